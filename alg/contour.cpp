@@ -37,8 +37,10 @@
 
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_thread_pool.h"
 #include "cpl_conv.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
@@ -210,6 +212,318 @@ struct GDALRingAppender
     void *data_;
 };
 
+/************************************************************************/
+/*                      Multi-threaded line contouring                  */
+/************************************************************************/
+
+namespace
+{
+
+// Collects the (possibly partial) linestrings generated for a strip of lines
+struct StripLineCollector
+{
+    struct Line
+    {
+        double level;
+        marching_squares::LineString ls;
+    };
+
+    std::vector<Line> lines{};
+
+    void addLine(double level, marching_squares::LineString &ls,
+                 bool /*closed*/)
+    {
+        lines.push_back(Line{level, std::move(ls)});
+    }
+};
+
+template <typename LevelGenerator> struct ContourStripJob
+{
+    LevelGenerator *levels = nullptr;
+    size_t width = 0;
+    size_t height = 0;
+    bool useNoData = false;
+    double noDataValue = 0.0;
+    // Index of the first line of the strip
+    size_t startLine = 0;
+    size_t lineCount = 0;
+    // Values of line startLine - 1 (if startLine > 0), followed by the
+    // lineCount lines of the strip
+    const double *data = nullptr;
+
+    StripLineCollector collector{};
+    std::string errorMsg{};
+};
+
+template <typename LevelGenerator> void ContourStripJobFunc(void *pData)
+{
+    using namespace marching_squares;
+    auto job = static_cast<ContourStripJob<LevelGenerator> *>(pData);
+    try
+    {
+        // Lines not completed in the strip are flushed to the collector
+        // when the merger is destroyed.
+        SegmentMerger<StripLineCollector, LevelGenerator> merger(
+            job->collector, *(job->levels), /* polygonize */ false);
+        ContourGenerator<decltype(merger), LevelGenerator> cg(
+            job->width, job->height, job->useNoData, job->noDataValue, merger,
+            *(job->levels));
+        cg.setStartLine(job->startLine,
+                        job->startLine > 0 ? job->data : nullptr);
+        for (size_t i = 0; i < job->lineCount; ++i)
+            cg.feedLine(job->data + (i + 1) * job->width);
+    }
+    catch (const std::exception &e)
+    {
+        job->errorMsg = e.what();
+    }
+}
+
+// Joins the pieces of contour lines generated independently by the strips,
+// and emits them once no further piece can be connected to them.
+class ContourStripStitcher
+{
+  public:
+    explicit ContourStripStitcher(GDALRingAppender &appender)
+        : appender_(appender)
+    {
+    }
+
+    ~ContourStripStitcher()
+    {
+        for (auto &chain : chains_)
+            appender_.addLine(chain.level, chain.ls, /* closed */ false);
+    }
+
+    // Must be called before adding the pieces of a strip. Pieces can only
+    // be connected through points located on the top seam of the strip
+    // (y == topY), and can be connected later to pieces of the next strip
+    // if they have an end on its bottom seam (y == bottomY).
+    void beginStrip(double topY, double bottomY)
+    {
+        topY_ = topY;
+        bottomY_ = bottomY;
+    }
+
+    void addPiece(double level, marching_squares::LineString &ls)
+    {
+        if (ls.front() == ls.back())
+        {
+            appender_.addLine(level, ls, /* closed */ true);
+            return;
+        }
+        if (ls.front().y != topY_ && ls.back().y != topY_ &&
+            ls.front().y != bottomY_ && ls.back().y != bottomY_)
+        {
+            appender_.addLine(level, ls, ls.front() == ls.back());
+            return;
+        }
+
+        chains_.push_back(StripLineCollector::Line{level, std::move(ls)});
+        auto chain = std::prev(chains_.end());
+        while (true)
+        {
+            auto other = ends_.end();
+            for (const auto *pt : {&chain->ls.front(), &chain->ls.back()})
+            {
+                if (pt->y == topY_)
+                {
+                    other = ends_.find(makeKey(level, *pt));
+                    if (other != ends_.end())
+                        break;
+                }
+            }
+            if (other == ends_.end())
+                break;
+            join(chain, other->second);
+        }
+
+        if (chain->ls.front() == chain->ls.back())
+        {
+            appender_.addLine(level, chain->ls, /* closed */ true);
+            chains_.erase(chain);
+        }
+        else
+        {
+            registerEnds(chain);
+        }
+    }
+
+    // Must be called once all pieces of a strip have been added. Emits the
+    // lines that cannot be extended by the next strip.
+    void endStrip()
+    {
+        ends_.clear();
+        auto it = chains_.begin();
+        while (it != chains_.end())
+        {
+            if (it->ls.front().y != bottomY_ && it->ls.back().y != bottomY_)
+            {
+                appender_.addLine(it->level, it->ls, /* closed */ false);
+                it = chains_.erase(it);
+            }
+            else
+            {
+                registerEnds(it);
+                ++it;
+            }
+        }
+    }
+
+  private:
+    typedef std::list<StripLineCollector::Line> Chains;
+    typedef std::tuple<double, double, double> Key;
+
+    GDALRingAppender &appender_;
+    double topY_ = 0;
+    double bottomY_ = 0;
+    Chains chains_{};
+    // Lines having an end on the top or bottom seam of the current strip,
+    // indexed by level and end point
+    std::map<Key, Chains::iterator> ends_{};
+
+    static Key makeKey(double level, const marching_squares::Point &pt)
+    {
+        return std::make_tuple(level, pt.x, pt.y);
+    }
+
+    void registerEnds(Chains::iterator chain)
+    {
+        for (const auto *pt : {&chain->ls.front(), &chain->ls.back()})
+        {
+            if (pt->y == topY_ || pt->y == bottomY_)
+                ends_[makeKey(chain->level, *pt)] = chain;
+        }
+    }
+
+    void unregisterEnds(Chains::iterator chain)
+    {
+        for (const auto *pt : {&chain->ls.front(), &chain->ls.back()})
+        {
+            auto it = ends_.find(makeKey(chain->level, *pt));
+            if (it != ends_.end() && it->second == chain)
+                ends_.erase(it);
+        }
+    }
+
+    // Appends other to chain, through their common end point
+    void join(Chains::iterator chain, Chains::iterator other)
+    {
+        unregisterEnds(other);
+        auto &ls = chain->ls;
+        auto &otherLs = other->ls;
+        if (ls.front() == otherLs.front() || ls.front() == otherLs.back())
+            ls.reverse();
+        if (otherLs.back() == ls.back())
+            otherLs.reverse();
+        ls.pop_back();
+        ls.splice(ls.end(), otherLs);
+        chains_.erase(other);
+    }
+};
+
+template <typename LevelGenerator>
+bool ContourGenerateMT(GDALRasterBandH hBand, bool useNoData,
+                       double noDataValue, LevelGenerator &levels,
+                       GDALRingAppender &appender, CPLJobQueue *poJobQueue,
+                       int nThreads, GDALProgressFunc pfnProgress,
+                       void *pProgressArg)
+{
+    const size_t width = GDALGetRasterBandXSize(hBand);
+    const size_t height = GDALGetRasterBandYSize(hBand);
+
+    // Each job processes a strip of lines. Limit the size of the buffer
+    // holding the lines of all the strips processed concurrently.
+    constexpr size_t MAX_BUFFER_VALUES = 32 * 1024 * 1024;
+    const size_t linesPerStrip = std::max<size_t>(
+        16, std::min<size_t>(1024, MAX_BUFFER_VALUES / nThreads / width));
+    const size_t linesPerGroup = linesPerStrip * nThreads;
+
+    std::vector<double> buffer;
+    std::vector<ContourStripJob<LevelGenerator>> jobs(nThreads);
+    ContourStripStitcher stitcher(appender);
+    try
+    {
+        buffer.resize((std::min(linesPerGroup, height) + 1) * width);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate contouring buffer");
+        return false;
+    }
+
+    for (size_t groupStart = 0; groupStart < height;
+         groupStart += linesPerGroup)
+    {
+        if (!pfnProgress(double(groupStart) / height, "Processing line",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+
+        // The first line of the buffer holds the last line of the previous
+        // group.
+        const size_t groupLines = std::min(linesPerGroup, height - groupStart);
+        if (groupStart > 0)
+        {
+            std::copy(buffer.begin() + linesPerGroup * width,
+                      buffer.begin() + (linesPerGroup + 1) * width,
+                      buffer.begin());
+        }
+        if (GDALRasterIO(hBand, GF_Read, 0, int(groupStart), int(width),
+                         int(groupLines), &buffer[width], int(width),
+                         int(groupLines), GDT_Float64, 0, 0) != CE_None)
+        {
+            return false;
+        }
+
+        size_t jobCount = 0;
+        for (size_t start = 0; start < groupLines; start += linesPerStrip)
+        {
+            auto &job = jobs[jobCount++];
+            job.levels = &levels;
+            job.width = width;
+            job.height = height;
+            job.useNoData = useNoData;
+            job.noDataValue = noDataValue;
+            job.startLine = groupStart + start;
+            job.lineCount = std::min(linesPerStrip, groupLines - start);
+            job.data = &buffer[start * width];
+            job.collector.lines.clear();
+            job.errorMsg.clear();
+            poJobQueue->SubmitJob(ContourStripJobFunc<LevelGenerator>, &job);
+        }
+        poJobQueue->WaitCompletion();
+
+        for (size_t i = 0; i < jobCount; ++i)
+        {
+            auto &job = jobs[i];
+            if (!job.errorMsg.empty())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         job.errorMsg.c_str());
+                return false;
+            }
+            // Coordinates of the lines of pixel centers shared with the
+            // previous and next strips. The last strip also processes the
+            // squares below the last line, and has no bottom seam.
+            const size_t endLine = job.startLine + job.lineCount;
+            stitcher.beginStrip(job.startLine - .5,
+                                endLine == height ? marching_squares::NaN
+                                                  : endLine - .5);
+            for (auto &line : job.collector.lines)
+                stitcher.addPiece(line.level, line.ls);
+            stitcher.endStrip();
+        }
+    }
+    pfnProgress(1.0, "", pProgressArg);
+    return true;
+}
+
+}  // namespace
+
 /************************************************************************/
 /* ==================================================================== */
 /*                   Additional C Callable Functions                    */
@@ -545,6 +859,16 @@ mode.
  *
  * If YES, contour polygons will be created, rather than polygon lines.
  *
+ *   NUM_THREADS=number|ALL_CPUS
+ *
+ * (GDAL >= 3.10) Number of worker threads used to generate contour lines.
+ * Defaults to the value of the GDAL_NUM_THREADS configuration option, or 1.
+ * When greater than 1, strips of lines are contoured in parallel, and the
+ * pieces of contour lines crossing the boundaries between strips are joined
+ * in the calling thread, which writes them to the layer. Contour lines are
+ * the same as with a single thread, but may be written in a different order.
+ * Only used in line contouring mode.
+ *
  *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
@@ -643,6 +967,21 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
 
     bool polygonize = CPLFetchBool(options, "POLYGONIZE", false);
 
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(options, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads)));
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1 && !polygonize)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
     using namespace marching_squares;
 
     OGRContourWriterInfo oCWI;
@@ -740,32 +1079,60 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
             {
                 FixedLevelRangeIterator levels(&fixedLevels[0],
                                                fixedLevels.size());
-                SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (poJobQueue)
+                {
+                    ok = ContourGenerateMT(hBand, useNoData, noDataValue,
+                                           levels, appender, poJobQueue.get(),
+                                           nThreads, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender, FixedLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               FixedLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
             else if (expBase > 0.0)
             {
                 ExponentialLevelRangeIterator levels(expBase);
-                SegmentMerger<GDALRingAppender, ExponentialLevelRangeIterator>
-                    writer(appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           ExponentialLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (poJobQueue)
+                {
+                    ok = ContourGenerateMT(hBand, useNoData, noDataValue,
+                                           levels, appender, poJobQueue.get(),
+                                           nThreads, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender,
+                                  ExponentialLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               ExponentialLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
             else
             {
                 IntervalLevelRangeIterator levels(contourBase, contourInterval);
-                SegmentMerger<GDALRingAppender, IntervalLevelRangeIterator>
-                    writer(appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           IntervalLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (poJobQueue)
+                {
+                    ok = ContourGenerateMT(hBand, useNoData, noDataValue,
+                                           levels, appender, poJobQueue.get(),
+                                           nThreads, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender, IntervalLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               IntervalLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
         }
     }
@@ -60,6 +60,9 @@ int CPL_DLL CPL_STDCALL GDALDitherRGB2PCT(
 int CPL_DLL CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff,
                                           int nYOff, int nXSize, int nYSize);
 
+CPLErr CPL_DLL GDALHashImage(GDALRasterBandH hBand, int nXOff, int nYOff,
+                             int nXSize, int nYSize, GUInt64 *pnHash);
+
 CPLErr CPL_DLL CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
                                                 GDALRasterBandH hProximityBand,
                                                 char **papszOptions,
@@ -88,6 +91,13 @@ CPLErr CPL_DLL CPL_STDCALL GDALSieveFilter(
     GDALRasterBandH hDstBand, int nSizeThreshold, int nConnectedness,
     char **papszOptions, GDALProgressFunc pfnProgress, void *pProgressArg);
 
+CPLErr CPL_DLL GDALZonalStatistics(GDALRasterBandH hSrcBand,
+                                   GDALRasterBandH hZoneBand,
+                                   OGRLayerH hZoneLayer, OGRLayerH hDstLayer,
+                                   CSLConstList papszOptions,
+                                   GDALProgressFunc pfnProgress,
+                                   void *pProgressArg);
+
 /*
  * Warp Related.
  */
@@ -35,6 +35,7 @@
 #ifndef DOXYGEN_SKIP
 
 #include <cstdint>
+#include <memory>
 
 #include <set>
 
@@ -94,6 +95,7 @@ typedef enum
 
 typedef void (*llScanlineFunc)(void *, int, int, int, double);
 typedef void (*llPointFunc)(void *, int, int, double);
+typedef void (*llCoverageFunc)(void *, int, int, double);
 
 void GDALdllImagePoint(int nRasterXSize, int nRasterYSize, int nPartCount,
                        const int *panPartSize, const double *padfX,
@@ -120,6 +122,12 @@ void GDALdllImageFilledPolygon(int nRasterXSize, int nRasterYSize,
                                llScanlineFunc pfnScanlineFunc, void *pCBData,
                                bool bAvoidBurningSamePoints);
 
+void GDALdllImagePolygonCoverage(int nRasterXSize, int nRasterYSize,
+                                 int nPartCount, const int *panPartSize,
+                                 const double *padfX, const double *padfY,
+                                 llCoverageFunc pfnCoverageFunc,
+                                 void *pCBData);
+
 CPL_C_END
 
 /************************************************************************/
@@ -215,6 +223,12 @@ typedef struct
     bool bReversed;
     double dfOversampleFactor;
 
+    // Number of threads used to generate the backmap.
+    int nThreads;
+
+    // Name of the file in which the backmap is persisted, or nullptr.
+    char *pszBackMapCacheFilename;
+
     // Map from target georef coordinates back to geolocation array
     // pixel line coordinates.  Built only if needed.
     int nBackMapWidth;
@@ -394,6 +408,23 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                                     int bReversed, const char *pszSourceDataset,
                                     CSLConstList papszTransformOptions);
 
+class GDALWarpPreparedCutline;
+
+struct GDALWarpPreparedCutlineDeleter
+{
+    void operator()(GDALWarpPreparedCutline *) const;
+};
+
+std::unique_ptr<GDALWarpPreparedCutline, GDALWarpPreparedCutlineDeleter>
+GDALWarpCreatePreparedCutline(OGRGeometryH hCutline, double dfBlendDist,
+                              CSLConstList papszWarpOptions);
+
+CPLErr GDALWarpCutlineMaskerPrepared(GDALWarpPreparedCutline *poPreparedCutline,
+                                     void *pMaskFuncArg, int nXOff, int nYOff,
+                                     int nXSize, int nYSize,
+                                     float *pafValidityMask,
+                                     int *pnValidityFlag);
+
 #endif /* #ifndef DOXYGEN_SKIP */
 
 #endif /* ndef GDAL_ALG_PRIV_H_INCLUDED */
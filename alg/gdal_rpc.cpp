@@ -38,6 +38,7 @@
 #include <algorithm>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -357,20 +358,15 @@ static double RPCEvaluate(const double *padfTerms, const double *padfCoefs)
 #endif
 
 /************************************************************************/
-/*                         RPCTransformPoint()                          */
+/*                      RPCComputeNormalizedTerms()                     */
 /************************************************************************/
 
-static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
-                              double dfLong, double dfLat, double dfHeight,
-                              double *pdfPixel, double *pdfLine)
-
+// Compute the 20 terms of the RPC polynomials for a point, from its
+// (non-normalized) longitude, latitude and height.
+static void RPCComputeNormalizedTerms(
+    const GDALRPCTransformInfo *psRPCTransformInfo, double dfLong,
+    double dfLat, double dfHeight, double *padfTerms)
 {
-    double adfTermsWithMargin[20 + 1] = {};
-    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
-    double *padfTerms =
-        adfTermsWithMargin +
-        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
-
     // Avoid dateline issues.
     double diffLong = dfLong - psRPCTransformInfo->sRPC.dfLONG_OFF;
     if (diffLong < -270)
@@ -442,6 +438,25 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
 
     RPCComputeTerms(dfNormalizedLong, dfNormalizedLat, dfNormalizedHeight,
                     padfTerms);
+}
+
+/************************************************************************/
+/*                         RPCTransformPoint()                          */
+/************************************************************************/
+
+static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
+                              double dfLong, double dfLat, double dfHeight,
+                              double *pdfPixel, double *pdfLine)
+
+{
+    double adfTermsWithMargin[20 + 1] = {};
+    // Make padfTerms aligned on 16-byte boundary for SSE2 aligned loads.
+    double *padfTerms =
+        adfTermsWithMargin +
+        (reinterpret_cast<GUIntptr_t>(adfTermsWithMargin) % 16) / 8;
+
+    RPCComputeNormalizedTerms(psRPCTransformInfo, dfLong, dfLat, dfHeight,
+                              padfTerms);
 
 #ifdef USE_SSE2_OPTIM
     double dfSampNum = 0.0;
@@ -470,6 +485,84 @@ static void RPCTransformPoint(const GDALRPCTransformInfo *psRPCTransformInfo,
                psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
 }
 
+/************************************************************************/
+/*                         RPCTransformPoints()                         */
+/************************************************************************/
+
+// Same as calling RPCTransformPoint() on each point, with the same results,
+// but evaluating the polynomials of 2 points at once.
+static void RPCTransformPoints(const GDALRPCTransformInfo *psRPCTransformInfo,
+                               int nPointCount, const double *padfLong,
+                               const double *padfLat, const double *padfHeight,
+                               double *padfPixel, double *padfLine)
+{
+    int i = 0;
+#ifdef USE_SSE2_OPTIM
+    const double *padfCoeffs = psRPCTransformInfo->padfCoeffs;
+    for (; i + 1 < nPointCount; i += 2)
+    {
+        double adfTerms0[20];
+        double adfTerms1[20];
+        RPCComputeNormalizedTerms(psRPCTransformInfo, padfLong[i], padfLat[i],
+                                  padfHeight[i], adfTerms0);
+        RPCComputeNormalizedTerms(psRPCTransformInfo, padfLong[i + 1],
+                                  padfLat[i + 1], padfHeight[i + 1],
+                                  adfTerms1);
+
+        // Each lane holds one point. As in RPCEvaluate4(), the even and odd
+        // terms are summed separately, and then added together.
+        XMMReg2Double aSumsEven[4] = {
+            XMMReg2Double::Zero(), XMMReg2Double::Zero(),
+            XMMReg2Double::Zero(), XMMReg2Double::Zero()};
+        XMMReg2Double aSumsOdd[4] = {
+            XMMReg2Double::Zero(), XMMReg2Double::Zero(),
+            XMMReg2Double::Zero(), XMMReg2Double::Zero()};
+        for (int k = 0; k < 20; k += 2)
+        {
+            const double adfTermsEven[2] = {adfTerms0[k], adfTerms1[k]};
+            const double adfTermsOdd[2] = {adfTerms0[k + 1], adfTerms1[k + 1]};
+            const auto termsEven = XMMReg2Double::Load2Val(adfTermsEven);
+            const auto termsOdd = XMMReg2Double::Load2Val(adfTermsOdd);
+            for (int iPoly = 0; iPoly < 4; ++iPoly)
+            {
+                aSumsEven[iPoly] +=
+                    termsEven *
+                    XMMReg2Double::Load1ValHighAndLow(padfCoeffs + 20 * iPoly +
+                                                      k);
+                aSumsOdd[iPoly] +=
+                    termsOdd * XMMReg2Double::Load1ValHighAndLow(
+                                   padfCoeffs + 20 * iPoly + k + 1);
+            }
+        }
+
+        // LINE_NUM_COEFF, LINE_DEN_COEFF, SAMP_NUM_COEFF, SAMP_DEN_COEFF.
+        double adfResultX[2];
+        double adfResultY[2];
+        ((aSumsEven[2] + aSumsOdd[2]) / (aSumsEven[3] + aSumsOdd[3]))
+            .Store2Val(adfResultX);
+        ((aSumsEven[0] + aSumsOdd[0]) / (aSumsEven[1] + aSumsOdd[1]))
+            .Store2Val(adfResultY);
+
+        for (int j = 0; j < 2; ++j)
+        {
+            // RPCs are using the center of upper left pixel = 0,0 convention
+            // convert to top left corner = 0,0 convention used in GDAL.
+            padfPixel[i + j] =
+                adfResultX[j] * psRPCTransformInfo->sRPC.dfSAMP_SCALE +
+                psRPCTransformInfo->sRPC.dfSAMP_OFF + 0.5;
+            padfLine[i + j] =
+                adfResultY[j] * psRPCTransformInfo->sRPC.dfLINE_SCALE +
+                psRPCTransformInfo->sRPC.dfLINE_OFF + 0.5;
+        }
+    }
+#endif
+    for (; i < nPointCount; ++i)
+    {
+        RPCTransformPoint(psRPCTransformInfo, padfLong[i], padfLat[i],
+                          padfHeight[i], padfPixel + i, padfLine + i);
+    }
+}
+
 /************************************************************************/
 /*                     GDALSerializeRPCDEMResample()                    */
 /************************************************************************/
@@ -1120,30 +1213,247 @@ void GDALDestroyRPCTransformer(void *pTransformAlg)
 }
 
 /************************************************************************/
-/*                      RPCInverseTransformPoint()                      */
+/*                        RPCInverseState                               */
 /************************************************************************/
 
-static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
-                                     double dfPixel, double dfLine,
-                                     double dfUserHeight, double *pdfLong,
-                                     double *pdfLat)
+namespace
+{
+// State of the iterative inversion of a point.
+struct RPCInverseState
+{
+    double dfPixel = 0.0;
+    double dfLine = 0.0;
+    double dfUserHeight = 0.0;
+    double dfResultX = 0.0;
+    double dfResultY = 0.0;
+    double dfPixelDeltaX = 0.0;
+    double dfPixelDeltaY = 0.0;
+    double dfLastResultX = 0.0;
+    double dfLastResultY = 0.0;
+    double dfLastPixelDeltaX = 0.0;
+    double dfLastPixelDeltaY = 0.0;
+    bool bLastPixelDeltaValid = false;
+    int nCountConsecutiveErrorBelow2 = 0;
+};
+}  // namespace
+
+/************************************************************************/
+/*                       RPCInverseInitState()                          */
+/************************************************************************/
 
+static void RPCInverseInitState(const GDALRPCTransformInfo *psTransform,
+                                double dfPixel, double dfLine,
+                                double dfUserHeight, RPCInverseState &sState)
 {
-    // Memo:
-    // Known to work with 40 iterations with DEM on all points (int coord and
-    // +0.5,+0.5 shift) of flock1.20160216_041050_0905.tif, especially on (0,0).
+    sState.dfPixel = dfPixel;
+    sState.dfLine = dfLine;
+    sState.dfUserHeight = dfUserHeight;
 
     /* -------------------------------------------------------------------- */
     /*      Compute an initial approximation based on linear                */
     /*      interpolation from our reference point.                         */
     /* -------------------------------------------------------------------- */
-    double dfResultX = psTransform->adfPLToLatLongGeoTransform[0] +
+    sState.dfResultX = psTransform->adfPLToLatLongGeoTransform[0] +
                        psTransform->adfPLToLatLongGeoTransform[1] * dfPixel +
                        psTransform->adfPLToLatLongGeoTransform[2] * dfLine;
 
-    double dfResultY = psTransform->adfPLToLatLongGeoTransform[3] +
+    sState.dfResultY = psTransform->adfPLToLatLongGeoTransform[3] +
                        psTransform->adfPLToLatLongGeoTransform[4] * dfPixel +
                        psTransform->adfPLToLatLongGeoTransform[5] * dfLine;
+}
+
+/************************************************************************/
+/*                    RPCInverseGetMaxIterations()                      */
+/************************************************************************/
+
+static int RPCInverseGetMaxIterations(const GDALRPCTransformInfo *psTransform)
+{
+    return (psTransform->nMaxIterations > 0) ? psTransform->nMaxIterations
+           : (psTransform->poDS != nullptr)  ? 20
+                                             : 10;
+}
+
+/************************************************************************/
+/*                       RPCInverseGetDEMHeight()                       */
+/************************************************************************/
+
+// Get the DEM height at the current guess of iteration iIter.
+static bool RPCInverseGetDEMHeight(GDALRPCTransformInfo *psTransform,
+                                   const RPCInverseState &sState, int iIter,
+                                   double &dfDEMH)
+{
+    const double dfPixel = sState.dfPixel;
+    const double dfLine = sState.dfLine;
+    const double dfResultX = sState.dfResultX;
+    const double dfResultY = sState.dfResultY;
+
+    dfDEMH = 0.0;
+    double dfDEMPixel = 0.0;
+    double dfDEMLine = 0.0;
+    if (!GDALRPCGetHeightAtLongLat(psTransform, dfResultX, dfResultY, &dfDEMH,
+                                   &dfDEMPixel, &dfDEMLine))
+    {
+        if (psTransform->poDS)
+        {
+            CPLDebug("RPC", "DEM (pixel, line) = (%g, %g)", dfDEMPixel,
+                     dfDEMLine);
+        }
+
+        // The first time, the guess might be completely out of the
+        // validity of the DEM, so pickup the "reference Z" as the
+        // first guess or the closest point of the DEM by snapping to it.
+        if (iIter == 0)
+        {
+            bool bUseRefZ = true;
+            if (psTransform->poDS)
+            {
+                if (dfDEMPixel >= psTransform->poDS->GetRasterXSize())
+                    dfDEMPixel = psTransform->poDS->GetRasterXSize() - 0.5;
+                else if (dfDEMPixel < 0)
+                    dfDEMPixel = 0.5;
+                if (dfDEMLine >= psTransform->poDS->GetRasterYSize())
+                    dfDEMLine = psTransform->poDS->GetRasterYSize() - 0.5;
+                else if (dfDEMPixel < 0)
+                    dfDEMPixel = 0.5;
+                if (GDALRPCGetDEMHeight(psTransform, dfDEMPixel, dfDEMLine,
+                                        &dfDEMH))
+                {
+                    bUseRefZ = false;
+                    CPLDebug("RPC",
+                             "Iteration %d for (pixel, line) = (%g, %g): "
+                             "No elevation value at %.15g %.15g. "
+                             "Using elevation %g at DEM (pixel, line) = "
+                             "(%g, %g) (snapping to boundaries) instead",
+                             iIter, dfPixel, dfLine, dfResultX, dfResultY,
+                             dfDEMH, dfDEMPixel, dfDEMLine);
+                }
+            }
+            if (bUseRefZ)
+            {
+                dfDEMH = psTransform->dfRefZ;
+                CPLDebug("RPC",
+                         "Iteration %d for (pixel, line) = (%g, %g): "
+                         "No elevation value at %.15g %.15g. "
+                         "Using elevation %g of reference point instead",
+                         iIter, dfPixel, dfLine, dfResultX, dfResultY, dfDEMH);
+            }
+        }
+        else
+        {
+            CPLDebug("RPC",
+                     "Iteration %d for (pixel, line) = (%g, %g): "
+                     "No elevation value at %.15g %.15g. Erroring out",
+                     iIter, dfPixel, dfLine, dfResultX, dfResultY);
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         RPCInverseUpdate()                           */
+/************************************************************************/
+
+// Update the guess from the pixel error (sState.dfPixelDeltaX/Y) of the
+// current one. Returns true if the current guess has converged.
+static bool RPCInverseUpdate(const GDALRPCTransformInfo *psTransform,
+                             RPCInverseState &sState)
+{
+    const double dfPixelDeltaX = sState.dfPixelDeltaX;
+    const double dfPixelDeltaY = sState.dfPixelDeltaY;
+    const double dfError =
+        std::max(std::abs(dfPixelDeltaX), std::abs(dfPixelDeltaY));
+    if (dfError < psTransform->dfPixErrThreshold)
+    {
+        if (psTransform->bRPCInverseVerbose)
+        {
+            CPLDebug("RPC", "Converged!");
+        }
+        return true;
+    }
+    else if (psTransform->poDS != nullptr && sState.bLastPixelDeltaValid &&
+             dfPixelDeltaX * sState.dfLastPixelDeltaX < 0 &&
+             dfPixelDeltaY * sState.dfLastPixelDeltaY < 0)
+    {
+        // When there is a DEM, if the error changes sign, we might
+        // oscillate forever, so take a mean position as a new guess.
+        if (psTransform->bRPCInverseVerbose)
+        {
+            CPLDebug("RPC", "Oscillation detected. "
+                            "Taking mean of 2 previous results as new guess");
+        }
+        const double dfLastPixelDeltaX = sState.dfLastPixelDeltaX;
+        const double dfLastPixelDeltaY = sState.dfLastPixelDeltaY;
+        sState.dfResultX = (fabs(dfPixelDeltaX) * sState.dfLastResultX +
+                            fabs(dfLastPixelDeltaX) * sState.dfResultX) /
+                           (fabs(dfPixelDeltaX) + fabs(dfLastPixelDeltaX));
+        sState.dfResultY = (fabs(dfPixelDeltaY) * sState.dfLastResultY +
+                            fabs(dfLastPixelDeltaY) * sState.dfResultY) /
+                           (fabs(dfPixelDeltaY) + fabs(dfLastPixelDeltaY));
+        sState.bLastPixelDeltaValid = false;
+        sState.nCountConsecutiveErrorBelow2 = 0;
+        return false;
+    }
+
+    double dfBoostFactor = 1.0;
+    if (psTransform->poDS != nullptr &&
+        sState.nCountConsecutiveErrorBelow2 >= 5 && dfError < 2)
+    {
+        // When there is a DEM, if we remain below a given threshold
+        // (somewhat arbitrarily set to 2 pixels) for some time, apply a
+        // "boost factor" for the new guessed result, in the hope we will go
+        // out of the somewhat current stuck situation.
+        dfBoostFactor = 10;
+        if (psTransform->bRPCInverseVerbose)
+        {
+            CPLDebug("RPC", "Applying boost factor 10");
+        }
+    }
+
+    if (dfError < 2)
+        sState.nCountConsecutiveErrorBelow2++;
+    else
+        sState.nCountConsecutiveErrorBelow2 = 0;
+
+    const double dfNewResultX =
+        sState.dfResultX -
+        (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[1] *
+         dfBoostFactor) -
+        (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[2] *
+         dfBoostFactor);
+    const double dfNewResultY =
+        sState.dfResultY -
+        (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[4] *
+         dfBoostFactor) -
+        (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[5] *
+         dfBoostFactor);
+
+    sState.dfLastResultX = sState.dfResultX;
+    sState.dfLastResultY = sState.dfResultY;
+    sState.dfResultX = dfNewResultX;
+    sState.dfResultY = dfNewResultY;
+    sState.dfLastPixelDeltaX = dfPixelDeltaX;
+    sState.dfLastPixelDeltaY = dfPixelDeltaY;
+    sState.bLastPixelDeltaValid = true;
+    return false;
+}
+
+/************************************************************************/
+/*                      RPCInverseTransformPoint()                      */
+/************************************************************************/
+
+static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
+                                     double dfPixel, double dfLine,
+                                     double dfUserHeight, double *pdfLong,
+                                     double *pdfLat)
+
+{
+    // Memo:
+    // Known to work with 40 iterations with DEM on all points (int coord and
+    // +0.5,+0.5 shift) of flock1.20160216_041050_0905.tif, especially on (0,0).
+
+    RPCInverseState sState;
+    RPCInverseInitState(psTransform, dfPixel, dfLine, dfUserHeight, sState);
 
     if (psTransform->bRPCInverseVerbose)
     {
@@ -1171,18 +1481,7 @@ static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
     /*      Now iterate, trying to find a closer LL location that will      */
     /*      back transform to the indicated pixel and line.                 */
     /* -------------------------------------------------------------------- */
-    double dfPixelDeltaX = 0.0;
-    double dfPixelDeltaY = 0.0;
-    double dfLastResultX = 0.0;
-    double dfLastResultY = 0.0;
-    double dfLastPixelDeltaX = 0.0;
-    double dfLastPixelDeltaY = 0.0;
-    bool bLastPixelDeltaValid = false;
-    const int nMaxIterations = (psTransform->nMaxIterations > 0)
-                                   ? psTransform->nMaxIterations
-                               : (psTransform->poDS != nullptr) ? 20
-                                                                : 10;
-    int nCountConsecutiveErrorBelow2 = 0;
+    const int nMaxIterations = RPCInverseGetMaxIterations(psTransform);
 
     int iIter = 0;  // Used after for.
     for (; iIter < nMaxIterations; iIter++)
@@ -1192,179 +1491,145 @@ static bool RPCInverseTransformPoint(GDALRPCTransformInfo *psTransform,
 
         // Update DEMH.
         double dfDEMH = 0.0;
-        double dfDEMPixel = 0.0;
-        double dfDEMLine = 0.0;
-        if (!GDALRPCGetHeightAtLongLat(psTransform, dfResultX, dfResultY,
-                                       &dfDEMH, &dfDEMPixel, &dfDEMLine))
+        if (!RPCInverseGetDEMHeight(psTransform, sState, iIter, dfDEMH))
         {
-            if (psTransform->poDS)
-            {
-                CPLDebug("RPC", "DEM (pixel, line) = (%g, %g)", dfDEMPixel,
-                         dfDEMLine);
-            }
-
-            // The first time, the guess might be completely out of the
-            // validity of the DEM, so pickup the "reference Z" as the
-            // first guess or the closest point of the DEM by snapping to it.
-            if (iIter == 0)
-            {
-                bool bUseRefZ = true;
-                if (psTransform->poDS)
-                {
-                    if (dfDEMPixel >= psTransform->poDS->GetRasterXSize())
-                        dfDEMPixel = psTransform->poDS->GetRasterXSize() - 0.5;
-                    else if (dfDEMPixel < 0)
-                        dfDEMPixel = 0.5;
-                    if (dfDEMLine >= psTransform->poDS->GetRasterYSize())
-                        dfDEMLine = psTransform->poDS->GetRasterYSize() - 0.5;
-                    else if (dfDEMPixel < 0)
-                        dfDEMPixel = 0.5;
-                    if (GDALRPCGetDEMHeight(psTransform, dfDEMPixel, dfDEMLine,
-                                            &dfDEMH))
-                    {
-                        bUseRefZ = false;
-                        CPLDebug("RPC",
-                                 "Iteration %d for (pixel, line) = (%g, %g): "
-                                 "No elevation value at %.15g %.15g. "
-                                 "Using elevation %g at DEM (pixel, line) = "
-                                 "(%g, %g) (snapping to boundaries) instead",
-                                 iIter, dfPixel, dfLine, dfResultX, dfResultY,
-                                 dfDEMH, dfDEMPixel, dfDEMLine);
-                    }
-                }
-                if (bUseRefZ)
-                {
-                    dfDEMH = psTransform->dfRefZ;
-                    CPLDebug("RPC",
-                             "Iteration %d for (pixel, line) = (%g, %g): "
-                             "No elevation value at %.15g %.15g. "
-                             "Using elevation %g of reference point instead",
-                             iIter, dfPixel, dfLine, dfResultX, dfResultY,
-                             dfDEMH);
-                }
-            }
-            else
-            {
-                CPLDebug("RPC",
-                         "Iteration %d for (pixel, line) = (%g, %g): "
-                         "No elevation value at %.15g %.15g. Erroring out",
-                         iIter, dfPixel, dfLine, dfResultX, dfResultY);
-                if (fpLog)
-                    VSIFCloseL(fpLog);
-                return false;
-            }
+            if (fpLog)
+                VSIFCloseL(fpLog);
+            return false;
         }
 
+        const double dfResultX = sState.dfResultX;
+        const double dfResultY = sState.dfResultY;
         RPCTransformPoint(psTransform, dfResultX, dfResultY,
                           dfUserHeight + dfDEMH, &dfBackPixel, &dfBackLine);
 
-        dfPixelDeltaX = dfBackPixel - dfPixel;
-        dfPixelDeltaY = dfBackLine - dfLine;
+        sState.dfPixelDeltaX = dfBackPixel - dfPixel;
+        sState.dfPixelDeltaY = dfBackLine - dfLine;
 
         if (psTransform->bRPCInverseVerbose)
         {
             CPLDebug("RPC",
                      "Iter %d: dfPixelDeltaX=%.02f, dfPixelDeltaY=%.02f, "
                      "long=%f, lat=%f, height=%f",
-                     iIter, dfPixelDeltaX, dfPixelDeltaY, dfResultX, dfResultY,
-                     dfUserHeight + dfDEMH);
+                     iIter, sState.dfPixelDeltaX, sState.dfPixelDeltaY,
+                     dfResultX, dfResultY, dfUserHeight + dfDEMH);
         }
         if (fpLog != nullptr)
         {
             VSIFPrintfL(fpLog,
                         "%d,%.12f,%.12f,%f,\"POINT(%.12f %.12f)\",%f,%f\n",
                         iIter, dfResultX, dfResultY, dfUserHeight + dfDEMH,
-                        dfResultX, dfResultY, dfPixelDeltaX, dfPixelDeltaY);
+                        dfResultX, dfResultY, sState.dfPixelDeltaX,
+                        sState.dfPixelDeltaY);
         }
 
-        const double dfError =
-            std::max(std::abs(dfPixelDeltaX), std::abs(dfPixelDeltaY));
-        if (dfError < psTransform->dfPixErrThreshold)
+        if (RPCInverseUpdate(psTransform, sState))
         {
             iIter = -1;
-            if (psTransform->bRPCInverseVerbose)
-            {
-                CPLDebug("RPC", "Converged!");
-            }
             break;
         }
-        else if (psTransform->poDS != nullptr && bLastPixelDeltaValid &&
-                 dfPixelDeltaX * dfLastPixelDeltaX < 0 &&
-                 dfPixelDeltaY * dfLastPixelDeltaY < 0)
+    }
+    if (fpLog != nullptr)
+        VSIFCloseL(fpLog);
+
+    if (iIter != -1)
+    {
+        CPLDebug("RPC", "Failed Iterations %d: Got: %.16g,%.16g  Offset=%g,%g",
+                 iIter, sState.dfResultX, sState.dfResultY,
+                 sState.dfPixelDeltaX, sState.dfPixelDeltaY);
+        return false;
+    }
+
+    *pdfLong = sState.dfResultX;
+    *pdfLat = sState.dfResultY;
+    return true;
+}
+
+/************************************************************************/
+/*                      RPCInverseTransformPoints()                     */
+/************************************************************************/
+
+// Same as calling RPCInverseTransformPoint() on each point, with the same
+// results, but iterating on all points in lockstep, so that the forward
+// evaluations of each iteration are done in batch by RPCTransformPoints().
+static void RPCInverseTransformPoints(GDALRPCTransformInfo *psTransform,
+                                      int nPointCount, const double *padfPixel,
+                                      const double *padfLine,
+                                      const double *padfUserHeight,
+                                      double *padfLong, double *padfLat,
+                                      int *panSuccess)
+{
+    std::vector<RPCInverseState> asStates(nPointCount);
+    std::vector<int> anActive;
+    anActive.reserve(nPointCount);
+    for (int i = 0; i < nPointCount; ++i)
+    {
+        RPCInverseInitState(psTransform, padfPixel[i], padfLine[i],
+                            padfUserHeight[i], asStates[i]);
+        panSuccess[i] = FALSE;
+        anActive.push_back(i);
+    }
+
+    std::vector<int> anEval;
+    std::vector<double> adfLongEval;
+    std::vector<double> adfLatEval;
+    std::vector<double> adfHeightEval;
+    std::vector<double> adfBackPixel;
+    std::vector<double> adfBackLine;
+
+    const int nMaxIterations = RPCInverseGetMaxIterations(psTransform);
+    for (int iIter = 0; iIter < nMaxIterations && !anActive.empty(); iIter++)
+    {
+        anEval.clear();
+        adfLongEval.clear();
+        adfLatEval.clear();
+        adfHeightEval.clear();
+        for (const int i : anActive)
         {
-            // When there is a DEM, if the error changes sign, we might
-            // oscillate forever, so take a mean position as a new guess.
-            if (psTransform->bRPCInverseVerbose)
-            {
-                CPLDebug("RPC",
-                         "Oscillation detected. "
-                         "Taking mean of 2 previous results as new guess");
-            }
-            dfResultX = (fabs(dfPixelDeltaX) * dfLastResultX +
-                         fabs(dfLastPixelDeltaX) * dfResultX) /
-                        (fabs(dfPixelDeltaX) + fabs(dfLastPixelDeltaX));
-            dfResultY = (fabs(dfPixelDeltaY) * dfLastResultY +
-                         fabs(dfLastPixelDeltaY) * dfResultY) /
-                        (fabs(dfPixelDeltaY) + fabs(dfLastPixelDeltaY));
-            bLastPixelDeltaValid = false;
-            nCountConsecutiveErrorBelow2 = 0;
-            continue;
+            const RPCInverseState &sState = asStates[i];
+            double dfDEMH = 0.0;
+            if (!RPCInverseGetDEMHeight(psTransform, sState, iIter, dfDEMH))
+                continue;
+            anEval.push_back(i);
+            adfLongEval.push_back(sState.dfResultX);
+            adfLatEval.push_back(sState.dfResultY);
+            adfHeightEval.push_back(sState.dfUserHeight + dfDEMH);
         }
 
-        double dfBoostFactor = 1.0;
-        if (psTransform->poDS != nullptr && nCountConsecutiveErrorBelow2 >= 5 &&
-            dfError < 2)
+        const int nEvalCount = static_cast<int>(anEval.size());
+        adfBackPixel.resize(nEvalCount);
+        adfBackLine.resize(nEvalCount);
+        RPCTransformPoints(psTransform, nEvalCount, adfLongEval.data(),
+                           adfLatEval.data(), adfHeightEval.data(),
+                           adfBackPixel.data(), adfBackLine.data());
+
+        anActive.clear();
+        for (int k = 0; k < nEvalCount; ++k)
         {
-            // When there is a DEM, if we remain below a given threshold
-            // (somewhat arbitrarily set to 2 pixels) for some time, apply a
-            // "boost factor" for the new guessed result, in the hope we will go
-            // out of the somewhat current stuck situation.
-            dfBoostFactor = 10;
-            if (psTransform->bRPCInverseVerbose)
+            const int i = anEval[k];
+            RPCInverseState &sState = asStates[i];
+            sState.dfPixelDeltaX = adfBackPixel[k] - sState.dfPixel;
+            sState.dfPixelDeltaY = adfBackLine[k] - sState.dfLine;
+            if (RPCInverseUpdate(psTransform, sState))
+            {
+                padfLong[i] = sState.dfResultX;
+                padfLat[i] = sState.dfResultY;
+                panSuccess[i] = TRUE;
+            }
+            else
             {
-                CPLDebug("RPC", "Applying boost factor 10");
+                anActive.push_back(i);
             }
         }
-
-        if (dfError < 2)
-            nCountConsecutiveErrorBelow2++;
-        else
-            nCountConsecutiveErrorBelow2 = 0;
-
-        const double dfNewResultX =
-            dfResultX -
-            (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[1] *
-             dfBoostFactor) -
-            (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[2] *
-             dfBoostFactor);
-        const double dfNewResultY =
-            dfResultY -
-            (dfPixelDeltaX * psTransform->adfPLToLatLongGeoTransform[4] *
-             dfBoostFactor) -
-            (dfPixelDeltaY * psTransform->adfPLToLatLongGeoTransform[5] *
-             dfBoostFactor);
-
-        dfLastResultX = dfResultX;
-        dfLastResultY = dfResultY;
-        dfResultX = dfNewResultX;
-        dfResultY = dfNewResultY;
-        dfLastPixelDeltaX = dfPixelDeltaX;
-        dfLastPixelDeltaY = dfPixelDeltaY;
-        bLastPixelDeltaValid = true;
     }
-    if (fpLog != nullptr)
-        VSIFCloseL(fpLog);
 
-    if (iIter != -1)
+    for (const int i : anActive)
     {
+        const RPCInverseState &sState = asStates[i];
         CPLDebug("RPC", "Failed Iterations %d: Got: %.16g,%.16g  Offset=%g,%g",
-                 iIter, dfResultX, dfResultY, dfPixelDeltaX, dfPixelDeltaY);
-        return false;
+                 nMaxIterations, sState.dfResultX, sState.dfResultY,
+                 sState.dfPixelDeltaX, sState.dfPixelDeltaY);
     }
-
-    *pdfLong = dfResultX;
-    *pdfLat = dfResultY;
-    return true;
 }
 
 static double BiCubicKernel(double dfVal)
@@ -2146,6 +2411,16 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
             }
         }
 
+        // Fetch the heights of all points first, and then evaluate the
+        // polynomials in batch.
+        std::vector<int> anValid;
+        std::vector<double> adfLong;
+        std::vector<double> adfLat;
+        std::vector<double> adfHeight;
+        anValid.reserve(nPointCount);
+        adfLong.reserve(nPointCount);
+        adfLat.reserve(nPointCount);
+        adfHeight.reserve(nPointCount);
         for (int i = 0; i < nPointCount; i++)
         {
             if (!RPCIsValidLongLat(psTransform, padfX[i], padfY[i]))
@@ -2165,9 +2440,23 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
                 continue;
             }
 
-            RPCTransformPoint(psTransform, padfX[i], padfY[i],
-                              (padfZ ? padfZ[i] : 0.0) + dfHeight, padfX + i,
-                              padfY + i);
+            anValid.push_back(i);
+            adfLong.push_back(padfX[i]);
+            adfLat.push_back(padfY[i]);
+            adfHeight.push_back((padfZ ? padfZ[i] : 0.0) + dfHeight);
+        }
+
+        const int nValidCount = static_cast<int>(anValid.size());
+        std::vector<double> adfPixel(nValidCount);
+        std::vector<double> adfLine(nValidCount);
+        RPCTransformPoints(psTransform, nValidCount, adfLong.data(),
+                           adfLat.data(), adfHeight.data(), adfPixel.data(),
+                           adfLine.data());
+        for (int k = 0; k < nValidCount; ++k)
+        {
+            const int i = anValid[k];
+            padfX[i] = adfPixel[k];
+            padfY[i] = adfLine[k];
             panSuccess[i] = TRUE;
         }
 
@@ -2186,15 +2475,31 @@ int GDALRPCTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
     /*      function uses an iterative method from an initial linear        */
     /*      approximation.                                                  */
     /* -------------------------------------------------------------------- */
+    std::vector<double> adfResultX(nPointCount);
+    std::vector<double> adfResultY(nPointCount);
+    if (psTransform->bRPCInverseVerbose || psTransform->pszRPCInverseLog)
+    {
+        for (int i = 0; i < nPointCount; i++)
+        {
+            panSuccess[i] = RPCInverseTransformPoint(
+                psTransform, padfX[i], padfY[i], padfZ[i], &adfResultX[i],
+                &adfResultY[i]);
+        }
+    }
+    else
+    {
+        RPCInverseTransformPoints(psTransform, nPointCount, padfX, padfY,
+                                  padfZ, adfResultX.data(), adfResultY.data(),
+                                  panSuccess);
+    }
+
     for (int i = 0; i < nPointCount; i++)
     {
-        double dfResultX = 0.0;
-        double dfResultY = 0.0;
+        const double dfResultX = adfResultX[i];
+        const double dfResultY = adfResultY[i];
 
-        if (!RPCInverseTransformPoint(psTransform, padfX[i], padfY[i], padfZ[i],
-                                      &dfResultX, &dfResultY))
+        if (!panSuccess[i])
         {
-            panSuccess[i] = FALSE;
             padfX[i] = HUGE_VAL;
             padfY[i] = HUGE_VAL;
             continue;
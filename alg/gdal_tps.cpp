@@ -32,7 +32,10 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <utility>
 
 #include "cpl_atomic_ops.h"
@@ -41,6 +44,7 @@
 #include "cpl_minixml.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
@@ -64,11 +68,48 @@ struct TPSTransformInfo
 
     bool bReversed{};
 
+    // Maximum number of GCPs of the local splines, or 0 for the global mode
+    int nLocalGCPCount{};
+
+    int nThreads = 1;
+
+    // Thread pool used to transform large batches of points. This is not the
+    // global thread pool, as GDALTPSTransform() may be called from one of its
+    // worker threads (e.g. by the warping kernel), and waiting there for jobs
+    // of the same pool could deadlock.
+    std::mutex oThreadPoolMutex{};
+    std::unique_ptr<CPLWorkerThreadPool> poThreadPool{};
+
     std::vector<gdal::GCP> asGCPs{};
 
     volatile int nRefCount{};
 };
 
+/************************************************************************/
+/*                        GDALTPSGetOptions()                           */
+/************************************************************************/
+
+// Options to create a transformer similar to psInfo.
+static CPLStringList GDALTPSGetOptions(const TPSTransformInfo *psInfo)
+{
+    CPLStringList aosOptions;
+    if (psInfo->dfSrcApproxErrorReverse > 0)
+    {
+        aosOptions.SetNameValue(
+            "SRC_APPROX_ERROR_IN_PIXEL",
+            CPLSPrintf("%.17g", psInfo->dfSrcApproxErrorReverse));
+    }
+    if (psInfo->nLocalGCPCount > 0)
+    {
+        aosOptions.SetNameValue("TPS_MODE", "LOCAL");
+        aosOptions.SetNameValue("TPS_LOCAL_GCP_COUNT",
+                                CPLSPrintf("%d", psInfo->nLocalGCPCount));
+    }
+    aosOptions.SetNameValue("NUM_THREADS",
+                            CPLSPrintf("%d", psInfo->nThreads));
+    return aosOptions;
+}
+
 /************************************************************************/
 /*                   GDALCreateSimilarTPSTransformer()                  */
 /************************************************************************/
@@ -95,9 +136,9 @@ static void *GDALCreateSimilarTPSTransformer(void *hTransformArg,
             gcp.Pixel() /= dfRatioX;
             gcp.Line() /= dfRatioY;
         }
-        psInfo = static_cast<TPSTransformInfo *>(GDALCreateTPSTransformer(
+        psInfo = static_cast<TPSTransformInfo *>(GDALCreateTPSTransformerInt(
             static_cast<int>(newGCPs.size()), gdal::GCP::c_ptr(newGCPs),
-            psInfo->bReversed));
+            psInfo->bReversed, GDALTPSGetOptions(psInfo).List()));
     }
 
     return psInfo;
@@ -121,6 +162,9 @@ static void *GDALCreateSimilarTPSTransformer(void *hTransformArg,
  * computed within this function call.  It can be quite an expensive operation
  * for large numbers of GCPs.  For instance, for reference, it takes on the
  * order of 10s for 400 GCPs on a 2GHz Athlon processor.
+ * For large numbers of GCPs, the TPS_MODE=LOCAL option of
+ * GDALCreateGenImgProjTransformer2() can be used to compute an approximation
+ * made of local splines instead.
  *
  * TPS Transformers are serializable.
  *
@@ -153,6 +197,34 @@ void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
                                   int bReversed, char **papszOptions)
 
 {
+    int nLocalGCPCount = 0;
+    const char *pszMode =
+        CSLFetchNameValueDef(papszOptions, "TPS_MODE", "GLOBAL");
+    if (EQUAL(pszMode, "LOCAL"))
+    {
+        nLocalGCPCount = atoi(
+            CSLFetchNameValueDef(papszOptions, "TPS_LOCAL_GCP_COUNT", "200"));
+        if (nLocalGCPCount < 10)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "TPS_LOCAL_GCP_COUNT should be at least 10");
+            return nullptr;
+        }
+    }
+    else if (!EQUAL(pszMode, "GLOBAL"))
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "Invalid value for TPS_MODE: %s",
+                 pszMode);
+        return nullptr;
+    }
+
+    const char *pszThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszThreads == nullptr)
+        pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
+    nThreads = std::max(1, std::min(128, nThreads));
+
     /* -------------------------------------------------------------------- */
     /*      Allocate transform info.                                        */
     /* -------------------------------------------------------------------- */
@@ -164,6 +236,9 @@ void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
     psInfo->poForward = new VizGeorefSpline2D(2);
     psInfo->poReverse = new VizGeorefSpline2D(2);
 
+    psInfo->nLocalGCPCount = nLocalGCPCount;
+    psInfo->nThreads = nThreads;
+
     memcpy(psInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
     psInfo->sTI.pszClassName = "GDALTPSTransformer";
@@ -248,20 +323,15 @@ void *GDALCreateTPSTransformerInt(int nGCPCount, const GDAL_GCP *pasGCPList,
     psInfo->dfSrcApproxErrorReverse = CPLAtof(
         CSLFetchNameValueDef(papszOptions, "SRC_APPROX_ERROR_IN_PIXEL", "0"));
 
-    int nThreads = 1;
-    if (nGCPCount > 100)
+    if (psInfo->nLocalGCPCount > 0)
     {
-        const char *pszWarpThreads =
-            CSLFetchNameValue(papszOptions, "NUM_THREADS");
-        if (pszWarpThreads == nullptr)
-            pszWarpThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
-        if (EQUAL(pszWarpThreads, "ALL_CPUS"))
-            nThreads = CPLGetNumCPUs();
-        else
-            nThreads = atoi(pszWarpThreads);
+        psInfo->poForward->set_local_mode(psInfo->nLocalGCPCount,
+                                          psInfo->nThreads);
+        psInfo->poReverse->set_local_mode(psInfo->nLocalGCPCount,
+                                          psInfo->nThreads);
     }
 
-    if (nThreads > 1)
+    if (nGCPCount > 100 && psInfo->nThreads > 1)
     {
         // Compute direct and reverse transforms in parallel.
         CPLJoinableThread *hThread =
@@ -343,14 +413,10 @@ void GDALDestroyTPSTransformer(void *pTransformArg)
  * @return TRUE.
  */
 
-int GDALTPSTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
-                     double *x, double *y, CPL_UNUSED double *z,
-                     int *panSuccess)
+static void GDALTPSTransformPoints(TPSTransformInfo *psInfo, int bDstToSrc,
+                                   int nPointCount, double *x, double *y,
+                                   int *panSuccess)
 {
-    VALIDATE_POINTER1(pTransformArg, "GDALTPSTransform", 0);
-
-    TPSTransformInfo *psInfo = static_cast<TPSTransformInfo *>(pTransformArg);
-
     for (int i = 0; i < nPointCount; i++)
     {
         double xy_out[2] = {0.0, 0.0};
@@ -391,6 +457,81 @@ int GDALTPSTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
         }
         panSuccess[i] = TRUE;
     }
+}
+
+namespace
+{
+struct GDALTPSTransformJob
+{
+    TPSTransformInfo *psInfo = nullptr;
+    int bDstToSrc = FALSE;
+    int nPointCount = 0;
+    double *x = nullptr;
+    double *y = nullptr;
+    int *panSuccess = nullptr;
+};
+}  // namespace
+
+static void GDALTPSTransformJobFunc(void *pData)
+{
+    const auto psJob = static_cast<const GDALTPSTransformJob *>(pData);
+    GDALTPSTransformPoints(psJob->psInfo, psJob->bDstToSrc, psJob->nPointCount,
+                           psJob->x, psJob->y, psJob->panSuccess);
+}
+
+int GDALTPSTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
+                     double *x, double *y, CPL_UNUSED double *z,
+                     int *panSuccess)
+{
+    VALIDATE_POINTER1(pTransformArg, "GDALTPSTransform", 0);
+
+    TPSTransformInfo *psInfo = static_cast<TPSTransformInfo *>(pTransformArg);
+
+    // Only dispatch the points to worker threads if there is enough work to
+    // make up for the overhead.
+    const double dfWork =
+        static_cast<double>(nPointCount) *
+        (bDstToSrc ? psInfo->poForward->get_nof_terms_per_point() * 2 +
+                         psInfo->poReverse->get_nof_terms_per_point()
+                   : psInfo->poForward->get_nof_terms_per_point());
+    const int nJobs = std::min(psInfo->nThreads, nPointCount);
+    CPLWorkerThreadPool *poThreadPool = nullptr;
+    if (nJobs > 1 && dfWork >= 1e6)
+    {
+        std::lock_guard<std::mutex> oLock(psInfo->oThreadPoolMutex);
+        if (!psInfo->poThreadPool)
+        {
+            auto poNewThreadPool = std::make_unique<CPLWorkerThreadPool>();
+            if (poNewThreadPool->Setup(psInfo->nThreads, nullptr, nullptr))
+                psInfo->poThreadPool = std::move(poNewThreadPool);
+        }
+        poThreadPool = psInfo->poThreadPool.get();
+    }
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+    {
+        GDALTPSTransformPoints(psInfo, bDstToSrc, nPointCount, x, y,
+                               panSuccess);
+        return TRUE;
+    }
+
+    std::vector<GDALTPSTransformJob> asJobs(nJobs);
+    const int nPointsPerJob = nPointCount / nJobs;
+    for (int iJob = 0; iJob < nJobs; ++iJob)
+    {
+        auto &sJob = asJobs[iJob];
+        const int iStart = iJob * nPointsPerJob;
+        sJob.psInfo = psInfo;
+        sJob.bDstToSrc = bDstToSrc;
+        sJob.nPointCount =
+            iJob + 1 == nJobs ? nPointCount - iStart : nPointsPerJob;
+        sJob.x = x + iStart;
+        sJob.y = y + iStart;
+        sJob.panSuccess = panSuccess + iStart;
+        if (!poJobQueue->SubmitJob(GDALTPSTransformJobFunc, &sJob))
+            GDALTPSTransformJobFunc(&sJob);
+    }
+    poJobQueue->WaitCompletion();
 
     return TRUE;
 }
@@ -431,6 +572,13 @@ CPLXMLNode *GDALSerializeTPSTransformer(void *pTransformArg)
             CPLString().Printf("%g", psInfo->dfSrcApproxErrorReverse));
     }
 
+    if (psInfo->nLocalGCPCount > 0)
+    {
+        CPLCreateXMLElementAndValue(
+            psTree, "LocalGCPCount",
+            CPLString().Printf("%d", psInfo->nLocalGCPCount));
+    }
+
     return psTree;
 }
 
@@ -461,6 +609,13 @@ void *GDALDeserializeTPSTransformer(CPLXMLNode *psTree)
     aosOptions.SetNameValue(
         "SRC_APPROX_ERROR_IN_PIXEL",
         CPLGetXMLValue(psTree, "SrcApproxErrorInPixel", nullptr));
+    const char *pszLocalGCPCount =
+        CPLGetXMLValue(psTree, "LocalGCPCount", nullptr);
+    if (pszLocalGCPCount)
+    {
+        aosOptions.SetNameValue("TPS_MODE", "LOCAL");
+        aosOptions.SetNameValue("TPS_LOCAL_GCP_COUNT", pszLocalGCPCount);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Generate transformation.                                        */
@@ -27,18 +27,238 @@
  * DEALINGS IN THE SOFTWARE.
  ****************************************************************************/
 
+
 #include "cpl_port.h"
 #include "gdal_alg.h"
 
 #include <cmath>
 #include <cstddef>
 #include <algorithm>
+#include <functional>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+
+namespace
+{
+
+// A window of the queried region, read from the calling thread and processed
+// by a worker thread.
+struct GDALChecksumChunk
+{
+    size_t nIdx = 0;  // index of the chunk, in row-major order
+    int nXOff = 0;    // relative to the queried region
+    int nYOff = 0;    // relative to the queried region
+    int nXSize = 0;
+    int nYSize = 0;
+    std::vector<GByte> abyData{};
+    const std::function<void(GDALChecksumChunk &)> *pfnProcess = nullptr;
+
+    static void Run(void *pData)
+    {
+        auto poChunk = static_cast<GDALChecksumChunk *>(pData);
+        (*poChunk->pfnProcess)(*poChunk);
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                      GDALChecksumGetNumThreads()                     */
+/************************************************************************/
+
+static int GDALChecksumGetNumThreads()
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    return std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszThreads)));
+}
+
+/************************************************************************/
+/*                      GDALChecksumGetMaxChunkSize()                   */
+/************************************************************************/
+
+// Maximum size in bytes of a chunk. When chunks are processed by several
+// threads, two batches of nThreads chunks are simultaneously in memory.
+static GIntBig GDALChecksumGetMaxChunkSize(int nThreads)
+{
+    return std::max(static_cast<GIntBig>(10 * 1000 * 1000),
+                    GDALGetCacheMax64() / 10) /
+           nThreads;
+}
+
+/************************************************************************/
+/*                      GDALChecksumProcessChunks()                     */
+/************************************************************************/
+
+// Read the (nXOff, nYOff, nXSize, nYSize) region of hBand as chunks of
+// nChunkXSize x nChunkYSize pixels of type eBufType, and call pfnProcess() on
+// each of them. Reads are done from the calling thread, so that drivers do not
+// need to be thread-safe. When nThreads > 1, chunks are processed by batches
+// in the global thread pool, and the next batch is read while the previous one
+// is processed.
+static bool GDALChecksumProcessChunks(
+    GDALRasterBandH hBand, int nXOff, int nYOff, int nXSize, int nYSize,
+    int nChunkXSize, int nChunkYSize, GDALDataType eBufType, int nThreads,
+    const char *pszWhat,
+    const std::function<void(GDALChecksumChunk &)> &pfnProcess)
+{
+    const int nXChunks = DIV_ROUND_UP(nXSize, nChunkXSize);
+    const int nYChunks = DIV_ROUND_UP(nYSize, nChunkYSize);
+    const size_t nTotalChunks = static_cast<size_t>(nXChunks) * nYChunks;
+    const size_t nBufTypeSize = GDALGetDataTypeSizeBytes(eBufType);
+
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 && nTotalChunks > 1 ? GDALGetGlobalThreadPool(nThreads)
+                                         : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    const size_t nBatchSize = poQueue ? static_cast<size_t>(nThreads) : 1;
+
+    std::vector<GDALChecksumChunk> aoBatches[2];
+    int iBatch = 0;
+    bool bRet = true;
+    for (size_t iChunk = 0; bRet && iChunk < nTotalChunks;
+         iChunk += nBatchSize)
+    {
+        auto &aoBatch = aoBatches[iBatch];
+        aoBatch.resize(std::min(nBatchSize, nTotalChunks - iChunk));
+        for (size_t i = 0; i < aoBatch.size(); ++i)
+        {
+            auto &oChunk = aoBatch[i];
+            oChunk.nIdx = iChunk + i;
+            oChunk.nXOff = static_cast<int>(oChunk.nIdx % nXChunks) *
+                           nChunkXSize;
+            oChunk.nYOff = static_cast<int>(oChunk.nIdx / nXChunks) *
+                           nChunkYSize;
+            oChunk.nXSize = std::min(nChunkXSize, nXSize - oChunk.nXOff);
+            oChunk.nYSize = std::min(nChunkYSize, nYSize - oChunk.nYOff);
+            oChunk.pfnProcess = &pfnProcess;
+            try
+            {
+                oChunk.abyData.resize(static_cast<size_t>(oChunk.nXSize) *
+                                      oChunk.nYSize * nBufTypeSize);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating chunk of %d x %d pixels",
+                         oChunk.nXSize, oChunk.nYSize);
+                bRet = false;
+                break;
+            }
+            if (GDALRasterIO(hBand, GF_Read, nXOff + oChunk.nXOff,
+                             nYOff + oChunk.nYOff, oChunk.nXSize,
+                             oChunk.nYSize, oChunk.abyData.data(),
+                             oChunk.nXSize, oChunk.nYSize, eBufType, 0,
+                             0) != CE_None)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "%s could not be computed due to I/O read error.",
+                         pszWhat);
+                bRet = false;
+                break;
+            }
+        }
+
+        // Wait for the previous batch before submitting this one, so that
+        // the buffers of the previous batch can be reused by the next one.
+        if (poQueue)
+            poQueue->WaitCompletion();
+        if (!bRet)
+            break;
+        for (auto &oChunk : aoBatch)
+        {
+            if (!poQueue ||
+                !poQueue->SubmitJob(GDALChecksumChunk::Run, &oChunk))
+            {
+                GDALChecksumChunk::Run(&oChunk);
+            }
+        }
+        iBatch = 1 - iBatch;
+    }
+    if (poQueue)
+        poQueue->WaitCompletion();
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                       GDALChecksumChunkValues()                      */
+/************************************************************************/
+
+static inline int GDALChecksumIntFromValue(GInt32 nVal)
+{
+    return nVal;
+}
+
+static inline int GDALChecksumIntFromValue(double dfVal)
+{
+    int nVal;
+    if (CPLIsNan(dfVal) || CPLIsInf(dfVal))
+    {
+        // Most compilers seem to cast NaN or Inf to 0x80000000.
+        // but VC7 is an exception. So we force the result
+        // of such a cast.
+        nVal = 0x80000000;
+    }
+    else
+    {
+        // Standard behavior of GDALCopyWords when converting
+        // from floating point to Int32.
+        dfVal += 0.5;
+
+        if (dfVal < -2147483647.0)
+            nVal = -2147483647;
+        else if (dfVal > 2147483647)
+            nVal = 2147483647;
+        else
+            nVal = static_cast<GInt32>(floor(dfVal));
+    }
+    return nVal;
+}
+
+// Return the contribution of a chunk to the checksum of a region of width
+// nXSize. As the checksum is a sum modulo 65536, the contributions of the
+// chunks can be computed independently and added together, and the result is
+// the same as when iterating over the full lines of the region.
+template <class T>
+static int GDALChecksumChunkValues(const GDALChecksumChunk &oChunk,
+                                   int nValsPerIter, int nXSize)
+{
+    const static int anPrimes[11] = {7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43};
+
+    const T *paData = reinterpret_cast<const T *>(oChunk.abyData.data());
+    const size_t xIters = static_cast<size_t>(nValsPerIter) * oChunk.nXSize;
+    int nChecksum = 0;
+    for (int iY = 0; iY < oChunk.nYSize; ++iY)
+    {
+        // Initialize iPrime so that it is consistent with a
+        // per full line iteration strategy
+        int iPrime = static_cast<int>(
+            (nValsPerIter *
+             (static_cast<int64_t>(oChunk.nYOff + iY) * nXSize +
+              oChunk.nXOff)) %
+            11);
+        const size_t nOffset = static_cast<size_t>(iY) * xIters;
+        for (size_t i = 0; i < xIters; ++i)
+        {
+            nChecksum +=
+                GDALChecksumIntFromValue(paData[nOffset + i]) %
+                anPrimes[iPrime++];
+            if (iPrime > 10)
+                iPrime = 0;
+        }
+        nChecksum &= 0xffff;
+    }
+    return nChecksum;
+}
 
 /************************************************************************/
 /*                         GDALChecksumImage()                          */
@@ -52,6 +272,12 @@
  * so decimal portions of such raster data will not affect the checksum.
  * Real and Imaginary components of complex bands influence the result.
  *
+ * Starting with GDAL 3.10, when the GDAL_NUM_THREADS configuration option is
+ * set to a value greater than 1 or ALL_CPUS, the region is split into
+ * chunks aligned on blocks whose checksums are computed in parallel, while
+ * the next chunks are read. The result does not depend on the number of
+ * threads.
+ *
  * @param hBand the raster band to read from.
  * @param nXOff pixel offset of window to read.
  * @param nYOff line offset of window to read.
@@ -67,309 +293,304 @@ int CPL_STDCALL GDALChecksumImage(GDALRasterBandH hBand, int nXOff, int nYOff,
 {
     VALIDATE_POINTER1(hBand, "GDALChecksumImage", 0);
 
-    const static int anPrimes[11] = {7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43};
+    if (nXSize <= 0 || nYSize <= 0)
+        return 0;
 
-    int nChecksum = 0;
-    int iPrime = 0;
     const GDALDataType eDataType = GDALGetRasterDataType(hBand);
     const bool bComplex = CPL_TO_BOOL(GDALDataTypeIsComplex(eDataType));
     const bool bIsFloatingPoint =
         (eDataType == GDT_Float32 || eDataType == GDT_Float64 ||
          eDataType == GDT_CFloat32 || eDataType == GDT_CFloat64);
+    const GDALDataType eDstDataType =
+        bIsFloatingPoint ? (bComplex ? GDT_CFloat64 : GDT_Float64)
+                         : (bComplex ? GDT_CInt32 : GDT_Int32);
+    const int nValsPerIter = bComplex ? 2 : 1;
+    const int nThreads = GDALChecksumGetNumThreads();
 
-    const auto IntFromDouble = [](double dfVal)
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALGetBlockSize(hBand, &nBlockXSize, &nBlockYSize);
+    const int nDstDataTypeSize = GDALGetDataTypeSizeBytes(eDstDataType);
+    int nChunkXSize = nBlockXSize;
+    const int nChunkYSize = nBlockYSize;
+    if (nBlockXSize < nXSize)
     {
-        int nVal;
-        if (CPLIsNan(dfVal) || CPLIsInf(dfVal))
+        const GIntBig nMaxChunkSize = GDALChecksumGetMaxChunkSize(nThreads);
+        if (nDstDataTypeSize > 0 &&
+            static_cast<GIntBig>(nXSize) * nChunkYSize <
+                nMaxChunkSize / nDstDataTypeSize)
         {
-            // Most compilers seem to cast NaN or Inf to 0x80000000.
-            // but VC7 is an exception. So we force the result
-            // of such a cast.
-            nVal = 0x80000000;
+            // A full line of height nChunkYSize can fit in the maximum
+            // allowed memory
+            nChunkXSize = nXSize;
         }
         else
         {
-            // Standard behavior of GDALCopyWords when converting
-            // from floating point to Int32.
-            dfVal += 0.5;
-
-            if (dfVal < -2147483647.0)
-                nVal = -2147483647;
-            else if (dfVal > 2147483647)
-                nVal = 2147483647;
-            else
-                nVal = static_cast<GInt32>(floor(dfVal));
+            // Otherwise compute a size that is a multiple of nBlockXSize
+            nChunkXSize = static_cast<int>(std::min(
+                static_cast<GIntBig>(nXSize),
+                nBlockXSize *
+                    std::max(static_cast<GIntBig>(1),
+                             nMaxChunkSize /
+                                 (static_cast<GIntBig>(nBlockXSize) *
+                                  nChunkYSize * nDstDataTypeSize))));
         }
-        return nVal;
+    }
+
+    std::vector<int> anChunkChecksums;
+    try
+    {
+        anChunkChecksums.resize(
+            static_cast<size_t>(DIV_ROUND_UP(nXSize, nChunkXSize)) *
+            DIV_ROUND_UP(nYSize, nChunkYSize));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALChecksumImage()");
+        return -1;
+    }
+
+    const std::function<void(GDALChecksumChunk &)> pfnProcess =
+        [&anChunkChecksums, bIsFloatingPoint, nValsPerIter,
+         nXSize](GDALChecksumChunk &oChunk)
+    {
+        anChunkChecksums[oChunk.nIdx] =
+            bIsFloatingPoint
+                ? GDALChecksumChunkValues<double>(oChunk, nValsPerIter, nXSize)
+                : GDALChecksumChunkValues<GInt32>(oChunk, nValsPerIter,
+                                                  nXSize);
     };
+    if (!GDALChecksumProcessChunks(hBand, nXOff, nYOff, nXSize, nYSize,
+                                   nChunkXSize, nChunkYSize, eDstDataType,
+                                   nThreads, "Checksum value", pfnProcess))
+    {
+        return -1;
+    }
+
+    int nChecksum = 0;
+    for (const int nChunkChecksum : anChunkChecksums)
+        nChecksum = (nChecksum + nChunkChecksum) & 0xffff;
+    return nChecksum;
+}
+
+/************************************************************************/
+/*                             GDALXXH64()                              */
+/************************************************************************/
 
-    if (bIsFloatingPoint && nXOff == 0 && nYOff == 0)
+// Implementation of the XXH64 hash algorithm of Yann Collet, following the
+// specification at
+// https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+
+namespace
+{
+constexpr GUInt64 XXH_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr GUInt64 XXH_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr GUInt64 XXH_PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr GUInt64 XXH_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr GUInt64 XXH_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+}  // namespace
+
+static inline GUInt64 GDALXXH64RotL(GUInt64 nVal, int nBits)
+{
+    return (nVal << nBits) | (nVal >> (64 - nBits));
+}
+
+static inline GUInt64 GDALXXH64Read64(const GByte *pabyData)
+{
+    GUInt64 nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_LSBPTR64(&nVal);
+    return nVal;
+}
+
+static inline GUInt64 GDALXXH64Read32(const GByte *pabyData)
+{
+    GUInt32 nVal;
+    memcpy(&nVal, pabyData, sizeof(nVal));
+    CPL_LSBPTR32(&nVal);
+    return nVal;
+}
+
+static inline GUInt64 GDALXXH64Round(GUInt64 nAcc, GUInt64 nInput)
+{
+    nAcc += nInput * XXH_PRIME64_2;
+    nAcc = GDALXXH64RotL(nAcc, 31);
+    return nAcc * XXH_PRIME64_1;
+}
+
+static inline GUInt64 GDALXXH64MergeRound(GUInt64 nAcc, GUInt64 nVal)
+{
+    nAcc ^= GDALXXH64Round(0, nVal);
+    return nAcc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+static GUInt64 GDALXXH64(const GByte *pabyData, size_t nLen, GUInt64 nSeed)
+{
+    const GByte *const pabyEnd = pabyData + nLen;
+    GUInt64 nHash;
+    if (nLen >= 32)
     {
-        const GDALDataType eDstDataType = bComplex ? GDT_CFloat64 : GDT_Float64;
-        int nBlockXSize = 0;
-        int nBlockYSize = 0;
-        GDALGetBlockSize(hBand, &nBlockXSize, &nBlockYSize);
-        const int nDstDataTypeSize = GDALGetDataTypeSizeBytes(eDstDataType);
-        int nChunkXSize = nBlockXSize;
-        const int nChunkYSize = nBlockYSize;
-        if (nBlockXSize < nXSize)
+        GUInt64 nV1 = nSeed + XXH_PRIME64_1 + XXH_PRIME64_2;
+        GUInt64 nV2 = nSeed + XXH_PRIME64_2;
+        GUInt64 nV3 = nSeed;
+        GUInt64 nV4 = nSeed - XXH_PRIME64_1;
+        const GByte *const pabyLimit = pabyEnd - 32;
+        do
         {
-            const GIntBig nMaxChunkSize =
-                std::max(static_cast<GIntBig>(10 * 1000 * 1000),
-                         GDALGetCacheMax64() / 10);
-            if (nDstDataTypeSize > 0 &&
-                static_cast<GIntBig>(nXSize) * nChunkYSize <
-                    nMaxChunkSize / nDstDataTypeSize)
-            {
-                // A full line of height nChunkYSize can fit in the maximum
-                // allowed memory
-                nChunkXSize = nXSize;
-            }
-            else
-            {
-                // Otherwise compute a size that is a multiple of nBlockXSize
-                nChunkXSize = static_cast<int>(std::min(
-                    static_cast<GIntBig>(nXSize),
-                    nBlockXSize *
-                        std::max(static_cast<GIntBig>(1),
-                                 nMaxChunkSize /
-                                     (static_cast<GIntBig>(nBlockXSize) *
-                                      nChunkYSize * nDstDataTypeSize))));
-            }
-        }
+            nV1 = GDALXXH64Round(nV1, GDALXXH64Read64(pabyData));
+            nV2 = GDALXXH64Round(nV2, GDALXXH64Read64(pabyData + 8));
+            nV3 = GDALXXH64Round(nV3, GDALXXH64Read64(pabyData + 16));
+            nV4 = GDALXXH64Round(nV4, GDALXXH64Read64(pabyData + 24));
+            pabyData += 32;
+        } while (pabyData <= pabyLimit);
 
-        double *padfLineData = static_cast<double *>(
-            VSI_MALLOC3_VERBOSE(nChunkXSize, nChunkYSize, nDstDataTypeSize));
-        if (padfLineData == nullptr)
-        {
-            return -1;
-        }
-        const int nValsPerIter = bComplex ? 2 : 1;
+        nHash = GDALXXH64RotL(nV1, 1) + GDALXXH64RotL(nV2, 7) +
+                GDALXXH64RotL(nV3, 12) + GDALXXH64RotL(nV4, 18);
+        nHash = GDALXXH64MergeRound(nHash, nV1);
+        nHash = GDALXXH64MergeRound(nHash, nV2);
+        nHash = GDALXXH64MergeRound(nHash, nV3);
+        nHash = GDALXXH64MergeRound(nHash, nV4);
+    }
+    else
+    {
+        nHash = nSeed + XXH_PRIME64_5;
+    }
 
-        const int nYBlocks = DIV_ROUND_UP(nYSize, nChunkYSize);
-        const int nXBlocks = DIV_ROUND_UP(nXSize, nChunkXSize);
-        for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
-        {
-            const int iYStart = iYBlock * nChunkYSize;
-            const int iYEnd =
-                iYBlock == nYBlocks - 1 ? nYSize : iYStart + nChunkYSize;
-            const int nChunkActualHeight = iYEnd - iYStart;
-            for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
-            {
-                const int iXStart = iXBlock * nChunkXSize;
-                const int iXEnd =
-                    iXBlock == nXBlocks - 1 ? nXSize : iXStart + nChunkXSize;
-                const int nChunkActualXSize = iXEnd - iXStart;
-                if (GDALRasterIO(
-                        hBand, GF_Read, iXStart, iYStart, nChunkActualXSize,
-                        nChunkActualHeight, padfLineData, nChunkActualXSize,
-                        nChunkActualHeight, eDstDataType, 0, 0) != CE_None)
-                {
-                    CPLError(CE_Failure, CPLE_FileIO,
-                             "Checksum value could not be computed due to I/O "
-                             "read error.");
-                    nChecksum = -1;
-                    iYBlock = nYBlocks;
-                    break;
-                }
-                const size_t xIters =
-                    static_cast<size_t>(nValsPerIter) * nChunkActualXSize;
-                for (int iY = iYStart; iY < iYEnd; ++iY)
-                {
-                    // Initialize iPrime so that it is consistent with a
-                    // per full line iteration strategy
-                    iPrime = (nValsPerIter *
-                              (static_cast<int64_t>(iY) * nXSize + iXStart)) %
-                             11;
-                    const size_t nOffset = nValsPerIter *
-                                           static_cast<size_t>(iY - iYStart) *
-                                           nChunkActualXSize;
-                    for (size_t i = 0; i < xIters; ++i)
-                    {
-                        const double dfVal = padfLineData[nOffset + i];
-                        nChecksum += IntFromDouble(dfVal) % anPrimes[iPrime++];
-                        if (iPrime > 10)
-                            iPrime = 0;
-                    }
-                    nChecksum &= 0xffff;
-                }
-            }
-        }
+    nHash += static_cast<GUInt64>(nLen);
 
-        CPLFree(padfLineData);
+    while (pabyData + 8 <= pabyEnd)
+    {
+        nHash ^= GDALXXH64Round(0, GDALXXH64Read64(pabyData));
+        nHash = GDALXXH64RotL(nHash, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+        pabyData += 8;
+    }
+    if (pabyData + 4 <= pabyEnd)
+    {
+        nHash ^= GDALXXH64Read32(pabyData) * XXH_PRIME64_1;
+        nHash = GDALXXH64RotL(nHash, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+        pabyData += 4;
     }
-    else if (bIsFloatingPoint)
+    while (pabyData < pabyEnd)
     {
-        const GDALDataType eDstDataType = bComplex ? GDT_CFloat64 : GDT_Float64;
+        nHash ^= (*pabyData) * XXH_PRIME64_5;
+        nHash = GDALXXH64RotL(nHash, 11) * XXH_PRIME64_1;
+        ++pabyData;
+    }
 
-        double *padfLineData = static_cast<double *>(VSI_MALLOC2_VERBOSE(
-            nXSize, GDALGetDataTypeSizeBytes(eDstDataType)));
-        if (padfLineData == nullptr)
-        {
-            return -1;
-        }
+    nHash ^= nHash >> 33;
+    nHash *= XXH_PRIME64_2;
+    nHash ^= nHash >> 29;
+    nHash *= XXH_PRIME64_3;
+    nHash ^= nHash >> 32;
+    return nHash;
+}
 
-        for (int iLine = nYOff; iLine < nYOff + nYSize; iLine++)
-        {
-            if (GDALRasterIO(hBand, GF_Read, nXOff, iLine, nXSize, 1,
-                             padfLineData, nXSize, 1, eDstDataType, 0,
-                             0) != CE_None)
-            {
-                CPLError(CE_Failure, CPLE_FileIO,
-                         "Checksum value couldn't be computed due to "
-                         "I/O read error.");
-                nChecksum = -1;
-                break;
-            }
-            const size_t nCount = bComplex ? static_cast<size_t>(nXSize) * 2
-                                           : static_cast<size_t>(nXSize);
+/************************************************************************/
+/*                           GDALHashImage()                            */
+/************************************************************************/
 
-            for (size_t i = 0; i < nCount; i++)
-            {
-                const double dfVal = padfLineData[i];
-                nChecksum += IntFromDouble(dfVal) % anPrimes[iPrime++];
-                if (iPrime > 10)
-                    iPrime = 0;
+/**
+ * Compute a 64-bit content hash for image region.
+ *
+ * Unlike GDALChecksumImage(), the hash is computed on the raw pixel values
+ * in the native data type of the band, so that any change of a value,
+ * including of the decimal part of floating point values, changes the hash.
+ * It is computed with the XXH64 algorithm, which is much faster than the
+ * checksum. Each line of the region is hashed separately, and the hashes
+ * of the lines are combined in order with the data type and the dimensions of
+ * the region. Values are hashed in little-endian order. Consequently, the
+ * result only depends on the pixel values and data type, and not on the
+ * block structure of the band, the number of threads or the host.
+ *
+ * When the GDAL_NUM_THREADS configuration option is set to a value greater
+ * than 1 or ALL_CPUS, lines are hashed in parallel, while the next ones are
+ * read.
+ *
+ * @param hBand the raster band to read from.
+ * @param nXOff pixel offset of window to read.
+ * @param nYOff line offset of window to read.
+ * @param nXSize pixel size of window to read.
+ * @param nYSize line size of window to read.
+ * @param[out] pnHash Pointer to the hash value. Must not be NULL.
+ *
+ * @return CE_None on success, CE_Failure in case of error.
+ *
+ * @since GDAL 3.10
+ */
 
-                nChecksum &= 0xffff;
-            }
-        }
+CPLErr GDALHashImage(GDALRasterBandH hBand, int nXOff, int nYOff, int nXSize,
+                     int nYSize, GUInt64 *pnHash)
 
-        CPLFree(padfLineData);
-    }
-    else if (nXOff == 0 && nYOff == 0)
-    {
-        const GDALDataType eDstDataType = bComplex ? GDT_CInt32 : GDT_Int32;
-        int nBlockXSize = 0;
-        int nBlockYSize = 0;
-        GDALGetBlockSize(hBand, &nBlockXSize, &nBlockYSize);
-        const int nDstDataTypeSize = GDALGetDataTypeSizeBytes(eDstDataType);
-        int nChunkXSize = nBlockXSize;
-        const int nChunkYSize = nBlockYSize;
-        if (nBlockXSize < nXSize)
-        {
-            const GIntBig nMaxChunkSize =
-                std::max(static_cast<GIntBig>(10 * 1000 * 1000),
-                         GDALGetCacheMax64() / 10);
-            if (nDstDataTypeSize > 0 &&
-                static_cast<GIntBig>(nXSize) * nChunkYSize <
-                    nMaxChunkSize / nDstDataTypeSize)
-            {
-                // A full line of height nChunkYSize can fit in the maximum
-                // allowed memory
-                nChunkXSize = nXSize;
-            }
-            else
-            {
-                // Otherwise compute a size that is a multiple of nBlockXSize
-                nChunkXSize = static_cast<int>(std::min(
-                    static_cast<GIntBig>(nXSize),
-                    nBlockXSize *
-                        std::max(static_cast<GIntBig>(1),
-                                 nMaxChunkSize /
-                                     (static_cast<GIntBig>(nBlockXSize) *
-                                      nChunkYSize * nDstDataTypeSize))));
-            }
-        }
+{
+    VALIDATE_POINTER1(hBand, "GDALHashImage", CE_Failure);
+    VALIDATE_POINTER1(pnHash, "GDALHashImage", CE_Failure);
 
-        int *panChunkData = static_cast<GInt32 *>(
-            VSI_MALLOC3_VERBOSE(nChunkXSize, nChunkYSize, nDstDataTypeSize));
-        if (panChunkData == nullptr)
-        {
-            return -1;
-        }
-        const int nValsPerIter = bComplex ? 2 : 1;
+    *pnHash = 0;
+    if (nXSize < 0 || nYSize < 0)
+        return CE_Failure;
 
-        const int nYBlocks = DIV_ROUND_UP(nYSize, nChunkYSize);
-        const int nXBlocks = DIV_ROUND_UP(nXSize, nChunkXSize);
-        for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
-        {
-            const int iYStart = iYBlock * nChunkYSize;
-            const int iYEnd =
-                iYBlock == nYBlocks - 1 ? nYSize : iYStart + nChunkYSize;
-            const int nChunkActualHeight = iYEnd - iYStart;
-            for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
-            {
-                const int iXStart = iXBlock * nChunkXSize;
-                const int iXEnd =
-                    iXBlock == nXBlocks - 1 ? nXSize : iXStart + nChunkXSize;
-                const int nChunkActualXSize = iXEnd - iXStart;
-                if (GDALRasterIO(
-                        hBand, GF_Read, iXStart, iYStart, nChunkActualXSize,
-                        nChunkActualHeight, panChunkData, nChunkActualXSize,
-                        nChunkActualHeight, eDstDataType, 0, 0) != CE_None)
-                {
-                    CPLError(CE_Failure, CPLE_FileIO,
-                             "Checksum value could not be computed due to I/O "
-                             "read error.");
-                    nChecksum = -1;
-                    iYBlock = nYBlocks;
-                    break;
-                }
-                const size_t xIters =
-                    static_cast<size_t>(nValsPerIter) * nChunkActualXSize;
-                for (int iY = iYStart; iY < iYEnd; ++iY)
-                {
-                    // Initialize iPrime so that it is consistent with a
-                    // per full line iteration strategy
-                    iPrime = (nValsPerIter *
-                              (static_cast<int64_t>(iY) * nXSize + iXStart)) %
-                             11;
-                    const size_t nOffset = nValsPerIter *
-                                           static_cast<size_t>(iY - iYStart) *
-                                           nChunkActualXSize;
-                    for (size_t i = 0; i < xIters; ++i)
-                    {
-                        nChecksum +=
-                            panChunkData[nOffset + i] % anPrimes[iPrime++];
-                        if (iPrime > 10)
-                            iPrime = 0;
-                    }
-                    nChecksum &= 0xffff;
-                }
-            }
-        }
+    const GDALDataType eDataType = GDALGetRasterDataType(hBand);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const int nThreads = GDALChecksumGetNumThreads();
+
+    // Hash full-width strips of lines, at most as high as blocks
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALGetBlockSize(hBand, &nBlockXSize, &nBlockYSize);
+    const GIntBig nLineSize = static_cast<GIntBig>(nXSize) * nDTSize;
+    const int nChunkYSize = static_cast<int>(std::max<GIntBig>(
+        1, std::min<GIntBig>(std::max(1, nBlockYSize),
+                             GDALChecksumGetMaxChunkSize(nThreads) /
+                                 std::max<GIntBig>(1, nLineSize))));
 
-        CPLFree(panChunkData);
+    // The data type and dimensions, followed by the hash of each line
+    constexpr int HEADER_SIZE = 3;
+    std::vector<GUInt64> anHashes;
+    try
+    {
+        anHashes.resize(HEADER_SIZE + static_cast<size_t>(nYSize));
     }
-    else
+    catch (const std::exception &)
     {
-        const GDALDataType eDstDataType = bComplex ? GDT_CInt32 : GDT_Int32;
-
-        int *panLineData = static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(
-            nXSize, GDALGetDataTypeSizeBytes(eDstDataType)));
-        if (panLineData == nullptr)
-        {
-            return -1;
-        }
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALHashImage()");
+        return CE_Failure;
+    }
+    anHashes[0] = static_cast<GUInt64>(eDataType);
+    anHashes[1] = static_cast<GUInt64>(nXSize);
+    anHashes[2] = static_cast<GUInt64>(nYSize);
 
-        for (int iLine = nYOff; iLine < nYOff + nYSize; iLine++)
+    if (nXSize > 0 && nYSize > 0)
+    {
+        const int nWordSize =
+            GDALDataTypeIsComplex(eDataType) ? nDTSize / 2 : nDTSize;
+        const std::function<void(GDALChecksumChunk &)> pfnProcess =
+            [&anHashes, nWordSize, nLineSize](GDALChecksumChunk &oChunk)
         {
-            if (GDALRasterIO(hBand, GF_Read, nXOff, iLine, nXSize, 1,
-                             panLineData, nXSize, 1, eDstDataType, 0,
-                             0) != CE_None)
+            if (!CPL_IS_LSB && nWordSize > 1)
             {
-                CPLError(CE_Failure, CPLE_FileIO,
-                         "Checksum value could not be computed due to I/O "
-                         "read error.");
-                nChecksum = -1;
-                break;
+                GDALSwapWordsEx(oChunk.abyData.data(), nWordSize,
+                                oChunk.abyData.size() / nWordSize, nWordSize);
             }
-            const size_t nCount = bComplex ? static_cast<size_t>(nXSize) * 2
-                                           : static_cast<size_t>(nXSize);
-
-            for (size_t i = 0; i < nCount; i++)
+            for (int iY = 0; iY < oChunk.nYSize; ++iY)
             {
-                nChecksum += panLineData[i] % anPrimes[iPrime++];
-                if (iPrime > 10)
-                    iPrime = 0;
-
-                nChecksum &= 0xffff;
+                anHashes[HEADER_SIZE + oChunk.nYOff + iY] =
+                    GDALXXH64(oChunk.abyData.data() + iY * nLineSize,
+                              static_cast<size_t>(nLineSize), 0);
             }
+        };
+        if (!GDALChecksumProcessChunks(hBand, nXOff, nYOff, nXSize, nYSize,
+                                       nXSize, nChunkYSize, eDataType,
+                                       nThreads, "Hash value", pfnProcess))
+        {
+            return CE_Failure;
         }
-
-        CPLFree(panLineData);
     }
 
-    return nChecksum;
+    for (auto &nHash : anHashes)
+        CPL_LSBPTR64(&nHash);
+    *pnHash = GDALXXH64(reinterpret_cast<const GByte *>(anHashes.data()),
+                        anHashes.size() * sizeof(GUInt64), 0);
+    return CE_None;
 }
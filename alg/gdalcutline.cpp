@@ -30,16 +30,21 @@
 #include "cpl_port.h"
 #include "gdalwarper.h"
 
+#include <climits>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_alg_priv.h"
 #include "gdal_priv.h"
 #include "memdataset.h"
 #include "ogr_api.h"
@@ -230,6 +235,304 @@ static int CutlineTransformer(void *pTransformArg, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                       GDALWarpPreparedCutline                        */
+/* ==================================================================== */
+/************************************************************************/
+
+// Cutline, expressed in source pixel coordinates, recursively split into
+// quadrants until each piece has a reasonable number of vertices. Pieces are
+// computed lazily, the first time a chunk overlaps them, so that the cost of
+// clipping a complex cutline (e.g. a coastline) is paid once per warp
+// operation rather than once per chunk. Quadrant boundaries are on integer
+// coordinates, hence never go through a pixel center, so rasterizing the
+// pieces gives the same result as rasterizing the whole cutline.
+class GDALWarpPreparedCutline
+{
+  public:
+    explicit GDALWarpPreparedCutline(const OGRGeometry *poCutline);
+
+    int CollectPieces(int nXOff, int nYOff, int nXSize, int nYSize,
+                      std::vector<const OGRGeometry *> &apoPieces);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GDALWarpPreparedCutline)
+
+    // Nodes not larger than that (in pixels) are not split
+    static constexpr int MIN_NODE_SIZE = 256;
+    // Nodes with less vertices than that are not split
+    static constexpr size_t MAX_NODE_POINTS = 4096;
+
+    enum class Status
+    {
+        EMPTY,
+        FULL,  // the cutline covers the whole node
+        PARTIAL
+    };
+
+    struct Node
+    {
+        int nMinX = 0;
+        int nMinY = 0;
+        int nMaxX = 0;
+        int nMaxY = 0;
+        std::unique_ptr<OGRGeometry> poOwnedGeom{};
+        const OGRGeometry *poGeom = nullptr;
+        Status eStatus = Status::PARTIAL;
+        bool bSplitTried = false;
+        std::vector<std::unique_ptr<Node>> apoChildren{};
+    };
+
+    std::mutex m_oMutex{};
+    Node m_oRoot{};
+
+    void Split(Node &oNode);
+    void Visit(Node &oNode, int nXOff, int nYOff, int nXSize, int nYSize,
+               std::vector<const OGRGeometry *> &apoPieces, bool &bAllFull);
+};
+
+/************************************************************************/
+/*                     GetPolygonalPointCount()                         */
+/************************************************************************/
+
+static size_t GetPolygonalPointCount(const OGRGeometry *poGeom)
+{
+    const auto eType = wkbFlatten(poGeom->getGeometryType());
+    size_t nCount = 0;
+    if (eType == wkbPolygon)
+    {
+        for (const auto poRing : *(poGeom->toPolygon()))
+            nCount += poRing->getNumPoints();
+    }
+    else if (OGR_GT_IsSubClassOf(eType, wkbGeometryCollection))
+    {
+        for (const auto poPart : *(poGeom->toGeometryCollection()))
+            nCount += GetPolygonalPointCount(poPart);
+    }
+    return nCount;
+}
+
+/************************************************************************/
+/*                         GetPolygonalPart()                           */
+/************************************************************************/
+
+// Intersections may contain lines or points where the cutline touches the
+// clipping rectangle. Drop them, as they would burn pixels.
+static std::unique_ptr<OGRGeometry>
+GetPolygonalPart(std::unique_ptr<OGRGeometry> poGeom)
+{
+    const auto eType = wkbFlatten(poGeom->getGeometryType());
+    if (eType == wkbPolygon || eType == wkbMultiPolygon)
+        return poGeom;
+    auto poMP = std::make_unique<OGRMultiPolygon>();
+    if (OGR_GT_IsSubClassOf(eType, wkbGeometryCollection))
+    {
+        for (const auto poPart : *(poGeom->toGeometryCollection()))
+        {
+            const auto ePartType = wkbFlatten(poPart->getGeometryType());
+            if (ePartType == wkbPolygon)
+            {
+                poMP->addGeometry(poPart);
+            }
+            else if (ePartType == wkbMultiPolygon)
+            {
+                for (const auto poPoly : *(poPart->toMultiPolygon()))
+                    poMP->addGeometry(poPoly);
+            }
+        }
+    }
+    return poMP;
+}
+
+/************************************************************************/
+/*                      GDALWarpPreparedCutline()                       */
+/************************************************************************/
+
+GDALWarpPreparedCutline::GDALWarpPreparedCutline(const OGRGeometry *poCutline)
+{
+    OGREnvelope sEnvelope;
+    poCutline->getEnvelope(&sEnvelope);
+    m_oRoot.nMinX = static_cast<int>(
+        std::max(static_cast<double>(INT_MIN / 2), std::floor(sEnvelope.MinX)));
+    m_oRoot.nMinY = static_cast<int>(
+        std::max(static_cast<double>(INT_MIN / 2), std::floor(sEnvelope.MinY)));
+    m_oRoot.nMaxX = static_cast<int>(
+        std::min(static_cast<double>(INT_MAX / 2), std::ceil(sEnvelope.MaxX)));
+    m_oRoot.nMaxY = static_cast<int>(
+        std::min(static_cast<double>(INT_MAX / 2), std::ceil(sEnvelope.MaxY)));
+    m_oRoot.poGeom = poCutline;
+}
+
+/************************************************************************/
+/*                               Split()                                */
+/************************************************************************/
+
+void GDALWarpPreparedCutline::Split(Node &oNode)
+{
+    oNode.bSplitTried = true;
+    if (oNode.nMaxX - oNode.nMinX < 2 * MIN_NODE_SIZE ||
+        oNode.nMaxY - oNode.nMinY < 2 * MIN_NODE_SIZE ||
+        GetPolygonalPointCount(oNode.poGeom) <= MAX_NODE_POINTS)
+    {
+        return;
+    }
+
+    const int nMidX = oNode.nMinX + (oNode.nMaxX - oNode.nMinX) / 2;
+    const int nMidY = oNode.nMinY + (oNode.nMaxY - oNode.nMinY) / 2;
+    std::vector<std::unique_ptr<Node>> apoChildren;
+    for (int i = 0; i < 4; ++i)
+    {
+        auto poChild = std::make_unique<Node>();
+        poChild->nMinX = (i % 2) == 0 ? oNode.nMinX : nMidX;
+        poChild->nMaxX = (i % 2) == 0 ? nMidX : oNode.nMaxX;
+        poChild->nMinY = (i / 2) == 0 ? oNode.nMinY : nMidY;
+        poChild->nMaxY = (i / 2) == 0 ? nMidY : oNode.nMaxY;
+
+        auto poRing = std::make_unique<OGRLinearRing>();
+        poRing->addPoint(poChild->nMinX, poChild->nMinY);
+        poRing->addPoint(poChild->nMinX, poChild->nMaxY);
+        poRing->addPoint(poChild->nMaxX, poChild->nMaxY);
+        poRing->addPoint(poChild->nMaxX, poChild->nMinY);
+        poRing->addPoint(poChild->nMinX, poChild->nMinY);
+        OGRPolygon oRect;
+        oRect.addRingDirectly(poRing.release());
+        std::unique_ptr<OGRGeometry> poClipped;
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            poClipped.reset(oNode.poGeom->Intersection(&oRect));
+        }
+        if (!poClipped)
+        {
+            // Typically an invalid cutline. Keep this node as a leaf.
+            CPLDebug("WARP", "Cannot split cutline piece");
+            return;
+        }
+        poClipped = GetPolygonalPart(std::move(poClipped));
+
+        if (poClipped->IsEmpty())
+        {
+            poChild->eStatus = Status::EMPTY;
+        }
+        else
+        {
+            OGREnvelope sEnvelope;
+            poClipped->getEnvelope(&sEnvelope);
+            const auto poPoly =
+                wkbFlatten(poClipped->getGeometryType()) == wkbPolygon
+                    ? poClipped->toPolygon()
+                    : nullptr;
+            if (poPoly && poPoly->getNumInteriorRings() == 0 &&
+                poPoly->getExteriorRing()->getNumPoints() == 5 &&
+                sEnvelope.MinX == poChild->nMinX &&
+                sEnvelope.MinY == poChild->nMinY &&
+                sEnvelope.MaxX == poChild->nMaxX &&
+                sEnvelope.MaxY == poChild->nMaxY)
+            {
+                poChild->eStatus = Status::FULL;
+            }
+        }
+        poChild->poOwnedGeom = std::move(poClipped);
+        poChild->poGeom = poChild->poOwnedGeom.get();
+        apoChildren.push_back(std::move(poChild));
+    }
+    oNode.apoChildren = std::move(apoChildren);
+}
+
+/************************************************************************/
+/*                               Visit()                                */
+/************************************************************************/
+
+void GDALWarpPreparedCutline::Visit(Node &oNode, int nXOff, int nYOff,
+                                    int nXSize, int nYSize,
+                                    std::vector<const OGRGeometry *> &apoPieces,
+                                    bool &bAllFull)
+{
+    if (oNode.nMaxX <= nXOff || oNode.nMinX >= nXOff + nXSize ||
+        oNode.nMaxY <= nYOff || oNode.nMinY >= nYOff + nYSize)
+    {
+        return;
+    }
+    if (oNode.eStatus == Status::EMPTY)
+    {
+        bAllFull = false;
+        return;
+    }
+    if (oNode.eStatus == Status::PARTIAL)
+    {
+        if (!oNode.bSplitTried)
+            Split(oNode);
+        if (!oNode.apoChildren.empty())
+        {
+            for (auto &poChild : oNode.apoChildren)
+                Visit(*poChild, nXOff, nYOff, nXSize, nYSize, apoPieces,
+                      bAllFull);
+            return;
+        }
+        bAllFull = false;
+    }
+    apoPieces.push_back(oNode.poGeom);
+}
+
+/************************************************************************/
+/*                           CollectPieces()                            */
+/************************************************************************/
+
+// Collect the pieces of the cutline that overlap the specified window, and
+// returns one of the GCMVF_xxx values.
+int GDALWarpPreparedCutline::CollectPieces(
+    int nXOff, int nYOff, int nXSize, int nYSize,
+    std::vector<const OGRGeometry *> &apoPieces)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    bool bAllFull = nXOff >= m_oRoot.nMinX && nYOff >= m_oRoot.nMinY &&
+                    nXOff + nXSize <= m_oRoot.nMaxX &&
+                    nYOff + nYSize <= m_oRoot.nMaxY;
+    Visit(m_oRoot, nXOff, nYOff, nXSize, nYSize, apoPieces, bAllFull);
+    if (apoPieces.empty())
+        return GCMVF_NO_INTERSECTION;
+    return bAllFull ? GCMVF_CHUNK_FULLY_WITHIN_CUTLINE
+                    : GCMVF_PARTIAL_INTERSECTION;
+}
+
+/************************************************************************/
+/*                   GDALWarpPreparedCutlineDeleter                     */
+/************************************************************************/
+
+void GDALWarpPreparedCutlineDeleter::operator()(
+    GDALWarpPreparedCutline *poPreparedCutline) const
+{
+    delete poPreparedCutline;
+}
+
+/************************************************************************/
+/*                   GDALWarpCreatePreparedCutline()                    */
+/************************************************************************/
+
+// Returns nullptr if the prepared cutline cannot be used for the specified
+// options.
+std::unique_ptr<GDALWarpPreparedCutline, GDALWarpPreparedCutlineDeleter>
+GDALWarpCreatePreparedCutline(OGRGeometryH hCutline, double dfBlendDist,
+                              CSLConstList papszWarpOptions)
+{
+    const auto poCutline = OGRGeometry::FromHandle(hCutline);
+    // The blend mask generator needs the whole cutline, and in all touched
+    // mode the boundaries of the pieces would burn extra pixels.
+    if (poCutline == nullptr || dfBlendDist != 0 ||
+        !OGRGeometryFactory::haveGEOS() ||
+        CPLFetchBool(papszWarpOptions, "CUTLINE_ALL_TOUCHED", false) ||
+        !CPLTestBool(CPLGetConfigOption("GDAL_WARP_PREPARE_CUTLINE", "YES")))
+    {
+        return nullptr;
+    }
+    const auto eType = wkbFlatten(poCutline->getGeometryType());
+    if (eType != wkbPolygon && eType != wkbMultiPolygon)
+        return nullptr;
+    return std::unique_ptr<GDALWarpPreparedCutline,
+                           GDALWarpPreparedCutlineDeleter>(
+        new GDALWarpPreparedCutline(poCutline));
+}
+
 /************************************************************************/
 /*                       GDALWarpCutlineMasker()                        */
 /*                                                                      */
@@ -248,12 +551,48 @@ CPLErr GDALWarpCutlineMasker(void *pMaskFuncArg, int nBandCount,
                                    bMaskIsFloat, pValidityMask, nullptr);
 }
 
+static CPLErr GDALWarpCutlineMaskerInternal(
+    void *pMaskFuncArg, GDALWarpPreparedCutline *poPreparedCutline, int nXOff,
+    int nYOff, int nXSize, int nYSize, int bMaskIsFloat, void *pValidityMask,
+    int *pnValidityFlag);
+
 CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
                                GDALDataType /* eType */, int nXOff, int nYOff,
                                int nXSize, int nYSize,
                                GByte ** /*ppImageData */, int bMaskIsFloat,
                                void *pValidityMask, int *pnValidityFlag)
 
+{
+    return GDALWarpCutlineMaskerInternal(pMaskFuncArg, nullptr, nXOff, nYOff,
+                                         nXSize, nYSize, bMaskIsFloat,
+                                         pValidityMask, pnValidityFlag);
+}
+
+/************************************************************************/
+/*                   GDALWarpCutlineMaskerPrepared()                    */
+/************************************************************************/
+
+// Same as GDALWarpCutlineMaskerEx(), but using the pieces of a prepared
+// cutline instead of the whole cutline.
+CPLErr GDALWarpCutlineMaskerPrepared(GDALWarpPreparedCutline *poPreparedCutline,
+                                     void *pMaskFuncArg, int nXOff, int nYOff,
+                                     int nXSize, int nYSize,
+                                     float *pafValidityMask,
+                                     int *pnValidityFlag)
+{
+    return GDALWarpCutlineMaskerInternal(pMaskFuncArg, poPreparedCutline,
+                                         nXOff, nYOff, nXSize, nYSize, TRUE,
+                                         pafValidityMask, pnValidityFlag);
+}
+
+/************************************************************************/
+/*                   GDALWarpCutlineMaskerInternal()                    */
+/************************************************************************/
+
+static CPLErr GDALWarpCutlineMaskerInternal(
+    void *pMaskFuncArg, GDALWarpPreparedCutline *poPreparedCutline, int nXOff,
+    int nYOff, int nXSize, int nYSize, int bMaskIsFloat, void *pValidityMask,
+    int *pnValidityFlag)
 {
     if (pnValidityFlag)
         *pnValidityFlag = GCMVF_PARTIAL_INTERSECTION;
@@ -319,9 +658,29 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
         return CE_None;
     }
 
+    // With a prepared cutline, find the pieces of the cutline relevant for
+    // this chunk, which also tells if the chunk is inside or outside of it.
+    std::vector<const OGRGeometry *> apoPieces;
+    if (poPreparedCutline)
+    {
+        const int nValidityFlag = poPreparedCutline->CollectPieces(
+            nXOff, nYOff, nXSize, nYSize, apoPieces);
+        if (pnValidityFlag)
+            *pnValidityFlag = nValidityFlag;
+        if (nValidityFlag == GCMVF_NO_INTERSECTION)
+        {
+            memset(pafMask, 0, sizeof(float) * nXSize * nYSize);
+            return CE_None;
+        }
+        else if (nValidityFlag == GCMVF_CHUNK_FULLY_WITHIN_CUTLINE)
+        {
+            CPLDebug("WARP", "Source chunk fully contained within cutline.");
+            return CE_None;
+        }
+    }
     // And now check if the chunk to warp is fully contained within the cutline
     // to save rasterization.
-    if (OGRGeometryFactory::haveGEOS()
+    else if (OGRGeometryFactory::haveGEOS()
 #ifdef DEBUG
         // Env var just for debugging purposes
         && !CPLTestBool(
@@ -384,9 +743,25 @@ CPLErr GDALWarpCutlineMaskerEx(void *pMaskFuncArg, int /* nBandCount */,
 
     int anXYOff[2] = {nXOff, nYOff};
 
+    std::vector<OGRGeometryH> ahGeoms;
+    if (poPreparedCutline)
+    {
+        for (const auto poPiece : apoPieces)
+        {
+            ahGeoms.push_back(
+                OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poPiece)));
+        }
+    }
+    else
+    {
+        ahGeoms.push_back(hPolygon);
+    }
+    std::vector<double> adfBurnValues(ahGeoms.size(), dfBurnValue);
+
     CPLErr eErr = GDALRasterizeGeometries(
-        hMemDS, 1, &nTargetBand, 1, &hPolygon, CutlineTransformer, anXYOff,
-        &dfBurnValue, papszRasterizeOptions, nullptr, nullptr);
+        hMemDS, 1, &nTargetBand, static_cast<int>(ahGeoms.size()),
+        ahGeoms.data(), CutlineTransformer, anXYOff, adfBurnValues.data(),
+        papszRasterizeOptions, nullptr, nullptr);
 
     CSLDestroy(papszRasterizeOptions);
 
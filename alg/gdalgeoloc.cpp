@@ -43,6 +43,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -50,8 +52,10 @@
 #include "cpl_quad_tree.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "memdataset.h"
 
 constexpr float INVALID_BMXY = -10.0f;
@@ -1151,11 +1155,252 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         }
     };
 
+    // Result of the forward projection of a sample point of the geolocation
+    // array into the backmap. Computing it only reads the geolocation array,
+    // which can be done in parallel, whereas applying it to the backmap must
+    // be done in the order of the samples, so that the result does not depend
+    // on the number of threads.
+    struct BackMapSample
+    {
+        double dfX = 0;
+        double dfY = 0;
+        double dBMX = 0;
+        double dBMY = 0;
+        float fBMXValue = 0;
+        float fBMYValue = 0;
+        bool bValid = false;
+        bool bMatchingGeoLocCellFound = false;
+    };
+
+    const auto ComputeSample = [&](double dfX, double dfY, OGRPoint &oPoint,
+                                   OGRLinearRing &oRing, BackMapSample &sSample)
+    {
+        sSample.dfX = dfX;
+        sSample.dfY = dfY;
+        sSample.bMatchingGeoLocCellFound = false;
+
+        // Use forward geolocation array interpolation to compute
+        // the georeferenced position corresponding to (dfX, dfY)
+        double dfGeoLocX;
+        double dfGeoLocY;
+        sSample.bValid =
+            PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX, dfGeoLocY);
+        if (!sSample.bValid)
+            return;
+
+        // Compute the floating point coordinates in the pixel space
+        // of the backmap
+        const double dBMX =
+            static_cast<double>((dfGeoLocX - dfMinX) / dfPixelXSize);
+
+        const double dBMY =
+            static_cast<double>((dfMaxY - dfGeoLocY) / dfPixelYSize);
+
+        sSample.dBMX = dBMX;
+        sSample.dBMY = dBMY;
+
+        // Get top left index by truncation
+        const int iBMX = static_cast<int>(std::floor(dBMX));
+        const int iBMY = static_cast<int>(std::floor(dBMY));
+
+        if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 && iBMY < nBMYSize)
+        {
+            // Compute the georeferenced position of the top-left
+            // index of the backmap
+            double dfGeoX = dfMinX + iBMX * dfPixelXSize;
+            const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+
+            bool bMatchingGeoLocCellFound = false;
+
+            const int nOuterIters =
+                psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                        fabs(dfGeoX) >= 180
+                    ? 2
+                    : 1;
+
+            for (int iOuterIter = 0; iOuterIter < nOuterIters; ++iOuterIter)
+            {
+                if (iOuterIter == 1 && dfGeoX >= 180)
+                    dfGeoX -= 360;
+                else if (iOuterIter == 1 && dfGeoX <= -180)
+                    dfGeoX += 360;
+
+                // Identify a cell (quadrilateral in georeferenced
+                // space) in the geolocation array in which dfGeoX,
+                // dfGeoY falls into.
+                oPoint.setX(dfGeoX);
+                oPoint.setY(dfGeoY);
+                const int nX = static_cast<int>(std::floor(dfX));
+                const int nY = static_cast<int>(std::floor(dfY));
+                for (int sx = -1; !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                {
+                    for (int sy = -1; !bMatchingGeoLocCellFound && sy <= 0;
+                         sy++)
+                    {
+                        const int pixel = nX + sx;
+                        const int line = nY + sy;
+                        double x0, y0, x1, y1, x2, y2, x3, y3;
+                        if (!PixelLineToXY(psTransform, pixel, line, x0, y0) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line, x2,
+                                           y2) ||
+                            !PixelLineToXY(psTransform, pixel, line + 1, x1,
+                                           y1) ||
+                            !PixelLineToXY(psTransform, pixel + 1, line + 1,
+                                           x3, y3))
+                        {
+                            break;
+                        }
+
+                        int nIters = 1;
+                        if (psTransform
+                                ->bGeographicSRSWithMinus180Plus180LongRange &&
+                            std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
+                            std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
+                            (std::fabs(x1 - x0) > 180 ||
+                             std::fabs(x2 - x0) > 180 ||
+                             std::fabs(x3 - x0) > 180))
+                        {
+                            nIters = 2;
+                            if (x0 > 0)
+                                x0 -= 360;
+                            if (x1 > 0)
+                                x1 -= 360;
+                            if (x2 > 0)
+                                x2 -= 360;
+                            if (x3 > 0)
+                                x3 -= 360;
+                        }
+                        for (int iIter = 0; iIter < nIters; ++iIter)
+                        {
+                            if (iIter == 1)
+                            {
+                                x0 += 360;
+                                x1 += 360;
+                                x2 += 360;
+                                x3 += 360;
+                            }
+
+                            oRing.setPoint(0, x0, y0);
+                            oRing.setPoint(1, x2, y2);
+                            oRing.setPoint(2, x3, y3);
+                            oRing.setPoint(3, x1, y1);
+                            oRing.setPoint(4, x0, y0);
+                            if (oRing.isPointInRing(&oPoint) ||
+                                oRing.isPointOnRingBoundary(&oPoint))
+                            {
+                                bMatchingGeoLocCellFound = true;
+                                double dfBMXValue = pixel;
+                                double dfBMYValue = line;
+                                GDALInverseBilinearInterpolation(
+                                    dfGeoX, dfGeoY, x0, y0, x1, y1, x2, y2, x3,
+                                    y3, dfBMXValue, dfBMYValue);
+
+                                dfBMXValue = (dfBMXValue +
+                                              dfGeorefConventionOffset) *
+                                                 psTransform->dfPIXEL_STEP +
+                                             psTransform->dfPIXEL_OFFSET;
+                                dfBMYValue = (dfBMYValue +
+                                              dfGeorefConventionOffset) *
+                                                 psTransform->dfLINE_STEP +
+                                             psTransform->dfLINE_OFFSET;
+
+                                sSample.fBMXValue =
+                                    static_cast<float>(dfBMXValue);
+                                sSample.fBMYValue =
+                                    static_cast<float>(dfBMYValue);
+                            }
+                        }
+                    }
+                }
+            }
+            sSample.bMatchingGeoLocCellFound = bMatchingGeoLocCellFound;
+        }
+    };
+
+    const auto ApplySample = [&](const BackMapSample &sSample)
+    {
+        if (!sSample.bValid)
+            return;
+
+        const int iBMX = static_cast<int>(std::floor(sSample.dBMX));
+        const int iBMY = static_cast<int>(std::floor(sSample.dBMY));
+
+        if (sSample.bMatchingGeoLocCellFound)
+        {
+            pAccessors->backMapXAccessor.Set(iBMX, iBMY, sSample.fBMXValue);
+            pAccessors->backMapYAccessor.Set(iBMX, iBMY, sSample.fBMYValue);
+            pAccessors->backMapWeightAccessor.Set(iBMX, iBMY, 1.0f);
+            return;
+        }
+
+        // We will end up here in non-nominal cases, with nodata,
+        // holes, etc.
+
+        // Check if the center is in range
+        if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize || iBMY > nBMYSize)
+            return;
+
+        const double dfX = sSample.dfX;
+        const double dfY = sSample.dfY;
+        const double fracBMX = sSample.dBMX - iBMX;
+        const double fracBMY = sSample.dBMY - iBMY;
+
+        // Check logic for top left pixel
+        if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
+            (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
+            UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for top right pixel
+        if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) && (iBMY < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) != 1.0f)
+        {
+            const double tempwt = fracBMX * (1.0 - fracBMY);
+            UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom right pixel
+        if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = fracBMX * fracBMY;
+            UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
+        }
+
+        // Check logic for bottom left pixel
+        if ((iBMX >= 0) && (iBMX < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+            pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) != 1.0f)
+        {
+            const double tempwt = (1.0 - fracBMX) * fracBMY;
+            UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
+        }
+    };
+
     // Keep those objects in this outer scope, so they are re-used, to
     // save memory allocations.
     OGRPoint oPoint;
     OGRLinearRing oRing;
     oRing.setNumPoints(5);
+    BackMapSample sSample;
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    std::vector<BackMapSample> asSamples;
+
+    // The sample points of the geolocation array can only be projected in
+    // worker threads for in-memory geolocation arrays, as the pixel caches of
+    // the temporary datasets are not thread-safe.
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (psTransform->nThreads > 1 && psTransform->bUseArray)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(psTransform->nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+    // Number of sample lines processed at once in worker threads
+    const int nLinesPerChunk = 16 * psTransform->nThreads;
 
     /* -------------------------------------------------------------------- */
     /*      Run through the whole geoloc array forward projecting and       */
@@ -1224,210 +1469,60 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
                  yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
                  xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
 #endif
+            adfY.clear();
             for (double dfY = yStartEnd[iYBlock].first;
                  dfY < yStartEnd[iYBlock].second; dfY += dfStep)
             {
-                for (double dfX = xStartEnd[iXBlock].first;
-                     dfX < xStartEnd[iXBlock].second; dfX += dfStep)
-                {
-                    // Use forward geolocation array interpolation to compute
-                    // the georeferenced position corresponding to (dfX, dfY)
-                    double dfGeoLocX;
-                    double dfGeoLocY;
-                    if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX,
-                                       dfGeoLocY))
-                        continue;
-
-                    // Compute the floating point coordinates in the pixel space
-                    // of the backmap
-                    const double dBMX = static_cast<double>(
-                        (dfGeoLocX - dfMinX) / dfPixelXSize);
-
-                    const double dBMY = static_cast<double>(
-                        (dfMaxY - dfGeoLocY) / dfPixelYSize);
-
-                    // Get top left index by truncation
-                    const int iBMX = static_cast<int>(std::floor(dBMX));
-                    const int iBMY = static_cast<int>(std::floor(dBMY));
+                adfY.push_back(dfY);
+            }
+            adfX.clear();
+            for (double dfX = xStartEnd[iXBlock].first;
+                 dfX < xStartEnd[iXBlock].second; dfX += dfStep)
+            {
+                adfX.push_back(dfX);
+            }
+            const int nLines = static_cast<int>(adfY.size());
+            const size_t nCols = adfX.size();
 
-                    if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 &&
-                        iBMY < nBMYSize)
+            if (!poJobQueue)
+            {
+                for (const double dfY : adfY)
+                {
+                    for (const double dfX : adfX)
                     {
-                        // Compute the georeferenced position of the top-left
-                        // index of the backmap
-                        double dfGeoX = dfMinX + iBMX * dfPixelXSize;
-                        const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
-
-                        bool bMatchingGeoLocCellFound = false;
-
-                        const int nOuterIters =
-                            psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-                                    fabs(dfGeoX) >= 180
-                                ? 2
-                                : 1;
+                        ComputeSample(dfX, dfY, oPoint, oRing, sSample);
+                        ApplySample(sSample);
+                    }
+                }
+                continue;
+            }
 
-                        for (int iOuterIter = 0; iOuterIter < nOuterIters;
-                             ++iOuterIter)
+            for (int iLineStart = 0; iLineStart < nLines;
+                 iLineStart += nLinesPerChunk)
+            {
+                const int nChunkLines =
+                    std::min(nLinesPerChunk, nLines - iLineStart);
+                asSamples.resize(static_cast<size_t>(nChunkLines) * nCols);
+                CPLJobQueueRunRanges(
+                    poJobQueue.get(), psTransform->nThreads, nChunkLines,
+                    [&](int, int iStart, int iEnd)
+                    {
+                        OGRPoint oPointJob;
+                        OGRLinearRing oRingJob;
+                        oRingJob.setNumPoints(5);
+                        for (int iLine = iStart; iLine < iEnd; ++iLine)
                         {
-                            if (iOuterIter == 1 && dfGeoX >= 180)
-                                dfGeoX -= 360;
-                            else if (iOuterIter == 1 && dfGeoX <= -180)
-                                dfGeoX += 360;
-
-                            // Identify a cell (quadrilateral in georeferenced
-                            // space) in the geolocation array in which dfGeoX,
-                            // dfGeoY falls into.
-                            oPoint.setX(dfGeoX);
-                            oPoint.setY(dfGeoY);
-                            const int nX = static_cast<int>(std::floor(dfX));
-                            const int nY = static_cast<int>(std::floor(dfY));
-                            for (int sx = -1;
-                                 !bMatchingGeoLocCellFound && sx <= 0; sx++)
+                            const double dfY = adfY[iLineStart + iLine];
+                            for (size_t iCol = 0; iCol < nCols; ++iCol)
                             {
-                                for (int sy = -1;
-                                     !bMatchingGeoLocCellFound && sy <= 0; sy++)
-                                {
-                                    const int pixel = nX + sx;
-                                    const int line = nY + sy;
-                                    double x0, y0, x1, y1, x2, y2, x3, y3;
-                                    if (!PixelLineToXY(psTransform, pixel, line,
-                                                       x0, y0) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line, x2, y2) ||
-                                        !PixelLineToXY(psTransform, pixel,
-                                                       line + 1, x1, y1) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line + 1, x3, y3))
-                                    {
-                                        break;
-                                    }
-
-                                    int nIters = 1;
-                                    if (psTransform
-                                            ->bGeographicSRSWithMinus180Plus180LongRange &&
-                                        std::fabs(x0) > 170 &&
-                                        std::fabs(x1) > 170 &&
-                                        std::fabs(x2) > 170 &&
-                                        std::fabs(x3) > 170 &&
-                                        (std::fabs(x1 - x0) > 180 ||
-                                         std::fabs(x2 - x0) > 180 ||
-                                         std::fabs(x3 - x0) > 180))
-                                    {
-                                        nIters = 2;
-                                        if (x0 > 0)
-                                            x0 -= 360;
-                                        if (x1 > 0)
-                                            x1 -= 360;
-                                        if (x2 > 0)
-                                            x2 -= 360;
-                                        if (x3 > 0)
-                                            x3 -= 360;
-                                    }
-                                    for (int iIter = 0; iIter < nIters; ++iIter)
-                                    {
-                                        if (iIter == 1)
-                                        {
-                                            x0 += 360;
-                                            x1 += 360;
-                                            x2 += 360;
-                                            x3 += 360;
-                                        }
-
-                                        oRing.setPoint(0, x0, y0);
-                                        oRing.setPoint(1, x2, y2);
-                                        oRing.setPoint(2, x3, y3);
-                                        oRing.setPoint(3, x1, y1);
-                                        oRing.setPoint(4, x0, y0);
-                                        if (oRing.isPointInRing(&oPoint) ||
-                                            oRing.isPointOnRingBoundary(
-                                                &oPoint))
-                                        {
-                                            bMatchingGeoLocCellFound = true;
-                                            double dfBMXValue = pixel;
-                                            double dfBMYValue = line;
-                                            GDALInverseBilinearInterpolation(
-                                                dfGeoX, dfGeoY, x0, y0, x1, y1,
-                                                x2, y2, x3, y3, dfBMXValue,
-                                                dfBMYValue);
-
-                                            dfBMXValue =
-                                                (dfBMXValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfPIXEL_STEP +
-                                                psTransform->dfPIXEL_OFFSET;
-                                            dfBMYValue =
-                                                (dfBMYValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfLINE_STEP +
-                                                psTransform->dfLINE_OFFSET;
-
-                                            pAccessors->backMapXAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMXValue));
-                                            pAccessors->backMapYAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMYValue));
-                                            pAccessors->backMapWeightAccessor
-                                                .Set(iBMX, iBMY, 1.0f);
-                                        }
-                                    }
-                                }
+                                ComputeSample(adfX[iCol], dfY, oPointJob,
+                                              oRingJob,
+                                              asSamples[iLine * nCols + iCol]);
                             }
                         }
-                        if (bMatchingGeoLocCellFound)
-                            continue;
-                    }
-
-                    // We will end up here in non-nominal cases, with nodata,
-                    // holes, etc.
-
-                    // Check if the center is in range
-                    if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize ||
-                        iBMY > nBMYSize)
-                        continue;
-
-                    const double fracBMX = dBMX - iBMX;
-                    const double fracBMY = dBMY - iBMY;
-
-                    // Check logic for top left pixel
-                    if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
-                    }
-
-                    // Check logic for top right pixel
-                    if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = fracBMX * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
-                    }
-
-                    // Check logic for bottom right pixel
-                    if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1,
-                                                              iBMY + 1) != 1.0f)
-                    {
-                        const double tempwt = fracBMX * fracBMY;
-                        UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
-                    }
-
-                    // Check logic for bottom left pixel
-                    if ((iBMX >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * fracBMY;
-                        UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
-                    }
-                }
+                    });
+                for (const auto &sChunkSample : asSamples)
+                    ApplySample(sChunkSample);
             }
         }
     }
@@ -1580,6 +1675,202 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
     return true;
 }
 
+/************************************************************************/
+/*                     GDALGeoLocGetBackMapCacheKey()                   */
+/************************************************************************/
+
+// Returns the set of parameters that a persisted backmap must have been
+// computed with to be reused.
+static CPLStringList
+GDALGeoLocGetBackMapCacheKey(const GDALGeoLocTransformInfo *psTransform)
+{
+    CPLStringList aosKey;
+    for (const char *pszItem : {"X_DATASET", "X_BAND", "Y_DATASET", "Y_BAND"})
+    {
+        aosKey.SetNameValue(
+            pszItem, CSLFetchNameValueDef(psTransform->papszGeolocationInfo,
+                                          pszItem, ""));
+    }
+    aosKey.SetNameValue("GEOLOC_X_SIZE",
+                        CPLSPrintf("%d", psTransform->nGeoLocXSize));
+    aosKey.SetNameValue("GEOLOC_Y_SIZE",
+                        CPLSPrintf("%d", psTransform->nGeoLocYSize));
+    aosKey.SetNameValue("PIXEL_OFFSET",
+                        CPLSPrintf("%.17g", psTransform->dfPIXEL_OFFSET));
+    aosKey.SetNameValue("PIXEL_STEP",
+                        CPLSPrintf("%.17g", psTransform->dfPIXEL_STEP));
+    aosKey.SetNameValue("LINE_OFFSET",
+                        CPLSPrintf("%.17g", psTransform->dfLINE_OFFSET));
+    aosKey.SetNameValue("LINE_STEP",
+                        CPLSPrintf("%.17g", psTransform->dfLINE_STEP));
+    aosKey.SetNameValue("GEOREFERENCING_CONVENTION",
+                        psTransform->bOriginIsTopLeftCorner ? "TOP_LEFT_CORNER"
+                                                            : "PIXEL_CENTER");
+    aosKey.SetNameValue("OVERSAMPLE_FACTOR",
+                        CPLSPrintf("%.17g", psTransform->dfOversampleFactor));
+    aosKey.SetNameValue("MIN_X", CPLSPrintf("%.17g", psTransform->dfMinX));
+    aosKey.SetNameValue("MIN_Y", CPLSPrintf("%.17g", psTransform->dfMinY));
+    aosKey.SetNameValue("MAX_X", CPLSPrintf("%.17g", psTransform->dfMaxX));
+    aosKey.SetNameValue("MAX_Y", CPLSPrintf("%.17g", psTransform->dfMaxY));
+    return aosKey;
+}
+
+/************************************************************************/
+/*                      GDALGeoLoc::LoadBackMap()                       */
+/************************************************************************/
+
+/** Load the backmap from the GeoTIFF file designated by
+ * psTransform->pszBackMapCacheFilename, if it exists and has been computed
+ * with the same geolocation arrays and parameters.
+ */
+template <class Accessors>
+bool GDALGeoLoc<Accessors>::LoadBackMap(GDALGeoLocTransformInfo *psTransform)
+{
+    const char *pszFilename = psTransform->pszBackMapCacheFilename;
+    VSIStatBufL sStat;
+    if (VSIStatL(pszFilename, &sStat) != 0)
+        return false;
+
+    std::unique_ptr<GDALDataset> poCacheDS;
+    {
+        const char *const apszAllowedDrivers[] = {"GTiff", nullptr};
+        CPLTurnFailureIntoWarning(true);
+        poCacheDS.reset(GDALDataset::Open(pszFilename, GDAL_OF_RASTER,
+                                          apszAllowedDrivers));
+        CPLTurnFailureIntoWarning(false);
+    }
+    if (!poCacheDS)
+        return false;
+
+    double adfGeoTransform[6] = {0};
+    if (poCacheDS->GetRasterCount() != 2 ||
+        poCacheDS->GetRasterBand(1)->GetRasterDataType() != GDT_Float32 ||
+        poCacheDS->GetRasterBand(2)->GetRasterDataType() != GDT_Float32 ||
+        poCacheDS->GetGeoTransform(adfGeoTransform) != CE_None)
+    {
+        CPLDebug("GEOLOC", "%s is not a valid backmap", pszFilename);
+        return false;
+    }
+
+    const CPLStringList aosKey(GDALGeoLocGetBackMapCacheKey(psTransform));
+    for (const auto &[pszKey, pszValue] : cpl::IterateNameValue(aosKey))
+    {
+        const char *pszCacheValue = poCacheDS->GetMetadataItem(pszKey);
+        if (pszCacheValue == nullptr || strcmp(pszCacheValue, pszValue) != 0)
+        {
+            CPLDebug("GEOLOC",
+                     "Backmap in %s has not been computed with the same "
+                     "parameters (%s). Ignoring it",
+                     pszFilename, pszKey);
+            return false;
+        }
+    }
+
+    CPLDebug("GEOLOC", "Loading backmap from %s", pszFilename);
+    psTransform->nBackMapWidth = poCacheDS->GetRasterXSize();
+    psTransform->nBackMapHeight = poCacheDS->GetRasterYSize();
+    memcpy(psTransform->adfBackMapGeoTransform, adfGeoTransform,
+           sizeof(adfGeoTransform));
+
+    auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+    if (!pAccessors->AllocateBackMap())
+        return false;
+    pAccessors->FreeWghtsBackMap();
+
+    auto poBackmapDS = pAccessors->GetBackmapDataset();
+    const bool bRet =
+        GDALDatasetCopyWholeRaster(GDALDataset::ToHandle(poCacheDS.get()),
+                                   GDALDataset::ToHandle(poBackmapDS), nullptr,
+                                   nullptr, nullptr) == CE_None;
+    pAccessors->ReleaseBackmapDataset(poBackmapDS);
+    return bRet;
+}
+
+/************************************************************************/
+/*                      GDALGeoLoc::SaveBackMap()                       */
+/************************************************************************/
+
+/** Save the backmap into the GeoTIFF file designated by
+ * psTransform->pszBackMapCacheFilename, so that it can be reused by
+ * LoadBackMap(). Failures are only emitted as warnings.
+ */
+template <class Accessors>
+void GDALGeoLoc<Accessors>::SaveBackMap(GDALGeoLocTransformInfo *psTransform)
+{
+    auto poDriver = GDALDriver::FromHandle(GDALGetDriverByName("GTiff"));
+    if (poDriver == nullptr)
+        return;
+
+    // Write into a temporary file first, so that concurrent readers never
+    // see a partially written backmap.
+    const std::string osFilename(psTransform->pszBackMapCacheFilename);
+    const std::string osTmpFilename(osFilename + ".tmp");
+
+    CPLStringList aosCreationOptions;
+    aosCreationOptions.SetNameValue("TILED", "YES");
+    aosCreationOptions.SetNameValue("COMPRESS", "DEFLATE");
+    aosCreationOptions.SetNameValue("PREDICTOR", "3");
+
+    auto pAccessors = static_cast<Accessors *>(psTransform->pAccessors);
+    auto poBackmapDS = pAccessors->GetBackmapDataset();
+
+    CPLTurnFailureIntoWarning(true);
+    bool bOK = false;
+    std::unique_ptr<GDALDataset> poCacheDS(poDriver->Create(
+        osTmpFilename.c_str(), psTransform->nBackMapWidth,
+        psTransform->nBackMapHeight, 2, GDT_Float32,
+        aosCreationOptions.List()));
+    if (poCacheDS)
+    {
+        poCacheDS->SetGeoTransform(psTransform->adfBackMapGeoTransform);
+        poCacheDS->SetMetadata(
+            GDALGeoLocGetBackMapCacheKey(psTransform).List());
+        for (int i = 1; i <= 2; ++i)
+            poCacheDS->GetRasterBand(i)->SetNoDataValue(INVALID_BMXY);
+        bOK = GDALDatasetCopyWholeRaster(GDALDataset::ToHandle(poBackmapDS),
+                                         GDALDataset::ToHandle(poCacheDS.get()),
+                                         nullptr, nullptr,
+                                         nullptr) == CE_None;
+        bOK = poCacheDS->Close() == CE_None && bOK;
+        poCacheDS.reset();
+        bOK = bOK &&
+              VSIRename(osTmpFilename.c_str(), osFilename.c_str()) == 0;
+        if (!bOK)
+            VSIUnlink(osTmpFilename.c_str());
+    }
+    CPLTurnFailureIntoWarning(false);
+    pAccessors->ReleaseBackmapDataset(poBackmapDS);
+
+    if (bOK)
+    {
+        CPLDebug("GEOLOC", "Backmap saved in %s", osFilename.c_str());
+    }
+    else
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot save backmap in %s",
+                 osFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                  GDALGeoLoc::LoadOrGenerateBackMap()                 */
+/************************************************************************/
+
+template <class Accessors>
+bool GDALGeoLoc<Accessors>::LoadOrGenerateBackMap(
+    GDALGeoLocTransformInfo *psTransform)
+{
+    if (psTransform->pszBackMapCacheFilename == nullptr)
+        return GenerateBackMap(psTransform);
+
+    if (LoadBackMap(psTransform))
+        return true;
+    if (!GenerateBackMap(psTransform))
+        return false;
+    SaveBackMap(psTransform);
+    return true;
+}
+
 /*! @endcond */
 
 /************************************************************************/
@@ -1794,6 +2085,20 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                      CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_OVERSAMPLE_FACTOR",
                                         "1.3")))));
 
+    const char *pszThreads =
+        CSLFetchNameValueDef(papszTransformOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    psTransform->nThreads = std::max(
+        1, std::min(128, EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                       : atoi(pszThreads)));
+
+    const char *pszBackMapCacheFilename = CSLFetchNameValueDef(
+        papszTransformOptions, "GEOLOC_BACKMAP_CACHE_FILENAME",
+        CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_CACHE_FILENAME", nullptr));
+    if (pszBackMapCacheFilename && pszBackMapCacheFilename[0] != '\0')
+        psTransform->pszBackMapCacheFilename =
+            CPLStrdup(pszBackMapCacheFilename);
+
     memcpy(psTransform->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
     psTransform->sTI.pszClassName = "GDALGeoLocTransformer";
@@ -2065,6 +2370,7 @@ void GDALDestroyGeoLocTransformer(void *pTransformAlg)
         static_cast<GDALGeoLocTransformInfo *>(pTransformAlg);
 
     CSLDestroy(psTransform->papszGeolocationInfo);
+    CPLFree(psTransform->pszBackMapCacheFilename);
 
     if (psTransform->bUseArray)
         delete static_cast<GDALGeoLocCArrayAccessors *>(
@@ -2130,6 +2436,19 @@ CPLXMLNode *GDALSerializeGeoLocTransformer(void *pTransformArg)
         psTree, "Reversed",
         CPLString().Printf("%d", static_cast<int>(psInfo->bReversed)));
 
+    /* -------------------------------------------------------------------- */
+    /*      Serialize the persisted backmap, and the oversample factor      */
+    /*      it must be consistent with.                                     */
+    /* -------------------------------------------------------------------- */
+    if (psInfo->pszBackMapCacheFilename)
+    {
+        CPLCreateXMLElementAndValue(psTree, "BackMapCacheFilename",
+                                    psInfo->pszBackMapCacheFilename);
+        CPLCreateXMLElementAndValue(
+            psTree, "BackMapOversampleFactor",
+            CPLSPrintf("%.17g", psInfo->dfOversampleFactor));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      geoloc metadata.                                                */
     /* -------------------------------------------------------------------- */
@@ -2194,8 +2513,23 @@ void *GDALDeserializeGeoLocTransformer(CPLXMLNode *psTree)
     const char *pszSourceDataset =
         CPLGetXMLValue(psTree, "SourceDataset", nullptr);
 
-    void *pResult = GDALCreateGeoLocTransformerEx(nullptr, papszMD, bReversed,
-                                                  pszSourceDataset, nullptr);
+    CPLStringList aosTransformOptions;
+    const char *pszBackMapCacheFilename =
+        CPLGetXMLValue(psTree, "BackMapCacheFilename", nullptr);
+    if (pszBackMapCacheFilename)
+    {
+        aosTransformOptions.SetNameValue("GEOLOC_BACKMAP_CACHE_FILENAME",
+                                         pszBackMapCacheFilename);
+        const char *pszOversampleFactor =
+            CPLGetXMLValue(psTree, "BackMapOversampleFactor", nullptr);
+        if (pszOversampleFactor)
+            aosTransformOptions.SetNameValue("GEOLOC_BACKMAP_OVERSAMPLE_FACTOR",
+                                             pszOversampleFactor);
+    }
+
+    void *pResult =
+        GDALCreateGeoLocTransformerEx(nullptr, papszMD, bReversed,
+                                      pszSourceDataset, aosTransformOptions);
 
     /* -------------------------------------------------------------------- */
     /*      Cleanup GCP copy.                                               */
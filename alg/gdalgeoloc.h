@@ -43,6 +43,12 @@ template <class Accessors> struct GDALGeoLoc
 
     static bool GenerateBackMap(GDALGeoLocTransformInfo *psTransform);
 
+    static bool LoadBackMap(GDALGeoLocTransformInfo *psTransform);
+
+    static void SaveBackMap(GDALGeoLocTransformInfo *psTransform);
+
+    static bool LoadOrGenerateBackMap(GDALGeoLocTransformInfo *psTransform);
+
     static bool PixelLineToXY(const GDALGeoLocTransformInfo *psTransform,
                               const int nGeoLocPixel, const int nGeoLocLine,
                               double &dfX, double &dfY);
@@ -120,6 +120,11 @@ class GDALGeoLocCArrayAccessors
 
 bool GDALGeoLocCArrayAccessors::AllocateBackMap()
 {
+    // In case a previous attempt at loading a persisted backmap failed
+    VSIFree(m_pafBackMapX);
+    VSIFree(m_pafBackMapY);
+    VSIFree(m_wgtsBackMap);
+
     m_pafBackMapX = static_cast<float *>(
         VSI_MALLOC3_VERBOSE(m_psTransform->nBackMapWidth,
                             m_psTransform->nBackMapHeight, sizeof(float)));
@@ -201,7 +206,7 @@ bool GDALGeoLocCArrayAccessors::Load(bool bIsRegularGrid, bool bUseQuadtree)
     return LoadGeoloc(bIsRegularGrid) &&
            ((bUseQuadtree && GDALGeoLocBuildQuadTree(m_psTransform)) ||
             (!bUseQuadtree &&
-             GDALGeoLoc<AccessorType>::GenerateBackMap(m_psTransform)));
+             GDALGeoLoc<AccessorType>::LoadOrGenerateBackMap(m_psTransform)));
 }
 
 /************************************************************************/
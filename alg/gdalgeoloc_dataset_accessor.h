@@ -117,6 +117,10 @@ bool GDALGeoLocDatasetAccessors::AllocateBackMap()
     if (poDriver == nullptr)
         return false;
 
+    // In case a previous attempt at loading a persisted backmap failed
+    delete m_poBackmapTmpDataset;
+    FreeWghtsBackMap();
+
     m_poBackmapTmpDataset = poDriver->Create(
         CPLResetExtension(CPLGenerateTempFilename(nullptr), "tif"),
         m_psTransform->nBackMapWidth, m_psTransform->nBackMapHeight, 2,
@@ -195,7 +199,7 @@ bool GDALGeoLocDatasetAccessors::Load(bool bIsRegularGrid, bool bUseQuadtree)
     return LoadGeoloc(bIsRegularGrid) &&
            ((bUseQuadtree && GDALGeoLocBuildQuadTree(m_psTransform)) ||
             (!bUseQuadtree &&
-             GDALGeoLoc<AccessorType>::GenerateBackMap(m_psTransform)));
+             GDALGeoLoc<AccessorType>::LoadOrGenerateBackMap(m_psTransform)));
 }
 
 /************************************************************************/
@@ -41,6 +41,7 @@
 #include <map>
 #include <utility>
 #include <algorithm>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
@@ -2718,7 +2719,8 @@ struct GDALGridContext
     CPLWorkerThreadPool *poWorkerThreadPool;
 };
 
-static void GDALGridContextCreateQuadTree(GDALGridContext *psContext);
+static void GDALGridContextCreateQuadTree(GDALGridContext *psContext,
+                                          bool bSortPoints);
 
 /**
  * Creates a context to do regular gridding from the scattered data.
@@ -3229,7 +3231,7 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     /* -------------------------------------------------------------------- */
     if (bCreateQuadTree)
     {
-        GDALGridContextCreateQuadTree(psContext);
+        GDALGridContextCreateQuadTree(psContext, /* bSortPoints = */ true);
         if (psContext->sExtraParameters.hQuadTree == nullptr &&
             (eAlgorithm == GGA_InverseDistanceToAPowerNearestNeighbor ||
              pfnGDALGridMethod == GDALGridMovingAveragePerQuadrant))
@@ -3303,11 +3305,104 @@ GDALGridContext *GDALGridContextCreate(GDALGridAlgorithm eAlgorithm,
     return psContext;
 }
 
+/************************************************************************/
+/*                       GDALGridSortPointsSpatially()                  */
+/*                                                                      */
+/*      Reorder the points of the context along a Z-order curve, so     */
+/*      that the points returned by a quadtree search are close in      */
+/*      memory. Returns, for each point in the original order, its      */
+/*      index in the new order, or an empty vector if the points could  */
+/*      not be reordered.                                               */
+/************************************************************************/
+
+static std::vector<GUInt32>
+GDALGridSortPointsSpatially(GDALGridContext *psContext, const CPLRectObj &sRect)
+{
+    const GUInt32 nPoints = psContext->nPoints;
+    std::vector<GUInt32> anNewIdx;
+    double *padfXNew =
+        static_cast<double *>(VSI_MALLOC2_VERBOSE(nPoints, sizeof(double)));
+    double *padfYNew =
+        static_cast<double *>(VSI_MALLOC2_VERBOSE(nPoints, sizeof(double)));
+    double *padfZNew =
+        static_cast<double *>(VSI_MALLOC2_VERBOSE(nPoints, sizeof(double)));
+    std::vector<std::pair<GUInt32, GUInt32>> aoCodes;
+    try
+    {
+        aoCodes.resize(nPoints);
+        anNewIdx.resize(nPoints);
+    }
+    catch (const std::exception &)
+    {
+        anNewIdx.clear();
+    }
+    if (padfXNew == nullptr || padfYNew == nullptr || padfZNew == nullptr ||
+        anNewIdx.empty())
+    {
+        VSIFree(padfXNew);
+        VSIFree(padfYNew);
+        VSIFree(padfZNew);
+        anNewIdx.clear();
+        return anNewIdx;
+    }
+
+    // Interleave the bits of the coordinates quantized on 16 bits
+    const auto Spread = [](GUInt32 v)
+    {
+        v = (v | (v << 8)) & 0x00FF00FFU;
+        v = (v | (v << 4)) & 0x0F0F0F0FU;
+        v = (v | (v << 2)) & 0x33333333U;
+        v = (v | (v << 1)) & 0x55555555U;
+        return v;
+    };
+    const double dfScaleX =
+        sRect.maxx > sRect.minx ? 65535.0 / (sRect.maxx - sRect.minx) : 0.0;
+    const double dfScaleY =
+        sRect.maxy > sRect.miny ? 65535.0 / (sRect.maxy - sRect.miny) : 0.0;
+    const double *const padfX = psContext->padfX;
+    const double *const padfY = psContext->padfY;
+    const double *const padfZ = psContext->padfZ;
+    for (GUInt32 i = 0; i < nPoints; i++)
+    {
+        const auto nX =
+            static_cast<GUInt32>((padfX[i] - sRect.minx) * dfScaleX);
+        const auto nY =
+            static_cast<GUInt32>((padfY[i] - sRect.miny) * dfScaleY);
+        aoCodes[i] = std::make_pair(Spread(nX) | (Spread(nY) << 1), i);
+    }
+    std::sort(aoCodes.begin(), aoCodes.end());
+
+    for (GUInt32 i = 0; i < nPoints; i++)
+    {
+        const GUInt32 iSrc = aoCodes[i].second;
+        padfXNew[i] = padfX[iSrc];
+        padfYNew[i] = padfY[iSrc];
+        padfZNew[i] = padfZ[iSrc];
+        anNewIdx[iSrc] = i;
+    }
+
+    if (psContext->bFreePadfXYZArrays)
+    {
+        CPLFree(psContext->padfX);
+        CPLFree(psContext->padfY);
+        CPLFree(psContext->padfZ);
+    }
+    psContext->padfX = padfXNew;
+    psContext->padfY = padfYNew;
+    psContext->padfZ = padfZNew;
+    psContext->bFreePadfXYZArrays = true;
+    psContext->sXYArrays.padfX = padfXNew;
+    psContext->sXYArrays.padfY = padfYNew;
+
+    return anNewIdx;
+}
+
 /************************************************************************/
 /*                      GDALGridContextCreateQuadTree()                 */
 /************************************************************************/
 
-void GDALGridContextCreateQuadTree(GDALGridContext *psContext)
+void GDALGridContextCreateQuadTree(GDALGridContext *psContext,
+                                   bool bSortPoints)
 {
     const GUInt32 nPoints = psContext->nPoints;
     psContext->pasGridPoints = static_cast<GDALGridPoint *>(
@@ -3340,15 +3435,25 @@ void GDALGridContextCreateQuadTree(GDALGridContext *psContext)
         psContext->sExtraParameters.dfInitialSearchRadius = sqrt(
             (sRect.maxx - sRect.minx) * (sRect.maxy - sRect.miny) / nPoints);
 
+        // Spatially sorted points make quadtree searches much more cache
+        // friendly. Points are still inserted in their original order, so
+        // that searches return them in the same order, and results are
+        // unchanged.
+        std::vector<GUInt32> anNewIdx;
+        if (bSortPoints && nPoints > 1)
+            anNewIdx = GDALGridSortPointsSpatially(psContext, sRect);
+
         psContext->sExtraParameters.hQuadTree =
             CPLQuadTreeCreate(&sRect, GDALGridGetPointBounds);
 
         for (GUInt32 i = 0; i < nPoints; i++)
         {
-            psContext->pasGridPoints[i].psXYArrays = &(psContext->sXYArrays);
-            psContext->pasGridPoints[i].i = i;
+            const GUInt32 iNew = anNewIdx.empty() ? i : anNewIdx[i];
+            psContext->pasGridPoints[iNew].psXYArrays =
+                &(psContext->sXYArrays);
+            psContext->pasGridPoints[iNew].i = static_cast<int>(iNew);
             CPLQuadTreeInsert(psContext->sExtraParameters.hQuadTree,
-                              psContext->pasGridPoints + i);
+                              psContext->pasGridPoints + iNew);
         }
     }
 }
@@ -3490,7 +3595,8 @@ CPLErr GDALGridContextProcess(GDALGridContext *psContext, double dfXMin,
         if (bNeedNearest)
         {
             CPLDebug("GDAL_GRID", "Will need nearest neighbour");
-            GDALGridContextCreateQuadTree(psContext);
+            // Points must be kept in the order used by the triangulation
+            GDALGridContextCreateQuadTree(psContext, /* bSortPoints = */ false);
         }
     }
 
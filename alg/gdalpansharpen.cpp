@@ -30,6 +30,7 @@
 #include "cpl_port.h"
 #include "cpl_worker_thread_pool.h"
 #include "gdalpansharpen.h"
+#include "gdalpansharpen_avx2.h"
 
 #include <algorithm>
 #include <array>
@@ -39,8 +40,10 @@
 #include <cstring>
 #include <limits>
 #include <new>
+#include <type_traits>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_vsi.h"
@@ -631,7 +634,23 @@ void GDALPansharpenOperation::WeightedBrovey3(
         return;
     }
 
-    for (size_t j = 0; j < nValues; j++)
+    size_t j = 0;  // Used after for.
+#ifdef HAVE_PANSHARPEN_AVX2
+    if constexpr (std::is_same<WorkDataType, float>::value &&
+                  std::is_same<OutDataType, float>::value && !bHasBitDepth)
+    {
+        if (CPLHaveRuntimeAVX2())
+        {
+            j = GDALPansharpenWeightedBroveyFloat32_AVX2(
+                pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+                nBandValues, psOptions->padfWeights,
+                psOptions->nInputSpectralBands,
+                psOptions->panOutPansharpenedBands,
+                psOptions->nOutPansharpenedBands);
+        }
+    }
+#endif
+    for (; j < nValues; j++)
     {
         double dfFactor = 0.0;
         // if( pPanBuffer[j] == 0 )
@@ -677,6 +696,18 @@ size_t GDALPansharpenOperation::WeightedBroveyPositiveWeightsInternal(
 {
     static_assert(NINPUT == 3 || NINPUT == 4);
     static_assert(NOUTPUT == 3 || NOUTPUT == 4);
+#ifdef HAVE_PANSHARPEN_AVX2
+    if constexpr (std::is_same<T, GUInt16>::value)
+    {
+        if (CPLHaveRuntimeAVX2())
+        {
+            return GDALPansharpenWeightedBroveyPositiveWeightsUInt16_AVX2(
+                pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+                nBandValues, psOptions->padfWeights, NINPUT, NOUTPUT,
+                nMaxValue);
+        }
+    }
+#endif
     const XMMReg4Double w0 =
         XMMReg4Double::Load1ValHighAndLow(psOptions->padfWeights + 0);
     const XMMReg4Double w1 =
@@ -1241,8 +1272,11 @@ CPLErr GDALPansharpenOperation::ProcessRegion(int nXOff, int nYOff, int nXSize,
 
     // When upsampling, extract the multispectral data at
     // full resolution in a temp buffer, and then do the upsampling.
+    // For nearest neighbour, this is only worth it when the upsampling can
+    // be split over several threads.
     if (nSpectralXSize < nXSize && nSpectralYSize < nYSize &&
-        eResampleAlg != GRIORA_NearestNeighbour && nYSize > 1)
+        (eResampleAlg != GRIORA_NearestNeighbour || nTasks > 1) &&
+        nYSize > 1)
     {
         // Take some margin to take into account the radius of the
         // resampling kernel.
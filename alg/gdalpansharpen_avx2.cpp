@@ -0,0 +1,212 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Pansharpening module
+ * Purpose:  AVX2 specializations of the weighted Brovey kernels
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "gdalpansharpen_avx2.h"
+
+#ifdef HAVE_PANSHARPEN_AVX2
+
+#include <algorithm>
+#include <limits>
+
+#include <immintrin.h>
+
+/************************************************************************/
+/*                           LoadUInt16()                               */
+/************************************************************************/
+
+// Load 8 UInt16 values as 2 vectors of 4 doubles.
+static inline void LoadUInt16(const GUInt16 *panSrc, __m256d &low,
+                              __m256d &high)
+{
+    const __m256i v = _mm256_cvtepu16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(panSrc)));
+    low = _mm256_cvtepi32_pd(_mm256_castsi256_si128(v));
+    high = _mm256_cvtepi32_pd(_mm256_extracti128_si256(v, 1));
+}
+
+/************************************************************************/
+/*            WeightedBroveyPositiveWeightsUInt16Internal()             */
+/************************************************************************/
+
+// The arithmetic below must follow the exact order of operations of the
+// SSE2 code path of WeightedBroveyPositiveWeightsInternal(), to get
+// bit-identical results. In particular no FMA must be used.
+template <int NINPUT, int NOUTPUT>
+static size_t WeightedBroveyPositiveWeightsUInt16Internal(
+    const GUInt16 *pPanBuffer, const GUInt16 *pUpsampledSpectralBuffer,
+    GUInt16 *pDataBuf, size_t nValues, size_t nBandValues,
+    const double *padfWeights, GUInt16 nMaxValue)
+{
+    constexpr int NBANDS = std::max(NINPUT, NOUTPUT);
+    __m256d w[NINPUT];
+    for (int i = 0; i < NINPUT; i++)
+        w[i] = _mm256_set1_pd(padfWeights[i]);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d maxValue = _mm256_set1_pd(nMaxValue);
+
+    size_t j = 0;  // Used after for.
+    for (; j + 7 < nValues; j += 8)
+    {
+        __m256d valLow[NBANDS];
+        __m256d valHigh[NBANDS];
+        for (int i = 0; i < NBANDS; i++)
+        {
+            LoadUInt16(pUpsampledSpectralBuffer + i * nBandValues + j,
+                       valLow[i], valHigh[i]);
+        }
+
+        __m256d pseudoPanchroLow = zero;
+        __m256d pseudoPanchroHigh = zero;
+        for (int i = 0; i < NINPUT; i++)
+        {
+            pseudoPanchroLow = _mm256_add_pd(pseudoPanchroLow,
+                                             _mm256_mul_pd(w[i], valLow[i]));
+            pseudoPanchroHigh = _mm256_add_pd(
+                pseudoPanchroHigh, _mm256_mul_pd(w[i], valHigh[i]));
+        }
+
+        __m256d panLow;
+        __m256d panHigh;
+        LoadUInt16(pPanBuffer + j, panLow, panHigh);
+        const __m256d factorLow = _mm256_and_pd(
+            _mm256_cmp_pd(pseudoPanchroLow, zero, _CMP_NEQ_UQ),
+            _mm256_div_pd(panLow, pseudoPanchroLow));
+        const __m256d factorHigh = _mm256_and_pd(
+            _mm256_cmp_pd(pseudoPanchroHigh, zero, _CMP_NEQ_UQ),
+            _mm256_div_pd(panHigh, pseudoPanchroHigh));
+
+        for (int i = 0; i < NOUTPUT; i++)
+        {
+            const __m256d outLow =
+                _mm256_min_pd(_mm256_mul_pd(valLow[i], factorLow), maxValue);
+            const __m256d outHigh =
+                _mm256_min_pd(_mm256_mul_pd(valHigh[i], factorHigh), maxValue);
+            const __m128i outLowInt =
+                _mm256_cvttpd_epi32(_mm256_add_pd(outLow, half));
+            const __m128i outHighInt =
+                _mm256_cvttpd_epi32(_mm256_add_pd(outHigh, half));
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i *>(pDataBuf + i * nBandValues + j),
+                _mm_packus_epi32(outLowInt, outHighInt));
+        }
+    }
+    return j;
+}
+
+/************************************************************************/
+/*          GDALPansharpenWeightedBroveyPositiveWeightsUInt16_AVX2()    */
+/************************************************************************/
+
+size_t GDALPansharpenWeightedBroveyPositiveWeightsUInt16_AVX2(
+    const GUInt16 *pPanBuffer, const GUInt16 *pUpsampledSpectralBuffer,
+    GUInt16 *pDataBuf, size_t nValues, size_t nBandValues,
+    const double *padfWeights, int nInputBands, int nOutputBands,
+    GUInt16 nMaxValue)
+{
+    if (nInputBands == 3 && nOutputBands == 3)
+    {
+        return WeightedBroveyPositiveWeightsUInt16Internal<3, 3>(
+            pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+            nBandValues, padfWeights, nMaxValue);
+    }
+    else if (nInputBands == 4 && nOutputBands == 4)
+    {
+        return WeightedBroveyPositiveWeightsUInt16Internal<4, 4>(
+            pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+            nBandValues, padfWeights, nMaxValue);
+    }
+    else if (nInputBands == 4 && nOutputBands == 3)
+    {
+        return WeightedBroveyPositiveWeightsUInt16Internal<4, 3>(
+            pPanBuffer, pUpsampledSpectralBuffer, pDataBuf, nValues,
+            nBandValues, padfWeights, nMaxValue);
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*               GDALPansharpenWeightedBroveyFloat32_AVX2()             */
+/************************************************************************/
+
+// The arithmetic below must follow the exact order of operations of
+// WeightedBrovey3(), including the conversion of GDALCopyWord() from double
+// to float, to get bit-identical results.
+size_t GDALPansharpenWeightedBroveyFloat32_AVX2(
+    const float *pPanBuffer, const float *pUpsampledSpectralBuffer,
+    float *pDataBuf, size_t nValues, size_t nBandValues,
+    const double *padfWeights, int nInputBands, const int *panOutBands,
+    int nOutputBands)
+{
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d floatMax =
+        _mm256_set1_pd(std::numeric_limits<float>::max());
+    const __m256d minusFloatMax =
+        _mm256_set1_pd(-std::numeric_limits<float>::max());
+    const __m256d inf = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    const __m256d minusInf =
+        _mm256_set1_pd(-std::numeric_limits<double>::infinity());
+
+    size_t j = 0;  // Used after for.
+    for (; j + 3 < nValues; j += 4)
+    {
+        __m256d pseudoPanchro = zero;
+        for (int i = 0; i < nInputBands; i++)
+        {
+            pseudoPanchro = _mm256_add_pd(
+                pseudoPanchro,
+                _mm256_mul_pd(_mm256_set1_pd(padfWeights[i]),
+                              _mm256_cvtps_pd(_mm_loadu_ps(
+                                  pUpsampledSpectralBuffer + i * nBandValues +
+                                  j))));
+        }
+
+        // Unordered comparison, so that a NaN pseudo panchromatic value
+        // gives a NaN factor, as in ComputeFactor().
+        const __m256d factor = _mm256_and_pd(
+            _mm256_cmp_pd(pseudoPanchro, zero, _CMP_NEQ_UQ),
+            _mm256_div_pd(_mm256_cvtps_pd(_mm_loadu_ps(pPanBuffer + j)),
+                          pseudoPanchro));
+
+        for (int i = 0; i < nOutputBands; i++)
+        {
+            __m256d val = _mm256_mul_pd(
+                _mm256_cvtps_pd(_mm_loadu_ps(pUpsampledSpectralBuffer +
+                                             panOutBands[i] * nBandValues +
+                                             j)),
+                factor);
+            val = _mm256_blendv_pd(val, inf,
+                                   _mm256_cmp_pd(val, floatMax, _CMP_GT_OQ));
+            val = _mm256_blendv_pd(
+                val, minusInf, _mm256_cmp_pd(val, minusFloatMax, _CMP_LT_OQ));
+            _mm_storeu_ps(pDataBuf + i * nBandValues + j, _mm256_cvtpd_ps(val));
+        }
+    }
+    return j;
+}
+
+#endif  // HAVE_PANSHARPEN_AVX2
@@ -0,0 +1,71 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Pansharpening module
+ * Purpose:  AVX2 specializations of the weighted Brovey kernels
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef GDALPANSHARPEN_AVX2_H_INCLUDED
+#define GDALPANSHARPEN_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+#include <cstddef>
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+#define HAVE_PANSHARPEN_AVX2
+
+/** Weighted Brovey pansharpening of UInt16 values with positive weights and
+ * no nodata, 8 values at a time.
+ *
+ * The nInputBands (3 or 4) first bands are used to compute the pseudo
+ * panchromatic value, and the nOutputBands (3 or 4) first bands are output.
+ * Returns the number of values processed, which is a multiple of 8: the
+ * remaining ones must be processed by the caller. Results are identical to the
+ * ones of the SSE2 code path.
+ */
+size_t GDALPansharpenWeightedBroveyPositiveWeightsUInt16_AVX2(
+    const GUInt16 *pPanBuffer, const GUInt16 *pUpsampledSpectralBuffer,
+    GUInt16 *pDataBuf, size_t nValues, size_t nBandValues,
+    const double *padfWeights, int nInputBands, int nOutputBands,
+    GUInt16 nMaxValue);
+
+/** Weighted Brovey pansharpening of Float32 values, without nodata and bit
+ * depth, 4 values at a time.
+ *
+ * Output band i is made from input band panOutBands[i].
+ * Returns the number of values processed, which is a multiple of 4: the
+ * remaining ones must be processed by the caller. Results are identical to the
+ * ones of the generic code path.
+ */
+size_t GDALPansharpenWeightedBroveyFloat32_AVX2(
+    const float *pPanBuffer, const float *pUpsampledSpectralBuffer,
+    float *pDataBuf, size_t nValues, size_t nBandValues,
+    const double *padfWeights, int nInputBands, const int *panOutBands,
+    int nOutputBands);
+
+#endif
+
+#endif /* GDALPANSHARPEN_AVX2_H_INCLUDED */
@@ -34,13 +34,18 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
 
 static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    int *panNearY, int bForward, int iLine,
@@ -49,6 +54,13 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    double *pdfSrcNoDataValue, int nTargetValues,
                                    int *panTargetValues);
 
+static CPLErr GDALComputeProximityExact(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hProximityBand,
+    double dfPixelSizeX, double dfPixelSizeY, double dfMaxDist,
+    const double *pdfSrcNoDataValue, float fNoDataValue, bool bFixedBufVal,
+    double dfFixedBufVal, int nTargetValues, const int *panTargetValues,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg);
+
 /************************************************************************/
 /*                        GDALComputeProximity()                        */
 /************************************************************************/
@@ -105,6 +117,20 @@ the proximity output.
 
 If this option is set, all pixels within the MAXDIST threadhold are
 set to this fixed value instead of to a proximity distance.
+
+  ALGORITHM=[DEFAULT]/EXACT
+
+(GDAL >= 3.10) The default algorithm propagates the nearest target along
+two scanline passes, which is fast and needs little memory, but may not
+find the nearest target in some configurations.  EXACT computes an exact
+Euclidean distance transform, in row and column passes that can use
+several threads.  It keeps 4 bytes per pixel of the raster in memory.
+With DISTUNITS=GEO, it also takes into account non-square pixels.
+
+  NUM_THREADS=number_of_threads|ALL_CPUS
+
+(GDAL >= 3.10) Number of threads used by ALGORITHM=EXACT. Defaults to the
+value of the GDAL_NUM_THREADS configuration option, or 1.
 */
 
 CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
@@ -120,11 +146,32 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
+    /* -------------------------------------------------------------------- */
+    /*      Which algorithm?                                                */
+    /* -------------------------------------------------------------------- */
+    bool bExact = false;
+    const char *pszOpt = CSLFetchNameValue(papszOptions, "ALGORITHM");
+    if (pszOpt)
+    {
+        if (EQUAL(pszOpt, "EXACT"))
+            bExact = true;
+        else if (!EQUAL(pszOpt, "DEFAULT"))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unrecognized ALGORITHM value '%s', should be DEFAULT or "
+                     "EXACT.",
+                     pszOpt);
+            return CE_Failure;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Are we using pixels or georeferenced coordinates for distances? */
     /* -------------------------------------------------------------------- */
     double dfDistMult = 1.0;
-    const char *pszOpt = CSLFetchNameValue(papszOptions, "DISTUNITS");
+    double dfPixelSizeX = 1.0;
+    double dfPixelSizeY = 1.0;
+    pszOpt = CSLFetchNameValue(papszOptions, "DISTUNITS");
     if (pszOpt)
     {
         if (EQUAL(pszOpt, "GEO"))
@@ -135,12 +182,14 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
                 double adfGeoTransform[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
 
                 GDALGetGeoTransform(hSrcDS, adfGeoTransform);
-                if (std::abs(adfGeoTransform[1]) !=
-                    std::abs(adfGeoTransform[5]))
+                if (!bExact && std::abs(adfGeoTransform[1]) !=
+                                   std::abs(adfGeoTransform[5]))
                     CPLError(
                         CE_Warning, CPLE_AppDefined,
                         "Pixels not square, distances will be inaccurate.");
                 dfDistMult = std::abs(adfGeoTransform[1]);
+                dfPixelSizeX = std::abs(adfGeoTransform[1]);
+                dfPixelSizeY = std::abs(adfGeoTransform[5]);
             }
         }
         else if (!EQUAL(pszOpt, "PIXEL"))
@@ -251,6 +300,31 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         return CE_Failure;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      The exact algorithm writes the proximity band only once, so     */
+    /*      does not need a signed working band.                            */
+    /* -------------------------------------------------------------------- */
+    if (bExact)
+    {
+        const char *pszNumThreads =
+            CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                                 CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+        const int nThreads = std::max(
+            1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(pszNumThreads)));
+        pszOpt = CSLFetchNameValue(papszOptions, "MAXDIST");
+        const CPLErr eErr = GDALComputeProximityExact(
+            hSrcBand, hProximityBand, dfPixelSizeX, dfPixelSizeY,
+            pszOpt ? CPLAtof(pszOpt)
+                   : std::numeric_limits<double>::infinity(),
+            pdfSrcNoData, fNoDataValue, bFixedBufVal, dfFixedBufVal,
+            nTargetValues, panTargetValues, nThreads, pfnProgress,
+            pProgressArg);
+        CPLFree(panTargetValues);
+        return eErr;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      We need a signed type for the working proximity values kept     */
     /*      on disk.  If our proximity band is not signed, then create a    */
@@ -589,3 +663,309 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
 
     return CE_None;
 }
+
+/************************************************************************/
+/*                         IsProximityTarget()                          */
+/************************************************************************/
+
+static inline bool IsProximityTarget(GInt32 nValue, int nTargetValues,
+                                     const int *panTargetValues)
+{
+    if (nTargetValues == 0)
+        return nValue != 0;
+
+    for (int i = 0; i < nTargetValues; i++)
+    {
+        if (nValue == panTargetValues[i])
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                       GDALProximityExactLine()                       */
+/*                                                                      */
+/*      Compute the squared distances of a line of pixels to the       */
+/*      nearest target, given the distance (in lines) of each pixel    */
+/*      to the nearest target of its column, as the lower envelope of  */
+/*      the parabolas rooted at each pixel of the line.                */
+/************************************************************************/
+
+constexpr int PROXIMITY_NO_TARGET = std::numeric_limits<int>::max();
+
+static void GDALProximityExactLine(const int *panColDist, int nXSize,
+                                   double dfPixelSizeX2, double dfPixelSizeY2,
+                                   int *panVertex, double *padfBound,
+                                   double *padfDistSq)
+{
+    const auto Root = [panColDist, dfPixelSizeY2](int iX)
+    {
+        const double dfColDist = panColDist[iX];
+        return dfPixelSizeY2 * dfColDist * dfColDist;
+    };
+
+    // panVertex[0..nVertices-1] are the pixels whose parabola is part of
+    // the lower envelope, and padfBound[i] the abscissa from which the
+    // parabola of panVertex[i] is the lowest one.
+    int nVertices = 0;
+    for (int iX = 0; iX < nXSize; ++iX)
+    {
+        if (panColDist[iX] == PROXIMITY_NO_TARGET)
+            continue;
+
+        const double dfRoot = Root(iX) + dfPixelSizeX2 * iX * iX;
+        double dfBound = -std::numeric_limits<double>::infinity();
+        while (nVertices > 0)
+        {
+            const int iVertex = panVertex[nVertices - 1];
+            dfBound = (dfRoot - Root(iVertex) -
+                       dfPixelSizeX2 * iVertex * iVertex) /
+                      (2 * dfPixelSizeX2 * (iX - iVertex));
+            if (dfBound > padfBound[nVertices - 1])
+                break;
+            --nVertices;
+            dfBound = -std::numeric_limits<double>::infinity();
+        }
+        panVertex[nVertices] = iX;
+        padfBound[nVertices] = dfBound;
+        ++nVertices;
+    }
+
+    if (nVertices == 0)
+    {
+        for (int iX = 0; iX < nXSize; ++iX)
+            padfDistSq[iX] = std::numeric_limits<double>::infinity();
+        return;
+    }
+
+    for (int iX = 0, i = 0; iX < nXSize; ++iX)
+    {
+        while (i + 1 < nVertices && padfBound[i + 1] < iX)
+            ++i;
+        const double dfDX = iX - panVertex[i];
+        padfDistSq[iX] = dfPixelSizeX2 * dfDX * dfDX + Root(panVertex[i]);
+    }
+}
+
+/************************************************************************/
+/*                     GDALComputeProximityExact()                      */
+/*                                                                      */
+/*      Exact Euclidean distance transform, computed separably as in    */
+/*      Felzenszwalb & Huttenlocher, "Distance Transforms of Sampled    */
+/*      Functions": first the distance of each pixel to the nearest     */
+/*      target of its column, then the lower envelope of parabolas      */
+/*      along each line.  The column distances of the whole raster are  */
+/*      kept in memory (4 bytes per pixel).                             */
+/************************************************************************/
+
+static CPLErr GDALComputeProximityExact(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hProximityBand,
+    double dfPixelSizeX, double dfPixelSizeY, double dfMaxDist,
+    const double *pdfSrcNoDataValue, float fNoDataValue, bool bFixedBufVal,
+    double dfFixedBufVal, int nTargetValues, const int *panTargetValues,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+    const int nJobs = poJobQueue ? nThreads : 1;
+
+    // Pixels further than that from any target of their column are
+    // further than dfMaxDist from any target.
+    const double dfMaxColDist = dfMaxDist / dfPixelSizeY;
+    const int nMaxColDist = dfMaxColDist < nYSize
+                                ? static_cast<int>(std::floor(dfMaxColDist))
+                                : nYSize;
+
+    int *panColDist = static_cast<int *>(
+        VSI_MALLOC3_VERBOSE(sizeof(int), nXSize, nYSize));
+    const int nStripLines =
+        std::max(1, std::min(nYSize, (1024 * 1024) / std::max(1, nXSize)));
+    const size_t nStripPixels = static_cast<size_t>(nStripLines) * nXSize;
+    float *pafProximity =
+        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nStripPixels));
+    GInt32 *panSrcStrip =
+        pdfSrcNoDataValue ? static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(
+                                sizeof(GInt32), nStripPixels))
+                          : nullptr;
+    int *panVertex = static_cast<int *>(
+        VSI_MALLOC3_VERBOSE(sizeof(int), nJobs, nXSize));
+    double *padfBound = static_cast<double *>(
+        VSI_MALLOC3_VERBOSE(sizeof(double), nJobs, nXSize));
+    double *padfDistSq = static_cast<double *>(
+        VSI_MALLOC3_VERBOSE(sizeof(double), nJobs, nXSize));
+    const auto FreeBuffers = [&]()
+    {
+        CPLFree(panColDist);
+        CPLFree(pafProximity);
+        CPLFree(panSrcStrip);
+        CPLFree(panVertex);
+        CPLFree(padfBound);
+        CPLFree(padfDistSq);
+    };
+    if (panColDist == nullptr || pafProximity == nullptr ||
+        (pdfSrcNoDataValue && panSrcStrip == nullptr) ||
+        panVertex == nullptr || padfBound == nullptr || padfDistSq == nullptr)
+    {
+        FreeBuffers();
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the source, and mark target pixels.                        */
+    /* -------------------------------------------------------------------- */
+    CPLErr eErr = CE_None;
+    for (int iLine = 0; eErr == CE_None && iLine < nYSize;
+         iLine += nStripLines)
+    {
+        const int nLines = std::min(nStripLines, nYSize - iLine);
+        int *panStrip = panColDist + static_cast<size_t>(iLine) * nXSize;
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iLine, nXSize, nLines,
+                            panStrip, nXSize, nLines, GDT_Int32, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        const size_t nPixels = static_cast<size_t>(nLines) * nXSize;
+        for (size_t i = 0; i < nPixels; ++i)
+        {
+            panStrip[i] =
+                IsProximityTarget(panStrip[i], nTargetValues, panTargetValues)
+                    ? 0
+                    : PROXIMITY_NO_TARGET;
+        }
+
+        if (!pfnProgress(0.25 * (iLine + nLines) / static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Distance to the nearest target of the same column, by ranges   */
+    /*      of columns.                                                     */
+    /* -------------------------------------------------------------------- */
+    if (eErr == CE_None)
+    {
+        CPLJobQueueRunRanges(
+            poJobQueue.get(), nJobs, nXSize,
+            [panColDist, nXSize, nYSize, nMaxColDist](int, int iXStart,
+                                                      int iXEnd)
+            {
+                // Top to bottom
+                for (int iLine = 1; iLine < nYSize; ++iLine)
+                {
+                    int *panLine =
+                        panColDist + static_cast<size_t>(iLine) * nXSize;
+                    const int *panPrevLine = panLine - nXSize;
+                    for (int iX = iXStart; iX < iXEnd; ++iX)
+                    {
+                        if (panLine[iX] != 0 && panPrevLine[iX] < nMaxColDist)
+                            panLine[iX] = panPrevLine[iX] + 1;
+                    }
+                }
+
+                // Bottom to top
+                for (int iLine = nYSize - 2; iLine >= 0; --iLine)
+                {
+                    int *panLine =
+                        panColDist + static_cast<size_t>(iLine) * nXSize;
+                    const int *panNextLine = panLine + nXSize;
+                    for (int iX = iXStart; iX < iXEnd; ++iX)
+                    {
+                        if (panNextLine[iX] < nMaxColDist &&
+                            panNextLine[iX] + 1 < panLine[iX])
+                            panLine[iX] = panNextLine[iX] + 1;
+                    }
+                }
+            });
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Distance to the nearest target, by strips of lines.             */
+    /* -------------------------------------------------------------------- */
+    const double dfPixelSizeX2 = dfPixelSizeX * dfPixelSizeX;
+    const double dfPixelSizeY2 = dfPixelSizeY * dfPixelSizeY;
+    // Also excludes pixels without any target, at an infinite distance
+    const double dfMaxDistSq =
+        std::min(dfMaxDist * dfMaxDist, std::numeric_limits<double>::max());
+    for (int iLine = 0; eErr == CE_None && iLine < nYSize;
+         iLine += nStripLines)
+    {
+        const int nLines = std::min(nStripLines, nYSize - iLine);
+        if (panSrcStrip)
+        {
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iLine, nXSize, nLines,
+                                panSrcStrip, nXSize, nLines, GDT_Int32, 0, 0);
+            if (eErr != CE_None)
+                break;
+        }
+
+        CPLJobQueueRunRanges(
+            poJobQueue.get(), nJobs, nLines,
+            [&](int iJob, int iStart, int iEnd)
+            {
+                int *panJobVertex =
+                    panVertex + static_cast<size_t>(iJob) * nXSize;
+                double *padfJobBound =
+                    padfBound + static_cast<size_t>(iJob) * nXSize;
+                double *padfJobDistSq =
+                    padfDistSq + static_cast<size_t>(iJob) * nXSize;
+                for (int i = iStart; i < iEnd; ++i)
+                {
+                    const int *panLineColDist =
+                        panColDist +
+                        static_cast<size_t>(iLine + i) * nXSize;
+                    const GInt32 *panSrcLine =
+                        panSrcStrip
+                            ? panSrcStrip + static_cast<size_t>(i) * nXSize
+                            : nullptr;
+                    float *pafLine =
+                        pafProximity + static_cast<size_t>(i) * nXSize;
+
+                    GDALProximityExactLine(panLineColDist, nXSize,
+                                           dfPixelSizeX2, dfPixelSizeY2,
+                                           panJobVertex, padfJobBound,
+                                           padfJobDistSq);
+
+                    for (int iX = 0; iX < nXSize; ++iX)
+                    {
+                        if (panLineColDist[iX] == 0)
+                            pafLine[iX] = 0.0f;
+                        else if ((panSrcLine &&
+                                  panSrcLine[iX] == *pdfSrcNoDataValue) ||
+                                 !(padfJobDistSq[iX] <= dfMaxDistSq))
+                            pafLine[iX] = fNoDataValue;
+                        else if (bFixedBufVal)
+                            pafLine[iX] = static_cast<float>(dfFixedBufVal);
+                        else
+                            pafLine[iX] =
+                                static_cast<float>(sqrt(padfJobDistSq[iX]));
+                    }
+                }
+            });
+
+        eErr = GDALRasterIO(hProximityBand, GF_Write, 0, iLine, nXSize, nLines,
+                            pafProximity, nXSize, nLines, GDT_Float32, 0, 0);
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.25 + 0.75 * (iLine + nLines) /
+                                    static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    FreeBuffers();
+    return eErr;
+}
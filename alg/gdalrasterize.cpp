@@ -36,7 +36,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <cfloat>
+#include <cmath>
 #include <limits>
+#include <memory>
 #include <vector>
 #include <algorithm>
 
@@ -45,9 +47,11 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -403,6 +407,83 @@ static void gvBurnPoint(void *pCBData, int nY, int nX, double dfVariant)
     }
 }
 
+/************************************************************************/
+/*                        gvBurnCoverageBasic()                         */
+/************************************************************************/
+template <typename T>
+static inline void gvBurnCoverageBasic(GDALRasterizeInfo *psInfo, int nY,
+                                       int nX, double dfCoverage)
+
+{
+    for (int iBand = 0; iBand < psInfo->nBands; iBand++)
+    {
+        const double dfBurnValue =
+            psInfo->eBurnValueType == GDT_Int64
+                ? static_cast<double>(psInfo->burnValues.int64_values[iBand])
+                : psInfo->burnValues.double_values[iBand];
+        double dfValue = dfBurnValue * dfCoverage;
+        T *pPixel = reinterpret_cast<T *>(
+            psInfo->pabyChunkBuf + iBand * psInfo->nBandSpace +
+            nY * psInfo->nLineSpace + nX * psInfo->nPixelSpace);
+        if (psInfo->eMergeAlg == GRMA_Add)
+            dfValue += static_cast<double>(*pPixel);
+        GDALCopyWord(dfValue, *pPixel);
+    }
+}
+
+/************************************************************************/
+/*                           gvBurnCoverage()                           */
+/************************************************************************/
+static void gvBurnCoverage(void *pCBData, int nY, int nX, double dfCoverage)
+
+{
+    GDALRasterizeInfo *psInfo = static_cast<GDALRasterizeInfo *>(pCBData);
+
+    CPLAssert(nY >= 0 && nY < psInfo->nYSize);
+    CPLAssert(nX >= 0 && nX < psInfo->nXSize);
+
+    switch (psInfo->eType)
+    {
+        case GDT_Byte:
+            gvBurnCoverageBasic<GByte>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_Int8:
+            gvBurnCoverageBasic<GInt8>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_Int16:
+            gvBurnCoverageBasic<GInt16>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_UInt16:
+            gvBurnCoverageBasic<GUInt16>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_Int32:
+            gvBurnCoverageBasic<GInt32>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_UInt32:
+            gvBurnCoverageBasic<GUInt32>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_Int64:
+            gvBurnCoverageBasic<std::int64_t>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_UInt64:
+            gvBurnCoverageBasic<std::uint64_t>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_Float32:
+            gvBurnCoverageBasic<float>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_Float64:
+            gvBurnCoverageBasic<double>(psInfo, nY, nX, dfCoverage);
+            break;
+        case GDT_CInt16:
+        case GDT_CInt32:
+        case GDT_CFloat32:
+        case GDT_CFloat64:
+        case GDT_Unknown:
+        case GDT_TypeCount:
+            CPLAssert(false);
+    }
+}
+
 /************************************************************************/
 /*                    GDALCollectRingsFromGeometry()                    */
 /************************************************************************/
@@ -412,7 +493,8 @@ static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
                                          std::vector<double> &aPointY,
                                          std::vector<double> &aPointVariant,
                                          std::vector<int> &aPartSize,
-                                         GDALBurnValueSrc eBurnValueSrc)
+                                         GDALBurnValueSrc eBurnValueSrc,
+                                         bool bReverseHoles = false)
 
 {
     if (poShape == nullptr || poShape->IsEmpty())
@@ -527,9 +609,22 @@ static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
                                      eBurnValueSrc);
 
         for (int i = 0; i < poPolygon->getNumInteriorRings(); i++)
+        {
+            const size_t nStart = aPointX.size();
             GDALCollectRingsFromGeometry(poPolygon->getInteriorRing(i), aPointX,
                                          aPointY, aPointVariant, aPartSize,
                                          eBurnValueSrc);
+            // Give interior rings the opposite orientation of the exterior
+            // ring, as needed by GDALdllImagePolygonCoverage()
+            if (bReverseHoles)
+            {
+                std::reverse(aPointX.begin() + nStart, aPointX.end());
+                std::reverse(aPointY.begin() + nStart, aPointY.end());
+                if (eBurnValueSrc != GBV_UserBurnValue)
+                    std::reverse(aPointVariant.begin() + nStart,
+                                 aPointVariant.end());
+            }
+        }
     }
     else if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
              eFlatType == wkbMultiPolygon || eFlatType == wkbGeometryCollection)
@@ -538,7 +633,7 @@ static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
         for (int i = 0; i < poGC->getNumGeometries(); i++)
             GDALCollectRingsFromGeometry(poGC->getGeometryRef(i), aPointX,
                                          aPointY, aPointVariant, aPartSize,
-                                         eBurnValueSrc);
+                                         eBurnValueSrc, bReverseHoles);
     }
     else
     {
@@ -552,8 +647,9 @@ static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
 static void gv_rasterize_one_shape(
     unsigned char *pabyChunkBuf, int nXOff, int nYOff, int nXSize, int nYSize,
     int nBands, GDALDataType eType, int nPixelSpace, GSpacing nLineSpace,
-    GSpacing nBandSpace, int bAllTouched, const OGRGeometry *poShape,
-    GDALDataType eBurnValueType, const double *padfBurnValues,
+    GSpacing nBandSpace, int bAllTouched, bool bCoverage,
+    const OGRGeometry *poShape, GDALDataType eBurnValueType,
+    const double *padfBurnValues,
     const int64_t *panBurnValues, GDALBurnValueSrc eBurnValueSrc,
     GDALRasterMergeAlg eMergeAlg, GDALTransformerFunc pfnTransformer,
     void *pTransformArg)
@@ -565,18 +661,21 @@ static void gv_rasterize_one_shape(
 
     if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
          eGeomType == wkbGeometryCollection) &&
-        eMergeAlg == GRMA_Replace)
+        eMergeAlg == GRMA_Replace &&
+        !(bCoverage && eGeomType == wkbMultiPolygon))
     {
         // Speed optimization: in replace mode, we can rasterize each part of
-        // a geometry collection separately.
+        // a geometry collection separately. This is not done for the
+        // polygons of a multipolygon when computing coverage fractions, as
+        // they may share pixels.
         const auto poGC = poShape->toGeometryCollection();
         for (const auto poPart : *poGC)
         {
             gv_rasterize_one_shape(
                 pabyChunkBuf, nXOff, nYOff, nXSize, nYSize, nBands, eType,
-                nPixelSpace, nLineSpace, nBandSpace, bAllTouched, poPart,
-                eBurnValueType, padfBurnValues, panBurnValues, eBurnValueSrc,
-                eMergeAlg, pfnTransformer, pTransformArg);
+                nPixelSpace, nLineSpace, nBandSpace, bAllTouched, bCoverage,
+                poPart, eBurnValueType, padfBurnValues, panBurnValues,
+                eBurnValueSrc, eMergeAlg, pfnTransformer, pTransformArg);
         }
         return;
     }
@@ -627,7 +726,7 @@ static void gv_rasterize_one_shape(
     std::vector<int> aPartSize;
 
     GDALCollectRingsFromGeometry(poShape, aPointX, aPointY, aPointVariant,
-                                 aPartSize, eBurnValueSrc);
+                                 aPartSize, eBurnValueSrc, bCoverage);
 
     /* -------------------------------------------------------------------- */
     /*      Transform points if needed.                                     */
@@ -695,6 +794,14 @@ static void gv_rasterize_one_shape(
 
         default:
         {
+            if (bCoverage)
+            {
+                GDALdllImagePolygonCoverage(
+                    sInfo.nXSize, nYSize, static_cast<int>(aPartSize.size()),
+                    aPartSize.data(), aPointX.data(), aPointY.data(),
+                    gvBurnCoverage, &sInfo);
+                break;
+            }
             if (eMergeAlg == GRMA_Add)
             {
                 sInfo.bFillSetVisitedPoints = true;
@@ -752,12 +859,22 @@ static void gv_rasterize_one_shape(
 /************************************************************************/
 
 static CPLErr GDALRasterizeOptions(CSLConstList papszOptions, int *pbAllTouched,
+                                   bool *pbCoverage,
                                    GDALBurnValueSrc *peBurnValueSource,
                                    GDALRasterMergeAlg *peMergeAlg,
                                    GDALRasterizeOptim *peOptim)
 {
     *pbAllTouched = CPLFetchBool(papszOptions, "ALL_TOUCHED", false);
 
+    *pbCoverage = CPLFetchBool(papszOptions, "COVERAGE_FRACTION", false);
+    if (*pbCoverage && *pbAllTouched)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "ALL_TOUCHED and COVERAGE_FRACTION options are mutually "
+                 "exclusive.");
+        return CE_Failure;
+    }
+
     const char *pszOpt = CSLFetchNameValue(papszOptions, "BURN_VALUE_FROM");
     *peBurnValueSource = GBV_UserBurnValue;
     if (pszOpt)
@@ -884,6 +1001,13 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * <li>"MERGE_ALG": May be REPLACE (the default) or ADD.  REPLACE results in
  * overwriting of value, while ADD adds the new value to the existing raster,
  * suitable for heatmaps for instance.</li>
+ * <li>"COVERAGE_FRACTION": (GDAL >= 3.10) May be set to TRUE to burn, for
+ * polygons, the burn value multiplied by the exact fraction of the area of
+ * each pixel covered by the polygon, instead of the burn value for pixels
+ * whose center is within the polygon. Combined with MERGE_ALG=ADD, this
+ * computes area-weighted sums. Typically used with a Float32 or Float64
+ * raster. Points and lines are burnt as usual. Incompatible with
+ * ALL_TOUCHED. Defaults to FALSE.</li>
  * <li>"CHUNKYSIZE": The height in lines of the chunk to operate on.
  * The larger the chunk size the less times we need to make a pass through all
  * the shapes. If it is not set or set to zero the default chunk size will be
@@ -1027,11 +1151,13 @@ static CPLErr GDALRasterizeGeometriesInternal(
     /*      Options                                                         */
     /* -------------------------------------------------------------------- */
     int bAllTouched = FALSE;
+    bool bCoverage = false;
     GDALBurnValueSrc eBurnValueSource = GBV_UserBurnValue;
     GDALRasterMergeAlg eMergeAlg = GRMA_Replace;
     GDALRasterizeOptim eOptim = GRO_Auto;
-    if (GDALRasterizeOptions(papszOptions, &bAllTouched, &eBurnValueSource,
-                             &eMergeAlg, &eOptim) == CE_Failure)
+    if (GDALRasterizeOptions(papszOptions, &bAllTouched, &bCoverage,
+                             &eBurnValueSource, &eMergeAlg,
+                             &eOptim) == CE_Failure)
     {
         return CE_Failure;
     }
@@ -1173,7 +1299,7 @@ static CPLErr GDALRasterizeGeometriesInternal(
                 gv_rasterize_one_shape(
                     pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
                     nThisYChunkSize, nBandCount, eType, 0, 0, 0, bAllTouched,
-                    OGRGeometry::FromHandle(pahGeometries[iShape]),
+                    bCoverage, OGRGeometry::FromHandle(pahGeometries[iShape]),
                     eBurnValueType,
                     padfGeomBurnValues
                         ? padfGeomBurnValues + iShape * nBandCount
@@ -1339,7 +1465,7 @@ static CPLErr GDALRasterizeGeometriesInternal(
                     gv_rasterize_one_shape(
                         pabyChunkBuf, xB * nXBlockSize, yB * nYBlockSize,
                         nThisXChunkSize, nThisYChunkSize, nBandCount, eType, 0,
-                        0, 0, bAllTouched,
+                        0, 0, bAllTouched, bCoverage,
                         OGRGeometry::FromHandle(pahGeometries[iShape]),
                         eBurnValueType,
                         padfGeomBurnValues
@@ -1389,6 +1515,236 @@ static CPLErr GDALRasterizeGeometriesInternal(
     return eErr;
 }
 
+/************************************************************************/
+/*                     GDALRasterizeLayerChunkMT()                      */
+/*                                                                      */
+/*      Burn all features of a layer into a chunk of lines, with        */
+/*      worker threads.  Features are read, and their geometry          */
+/*      transformed to pixel/line coordinates, by batches in the        */
+/*      calling thread, while the previous batch is burnt.  Each job    */
+/*      burns, in order, the features of a batch that intersect its     */
+/*      strip of lines of the chunk, so the result is the same as       */
+/*      burning features one after the other.                           */
+/************************************************************************/
+
+namespace
+{
+
+// Applies a GDALTransformerFunc to geometries, ignoring failures as
+// gv_rasterize_one_shape() does.
+class GDALRasterizeTransformer final : public OGRCoordinateTransformation
+{
+    GDALTransformerFunc m_pfnTransformer;
+    void *m_pTransformArg;
+
+    GDALRasterizeTransformer(const GDALRasterizeTransformer &) = delete;
+    GDALRasterizeTransformer &
+    operator=(const GDALRasterizeTransformer &) = delete;
+
+  public:
+    GDALRasterizeTransformer(GDALTransformerFunc pfnTransformer,
+                             void *pTransformArg)
+        : m_pfnTransformer(pfnTransformer), m_pTransformArg(pTransformArg)
+    {
+    }
+
+    const OGRSpatialReference *GetSourceCS() const override
+    {
+        return nullptr;
+    }
+
+    const OGRSpatialReference *GetTargetCS() const override
+    {
+        return nullptr;
+    }
+
+    int Transform(size_t nCount, double *x, double *y, double * /* z */,
+                  double * /* t */, int *pabSuccess) override
+    {
+        CPLAssert(nCount <=
+                  static_cast<size_t>(std::numeric_limits<int>::max()));
+        m_pfnTransformer(m_pTransformArg, FALSE, static_cast<int>(nCount), x,
+                         y, nullptr, pabSuccess);
+        for (size_t i = 0; pabSuccess && i < nCount; ++i)
+            pabSuccess[i] = TRUE;
+        return TRUE;
+    }
+
+    OGRCoordinateTransformation *Clone() const override
+    {
+        return new GDALRasterizeTransformer(m_pfnTransformer,
+                                            m_pTransformArg);
+    }
+
+    OGRCoordinateTransformation *GetInverse() const override
+    {
+        return nullptr;
+    }
+};
+
+struct GDALRasterizeShape
+{
+    std::unique_ptr<OGRGeometry> poGeom{};
+    // Burn values from the attribute field, if any
+    std::vector<double> adfBurnValues{};
+    // Range of lines of the chunk that may be affected
+    int nYMin = 0;
+    int nYMax = 0;
+};
+
+struct GDALRasterizeStripJob
+{
+    const std::vector<GDALRasterizeShape> *paoShapes = nullptr;
+    unsigned char *pabyChunkBuf = nullptr;
+    int nXSize = 0;
+    int nYOff = 0;
+    int nYStart = 0;
+    int nYEnd = 0;
+    int nBands = 0;
+    GDALDataType eType = GDT_Unknown;
+    GSpacing nLineSpace = 0;
+    GSpacing nBandSpace = 0;
+    int bAllTouched = FALSE;
+    bool bCoverage = false;
+    const double *padfBurnValues = nullptr;
+    GDALBurnValueSrc eBurnValueSrc = GBV_UserBurnValue;
+    GDALRasterMergeAlg eMergeAlg = GRMA_Replace;
+};
+
+}  // namespace
+
+static void GDALRasterizeStripJobFunc(void *pData)
+{
+    const auto psJob = static_cast<const GDALRasterizeStripJob *>(pData);
+    for (const auto &oShape : *(psJob->paoShapes))
+    {
+        if (oShape.nYMax < psJob->nYStart || oShape.nYMin >= psJob->nYEnd)
+            continue;
+        gv_rasterize_one_shape(
+            psJob->pabyChunkBuf + psJob->nYStart * psJob->nLineSpace, 0,
+            psJob->nYOff + psJob->nYStart, psJob->nXSize,
+            psJob->nYEnd - psJob->nYStart, psJob->nBands, psJob->eType, 0,
+            psJob->nLineSpace, psJob->nBandSpace, psJob->bAllTouched,
+            psJob->bCoverage, oShape.poGeom.get(), GDT_Float64,
+            oShape.adfBurnValues.empty() ? psJob->padfBurnValues
+                                         : oShape.adfBurnValues.data(),
+            nullptr, psJob->eBurnValueSrc, psJob->eMergeAlg, nullptr, nullptr);
+    }
+}
+
+static CPLErr GDALRasterizeLayerChunkMT(
+    CPLJobQueue *poJobQueue, int nThreads, OGRLayer *poLayer,
+    unsigned char *pabyChunkBuf, int nYOff, int nXSize, int nYSize, int nBands,
+    GDALDataType eType, int bAllTouched, bool bCoverage, int iBurnField,
+    const double *padfBurnValues, GDALBurnValueSrc eBurnValueSrc,
+    GDALRasterMergeAlg eMergeAlg, GDALTransformerFunc pfnTransformer,
+    void *pTransformArg)
+{
+    const GSpacing nLineSpace =
+        static_cast<GSpacing>(nXSize) * GDALGetDataTypeSizeBytes(eType);
+
+    // More strips than threads, for load balancing
+    const int nStrips = std::min(nYSize, 4 * nThreads);
+    std::vector<GDALRasterizeStripJob> asJobs(nStrips);
+    for (int i = 0; i < nStrips; ++i)
+    {
+        auto &sJob = asJobs[i];
+        sJob.pabyChunkBuf = pabyChunkBuf;
+        sJob.nXSize = nXSize;
+        sJob.nYOff = nYOff;
+        sJob.nYStart =
+            static_cast<int>(static_cast<GIntBig>(nYSize) * i / nStrips);
+        sJob.nYEnd =
+            static_cast<int>(static_cast<GIntBig>(nYSize) * (i + 1) / nStrips);
+        sJob.nBands = nBands;
+        sJob.eType = eType;
+        sJob.nLineSpace = nLineSpace;
+        sJob.nBandSpace = nYSize * nLineSpace;
+        sJob.bAllTouched = bAllTouched;
+        sJob.bCoverage = bCoverage;
+        sJob.padfBurnValues = padfBurnValues;
+        sJob.eBurnValueSrc = eBurnValueSrc;
+        sJob.eMergeAlg = eMergeAlg;
+    }
+
+    std::unique_ptr<OGRCoordinateTransformation> poCT;
+    if (pfnTransformer)
+        poCT = std::make_unique<GDALRasterizeTransformer>(pfnTransformer,
+                                                          pTransformArg);
+
+    // Batch being read, and batch being burnt
+    constexpr size_t BATCH_SIZE = 10000;
+    std::vector<GDALRasterizeShape> aoReadShapes;
+    std::vector<GDALRasterizeShape> aoBurntShapes;
+    bool bBurning = false;
+
+    const auto SubmitBatch = [&]()
+    {
+        if (bBurning)
+            poJobQueue->WaitCompletion();
+        std::swap(aoReadShapes, aoBurntShapes);
+        aoReadShapes.clear();
+        bBurning = !aoBurntShapes.empty();
+        if (bBurning)
+        {
+            for (auto &sJob : asJobs)
+            {
+                sJob.paoShapes = &aoBurntShapes;
+                poJobQueue->SubmitJob(GDALRasterizeStripJobFunc, &sJob);
+            }
+        }
+    };
+
+    for (auto &poFeat : poLayer)
+    {
+        const OGRGeometry *poGeom = poFeat->GetGeometryRef();
+        if (poGeom == nullptr || poGeom->IsEmpty())
+            continue;
+
+        GDALRasterizeShape oShape;
+        oShape.poGeom.reset(poFeat->StealGeometry());
+        if (poCT)
+            oShape.poGeom->transform(poCT.get());
+
+        OGREnvelope sEnvelope;
+        oShape.poGeom->getEnvelope(&sEnvelope);
+        // Be conservative on the lines that may be touched
+        const double dfYMin = sEnvelope.MinY - nYOff - 1;
+        const double dfYMax = sEnvelope.MaxY - nYOff + 1;
+        if (!(dfYMin < nYSize) || !(dfYMax >= 0))
+        {
+            if (!std::isnan(dfYMin) && !std::isnan(dfYMax))
+                continue;
+            oShape.nYMin = 0;
+            oShape.nYMax = nYSize - 1;
+        }
+        else
+        {
+            oShape.nYMin =
+                dfYMin <= 0 ? 0 : static_cast<int>(std::floor(dfYMin));
+            oShape.nYMax = dfYMax >= nYSize - 1
+                               ? nYSize - 1
+                               : static_cast<int>(std::floor(dfYMax));
+        }
+
+        if (iBurnField >= 0)
+        {
+            oShape.adfBurnValues.resize(nBands,
+                                        poFeat->GetFieldAsDouble(iBurnField));
+        }
+
+        aoReadShapes.push_back(std::move(oShape));
+        if (aoReadShapes.size() == BATCH_SIZE)
+            SubmitBatch();
+    }
+
+    // Burn the last batch, and wait for it
+    SubmitBatch();
+    SubmitBatch();
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                        GDALRasterizeLayers()                         */
 /************************************************************************/
@@ -1444,6 +1800,19 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * <li>"MERGE_ALG": May be REPLACE (the default) or ADD.  REPLACE results in
  * overwriting of value, while ADD adds the new value to the existing raster,
  * suitable for heatmaps for instance.</li>
+ * <li>"COVERAGE_FRACTION": (GDAL >= 3.10) May be set to TRUE to burn, for
+ * polygons, the burn value multiplied by the exact fraction of the area of
+ * each pixel covered by the polygon, instead of the burn value for pixels
+ * whose center is within the polygon. Combined with MERGE_ALG=ADD, this
+ * computes area-weighted sums. Typically used with a Float32 or Float64
+ * raster. Points and lines are burnt as usual. Incompatible with
+ * ALL_TOUCHED. Defaults to FALSE.</li>
+ * <li>"NUM_THREADS": (GDAL >= 3.10) Number of threads, or ALL_CPUS, used to
+ * burn features. Defaults to the value of the GDAL_NUM_THREADS configuration
+ * option, or 1. When greater than 1, features are read and transformed by
+ * batches in the calling thread, while worker threads burn the previous
+ * batch into strips of lines of the current chunk. Features are burnt in
+ * the same order as with a single thread.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1481,11 +1850,13 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
     /*      Options                                                         */
     /* -------------------------------------------------------------------- */
     int bAllTouched = FALSE;
+    bool bCoverage = false;
     GDALBurnValueSrc eBurnValueSource = GBV_UserBurnValue;
     GDALRasterMergeAlg eMergeAlg = GRMA_Replace;
     GDALRasterizeOptim eOptim = GRO_Auto;
-    if (GDALRasterizeOptions(papszOptions, &bAllTouched, &eBurnValueSource,
-                             &eMergeAlg, &eOptim) == CE_Failure)
+    if (GDALRasterizeOptions(papszOptions, &bAllTouched, &bCoverage,
+                             &eBurnValueSource, &eMergeAlg,
+                             &eOptim) == CE_Failure)
     {
         return CE_Failure;
     }
@@ -1528,6 +1899,24 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
         return CE_Failure;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Use worker threads to burn features if asked to.                */
+    /* -------------------------------------------------------------------- */
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads)));
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Read the image once for all layers if user requested to render  */
     /*      the whole raster in single chunk.                               */
@@ -1678,25 +2067,38 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
                     break;
             }
 
-            for (auto &poFeat : poLayer)
+            if (poJobQueue)
             {
-                OGRGeometry *poGeom = poFeat->GetGeometryRef();
-
-                if (pszBurnAttribute)
+                eErr = GDALRasterizeLayerChunkMT(
+                    poJobQueue.get(), nThreads, poLayer, pabyChunkBuf, iY,
+                    poDS->GetRasterXSize(), nThisYChunkSize, nBandCount, eType,
+                    bAllTouched, bCoverage, iBurnField, padfBurnValues,
+                    eBurnValueSource, eMergeAlg, pfnTransformer,
+                    pTransformArg);
+            }
+            else
+            {
+                for (auto &poFeat : poLayer)
                 {
-                    const double dfAttrValue =
-                        poFeat->GetFieldAsDouble(iBurnField);
-                    for (int iBand = 0; iBand < nBandCount; iBand++)
-                        padfAttrValues[iBand] = dfAttrValue;
+                    OGRGeometry *poGeom = poFeat->GetGeometryRef();
 
-                    padfBurnValues = padfAttrValues;
-                }
+                    if (pszBurnAttribute)
+                    {
+                        const double dfAttrValue =
+                            poFeat->GetFieldAsDouble(iBurnField);
+                        for (int iBand = 0; iBand < nBandCount; iBand++)
+                            padfAttrValues[iBand] = dfAttrValue;
 
-                gv_rasterize_one_shape(
-                    pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
-                    nThisYChunkSize, nBandCount, eType, 0, 0, 0, bAllTouched,
-                    poGeom, GDT_Float64, padfBurnValues, nullptr,
-                    eBurnValueSource, eMergeAlg, pfnTransformer, pTransformArg);
+                        padfBurnValues = padfAttrValues;
+                    }
+
+                    gv_rasterize_one_shape(
+                        pabyChunkBuf, 0, iY, poDS->GetRasterXSize(),
+                        nThisYChunkSize, nBandCount, eType, 0, 0, 0,
+                        bAllTouched, bCoverage, poGeom, GDT_Float64,
+                        padfBurnValues, nullptr, eBurnValueSource, eMergeAlg,
+                        pfnTransformer, pTransformArg);
+                }
             }
 
             // Only write image if not a single chunk is being rendered.
@@ -1819,6 +2221,13 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
  * <li>"MERGE_ALG": May be REPLACE (the default) or ADD.  REPLACE
  * results in overwriting of value, while ADD adds the new value to the
  * existing raster, suitable for heatmaps for instance.</li>
+ * <li>"COVERAGE_FRACTION": (GDAL >= 3.10) May be set to TRUE to burn, for
+ * polygons, the burn value multiplied by the exact fraction of the area of
+ * each pixel covered by the polygon, instead of the burn value for pixels
+ * whose center is within the polygon. Combined with MERGE_ALG=ADD, this
+ * computes area-weighted sums. Typically used with a Float32 or Float64
+ * raster. Points and lines are burnt as usual. Incompatible with
+ * ALL_TOUCHED. Defaults to FALSE.</li>
  * </ul>
  *
  * @param pfnProgress the progress function to report completion.
@@ -1888,11 +2297,13 @@ CPLErr GDALRasterizeLayersBuf(
     /*      Options                                                         */
     /* -------------------------------------------------------------------- */
     int bAllTouched = FALSE;
+    bool bCoverage = false;
     GDALBurnValueSrc eBurnValueSource = GBV_UserBurnValue;
     GDALRasterMergeAlg eMergeAlg = GRMA_Replace;
     GDALRasterizeOptim eOptim = GRO_Auto;
-    if (GDALRasterizeOptions(papszOptions, &bAllTouched, &eBurnValueSource,
-                             &eMergeAlg, &eOptim) == CE_Failure)
+    if (GDALRasterizeOptions(papszOptions, &bAllTouched, &bCoverage,
+                             &eBurnValueSource, &eMergeAlg,
+                             &eOptim) == CE_Failure)
     {
         return CE_Failure;
     }
@@ -1985,9 +2396,9 @@ CPLErr GDALRasterizeLayersBuf(
 
             gv_rasterize_one_shape(
                 static_cast<unsigned char *>(pData), 0, 0, nBufXSize, nBufYSize,
-                1, eBufType, nPixelSpace, nLineSpace, 0, bAllTouched, poGeom,
-                GDT_Float64, &dfBurnValue, nullptr, eBurnValueSource, eMergeAlg,
-                pfnTransformer, pTransformArg);
+                1, eBufType, nPixelSpace, nLineSpace, 0, bAllTouched,
+                bCoverage, poGeom, GDT_Float64, &dfBurnValue, nullptr,
+                eBurnValueSource, eMergeAlg, pfnTransformer, pTransformArg);
         }
 
         poLayer->ResetReading();
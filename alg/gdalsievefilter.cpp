@@ -34,16 +34,25 @@
 
 #include <algorithm>
 #include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <vector>
 #include <utility>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 
 #define MY_MAX_INT 2147483647
 
@@ -142,6 +151,750 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
         anBigNeighbour[nPolyId2] = nPolyId1;
 }
 
+/************************************************************************/
+/*                        GPSieveResolveMerges()                        */
+/*                                                                      */
+/*      Given the biggest neighbour of each final polygon, make         */
+/*      anBigNeighbour point, for each polygon smaller than the         */
+/*      threshold, to the polygon it must be merged into, or -1.        */
+/************************************************************************/
+
+static void GPSieveResolveMerges(const GInt32 *panPolyIdMap,
+                                 const std::int64_t *panPolyValue,
+                                 const std::vector<int> &anPolySizes,
+                                 std::vector<int> &anBigNeighbour,
+                                 int nSizeThreshold)
+{
+    /* -------------------------------------------------------------------- */
+    /*      If our biggest neighbour is still smaller than the              */
+    /*      threshold, then try tracking to that polygons biggest           */
+    /*      neighbour, and so forth.                                        */
+    /* -------------------------------------------------------------------- */
+    int nFailedMerges = 0;
+    int nIsolatedSmall = 0;
+    int nSieveTargets = 0;
+
+    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
+    {
+        if (panPolyIdMap[iPoly] != iPoly)
+            continue;
+
+        // Ignore nodata polygons.
+        if (panPolyValue[iPoly] == GP_NODATA_MARKER)
+            continue;
+
+        // Don't try to merge polygons larger than the threshold.
+        if (anPolySizes[iPoly] >= nSizeThreshold)
+        {
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        nSieveTargets++;
+
+        // if we have no neighbours but we are small, what shall we do?
+        if (anBigNeighbour[iPoly] == -1)
+        {
+            nIsolatedSmall++;
+            continue;
+        }
+
+        std::set<int> oSetVisitedPoly;
+        oSetVisitedPoly.insert(iPoly);
+
+        // Walk through our neighbours until we find a polygon large enough.
+        int iFinalId = iPoly;
+        bool bFoundBigEnoughPoly = false;
+        while (true)
+        {
+            iFinalId = anBigNeighbour[iFinalId];
+            if (iFinalId < 0)
+            {
+                break;
+            }
+            // If the biggest neighbour is larger than the threshold
+            // then we are golden.
+            if (anPolySizes[iFinalId] >= nSizeThreshold)
+            {
+                bFoundBigEnoughPoly = true;
+                break;
+            }
+            // Check that we don't cycle on an already visited polygon.
+            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
+                break;
+            oSetVisitedPoly.insert(iFinalId);
+        }
+
+        if (!bFoundBigEnoughPoly)
+        {
+            nFailedMerges++;
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        // Map the whole intermediate chain to it.
+        int iPolyCur = iPoly;
+        while (anBigNeighbour[iPolyCur] != iFinalId)
+        {
+            int iNextPoly = anBigNeighbour[iPolyCur];
+            anBigNeighbour[iPolyCur] = iFinalId;
+            iPolyCur = iNextPoly;
+        }
+    }
+
+    CPLDebug("GDALSieveFilter",
+             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
+             nIsolatedSmall, nFailedMerges);
+}
+
+/************************************************************************/
+/*                         GPSieveFilterMT()                            */
+/************************************************************************/
+
+namespace
+{
+
+// What is kept of a strip of lines between passes
+struct GPSieveStripInfo
+{
+    int iYStart = 0;
+    int iYEnd = 0;
+    // Global index of the first polygon fragment of the strip
+    int nFirstPoly = 0;
+    // Polygon fragment ids, in the strip, and values of the first and last
+    // lines of the strip
+    std::vector<GInt32> anFirstLineId{};
+    std::vector<GInt32> anLastLineId{};
+    std::vector<std::int64_t> anFirstLineVal{};
+    std::vector<std::int64_t> anLastLineVal{};
+};
+
+struct GPSieveContext
+{
+    int nXSize = 0;
+    int nConnectedness = 4;
+    std::vector<GPSieveStripInfo> aoStrips{};
+
+    // Indexed by global polygon fragment index. anPolyIdMap maps fragments
+    // to the index of their final polygon, and anPolySizes, anBigNeighbour
+    // and anBigNeighbourEvent are only meaningful for final polygons.
+    std::vector<GInt32> anPolyIdMap{};
+    std::vector<std::int64_t> anPolyValue{};
+    std::vector<int> anPolySizes{};
+    std::vector<int> anBigNeighbour{};
+    // Position, in scan order, of the neighbourhood that determined
+    // anBigNeighbour. Used to pick the same neighbour as the sequential
+    // algorithm when several have the same size.
+    std::vector<GUIntBig> anBigNeighbourEvent{};
+};
+
+struct GPSieveStrip
+{
+    std::mutex *poMutex = nullptr;
+    std::condition_variable *poCV = nullptr;
+    const GPSieveContext *psContext = nullptr;
+    int nPass = 0;
+    int iStrip = 0;
+    // Pixel values, with GP_NODATA_MARKER for masked pixels
+    std::vector<std::int64_t> anVal{};
+    // Pixel values to write
+    std::vector<std::int64_t> anWriteVal{};
+
+    CPLErr eErr = CE_None;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    // Pass 1 output, indexed by polygon fragment in the strip
+    std::vector<GInt32> anPolyIdMap{};
+    std::vector<std::int64_t> anPolyValue{};
+    std::vector<int> anPolySizes{};
+    std::vector<GInt32> anFirstLineId{};
+    std::vector<GInt32> anLastLineId{};
+    // Pass 2 output, indexed by polygon fragment in the strip
+    std::vector<int> anBigNeighbour{};
+    std::vector<GUIntBig> anBigNeighbourEvent{};
+    bool bDone = false;  // protected by *poMutex
+};
+
+}  // namespace
+
+// Update the biggest neighbour of a polygon with another neighbour, met at
+// position nEvent in scan order. On equal sizes, the neighbour met first is
+// kept, as CompareNeighbour() does.
+static inline void
+GPSieveUpdateBigNeighbour(int &nBigNeighbour, GUIntBig &nBigNeighbourEvent,
+                          int nNeighbour, GUIntBig nEvent,
+                          const std::vector<int> &anPolySizes)
+{
+    if (nBigNeighbour == -1 ||
+        anPolySizes[nBigNeighbour] < anPolySizes[nNeighbour] ||
+        (anPolySizes[nBigNeighbour] == anPolySizes[nNeighbour] &&
+         nEvent < nBigNeighbourEvent))
+    {
+        nBigNeighbour = nNeighbour;
+        nBigNeighbourEvent = nEvent;
+    }
+}
+
+// Position, in the scan order of the sequential second pass, of the
+// comparison of pixel (iX, iY) with its neighbour iNeighbour (0: above,
+// 1: above left, 2: above right, 3: left).
+static inline GUIntBig GPSieveEvent(int iX, int iY, int nXSize, int iNeighbour)
+{
+    return (static_cast<GUIntBig>(iY) * nXSize + iX) * 4 + iNeighbour;
+}
+
+static void GPSieveStripJob(void *pData)
+{
+    auto psStrip = static_cast<GPSieveStrip *>(pData);
+    const GPSieveContext &sContext = *(psStrip->psContext);
+    const GPSieveStripInfo &sInfo = sContext.aoStrips[psStrip->iStrip];
+    const int nXSize = sContext.nXSize;
+    const int nConnectedness = sContext.nConnectedness;
+
+    CPLInstallErrorHandlerAccumulator(psStrip->aoErrors);
+
+    GDALRasterPolygonEnumerator oEnum(nConnectedness);
+    std::vector<GInt32> anLastLineId(nXSize);
+    std::vector<GInt32> anThisLineId(nXSize);
+
+    // In passes 2 and 3, global index of the final polygon of a fragment
+    const auto FinalPoly = [&sContext, &sInfo](GInt32 nId)
+    { return sContext.anPolyIdMap[sInfo.nFirstPoly + nId]; };
+
+    // Pass 2: record a neighbourhood between two fragments of the strip
+    const auto CompareNeighbour =
+        [psStrip, &sContext, &FinalPoly](GInt32 nId1, GInt32 nId2,
+                                         GUIntBig nEvent)
+    {
+        if (nId1 < 0 || nId2 < 0)
+            return;
+        const int iPoly1 = FinalPoly(nId1);
+        const int iPoly2 = FinalPoly(nId2);
+        if (iPoly1 == iPoly2)
+            return;
+        GPSieveUpdateBigNeighbour(psStrip->anBigNeighbour[nId1],
+                                  psStrip->anBigNeighbourEvent[nId1], iPoly2,
+                                  nEvent, sContext.anPolySizes);
+        GPSieveUpdateBigNeighbour(psStrip->anBigNeighbour[nId2],
+                                  psStrip->anBigNeighbourEvent[nId2], iPoly1,
+                                  nEvent, sContext.anPolySizes);
+    };
+
+    CPLErr eErr = CE_None;
+    const int nLines = sInfo.iYEnd - sInfo.iYStart;
+    for (int iLine = 0; eErr == CE_None && iLine < nLines; ++iLine)
+    {
+        std::int64_t *panThisLineVal =
+            psStrip->anVal.data() + static_cast<size_t>(iLine) * nXSize;
+        if (iLine == 0)
+            eErr = oEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
+                                     anThisLineId.data(), nXSize)
+                       ? CE_None
+                       : CE_Failure;
+        else
+            eErr = oEnum.ProcessLine(panThisLineVal - nXSize, panThisLineVal,
+                                     anLastLineId.data(), anThisLineId.data(),
+                                     nXSize)
+                       ? CE_None
+                       : CE_Failure;
+        if (eErr != CE_None)
+            break;
+
+        if (psStrip->nPass == 1)
+        {
+            if (oEnum.nNextPolygonId >
+                static_cast<int>(psStrip->anPolySizes.size()))
+                psStrip->anPolySizes.resize(oEnum.nNextPolygonId);
+
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                const int iPoly = anThisLineId[iX];
+
+                if (iPoly >= 0 && psStrip->anPolySizes[iPoly] < MY_MAX_INT)
+                    psStrip->anPolySizes[iPoly] += 1;
+            }
+
+            if (iLine == 0)
+                psStrip->anFirstLineId = anThisLineId;
+            if (iLine == nLines - 1)
+                psStrip->anLastLineId = anThisLineId;
+        }
+        else if (psStrip->nPass == 2)
+        {
+            if (oEnum.nNextPolygonId >
+                static_cast<int>(psStrip->anBigNeighbour.size()))
+            {
+                psStrip->anBigNeighbour.resize(oEnum.nNextPolygonId, -1);
+                psStrip->anBigNeighbourEvent.resize(oEnum.nNextPolygonId);
+            }
+
+            // The comparisons of the first line with the last line of the
+            // previous strip are done when merging strips.
+            const int iY = sInfo.iYStart + iLine;
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                if (iLine > 0)
+                {
+                    CompareNeighbour(anThisLineId[iX], anLastLineId[iX],
+                                     GPSieveEvent(iX, iY, nXSize, 0));
+
+                    if (iX > 0 && nConnectedness == 8)
+                        CompareNeighbour(anThisLineId[iX],
+                                         anLastLineId[iX - 1],
+                                         GPSieveEvent(iX, iY, nXSize, 1));
+
+                    if (iX < nXSize - 1 && nConnectedness == 8)
+                        CompareNeighbour(anThisLineId[iX],
+                                         anLastLineId[iX + 1],
+                                         GPSieveEvent(iX, iY, nXSize, 2));
+                }
+
+                if (iX > 0)
+                    CompareNeighbour(anThisLineId[iX], anThisLineId[iX - 1],
+                                     GPSieveEvent(iX, iY, nXSize, 3));
+            }
+        }
+        else
+        {
+            std::int64_t *panThisLineWriteVal =
+                psStrip->anWriteVal.data() +
+                static_cast<size_t>(iLine) * nXSize;
+            for (int iX = 0; iX < nXSize; iX++)
+            {
+                if (anThisLineId[iX] >= 0)
+                {
+                    const int iThisPoly = FinalPoly(anThisLineId[iX]);
+                    const int iBigNeighbour =
+                        sContext.anBigNeighbour[iThisPoly];
+
+                    if (iBigNeighbour != -1)
+                    {
+                        panThisLineWriteVal[iX] =
+                            sContext.anPolyValue[iBigNeighbour];
+                    }
+                }
+            }
+        }
+
+        std::swap(anLastLineId, anThisLineId);
+    }
+
+    if (eErr == CE_None && psStrip->nPass == 1)
+    {
+        oEnum.CompleteMerges();
+        psStrip->anPolyIdMap.assign(oEnum.panPolyIdMap,
+                                    oEnum.panPolyIdMap + oEnum.nNextPolygonId);
+        psStrip->anPolyValue.assign(oEnum.panPolyValue,
+                                    oEnum.panPolyValue + oEnum.nNextPolygonId);
+        psStrip->anPolySizes.resize(oEnum.nNextPolygonId);
+    }
+    else if (eErr == CE_None && psStrip->nPass == 2)
+    {
+        psStrip->anBigNeighbour.resize(oEnum.nNextPolygonId, -1);
+        psStrip->anBigNeighbourEvent.resize(oEnum.nNextPolygonId);
+    }
+    psStrip->eErr = eErr;
+
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(*(psStrip->poMutex));
+    psStrip->bDone = true;
+    psStrip->poCV->notify_all();
+}
+
+// Find the final polygon of a fragment during pass 1, when anPolyIdMap is
+// a union-find forest.
+static int GPSieveFindPoly(std::vector<GInt32> &anPolyIdMap, int iPoly)
+{
+    while (anPolyIdMap[iPoly] != iPoly)
+    {
+        anPolyIdMap[iPoly] = anPolyIdMap[anPolyIdMap[iPoly]];
+        iPoly = anPolyIdMap[iPoly];
+    }
+    return iPoly;
+}
+
+// Same algorithm as the sequential code of GDALSieveFilter(), except that
+// each of the three passes processes strips of lines in worker threads.
+// The calling thread does all raster I/O, and joins polygons across strip
+// boundaries between passes, so the result is the same.
+static CPLErr GPSieveFilterMT(GDALRasterBandH hSrcBand,
+                              GDALRasterBandH hMaskBand,
+                              GDALRasterBandH hDstBand, int nSizeThreshold,
+                              int nConnectedness, CPLJobQueue *poJobQueue,
+                              int nThreads, GDALProgressFunc pfnProgress,
+                              void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    // Strips of at most about 1 million pixels, and enough of them to keep
+    // all threads busy.
+    const int nStripLines = std::max(
+        1, std::min((1024 * 1024) / std::max(1, nXSize),
+                    (nYSize + 2 * nThreads - 1) / (2 * nThreads)));
+
+    GPSieveContext sContext;
+    sContext.nXSize = nXSize;
+    sContext.nConnectedness = nConnectedness;
+    for (int iYStart = 0; iYStart < nYSize; iYStart += nStripLines)
+    {
+        GPSieveStripInfo sInfo;
+        sInfo.iYStart = iYStart;
+        sInfo.iYEnd = std::min(iYStart + nStripLines, nYSize);
+        sContext.aoStrips.push_back(std::move(sInfo));
+    }
+    const int nStrips = static_cast<int>(sContext.aoStrips.size());
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::vector<std::unique_ptr<GPSieveStrip>> apoFreeStrips;
+    for (int i = 0; i < 2 * nThreads; ++i)
+    {
+        auto poStrip = std::make_unique<GPSieveStrip>();
+        poStrip->poMutex = &oMutex;
+        poStrip->poCV = &oCV;
+        poStrip->psContext = &sContext;
+        apoFreeStrips.push_back(std::move(poStrip));
+    }
+
+    // Run a pass over all strips, calling pfnConsumeStrip() on the result
+    // of each strip, in order.
+    const auto RunPass =
+        [&](int nPass, double dfProgressStart, double dfProgressEnd,
+            const std::function<CPLErr(GPSieveStrip &)> &pfnConsumeStrip)
+    {
+        std::deque<std::unique_ptr<GPSieveStrip>> apoPendingStrips;
+
+        const auto ConsumeOldestStrip = [&]()
+        {
+            auto poStrip = std::move(apoPendingStrips.front());
+            apoPendingStrips.pop_front();
+            {
+                std::unique_lock<std::mutex> oLock(oMutex);
+                oCV.wait(oLock, [&poStrip] { return poStrip->bDone; });
+            }
+            for (const auto &oError : poStrip->aoErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+            poStrip->aoErrors.clear();
+            CPLErr eErr = poStrip->eErr;
+            if (eErr == CE_None)
+                eErr = pfnConsumeStrip(*poStrip);
+            if (eErr == CE_None &&
+                !pfnProgress(dfProgressStart +
+                                 (dfProgressEnd - dfProgressStart) *
+                                     sContext.aoStrips[poStrip->iStrip].iYEnd /
+                                     nYSize,
+                             "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                eErr = CE_Failure;
+            }
+            apoFreeStrips.push_back(std::move(poStrip));
+            return eErr;
+        };
+
+        CPLErr eErr = CE_None;
+        for (int iStrip = 0; eErr == CE_None && iStrip < nStrips;)
+        {
+            if (apoFreeStrips.empty())
+            {
+                eErr = ConsumeOldestStrip();
+                continue;
+            }
+            auto poStrip = std::move(apoFreeStrips.back());
+            apoFreeStrips.pop_back();
+            const auto &sInfo = sContext.aoStrips[iStrip];
+            const int nLines = sInfo.iYEnd - sInfo.iYStart;
+            const size_t nPixels = static_cast<size_t>(nLines) * nXSize;
+            poStrip->nPass = nPass;
+            poStrip->iStrip = iStrip;
+            poStrip->eErr = CE_None;
+            poStrip->bDone = false;
+            poStrip->anPolySizes.clear();
+            poStrip->anBigNeighbour.clear();
+            poStrip->anBigNeighbourEvent.clear();
+            std::vector<GByte> abyMask;
+            try
+            {
+                poStrip->anVal.resize(nPixels);
+                if (hMaskBand)
+                    abyMask.resize(nPixels);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate strip buffers");
+                eErr = CE_Failure;
+                break;
+            }
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, sInfo.iYStart, nXSize,
+                                nLines, poStrip->anVal.data(), nXSize, nLines,
+                                GDT_Int64, 0, 0);
+            if (eErr == CE_None && nPass == 3)
+            {
+                try
+                {
+                    poStrip->anWriteVal = poStrip->anVal;
+                }
+                catch (const std::exception &)
+                {
+                    CPLError(CE_Failure, CPLE_OutOfMemory,
+                             "Cannot allocate strip buffers");
+                    eErr = CE_Failure;
+                }
+            }
+            if (eErr == CE_None && hMaskBand)
+            {
+                eErr = GDALRasterIO(hMaskBand, GF_Read, 0, sInfo.iYStart,
+                                    nXSize, nLines, abyMask.data(), nXSize,
+                                    nLines, GDT_Byte, 0, 0);
+                for (size_t i = 0; eErr == CE_None && i < nPixels; ++i)
+                {
+                    if (abyMask[i] == 0)
+                        poStrip->anVal[i] = GP_NODATA_MARKER;
+                }
+            }
+            if (eErr != CE_None)
+                break;
+            ++iStrip;
+            auto psStrip = poStrip.get();
+            apoPendingStrips.push_back(std::move(poStrip));
+            poJobQueue->SubmitJob(GPSieveStripJob, psStrip);
+        }
+
+        while (!apoPendingStrips.empty())
+        {
+            if (eErr == CE_None)
+            {
+                eErr = ConsumeOldestStrip();
+            }
+            else
+            {
+                // Only wait for the jobs that reference the strips
+                poJobQueue->WaitCompletion();
+                apoPendingStrips.clear();
+            }
+        }
+        return eErr;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: enumerate the polygon fragments of each strip,      */
+    /*      and join fragments across strip boundaries, with the same       */
+    /*      rules as GDALRasterPolygonEnumerator.                           */
+    /* -------------------------------------------------------------------- */
+    auto &anPolyIdMap = sContext.anPolyIdMap;
+    auto &anPolyValue = sContext.anPolyValue;
+    auto &anPolySizes = sContext.anPolySizes;
+    CPLErr eErr = RunPass(
+        1, 0.0, 0.25,
+        [&](GPSieveStrip &oStrip)
+        {
+            auto &sInfo = sContext.aoStrips[oStrip.iStrip];
+            const size_t nStripPolys = oStrip.anPolyIdMap.size();
+            if (nStripPolys >
+                static_cast<size_t>(std::numeric_limits<int>::max()) -
+                    anPolyIdMap.size())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "GDALSieveFilter(): maximum number of polygons "
+                         "reached");
+                return CE_Failure;
+            }
+            sInfo.nFirstPoly = static_cast<int>(anPolyIdMap.size());
+            try
+            {
+                for (size_t i = 0; i < nStripPolys; ++i)
+                {
+                    anPolyIdMap.push_back(sInfo.nFirstPoly +
+                                          oStrip.anPolyIdMap[i]);
+                }
+                anPolyValue.insert(anPolyValue.end(),
+                                   oStrip.anPolyValue.begin(),
+                                   oStrip.anPolyValue.end());
+                anPolySizes.insert(anPolySizes.end(),
+                                   oStrip.anPolySizes.begin(),
+                                   oStrip.anPolySizes.end());
+                sInfo.anFirstLineId = std::move(oStrip.anFirstLineId);
+                sInfo.anLastLineId = std::move(oStrip.anLastLineId);
+                sInfo.anFirstLineVal.assign(oStrip.anVal.begin(),
+                                            oStrip.anVal.begin() + nXSize);
+                sInfo.anLastLineVal.assign(oStrip.anVal.end() - nXSize,
+                                           oStrip.anVal.end());
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate polygon maps");
+                return CE_Failure;
+            }
+
+            if (oStrip.iStrip > 0)
+            {
+                auto &sPrevInfo = sContext.aoStrips[oStrip.iStrip - 1];
+                const auto Link = [&](int iXAbove, int iX)
+                {
+                    const GInt32 nIdAbove = sPrevInfo.anLastLineId[iXAbove];
+                    const GInt32 nId = sInfo.anFirstLineId[iX];
+                    if (nIdAbove < 0 || nId < 0 ||
+                        sPrevInfo.anLastLineVal[iXAbove] !=
+                            sInfo.anFirstLineVal[iX])
+                        return;
+                    const int iPolyAbove = GPSieveFindPoly(
+                        anPolyIdMap, sPrevInfo.nFirstPoly + nIdAbove);
+                    const int iPoly =
+                        GPSieveFindPoly(anPolyIdMap, sInfo.nFirstPoly + nId);
+                    if (iPolyAbove != iPoly)
+                        anPolyIdMap[std::max(iPolyAbove, iPoly)] =
+                            std::min(iPolyAbove, iPoly);
+                };
+                for (int iX = 0; iX < nXSize; ++iX)
+                {
+                    Link(iX, iX);
+                    if (nConnectedness == 8)
+                    {
+                        if (iX > 0)
+                            Link(iX - 1, iX);
+                        if (iX + 1 < nXSize)
+                            Link(iX + 1, iX);
+                    }
+                }
+                // Only needed by the comparisons of pass 2
+                sPrevInfo.anLastLineVal.clear();
+                sPrevInfo.anLastLineVal.shrink_to_fit();
+            }
+            sInfo.anFirstLineVal.clear();
+            sInfo.anFirstLineVal.shrink_to_fit();
+            return CE_None;
+        });
+    if (eErr != CE_None)
+        return eErr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Make every fragment point to its final polygon, and push the    */
+    /*      sizes of merged polygon fragments into the final polygon.       */
+    /* -------------------------------------------------------------------- */
+    const int nPolys = static_cast<int>(anPolyIdMap.size());
+    for (int iPoly = 0; iPoly < nPolys; iPoly++)
+    {
+        const int iFinal = GPSieveFindPoly(anPolyIdMap, iPoly);
+        anPolyIdMap[iPoly] = iFinal;
+        if (iFinal != iPoly)
+        {
+            GIntBig nSize = anPolySizes[iFinal];
+
+            nSize += anPolySizes[iPoly];
+
+            if (nSize > MY_MAX_INT)
+                nSize = MY_MAX_INT;
+
+            anPolySizes[iFinal] = static_cast<int>(nSize);
+            anPolySizes[iPoly] = 0;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: identify the largest neighbour of each polygon.    */
+    /* -------------------------------------------------------------------- */
+    auto &anBigNeighbour = sContext.anBigNeighbour;
+    auto &anBigNeighbourEvent = sContext.anBigNeighbourEvent;
+    try
+    {
+        anBigNeighbour.resize(nPolys, -1);
+        anBigNeighbourEvent.resize(nPolys);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate polygon maps");
+        return CE_Failure;
+    }
+
+    eErr = RunPass(
+        2, 0.25, 0.5,
+        [&](GPSieveStrip &oStrip)
+        {
+            const auto &sInfo = sContext.aoStrips[oStrip.iStrip];
+            for (size_t i = 0; i < oStrip.anBigNeighbour.size(); ++i)
+            {
+                if (oStrip.anBigNeighbour[i] >= 0)
+                {
+                    const int iPoly = anPolyIdMap[sInfo.nFirstPoly + i];
+                    GPSieveUpdateBigNeighbour(
+                        anBigNeighbour[iPoly], anBigNeighbourEvent[iPoly],
+                        oStrip.anBigNeighbour[i],
+                        oStrip.anBigNeighbourEvent[i], anPolySizes);
+                }
+            }
+
+            if (oStrip.iStrip > 0)
+            {
+                const auto &sPrevInfo = sContext.aoStrips[oStrip.iStrip - 1];
+                const int iY = sInfo.iYStart;
+                const auto CompareNeighbour =
+                    [&](int iX, int iXAbove, int iNeighbour)
+                {
+                    const GInt32 nId = sInfo.anFirstLineId[iX];
+                    const GInt32 nIdAbove = sPrevInfo.anLastLineId[iXAbove];
+                    if (nId < 0 || nIdAbove < 0)
+                        return;
+                    const int iPoly = anPolyIdMap[sInfo.nFirstPoly + nId];
+                    const int iPolyAbove =
+                        anPolyIdMap[sPrevInfo.nFirstPoly + nIdAbove];
+                    if (iPoly == iPolyAbove)
+                        return;
+                    const GUIntBig nEvent =
+                        GPSieveEvent(iX, iY, nXSize, iNeighbour);
+                    GPSieveUpdateBigNeighbour(
+                        anBigNeighbour[iPoly], anBigNeighbourEvent[iPoly],
+                        iPolyAbove, nEvent, anPolySizes);
+                    GPSieveUpdateBigNeighbour(anBigNeighbour[iPolyAbove],
+                                              anBigNeighbourEvent[iPolyAbove],
+                                              iPoly, nEvent, anPolySizes);
+                };
+                for (int iX = 0; iX < nXSize; iX++)
+                {
+                    CompareNeighbour(iX, iX, 0);
+                    if (iX > 0 && nConnectedness == 8)
+                        CompareNeighbour(iX, iX - 1, 1);
+                    if (iX < nXSize - 1 && nConnectedness == 8)
+                        CompareNeighbour(iX, iX + 1, 2);
+                }
+            }
+            return CE_None;
+        });
+    if (eErr != CE_None)
+        return eErr;
+
+    for (auto &sInfo : sContext.aoStrips)
+    {
+        sInfo.anFirstLineId.clear();
+        sInfo.anFirstLineId.shrink_to_fit();
+        sInfo.anLastLineId.clear();
+        sInfo.anLastLineId.shrink_to_fit();
+    }
+    anBigNeighbourEvent.clear();
+    anBigNeighbourEvent.shrink_to_fit();
+
+    GPSieveResolveMerges(anPolyIdMap.data(), anPolyValue.data(), anPolySizes,
+                         anBigNeighbour, nSizeThreshold);
+
+    /* -------------------------------------------------------------------- */
+    /*      Third pass: apply the merges, and write strips in order.        */
+    /* -------------------------------------------------------------------- */
+    return RunPass(3, 0.5, 1.0,
+                   [&](GPSieveStrip &oStrip)
+                   {
+                       const auto &sInfo = sContext.aoStrips[oStrip.iStrip];
+                       const int nLines = sInfo.iYEnd - sInfo.iYStart;
+                       return GDALRasterIO(hDstBand, GF_Write, 0, sInfo.iYStart,
+                                           nXSize, nLines,
+                                           oStrip.anWriteVal.data(), nXSize,
+                                           nLines, GDT_Int64, 0, 0);
+                   });
+}
+
 /************************************************************************/
 /*                          GDALSieveFilter()                           */
 /************************************************************************/
@@ -183,8 +936,14 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * @param nConnectedness either 4 indicating that diagonal pixels are not
  * considered directly adjacent for polygon membership purposes or 8
  * indicating they are.
- * @param papszOptions algorithm options in name=value list form.  None
- * currently supported.
+ * @param papszOptions algorithm options in name=value list form.
+ * The following options are supported:
+ * <ul>
+ * <li>NUM_THREADS=number_of_threads|ALL_CPUS: (GDAL >= 3.10) Number of
+ * worker threads used to enumerate polygons and apply merges, by strips of
+ * lines. Defaults to the value of the GDAL_NUM_THREADS configuration option,
+ * or 1. The result does not depend on the number of threads.</li>
+ * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
@@ -196,7 +955,7 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
                                    GDALRasterBandH hMaskBand,
                                    GDALRasterBandH hDstBand, int nSizeThreshold,
                                    int nConnectedness,
-                                   CPL_UNUSED char **papszOptions,
+                                   char **papszOptions,
                                    GDALProgressFunc pfnProgress,
                                    void *pProgressArg)
 {
@@ -206,6 +965,31 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
+    /* -------------------------------------------------------------------- */
+    /*      Use worker threads on strips of lines if asked to.              */
+    /* -------------------------------------------------------------------- */
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads)));
+    if (nThreads > 1 && GDALGetRasterBandYSize(hSrcBand) > 1 &&
+        GDALGetRasterBandXSize(hSrcBand) > 0)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        auto poJobQueue =
+            poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+        if (poJobQueue)
+        {
+            return GPSieveFilterMT(hSrcBand, hMaskBand, hDstBand,
+                                   nSizeThreshold, nConnectedness,
+                                   poJobQueue.get(), nThreads, pfnProgress,
+                                   pProgressArg);
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate working buffers.                                       */
     /* -------------------------------------------------------------------- */
@@ -452,86 +1236,8 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
         }
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      If our biggest neighbour is still smaller than the              */
-    /*      threshold, then try tracking to that polygons biggest           */
-    /*      neighbour, and so forth.                                        */
-    /* -------------------------------------------------------------------- */
-    int nFailedMerges = 0;
-    int nIsolatedSmall = 0;
-    int nSieveTargets = 0;
-
-    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
-    {
-        if (oFirstEnum.panPolyIdMap[iPoly] != iPoly)
-            continue;
-
-        // Ignore nodata polygons.
-        if (oFirstEnum.panPolyValue[iPoly] == GP_NODATA_MARKER)
-            continue;
-
-        // Don't try to merge polygons larger than the threshold.
-        if (anPolySizes[iPoly] >= nSizeThreshold)
-        {
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        nSieveTargets++;
-
-        // if we have no neighbours but we are small, what shall we do?
-        if (anBigNeighbour[iPoly] == -1)
-        {
-            nIsolatedSmall++;
-            continue;
-        }
-
-        std::set<int> oSetVisitedPoly;
-        oSetVisitedPoly.insert(iPoly);
-
-        // Walk through our neighbours until we find a polygon large enough.
-        int iFinalId = iPoly;
-        bool bFoundBigEnoughPoly = false;
-        while (true)
-        {
-            iFinalId = anBigNeighbour[iFinalId];
-            if (iFinalId < 0)
-            {
-                break;
-            }
-            // If the biggest neighbour is larger than the threshold
-            // then we are golden.
-            if (anPolySizes[iFinalId] >= nSizeThreshold)
-            {
-                bFoundBigEnoughPoly = true;
-                break;
-            }
-            // Check that we don't cycle on an already visited polygon.
-            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
-                break;
-            oSetVisitedPoly.insert(iFinalId);
-        }
-
-        if (!bFoundBigEnoughPoly)
-        {
-            nFailedMerges++;
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        // Map the whole intermediate chain to it.
-        int iPolyCur = iPoly;
-        while (anBigNeighbour[iPolyCur] != iFinalId)
-        {
-            int iNextPoly = anBigNeighbour[iPolyCur];
-            anBigNeighbour[iPolyCur] = iFinalId;
-            iPolyCur = iNextPoly;
-        }
-    }
-
-    CPLDebug("GDALSieveFilter",
-             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
-             nIsolatedSmall, nFailedMerges);
+    GPSieveResolveMerges(oFirstEnum.panPolyIdMap, oFirstEnum.panPolyValue,
+                         anPolySizes, anBigNeighbour, nSizeThreshold);
 
     /* ==================================================================== */
     /*      Make a third pass over the image, actually applying the         */
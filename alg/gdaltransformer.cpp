@@ -1861,6 +1861,31 @@ static void GDALGCPAntimeridianUnwrap(int nGCPCount, GDAL_GCP *pasGCPList,
  * the backmap. The default is NO, that is to use in-memory arrays, unless the
  * number of pixels of the geolocation array is greater than 16 megapixels.
  * </li>
+ * <li> GEOLOC_BACKMAP_CACHE_FILENAME=filename.
+ * (GDAL &gt;= 3.10) Name of a GeoTIFF file in which the "backmap" of
+ * geolocation array transformers is saved once computed, and from which it is
+ * loaded by later transformers built from the same geolocation arrays and
+ * parameters, instead of being computed again. The file is silently
+ * overwritten if it has been computed with other arrays or parameters.
+ * May also be set with the GDAL_GEOLOC_BACKMAP_CACHE_FILENAME configuration
+ * option.
+ * </li>
+ * <li> NUM_THREADS=number|ALL_CPUS. (GDAL &gt;= 3.10) Number of threads used
+ * to compute the "backmap" of geolocation array transformers, when it is held
+ * in memory. Defaults to the value of the GDAL_NUM_THREADS configuration
+ * option, or 1. Also used by the TPS transformer, to solve its splines and
+ * to transform large batches of points.
+ * </li>
+ * <li> TPS_MODE=GLOBAL/LOCAL. (GDAL &gt;= 3.10) Method used by the thin plate
+ * spline transformer. GLOBAL (the default) solves a single spline on all GCPs,
+ * whose cost grows with the cube of the number of GCPs. LOCAL computes splines
+ * on the GCPs of the neighbourhood of the nodes of a regular grid, and blends
+ * them, which is much faster for thousands of GCPs. The result still honours
+ * exactly the GCPs, but slightly differs from the GLOBAL one elsewhere.
+ * </li>
+ * <li> TPS_LOCAL_GCP_COUNT=integer. (GDAL &gt;= 3.10) Approximate number of
+ * GCPs of each local spline, when TPS_MODE=LOCAL. Defaults to 200.
+ * </li>
  * <li>
  * GEOLOC_ARRAY/SRC_GEOLOC_ARRAY=filename. (GDAL &gt;= 3.5.2) Name of a GDAL
  * dataset containing a geolocation array and associated metadata. This is an
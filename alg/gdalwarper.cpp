@@ -1102,6 +1102,14 @@ CPLErr GDALWarpDstAlphaMasker(void *pMaskFuncArg, int nBandCount,
  * situations. Starting with GDAL 2.4, gdalwarp will automatically enable this
  * option when it is assumed to be safe to do so.</li>
  *
+ * <li>SKIP_EMPTY_SOURCE_WINDOW=YES/NO: (GDAL >= 3.10) Whether to skip reading
+ * and warping source windows for which GDALGetDataCoverageStatus() reports
+ * that they have no data (e.g. sparse GeoTIFF files or VRT mosaics), when the
+ * values read in such areas would be invalid anyway (matching source nodata
+ * value, or fully transparent source alpha band). When SKIP_NOSOURCE=YES is
+ * also set, the corresponding chunks are skipped entirely. Defaults to YES.
+ * </li>
+ *
  * <li>UNIFIED_SRC_NODATA=YES/NO/PARTIAL: This setting determines
  * how to take into account nodata values when there are several input bands.
  * <ul>
@@ -1177,6 +1185,16 @@ CPLErr GDALWarpDstAlphaMasker(void *pMaskFuncArg, int nBandCount,
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>NUM_CHUNK_THREADS: (GDAL >= 3.10) Can be set to a numeric value or
+ * ALL_CPUS to set the number of chunks that
+ * GDALWarpOperation::ChunkAndWarpMulti() processes concurrently. Reading and writing of chunks remain serialized,
+ * but the computation of several chunks may run at the same time, each
+ * one using NUM_THREADS threads. The number of chunks in memory at the same
+ * time is limited so that it does not exceed GDAL_CACHEMAX, given the
+ * warp memory limit. Ignored if STREAMABLE_OUTPUT is set.
+ * Default is 1, that is input/output of one chunk is done while the
+ * computation of another one is done.</li>
+ *
  * <li>STREAMABLE_OUTPUT: (GDAL >= 2.0) This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
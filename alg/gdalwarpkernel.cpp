@@ -42,11 +42,13 @@
 #include <limits>
 #include <mutex>
 #include <new>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_mask.h"
 #include "cpl_multiproc.h"
@@ -59,6 +61,7 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_thread_pool.h"
+#include "gdalwarpkernel_avx2.h"
 #include "gdalwarpkernel_opencl.h"
 
 // #define CHECK_SUM_WITH_GEOS
@@ -1222,16 +1225,42 @@ CPLErr GDALWarpKernel::PerformWarp()
     {
         if (pafUnifiedSrcDensity != nullptr)
         {
-            // If pafUnifiedSrcDensity is only set to 1.0, then we can
-            // discard it.
+            // If pafUnifiedSrcDensity is only set to 0.0 or 1.0, which is
+            // the case of alpha bands with only 0 and 255 values, or of
+            // cutlines without blending, then it is equivalent to a
+            // validity mask, which the OpenCL warper supports.
+            const GPtrDiff_t nSrcPixels =
+                static_cast<GPtrDiff_t>(nSrcXSize) * nSrcYSize;
             bool bFoundNotOne = false;
-            for (GPtrDiff_t j = 0;
-                 j < static_cast<GPtrDiff_t>(nSrcXSize) * nSrcYSize; j++)
+            bool bFoundNotZeroOrOne = false;
+            for (GPtrDiff_t j = 0; j < nSrcPixels; j++)
             {
-                if (pafUnifiedSrcDensity[j] != 1.0)
+                if (pafUnifiedSrcDensity[j] != 1.0f)
                 {
                     bFoundNotOne = true;
-                    break;
+                    if (pafUnifiedSrcDensity[j] != 0.0f)
+                    {
+                        bFoundNotZeroOrOne = true;
+                        break;
+                    }
+                }
+            }
+            if (bFoundNotOne && !bFoundNotZeroOrOne)
+            {
+                if (panUnifiedSrcValid == nullptr)
+                {
+                    panUnifiedSrcValid = CPLMaskCreate(
+                        static_cast<size_t>(nSrcPixels), true);
+                }
+                if (panUnifiedSrcValid != nullptr)
+                {
+                    for (GPtrDiff_t j = 0; j < nSrcPixels; j++)
+                    {
+                        if (pafUnifiedSrcDensity[j] == 0.0f)
+                            CPLMaskClear(panUnifiedSrcValid,
+                                         static_cast<size_t>(j));
+                    }
+                    bFoundNotOne = false;
                 }
             }
             if (!bFoundNotOne)
@@ -1248,8 +1277,9 @@ CPLErr GDALWarpKernel::PerformWarp()
             if (!bHasWarned)
             {
                 bHasWarned = true;
-                CPLDebug("WARP", "pafUnifiedSrcDensity is not null, "
-                                 "hence OpenCL warper cannot be used");
+                CPLDebug("WARP",
+                         "pafUnifiedSrcDensity has values other than 0 and 1, "
+                         "hence OpenCL warper cannot be used");
             }
         }
         else
@@ -2572,7 +2602,8 @@ static bool GWKGetPixelT(const GDALWarpKernel *poWK, int iBand,
     T *pSrc = reinterpret_cast<T *>(poWK->papabySrcImage[iBand]);
 
     if ((poWK->panUnifiedSrcValid != nullptr &&
-         !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset)) ||
+         !CPLMaskGet(poWK->panUnifiedSrcValid,
+                                static_cast<size_t>(iSrcOffset))) ||
         (poWK->papanBandSrcValid != nullptr &&
          poWK->papanBandSrcValid[iBand] != nullptr &&
          !CPLMaskGet(poWK->papanBandSrcValid[iBand], iSrcOffset)))
@@ -4846,6 +4877,11 @@ static CPLErr GWKOpenCLCase(GDALWarpKernel *poWK)
                     iSrcX + static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
                 double dfDensity = 1.0;
 
+                if (poWK->panUnifiedSrcValid != nullptr &&
+                    !CPLMaskGet(poWK->panUnifiedSrcValid,
+                                static_cast<size_t>(iSrcOffset)))
+                    continue;
+
                 if (poWK->pafUnifiedSrcDensity != nullptr && iSrcX >= 0 &&
                     iSrcY >= 0 && iSrcX < nSrcXSize && iSrcY < nSrcYSize)
                     dfDensity = poWK->pafUnifiedSrcDensity[iSrcOffset];
@@ -5415,7 +5451,8 @@ static void GWKGeneralCaseThread(void *pData)
             }
 
             if (poWK->panUnifiedSrcValid != nullptr &&
-                !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset))
+                !CPLMaskGet(poWK->panUnifiedSrcValid,
+                                static_cast<size_t>(iSrcOffset)))
             {
                 if (!bOneSourceCornerFailsToReproject)
                 {
@@ -5691,7 +5728,8 @@ static void GWKRealCaseThread(void *pData)
             }
 
             if (poWK->panUnifiedSrcValid != nullptr &&
-                !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset))
+                !CPLMaskGet(poWK->panUnifiedSrcValid,
+                                static_cast<size_t>(iSrcOffset)))
             {
                 if (!bOneSourceCornerFailsToReproject)
                 {
@@ -5905,6 +5943,25 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
     for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
         padfX[nDstXSize + iDstX] = iDstX + 0.5 + poWK->nDstXOff;
 
+    // With AVX2, the interpolated values of a whole line are computed
+    // upfront, 8 pixels at a time.
+    GByte *pabyValid = nullptr;
+    GByte *pabyTodo = nullptr;
+    float *pafValues = nullptr;
+#ifdef HAVE_GWK_AVX2
+    if constexpr (std::is_same<T, float>::value && bUse4SamplesFormula &&
+                  (eResample == GRA_Bilinear || eResample == GRA_Cubic))
+    {
+        if (CPLHaveRuntimeAVX2())
+        {
+            pabyValid = static_cast<GByte *>(CPLMalloc(nDstXSize));
+            pabyTodo = static_cast<GByte *>(CPLMalloc(nDstXSize));
+            pafValues = static_cast<float *>(
+                CPLMalloc(sizeof(float) * nDstXSize * poWK->nBands));
+        }
+    }
+#endif
+
     /* ==================================================================== */
     /*      Loop over output lines.                                         */
     /* ==================================================================== */
@@ -5937,6 +5994,51 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
                 0.5 + poWK->nDstXOff, iDstY + 0.5 + poWK->nDstYOff);
         }
 
+#ifdef HAVE_GWK_AVX2
+        if constexpr (std::is_same<T, float>::value && bUse4SamplesFormula &&
+                      (eResample == GRA_Bilinear || eResample == GRA_Cubic))
+        {
+            if (pafValues)
+            {
+                for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+                {
+                    GPtrDiff_t iSrcOffset = 0;
+                    pabyValid[iDstX] = GWKCheckAndComputeSrcOffsets(
+                        psJob, pabSuccess, iDstX, iDstY, padfX, padfY,
+                        nSrcXSize, nSrcYSize, iSrcOffset);
+                }
+                for (int iBand = 0; iBand < poWK->nBands; iBand++)
+                {
+                    float *pafBandValues =
+                        pafValues + static_cast<size_t>(iBand) * nDstXSize;
+                    memcpy(pabyTodo, pabyValid, nDstXSize);
+                    GWKResampleNoMasks4SampleFloat_AVX2(
+                        eResample == GRA_Cubic,
+                        reinterpret_cast<const float *>(
+                            poWK->papabySrcImage[iBand]),
+                        nSrcXSize, nSrcYSize, padfX, padfY, poWK->nSrcXOff,
+                        poWK->nSrcYOff, nDstXSize, pabyTodo, pafBandValues);
+                    // Pixels near the edges of the source buffer.
+                    for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+                    {
+                        if (!pabyTodo[iDstX])
+                            continue;
+                        if constexpr (eResample == GRA_Bilinear)
+                            GWKBilinearResampleNoMasks4SampleT(
+                                poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
+                                padfY[iDstX] - poWK->nSrcYOff,
+                                pafBandValues + iDstX);
+                        else
+                            GWKCubicResampleNoMasks4SampleT(
+                                poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
+                                padfY[iDstX] - poWK->nSrcYOff,
+                                pafBandValues + iDstX);
+                    }
+                }
+            }
+        }
+#endif
+
         /* ====================================================================
          */
         /*      Loop over pixels in output scanline. */
@@ -5945,9 +6047,15 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
         for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
         {
             GPtrDiff_t iSrcOffset = 0;
-            if (!GWKCheckAndComputeSrcOffsets(psJob, pabSuccess, iDstX, iDstY,
-                                              padfX, padfY, nSrcXSize,
-                                              nSrcYSize, iSrcOffset))
+            if (pabyValid)
+            {
+                if (!pabyValid[iDstX])
+                    continue;
+            }
+            else if (!GWKCheckAndComputeSrcOffsets(psJob, pabSuccess, iDstX,
+                                                   iDstY, padfX, padfY,
+                                                   nSrcXSize, nSrcYSize,
+                                                   iSrcOffset))
                 continue;
 
             /* ====================================================================
@@ -5968,7 +6076,11 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
                 }
                 else if constexpr (bUse4SamplesFormula)
                 {
-                    if constexpr (eResample == GRA_Bilinear)
+                    if (pafValues)
+                        value = static_cast<T>(
+                            pafValues[static_cast<size_t>(iBand) * nDstXSize +
+                                      iDstX]);
+                    else if constexpr (eResample == GRA_Bilinear)
                         GWKBilinearResampleNoMasks4SampleT(
                             poWK, iBand, padfX[iDstX] - poWK->nSrcXOff,
                             padfY[iDstX] - poWK->nSrcYOff, &value);
@@ -6020,6 +6132,9 @@ static void GWKResampleNoMasksOrDstDensityOnlyThreadInternal(void *pData)
     CPLFree(padfZ);
     CPLFree(pabSuccess);
     CPLFree(padfWeight);
+    CPLFree(pabyValid);
+    CPLFree(pabyTodo);
+    CPLFree(pafValues);
 }
 
 template <class T, GDALResampleAlg eResample>
@@ -6195,7 +6310,8 @@ template <class T> static void GWKNearestThread(void *pData)
             /* --------------------------------------------------------------------
              */
             if (poWK->panUnifiedSrcValid != nullptr &&
-                !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset))
+                !CPLMaskGet(poWK->panUnifiedSrcValid,
+                                static_cast<size_t>(iSrcOffset)))
             {
                 if (!bOneSourceCornerFailsToReproject)
                 {
@@ -6400,6 +6516,367 @@ static CPLErr GWKNearestFloat(GDALWarpKernel *poWK)
     return GWKRun(poWK, "GWKNearestFloat", GWKNearestThread<float>);
 }
 
+/************************************************************************/
+/*                     GWKAverageAffineNoRotation()                     */
+/************************************************************************/
+
+namespace
+{
+// Source footprint of a target column (or line): the source columns (or
+// lines) in [nMin, nMax[ contribute to it, with the weights stored starting
+// at nWeightOffset in the associated weight array.
+struct GWKAverageFootprint
+{
+    int nMin = 0;
+    int nMax = 0;
+    size_t nWeightOffset = 0;
+    double dfSumWeights = 0;
+};
+}  // namespace
+
+// Computes the footprint along one axis of a target pixel whose edges
+// transform to [dfMin, dfMax] in source coordinates, following the same
+// rules as COMPUTE_WEIGHT_Y() and COMPUTE_WEIGHT() in
+// GWKAverageOrModeThread(). Source pixels of null weight are trimmed.
+static GWKAverageFootprint
+GWKAverageComputeFootprint(double dfMin, double dfMax, int nSrcSize,
+                           std::vector<double> &adfWeights)
+{
+    GWKAverageFootprint sFootprint;
+    sFootprint.nWeightOffset = adfWeights.size();
+
+    constexpr double EPS = 1e-10;
+    if (!(dfMax > -EPS && dfMin < nSrcSize + EPS))
+        return sFootprint;
+    const int iMin = static_cast<int>(std::max(floor(dfMin + EPS), 0.0));
+    int iMax = static_cast<int>(
+        std::min(ceil(dfMax - EPS), static_cast<double>(nSrcSize)));
+    if (iMin == iMax && iMax < nSrcSize)
+        iMax++;
+
+    int nMin = iMin;
+    int nMax = iMin;
+    for (int i = iMin; i < iMax; ++i)
+    {
+        const double dfWeight =
+            (i == iMin) ? ((iMin + 1 == iMax) ? 1.0 : 1 - (dfMin - iMin))
+            : (i + 1 == iMax) ? 1 - (iMax - dfMax)
+                              : 1.0;
+        if (dfWeight <= 0)
+        {
+            if (nMin == nMax)
+                nMin = nMax = i + 1;
+            continue;
+        }
+        adfWeights.push_back(dfWeight);
+        sFootprint.dfSumWeights += dfWeight;
+        nMax = i + 1;
+    }
+    // A null weight can only be found at the extremities
+    CPLAssert(static_cast<size_t>(nMax - nMin) ==
+              adfWeights.size() - sFootprint.nWeightOffset);
+    sFootprint.nMin = nMin;
+    sFootprint.nMax = nMax;
+    return sFootprint;
+}
+
+// Returns sum(padfWeights[i] * pSrc[i]) for i in [0, nCount[
+template <class T>
+static double GWKAverageWeightedSum(const T *pSrc, const double *padfWeights,
+                                    int nCount)
+{
+    int i = 0;
+    XMMReg4Double v_acc_1 = XMMReg4Double::Zero();
+    XMMReg4Double v_acc_2 = XMMReg4Double::Zero();
+    for (; i + 7 < nCount; i += 8)
+    {
+        v_acc_1 += XMMReg4Double::Load4Val(pSrc + i) *
+                   XMMReg4Double::Load4Val(padfWeights + i);
+        v_acc_2 += XMMReg4Double::Load4Val(pSrc + i + 4) *
+                   XMMReg4Double::Load4Val(padfWeights + i + 4);
+    }
+    v_acc_1 += v_acc_2;
+    for (; i + 3 < nCount; i += 4)
+    {
+        v_acc_1 += XMMReg4Double::Load4Val(pSrc + i) *
+                   XMMReg4Double::Load4Val(padfWeights + i);
+    }
+    double dfSum = v_acc_1.GetHorizSum();
+    for (; i < nCount; ++i)
+        dfSum += padfWeights[i] * static_cast<double>(pSrc[i]);
+    return dfSum;
+}
+
+template <class T>
+static void GWKAverageAffineNoRotationThread(
+    GWKJobStruct *psJob, const std::vector<GWKAverageFootprint> &asXFootprints,
+    const std::vector<double> &adfXWeights,
+    const std::vector<GWKAverageFootprint> &asYFootprints,
+    const std::vector<double> &adfYWeights)
+{
+    GDALWarpKernel *poWK = psJob->poWK;
+    const int nDstXSize = poWK->nDstXSize;
+    const int nSrcXSize = poWK->nSrcXSize;
+    GUInt32 *const panUnifiedSrcValid = poWK->panUnifiedSrcValid;
+
+    for (int iDstY = psJob->iYMin; iDstY < psJob->iYMax; iDstY++)
+    {
+        const auto &sYFootprint = asYFootprints[iDstY - psJob->iYMin];
+        const double *padfYWeights =
+            adfYWeights.data() + sYFootprint.nWeightOffset;
+
+        for (int iDstX = 0;
+             sYFootprint.nMin < sYFootprint.nMax && iDstX < nDstXSize; iDstX++)
+        {
+            const auto &sXFootprint = asXFootprints[iDstX];
+            if (sXFootprint.nMin == sXFootprint.nMax)
+                continue;
+            const double *padfXWeights =
+                adfXWeights.data() + sXFootprint.nWeightOffset;
+            const int nXCount = sXFootprint.nMax - sXFootprint.nMin;
+
+            const GPtrDiff_t iDstOffset =
+                iDstX + static_cast<GPtrDiff_t>(iDstY) * nDstXSize;
+
+            bool bHasFoundDensity = false;
+            for (int iBand = 0; iBand < poWK->nBands; iBand++)
+            {
+                const T *pSrcBand =
+                    reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]);
+                double dfTotal = 0;
+                double dfTotalWeight = 0;
+                for (int iSrcY = sYFootprint.nMin; iSrcY < sYFootprint.nMax;
+                     iSrcY++)
+                {
+                    const double dfWeightY =
+                        padfYWeights[iSrcY - sYFootprint.nMin];
+                    const GPtrDiff_t iSrcOffset =
+                        sXFootprint.nMin +
+                        static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+                    if (panUnifiedSrcValid == nullptr)
+                    {
+                        dfTotal += dfWeightY * GWKAverageWeightedSum(
+                                                   pSrcBand + iSrcOffset,
+                                                   padfXWeights, nXCount);
+                        dfTotalWeight += dfWeightY * sXFootprint.dfSumWeights;
+                    }
+                    else
+                    {
+                        double dfLineTotal = 0;
+                        double dfLineWeight = 0;
+                        for (int i = 0; i < nXCount; ++i)
+                        {
+                            if (CPLMaskGet(panUnifiedSrcValid, iSrcOffset + i))
+                            {
+                                dfLineTotal +=
+                                    padfXWeights[i] *
+                                    static_cast<double>(
+                                        pSrcBand[iSrcOffset + i]);
+                                dfLineWeight += padfXWeights[i];
+                            }
+                        }
+                        dfTotal += dfWeightY * dfLineTotal;
+                        dfTotalWeight += dfWeightY * dfLineWeight;
+                    }
+                }
+
+                if (dfTotalWeight > 0)
+                {
+                    GWKSetPixelValue(poWK, iBand, iDstOffset,
+                                     /* dfBandDensity = */ 1.0,
+                                     dfTotal / dfTotalWeight, 0.0);
+                    bHasFoundDensity = true;
+                }
+            }
+
+            if (!bHasFoundDensity)
+                continue;
+
+            GWKOverlayDensity(poWK, iDstOffset, 1.0);
+
+            if (poWK->panDstValid != nullptr)
+            {
+                CPLMaskSet(poWK->panDstValid, iDstOffset);
+            }
+        }
+
+        if (psJob->pfnProgress && psJob->pfnProgress(psJob))
+            break;
+    }
+}
+
+// Fast path of GWKAverageOrModeThread() for GRA_Average when the
+// transformation is affine without rotation, and there is no source density,
+// per-band validity mask, vertical shift or excluded value. The horizontal
+// footprint of a target pixel then only depends on its column, and its
+// vertical footprint only on its line, so they are computed once per job
+// instead of for every target pixel.
+// Returns false if the fast path cannot be used.
+static bool GWKAverageAffineNoRotation(GWKJobStruct *psJob)
+{
+    GDALWarpKernel *poWK = psJob->poWK;
+    if (poWK->eResample != GRA_Average || poWK->bApplyVerticalShift ||
+        poWK->pafUnifiedSrcDensity != nullptr ||
+        !poWK->m_aadfExcludedValues.empty() ||
+        !(poWK->eWorkingDataType == GDT_Byte ||
+          poWK->eWorkingDataType == GDT_Int16 ||
+          poWK->eWorkingDataType == GDT_UInt16 ||
+          poWK->eWorkingDataType == GDT_Float32))
+    {
+        return false;
+    }
+    if (poWK->papanBandSrcValid != nullptr)
+    {
+        for (int iBand = 0; iBand < poWK->nBands; iBand++)
+        {
+            if (poWK->papanBandSrcValid[iBand] != nullptr)
+                return false;
+        }
+    }
+    if (CPLAtof(CSLFetchNameValueDef(poWK->papszWarpOptions,
+                                     "SRC_COORD_PRECISION", "0")) > 0 ||
+        CPLAtof(CSLFetchNameValueDef(poWK->papszWarpOptions,
+                                     "NODATA_VALUES_PCT_THRESHOLD", "100")) <
+            100 - 1e-8)
+    {
+        return false;
+    }
+    if (!GDALTransformIsAffineNoRotation(poWK->pfnTransformer,
+                                         poWK->pTransformerArg) ||
+        // for debug/testing purposes
+        !CPLTestBool(
+            CPLGetConfigOption("GDAL_WARP_USE_AFFINE_OPTIMIZATION", "YES")))
+    {
+        return false;
+    }
+
+    const int iYMin = psJob->iYMin;
+    const int iYMax = psJob->iYMax;
+    const int nDstXSize = poWK->nDstXSize;
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int nSrcYSize = poWK->nSrcYSize;
+    const int nXMargin =
+        2 * std::max(1, static_cast<int>(std::ceil(1. / poWK->dfXScale)));
+    const int nYMargin =
+        2 * std::max(1, static_cast<int>(std::ceil(1. / poWK->dfYScale)));
+
+    /* -------------------------------------------------------------------- */
+    /*      Horizontal footprints, from the transformation of the first     */
+    /*      target line.                                                    */
+    /* -------------------------------------------------------------------- */
+    std::vector<GWKAverageFootprint> asXFootprints(nDstXSize);
+    std::vector<double> adfXWeights;
+    {
+        std::vector<double> adfX(nDstXSize);
+        std::vector<double> adfY(nDstXSize, iYMin + poWK->nDstYOff);
+        std::vector<double> adfZ(nDstXSize);
+        std::vector<double> adfX2(nDstXSize);
+        std::vector<double> adfY2(nDstXSize, iYMin + 1.0 + poWK->nDstYOff);
+        std::vector<double> adfZ2(nDstXSize);
+        std::vector<int> abSuccess(nDstXSize);
+        std::vector<int> abSuccess2(nDstXSize);
+        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+        {
+            adfX[iDstX] = iDstX + poWK->nDstXOff;
+            adfX2[iDstX] = iDstX + 1.0 + poWK->nDstXOff;
+        }
+        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize,
+                             adfX.data(), adfY.data(), adfZ.data(),
+                             abSuccess.data());
+        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize,
+                             adfX2.data(), adfY2.data(), adfZ2.data(),
+                             abSuccess2.data());
+
+        const int nThresholdWrapOverX = std::min(2, nSrcXSize / 10);
+        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+        {
+            asXFootprints[iDstX].nWeightOffset = adfXWeights.size();
+            if (!abSuccess[iDstX] || !abSuccess2[iDstX])
+                continue;
+            double dfX = adfX[iDstX];
+            double dfX2 = adfX2[iDstX];
+            if (!(dfX - poWK->nSrcXOff >= -nXMargin &&
+                  dfX2 - poWK->nSrcXOff >= -nXMargin &&
+                  dfX - poWK->nSrcXOff - nSrcXSize <= nXMargin &&
+                  dfX2 - poWK->nSrcXOff - nSrcXSize <= nXMargin))
+            {
+                continue;
+            }
+            if (dfX > dfX2)
+                std::swap(dfX, dfX2);
+            // Wrapping over the antimeridian is left to the general case
+            if (poWK->nSrcXOff == 0 &&
+                dfX * poWK->dfXScale < nThresholdWrapOverX &&
+                (nSrcXSize - dfX2) * poWK->dfXScale < nThresholdWrapOverX)
+            {
+                return false;
+            }
+            asXFootprints[iDstX] = GWKAverageComputeFootprint(
+                dfX - poWK->nSrcXOff, dfX2 - poWK->nSrcXOff, nSrcXSize,
+                adfXWeights);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Vertical footprints of the target lines of this job.            */
+    /* -------------------------------------------------------------------- */
+    std::vector<GWKAverageFootprint> asYFootprints(iYMax - iYMin);
+    std::vector<double> adfYWeights;
+    for (int iDstY = iYMin; iDstY < iYMax; iDstY++)
+    {
+        double adfX[2] = {static_cast<double>(poWK->nDstXOff),
+                          poWK->nDstXOff + 1.0};
+        double adfY[2] = {static_cast<double>(iDstY + poWK->nDstYOff),
+                          iDstY + 1.0 + poWK->nDstYOff};
+        double adfZ[2] = {0, 0};
+        int abSuccess[2] = {FALSE, FALSE};
+        asYFootprints[iDstY - iYMin].nWeightOffset = adfYWeights.size();
+        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, 2, adfX, adfY,
+                             adfZ, abSuccess);
+        if (!abSuccess[0] || !abSuccess[1])
+            continue;
+        double dfY = adfY[0];
+        double dfY2 = adfY[1];
+        if (!(dfY - poWK->nSrcYOff >= -nYMargin &&
+              dfY2 - poWK->nSrcYOff >= -nYMargin &&
+              dfY - poWK->nSrcYOff - nSrcYSize <= nYMargin &&
+              dfY2 - poWK->nSrcYOff - nSrcYSize <= nYMargin))
+        {
+            continue;
+        }
+        if (dfY > dfY2)
+            std::swap(dfY, dfY2);
+        asYFootprints[iDstY - iYMin] = GWKAverageComputeFootprint(
+            dfY - poWK->nSrcYOff, dfY2 - poWK->nSrcYOff, nSrcYSize,
+            adfYWeights);
+    }
+
+    CPLDebug("GDAL", "GDALWarpKernel():GWKAverageOrModeThread() using "
+                     "affine no-rotation average optimization");
+
+    switch (poWK->eWorkingDataType)
+    {
+        case GDT_Byte:
+            GWKAverageAffineNoRotationThread<GByte>(
+                psJob, asXFootprints, adfXWeights, asYFootprints, adfYWeights);
+            break;
+        case GDT_Int16:
+            GWKAverageAffineNoRotationThread<GInt16>(
+                psJob, asXFootprints, adfXWeights, asYFootprints, adfYWeights);
+            break;
+        case GDT_UInt16:
+            GWKAverageAffineNoRotationThread<GUInt16>(
+                psJob, asXFootprints, adfXWeights, asYFootprints, adfYWeights);
+            break;
+        default:
+            CPLAssert(poWK->eWorkingDataType == GDT_Float32);
+            GWKAverageAffineNoRotationThread<float>(
+                psJob, asXFootprints, adfXWeights, asYFootprints, adfYWeights);
+            break;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                           GWKAverageOrMode()                         */
 /*                                                                      */
@@ -6416,6 +6893,9 @@ static CPLErr GWKAverageOrMode(GDALWarpKernel *poWK)
 static void GWKAverageOrModeThread(void *pData)
 {
     GWKJobStruct *psJob = static_cast<GWKJobStruct *>(pData);
+    if (GWKAverageAffineNoRotation(psJob))
+        return;
+
     GDALWarpKernel *poWK = psJob->poWK;
     const int iYMin = psJob->iYMin;
     const int iYMax = psJob->iYMax;
@@ -6437,6 +6917,7 @@ static void GWKAverageOrModeThread(void *pData)
 
     // These vars only used with nAlgo == 3.
     int *panVals = nullptr;
+    std::vector<int> anUsedBins;  // Bins of panVals used by a target pixel
     int nBins = 0;
     int nBinsOffset = 0;
 
@@ -6492,8 +6973,10 @@ static void GWKAverageOrModeThread(void *pData)
             {
                 nBins = 65536;
             }
+            // Zeroed once, and then only the bins used by a target pixel
+            // are reset after it has been processed.
             panVals =
-                static_cast<int *>(VSI_MALLOC_VERBOSE(nBins * sizeof(int)));
+                static_cast<int *>(VSI_CALLOC_VERBOSE(nBins, sizeof(int)));
             if (panVals == nullptr)
                 return;
         }
@@ -6779,7 +7262,8 @@ static void GWKAverageOrModeThread(void *pData)
                             continue;
 
                         if (poWK->panUnifiedSrcValid != nullptr &&
-                            !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset))
+                            !CPLMaskGet(poWK->panUnifiedSrcValid,
+                                static_cast<size_t>(iSrcOffset)))
                         {
                             dfTotalWeightInvalid += dfWeight;
                             continue;
@@ -7209,8 +7693,7 @@ static void GWKAverageOrModeThread(void *pData)
                     {
                         int nMaxVal = 0;
                         int iMaxInd = -1;
-
-                        memset(panVals, 0, nBins * sizeof(int));
+                        anUsedBins.clear();
 
                         for (int iSrcY = iSrcYMin; iSrcY < iSrcYMax; iSrcY++)
                         {
@@ -7238,17 +7721,25 @@ static void GWKAverageOrModeThread(void *pData)
                                 {
                                     const int nVal =
                                         static_cast<int>(dfValueRealTmp);
-                                    if (++panVals[nVal + nBinsOffset] > nMaxVal)
+                                    const int nBin = nVal + nBinsOffset;
+                                    if (panVals[nBin] == 0)
+                                        anUsedBins.push_back(nBin);
+                                    if (++panVals[nBin] > nMaxVal)
                                     {
                                         // Sum the density.
                                         // Is it the most common value so far?
                                         iMaxInd = nVal;
-                                        nMaxVal = panVals[nVal + nBinsOffset];
+                                        nMaxVal = panVals[nBin];
                                     }
                                 }
                             }
                         }
 
+                        // Much cheaper than clearing the whole array for
+                        // UInt16 or Int16 data.
+                        for (const int nBin : anUsedBins)
+                            panVals[nBin] = 0;
+
                         if (iMaxInd != -1)
                         {
                             dfValueReal = iMaxInd;
@@ -7978,7 +8469,8 @@ static void GWKSumPreservingThread(void *pData)
                 const auto iSrcOffset =
                     iX + static_cast<GPtrDiff_t>(iY) * nSrcXSize;
                 if (poWK->panUnifiedSrcValid != nullptr &&
-                    !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset))
+                    !CPLMaskGet(poWK->panUnifiedSrcValid,
+                                static_cast<size_t>(iSrcOffset)))
                 {
                     continue;
                 }
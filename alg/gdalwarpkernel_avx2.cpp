@@ -0,0 +1,296 @@
+/******************************************************************************
+ *
+ * Project:  High Performance Image Reprojector
+ * Purpose:  AVX2 specializations of the warp kernels with no masks
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "gdalwarpkernel_avx2.h"
+
+#ifdef HAVE_GWK_AVX2
+
+#include <algorithm>
+#include <cstring>
+
+#include <immintrin.h>
+
+/************************************************************************/
+/*                            GatherFloat()                             */
+/************************************************************************/
+
+// Fetch pafSrc[anOffset[i] + nShift] for the lanes set in the mask,
+// converted to double.
+static inline __m256d GatherFloat(const float *pafSrc, __m256i anOffset,
+                                  GPtrDiff_t nShift, __m128 mask)
+{
+    return _mm256_cvtps_pd(_mm256_mask_i64gather_ps(
+        _mm_setzero_ps(), pafSrc,
+        _mm256_add_epi64(anOffset, _mm256_set1_epi64x(nShift)), mask, 4));
+}
+
+/************************************************************************/
+/*                          Resample4Pixels()                           */
+/************************************************************************/
+
+// The arithmetic below must follow the exact order of operations of
+// GWKBilinearResampleNoMasks4SampleT() and GWKCubicResampleNoMasks4SampleT(),
+// to get bit-identical results. In particular no FMA must be used.
+template <bool bCubic>
+static inline void
+Resample4Pixels(const float *pafSrc, int nSrcXSize, int nSrcYSize,
+                const double *padfX, const double *padfY, __m256d vSrcXOff,
+                __m256d vSrcYOff, GByte *pabyTodo, float *pafDst)
+{
+    int nTodo;
+    memcpy(&nTodo, pabyTodo, sizeof(nTodo));
+    if (nTodo == 0)
+        return;
+
+    const __m256i vTodo = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(nTodo));
+    const __m256d vTodoMask = _mm256_castsi256_pd(
+        _mm256_cmpgt_epi64(vTodo, _mm256_setzero_si256()));
+
+    const __m256d vHalf = _mm256_set1_pd(0.5);
+    const __m256d vSrcX = _mm256_sub_pd(_mm256_loadu_pd(padfX), vSrcXOff);
+    const __m256d vSrcY = _mm256_sub_pd(_mm256_loadu_pd(padfY), vSrcYOff);
+    constexpr int ROUNDING =
+        (bCubic ? _MM_FROUND_TO_ZERO : _MM_FROUND_TO_NEG_INF) |
+        _MM_FROUND_NO_EXC;
+    const __m256d vSrcXMinusHalf = _mm256_sub_pd(vSrcX, vHalf);
+    const __m256d vSrcYMinusHalf = _mm256_sub_pd(vSrcY, vHalf);
+    const __m256d vIX = _mm256_round_pd(vSrcXMinusHalf, ROUNDING);
+    const __m256d vIY = _mm256_round_pd(vSrcYMinusHalf, ROUNDING);
+
+    // Only process pixels whose samples are all within the source buffer.
+    // NaN coordinates fail those (ordered) comparisons.
+    constexpr int nMarginBefore = bCubic ? 1 : 0;
+    constexpr int nMarginAfter = bCubic ? 2 : 1;
+    __m256d vMask = _mm256_and_pd(
+        vTodoMask,
+        _mm256_cmp_pd(vIX, _mm256_set1_pd(nMarginBefore), _CMP_GE_OQ));
+    vMask = _mm256_and_pd(
+        vMask, _mm256_cmp_pd(vIX, _mm256_set1_pd(nSrcXSize - 1 - nMarginAfter),
+                             _CMP_LE_OQ));
+    vMask = _mm256_and_pd(
+        vMask, _mm256_cmp_pd(vIY, _mm256_set1_pd(nMarginBefore), _CMP_GE_OQ));
+    vMask = _mm256_and_pd(
+        vMask, _mm256_cmp_pd(vIY, _mm256_set1_pd(nSrcYSize - 1 - nMarginAfter),
+                             _CMP_LE_OQ));
+    const int nMask = _mm256_movemask_pd(vMask);
+    if (nMask == 0)
+        return;
+
+    // Convert the 64-bit lane mask to a 32-bit lane mask, for the gathers.
+    const __m256i vPermute = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    const __m128 vMask32 = _mm_castsi128_ps(_mm256_castsi256_si128(
+        _mm256_permutevar8x32_epi32(_mm256_castpd_si256(vMask), vPermute)));
+
+    // Lanes not in the mask may hold garbage, but they are not dereferenced.
+    const __m256i vOffset = _mm256_add_epi64(
+        _mm256_cvtepi32_epi64(_mm256_cvttpd_epi32(vIX)),
+        _mm256_mul_epi32(_mm256_cvtepi32_epi64(_mm256_cvttpd_epi32(vIY)),
+                         _mm256_set1_epi64x(nSrcXSize)));
+
+    const GPtrDiff_t nLineStride = nSrcXSize;
+    __m256d vValue;
+    if constexpr (bCubic)
+    {
+        const __m256d vOne = _mm256_set1_pd(1.0);
+        const __m256d vTwo = _mm256_set1_pd(2.0);
+        const __m256d vThree = _mm256_set1_pd(3.0);
+        const __m256d vFour = _mm256_set1_pd(4.0);
+        const __m256d vFive = _mm256_set1_pd(5.0);
+
+        // GWKCubicComputeWeights()
+        const __m256d vDeltaX = _mm256_sub_pd(vSrcXMinusHalf, vIX);
+        const __m256d vHalfX = _mm256_mul_pd(vHalf, vDeltaX);
+        const __m256d vThreeX = _mm256_mul_pd(vThree, vDeltaX);
+        const __m256d vHalfX2 = _mm256_mul_pd(vHalfX, vDeltaX);
+        const __m256d vCoeff0 = _mm256_mul_pd(
+            vHalfX, _mm256_add_pd(_mm256_set1_pd(-1.0),
+                                  _mm256_mul_pd(vDeltaX,
+                                                _mm256_sub_pd(vTwo, vDeltaX))));
+        const __m256d vCoeff1 = _mm256_add_pd(
+            vOne, _mm256_mul_pd(vHalfX2, _mm256_add_pd(_mm256_set1_pd(-5.0),
+                                                       vThreeX)));
+        const __m256d vCoeff2 = _mm256_mul_pd(
+            vHalfX,
+            _mm256_add_pd(vOne, _mm256_mul_pd(vDeltaX,
+                                              _mm256_sub_pd(vFour, vThreeX))));
+        const __m256d vCoeff3 = _mm256_mul_pd(
+            vHalfX2, _mm256_add_pd(_mm256_set1_pd(-1.0), vDeltaX));
+
+        // CONVOL4() on the 4 rows.
+        __m256d avRow[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            const GPtrDiff_t nShift = (i - 1) * nLineStride - 1;
+            __m256d vSum = _mm256_mul_pd(
+                vCoeff0, GatherFloat(pafSrc, vOffset, nShift, vMask32));
+            vSum = _mm256_add_pd(
+                vSum, _mm256_mul_pd(vCoeff1, GatherFloat(pafSrc, vOffset,
+                                                         nShift + 1, vMask32)));
+            vSum = _mm256_add_pd(
+                vSum, _mm256_mul_pd(vCoeff2, GatherFloat(pafSrc, vOffset,
+                                                         nShift + 2, vMask32)));
+            vSum = _mm256_add_pd(
+                vSum, _mm256_mul_pd(vCoeff3, GatherFloat(pafSrc, vOffset,
+                                                         nShift + 3, vMask32)));
+            avRow[i] = vSum;
+        }
+
+        // CubicConvolution()
+        const __m256d vDist1 = _mm256_sub_pd(vSrcYMinusHalf, vIY);
+        const __m256d vDist2 = _mm256_mul_pd(vDist1, vDist1);
+        const __m256d vDist3 = _mm256_mul_pd(vDist2, vDist1);
+        const __m256d f0 = avRow[0];
+        const __m256d f1 = avRow[1];
+        const __m256d f2 = avRow[2];
+        const __m256d f3 = avRow[3];
+        const __m256d vTerm1 = _mm256_mul_pd(vDist1, _mm256_sub_pd(f2, f0));
+        const __m256d vTerm2 = _mm256_mul_pd(
+            vDist2,
+            _mm256_sub_pd(
+                _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(vTwo, f0),
+                                            _mm256_mul_pd(vFive, f1)),
+                              _mm256_mul_pd(vFour, f2)),
+                f3));
+        const __m256d vTerm3 = _mm256_mul_pd(
+            vDist3,
+            _mm256_sub_pd(
+                _mm256_add_pd(_mm256_mul_pd(vThree, _mm256_sub_pd(f1, f2)), f3),
+                f0));
+        const __m256d vSumTerms =
+            _mm256_add_pd(_mm256_add_pd(vTerm1, vTerm2), vTerm3);
+        vValue = _mm256_add_pd(f1, _mm256_mul_pd(vHalf, vSumTerms));
+    }
+    else
+    {
+        const __m256d vOne = _mm256_set1_pd(1.0);
+        const __m256d vOnePointFive = _mm256_set1_pd(1.5);
+        const __m256d vRatioX =
+            _mm256_sub_pd(vOnePointFive, _mm256_sub_pd(vSrcX, vIX));
+        const __m256d vRatioY =
+            _mm256_sub_pd(vOnePointFive, _mm256_sub_pd(vSrcY, vIY));
+        const __m256d vOneMinusRatioX = _mm256_sub_pd(vOne, vRatioX);
+        const __m256d vOneMinusRatioY = _mm256_sub_pd(vOne, vRatioY);
+
+        const __m256d vUpper = _mm256_add_pd(
+            _mm256_mul_pd(GatherFloat(pafSrc, vOffset, 0, vMask32), vRatioX),
+            _mm256_mul_pd(GatherFloat(pafSrc, vOffset, 1, vMask32),
+                          vOneMinusRatioX));
+        const __m256d vLower = _mm256_add_pd(
+            _mm256_mul_pd(GatherFloat(pafSrc, vOffset, nLineStride, vMask32),
+                          vRatioX),
+            _mm256_mul_pd(
+                GatherFloat(pafSrc, vOffset, nLineStride + 1, vMask32),
+                vOneMinusRatioX));
+        vValue = _mm256_add_pd(_mm256_mul_pd(vUpper, vRatioY),
+                               _mm256_mul_pd(vLower, vOneMinusRatioY));
+    }
+
+    float afValue[4];
+    _mm_storeu_ps(afValue, _mm256_cvtpd_ps(vValue));
+    for (int i = 0; i < 4; ++i)
+    {
+        if (nMask & (1 << i))
+        {
+            pafDst[i] = afValue[i];
+            pabyTodo[i] = 0;
+        }
+    }
+}
+
+/************************************************************************/
+/*                      GWKResampleNoMasks4SampleFloat()                */
+/************************************************************************/
+
+template <bool bCubic>
+static void GWKResampleNoMasks4SampleFloat(const float *pafSrc, int nSrcXSize,
+                                           int nSrcYSize, const double *padfX,
+                                           const double *padfY,
+                                           double dfSrcXOff, double dfSrcYOff,
+                                           int nCount, GByte *pabyTodo,
+                                           float *pafDst)
+{
+    const __m256d vSrcXOff = _mm256_set1_pd(dfSrcXOff);
+    const __m256d vSrcYOff = _mm256_set1_pd(dfSrcYOff);
+    int i = 0;
+    // Process 8 destination pixels per iteration.
+    for (; i + 7 < nCount; i += 8)
+    {
+        Resample4Pixels<bCubic>(pafSrc, nSrcXSize, nSrcYSize, padfX + i,
+                                padfY + i, vSrcXOff, vSrcYOff, pabyTodo + i,
+                                pafDst + i);
+        Resample4Pixels<bCubic>(pafSrc, nSrcXSize, nSrcYSize, padfX + i + 4,
+                                padfY + i + 4, vSrcXOff, vSrcYOff,
+                                pabyTodo + i + 4, pafDst + i + 4);
+    }
+    for (; i < nCount; i += 4)
+    {
+        // Remainder: work on padded copies.
+        const int nRemaining = std::min(4, nCount - i);
+        double adfX[4] = {0, 0, 0, 0};
+        double adfY[4] = {0, 0, 0, 0};
+        GByte abyTodo[4] = {0, 0, 0, 0};
+        float afDst[4] = {0, 0, 0, 0};
+        memcpy(adfX, padfX + i, nRemaining * sizeof(double));
+        memcpy(adfY, padfY + i, nRemaining * sizeof(double));
+        memcpy(abyTodo, pabyTodo + i, nRemaining);
+        Resample4Pixels<bCubic>(pafSrc, nSrcXSize, nSrcYSize, adfX, adfY,
+                                vSrcXOff, vSrcYOff, abyTodo, afDst);
+        for (int j = 0; j < nRemaining; ++j)
+        {
+            if (pabyTodo[i + j] && !abyTodo[j])
+            {
+                pafDst[i + j] = afDst[j];
+                pabyTodo[i + j] = 0;
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                  GWKResampleNoMasks4SampleFloat_AVX2()               */
+/************************************************************************/
+
+void GWKResampleNoMasks4SampleFloat_AVX2(bool bCubic, const float *pafSrc,
+                                         int nSrcXSize, int nSrcYSize,
+                                         const double *padfX,
+                                         const double *padfY, double dfSrcXOff,
+                                         double dfSrcYOff, int nCount,
+                                         GByte *pabyTodo, float *pafDst)
+{
+    if (bCubic)
+        GWKResampleNoMasks4SampleFloat<true>(pafSrc, nSrcXSize, nSrcYSize,
+                                             padfX, padfY, dfSrcXOff,
+                                             dfSrcYOff, nCount, pabyTodo,
+                                             pafDst);
+    else
+        GWKResampleNoMasks4SampleFloat<false>(pafSrc, nSrcXSize, nSrcYSize,
+                                              padfX, padfY, dfSrcXOff,
+                                              dfSrcYOff, nCount, pabyTodo,
+                                              pafDst);
+}
+
+#endif /* HAVE_GWK_AVX2 */
@@ -0,0 +1,58 @@
+/******************************************************************************
+ *
+ * Project:  High Performance Image Reprojector
+ * Purpose:  AVX2 specializations of the warp kernels with no masks
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef GDALWARPKERNEL_AVX2_H_INCLUDED
+#define GDALWARPKERNEL_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+#define HAVE_GWK_AVX2
+
+/** Compute the bilinear or cubic 4-sample interpolation of a Float32 source
+ * buffer, without masks, for nCount destination pixels, 8 at a time.
+ *
+ * padfX[i] - dfSrcXOff and padfY[i] - dfSrcYOff are the source coordinates
+ * of the i-th pixel, which is only processed if pabyTodo[i] is not zero.
+ * On return, pabyTodo[i] is reset to 0 for the pixels whose value has been
+ * stored in pafDst[i]. The remaining ones are too close to the edge of the
+ * source buffer and must be computed by the caller. Results are identical
+ * to the ones of GWKBilinearResampleNoMasks4SampleT() and
+ * GWKCubicResampleNoMasks4SampleT().
+ */
+void GWKResampleNoMasks4SampleFloat_AVX2(bool bCubic, const float *pafSrc,
+                                         int nSrcXSize, int nSrcYSize,
+                                         const double *padfX,
+                                         const double *padfY, double dfSrcXOff,
+                                         double dfSrcYOff, int nCount,
+                                         GByte *pabyTodo, float *pafDst);
+
+#endif
+
+#endif /* GDALWARPKERNEL_AVX2_H_INCLUDED */
@@ -37,6 +37,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -48,7 +49,9 @@
 #include "cpl_mask.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_alg_priv.h"
@@ -62,18 +65,74 @@ struct _GDALWarpChunk
     double sExtraSx, sExtraSy;
 };
 
+struct GDALWarpTransformedPoint
+{
+    double dfX = 0;
+    double dfY = 0;
+    double dfZ = 0;
+    bool bSuccess = false;
+};
+
 struct GDALWarpPrivateData
 {
     int nStepCount = 0;
     std::vector<int> abSuccess{};
     std::vector<double> adfDstX{};
     std::vector<double> adfDstY{};
+
+    // Destination pixel coordinates already transformed to source pixel
+    // coordinates by ComputeSourceWindow(). Neighbouring chunks, and the
+    // sub-windows tried by CollectChunkList(), share corners and edges.
+    std::mutex oTransformCacheMutex{};
+    std::map<std::pair<double, double>, GDALWarpTransformedPoint>
+        oMapTransformCache{};
+
+    // Cutline split into pieces, shared by all chunks
+    std::unique_ptr<GDALWarpPreparedCutline, GDALWarpPreparedCutlineDeleter>
+        poPreparedCutline{};
 };
 
 static std::mutex gMutex{};
 static std::map<GDALWarpOperation *, std::unique_ptr<GDALWarpPrivateData>>
     gMapPrivate{};
 
+struct GDALWarpChunkWorkersData;
+
+// State of a worker of ChunkAndWarpMulti() when several chunks are warped
+// concurrently.
+struct GDALWarpChunkWorker
+{
+    GDALWarpChunkWorkersData *psShared = nullptr;
+    void *pTransformerArg = nullptr;
+    void *psThreadData = nullptr;
+    double dfChunkPixels = 0;
+    double dfChunkPixelsDone = 0;
+};
+
+struct GDALWarpChunkWorkersData
+{
+    GDALWarpOperation *poOperation = nullptr;
+    GDALWarpChunk *pasChunkList = nullptr;
+    int nChunkListCount = 0;
+    CPLMutex *hIOMutex = nullptr;
+    std::atomic<int> nNextChunk{0};
+
+    std::mutex oMutex{};
+    std::vector<GDALWarpChunkWorker> asWorkers{};
+    GDALProgressFunc pfnProgress = nullptr;
+    void *pProgressArg = nullptr;
+    double dfTotalPixels = 0;
+    double dfPixelsDone = 0;
+    double dfLastReported = 0;
+    bool bStop = false;
+    CPLErr eErr = CE_None;
+};
+
+// Set while a worker of ChunkAndWarpMulti() processes a chunk, so that
+// WarpRegionToBuffer() uses the transformer and kernel threads of that
+// worker, and does not serialize the warp kernels.
+static thread_local GDALWarpChunkWorker *tlpsChunkWorker = nullptr;
+
 static GDALWarpPrivateData *
 GetWarpPrivateData(GDALWarpOperation *poWarpOperation)
 {
@@ -651,6 +710,14 @@ CPLErr GDALWarpOperation::Initialize(const GDALWarpOptions *psNewOptions)
             }
         }
 
+        if (psOptions->hCutline != nullptr)
+        {
+            GetWarpPrivateData(this)->poPreparedCutline =
+                GDALWarpCreatePreparedCutline(
+                    static_cast<OGRGeometryH>(psOptions->hCutline),
+                    psOptions->dfCutlineBlendDist, psOptions->papszWarpOptions);
+        }
+
         m_bIsTranslationOnPixelBoundaries =
             GDALTransformIsTranslationOnPixelBoundaries(
                 psOptions->pfnTransformer, psOptions->pTransformerArg) &&
@@ -1067,6 +1134,99 @@ static void ChunkThreadMain(void *pThreadData)
     }
 }
 
+/************************************************************************/
+/*                    GDALWarpChunkWorkerProgress()                     */
+/************************************************************************/
+
+// Progress callback of the warp kernels of the workers of
+// ChunkAndWarpMulti(), that aggregates the progress of all chunks.
+static int CPL_STDCALL GDALWarpChunkWorkerProgress(double dfComplete,
+                                                   const char *, void *pData)
+{
+    GDALWarpChunkWorker *psWorker = static_cast<GDALWarpChunkWorker *>(pData);
+    GDALWarpChunkWorkersData *psShared = psWorker->psShared;
+    std::lock_guard<std::mutex> oLock(psShared->oMutex);
+    if (psShared->bStop)
+        return FALSE;
+    psWorker->dfChunkPixelsDone = dfComplete * psWorker->dfChunkPixels;
+    double dfPixelsDone = psShared->dfPixelsDone;
+    for (const auto &sWorker : psShared->asWorkers)
+        dfPixelsDone += sWorker.dfChunkPixelsDone;
+    const double dfRatio =
+        std::min(1.0, dfPixelsDone / psShared->dfTotalPixels);
+    if (dfRatio > psShared->dfLastReported)
+    {
+        psShared->dfLastReported = dfRatio;
+        if (!psShared->pfnProgress(dfRatio, "", psShared->pProgressArg))
+        {
+            psShared->bStop = true;
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+/************************************************************************/
+/*                       GDALWarpChunkWorkerMain()                      */
+/************************************************************************/
+
+// Job of a worker of ChunkAndWarpMulti(): warp chunks until there are no
+// more of them.
+static void GDALWarpChunkWorkerMain(void *pData)
+{
+    GDALWarpChunkWorker *psWorker = static_cast<GDALWarpChunkWorker *>(pData);
+    GDALWarpChunkWorkersData *psShared = psWorker->psShared;
+    tlpsChunkWorker = psWorker;
+    while (true)
+    {
+        const int iChunk = psShared->nNextChunk++;
+        if (iChunk >= psShared->nChunkListCount)
+            break;
+        const GDALWarpChunk *pasThisChunk = psShared->pasChunkList + iChunk;
+        {
+            std::lock_guard<std::mutex> oLock(psShared->oMutex);
+            if (psShared->bStop)
+                break;
+            psWorker->dfChunkPixels =
+                pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
+            psWorker->dfChunkPixelsDone = 0;
+        }
+
+        CPLErr eErr = CE_None;
+        if (!CPLAcquireMutex(psShared->hIOMutex, 600.0))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failed to acquire IOMutex in WarpRegion().");
+            eErr = CE_Failure;
+        }
+        else
+        {
+            CPLDebug("GDAL", "Start chunk %d / %d.", iChunk,
+                     psShared->nChunkListCount);
+            eErr = psShared->poOperation->WarpRegion(
+                pasThisChunk->dx, pasThisChunk->dy, pasThisChunk->dsx,
+                pasThisChunk->dsy, pasThisChunk->sx, pasThisChunk->sy,
+                pasThisChunk->ssx, pasThisChunk->ssy, pasThisChunk->sExtraSx,
+                pasThisChunk->sExtraSy, 0.0, 1.0);
+            CPLReleaseMutex(psShared->hIOMutex);
+            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk,
+                     psShared->nChunkListCount);
+        }
+
+        std::lock_guard<std::mutex> oLock(psShared->oMutex);
+        psShared->dfPixelsDone += psWorker->dfChunkPixels;
+        psWorker->dfChunkPixels = 0;
+        psWorker->dfChunkPixelsDone = 0;
+        if (eErr != CE_None)
+        {
+            psShared->eErr = eErr;
+            psShared->bStop = true;
+            break;
+        }
+    }
+    tlpsChunkWorker = nullptr;
+}
+
 /************************************************************************/
 /*                         ChunkAndWarpMulti()                          */
 /************************************************************************/
@@ -1083,6 +1243,11 @@ static void ChunkThreadMain(void *pThreadData)
  * internally this method uses multiple threads to interleave input/output
  * for one region while the processing is being done for another.
  *
+ * If the NUM_CHUNK_THREADS warp option is set to a value greater than 1,
+ * that number of chunks are processed concurrently: reading and writing are
+ * still serialized, but the warp kernels of several chunks may run at the
+ * same time. Chunks are then written in the order they are completed.
+ *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
  * @param nDstXSize Width of output window on destination file to be produced.
@@ -1110,6 +1275,124 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
     /* -------------------------------------------------------------------- */
     CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
 
+    /* -------------------------------------------------------------------- */
+    /*      Process several chunks concurrently if asked to.                */
+    /* -------------------------------------------------------------------- */
+    const char *pszChunkThreads =
+        CSLFetchNameValue(psOptions->papszWarpOptions, "NUM_CHUNK_THREADS");
+    int nChunkThreads = 1;
+    if (pszChunkThreads)
+    {
+        nChunkThreads = EQUAL(pszChunkThreads, "ALL_CPUS")
+                            ? CPLGetNumCPUs()
+                            : atoi(pszChunkThreads);
+        nChunkThreads = std::min(std::max(1, nChunkThreads), 128);
+    }
+    if (nChunkThreads > 1 &&
+        CPLFetchBool(psOptions->papszWarpOptions, "STREAMABLE_OUTPUT", false))
+    {
+        // Streamed output requires writing chunks in order.
+        CPLDebug("WARP", "NUM_CHUNK_THREADS ignored due to STREAMABLE_OUTPUT");
+        nChunkThreads = 1;
+    }
+    if (nChunkThreads > 1 && (psOptions->pfnPreWarpChunkProcessor ||
+                              psOptions->pfnPostWarpChunkProcessor))
+    {
+        // Those callbacks are not expected to be called concurrently.
+        nChunkThreads = 1;
+    }
+    if (nChunkThreads > 1 && psOptions->dfWarpMemoryLimit > 0)
+    {
+        // Each chunk being processed may use up to the warp memory limit.
+        const double dfMaxChunksInMemory =
+            static_cast<double>(GDALGetCacheMax64()) /
+            psOptions->dfWarpMemoryLimit;
+        if (dfMaxChunksInMemory < nChunkThreads)
+        {
+            nChunkThreads = std::max(2, static_cast<int>(dfMaxChunksInMemory));
+            CPLDebug("WARP", "NUM_CHUNK_THREADS limited to %d by GDAL_CACHEMAX",
+                     nChunkThreads);
+        }
+    }
+    nChunkThreads = std::min(nChunkThreads, nChunkListCount);
+
+    if (nChunkThreads > 1)
+    {
+        GDALWarpChunkWorkersData sShared;
+        sShared.poOperation = this;
+        sShared.pasChunkList = pasChunkList;
+        sShared.nChunkListCount = nChunkListCount;
+        sShared.hIOMutex = hIOMutex;
+        sShared.pfnProgress = psOptions->pfnProgress;
+        sShared.pProgressArg = psOptions->pProgressArg;
+        sShared.dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
+        sShared.asWorkers.resize(nChunkThreads);
+
+        // Each worker needs its own transformer, since several warp kernels
+        // may run at the same time.
+        bool bOK = true;
+        for (auto &sWorker : sShared.asWorkers)
+        {
+            sWorker.psShared = &sShared;
+            sWorker.pTransformerArg =
+                GDALCloneTransformer(psOptions->pTransformerArg);
+            if (sWorker.pTransformerArg == nullptr)
+            {
+                bOK = false;
+                break;
+            }
+            sWorker.psThreadData = GWKThreadsCreate(psOptions->papszWarpOptions,
+                                                    psOptions->pfnTransformer,
+                                                    sWorker.pTransformerArg);
+            if (sWorker.psThreadData == nullptr)
+            {
+                bOK = false;
+                break;
+            }
+        }
+
+        CPLWorkerThreadPool oPool;
+        if (bOK)
+            bOK = oPool.Setup(nChunkThreads, nullptr, nullptr);
+        if (bOK)
+        {
+            for (auto &sWorker : sShared.asWorkers)
+            {
+                if (!oPool.SubmitJob(GDALWarpChunkWorkerMain, &sWorker))
+                {
+                    std::lock_guard<std::mutex> oLock(sShared.oMutex);
+                    sShared.eErr = CE_Failure;
+                    sShared.bStop = true;
+                    break;
+                }
+            }
+            oPool.WaitCompletion();
+        }
+
+        for (auto &sWorker : sShared.asWorkers)
+        {
+            GWKThreadsEnd(sWorker.psThreadData);
+            if (sWorker.pTransformerArg)
+                GDALDestroyTransformer(sWorker.pTransformerArg);
+        }
+
+        if (bOK)
+        {
+            CPLDestroyCond(hCond);
+            CPLDestroyMutex(hCondMutex);
+
+            WipeChunkList();
+
+            if (sShared.eErr == CE_None)
+                psOptions->pfnProgress(1.0, "", psOptions->pProgressArg);
+
+            return sShared.eErr;
+        }
+
+        CPLDebug("WARP",
+                 "Cannot set up NUM_CHUNK_THREADS workers. Using 2 threads");
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Process them one at a time, updating the progress               */
     /*      information for each region.                                    */
@@ -1324,6 +1607,84 @@ double GDALWarpOperation::GetWorkingMemoryForWindow(int nSrcXSize,
     return dfTotalMemoryUse;
 }
 
+/************************************************************************/
+/*                    GDALWarpIsSourceWindowEmpty()                     */
+/************************************************************************/
+
+// Returns true if GDALGetDataCoverageStatus() reports that the source window
+// has no data (sparse GTiff files, VRT mosaics, ...), and that the pixel
+// values returned for such areas are invalid for the warper, in which case
+// reading and warping the window is equivalent to having no source at all.
+static bool GDALWarpIsSourceWindowEmpty(const GDALWarpOptions *psOptions,
+                                        int nSrcXOff, int nSrcYOff,
+                                        int nSrcXSize, int nSrcYSize)
+{
+    if (psOptions->hSrcDS == nullptr || nSrcXSize <= 0 || nSrcYSize <= 0 ||
+        !CPLFetchBool(psOptions->papszWarpOptions, "SKIP_EMPTY_SOURCE_WINDOW",
+                      true))
+    {
+        return false;
+    }
+
+    const auto IsEmpty = [nSrcXOff, nSrcYOff, nSrcXSize,
+                          nSrcYSize](GDALRasterBandH hBand)
+    {
+        return GDALGetDataCoverageStatus(
+                   hBand, nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize,
+                   GDAL_DATA_COVERAGE_STATUS_DATA,
+                   nullptr) == GDAL_DATA_COVERAGE_STATUS_EMPTY;
+    };
+
+    // Value read in empty areas: the nodata value if set, or 0.
+    const auto GetEmptyValue = [](GDALRasterBandH hBand)
+    {
+        int bHasNoData = FALSE;
+        const double dfNoData = GDALGetRasterNoDataValue(hBand, &bHasNoData);
+        return bHasNoData ? dfNoData : 0.0;
+    };
+
+    // When there is a source alpha band, empty areas are fully transparent
+    // if the alpha band is empty and reads as 0.
+    if (psOptions->nSrcAlphaBand > 0)
+    {
+        GDALRasterBandH hAlphaBand =
+            GDALGetRasterBand(psOptions->hSrcDS, psOptions->nSrcAlphaBand);
+        return hAlphaBand != nullptr && GetEmptyValue(hAlphaBand) == 0 &&
+               IsEmpty(hAlphaBand);
+    }
+
+    // Otherwise all bands must be empty and read as their source nodata
+    // value.
+    if (psOptions->padfSrcNoDataReal == nullptr)
+        return false;
+    for (int i = 0; i < psOptions->nBandCount; i++)
+    {
+        if (psOptions->padfSrcNoDataImag != nullptr &&
+            psOptions->padfSrcNoDataImag[i] != 0)
+        {
+            return false;
+        }
+        GDALRasterBandH hBand =
+            GDALGetRasterBand(psOptions->hSrcDS, psOptions->panSrcBands[i]);
+        if (hBand == nullptr)
+            return false;
+        const double dfEmptyValue = GetEmptyValue(hBand);
+        const double dfSrcNoData = psOptions->padfSrcNoDataReal[i];
+        if (!(dfEmptyValue == dfSrcNoData ||
+              (std::isnan(dfEmptyValue) && std::isnan(dfSrcNoData))))
+        {
+            return false;
+        }
+    }
+    for (int i = 0; i < psOptions->nBandCount; i++)
+    {
+        if (!IsEmpty(
+                GDALGetRasterBand(psOptions->hSrcDS, psOptions->panSrcBands[i])))
+            return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                       CollectChunkListInternal()                     */
 /************************************************************************/
@@ -1361,8 +1722,10 @@ CPLErr GDALWarpOperation::CollectChunkListInternal(int nDstXOff, int nDstYOff,
     /*      If we are allowed to drop no-source regions, do so now if       */
     /*      appropriate.                                                    */
     /* -------------------------------------------------------------------- */
-    if ((nSrcXSize == 0 || nSrcYSize == 0) &&
-        CPLFetchBool(psOptions->papszWarpOptions, "SKIP_NOSOURCE", false))
+    if (CPLFetchBool(psOptions->papszWarpOptions, "SKIP_NOSOURCE", false) &&
+        (nSrcXSize == 0 || nSrcYSize == 0 ||
+         GDALWarpIsSourceWindowEmpty(psOptions, nSrcXOff, nSrcYOff, nSrcXSize,
+                                     nSrcYSize)))
         return CE_None;
 
     /* -------------------------------------------------------------------- */
@@ -1794,6 +2157,15 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale)
 
 {
+    CPLTraceSpan oTraceSpan("warp", "WarpRegionToBuffer");
+    if (oTraceSpan.IsEnabled())
+    {
+        oTraceSpan.AddArg("dst_xoff", nDstXOff);
+        oTraceSpan.AddArg("dst_yoff", nDstYOff);
+        oTraceSpan.AddArg("dst_xsize", nDstXSize);
+        oTraceSpan.AddArg("dst_ysize", nDstYSize);
+    }
+
     const int nWordSize = GDALGetDataTypeSizeBytes(psOptions->eWorkingDataType);
 
     CPLAssert(eBufDataType == psOptions->eWorkingDataType);
@@ -1829,6 +2201,23 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      If the source window has no data, skip reading and warping it. */
+    /* -------------------------------------------------------------------- */
+    if (GDALWarpIsSourceWindowEmpty(psOptions, nSrcXOff, nSrcYOff, nSrcXSize,
+                                    nSrcYSize))
+    {
+        CPLDebug("WARP",
+                 "Source window %d,%d,%dx%d has no data. Skipping reading it",
+                 nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize);
+        nSrcXOff = 0;
+        nSrcYOff = 0;
+        nSrcXSize = 0;
+        nSrcYSize = 0;
+        dfSrcXExtraSize = 0;
+        dfSrcYExtraSize = 0;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Prepare a WarpKernel object to match this operation.            */
     /* -------------------------------------------------------------------- */
@@ -1850,6 +2239,15 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     oWK.papszWarpOptions = psOptions->papszWarpOptions;
     oWK.psThreadData = psThreadData;
 
+    GDALWarpChunkWorker *const psChunkWorker = tlpsChunkWorker;
+    if (psChunkWorker)
+    {
+        oWK.pTransformerArg = psChunkWorker->pTransformerArg;
+        oWK.pfnProgress = GDALWarpChunkWorkerProgress;
+        oWK.pProgress = psChunkWorker;
+        oWK.psThreadData = psChunkWorker->psThreadData;
+    }
+
     oWK.padfDstNoDataReal = psOptions->padfDstNoDataReal;
 
     /* -------------------------------------------------------------------- */
@@ -2003,7 +2401,14 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
         }
 
         int nValidityFlag = 0;
-        if (eErr == CE_None)
+        auto poPreparedCutline =
+            GetWarpPrivateData(this)->poPreparedCutline.get();
+        if (eErr == CE_None && poPreparedCutline)
+            eErr = GDALWarpCutlineMaskerPrepared(
+                poPreparedCutline, psOptions, oWK.nSrcXOff, oWK.nSrcYOff,
+                oWK.nSrcXSize, oWK.nSrcYSize, oWK.pafUnifiedSrcDensity,
+                &nValidityFlag);
+        else if (eErr == CE_None)
             eErr = GDALWarpCutlineMaskerEx(
                 psOptions, psOptions->nBandCount, psOptions->eWorkingDataType,
                 oWK.nSrcXOff, oWK.nSrcYOff, oWK.nSrcXSize, oWK.nSrcYSize,
@@ -2243,7 +2648,7 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     if (hIOMutex != nullptr)
     {
         CPLReleaseMutex(hIOMutex);
-        if (!CPLAcquireMutex(hWarpMutex, 600.0))
+        if (!psChunkWorker && !CPLAcquireMutex(hWarpMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Failed to acquire WarpMutex in WarpRegion().");
@@ -2279,7 +2684,8 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     if (hIOMutex != nullptr)
     {
-        CPLReleaseMutex(hWarpMutex);
+        if (!psChunkWorker)
+            CPLReleaseMutex(hWarpMutex);
         if (!CPLAcquireMutex(hIOMutex, 600.0))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -2598,6 +3004,103 @@ void GDALWarpOperation::ComputeSourceWindowStartingFromSource(
     }
 }
 
+/************************************************************************/
+/*                     GDALWarpTransformWithCache()                     */
+/************************************************************************/
+
+// Maximum number of entries of GDALWarpPrivateData::oMapTransformCache
+constexpr size_t MAX_CACHED_TRANSFORMED_POINTS = 100 * 1000;
+
+/** Transform destination pixel coordinates to source pixel coordinates,
+ * reusing the results of the previous calls for the same warp operation.
+ *
+ * Only the points not found in the cache are transformed. The approximate
+ * transformer interpolates points that lie on a same line, so in that
+ * situation they are transformed by groups of at most 5 points, to get the
+ * same results as when transforming all the points of the caller at once.
+ */
+static int GDALWarpTransformWithCache(GDALWarpPrivateData *psPrivate,
+                                      GDALTransformerFunc pfnTransformer,
+                                      void *pTransformerArg, int nPointCount,
+                                      double *padfX, double *padfY,
+                                      double *padfZ, int *pabSuccess)
+{
+    std::vector<int> anMissing;
+    {
+        std::lock_guard<std::mutex> oLock(psPrivate->oTransformCacheMutex);
+        for (int i = 0; i < nPointCount; ++i)
+        {
+            const auto oIter = psPrivate->oMapTransformCache.find(
+                std::pair<double, double>(padfX[i], padfY[i]));
+            if (oIter == psPrivate->oMapTransformCache.end())
+            {
+                anMissing.push_back(i);
+            }
+            else
+            {
+                padfX[i] = oIter->second.dfX;
+                padfY[i] = oIter->second.dfY;
+                padfZ[i] = oIter->second.dfZ;
+                pabSuccess[i] = oIter->second.bSuccess;
+            }
+        }
+    }
+    if (anMissing.empty())
+        return TRUE;
+
+    const int nMissing = static_cast<int>(anMissing.size());
+    std::vector<double> adfX(nMissing);
+    std::vector<double> adfY(nMissing);
+    std::vector<double> adfZ(nMissing);
+    std::vector<int> abSuccess(nMissing);
+    for (int i = 0; i < nMissing; ++i)
+    {
+        adfX[i] = padfX[anMissing[i]];
+        adfY[i] = padfY[anMissing[i]];
+        adfZ[i] = padfZ[anMissing[i]];
+    }
+
+    const bool bOnSameLine = nMissing > 5 && adfY[0] == adfY[nMissing - 1] &&
+                             adfY[0] == adfY[(nMissing - 1) / 2];
+    const int nBatchSize = bOnSameLine ? 5 : nMissing;
+    for (int i = 0; i < nMissing; i += nBatchSize)
+    {
+        const int nCount = std::min(nBatchSize, nMissing - i);
+        if (!pfnTransformer(pTransformerArg, TRUE, nCount, adfX.data() + i,
+                            adfY.data() + i, adfZ.data() + i,
+                            abSuccess.data() + i))
+        {
+            return FALSE;
+        }
+    }
+
+    std::lock_guard<std::mutex> oLock(psPrivate->oTransformCacheMutex);
+    if (psPrivate->oMapTransformCache.size() + nMissing >
+        MAX_CACHED_TRANSFORMED_POINTS)
+    {
+        psPrivate->oMapTransformCache.clear();
+    }
+    for (int i = 0; i < nMissing; ++i)
+    {
+        const int iPoint = anMissing[i];
+        GDALWarpTransformedPoint sPoint;
+        sPoint.dfX = adfX[i];
+        sPoint.dfY = adfY[i];
+        sPoint.dfZ = adfZ[i];
+        sPoint.bSuccess = abSuccess[i] != 0;
+        if (nMissing <= static_cast<int>(MAX_CACHED_TRANSFORMED_POINTS))
+        {
+            psPrivate->oMapTransformCache[std::pair<double, double>(
+                padfX[iPoint], padfY[iPoint])] = sPoint;
+        }
+        padfX[iPoint] = sPoint.dfX;
+        padfY[iPoint] = sPoint.dfY;
+        padfZ[iPoint] = sPoint.dfZ;
+        pabSuccess[iPoint] = abSuccess[i];
+    }
+    return TRUE;
+}
+
 /************************************************************************/
 /*                    ComputeSourceWindowTransformPoints()              */
 /************************************************************************/
@@ -2798,9 +3301,17 @@ bool GDALWarpOperation::ComputeSourceWindowTransformPoints(
         CPLSetThreadLocalConfigOption("CHECK_WITH_INVERT_PROJ", "YES");
         RefreshTransformer();
     }
-    int ret = psOptions->pfnTransformer(psOptions->pTransformerArg, TRUE,
+    // CHECK_WITH_INVERT_PROJ changes the results of the transformer, so
+    // bypass the cache in that case.
+    int ret =
+        bTryWithCheckWithInvertProj
+            ? psOptions->pfnTransformer(psOptions->pTransformerArg, TRUE,
                                         nSamplePoints, padfX, padfY, padfZ,
-                                        pabSuccess);
+                                        pabSuccess)
+            : GDALWarpTransformWithCache(
+                  GetWarpPrivateData(this), psOptions->pfnTransformer,
+                  psOptions->pTransformerArg, nSamplePoints, padfX, padfY,
+                  padfZ, pabSuccess);
     if (bTryWithCheckWithInvertProj)
     {
         CPLSetThreadLocalConfigOption("CHECK_WITH_INVERT_PROJ", nullptr);
@@ -2925,9 +3436,10 @@ CPLErr GDALWarpOperation::ComputeSourceWindow(
         adfCornerY[2] = nDstYOff + nDstYSize;
         adfCornerX[3] = nDstXOff + nDstXSize;
         adfCornerY[3] = nDstYOff + nDstYSize;
-        if (!psOptions->pfnTransformer(psOptions->pTransformerArg, TRUE, 4,
-                                       adfCornerX, adfCornerY, adfCornerZ,
-                                       anCornerSuccess) ||
+        if (!GDALWarpTransformWithCache(
+                GetWarpPrivateData(this), psOptions->pfnTransformer,
+                psOptions->pTransformerArg, 4, adfCornerX, adfCornerY,
+                adfCornerZ, anCornerSuccess) ||
             !anCornerSuccess[0] || !anCornerSuccess[1] || !anCornerSuccess[2] ||
             !anCornerSuccess[3])
         {
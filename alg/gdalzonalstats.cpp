@@ -0,0 +1,687 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Compute statistics of raster values within zones.
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdal_alg.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_progress.h"
+#include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "memdataset.h"
+#include "ogr_api.h"
+#include "ogr_core.h"
+#include "ogr_feature.h"
+#include "ogr_geometry.h"
+#include "ogr_spatialref.h"
+#include "ogrsf_frmts.h"
+
+namespace
+{
+
+// Value of pixels that do not belong to any zone
+constexpr GIntBig ZONAL_STATS_NO_ZONE = std::numeric_limits<GIntBig>::min();
+
+struct GDALZonalStatsHistogramDef
+{
+    int nBuckets = 0;
+    double dfMin = 0;
+    double dfMax = 0;
+};
+
+struct GDALZonalStatsAccumulator
+{
+    GIntBig nCount = 0;
+    double dfSum = 0;
+    double dfMin = std::numeric_limits<double>::infinity();
+    double dfMax = -std::numeric_limits<double>::infinity();
+    // Running mean and sum of squared differences to the mean (Welford)
+    double dfMean = 0;
+    double dfM2 = 0;
+    std::vector<GIntBig> anHistogram{};
+
+    void Add(double dfVal, const GDALZonalStatsHistogramDef &sHistDef)
+    {
+        ++nCount;
+        dfSum += dfVal;
+        dfMin = std::min(dfMin, dfVal);
+        dfMax = std::max(dfMax, dfVal);
+        const double dfDelta = dfVal - dfMean;
+        dfMean += dfDelta / static_cast<double>(nCount);
+        dfM2 += dfDelta * (dfVal - dfMean);
+
+        if (sHistDef.nBuckets > 0 && dfVal >= sHistDef.dfMin &&
+            dfVal <= sHistDef.dfMax)
+        {
+            if (anHistogram.empty())
+                anHistogram.resize(sHistDef.nBuckets);
+            const int iBucket = std::min(
+                sHistDef.nBuckets - 1,
+                static_cast<int>((dfVal - sHistDef.dfMin) /
+                                 (sHistDef.dfMax - sHistDef.dfMin) *
+                                 sHistDef.nBuckets));
+            ++anHistogram[iBucket];
+        }
+    }
+
+    void Merge(const GDALZonalStatsAccumulator &other)
+    {
+        if (other.nCount == 0)
+            return;
+        const GIntBig nNewCount = nCount + other.nCount;
+        const double dfDelta = other.dfMean - dfMean;
+        dfMean += dfDelta * static_cast<double>(other.nCount) /
+                  static_cast<double>(nNewCount);
+        dfM2 += other.dfM2 + dfDelta * dfDelta *
+                                 static_cast<double>(nCount) *
+                                 static_cast<double>(other.nCount) /
+                                 static_cast<double>(nNewCount);
+        nCount = nNewCount;
+        dfSum += other.dfSum;
+        dfMin = std::min(dfMin, other.dfMin);
+        dfMax = std::max(dfMax, other.dfMax);
+        if (!other.anHistogram.empty())
+        {
+            if (anHistogram.empty())
+                anHistogram.resize(other.anHistogram.size());
+            for (size_t i = 0; i < anHistogram.size(); ++i)
+                anHistogram[i] += other.anHistogram[i];
+        }
+    }
+};
+
+typedef std::map<GIntBig, GDALZonalStatsAccumulator> GDALZonalStatsMap;
+
+// Pixels of a chunk of lines
+struct GDALZonalStatsChunk
+{
+    std::vector<double> adfValues{};
+    std::vector<GByte> abyMask{};
+    std::vector<GIntBig> anZones{};
+    size_t nPixels = 0;
+};
+
+struct GDALZonalStatsJob
+{
+    const GDALZonalStatsChunk *psChunk = nullptr;
+    size_t nStart = 0;
+    size_t nEnd = 0;
+    GDALZonalStatsMap *poMap = nullptr;
+    const GDALZonalStatsHistogramDef *psHistDef = nullptr;
+};
+
+struct GDALZonalStatsZoneGeom
+{
+    std::unique_ptr<OGRGeometry> poGeom{};
+    OGREnvelope sEnvelope{};
+    GIntBig nFID = 0;
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                      GDALZonalStatsJobFunc()                         */
+/************************************************************************/
+
+static void GDALZonalStatsJobFunc(void *pData)
+{
+    const auto psJob = static_cast<const GDALZonalStatsJob *>(pData);
+    const auto psChunk = psJob->psChunk;
+    const bool bHasMask = !psChunk->abyMask.empty();
+    auto &oMap = *(psJob->poMap);
+
+    // Zones are usually spatially coherent, so cache the last one.
+    GIntBig nLastZone = ZONAL_STATS_NO_ZONE;
+    GDALZonalStatsAccumulator *poLastAcc = nullptr;
+    for (size_t i = psJob->nStart; i < psJob->nEnd; ++i)
+    {
+        const GIntBig nZone = psChunk->anZones[i];
+        const double dfVal = psChunk->adfValues[i];
+        if (nZone == ZONAL_STATS_NO_ZONE ||
+            (bHasMask && !psChunk->abyMask[i]) || std::isnan(dfVal))
+        {
+            continue;
+        }
+        if (nZone != nLastZone || poLastAcc == nullptr)
+        {
+            nLastZone = nZone;
+            poLastAcc = &oMap[nZone];
+        }
+        poLastAcc->Add(dfVal, *(psJob->psHistDef));
+    }
+}
+
+/************************************************************************/
+/*                     GDALZonalStatsCollectZones()                     */
+/*                                                                      */
+/*      Load the geometries of the zone layer, in the georeferenced    */
+/*      coordinates of the source raster.                               */
+/************************************************************************/
+
+static bool
+GDALZonalStatsCollectZones(OGRLayer *poZoneLayer, GDALDataset *poSrcDS,
+                           std::vector<GDALZonalStatsZoneGeom> &aoZones)
+{
+    std::unique_ptr<OGRCoordinateTransformation> poCT;
+    const OGRSpatialReference *poLayerSRS = poZoneLayer->GetSpatialRef();
+    const OGRSpatialReference *poRasterSRS =
+        poSrcDS ? poSrcDS->GetSpatialRef() : nullptr;
+    if (poLayerSRS && poRasterSRS && !poLayerSRS->IsSame(poRasterSRS))
+    {
+        OGRSpatialReference oLayerSRS(*poLayerSRS);
+        oLayerSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+        OGRSpatialReference oRasterSRS(*poRasterSRS);
+        oRasterSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+        poCT.reset(OGRCreateCoordinateTransformation(&oLayerSRS, &oRasterSRS));
+        if (!poCT)
+            return false;
+    }
+
+    poZoneLayer->ResetReading();
+    for (auto &&poFeature : *poZoneLayer)
+    {
+        std::unique_ptr<OGRGeometry> poGeom(poFeature->StealGeometry());
+        if (!poGeom || poGeom->IsEmpty())
+            continue;
+        if (poCT && poGeom->transform(poCT.get()) != OGRERR_NONE)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Cannot reproject geometry of feature " CPL_FRMT_GIB
+                     ". Ignoring it.",
+                     static_cast<GIntBig>(poFeature->GetFID()));
+            continue;
+        }
+        GDALZonalStatsZoneGeom oZone;
+        poGeom->getEnvelope(&oZone.sEnvelope);
+        oZone.poGeom = std::move(poGeom);
+        oZone.nFID = poFeature->GetFID();
+        aoZones.push_back(std::move(oZone));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      GDALZonalStatsBurnZones()                       */
+/*                                                                      */
+/*      Rasterize the zones intersecting a chunk of lines, burning     */
+/*      their FID.                                                      */
+/************************************************************************/
+
+static CPLErr
+GDALZonalStatsBurnZones(const std::vector<GDALZonalStatsZoneGeom> &aoZones,
+                        const double *padfGeoTransform, int nYOff, int nXSize,
+                        int nLines, CSLConstList papszRasterizeOptions,
+                        GIntBig *panZones)
+{
+    std::fill(panZones, panZones + static_cast<size_t>(nXSize) * nLines,
+              ZONAL_STATS_NO_ZONE);
+
+    double adfChunkGT[6];
+    memcpy(adfChunkGT, padfGeoTransform, sizeof(adfChunkGT));
+    adfChunkGT[0] += nYOff * padfGeoTransform[2];
+    adfChunkGT[3] += nYOff * padfGeoTransform[5];
+
+    // Georeferenced extent of the chunk
+    double dfMinX = std::numeric_limits<double>::infinity();
+    double dfMinY = std::numeric_limits<double>::infinity();
+    double dfMaxX = -std::numeric_limits<double>::infinity();
+    double dfMaxY = -std::numeric_limits<double>::infinity();
+    for (int iCorner = 0; iCorner < 4; ++iCorner)
+    {
+        const double dfPixel = (iCorner & 1) ? nXSize : 0;
+        const double dfLine = (iCorner & 2) ? nLines : 0;
+        const double dfX =
+            adfChunkGT[0] + dfPixel * adfChunkGT[1] + dfLine * adfChunkGT[2];
+        const double dfY =
+            adfChunkGT[3] + dfPixel * adfChunkGT[4] + dfLine * adfChunkGT[5];
+        dfMinX = std::min(dfMinX, dfX);
+        dfMinY = std::min(dfMinY, dfY);
+        dfMaxX = std::max(dfMaxX, dfX);
+        dfMaxY = std::max(dfMaxY, dfY);
+    }
+
+    std::vector<OGRGeometryH> ahGeoms;
+    std::vector<int64_t> anFIDs;
+    for (const auto &oZone : aoZones)
+    {
+        if (oZone.sEnvelope.MaxX < dfMinX || oZone.sEnvelope.MinX > dfMaxX ||
+            oZone.sEnvelope.MaxY < dfMinY || oZone.sEnvelope.MinY > dfMaxY)
+        {
+            continue;
+        }
+        ahGeoms.push_back(OGRGeometry::ToHandle(oZone.poGeom.get()));
+        anFIDs.push_back(oZone.nFID);
+    }
+    if (ahGeoms.empty())
+        return CE_None;
+
+    auto poMEMDS =
+        MEMDataset::Create("", nXSize, nLines, 0, GDT_Int64, nullptr);
+    GDALRasterBandH hMEMBand = MEMCreateRasterBandEx(
+        poMEMDS, 1, reinterpret_cast<GByte *>(panZones), GDT_Int64, 0, 0,
+        false);
+    poMEMDS->AddMEMBand(hMEMBand);
+    poMEMDS->SetGeoTransform(adfChunkGT);
+
+    int nTargetBand = 1;
+    GDALDatasetH hMEMDS = GDALDataset::ToHandle(poMEMDS);
+    const CPLErr eErr = GDALRasterizeGeometriesInt64(
+        hMEMDS, 1, &nTargetBand, static_cast<int>(ahGeoms.size()),
+        ahGeoms.data(), nullptr, nullptr, anFIDs.data(), papszRasterizeOptions,
+        nullptr, nullptr);
+    GDALClose(hMEMDS);
+    return eErr;
+}
+
+/************************************************************************/
+/*                        GDALZonalStatistics()                         */
+/************************************************************************/
+
+/**
+ * Compute statistics of raster values within zones.
+ *
+ * Zones are either defined by the integer values of a zone raster band,
+ * which must have the same dimensions as the source band, or by the
+ * polygons of a zone layer, which are rasterized on the fly on the grid of
+ * the source band, with the same rules as GDALRasterizeGeometries(). When
+ * polygons of the zone layer overlap, pixels are assigned to the last one.
+ *
+ * The source band is read only once, by chunks of lines, and the
+ * statistics of each chunk are accumulated in worker threads if the
+ * NUM_THREADS option is set.
+ *
+ * Invalid pixels of the source band, as determined by its mask band, and
+ * NaN values, are ignored. Pixels that are invalid in the zone band, or
+ * outside of any polygon of the zone layer, are ignored too.
+ *
+ * For each zone, a feature is created in the output layer, with the
+ * following fields, which are created in the layer if they do not exist
+ * yet: "zone" (Integer64: value of the zone band, or FID of the zone
+ * feature), "count" (Integer64: number of pixels), "sum", "mean", "min",
+ * "max", "stddev" (Real: population standard deviation), and, when a
+ * histogram is requested, "histogram" (Integer64List). When zones come
+ * from a layer, a feature is created for each zone feature, with a null
+ * count of pixels if it does not intersect any valid pixel.
+ *
+ * @param hSrcBand the band whose values are used.
+ * @param hZoneBand the band whose values define the zones, or NULL.
+ * @param hZoneLayer the layer whose polygons define the zones, or NULL.
+ * Exactly one of hZoneBand and hZoneLayer must be set.
+ * @param hDstLayer the layer into which features are written.
+ * @param papszOptions a name/value list of additional options
+ * <ul>
+ * <li>NUM_THREADS=number|ALL_CPUS: number of threads used to accumulate
+ * statistics. Defaults to the value of the GDAL_NUM_THREADS configuration
+ * option, or 1.</li>
+ * <li>ALL_TOUCHED=YES/NO: whether all pixels touched by the polygons of the
+ * zone layer belong to the zone, and not only those whose center is
+ * within the polygon. Defaults to NO.</li>
+ * <li>HISTOGRAM_BUCKETS=number: number of buckets of a histogram of values
+ * to compute for each zone. Requires HISTOGRAM_MIN and HISTOGRAM_MAX.</li>
+ * <li>HISTOGRAM_MIN=value: lower bound of the first bucket.</li>
+ * <li>HISTOGRAM_MAX=value: upper bound of the last bucket. Values outside
+ * of [HISTOGRAM_MIN, HISTOGRAM_MAX] are not counted in the histogram.</li>
+ * </ul>
+ * @param pfnProgress callback for reporting algorithm progress
+ * matching the GDALProgressFunc() semantics.  May be NULL.
+ * @param pProgressArg callback argument passed to pfnProgress.
+ *
+ * @return CE_None on success or CE_Failure if an error occurs.
+ *
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALZonalStatistics(GDALRasterBandH hSrcBand, GDALRasterBandH hZoneBand,
+                           OGRLayerH hZoneLayer, OGRLayerH hDstLayer,
+                           CSLConstList papszOptions,
+                           GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    VALIDATE_POINTER1(hSrcBand, "GDALZonalStatistics", CE_Failure);
+    VALIDATE_POINTER1(hDstLayer, "GDALZonalStatistics", CE_Failure);
+
+    if ((hZoneBand == nullptr) == (hZoneLayer == nullptr))
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "GDALZonalStatistics(): exactly one of hZoneBand and "
+                 "hZoneLayer must be set.");
+        return CE_Failure;
+    }
+
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    GDALRasterBand *poSrcBand = GDALRasterBand::FromHandle(hSrcBand);
+    GDALRasterBand *poZoneBand = GDALRasterBand::FromHandle(hZoneBand);
+    OGRLayer *poZoneLayer = OGRLayer::FromHandle(hZoneLayer);
+    OGRLayer *poDstLayer = OGRLayer::FromHandle(hDstLayer);
+
+    const int nXSize = poSrcBand->GetXSize();
+    const int nYSize = poSrcBand->GetYSize();
+    if (poZoneBand && (poZoneBand->GetXSize() != nXSize ||
+                       poZoneBand->GetYSize() != nYSize))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Source and zone bands should have the same dimensions.");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Parse options.                                                  */
+    /* -------------------------------------------------------------------- */
+    GDALZonalStatsHistogramDef sHistDef;
+    const char *pszBuckets =
+        CSLFetchNameValue(papszOptions, "HISTOGRAM_BUCKETS");
+    if (pszBuckets)
+    {
+        const char *pszMin = CSLFetchNameValue(papszOptions, "HISTOGRAM_MIN");
+        const char *pszMax = CSLFetchNameValue(papszOptions, "HISTOGRAM_MAX");
+        sHistDef.nBuckets = atoi(pszBuckets);
+        if (pszMin == nullptr || pszMax == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "HISTOGRAM_MIN and HISTOGRAM_MAX must be set when "
+                     "HISTOGRAM_BUCKETS is set.");
+            return CE_Failure;
+        }
+        sHistDef.dfMin = CPLAtof(pszMin);
+        sHistDef.dfMax = CPLAtof(pszMax);
+        if (sHistDef.nBuckets <= 0 || sHistDef.nBuckets > 100 * 1000 * 1000 ||
+            !(sHistDef.dfMax > sHistDef.dfMin))
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "Invalid values for HISTOGRAM_BUCKETS, HISTOGRAM_MIN or "
+                     "HISTOGRAM_MAX.");
+            return CE_Failure;
+        }
+    }
+
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads)));
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Load zone geometries.                                           */
+    /* -------------------------------------------------------------------- */
+    std::vector<GDALZonalStatsZoneGeom> aoZones;
+    double adfGeoTransform[6] = {0, 1, 0, 0, 0, 1};
+    CPLStringList aosRasterizeOptions;
+    if (poZoneLayer)
+    {
+        GDALDataset *poSrcDS = poSrcBand->GetDataset();
+        if (poSrcDS)
+            poSrcDS->GetGeoTransform(adfGeoTransform);
+        if (!GDALZonalStatsCollectZones(poZoneLayer, poSrcDS, aoZones))
+            return CE_Failure;
+        if (CPLFetchBool(papszOptions, "ALL_TOUCHED", false))
+            aosRasterizeOptions.SetNameValue("ALL_TOUCHED", "YES");
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Establish the chunks of lines to process, as a multiple of the  */
+    /*      block height.                                                   */
+    /* -------------------------------------------------------------------- */
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poSrcBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    constexpr int CHUNK_PIXELS = 1024 * 1024;
+    int nChunkLines = std::max(1, CHUNK_PIXELS / std::max(1, nXSize));
+    if (nBlockYSize > 0 && nBlockYSize <= nChunkLines)
+        nChunkLines = nChunkLines / nBlockYSize * nBlockYSize;
+    nChunkLines = std::min(nChunkLines, nYSize);
+
+    GDALRasterBand *poSrcMask = nullptr;
+    if (!(poSrcBand->GetMaskFlags() & GMF_ALL_VALID))
+        poSrcMask = poSrcBand->GetMaskBand();
+    GDALRasterBand *poZoneMask = nullptr;
+    if (poZoneBand && !(poZoneBand->GetMaskFlags() & GMF_ALL_VALID))
+        poZoneMask = poZoneBand->GetMaskBand();
+
+    // Two chunks, so that a chunk can be read while the other one is
+    // processed by worker threads.
+    GDALZonalStatsChunk asChunks[2];
+    std::vector<GByte> abyZoneMask;
+    const size_t nChunkPixels = static_cast<size_t>(nXSize) * nChunkLines;
+    try
+    {
+        for (auto &sChunk : asChunks)
+        {
+            sChunk.adfValues.resize(nChunkPixels);
+            sChunk.anZones.resize(nChunkPixels);
+            if (poSrcMask || poZoneMask)
+                sChunk.abyMask.resize(nChunkPixels);
+            if (!poJobQueue)
+                break;
+        }
+        if (poSrcMask && poZoneMask)
+            abyZoneMask.resize(nChunkPixels);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffers");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Process chunks.                                                 */
+    /* -------------------------------------------------------------------- */
+    std::vector<GDALZonalStatsMap> aoMaps(nThreads);
+    std::vector<GDALZonalStatsJob> asJobs(nThreads);
+    CPLErr eErr = CE_None;
+    int iChunk = 0;
+    for (int nYOff = 0; nYOff < nYSize && eErr == CE_None;
+         nYOff += nChunkLines, ++iChunk)
+    {
+        const int nLines = std::min(nChunkLines, nYSize - nYOff);
+        auto &sChunk = asChunks[poJobQueue ? iChunk % 2 : 0];
+        sChunk.nPixels = static_cast<size_t>(nXSize) * nLines;
+
+        eErr = poSrcBand->RasterIO(GF_Read, 0, nYOff, nXSize, nLines,
+                                   sChunk.adfValues.data(), nXSize, nLines,
+                                   GDT_Float64, 0, 0, nullptr);
+        if (eErr == CE_None && poSrcMask)
+        {
+            eErr = poSrcMask->RasterIO(GF_Read, 0, nYOff, nXSize, nLines,
+                                       sChunk.abyMask.data(), nXSize, nLines,
+                                       GDT_Byte, 0, 0, nullptr);
+        }
+        if (eErr == CE_None && poZoneMask)
+        {
+            GByte *pabyZoneMask =
+                poSrcMask ? abyZoneMask.data() : sChunk.abyMask.data();
+            eErr = poZoneMask->RasterIO(GF_Read, 0, nYOff, nXSize, nLines,
+                                        pabyZoneMask, nXSize, nLines, GDT_Byte,
+                                        0, 0, nullptr);
+            if (poSrcMask)
+            {
+                for (size_t i = 0; i < sChunk.nPixels; ++i)
+                    sChunk.abyMask[i] &= pabyZoneMask[i];
+            }
+        }
+        if (eErr == CE_None)
+        {
+            if (poZoneBand)
+            {
+                eErr = poZoneBand->RasterIO(GF_Read, 0, nYOff, nXSize, nLines,
+                                            sChunk.anZones.data(), nXSize,
+                                            nLines, GDT_Int64, 0, 0, nullptr);
+            }
+            else
+            {
+                eErr = GDALZonalStatsBurnZones(
+                    aoZones, adfGeoTransform, nYOff, nXSize, nLines,
+                    aosRasterizeOptions.List(), sChunk.anZones.data());
+            }
+        }
+        if (eErr != CE_None)
+            break;
+
+        if (poJobQueue)
+        {
+            // Wait for the processing of the previous chunk, which uses the
+            // same accumulators.
+            poJobQueue->WaitCompletion();
+            for (int iJob = 0; iJob < nThreads; ++iJob)
+            {
+                auto &sJob = asJobs[iJob];
+                sJob.psChunk = &sChunk;
+                sJob.nStart = sChunk.nPixels * iJob / nThreads;
+                sJob.nEnd = sChunk.nPixels * (iJob + 1) / nThreads;
+                sJob.poMap = &aoMaps[iJob];
+                sJob.psHistDef = &sHistDef;
+                poJobQueue->SubmitJob(GDALZonalStatsJobFunc, &sJob);
+            }
+        }
+        else
+        {
+            auto &sJob = asJobs[0];
+            sJob.psChunk = &sChunk;
+            sJob.nStart = 0;
+            sJob.nEnd = sChunk.nPixels;
+            sJob.poMap = &aoMaps[0];
+            sJob.psHistDef = &sHistDef;
+            GDALZonalStatsJobFunc(&sJob);
+        }
+
+        if (!pfnProgress(static_cast<double>(nYOff + nLines) / nYSize, "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+    if (eErr != CE_None)
+        return eErr;
+
+    for (int i = 1; i < nThreads; ++i)
+    {
+        for (const auto &oIter : aoMaps[i])
+            aoMaps[0][oIter.first].Merge(oIter.second);
+        aoMaps[i].clear();
+    }
+    auto &oMap = aoMaps[0];
+    if (poZoneLayer)
+    {
+        // Report all zones, even those without any pixel.
+        for (const auto &oZone : aoZones)
+            oMap[oZone.nFID];
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Create output fields if needed.                                 */
+    /* -------------------------------------------------------------------- */
+    const struct
+    {
+        const char *pszName;
+        OGRFieldType eType;
+    } asFields[] = {
+        {"zone", OFTInteger64}, {"count", OFTInteger64},
+        {"sum", OFTReal},       {"mean", OFTReal},
+        {"min", OFTReal},       {"max", OFTReal},
+        {"stddev", OFTReal},    {"histogram", OFTInteger64List},
+    };
+    int anFieldIdx[CPL_ARRAYSIZE(asFields)];
+    for (size_t i = 0; i < CPL_ARRAYSIZE(asFields); ++i)
+    {
+        const bool bIsHistogram = asFields[i].eType == OFTInteger64List;
+        anFieldIdx[i] = -1;
+        if (bIsHistogram && sHistDef.nBuckets == 0)
+            continue;
+        anFieldIdx[i] =
+            poDstLayer->GetLayerDefn()->GetFieldIndex(asFields[i].pszName);
+        if (anFieldIdx[i] < 0)
+        {
+            OGRFieldDefn oFieldDefn(asFields[i].pszName, asFields[i].eType);
+            if (poDstLayer->CreateField(&oFieldDefn) != OGRERR_NONE)
+                return CE_Failure;
+            anFieldIdx[i] =
+                poDstLayer->GetLayerDefn()->GetFieldIndex(asFields[i].pszName);
+            if (anFieldIdx[i] < 0)
+                return CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Write statistics.                                               */
+    /* -------------------------------------------------------------------- */
+    for (const auto &oIter : oMap)
+    {
+        const auto &oAcc = oIter.second;
+        OGRFeature oFeature(poDstLayer->GetLayerDefn());
+        oFeature.SetField(anFieldIdx[0], oIter.first);
+        oFeature.SetField(anFieldIdx[1], oAcc.nCount);
+        if (oAcc.nCount > 0)
+        {
+            oFeature.SetField(anFieldIdx[2], oAcc.dfSum);
+            oFeature.SetField(anFieldIdx[3], oAcc.dfMean);
+            oFeature.SetField(anFieldIdx[4], oAcc.dfMin);
+            oFeature.SetField(anFieldIdx[5], oAcc.dfMax);
+            oFeature.SetField(
+                anFieldIdx[6],
+                std::sqrt(oAcc.dfM2 / static_cast<double>(oAcc.nCount)));
+        }
+        if (anFieldIdx[7] >= 0)
+        {
+            std::vector<GIntBig> anHistogram(oAcc.anHistogram);
+            anHistogram.resize(sHistDef.nBuckets);
+            oFeature.SetField(anFieldIdx[7],
+                              static_cast<int>(anHistogram.size()),
+                              anHistogram.data());
+        }
+        if (poDstLayer->CreateFeature(&oFeature) != OGRERR_NONE)
+            return CE_Failure;
+    }
+
+    return CE_None;
+}
@@ -241,6 +241,205 @@ void GDALdllImageFilledPolygon(int nRasterXSize, int nRasterYSize,
     }
 }
 
+/************************************************************************/
+/*                     GDALdllImagePolygonCoverage()                    */
+/*                                                                      */
+/*      Compute the exact fraction of the area of each pixel that is    */
+/*      covered by the passed multi-ring polygon, and call the          */
+/*      coverage function for each pixel whose fraction is not null.    */
+/*                                                                      */
+/*      Rings do not need to be explicitly closed. Interior rings must  */
+/*      have the opposite orientation of the exterior ring they are     */
+/*      in, and all exterior rings must have the same orientation.      */
+/*                                                                      */
+/*      For each line, the edges crossing it are clipped to the line,   */
+/*      split at pixel boundaries, and the signed area on the right of  */
+/*      each piece is accumulated, as done by font rasterizers. A       */
+/*      running sum along the line then gives the covered area.         */
+/************************************************************************/
+
+void GDALdllImagePolygonCoverage(int nRasterXSize, int nRasterYSize,
+                                 int nPartCount, const int *panPartSize,
+                                 const double *padfX, const double *padfY,
+                                 llCoverageFunc pfnCoverageFunc, void *pCBData)
+{
+    struct Edge
+    {
+        double dfX0;
+        double dfY0;
+        double dfX1;
+        double dfY1;
+        double dfDir;
+    };
+
+    std::vector<Edge> asEdges;
+    int nOffset = 0;
+    for (int iPart = 0; iPart < nPartCount; ++iPart)
+    {
+        const int nCount = panPartSize[iPart];
+        for (int i = 0; i < nCount; ++i)
+        {
+            const int i0 = nOffset + i;
+            const int i1 = nOffset + (i + 1 == nCount ? 0 : i + 1);
+            Edge sEdge;
+            sEdge.dfX0 = padfX[i0];
+            sEdge.dfY0 = padfY[i0];
+            sEdge.dfX1 = padfX[i1];
+            sEdge.dfY1 = padfY[i1];
+            sEdge.dfDir = 1.0;
+            if (sEdge.dfY0 > sEdge.dfY1)
+            {
+                std::swap(sEdge.dfX0, sEdge.dfX1);
+                std::swap(sEdge.dfY0, sEdge.dfY1);
+                sEdge.dfDir = -1.0;
+            }
+            // Horizontal edges do not contribute, and edges always fully
+            // above or below the raster can be ignored.
+            if (!(sEdge.dfY0 < sEdge.dfY1) || sEdge.dfY1 <= 0 ||
+                sEdge.dfY0 >= nRasterYSize || !std::isfinite(sEdge.dfX0) ||
+                !std::isfinite(sEdge.dfX1) || !std::isfinite(sEdge.dfY0) ||
+                !std::isfinite(sEdge.dfY1))
+            {
+                continue;
+            }
+            asEdges.push_back(sEdge);
+        }
+        nOffset += nCount;
+    }
+    if (asEdges.empty())
+        return;
+
+    std::sort(asEdges.begin(), asEdges.end(), [](const Edge &a, const Edge &b)
+              { return a.dfY0 < b.dfY0; });
+
+    const int nYStart =
+        static_cast<int>(std::max(0.0, std::floor(asEdges[0].dfY0)));
+
+    // Accumulation buffer for one line. Index nRasterXSize only receives
+    // the contributions of pieces in the last column.
+    std::vector<double> adfAcc(static_cast<size_t>(nRasterXSize) + 1);
+    std::vector<size_t> anActive;
+    size_t iNextEdge = 0;
+    constexpr double EPS = 1e-10;
+
+    for (int nY = nYStart; nY < nRasterYSize; ++nY)
+    {
+        const double dfLineTop = nY;
+        const double dfLineBottom = nY + 1.0;
+
+        // Update the list of edges crossing the line.
+        size_t j = 0;
+        for (size_t i = 0; i < anActive.size(); ++i)
+        {
+            if (asEdges[anActive[i]].dfY1 > dfLineTop)
+                anActive[j++] = anActive[i];
+        }
+        anActive.resize(j);
+        while (iNextEdge < asEdges.size() &&
+               asEdges[iNextEdge].dfY0 < dfLineBottom)
+        {
+            if (asEdges[iNextEdge].dfY1 > dfLineTop)
+                anActive.push_back(iNextEdge);
+            ++iNextEdge;
+        }
+        if (anActive.empty())
+        {
+            if (iNextEdge == asEdges.size())
+                break;
+            // Skip lines without any edge.
+            nY = std::max(
+                nY, static_cast<int>(std::floor(asEdges[iNextEdge].dfY0)) - 1);
+            continue;
+        }
+
+        int nXMinTouched = nRasterXSize;
+        int nXMaxTouched = -1;
+        for (const size_t iEdge : anActive)
+        {
+            const Edge &sEdge = asEdges[iEdge];
+            const double dfYA = std::max(sEdge.dfY0, dfLineTop);
+            const double dfYB = std::min(sEdge.dfY1, dfLineBottom);
+            const double dfH = dfYB - dfYA;
+            if (!(dfH > 0))
+                continue;
+            const double dfSlope =
+                (sEdge.dfX1 - sEdge.dfX0) / (sEdge.dfY1 - sEdge.dfY0);
+            const double dfXA = sEdge.dfX0 + (dfYA - sEdge.dfY0) * dfSlope;
+            const double dfXB = sEdge.dfX0 + (dfYB - sEdge.dfY0) * dfSlope;
+            const double dfXLo = std::min(dfXA, dfXB);
+            const double dfXHi = std::max(dfXA, dfXB);
+            const double dfSignedH = sEdge.dfDir * dfH;
+
+            // Pieces on the right of the raster do not contribute.
+            if (dfXLo >= nRasterXSize)
+                continue;
+
+            // Pieces on the left of the raster contribute fully to all
+            // pixels of the line.
+            if (dfXHi <= 0)
+            {
+                adfAcc[0] += dfSignedH;
+                nXMinTouched = 0;
+                nXMaxTouched = std::max(nXMaxTouched, 0);
+                continue;
+            }
+
+            const double dfXRange = dfXHi - dfXLo;
+            if (dfXRange == 0)
+            {
+                const int nX = static_cast<int>(dfXLo);
+                adfAcc[nX] += dfSignedH * (nX + 1 - dfXLo);
+                adfAcc[nX + 1] += dfSignedH * (dfXLo - nX);
+                nXMinTouched = std::min(nXMinTouched, nX);
+                nXMaxTouched = std::max(nXMaxTouched, nX + 1);
+                continue;
+            }
+
+            double dfP = dfXLo;
+            if (dfP < 0)
+            {
+                adfAcc[0] += dfSignedH * (-dfP / dfXRange);
+                dfP = 0;
+            }
+            const double dfXEnd = std::min(dfXHi, double(nRasterXSize));
+            int nX = static_cast<int>(dfP);
+            nXMinTouched = std::min(nXMinTouched, nX);
+            while (dfP < dfXEnd)
+            {
+                const double dfQ = std::min(double(nX + 1), dfXEnd);
+                const double dfHPiece = dfSignedH * ((dfQ - dfP) / dfXRange);
+                const double dfXMid = 0.5 * (dfP + dfQ);
+                adfAcc[nX] += dfHPiece * (nX + 1 - dfXMid);
+                adfAcc[nX + 1] += dfHPiece * (dfXMid - nX);
+                dfP = dfQ;
+                ++nX;
+            }
+            nXMaxTouched = std::max(nXMaxTouched, nX);
+        }
+
+        // Running sum along the line. After the last column touched by an
+        // edge, the coverage is constant till the right of the raster.
+        double dfSum = 0;
+        for (int nX = nXMinTouched; nX <= nXMaxTouched; ++nX)
+        {
+            dfSum += adfAcc[nX];
+            adfAcc[nX] = 0;
+            if (nX < nRasterXSize)
+            {
+                const double dfCoverage = std::min(1.0, std::fabs(dfSum));
+                if (dfCoverage > EPS)
+                    pfnCoverageFunc(pCBData, nY, nX, dfCoverage);
+            }
+        }
+        const double dfCoverage = std::min(1.0, std::fabs(dfSum));
+        if (dfCoverage > EPS)
+        {
+            for (int nX = nXMaxTouched + 1; nX < nRasterXSize; ++nX)
+                pfnCoverageFunc(pCBData, nY, nX, dfCoverage);
+        }
+    }
+}
+
 /************************************************************************/
 /*                         GDALdllImagePoint()                          */
 /************************************************************************/
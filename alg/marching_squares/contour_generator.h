@@ -70,6 +70,20 @@ class ContourGenerator
         return CE_None;
     }
 
+    // Start the processing at line lineIdx instead of the first line.
+    // previousLine must point to the values of line lineIdx - 1, or be
+    // nullptr if lineIdx is 0. This is used to process independent strips
+    // of lines, each square belonging to exactly one strip.
+    void setStartLine(size_t lineIdx, const double *previousLine)
+    {
+        lineIdx_ = lineIdx;
+        if (previousLine != nullptr)
+            std::copy(previousLine, previousLine + width_,
+                      previousLine_.begin());
+        else
+            std::fill(previousLine_.begin(), previousLine_.end(), NaN);
+    }
+
   private:
     size_t width_;
     size_t height_;
@@ -35,9 +35,15 @@
 #include <string.h>
 
 #include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -47,9 +53,12 @@
 #include "ogr_core.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "polygonize_polygonizer.h"
 
@@ -82,47 +91,27 @@ static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
 }
 
 /************************************************************************/
-/*                           GDALPolygonizeT()                          */
+/*                         GPPolygonizeLines()                          */
 /************************************************************************/
 
-template <class DataType, class EqualityTest>
-static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
-                              GDALRasterBandH hMaskBand, OGRLayerH hOutLayer,
-                              int iPixValField, char **papszOptions,
-                              GDALProgressFunc pfnProgress, void *pProgressArg,
-                              GDALDataType eDT)
-
+// Polygonize the lines iYStart to iYEnd-1, read with pfnReadLine(), as if
+// they were a whole raster, and send the polygons to oReceiver. Line and
+// column numbers of polygon vertices are those of the full raster.
+// If ppanLastLineFinalId is not null, it is set before each call to the
+// polygonizer to the final polygon ids of the previous line, which is where
+// the bottom-right cell of completed polygons is.
+// If panFirstLineFinalId / panLastLineFinalId are not null, they receive the
+// final polygon ids of the first and last lines.
+template <class DataType, class EqualityTest, class Receiver>
+static CPLErr
+GPPolygonizeLines(const std::function<CPLErr(int, DataType *)> &pfnReadLine,
+                  int nXSize, int iYStart, int iYEnd, int nConnectedness,
+                  Receiver &oReceiver, const GInt32 **ppanLastLineFinalId,
+                  std::vector<GInt32> *panFirstLineFinalId,
+                  std::vector<GInt32> *panLastLineFinalId,
+                  GDALProgressFunc pfnProgress, void *pProgressArg)
 {
-    VALIDATE_POINTER1(hSrcBand, "GDALPolygonize", CE_Failure);
-    VALIDATE_POINTER1(hOutLayer, "GDALPolygonize", CE_Failure);
-
-    if (pfnProgress == nullptr)
-        pfnProgress = GDALDummyProgress;
-
-    const int nConnectedness =
-        CSLFetchNameValue(papszOptions, "8CONNECTED") ? 8 : 4;
-
-    /* -------------------------------------------------------------------- */
-    /*      Confirm our output layer will support feature creation.         */
-    /* -------------------------------------------------------------------- */
-    if (!OGR_L_TestCapability(hOutLayer, OLCSequentialWrite))
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Output feature layer does not appear to support creation "
-                 "of features in GDALPolygonize().");
-        return CE_Failure;
-    }
-
-    /* -------------------------------------------------------------------- */
-    /*      Allocate working buffers.                                       */
-    /* -------------------------------------------------------------------- */
-    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
-    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
-    if (nXSize > std::numeric_limits<int>::max() - 2)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Too wide raster");
-        return CE_Failure;
-    }
+    const int nLines = iYEnd - iYStart;
 
     DataType *panLastLineVal =
         static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
@@ -132,56 +121,24 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
     GInt32 *panThisLineId =
         static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
-
-    GByte *pabyMaskLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
+    GInt32 *panLastFinalId =
+        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
+    GInt32 *panThisFinalId =
+        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
 
     if (panLastLineVal == nullptr || panThisLineVal == nullptr ||
         panLastLineId == nullptr || panThisLineId == nullptr ||
-        pabyMaskLine == nullptr)
+        panLastFinalId == nullptr || panThisFinalId == nullptr)
     {
+        CPLFree(panThisFinalId);
+        CPLFree(panLastFinalId);
         CPLFree(panThisLineId);
         CPLFree(panLastLineId);
         CPLFree(panThisLineVal);
         CPLFree(panLastLineVal);
-        CPLFree(pabyMaskLine);
         return CE_Failure;
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Get the geotransform, if there is one, so we can convert the    */
-    /*      vectors into georeferenced coordinates.                         */
-    /* -------------------------------------------------------------------- */
-    double adfGeoTransform[6] = {0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
-    bool bGotGeoTransform = false;
-    const char *pszDatasetForGeoRef =
-        CSLFetchNameValue(papszOptions, "DATASET_FOR_GEOREF");
-    if (pszDatasetForGeoRef)
-    {
-        GDALDatasetH hSrcDS = GDALOpen(pszDatasetForGeoRef, GA_ReadOnly);
-        if (hSrcDS)
-        {
-            bGotGeoTransform =
-                GDALGetGeoTransform(hSrcDS, adfGeoTransform) == CE_None;
-            GDALClose(hSrcDS);
-        }
-    }
-    else
-    {
-        GDALDatasetH hSrcDS = GDALGetBandDataset(hSrcBand);
-        if (hSrcDS)
-            bGotGeoTransform =
-                GDALGetGeoTransform(hSrcDS, adfGeoTransform) == CE_None;
-    }
-    if (!bGotGeoTransform)
-    {
-        adfGeoTransform[0] = 0;
-        adfGeoTransform[1] = 1;
-        adfGeoTransform[2] = 0;
-        adfGeoTransform[3] = 0;
-        adfGeoTransform[4] = 0;
-        adfGeoTransform[5] = 1;
-    }
-
     /* -------------------------------------------------------------------- */
     /*      The first pass over the raster is only used to build up the     */
     /*      polygon id map so we will know in advance what polygons are     */
@@ -192,19 +149,14 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
 
     CPLErr eErr = CE_None;
 
-    for (int iY = 0; eErr == CE_None && iY < nYSize; iY++)
+    for (int iY = iYStart; eErr == CE_None && iY < iYEnd; iY++)
     {
-        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1, panThisLineVal,
-                            nXSize, 1, eDT, 0, 0);
-
-        if (eErr == CE_None && hMaskBand != nullptr)
-            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
-                                   panThisLineVal);
+        eErr = pfnReadLine(iY, panThisLineVal);
 
         if (eErr != CE_None)
             break;
 
-        if (iY == 0)
+        if (iY == iYStart)
             eErr = oFirstEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
                                           panThisLineId, nXSize)
                        ? CE_None
@@ -227,8 +179,10 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         /*      Report progress, and support interrupts. */
         /* --------------------------------------------------------------------
          */
-        if (!pfnProgress(0.10 * ((iY + 1) / static_cast<double>(nYSize)), "",
-                         pProgressArg))
+        if (pfnProgress &&
+            !pfnProgress(0.10 * ((iY - iYStart + 1) /
+                                 static_cast<double>(nLines)),
+                         "", pProgressArg))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
             eErr = CE_Failure;
@@ -250,9 +204,7 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
     GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oSecondEnum(
         nConnectedness);
 
-    OGRPolygonWriter<DataType> oPolygonWriter{hOutLayer, iPixValField,
-                                              adfGeoTransform};
-    Polygonizer<GInt32, DataType> oPolygonizer{-1, &oPolygonWriter};
+    Polygonizer<GInt32, DataType> oPolygonizer{-1, &oReceiver};
     TwoArm *paoLastLineArm =
         static_cast<TwoArm *>(VSI_CALLOC_VERBOSE(sizeof(TwoArm), nXSize + 2));
     TwoArm *paoThisLineArm =
@@ -274,21 +226,15 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
     /*      Second pass during which we will actually collect polygon       */
     /*      edges as geometries.                                            */
     /* ==================================================================== */
-    for (int iY = 0; eErr == CE_None && iY < nYSize + 1; iY++)
+    for (int iY = iYStart; eErr == CE_None && iY < iYEnd + 1; iY++)
     {
         /* --------------------------------------------------------------------
          */
         /*      Read the image data. */
         /* --------------------------------------------------------------------
          */
-        if (iY < nYSize)
-        {
-            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1,
-                                panThisLineVal, nXSize, 1, eDT, 0, 0);
-            if (eErr == CE_None && hMaskBand != nullptr)
-                eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
-                                       panThisLineVal);
-        }
+        if (iY < iYEnd)
+            eErr = pfnReadLine(iY, panThisLineVal);
 
         if (eErr != CE_None)
             continue;
@@ -299,56 +245,58 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         /*      the same thing done in the first pass above). */
         /* --------------------------------------------------------------------
          */
-        if (iY == nYSize)
+        if (iY == iYEnd)
         {
             for (int iX = 0; iX < nXSize; iX++)
-                panThisLineId[iX] =
+                panThisFinalId[iX] =
                     decltype(oPolygonizer)::THE_OUTER_POLYGON_ID;
         }
-        else if (iY == 0)
-        {
-            eErr = oSecondEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
-                                           panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-        }
         else
         {
-            eErr = oSecondEnum.ProcessLine(panLastLineVal, panThisLineVal,
-                                           panLastLineId, panThisLineId, nXSize)
-                       ? CE_None
-                       : CE_Failure;
-        }
+            if (iY == iYStart)
+            {
+                eErr = oSecondEnum.ProcessLine(nullptr, panThisLineVal, nullptr,
+                                               panThisLineId, nXSize)
+                           ? CE_None
+                           : CE_Failure;
+            }
+            else
+            {
+                eErr = oSecondEnum.ProcessLine(panLastLineVal, panThisLineVal,
+                                               panLastLineId, panThisLineId,
+                                               nXSize)
+                           ? CE_None
+                           : CE_Failure;
+            }
 
-        if (eErr != CE_None)
-            continue;
+            if (eErr != CE_None)
+                continue;
 
-        if (iY < nYSize)
-        {
             for (int iX = 0; iX < nXSize; iX++)
             {
                 // TODO: maybe we can reserve -1 as the lookup result for -1 polygon id in the panPolyIdMap,
-                //       so the this expression becomes: panLastLineId[iX] = *(oFirstEnum.panPolyIdMap + panThisLineId[iX]).
+                //       so the this expression becomes: panThisFinalId[iX] = *(oFirstEnum.panPolyIdMap + panThisLineId[iX]).
                 //       This would eliminate the condition checking.
-                panLastLineId[iX] =
+                panThisFinalId[iX] =
                     panThisLineId[iX] == -1
                         ? -1
                         : oFirstEnum.panPolyIdMap[panThisLineId[iX]];
             }
 
-            oPolygonizer.processLine(panLastLineId, panLastLineVal,
-                                     paoThisLineArm, paoLastLineArm, iY,
-                                     nXSize);
-            eErr = oPolygonWriter.getErr();
-        }
-        else
-        {
-            oPolygonizer.processLine(panThisLineId, panLastLineVal,
-                                     paoThisLineArm, paoLastLineArm, iY,
-                                     nXSize);
-            eErr = oPolygonWriter.getErr();
+            if (iY == iYStart && panFirstLineFinalId)
+                panFirstLineFinalId->assign(panThisFinalId,
+                                            panThisFinalId + nXSize);
+            if (iY == iYEnd - 1 && panLastLineFinalId)
+                panLastLineFinalId->assign(panThisFinalId,
+                                           panThisFinalId + nXSize);
         }
 
+        if (ppanLastLineFinalId)
+            *ppanLastLineFinalId = panLastFinalId;
+        oPolygonizer.processLine(panThisFinalId, panLastLineVal,
+                                 paoThisLineArm, paoLastLineArm, iY, nXSize);
+        eErr = oReceiver.getErr();
+
         if (eErr != CE_None)
             continue;
 
@@ -360,6 +308,7 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
          */
         std::swap(panLastLineVal, panThisLineVal);
         std::swap(panLastLineId, panThisLineId);
+        std::swap(panLastFinalId, panThisFinalId);
         std::swap(paoThisLineArm, paoLastLineArm);
 
         /* --------------------------------------------------------------------
@@ -367,7 +316,9 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         /*      Report progress, and support interrupts. */
         /* --------------------------------------------------------------------
          */
-        if (!pfnProgress(0.10 + 0.90 * ((iY + 1) / static_cast<double>(nYSize)),
+        if (pfnProgress &&
+            !pfnProgress(0.10 + 0.90 * ((iY - iYStart + 1) /
+                                        static_cast<double>(nLines)),
                          "", pProgressArg))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -378,12 +329,922 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
     /* -------------------------------------------------------------------- */
     /*      Cleanup                                                         */
     /* -------------------------------------------------------------------- */
+    CPLFree(panThisFinalId);
+    CPLFree(panLastFinalId);
     CPLFree(panThisLineId);
     CPLFree(panLastLineId);
     CPLFree(panThisLineVal);
     CPLFree(panLastLineVal);
     CPLFree(paoThisLineArm);
     CPLFree(paoLastLineArm);
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                         GPGetPolygonRings()                          */
+/************************************************************************/
+
+// Return the rings of a raster polygon, in the same order and with the same
+// vertices as OGRPolygonWriter, but without the closing vertex.
+static void GPGetPolygonRings(const RPolygon &oPolygon,
+                              std::vector<Arc> &aoRings)
+{
+    std::vector<bool> oAccessedArc(oPolygon.oArcConnections.size(), false);
+    for (std::size_t iFirstArcIndex = 0; iFirstArcIndex < oAccessedArc.size();
+         ++iFirstArcIndex)
+    {
+        if (oAccessedArc[iFirstArcIndex])
+            continue;
+        aoRings.emplace_back();
+        Arc &oRing = aoRings.back();
+        std::size_t iArcIndex = iFirstArcIndex;
+        do
+        {
+            const Arc &oArc = *(oPolygon.oArcs[iArcIndex]);
+            if (oPolygon.oArcRighthandFollow[iArcIndex])
+                oRing.insert(oRing.end(), oArc.begin(), oArc.end());
+            else
+                oRing.insert(oRing.end(), oArc.rbegin(), oArc.rend());
+            oAccessedArc[iArcIndex] = true;
+            iArcIndex = oPolygon.oArcConnections[iArcIndex];
+        } while (iArcIndex != iFirstArcIndex);
+    }
+}
+
+/************************************************************************/
+/*                        GPRingsToOGRPolygon()                         */
+/************************************************************************/
+
+static OGRGeometryH GPRingsToOGRPolygon(const std::vector<Arc> &aoRings,
+                                        const double *padfGeoTransform)
+{
+    OGRGeometryH hPolygon = OGR_G_CreateGeometry(wkbPolygon);
+    for (const Arc &oRing : aoRings)
+    {
+        OGRGeometryH hRing = OGR_G_CreateGeometry(wkbLinearRing);
+        for (const Point &oPixel : oRing)
+        {
+            const double dfX = padfGeoTransform[0] +
+                               oPixel[1] * padfGeoTransform[1] +
+                               oPixel[0] * padfGeoTransform[2];
+            const double dfY = padfGeoTransform[3] +
+                               oPixel[1] * padfGeoTransform[4] +
+                               oPixel[0] * padfGeoTransform[5];
+            OGR_G_AddPoint_2D(hRing, dfX, dfY);
+        }
+        // close ring manually
+        OGR_G_AddPoint_2D(hRing, OGR_G_GetX(hRing, 0), OGR_G_GetY(hRing, 0));
+        OGR_G_AddGeometryDirectly(hPolygon, hRing);
+    }
+    return hPolygon;
+}
+
+/************************************************************************/
+/*                           GPWritePolygon()                           */
+/************************************************************************/
+
+// Write a polygon, whose ownership is taken, as a new feature.
+template <class DataType>
+static CPLErr GPWritePolygon(OGRLayerH hOutLayer, int iPixValField,
+                             OGRGeometryH hPolygon, DataType nValue)
+{
+    OGRFeatureH hFeat = OGR_F_Create(OGR_L_GetLayerDefn(hOutLayer));
+
+    OGR_F_SetGeometryDirectly(hFeat, hPolygon);
+
+    if (iPixValField >= 0)
+        OGR_F_SetFieldDouble(hFeat, iPixValField, static_cast<double>(nValue));
+
+    const CPLErr eErr =
+        OGR_L_CreateFeature(hOutLayer, hFeat) == OGRERR_NONE ? CE_None
+                                                             : CE_Failure;
+    OGR_F_Destroy(hFeat);
+    return eErr;
+}
+
+/************************************************************************/
+/*                         GPMergeSeamPieces()                          */
+/************************************************************************/
+
+// Signed area, in (column, line) space, of a ring.
+static double GPRingSignedArea(const Arc &oRing)
+{
+    double dfArea = 0;
+    for (std::size_t i = 0; i < oRing.size(); ++i)
+    {
+        const Point &a = oRing[i];
+        const Point &b = oRing[(i + 1) % oRing.size()];
+        dfArea += static_cast<double>(a[1]) * b[0] -
+                  static_cast<double>(b[1]) * a[0];
+    }
+    return dfArea / 2;
+}
+
+// Merge the rings of pieces of a polygon that were traced in different
+// strips into the rings of a single polygon. Horizontal edges on seam lines
+// (multiples of nStripLines) shared by two pieces cancel out, and the
+// remaining edges are linked again into rings.
+static bool
+GPMergeSeamPieces(const std::vector<const std::vector<Arc> *> &apoRings,
+                  int nConnectedness, int nStripLines, int nYSize,
+                  std::vector<Arc> &aoRingsOut)
+{
+    struct Edge
+    {
+        Point oStart;
+        Point oEnd;
+        bool bUsed;
+    };
+
+    std::vector<Edge> aoEdges;
+    // Unit edges on seam lines, indexed by their line and leftmost column
+    std::map<std::pair<IndexType, IndexType>, std::size_t> oMapSeamEdges;
+    const auto IsSeamLine = [nStripLines, nYSize](IndexType iRow)
+    {
+        return iRow > 0 && iRow < static_cast<IndexType>(nYSize) &&
+               (iRow % nStripLines) == 0;
+    };
+
+    for (const auto *paoRings : apoRings)
+    {
+        for (const Arc &oRing : *paoRings)
+        {
+            for (std::size_t i = 0; i < oRing.size(); ++i)
+            {
+                const Point &a = oRing[i];
+                const Point &b = oRing[(i + 1) % oRing.size()];
+                if (a == b)
+                    continue;
+                if (a[0] != b[0] || !IsSeamLine(a[0]))
+                {
+                    aoEdges.push_back(Edge{a, b, false});
+                    continue;
+                }
+                const bool bRight = b[1] > a[1];
+                for (IndexType iCol = a[1]; iCol != b[1];)
+                {
+                    const IndexType iNextCol = bRight ? iCol + 1 : iCol - 1;
+                    const auto oKey =
+                        std::make_pair(a[0], std::min(iCol, iNextCol));
+                    const auto oIter = oMapSeamEdges.find(oKey);
+                    if (oIter != oMapSeamEdges.end() &&
+                        !aoEdges[oIter->second].bUsed &&
+                        aoEdges[oIter->second].oStart ==
+                            Point{a[0], iNextCol})
+                    {
+                        // Shared by two pieces: cancel out.
+                        aoEdges[oIter->second].bUsed = true;
+                    }
+                    else
+                    {
+                        oMapSeamEdges[oKey] = aoEdges.size();
+                        aoEdges.push_back(Edge{Point{a[0], iCol},
+                                               Point{a[0], iNextCol}, false});
+                    }
+                    iCol = iNextCol;
+                }
+            }
+        }
+    }
+
+    std::multimap<Point, std::size_t> oMapEdgesFromVertex;
+    for (std::size_t i = 0; i < aoEdges.size(); ++i)
+    {
+        if (!aoEdges[i].bUsed)
+            oMapEdgesFromVertex.emplace(aoEdges[i].oStart, i);
+    }
+
+    // All rings have the polygon on the same side: the one of the exterior
+    // ring of the first piece. When leaving a vertex through which the
+    // boundary passes twice, polygons with 8-connectedness take the turn
+    // away from the polygon, so that pixels only touching by a corner stay
+    // in the same ring, and polygons with 4-connectedness the turn towards
+    // it.
+    const bool bPolygonOnLeft =
+        !apoRings.empty() && !apoRings[0]->empty() &&
+        GPRingSignedArea((*apoRings[0])[0]) > 0;
+    const bool bPreferRightTurn = bPolygonOnLeft == (nConnectedness == 8);
+
+    for (std::size_t iFirst = 0; iFirst < aoEdges.size(); ++iFirst)
+    {
+        if (aoEdges[iFirst].bUsed)
+            continue;
+        Arc oRing;
+        std::size_t iCur = iFirst;
+        while (true)
+        {
+            Edge &oEdge = aoEdges[iCur];
+            oEdge.bUsed = true;
+            oRing.push_back(oEdge.oStart);
+            const double dfInX =
+                static_cast<double>(oEdge.oEnd[1]) - oEdge.oStart[1];
+            const double dfInY =
+                static_cast<double>(oEdge.oEnd[0]) - oEdge.oStart[0];
+
+            std::size_t iNext = aoEdges.size();
+            double dfBestCross = 0;
+            const auto oRange = oMapEdgesFromVertex.equal_range(oEdge.oEnd);
+            for (auto oIter = oRange.first; oIter != oRange.second; ++oIter)
+            {
+                const Edge &oCandidate = aoEdges[oIter->second];
+                if (oCandidate.bUsed && oIter->second != iFirst)
+                    continue;
+                const double dfOutX = static_cast<double>(oCandidate.oEnd[1]) -
+                                      oCandidate.oStart[1];
+                const double dfOutY = static_cast<double>(oCandidate.oEnd[0]) -
+                                      oCandidate.oStart[0];
+                double dfCross = dfInX * dfOutY - dfInY * dfOutX;
+                if (bPreferRightTurn)
+                    dfCross = -dfCross;
+                if (iNext == aoEdges.size() || dfCross > dfBestCross)
+                {
+                    iNext = oIter->second;
+                    dfBestCross = dfCross;
+                }
+            }
+            if (iNext == aoEdges.size())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "GDALPolygonize(): cannot merge polygon pieces "
+                         "across strips");
+                return false;
+            }
+            if (iNext == iFirst)
+                break;
+            iCur = iNext;
+        }
+
+        // Remove vertices in the middle of straight runs.
+        const auto IsCollinear = [](const Point &a, const Point &b,
+                                    const Point &c)
+        {
+            return (a[0] == b[0] && b[0] == c[0]) ||
+                   (a[1] == b[1] && b[1] == c[1]);
+        };
+        Arc oSimplified;
+        for (const Point &oPoint : oRing)
+        {
+            while (oSimplified.size() >= 2 &&
+                   IsCollinear(oSimplified[oSimplified.size() - 2],
+                               oSimplified.back(), oPoint))
+            {
+                oSimplified.pop_back();
+            }
+            oSimplified.push_back(oPoint);
+        }
+        std::size_t iStart = 0;
+        while (oSimplified.size() - iStart >= 3)
+        {
+            if (IsCollinear(oSimplified[oSimplified.size() - 2],
+                            oSimplified.back(), oSimplified[iStart]))
+                oSimplified.pop_back();
+            else if (IsCollinear(oSimplified.back(), oSimplified[iStart],
+                                 oSimplified[iStart + 1]))
+                ++iStart;
+            else
+                break;
+        }
+        aoRingsOut.emplace_back(oSimplified.begin() + iStart,
+                                oSimplified.end());
+    }
+
+    // Put the exterior ring first.
+    std::size_t iExterior = 0;
+    double dfMaxArea = 0;
+    for (std::size_t i = 0; i < aoRingsOut.size(); ++i)
+    {
+        const double dfArea = std::fabs(GPRingSignedArea(aoRingsOut[i]));
+        if (dfArea > dfMaxArea)
+        {
+            dfMaxArea = dfArea;
+            iExterior = i;
+        }
+    }
+    if (iExterior != 0)
+        std::swap(aoRingsOut[0], aoRingsOut[iExterior]);
+
+    return true;
+}
+
+/************************************************************************/
+/*                          GPPolygonizeMT()                            */
+/************************************************************************/
+
+namespace
+{
+
+// Part of a polygon traced in a strip that touches the line above or below
+// the strip, and might continue in the neighbouring strip.
+template <class DataType> struct GPSeamPiece
+{
+    std::vector<Arc> aoRings{};
+    DataType nValue{};
+    IndexType iBottomRightRow = 0;
+    IndexType iBottomRightCol = 0;
+    bool bTouchesBottom = false;
+};
+
+template <class DataType> struct GPStrip
+{
+    std::mutex *poMutex = nullptr;
+    std::condition_variable *poCV = nullptr;
+    const double *padfGeoTransform = nullptr;
+    int nXSize = 0;
+    int nYSize = 0;
+    int nConnectedness = 4;
+    int iYStart = 0;
+    int iYEnd = 0;
+    // Pixel values, with GP_NODATA_MARKER for masked pixels
+    std::vector<DataType> anVal{};
+
+    CPLErr eErr = CE_None;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    // Polygons that do not reach the line above or below the strip
+    std::vector<std::pair<OGRGeometryH, DataType>> aoPolygons{};
+    std::vector<GPSeamPiece<DataType>> aoSeamPieces{};
+    // Final polygon id in the strip to index in aoSeamPieces
+    std::map<GInt32, std::size_t> oMapIdToSeamPiece{};
+    // Final polygon ids of the first and last lines of the strip
+    std::vector<GInt32> anFirstLineId{};
+    std::vector<GInt32> anLastLineId{};
+    bool bDone = false;  // protected by *poMutex
+
+    GPStrip() = default;
+    GPStrip(const GPStrip &) = delete;
+    GPStrip &operator=(const GPStrip &) = delete;
+
+    ~GPStrip()
+    {
+        Reset();
+    }
+
+    void Reset()
+    {
+        for (auto &oPolygon : aoPolygons)
+            OGR_G_DestroyGeometry(oPolygon.first);
+        aoPolygons.clear();
+        aoSeamPieces.clear();
+        oMapIdToSeamPiece.clear();
+        aoErrors.clear();
+        eErr = CE_None;
+        bDone = false;
+    }
+};
+
+// Receives the polygons traced in a strip.
+template <class DataType>
+class GPStripCollector final : public PolygonReceiver<DataType>
+{
+    GPStrip<DataType> &oStrip_;
+    CPLErr eErr_{CE_None};
+
+  public:
+    const GInt32 *panLastLineFinalId = nullptr;
+
+    explicit GPStripCollector(GPStrip<DataType> &oStrip) : oStrip_(oStrip)
+    {
+    }
+
+    GPStripCollector(const GPStripCollector &) = delete;
+    GPStripCollector &operator=(const GPStripCollector &) = delete;
+
+    void receive(RPolygon *poPolygon, DataType nPolygonCellValue) override
+    {
+        try
+        {
+            std::vector<Arc> aoRings;
+            GPGetPolygonRings(*poPolygon, aoRings);
+
+            bool bTouchesTop = false;
+            if (oStrip_.iYStart > 0)
+            {
+                const IndexType iTopRow =
+                    static_cast<IndexType>(oStrip_.iYStart);
+                for (const Arc &oRing : aoRings)
+                {
+                    for (const Point &oPoint : oRing)
+                    {
+                        if (oPoint[0] == iTopRow)
+                        {
+                            bTouchesTop = true;
+                            break;
+                        }
+                    }
+                }
+            }
+            const bool bTouchesBottom =
+                oStrip_.iYEnd < oStrip_.nYSize &&
+                poPolygon->iBottomRightRow + 1 ==
+                    static_cast<IndexType>(oStrip_.iYEnd);
+
+            if (!bTouchesTop && !bTouchesBottom)
+            {
+                oStrip_.aoPolygons.emplace_back(nullptr, nPolygonCellValue);
+                oStrip_.aoPolygons.back().first =
+                    GPRingsToOGRPolygon(aoRings, oStrip_.padfGeoTransform);
+                return;
+            }
+
+            const GInt32 nId = panLastLineFinalId[poPolygon->iBottomRightCol];
+            oStrip_.oMapIdToSeamPiece[nId] = oStrip_.aoSeamPieces.size();
+            oStrip_.aoSeamPieces.emplace_back();
+            auto &oPiece = oStrip_.aoSeamPieces.back();
+            oPiece.aoRings = std::move(aoRings);
+            oPiece.nValue = nPolygonCellValue;
+            oPiece.iBottomRightRow = poPolygon->iBottomRightRow;
+            oPiece.iBottomRightCol = poPolygon->iBottomRightCol;
+            oPiece.bTouchesBottom = bTouchesBottom;
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+            eErr_ = CE_Failure;
+        }
+    }
+
+    inline CPLErr getErr()
+    {
+        return eErr_;
+    }
+};
+
+// Joins, in the calling thread, the seam pieces of successive strips that
+// belong to the same polygon, and writes polygons once they are complete.
+template <class DataType, class EqualityTest> class GPSeamMerger
+{
+    OGRLayerH hOutLayer_;
+    int iPixValField_;
+    const double *padfGeoTransform_;
+    int nConnectedness_;
+    int nStripLines_;
+    int nYSize_;
+
+    // Union-find structure on all seam pieces seen so far
+    std::vector<GPSeamPiece<DataType>> aoPieces_{};
+    std::vector<std::size_t> anParent_{};
+    // For roots, the pieces of their set
+    std::vector<std::vector<std::size_t>> aanMembers_{};
+    std::vector<bool> abWritten_{};
+
+    // Last line of the previous strip
+    std::vector<GInt32> anPrevLastLineId_{};
+    std::vector<DataType> anPrevLastLineVal_{};
+    std::map<GInt32, std::size_t> oPrevMapIdToPiece_{};
+    std::size_t nPrevFirstPiece_ = 0;
+
+    std::size_t Find(std::size_t i)
+    {
+        while (anParent_[i] != i)
+        {
+            anParent_[i] = anParent_[anParent_[i]];
+            i = anParent_[i];
+        }
+        return i;
+    }
+
+    void Union(std::size_t i, std::size_t j)
+    {
+        i = Find(i);
+        j = Find(j);
+        if (i == j)
+            return;
+        if (aanMembers_[i].size() < aanMembers_[j].size())
+            std::swap(i, j);
+        anParent_[j] = i;
+        aanMembers_[i].insert(aanMembers_[i].end(), aanMembers_[j].begin(),
+                              aanMembers_[j].end());
+        aanMembers_[j].clear();
+    }
+
+    CPLErr WritePolygon(std::size_t iRoot)
+    {
+        const auto &anMembers = aanMembers_[iRoot];
+        // As in the sequential algorithm, the value of the polygon is the one
+        // of its bottom-right cell.
+        std::size_t iValuePiece = anMembers[0];
+        std::vector<const std::vector<Arc> *> apoRings;
+        for (std::size_t i : anMembers)
+        {
+            const auto &oPiece = aoPieces_[i];
+            const auto &oValuePiece = aoPieces_[iValuePiece];
+            if (oPiece.iBottomRightRow > oValuePiece.iBottomRightRow ||
+                (oPiece.iBottomRightRow == oValuePiece.iBottomRightRow &&
+                 oPiece.iBottomRightCol > oValuePiece.iBottomRightCol))
+                iValuePiece = i;
+            apoRings.push_back(&oPiece.aoRings);
+        }
+
+        OGRGeometryH hPolygon = nullptr;
+        if (anMembers.size() == 1)
+        {
+            hPolygon = GPRingsToOGRPolygon(aoPieces_[anMembers[0]].aoRings,
+                                           padfGeoTransform_);
+        }
+        else
+        {
+            std::vector<Arc> aoRings;
+            if (!GPMergeSeamPieces(apoRings, nConnectedness_, nStripLines_,
+                                   nYSize_, aoRings))
+                return CE_Failure;
+            hPolygon = GPRingsToOGRPolygon(aoRings, padfGeoTransform_);
+        }
+
+        const CPLErr eErr =
+            GPWritePolygon(hOutLayer_, iPixValField_, hPolygon,
+                           aoPieces_[iValuePiece].nValue);
+
+        for (std::size_t i : anMembers)
+            std::vector<Arc>().swap(aoPieces_[i].aoRings);
+        aanMembers_[iRoot].clear();
+        abWritten_[iRoot] = true;
+        return eErr;
+    }
+
+  public:
+    GPSeamMerger(const GPSeamMerger &) = delete;
+    GPSeamMerger &operator=(const GPSeamMerger &) = delete;
+
+    GPSeamMerger(OGRLayerH hOutLayer, int iPixValField,
+                 const double *padfGeoTransform, int nConnectedness,
+                 int nStripLines, int nYSize)
+        : hOutLayer_(hOutLayer), iPixValField_(iPixValField),
+          padfGeoTransform_(padfGeoTransform), nConnectedness_(nConnectedness),
+          nStripLines_(nStripLines), nYSize_(nYSize)
+    {
+    }
+
+    // Must be called for strips in order.
+    CPLErr AddStrip(GPStrip<DataType> &oStrip)
+    {
+        const std::size_t nFirstPiece = aoPieces_.size();
+        for (auto &oPiece : oStrip.aoSeamPieces)
+        {
+            anParent_.push_back(aoPieces_.size());
+            aanMembers_.push_back({aoPieces_.size()});
+            abWritten_.push_back(false);
+            aoPieces_.push_back(std::move(oPiece));
+        }
+
+        // Join pieces across the seam with the previous strip, with the
+        // same connectedness rules as GDALRasterPolygonEnumerator.
+        if (oStrip.iYStart > 0)
+        {
+            EqualityTest eq;
+            const int nXSize = oStrip.nXSize;
+            const DataType *panFirstLineVal = oStrip.anVal.data();
+            const auto Link = [&](int iXAbove, int iXBelow)
+            {
+                const GInt32 nIdAbove = anPrevLastLineId_[iXAbove];
+                const GInt32 nIdBelow = oStrip.anFirstLineId[iXBelow];
+                if (nIdAbove < 0 || nIdBelow < 0 ||
+                    !eq(anPrevLastLineVal_[iXAbove], panFirstLineVal[iXBelow]))
+                    return;
+                const auto oIterAbove = oPrevMapIdToPiece_.find(nIdAbove);
+                const auto oIterBelow = oStrip.oMapIdToSeamPiece.find(nIdBelow);
+                if (oIterAbove != oPrevMapIdToPiece_.end() &&
+                    oIterBelow != oStrip.oMapIdToSeamPiece.end())
+                {
+                    Union(oIterAbove->second, nFirstPiece + oIterBelow->second);
+                }
+            };
+            for (int iX = 0; iX < nXSize; ++iX)
+            {
+                Link(iX, iX);
+                if (nConnectedness_ == 8)
+                {
+                    if (iX > 0)
+                        Link(iX - 1, iX);
+                    if (iX + 1 < nXSize)
+                        Link(iX + 1, iX);
+                }
+            }
+        }
+
+        // Write polygons that do not reach the bottom of this strip.
+        std::set<std::size_t> oOpenRoots;
+        for (std::size_t i = nFirstPiece; i < aoPieces_.size(); ++i)
+        {
+            if (aoPieces_[i].bTouchesBottom)
+                oOpenRoots.insert(Find(i));
+        }
+        for (std::size_t i = nPrevFirstPiece_; i < aoPieces_.size(); ++i)
+        {
+            const std::size_t iRoot = Find(i);
+            if (!abWritten_[iRoot] && oOpenRoots.count(iRoot) == 0)
+            {
+                const CPLErr eErr = WritePolygon(iRoot);
+                if (eErr != CE_None)
+                    return eErr;
+            }
+        }
+
+        anPrevLastLineId_ = std::move(oStrip.anLastLineId);
+        anPrevLastLineVal_.assign(
+            oStrip.anVal.end() - oStrip.nXSize, oStrip.anVal.end());
+        oPrevMapIdToPiece_.clear();
+        for (const auto &oIter : oStrip.oMapIdToSeamPiece)
+            oPrevMapIdToPiece_[oIter.first] = nFirstPiece + oIter.second;
+        nPrevFirstPiece_ = nFirstPiece;
+        return CE_None;
+    }
+};
+
+}  // namespace
+
+template <class DataType, class EqualityTest>
+static void GPPolygonizeStripJob(void *pData)
+{
+    auto psStrip = static_cast<GPStrip<DataType> *>(pData);
+    const int nXSize = psStrip->nXSize;
+
+    CPLInstallErrorHandlerAccumulator(psStrip->aoErrors);
+    GPStripCollector<DataType> oCollector(*psStrip);
+    const DataType *panVal = psStrip->anVal.data();
+    const int iYStart = psStrip->iYStart;
+    psStrip->eErr = GPPolygonizeLines<DataType, EqualityTest>(
+        [panVal, iYStart, nXSize](int iY, DataType *panLine)
+        {
+            memcpy(panLine,
+                   panVal + static_cast<size_t>(iY - iYStart) * nXSize,
+                   sizeof(DataType) * nXSize);
+            return CE_None;
+        },
+        nXSize, psStrip->iYStart, psStrip->iYEnd, psStrip->nConnectedness,
+        oCollector, &oCollector.panLastLineFinalId, &psStrip->anFirstLineId,
+        &psStrip->anLastLineId, nullptr, nullptr);
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(*(psStrip->poMutex));
+    psStrip->bDone = true;
+    psStrip->poCV->notify_all();
+}
+
+// Polygonize strips of lines in worker threads. Polygons that cross strip
+// boundaries are assembled and written, as well as all other polygons, from
+// the calling thread, which also does all raster reads.
+template <class DataType, class EqualityTest>
+static CPLErr GPPolygonizeMT(GDALRasterBandH hSrcBand,
+                             GDALRasterBandH hMaskBand, OGRLayerH hOutLayer,
+                             int iPixValField, int nConnectedness,
+                             const double *padfGeoTransform, GDALDataType eDT,
+                             CPLJobQueue *poJobQueue, int nThreads,
+                             GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    // Strips of at most about 4 million pixels, and enough of them to keep
+    // all threads busy.
+    const int nStripLines = std::max(
+        1, std::min((4 * 1024 * 1024) / nXSize,
+                    (nYSize + 2 * nThreads - 1) / (2 * nThreads)));
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::vector<std::unique_ptr<GPStrip<DataType>>> apoFreeStrips;
+    for (int i = 0; i < 2 * nThreads; ++i)
+    {
+        auto poStrip = std::make_unique<GPStrip<DataType>>();
+        poStrip->poMutex = &oMutex;
+        poStrip->poCV = &oCV;
+        poStrip->padfGeoTransform = padfGeoTransform;
+        poStrip->nXSize = nXSize;
+        poStrip->nYSize = nYSize;
+        poStrip->nConnectedness = nConnectedness;
+        apoFreeStrips.push_back(std::move(poStrip));
+    }
+    std::deque<std::unique_ptr<GPStrip<DataType>>> apoPendingStrips;
+
+    GPSeamMerger<DataType, EqualityTest> oMerger(
+        hOutLayer, iPixValField, padfGeoTransform, nConnectedness, nStripLines,
+        nYSize);
+
+    // Wait for the oldest submitted strip and write its polygons
+    const auto WriteOldestStrip = [&]()
+    {
+        auto poStrip = std::move(apoPendingStrips.front());
+        apoPendingStrips.pop_front();
+        {
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock, [&poStrip] { return poStrip->bDone; });
+        }
+        for (const auto &oError : poStrip->aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        CPLErr eErr = poStrip->eErr;
+        for (auto &oPolygon : poStrip->aoPolygons)
+        {
+            OGRGeometryH hPolygon = oPolygon.first;
+            oPolygon.first = nullptr;
+            if (eErr == CE_None)
+                eErr = GPWritePolygon(hOutLayer, iPixValField, hPolygon,
+                                      oPolygon.second);
+            else
+                OGR_G_DestroyGeometry(hPolygon);
+        }
+        poStrip->aoPolygons.clear();
+        if (eErr == CE_None)
+            eErr = oMerger.AddStrip(*poStrip);
+        if (eErr == CE_None &&
+            !pfnProgress(static_cast<double>(poStrip->iYEnd) / nYSize, "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+        poStrip->Reset();
+        apoFreeStrips.push_back(std::move(poStrip));
+        return eErr;
+    };
+
+    std::vector<GByte> abyMask;
+    CPLErr eErr = CE_None;
+    for (int iYStart = 0; eErr == CE_None && iYStart < nYSize;)
+    {
+        if (apoFreeStrips.empty())
+        {
+            eErr = WriteOldestStrip();
+            continue;
+        }
+        auto poStrip = std::move(apoFreeStrips.back());
+        apoFreeStrips.pop_back();
+        poStrip->iYStart = iYStart;
+        poStrip->iYEnd = std::min(iYStart + nStripLines, nYSize);
+        const int nLines = poStrip->iYEnd - iYStart;
+        const size_t nPixels = static_cast<size_t>(nLines) * nXSize;
+        try
+        {
+            poStrip->anVal.resize(nPixels);
+            if (hMaskBand)
+                abyMask.resize(nPixels);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate strip buffers");
+            eErr = CE_Failure;
+            break;
+        }
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iYStart, nXSize, nLines,
+                            poStrip->anVal.data(), nXSize, nLines, eDT, 0, 0);
+        if (eErr == CE_None && hMaskBand)
+        {
+            eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iYStart, nXSize, nLines,
+                                abyMask.data(), nXSize, nLines, GDT_Byte, 0, 0);
+            for (size_t i = 0; eErr == CE_None && i < nPixels; ++i)
+            {
+                if (abyMask[i] == 0)
+                    poStrip->anVal[i] = GP_NODATA_MARKER;
+            }
+        }
+        if (eErr != CE_None)
+            break;
+        iYStart = poStrip->iYEnd;
+        auto psStrip = poStrip.get();
+        apoPendingStrips.push_back(std::move(poStrip));
+        poJobQueue->SubmitJob(GPPolygonizeStripJob<DataType, EqualityTest>,
+                              psStrip);
+    }
+
+    while (!apoPendingStrips.empty())
+    {
+        if (eErr == CE_None)
+        {
+            eErr = WriteOldestStrip();
+        }
+        else
+        {
+            // Only wait for the jobs that reference the strips
+            poJobQueue->WaitCompletion();
+            apoPendingStrips.clear();
+        }
+    }
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                           GDALPolygonizeT()                          */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
+                              GDALRasterBandH hMaskBand, OGRLayerH hOutLayer,
+                              int iPixValField, char **papszOptions,
+                              GDALProgressFunc pfnProgress, void *pProgressArg,
+                              GDALDataType eDT)
+
+{
+    VALIDATE_POINTER1(hSrcBand, "GDALPolygonize", CE_Failure);
+    VALIDATE_POINTER1(hOutLayer, "GDALPolygonize", CE_Failure);
+
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    const int nConnectedness =
+        CSLFetchNameValue(papszOptions, "8CONNECTED") ? 8 : 4;
+
+    /* -------------------------------------------------------------------- */
+    /*      Confirm our output layer will support feature creation.         */
+    /* -------------------------------------------------------------------- */
+    if (!OGR_L_TestCapability(hOutLayer, OLCSequentialWrite))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Output feature layer does not appear to support creation "
+                 "of features in GDALPolygonize().");
+        return CE_Failure;
+    }
+
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+    if (nXSize > std::numeric_limits<int>::max() - 2)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Too wide raster");
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Get the geotransform, if there is one, so we can convert the    */
+    /*      vectors into georeferenced coordinates.                         */
+    /* -------------------------------------------------------------------- */
+    double adfGeoTransform[6] = {0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+    bool bGotGeoTransform = false;
+    const char *pszDatasetForGeoRef =
+        CSLFetchNameValue(papszOptions, "DATASET_FOR_GEOREF");
+    if (pszDatasetForGeoRef)
+    {
+        GDALDatasetH hSrcDS = GDALOpen(pszDatasetForGeoRef, GA_ReadOnly);
+        if (hSrcDS)
+        {
+            bGotGeoTransform =
+                GDALGetGeoTransform(hSrcDS, adfGeoTransform) == CE_None;
+            GDALClose(hSrcDS);
+        }
+    }
+    else
+    {
+        GDALDatasetH hSrcDS = GDALGetBandDataset(hSrcBand);
+        if (hSrcDS)
+            bGotGeoTransform =
+                GDALGetGeoTransform(hSrcDS, adfGeoTransform) == CE_None;
+    }
+    if (!bGotGeoTransform)
+    {
+        adfGeoTransform[0] = 0;
+        adfGeoTransform[1] = 1;
+        adfGeoTransform[2] = 0;
+        adfGeoTransform[3] = 0;
+        adfGeoTransform[4] = 0;
+        adfGeoTransform[5] = 1;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Use worker threads on strips of lines if asked to.              */
+    /* -------------------------------------------------------------------- */
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads)));
+    if (nThreads > 1 && nYSize > 1 && nXSize > 0)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        auto poJobQueue =
+            poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+        if (poJobQueue)
+        {
+            return GPPolygonizeMT<DataType, EqualityTest>(
+                hSrcBand, hMaskBand, hOutLayer, iPixValField, nConnectedness,
+                adfGeoTransform, eDT, poJobQueue.get(), nThreads, pfnProgress,
+                pProgressArg);
+        }
+    }
+
+    GByte *pabyMaskLine =
+        hMaskBand ? static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize)) : nullptr;
+    if (hMaskBand && pabyMaskLine == nullptr)
+        return CE_Failure;
+
+    OGRPolygonWriter<DataType> oPolygonWriter{hOutLayer, iPixValField,
+                                              adfGeoTransform};
+    const CPLErr eErr = GPPolygonizeLines<DataType, EqualityTest>(
+        [hSrcBand, hMaskBand, pabyMaskLine, nXSize,
+         eDT](int iY, DataType *panLine)
+        {
+            CPLErr eErrLine = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1,
+                                           panLine, nXSize, 1, eDT, 0, 0);
+            if (eErrLine == CE_None && hMaskBand != nullptr)
+                eErrLine = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
+                                           panLine);
+            return eErrLine;
+        },
+        nXSize, 0, nYSize, nConnectedness, oPolygonWriter, nullptr, nullptr,
+        nullptr, pfnProgress, pProgressArg);
+
     CPLFree(pabyMaskLine);
 
     return eErr;
@@ -491,6 +1352,11 @@ GBool GDALFloatEquals(float A, float B)
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number_of_threads|ALL_CPUS: (GDAL >= 3.10) Number of threads
+ * to use. Defaults to the value of the GDAL_NUM_THREADS configuration option,
+ * or 1. With several threads, strips of lines are polygonized in parallel,
+ * and polygons crossing strip boundaries are merged afterwards. Features are
+ * then not written in the same order as with a single thread.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -565,6 +1431,11 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number_of_threads|ALL_CPUS: (GDAL >= 3.10) Number of threads
+ * to use. Defaults to the value of the GDAL_NUM_THREADS configuration option,
+ * or 1. With several threads, strips of lines are polygonized in parallel,
+ * and polygons crossing strip boundaries are merged afterwards. Features are
+ * then not written in the same order as with a single thread.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -35,16 +35,20 @@
 #include <cstring>
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALFilterLine()                           */
@@ -360,6 +364,344 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
     }
 }
 
+/************************************************************************/
+/*                        GDALFillNodataPullPush()                      */
+/*                                                                      */
+/*      Fill pixels with the pull-push algorithm (Gortler et al., "The  */
+/*      Lumigraph"): "pull" builds a pyramid where each pixel is the    */
+/*      weighted average of its four children, and the weight their     */
+/*      sum clamped to 1, then "push" goes back down the pyramid, and   */
+/*      completes each pixel whose weight is lower than 1 with the      */
+/*      bilinear interpolation of the coarser level.  The cost is       */
+/*      linear in the number of pixels, whatever the size of the holes. */
+/*      The whole raster is kept in memory.                             */
+/************************************************************************/
+
+namespace
+{
+struct GDALFillLevel
+{
+    int nXSize = 0;
+    int nYSize = 0;
+    std::vector<float> afValue{};
+    std::vector<float> afWeight{};
+};
+}  // namespace
+
+static CPLErr GDALFillNodataPullPush(GDALRasterBandH hTargetBand,
+                                     GDALRasterBandH hMaskBand,
+                                     bool bUpdateMask,
+                                     GDALRasterBandH hFiltMaskBand,
+                                     int nMaxLevels, bool bHasNoData,
+                                     float fNoData, int nThreads,
+                                     GDALProgressFunc pfnProgress,
+                                     void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+    const int nJobs = poJobQueue ? nThreads : 1;
+
+    // Pixel status of the full resolution level
+    constexpr GByte PIXEL_TO_FILL = 0;
+    constexpr GByte PIXEL_VALID = 1;
+    constexpr GByte PIXEL_NODATA = 2;
+
+    std::vector<GDALFillLevel> aoLevels;
+    std::vector<GByte> abyStatus;
+    try
+    {
+        aoLevels.resize(1);
+        aoLevels[0].nXSize = nXSize;
+        aoLevels[0].nYSize = nYSize;
+        const size_t nPixels = static_cast<size_t>(nXSize) * nYSize;
+        aoLevels[0].afValue.resize(nPixels);
+        aoLevels[0].afWeight.resize(nPixels);
+        abyStatus.resize(nPixels);
+        while (static_cast<int>(aoLevels.size()) <= nMaxLevels &&
+               (aoLevels.back().nXSize > 1 || aoLevels.back().nYSize > 1))
+        {
+            GDALFillLevel oLevel;
+            oLevel.nXSize = (aoLevels.back().nXSize + 1) / 2;
+            oLevel.nYSize = (aoLevels.back().nYSize + 1) / 2;
+            const size_t nLevelPixels =
+                static_cast<size_t>(oLevel.nXSize) * oLevel.nYSize;
+            oLevel.afValue.resize(nLevelPixels);
+            oLevel.afWeight.resize(nLevelPixels);
+            aoLevels.push_back(std::move(oLevel));
+        }
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate pull-push pyramid");
+        return CE_Failure;
+    }
+
+    const int nStripLines =
+        std::max(1, std::min(nYSize, (1024 * 1024) / std::max(1, nXSize)));
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the raster and its mask.                                   */
+    /* -------------------------------------------------------------------- */
+    CPLErr eErr = CE_None;
+    for (int iY = 0; eErr == CE_None && iY < nYSize; iY += nStripLines)
+    {
+        const int nLines = std::min(nStripLines, nYSize - iY);
+        const size_t nOffset = static_cast<size_t>(iY) * nXSize;
+        float *pafValue = aoLevels[0].afValue.data() + nOffset;
+        GByte *pabyStatus = abyStatus.data() + nOffset;
+        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iY, nXSize, nLines,
+                            pafValue, nXSize, nLines, GDT_Float32, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, nLines,
+                                pabyStatus, nXSize, nLines, GDT_Byte, 0, 0);
+        if (eErr != CE_None)
+            break;
+
+        float *pafWeight = aoLevels[0].afWeight.data() + nOffset;
+        const size_t nPixels = static_cast<size_t>(nLines) * nXSize;
+        for (size_t i = 0; i < nPixels; ++i)
+        {
+            if (pabyStatus[i] == 0)
+                pabyStatus[i] = PIXEL_TO_FILL;
+            else if (bHasNoData && pafValue[i] == fNoData)
+                pabyStatus[i] = PIXEL_NODATA;
+            else
+                pabyStatus[i] = PIXEL_VALID;
+            pafWeight[i] = pabyStatus[i] == PIXEL_VALID ? 1.0f : 0.0f;
+        }
+
+        if (!pfnProgress(0.2 * (iY + nLines) / nYSize, "Filling...",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+    if (eErr != CE_None)
+        return eErr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Pull: build the pyramid of weighted averages.                   */
+    /* -------------------------------------------------------------------- */
+    for (size_t iLevel = 1; iLevel < aoLevels.size(); ++iLevel)
+    {
+        const GDALFillLevel &oFine = aoLevels[iLevel - 1];
+        GDALFillLevel &oCoarse = aoLevels[iLevel];
+        // Not worth the synchronization cost on small levels
+        CPLJobQueueRunRanges(
+            poJobQueue.get(), std::min(nJobs, oCoarse.nYSize / 2),
+            oCoarse.nYSize,
+            [&oFine, &oCoarse](int, int iYStart, int iYEnd)
+            {
+                for (int iY = iYStart; iY < iYEnd; ++iY)
+                {
+                    for (int iX = 0; iX < oCoarse.nXSize; ++iX)
+                    {
+                        double dfWeightSum = 0;
+                        double dfValueSum = 0;
+                        for (int iYFine = 2 * iY;
+                             iYFine < std::min(2 * iY + 2, oFine.nYSize);
+                             ++iYFine)
+                        {
+                            for (int iXFine = 2 * iX;
+                                 iXFine < std::min(2 * iX + 2, oFine.nXSize);
+                                 ++iXFine)
+                            {
+                                const size_t iFine =
+                                    static_cast<size_t>(iYFine) *
+                                        oFine.nXSize +
+                                    iXFine;
+                                const float fWeight = oFine.afWeight[iFine];
+                                if (fWeight > 0)
+                                {
+                                    dfWeightSum += fWeight;
+                                    dfValueSum +=
+                                        fWeight * double(oFine.afValue[iFine]);
+                                }
+                            }
+                        }
+                        const size_t iCoarse =
+                            static_cast<size_t>(iY) * oCoarse.nXSize + iX;
+                        oCoarse.afWeight[iCoarse] =
+                            static_cast<float>(std::min(1.0, dfWeightSum));
+                        oCoarse.afValue[iCoarse] =
+                            dfWeightSum > 0
+                                ? static_cast<float>(dfValueSum / dfWeightSum)
+                                : 0.0f;
+                    }
+                }
+            });
+
+        if (!pfnProgress(0.2 + 0.3 * iLevel / aoLevels.size(), "Filling...",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Push: complete each level from the coarser one.                 */
+    /* -------------------------------------------------------------------- */
+    for (size_t iLevel = aoLevels.size() - 1; iLevel > 0; --iLevel)
+    {
+        const GDALFillLevel &oCoarse = aoLevels[iLevel];
+        GDALFillLevel &oFine = aoLevels[iLevel - 1];
+        // Not worth the synchronization cost on small levels
+        CPLJobQueueRunRanges(
+            poJobQueue.get(), std::min(nJobs, oFine.nYSize / 2), oFine.nYSize,
+            [&oFine, &oCoarse](int, int iYStart, int iYEnd)
+            {
+                for (int iY = iYStart; iY < iYEnd; ++iY)
+                {
+                    // Position of the center of the pixel in the coarser
+                    // level, relatively to the centers of its pixels.
+                    const double dfYCoarse = iY * 0.5 - 0.25;
+                    const int iY0 = static_cast<int>(std::floor(dfYCoarse));
+                    const double dfFracY = dfYCoarse - iY0;
+                    const int iYCoarse0 = std::max(iY0, 0);
+                    const int iYCoarse1 = std::min(iY0 + 1, oCoarse.nYSize - 1);
+                    for (int iX = 0; iX < oFine.nXSize; ++iX)
+                    {
+                        const size_t iFine =
+                            static_cast<size_t>(iY) * oFine.nXSize + iX;
+                        const float fWeight = oFine.afWeight[iFine];
+                        if (fWeight >= 1.0f)
+                            continue;
+
+                        const double dfXCoarse = iX * 0.5 - 0.25;
+                        const int iX0 = static_cast<int>(std::floor(dfXCoarse));
+                        const double dfFracX = dfXCoarse - iX0;
+                        const int iXCoarse0 = std::max(iX0, 0);
+                        const int iXCoarse1 =
+                            std::min(iX0 + 1, oCoarse.nXSize - 1);
+
+                        double dfWeightSum = 0;
+                        double dfValueSum = 0;
+                        const auto Add = [&oCoarse, &dfWeightSum, &dfValueSum](
+                                             int iXC, int iYC, double dfW)
+                        {
+                            const size_t iCoarse =
+                                static_cast<size_t>(iYC) * oCoarse.nXSize + iXC;
+                            if (oCoarse.afWeight[iCoarse] > 0)
+                            {
+                                dfWeightSum += dfW;
+                                dfValueSum +=
+                                    dfW * double(oCoarse.afValue[iCoarse]);
+                            }
+                        };
+                        Add(iXCoarse0, iYCoarse0,
+                            (1 - dfFracX) * (1 - dfFracY));
+                        Add(iXCoarse1, iYCoarse0, dfFracX * (1 - dfFracY));
+                        Add(iXCoarse0, iYCoarse1, (1 - dfFracX) * dfFracY);
+                        Add(iXCoarse1, iYCoarse1, dfFracX * dfFracY);
+
+                        if (dfWeightSum > 0)
+                        {
+                            const double dfCoarseValue =
+                                dfValueSum / dfWeightSum;
+                            oFine.afValue[iFine] = static_cast<float>(
+                                (fWeight > 0 ? fWeight * oFine.afValue[iFine]
+                                             : 0.0) +
+                                (1 - fWeight) * dfCoarseValue);
+                            oFine.afWeight[iFine] = 1.0f;
+                        }
+                        else if (fWeight > 0)
+                        {
+                            oFine.afWeight[iFine] = 1.0f;
+                        }
+                    }
+                }
+            });
+
+        if (!pfnProgress(0.5 + 0.3 * (aoLevels.size() - iLevel) /
+                                   aoLevels.size(),
+                         "Filling...", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Write the filled pixels, and the updated masks.                 */
+    /* -------------------------------------------------------------------- */
+    std::vector<GByte> abyMask;
+    try
+    {
+        abyMask.resize(static_cast<size_t>(nStripLines) * nXSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate mask buffer");
+        return CE_Failure;
+    }
+
+    for (int iY = 0; eErr == CE_None && iY < nYSize; iY += nStripLines)
+    {
+        const int nLines = std::min(nStripLines, nYSize - iY);
+        const size_t nOffset = static_cast<size_t>(iY) * nXSize;
+        float *pafValue = aoLevels[0].afValue.data() + nOffset;
+        const float *pafWeight = aoLevels[0].afWeight.data() + nOffset;
+        const GByte *pabyStatus = abyStatus.data() + nOffset;
+        const size_t nPixels = static_cast<size_t>(nLines) * nXSize;
+
+        // Pixels at the NODATA value are neither used nor filled.
+        for (size_t i = 0; i < nPixels; ++i)
+        {
+            if (pabyStatus[i] == PIXEL_NODATA)
+                pafValue[i] = fNoData;
+        }
+
+        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iY, nXSize, nLines,
+                            pafValue, nXSize, nLines, GDT_Float32, 0, 0);
+
+        if (eErr == CE_None && bUpdateMask)
+        {
+            for (size_t i = 0; i < nPixels; ++i)
+            {
+                abyMask[i] = (pabyStatus[i] != PIXEL_TO_FILL ||
+                              pafWeight[i] > 0)
+                                 ? 255
+                                 : 0;
+            }
+            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iY, nXSize, nLines,
+                                abyMask.data(), nXSize, nLines, GDT_Byte, 0, 0);
+        }
+
+        if (eErr == CE_None && hFiltMaskBand)
+        {
+            for (size_t i = 0; i < nPixels; ++i)
+            {
+                abyMask[i] =
+                    (pabyStatus[i] == PIXEL_TO_FILL && pafWeight[i] > 0) ? 255
+                                                                         : 0;
+            }
+            eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iY, nXSize, nLines,
+                                abyMask.data(), nXSize, nLines, GDT_Byte, 0, 0);
+        }
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.8 + 0.2 * (iY + nLines) / nYSize, "Filling...",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                           GDALFillNodata()                           */
 /************************************************************************/
@@ -397,9 +739,18 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
  * <li>NODATA=value (starting with GDAL 2.4).
  * Source pixels at that value will be ignored by the interpolator. Warning:
  * currently this will not be honored by smoothing passes.</li>
- * <li>INTERPOLATION=INV_DIST/NEAREST (GDAL >= 3.9). By default, pixels are
- * interpolated using an inverse distance weighting (INV_DIST). It is also
- * possible to choose a nearest neighbour (NEAREST) strategy.</li>
+ * <li>INTERPOLATION=INV_DIST/NEAREST/PULL_PUSH (GDAL >= 3.9). By default,
+ * pixels are interpolated using an inverse distance weighting (INV_DIST). It
+ * is also possible to choose a nearest neighbour (NEAREST) strategy.
+ * PULL_PUSH (GDAL >= 3.10) uses a multi-resolution pyramid of weighted
+ * averages, whose cost does not depend on the size of the holes, and gives
+ * smooth results. dfMaxSearchDist then determines the number of levels of
+ * the pyramid, and so only approximately the maximum distance from which
+ * values are interpolated. This mode keeps the whole raster in memory
+ * (about 12 bytes per pixel), and does not use temporary files.</li>
+ * <li>NUM_THREADS=number_of_threads|ALL_CPUS (GDAL >= 3.10). Number of
+ * threads used by INTERPOLATION=PULL_PUSH. Defaults to the value of the
+ * GDAL_NUM_THREADS configuration option, or 1.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -429,8 +780,8 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
     const char *pszInterpolation =
         CSLFetchNameValueDef(papszOptions, "INTERPOLATION", "INV_DIST");
     const bool bNearest = EQUAL(pszInterpolation, "NEAREST");
-    if (!EQUAL(pszInterpolation, "INV_DIST") &&
-        !EQUAL(pszInterpolation, "NEAREST"))
+    const bool bPullPush = EQUAL(pszInterpolation, "PULL_PUSH");
+    if (!EQUAL(pszInterpolation, "INV_DIST") && !bNearest && !bPullPush)
     {
         CPLError(CE_Failure, CPLE_NotSupported,
                  "Unsupported interpolation method: %s", pszInterpolation);
@@ -537,6 +888,70 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         return CE_Failure;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      The pull-push algorithm works in memory, and only needs a       */
+    /*      work file for the mask of the smoothing passes.                 */
+    /* -------------------------------------------------------------------- */
+    if (bPullPush)
+    {
+        std::unique_ptr<GDALDataset> poFiltMaskDS;
+        GDALRasterBandH hFiltMaskBand = nullptr;
+        if (nSmoothingIterations > 0)
+        {
+            const CPLString osFiltMaskTmpFile =
+                osTmpFile + "fill_filtmask_work.tif";
+            poFiltMaskDS.reset(GDALDataset::FromHandle(
+                GDALCreate(hDriver, osFiltMaskTmpFile, nXSize, nYSize, 1,
+                           GDT_Byte, aosWorkFileOptions.List())));
+            if (poFiltMaskDS == nullptr)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Could not create mask work file. Check driver "
+                         "capabilities.");
+                return CE_Failure;
+            }
+            poFiltMaskDS->MarkSuppressOnClose();
+            hFiltMaskBand =
+                GDALRasterBand::ToHandle(poFiltMaskDS->GetRasterBand(1));
+        }
+
+        const char *pszNumThreads =
+            CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                                 CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+        const int nThreads = std::max(
+            1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(pszNumThreads)));
+
+        // Each level of the pyramid doubles the distance from which values
+        // are propagated.
+        const int nMaxLevels = static_cast<int>(
+            std::ceil(std::log2(std::max(1.0, dfMaxSearchDist))));
+
+        void *pScaledProgress = GDALCreateScaledProgress(
+            0.0, dfProgressRatio, pfnProgress, pProgressArg);
+        CPLErr eErr = GDALFillNodataPullPush(
+            hTargetBand, hMaskBand, poTmpMaskDS != nullptr, hFiltMaskBand,
+            nMaxLevels, bHasNoData, fNoData, nThreads, GDALScaledProgress,
+            pScaledProgress);
+        GDALDestroyScaledProgress(pScaledProgress);
+
+        if (eErr == CE_None && nSmoothingIterations > 0)
+        {
+            if (poTmpMaskDS == nullptr)
+                GDALFlushRasterCache(hMaskBand);
+
+            pScaledProgress = GDALCreateScaledProgress(
+                dfProgressRatio, 1.0, pfnProgress, pProgressArg);
+            eErr = GDALMultiFilter(hTargetBand, hMaskBand, hFiltMaskBand,
+                                   nSmoothingIterations, GDALScaledProgress,
+                                   pScaledProgress);
+            GDALDestroyScaledProgress(pScaledProgress);
+        }
+
+        return eErr;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Create a work file to hold the Y "last value" indices.          */
     /* -------------------------------------------------------------------- */
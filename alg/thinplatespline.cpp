@@ -46,6 +46,8 @@
 
 #include "cpl_error.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 //////////////////////////////////////////////////////////////////////////////
 //// vizGeorefSpline2D
@@ -549,6 +551,11 @@ int VizGeorefSpline2D::solve()
         return 3;
     }
 
+    if (_nof_local_points > 0 && _nof_points > _nof_local_points)
+    {
+        return solve_local();
+    }
+
     type = VIZ_GEOREF_SPLINE_FULL;
     // Make the necessary memory allocations.
 
@@ -624,6 +631,236 @@ int VizGeorefSpline2D::solve()
     return 4;
 }
 
+/************************************************************************/
+/*                            solve_local()                             */
+/************************************************************************/
+
+namespace
+{
+// Points and grid shared by the computation of all node splines.
+struct VizGeorefLocalSplineContext
+{
+    const double *x = nullptr;
+    const double *y = nullptr;
+    const double *const *rhs = nullptr;
+    int nof_vars = 0;
+    int nof_points = 0;
+    int nof_min_points = 0;
+    int nof_cells_x = 0;
+    int nof_cells_y = 0;
+    double grid_xmin = 0;
+    double grid_ymin = 0;
+    double cell_width = 0;
+    double cell_height = 0;
+    // Indices of the points of each cell.
+    std::vector<std::vector<int>> cell_points{};
+
+    int GetCellX(double dfX) const
+    {
+        return std::max(
+            0, std::min(nof_cells_x - 1,
+                        static_cast<int>((dfX - grid_xmin) / cell_width)));
+    }
+
+    int GetCellY(double dfY) const
+    {
+        return std::max(
+            0, std::min(nof_cells_y - 1,
+                        static_cast<int>((dfY - grid_ymin) / cell_height)));
+    }
+};
+
+struct VizGeorefLocalSplineJob
+{
+    const VizGeorefLocalSplineContext *psContext = nullptr;
+    double dfNodeX = 0;
+    double dfNodeY = 0;
+    std::unique_ptr<VizGeorefSpline2D> poSpline{};
+};
+}  // namespace
+
+static void VizGeorefLocalSplineSolve(void *pData)
+{
+    auto psJob = static_cast<VizGeorefLocalSplineJob *>(pData);
+    const auto &sCtxt = *(psJob->psContext);
+
+    // The spline of a node is computed on the points at less than 1.5 cell
+    // of it, which include the points where its weight is not zero. If
+    // there are not enough of them, or if they are degenerate (for example
+    // aligned), the neighbourhood is enlarged.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    std::vector<int> anIdx;
+    for (double dfRadius = 1.5;; dfRadius *= 2)
+    {
+        const double dfMaxDX = dfRadius * sCtxt.cell_width;
+        const double dfMaxDY = dfRadius * sCtxt.cell_height;
+        const int nCellXMin = sCtxt.GetCellX(psJob->dfNodeX - dfMaxDX);
+        const int nCellXMax = sCtxt.GetCellX(psJob->dfNodeX + dfMaxDX);
+        const int nCellYMin = sCtxt.GetCellY(psJob->dfNodeY - dfMaxDY);
+        const int nCellYMax = sCtxt.GetCellY(psJob->dfNodeY + dfMaxDY);
+        anIdx.clear();
+        for (int iCellY = nCellYMin; iCellY <= nCellYMax; iCellY++)
+        {
+            for (int iCellX = nCellXMin; iCellX <= nCellXMax; iCellX++)
+            {
+                for (const int p :
+                     sCtxt.cell_points[static_cast<size_t>(iCellY) *
+                                           sCtxt.nof_cells_x +
+                                       iCellX])
+                {
+                    if (fabs(sCtxt.x[p] - psJob->dfNodeX) <= dfMaxDX &&
+                        fabs(sCtxt.y[p] - psJob->dfNodeY) <= dfMaxDY)
+                    {
+                        anIdx.push_back(p);
+                    }
+                }
+            }
+        }
+
+        const int nCount = static_cast<int>(anIdx.size());
+        if (nCount >= sCtxt.nof_min_points)
+        {
+            psJob->poSpline =
+                std::make_unique<VizGeorefSpline2D>(sCtxt.nof_vars);
+            bool bOK = true;
+            for (const int p : anIdx)
+            {
+                double adfVars[VIZGEOREF_MAX_VARS];
+                for (int v = 0; v < sCtxt.nof_vars; v++)
+                    adfVars[v] = sCtxt.rhs[v][p + 3];
+                bOK &=
+                    psJob->poSpline->add_point(sCtxt.x[p], sCtxt.y[p], adfVars);
+            }
+            if (bOK && psJob->poSpline->solve() != 0)
+                return;
+            psJob->poSpline.reset();
+        }
+        if (nCount == sCtxt.nof_points)
+            return;
+    }
+}
+
+int VizGeorefSpline2D::solve_local()
+{
+    VizGeorefLocalSplineContext sCtxt;
+    sCtxt.x = x;
+    sCtxt.y = y;
+    sCtxt.rhs = rhs;
+    sCtxt.nof_vars = _nof_vars;
+    sCtxt.nof_points = _nof_points;
+    sCtxt.nof_min_points =
+        std::min(_nof_points, std::max(10, _nof_local_points / 4));
+
+    double xmin = x[0];
+    double xmax = x[0];
+    double ymin = y[0];
+    double ymax = y[0];
+    for (int p = 1; p < _nof_points; p++)
+    {
+        xmin = std::min(xmin, x[p]);
+        xmax = std::max(xmax, x[p]);
+        ymin = std::min(ymin, y[p]);
+        ymax = std::max(ymax, y[p]);
+    }
+    const double delx = xmax - xmin;
+    const double dely = ymax - ymin;
+
+    // Each node spline is computed on an area of about 3x3 cells, hence the
+    // number of cells to get about _nof_local_points points per node.
+    const double dfCellCount =
+        9.0 * _nof_points / static_cast<double>(_nof_local_points);
+    constexpr double MAX_CELLS_PER_DIM = 10000;
+    _nof_cells_x = static_cast<int>(std::min(
+        MAX_CELLS_PER_DIM,
+        std::max(1.0, std::round(std::sqrt(dfCellCount * delx / dely)))));
+    _nof_cells_y = static_cast<int>(std::min(
+        MAX_CELLS_PER_DIM,
+        std::max(1.0, std::round(dfCellCount / _nof_cells_x))));
+    _grid_xmin = xmin;
+    _grid_ymin = ymin;
+    _cell_width = delx / _nof_cells_x;
+    _cell_height = dely / _nof_cells_y;
+
+    sCtxt.nof_cells_x = _nof_cells_x;
+    sCtxt.nof_cells_y = _nof_cells_y;
+    sCtxt.grid_xmin = _grid_xmin;
+    sCtxt.grid_ymin = _grid_ymin;
+    sCtxt.cell_width = _cell_width;
+    sCtxt.cell_height = _cell_height;
+    sCtxt.cell_points.resize(static_cast<size_t>(_nof_cells_x) *
+                             _nof_cells_y);
+    for (int p = 0; p < _nof_points; p++)
+    {
+        sCtxt
+            .cell_points[static_cast<size_t>(sCtxt.GetCellY(y[p])) *
+                             _nof_cells_x +
+                         sCtxt.GetCellX(x[p])]
+            .push_back(p);
+    }
+
+    const int nNodesX = _nof_cells_x + 1;
+    const int nNodesY = _nof_cells_y + 1;
+    std::vector<VizGeorefLocalSplineJob> asJobs(static_cast<size_t>(nNodesX) *
+                                                nNodesY);
+    for (int j = 0; j < nNodesY; j++)
+    {
+        for (int i = 0; i < nNodesX; i++)
+        {
+            auto &sJob = asJobs[static_cast<size_t>(j) * nNodesX + i];
+            sJob.psContext = &sCtxt;
+            sJob.dfNodeX = _grid_xmin + i * _cell_width;
+            sJob.dfNodeY = _grid_ymin + j * _cell_height;
+        }
+    }
+
+    CPLWorkerThreadPool *poThreadPool =
+        _nof_threads > 1 && asJobs.size() > 1
+            ? GDALGetGlobalThreadPool(_nof_threads)
+            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    for (auto &sJob : asJobs)
+    {
+        if (!poJobQueue ||
+            !poJobQueue->SubmitJob(VizGeorefLocalSplineSolve, &sJob))
+        {
+            VizGeorefLocalSplineSolve(&sJob);
+        }
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    _local_splines.clear();
+    for (auto &sJob : asJobs)
+    {
+        if (!sJob.poSpline)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot solve local thin plate spline around (%f,%f). "
+                     "Computation aborted.",
+                     sJob.dfNodeX, sJob.dfNodeY);
+            _local_splines.clear();
+            return 0;
+        }
+        _local_splines.push_back(std::move(sJob.poSpline));
+    }
+
+    type = VIZ_GEOREF_SPLINE_LOCAL;
+    return 5;
+}
+
+/************************************************************************/
+/*                      get_nof_terms_per_point()                       */
+/************************************************************************/
+
+int VizGeorefSpline2D::get_nof_terms_per_point() const
+{
+    if (type == VIZ_GEOREF_SPLINE_FULL)
+        return _nof_points;
+    if (type == VIZ_GEOREF_SPLINE_LOCAL)
+        return 4 * _nof_local_points;
+    return 1;
+}
+
 int VizGeorefSpline2D::get_point(const double Px, const double Py, double *vars)
 {
     switch (type)
@@ -706,6 +943,47 @@ int VizGeorefSpline2D::get_point(const double Px, const double Py, double *vars)
             }
             break;
         }
+        case VIZ_GEOREF_SPLINE_LOCAL:
+        {
+            // Blend the splines of the 4 nodes around the point (or around
+            // its projection on the grid extent) with bilinear weights,
+            // which form a partition of unity.
+            const double dfCellX = std::max(
+                0.0, std::min(static_cast<double>(_nof_cells_x),
+                              (Px - _grid_xmin) / _cell_width));
+            const double dfCellY = std::max(
+                0.0, std::min(static_cast<double>(_nof_cells_y),
+                              (Py - _grid_ymin) / _cell_height));
+            const int i0 =
+                std::min(_nof_cells_x - 1, static_cast<int>(dfCellX));
+            const int j0 =
+                std::min(_nof_cells_y - 1, static_cast<int>(dfCellY));
+            const double dfFracX = dfCellX - i0;
+            const double dfFracY = dfCellY - j0;
+            const double adfWeights[4] = {
+                (1 - dfFracX) * (1 - dfFracY), dfFracX * (1 - dfFracY),
+                (1 - dfFracX) * dfFracY, dfFracX * dfFracY};
+
+            for (int v = 0; v < _nof_vars; v++)
+                vars[v] = 0.0;
+            for (int iNode = 0; iNode < 4; iNode++)
+            {
+                if (adfWeights[iNode] == 0)
+                    continue;
+                const int i = i0 + (iNode % 2);
+                const int j = j0 + (iNode / 2);
+                double adfNodeVars[VIZGEOREF_MAX_VARS];
+                auto &poSpline =
+                    _local_splines[static_cast<size_t>(j) *
+                                       (_nof_cells_x + 1) +
+                                   i];
+                if (!poSpline->get_point(Px, Py, adfNodeVars))
+                    return 0;
+                for (int v = 0; v < _nof_vars; v++)
+                    vars[v] += adfWeights[iNode] * adfNodeVars[v];
+            }
+            break;
+        }
         case VIZ_GEOREF_SPLINE_POINT_WAS_ADDED:
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -38,6 +38,9 @@
 #include "gdal_alg.h"
 #include "cpl_conv.h"
 
+#include <memory>
+#include <vector>
+
 typedef enum
 {
     VIZ_GEOREF_SPLINE_ZERO_POINTS,
@@ -45,6 +48,7 @@ typedef enum
     VIZ_GEOREF_SPLINE_TWO_POINTS,
     VIZ_GEOREF_SPLINE_ONE_DIMENSIONAL,
     VIZ_GEOREF_SPLINE_FULL,
+    VIZ_GEOREF_SPLINE_LOCAL,
 
     VIZ_GEOREF_SPLINE_POINT_WAS_ADDED,
     VIZ_GEOREF_SPLINE_POINT_WAS_DELETED
@@ -140,6 +144,21 @@ class VizGeorefSpline2D
     }
 #endif
 
+    // Enable the local mode: when there are more than nof_local_points
+    // points, solve() computes, instead of a single spline on all points,
+    // splines on the neighbourhoods of the nodes of a regular grid, each one
+    // made of about nof_local_points points, and get_point() blends the
+    // splines of the 4 surrounding nodes with bilinear weights. The result
+    // still honours exactly the input points.
+    void set_local_mode(int nof_local_points, int nof_threads)
+    {
+        _nof_local_points = nof_local_points;
+        _nof_threads = nof_threads;
+    }
+
+    // Number of spline terms evaluated by get_point()
+    int get_nof_terms_per_point() const;
+
     bool add_point(const double Px, const double Py, const double *Pvars);
     int get_point(const double Px, const double Py, double *Pvars);
 #if 0
@@ -151,6 +170,8 @@ class VizGeorefSpline2D
     int solve(void);
 
   private:
+    int solve_local();
+
     vizGeorefInterType type;
 
     const int _nof_vars;
@@ -181,6 +202,18 @@ class VizGeorefSpline2D
     double x_mean;
     double y_mean;
 
+    // Local mode
+    int _nof_local_points = 0;
+    int _nof_threads = 1;
+    int _nof_cells_x = 0;
+    int _nof_cells_y = 0;
+    double _grid_xmin = 0;
+    double _grid_ymin = 0;
+    double _cell_width = 0;
+    double _cell_height = 0;
+    // Splines of the (_nof_cells_x + 1) * (_nof_cells_y + 1) grid nodes
+    std::vector<std::unique_ptr<VizGeorefSpline2D>> _local_splines{};
+
   private:
     CPL_DISALLOW_COPY_ASSIGN(VizGeorefSpline2D)
 };
@@ -27,11 +27,20 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
+#include <functional>
 #include <limits>
+#include <mutex>
+#include <vector>
 
+#include "cpl_conv.h"
 #include "gdal_alg.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
+#include "ogr_spatialref.h"
+#include "ogrsf_frmts.h"
 
 #include "viewshed.h"
 
@@ -119,7 +128,12 @@
  * and dfInvisibleVal will be ignored.
  *
  *
- * @param papszExtraOptions Future extra options. Must be set to NULL currently.
+ * @param papszExtraOptions Extra options. Currently supported:
+ * <ul>
+ * <li>NUM_THREADS=number|ALL_CPUS (GDAL >= 3.10): number of threads used to
+ * process the four quadrants around the observer concurrently. Defaults to
+ * the value of the GDAL_NUM_THREADS configuration option, or 1.</li>
+ * </ul>
  *
  * @return not NULL output dataset on success (to be closed with GDALClose()) or
  * NULL if an error occurs.
@@ -134,7 +148,7 @@ GDALDatasetH GDALViewshedGenerate(
     double dfOutOfRangeVal, double dfNoDataVal, double dfCurvCoeff,
     GDALViewshedMode eMode, double dfMaxDistance, GDALProgressFunc pfnProgress,
     void *pProgressArg, GDALViewshedOutputType heightMode,
-    [[maybe_unused]] CSLConstList papszExtraOptions)
+    CSLConstList papszExtraOptions)
 {
     using namespace gdal;
 
@@ -150,6 +164,13 @@ GDALDatasetH GDALViewshedGenerate(
     oOpts.maxDistance = dfMaxDistance;
     oOpts.nodataVal = dfNoDataVal;
 
+    const char *pszNumThreads =
+        CSLFetchNameValue(papszExtraOptions, "NUM_THREADS");
+    if (pszNumThreads)
+        oOpts.numThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                               ? CPLGetNumCPUs()
+                               : std::max(1, atoi(pszNumThreads));
+
     switch (eMode)
     {
         case GVM_Edge:
@@ -258,79 +279,45 @@ double CalcHeightEdge(int i, int j, double Za, double Zb, double Zo)
         return ((Za - Zo) * i + (Zb - Zo) * (j - i)) / (j - 1) + Zo;
 }
 
-}  // unnamed namespace
-
-void Viewshed::setVisibility(int iPixel, double dfZ, double *padfZVal,
-                             std::vector<GByte> &vResult)
-{
-    if (padfZVal[iPixel] + oOpts.targetHeight < dfZ)
-        vResult[iPixel] = oOpts.invisibleVal;
-    else
-        vResult[iPixel] = oOpts.visibleVal;
-
-    if (padfZVal[iPixel] < dfZ)
-        padfZVal[iPixel] = dfZ;
-}
-
-double Viewshed::calcHeight(double dfDiagZ, double dfEdgeZ)
-{
-    double dfHeight = dfEdgeZ;
-
-    switch (oOpts.cellMode)
-    {
-        case Viewshed::CellMode::Max:
-            dfHeight = std::max(dfDiagZ, dfEdgeZ);
-            break;
-        case Viewshed::CellMode::Min:
-            dfHeight = std::min(dfDiagZ, dfEdgeZ);
-            break;
-        case Viewshed::CellMode::Diagonal:
-            dfHeight = dfDiagZ;
-            break;
-        default:  // Edge case set in initialization.
-            break;
-    }
-    return dfHeight;
-}
-
-bool Viewshed::run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
-                   void *pProgressArg)
+/// Part of the source raster processed for an observer, in pixel/line
+/// coordinates of the source band. Stop values are exclusive.
+struct Window
 {
-    if (!pfnProgress)
-        pfnProgress = GDALDummyProgress;
+    int nXStart{0};
+    int nYStart{0};
+    int nXStop{0};
+    int nYStop{0};
 
-    if (!pfnProgress(0.0, "", pProgressArg))
+    int xSize() const
     {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        return false;
+        return nXStop - nXStart;
     }
 
-    /* set up geotransformation */
-    std::array<double, 6> adfGeoTransform{{0.0, 1.0, 0.0, 0.0, 0.0, 1.0}};
-    GDALDatasetH hSrcDS = GDALGetBandDataset(hBand);
-    if (hSrcDS != nullptr)
-        GDALGetGeoTransform(hSrcDS, adfGeoTransform.data());
-
-    double adfInvGeoTransform[6];
-    if (!GDALInvGeoTransform(adfGeoTransform.data(), adfInvGeoTransform))
+    int ySize() const
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Cannot invert geotransform");
-        return false;
+        return nYStop - nYStart;
     }
-
+};
+
+/// Compute the pixel position of an observer and the window of the source
+/// band that must be processed for it.
+/// Errors are emitted with the eErrClass class.
+bool CalcObserverWindow(const Viewshed::Options &oOpts,
+                        const Viewshed::Point &oObserver,
+                        const double *adfInvGeoTransform, int nBandXSize,
+                        int nBandYSize, CPLErr eErrClass, int &nX, int &nY,
+                        Window &oWindow)
+{
     /* calculate observer position */
     double dfX, dfY;
-    GDALApplyGeoTransform(adfInvGeoTransform, oOpts.observer.x,
-                          oOpts.observer.y, &dfX, &dfY);
-    int nX = static_cast<int>(dfX);
-    int nY = static_cast<int>(dfY);
-
-    int nXSize = GDALGetRasterBandXSize(hBand);
-    int nYSize = GDALGetRasterBandYSize(hBand);
+    GDALApplyGeoTransform(adfInvGeoTransform, oObserver.x, oObserver.y, &dfX,
+                          &dfY);
+    nX = static_cast<int>(dfX);
+    nY = static_cast<int>(dfY);
 
-    if (nX < 0 || nX > nXSize || nY < 0 || nY > nYSize)
+    if (nX < 0 || nX > nBandXSize || nY < 0 || nY > nBandYSize)
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
+        CPLError(eErrClass, CPLE_AppDefined,
                  "The observer location falls outside of the DEM area");
         return false;
     }
@@ -340,8 +327,8 @@ bool Viewshed::run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
 
     int nXStart = 0;
     int nYStart = 0;
-    int nXStop = nXSize;
-    int nYStop = nYSize;
+    int nXStop = nBandXSize;
+    int nYStop = nBandYSize;
     if (oOpts.maxDistance > 0)
     {
         nXStart = static_cast<int>(std::floor(
@@ -361,162 +348,236 @@ bool Viewshed::run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
                       EPSILON) +
             (adfInvGeoTransform[5] < 0 ? 1 : 0));
     }
-    nXStart = std::max(nXStart, 0);
-    nYStart = std::max(nYStart, 0);
-    nXStop = std::min(nXStop, nXSize);
-    nYStop = std::min(nYStop, nYSize);
-
-    /* normalize horizontal index (0 - nXSize) */
-    nXSize = nXStop - nXStart;
-    nX -= nXStart;
+    oWindow.nXStart = std::max(nXStart, 0);
+    oWindow.nYStart = std::max(nYStart, 0);
+    oWindow.nXStop = std::min(nXStop, nBandXSize);
+    oWindow.nYStop = std::min(nYStop, nBandYSize);
 
-    nYSize = nYStop - nYStart;
-
-    if (nXSize == 0 || nYSize == 0)
+    if (oWindow.xSize() <= 0 || oWindow.ySize() <= 0)
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Invalid target raster size");
+        CPLError(eErrClass, CPLE_AppDefined, "Invalid target raster size");
         return false;
     }
 
-    std::vector<double> vFirstLineVal;
-    std::vector<double> vLastLineVal;
-    std::vector<double> vThisLineVal;
-    std::vector<GByte> vResult;
-    std::vector<double> vHeightResult;
+    return true;
+}
 
-    try
+/// Return the diameter of the sphere used for curvature correction.
+/// If we can't get a SemiMajor axis from the SRS, infinity is returned.
+double GetSphereDiameter(const OGRSpatialReference *poSRS)
+{
+    double dfSphereDiameter(std::numeric_limits<double>::infinity());
+    if (poSRS)
     {
-        vFirstLineVal.resize(nXSize);
-        vLastLineVal.resize(nXSize);
-        vThisLineVal.resize(nXSize);
-        vResult.resize(nXSize);
+        OGRErr eSRSerr;
+        double dfSemiMajor = poSRS->GetSemiMajor(&eSRSerr);
 
-        if (oOpts.outputMode != OutputMode::Normal)
-            vHeightResult.resize(nXSize);
+        /* If we fetched the axis from the SRS, use it */
+        if (eSRSerr != OGRERR_FAILURE)
+            dfSphereDiameter = dfSemiMajor * 2.0;
+        else
+            CPLDebug("GDALViewshedGenerate",
+                     "Unable to fetch SemiMajor axis from spatial reference");
     }
-    catch (...)
+    return dfSphereDiameter;
+}
+
+/// Resolve the number of threads to use from Options::numThreads.
+int GetNumThreads(int nRequested)
+{
+    int nThreads = nRequested;
+    if (nThreads <= 0)
     {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Cannot allocate vectors for viewshed");
-        return false;
+        const char *pszThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
     }
+    return std::max(1, std::min(128, nThreads));
+}
 
-    double *padfFirstLineVal = vFirstLineVal.data();
-    double *padfLastLineVal = vLastLineVal.data();
-    double *padfThisLineVal = vThisLineVal.data();
-    GByte *pabyResult = vResult.data();
-    double *dfHeightResult = vHeightResult.data();
+/************************************************************************/
+/*                           ViewshedExecutor                           */
+/************************************************************************/
 
-    GDALDriverManager *hMgr = GetGDALDriverManager();
-    GDALDriver *hDriver = hMgr->GetDriverByName(oOpts.outputFormat.c_str());
-    if (!hDriver)
+/// Computes the viewshed of one observer over a window.
+///
+/// The line of the observer is processed first. Each of the four quadrants
+/// around the observer then only depends on that line and on the column of
+/// the observer, which is recomputed identically by the quadrants sharing
+/// it, so the quadrants can be processed concurrently.
+class ViewshedExecutor
+{
+  public:
+    /// Read nXCount DEM values of line iLine of the window, starting at
+    /// column nXOff, into padfLine.
+    using LineReader = std::function<bool(int iLine, int nXOff, int nXCount,
+                                          double *padfLine)>;
+
+    /// Store nXCount results of line iLine of the window, starting at
+    /// column nXOff. padfHeight is only meaningful in the DEM and Ground
+    /// output modes.
+    using LineWriter =
+        std::function<bool(int iLine, int nXOff, int nXCount,
+                           const GByte *pabyResult, const double *padfHeight)>;
+
+    ViewshedExecutor(const Viewshed::Options &oOpts,
+                     const double *adfGeoTransform, int nXSize, int nYSize,
+                     int nX, int nY, double dfSphereDiameter,
+                     LineReader pfnReadLine, LineWriter pfnWriteLine)
+        : m_oOpts(oOpts), m_nXSize(nXSize), m_nYSize(nYSize), m_nX(nX),
+          m_nY(nY), m_dfDistance2(oOpts.maxDistance * oOpts.maxDistance),
+          m_dfSphereDiameter(dfSphereDiameter),
+          m_pfnReadLine(std::move(pfnReadLine)),
+          m_pfnWriteLine(std::move(pfnWriteLine))
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Cannot get driver");
-        return false;
+        std::copy(adfGeoTransform, adfGeoTransform + 6,
+                  m_adfGeoTransform.begin());
     }
 
-    /* create output raster */
-    poDstDS.reset(hDriver->Create(
-        oOpts.outputFilename.c_str(), nXSize, nYSize, 1,
-        oOpts.outputMode == OutputMode::Normal ? GDT_Byte : GDT_Float64,
-        const_cast<char **>(oOpts.creationOpts.List())));
-    if (!poDstDS)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create dataset for %s",
-                 oOpts.outputFilename.c_str());
-        return false;
-    }
-    /* copy srs */
-    if (hSrcDS)
-        poDstDS->SetSpatialRef(
-            GDALDataset::FromHandle(hSrcDS)->GetSpatialRef());
+    bool run(int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg);
 
-    std::array<double, 6> adfDstGeoTransform;
-    adfDstGeoTransform[0] = adfGeoTransform[0] + adfGeoTransform[1] * nXStart +
-                            adfGeoTransform[2] * nYStart;
-    adfDstGeoTransform[1] = adfGeoTransform[1];
-    adfDstGeoTransform[2] = adfGeoTransform[2];
-    adfDstGeoTransform[3] = adfGeoTransform[3] + adfGeoTransform[4] * nXStart +
-                            adfGeoTransform[5] * nYStart;
-    adfDstGeoTransform[4] = adfGeoTransform[4];
-    adfDstGeoTransform[5] = adfGeoTransform[5];
-    poDstDS->SetGeoTransform(adfDstGeoTransform.data());
+  private:
+    /// Columns processed by a job
+    enum class Columns
+    {
+        Left,   //!< Columns left of the observer
+        Right,  //!< Column of the observer and columns right of it
+        Both    //!< All columns
+    };
 
-    auto hTargetBand = poDstDS->GetRasterBand(1);
-    if (hTargetBand == nullptr)
+    struct Job
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Cannot get band for %s",
-                 oOpts.outputFilename.c_str());
-        return false;
-    }
+        ViewshedExecutor *poExecutor = nullptr;
+        bool bUp = false;
+        Columns eColumns = Columns::Both;
+        bool bOK = true;
+    };
+
+    const Viewshed::Options &m_oOpts;
+    std::array<double, 6> m_adfGeoTransform{};
+    const int m_nXSize;
+    const int m_nYSize;
+    const int m_nX;
+    const int m_nY;
+    const double m_dfDistance2;
+    const double m_dfSphereDiameter;
+    double m_dfZObserver = 0;
+    LineReader m_pfnReadLine;
+    LineWriter m_pfnWriteLine;
+    std::vector<double> m_vFirstLineVal{};
+
+    std::mutex m_oProgressMutex{};
+    GDALProgressFunc m_pfnProgress = nullptr;
+    void *m_pProgressArg = nullptr;
+    int m_nLinesDone = 0;
+    int m_nLinesTotal = 0;
+    std::atomic<bool> m_bStop{false};
+
+    static void JobFunc(void *pData);
+
+    CPL_DISALLOW_COPY_ASSIGN(ViewshedExecutor)
+
+    bool processFirstLine(std::vector<GByte> &vResult,
+                          std::vector<double> &vHeightResult);
+    bool processLines(bool bUp, Columns eColumns);
+    void processCenter(int nDeltaY, double *padfThisLineVal,
+                       const double *padfLastLineVal, GByte *pabyResult,
+                       double *padfHeightResult);
+    void processLeft(int nDeltaY, double *padfThisLineVal,
+                     const double *padfLastLineVal, GByte *pabyResult,
+                     double *padfHeightResult);
+    void processRight(int nDeltaY, double *padfThisLineVal,
+                      const double *padfLastLineVal, GByte *pabyResult,
+                      double *padfHeightResult);
+    bool reportLineDone();
+
+    void setVisibility(int iPixel, double dfZ, double *padfZVal,
+                       GByte *pabyResult) const;
+    double calcHeight(double dfDiagZ, double dfEdgeZ) const;
+};
+
+void ViewshedExecutor::setVisibility(int iPixel, double dfZ, double *padfZVal,
+                                     GByte *pabyResult) const
+{
+    if (padfZVal[iPixel] + m_oOpts.targetHeight < dfZ)
+        pabyResult[iPixel] = m_oOpts.invisibleVal;
+    else
+        pabyResult[iPixel] = m_oOpts.visibleVal;
 
-    if (oOpts.nodataVal >= 0)
-        GDALSetRasterNoDataValue(hTargetBand, oOpts.nodataVal);
+    if (padfZVal[iPixel] < dfZ)
+        padfZVal[iPixel] = dfZ;
+}
+
+double ViewshedExecutor::calcHeight(double dfDiagZ, double dfEdgeZ) const
+{
+    double dfHeight = dfEdgeZ;
 
-    /* process first line */
-    if (GDALRasterIO(hBand, GF_Read, nXStart, nY, nXSize, 1, padfFirstLineVal,
-                     nXSize, 1, GDT_Float64, 0, 0))
+    switch (m_oOpts.cellMode)
     {
-        CPLError(
-            CE_Failure, CPLE_AppDefined,
-            "RasterIO error when reading DEM at position(%d, %d), size(%d, %d)",
-            nXStart, nY, nXSize, 1);
-        return false;
+        case Viewshed::CellMode::Max:
+            dfHeight = std::max(dfDiagZ, dfEdgeZ);
+            break;
+        case Viewshed::CellMode::Min:
+            dfHeight = std::min(dfDiagZ, dfEdgeZ);
+            break;
+        case Viewshed::CellMode::Diagonal:
+            dfHeight = dfDiagZ;
+            break;
+        default:  // Edge case set in initialization.
+            break;
     }
+    return dfHeight;
+}
 
-    const double dfZObserver = oOpts.observer.z + padfFirstLineVal[nX];
-    const double dfDistance2 = oOpts.maxDistance * oOpts.maxDistance;
+bool ViewshedExecutor::processFirstLine(std::vector<GByte> &vResult,
+                                        std::vector<double> &vHeightResult)
+{
+    using OutputMode = Viewshed::OutputMode;
 
-    /* If we can't get a SemiMajor axis from the SRS, it will be
-     * SRS_WGS84_SEMIMAJOR
-     */
-    double dfSphereDiameter(std::numeric_limits<double>::infinity());
-    const OGRSpatialReference *poDstSRS = poDstDS->GetSpatialRef();
-    if (poDstSRS)
-    {
-        OGRErr eSRSerr;
-        double dfSemiMajor = poDstSRS->GetSemiMajor(&eSRSerr);
+    double *padfFirstLineVal = m_vFirstLineVal.data();
+    GByte *pabyResult = vResult.data();
+    double *dfHeightResult = vHeightResult.data();
+    const int nX = m_nX;
+    const int nXSize = m_nXSize;
 
-        /* If we fetched the axis from the SRS, use it */
-        if (eSRSerr != OGRERR_FAILURE)
-            dfSphereDiameter = dfSemiMajor * 2.0;
-        else
-            CPLDebug("GDALViewshedGenerate",
-                     "Unable to fetch SemiMajor axis from spatial reference");
-    }
+    if (!m_pfnReadLine(m_nY, 0, nXSize, padfFirstLineVal))
+        return false;
+
+    m_dfZObserver = m_oOpts.observer.z + padfFirstLineVal[nX];
 
     /* mark the observer point as visible */
     double dfGroundLevel = 0;
-    if (oOpts.outputMode == OutputMode::DEM)
+    if (m_oOpts.outputMode == OutputMode::DEM)
         dfGroundLevel = padfFirstLineVal[nX];
 
-    pabyResult[nX] = oOpts.visibleVal;
+    pabyResult[nX] = m_oOpts.visibleVal;
 
     //ABELL - Do we care about this conditional?
-    if (oOpts.outputMode != OutputMode::Normal)
+    if (m_oOpts.outputMode != OutputMode::Normal)
         dfHeightResult[nX] = dfGroundLevel;
 
     dfGroundLevel = 0;
     if (nX > 0)
     {
-        if (oOpts.outputMode == OutputMode::DEM)
+        if (m_oOpts.outputMode == OutputMode::DEM)
             dfGroundLevel = padfFirstLineVal[nX - 1];
         CPL_IGNORE_RET_VAL(AdjustHeightInRange(
-            adfGeoTransform.data(), 1, 0, padfFirstLineVal[nX - 1], dfDistance2,
-            oOpts.curveCoeff, dfSphereDiameter));
-        pabyResult[nX - 1] = oOpts.visibleVal;
-        if (oOpts.outputMode != OutputMode::Normal)
+            m_adfGeoTransform.data(), 1, 0, padfFirstLineVal[nX - 1],
+            m_dfDistance2, m_oOpts.curveCoeff, m_dfSphereDiameter));
+        pabyResult[nX - 1] = m_oOpts.visibleVal;
+        if (m_oOpts.outputMode != OutputMode::Normal)
             dfHeightResult[nX - 1] = dfGroundLevel;
     }
     if (nX < nXSize - 1)
     {
-        if (oOpts.outputMode == OutputMode::DEM)
+        if (m_oOpts.outputMode == OutputMode::DEM)
             dfGroundLevel = padfFirstLineVal[nX + 1];
         CPL_IGNORE_RET_VAL(AdjustHeightInRange(
-            adfGeoTransform.data(), 1, 0, padfFirstLineVal[nX + 1], dfDistance2,
-            oOpts.curveCoeff, dfSphereDiameter));
-        pabyResult[nX + 1] = oOpts.visibleVal;
-        if (oOpts.outputMode != OutputMode::Normal)
+            m_adfGeoTransform.data(), 1, 0, padfFirstLineVal[nX + 1],
+            m_dfDistance2, m_oOpts.curveCoeff, m_dfSphereDiameter));
+        pabyResult[nX + 1] = m_oOpts.visibleVal;
+        if (m_oOpts.outputMode != OutputMode::Normal)
             dfHeightResult[nX + 1] = dfGroundLevel;
     }
 
@@ -524,29 +585,29 @@ bool Viewshed::run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
     for (int iPixel = nX - 2; iPixel >= 0; iPixel--)
     {
         dfGroundLevel = 0;
-        if (oOpts.outputMode == OutputMode::DEM)
+        if (m_oOpts.outputMode == OutputMode::DEM)
             dfGroundLevel = padfFirstLineVal[iPixel];
 
-        if (AdjustHeightInRange(adfGeoTransform.data(), nX - iPixel, 0,
-                                padfFirstLineVal[iPixel], dfDistance2,
-                                oOpts.curveCoeff, dfSphereDiameter))
+        if (AdjustHeightInRange(m_adfGeoTransform.data(), nX - iPixel, 0,
+                                padfFirstLineVal[iPixel], m_dfDistance2,
+                                m_oOpts.curveCoeff, m_dfSphereDiameter))
         {
             double dfZ = CalcHeightLine(
-                nX - iPixel, padfFirstLineVal[iPixel + 1], dfZObserver);
+                nX - iPixel, padfFirstLineVal[iPixel + 1], m_dfZObserver);
 
-            if (oOpts.outputMode != OutputMode::Normal)
+            if (m_oOpts.outputMode != OutputMode::Normal)
                 dfHeightResult[iPixel] = std::max(
                     0.0, (dfZ - padfFirstLineVal[iPixel] + dfGroundLevel));
 
-            setVisibility(iPixel, dfZ, padfFirstLineVal, vResult);
+            setVisibility(iPixel, dfZ, padfFirstLineVal, pabyResult);
         }
         else
         {
             for (; iPixel >= 0; iPixel--)
             {
-                pabyResult[iPixel] = oOpts.outOfRangeVal;
-                if (oOpts.outputMode != OutputMode::Normal)
-                    dfHeightResult[iPixel] = oOpts.outOfRangeVal;
+                pabyResult[iPixel] = m_oOpts.outOfRangeVal;
+                if (m_oOpts.outputMode != OutputMode::Normal)
+                    dfHeightResult[iPixel] = m_oOpts.outOfRangeVal;
             }
         }
     }
@@ -554,373 +615,935 @@ bool Viewshed::run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
     for (int iPixel = nX + 2; iPixel < nXSize; iPixel++)
     {
         dfGroundLevel = 0;
-        if (oOpts.outputMode == OutputMode::DEM)
+        if (m_oOpts.outputMode == OutputMode::DEM)
             dfGroundLevel = padfFirstLineVal[iPixel];
-        if (AdjustHeightInRange(adfGeoTransform.data(), iPixel - nX, 0,
-                                padfFirstLineVal[iPixel], dfDistance2,
-                                oOpts.curveCoeff, dfSphereDiameter))
+        if (AdjustHeightInRange(m_adfGeoTransform.data(), iPixel - nX, 0,
+                                padfFirstLineVal[iPixel], m_dfDistance2,
+                                m_oOpts.curveCoeff, m_dfSphereDiameter))
         {
             double dfZ = CalcHeightLine(
-                iPixel - nX, padfFirstLineVal[iPixel - 1], dfZObserver);
+                iPixel - nX, padfFirstLineVal[iPixel - 1], m_dfZObserver);
 
-            if (oOpts.outputMode != OutputMode::Normal)
+            if (m_oOpts.outputMode != OutputMode::Normal)
                 dfHeightResult[iPixel] = std::max(
                     0.0, (dfZ - padfFirstLineVal[iPixel] + dfGroundLevel));
 
-            setVisibility(iPixel, dfZ, padfFirstLineVal, vResult);
+            setVisibility(iPixel, dfZ, padfFirstLineVal, pabyResult);
         }
         else
         {
             for (; iPixel < nXSize; iPixel++)
             {
-                pabyResult[iPixel] = oOpts.outOfRangeVal;
-                if (oOpts.outputMode != OutputMode::Normal)
-                    dfHeightResult[iPixel] = oOpts.outOfRangeVal;
+                pabyResult[iPixel] = m_oOpts.outOfRangeVal;
+                if (m_oOpts.outputMode != OutputMode::Normal)
+                    dfHeightResult[iPixel] = m_oOpts.outOfRangeVal;
             }
         }
     }
+
     /* write result line */
+    return m_pfnWriteLine(m_nY, 0, nXSize, pabyResult, dfHeightResult);
+}
+
+/// Set up the initial point of a line, in the column of the observer.
+void ViewshedExecutor::processCenter(int nDeltaY, double *padfThisLineVal,
+                                     const double *padfLastLineVal,
+                                     GByte *pabyResult,
+                                     double *padfHeightResult)
+{
+    using OutputMode = Viewshed::OutputMode;
+    const int nX = m_nX;
+
+    double dfGroundLevel = 0;
+    if (m_oOpts.outputMode == OutputMode::DEM)
+        dfGroundLevel = padfThisLineVal[nX];
 
-    void *data;
-    GDALDataType dataType;
-    if (oOpts.outputMode == OutputMode::Normal)
+    if (AdjustHeightInRange(m_adfGeoTransform.data(), 0, nDeltaY,
+                            padfThisLineVal[nX], m_dfDistance2,
+                            m_oOpts.curveCoeff, m_dfSphereDiameter))
     {
-        data = static_cast<void *>(pabyResult);
-        dataType = GDT_Byte;
+        double dfZ =
+            CalcHeightLine(nDeltaY, padfLastLineVal[nX], m_dfZObserver);
+
+        if (m_oOpts.outputMode != OutputMode::Normal)
+            padfHeightResult[nX] =
+                std::max(0.0, (dfZ - padfThisLineVal[nX] + dfGroundLevel));
+
+        setVisibility(nX, dfZ, padfThisLineVal, pabyResult);
     }
     else
     {
-        data = static_cast<void *>(dfHeightResult);
-        dataType = GDT_Float64;
-    }
-    if (GDALRasterIO(hTargetBand, GF_Write, 0, nY - nYStart, nXSize, 1, data,
-                     nXSize, 1, dataType, 0, 0))
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "RasterIO error when writing target raster at position "
-                 "(%d,%d), size (%d,%d)",
-                 0, nY - nYStart, nXSize, 1);
-        return false;
+        pabyResult[nX] = m_oOpts.outOfRangeVal;
+        if (m_oOpts.outputMode != OutputMode::Normal)
+            padfHeightResult[nX] = m_oOpts.outOfRangeVal;
     }
+}
 
-    /* scan upwards */
-    std::copy(vFirstLineVal.begin(), vFirstLineVal.end(), vLastLineVal.begin());
-    for (int iLine = nY - 1; iLine >= nYStart; iLine--)
-    {
-        if (GDALRasterIO(hBand, GF_Read, nXStart, iLine, nXSize, 1,
-                         padfThisLineVal, nXSize, 1, GDT_Float64, 0, 0))
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "RasterIO error when reading DEM at position (%d,%d), "
-                     "size (%d,%d)",
-                     nXStart, iLine, nXSize, 1);
-            return false;
-        }
+/// Process the pixels of a line left of the observer.
+void ViewshedExecutor::processLeft(int nDeltaY, double *padfThisLineVal,
+                                   const double *padfLastLineVal,
+                                   GByte *pabyResult, double *padfHeightResult)
+{
+    using OutputMode = Viewshed::OutputMode;
+    using CellMode = Viewshed::CellMode;
+    const int nX = m_nX;
 
-        /* set up initial point on the scanline */
-        dfGroundLevel = 0;
-        if (oOpts.outputMode == OutputMode::DEM)
-            dfGroundLevel = padfThisLineVal[nX];
-        if (AdjustHeightInRange(adfGeoTransform.data(), 0, nY - iLine,
-                                padfThisLineVal[nX], dfDistance2,
-                                oOpts.curveCoeff, dfSphereDiameter))
+    for (int iPixel = nX - 1; iPixel >= 0; iPixel--)
+    {
+        double dfGroundLevel = 0;
+        if (m_oOpts.outputMode == OutputMode::DEM)
+            dfGroundLevel = padfThisLineVal[iPixel];
+        if (AdjustHeightInRange(m_adfGeoTransform.data(), nX - iPixel,
+                                nDeltaY, padfThisLineVal[iPixel],
+                                m_dfDistance2, m_oOpts.curveCoeff,
+                                m_dfSphereDiameter))
         {
-            double dfZ =
-                CalcHeightLine(nY - iLine, padfLastLineVal[nX], dfZObserver);
-
-            if (oOpts.outputMode != OutputMode::Normal)
-                dfHeightResult[nX] =
-                    std::max(0.0, (dfZ - padfThisLineVal[nX] + dfGroundLevel));
-
-            setVisibility(nX, dfZ, padfThisLineVal, vResult);
+            double dfDiagZ = 0;
+            double dfEdgeZ = 0;
+            if (m_oOpts.cellMode != CellMode::Edge)
+                dfDiagZ = CalcHeightDiagonal(
+                    nX - iPixel, nDeltaY, padfThisLineVal[iPixel + 1],
+                    padfLastLineVal[iPixel], m_dfZObserver);
+
+            if (m_oOpts.cellMode != CellMode::Diagonal)
+                dfEdgeZ = nX - iPixel >= nDeltaY
+                              ? CalcHeightEdge(nDeltaY, nX - iPixel,
+                                               padfLastLineVal[iPixel + 1],
+                                               padfThisLineVal[iPixel + 1],
+                                               m_dfZObserver)
+                              : CalcHeightEdge(nX - iPixel, nDeltaY,
+                                               padfLastLineVal[iPixel + 1],
+                                               padfLastLineVal[iPixel],
+                                               m_dfZObserver);
+
+            double dfZ = calcHeight(dfDiagZ, dfEdgeZ);
+
+            if (m_oOpts.outputMode != OutputMode::Normal)
+                padfHeightResult[iPixel] = std::max(
+                    0.0, (dfZ - padfThisLineVal[iPixel] + dfGroundLevel));
+
+            setVisibility(iPixel, dfZ, padfThisLineVal, pabyResult);
         }
         else
         {
-            pabyResult[nX] = oOpts.outOfRangeVal;
-            if (oOpts.outputMode != OutputMode::Normal)
-                dfHeightResult[nX] = oOpts.outOfRangeVal;
-        }
-
-        /* process left direction */
-        for (int iPixel = nX - 1; iPixel >= 0; iPixel--)
-        {
-            dfGroundLevel = 0;
-            if (oOpts.outputMode == OutputMode::DEM)
-                dfGroundLevel = padfThisLineVal[iPixel];
-            if (AdjustHeightInRange(adfGeoTransform.data(), nX - iPixel,
-                                    nY - iLine, padfThisLineVal[iPixel],
-                                    dfDistance2, oOpts.curveCoeff,
-                                    dfSphereDiameter))
-            {
-                double dfDiagZ = 0;
-                double dfEdgeZ = 0;
-                if (oOpts.cellMode != CellMode::Edge)
-                    dfDiagZ = CalcHeightDiagonal(
-                        nX - iPixel, nY - iLine, padfThisLineVal[iPixel + 1],
-                        padfLastLineVal[iPixel], dfZObserver);
-
-                if (oOpts.cellMode != CellMode::Diagonal)
-                    dfEdgeZ = nX - iPixel >= nY - iLine
-                                  ? CalcHeightEdge(nY - iLine, nX - iPixel,
-                                                   padfLastLineVal[iPixel + 1],
-                                                   padfThisLineVal[iPixel + 1],
-                                                   dfZObserver)
-                                  : CalcHeightEdge(nX - iPixel, nY - iLine,
-                                                   padfLastLineVal[iPixel + 1],
-                                                   padfLastLineVal[iPixel],
-                                                   dfZObserver);
-
-                double dfZ = calcHeight(dfDiagZ, dfEdgeZ);
-
-                if (oOpts.outputMode != OutputMode::Normal)
-                    dfHeightResult[iPixel] = std::max(
-                        0.0, (dfZ - padfThisLineVal[iPixel] + dfGroundLevel));
-
-                setVisibility(iPixel, dfZ, padfThisLineVal, vResult);
-            }
-            else
-            {
-                for (; iPixel >= 0; iPixel--)
-                {
-                    pabyResult[iPixel] = oOpts.outOfRangeVal;
-                    if (oOpts.outputMode != OutputMode::Normal)
-                        dfHeightResult[iPixel] = oOpts.outOfRangeVal;
-                }
-            }
-        }
-        /* process right direction */
-        for (int iPixel = nX + 1; iPixel < nXSize; iPixel++)
-        {
-            dfGroundLevel = 0;
-            if (oOpts.outputMode == OutputMode::DEM)
-                dfGroundLevel = padfThisLineVal[iPixel];
-
-            if (AdjustHeightInRange(adfGeoTransform.data(), iPixel - nX,
-                                    nY - iLine, padfThisLineVal[iPixel],
-                                    dfDistance2, oOpts.curveCoeff,
-                                    dfSphereDiameter))
-            {
-                double dfDiagZ = 0;
-                double dfEdgeZ = 0;
-                if (oOpts.cellMode != CellMode::Edge)
-                    dfDiagZ = CalcHeightDiagonal(
-                        iPixel - nX, nY - iLine, padfThisLineVal[iPixel - 1],
-                        padfLastLineVal[iPixel], dfZObserver);
-                if (oOpts.cellMode != CellMode::Diagonal)
-                    dfEdgeZ = iPixel - nX >= nY - iLine
-                                  ? CalcHeightEdge(nY - iLine, iPixel - nX,
-                                                   padfLastLineVal[iPixel - 1],
-                                                   padfThisLineVal[iPixel - 1],
-                                                   dfZObserver)
-                                  : CalcHeightEdge(iPixel - nX, nY - iLine,
-                                                   padfLastLineVal[iPixel - 1],
-                                                   padfLastLineVal[iPixel],
-                                                   dfZObserver);
-
-                double dfZ = calcHeight(dfDiagZ, dfEdgeZ);
-
-                if (oOpts.outputMode != OutputMode::Normal)
-                    dfHeightResult[iPixel] = std::max(
-                        0.0, (dfZ - padfThisLineVal[iPixel] + dfGroundLevel));
-
-                setVisibility(iPixel, dfZ, padfThisLineVal, vResult);
-            }
-            else
+            for (; iPixel >= 0; iPixel--)
             {
-                for (; iPixel < nXSize; iPixel++)
-                {
-                    pabyResult[iPixel] = oOpts.outOfRangeVal;
-                    if (oOpts.outputMode != OutputMode::Normal)
-                        dfHeightResult[iPixel] = oOpts.outOfRangeVal;
-                }
+                pabyResult[iPixel] = m_oOpts.outOfRangeVal;
+                if (m_oOpts.outputMode != OutputMode::Normal)
+                    padfHeightResult[iPixel] = m_oOpts.outOfRangeVal;
             }
         }
-
-        /* write result line */
-        if (GDALRasterIO(hTargetBand, GF_Write, 0, iLine - nYStart, nXSize, 1,
-                         data, nXSize, 1, dataType, 0, 0))
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "RasterIO error when writing target raster at position "
-                     "(%d,%d), size (%d,%d)",
-                     0, iLine - nYStart, nXSize, 1);
-            return false;
-        }
-
-        std::swap(padfLastLineVal, padfThisLineVal);
-
-        if (!pfnProgress((nY - iLine) / static_cast<double>(nYSize), "",
-                         pProgressArg))
-        {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            return false;
-        }
     }
+}
 
-    /* scan downwards */
-    memcpy(padfLastLineVal, padfFirstLineVal, nXSize * sizeof(double));
-    for (int iLine = nY + 1; iLine < nYStop; iLine++)
-    {
-        if (GDALRasterIO(hBand, GF_Read, nXStart, iLine, nXSize, 1,
-                         padfThisLineVal, nXSize, 1, GDT_Float64, 0, 0))
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "RasterIO error when reading DEM at position (%d,%d), "
-                     "size (%d,%d)",
-                     nXStart, iLine, nXStop - nXStart, 1);
-            return false;
-        }
-
-        /* set up initial point on the scanline */
-        dfGroundLevel = 0;
-        if (oOpts.outputMode == OutputMode::DEM)
-            dfGroundLevel = padfThisLineVal[nX];
+/// Process the pixels of a line right of the observer.
+void ViewshedExecutor::processRight(int nDeltaY, double *padfThisLineVal,
+                                    const double *padfLastLineVal,
+                                    GByte *pabyResult,
+                                    double *padfHeightResult)
+{
+    using OutputMode = Viewshed::OutputMode;
+    using CellMode = Viewshed::CellMode;
+    const int nX = m_nX;
 
-        if (AdjustHeightInRange(adfGeoTransform.data(), 0, iLine - nY,
-                                padfThisLineVal[nX], dfDistance2,
-                                oOpts.curveCoeff, dfSphereDiameter))
+    for (int iPixel = nX + 1; iPixel < m_nXSize; iPixel++)
+    {
+        double dfGroundLevel = 0;
+        if (m_oOpts.outputMode == OutputMode::DEM)
+            dfGroundLevel = padfThisLineVal[iPixel];
+
+        if (AdjustHeightInRange(m_adfGeoTransform.data(), iPixel - nX,
+                                nDeltaY, padfThisLineVal[iPixel],
+                                m_dfDistance2, m_oOpts.curveCoeff,
+                                m_dfSphereDiameter))
         {
-            double dfZ =
-                CalcHeightLine(iLine - nY, padfLastLineVal[nX], dfZObserver);
-
-            if (oOpts.outputMode != OutputMode::Normal)
-                dfHeightResult[nX] =
-                    std::max(0.0, (dfZ - padfThisLineVal[nX] + dfGroundLevel));
-
-            setVisibility(nX, dfZ, padfThisLineVal, vResult);
+            double dfDiagZ = 0;
+            double dfEdgeZ = 0;
+            if (m_oOpts.cellMode != CellMode::Edge)
+                dfDiagZ = CalcHeightDiagonal(
+                    iPixel - nX, nDeltaY, padfThisLineVal[iPixel - 1],
+                    padfLastLineVal[iPixel], m_dfZObserver);
+
+            if (m_oOpts.cellMode != CellMode::Diagonal)
+                dfEdgeZ = iPixel - nX >= nDeltaY
+                              ? CalcHeightEdge(nDeltaY, iPixel - nX,
+                                               padfLastLineVal[iPixel - 1],
+                                               padfThisLineVal[iPixel - 1],
+                                               m_dfZObserver)
+                              : CalcHeightEdge(iPixel - nX, nDeltaY,
+                                               padfLastLineVal[iPixel - 1],
+                                               padfLastLineVal[iPixel],
+                                               m_dfZObserver);
+
+            double dfZ = calcHeight(dfDiagZ, dfEdgeZ);
+
+            if (m_oOpts.outputMode != OutputMode::Normal)
+                padfHeightResult[iPixel] = std::max(
+                    0.0, (dfZ - padfThisLineVal[iPixel] + dfGroundLevel));
+
+            setVisibility(iPixel, dfZ, padfThisLineVal, pabyResult);
         }
         else
         {
-            pabyResult[nX] = oOpts.outOfRangeVal;
-            if (oOpts.outputMode != OutputMode::Normal)
-                dfHeightResult[nX] = oOpts.outOfRangeVal;
-        }
-
-        /* process left direction */
-        for (int iPixel = nX - 1; iPixel >= 0; iPixel--)
-        {
-            dfGroundLevel = 0;
-            if (oOpts.outputMode == OutputMode::DEM)
-                dfGroundLevel = padfThisLineVal[iPixel];
-
-            if (AdjustHeightInRange(adfGeoTransform.data(), nX - iPixel,
-                                    iLine - nY, padfThisLineVal[iPixel],
-                                    dfDistance2, oOpts.curveCoeff,
-                                    dfSphereDiameter))
-            {
-                double dfDiagZ = 0;
-                double dfEdgeZ = 0;
-                if (oOpts.cellMode != CellMode::Edge)
-                    dfDiagZ = CalcHeightDiagonal(
-                        nX - iPixel, iLine - nY, padfThisLineVal[iPixel + 1],
-                        padfLastLineVal[iPixel], dfZObserver);
-
-                if (oOpts.cellMode != CellMode::Diagonal)
-                    dfEdgeZ = nX - iPixel >= iLine - nY
-                                  ? CalcHeightEdge(iLine - nY, nX - iPixel,
-                                                   padfLastLineVal[iPixel + 1],
-                                                   padfThisLineVal[iPixel + 1],
-                                                   dfZObserver)
-                                  : CalcHeightEdge(nX - iPixel, iLine - nY,
-                                                   padfLastLineVal[iPixel + 1],
-                                                   padfLastLineVal[iPixel],
-                                                   dfZObserver);
-
-                double dfZ = calcHeight(dfDiagZ, dfEdgeZ);
-
-                if (oOpts.outputMode != OutputMode::Normal)
-                    dfHeightResult[iPixel] = std::max(
-                        0.0, (dfZ - padfThisLineVal[iPixel] + dfGroundLevel));
-
-                setVisibility(iPixel, dfZ, padfThisLineVal, vResult);
-            }
-            else
-            {
-                for (; iPixel >= 0; iPixel--)
-                {
-                    pabyResult[iPixel] = oOpts.outOfRangeVal;
-                    if (oOpts.outputMode != OutputMode::Normal)
-                        dfHeightResult[iPixel] = oOpts.outOfRangeVal;
-                }
-            }
-        }
-        /* process right direction */
-        for (int iPixel = nX + 1; iPixel < nXSize; iPixel++)
-        {
-            dfGroundLevel = 0;
-            if (oOpts.outputMode == OutputMode::DEM)
-                dfGroundLevel = padfThisLineVal[iPixel];
-
-            if (AdjustHeightInRange(adfGeoTransform.data(), iPixel - nX,
-                                    iLine - nY, padfThisLineVal[iPixel],
-                                    dfDistance2, oOpts.curveCoeff,
-                                    dfSphereDiameter))
-            {
-                double dfDiagZ = 0;
-                double dfEdgeZ = 0;
-                if (oOpts.cellMode != CellMode::Edge)
-                    dfDiagZ = CalcHeightDiagonal(
-                        iPixel - nX, iLine - nY, padfThisLineVal[iPixel - 1],
-                        padfLastLineVal[iPixel], dfZObserver);
-
-                if (oOpts.cellMode != CellMode::Diagonal)
-                    dfEdgeZ = iPixel - nX >= iLine - nY
-                                  ? CalcHeightEdge(iLine - nY, iPixel - nX,
-                                                   padfLastLineVal[iPixel - 1],
-                                                   padfThisLineVal[iPixel - 1],
-                                                   dfZObserver)
-                                  : CalcHeightEdge(iPixel - nX, iLine - nY,
-                                                   padfLastLineVal[iPixel - 1],
-                                                   padfLastLineVal[iPixel],
-                                                   dfZObserver);
-
-                double dfZ = calcHeight(dfDiagZ, dfEdgeZ);
-
-                if (oOpts.outputMode != OutputMode::Normal)
-                    dfHeightResult[iPixel] = std::max(
-                        0.0, (dfZ - padfThisLineVal[iPixel] + dfGroundLevel));
-
-                setVisibility(iPixel, dfZ, padfThisLineVal, vResult);
-            }
-            else
+            for (; iPixel < m_nXSize; iPixel++)
             {
-                for (; iPixel < nXSize; iPixel++)
-                {
-                    pabyResult[iPixel] = oOpts.outOfRangeVal;
-                    if (oOpts.outputMode != OutputMode::Normal)
-                        dfHeightResult[iPixel] = oOpts.outOfRangeVal;
-                }
+                pabyResult[iPixel] = m_oOpts.outOfRangeVal;
+                if (m_oOpts.outputMode != OutputMode::Normal)
+                    padfHeightResult[iPixel] = m_oOpts.outOfRangeVal;
             }
         }
-
-        /* write result line */
-        if (GDALRasterIO(hTargetBand, GF_Write, 0, iLine - nYStart, nXSize, 1,
-                         data, nXSize, 1, dataType, 0, 0))
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "RasterIO error when writing target raster at position "
-                     "(%d,%d), size (%d,%d)",
-                     0, iLine - nYStart, nXSize, 1);
-            return false;
-        }
-
-        std::swap(padfLastLineVal, padfThisLineVal);
-
-        if (!pfnProgress((iLine - nYStart) / static_cast<double>(nYSize), "",
-                         pProgressArg))
-        {
-            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            return false;
-        }
     }
+}
 
-    if (!pfnProgress(1.0, "", pProgressArg))
+/// Account for a processed line, and report progress. May be called from
+/// several threads.
+bool ViewshedExecutor::reportLineDone()
+{
+    std::lock_guard<std::mutex> oLock(m_oProgressMutex);
+    if (m_bStop)
+        return false;
+    ++m_nLinesDone;
+    if (!m_pfnProgress(static_cast<double>(m_nLinesDone) / m_nLinesTotal, "",
+                       m_pProgressArg))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        m_bStop = true;
         return false;
     }
-
     return true;
 }
 
+/// Process the lines above (bUp) or below the observer line, for the
+/// columns selected by eColumns.
+bool ViewshedExecutor::processLines(bool bUp, Columns eColumns)
+{
+    std::vector<double> vLastLineVal;
+    std::vector<double> vThisLineVal;
+    std::vector<GByte> vResult;
+    std::vector<double> vHeightResult;
+
+    try
+    {
+        vLastLineVal = m_vFirstLineVal;
+        vThisLineVal.resize(m_nXSize);
+        vResult.resize(m_nXSize);
+
+        if (m_oOpts.outputMode != Viewshed::OutputMode::Normal)
+            vHeightResult.resize(m_nXSize);
+    }
+    catch (...)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot allocate vectors for viewshed");
+        return false;
+    }
+
+    double *padfLastLineVal = vLastLineVal.data();
+    double *padfThisLineVal = vThisLineVal.data();
+    GByte *pabyResult = vResult.data();
+    double *padfHeightResult = vHeightResult.data();
+
+    // Columns read and written. The column of the observer is needed by
+    // both sides, but only written by the right one.
+    int nReadXOff = 0;
+    int nReadXCount = m_nXSize;
+    int nWriteXOff = 0;
+    int nWriteXCount = m_nXSize;
+    if (eColumns == Columns::Left)
+    {
+        nReadXCount = m_nX + 1;
+        nWriteXCount = m_nX;
+    }
+    else if (eColumns == Columns::Right)
+    {
+        nReadXOff = m_nX;
+        nReadXCount = m_nXSize - m_nX;
+        nWriteXOff = m_nX;
+        nWriteXCount = m_nXSize - m_nX;
+    }
+
+    const int nStep = bUp ? -1 : 1;
+    const int nLineStop = bUp ? -1 : m_nYSize;
+    for (int iLine = m_nY + nStep; iLine != nLineStop; iLine += nStep)
+    {
+        if (m_bStop)
+            return false;
+
+        if (!m_pfnReadLine(iLine, nReadXOff, nReadXCount,
+                           padfThisLineVal + nReadXOff))
+            return false;
+
+        const int nDeltaY = bUp ? m_nY - iLine : iLine - m_nY;
+        processCenter(nDeltaY, padfThisLineVal, padfLastLineVal, pabyResult,
+                      padfHeightResult);
+        if (eColumns != Columns::Right)
+            processLeft(nDeltaY, padfThisLineVal, padfLastLineVal, pabyResult,
+                        padfHeightResult);
+        if (eColumns != Columns::Left)
+            processRight(nDeltaY, padfThisLineVal, padfLastLineVal,
+                         pabyResult, padfHeightResult);
+
+        /* write result line */
+        if (!m_pfnWriteLine(
+                iLine, nWriteXOff, nWriteXCount, pabyResult + nWriteXOff,
+                padfHeightResult ? padfHeightResult + nWriteXOff : nullptr))
+            return false;
+
+        std::swap(padfLastLineVal, padfThisLineVal);
+
+        if (!reportLineDone())
+            return false;
+    }
+
+    return true;
+}
+
+void ViewshedExecutor::JobFunc(void *pData)
+{
+    Job *psJob = static_cast<Job *>(pData);
+    psJob->bOK = psJob->poExecutor->processLines(psJob->bUp, psJob->eColumns);
+    if (!psJob->bOK)
+        psJob->poExecutor->m_bStop = true;
+}
+
+bool ViewshedExecutor::run(int nThreads, GDALProgressFunc pfnProgress,
+                           void *pProgressArg)
+{
+    std::vector<GByte> vResult;
+    std::vector<double> vHeightResult;
+
+    try
+    {
+        m_vFirstLineVal.resize(m_nXSize);
+        vResult.resize(m_nXSize);
+
+        if (m_oOpts.outputMode != Viewshed::OutputMode::Normal)
+            vHeightResult.resize(m_nXSize);
+    }
+    catch (...)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot allocate vectors for viewshed");
+        return false;
+    }
+
+    if (!processFirstLine(vResult, vHeightResult))
+        return false;
+
+    m_pfnProgress = pfnProgress;
+    m_pProgressArg = pProgressArg;
+
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1 && m_nYSize > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    // The quadrants left of the observer are only worth a job of their own
+    // when there is something left of it.
+    std::vector<Job> asJobs;
+    for (const bool bUp : {true, false})
+    {
+        if (poJobQueue && m_nX > 0)
+        {
+            asJobs.push_back({this, bUp, Columns::Left, true});
+            asJobs.push_back({this, bUp, Columns::Right, true});
+        }
+        else
+        {
+            asJobs.push_back({this, bUp, Columns::Both, true});
+        }
+    }
+
+    m_nLinesTotal =
+        1 + static_cast<int>(asJobs.size() / 2) * (m_nYSize - 1);
+    m_nLinesDone = 1;
+    if (!m_pfnProgress(1.0 / m_nLinesTotal, "", m_pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+
+    bool bOK = true;
+    if (poJobQueue)
+    {
+        for (auto &sJob : asJobs)
+            poJobQueue->SubmitJob(JobFunc, &sJob);
+        poJobQueue->WaitCompletion();
+        for (const auto &sJob : asJobs)
+            bOK = bOK && sJob.bOK;
+    }
+    else
+    {
+        for (auto &sJob : asJobs)
+        {
+            JobFunc(&sJob);
+            if (!sJob.bOK)
+            {
+                bOK = false;
+                break;
+            }
+        }
+    }
+
+    return bOK && !m_bStop;
+}
+
+/************************************************************************/
+/*                       Cumulative viewshed helpers                    */
+/************************************************************************/
+
+/// Observer of a cumulative viewshed, with its processing window.
+struct ObserverWindow
+{
+    Viewshed::Point oObserver{0, 0, 0};
+    int nX = 0;
+    int nY = 0;
+    Window oWindow{};
+};
+
+/// State shared by the observers of a cumulative viewshed.
+struct CumulativeState
+{
+    explicit CumulativeState(const Viewshed::Options &oOptsIn) : oOpts(oOptsIn)
+    {
+        // Each observer is computed with visible cells set to 1 and all
+        // other cells to 0, and added to the counts.
+        oOpts.visibleVal = 1;
+        oOpts.invisibleVal = 0;
+        oOpts.outOfRangeVal = 0;
+    }
+
+    Viewshed::Options oOpts;
+    std::array<double, 6> adfGeoTransform{};
+    double dfSphereDiameter = 0;
+    Window oUnion{};
+    std::vector<ObserverWindow> aoWindows{};
+    std::vector<double> adfDEM{};
+    std::unique_ptr<std::atomic<uint32_t>[]> panCounts{};
+
+    std::mutex oProgressMutex{};
+    GDALProgressFunc pfnProgress = nullptr;
+    void *pProgressArg = nullptr;
+    size_t nObserversDone = 0;
+    std::atomic<bool> bStop{false};
+
+    CPL_DISALLOW_COPY_ASSIGN(CumulativeState)
+};
+
+/// Compute the viewshed of one observer, and add it to the counts.
+/// May be called concurrently for different observers.
+bool AccumulateObserver(const CumulativeState &sState, size_t iObserver,
+                        int nThreads, GDALProgressFunc pfnProgress,
+                        void *pProgressArg)
+{
+    const ObserverWindow &sWindow = sState.aoWindows[iObserver];
+    const int nUnionXSize = sState.oUnion.xSize();
+    const int nXOffInUnion = sWindow.oWindow.nXStart - sState.oUnion.nXStart;
+    const int nYOffInUnion = sWindow.oWindow.nYStart - sState.oUnion.nYStart;
+    const double *padfDEM = sState.adfDEM.data();
+    std::atomic<uint32_t> *panCounts = sState.panCounts.get();
+
+    auto readLine = [padfDEM, nUnionXSize, nXOffInUnion,
+                     nYOffInUnion](int iLine, int nXOff, int nXCount,
+                                   double *padfLine)
+    {
+        const double *padfSrc =
+            padfDEM + static_cast<size_t>(nYOffInUnion + iLine) * nUnionXSize +
+            nXOffInUnion + nXOff;
+        std::copy(padfSrc, padfSrc + nXCount, padfLine);
+        return true;
+    };
+
+    // Windows of different observers overlap: counts are updated
+    // atomically.
+    auto writeLine = [panCounts, nUnionXSize, nXOffInUnion, nYOffInUnion](
+                         int iLine, int nXOff, int nXCount,
+                         const GByte *pabyResult, const double *)
+    {
+        std::atomic<uint32_t> *panDst =
+            panCounts +
+            static_cast<size_t>(nYOffInUnion + iLine) * nUnionXSize +
+            nXOffInUnion + nXOff;
+        for (int j = 0; j < nXCount; ++j)
+        {
+            if (pabyResult[j])
+                panDst[j].fetch_add(1, std::memory_order_relaxed);
+        }
+        return true;
+    };
+
+    Viewshed::Options oOpts(sState.oOpts);
+    oOpts.observer = sWindow.oObserver;
+    ViewshedExecutor oExecutor(
+        oOpts, sState.adfGeoTransform.data(), sWindow.oWindow.xSize(),
+        sWindow.oWindow.ySize(), sWindow.nX - sWindow.oWindow.nXStart,
+        sWindow.nY - sWindow.oWindow.nYStart, sState.dfSphereDiameter,
+        readLine, writeLine);
+    return oExecutor.run(nThreads, pfnProgress, pProgressArg);
+}
+
+struct CumulativeJob
+{
+    CumulativeState *psState = nullptr;
+    size_t iObserver = 0;
+    bool bOK = true;
+};
+
+void CumulativeJobFunc(void *pData)
+{
+    CumulativeJob *psJob = static_cast<CumulativeJob *>(pData);
+    CumulativeState &sState = *(psJob->psState);
+    if (sState.bStop)
+    {
+        psJob->bOK = false;
+        return;
+    }
+
+    psJob->bOK = AccumulateObserver(sState, psJob->iObserver, 1,
+                                    GDALDummyProgress, nullptr);
+
+    std::lock_guard<std::mutex> oLock(sState.oProgressMutex);
+    if (!psJob->bOK || sState.bStop)
+    {
+        sState.bStop = true;
+        return;
+    }
+    ++sState.nObserversDone;
+    if (!sState.pfnProgress(static_cast<double>(sState.nObserversDone) /
+                                sState.aoWindows.size(),
+                            "", sState.pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        sState.bStop = true;
+        psJob->bOK = false;
+    }
+}
+
+}  // unnamed namespace
+
+/// Fetch the geotransform of the dataset of hBand and its inverse.
+bool Viewshed::getTransforms(GDALRasterBandH hBand, double *adfGeoTransform,
+                             double *adfInvGeoTransform)
+{
+    /* set up geotransformation */
+    const double adfDefaultGeoTransform[6] = {0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+    std::copy(std::begin(adfDefaultGeoTransform),
+              std::end(adfDefaultGeoTransform), adfGeoTransform);
+    GDALDatasetH hSrcDS = GDALGetBandDataset(hBand);
+    if (hSrcDS != nullptr)
+        GDALGetGeoTransform(hSrcDS, adfGeoTransform);
+
+    if (!GDALInvGeoTransform(adfGeoTransform, adfInvGeoTransform))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot invert geotransform");
+        return false;
+    }
+    return true;
+}
+
+/// Create poDstDS, covering the nXSize x nYSize window of hBand starting
+/// at (nXStart, nYStart).
+bool Viewshed::createOutputDataset(GDALRasterBandH hBand,
+                                   const double *adfGeoTransform, int nXStart,
+                                   int nYStart, int nXSize, int nYSize,
+                                   GDALDataType eType)
+{
+    GDALDriverManager *hMgr = GetGDALDriverManager();
+    GDALDriver *hDriver = hMgr->GetDriverByName(oOpts.outputFormat.c_str());
+    if (!hDriver)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot get driver");
+        return false;
+    }
+
+    /* create output raster */
+    poDstDS.reset(hDriver->Create(
+        oOpts.outputFilename.c_str(), nXSize, nYSize, 1, eType,
+        const_cast<char **>(oOpts.creationOpts.List())));
+    if (!poDstDS)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create dataset for %s",
+                 oOpts.outputFilename.c_str());
+        return false;
+    }
+    /* copy srs */
+    GDALDatasetH hSrcDS = GDALGetBandDataset(hBand);
+    if (hSrcDS)
+        poDstDS->SetSpatialRef(
+            GDALDataset::FromHandle(hSrcDS)->GetSpatialRef());
+
+    std::array<double, 6> adfDstGeoTransform;
+    adfDstGeoTransform[0] = adfGeoTransform[0] + adfGeoTransform[1] * nXStart +
+                            adfGeoTransform[2] * nYStart;
+    adfDstGeoTransform[1] = adfGeoTransform[1];
+    adfDstGeoTransform[2] = adfGeoTransform[2];
+    adfDstGeoTransform[3] = adfGeoTransform[3] + adfGeoTransform[4] * nXStart +
+                            adfGeoTransform[5] * nYStart;
+    adfDstGeoTransform[4] = adfGeoTransform[4];
+    adfDstGeoTransform[5] = adfGeoTransform[5];
+    poDstDS->SetGeoTransform(adfDstGeoTransform.data());
+
+    auto hTargetBand = poDstDS->GetRasterBand(1);
+    if (hTargetBand == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot get band for %s",
+                 oOpts.outputFilename.c_str());
+        return false;
+    }
+
+    if (oOpts.nodataVal >= 0)
+        GDALSetRasterNoDataValue(hTargetBand, oOpts.nodataVal);
+
+    return true;
+}
+
+bool Viewshed::run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
+                   void *pProgressArg)
+{
+    if (!pfnProgress)
+        pfnProgress = GDALDummyProgress;
+
+    if (!pfnProgress(0.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+
+    std::array<double, 6> adfGeoTransform;
+    double adfInvGeoTransform[6];
+    if (!getTransforms(hBand, adfGeoTransform.data(), adfInvGeoTransform))
+        return false;
+
+    int nX = 0;
+    int nY = 0;
+    Window oWindow;
+    if (!CalcObserverWindow(oOpts, oOpts.observer, adfInvGeoTransform,
+                            GDALGetRasterBandXSize(hBand),
+                            GDALGetRasterBandYSize(hBand), CE_Failure, nX, nY,
+                            oWindow))
+        return false;
+
+    if (!createOutputDataset(
+            hBand, adfGeoTransform.data(), oWindow.nXStart, oWindow.nYStart,
+            oWindow.xSize(), oWindow.ySize(),
+            oOpts.outputMode == OutputMode::Normal ? GDT_Byte : GDT_Float64))
+        return false;
+
+    GDALRasterBandH hTargetBand = poDstDS->GetRasterBand(1);
+    const double dfSphereDiameter =
+        GetSphereDiameter(poDstDS->GetSpatialRef());
+
+    // Quadrants may be processed concurrently: serialize accesses to the
+    // source and target bands.
+    std::mutex oIOMutex;
+    auto readLine = [hBand, &oWindow, &oIOMutex](int iLine, int nXOff,
+                                                 int nXCount, double *padfLine)
+    {
+        std::lock_guard<std::mutex> oLock(oIOMutex);
+        if (GDALRasterIO(hBand, GF_Read, oWindow.nXStart + nXOff,
+                         oWindow.nYStart + iLine, nXCount, 1, padfLine,
+                         nXCount, 1, GDT_Float64, 0, 0))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "RasterIO error when reading DEM at position (%d,%d), "
+                     "size (%d,%d)",
+                     oWindow.nXStart + nXOff, oWindow.nYStart + iLine,
+                     nXCount, 1);
+            return false;
+        }
+        return true;
+    };
+
+    const bool bHeightOutput = oOpts.outputMode != OutputMode::Normal;
+    auto writeLine = [hTargetBand, bHeightOutput, &oIOMutex](
+                         int iLine, int nXOff, int nXCount,
+                         const GByte *pabyResult, const double *padfHeight)
+    {
+        std::lock_guard<std::mutex> oLock(oIOMutex);
+        if (GDALRasterIO(
+                hTargetBand, GF_Write, nXOff, iLine, nXCount, 1,
+                bHeightOutput ? static_cast<void *>(
+                                    const_cast<double *>(padfHeight))
+                              : static_cast<void *>(
+                                    const_cast<GByte *>(pabyResult)),
+                nXCount, 1, bHeightOutput ? GDT_Float64 : GDT_Byte, 0, 0))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "RasterIO error when writing target raster at position "
+                     "(%d,%d), size (%d,%d)",
+                     nXOff, iLine, nXCount, 1);
+            return false;
+        }
+        return true;
+    };
+
+    ViewshedExecutor oExecutor(oOpts, adfGeoTransform.data(), oWindow.xSize(),
+                               oWindow.ySize(), nX - oWindow.nXStart,
+                               nY - oWindow.nYStart, dfSphereDiameter,
+                               readLine, writeLine);
+    if (!oExecutor.run(GetNumThreads(oOpts.numThreads), pfnProgress,
+                       pProgressArg))
+        return false;
+
+    if (!pfnProgress(1.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+
+    return true;
+}
+
+bool Viewshed::runCumulative(GDALRasterBandH hBand,
+                             const std::vector<Point> &aoObservers,
+                             GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    if (!pfnProgress)
+        pfnProgress = GDALDummyProgress;
+
+    if (!pfnProgress(0.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+
+    if (oOpts.outputMode != OutputMode::Normal)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Cumulative viewshed is only supported with the normal "
+                 "output mode");
+        return false;
+    }
+
+    CumulativeState sState(oOpts);
+    double adfInvGeoTransform[6];
+    if (!getTransforms(hBand, sState.adfGeoTransform.data(),
+                       adfInvGeoTransform))
+        return false;
+
+    /* compute the window of each observer, and their union */
+    Window &oUnion = sState.oUnion;
+    oUnion.nXStart = std::numeric_limits<int>::max();
+    oUnion.nYStart = std::numeric_limits<int>::max();
+    for (const auto &oObserver : aoObservers)
+    {
+        ObserverWindow sWindow;
+        sWindow.oObserver = oObserver;
+        if (!CalcObserverWindow(oOpts, oObserver, adfInvGeoTransform,
+                                GDALGetRasterBandXSize(hBand),
+                                GDALGetRasterBandYSize(hBand), CE_Debug,
+                                sWindow.nX, sWindow.nY, sWindow.oWindow))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping observer at (%.17g,%.17g)", oObserver.x,
+                     oObserver.y);
+            continue;
+        }
+        oUnion.nXStart = std::min(oUnion.nXStart, sWindow.oWindow.nXStart);
+        oUnion.nYStart = std::min(oUnion.nYStart, sWindow.oWindow.nYStart);
+        oUnion.nXStop = std::max(oUnion.nXStop, sWindow.oWindow.nXStop);
+        oUnion.nYStop = std::max(oUnion.nYStop, sWindow.oWindow.nYStop);
+        sState.aoWindows.push_back(sWindow);
+    }
+
+    if (sState.aoWindows.empty())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "No observer location falls inside of the DEM area");
+        return false;
+    }
+
+    /* load the DEM once for all observers */
+    const int nUnionXSize = oUnion.xSize();
+    const int nUnionYSize = oUnion.ySize();
+    const size_t nPixels = static_cast<size_t>(nUnionXSize) * nUnionYSize;
+    std::vector<uint32_t> anCountsLine;
+    try
+    {
+        sState.adfDEM.resize(nPixels);
+        sState.panCounts.reset(new std::atomic<uint32_t>[nPixels]());
+        anCountsLine.resize(nUnionXSize);
+    }
+    catch (...)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate %d x %d DEM window for cumulative viewshed",
+                 nUnionXSize, nUnionYSize);
+        return false;
+    }
+
+    if (GDALRasterIO(hBand, GF_Read, oUnion.nXStart, oUnion.nYStart,
+                     nUnionXSize, nUnionYSize, sState.adfDEM.data(),
+                     nUnionXSize, nUnionYSize, GDT_Float64, 0, 0))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "RasterIO error when reading DEM at position (%d,%d), "
+                 "size (%d,%d)",
+                 oUnion.nXStart, oUnion.nYStart, nUnionXSize, nUnionYSize);
+        return false;
+    }
+
+    if (!createOutputDataset(hBand, sState.adfGeoTransform.data(),
+                             oUnion.nXStart, oUnion.nYStart, nUnionXSize,
+                             nUnionYSize, GDT_UInt32))
+        return false;
+
+    sState.dfSphereDiameter = GetSphereDiameter(poDstDS->GetSpatialRef());
+    const int nThreads = GetNumThreads(oOpts.numThreads);
+    const size_t nObservers = sState.aoWindows.size();
+
+    // Observers are processed concurrently, one per job. A single observer
+    // can still have its quadrants processed in parallel.
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1 && nObservers > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    if (poJobQueue)
+    {
+        sState.pfnProgress = pfnProgress;
+        sState.pProgressArg = pProgressArg;
+        std::vector<CumulativeJob> asJobs(nObservers);
+        for (size_t i = 0; i < nObservers; ++i)
+        {
+            asJobs[i].psState = &sState;
+            asJobs[i].iObserver = i;
+            poJobQueue->SubmitJob(CumulativeJobFunc, &asJobs[i]);
+        }
+        poJobQueue->WaitCompletion();
+        if (sState.bStop)
+            return false;
+    }
+    else
+    {
+        for (size_t i = 0; i < nObservers; ++i)
+        {
+            std::unique_ptr<void, decltype(&GDALDestroyScaledProgress)>
+                pScaledProgress(
+                    GDALCreateScaledProgress(
+                        static_cast<double>(i) / nObservers,
+                        static_cast<double>(i + 1) / nObservers, pfnProgress,
+                        pProgressArg),
+                    GDALDestroyScaledProgress);
+            if (!AccumulateObserver(sState, i, nThreads, GDALScaledProgress,
+                                    pScaledProgress.get()))
+                return false;
+        }
+    }
+
+    GDALRasterBand *poTargetBand = poDstDS->GetRasterBand(1);
+    for (int iLine = 0; iLine < nUnionYSize; ++iLine)
+    {
+        const std::atomic<uint32_t> *panSrc =
+            sState.panCounts.get() + static_cast<size_t>(iLine) * nUnionXSize;
+        for (int j = 0; j < nUnionXSize; ++j)
+            anCountsLine[j] = panSrc[j].load(std::memory_order_relaxed);
+        if (poTargetBand->RasterIO(GF_Write, 0, iLine, nUnionXSize, 1,
+                                   anCountsLine.data(), nUnionXSize, 1,
+                                   GDT_UInt32, 0, 0, nullptr) != CE_None)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "RasterIO error when writing target raster at position "
+                     "(%d,%d), size (%d,%d)",
+                     0, iLine, nUnionXSize, 1);
+            return false;
+        }
+    }
+
+    if (!pfnProgress(1.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+
+    return true;
+}
+
+bool Viewshed::runCumulative(GDALRasterBandH hBand, OGRLayerH hObserverLayer,
+                             const char *pszHeightField,
+                             GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    OGRLayer *poLayer = OGRLayer::FromHandle(hObserverLayer);
+
+    int iHeightField = -1;
+    if (pszHeightField && pszHeightField[0])
+    {
+        iHeightField = poLayer->GetLayerDefn()->GetFieldIndex(pszHeightField);
+        if (iHeightField < 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Field %s does not exist in layer %s", pszHeightField,
+                     poLayer->GetName());
+            return false;
+        }
+    }
+
+    /* reproject observers to the DEM SRS if needed */
+    std::unique_ptr<OGRCoordinateTransformation> poCT;
+    const OGRSpatialReference *poLayerSRS = poLayer->GetSpatialRef();
+    GDALDatasetH hSrcDS = GDALGetBandDataset(hBand);
+    const OGRSpatialReference *poDEMSRS =
+        hSrcDS ? GDALDataset::FromHandle(hSrcDS)->GetSpatialRef() : nullptr;
+    if (poLayerSRS && poDEMSRS && !poLayerSRS->IsSame(poDEMSRS))
+    {
+        poCT.reset(OGRCreateCoordinateTransformation(poLayerSRS, poDEMSRS));
+        if (!poCT)
+            return false;
+    }
+
+    std::vector<Point> aoObservers;
+    bool bWarnedNonPoint = false;
+    for (auto &&poFeature : *poLayer)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (!poGeom || poGeom->IsEmpty())
+            continue;
+
+        const double dfHeight = iHeightField >= 0
+                                    ? poFeature->GetFieldAsDouble(iHeightField)
+                                    : oOpts.observer.z;
+        const auto addObserver = [&aoObservers, &poCT,
+                                  dfHeight](const OGRPoint *poPoint)
+        {
+            double dfX = poPoint->getX();
+            double dfY = poPoint->getY();
+            if (poCT && !poCT->Transform(1, &dfX, &dfY))
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Cannot reproject observer at (%.17g,%.17g)",
+                         poPoint->getX(), poPoint->getY());
+                return;
+            }
+            aoObservers.push_back({dfX, dfY, dfHeight});
+        };
+
+        const auto eType = wkbFlatten(poGeom->getGeometryType());
+        if (eType == wkbPoint)
+        {
+            addObserver(poGeom->toPoint());
+        }
+        else if (eType == wkbMultiPoint)
+        {
+            for (const OGRPoint *poPoint : *(poGeom->toMultiPoint()))
+                addObserver(poPoint);
+        }
+        else if (!bWarnedNonPoint)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Layer %s contains non-point geometries, which are "
+                     "ignored",
+                     poLayer->GetName());
+            bWarnedNonPoint = true;
+        }
+    }
+
+    return runCumulative(hBand, aoObservers, pfnProgress, pProgressArg);
+}
+
 }  // namespace gdal
@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpl_progress.h"
 #include "gdal_priv.h"
@@ -95,6 +96,10 @@ class Viewshed
         CPLStringList creationOpts{};  //!< options for output raster creation
         CellMode cellMode{
             CellMode::Edge};  //!< Mode of cell height calculation.
+        int numThreads{
+            0};  //!< Number of threads used to process the quadrants around
+                 //!< an observer. 0 to use the GDAL_NUM_THREADS
+                 //!< configuration option (default to 1).
     };
 
     /**
@@ -116,6 +121,48 @@ class Viewshed
     CPL_DLL bool run(GDALRasterBandH hBand, GDALProgressFunc pfnProgress,
                      void *pProgressArg = nullptr);
 
+    /**
+     * Create a cumulative viewshed for several observers.
+     *
+     * The value of each cell of the output UInt32 raster is the number of
+     * observers from which it is visible. The output covers the union of the
+     * areas processed for each observer, which is read from hBand once.
+     * Observers are processed concurrently when numThreads is greater than 1.
+     * The observer member of the options is ignored, and the output mode must
+     * be Normal. Observers outside of the DEM are skipped with a warning.
+     *
+     * @param hBand  Handle to the raster band.
+     * @param aoObservers  Observers. Their z value is the height above the DEM.
+     * @param pfnProgress  Progress reporting callback function.
+     * @param pProgressArg  Argument to pass to the progress callback.
+     * @since GDAL 3.10
+    */
+    CPL_DLL bool runCumulative(GDALRasterBandH hBand,
+                               const std::vector<Point> &aoObservers,
+                               GDALProgressFunc pfnProgress,
+                               void *pProgressArg = nullptr);
+
+    /**
+     * Create a cumulative viewshed for the observers of a vector layer.
+     *
+     * Point and multipoint geometries of the layer are used as observers,
+     * reprojected to the spatial reference system of the DEM if needed.
+     * See the other overload for the output.
+     *
+     * @param hBand  Handle to the raster band.
+     * @param hObserverLayer  Handle to the layer of observers.
+     * @param pszHeightField  Name of the field containing the height of each
+     *                        observer above the DEM, or nullptr to use the z
+     *                        value of the observer member of the options.
+     * @param pfnProgress  Progress reporting callback function.
+     * @param pProgressArg  Argument to pass to the progress callback.
+     * @since GDAL 3.10
+    */
+    CPL_DLL bool runCumulative(GDALRasterBandH hBand, OGRLayerH hObserverLayer,
+                               const char *pszHeightField,
+                               GDALProgressFunc pfnProgress,
+                               void *pProgressArg = nullptr);
+
     /**
      * Fetch a pointer to the created raster band.
      *
@@ -130,9 +177,12 @@ class Viewshed
     Options oOpts;
     std::unique_ptr<GDALDataset> poDstDS;
 
-    void setVisibility(int iPixel, double dfZ, double *padfZVal,
-                       std::vector<GByte> &vResult);
-    double calcHeight(double dfZ, double dfZ2);
+    static bool getTransforms(GDALRasterBandH hBand, double *adfGeoTransform,
+                              double *adfInvGeoTransform);
+    bool createOutputDataset(GDALRasterBandH hBand,
+                             const double *adfGeoTransform, int nXStart,
+                             int nYStart, int nXSize, int nYSize,
+                             GDALDataType eType);
 };
 
 }  // namespace gdal
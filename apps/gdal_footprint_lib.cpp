@@ -85,6 +85,12 @@ struct GDALFootprintOptions
     /*! Overview index: 0 = first overview level */
     int nOvrIndex = -1;
 
+    /** Whether to vectorize an overview level of the mask band first, and
+     * refine the result at full resolution only near the boundary of the
+     * footprint.
+     */
+    bool bAdaptive = false;
+
     /** Whether output geometry should be in georeferenced coordinates, if
      * possible (if explicitly requested, bOutCSGeorefRequested is also set)
      * false = in pixel coordinates
@@ -169,6 +175,12 @@ static std::unique_ptr<GDALArgumentParser> GDALFootprintAppOptionsGetParser(
             .help(_("Set nodata value(s) for input bands."));
     }
 
+    argParser->add_argument("-adaptive")
+        .flag()
+        .store_into(psOptions->bAdaptive)
+        .help(_("Vectorize an overview level first, and refine the footprint "
+                "at full resolution only near its boundary."));
+
     argParser->add_argument("-t_cs")
         .choices("pixel", "georef")
         .default_value("georef")
@@ -811,6 +823,457 @@ static double GetMinDistanceBetweenTwoPoints(const OGRGeometry *poGeom)
     return 0;
 }
 
+/************************************************************************/
+/*                  GDALFootprintGetOverviewMaskBand()                  */
+/************************************************************************/
+
+static GDALRasterBand *GDALFootprintGetOverviewMaskBand(
+    GDALRasterBand *poBand, GDALRasterBand *poMaskBand, int nMaskFlags,
+    int nOvrIndex)
+{
+    if (nMaskFlags == GMF_NODATA)
+    {
+        // If the mask band is based on nodata, we don't need
+        // to check the overviews of the mask band, but we
+        // can take the mask band of the overviews
+        auto poOvrBand = poBand->GetOverview(nOvrIndex);
+        if (!poOvrBand)
+        {
+            if (poBand->GetOverviewCount() == 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Overview index %d invalid for this dataset. "
+                         "Bands of this dataset have no "
+                         "precomputed overviews",
+                         nOvrIndex);
+            }
+            else
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Overview index %d invalid for this dataset. "
+                         "Value should be in [0,%d] range",
+                         nOvrIndex, poBand->GetOverviewCount() - 1);
+            }
+            return nullptr;
+        }
+        if (poOvrBand->GetMaskFlags() != GMF_NODATA)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "poOvrBand->GetMaskFlags() != GMF_NODATA");
+            return nullptr;
+        }
+        return poOvrBand->GetMaskBand();
+    }
+
+    auto poOvrMaskBand = poMaskBand->GetOverview(nOvrIndex);
+    if (!poOvrMaskBand)
+    {
+        if (poBand->GetMaskBand()->GetOverviewCount() == 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Overview index %d invalid for this dataset. "
+                     "Mask bands of this dataset have no "
+                     "precomputed overviews",
+                     nOvrIndex);
+        }
+        else
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Overview index %d invalid for this dataset. "
+                     "Value should be in [0,%d] range",
+                     nOvrIndex, poBand->GetMaskBand()->GetOverviewCount() - 1);
+        }
+        return nullptr;
+    }
+    return poOvrMaskBand;
+}
+
+/************************************************************************/
+/*                    GDALFootprintPolygonizeBuffer()                   */
+/************************************************************************/
+
+/** Vectorize the non-zero pixels of a Byte buffer of nXSize * nYSize pixels,
+ * and append the resulting polygons to poMP, after having transformed their
+ * coordinates with X = min(nXOff + x * nXScale, nXMax) and
+ * Y = min(nYOff + y * nYScale, nYMax).
+ */
+static bool GDALFootprintPolygonizeBuffer(const GByte *pabyBuffer, int nXSize,
+                                          int nYSize, int nXOff, int nYOff,
+                                          int nXScale, int nYScale, int nXMax,
+                                          int nYMax, OGRMultiPolygon *poMP)
+{
+    auto poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poMEMDriver)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "MEM driver not available");
+        return false;
+    }
+    std::unique_ptr<GDALDataset> poMEMDS(
+        poMEMDriver->Create("", nXSize, nYSize, 1, GDT_Byte, nullptr));
+    if (!poMEMDS)
+        return false;
+    auto poMEMBand = poMEMDS->GetRasterBand(1);
+    if (poMEMBand->RasterIO(GF_Write, 0, 0, nXSize, nYSize,
+                            const_cast<GByte *>(pabyBuffer), nXSize, nYSize,
+                            GDT_Byte, 0, 0, nullptr) != CE_None)
+    {
+        return false;
+    }
+
+    auto hBand = GDALRasterBand::ToHandle(poMEMBand);
+    auto poMemLayer = std::make_unique<OGRMemLayer>("", nullptr, wkbUnknown);
+    if (GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(poMemLayer.get()),
+                       /* iPixValField = */ -1,
+                       /* papszOptions = */ nullptr, nullptr,
+                       nullptr) != CE_None)
+    {
+        return false;
+    }
+
+    for (auto &&poFeature : poMemLayer.get())
+    {
+        auto poGeom = std::unique_ptr<OGRGeometry>(poFeature->StealGeometry());
+        if (!poGeom || poGeom->getGeometryType() != wkbPolygon)
+            continue;
+        for (auto *poRing : poGeom->toPolygon())
+        {
+            for (int i = 0; i < poRing->getNumPoints(); ++i)
+            {
+                poRing->setPoint(
+                    i,
+                    std::min(static_cast<double>(nXMax),
+                             nXOff + poRing->getX(i) * nXScale),
+                    std::min(static_cast<double>(nYMax),
+                             nYOff + poRing->getY(i) * nYScale));
+            }
+        }
+        poMP->addGeometryDirectly(poGeom.release());
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  GDALFootprintAdaptivePolygonize()                   */
+/************************************************************************/
+
+/** Compute the footprint by vectorizing an overview level of the mask band,
+ * and refining it at full resolution only in the tiles crossed by the boundary
+ * of the footprint.
+ *
+ * Tiles whose neighbourhood is uniformly valid or invalid in the overview
+ * level are not read at full resolution, nor are tiles for which
+ * GetDataCoverageStatus() reports that they are empty. Consequently, holes
+ * or islands much smaller than an overview pixel and far from the boundary
+ * of the footprint visible in the overview level may be missed.
+ *
+ * bDone is set to false if no suitable overview level is available, in which
+ * case the caller must vectorize the full resolution mask band.
+ */
+static bool GDALFootprintAdaptivePolygonize(
+    GDALDataset *poSrcDS, const std::vector<int> &anBands,
+    const std::vector<double> &adfSrcNoData, bool bGlobalMask,
+    GDALRasterBand *poFullResMaskBand,
+    const std::vector<GDALRasterBand *> &apoCoverageBands,
+    OGRLayer *poMemLayer, const GDALFootprintOptions *psOptions, bool &bDone)
+{
+    bDone = false;
+
+    const int nXSize = poFullResMaskBand->GetXSize();
+    const int nYSize = poFullResMaskBand->GetYSize();
+
+    // Dimension of the tiles in which the footprint is refined
+    int nTileXSize = 0;
+    int nTileYSize = 0;
+    poFullResMaskBand->GetBlockSize(&nTileXSize, &nTileYSize);
+    constexpr int MIN_TILE_SIZE = 64;
+    constexpr int DEFAULT_TILE_SIZE = 256;
+    constexpr int MAX_TILE_SIZE = 2048;
+    if (nTileXSize < MIN_TILE_SIZE)
+        nTileXSize = DEFAULT_TILE_SIZE;
+    if (nTileYSize < MIN_TILE_SIZE)
+        nTileYSize = DEFAULT_TILE_SIZE;
+    nTileXSize = std::min(nTileXSize, MAX_TILE_SIZE);
+    nTileYSize = std::min(nTileYSize, MAX_TILE_SIZE);
+
+    auto poBand0 = poSrcDS->GetRasterBand(anBands[0]);
+    int nOvrIndex = psOptions->nOvrIndex;
+    if (nOvrIndex < 0)
+    {
+        // Select the coarsest overview level whose pixels are not larger than
+        // a quarter of a tile, so that each tile is covered by several
+        // overview pixels.
+        const int nMaxFactor =
+            std::max(1, std::min(nTileXSize, nTileYSize) / 4);
+        for (int i = poBand0->GetOverviewCount() - 1; i >= 0; --i)
+        {
+            const auto poOvrBand = poBand0->GetOverview(i);
+            if (poOvrBand &&
+                static_cast<int64_t>(poOvrBand->GetXSize()) * nMaxFactor >=
+                    nXSize &&
+                static_cast<int64_t>(poOvrBand->GetYSize()) * nMaxFactor >=
+                    nYSize)
+            {
+                nOvrIndex = i;
+                break;
+            }
+        }
+        if (nOvrIndex < 0)
+        {
+            CPLDebug("GDAL",
+                     "gdal_footprint: no suitable overview level for "
+                     "adaptive mode. Using full resolution mask");
+            return true;
+        }
+    }
+
+    std::vector<GDALRasterBand *> apoOvrMaskBands;
+    std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands;
+    bool bOK = true;
+    {
+        // When the overview level is automatically selected, silently fall
+        // back to the full resolution mask if it has no overviews.
+        std::unique_ptr<CPLErrorStateBackuper> poErrorStateBackuper;
+        if (psOptions->nOvrIndex < 0)
+        {
+            poErrorStateBackuper =
+                std::make_unique<CPLErrorStateBackuper>(CPLQuietErrorHandler);
+        }
+        for (size_t i = 0; i < anBands.size(); ++i)
+        {
+            auto poBand = poSrcDS->GetRasterBand(anBands[i]);
+            if (!adfSrcNoData.empty())
+            {
+                auto poOvrBand = poBand->GetOverview(nOvrIndex);
+                if (!poOvrBand)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Overview index %d invalid for this dataset",
+                             nOvrIndex);
+                    bOK = false;
+                    break;
+                }
+                apoTmpNoDataMaskBands.emplace_back(
+                    std::make_unique<GDALNoDataMaskBand>(
+                        poOvrBand, adfSrcNoData.size() == 1
+                                       ? adfSrcNoData[0]
+                                       : adfSrcNoData[i]));
+                apoOvrMaskBands.push_back(apoTmpNoDataMaskBands.back().get());
+            }
+            else
+            {
+                auto poMaskBand =
+                    poBand->GetColorInterpretation() == GCI_AlphaBand
+                        ? poBand
+                        : poBand->GetMaskBand();
+                auto poOvrMaskBand = GDALFootprintGetOverviewMaskBand(
+                    poBand, poMaskBand, poBand->GetMaskFlags(), nOvrIndex);
+                if (!poOvrMaskBand)
+                {
+                    bOK = false;
+                    break;
+                }
+                apoOvrMaskBands.push_back(poOvrMaskBand);
+            }
+        }
+    }
+    if (!bOK)
+    {
+        if (psOptions->nOvrIndex >= 0)
+            return false;
+        CPLDebug("GDAL",
+                 "gdal_footprint: no overview level for the mask band. "
+                 "Using full resolution mask");
+        return true;
+    }
+
+    std::unique_ptr<GDALRasterBand> poOvrMask;
+    if (bGlobalMask || anBands.size() == 1)
+    {
+        poOvrMask = std::make_unique<GDALFootprintMaskBand>(apoOvrMaskBands[0]);
+    }
+    else
+    {
+        poOvrMask = std::make_unique<GDALFootprintCombinedMaskBand>(
+            apoOvrMaskBands, psOptions->bCombineBandsUnion);
+    }
+
+    const int nOvrXSize = poOvrMask->GetXSize();
+    const int nOvrYSize = poOvrMask->GetYSize();
+    const int nTilesX = DIV_ROUND_UP(nXSize, nTileXSize);
+    const int nTilesY = DIV_ROUND_UP(nYSize, nTileYSize);
+    std::vector<GByte> abyOvrMask;
+    std::vector<GByte> abyValidTiles;
+    std::vector<GByte> abyTile;
+    try
+    {
+        abyOvrMask.resize(static_cast<size_t>(nOvrXSize) * nOvrYSize);
+        abyValidTiles.resize(static_cast<size_t>(nTilesX) * nTilesY);
+        abyTile.resize(static_cast<size_t>(nTileXSize) * nTileYSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in adaptive mode");
+        return false;
+    }
+    if (poOvrMask->RasterIO(GF_Read, 0, 0, nOvrXSize, nOvrYSize,
+                            abyOvrMask.data(), nOvrXSize, nOvrYSize, GDT_Byte,
+                            0, 0, nullptr) != CE_None)
+    {
+        return false;
+    }
+
+    // Classify tiles as invalid, valid, or to be refined at full resolution
+    std::vector<std::pair<int, int>> anTilesToRefine;
+    const size_t nCoverageBands =
+        (bGlobalMask || anBands.size() == 1) ? 1 : apoCoverageBands.size();
+    for (int iTileY = 0; iTileY < nTilesY; ++iTileY)
+    {
+        const int nYOff = iTileY * nTileYSize;
+        const int nReqYSize = std::min(nTileYSize, nYSize - nYOff);
+        for (int iTileX = 0; iTileX < nTilesX; ++iTileX)
+        {
+            const int nXOff = iTileX * nTileXSize;
+            const int nReqXSize = std::min(nTileXSize, nXSize - nXOff);
+
+            // Skip tiles that have no data at all at full resolution
+            int nEmptyCount = 0;
+            for (size_t i = 0; i < nCoverageBands; ++i)
+            {
+                if (apoCoverageBands[i] &&
+                    apoCoverageBands[i]->GetDataCoverageStatus(
+                        nXOff, nYOff, nReqXSize, nReqYSize) ==
+                        GDAL_DATA_COVERAGE_STATUS_EMPTY)
+                {
+                    ++nEmptyCount;
+                }
+            }
+            if (psOptions->bCombineBandsUnion
+                    ? static_cast<size_t>(nEmptyCount) == nCoverageBands
+                    : nEmptyCount > 0)
+            {
+                continue;
+            }
+
+            // Inspect the overview pixels intersecting the tile, and their
+            // immediate neighbours
+            const int nOvrX0 = std::max(
+                0, static_cast<int>(static_cast<int64_t>(nXOff) * nOvrXSize /
+                                    nXSize) -
+                       1);
+            const int nOvrX1 = std::min(
+                nOvrXSize,
+                static_cast<int>((static_cast<int64_t>(nXOff + nReqXSize) *
+                                      nOvrXSize +
+                                  nXSize - 1) /
+                                 nXSize) +
+                    1);
+            const int nOvrY0 = std::max(
+                0, static_cast<int>(static_cast<int64_t>(nYOff) * nOvrYSize /
+                                    nYSize) -
+                       1);
+            const int nOvrY1 = std::min(
+                nOvrYSize,
+                static_cast<int>((static_cast<int64_t>(nYOff + nReqYSize) *
+                                      nOvrYSize +
+                                  nYSize - 1) /
+                                 nYSize) +
+                    1);
+            bool bHasValid = false;
+            bool bHasInvalid = false;
+            for (int iY = nOvrY0; iY < nOvrY1; ++iY)
+            {
+                for (int iX = nOvrX0; iX < nOvrX1; ++iX)
+                {
+                    if (abyOvrMask[static_cast<size_t>(iY) * nOvrXSize + iX])
+                        bHasValid = true;
+                    else
+                        bHasInvalid = true;
+                }
+            }
+            if (bHasValid && bHasInvalid)
+                anTilesToRefine.emplace_back(iTileX, iTileY);
+            else if (bHasValid)
+                abyValidTiles[static_cast<size_t>(iTileY) * nTilesX + iTileX] =
+                    1;
+        }
+    }
+    abyOvrMask.clear();
+
+    CPLDebug("GDAL",
+             "gdal_footprint: using overview level %d, refining %d tiles "
+             "out of %d",
+             nOvrIndex, static_cast<int>(anTilesToRefine.size()),
+             nTilesX * nTilesY);
+
+    auto poMP = std::make_unique<OGRMultiPolygon>();
+
+    // Tiles that are entirely valid
+    if (!GDALFootprintPolygonizeBuffer(abyValidTiles.data(), nTilesX, nTilesY,
+                                       0, 0, nTileXSize, nTileYSize, nXSize,
+                                       nYSize, poMP.get()))
+    {
+        return false;
+    }
+
+    // Tiles crossed by the boundary of the footprint
+    for (size_t i = 0; i < anTilesToRefine.size(); ++i)
+    {
+        const int nXOff = anTilesToRefine[i].first * nTileXSize;
+        const int nYOff = anTilesToRefine[i].second * nTileYSize;
+        const int nReqXSize = std::min(nTileXSize, nXSize - nXOff);
+        const int nReqYSize = std::min(nTileYSize, nYSize - nYOff);
+        if (poFullResMaskBand->RasterIO(GF_Read, nXOff, nYOff, nReqXSize,
+                                        nReqYSize, abyTile.data(), nReqXSize,
+                                        nReqYSize, GDT_Byte, 0, 0,
+                                        nullptr) != CE_None ||
+            !GDALFootprintPolygonizeBuffer(abyTile.data(), nReqXSize,
+                                           nReqYSize, nXOff, nYOff, 1, 1,
+                                           nXSize, nYSize, poMP.get()))
+        {
+            return false;
+        }
+
+        if (!psOptions->pfnProgress(
+                0.9 * static_cast<double>(i + 1) / anTilesToRefine.size(), "",
+                psOptions->pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+    }
+
+    if (!poMP->IsEmpty())
+    {
+        // Merge the pieces that share edges at tile boundaries
+        std::unique_ptr<OGRGeometry> poUnion(poMP->UnionCascaded());
+        if (!poUnion)
+            return false;
+        std::vector<const OGRPolygon *> apoPolygons;
+        if (poUnion->getGeometryType() == wkbPolygon)
+        {
+            apoPolygons.push_back(poUnion->toPolygon());
+        }
+        else if (poUnion->getGeometryType() == wkbMultiPolygon)
+        {
+            for (const auto *poPoly : poUnion->toMultiPolygon())
+                apoPolygons.push_back(poPoly);
+        }
+        for (const auto *poPoly : apoPolygons)
+        {
+            auto poFeature =
+                std::make_unique<OGRFeature>(poMemLayer->GetLayerDefn());
+            poFeature->SetGeometryDirectly(poPoly->clone());
+            if (poMemLayer->CreateFeature(poFeature.get()) != OGRERR_NONE)
+                return false;
+        }
+    }
+
+    psOptions->pfnProgress(1.0, "", psOptions->pProgressData);
+    bDone = true;
+    return true;
+}
+
 /************************************************************************/
 /*                       GDALFootprintProcess()                         */
 /************************************************************************/
@@ -863,8 +1326,13 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
             adfSrcNoData.emplace_back(CPLAtof(aosSrcNoData[i]));
         }
     }
+    // In adaptive mode, the overview level is only used to compute the
+    // coarse footprint, and the output is in full resolution pixel space
+    const int nOvrIndex = psOptions->bAdaptive ? -1 : psOptions->nOvrIndex;
     bool bGlobalMask = true;
     std::vector<std::unique_ptr<GDALRasterBand>> apoTmpNoDataMaskBands;
+    // Bands whose GetDataCoverageStatus() tells if the mask is empty
+    std::vector<GDALRasterBand *> apoCoverageBands;
     for (size_t i = 0; i < anBands.size(); ++i)
     {
         const int nBand = anBands[i];
@@ -883,6 +1351,9 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
                     poBand, adfSrcNoData.size() == 1 ? adfSrcNoData[0]
                                                      : adfSrcNoData[i]));
             apoSrcMaskBands.push_back(apoTmpNoDataMaskBands.back().get());
+            // Sparse blocks are not necessarily filled with the nodata value
+            // specified with -srcnodata
+            apoCoverageBands.push_back(nullptr);
         }
         else
         {
@@ -900,72 +1371,20 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
                 }
                 poMaskBand = poBand->GetMaskBand();
             }
-            if (psOptions->nOvrIndex >= 0)
+            if (nOvrIndex >= 0)
             {
-                if (nMaskFlags == GMF_NODATA)
-                {
-                    // If the mask band is based on nodata, we don't need
-                    // to check the overviews of the mask band, but we
-                    // can take the mask band of the overviews
-                    auto poOvrBand = poBand->GetOverview(psOptions->nOvrIndex);
-                    if (!poOvrBand)
-                    {
-                        if (poBand->GetOverviewCount() == 0)
-                        {
-                            CPLError(
-                                CE_Failure, CPLE_AppDefined,
-                                "Overview index %d invalid for this dataset. "
-                                "Bands of this dataset have no "
-                                "precomputed overviews",
-                                psOptions->nOvrIndex);
-                        }
-                        else
-                        {
-                            CPLError(
-                                CE_Failure, CPLE_AppDefined,
-                                "Overview index %d invalid for this dataset. "
-                                "Value should be in [0,%d] range",
-                                psOptions->nOvrIndex,
-                                poBand->GetOverviewCount() - 1);
-                        }
-                        return false;
-                    }
-                    if (poOvrBand->GetMaskFlags() != GMF_NODATA)
-                    {
-                        CPLError(CE_Failure, CPLE_AppDefined,
-                                 "poOvrBand->GetMaskFlags() != GMF_NODATA");
-                        return false;
-                    }
-                    poMaskBand = poOvrBand->GetMaskBand();
-                }
-                else
-                {
-                    poMaskBand = poMaskBand->GetOverview(psOptions->nOvrIndex);
-                    if (!poMaskBand)
-                    {
-                        if (poBand->GetMaskBand()->GetOverviewCount() == 0)
-                        {
-                            CPLError(
-                                CE_Failure, CPLE_AppDefined,
-                                "Overview index %d invalid for this dataset. "
-                                "Mask bands of this dataset have no "
-                                "precomputed overviews",
-                                psOptions->nOvrIndex);
-                        }
-                        else
-                        {
-                            CPLError(
-                                CE_Failure, CPLE_AppDefined,
-                                "Overview index %d invalid for this dataset. "
-                                "Value should be in [0,%d] range",
-                                psOptions->nOvrIndex,
-                                poBand->GetMaskBand()->GetOverviewCount() - 1);
-                        }
-                        return false;
-                    }
-                }
+                poMaskBand = GDALFootprintGetOverviewMaskBand(
+                    poBand, poMaskBand, nMaskFlags, nOvrIndex);
+                if (!poMaskBand)
+                    return false;
             }
             apoSrcMaskBands.push_back(poMaskBand);
+            if (nMaskFlags == GMF_NODATA)
+                apoCoverageBands.push_back(poBand);
+            else if ((nMaskFlags & GMF_ALL_VALID) != 0)
+                apoCoverageBands.push_back(nullptr);
+            else
+                apoCoverageBands.push_back(poMaskBand);
         }
     }
 
@@ -993,7 +1412,7 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
                  "input dataset has no geotransform.");
         return false;
     }
-    else if (psOptions->nOvrIndex >= 0)
+    else if (nOvrIndex >= 0)
     {
         // Transform from overview pixel coordinates to full resolution
         // pixel coordinates
@@ -1020,17 +1439,29 @@ static bool GDALFootprintProcess(GDALDataset *poSrcDS, OGRLayer *poDstLayer,
             apoSrcMaskBands, psOptions->bCombineBandsUnion);
     }
 
-    auto hBand = GDALRasterBand::ToHandle(poMaskForRasterize.get());
     auto poMemLayer = std::make_unique<OGRMemLayer>("", nullptr, wkbUnknown);
-    const CPLErr eErr =
-        GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(poMemLayer.get()),
-                       /* iPixValField = */ -1,
-                       /* papszOptions = */ nullptr, psOptions->pfnProgress,
-                       psOptions->pProgressData);
-    if (eErr != CE_None)
+    bool bDone = false;
+    if (psOptions->bAdaptive &&
+        !GDALFootprintAdaptivePolygonize(
+            poSrcDS, anBands, adfSrcNoData, bGlobalMask,
+            poMaskForRasterize.get(), apoCoverageBands, poMemLayer.get(),
+            psOptions, bDone))
     {
         return false;
     }
+    if (!bDone)
+    {
+        auto hBand = GDALRasterBand::ToHandle(poMaskForRasterize.get());
+        const CPLErr eErr =
+            GDALPolygonize(hBand, hBand, OGRLayer::ToHandle(poMemLayer.get()),
+                           /* iPixValField = */ -1,
+                           /* papszOptions = */ nullptr, psOptions->pfnProgress,
+                           psOptions->pProgressData);
+        if (eErr != CE_None)
+        {
+            return false;
+        }
+    }
 
     if (!psOptions->bSplitPolys)
     {
@@ -108,6 +108,7 @@ struct GDALGridOptions
     std::string osClipSrcWhere{};
     bool bNoDataSet = false;
     double dfNoDataValue = 0;
+    bool bTiled = false;
 
     GDALGridOptions()
     {
@@ -306,6 +307,107 @@ class GDALGridGeometryVisitor final : public OGRDefaultConstGeometryVisitor
     }
 };
 
+/************************************************************************/
+/*                      GetAlgorithmSearchRadius()                      */
+/*                                                                      */
+/*      Return the distance beyond which points are not used by the     */
+/*      algorithm, or false if it may use points at any distance.       */
+/************************************************************************/
+
+static bool GetAlgorithmSearchRadius(GDALGridAlgorithm eAlgorithm,
+                                     const void *pOptions, double &dfRadius)
+{
+    switch (eAlgorithm)
+    {
+        case GGA_InverseDistanceToAPower:
+        {
+            const auto pOptions2 =
+                static_cast<const GDALGridInverseDistanceToAPowerOptions *>(
+                    pOptions);
+            dfRadius = std::max(pOptions2->dfRadius1, pOptions2->dfRadius2);
+            return dfRadius > 0;
+        }
+        case GGA_InverseDistanceToAPowerNearestNeighbor:
+        {
+            using Options =
+                GDALGridInverseDistanceToAPowerNearestNeighborOptions;
+            dfRadius = static_cast<const Options *>(pOptions)->dfRadius;
+            return dfRadius > 0;
+        }
+        case GGA_MovingAverage:
+        {
+            const auto pOptions2 =
+                static_cast<const GDALGridMovingAverageOptions *>(pOptions);
+            dfRadius = std::max(pOptions2->dfRadius1, pOptions2->dfRadius2);
+            return true;
+        }
+        case GGA_NearestNeighbor:
+        {
+            const auto pOptions2 =
+                static_cast<const GDALGridNearestNeighborOptions *>(pOptions);
+            dfRadius = std::max(pOptions2->dfRadius1, pOptions2->dfRadius2);
+            return dfRadius > 0;
+        }
+        case GGA_MetricMinimum:
+        case GGA_MetricMaximum:
+        case GGA_MetricRange:
+        case GGA_MetricCount:
+        case GGA_MetricAverageDistance:
+        case GGA_MetricAverageDistancePts:
+        {
+            const auto pOptions2 =
+                static_cast<const GDALGridDataMetricsOptions *>(pOptions);
+            dfRadius = std::max(pOptions2->dfRadius1, pOptions2->dfRadius2);
+            return true;
+        }
+        case GGA_Linear:
+            // The Delaunay triangulation involves all points
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                      GetAlgorithmNoDataValue()                       */
+/************************************************************************/
+
+static double GetAlgorithmNoDataValue(GDALGridAlgorithm eAlgorithm,
+                                      const void *pOptions)
+{
+    switch (eAlgorithm)
+    {
+        case GGA_InverseDistanceToAPower:
+            return static_cast<const GDALGridInverseDistanceToAPowerOptions *>(
+                       pOptions)
+                ->dfNoDataValue;
+        case GGA_InverseDistanceToAPowerNearestNeighbor:
+        {
+            using Options =
+                GDALGridInverseDistanceToAPowerNearestNeighborOptions;
+            return static_cast<const Options *>(pOptions)->dfNoDataValue;
+        }
+        case GGA_MovingAverage:
+            return static_cast<const GDALGridMovingAverageOptions *>(pOptions)
+                ->dfNoDataValue;
+        case GGA_NearestNeighbor:
+            return static_cast<const GDALGridNearestNeighborOptions *>(
+                       pOptions)
+                ->dfNoDataValue;
+        case GGA_MetricMinimum:
+        case GGA_MetricMaximum:
+        case GGA_MetricRange:
+        case GGA_MetricCount:
+        case GGA_MetricAverageDistance:
+        case GGA_MetricAverageDistancePts:
+            return static_cast<const GDALGridDataMetricsOptions *>(pOptions)
+                ->dfNoDataValue;
+        case GGA_Linear:
+            return static_cast<const GDALGridLinearOptions *>(pOptions)
+                ->dfNoDataValue;
+    }
+    return 0;
+}
+
 /************************************************************************/
 /*                            ProcessLayer()                            */
 /*                                                                      */
@@ -321,8 +423,8 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
                            const double dfIncreaseBurnValue,
                            const double dfMultiplyBurnValue, GDALDataType eType,
                            GDALGridAlgorithm eAlgorithm, void *pOptions,
-                           bool bQuiet, GDALProgressFunc pfnProgress,
-                           void *pProgressData)
+                           bool bTiled, bool bQuiet,
+                           GDALProgressFunc pfnProgress, void *pProgressData)
 
 {
     /* -------------------------------------------------------------------- */
@@ -352,29 +454,65 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
     oVisitor.dfIncreaseBurnValue = dfIncreaseBurnValue;
     oVisitor.dfMultiplyBurnValue = dfMultiplyBurnValue;
 
-    for (auto &&poFeat : poSrcLayer)
+    const auto CollectPoints = [poSrcLayer, iBurnField, &oVisitor]()
     {
-        const OGRGeometry *poGeom = poFeat->GetGeometryRef();
-        if (poGeom)
+        oVisitor.adfX.clear();
+        oVisitor.adfY.clear();
+        oVisitor.adfZ.clear();
+        for (auto &&poFeat : poSrcLayer)
         {
-            if (iBurnField >= 0)
+            const OGRGeometry *poGeom = poFeat->GetGeometryRef();
+            if (poGeom)
             {
-                if (!poFeat->IsFieldSetAndNotNull(iBurnField))
+                if (iBurnField >= 0)
                 {
-                    continue;
+                    if (!poFeat->IsFieldSetAndNotNull(iBurnField))
+                    {
+                        continue;
+                    }
+                    oVisitor.dfBurnValue =
+                        poFeat->GetFieldAsDouble(iBurnField);
                 }
-                oVisitor.dfBurnValue = poFeat->GetFieldAsDouble(iBurnField);
+
+                poGeom->accept(&oVisitor);
             }
+        }
+    };
 
-            poGeom->accept(&oVisitor);
+    // In tiled mode, the points are read for each output block, with a
+    // spatial filter on the block extent extended by the search radius of
+    // the algorithm, instead of being all loaded in memory.
+    double dfSearchRadius = 0;
+    if (bTiled)
+    {
+        if (!GetAlgorithmSearchRadius(eAlgorithm, pOptions, dfSearchRadius))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Tiled processing requires an algorithm with a bounded "
+                     "search radius. The linear algorithm, and the invdist "
+                     "and nearest algorithms without radius, are not "
+                     "supported.");
+            return CE_Failure;
         }
-    }
 
-    if (oVisitor.adfX.empty())
+        OGREnvelope sEnvelope;
+        if (poSrcLayer->GetExtent(&sEnvelope, TRUE) != OGRERR_NONE)
+        {
+            printf("No point geometry found on layer %s, skipping.\n",
+                   poSrcLayer->GetName());
+            return CE_None;
+        }
+    }
+    else
     {
-        printf("No point geometry found on layer %s, skipping.\n",
-               poSrcLayer->GetName());
-        return CE_None;
+        CollectPoints();
+
+        if (oVisitor.adfX.empty())
+        {
+            printf("No point geometry found on layer %s, skipping.\n",
+                   poSrcLayer->GetName());
+            return CE_None;
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -421,8 +559,13 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
         CPLprintf("Corner coordinates = (%f %f)-(%f %f).\n", dfXMin, dfYMin,
                   dfXMax, dfYMax);
         CPLprintf("Grid cell size = (%f %f).\n", dfDeltaX, dfDeltaY);
-        printf("Source point count = %lu.\n",
-               static_cast<unsigned long>(oVisitor.adfX.size()));
+        if (bTiled)
+            CPLprintf("Source points read by tiles, with a search radius of "
+                      "%f.\n",
+                      dfSearchRadius);
+        else
+            printf("Source point count = %lu.\n",
+                   static_cast<unsigned long>(oVisitor.adfX.size()));
         PrintAlgorithmAndOptions(eAlgorithm, pOptions);
         printf("\n");
     }
@@ -480,14 +623,17 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
         }
     };
 
-    std::unique_ptr<GDALGridContext, GDALGridContextReleaser> psContext(
-        GDALGridContextCreate(eAlgorithm, pOptions,
-                              static_cast<int>(oVisitor.adfX.size()),
-                              &(oVisitor.adfX[0]), &(oVisitor.adfY[0]),
-                              &(oVisitor.adfZ[0]), TRUE));
-    if (!psContext)
+    std::unique_ptr<GDALGridContext, GDALGridContextReleaser> psContext;
+    if (!bTiled)
     {
-        return CE_Failure;
+        psContext.reset(GDALGridContextCreate(
+            eAlgorithm, pOptions, static_cast<int>(oVisitor.adfX.size()),
+            &(oVisitor.adfX[0]), &(oVisitor.adfY[0]), &(oVisitor.adfZ[0]),
+            TRUE));
+        if (!psContext)
+        {
+            return CE_Failure;
+        }
     }
 
     CPLErr eErr = CE_None;
@@ -512,13 +658,48 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
             if (nYOffset > nYSize - nYRequest)
                 nYRequest = nYSize - nYOffset;
 
-            eErr = GDALGridContextProcess(
-                psContext.get(), dfXMin + dfDeltaX * nXOffset,
-                dfXMin + dfDeltaX * (nXOffset + nXRequest),
-                dfYMin + dfDeltaY * nYOffset,
-                dfYMin + dfDeltaY * (nYOffset + nYRequest), nXRequest,
-                nYRequest, eType, pData.get(), GDALScaledProgress,
-                pScaledProgress.get());
+            const double dfBlockXMin = dfXMin + dfDeltaX * nXOffset;
+            const double dfBlockXMax =
+                dfXMin + dfDeltaX * (nXOffset + nXRequest);
+            const double dfBlockYMin = dfYMin + dfDeltaY * nYOffset;
+            const double dfBlockYMax =
+                dfYMin + dfDeltaY * (nYOffset + nYRequest);
+
+            if (bTiled)
+            {
+                poSrcLayer->SetSpatialFilterRect(
+                    std::min(dfBlockXMin, dfBlockXMax) - dfSearchRadius,
+                    std::min(dfBlockYMin, dfBlockYMax) - dfSearchRadius,
+                    std::max(dfBlockXMin, dfBlockXMax) + dfSearchRadius,
+                    std::max(dfBlockYMin, dfBlockYMax) + dfSearchRadius);
+                CollectPoints();
+                if (oVisitor.adfX.empty())
+                {
+                    const double dfNoData =
+                        GetAlgorithmNoDataValue(eAlgorithm, pOptions);
+                    GDALCopyWords64(&dfNoData, GDT_Float64, 0, pData.get(),
+                                    eType, nDataTypeSize,
+                                    static_cast<GPtrDiff_t>(nXRequest) *
+                                        nYRequest);
+                    psContext.reset();
+                }
+                else
+                {
+                    psContext.reset(GDALGridContextCreate(
+                        eAlgorithm, pOptions,
+                        static_cast<int>(oVisitor.adfX.size()),
+                        &(oVisitor.adfX[0]), &(oVisitor.adfY[0]),
+                        &(oVisitor.adfZ[0]), TRUE));
+                    if (!psContext)
+                        eErr = CE_Failure;
+                }
+            }
+
+            if (eErr == CE_None && psContext)
+                eErr = GDALGridContextProcess(
+                    psContext.get(), dfBlockXMin, dfBlockXMax, dfBlockYMin,
+                    dfBlockYMax, nXRequest, nYRequest, eType, pData.get(),
+                    GDALScaledProgress, pScaledProgress.get());
 
             if (eErr == CE_None)
                 eErr = poBand->RasterIO(GF_Write, nXOffset, nYOffset, nXRequest,
@@ -526,6 +707,13 @@ static CPLErr ProcessLayer(OGRLayer *poSrcLayer, GDALDataset *poDstDS,
                                         nYRequest, eType, 0, 0, nullptr);
         }
     }
+    if (bTiled)
+    {
+        // Restore the spatial filter of the layer
+        psContext.reset();
+        poSrcLayer->SetSpatialFilter(const_cast<OGRGeometry *>(poClipSrc));
+    }
+
     if (eErr == CE_None && pfnProgress)
         pfnProgress(1.0, "", pProgressData);
 
@@ -838,8 +1026,9 @@ GDALDatasetH GDALGrid(const char *pszDest, GDALDatasetH hSrcDataset,
             nYSize, 1, bIsXExtentSet, bIsYExtentSet, dfXMin, dfXMax, dfYMin,
             dfYMax, psOptions->osBurnAttribute, psOptions->dfIncreaseBurnValue,
             psOptions->dfMultiplyBurnValue, psOptions->eOutputType,
-            psOptions->eAlgorithm, psOptions->pOptions.get(), psOptions->bQuiet,
-            psOptions->pfnProgress, psOptions->pProgressData);
+            psOptions->eAlgorithm, psOptions->pOptions.get(),
+            psOptions->bTiled, psOptions->bQuiet, psOptions->pfnProgress,
+            psOptions->pProgressData);
 
         poSrcDS->ReleaseResultSet(poLayer);
     }
@@ -891,7 +1080,7 @@ GDALDatasetH GDALGrid(const char *pszDest, GDALDatasetH hSrcDataset,
             dfXMin, dfXMax, dfYMin, dfYMax, psOptions->osBurnAttribute,
             psOptions->dfIncreaseBurnValue, psOptions->dfMultiplyBurnValue,
             psOptions->eOutputType, psOptions->eAlgorithm,
-            psOptions->pOptions.get(), psOptions->bQuiet,
+            psOptions->pOptions.get(), psOptions->bTiled, psOptions->bQuiet,
             psOptions->pfnProgress, psOptions->pProgressData);
         if (eErr != CE_None)
             break;
@@ -1121,6 +1310,12 @@ GDALGridOptionsGetParser(GDALGridOptions *psOptions,
         .help(_("Set the interpolation algorithm or data metric name and "
                 "(optionally) its parameters."));
 
+    argParser->add_argument("-tiled")
+        .flag()
+        .store_into(psOptions->bTiled)
+        .help(_("Read the points of each output block with a spatial filter, "
+                "instead of loading all points in memory."));
+
     if (psOptionsForBinary)
     {
         argParser->add_open_options_argument(
@@ -42,7 +42,7 @@ static void Usage(bool bIsError, const char *pszErrorMsg = nullptr)
     fprintf(
         bIsError ? stderr : stdout,
         "Usage: gdal_rasterize [--help] [--help-general]\n"
-        "       [-b <band>]... [-i] [-at]\n"
+        "       [-b <band>]... [-i] [-at] [-coverage]\n"
         "       [-oo <NAME>=<VALUE>]...\n"
         "       {[-burn <value>]... | [-a <attribute_name>] | [-3d]} [-add]\n"
         "       [-l <layername>]... [-where <expression>] "
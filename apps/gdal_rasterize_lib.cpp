@@ -1109,6 +1109,11 @@ GDALRasterizeOptionsNew(char **papszArgv,
             psOptions->papszRasterizeOptions = CSLSetNameValue(
                 psOptions->papszRasterizeOptions, "ALL_TOUCHED", "TRUE");
         }
+        else if (EQUAL(papszArgv[i], "-coverage"))
+        {
+            psOptions->papszRasterizeOptions = CSLSetNameValue(
+                psOptions->papszRasterizeOptions, "COVERAGE_FRACTION", "TRUE");
+        }
         else if (i < argc - 1 && EQUAL(papszArgv[i], "-optim"))
         {
             psOptions->papszRasterizeOptions = CSLSetNameValue(
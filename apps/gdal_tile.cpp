@@ -0,0 +1,1169 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Utilities
+ * Purpose:  Generate a tile pyramid (XYZ/TMS layout) from a raster dataset
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "commonutils.h"
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_alg.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "gdalargumentparser.h"
+#include "gdalwarper.h"
+#include "ogr_spatialref.h"
+#include "tilematrixset.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/************************************************************************/
+/*                          ResamplingMethod                            */
+/************************************************************************/
+
+struct ResamplingMethod
+{
+    const char *pszName;
+    GDALResampleAlg eWarpAlg;
+    GDALRIOResampleAlg eRIOAlg;
+};
+
+constexpr ResamplingMethod asResamplingMethods[] = {
+    {"nearest", GRA_NearestNeighbour, GRIORA_NearestNeighbour},
+    {"bilinear", GRA_Bilinear, GRIORA_Bilinear},
+    {"cubic", GRA_Cubic, GRIORA_Cubic},
+    {"cubicspline", GRA_CubicSpline, GRIORA_CubicSpline},
+    {"lanczos", GRA_Lanczos, GRIORA_Lanczos},
+    {"average", GRA_Average, GRIORA_Average},
+    {"rms", GRA_RMS, GRIORA_RMS},
+    {"mode", GRA_Mode, GRIORA_Mode},
+};
+
+/************************************************************************/
+/*                             TileRange                                */
+/************************************************************************/
+
+// Inclusive range of tile indices of a zoom level.
+struct TileRange
+{
+    int nMinX = 0;
+    int nMinY = 0;
+    int nMaxX = -1;
+    int nMaxY = -1;
+
+    bool IsEmpty() const
+    {
+        return nMinX > nMaxX || nMinY > nMaxY;
+    }
+};
+
+/************************************************************************/
+/*                             SourceSlot                               */
+/************************************************************************/
+
+// A source dataset handle and its transformer to the tile matrix set CRS.
+// Each concurrently running job uses its own slot.
+struct SourceSlot
+{
+    GDALDatasetUniquePtr poDS{};
+    void *hTransformArg = nullptr;
+
+    SourceSlot() = default;
+
+    ~SourceSlot()
+    {
+        if (hTransformArg)
+            GDALDestroyGenImgProjTransformer(hTransformArg);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(SourceSlot)
+};
+
+/************************************************************************/
+/*                            TileGenerator                             */
+/************************************************************************/
+
+class TileGenerator
+{
+  public:
+    std::string m_osSrcFilename{};
+    std::string m_osDstDir{};
+    std::string m_osExtension{};
+    CPLStringList m_aosCreationOptions{};
+    CPLStringList m_aosTransformerOptions{};
+    GDALDriver *m_poTileDriver = nullptr;
+    const ResamplingMethod *m_psResampling = nullptr;
+    std::unique_ptr<gdal::TileMatrixSet> m_poTMS{};
+    bool m_bInvertAxis = false;
+    bool m_bTMSConvention = false;
+    bool m_bJPEG = false;
+    bool m_bWEBP = false;
+    int m_nColorBands = 0;
+    int m_nSrcAlphaBand = 0;
+    std::vector<double> m_adfSrcNoData{};
+
+    // Extent of the source raster in the tile matrix set CRS, in
+    // easting/northing order.
+    double m_dfMinX = 0;
+    double m_dfMinY = 0;
+    double m_dfMaxX = 0;
+    double m_dfMaxY = 0;
+
+    std::atomic<bool> m_bError{false};
+    std::atomic<GIntBig> m_nTilesWritten{0};
+
+    TileGenerator() = default;
+
+    bool GetTileRange(int nZ, TileRange &sRange) const;
+    bool CreateLevelDirectories(int nZ, const TileRange &sRange) const;
+    std::string GetTileFilename(int nZ, int nX, int nY) const;
+
+    std::unique_ptr<SourceSlot> AcquireSource();
+    void ReleaseSource(std::unique_ptr<SourceSlot> &&poSlot);
+    void CloseSources();
+
+    bool WarpMetaTile(int nZ, int nTileX0, int nTileY0, int nTilesX,
+                      int nTilesY);
+    bool BuildFromChildren(int nZ, int nTileX0, int nTileY0, int nTilesX,
+                           int nTilesY);
+
+  private:
+    std::mutex m_oSourceMutex{};
+    std::vector<std::unique_ptr<SourceSlot>> m_apoFreeSources{};
+
+    bool WriteTile(int nZ, int nX, int nY, const GByte *pabyData,
+                   GSpacing nLineSpace, GSpacing nBandSpace);
+
+    CPL_DISALLOW_COPY_ASSIGN(TileGenerator)
+};
+
+/************************************************************************/
+/*                          CreateMEMDataset()                          */
+/************************************************************************/
+
+// Wraps a band sequential Byte buffer into a MEM dataset, without copy.
+// panBandMap gives, for each band to create, the 0-based index of the band
+// in the buffer.
+static GDALDatasetUniquePtr CreateMEMDataset(GByte *pabyData, int nWidth,
+                                             int nHeight,
+                                             const std::vector<int> &anBandMap,
+                                             GSpacing nLineSpace,
+                                             GSpacing nBandSpace,
+                                             bool bLastBandIsAlpha)
+{
+    auto poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    if (!poMEMDriver)
+        return nullptr;
+    GDALDatasetUniquePtr poDS(
+        poMEMDriver->Create("", nWidth, nHeight, 0, GDT_Byte, nullptr));
+    if (!poDS)
+        return nullptr;
+    for (int iBand : anBandMap)
+    {
+        char szPointer[64] = {'\0'};
+        const int nRet = CPLPrintPointer(
+            szPointer, pabyData + nBandSpace * iBand, sizeof(szPointer));
+        szPointer[nRet] = 0;
+
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("DATAPOINTER", szPointer);
+        aosOptions.SetNameValue("PIXELOFFSET", "1");
+        aosOptions.SetNameValue(
+            "LINEOFFSET",
+            CPLSPrintf(CPL_FRMT_GIB, static_cast<GIntBig>(nLineSpace)));
+        if (poDS->AddBand(GDT_Byte, aosOptions.List()) != CE_None)
+            return nullptr;
+    }
+    if (bLastBandIsAlpha)
+    {
+        poDS->GetRasterBand(poDS->GetRasterCount())
+            ->SetColorInterpretation(GCI_AlphaBand);
+    }
+    return poDS;
+}
+
+/************************************************************************/
+/*                   TileGenerator::GetTileRange()                      */
+/************************************************************************/
+
+bool TileGenerator::GetTileRange(int nZ, TileRange &sRange) const
+{
+    const auto &tm = m_poTMS->tileMatrixList()[nZ];
+    const double dfOriX = m_bInvertAxis ? tm.mTopLeftY : tm.mTopLeftX;
+    const double dfOriY = m_bInvertAxis ? tm.mTopLeftX : tm.mTopLeftY;
+    const double dfTileWidth = tm.mResX * tm.mTileWidth;
+    const double dfTileHeight = tm.mResY * tm.mTileHeight;
+
+    // Do not generate tiles for a source that only overlaps them by less
+    // than half a pixel.
+    constexpr double TOLERANCE_IN_PIXEL = 0.499;
+    const double dfEpsX = TOLERANCE_IN_PIXEL / tm.mTileWidth;
+    const double dfEpsY = TOLERANCE_IN_PIXEL / tm.mTileHeight;
+
+    const double dfMinTileX =
+        std::floor((m_dfMinX - dfOriX) / dfTileWidth + dfEpsX);
+    const double dfMaxTileX =
+        std::ceil((m_dfMaxX - dfOriX) / dfTileWidth - dfEpsX) - 1;
+    const double dfMinTileY =
+        std::floor((dfOriY - m_dfMaxY) / dfTileHeight + dfEpsY);
+    const double dfMaxTileY =
+        std::ceil((dfOriY - m_dfMinY) / dfTileHeight - dfEpsY) - 1;
+    if (!(dfMinTileX < tm.mMatrixWidth && dfMaxTileX >= 0 &&
+          dfMinTileY < tm.mMatrixHeight && dfMaxTileY >= 0))
+    {
+        sRange = TileRange();
+        return false;
+    }
+
+    sRange.nMinX = static_cast<int>(std::max(0.0, dfMinTileX));
+    sRange.nMinY = static_cast<int>(std::max(0.0, dfMinTileY));
+    sRange.nMaxX = static_cast<int>(
+        std::min(static_cast<double>(tm.mMatrixWidth - 1), dfMaxTileX));
+    sRange.nMaxY = static_cast<int>(
+        std::min(static_cast<double>(tm.mMatrixHeight - 1), dfMaxTileY));
+    return !sRange.IsEmpty();
+}
+
+/************************************************************************/
+/*                 TileGenerator::GetTileFilename()                     */
+/************************************************************************/
+
+std::string TileGenerator::GetTileFilename(int nZ, int nX, int nY) const
+{
+    if (m_bTMSConvention)
+        nY = m_poTMS->tileMatrixList()[nZ].mMatrixHeight - 1 - nY;
+    return std::string(CPLSPrintf("%s/%d/%d/%d.%s", m_osDstDir.c_str(), nZ,
+                                  nX, nY, m_osExtension.c_str()));
+}
+
+/************************************************************************/
+/*              TileGenerator::CreateLevelDirectories()                 */
+/************************************************************************/
+
+bool TileGenerator::CreateLevelDirectories(int nZ,
+                                           const TileRange &sRange) const
+{
+    const std::string osZDir(
+        CPLSPrintf("%s/%d", m_osDstDir.c_str(), nZ));
+    VSIStatBufL sStat;
+    if (VSIStatL(osZDir.c_str(), &sStat) != 0 &&
+        VSIMkdir(osZDir.c_str(), 0755) != 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create directory %s",
+                 osZDir.c_str());
+        return false;
+    }
+    for (int nX = sRange.nMinX; nX <= sRange.nMaxX; ++nX)
+    {
+        const std::string osXDir(CPLSPrintf("%s/%d", osZDir.c_str(), nX));
+        if (VSIStatL(osXDir.c_str(), &sStat) != 0 &&
+            VSIMkdir(osXDir.c_str(), 0755) != 0)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create directory %s",
+                     osXDir.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                   TileGenerator::AcquireSource()                     */
+/************************************************************************/
+
+std::unique_ptr<SourceSlot> TileGenerator::AcquireSource()
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oSourceMutex);
+        if (!m_apoFreeSources.empty())
+        {
+            auto poSlot = std::move(m_apoFreeSources.back());
+            m_apoFreeSources.pop_back();
+            return poSlot;
+        }
+    }
+
+    // All handles are in use: open a new one for this job. GDAL datasets
+    // cannot be shared between threads.
+    auto poSlot = std::make_unique<SourceSlot>();
+    poSlot->poDS.reset(GDALDataset::Open(
+        m_osSrcFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR));
+    if (!poSlot->poDS)
+        return nullptr;
+    poSlot->hTransformArg = GDALCreateGenImgProjTransformer2(
+        poSlot->poDS.get(), nullptr, m_aosTransformerOptions.List());
+    if (!poSlot->hTransformArg)
+        return nullptr;
+    return poSlot;
+}
+
+/************************************************************************/
+/*                   TileGenerator::ReleaseSource()                     */
+/************************************************************************/
+
+void TileGenerator::ReleaseSource(std::unique_ptr<SourceSlot> &&poSlot)
+{
+    std::lock_guard<std::mutex> oLock(m_oSourceMutex);
+    m_apoFreeSources.push_back(std::move(poSlot));
+}
+
+/************************************************************************/
+/*                    TileGenerator::CloseSources()                     */
+/************************************************************************/
+
+void TileGenerator::CloseSources()
+{
+    std::lock_guard<std::mutex> oLock(m_oSourceMutex);
+    m_apoFreeSources.clear();
+}
+
+/************************************************************************/
+/*                     TileGenerator::WriteTile()                       */
+/************************************************************************/
+
+// pabyData points to the top-left pixel of the tile in a band sequential
+// buffer with m_nColorBands colour bands followed by an alpha band.
+bool TileGenerator::WriteTile(int nZ, int nX, int nY, const GByte *pabyData,
+                              GSpacing nLineSpace, GSpacing nBandSpace)
+{
+    const auto &tm = m_poTMS->tileMatrixList()[nZ];
+
+    // Skip fully transparent tiles
+    const GByte *pabyAlpha = pabyData + nBandSpace * m_nColorBands;
+    bool bEmpty = true;
+    for (int iY = 0; bEmpty && iY < tm.mTileHeight; ++iY)
+    {
+        const GByte *pabyLine = pabyAlpha + nLineSpace * iY;
+        for (int iX = 0; iX < tm.mTileWidth; ++iX)
+        {
+            if (pabyLine[iX] != 0)
+            {
+                bEmpty = false;
+                break;
+            }
+        }
+    }
+    if (bEmpty)
+        return true;
+
+    std::vector<int> anBandMap;
+    if (m_nColorBands == 1 && m_bWEBP)
+    {
+        // WEBP only supports RGB(A): replicate the gray band
+        anBandMap = {0, 0, 0};
+    }
+    else
+    {
+        for (int i = 0; i < m_nColorBands; ++i)
+            anBandMap.push_back(i);
+    }
+    if (!m_bJPEG)
+        anBandMap.push_back(m_nColorBands);
+
+    auto poTileDS = CreateMEMDataset(const_cast<GByte *>(pabyData),
+                                     tm.mTileWidth, tm.mTileHeight, anBandMap,
+                                     nLineSpace, nBandSpace, !m_bJPEG);
+    if (!poTileDS)
+        return false;
+
+    const std::string osFilename = GetTileFilename(nZ, nX, nY);
+    GDALDatasetUniquePtr poOutDS(m_poTileDriver->CreateCopy(
+        osFilename.c_str(), poTileDS.get(), false, m_aosCreationOptions.List(),
+        nullptr, nullptr));
+    if (!poOutDS || poOutDS->Close() != CE_None)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write %s",
+                 osFilename.c_str());
+        return false;
+    }
+    ++m_nTilesWritten;
+    return true;
+}
+
+/************************************************************************/
+/*                    TileGenerator::WarpMetaTile()                     */
+/************************************************************************/
+
+// Warps the source once over a block of nTilesX * nTilesY tiles, and cuts
+// the result into tiles.
+bool TileGenerator::WarpMetaTile(int nZ, int nTileX0, int nTileY0,
+                                 int nTilesX, int nTilesY)
+{
+    const auto &tm = m_poTMS->tileMatrixList()[nZ];
+    const int nWidth = nTilesX * tm.mTileWidth;
+    const int nHeight = nTilesY * tm.mTileHeight;
+    const int nBands = m_nColorBands + 1;
+    const GSpacing nBandSpace = static_cast<GSpacing>(nWidth) * nHeight;
+
+    std::vector<GByte> abyBuffer;
+    try
+    {
+        abyBuffer.resize(static_cast<size_t>(nBandSpace * nBands));
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate metatile buffer");
+        return false;
+    }
+
+    std::vector<int> anBandMap;
+    for (int i = 0; i < nBands; ++i)
+        anBandMap.push_back(i);
+    auto poMetaTileDS =
+        CreateMEMDataset(abyBuffer.data(), nWidth, nHeight, anBandMap, nWidth,
+                         nBandSpace, true);
+    if (!poMetaTileDS)
+        return false;
+
+    const double dfOriX = m_bInvertAxis ? tm.mTopLeftY : tm.mTopLeftX;
+    const double dfOriY = m_bInvertAxis ? tm.mTopLeftX : tm.mTopLeftY;
+    double adfGeoTransform[6] = {
+        dfOriX + nTileX0 * tm.mResX * tm.mTileWidth,
+        tm.mResX,
+        0,
+        dfOriY - nTileY0 * tm.mResY * tm.mTileHeight,
+        0,
+        -tm.mResY};
+    poMetaTileDS->SetGeoTransform(adfGeoTransform);
+
+    auto poSource = AcquireSource();
+    if (!poSource)
+        return false;
+
+    GDALSetGenImgProjTransformerDstGeoTransform(poSource->hTransformArg,
+                                                adfGeoTransform);
+    void *hApproxArg = GDALCreateApproxTransformer(
+        GDALGenImgProjTransform, poSource->hTransformArg, 0.125);
+
+    GDALWarpOptions *psWO = GDALCreateWarpOptions();
+    psWO->hSrcDS = GDALDataset::ToHandle(poSource->poDS.get());
+    psWO->hDstDS = GDALDataset::ToHandle(poMetaTileDS.get());
+    psWO->eResampleAlg = m_psResampling->eWarpAlg;
+    psWO->eWorkingDataType = GDT_Byte;
+    psWO->nBandCount = m_nColorBands;
+    psWO->panSrcBands =
+        static_cast<int *>(CPLMalloc(sizeof(int) * m_nColorBands));
+    psWO->panDstBands =
+        static_cast<int *>(CPLMalloc(sizeof(int) * m_nColorBands));
+    for (int i = 0; i < m_nColorBands; ++i)
+    {
+        psWO->panSrcBands[i] = i + 1;
+        psWO->panDstBands[i] = i + 1;
+    }
+    if (!m_adfSrcNoData.empty())
+    {
+        psWO->padfSrcNoDataReal =
+            static_cast<double *>(CPLMalloc(sizeof(double) * m_nColorBands));
+        for (int i = 0; i < m_nColorBands; ++i)
+            psWO->padfSrcNoDataReal[i] = m_adfSrcNoData[i];
+    }
+    psWO->nSrcAlphaBand = m_nSrcAlphaBand;
+    psWO->nDstAlphaBand = nBands;
+    psWO->pfnTransformer = GDALApproxTransform;
+    psWO->pTransformerArg = hApproxArg;
+    psWO->papszWarpOptions =
+        CSLSetNameValue(psWO->papszWarpOptions, "INIT_DEST", "0");
+    // Parallelism is achieved at the metatile level
+    psWO->papszWarpOptions =
+        CSLSetNameValue(psWO->papszWarpOptions, "NUM_THREADS", "1");
+
+    bool bRet;
+    {
+        GDALWarpOperation oWO;
+        bRet = oWO.Initialize(psWO) == CE_None &&
+               oWO.ChunkAndWarpImage(0, 0, nWidth, nHeight) == CE_None;
+    }
+
+    GDALDestroyWarpOptions(psWO);
+    GDALDestroyApproxTransformer(hApproxArg);
+    ReleaseSource(std::move(poSource));
+    poMetaTileDS.reset();
+
+    for (int iY = 0; bRet && iY < nTilesY; ++iY)
+    {
+        for (int iX = 0; bRet && iX < nTilesX; ++iX)
+        {
+            bRet = WriteTile(
+                nZ, nTileX0 + iX, nTileY0 + iY,
+                abyBuffer.data() +
+                    static_cast<size_t>(iY) * tm.mTileHeight * nWidth +
+                    static_cast<size_t>(iX) * tm.mTileWidth,
+                nWidth, nBandSpace);
+        }
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                 TileGenerator::BuildFromChildren()                   */
+/************************************************************************/
+
+// Generates the tiles of a zoom level by downsampling the 2x2 tiles of the
+// next zoom level that have been previously written.
+bool TileGenerator::BuildFromChildren(int nZ, int nTileX0, int nTileY0,
+                                      int nTilesX, int nTilesY)
+{
+    const auto &tm = m_poTMS->tileMatrixList()[nZ];
+    const auto &tmChild = m_poTMS->tileMatrixList()[nZ + 1];
+    const int nTileWidth = tm.mTileWidth;
+    const int nTileHeight = tm.mTileHeight;
+    const int nBands = m_nColorBands + 1;
+    const int nQuadWidth = 2 * nTileWidth;
+    const int nQuadHeight = 2 * nTileHeight;
+    const GSpacing nQuadBandSpace =
+        static_cast<GSpacing>(nQuadWidth) * nQuadHeight;
+    const GSpacing nTileBandSpace =
+        static_cast<GSpacing>(nTileWidth) * nTileHeight;
+
+    std::vector<GByte> abyQuad;
+    std::vector<GByte> abyTile;
+    try
+    {
+        abyQuad.resize(static_cast<size_t>(nQuadBandSpace * nBands));
+        abyTile.resize(static_cast<size_t>(nTileBandSpace * nBands));
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate tile buffer");
+        return false;
+    }
+
+    std::vector<int> anBandMap;
+    for (int i = 0; i < nBands; ++i)
+        anBandMap.push_back(i);
+    auto poQuadDS =
+        CreateMEMDataset(abyQuad.data(), nQuadWidth, nQuadHeight, anBandMap,
+                         nQuadWidth, nQuadBandSpace, true);
+    if (!poQuadDS)
+        return false;
+
+    const char *const apszAllowedDrivers[] = {m_poTileDriver->GetDescription(),
+                                              nullptr};
+
+    for (int iY = 0; iY < nTilesY; ++iY)
+    {
+        for (int iX = 0; iX < nTilesX; ++iX)
+        {
+            const int nX = nTileX0 + iX;
+            const int nY = nTileY0 + iY;
+            std::fill(abyQuad.begin(), abyQuad.end(), static_cast<GByte>(0));
+            bool bHasChild = false;
+            for (int iChild = 0; iChild < 4; ++iChild)
+            {
+                const int nDX = iChild % 2;
+                const int nDY = iChild / 2;
+                const int nChildX = 2 * nX + nDX;
+                const int nChildY = 2 * nY + nDY;
+                if (nChildX >= tmChild.mMatrixWidth ||
+                    nChildY >= tmChild.mMatrixHeight)
+                    continue;
+                const std::string osChild =
+                    GetTileFilename(nZ + 1, nChildX, nChildY);
+                VSIStatBufL sStat;
+                if (VSIStatL(osChild.c_str(), &sStat) != 0)
+                    continue;
+                GDALDatasetUniquePtr poChildDS(GDALDataset::Open(
+                    osChild.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
+                    apszAllowedDrivers));
+                if (!poChildDS)
+                    return false;
+                const int nChildBands = poChildDS->GetRasterCount();
+                const bool bChildHasAlpha =
+                    nChildBands == 2 || nChildBands == 4;
+                if (poChildDS->GetRasterXSize() != nTileWidth ||
+                    poChildDS->GetRasterYSize() != nTileHeight ||
+                    nChildBands < m_nColorBands)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "%s has unexpected dimensions or band count",
+                             osChild.c_str());
+                    return false;
+                }
+
+                GByte *pabyDst = abyQuad.data() +
+                                 static_cast<size_t>(nDY) * nTileHeight *
+                                     nQuadWidth +
+                                 static_cast<size_t>(nDX) * nTileWidth;
+                // Gray tiles written as WEBP have R=G=B: band 1 is the gray
+                // value.
+                std::vector<int> anChildBands;
+                for (int i = 1; i <= m_nColorBands; ++i)
+                    anChildBands.push_back(i);
+                if (bChildHasAlpha)
+                    anChildBands.push_back(nChildBands);
+                if (poChildDS->RasterIO(
+                        GF_Read, 0, 0, nTileWidth, nTileHeight, pabyDst,
+                        nTileWidth, nTileHeight, GDT_Byte,
+                        static_cast<int>(anChildBands.size()),
+                        anChildBands.data(), 1, nQuadWidth, nQuadBandSpace,
+                        nullptr) != CE_None)
+                {
+                    return false;
+                }
+                if (!bChildHasAlpha)
+                {
+                    // JPEG tiles: what has been written is opaque
+                    GByte *pabyAlpha = pabyDst + nQuadBandSpace * m_nColorBands;
+                    for (int iLine = 0; iLine < nTileHeight; ++iLine)
+                    {
+                        memset(pabyAlpha + static_cast<size_t>(iLine) *
+                                               nQuadWidth,
+                               255, nTileWidth);
+                    }
+                }
+                bHasChild = true;
+            }
+            if (!bHasChild)
+                continue;
+
+            GDALRasterIOExtraArg sExtraArg;
+            INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+            sExtraArg.eResampleAlg = m_psResampling->eRIOAlg;
+            if (poQuadDS->RasterIO(GF_Read, 0, 0, nQuadWidth, nQuadHeight,
+                                   abyTile.data(), nTileWidth, nTileHeight,
+                                   GDT_Byte, nBands, nullptr, 1, nTileWidth,
+                                   nTileBandSpace, &sExtraArg) != CE_None ||
+                !WriteTile(nZ, nX, nY, abyTile.data(), nTileWidth,
+                           nTileBandSpace))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                              LevelJob                                */
+/************************************************************************/
+
+struct LevelJob
+{
+    TileGenerator *poGenerator = nullptr;
+    bool bFromChildren = false;
+    int nZ = 0;
+    int nTileX0 = 0;
+    int nTileY0 = 0;
+    int nTilesX = 0;
+    int nTilesY = 0;
+
+    static void Run(void *pData)
+    {
+        LevelJob *psJob = static_cast<LevelJob *>(pData);
+        auto poGenerator = psJob->poGenerator;
+        if (poGenerator->m_bError)
+            return;
+        const bool bOK =
+            psJob->bFromChildren
+                ? poGenerator->BuildFromChildren(psJob->nZ, psJob->nTileX0,
+                                                 psJob->nTileY0, psJob->nTilesX,
+                                                 psJob->nTilesY)
+                : poGenerator->WarpMetaTile(psJob->nZ, psJob->nTileX0,
+                                            psJob->nTileY0, psJob->nTilesX,
+                                            psJob->nTilesY);
+        if (!bOK)
+            poGenerator->m_bError = true;
+    }
+};
+
+/************************************************************************/
+/*                          ZoomForPixelSize()                          */
+/************************************************************************/
+
+// Returns the most detailed zoom level whose resolution is not finer than
+// dfPixelSize (same logic as gdal2tiles).
+static int ZoomForPixelSize(const gdal::TileMatrixSet &oTMS,
+                            double dfPixelSize)
+{
+    const auto &tmList = oTMS.tileMatrixList();
+    const int nLevels = static_cast<int>(tmList.size());
+    for (int i = 0; i < nLevels; ++i)
+    {
+        const double dfRes = tmList[i].mResX;
+        if (dfPixelSize > dfRes && (dfPixelSize - dfRes) / dfRes > 1e-8)
+            return std::max(0, i - 1);
+    }
+    return nLevels - 1;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                                main()                                */
+/************************************************************************/
+
+MAIN_START(argc, argv)
+{
+    EarlySetConfigOptions(argc, argv);
+
+    GDALAllRegister();
+
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    CPLStringList aosArgv;
+    aosArgv.Assign(argv, /* bTakeOwnership= */ true);
+    if (argc < 1)
+        std::exit(-argc);
+
+    GDALArgumentParser argParser(aosArgv[0], /* bForBinary=*/true);
+
+    argParser.add_description(
+        _("Generates a pyramid of tiles, in a z/x/y directory layout, from a "
+          "raster dataset."));
+
+    argParser.add_epilog(_("For more details, consult "
+                           "https://gdal.org/programs/gdal_tile.html"));
+
+    TileGenerator oGenerator;
+
+    std::string osTileFormat("PNG");
+    argParser.add_argument("-f")
+        .store_into(osTileFormat)
+        .choices("PNG", "JPEG", "WEBP")
+        .metavar("PNG|JPEG|WEBP")
+        .help(_("Tile format."));
+
+    argParser.add_creation_options_argument(oGenerator.m_aosCreationOptions);
+
+    std::string osTilingScheme("GoogleMapsCompatible");
+    argParser.add_argument("-tiling_scheme")
+        .store_into(osTilingScheme)
+        .metavar("<name>")
+        .help(_("Tile matrix set name or definition."));
+
+    std::string osZoom;
+    argParser.add_argument("-z")
+        .store_into(osZoom)
+        .metavar("<min>-<max>|<zoom>")
+        .help(_("Zoom levels to generate."));
+
+    std::string osResampling("average");
+    {
+        auto &arg = argParser.add_argument("-r")
+                        .store_into(osResampling)
+                        .metavar("<resampling_method>")
+                        .help(_("Resampling method."));
+        for (const auto &sMethod : asResamplingMethods)
+            arg.choices(sMethod.pszName);
+    }
+
+    std::string osConvention("xyz");
+    argParser.add_argument("-convention")
+        .store_into(osConvention)
+        .choices("xyz", "tms")
+        .metavar("xyz|tms")
+        .help(_("Tile row numbering: from top (xyz) or from bottom (tms)."));
+
+    int nMetaTileSize = 8;
+    argParser.add_argument("-metatile_size")
+        .store_into(nMetaTileSize)
+        .metavar("<tiles>")
+        .help(_("Number of tiles in each dimension of the blocks that are "
+                "processed at once."));
+
+    std::string osNumThreads(
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS"));
+    argParser.add_argument("-num_threads")
+        .store_into(osNumThreads)
+        .metavar("<number|ALL_CPUS>")
+        .help(_("Number of threads."));
+
+    bool bQuiet = false;
+    argParser.add_quiet_argument(&bQuiet);
+
+    argParser.add_argument("src_filename")
+        .store_into(oGenerator.m_osSrcFilename)
+        .metavar("<src_filename>");
+
+    argParser.add_argument("dst_directory")
+        .store_into(oGenerator.m_osDstDir)
+        .metavar("<dst_directory>");
+
+    try
+    {
+        argParser.parse_args(aosArgv);
+        if (nMetaTileSize < 1 || nMetaTileSize > 256)
+            throw std::runtime_error("-metatile_size should be in [1,256].");
+    }
+    catch (const std::exception &err)
+    {
+        argParser.display_error_and_usage(err);
+        std::exit(1);
+    }
+
+    for (const auto &sMethod : asResamplingMethods)
+    {
+        if (EQUAL(sMethod.pszName, osResampling.c_str()))
+            oGenerator.m_psResampling = &sMethod;
+    }
+    oGenerator.m_bTMSConvention = EQUAL(osConvention.c_str(), "tms");
+    oGenerator.m_bJPEG = EQUAL(osTileFormat.c_str(), "JPEG");
+    oGenerator.m_bWEBP = EQUAL(osTileFormat.c_str(), "WEBP");
+    oGenerator.m_osExtension = oGenerator.m_bJPEG   ? "jpg"
+                               : oGenerator.m_bWEBP ? "webp"
+                                                    : "png";
+    oGenerator.m_poTileDriver =
+        GetGDALDriverManager()->GetDriverByName(osTileFormat.c_str());
+    if (!oGenerator.m_poTileDriver)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s driver not available.",
+                 osTileFormat.c_str());
+        std::exit(1);
+    }
+
+    const int nThreads =
+        EQUAL(osNumThreads.c_str(), "ALL_CPUS")
+            ? CPLGetNumCPUs()
+            : std::max(1, std::min(128, atoi(osNumThreads.c_str())));
+
+    /* -------------------------------------------------------------------- */
+    /*      Tile matrix set.                                                */
+    /* -------------------------------------------------------------------- */
+    oGenerator.m_poTMS = gdal::TileMatrixSet::parse(osTilingScheme.c_str());
+    if (!oGenerator.m_poTMS)
+        std::exit(1);
+    if (oGenerator.m_poTMS->hasVariableMatrixWidth())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Unsupported tiling scheme: some levels have variable "
+                 "matrix width");
+        std::exit(1);
+    }
+    const auto &tmList = oGenerator.m_poTMS->tileMatrixList();
+    const int nLevels = static_cast<int>(tmList.size());
+
+    OGRSpatialReference oTargetSRS;
+    if (oTargetSRS.SetFromUserInput(
+            oGenerator.m_poTMS->crs().c_str(),
+            OGRSpatialReference::SET_FROM_USER_INPUT_LIMITATIONS_get()) !=
+        OGRERR_NONE)
+    {
+        std::exit(1);
+    }
+    oGenerator.m_bInvertAxis =
+        oTargetSRS.EPSGTreatsAsLatLong() != FALSE ||
+        oTargetSRS.EPSGTreatsAsNorthingEasting() != FALSE;
+    oGenerator.m_aosTransformerOptions.SetNameValue(
+        "DST_SRS", oGenerator.m_poTMS->crs().c_str());
+
+    /* -------------------------------------------------------------------- */
+    /*      Open source raster file.                                        */
+    /* -------------------------------------------------------------------- */
+    auto poSource = std::make_unique<SourceSlot>();
+    poSource->poDS.reset(
+        GDALDataset::Open(oGenerator.m_osSrcFilename.c_str(),
+                          GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR));
+    if (!poSource->poDS)
+        std::exit(1);
+    GDALDataset *poSrcDS = poSource->poDS.get();
+
+    const int nSrcBands = poSrcDS->GetRasterCount();
+    if (nSrcBands < 1 || nSrcBands > 4)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Only datasets with 1 (Gray), 2 (Gray+Alpha), 3 (RGB) or "
+                 "4 (RGBA) bands are supported.");
+        std::exit(1);
+    }
+    for (int i = 1; i <= nSrcBands; ++i)
+    {
+        if (poSrcDS->GetRasterBand(i)->GetRasterDataType() != GDT_Byte)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Only Byte datasets are supported. Use gdal_translate "
+                     "-ot Byte -scale to convert the source first.");
+            std::exit(1);
+        }
+    }
+    if (poSrcDS->GetRasterBand(1)->GetColorTable())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Datasets with a color table are not supported. Use "
+                 "gdal_translate -expand rgba to convert the source first.");
+        std::exit(1);
+    }
+    oGenerator.m_nColorBands = nSrcBands >= 3 ? 3 : 1;
+    if (nSrcBands == 2 || nSrcBands == 4)
+    {
+        oGenerator.m_nSrcAlphaBand = nSrcBands;
+    }
+    else
+    {
+        int bHasNoData = FALSE;
+        for (int i = 1; i <= nSrcBands; ++i)
+        {
+            const double dfNoData =
+                poSrcDS->GetRasterBand(i)->GetNoDataValue(&bHasNoData);
+            if (!bHasNoData)
+                break;
+            oGenerator.m_adfSrcNoData.push_back(dfNoData);
+        }
+        if (!bHasNoData)
+            oGenerator.m_adfSrcNoData.clear();
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Compute the extent in the tile matrix set CRS.                  */
+    /* -------------------------------------------------------------------- */
+    poSource->hTransformArg = GDALCreateGenImgProjTransformer2(
+        poSrcDS, nullptr, oGenerator.m_aosTransformerOptions.List());
+    if (!poSource->hTransformArg)
+        std::exit(1);
+
+    double adfGeoTransform[6];
+    double adfExtent[4];
+    int nXSize = 0;
+    int nYSize = 0;
+    if (GDALSuggestedWarpOutput2(poSrcDS, GDALGenImgProjTransform,
+                                 poSource->hTransformArg, adfGeoTransform,
+                                 &nXSize, &nYSize, adfExtent,
+                                 0) != CE_None)
+    {
+        std::exit(1);
+    }
+    oGenerator.m_dfMinX = adfExtent[0];
+    oGenerator.m_dfMinY = adfExtent[1];
+    oGenerator.m_dfMaxX = adfExtent[2];
+    oGenerator.m_dfMaxY = adfExtent[3];
+
+    const auto &bbox = oGenerator.m_poTMS->bbox();
+    if (bbox.mCrs == oGenerator.m_poTMS->crs())
+    {
+        const bool bInvertAxis = oGenerator.m_bInvertAxis;
+        oGenerator.m_dfMinX =
+            std::max(oGenerator.m_dfMinX,
+                     bInvertAxis ? bbox.mLowerCornerY : bbox.mLowerCornerX);
+        oGenerator.m_dfMinY =
+            std::max(oGenerator.m_dfMinY,
+                     bInvertAxis ? bbox.mLowerCornerX : bbox.mLowerCornerY);
+        oGenerator.m_dfMaxX =
+            std::min(oGenerator.m_dfMaxX,
+                     bInvertAxis ? bbox.mUpperCornerY : bbox.mUpperCornerX);
+        oGenerator.m_dfMaxY =
+            std::min(oGenerator.m_dfMaxY,
+                     bInvertAxis ? bbox.mUpperCornerX : bbox.mUpperCornerY);
+        if (oGenerator.m_dfMinX >= oGenerator.m_dfMaxX ||
+            oGenerator.m_dfMinY >= oGenerator.m_dfMaxY)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Raster extent completely outside of tile matrix set "
+                     "bounding box");
+            std::exit(1);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Zoom levels.                                                    */
+    /* -------------------------------------------------------------------- */
+    int nMinZoom;
+    int nMaxZoom;
+    if (osZoom.empty())
+    {
+        const double dfRes = adfGeoTransform[1];
+        nMaxZoom = ZoomForPixelSize(*(oGenerator.m_poTMS), dfRes);
+        nMinZoom = std::min(
+            nMaxZoom, ZoomForPixelSize(*(oGenerator.m_poTMS),
+                                       dfRes * std::max(nXSize, nYSize) /
+                                           tmList[0].mTileWidth));
+    }
+    else
+    {
+        const CPLStringList aosZoom(CSLTokenizeString2(osZoom.c_str(), "-", 0));
+        if (aosZoom.size() != 1 && aosZoom.size() != 2)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg, "Invalid value for -z");
+            std::exit(1);
+        }
+        nMinZoom = atoi(aosZoom[0]);
+        nMaxZoom = aosZoom.size() == 2 ? atoi(aosZoom[1]) : nMinZoom;
+        if (nMinZoom < 0 || nMinZoom > nMaxZoom || nMaxZoom >= nLevels)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "Invalid value for -z: zoom levels should be in [0,%d]",
+                     nLevels - 1);
+            std::exit(1);
+        }
+    }
+    CPLDebug("gdal_tile", "Generating zoom levels %d to %d", nMinZoom,
+             nMaxZoom);
+
+    // When each tile of a level is exactly made of 2x2 tiles of the next
+    // level, lower levels are built from the tiles just written, instead of
+    // warping the source again.
+    const bool bCanBuildFromChildren =
+        oGenerator.m_poTMS->haveAllLevelsSameTopLeft() &&
+        oGenerator.m_poTMS->haveAllLevelsSameTileSize() &&
+        oGenerator.m_poTMS->hasOnlyPowerOfTwoVaryingScales();
+
+    oGenerator.ReleaseSource(std::move(poSource));
+
+    if (VSIMkdirRecursive(oGenerator.m_osDstDir.c_str(), 0755) != 0)
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(oGenerator.m_osDstDir.c_str(), &sStat) != 0)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create directory %s",
+                     oGenerator.m_osDstDir.c_str());
+            std::exit(1);
+        }
+    }
+
+    // Tiles are non-georeferenced: do not let the tile drivers write .aux.xml
+    // side car files.
+    CPLSetConfigOption("GDAL_PAM_ENABLED", "NO");
+
+    /* -------------------------------------------------------------------- */
+    /*      Build the job list of each level.                               */
+    /* -------------------------------------------------------------------- */
+    std::vector<std::vector<LevelJob>> aaoLevelJobs;
+    size_t nTotalJobs = 0;
+    for (int nZ = nMaxZoom; nZ >= nMinZoom; --nZ)
+    {
+        aaoLevelJobs.emplace_back();
+        TileRange sRange;
+        if (!oGenerator.GetTileRange(nZ, sRange))
+            continue;
+        const bool bFromChildren = nZ < nMaxZoom && bCanBuildFromChildren;
+        // Align blocks on multiples of the metatile size, so that the blocks
+        // of lower levels read children written by the same number of jobs.
+        const int nBlockX0 = (sRange.nMinX / nMetaTileSize) * nMetaTileSize;
+        const int nBlockY0 = (sRange.nMinY / nMetaTileSize) * nMetaTileSize;
+        for (int nY = nBlockY0; nY <= sRange.nMaxY; nY += nMetaTileSize)
+        {
+            for (int nX = nBlockX0; nX <= sRange.nMaxX; nX += nMetaTileSize)
+            {
+                LevelJob sJob;
+                sJob.poGenerator = &oGenerator;
+                sJob.bFromChildren = bFromChildren;
+                sJob.nZ = nZ;
+                sJob.nTileX0 = std::max(nX, sRange.nMinX);
+                sJob.nTileY0 = std::max(nY, sRange.nMinY);
+                sJob.nTilesX = std::min(nX + nMetaTileSize - 1,
+                                        sRange.nMaxX) -
+                               sJob.nTileX0 + 1;
+                sJob.nTilesY = std::min(nY + nMetaTileSize - 1,
+                                        sRange.nMaxY) -
+                               sJob.nTileY0 + 1;
+                aaoLevelJobs.back().push_back(sJob);
+            }
+        }
+        nTotalJobs += aaoLevelJobs.back().size();
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Run them, level after level.                                    */
+    /* -------------------------------------------------------------------- */
+    GDALProgressFunc pfnProgress =
+        bQuiet ? GDALDummyProgress : GDALTermProgress;
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    size_t nJobsDone = 0;
+    bool bSuccess = true;
+    for (auto &aoJobs : aaoLevelJobs)
+    {
+        if (aoJobs.empty())
+            continue;
+        const int nZ = aoJobs.front().nZ;
+        TileRange sRange;
+        oGenerator.GetTileRange(nZ, sRange);
+        if (!oGenerator.CreateLevelDirectories(nZ, sRange))
+        {
+            bSuccess = false;
+            break;
+        }
+
+        auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                    : std::unique_ptr<CPLJobQueue>();
+        const int nLevelJobs = static_cast<int>(aoJobs.size());
+        for (auto &sJob : aoJobs)
+        {
+            if (!poQueue || !poQueue->SubmitJob(LevelJob::Run, &sJob))
+            {
+                LevelJob::Run(&sJob);
+                ++nJobsDone;
+                if (!pfnProgress(static_cast<double>(nJobsDone) / nTotalJobs,
+                                 "", nullptr))
+                {
+                    CPLError(CE_Failure, CPLE_UserInterrupt,
+                             "User terminated");
+                    oGenerator.m_bError = true;
+                }
+                if (oGenerator.m_bError)
+                    break;
+            }
+        }
+        if (poQueue)
+        {
+            const size_t nJobsDoneBefore = nJobsDone;
+            for (int nRemaining = nLevelJobs - 1; nRemaining >= 0;
+                 --nRemaining)
+            {
+                poQueue->WaitCompletion(nRemaining);
+                nJobsDone = nJobsDoneBefore + nLevelJobs - nRemaining;
+                if (!oGenerator.m_bError &&
+                    !pfnProgress(static_cast<double>(nJobsDone) / nTotalJobs,
+                                 "", nullptr))
+                {
+                    CPLError(CE_Failure, CPLE_UserInterrupt,
+                             "User terminated");
+                    oGenerator.m_bError = true;
+                }
+            }
+        }
+        if (oGenerator.m_bError)
+        {
+            bSuccess = false;
+            break;
+        }
+    }
+    if (bSuccess)
+        pfnProgress(1.0, "", nullptr);
+
+    CPLDebug("gdal_tile", CPL_FRMT_GIB " tiles written",
+             static_cast<GIntBig>(oGenerator.m_nTilesWritten));
+
+    oGenerator.CloseSources();
+
+    GDALDestroyDriverManager();
+    OGRCleanupAll();
+
+    return bSuccess ? 0 : 1;
+}
+
+MAIN_END
@@ -2565,13 +2565,75 @@ GDALDatasetH GDALTranslate(const char *pszDest, GDALDatasetH hSrcDataset,
     }
     else
     {
-        hOutDS = GDALCreateCopy(
-            hDriver, pszDest, GDALDataset::ToHandle(poVDS), psOptions->bStrict,
-            psOptions->aosCreateOptions.List(), psOptions->pfnProgress,
-            psOptions->pProgressData);
-        hOutDS = GDALTranslateFlush(hOutDS);
+        // When pixel values must be computed (scaling, data type conversion,
+        // etc.), try to wrap the VRT dataset into a thread-safe one, so that
+        // GDALDatasetCopyWholeRaster() can compute chunks in parallel.
+        GDALDataset *poCopySrcDS = poVDS;
+        std::unique_ptr<GDALDataset> poThreadSafeDS;
+        const char *pszThreads = psOptions->aosCreateOptions.FetchNameValueDef(
+            "NUM_THREADS", CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+        const int nThreads =
+            EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+        auto poSrcDriver = poSrcDS->GetDriver();
+        if (nThreads > 1 &&
+            (!psOptions->asScaleParams.empty() ||
+             !psOptions->adfExponent.empty() || psOptions->bUnscale ||
+             psOptions->eOutputType != GDT_Unknown ||
+             psOptions->nRGBExpand != 0) &&
+            poSrcDS == poSrcDSOri && poSrcDriver &&
+            !EQUAL(poSrcDriver->GetDescription(), "MEM") &&
+            !EQUAL(GDALGetDescription(hDriver), "VRT"))
+        {
+            char **papszXML = poVDS->GetMetadata("xml:VRT");
+            const std::string osXML(
+                papszXML && papszXML[0] ? papszXML[0] : "");
+            // Check that the serialized VRT can be re-opened by each thread
+            bool bCanReopen = false;
+            if (!osXML.empty())
+            {
+                CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+                auto poTestDS = std::unique_ptr<GDALDataset>(
+                    GDALDataset::Open(osXML.c_str(),
+                                      GDAL_OF_RASTER | GDAL_OF_INTERNAL));
+                GByte abyPixel[8] = {0};
+                bCanReopen =
+                    poTestDS && poVDS->GetRasterCount() > 0 &&
+                    poTestDS->GetRasterCount() == poVDS->GetRasterCount() &&
+                    poTestDS->GetRasterBand(1)->RasterIO(
+                        GF_Read, 0, 0, 1, 1, abyPixel, 1, 1, GDT_Float64, 0, 0,
+                        nullptr) == CE_None;
+            }
+            if (bCanReopen)
+            {
+                poThreadSafeDS = GDALCreateThreadSafeDataset(
+                    std::unique_ptr<GDALDataset>(poVDS), osXML.c_str(),
+                    GDAL_OF_RASTER, nullptr, nullptr);
+                // poVDS is now owned by poThreadSafeDS
+                poVDS = nullptr;
+                poCopySrcDS = poThreadSafeDS.get();
+                if (poCopySrcDS)
+                {
+                    CPLDebug("GDAL",
+                             "Using thread-safe VRT dataset with %d threads",
+                             nThreads);
+                }
+            }
+        }
 
-        GDALClose(poVDS);
+        if (poCopySrcDS)
+        {
+            hOutDS = GDALCreateCopy(hDriver, pszDest,
+                                    GDALDataset::ToHandle(poCopySrcDS),
+                                    psOptions->bStrict,
+                                    psOptions->aosCreateOptions.List(),
+                                    psOptions->pfnProgress,
+                                    psOptions->pProgressData);
+            hOutDS = GDALTranslateFlush(hOutDS);
+        }
+
+        poThreadSafeDS.reset();
+        if (poVDS)
+            GDALClose(poVDS);
     }
 
     poSrcDS->Release();
@@ -64,16 +64,34 @@ MAIN_START(argc, argv)
     argParser.add_output_format_argument(opts.outputFormat);
     argParser.add_argument("-ox")
         .store_into(opts.observer.x)
-        .required()
         .metavar("<value>")
         .help(_("The X position of the observer (in SRS units)."));
 
     argParser.add_argument("-oy")
         .store_into(opts.observer.y)
-        .required()
         .metavar("<value>")
         .help(_("The Y position of the observer (in SRS units)."));
 
+    std::string osObserversFilename;
+    argParser.add_argument("-observers")
+        .store_into(osObserversFilename)
+        .metavar("<filename>")
+        .help(_("Vector dataset with the observer points, to compute a "
+                "cumulative viewshed instead of -ox and -oy."));
+
+    std::string osObserversLayer;
+    argParser.add_argument("-observers_layer")
+        .store_into(osObserversLayer)
+        .metavar("<layername>")
+        .help(_("Layer of the observers dataset to use."));
+
+    std::string osObserversHeightField;
+    argParser.add_argument("-observers_height_field")
+        .store_into(osObserversHeightField)
+        .metavar("<fieldname>")
+        .help(_("Field containing the height of each observer above the DEM "
+                "(defaults to -oz)."));
+
     argParser.add_argument("-oz")
         .default_value(2)
         .store_into(opts.observer.z)
@@ -179,6 +197,19 @@ MAIN_START(argc, argv)
     try
     {
         argParser.parse_args(aosArgv);
+
+        if (osObserversFilename.empty())
+        {
+            if (!argParser.is_used("-ox"))
+                throw std::runtime_error("-ox: required.");
+            if (!argParser.is_used("-oy"))
+                throw std::runtime_error("-oy: required.");
+        }
+        else if (argParser.is_used("-ox") || argParser.is_used("-oy"))
+        {
+            throw std::runtime_error(
+                "-ox and -oy cannot be used together with -observers.");
+        }
     }
     catch (const std::exception &err)
     {
@@ -243,16 +274,54 @@ MAIN_START(argc, argv)
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Open observers dataset.                                         */
+    /* -------------------------------------------------------------------- */
+    GDALDatasetH hObserversDS = nullptr;
+    OGRLayerH hObserversLayer = nullptr;
+    if (!osObserversFilename.empty())
+    {
+        hObserversDS =
+            GDALOpenEx(osObserversFilename.c_str(),
+                       GDAL_OF_VECTOR | GDAL_OF_VERBOSE_ERROR, nullptr,
+                       nullptr, nullptr);
+        if (hObserversDS == nullptr)
+            exit(2);
+
+        hObserversLayer =
+            osObserversLayer.empty()
+                ? GDALDatasetGetLayer(hObserversDS, 0)
+                : GDALDatasetGetLayerByName(hObserversDS,
+                                            osObserversLayer.c_str());
+        if (hObserversLayer == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot find layer %s in %s.",
+                     osObserversLayer.empty() ? "0"
+                                              : osObserversLayer.c_str(),
+                     osObserversFilename.c_str());
+            exit(2);
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Invoke.                                                         */
     /* -------------------------------------------------------------------- */
     Viewshed oViewshed(opts);
 
+    GDALProgressFunc pfnProgress =
+        bQuiet ? GDALDummyProgress : GDALTermProgress;
     bool bSuccess =
-        oViewshed.run(hBand, bQuiet ? GDALDummyProgress : GDALTermProgress);
+        hObserversLayer
+            ? oViewshed.runCumulative(hBand, hObserversLayer,
+                                      osObserversHeightField.c_str(),
+                                      pfnProgress)
+            : oViewshed.run(hBand, pfnProgress);
 
     GDALDatasetH hDstDS = GDALDataset::FromHandle(oViewshed.output().release());
 
+    if (hObserversDS)
+        GDALClose(hObserversDS);
     GDALClose(hSrcDS);
     if (GDALClose(hDstDS) != CE_None)
         bSuccess = false;
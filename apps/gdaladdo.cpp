@@ -70,7 +70,7 @@ static void CPL_STDCALL GDALAddoErrorHandler(CPLErr eErr, CPLErrorNum errNum,
 static bool PartialRefresh(GDALDataset *poDS,
                            const std::vector<int> &anOvrIndices, int nBandCount,
                            const int *panBandList, const char *pszResampling,
-                           int nXOff, int nYOff, int nXSize, int nYSize,
+                           CSLConstList papszOptions,
                            GDALProgressFunc pfnProgress, void *pProgressArg)
 {
     std::vector<int> anBandList;
@@ -112,21 +112,32 @@ static bool PartialRefresh(GDALDataset *poDS,
         }
     }
 
-    CPLStringList aosOptions;
-    aosOptions.SetNameValue("XOFF", CPLSPrintf("%d", nXOff));
-    aosOptions.SetNameValue("YOFF", CPLSPrintf("%d", nYOff));
-    aosOptions.SetNameValue("XSIZE", CPLSPrintf("%d", nXSize));
-    aosOptions.SetNameValue("YSIZE", CPLSPrintf("%d", nYSize));
     bool bOK = GDALRegenerateOverviewsMultiBand(
                    nBandCount, apoSrcBands.data(),
                    static_cast<int>(anOvrIndices.size()),
                    apapoOverviewBands.data(), pszResampling, pfnProgress,
-                   pProgressArg, aosOptions.List()) == CE_None;
+                   pProgressArg, papszOptions) == CE_None;
     for (auto papoOverviewBands : apapoOverviewBands)
         CPLFree(papoOverviewBands);
     return bOK;
 }
 
+static bool PartialRefresh(GDALDataset *poDS,
+                           const std::vector<int> &anOvrIndices, int nBandCount,
+                           const int *panBandList, const char *pszResampling,
+                           int nXOff, int nYOff, int nXSize, int nYSize,
+                           GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("XOFF", CPLSPrintf("%d", nXOff));
+    aosOptions.SetNameValue("YOFF", CPLSPrintf("%d", nYOff));
+    aosOptions.SetNameValue("XSIZE", CPLSPrintf("%d", nXSize));
+    aosOptions.SetNameValue("YSIZE", CPLSPrintf("%d", nYSize));
+    return PartialRefresh(poDS, anOvrIndices, nBandCount, panBandList,
+                          pszResampling, aosOptions.List(), pfnProgress,
+                          pProgressArg);
+}
+
 /************************************************************************/
 /*                           GetOvrIndices()                            */
 /************************************************************************/
@@ -551,6 +562,48 @@ static bool PartialRefreshFromProjWin(
                           pfnProgress, pProgressArg);
 }
 
+/************************************************************************/
+/*                    PartialRefreshFromDirtyRegions()                  */
+/************************************************************************/
+
+static bool PartialRefreshFromDirtyRegions(
+    GDALDataset *poDS, const char *pszResampling, int nLevelCount,
+    const int *panLevels, int nBandCount, const int *panBandList,
+    bool bMinSizeSpecified, int nMinSize, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    std::vector<int> anOvrIndices;
+    if (!GetOvrIndices(poDS, nLevelCount, panLevels, bMinSizeSpecified,
+                       nMinSize, anOvrIndices))
+        return false;
+
+    const auto aoRegions = poDS->GetDirtyRegions();
+    if (aoRegions.empty())
+    {
+        if (pfnProgress == GDALDummyProgress)
+            CPLDebug("GDAL", "No dirty region");
+        else
+            printf("No dirty region to refresh.\n");
+        return true;
+    }
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("DIRTY_REGIONS",
+                            GDALSerializeRasterWindows(aoRegions).c_str());
+    if (!PartialRefresh(poDS, anOvrIndices, nBandCount, panBandList,
+                        pszResampling, aosOptions.List(), pfnProgress,
+                        pProgressArg))
+    {
+        return false;
+    }
+
+    // Only forget the dirty regions when all levels have been refreshed.
+    const auto poBand = poDS->GetRasterBand(1);
+    if (static_cast<int>(anOvrIndices.size()) == poBand->GetOverviewCount())
+        poDS->ClearDirtyRegions();
+    return true;
+}
+
 /************************************************************************/
 /*                                main()                                */
 /************************************************************************/
@@ -643,6 +696,7 @@ MAIN_START(nArgc, papszArgv)
 
     bool bClean = false;
     bool bPartialRefreshFromSourceTimestamp = false;
+    bool bPartialRefreshFromDirtyRegions = false;
     std::string osPartialRefreshFromSourceExtent;
 
     {
@@ -669,6 +723,11 @@ MAIN_START(nArgc, papszArgv)
             .help(
                 _("Performs a partial refresh of existing overviews, in the "
                   "region of interest specified by one or several filename."));
+
+        group.add_argument("--partial-refresh-from-dirty-regions")
+            .store_into(bPartialRefreshFromDirtyRegions)
+            .help(_("Performs a partial refresh of existing overviews, in the "
+                    "regions recorded as modified by the driver."));
     }
 
     std::string osFilename;
@@ -828,6 +887,17 @@ MAIN_START(nArgc, papszArgv)
             nResultStatus = 1;
         }
     }
+    else if (bPartialRefreshFromDirtyRegions)
+    {
+        if (!PartialRefreshFromDirtyRegions(
+                GDALDataset::FromHandle(hDataset), osResampling.c_str(),
+                static_cast<int>(anLevels.size()), anLevels.data(), nBandCount,
+                anBandList.data(), bMinSizeSpecified, nMinSize, pfnProgress,
+                pProgressArg))
+        {
+            nResultStatus = 1;
+        }
+    }
     else if (!aosSources.empty())
     {
         if (!PartialRefreshFromSourceExtent(
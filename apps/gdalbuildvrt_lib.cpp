@@ -42,7 +42,9 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
@@ -50,14 +52,17 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_vrt.h"
 #include "gdal_priv.h"
 #include "gdal_proxy.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
@@ -254,6 +259,7 @@ class VRTBuilder
     bool bUseSrcMaskBand = true;
     bool bNoDataFromMask = false;
     double dfMaskValueThreshold = 0;
+    int nNumThreads = 1;
 
     /* Internal variables */
     char *pszProjectionRef = nullptr;
@@ -291,7 +297,7 @@ class VRTBuilder
                const char *pszVRTNoData, bool bUseSrcMaskBand,
                bool bNoDataFromMask, double dfMaskValueThreshold,
                const char *pszOutputSRS, const char *pszResampling,
-               const char *const *papszOpenOptionsIn);
+               const char *const *papszOpenOptionsIn, int nNumThreadsIn);
 
     ~VRTBuilder();
 
@@ -313,8 +319,9 @@ VRTBuilder::VRTBuilder(
     const char *pszSrcNoDataIn, const char *pszVRTNoDataIn,
     bool bUseSrcMaskBandIn, bool bNoDataFromMaskIn,
     double dfMaskValueThresholdIn, const char *pszOutputSRSIn,
-    const char *pszResamplingIn, const char *const *papszOpenOptionsIn)
-    : bStrict(bStrictIn)
+    const char *pszResamplingIn, const char *const *papszOpenOptionsIn,
+    int nNumThreadsIn)
+    : bStrict(bStrictIn), nNumThreads(std::max(1, nNumThreadsIn))
 {
     pszOutputFilename = CPLStrdup(pszOutputFilenameIn);
     nInputFiles = nInputFilesIn;
@@ -1437,6 +1444,145 @@ void VRTBuilder::CreateVRTNonSeparate(VRTDatasetH hVRTDS)
     }
 }
 
+/************************************************************************/
+/*                        VRTBuilderDatasetOpener                       */
+/************************************************************************/
+
+/* Opens the input datasets of a VRTBuilder ahead of their analysis, from
+ * worker threads. Opening a dataset (and probing its side-car files for
+ * overviews and masks) is what dominates the run time of gdalbuildvrt on
+ * network file systems or cloud storage. The analysis itself remains
+ * sequential and in the order of the input files, so that the result is
+ * the same as with a single thread. At most a few datasets per thread are
+ * opened ahead, to bound the number of simultaneously opened files.
+ */
+class VRTBuilderDatasetOpener
+{
+    CPL_DISALLOW_COPY_ASSIGN(VRTBuilderDatasetOpener)
+
+    struct Job
+    {
+        VRTBuilderDatasetOpener *poOpener = nullptr;
+        const char *pszFilename = nullptr;
+        GDALDatasetH hDS = nullptr;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        bool bDone = false;
+    };
+
+    CSLConstList m_papszOpenOptions = nullptr;
+    std::vector<Job> m_asJobs{};
+    std::unique_ptr<CPLJobQueue> m_poQueue{};
+    int m_nMaxAhead = 0;
+    int m_nSubmitted = 0;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+
+    static void OpenFunc(void *pData);
+
+  public:
+    VRTBuilderDatasetOpener(CPLWorkerThreadPool *poPool,
+                            const char *const *papszFilenames, int nFiles,
+                            CSLConstList papszOpenOptions);
+    ~VRTBuilderDatasetOpener();
+
+    int GetFileCount() const
+    {
+        return static_cast<int>(m_asJobs.size());
+    }
+
+    GDALDatasetH Get(int i);
+};
+
+VRTBuilderDatasetOpener::VRTBuilderDatasetOpener(
+    CPLWorkerThreadPool *poPool, const char *const *papszFilenames,
+    int nFiles, CSLConstList papszOpenOptions)
+    : m_papszOpenOptions(papszOpenOptions), m_asJobs(nFiles),
+      m_poQueue(poPool->CreateJobQueue()),
+      m_nMaxAhead(2 * poPool->GetThreadCount())
+{
+    for (int i = 0; i < nFiles; ++i)
+    {
+        m_asJobs[i].poOpener = this;
+        m_asJobs[i].pszFilename = papszFilenames[i];
+    }
+}
+
+VRTBuilderDatasetOpener::~VRTBuilderDatasetOpener()
+{
+    m_poQueue->WaitCompletion();
+    for (auto &sJob : m_asJobs)
+    {
+        if (sJob.hDS)
+            GDALClose(sJob.hDS);
+    }
+}
+
+void VRTBuilderDatasetOpener::OpenFunc(void *pData)
+{
+    Job *psJob = static_cast<Job *>(pData);
+    CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+    GDALDatasetH hDS =
+        GDALOpenEx(psJob->pszFilename, GDAL_OF_RASTER, nullptr,
+                   psJob->poOpener->m_papszOpenOptions, nullptr);
+    if (hDS)
+    {
+        // Trigger the lazy loading of what AnalyseRaster() will query,
+        // while we are still in a worker thread.
+        GDALDataset *poDS = GDALDataset::FromHandle(hDS);
+        double adfGeoTransform[6];
+        CPL_IGNORE_RET_VAL(poDS->GetGeoTransform(adfGeoTransform));
+        CPL_IGNORE_RET_VAL(poDS->GetSpatialRef());
+        for (int j = 1; j <= poDS->GetRasterCount(); ++j)
+        {
+            GDALRasterBand *poBand = poDS->GetRasterBand(j);
+            CPL_IGNORE_RET_VAL(poBand->GetMaskFlags());
+            if (j == 1)
+                CPL_IGNORE_RET_VAL(poBand->GetOverviewCount());
+        }
+    }
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard oLock(psJob->poOpener->m_oMutex);
+    psJob->hDS = hDS;
+    psJob->bDone = true;
+    psJob->poOpener->m_oCV.notify_all();
+}
+
+/* Returns the dataset for the i-th file (or nullptr if it cannot be opened),
+ * whose ownership is transferred to the caller, and re-emits in the calling
+ * thread the errors emitted while opening it. Must be called with
+ * increasing values of i. */
+GDALDatasetH VRTBuilderDatasetOpener::Get(int i)
+{
+    const int nFiles = GetFileCount();
+    const int nUpTo = static_cast<int>(
+        std::min<int64_t>(nFiles, static_cast<int64_t>(i) + 1 + m_nMaxAhead));
+    for (; m_nSubmitted < nUpTo; ++m_nSubmitted)
+    {
+        if (!m_poQueue->SubmitJob(OpenFunc, &m_asJobs[m_nSubmitted]))
+        {
+            // Should not happen. Open the remaining files synchronously.
+            for (; m_nSubmitted < nUpTo; ++m_nSubmitted)
+                OpenFunc(&m_asJobs[m_nSubmitted]);
+        }
+    }
+
+    Job &sJob = m_asJobs[i];
+    GDALDatasetH hDS;
+    {
+        std::unique_lock oLock(m_oMutex);
+        m_oCV.wait(oLock, [&sJob] { return sJob.bDone; });
+        hDS = sJob.hDS;
+        sJob.hDS = nullptr;
+    }
+    for (const auto &oError : sJob.aoErrors)
+    {
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+    sJob.aoErrors.clear();
+    return hDS;
+}
+
 /************************************************************************/
 /*                             Build()                                  */
 /************************************************************************/
@@ -1540,6 +1686,22 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
         }
     }
 
+    // Open the input datasets from worker threads when several threads are
+    // allowed. Datasets added by expansion of subdatasets are opened
+    // synchronously.
+    std::unique_ptr<VRTBuilderDatasetOpener> poOpener;
+    if (pahSrcDS == nullptr && ppszInputFilenames != nullptr &&
+        nNumThreads > 1 && nInputFiles > 1)
+    {
+        CPLWorkerThreadPool *poPool =
+            GDALGetGlobalThreadPool(std::min(nNumThreads, nInputFiles));
+        if (poPool)
+        {
+            poOpener = std::make_unique<VRTBuilderDatasetOpener>(
+                poPool, ppszInputFilenames, nInputFiles, papszOpenOptions);
+        }
+    }
+
     bool bFoundValid = false;
     for (int i = 0; ppszInputFilenames != nullptr && i < nInputFiles; i++)
     {
@@ -1550,10 +1712,14 @@ GDALDataset *VRTBuilder::Build(GDALProgressFunc pfnProgress,
             return nullptr;
         }
 
-        GDALDatasetH hDS = (pahSrcDS)
-                               ? pahSrcDS[i]
-                               : GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
-                                            papszOpenOptions, nullptr);
+        GDALDatasetH hDS;
+        if (pahSrcDS)
+            hDS = pahSrcDS[i];
+        else if (poOpener && i < poOpener->GetFileCount())
+            hDS = poOpener->Get(i);
+        else
+            hDS = GDALOpenEx(dsFileName, GDAL_OF_RASTER, nullptr,
+                             papszOpenOptions, nullptr);
         asDatasetProperties[i].isFileOK = FALSE;
 
         if (hDS)
@@ -1760,6 +1926,10 @@ struct GDALBuildVRTOptions
     bool bNoDataFromMask = false;
     double dfMaskValueThreshold = 0;
 
+    /*! number of threads used to open input datasets (0 = from the
+     * GDAL_NUM_THREADS configuration option) */
+    int nNumThreads = 0;
+
     /*! allow or suppress progress monitor and other non-error output */
     bool bQuiet = true;
 
@@ -1890,6 +2060,21 @@ GDALDatasetH GDALBuildVRT(const char *pszDest, int nSrcCount,
     if (!sOptions.osSrcNoData.empty() && sOptions.osVRTNoData.empty())
         sOptions.osVRTNoData = sOptions.osSrcNoData;
 
+    int nNumThreads = sOptions.nNumThreads;
+    if (nNumThreads <= 0)
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                              ? CPLGetNumCPUs()
+                              : atoi(pszNumThreads);
+        }
+    }
+    // Cap to avoid unreasonable values
+    nNumThreads = std::max(1, std::min(1024, nNumThreads));
+
     VRTBuilder oBuilder(
         sOptions.bStrict, pszDest, nSrcCount, papszSrcDSNames, pahSrcDS,
         sOptions.anSelectedBandList.empty()
@@ -1906,7 +2091,7 @@ GDALDatasetH GDALBuildVRT(const char *pszDest, int nSrcCount,
         sOptions.dfMaskValueThreshold,
         sOptions.osOutputSRS.empty() ? nullptr : sOptions.osOutputSRS.c_str(),
         sOptions.osResampling.empty() ? nullptr : sOptions.osResampling.c_str(),
-        sOptions.aosOpenOptions.List());
+        sOptions.aosOpenOptions.List(), nNumThreads);
 
     return GDALDataset::ToHandle(
         oBuilder.Build(sOptions.pfnProgress, sOptions.pProgressData));
@@ -2175,6 +2360,21 @@ GDALBuildVRTOptionsGetParser(GDALBuildVRTOptions *psOptions,
                 "when the value of the mask band of the source is less or "
                 "equal to the threshold."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<num_threads>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (EQUAL(s.c_str(), "ALL_CPUS"))
+                    psOptions->nNumThreads = CPLGetNumCPUs();
+                else
+                    psOptions->nNumThreads = atoi(s.c_str());
+                if (psOptions->nNumThreads < 1)
+                    throw std::invalid_argument(
+                        "Invalid value for -num_threads: " + s);
+            })
+        .help(_("Number of threads used to open input datasets."));
+
     if (psOptionsForBinary)
     {
         if (psOptionsForBinary->osDstFilename.empty())
@@ -109,7 +109,13 @@
 #endif
 
 #include <algorithm>
+#include <climits>
+#include <condition_variable>
+#include <deque>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "cpl_error.h"
 #include "cpl_progress.h"
@@ -117,6 +123,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__SSE2__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -124,6 +131,11 @@
 #include "emmintrin.h"
 #endif
 
+#if (defined(__x86_64) || defined(_M_X64)) && !defined(USE_SSE2_EMULATION)
+#define HAVE_GDALDEM_ROW_KERNELS
+#include "gdalsse_priv.h"
+#endif
+
 static const double kdfDegreesToRadians = M_PI / 180.0;
 static const double kdfRadiansToDegrees = 180.0 / M_PI;
 
@@ -196,8 +208,8 @@ template <class T> struct GDALGeneric3x3ProcessingAlg
 template <class T> struct GDALGeneric3x3ProcessingAlg_multisample
 {
     typedef int (*type)(const T *pafThreeLineWin, int nLine1Off, int nLine2Off,
-                        int nLine3Off, int nXSize, void *pData,
-                        float *pafOutputBuf);
+                        int nLine3Off, int nXSize, float fDstNoDataValue,
+                        void *pData, float *pafOutputBuf);
 };
 
 template <class T>
@@ -292,6 +304,385 @@ GInt32 INTERPOL(GInt32 a, GInt32 b, int bSrcHasNoData, GInt32 fSrcNoDataValue)
     return nVal;
 }
 
+/************************************************************************/
+/*                     GDALGeneric3x3IsNoData()                         */
+/************************************************************************/
+
+template <class T>
+static bool GDALGeneric3x3IsNoData(T fVal, T fSrcNoDataValue,
+                                   bool bIsSrcNoDataNan);
+
+template <>
+bool GDALGeneric3x3IsNoData(float fVal, float fSrcNoDataValue,
+                            bool bIsSrcNoDataNan)
+{
+    return bIsSrcNoDataNan ? CPLIsNan(fVal)
+                           : ARE_REAL_EQUAL(fVal, fSrcNoDataValue);
+}
+
+template <>
+bool GDALGeneric3x3IsNoData(GInt32 fVal, GInt32 fSrcNoDataValue,
+                            bool /* bIsSrcNoDataNan */)
+{
+    return fVal == fSrcNoDataValue;
+}
+
+/************************************************************************/
+/*                  GDALGeneric3x3LineHasNoData()                       */
+/************************************************************************/
+
+// Whether a source line of integer type contains the nodata value
+template <class T>
+static bool GDALGeneric3x3LineHasNoData(const T *pafLine, int nXSize,
+                                        T fSrcNoDataValue)
+{
+    int iX = 0;
+    for (; iX + 3 < nXSize; iX += 4)
+    {
+        if (pafLine[iX] == fSrcNoDataValue ||
+            pafLine[iX + 1] == fSrcNoDataValue ||
+            pafLine[iX + 2] == fSrcNoDataValue ||
+            pafLine[iX + 3] == fSrcNoDataValue)
+        {
+            return true;
+        }
+    }
+    for (; iX < nXSize; iX++)
+    {
+        if (pafLine[iX] == fSrcNoDataValue)
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                 GDALGeneric3x3ProcessInteriorLine()                  */
+/************************************************************************/
+
+template <class T> struct GDALGeneric3x3ProcessingParams
+{
+    int nXSize = 0;
+    bool bSrcHasNoData = false;
+    T fSrcNoDataValue = 0;
+    bool bIsSrcNoDataNan = false;
+    float fDstNoDataValue = 0;
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg = nullptr;
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
+        pfnAlg_multisample = nullptr;
+    void *pData = nullptr;
+    bool bComputeAtEdges = false;
+};
+
+// Compute an output line that is neither the first nor the last one of the
+// raster, from the source lines above, at and below it, which are at offsets
+// nLine1Off, nLine2Off and nLine3Off of pafThreeLineWin.
+template <class T>
+static void GDALGeneric3x3ProcessInteriorLine(
+    const GDALGeneric3x3ProcessingParams<T> &sParams,
+    const T *pafThreeLineWin, int nLine1Off, int nLine2Off, int nLine3Off,
+    bool bOneOfThreeLinesHasNoData, float *pafOutputBuf)
+{
+    const int nXSize = sParams.nXSize;
+    const bool bSrcHasNoData = sParams.bSrcHasNoData;
+    const T fSrcNoDataValue = sParams.fSrcNoDataValue;
+    const bool bIsSrcNoDataNan = sParams.bIsSrcNoDataNan;
+    const float fDstNoDataValue = sParams.fDstNoDataValue;
+    const auto pfnAlg = sParams.pfnAlg;
+    void *const pData = sParams.pData;
+    const bool bComputeAtEdges = sParams.bComputeAtEdges;
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        int j = 0;
+        T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
+                               pafThreeLineWin[nLine1Off + j + 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine1Off + j],
+                      pafThreeLineWin[nLine1Off + j + 1],
+                      INTERPOL(pafThreeLineWin[nLine2Off + j],
+                               pafThreeLineWin[nLine2Off + j + 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine2Off + j],
+                      pafThreeLineWin[nLine2Off + j + 1],
+                      INTERPOL(pafThreeLineWin[nLine3Off + j],
+                               pafThreeLineWin[nLine3Off + j + 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine3Off + j],
+                      pafThreeLineWin[nLine3Off + j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData,
+                                     fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                                     fDstNoDataValue, pfnAlg, pData,
+                                     bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        pafOutputBuf[0] = fDstNoDataValue;
+    }
+
+    const auto ComputePixel = [&](int iX)
+    {
+        T afWin[9] = {pafThreeLineWin[nLine1Off + iX - 1],
+                      pafThreeLineWin[nLine1Off + iX],
+                      pafThreeLineWin[nLine1Off + iX + 1],
+                      pafThreeLineWin[nLine2Off + iX - 1],
+                      pafThreeLineWin[nLine2Off + iX],
+                      pafThreeLineWin[nLine2Off + iX + 1],
+                      pafThreeLineWin[nLine3Off + iX - 1],
+                      pafThreeLineWin[nLine3Off + iX],
+                      pafThreeLineWin[nLine3Off + iX + 1]};
+
+        pafOutputBuf[iX] = ComputeVal(bOneOfThreeLinesHasNoData,
+                                      fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                                      fDstNoDataValue, pfnAlg, pData,
+                                      bComputeAtEdges);
+    };
+
+    const auto pfnAlg_multisample = sParams.pfnAlg_multisample;
+    int j = 1;
+    if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+    {
+        j = pfnAlg_multisample(pafThreeLineWin, nLine1Off, nLine2Off,
+                               nLine3Off, nXSize, fDstNoDataValue, pData,
+                               pafOutputBuf);
+    }
+    else if (pfnAlg_multisample)
+    {
+        // Use the row kernel on the runs of pixels whose 3x3 window has no
+        // nodata value, and the per-pixel code path on the other ones.
+        const auto IsValidColumn = [&](int iX)
+        {
+            return !GDALGeneric3x3IsNoData(pafThreeLineWin[nLine1Off + iX],
+                                           fSrcNoDataValue, bIsSrcNoDataNan) &&
+                   !GDALGeneric3x3IsNoData(pafThreeLineWin[nLine2Off + iX],
+                                           fSrcNoDataValue, bIsSrcNoDataNan) &&
+                   !GDALGeneric3x3IsNoData(pafThreeLineWin[nLine3Off + iX],
+                                           fSrcNoDataValue, bIsSrcNoDataNan);
+        };
+
+        while (j < nXSize - 1)
+        {
+            // Columns [j - 1, iEnd[ have no nodata value, so pixels
+            // [j, iEnd - 1[ can be computed by the row kernel.
+            int iEnd = j - 1;
+            while (iEnd < nXSize && IsValidColumn(iEnd))
+                ++iEnd;
+            if (iEnd - j > 4)
+            {
+                j += pfnAlg_multisample(pafThreeLineWin + j - 1, nLine1Off,
+                                        nLine2Off, nLine3Off, iEnd - j + 1,
+                                        fDstNoDataValue, pData,
+                                        pafOutputBuf + j - 1) -
+                     1;
+            }
+            // Remaining pixels of the run, and pixels whose window includes
+            // column iEnd.
+            const int jLast = std::min(iEnd + 1, nXSize - 2);
+            for (; j <= jLast; j++)
+                ComputePixel(j);
+        }
+    }
+
+    for (; j < nXSize - 1; j++)
+        ComputePixel(j);
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        j = nXSize - 1;
+
+        T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
+                      pafThreeLineWin[nLine1Off + j],
+                      INTERPOL(pafThreeLineWin[nLine1Off + j],
+                               pafThreeLineWin[nLine1Off + j - 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine2Off + j - 1],
+                      pafThreeLineWin[nLine2Off + j],
+                      INTERPOL(pafThreeLineWin[nLine2Off + j],
+                               pafThreeLineWin[nLine2Off + j - 1],
+                               bSrcHasNoData, fSrcNoDataValue),
+                      pafThreeLineWin[nLine3Off + j - 1],
+                      pafThreeLineWin[nLine3Off + j],
+                      INTERPOL(pafThreeLineWin[nLine3Off + j],
+                               pafThreeLineWin[nLine3Off + j - 1],
+                               bSrcHasNoData, fSrcNoDataValue)};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData,
+                                     fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                                     fDstNoDataValue, pfnAlg, pData,
+                                     bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        if (nXSize > 1)
+            pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+    }
+}
+
+/************************************************************************/
+/*                GDALGeneric3x3ProcessInteriorLinesMT()                */
+/************************************************************************/
+
+namespace
+{
+template <class T> struct GDALGeneric3x3Strip
+{
+    const GDALGeneric3x3ProcessingParams<T> *psParams = nullptr;
+    std::mutex *poMutex = nullptr;
+    std::condition_variable *poCV = nullptr;
+    int nFirstLine = 0;      // first output line
+    int nLines = 0;          // number of output lines
+    std::vector<T> aSrc{};   // source lines nFirstLine-1 to nFirstLine+nLines
+    std::vector<float> afOutput{};
+    bool bDone = false;  // protected by *poMutex
+};
+}  // namespace
+
+template <class T> static void GDALGeneric3x3StripJob(void *pData)
+{
+    auto psStrip = static_cast<GDALGeneric3x3Strip<T> *>(pData);
+    const auto &sParams = *(psStrip->psParams);
+    const int nXSize = sParams.nXSize;
+    const bool bCheckLineNoData =
+        std::numeric_limits<T>::is_integer && sParams.bSrcHasNoData;
+
+    std::vector<bool> abLineHasNoData(psStrip->nLines + 2,
+                                      sParams.bSrcHasNoData);
+    if (bCheckLineNoData)
+    {
+        for (int i = 0; i < psStrip->nLines + 2; ++i)
+        {
+            abLineHasNoData[i] = GDALGeneric3x3LineHasNoData(
+                psStrip->aSrc.data() + static_cast<size_t>(i) * nXSize, nXSize,
+                sParams.fSrcNoDataValue);
+        }
+    }
+
+    for (int i = 0; i < psStrip->nLines; ++i)
+    {
+        GDALGeneric3x3ProcessInteriorLine(
+            sParams, psStrip->aSrc.data(), i * nXSize, (i + 1) * nXSize,
+            (i + 2) * nXSize,
+            abLineHasNoData[i] || abLineHasNoData[i + 1] ||
+                abLineHasNoData[i + 2],
+            psStrip->afOutput.data() + static_cast<size_t>(i) * nXSize);
+    }
+
+    std::lock_guard<std::mutex> oLock(*(psStrip->poMutex));
+    psStrip->bDone = true;
+    psStrip->poCV->notify_all();
+}
+
+// Compute the output lines 1 to nYSize-2 by strips of lines that are read,
+// with a 1-line halo, and written in order from the calling thread, and
+// processed in worker threads.
+template <class T>
+static CPLErr GDALGeneric3x3ProcessInteriorLinesMT(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand, GDALDataType eReadDT,
+    const GDALGeneric3x3ProcessingParams<T> &sParams, CPLJobQueue *poJobQueue,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nXSize = sParams.nXSize;
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    // Strips of about 1 million pixels
+    const int nStripLines =
+        std::max(1, std::min(nYSize - 2, (1024 * 1024) / nXSize));
+
+    std::mutex oMutex;
+    std::condition_variable oCV;
+    std::vector<std::unique_ptr<GDALGeneric3x3Strip<T>>> apoFreeStrips;
+    for (int i = 0; i < 2 * nThreads; ++i)
+    {
+        auto poStrip = std::make_unique<GDALGeneric3x3Strip<T>>();
+        poStrip->psParams = &sParams;
+        poStrip->poMutex = &oMutex;
+        poStrip->poCV = &oCV;
+        apoFreeStrips.push_back(std::move(poStrip));
+    }
+    std::deque<std::unique_ptr<GDALGeneric3x3Strip<T>>> apoPendingStrips;
+
+    // Wait for the oldest submitted strip and write it
+    const auto WriteOldestStrip = [&]()
+    {
+        auto poStrip = std::move(apoPendingStrips.front());
+        apoPendingStrips.pop_front();
+        {
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock, [&poStrip] { return poStrip->bDone; });
+        }
+        CPLErr eErr = GDALRasterIO(hDstBand, GF_Write, 0, poStrip->nFirstLine,
+                                   nXSize, poStrip->nLines,
+                                   poStrip->afOutput.data(), nXSize,
+                                   poStrip->nLines, GDT_Float32, 0, 0);
+        if (eErr == CE_None &&
+            !pfnProgress(1.0 * (poStrip->nFirstLine + poStrip->nLines + 1) /
+                             nYSize,
+                         nullptr, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+        apoFreeStrips.push_back(std::move(poStrip));
+        return eErr;
+    };
+
+    CPLErr eErr = CE_None;
+    for (int nFirstLine = 1; eErr == CE_None && nFirstLine < nYSize - 1;)
+    {
+        if (apoFreeStrips.empty())
+        {
+            eErr = WriteOldestStrip();
+            continue;
+        }
+        auto poStrip = std::move(apoFreeStrips.back());
+        apoFreeStrips.pop_back();
+        poStrip->nFirstLine = nFirstLine;
+        poStrip->nLines = std::min(nStripLines, nYSize - 1 - nFirstLine);
+        poStrip->bDone = false;
+        try
+        {
+            poStrip->aSrc.resize(static_cast<size_t>(poStrip->nLines + 2) *
+                                 nXSize);
+            poStrip->afOutput.resize(static_cast<size_t>(poStrip->nLines) *
+                                     nXSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate strip buffers");
+            eErr = CE_Failure;
+            break;
+        }
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, nFirstLine - 1, nXSize,
+                            poStrip->nLines + 2, poStrip->aSrc.data(), nXSize,
+                            poStrip->nLines + 2, eReadDT, 0, 0);
+        if (eErr != CE_None)
+            break;
+        nFirstLine += poStrip->nLines;
+        auto psStrip = poStrip.get();
+        apoPendingStrips.push_back(std::move(poStrip));
+        poJobQueue->SubmitJob(GDALGeneric3x3StripJob<T>, psStrip);
+    }
+
+    while (!apoPendingStrips.empty())
+    {
+        if (eErr == CE_None)
+        {
+            eErr = WriteOldestStrip();
+        }
+        else
+        {
+            // Only wait for the jobs that reference the strips
+            poJobQueue->WaitCompletion();
+            apoPendingStrips.clear();
+        }
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                  GDALGeneric3x3Processing()                          */
 /************************************************************************/
@@ -302,8 +693,8 @@ static CPLErr GDALGeneric3x3Processing(
     typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg,
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisample,
-    void *pData, bool bComputeAtEdges, GDALProgressFunc pfnProgress,
-    void *pProgressData)
+    void *pData, bool bComputeAtEdges, int nThreads,
+    GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
@@ -477,7 +868,49 @@ static CPLErr GDALGeneric3x3Processing(
         return eErr;
     }
 
+    GDALGeneric3x3ProcessingParams<T> sParams;
+    sParams.nXSize = nXSize;
+    sParams.bSrcHasNoData = CPL_TO_BOOL(bSrcHasNoData);
+    sParams.fSrcNoDataValue = fSrcNoDataValue;
+    sParams.bIsSrcNoDataNan = CPL_TO_BOOL(bIsSrcNoDataNan);
+    sParams.fDstNoDataValue = fDstNoDataValue;
+    sParams.pfnAlg = pfnAlg;
+    sParams.pfnAlg_multisample = pfnAlg_multisample;
+    sParams.pData = pData;
+    sParams.bComputeAtEdges = bComputeAtEdges;
+
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    // Offsets of lines in strips must fit on an int
+    if (nThreads >= 2 && nYSize >= 3 && nXSize <= INT_MAX / 4)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
     int i = 1;  // Used after for.
+    if (poJobQueue)
+    {
+        eErr = GDALGeneric3x3ProcessInteriorLinesMT(
+            hSrcBand, hDstBand, eReadDT, sParams, poJobQueue.get(), nThreads,
+            pfnProgress, pProgressData);
+        i = nYSize - 1;
+        // Load the last 2 lines for the processing of the last line
+        nLine1Off = 0;
+        nLine2Off = nXSize;
+        if (eErr == CE_None && bComputeAtEdges && nXSize >= 2)
+        {
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, nYSize - 2, nXSize, 2,
+                                pafThreeLineWin, nXSize, 2, eReadDT, 0, 0);
+        }
+        if (eErr != CE_None)
+        {
+            CPLFree(pafOutputBuf);
+            CPLFree(pafThreeLineWin);
+
+            return eErr;
+        }
+    }
     for (; i < nYSize - 1; i++)
     {
         /* Read third line of the line buffer */
@@ -497,29 +930,8 @@ static CPLErr GDALGeneric3x3Processing(
         bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
         if (std::numeric_limits<T>::is_integer && bSrcHasNoData)
         {
-            bool bLastLineHasNoDataValue = false;
-            int iX = 0;
-            for (; iX + 3 < nXSize; iX += 4)
-            {
-                if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 1] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 2] == fSrcNoDataValue ||
-                    pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
-                {
-                    bLastLineHasNoDataValue = true;
-                    break;
-                }
-            }
-            if (!bLastLineHasNoDataValue)
-            {
-                for (; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
-                    {
-                        bLastLineHasNoDataValue = true;
-                    }
-                }
-            }
+            const bool bLastLineHasNoDataValue = GDALGeneric3x3LineHasNoData(
+                pafThreeLineWin + nLine3Off, nXSize, fSrcNoDataValue);
             abLineHasNoDataValue[nLine3Off / nXSize] = bLastLineHasNoDataValue;
 
             bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
@@ -527,92 +939,10 @@ static CPLErr GDALGeneric3x3Processing(
                                         abLineHasNoDataValue[2];
         }
 
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
-        }
-
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
-        {
-            j = pfnAlg_multisample(pafThreeLineWin, nLine1Off, nLine2Off,
-                                   nLine3Off, nXSize, pData, pafOutputBuf);
-        }
-
-        for (; j < nXSize - 1; j++)
-        {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
-        }
-
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            j = nXSize - 1;
-
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
-
-            pafOutputBuf[j] =
-                ComputeVal(CPL_TO_BOOL(bOneOfThreeLinesHasNoData),
-                           fSrcNoDataValue, CPL_TO_BOOL(bIsSrcNoDataNan), afWin,
-                           fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
-        }
+        GDALGeneric3x3ProcessInteriorLine(sParams, pafThreeLineWin, nLine1Off,
+                                          nLine2Off, nLine3Off,
+                                          bOneOfThreeLinesHasNoData,
+                                          pafOutputBuf);
 
         /* -----------------------------------------
          * Write Line to Raster
@@ -849,6 +1179,22 @@ static double DifferenceBetweenAngles(double angle1, double angle2,
     return diff;
 }
 
+// Final step of GDALHillshadeIgorAlg(), shared with its row kernel.
+static float GDALHillshadeIgor(double slopeDegrees, double aspect,
+                               const GDALHillshadeAlgData *psData)
+{
+    double slopeStrength = slopeDegrees / 90;
+
+    double aspectDiff = DifferenceBetweenAngles(
+        aspect, M_PI * 3 / 2 - psData->azRadians, M_PI * 2);
+
+    double aspectStrength = 1 - aspectDiff / M_PI;
+
+    double shadowness = 1.0 - slopeStrength * aspectStrength;
+
+    return static_cast<float>(255.0 * shadowness);
+}
+
 template <class T, GradientAlg alg>
 static float GDALHillshadeIgorAlg(const T *afWin, float /*fDstNoDataValue*/,
                                   void *pData)
@@ -896,16 +1242,7 @@ static float GDALHillshadeIgorAlg(const T *afWin, float /*fDstNoDataValue*/,
         aspect = atan2(dy, -dx);
     }
 
-    double slopeStrength = slopeDegrees / 90;
-
-    double aspectDiff = DifferenceBetweenAngles(
-        aspect, M_PI * 3 / 2 - psData->azRadians, M_PI * 2);
-
-    double aspectStrength = 1 - aspectDiff / M_PI;
-
-    double shadowness = 1.0 - slopeStrength * aspectStrength;
-
-    return static_cast<float>(255.0 * shadowness);
+    return GDALHillshadeIgor(slopeDegrees, aspect, psData);
 }
 
 template <class T, GradientAlg alg>
@@ -978,7 +1315,8 @@ template <class T>
 static int
 GDALHillshadeAlg_same_res_multisample(const T *pafThreeLineWin, int nLine1Off,
                                       int nLine2Off, int nLine3Off, int nXSize,
-                                      void *pData, float *pafOutputBuf)
+                                      float /* fDstNoDataValue */, void *pData,
+                                      float *pafOutputBuf)
 {
     // Only valid for T == int
 
@@ -1084,6 +1422,20 @@ GDALHillshadeAlg_same_res_multisample(const T *pafThreeLineWin, int nLine1Off,
 
 static const double INV_SQUARE_OF_HALF_PI = 1.0 / ((M_PI * M_PI) / 4);
 
+// Final step of GDALHillshadeCombinedAlg(), shared with its row kernel.
+static float GDALHillshadeCombined(double cos_cang, double slope)
+{
+    double cang = acos(cos_cang);
+
+    // combined shading
+    cang = 1 - cang * atan(sqrt(slope)) * INV_SQUARE_OF_HALF_PI;
+
+    const float fcang =
+        cang <= 0.0 ? 1.0f : static_cast<float>(1.0 + (254.0 * cang));
+
+    return fcang;
+}
+
 template <class T, GradientAlg alg>
 static float GDALHillshadeCombinedAlg(const T *afWin, float /*fDstNoDataValue*/,
                                       void *pData)
@@ -1099,18 +1451,12 @@ static float GDALHillshadeCombinedAlg(const T *afWin, float /*fDstNoDataValue*/,
     const double slope = xx_plus_yy * psData->square_z;
 
     // ... then the shade value
-    double cang = acos(ApproxADivByInvSqrtB(
-        psData->sin_altRadians - (y * psData->cos_az_mul_cos_alt_mul_z -
-                                  x * psData->sin_az_mul_cos_alt_mul_z),
-        1 + slope));
-
-    // combined shading
-    cang = 1 - cang * atan(sqrt(slope)) * INV_SQUARE_OF_HALF_PI;
-
-    const float fcang =
-        cang <= 0.0 ? 1.0f : static_cast<float>(1.0 + (254.0 * cang));
-
-    return fcang;
+    return GDALHillshadeCombined(
+        ApproxADivByInvSqrtB(
+            psData->sin_altRadians - (y * psData->cos_az_mul_cos_alt_mul_z -
+                                      x * psData->sin_az_mul_cos_alt_mul_z),
+            1 + slope),
+        slope);
 }
 
 static void *GDALCreateHillshadeData(double *adfGeoTransform, double z,
@@ -1331,18 +1677,10 @@ typedef struct
     bool bAngleAsAzimuth;
 } GDALAspectAlgData;
 
-template <class T>
-static float GDALAspectAlg(const T *afWin, float fDstNoDataValue, void *pData)
+// Final step of the aspect algorithms, shared with their row kernels.
+static float GDALAspect(double dx, double dy, float fDstNoDataValue,
+                        const GDALAspectAlgData *psData)
 {
-    const GDALAspectAlgData *psData =
-        static_cast<const GDALAspectAlgData *>(pData);
-
-    const double dx = ((afWin[2] + afWin[5] + afWin[5] + afWin[8]) -
-                       (afWin[0] + afWin[3] + afWin[3] + afWin[6]));
-
-    const double dy = ((afWin[6] + afWin[7] + afWin[7] + afWin[8]) -
-                       (afWin[0] + afWin[1] + afWin[1] + afWin[2]));
-
     float aspect = static_cast<float>(atan2(dy, -dx) / kdfDegreesToRadians);
 
     if (dx == 0 && dy == 0)
@@ -1369,6 +1707,21 @@ static float GDALAspectAlg(const T *afWin, float fDstNoDataValue, void *pData)
     return aspect;
 }
 
+template <class T>
+static float GDALAspectAlg(const T *afWin, float fDstNoDataValue, void *pData)
+{
+    const GDALAspectAlgData *psData =
+        static_cast<const GDALAspectAlgData *>(pData);
+
+    const double dx = ((afWin[2] + afWin[5] + afWin[5] + afWin[8]) -
+                       (afWin[0] + afWin[3] + afWin[3] + afWin[6]));
+
+    const double dy = ((afWin[6] + afWin[7] + afWin[7] + afWin[8]) -
+                       (afWin[0] + afWin[1] + afWin[1] + afWin[2]));
+
+    return GDALAspect(dx, dy, fDstNoDataValue, psData);
+}
+
 template <class T>
 static float GDALAspectZevenbergenThorneAlg(const T *afWin,
                                             float fDstNoDataValue, void *pData)
@@ -1378,29 +1731,7 @@ static float GDALAspectZevenbergenThorneAlg(const T *afWin,
 
     const double dx = afWin[5] - afWin[3];
     const double dy = afWin[7] - afWin[1];
-    float aspect = static_cast<float>(atan2(dy, -dx) / kdfDegreesToRadians);
-    if (dx == 0 && dy == 0)
-    {
-        /* Flat area */
-        aspect = fDstNoDataValue;
-    }
-    else if (psData->bAngleAsAzimuth)
-    {
-        if (aspect > 90.0f)
-            aspect = 450.0f - aspect;
-        else
-            aspect = 90.0f - aspect;
-    }
-    else
-    {
-        if (aspect < 0)
-            aspect += 360.0f;
-    }
-
-    if (aspect == 360.0f)
-        aspect = 0.0;
-
-    return aspect;
+    return GDALAspect(dx, dy, fDstNoDataValue, psData);
 }
 
 static void *GDALCreateAspectData(bool bAngleAsAzimuth)
@@ -2672,6 +3003,719 @@ static float GDALRoughnessAlg(const T *afWin, float /*fDstNoDataValue*/,
     return static_cast<float>(pafRoughnessMax - pafRoughnessMin);
 }
 
+/************************************************************************/
+/*                            Row kernels                               */
+/************************************************************************/
+
+// The row kernels compute 4 consecutive output pixels at a time, directly
+// from the 3 source lines, and are used through the
+// GDALGeneric3x3ProcessingAlg_multisample interface for the parts of lines
+// whose 3x3 windows have no nodata value. They evaluate the same expressions,
+// in the same order and with the same types, as the above per-pixel
+// functions, so that results are identical.
+// Double precision computations use XMMReg4Double, which maps to a 256-bit
+// AVX register when the compiler targets AVX/AVX2, and to a pair of SSE2
+// registers otherwise.
+
+#ifdef HAVE_GDALDEM_ROW_KERNELS
+
+namespace
+{
+
+inline XMMReg4Double GDALDEMSet1(double dfVal)
+{
+    return XMMReg4Double::Load1ValHighAndLow(&dfVal);
+}
+
+inline XMMReg4Double GDALDEMToDouble(__m128i v)
+{
+    XMMReg4Double reg;
+#ifdef __AVX__
+    reg.ymm = _mm256_cvtepi32_pd(v);
+#else
+    reg.low.xmm = _mm_cvtepi32_pd(v);
+    reg.high.xmm = _mm_cvtepi32_pd(_mm_srli_si128(v, 8));
+#endif
+    return reg;
+}
+
+inline XMMReg4Double GDALDEMToDouble(__m128 v)
+{
+    XMMReg4Double reg;
+#ifdef __AVX__
+    reg.ymm = _mm256_cvtps_pd(v);
+#else
+    reg.low.xmm = _mm_cvtps_pd(v);
+    reg.high.xmm = _mm_cvtps_pd(_mm_movehl_ps(v, v));
+#endif
+    return reg;
+}
+
+inline XMMReg4Double GDALDEMSqrt(const XMMReg4Double &x)
+{
+    XMMReg4Double reg;
+#ifdef __AVX__
+    reg.ymm = _mm256_sqrt_pd(x.ymm);
+#else
+    reg.low.xmm = _mm_sqrt_pd(x.low.xmm);
+    reg.high.xmm = _mm_sqrt_pd(x.high.xmm);
+#endif
+    return reg;
+}
+
+// Mask of the lanes where x <= 0
+inline XMMReg4Double GDALDEMLessOrEqualZero(const XMMReg4Double &x)
+{
+    XMMReg4Double reg;
+#ifdef __AVX__
+    reg.ymm = _mm256_cmp_pd(x.ymm, _mm256_setzero_pd(), _CMP_LE_OQ);
+#else
+    reg.low.xmm = _mm_cmple_pd(x.low.xmm, _mm_setzero_pd());
+    reg.high.xmm = _mm_cmple_pd(x.high.xmm, _mm_setzero_pd());
+#endif
+    return reg;
+}
+
+#ifndef __AVX__
+inline __m128d GDALDEMApproxInvSqrt(__m128d regB)
+{
+    const __m128d regB_half = _mm_mul_pd(regB, _mm_set1_pd(0.5));
+    regB = _mm_cvtps_pd(_mm_rsqrt_ps(_mm_cvtpd_ps(regB)));
+    return _mm_mul_pd(
+        regB, _mm_sub_pd(_mm_set1_pd(1.5),
+                         _mm_mul_pd(regB_half, _mm_mul_pd(regB, regB))));
+}
+#endif
+
+// Vector version of ApproxADivByInvSqrtB()
+inline XMMReg4Double GDALDEMApproxADivByInvSqrtB(const XMMReg4Double &a,
+                                                 const XMMReg4Double &b)
+{
+    XMMReg4Double reg;
+#ifdef __AVX__
+    __m256d regB = b.ymm;
+    const __m256d regB_half = _mm256_mul_pd(regB, _mm256_set1_pd(0.5));
+    regB = _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(regB)));
+    regB = _mm256_mul_pd(
+        regB,
+        _mm256_sub_pd(_mm256_set1_pd(1.5),
+                      _mm256_mul_pd(regB_half, _mm256_mul_pd(regB, regB))));
+    reg.ymm = _mm256_mul_pd(a.ymm, regB);
+#else
+    reg.low.xmm = _mm_mul_pd(a.low.xmm, GDALDEMApproxInvSqrt(b.low.xmm));
+    reg.high.xmm = _mm_mul_pd(a.high.xmm, GDALDEMApproxInvSqrt(b.high.xmm));
+#endif
+    return reg;
+}
+
+// 4 consecutive source values
+template <class T> struct GDALDEMVec4
+{
+};
+
+template <> struct GDALDEMVec4<GInt32>
+{
+    __m128i v;
+
+    static inline GDALDEMVec4 Load(const GInt32 *ptr)
+    {
+        return {_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr))};
+    }
+
+    inline GDALDEMVec4 operator+(const GDALDEMVec4 &other) const
+    {
+        return {_mm_add_epi32(v, other.v)};
+    }
+
+    inline GDALDEMVec4 operator-(const GDALDEMVec4 &other) const
+    {
+        return {_mm_sub_epi32(v, other.v)};
+    }
+
+    inline GDALDEMVec4 Abs() const
+    {
+#ifdef __SSE4_1__
+        return {_mm_abs_epi32(v)};
+#else
+        const __m128i sign = _mm_srai_epi32(v, 31);
+        return {_mm_sub_epi32(_mm_xor_si128(v, sign), sign)};
+#endif
+    }
+
+    // a > b ? a : b
+    static inline GDALDEMVec4 Max(const GDALDEMVec4 &a, const GDALDEMVec4 &b)
+    {
+#ifdef __SSE4_1__
+        return {_mm_max_epi32(a.v, b.v)};
+#else
+        const __m128i mask = _mm_cmpgt_epi32(a.v, b.v);
+        return {_mm_or_si128(_mm_and_si128(mask, a.v),
+                             _mm_andnot_si128(mask, b.v))};
+#endif
+    }
+
+    // a < b ? a : b
+    static inline GDALDEMVec4 Min(const GDALDEMVec4 &a, const GDALDEMVec4 &b)
+    {
+#ifdef __SSE4_1__
+        return {_mm_min_epi32(a.v, b.v)};
+#else
+        const __m128i mask = _mm_cmplt_epi32(a.v, b.v);
+        return {_mm_or_si128(_mm_and_si128(mask, a.v),
+                             _mm_andnot_si128(mask, b.v))};
+#endif
+    }
+
+    inline __m128 ToFloat() const
+    {
+        return _mm_cvtepi32_ps(v);
+    }
+
+    inline XMMReg4Double ToDouble() const
+    {
+        return GDALDEMToDouble(v);
+    }
+};
+
+template <> struct GDALDEMVec4<float>
+{
+    __m128 v;
+
+    static inline GDALDEMVec4 Load(const float *ptr)
+    {
+        return {_mm_loadu_ps(ptr)};
+    }
+
+    inline GDALDEMVec4 operator+(const GDALDEMVec4 &other) const
+    {
+        return {_mm_add_ps(v, other.v)};
+    }
+
+    inline GDALDEMVec4 operator-(const GDALDEMVec4 &other) const
+    {
+        return {_mm_sub_ps(v, other.v)};
+    }
+
+    inline GDALDEMVec4 Abs() const
+    {
+        return {_mm_andnot_ps(_mm_set1_ps(-0.0f), v)};
+    }
+
+    // a > b ? a : b
+    static inline GDALDEMVec4 Max(const GDALDEMVec4 &a, const GDALDEMVec4 &b)
+    {
+        return {_mm_max_ps(a.v, b.v)};
+    }
+
+    // a < b ? a : b
+    static inline GDALDEMVec4 Min(const GDALDEMVec4 &a, const GDALDEMVec4 &b)
+    {
+        return {_mm_min_ps(a.v, b.v)};
+    }
+
+    inline __m128 ToFloat() const
+    {
+        return v;
+    }
+
+    inline XMMReg4Double ToDouble() const
+    {
+        return GDALDEMToDouble(v);
+    }
+};
+
+// 3x3 windows of 4 consecutive pixels: w[k] contains the values that
+// afWin[k] would have for each of the pixels.
+template <class T> struct GDALDEMWindow4
+{
+    GDALDEMVec4<T> w[9];
+
+    GDALDEMWindow4(const T *pafLine1, const T *pafLine2, const T *pafLine3)
+        : w{GDALDEMVec4<T>::Load(pafLine1),
+            GDALDEMVec4<T>::Load(pafLine1 + 1),
+            GDALDEMVec4<T>::Load(pafLine1 + 2),
+            GDALDEMVec4<T>::Load(pafLine2),
+            GDALDEMVec4<T>::Load(pafLine2 + 1),
+            GDALDEMVec4<T>::Load(pafLine2 + 2),
+            GDALDEMVec4<T>::Load(pafLine3),
+            GDALDEMVec4<T>::Load(pafLine3 + 1),
+            GDALDEMVec4<T>::Load(pafLine3 + 2)}
+    {
+    }
+
+    inline const GDALDEMVec4<T> &operator[](int k) const
+    {
+        return w[k];
+    }
+};
+
+// Un-scaled x and y gradients, as in Gradient<T, alg>::calc()
+template <class T, GradientAlg alg> struct GDALDEMRawGradient4
+{
+};
+
+template <class T> struct GDALDEMRawGradient4<T, GradientAlg::HORN>
+{
+    static inline GDALDEMVec4<T> X(const GDALDEMWindow4<T> &w)
+    {
+        return (w[0] + w[3] + w[3] + w[6]) - (w[2] + w[5] + w[5] + w[8]);
+    }
+
+    static inline GDALDEMVec4<T> Y(const GDALDEMWindow4<T> &w)
+    {
+        return (w[6] + w[7] + w[7] + w[8]) - (w[0] + w[1] + w[1] + w[2]);
+    }
+};
+
+template <class T>
+struct GDALDEMRawGradient4<T, GradientAlg::ZEVENBERGEN_THORNE>
+{
+    static inline GDALDEMVec4<T> X(const GDALDEMWindow4<T> &w)
+    {
+        return w[3] - w[5];
+    }
+
+    static inline GDALDEMVec4<T> Y(const GDALDEMWindow4<T> &w)
+    {
+        return w[7] - w[1];
+    }
+};
+
+/************************************************************************/
+/*                     GDALGeneric3x3RowKernel()                        */
+/************************************************************************/
+
+// Implements GDALGeneric3x3ProcessingAlg_multisample<T>::type on top of a
+// Kernel class whose Compute() method computes 4 pixels
+template <class T, class Kernel>
+int GDALGeneric3x3RowKernel(const T *pafThreeLineWin, int nLine1Off,
+                            int nLine2Off, int nLine3Off, int nXSize,
+                            float fDstNoDataValue, void *pData,
+                            float *pafOutputBuf)
+{
+    const Kernel oKernel(pData, fDstNoDataValue);
+
+    int j = 1;  // Used after for.
+    for (; j < nXSize - 4; j += 4)
+    {
+        const GDALDEMWindow4<T> w(pafThreeLineWin + nLine1Off + j - 1,
+                                  pafThreeLineWin + nLine2Off + j - 1,
+                                  pafThreeLineWin + nLine3Off + j - 1);
+        oKernel.Compute(w, pafOutputBuf + j);
+    }
+    return j;
+}
+
+/************************************************************************/
+/*                        Hillshade row kernels                         */
+/************************************************************************/
+
+// Same as GDALHillshadeAlg()
+template <class T, GradientAlg alg> struct GDALHillshadeRowKernel
+{
+    const XMMReg4Double inv_ewres, inv_nsres, square_z, sin_alt_254,
+        cos_az_254, sin_az_254;
+
+    GDALHillshadeRowKernel(const void *pData, float /* fDstNoDataValue */)
+        : GDALHillshadeRowKernel(
+              static_cast<const GDALHillshadeAlgData *>(pData))
+    {
+    }
+
+    explicit GDALHillshadeRowKernel(const GDALHillshadeAlgData *psData)
+        : inv_ewres(GDALDEMSet1(psData->inv_ewres)),
+          inv_nsres(GDALDEMSet1(psData->inv_nsres)),
+          square_z(GDALDEMSet1(psData->square_z)),
+          sin_alt_254(GDALDEMSet1(psData->sin_altRadians_mul_254)),
+          cos_az_254(GDALDEMSet1(psData->cos_az_mul_cos_alt_mul_z_mul_254)),
+          sin_az_254(GDALDEMSet1(psData->sin_az_mul_cos_alt_mul_z_mul_254))
+    {
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        const auto x = GDALDEMRawGradient4<T, alg>::X(w).ToDouble() * inv_ewres;
+        const auto y = GDALDEMRawGradient4<T, alg>::Y(w).ToDouble() * inv_nsres;
+
+        const auto xx_plus_yy = x * x + y * y;
+        const auto one = GDALDEMSet1(1.0);
+        const auto cang_mul_254 = GDALDEMApproxADivByInvSqrtB(
+            sin_alt_254 - (y * cos_az_254 - x * sin_az_254),
+            one + square_z * xx_plus_yy);
+        XMMReg4Double::Ternary(GDALDEMLessOrEqualZero(cang_mul_254), one,
+                               one + cang_mul_254)
+            .Store4Val(pafOut);
+    }
+};
+
+// Same as GDALHillshadeAlg_same_res()
+template <class T> struct GDALHillshadeSameResRowKernel
+{
+    const XMMReg4Double square_z_inv_res, sin_alt_254, cos_az_254_inv_res,
+        sin_az_254_inv_res;
+
+    GDALHillshadeSameResRowKernel(const void *pData,
+                                  float /* fDstNoDataValue */)
+        : GDALHillshadeSameResRowKernel(
+              static_cast<const GDALHillshadeAlgData *>(pData))
+    {
+    }
+
+    explicit GDALHillshadeSameResRowKernel(const GDALHillshadeAlgData *psData)
+        : square_z_inv_res(GDALDEMSet1(psData->square_z_mul_square_inv_res)),
+          sin_alt_254(GDALDEMSet1(psData->sin_altRadians_mul_254)),
+          cos_az_254_inv_res(GDALDEMSet1(
+              psData->cos_az_mul_cos_alt_mul_z_mul_254_mul_inv_res)),
+          sin_az_254_inv_res(GDALDEMSet1(
+              psData->sin_az_mul_cos_alt_mul_z_mul_254_mul_inv_res))
+    {
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        auto accX = w[0] - w[8];
+        const auto six_minus_two = w[6] - w[2];
+        auto accY = accX;
+        const auto three_minus_five = w[3] - w[5];
+        const auto one_minus_seven = w[1] - w[7];
+        accX = accX + three_minus_five;
+        accY = accY + one_minus_seven;
+        accX = accX + three_minus_five;
+        accY = accY + one_minus_seven;
+        accX = accX + six_minus_two;
+        accY = accY - six_minus_two;
+        const auto x = accX.ToDouble();
+        const auto y = accY.ToDouble();
+
+        const auto xx_plus_yy = x * x + y * y;
+        const auto one = GDALDEMSet1(1.0);
+        const auto cang_mul_254 = GDALDEMApproxADivByInvSqrtB(
+            sin_alt_254 + (x * sin_az_254_inv_res + y * cos_az_254_inv_res),
+            one + square_z_inv_res * xx_plus_yy);
+        XMMReg4Double::Ternary(GDALDEMLessOrEqualZero(cang_mul_254), one,
+                               one + cang_mul_254)
+            .Store4Val(pafOut);
+    }
+};
+
+// Same as GDALHillshadeCombinedAlg()
+template <class T, GradientAlg alg> struct GDALHillshadeCombinedRowKernel
+{
+    const XMMReg4Double inv_ewres, inv_nsres, square_z, sin_alt, cos_az,
+        sin_az;
+
+    GDALHillshadeCombinedRowKernel(const void *pData,
+                                   float /* fDstNoDataValue */)
+        : GDALHillshadeCombinedRowKernel(
+              static_cast<const GDALHillshadeAlgData *>(pData))
+    {
+    }
+
+    explicit GDALHillshadeCombinedRowKernel(const GDALHillshadeAlgData *psData)
+        : inv_ewres(GDALDEMSet1(psData->inv_ewres)),
+          inv_nsres(GDALDEMSet1(psData->inv_nsres)),
+          square_z(GDALDEMSet1(psData->square_z)),
+          sin_alt(GDALDEMSet1(psData->sin_altRadians)),
+          cos_az(GDALDEMSet1(psData->cos_az_mul_cos_alt_mul_z)),
+          sin_az(GDALDEMSet1(psData->sin_az_mul_cos_alt_mul_z))
+    {
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        const auto x = GDALDEMRawGradient4<T, alg>::X(w).ToDouble() * inv_ewres;
+        const auto y = GDALDEMRawGradient4<T, alg>::Y(w).ToDouble() * inv_nsres;
+
+        const auto xx_plus_yy = x * x + y * y;
+        const auto slope = xx_plus_yy * square_z;
+        const auto cos_cang = GDALDEMApproxADivByInvSqrtB(
+            sin_alt - (y * cos_az - x * sin_az), GDALDEMSet1(1.0) + slope);
+
+        double adfCosCang[4], adfSlope[4];
+        cos_cang.Store4Val(adfCosCang);
+        slope.Store4Val(adfSlope);
+        for (int i = 0; i < 4; ++i)
+            pafOut[i] = GDALHillshadeCombined(adfCosCang[i], adfSlope[i]);
+    }
+};
+
+// Same as GDALHillshadeIgorAlg()
+template <class T, GradientAlg alg> struct GDALHillshadeIgorRowKernel
+{
+    const GDALHillshadeAlgData *const psData;
+    const XMMReg4Double inv_ewres, inv_nsres, z_scaled;
+
+    GDALHillshadeIgorRowKernel(const void *pData, float /* fDstNoDataValue */)
+        : GDALHillshadeIgorRowKernel(
+              static_cast<const GDALHillshadeAlgData *>(pData))
+    {
+    }
+
+    explicit GDALHillshadeIgorRowKernel(const GDALHillshadeAlgData *psDataIn)
+        : psData(psDataIn), inv_ewres(GDALDEMSet1(psDataIn->inv_ewres)),
+          inv_nsres(GDALDEMSet1(psDataIn->inv_nsres)),
+          z_scaled(GDALDEMSet1(psDataIn->z_scaled))
+    {
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        const auto rawY = GDALDEMRawGradient4<T, alg>::Y(w);
+        const auto dx =
+            GDALDEMRawGradient4<T, alg>::X(w).ToDouble() * inv_ewres;
+        const auto dy = rawY.ToDouble() * inv_nsres;
+        const auto key = dx * dx + dy * dy;
+
+        // Opposite of the x gradient, computed in the same way as in
+        // GDALHillshadeIgorAlg()
+        const auto aspect_dx =
+            (alg == GradientAlg::HORN)
+                ? ((w[2] + w[5] + w[5] + w[8]) - (w[0] + w[3] + w[3] + w[6]))
+                : (w[5] - w[3]);
+
+        double adfSlopeTan[4], adfAspectDx[4], adfAspectDy[4];
+        (GDALDEMSqrt(key) * z_scaled).Store4Val(adfSlopeTan);
+        aspect_dx.ToDouble().Store4Val(adfAspectDx);
+        rawY.ToDouble().Store4Val(adfAspectDy);
+        for (int i = 0; i < 4; ++i)
+        {
+            const double slopeDegrees =
+                atan(adfSlopeTan[i]) * kdfRadiansToDegrees;
+            const double aspect = atan2(adfAspectDy[i], -adfAspectDx[i]);
+            pafOut[i] = GDALHillshadeIgor(slopeDegrees, aspect, psData);
+        }
+    }
+};
+
+// Same as GDALHillshadeMultiDirectionalAlg()
+template <class T, GradientAlg alg>
+struct GDALHillshadeMultiDirectionalRowKernel
+{
+    const XMMReg4Double inv_ewres, inv_nsres, square_z, sin_alt_127,
+        sin_alt_254, cos_alt_127, cos225_az_127;
+
+    GDALHillshadeMultiDirectionalRowKernel(const void *pData,
+                                           float /* fDstNoDataValue */)
+        : GDALHillshadeMultiDirectionalRowKernel(
+              static_cast<const GDALHillshadeMultiDirectionalAlgData *>(pData))
+    {
+    }
+
+    explicit GDALHillshadeMultiDirectionalRowKernel(
+        const GDALHillshadeMultiDirectionalAlgData *psData)
+        : inv_ewres(GDALDEMSet1(psData->inv_ewres)),
+          inv_nsres(GDALDEMSet1(psData->inv_nsres)),
+          square_z(GDALDEMSet1(psData->square_z)),
+          sin_alt_127(GDALDEMSet1(psData->sin_altRadians_mul_127)),
+          sin_alt_254(GDALDEMSet1(psData->sin_altRadians_mul_254)),
+          cos_alt_127(GDALDEMSet1(psData->cos_alt_mul_z_mul_127)),
+          cos225_az_127(
+              GDALDEMSet1(psData->cos225_az_mul_cos_alt_mul_z_mul_127))
+    {
+    }
+
+    // x <= 0 ? 0 : x
+    static inline XMMReg4Double ClampToZero(const XMMReg4Double &x)
+    {
+        return XMMReg4Double::Ternary(GDALDEMLessOrEqualZero(x),
+                                      XMMReg4Double::Zero(), x);
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        const auto x = GDALDEMRawGradient4<T, alg>::X(w).ToDouble() * inv_ewres;
+        const auto y = GDALDEMRawGradient4<T, alg>::Y(w).ToDouble() * inv_nsres;
+
+        const auto xx = x * x;
+        const auto yy = y * y;
+        const auto xx_plus_yy = xx + yy;
+
+        const auto val225_mul_127 =
+            ClampToZero(sin_alt_127 + (x - y) * cos225_az_127);
+        const auto val270_mul_127 = ClampToZero(sin_alt_127 - x * cos_alt_127);
+        const auto val315_mul_127 =
+            ClampToZero(sin_alt_127 + (x + y) * cos225_az_127);
+        const auto val360_mul_127 = ClampToZero(sin_alt_127 - y * cos_alt_127);
+
+        const auto weight_225 = GDALDEMSet1(0.5) * xx_plus_yy - x * y;
+        const auto &weight_270 = xx;
+        const auto weight_315 = xx_plus_yy - weight_225;
+        const auto &weight_360 = yy;
+        const auto one = GDALDEMSet1(1.0);
+        const auto cang_mul_127 = GDALDEMApproxADivByInvSqrtB(
+            (weight_225 * val225_mul_127 + weight_270 * val270_mul_127 +
+             weight_315 * val315_mul_127 + weight_360 * val360_mul_127) /
+                xx_plus_yy,
+            one + square_z * xx_plus_yy);
+
+        XMMReg4Double::Ternary(
+            XMMReg4Double::Equals(xx_plus_yy, XMMReg4Double::Zero()),
+            one + sin_alt_254, one + cang_mul_127)
+            .Store4Val(pafOut);
+    }
+};
+
+/************************************************************************/
+/*                     Slope and aspect row kernels                     */
+/************************************************************************/
+
+// Same as GDALSlopeHornAlg() and GDALSlopeZevenbergenThorneAlg()
+template <class T, GradientAlg alg> struct GDALSlopeRowKernel
+{
+    const XMMReg4Double ewres, nsres, scale;
+    const bool bDegrees;
+
+    GDALSlopeRowKernel(const void *pData, float /* fDstNoDataValue */)
+        : GDALSlopeRowKernel(static_cast<const GDALSlopeAlgData *>(pData))
+    {
+    }
+
+    explicit GDALSlopeRowKernel(const GDALSlopeAlgData *psData)
+        : ewres(GDALDEMSet1(psData->ewres)), nsres(GDALDEMSet1(psData->nsres)),
+          scale(GDALDEMSet1(
+              (alg == GradientAlg::HORN ? 8 : 2) * psData->scale)),
+          bDegrees(psData->slopeFormat == 1)
+    {
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        const auto dx = GDALDEMRawGradient4<T, alg>::X(w).ToDouble() / ewres;
+        const auto dy = GDALDEMRawGradient4<T, alg>::Y(w).ToDouble() / nsres;
+        const auto key = dx * dx + dy * dy;
+        const auto slope = GDALDEMSqrt(key) / scale;
+
+        if (bDegrees)
+        {
+            double adfSlope[4];
+            slope.Store4Val(adfSlope);
+            for (int i = 0; i < 4; ++i)
+                pafOut[i] = static_cast<float>(atan(adfSlope[i]) *
+                                               kdfRadiansToDegrees);
+        }
+        else
+        {
+            (GDALDEMSet1(100) * slope).Store4Val(pafOut);
+        }
+    }
+};
+
+// Same as GDALAspectAlg() and GDALAspectZevenbergenThorneAlg()
+template <class T, GradientAlg alg> struct GDALAspectRowKernel
+{
+    const GDALAspectAlgData *const psData;
+    const float fDstNoDataValue;
+
+    GDALAspectRowKernel(const void *pData, float fDstNoDataValueIn)
+        : psData(static_cast<const GDALAspectAlgData *>(pData)),
+          fDstNoDataValue(fDstNoDataValueIn)
+    {
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        const auto dx =
+            (alg == GradientAlg::HORN)
+                ? ((w[2] + w[5] + w[5] + w[8]) - (w[0] + w[3] + w[3] + w[6]))
+                : (w[5] - w[3]);
+
+        double adfDx[4], adfDy[4];
+        dx.ToDouble().Store4Val(adfDx);
+        GDALDEMRawGradient4<T, alg>::Y(w).ToDouble().Store4Val(adfDy);
+        for (int i = 0; i < 4; ++i)
+            pafOut[i] =
+                GDALAspect(adfDx[i], adfDy[i], fDstNoDataValue, psData);
+    }
+};
+
+/************************************************************************/
+/*                 TRI, TPI and roughness row kernels                   */
+/************************************************************************/
+
+// Same as GDALTRIAlgWilson()
+template <class T> struct GDALTRIWilsonRowKernel
+{
+    GDALTRIWilsonRowKernel(const void * /* pData */,
+                           float /* fDstNoDataValue */)
+    {
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        const auto sum =
+            (w[0] - w[4]).Abs() + (w[1] - w[4]).Abs() + (w[2] - w[4]).Abs() +
+            (w[3] - w[4]).Abs() + (w[5] - w[4]).Abs() + (w[6] - w[4]).Abs() +
+            (w[7] - w[4]).Abs() + (w[8] - w[4]).Abs();
+        _mm_storeu_ps(pafOut, _mm_mul_ps(sum.ToFloat(), _mm_set1_ps(0.125f)));
+    }
+};
+
+// Same as GDALTRIAlgRiley()
+template <class T> struct GDALTRIRileyRowKernel
+{
+    GDALTRIRileyRowKernel(const void * /* pData */,
+                          float /* fDstNoDataValue */)
+    {
+    }
+
+    static inline XMMReg4Double Square(const GDALDEMVec4<T> &v)
+    {
+        const auto d = v.ToDouble();
+        return d * d;
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        GDALDEMSqrt(Square(w[0] - w[4]) + Square(w[1] - w[4]) +
+                    Square(w[2] - w[4]) + Square(w[3] - w[4]) +
+                    Square(w[5] - w[4]) + Square(w[6] - w[4]) +
+                    Square(w[7] - w[4]) + Square(w[8] - w[4]))
+            .Store4Val(pafOut);
+    }
+};
+
+// Same as GDALTPIAlg()
+template <class T> struct GDALTPIRowKernel
+{
+    GDALTPIRowKernel(const void * /* pData */, float /* fDstNoDataValue */)
+    {
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        const auto sum =
+            w[0] + w[1] + w[2] + w[3] + w[5] + w[6] + w[7] + w[8];
+        _mm_storeu_ps(pafOut, _mm_sub_ps(w[4].ToFloat(),
+                                         _mm_mul_ps(sum.ToFloat(),
+                                                    _mm_set1_ps(0.125f))));
+    }
+};
+
+// Same as GDALRoughnessAlg()
+template <class T> struct GDALRoughnessRowKernel
+{
+    GDALRoughnessRowKernel(const void * /* pData */,
+                           float /* fDstNoDataValue */)
+    {
+    }
+
+    inline void Compute(const GDALDEMWindow4<T> &w, float *pafOut) const
+    {
+        auto vMin = w[0];
+        auto vMax = w[0];
+        for (int k = 1; k < 9; k++)
+        {
+            vMax = GDALDEMVec4<T>::Max(w[k], vMax);
+            vMin = GDALDEMVec4<T>::Min(w[k], vMin);
+        }
+        _mm_storeu_ps(pafOut, (vMax - vMin).ToFloat());
+    }
+};
+
+}  // namespace
+
+#endif  // HAVE_GDALDEM_ROW_KERNELS
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       GDALGeneric3x3Dataset                        */
@@ -3170,6 +4214,124 @@ static Algorithm GetAlgorithm(const char *pszProcessing)
     }
 }
 
+/************************************************************************/
+/*                        GDALDEMGetRowKernels()                        */
+/************************************************************************/
+
+#ifdef HAVE_GDALDEM_ROW_KERNELS
+template <template <class, GradientAlg> class Kernel>
+static void GDALDEMSetRowKernels(
+    GradientAlg eGradientAlg,
+    GDALGeneric3x3ProcessingAlg_multisample<float>::type &pfnAlgFloat,
+    GDALGeneric3x3ProcessingAlg_multisample<GInt32>::type &pfnAlgInt32)
+{
+    if (eGradientAlg == GradientAlg::ZEVENBERGEN_THORNE)
+    {
+        pfnAlgFloat = GDALGeneric3x3RowKernel<
+            float, Kernel<float, GradientAlg::ZEVENBERGEN_THORNE>>;
+        pfnAlgInt32 = GDALGeneric3x3RowKernel<
+            GInt32, Kernel<GInt32, GradientAlg::ZEVENBERGEN_THORNE>>;
+    }
+    else
+    {
+        pfnAlgFloat =
+            GDALGeneric3x3RowKernel<float, Kernel<float, GradientAlg::HORN>>;
+        pfnAlgInt32 =
+            GDALGeneric3x3RowKernel<GInt32, Kernel<GInt32, GradientAlg::HORN>>;
+    }
+}
+
+template <template <class> class Kernel>
+static void GDALDEMSetRowKernels(
+    GDALGeneric3x3ProcessingAlg_multisample<float>::type &pfnAlgFloat,
+    GDALGeneric3x3ProcessingAlg_multisample<GInt32>::type &pfnAlgInt32)
+{
+    pfnAlgFloat = GDALGeneric3x3RowKernel<float, Kernel<float>>;
+    pfnAlgInt32 = GDALGeneric3x3RowKernel<GInt32, Kernel<GInt32>>;
+}
+#endif
+
+// Select the row kernels matching the per-pixel algorithm, if available.
+static void GDALDEMGetRowKernels(
+    Algorithm eUtilityMode, const GDALDEMProcessingOptions *psOptions,
+    const double *adfGeoTransform,
+    GDALGeneric3x3ProcessingAlg_multisample<float>::type &pfnAlgFloat,
+    GDALGeneric3x3ProcessingAlg_multisample<GInt32>::type &pfnAlgInt32)
+{
+    const GradientAlg eGradientAlg = psOptions->eGradientAlg;
+#ifdef HAVE_GDALDEM_ROW_KERNELS
+    if (eUtilityMode == HILL_SHADE && psOptions->bMultiDirectional)
+    {
+        GDALDEMSetRowKernels<GDALHillshadeMultiDirectionalRowKernel>(
+            eGradientAlg, pfnAlgFloat, pfnAlgInt32);
+    }
+    else if (eUtilityMode == HILL_SHADE && psOptions->bCombined)
+    {
+        GDALDEMSetRowKernels<GDALHillshadeCombinedRowKernel>(
+            eGradientAlg, pfnAlgFloat, pfnAlgInt32);
+    }
+    else if (eUtilityMode == HILL_SHADE && psOptions->bIgor)
+    {
+        GDALDEMSetRowKernels<GDALHillshadeIgorRowKernel>(
+            eGradientAlg, pfnAlgFloat, pfnAlgInt32);
+    }
+    else if (eUtilityMode == HILL_SHADE &&
+             eGradientAlg == GradientAlg::HORN &&
+             adfGeoTransform[1] == -adfGeoTransform[5])
+    {
+        pfnAlgFloat = GDALGeneric3x3RowKernel<
+            float, GDALHillshadeSameResRowKernel<float>>;
+        pfnAlgInt32 = GDALHillshadeAlg_same_res_multisample<GInt32>;
+    }
+    else if (eUtilityMode == HILL_SHADE)
+    {
+        GDALDEMSetRowKernels<GDALHillshadeRowKernel>(eGradientAlg, pfnAlgFloat,
+                                                     pfnAlgInt32);
+    }
+    else if (eUtilityMode == SLOPE)
+    {
+        GDALDEMSetRowKernels<GDALSlopeRowKernel>(eGradientAlg, pfnAlgFloat,
+                                                 pfnAlgInt32);
+    }
+    else if (eUtilityMode == ASPECT)
+    {
+        GDALDEMSetRowKernels<GDALAspectRowKernel>(eGradientAlg, pfnAlgFloat,
+                                                  pfnAlgInt32);
+    }
+    else if (eUtilityMode == TRI && psOptions->eTRIAlg == TRIAlg::WILSON)
+    {
+        GDALDEMSetRowKernels<GDALTRIWilsonRowKernel>(pfnAlgFloat, pfnAlgInt32);
+    }
+    else if (eUtilityMode == TRI)
+    {
+        GDALDEMSetRowKernels<GDALTRIRileyRowKernel>(pfnAlgFloat, pfnAlgInt32);
+    }
+    else if (eUtilityMode == TPI)
+    {
+        GDALDEMSetRowKernels<GDALTPIRowKernel>(pfnAlgFloat, pfnAlgInt32);
+    }
+    else if (eUtilityMode == ROUGHNESS)
+    {
+        GDALDEMSetRowKernels<GDALRoughnessRowKernel>(pfnAlgFloat, pfnAlgInt32);
+    }
+#elif defined(HAVE_16_SSE_REG)
+    pfnAlgFloat = nullptr;
+    if (eUtilityMode == HILL_SHADE && !psOptions->bMultiDirectional &&
+        !psOptions->bCombined && !psOptions->bIgor &&
+        eGradientAlg == GradientAlg::HORN &&
+        adfGeoTransform[1] == -adfGeoTransform[5])
+    {
+        pfnAlgInt32 = GDALHillshadeAlg_same_res_multisample<GInt32>;
+    }
+#else
+    pfnAlgFloat = nullptr;
+    pfnAlgInt32 = nullptr;
+    CPL_IGNORE_RET_VAL(eUtilityMode);
+    CPL_IGNORE_RET_VAL(eGradientAlg);
+    CPL_IGNORE_RET_VAL(adfGeoTransform);
+#endif
+}
+
 /************************************************************************/
 /*                            GDALDEMProcessing()                       */
 /************************************************************************/
@@ -3382,8 +4544,6 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
     void *pData = nullptr;
     GDALGeneric3x3ProcessingAlg<float>::type pfnAlgFloat = nullptr;
     GDALGeneric3x3ProcessingAlg<GInt32>::type pfnAlgInt32 = nullptr;
-    GDALGeneric3x3ProcessingAlg_multisample<GInt32>::type
-        pfnAlgInt32_multisample = nullptr;
 
     if (eUtilityMode == HILL_SHADE && psOptions->bMultiDirectional)
     {
@@ -3462,10 +4622,6 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 {
                     pfnAlgFloat = GDALHillshadeAlg_same_res<float>;
                     pfnAlgInt32 = GDALHillshadeAlg_same_res<GInt32>;
-#ifdef HAVE_16_SSE_REG
-                    pfnAlgInt32_multisample =
-                        GDALHillshadeAlg_same_res_multisample<GInt32>;
-#endif
                 }
                 else
                 {
@@ -3544,6 +4700,16 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         pfnAlgInt32 = GDALRoughnessAlg<GInt32>;
     }
 
+    GDALGeneric3x3ProcessingAlg_multisample<float>::type
+        pfnAlgFloat_multisample = nullptr;
+    GDALGeneric3x3ProcessingAlg_multisample<GInt32>::type
+        pfnAlgInt32_multisample = nullptr;
+    if (CPLTestBool(CPLGetConfigOption("GDAL_USE_SSE", "YES")))
+    {
+        GDALDEMGetRowKernels(eUtilityMode, psOptions, adfGeoTransform,
+                             pfnAlgFloat_multisample, pfnAlgInt32_multisample);
+    }
+
     const GDALDataType eDstDataType =
         (eUtilityMode == HILL_SHADE || eUtilityMode == COLOR_RELIEF)
             ? GDT_Byte
@@ -3719,17 +4885,29 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         if (bDstHasNoData)
             GDALSetRasterNoDataValue(hDstBand, dfDstNoDataValue);
 
+        // Number of threads used to process strips of lines, which is also
+        // usually used by the output driver to compress blocks.
+        const char *pszNumThreads = CSLFetchNameValueDef(
+            psOptions->papszCreateOptions, "NUM_THREADS",
+            CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+        const int nThreads = std::max(
+            1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(pszNumThreads)));
+
         if (eSrcDT == GDT_Byte || eSrcDT == GDT_Int16 || eSrcDT == GDT_UInt16)
         {
             GDALGeneric3x3Processing<GInt32>(
                 hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample, pData,
-                psOptions->bComputeAtEdges, pfnProgress, pProgressData);
+                psOptions->bComputeAtEdges, nThreads, pfnProgress,
+                pProgressData);
         }
         else
         {
             GDALGeneric3x3Processing<float>(
-                hSrcBand, hDstBand, pfnAlgFloat, nullptr, pData,
-                psOptions->bComputeAtEdges, pfnProgress, pProgressData);
+                hSrcBand, hDstBand, pfnAlgFloat, pfnAlgFloat_multisample, pData,
+                psOptions->bComputeAtEdges, nThreads, pfnProgress,
+                pProgressData);
         }
     }
 
@@ -234,6 +234,10 @@ MAIN_START(argc, argv)
 
         CPLFree(pszGDALInfoOutput);
 
+        // Only emitted with --debug on or --debug MEMORY, while the dataset
+        // and its caches are still alive.
+        CPLDebugMemoryAccounting();
+
         GDALClose(hDataset);
 #ifdef __AFL_HAVE_MANUAL_CONTROL
     }
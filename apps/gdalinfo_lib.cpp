@@ -105,6 +105,10 @@ struct GDALInfoOptions
     /*! force computation of the checksum for each band in the dataset */
     bool bComputeChecksum = false;
 
+    /*! force computation of the XXH64 content hash for each band in the
+        dataset */
+    bool bComputeHash = false;
+
     /*! allow or suppress ground control points list printing. It may be useful
         for datasets with huge amount of GCPs, such as L1B AVHRR or HDF4 MODIS
         which contain thousands of them. */
@@ -284,6 +288,12 @@ GDALInfoAppOptionsGetParser(GDALInfoOptions *psOptions,
         .help(_(
             "Force computation of the checksum for each band in the dataset."));
 
+    argParser->add_argument("-hash")
+        .flag()
+        .store_into(psOptions->bComputeHash)
+        .help(_("Force computation of a 64-bit content hash for each band in "
+                "the dataset."));
+
     argParser->add_argument("-listmdd")
         .flag()
         .store_into(psOptions->bListMDD)
@@ -987,6 +997,35 @@ char *GDALInfo(GDALDatasetH hDataset, const GDALInfoOptions *psOptions)
         hTransform = nullptr;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Compute the missing exact statistics of all bands at once, so   */
+    /*      that each block is read a single time. Errors are reported by   */
+    /*      the per-band GDALGetRasterStatistics() call below, that will    */
+    /*      retry the computation on bands where it failed.                 */
+    /* -------------------------------------------------------------------- */
+    if (psOptions->bStats && !psOptions->bApproxStats)
+    {
+        std::vector<int> anBandsWithoutStats;
+        for (int iBand = 0; iBand < GDALGetRasterCount(hDataset); iBand++)
+        {
+            GDALRasterBandH hBand = GDALGetRasterBand(hDataset, iBand + 1);
+            double dfDummy = 0;
+            if (GDALGetRasterStatistics(hBand, FALSE, FALSE, &dfDummy,
+                                        &dfDummy, &dfDummy,
+                                        &dfDummy) != CE_None)
+            {
+                anBandsWithoutStats.push_back(iBand + 1);
+            }
+        }
+        if (anBandsWithoutStats.size() > 1)
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            GDALDatasetComputeRasterStatistics(
+                hDataset, static_cast<int>(anBandsWithoutStats.size()),
+                anBandsWithoutStats.data(), FALSE, nullptr, nullptr);
+        }
+    }
+
     /* ==================================================================== */
     /*      Loop over bands.                                                */
     /* ==================================================================== */
@@ -1357,6 +1396,29 @@ char *GDALInfo(GDALDatasetH hDataset, const GDALInfoOptions *psOptions)
             }
         }
 
+        if (psOptions->bComputeHash)
+        {
+            GUInt64 nBandHash = 0;
+            if (GDALHashImage(hBand, 0, 0, GDALGetRasterXSize(hDataset),
+                              GDALGetRasterYSize(hDataset),
+                              &nBandHash) == CE_None)
+            {
+                const std::string osHash =
+                    CPLSPrintf("%016" CPL_FRMT_GB_WITHOUT_PREFIX "x",
+                               static_cast<GUIntBig>(nBandHash));
+                if (bJson)
+                {
+                    json_object_object_add(
+                        poBand, "hash", json_object_new_string(osHash.c_str()));
+                }
+                else
+                {
+                    Concat(osStr, psOptions->bStdoutOutput, "  Hash=%s\n",
+                           osHash.c_str());
+                }
+            }
+        }
+
         int bGotNodata = FALSE;
         if (eDT == GDT_Int64)
         {
@@ -35,6 +35,7 @@
 #include "ogr_spatialref.h"
 #include "gdalargumentparser.h"
 
+#include <algorithm>
 #include <limits>
 #include <vector>
 
@@ -73,10 +74,12 @@ MAIN_START(argc, argv)
     bool bAsXML = false, bLIFOnly = false;
     bool bQuiet = false, bValOnly = false;
     int nOverview = 0;
+    std::string osMDArrayName;
     CPLStringList aosOpenOptions;
     std::string osFieldSep;
     bool bIgnoreExtraInput = false;
     bool bEcho = false;
+    std::string osResampling;
 
     GDALAllRegister();
     argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
@@ -137,6 +140,17 @@ MAIN_START(argc, argv)
         .help(_("Query the (overview_level)th overview (overview_level=1 is "
                 "the 1st overview)."));
 
+    argParser.add_argument("-r")
+        .metavar("nearest|bilinear|cubic")
+        .store_into(osResampling)
+        .help(_("Resampling algorithm used to compute the value at the "
+                "location."));
+
+    argParser.add_argument("-mdarray")
+        .metavar("<array_name>")
+        .store_into(osMDArrayName)
+        .help(_("Name or full path of a multidimensional array to query."));
+
     {
         auto &group = argParser.add_mutually_exclusive_group();
 
@@ -245,12 +259,83 @@ MAIN_START(argc, argv)
         exit(1);
     }
 
+    if (!osMDArrayName.empty() && nOverview >= 0)
+    {
+        fprintf(stderr, "-overview cannot be used with -mdarray\n");
+        exit(1);
+    }
+
+    GDALRIOResampleAlg eResampleAlg = GRIORA_NearestNeighbour;
+    if (osResampling.empty() || EQUAL(osResampling.c_str(), "nearest"))
+        eResampleAlg = GRIORA_NearestNeighbour;
+    else if (EQUAL(osResampling.c_str(), "bilinear"))
+        eResampleAlg = GRIORA_Bilinear;
+    else if (EQUAL(osResampling.c_str(), "cubic"))
+        eResampleAlg = GRIORA_Cubic;
+    else
+    {
+        fprintf(stderr, "Unsupported value for -r: %s\n",
+                osResampling.c_str());
+        exit(1);
+    }
+
+    if (!osMDArrayName.empty() && eResampleAlg != GRIORA_NearestNeighbour)
+    {
+        fprintf(stderr, "-r cannot be used with -mdarray\n");
+        exit(1);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Open source file.                                               */
     /* -------------------------------------------------------------------- */
-    GDALDatasetH hSrcDS = GDALOpenEx(osSrcFilename.c_str(),
-                                     GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
-                                     nullptr, aosOpenOptions.List(), nullptr);
+    GDALDatasetH hSrcDS = nullptr;
+    GDALDatasetH hMDimDS = nullptr;
+    GDALGroupH hRootGroup = nullptr;
+    GDALMDArrayH hMDArray = nullptr;
+    std::vector<GUInt64> anMDArrayDimSizes;
+    if (!osMDArrayName.empty())
+    {
+        // The last two dimensions of the array are the Y and X ones, and
+        // each combination of indices along the other dimensions is
+        // reported as a band, as in GDALMDArray::AsClassicDataset().
+        hMDimDS = GDALOpenEx(osSrcFilename.c_str(),
+                             GDAL_OF_MULTIDIM_RASTER | GDAL_OF_VERBOSE_ERROR,
+                             nullptr, aosOpenOptions.List(), nullptr);
+        if (hMDimDS == nullptr)
+            exit(1);
+        hRootGroup = GDALDatasetGetRootGroup(hMDimDS);
+        if (hRootGroup == nullptr)
+            exit(1);
+        hMDArray = osMDArrayName[0] == '/'
+                       ? GDALGroupOpenMDArrayFromFullname(
+                             hRootGroup, osMDArrayName.c_str(), nullptr)
+                       : GDALGroupOpenMDArray(hRootGroup,
+                                              osMDArrayName.c_str(), nullptr);
+        if (hMDArray == nullptr)
+        {
+            fprintf(stderr, "Cannot find array %s\n", osMDArrayName.c_str());
+            exit(1);
+        }
+        size_t nDims = 0;
+        GDALDimensionH *pahDims = GDALMDArrayGetDimensions(hMDArray, &nDims);
+        for (size_t i = 0; i < nDims; ++i)
+            anMDArrayDimSizes.push_back(GDALDimensionGetSize(pahDims[i]));
+        GDALReleaseDimensions(pahDims, nDims);
+        if (nDims < 2)
+        {
+            fprintf(stderr, "Array %s should have at least 2 dimensions\n",
+                    osMDArrayName.c_str());
+            exit(1);
+        }
+        hSrcDS = GDALMDArrayAsClassicDatasetEx(hMDArray, nDims - 1, nDims - 2,
+                                               hRootGroup, nullptr);
+    }
+    else
+    {
+        hSrcDS = GDALOpenEx(osSrcFilename.c_str(),
+                            GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR, nullptr,
+                            aosOpenOptions.List(), nullptr);
+    }
     if (hSrcDS == nullptr)
         exit(1);
 
@@ -283,34 +368,59 @@ MAIN_START(argc, argv)
     }
 
     /* -------------------------------------------------------------------- */
-    /*      Turn the location into a pixel and line location.               */
+    /*      Resolve the band (or overview band) to query for each         */
+    /*      requested band.                                                 */
     /* -------------------------------------------------------------------- */
-    bool inputAvailable = true;
-    CPLString osXML;
+    std::vector<GDALRasterBandH> ahQueryBands;
+    for (const int nBand : anBandList)
+    {
+        GDALRasterBandH hBand = GDALGetRasterBand(hSrcDS, nBand);
+        if (nOverview >= 0 && hBand != nullptr)
+        {
+            GDALRasterBandH hOvrBand = GDALGetOverview(hBand, nOverview);
+            if (hOvrBand == nullptr)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot get overview %d of band %d", nOverview + 1,
+                         nBand);
+            }
+            hBand = hOvrBand;
+        }
+        ahQueryBands.push_back(hBand);
+    }
+
+    const int nRasterXSize = GDALGetRasterXSize(hSrcDS);
+    const int nRasterYSize = GDALGetRasterYSize(hSrcDS);
+
+    /* -------------------------------------------------------------------- */
+    /*      Read input points. When the input is not an interactive        */
+    /*      terminal, points are processed by batches, so that they can be */
+    /*      reprojected and sampled at once.                                */
+    /* -------------------------------------------------------------------- */
+    struct InputPoint
+    {
+        double dfGeoX = 0;
+        double dfGeoY = 0;
+        std::string osExtraContent{};
+    };
+
+    std::vector<InputPoint> asPoints;
+    size_t nMaxBatchSize = 1;
     char szLine[1024];
     int nLine = 0;
-    std::string osExtraContent;
+    bool bInputEOF = false;
 
-    if (std::isnan(dfGeoX))
+    // Append up to nMaxBatchSize points read from stdin to asPoints.
+    const auto ReadInputPoints = [&]()
     {
-        // Is it an interactive terminal ?
-        if (isatty(static_cast<int>(fileno(stdin))))
+        while (asPoints.size() < nMaxBatchSize)
         {
-            if (!osSourceSRS.empty())
+            if (!fgets(szLine, sizeof(szLine) - 1, stdin))
             {
-                fprintf(
-                    stderr,
-                    "Enter X Y values separated by space, and press Return.\n");
+                bInputEOF = true;
+                return;
             }
-            else
-            {
-                fprintf(stderr, "Enter pixel line values separated by space, "
-                                "and press Return.\n");
-            }
-        }
 
-        if (fgets(szLine, sizeof(szLine) - 1, stdin))
-        {
             const CPLStringList aosTokens(CSLTokenizeString(szLine));
             const int nCount = aosTokens.size();
 
@@ -318,42 +428,95 @@ MAIN_START(argc, argv)
             if (nCount < 2)
             {
                 fprintf(stderr, "Not enough values at line %d\n", nLine);
-                inputAvailable = false;
+                // Historical behavior: stop on an invalid first line
+                if (nLine == 1)
+                {
+                    bInputEOF = true;
+                    return;
+                }
+                continue;
             }
-            else
+
+            InputPoint sPoint;
+            sPoint.dfGeoX = CPLAtof(aosTokens[0]);
+            sPoint.dfGeoY = CPLAtof(aosTokens[1]);
+            if (!bIgnoreExtraInput)
             {
-                dfGeoX = CPLAtof(aosTokens[0]);
-                dfGeoY = CPLAtof(aosTokens[1]);
-                if (!bIgnoreExtraInput)
+                for (int i = 2; i < nCount; ++i)
                 {
-                    for (int i = 2; i < nCount; ++i)
-                    {
-                        if (!osExtraContent.empty())
-                            osExtraContent += ' ';
-                        osExtraContent += aosTokens[i];
-                    }
-                    while (!osExtraContent.empty() &&
-                           isspace(static_cast<int>(osExtraContent.back())))
-                    {
-                        osExtraContent.pop_back();
-                    }
+                    if (!sPoint.osExtraContent.empty())
+                        sPoint.osExtraContent += ' ';
+                    sPoint.osExtraContent += aosTokens[i];
+                }
+                while (!sPoint.osExtraContent.empty() &&
+                       isspace(
+                           static_cast<int>(sPoint.osExtraContent.back())))
+                {
+                    sPoint.osExtraContent.pop_back();
                 }
             }
+            asPoints.emplace_back(std::move(sPoint));
+        }
+    };
+
+    if (bIsXYSpecifiedAsArgument)
+    {
+        InputPoint sPoint;
+        sPoint.dfGeoX = dfGeoX;
+        sPoint.dfGeoY = dfGeoY;
+        asPoints.emplace_back(std::move(sPoint));
+        bInputEOF = true;
+    }
+    else
+    {
+        // Is it an interactive terminal ?
+        if (isatty(static_cast<int>(fileno(stdin))))
+        {
+            if (!osSourceSRS.empty())
+            {
+                fprintf(
+                    stderr,
+                    "Enter X Y values separated by space, and press Return.\n");
+            }
+            else
+            {
+                fprintf(stderr, "Enter pixel line values separated by space, "
+                                "and press Return.\n");
+            }
         }
         else
         {
-            inputAvailable = false;
+            nMaxBatchSize = 10 * 1000;
         }
+        ReadInputPoints();
     }
 
+    CPLString osXML;
     int nRetCode = 0;
-    while (inputAvailable)
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    std::vector<double> adfPixelToQuery;
+    std::vector<double> adfLineToQuery;
+    std::vector<double> adfBandReal;
+    std::vector<double> adfBandImag;
+    std::vector<int> abBandSuccess;
+    while (!asPoints.empty())
     {
-        int iPixel, iLine;
+        const size_t nPoints = asPoints.size();
+
+        // Turn the locations into pixel and line locations.
+        adfX.resize(nPoints);
+        adfY.resize(nPoints);
+        for (size_t iPt = 0; iPt < nPoints; ++iPt)
+        {
+            adfX[iPt] = asPoints[iPt].dfGeoX;
+            adfY[iPt] = asPoints[iPt].dfGeoY;
+        }
 
         if (hCT)
         {
-            if (!OCTTransform(hCT, 1, &dfGeoX, &dfGeoY, nullptr))
+            if (!OCTTransform(hCT, static_cast<int>(nPoints), adfX.data(),
+                              adfY.data(), nullptr))
                 exit(1);
         }
 
@@ -375,305 +538,371 @@ MAIN_START(argc, argv)
                 exit(1);
             }
 
-            iPixel = static_cast<int>(floor(adfInvGeoTransform[0] +
-                                            adfInvGeoTransform[1] * dfGeoX +
-                                            adfInvGeoTransform[2] * dfGeoY));
-            iLine = static_cast<int>(floor(adfInvGeoTransform[3] +
-                                           adfInvGeoTransform[4] * dfGeoX +
-                                           adfInvGeoTransform[5] * dfGeoY));
-        }
-        else
-        {
-            iPixel = static_cast<int>(floor(dfGeoX));
-            iLine = static_cast<int>(floor(dfGeoY));
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Prepare report. */
-        /* --------------------------------------------------------------------
-         */
-        CPLString osLine;
-
-        if (bAsXML)
-        {
-            osLine.Printf("<Report pixel=\"%d\" line=\"%d\">", iPixel, iLine);
-            osXML += osLine;
-            if (!osExtraContent.empty())
+            for (size_t iPt = 0; iPt < nPoints; ++iPt)
             {
-                char *pszEscaped =
-                    CPLEscapeString(osExtraContent.c_str(), -1, CPLES_XML);
-                osXML += CPLString().Printf("  <ExtraInput>%s</ExtraInput>",
-                                            pszEscaped);
-                CPLFree(pszEscaped);
+                const double dfX = adfX[iPt];
+                const double dfY = adfY[iPt];
+                adfX[iPt] = adfInvGeoTransform[0] +
+                            adfInvGeoTransform[1] * dfX +
+                            adfInvGeoTransform[2] * dfY;
+                adfY[iPt] = adfInvGeoTransform[3] +
+                            adfInvGeoTransform[4] * dfX +
+                            adfInvGeoTransform[5] * dfY;
             }
         }
-        else if (!bQuiet)
-        {
-            printf("Report:\n");
-            printf("  Location: (%dP,%dL)\n", iPixel, iLine);
-            if (!osExtraContent.empty())
-            {
-                printf("  Extra input: %s\n", osExtraContent.c_str());
-            }
-        }
-        else if (bEcho)
-        {
-            printf("%d%s%d%s", iPixel, osFieldSep.c_str(), iLine,
-                   osFieldSep.c_str());
-        }
-
-        bool bPixelReport = true;
 
-        if (iPixel < 0 || iLine < 0 || iPixel >= GDALGetRasterXSize(hSrcDS) ||
-            iLine >= GDALGetRasterYSize(hSrcDS))
+        // Return the pixel/line to query in hBand, which may be an overview
+        const auto GetPixelToQuery = [nRasterXSize](GDALRasterBandH hBand,
+                                                    int iPixel)
         {
-            if (bAsXML)
-                osXML += "<Alert>Location is off this file! No further details "
-                         "to report.</Alert>";
-            else if (bValOnly)
-                printf("\n");
-            else if (!bQuiet)
-                printf("\nLocation is off this file! No further details to "
-                       "report.\n");
-            bPixelReport = false;
-            nRetCode = 1;
-        }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Process each band. */
-        /* --------------------------------------------------------------------
-         */
-        for (int i = 0; bPixelReport && i < static_cast<int>(anBandList.size());
-             i++)
+            const int nBandXSize = GDALGetRasterBandXSize(hBand);
+            if (nBandXSize == nRasterXSize)
+                return iPixel;
+            return std::min(nBandXSize - 1,
+                            static_cast<int>(0.5 + 1.0 * iPixel /
+                                                       nRasterXSize *
+                                                       nBandXSize));
+        };
+        const auto GetLineToQuery = [nRasterYSize](GDALRasterBandH hBand,
+                                                   int iLine)
         {
-            GDALRasterBandH hBand = GDALGetRasterBand(hSrcDS, anBandList[i]);
-
-            int iPixelToQuery = iPixel;
-            int iLineToQuery = iLine;
-
-            if (nOverview >= 0 && hBand != nullptr)
+            const int nBandYSize = GDALGetRasterBandYSize(hBand);
+            if (nBandYSize == nRasterYSize)
+                return iLine;
+            return std::min(nBandYSize - 1,
+                            static_cast<int>(0.5 + 1.0 * iLine /
+                                                       nRasterYSize *
+                                                       nBandYSize));
+        };
+
+        // Sample all points of the batch at once for each band.
+        const size_t nBands = anBandList.size();
+        if (!hMDArray)
+        {
+            adfPixelToQuery.resize(nPoints);
+            adfLineToQuery.resize(nPoints);
+            adfBandReal.resize(nBands * nPoints);
+            adfBandImag.resize(nBands * nPoints);
+            abBandSuccess.assign(nBands * nPoints, FALSE);
+            for (size_t iBand = 0; iBand < nBands; ++iBand)
             {
-                GDALRasterBandH hOvrBand = GDALGetOverview(hBand, nOverview);
-                if (hOvrBand != nullptr)
+                GDALRasterBandH hBand = ahQueryBands[iBand];
+                if (hBand == nullptr)
+                    continue;
+                const double dfXRatio = 1.0 * GDALGetRasterBandXSize(hBand) /
+                                        nRasterXSize;
+                const double dfYRatio = 1.0 * GDALGetRasterBandYSize(hBand) /
+                                        nRasterYSize;
+                for (size_t iPt = 0; iPt < nPoints; ++iPt)
                 {
-                    int nOvrXSize = GDALGetRasterBandXSize(hOvrBand);
-                    int nOvrYSize = GDALGetRasterBandYSize(hOvrBand);
-                    iPixelToQuery = static_cast<int>(
-                        0.5 +
-                        1.0 * iPixel / GDALGetRasterXSize(hSrcDS) * nOvrXSize);
-                    iLineToQuery = static_cast<int>(
-                        0.5 +
-                        1.0 * iLine / GDALGetRasterYSize(hSrcDS) * nOvrYSize);
-                    if (iPixelToQuery >= nOvrXSize)
-                        iPixelToQuery = nOvrXSize - 1;
-                    if (iLineToQuery >= nOvrYSize)
-                        iLineToQuery = nOvrYSize - 1;
-                }
-                else
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot get overview %d of band %d", nOverview + 1,
-                             anBandList[i]);
+                    if (eResampleAlg == GRIORA_NearestNeighbour)
+                    {
+                        const double dfPixel = floor(adfX[iPt]);
+                        const double dfLine = floor(adfY[iPt]);
+                        if (dfPixel >= 0 && dfPixel < nRasterXSize &&
+                            dfLine >= 0 && dfLine < nRasterYSize)
+                        {
+                            adfPixelToQuery[iPt] =
+                                GetPixelToQuery(hBand,
+                                                static_cast<int>(dfPixel)) +
+                                0.5;
+                            adfLineToQuery[iPt] =
+                                GetLineToQuery(hBand,
+                                               static_cast<int>(dfLine)) +
+                                0.5;
+                        }
+                        else
+                        {
+                            adfPixelToQuery[iPt] = -1;
+                            adfLineToQuery[iPt] = -1;
+                        }
+                    }
+                    else
+                    {
+                        adfPixelToQuery[iPt] = adfX[iPt] * dfXRatio;
+                        adfLineToQuery[iPt] = adfY[iPt] * dfYRatio;
+                    }
                 }
-                hBand = hOvrBand;
+                GDALRasterBandSamplePoints(
+                    hBand, nPoints, adfPixelToQuery.data(),
+                    adfLineToQuery.data(), eResampleAlg,
+                    adfBandReal.data() + iBand * nPoints,
+                    adfBandImag.data() + iBand * nPoints,
+                    abBandSuccess.data() + iBand * nPoints);
             }
+        }
 
-            if (hBand == nullptr)
-                continue;
+        for (size_t iPt = 0; iPt < nPoints; ++iPt)
+        {
+            const std::string &osExtraContent = asPoints[iPt].osExtraContent;
+            int iPixel = static_cast<int>(floor(adfX[iPt]));
+            int iLine = static_cast<int>(floor(adfY[iPt]));
+
+            // Prepare report.
+            CPLString osLine;
 
             if (bAsXML)
             {
-                osLine.Printf("<BandReport band=\"%d\">", anBandList[i]);
+                osLine.Printf("<Report pixel=\"%d\" line=\"%d\">", iPixel,
+                              iLine);
                 osXML += osLine;
+                if (!osExtraContent.empty())
+                {
+                    char *pszEscaped =
+                        CPLEscapeString(osExtraContent.c_str(), -1, CPLES_XML);
+                    osXML += CPLString().Printf(
+                        "  <ExtraInput>%s</ExtraInput>", pszEscaped);
+                    CPLFree(pszEscaped);
+                }
             }
             else if (!bQuiet)
             {
-                printf("  Band %d:\n", anBandList[i]);
+                printf("Report:\n");
+                printf("  Location: (%dP,%dL)\n", iPixel, iLine);
+                if (!osExtraContent.empty())
+                {
+                    printf("  Extra input: %s\n", osExtraContent.c_str());
+                }
+            }
+            else if (bEcho)
+            {
+                printf("%d%s%d%s", iPixel, osFieldSep.c_str(), iLine,
+                       osFieldSep.c_str());
             }
 
-            /* --------------------------------------------------------------------
-             */
-            /*      Request location info for this location.  It is possible */
-            /*      only the VRT driver actually supports this. */
-            /* --------------------------------------------------------------------
-             */
-            CPLString osItem;
-
-            osItem.Printf("Pixel_%d_%d", iPixelToQuery, iLineToQuery);
-
-            const char *pszLI =
-                GDALGetMetadataItem(hBand, osItem, "LocationInfo");
+            bool bPixelReport = true;
 
-            if (pszLI != nullptr)
+            if (iPixel < 0 || iLine < 0 || iPixel >= nRasterXSize ||
+                iLine >= nRasterYSize)
             {
                 if (bAsXML)
-                    osXML += pszLI;
+                    osXML += "<Alert>Location is off this file! No further "
+                             "details to report.</Alert>";
+                else if (bValOnly)
+                    printf("\n");
                 else if (!bQuiet)
-                    printf("    %s\n", pszLI);
-                else if (bLIFOnly)
-                {
-                    /* Extract all files, if any. */
-
-                    CPLXMLNode *psRoot = CPLParseXMLString(pszLI);
+                    printf("\nLocation is off this file! No further details "
+                           "to report.\n");
+                bPixelReport = false;
+                nRetCode = 1;
+            }
 
-                    if (psRoot != nullptr && psRoot->psChild != nullptr &&
-                        psRoot->eType == CXT_Element &&
-                        EQUAL(psRoot->pszValue, "LocationInfo"))
+            // With a multidimensional array, read the values of all
+            // requested bands at once.
+            std::vector<double> adfMDArrayValues;
+            bool bMDArrayReadOK = false;
+            const bool bMDArrayIsComplex =
+                hMDArray && GDALGetRasterCount(hSrcDS) > 0 &&
+                GDALDataTypeIsComplex(
+                    GDALGetRasterDataType(GDALGetRasterBand(hSrcDS, 1)));
+            if (hMDArray && bPixelReport)
+            {
+                const size_t nDims = anMDArrayDimSizes.size();
+                std::vector<GUInt64> anIndices;
+                for (const int nBand : anBandList)
+                {
+                    // Band numbers are checked in the loop below
+                    GUInt64 nIdx = nBand >= 1 ? nBand - 1 : 0;
+                    const size_t nOffset = anIndices.size();
+                    anIndices.resize(nOffset + nDims);
+                    for (size_t j = nDims - 2; j > 0;)
                     {
-                        for (CPLXMLNode *psNode = psRoot->psChild;
-                             psNode != nullptr; psNode = psNode->psNext)
-                        {
-                            if (psNode->eType == CXT_Element &&
-                                EQUAL(psNode->pszValue, "File") &&
-                                psNode->psChild != nullptr)
-                            {
-                                char *pszUnescaped =
-                                    CPLUnescapeString(psNode->psChild->pszValue,
-                                                      nullptr, CPLES_XML);
-                                printf("%s\n", pszUnescaped);
-                                CPLFree(pszUnescaped);
-                            }
-                        }
+                        --j;
+                        anIndices[nOffset + j] = nIdx % anMDArrayDimSizes[j];
+                        nIdx /= anMDArrayDimSizes[j];
                     }
-                    CPLDestroyXMLNode(psRoot);
+                    anIndices[nOffset + nDims - 2] = iLine;
+                    anIndices[nOffset + nDims - 1] = iPixel;
                 }
+                adfMDArrayValues.resize(anBandList.size() *
+                                        (bMDArrayIsComplex ? 2 : 1));
+                GDALExtendedDataTypeH hDT = GDALExtendedDataTypeCreate(
+                    bMDArrayIsComplex ? GDT_CFloat64 : GDT_Float64);
+                bMDArrayReadOK = CPL_TO_BOOL(GDALMDArrayReadPoints(
+                    hMDArray, anBandList.size(), anIndices.data(), hDT,
+                    adfMDArrayValues.data()));
+                GDALExtendedDataTypeRelease(hDT);
             }
 
-            /* --------------------------------------------------------------------
-             */
-            /*      Report the pixel value of this band. */
-            /* --------------------------------------------------------------------
-             */
-            double adfPixel[2] = {0, 0};
-            const bool bIsComplex = CPL_TO_BOOL(
-                GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
-
-            if (GDALRasterIO(hBand, GF_Read, iPixelToQuery, iLineToQuery, 1, 1,
-                             adfPixel, 1, 1,
-                             bIsComplex ? GDT_CFloat64 : GDT_Float64, 0,
-                             0) == CE_None)
+            // Process each band.
+            for (int i = 0; bPixelReport && i < static_cast<int>(nBands); i++)
             {
-                CPLString osValue;
+                GDALRasterBandH hBand = ahQueryBands[i];
+                if (hBand == nullptr)
+                    continue;
 
-                if (bIsComplex)
-                    osValue.Printf("%.15g+%.15gi", adfPixel[0], adfPixel[1]);
-                else
-                    osValue.Printf("%.15g", adfPixel[0]);
+                const int iPixelToQuery = GetPixelToQuery(hBand, iPixel);
+                const int iLineToQuery = GetLineToQuery(hBand, iLine);
 
                 if (bAsXML)
                 {
-                    osXML += "<Value>";
-                    osXML += osValue;
-                    osXML += "</Value>";
+                    osLine.Printf("<BandReport band=\"%d\">", anBandList[i]);
+                    osXML += osLine;
                 }
                 else if (!bQuiet)
-                    printf("    Value: %s\n", osValue.c_str());
-                else if (bValOnly)
                 {
-                    if (i > 0)
-                        printf("%s", osFieldSep.c_str());
-                    printf("%s", osValue.c_str());
+                    printf("  Band %d:\n", anBandList[i]);
                 }
 
-                // Report unscaled if we have scale/offset values.
-                int bSuccess;
+                // Request location info for this location.  It is possible
+                // only the VRT driver actually supports this.
+                CPLString osItem;
 
-                double dfOffset = GDALGetRasterOffset(hBand, &bSuccess);
-                // TODO: Should we turn on checking of bSuccess?
-                // Alternatively, delete these checks and put a comment as to
-                // why checking bSuccess does not matter.
-#if 0
-                if (bSuccess == FALSE)
+                osItem.Printf("Pixel_%d_%d", iPixelToQuery, iLineToQuery);
+
+                const char *pszLI =
+                    GDALGetMetadataItem(hBand, osItem, "LocationInfo");
+
+                if (pszLI != nullptr)
                 {
-                    CPLError( CE_Debug, CPLE_AppDefined,
-                              "Unable to get raster offset." );
+                    if (bAsXML)
+                        osXML += pszLI;
+                    else if (!bQuiet)
+                        printf("    %s\n", pszLI);
+                    else if (bLIFOnly)
+                    {
+                        /* Extract all files, if any. */
+
+                        CPLXMLNode *psRoot = CPLParseXMLString(pszLI);
+
+                        if (psRoot != nullptr && psRoot->psChild != nullptr &&
+                            psRoot->eType == CXT_Element &&
+                            EQUAL(psRoot->pszValue, "LocationInfo"))
+                        {
+                            for (CPLXMLNode *psNode = psRoot->psChild;
+                                 psNode != nullptr; psNode = psNode->psNext)
+                            {
+                                if (psNode->eType == CXT_Element &&
+                                    EQUAL(psNode->pszValue, "File") &&
+                                    psNode->psChild != nullptr)
+                                {
+                                    char *pszUnescaped = CPLUnescapeString(
+                                        psNode->psChild->pszValue, nullptr,
+                                        CPLES_XML);
+                                    printf("%s\n", pszUnescaped);
+                                    CPLFree(pszUnescaped);
+                                }
+                            }
+                        }
+                        CPLDestroyXMLNode(psRoot);
+                    }
                 }
-#endif
-                double dfScale = GDALGetRasterScale(hBand, &bSuccess);
-#if 0
-                if (bSuccess == FALSE)
+
+                // Report the pixel value of this band.
+                double adfPixel[2] = {0, 0};
+                const bool bIsComplex = CPL_TO_BOOL(
+                    GDALDataTypeIsComplex(GDALGetRasterDataType(hBand)));
+
+                bool bValueRead = false;
+                if (hMDArray)
                 {
-                    CPLError( CE_Debug, CPLE_AppDefined,
-                              "Unable to get raster scale." );
+                    bValueRead = bMDArrayReadOK;
+                    if (bValueRead)
+                    {
+                        const size_t nValIdx = bIsComplex ? 2 * i : i;
+                        adfPixel[0] = adfMDArrayValues[nValIdx];
+                        if (bIsComplex)
+                            adfPixel[1] = adfMDArrayValues[nValIdx + 1];
+                    }
                 }
-#endif
-                if (dfOffset != 0.0 || dfScale != 1.0)
+                else
+                {
+                    const size_t nValIdx = i * nPoints + iPt;
+                    bValueRead = abBandSuccess[nValIdx] != FALSE;
+                    adfPixel[0] = adfBandReal[nValIdx];
+                    adfPixel[1] = adfBandImag[nValIdx];
+                }
+                if (bValueRead)
                 {
-                    adfPixel[0] = adfPixel[0] * dfScale + dfOffset;
+                    CPLString osValue;
 
                     if (bIsComplex)
-                    {
-                        adfPixel[1] = adfPixel[1] * dfScale + dfOffset;
                         osValue.Printf("%.15g+%.15gi", adfPixel[0],
                                        adfPixel[1]);
-                    }
                     else
                         osValue.Printf("%.15g", adfPixel[0]);
 
                     if (bAsXML)
                     {
-                        osXML += "<DescaledValue>";
+                        osXML += "<Value>";
                         osXML += osValue;
-                        osXML += "</DescaledValue>";
+                        osXML += "</Value>";
                     }
                     else if (!bQuiet)
-                        printf("    Descaled Value: %s\n", osValue.c_str());
-                }
-            }
-
-            if (bAsXML)
-                osXML += "</BandReport>";
-        }
-
-        osXML += "</Report>";
-
-        if (bValOnly)
-        {
-            if (!osExtraContent.empty() && osFieldSep != "\n")
-                printf("%s%s", osFieldSep.c_str(), osExtraContent.c_str());
-            printf("\n");
-        }
+                        printf("    Value: %s\n", osValue.c_str());
+                    else if (bValOnly)
+                    {
+                        if (i > 0)
+                            printf("%s", osFieldSep.c_str());
+                        printf("%s", osValue.c_str());
+                    }
 
-        if (bIsXYSpecifiedAsArgument)
-            break;
+                    // Report unscaled if we have scale/offset values.
+                    int bSuccess;
 
-        osExtraContent.clear();
-        if (fgets(szLine, sizeof(szLine) - 1, stdin))
-        {
-            const CPLStringList aosTokens(CSLTokenizeString(szLine));
-            const int nCount = aosTokens.size();
-
-            ++nLine;
-            if (nCount < 2)
-            {
-                fprintf(stderr, "Not enough values at line %d\n", nLine);
-                continue;
-            }
-            else
-            {
-                dfGeoX = CPLAtof(aosTokens[0]);
-                dfGeoY = CPLAtof(aosTokens[1]);
-                if (!bIgnoreExtraInput)
-                {
-                    for (int i = 2; i < nCount; ++i)
+                    double dfOffset = GDALGetRasterOffset(hBand, &bSuccess);
+                    // TODO: Should we turn on checking of bSuccess?
+                    // Alternatively, delete these checks and put a comment as
+                    // to why checking bSuccess does not matter.
+#if 0
+                    if (bSuccess == FALSE)
                     {
-                        if (!osExtraContent.empty())
-                            osExtraContent += ' ';
-                        osExtraContent += aosTokens[i];
+                        CPLError( CE_Debug, CPLE_AppDefined,
+                                  "Unable to get raster offset." );
                     }
-                    while (!osExtraContent.empty() &&
-                           isspace(static_cast<int>(osExtraContent.back())))
+#endif
+                    double dfScale = GDALGetRasterScale(hBand, &bSuccess);
+#if 0
+                    if (bSuccess == FALSE)
                     {
-                        osExtraContent.pop_back();
+                        CPLError( CE_Debug, CPLE_AppDefined,
+                                  "Unable to get raster scale." );
+                    }
+#endif
+                    if (dfOffset != 0.0 || dfScale != 1.0)
+                    {
+                        adfPixel[0] = adfPixel[0] * dfScale + dfOffset;
+
+                        if (bIsComplex)
+                        {
+                            adfPixel[1] = adfPixel[1] * dfScale + dfOffset;
+                            osValue.Printf("%.15g+%.15gi", adfPixel[0],
+                                           adfPixel[1]);
+                        }
+                        else
+                            osValue.Printf("%.15g", adfPixel[0]);
+
+                        if (bAsXML)
+                        {
+                            osXML += "<DescaledValue>";
+                            osXML += osValue;
+                            osXML += "</DescaledValue>";
+                        }
+                        else if (!bQuiet)
+                            printf("    Descaled Value: %s\n",
+                                   osValue.c_str());
                     }
                 }
+
+                if (bAsXML)
+                    osXML += "</BandReport>";
+            }
+
+            osXML += "</Report>";
+
+            if (bValOnly)
+            {
+                if (!osExtraContent.empty() && osFieldSep != "\n")
+                    printf("%s%s", osFieldSep.c_str(), osExtraContent.c_str());
+                printf("\n");
             }
         }
-        else
+
+        asPoints.clear();
+        if (!bInputEOF)
         {
-            break;
+            fflush(stdout);
+            ReadInputPoints();
         }
     }
 
@@ -700,6 +929,12 @@ MAIN_START(argc, argv)
     }
 
     GDALClose(hSrcDS);
+    if (hMDArray)
+        GDALMDArrayRelease(hMDArray);
+    if (hRootGroup)
+        GDALGroupRelease(hRootGroup);
+    if (hMDimDS)
+        GDALClose(hMDimDS);
 
     GDALDumpOpenDatasets(stderr);
     GDALDestroyDriverManager();
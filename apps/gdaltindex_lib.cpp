@@ -29,10 +29,13 @@
 
 #include "cpl_port.h"
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_utils.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils_priv.h"
 #include "ogr_api.h"
 #include "ogrsf_frmts.h"
@@ -44,7 +47,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <condition_variable>
+#include <deque>
 #include <limits>
+#include <mutex>
 #include <set>
 
 typedef enum
@@ -100,6 +106,7 @@ struct GDALTileIndexOptions
     double dfMaxPixelSize = std::numeric_limits<double>::quiet_NaN();
     std::vector<GDALTileIndexRasterMetadata> aoFetchMD{};
     std::set<std::string> oSetFilenameFilters{};
+    int nNumThreads = 0;
 };
 
 /************************************************************************/
@@ -330,6 +337,21 @@ static std::unique_ptr<GDALArgumentParser> GDALTileIndexAppOptionsGetParser(
         .help("Fetch a metadata item from the raster tile and write it as a "
               "field in the tile index.");
 
+    argParser->add_argument("-num_threads")
+        .metavar("<num_threads>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (EQUAL(s.c_str(), "ALL_CPUS"))
+                    psOptions->nNumThreads = CPLGetNumCPUs();
+                else
+                    psOptions->nNumThreads = atoi(s.c_str());
+                if (psOptions->nNumThreads < 1)
+                    throw std::invalid_argument(
+                        "Invalid value for -num_threads: " + s);
+            })
+        .help(_("Number of threads used to open the raster tiles."));
+
     if (psOptionsForBinary)
     {
         argParser->add_quiet_argument(&psOptionsForBinary->bQuiet);
@@ -485,6 +507,158 @@ struct GDALTileIndexTileIterator
     }
 };
 
+/************************************************************************/
+/*                       GDALTileIndexTileOpener                        */
+/************************************************************************/
+
+/* Opens raster tiles, possibly ahead of their processing from worker
+ * threads, while returning them in submission order. Opening a tile and
+ * reading its georeferencing dominates the run time when tiles are on
+ * network file systems or cloud storage.
+ */
+class GDALTileIndexTileOpener
+{
+    CPL_DISALLOW_COPY_ASSIGN(GDALTileIndexTileOpener)
+
+  public:
+    struct Tile
+    {
+        std::string osSrcFilename{};
+        std::string osFileNameToWrite{};
+        bool bAlreadyInIndex = false;
+        std::unique_ptr<GDALDataset> poSrcDS{};
+
+      private:
+        friend class GDALTileIndexTileOpener;
+        GDALTileIndexTileOpener *poOpener = nullptr;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        bool bDone = false;
+    };
+
+    explicit GDALTileIndexTileOpener(int nNumThreads,
+                                     const GDALTileIndexOptions *psOptions);
+    ~GDALTileIndexTileOpener();
+
+    bool IsFull() const
+    {
+        return m_apoTiles.size() >= m_nMaxPending;
+    }
+
+    void Submit(std::unique_ptr<Tile> poTile);
+
+    std::unique_ptr<Tile> Next();
+
+  private:
+    const GDALTileIndexOptions *m_psOptions = nullptr;
+    std::unique_ptr<CPLJobQueue> m_poQueue{};
+    size_t m_nMaxPending = 1;
+    std::deque<std::unique_ptr<Tile>> m_apoTiles{};
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+
+    void Open(Tile *psTile) const;
+    static void OpenFunc(void *pData);
+};
+
+GDALTileIndexTileOpener::GDALTileIndexTileOpener(
+    int nNumThreads, const GDALTileIndexOptions *psOptions)
+    : m_psOptions(psOptions)
+{
+    if (nNumThreads > 1)
+    {
+        CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nNumThreads);
+        if (poPool)
+        {
+            m_poQueue = poPool->CreateJobQueue();
+            // At most a few tiles opened ahead per thread, to bound the
+            // number of simultaneously opened files.
+            m_nMaxPending = 2 * static_cast<size_t>(poPool->GetThreadCount());
+        }
+    }
+}
+
+GDALTileIndexTileOpener::~GDALTileIndexTileOpener()
+{
+    if (m_poQueue)
+        m_poQueue->WaitCompletion();
+}
+
+void GDALTileIndexTileOpener::Open(Tile *psTile) const
+{
+    psTile->poSrcDS.reset(GDALDataset::Open(
+        psTile->osSrcFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
+        nullptr, nullptr, nullptr));
+    if (psTile->poSrcDS)
+    {
+        // Trigger the lazy loading of what GDALTileIndex() will query.
+        double adfGeoTransform[6];
+        CPL_IGNORE_RET_VAL(psTile->poSrcDS->GetGeoTransform(adfGeoTransform));
+        CPL_IGNORE_RET_VAL(psTile->poSrcDS->GetSpatialRef());
+        for (const auto &oFetchMD : m_psOptions->aoFetchMD)
+        {
+            CPL_IGNORE_RET_VAL(psTile->poSrcDS->GetMetadataItem(
+                oFetchMD.osRasterItemName.c_str()));
+        }
+    }
+}
+
+void GDALTileIndexTileOpener::OpenFunc(void *pData)
+{
+    Tile *psTile = static_cast<Tile *>(pData);
+    GDALTileIndexTileOpener *poOpener = psTile->poOpener;
+    CPLInstallErrorHandlerAccumulator(psTile->aoErrors);
+    poOpener->Open(psTile);
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard oLock(poOpener->m_oMutex);
+    psTile->bDone = true;
+    poOpener->m_oCV.notify_all();
+}
+
+void GDALTileIndexTileOpener::Submit(std::unique_ptr<Tile> poTile)
+{
+    poTile->poOpener = this;
+    if (m_poQueue && !poTile->bAlreadyInIndex &&
+        !m_poQueue->SubmitJob(OpenFunc, poTile.get()))
+    {
+        // Should not happen. Fallback to opening in Next().
+        poTile->poOpener = nullptr;
+    }
+    m_apoTiles.push_back(std::move(poTile));
+}
+
+/* Returns the next tile in submission order, or nullptr if there is none.
+ * The errors emitted while opening it are re-emitted in the calling thread.
+ */
+std::unique_ptr<GDALTileIndexTileOpener::Tile> GDALTileIndexTileOpener::Next()
+{
+    if (m_apoTiles.empty())
+        return nullptr;
+    auto poTile = std::move(m_apoTiles.front());
+    m_apoTiles.pop_front();
+    if (poTile->bAlreadyInIndex)
+        return poTile;
+
+    if (m_poQueue && poTile->poOpener)
+    {
+        {
+            std::unique_lock oLock(m_oMutex);
+            Tile *psTile = poTile.get();
+            m_oCV.wait(oLock, [psTile] { return psTile->bDone; });
+        }
+        for (const auto &oError : poTile->aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        poTile->aoErrors.clear();
+    }
+    else
+    {
+        Open(poTile.get());
+    }
+    return poTile;
+}
+
 /************************************************************************/
 /*                           GDALTileIndex()                            */
 /************************************************************************/
@@ -991,34 +1165,77 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         psOptions->bMaskBand || !psOptions->aosMetadata.empty() ||
         !psOptions->osGTIFilename.empty();
 
+    int nNumThreads = psOptions->nNumThreads;
+    if (nNumThreads <= 0)
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                              ? CPLGetNumCPUs()
+                              : atoi(pszNumThreads);
+        }
+    }
+    // Cap to avoid unreasonable values
+    nNumThreads = std::max(1, std::min(1024, nNumThreads));
+    GDALTileIndexTileOpener oTileOpener(nNumThreads, psOptions.get());
+
+    // Group the writing of features in transactions, for formats where
+    // this matters (GPKG, etc.)
+    constexpr int FEATURES_PER_TRANSACTION = 10 * 1000;
+    const bool bUseTransactions =
+        poTileIndexDS->TestCapability(ODsCTransactions) != FALSE;
+    bool bInTransaction = false;
+    int nFeaturesInTransaction = 0;
+
     /* -------------------------------------------------------------------- */
     /*      loop over GDAL files, processing.                               */
     /* -------------------------------------------------------------------- */
+    bool bMoreFiles = true;
     while (true)
     {
-        const std::string osSrcFilename = oGDALTileIndexTileIterator.next();
-        if (osSrcFilename.empty())
-            break;
+        while (bMoreFiles && !oTileOpener.IsFull())
+        {
+            std::string osSrcFilename = oGDALTileIndexTileIterator.next();
+            if (osSrcFilename.empty())
+            {
+                bMoreFiles = false;
+                break;
+            }
 
-        std::string osFileNameToWrite;
-        VSIStatBuf sStatBuf;
+            auto poTile = std::make_unique<GDALTileIndexTileOpener::Tile>();
+            VSIStatBuf sStatBuf;
 
-        // Make sure it is a file before building absolute path name.
-        if (!osCurrentPath.empty() &&
-            CPLIsFilenameRelative(osSrcFilename.c_str()) &&
-            VSIStat(osSrcFilename.c_str(), &sStatBuf) == 0)
-        {
-            osFileNameToWrite = CPLProjectRelativeFilename(
-                osCurrentPath.c_str(), osSrcFilename.c_str());
-        }
-        else
-        {
-            osFileNameToWrite = osSrcFilename.c_str();
+            // Make sure it is a file before building absolute path name.
+            if (!osCurrentPath.empty() &&
+                CPLIsFilenameRelative(osSrcFilename.c_str()) &&
+                VSIStat(osSrcFilename.c_str(), &sStatBuf) == 0)
+            {
+                poTile->osFileNameToWrite = CPLProjectRelativeFilename(
+                    osCurrentPath.c_str(), osSrcFilename.c_str());
+            }
+            else
+            {
+                poTile->osFileNameToWrite = osSrcFilename;
+            }
+            poTile->osSrcFilename = std::move(osSrcFilename);
+
+            // Checks that file is not already in tileindex.
+            poTile->bAlreadyInIndex =
+                oSetExistingFiles.find(poTile->osFileNameToWrite) !=
+                oSetExistingFiles.end();
+
+            oTileOpener.Submit(std::move(poTile));
         }
 
-        // Checks that file is not already in tileindex.
-        if (oSetExistingFiles.find(osFileNameToWrite) !=
-            oSetExistingFiles.end())
+        auto poTile = oTileOpener.Next();
+        if (!poTile)
+            break;
+        const std::string &osSrcFilename = poTile->osSrcFilename;
+        const std::string &osFileNameToWrite = poTile->osFileNameToWrite;
+
+        if (poTile->bAlreadyInIndex)
         {
             CPLError(CE_Warning, CPLE_AppDefined,
                      "File %s is already in tileindex. Skipping it.",
@@ -1026,9 +1243,7 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
             continue;
         }
 
-        auto poSrcDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
-            osSrcFilename.c_str(), GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR,
-            nullptr, nullptr, nullptr));
+        auto poSrcDS = std::move(poTile->poSrcDS);
         if (poSrcDS == nullptr)
         {
             CPLError(CE_Warning, CPLE_AppDefined,
@@ -1286,14 +1501,31 @@ GDALDatasetH GDALTileIndex(const char *pszDest, int nSrcCount,
         poPoly->addRingDirectly(poRing.release());
         poFeature->SetGeometryDirectly(poPoly.release());
 
+        if (bUseTransactions && !bInTransaction)
+        {
+            bInTransaction = poTileIndexDS->StartTransaction() == OGRERR_NONE;
+            nFeaturesInTransaction = 0;
+        }
+
         if (poLayer->CreateFeature(poFeature.get()) != OGRERR_NONE)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
                      "Failed to create feature in tile index.");
             return nullptr;
         }
+
+        if (bInTransaction &&
+            ++nFeaturesInTransaction == FEATURES_PER_TRANSACTION)
+        {
+            bInTransaction = false;
+            if (poTileIndexDS->CommitTransaction() != OGRERR_NONE)
+                return nullptr;
+        }
     }
 
+    if (bInTransaction && poTileIndexDS->CommitTransaction() != OGRERR_NONE)
+        return nullptr;
+
     return GDALDataset::ToHandle(poTileIndexDS.release());
 }
 
@@ -45,18 +45,13 @@
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #include "nearblack_lib.h"
 
-static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
-                        int nSrcBands, int nDstBands, int nNearDist,
-                        int nMaxNonBlack, bool bNearWhite,
-                        const Colors &oColors, int *panLastLineCounts,
-                        bool bDoHorizontalCheck, bool bDoVerticalCheck,
-                        bool bBottomUp, int iLineFromTopOrBottom);
-
 /************************************************************************/
 /*                            GDALNearblack()                           */
 /************************************************************************/
@@ -335,223 +330,131 @@ GDALDatasetH CPL_DLL GDALNearblack(const char *pszDest, GDALDatasetH hDstDS,
 }
 
 /************************************************************************/
-/*                   GDALNearblackTwoPassesAlgorithm()                  */
+/*                        ProcessLineVertical()                         */
 /*                                                                      */
-/* Do a top-to-bottom pass, followed by a bottom-to-top one.            */
+/*      Do the vertical checks of the columns [iColStart, iColEnd[ of   */
+/*      a single scanline of image data.                                */
 /************************************************************************/
 
-bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
-                                     GDALDatasetH hSrcDataset,
-                                     GDALDatasetH hDstDS,
-                                     GDALRasterBandH hMaskBand, int nBands,
-                                     int nDstBands, bool bSetMask,
-                                     const Colors &oColors)
+static void ProcessLineVertical(GByte *pabyLine, GByte *pabyMask,
+                                int iColStart, int iColEnd, int nSrcBands,
+                                int nDstBands, int nNearDist, int nMaxNonBlack,
+                                bool bNearWhite, const Colors &oColors,
+                                int *panLastLineCounts,
+                                int iLineFromTopOrBottom)
 {
-    const int nXSize = GDALGetRasterXSize(hSrcDataset);
-    const int nYSize = GDALGetRasterYSize(hSrcDataset);
-
-    const int nMaxNonBlack = psOptions->nMaxNonBlack;
-    const int nNearDist = psOptions->nNearDist;
-    const bool bNearWhite = psOptions->bNearWhite;
-    const bool bSetAlpha = psOptions->bSetAlpha;
+    const GByte nReplacevalue = bNearWhite ? 255 : 0;
 
     /* -------------------------------------------------------------------- */
-    /*      Allocate a line buffer.                                         */
+    /*      Vertical checking.                                              */
     /* -------------------------------------------------------------------- */
 
-    std::vector<GByte> abyLine(static_cast<size_t>(nXSize) * nDstBands);
-    GByte *pabyLine = abyLine.data();
-
-    std::vector<GByte> abyMask;
-    GByte *pabyMask = nullptr;
-    if (bSetMask)
+    for (int i = iColStart; i < iColEnd; i++)
     {
-        abyMask.resize(nXSize);
-        pabyMask = abyMask.data();
-    }
-
-    std::vector<int> anLastLineCounts(nXSize);
-    int *panLastLineCounts = anLastLineCounts.data();
+        // are we already terminated for this column?
+        if (panLastLineCounts[i] > nMaxNonBlack)
+            continue;
 
-    /* -------------------------------------------------------------------- */
-    /*      Processing data one line at a time.                             */
-    /* -------------------------------------------------------------------- */
-    int iLine;
+        /***** is the pixel valid data? ****/
 
-    for (iLine = 0; iLine < nYSize; iLine++)
-    {
-        CPLErr eErr = GDALDatasetRasterIO(
-            hSrcDataset, GF_Read, 0, iLine, nXSize, 1, pabyLine, nXSize, 1,
-            GDT_Byte, nBands, nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
-        {
-            return false;
-        }
+        bool bIsNonBlack = false;
 
-        if (bSetAlpha)
-        {
-            for (int iCol = 0; iCol < nXSize; iCol++)
-            {
-                pabyLine[iCol * nDstBands + nDstBands - 1] = 255;
-            }
-        }
+        /***** loop over the colors *****/
 
-        if (bSetMask)
+        for (int iColor = 0; iColor < static_cast<int>(oColors.size());
+             iColor++)
         {
-            for (int iCol = 0; iCol < nXSize; iCol++)
-            {
-                pabyMask[iCol] = 255;
-            }
-        }
 
-        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    true,   // bDoVerticalCheck
-                    false,  // bBottomUp
-                    iLine);
-        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    false,  // bDoVerticalCheck
-                    false,  // bBottomUp
-                    iLine);
-
-        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iLine, nXSize, 1,
-                                   pabyLine, nXSize, 1, GDT_Byte, nDstBands,
-                                   nullptr, nDstBands, nXSize * nDstBands, 1);
+            const Color &oColor = oColors[iColor];
 
-        if (eErr != CE_None)
-        {
-            return false;
-        }
+            bIsNonBlack = false;
 
-        /***** write out the mask band line *****/
+            /***** loop over the bands *****/
 
-        if (bSetMask)
-        {
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
+            for (int iBand = 0; iBand < nSrcBands; iBand++)
             {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "ERROR writing out line to mask band.");
-                return false;
+                const int nPix = pabyLine[i * nDstBands + iBand];
+
+                if (oColor[iBand] - nPix > nNearDist ||
+                    nPix > nNearDist + oColor[iBand])
+                {
+                    bIsNonBlack = true;
+                    break;
+                }
             }
-        }
 
-        if (!(psOptions->pfnProgress(
-                0.5 * ((iLine + 1) / static_cast<double>(nYSize)), nullptr,
-                psOptions->pProgressData)))
-        {
-            return false;
+            if (!bIsNonBlack)
+                break;
         }
-    }
-
-    /* -------------------------------------------------------------------- */
-    /*      Now process from the bottom back up                            .*/
-    /* -------------------------------------------------------------------- */
-    memset(panLastLineCounts, 0, sizeof(int) * nXSize);
 
-    for (iLine = nYSize - 1; hDstDS != nullptr && iLine >= 0; iLine--)
-    {
-        CPLErr eErr = GDALDatasetRasterIO(
-            hDstDS, GF_Read, 0, iLine, nXSize, 1, pabyLine, nXSize, 1, GDT_Byte,
-            nDstBands, nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
+        if (bIsNonBlack)
         {
-            return false;
-        }
+            panLastLineCounts[i]++;
 
-        /***** read the mask band line back in *****/
+            if (panLastLineCounts[i] > nMaxNonBlack)
+                continue;
 
-        if (bSetMask)
-        {
-            eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
+            if (iLineFromTopOrBottom == 0 && nMaxNonBlack > 0)
             {
-                return false;
+                // if there's a valid value just at the top or bottom
+                // of the raster, then ignore the nMaxNonBlack setting
+                panLastLineCounts[i] = nMaxNonBlack + 1;
+                continue;
             }
         }
+        // else
+        //   panLastLineCounts[i] = 0; // not sure this even makes sense
 
-        ProcessLine(pabyLine, pabyMask, 0, nXSize - 1, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,  // bDoHorizontalCheck
-                    true,  // bDoVerticalCheck
-                    true,  // bBottomUp
-                    nYSize - 1 - iLine);
-        ProcessLine(pabyLine, pabyMask, nXSize - 1, 0, nBands, nDstBands,
-                    nNearDist, nMaxNonBlack, bNearWhite, oColors,
-                    panLastLineCounts,
-                    true,   // bDoHorizontalCheck
-                    false,  // bDoVerticalCheck
-                    true,   // bBottomUp
-                    nYSize - 1 - iLine);
-
-        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iLine, nXSize, 1,
-                                   pabyLine, nXSize, 1, GDT_Byte, nDstBands,
-                                   nullptr, nDstBands, nXSize * nDstBands, 1);
-        if (eErr != CE_None)
-        {
-            return false;
-        }
-
-        /***** write out the mask band line *****/
+        /***** replace the pixel values *****/
+        for (int iBand = 0; iBand < nSrcBands; iBand++)
+            pabyLine[i * nDstBands + iBand] = nReplacevalue;
 
-        if (bSetMask)
-        {
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iLine, nXSize, 1,
-                                pabyMask, nXSize, 1, GDT_Byte, 0, 0);
-            if (eErr != CE_None)
-            {
-                return false;
-            }
-        }
+        /***** alpha *****/
+        if (nDstBands > nSrcBands)
+            pabyLine[i * nDstBands + nDstBands - 1] = 0;
 
-        if (!(psOptions->pfnProgress(0.5 + 0.5 * (nYSize - iLine) /
-                                               static_cast<double>(nYSize),
-                                     nullptr, psOptions->pProgressData)))
-        {
-            return false;
-        }
+        /***** mask *****/
+        if (pabyMask != nullptr)
+            pabyMask[i] = 0;
     }
-
-    return true;
 }
 
 /************************************************************************/
-/*                            ProcessLine()                             */
+/*                       ProcessLineHorizontal()                        */
 /*                                                                      */
-/*      Process a single scanline of image data.                        */
+/*      Do the horizontal checks of a single scanline of image data,    */
+/*      from iStart to iEnd.                                            */
 /************************************************************************/
 
-static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
-                        int nSrcBands, int nDstBands, int nNearDist,
-                        int nMaxNonBlack, bool bNearWhite,
-                        const Colors &oColors, int *panLastLineCounts,
-                        bool bDoHorizontalCheck, bool bDoVerticalCheck,
-                        bool bBottomUp, int iLineFromTopOrBottom)
+static void ProcessLineHorizontal(GByte *pabyLine, GByte *pabyMask, int iStart,
+                                  int iEnd, int nSrcBands, int nDstBands,
+                                  int nNearDist, int nMaxNonBlack,
+                                  bool bNearWhite, const Colors &oColors,
+                                  const int *panLastLineCounts, bool bBottomUp)
 {
     const GByte nReplacevalue = bNearWhite ? 255 : 0;
 
     /* -------------------------------------------------------------------- */
-    /*      Vertical checking.                                              */
+    /*      Horizontal Checking.                                            */
     /* -------------------------------------------------------------------- */
 
-    if (bDoVerticalCheck)
+    int nNonBlackPixels = 0;
+
+    /***** on a bottom up pass assume nMaxNonBlack is 0 *****/
+
+    if (bBottomUp)
+        nMaxNonBlack = 0;
+
+    const int iDir = iStart < iEnd ? 1 : -1;
+
+    bool bDoTest = TRUE;
+
+    for (int i = iStart; i != iEnd; i += iDir)
     {
-        const int nXSize = std::max(iStart + 1, iEnd + 1);
+        /***** not seen any valid data? *****/
 
-        for (int i = 0; i < nXSize; i++)
+        if (bDoTest)
         {
-            // are we already terminated for this column?
-            if (panLastLineCounts[i] > nMaxNonBlack)
-                continue;
-
             /***** is the pixel valid data? ****/
 
             bool bIsNonBlack = false;
@@ -580,148 +483,339 @@ static void ProcessLine(GByte *pabyLine, GByte *pabyMask, int iStart, int iEnd,
                     }
                 }
 
-                if (!bIsNonBlack)
+                if (bIsNonBlack == false)
                     break;
             }
 
             if (bIsNonBlack)
             {
-                panLastLineCounts[i]++;
+                /***** use nNonBlackPixels in grey areas  *****/
+                /***** from the vertical pass's grey areas ****/
 
-                if (panLastLineCounts[i] > nMaxNonBlack)
-                    continue;
+                if (panLastLineCounts[i] <= nMaxNonBlack)
+                    nNonBlackPixels = panLastLineCounts[i];
+                else
+                    nNonBlackPixels++;
+            }
 
-                if (iLineFromTopOrBottom == 0 && nMaxNonBlack > 0)
-                {
-                    // if there's a valid value just at the top or bottom
-                    // of the raster, then ignore the nMaxNonBlack setting
-                    panLastLineCounts[i] = nMaxNonBlack + 1;
-                    continue;
-                }
+            if (nNonBlackPixels > nMaxNonBlack)
+            {
+                bDoTest = false;
+                continue;
+            }
+
+            if (bIsNonBlack && nMaxNonBlack > 0 && i == iStart)
+            {
+                // if there's a valid value just at the left or right
+                // of the raster, then ignore the nMaxNonBlack setting
+                bDoTest = false;
+                continue;
             }
-            // else
-            //   panLastLineCounts[i] = 0; // not sure this even makes sense
 
             /***** replace the pixel values *****/
+
             for (int iBand = 0; iBand < nSrcBands; iBand++)
                 pabyLine[i * nDstBands + iBand] = nReplacevalue;
 
             /***** alpha *****/
+
             if (nDstBands > nSrcBands)
                 pabyLine[i * nDstBands + nDstBands - 1] = 0;
 
             /***** mask *****/
+
             if (pabyMask != nullptr)
                 pabyMask[i] = 0;
         }
-    }
 
-    /* -------------------------------------------------------------------- */
-    /*      Horizontal Checking.                                            */
-    /* -------------------------------------------------------------------- */
+        /***** seen valid data but test if the *****/
+        /***** vertical pass saw any non valid data *****/
 
-    if (bDoHorizontalCheck)
-    {
-        int nNonBlackPixels = 0;
+        else if (panLastLineCounts[i] == 0)
+        {
+            bDoTest = true;
+            nNonBlackPixels = 0;
+        }
+    }
+}
 
-        /***** on a bottom up pass assume nMaxNonBlack is 0 *****/
+/************************************************************************/
+/*                     GDALNearblackGetNumThreads()                     */
+/************************************************************************/
 
-        if (bBottomUp)
-            nMaxNonBlack = 0;
+int GDALNearblackGetNumThreads(const GDALNearblackOptions *psOptions)
+{
+    int nThreads = psOptions->nNumThreads;
+    if (nThreads <= 0)
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            nThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                        : atoi(pszNumThreads);
+        }
+    }
+    // Cap to avoid unreasonable values
+    return std::max(1, std::min(128, nThreads));
+}
 
-        const int iDir = iStart < iEnd ? 1 : -1;
+/************************************************************************/
+/*                   GDALNearblackTwoPassesAlgorithm()                  */
+/*                                                                      */
+/* Do a top-to-bottom pass, followed by a bottom-to-top one.            */
+/*                                                                      */
+/* Lines are processed by chunks. Within a chunk, the vertical checks   */
+/* are done on ranges of columns in parallel (each column only depends  */
+/* on the previous lines of the same column), and then the horizontal   */
+/* checks on ranges of lines in parallel, using the state of the        */
+/* vertical checks saved for each line. The result does not depend on  */
+/* the number of threads.                                               */
+/************************************************************************/
 
-        bool bDoTest = TRUE;
+bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
+                                     GDALDatasetH hSrcDataset,
+                                     GDALDatasetH hDstDS,
+                                     GDALRasterBandH hMaskBand, int nBands,
+                                     int nDstBands, bool bSetMask,
+                                     const Colors &oColors)
+{
+    const int nXSize = GDALGetRasterXSize(hSrcDataset);
+    const int nYSize = GDALGetRasterYSize(hSrcDataset);
 
-        for (int i = iStart; i != iEnd; i += iDir)
-        {
-            /***** not seen any valid data? *****/
+    const int nMaxNonBlack = psOptions->nMaxNonBlack;
+    const int nNearDist = psOptions->nNearDist;
+    const bool bNearWhite = psOptions->bNearWhite;
+    const bool bSetAlpha = psOptions->bSetAlpha;
 
-            if (bDoTest)
-            {
-                /***** is the pixel valid data? ****/
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    const int nThreads = GDALNearblackGetNumThreads(psOptions);
+    if (nThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
 
-                bool bIsNonBlack = false;
+    /* -------------------------------------------------------------------- */
+    /*      Allocate buffers for a chunk of lines.                          */
+    /* -------------------------------------------------------------------- */
 
-                /***** loop over the colors *****/
+    // Chunks are at least as high as the blocks of the source dataset, so
+    // that tiled datasets are read efficiently, but their size is capped.
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    GDALGetBlockSize(GDALGetRasterBand(hSrcDataset, 1), &nBlockXSize,
+                     &nBlockYSize);
+    int nChunkLines = std::max(nBlockYSize, poJobQueue ? 16 * nThreads : 1);
+    constexpr size_t MAX_CHUNK_BYTES = 64 * 1024 * 1024;
+    const size_t nBytesPerLine =
+        static_cast<size_t>(nXSize) * (nDstBands + 1 + sizeof(int));
+    nChunkLines = static_cast<int>(std::min<size_t>(
+        nChunkLines, std::max<size_t>(1, MAX_CHUNK_BYTES / nBytesPerLine)));
+    nChunkLines = std::max(1, std::min(nChunkLines, nYSize));
+
+    std::vector<GByte> abyChunk;
+    std::vector<GByte> abyMaskChunk;
+    std::vector<int> anLastLineCounts;
+    // Value of anLastLineCounts after the vertical check of each line
+    std::vector<int> anChunkLineCounts;
+    try
+    {
+        abyChunk.resize(static_cast<size_t>(nChunkLines) * nXSize * nDstBands);
+        if (bSetMask)
+            abyMaskChunk.resize(static_cast<size_t>(nChunkLines) * nXSize);
+        anLastLineCounts.resize(nXSize);
+        anChunkLineCounts.resize(static_cast<size_t>(nChunkLines) * nXSize);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffers: %s", e.what());
+        return false;
+    }
+    const int nLineSpace = nXSize * nDstBands;
 
-                for (int iColor = 0; iColor < static_cast<int>(oColors.size());
-                     iColor++)
+    const auto ProcessChunk =
+        [&](int nLines, bool bBottomUp, int iFirstLineFromTopOrBottom)
+    {
+        CPLJobQueueRunRanges(
+            poJobQueue.get(), nThreads, nXSize,
+            [&](int, int iColStart, int iColEnd)
+            {
+                for (int i = 0; i < nLines; ++i)
                 {
+                    const size_t iLine = bBottomUp ? nLines - 1 - i : i;
+                    ProcessLineVertical(
+                        abyChunk.data() + iLine * nLineSpace,
+                        bSetMask ? abyMaskChunk.data() + iLine * nXSize
+                                 : nullptr,
+                        iColStart, iColEnd, nBands, nDstBands, nNearDist,
+                        nMaxNonBlack, bNearWhite, oColors,
+                        anLastLineCounts.data(),
+                        iFirstLineFromTopOrBottom + i);
+                    memcpy(anChunkLineCounts.data() + iLine * nXSize +
+                               iColStart,
+                           anLastLineCounts.data() + iColStart,
+                           sizeof(int) * (iColEnd - iColStart));
+                }
+            });
 
-                    const Color &oColor = oColors[iColor];
+        CPLJobQueueRunRanges(
+            poJobQueue.get(), nThreads, nLines,
+            [&](int, int iLineStart, int iLineEnd)
+            {
+                for (size_t iLine = iLineStart;
+                     iLine < static_cast<size_t>(iLineEnd); ++iLine)
+                {
+                    GByte *pabyLine = abyChunk.data() + iLine * nLineSpace;
+                    GByte *pabyMask =
+                        bSetMask ? abyMaskChunk.data() + iLine * nXSize
+                                 : nullptr;
+                    const int *panLineCounts =
+                        anChunkLineCounts.data() + iLine * nXSize;
+                    ProcessLineHorizontal(pabyLine, pabyMask, 0, nXSize - 1,
+                                          nBands, nDstBands, nNearDist,
+                                          nMaxNonBlack, bNearWhite, oColors,
+                                          panLineCounts, bBottomUp);
+                    ProcessLineHorizontal(pabyLine, pabyMask, nXSize - 1, 0,
+                                          nBands, nDstBands, nNearDist,
+                                          nMaxNonBlack, bNearWhite, oColors,
+                                          panLineCounts, bBottomUp);
+                }
+            });
+    };
 
-                    bIsNonBlack = false;
+    /* -------------------------------------------------------------------- */
+    /*      Processing data one chunk at a time.                            */
+    /* -------------------------------------------------------------------- */
+    for (int iChunkLine = 0; iChunkLine < nYSize; iChunkLine += nChunkLines)
+    {
+        const int nLines = std::min(nChunkLines, nYSize - iChunkLine);
 
-                    /***** loop over the bands *****/
+        CPLErr eErr = GDALDatasetRasterIO(
+            hSrcDataset, GF_Read, 0, iChunkLine, nXSize, nLines,
+            abyChunk.data(), nXSize, nLines, GDT_Byte, nBands, nullptr,
+            nDstBands, nLineSpace, 1);
+        if (eErr != CE_None)
+        {
+            return false;
+        }
 
-                    for (int iBand = 0; iBand < nSrcBands; iBand++)
-                    {
-                        const int nPix = pabyLine[i * nDstBands + iBand];
+        if (bSetAlpha)
+        {
+            for (size_t i = 0; i < static_cast<size_t>(nLines) * nXSize; i++)
+            {
+                abyChunk[i * nDstBands + nDstBands - 1] = 255;
+            }
+        }
 
-                        if (oColor[iBand] - nPix > nNearDist ||
-                            nPix > nNearDist + oColor[iBand])
-                        {
-                            bIsNonBlack = true;
-                            break;
-                        }
-                    }
+        if (bSetMask)
+        {
+            memset(abyMaskChunk.data(), 255,
+                   static_cast<size_t>(nLines) * nXSize);
+        }
 
-                    if (bIsNonBlack == false)
-                        break;
-                }
+        ProcessChunk(nLines, /* bBottomUp = */ false, iChunkLine);
 
-                if (bIsNonBlack)
-                {
-                    /***** use nNonBlackPixels in grey areas  *****/
-                    /***** from the vertical pass's grey areas ****/
+        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iChunkLine, nXSize,
+                                   nLines, abyChunk.data(), nXSize, nLines,
+                                   GDT_Byte, nDstBands, nullptr, nDstBands,
+                                   nLineSpace, 1);
 
-                    if (panLastLineCounts[i] <= nMaxNonBlack)
-                        nNonBlackPixels = panLastLineCounts[i];
-                    else
-                        nNonBlackPixels++;
-                }
+        if (eErr != CE_None)
+        {
+            return false;
+        }
 
-                if (nNonBlackPixels > nMaxNonBlack)
-                {
-                    bDoTest = false;
-                    continue;
-                }
+        /***** write out the mask band lines *****/
 
-                if (bIsNonBlack && nMaxNonBlack > 0 && i == iStart)
-                {
-                    // if there's a valid value just at the left or right
-                    // of the raster, then ignore the nMaxNonBlack setting
-                    bDoTest = false;
-                    continue;
-                }
+        if (bSetMask)
+        {
+            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iChunkLine, nXSize,
+                                nLines, abyMaskChunk.data(), nXSize, nLines,
+                                GDT_Byte, 0, 0);
+            if (eErr != CE_None)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "ERROR writing out line to mask band.");
+                return false;
+            }
+        }
 
-                /***** replace the pixel values *****/
+        if (!(psOptions->pfnProgress(
+                0.5 * ((iChunkLine + nLines) / static_cast<double>(nYSize)),
+                nullptr, psOptions->pProgressData)))
+        {
+            return false;
+        }
+    }
 
-                for (int iBand = 0; iBand < nSrcBands; iBand++)
-                    pabyLine[i * nDstBands + iBand] = nReplacevalue;
+    /* -------------------------------------------------------------------- */
+    /*      Now process from the bottom back up                            .*/
+    /* -------------------------------------------------------------------- */
+    std::fill(anLastLineCounts.begin(), anLastLineCounts.end(), 0);
 
-                /***** alpha *****/
+    for (int iChunkEnd = nYSize; iChunkEnd > 0; iChunkEnd -= nChunkLines)
+    {
+        const int nLines = std::min(nChunkLines, iChunkEnd);
+        const int iChunkLine = iChunkEnd - nLines;
 
-                if (nDstBands > nSrcBands)
-                    pabyLine[i * nDstBands + nDstBands - 1] = 0;
+        CPLErr eErr = GDALDatasetRasterIO(
+            hDstDS, GF_Read, 0, iChunkLine, nXSize, nLines, abyChunk.data(),
+            nXSize, nLines, GDT_Byte, nDstBands, nullptr, nDstBands,
+            nLineSpace, 1);
+        if (eErr != CE_None)
+        {
+            return false;
+        }
 
-                /***** mask *****/
+        /***** read the mask band lines back in *****/
 
-                if (pabyMask != nullptr)
-                    pabyMask[i] = 0;
+        if (bSetMask)
+        {
+            eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iChunkLine, nXSize,
+                                nLines, abyMaskChunk.data(), nXSize, nLines,
+                                GDT_Byte, 0, 0);
+            if (eErr != CE_None)
+            {
+                return false;
             }
+        }
+
+        ProcessChunk(nLines, /* bBottomUp = */ true, nYSize - iChunkEnd);
 
-            /***** seen valid data but test if the *****/
-            /***** vertical pass saw any non valid data *****/
+        eErr = GDALDatasetRasterIO(hDstDS, GF_Write, 0, iChunkLine, nXSize,
+                                   nLines, abyChunk.data(), nXSize, nLines,
+                                   GDT_Byte, nDstBands, nullptr, nDstBands,
+                                   nLineSpace, 1);
+        if (eErr != CE_None)
+        {
+            return false;
+        }
 
-            else if (panLastLineCounts[i] == 0)
+        /***** write out the mask band lines *****/
+
+        if (bSetMask)
+        {
+            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iChunkLine, nXSize,
+                                nLines, abyMaskChunk.data(), nXSize, nLines,
+                                GDT_Byte, 0, 0);
+            if (eErr != CE_None)
             {
-                bDoTest = true;
-                nNonBlackPixels = 0;
+                return false;
             }
         }
+
+        if (!(psOptions->pfnProgress(0.5 + 0.5 * (nYSize - iChunkLine) /
+                                               static_cast<double>(nYSize),
+                                     nullptr, psOptions->pProgressData)))
+        {
+            return false;
+        }
     }
+
+    return true;
 }
 
 /************************************************************************/
@@ -865,6 +959,21 @@ GDALNearblackOptionsGetParser(GDALNearblackOptions *psOptions,
                 { psOptions->bFloodFill = EQUAL(s.c_str(), "floodfill"); })
         .help(_("Selects the algorithm to apply."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<num_threads>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (EQUAL(s.c_str(), "ALL_CPUS"))
+                    psOptions->nNumThreads = CPLGetNumCPUs();
+                else
+                    psOptions->nNumThreads = atoi(s.c_str());
+                if (psOptions->nNumThreads < 1)
+                    throw std::invalid_argument(
+                        "Invalid value for -num_threads: " + s);
+            })
+        .help(_("Number of threads to use."));
+
     if (psOptionsForBinary)
     {
         argParser->add_argument("input_file")
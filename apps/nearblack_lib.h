@@ -60,11 +60,16 @@ struct GDALNearblackOptions
 
     bool bFloodFill = false;
 
+    /*! Number of threads. 0 = use GDAL_NUM_THREADS configuration option */
+    int nNumThreads = 0;
+
     Colors oColors{};
 
     CPLStringList aosCreationOptions{};
 };
 
+int GDALNearblackGetNumThreads(const GDALNearblackOptions *psOptions);
+
 bool GDALNearblackTwoPassesAlgorithm(const GDALNearblackOptions *psOptions,
                                      GDALDatasetH hSrcDataset,
                                      GDALDatasetH hDstDS,
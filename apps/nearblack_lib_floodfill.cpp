@@ -27,7 +27,9 @@
  * DEALINGS IN THE SOFTWARE.
  ****************************************************************************/
 
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "nearblack_lib.h"
 
 #include <algorithm>
@@ -585,6 +587,624 @@ bool GDALNearblackFloodFillAlg::Process()
     return LoadLine(-1);
 }
 
+/************************************************************************/
+/*                GDALNearblackConnectedComponentsAlg                   */
+/************************************************************************/
+
+// Multi-threaded alternative to GDALNearblackFloodFillAlg, giving the same
+// result: the pixels that are set are the ones of the 4-connected components
+// of "black" pixels that touch the border of the raster.
+//
+// The raster is processed by strips of lines. In a first pass, the connected
+// components of runs of "black" pixels of several strips are labelled in
+// parallel, and the components that reach the first or last line of a strip
+// are merged with the ones of the neighbouring strips in a global union-find
+// structure. In a second pass, the strips are labelled again, and the pixels
+// of the components that touch the border of the raster are set.
+
+struct GDALNearblackConnectedComponentsAlg
+{
+    // Input arguments of the algorithm
+    const GDALNearblackOptions *m_psOptions = nullptr;
+    GDALDataset *m_poSrcDataset = nullptr;
+    GDALDataset *m_poDstDS = nullptr;
+    GDALRasterBand *m_poMaskBand = nullptr;
+    int m_nSrcBands = 0;
+    int m_nDstBands = 0;
+    bool m_bSetMask = false;
+    Colors m_oColors{};
+    GByte m_nReplacevalue = 0;
+    int m_nThreads = 1;
+
+    // Entry point
+    bool Process();
+
+  private:
+    struct Strip
+    {
+        int nFirstLine = 0;
+        int nLines = 0;
+
+        // Same layout as GDALNearblackFloodFillAlg::m_abyLine, for nLines
+        std::vector<GByte> abyData{};
+
+        // Only used if m_bSetMask
+        std::vector<GByte> abyMask{};
+
+        std::vector<bool> abLineModified{};
+
+        // Runs of "black" pixels are the columns [anRunX1[i], anRunX2[i]]
+        // of their line. Runs of line iLine are the indices in
+        // [anLineFirstRun[iLine], anLineFirstRun[iLine + 1][
+        std::vector<int> anLineFirstRun{};
+        std::vector<int> anRunX1{};
+        std::vector<int> anRunX2{};
+
+        // Union-find forest of the runs
+        std::vector<int> anParent{};
+
+        // Indexed by root runs: whether the connected component touches the
+        // border of the raster
+        std::vector<bool> abTouchesBorder{};
+
+        // Indexed by root runs: index of the connected component among the
+        // ones that reach the first or last line of the strip, or -1
+        std::vector<int> anComponent{};
+        int nComponents = 0;
+
+        // Index of the first component of the strip in the global union-find
+        int nFirstComponent = 0;
+    };
+
+    // Runs of the first or last line of a strip, with the index of their
+    // component in the global union-find
+    struct BoundaryRun
+    {
+        int nX1;
+        int nX2;
+        int nComponent;
+    };
+
+    bool IsBlack(const GByte *pabyPixel) const;
+    void Label(Strip &oStrip) const;
+    bool ReadStrip(Strip &oStrip, bool bReadMask) const;
+    bool WriteStrip(const Strip &oStrip) const;
+};
+
+/************************************************************************/
+/*                        NearblackFindRoot()                           */
+/************************************************************************/
+
+static int NearblackFindRoot(std::vector<int> &anParent, int i)
+{
+    while (anParent[i] != i)
+    {
+        anParent[i] = anParent[anParent[i]];
+        i = anParent[i];
+    }
+    return i;
+}
+
+/************************************************************************/
+/*                          NearblackUnion()                            */
+/************************************************************************/
+
+static void NearblackUnion(std::vector<int> &anParent, int i, int j)
+{
+    i = NearblackFindRoot(anParent, i);
+    j = NearblackFindRoot(anParent, j);
+    // Use the smallest index as the root, so that the result is deterministic
+    if (i < j)
+        anParent[j] = i;
+    else if (j < i)
+        anParent[i] = j;
+}
+
+/************************************************************************/
+/*           GDALNearblackConnectedComponentsAlg::IsBlack()             */
+/************************************************************************/
+
+// Same test as GDALNearblackFloodFillAlg::MustSet()
+bool GDALNearblackConnectedComponentsAlg::IsBlack(const GByte *pabyPixel) const
+{
+    for (const Color &oColor : m_oColors)
+    {
+        bool bIsNonBlack = false;
+
+        for (int iBand = 0; iBand < m_nSrcBands; iBand++)
+        {
+            const int nPix = pabyPixel[iBand];
+
+            if (oColor[iBand] - nPix > m_psOptions->nNearDist ||
+                nPix > m_psOptions->nNearDist + oColor[iBand])
+            {
+                bIsNonBlack = true;
+                break;
+            }
+        }
+
+        if (!bIsNonBlack)
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*            GDALNearblackConnectedComponentsAlg::Label()              */
+/************************************************************************/
+
+// Compute the connected components of the runs of "black" pixels of the
+// strip. The result only depends on the content of the strip.
+void GDALNearblackConnectedComponentsAlg::Label(Strip &oStrip) const
+{
+    const int nXSize = m_poSrcDataset->GetRasterXSize();
+    const int nYSize = m_poSrcDataset->GetRasterYSize();
+
+    oStrip.anLineFirstRun.clear();
+    oStrip.anRunX1.clear();
+    oStrip.anRunX2.clear();
+    oStrip.anParent.clear();
+
+    for (int iLine = 0; iLine < oStrip.nLines; ++iLine)
+    {
+        const GByte *pabyLine = oStrip.abyData.data() +
+                                static_cast<size_t>(iLine) * nXSize *
+                                    m_nDstBands;
+        const int nFirstRun = static_cast<int>(oStrip.anRunX1.size());
+        oStrip.anLineFirstRun.push_back(nFirstRun);
+
+        for (int iX = 0; iX < nXSize;)
+        {
+            if (!IsBlack(pabyLine + static_cast<size_t>(iX) * m_nDstBands))
+            {
+                ++iX;
+                continue;
+            }
+            const int iX1 = iX;
+            ++iX;
+            while (iX < nXSize &&
+                   IsBlack(pabyLine + static_cast<size_t>(iX) * m_nDstBands))
+            {
+                ++iX;
+            }
+            oStrip.anParent.push_back(static_cast<int>(oStrip.anRunX1.size()));
+            oStrip.anRunX1.push_back(iX1);
+            oStrip.anRunX2.push_back(iX - 1);
+        }
+
+        // Merge with the overlapping runs of the previous line
+        if (iLine > 0)
+        {
+            const int nRuns = static_cast<int>(oStrip.anRunX1.size());
+            int iPrev = oStrip.anLineFirstRun[iLine - 1];
+            int iCur = nFirstRun;
+            while (iPrev < nFirstRun && iCur < nRuns)
+            {
+                if (oStrip.anRunX1[iPrev] <= oStrip.anRunX2[iCur] &&
+                    oStrip.anRunX1[iCur] <= oStrip.anRunX2[iPrev])
+                {
+                    NearblackUnion(oStrip.anParent, iPrev, iCur);
+                }
+                if (oStrip.anRunX2[iPrev] < oStrip.anRunX2[iCur])
+                    ++iPrev;
+                else
+                    ++iCur;
+            }
+        }
+    }
+    const int nRuns = static_cast<int>(oStrip.anRunX1.size());
+    oStrip.anLineFirstRun.push_back(nRuns);
+
+    oStrip.abTouchesBorder.assign(nRuns, false);
+    for (int iLine = 0; iLine < oStrip.nLines; ++iLine)
+    {
+        const int iY = oStrip.nFirstLine + iLine;
+        for (int i = oStrip.anLineFirstRun[iLine];
+             i < oStrip.anLineFirstRun[iLine + 1]; ++i)
+        {
+            if (iY == 0 || iY == nYSize - 1 || oStrip.anRunX1[i] == 0 ||
+                oStrip.anRunX2[i] == nXSize - 1)
+            {
+                oStrip.abTouchesBorder[NearblackFindRoot(oStrip.anParent, i)] =
+                    true;
+            }
+        }
+    }
+
+    oStrip.anComponent.assign(nRuns, -1);
+    oStrip.nComponents = 0;
+    for (int iLine : {0, oStrip.nLines - 1})
+    {
+        for (int i = oStrip.anLineFirstRun[iLine];
+             i < oStrip.anLineFirstRun[iLine + 1]; ++i)
+        {
+            const int iRoot = NearblackFindRoot(oStrip.anParent, i);
+            if (oStrip.anComponent[iRoot] < 0)
+                oStrip.anComponent[iRoot] = oStrip.nComponents++;
+        }
+    }
+}
+
+/************************************************************************/
+/*          GDALNearblackConnectedComponentsAlg::ReadStrip()            */
+/************************************************************************/
+
+bool GDALNearblackConnectedComponentsAlg::ReadStrip(Strip &oStrip,
+                                                    bool bReadMask) const
+{
+    const int nXSize = m_poSrcDataset->GetRasterXSize();
+    const GSpacing nLineSpace = static_cast<GSpacing>(nXSize) * m_nDstBands;
+
+    // If nMaxNonBlack > 0, the TwoPasses algorithm has already been run
+    // and has written the whole output dataset and mask band.
+    const bool bReadFromDst = m_psOptions->nMaxNonBlack > 0;
+    if (bReadFromDst)
+    {
+        if (m_poDstDS->RasterIO(GF_Read, 0, oStrip.nFirstLine, nXSize,
+                                oStrip.nLines, oStrip.abyData.data(), nXSize,
+                                oStrip.nLines, GDT_Byte, m_nDstBands, nullptr,
+                                m_nDstBands, nLineSpace, 1,
+                                nullptr) != CE_None)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if (m_poSrcDataset->RasterIO(GF_Read, 0, oStrip.nFirstLine, nXSize,
+                                     oStrip.nLines, oStrip.abyData.data(),
+                                     nXSize, oStrip.nLines, GDT_Byte,
+                                     // m_nSrcBands intended
+                                     m_nSrcBands,
+                                     // m_nDstBands intended
+                                     nullptr, m_nDstBands, nLineSpace, 1,
+                                     nullptr) != CE_None)
+        {
+            return false;
+        }
+
+        if (m_psOptions->bSetAlpha)
+        {
+            const size_t nPixels = static_cast<size_t>(nXSize) * oStrip.nLines;
+            for (size_t i = 0; i < nPixels; i++)
+            {
+                oStrip.abyData[i * m_nDstBands + m_nDstBands - 1] = 255;
+            }
+        }
+    }
+
+    if (m_bSetMask && bReadMask)
+    {
+        if (bReadFromDst)
+        {
+            if (m_poMaskBand->RasterIO(GF_Read, 0, oStrip.nFirstLine, nXSize,
+                                       oStrip.nLines, oStrip.abyMask.data(),
+                                       nXSize, oStrip.nLines, GDT_Byte, 0, 0,
+                                       nullptr) != CE_None)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            std::fill_n(oStrip.abyMask.begin(),
+                        static_cast<size_t>(nXSize) * oStrip.nLines, 255);
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*          GDALNearblackConnectedComponentsAlg::WriteStrip()           */
+/************************************************************************/
+
+bool GDALNearblackConnectedComponentsAlg::WriteStrip(const Strip &oStrip) const
+{
+    const int nXSize = m_poSrcDataset->GetRasterXSize();
+    const GSpacing nLineSpace = static_cast<GSpacing>(nXSize) * m_nDstBands;
+
+    // Same logic as in GDALNearblackFloodFillAlg::LoadLine() to decide which
+    // lines must be written
+    const bool bNotYetWritten = m_psOptions->nMaxNonBlack == 0;
+    const bool bWriteAllData = m_poDstDS != m_poSrcDataset && bNotYetWritten;
+    const bool bWriteAllMask = m_bSetMask && bNotYetWritten;
+
+    const auto MustWriteData = [&oStrip, bWriteAllData](int iLine)
+    { return bWriteAllData || oStrip.abLineModified[iLine]; };
+    const auto MustWriteMask = [this, &oStrip, bWriteAllMask](int iLine)
+    { return m_bSetMask && (bWriteAllMask || oStrip.abLineModified[iLine]); };
+
+    for (int iLine = 0; iLine < oStrip.nLines;)
+    {
+        // Group consecutive lines that must be written in the same way
+        const bool bWriteData = MustWriteData(iLine);
+        const bool bWriteMask = MustWriteMask(iLine);
+        int nLines = 1;
+        while (iLine + nLines < oStrip.nLines &&
+               MustWriteData(iLine + nLines) == bWriteData &&
+               MustWriteMask(iLine + nLines) == bWriteMask)
+        {
+            ++nLines;
+        }
+
+        if (bWriteData &&
+            m_poDstDS->RasterIO(
+                GF_Write, 0, oStrip.nFirstLine + iLine, nXSize, nLines,
+                const_cast<GByte *>(oStrip.abyData.data()) + iLine * nLineSpace,
+                nXSize, nLines, GDT_Byte, m_nDstBands, nullptr, m_nDstBands,
+                nLineSpace, 1, nullptr) != CE_None)
+        {
+            return false;
+        }
+        if (bWriteMask &&
+            m_poMaskBand->RasterIO(
+                GF_Write, 0, oStrip.nFirstLine + iLine, nXSize, nLines,
+                const_cast<GByte *>(oStrip.abyMask.data()) +
+                    static_cast<size_t>(iLine) * nXSize,
+                nXSize, nLines, GDT_Byte, 0, 0, nullptr) != CE_None)
+        {
+            return false;
+        }
+        iLine += nLines;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*           GDALNearblackConnectedComponentsAlg::Process()             */
+/************************************************************************/
+
+// Entry point.
+// Returns true if no error.
+
+bool GDALNearblackConnectedComponentsAlg::Process()
+{
+    const int nXSize = m_poSrcDataset->GetRasterXSize();
+    const int nYSize = m_poSrcDataset->GetRasterYSize();
+
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (m_nThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(m_nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+
+    // Strips are made of whole blocks of the source dataset when possible,
+    // and their size is capped.
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    m_poSrcDataset->GetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    constexpr size_t MAX_STRIP_BYTES = 16 * 1024 * 1024;
+    const size_t nBytesPerLine =
+        static_cast<size_t>(nXSize) * (m_nDstBands + 1);
+    int nStripLines = static_cast<int>(std::min<size_t>(
+        nYSize, std::max<size_t>(1, MAX_STRIP_BYTES / nBytesPerLine)));
+    if (nBlockYSize > 1 && nStripLines > nBlockYSize)
+        nStripLines = nStripLines / nBlockYSize * nBlockYSize;
+    const int nStrips = DIV_ROUND_UP(nYSize, nStripLines);
+
+    // Number of strips processed at once
+    const int nBatchStrips = poJobQueue ? std::min(m_nThreads, nStrips) : 1;
+
+    /* -------------------------------------------------------------------- */
+    /*      Allocate working buffers.                                       */
+    /* -------------------------------------------------------------------- */
+    std::vector<Strip> aoStrips(nBatchStrips);
+    try
+    {
+        for (auto &oStrip : aoStrips)
+        {
+            oStrip.abyData.resize(static_cast<size_t>(nStripLines) * nXSize *
+                                  m_nDstBands);
+            if (m_bSetMask)
+                oStrip.abyMask.resize(static_cast<size_t>(nStripLines) *
+                                      nXSize);
+            oStrip.abLineModified.resize(nStripLines);
+        }
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffers: %s", e.what());
+        return false;
+    }
+
+    // Global union-find of the components that reach the first or last line
+    // of a strip
+    std::vector<int> anGlobalParent;
+    std::vector<bool> abGlobalTouchesBorder;
+    std::vector<int> anStripFirstComponent(nStrips);
+    std::vector<BoundaryRun> asPrevLastLineRuns;
+    std::vector<BoundaryRun> asFirstLineRuns;
+
+    const auto GetBoundaryRuns = [](Strip &oStrip, int iLine,
+                                    std::vector<BoundaryRun> &asRuns)
+    {
+        asRuns.clear();
+        for (int i = oStrip.anLineFirstRun[iLine];
+             i < oStrip.anLineFirstRun[iLine + 1]; ++i)
+        {
+            const int iRoot = NearblackFindRoot(oStrip.anParent, i);
+            asRuns.push_back(
+                BoundaryRun{oStrip.anRunX1[i], oStrip.anRunX2[i],
+                            oStrip.nFirstComponent +
+                                oStrip.anComponent[iRoot]});
+        }
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: label strips and merge their components.            */
+    /* -------------------------------------------------------------------- */
+    for (int iStrip0 = 0; iStrip0 < nStrips; iStrip0 += nBatchStrips)
+    {
+        const int nStripsInBatch = std::min(nBatchStrips, nStrips - iStrip0);
+        for (int j = 0; j < nStripsInBatch; ++j)
+        {
+            Strip &oStrip = aoStrips[j];
+            oStrip.nFirstLine = (iStrip0 + j) * nStripLines;
+            oStrip.nLines = std::min(nStripLines, nYSize - oStrip.nFirstLine);
+            if (!ReadStrip(oStrip, /* bReadMask = */ false))
+                return false;
+        }
+
+        CPLJobQueueRunRanges(poJobQueue.get(), nStripsInBatch, nStripsInBatch,
+                             [this, &aoStrips](int, int iStart, int iEnd)
+                             {
+                                 for (int j = iStart; j < iEnd; ++j)
+                                     Label(aoStrips[j]);
+                             });
+
+        for (int j = 0; j < nStripsInBatch; ++j)
+        {
+            Strip &oStrip = aoStrips[j];
+            oStrip.nFirstComponent = static_cast<int>(anGlobalParent.size());
+            anStripFirstComponent[iStrip0 + j] = oStrip.nFirstComponent;
+            for (int k = 0; k < oStrip.nComponents; ++k)
+            {
+                anGlobalParent.push_back(oStrip.nFirstComponent + k);
+                abGlobalTouchesBorder.push_back(false);
+            }
+            for (size_t i = 0; i < oStrip.anComponent.size(); ++i)
+            {
+                if (oStrip.anComponent[i] >= 0 && oStrip.abTouchesBorder[i])
+                {
+                    abGlobalTouchesBorder[oStrip.nFirstComponent +
+                                          oStrip.anComponent[i]] = true;
+                }
+            }
+
+            // Merge the components of the first line of this strip with
+            // the ones of the last line of the previous strip
+            GetBoundaryRuns(oStrip, 0, asFirstLineRuns);
+            size_t iPrev = 0;
+            size_t iCur = 0;
+            while (iPrev < asPrevLastLineRuns.size() &&
+                   iCur < asFirstLineRuns.size())
+            {
+                const auto &sPrev = asPrevLastLineRuns[iPrev];
+                const auto &sCur = asFirstLineRuns[iCur];
+                if (sPrev.nX1 <= sCur.nX2 && sCur.nX1 <= sPrev.nX2)
+                {
+                    NearblackUnion(anGlobalParent, sPrev.nComponent,
+                                   sCur.nComponent);
+                }
+                if (sPrev.nX2 < sCur.nX2)
+                    ++iPrev;
+                else
+                    ++iCur;
+            }
+            GetBoundaryRuns(oStrip, oStrip.nLines - 1, asPrevLastLineRuns);
+        }
+
+        if (!(m_psOptions->pfnProgress(
+                0.5 * (iStrip0 + nStripsInBatch) / nStrips, nullptr,
+                m_psOptions->pProgressData)))
+        {
+            return false;
+        }
+    }
+
+    // Propagate the border flag to the root of each component, and then back
+    // to all the components
+    const int nGlobalComponents = static_cast<int>(anGlobalParent.size());
+    for (int i = 0; i < nGlobalComponents; ++i)
+    {
+        if (abGlobalTouchesBorder[i])
+            abGlobalTouchesBorder[NearblackFindRoot(anGlobalParent, i)] = true;
+    }
+    for (int i = 0; i < nGlobalComponents; ++i)
+    {
+        abGlobalTouchesBorder[i] =
+            abGlobalTouchesBorder[NearblackFindRoot(anGlobalParent, i)];
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: set the pixels of components touching the border.  */
+    /* -------------------------------------------------------------------- */
+    for (int iStrip0 = 0; iStrip0 < nStrips; iStrip0 += nBatchStrips)
+    {
+        const int nStripsInBatch = std::min(nBatchStrips, nStrips - iStrip0);
+        for (int j = 0; j < nStripsInBatch; ++j)
+        {
+            Strip &oStrip = aoStrips[j];
+            oStrip.nFirstLine = (iStrip0 + j) * nStripLines;
+            oStrip.nLines = std::min(nStripLines, nYSize - oStrip.nFirstLine);
+            oStrip.nFirstComponent = anStripFirstComponent[iStrip0 + j];
+            if (!ReadStrip(oStrip, /* bReadMask = */ true))
+                return false;
+        }
+
+        CPLJobQueueRunRanges(
+            poJobQueue.get(), nStripsInBatch, nStripsInBatch,
+            [this, &aoStrips, &abGlobalTouchesBorder, nXSize](int, int iStart,
+                                                              int iEnd)
+            {
+                for (int j = iStart; j < iEnd; ++j)
+                {
+                    Strip &oStrip = aoStrips[j];
+                    Label(oStrip);
+                    for (int iLine = 0; iLine < oStrip.nLines; ++iLine)
+                    {
+                        const size_t nLineOffset =
+                            static_cast<size_t>(iLine) * nXSize;
+                        GByte *pabyLine =
+                            oStrip.abyData.data() + nLineOffset * m_nDstBands;
+                        oStrip.abLineModified[iLine] = false;
+                        for (int i = oStrip.anLineFirstRun[iLine];
+                             i < oStrip.anLineFirstRun[iLine + 1]; ++i)
+                        {
+                            const int iRoot =
+                                NearblackFindRoot(oStrip.anParent, i);
+                            const bool bSet =
+                                oStrip.anComponent[iRoot] >= 0
+                                    ? abGlobalTouchesBorder
+                                          [oStrip.nFirstComponent +
+                                           oStrip.anComponent[iRoot]]
+                                    : oStrip.abTouchesBorder[iRoot];
+                            if (!bSet)
+                                continue;
+                            oStrip.abLineModified[iLine] = true;
+                            for (int iX = oStrip.anRunX1[i];
+                                 iX <= oStrip.anRunX2[i]; ++iX)
+                            {
+                                GByte *pabyPixel = pabyLine +
+                                                   static_cast<size_t>(iX) *
+                                                       m_nDstBands;
+                                for (int iBand = 0; iBand < m_nSrcBands;
+                                     iBand++)
+                                    pabyPixel[iBand] = m_nReplacevalue;
+
+                                /***** alpha *****/
+                                if (m_nDstBands > m_nSrcBands)
+                                    pabyPixel[m_nDstBands - 1] = 0;
+
+                                if (m_bSetMask)
+                                    oStrip.abyMask[nLineOffset + iX] = 0;
+                            }
+                        }
+                    }
+                }
+            });
+
+        for (int j = 0; j < nStripsInBatch; ++j)
+        {
+            if (!WriteStrip(aoStrips[j]))
+                return false;
+        }
+
+        if (!(m_psOptions->pfnProgress(
+                0.5 + 0.5 * (iStrip0 + nStripsInBatch) / nStrips, nullptr,
+                m_psOptions->pProgressData)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                    GDALNearblackFloodFill()                          */
 /************************************************************************/
@@ -608,6 +1228,30 @@ bool GDALNearblackFloodFill(const GDALNearblackOptions *psOptions,
     alg.m_oColors = oColors;
     alg.m_nReplacevalue = psOptions->bNearWhite ? 255 : 0;
 
+    // In multi-threaded mode, use a connected-components labelling that
+    // processes strips of lines in parallel, instead of the flood fill.
+    const int nThreads = GDALNearblackGetNumThreads(psOptions);
+    const auto RunAlg = [&alg, nThreads](const GDALNearblackOptions *psOpts)
+    {
+        if (nThreads > 1)
+        {
+            GDALNearblackConnectedComponentsAlg ccAlg;
+            ccAlg.m_psOptions = psOpts;
+            ccAlg.m_poSrcDataset = alg.m_poSrcDataset;
+            ccAlg.m_poDstDS = alg.m_poDstDS;
+            ccAlg.m_poMaskBand = alg.m_poMaskBand;
+            ccAlg.m_nSrcBands = alg.m_nSrcBands;
+            ccAlg.m_nDstBands = alg.m_nDstBands;
+            ccAlg.m_bSetMask = alg.m_bSetMask;
+            ccAlg.m_oColors = alg.m_oColors;
+            ccAlg.m_nReplacevalue = alg.m_nReplacevalue;
+            ccAlg.m_nThreads = nThreads;
+            return ccAlg.Process();
+        }
+        alg.m_psOptions = psOpts;
+        return alg.Process();
+    };
+
     if (psOptions->nMaxNonBlack > 0)
     {
         // First pass: use the TwoPasses algorithm to deal with nMaxNonBlack
@@ -626,13 +1270,12 @@ bool GDALNearblackFloodFill(const GDALNearblackOptions *psOptions,
         sOptionsTmp.pProgressData = GDALCreateScaledProgress(
             0.5, 1, psOptions->pfnProgress, psOptions->pProgressData);
         sOptionsTmp.pfnProgress = GDALScaledProgress;
-        alg.m_psOptions = &sOptionsTmp;
-        bRet = alg.Process();
+        bRet = RunAlg(&sOptionsTmp);
         GDALDestroyScaledProgress(sOptionsTmp.pProgressData);
         return bRet;
     }
     else
     {
-        return alg.Process();
+        return RunAlg(psOptions);
     }
 }
@@ -40,9 +40,12 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <unordered_set>
 #include <string>
@@ -52,6 +55,7 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
@@ -60,6 +64,7 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -68,6 +73,7 @@
 #include "ogr_p.h"
 #include "ogr_recordbatch.h"
 #include "ogr_spatialref.h"
+#include "ogr_wkb.h"
 #include "ogrlayerdecorator.h"
 #include "ogrsf_frmts.h"
 
@@ -439,6 +445,11 @@ struct GDALVectorTranslateOptions
     /*! Maximum number of features, or -1 if no limit. */
     GIntBig nLimit = -1;
 
+    /*! Number of threads used to process geometries (reprojection, clipping,
+     * simplification, etc.). Features are still read and written by the
+     * calling thread. */
+    int nThreads = 1;
+
     /*! Wished offset w.r.t UTC of dateTime */
     int nTZOffsetInSec = TZ_OFFSET_INVALID;
 
@@ -579,17 +590,43 @@ class LayerTranslator
     GeomOperation m_eGeomOp = GEOMOP_NONE;
     double m_dfGeomOpParam = 0;
     OGRGeometry *m_poClipSrcOri = nullptr;
-    bool m_bWarnedClipSrcSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS;
-    const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
     OGRGeometry *m_poClipDstOri = nullptr;
-    bool m_bWarnedClipDstSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS;
-    const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
     bool m_bExplodeCollections = false;
     bool m_bNativeData = false;
     GIntBig m_nLimit = -1;
-    OGRGeometryFactory::TransformWithOptionsCache m_transformWithOptionsCache;
+
+    // State modified while processing geometries. With -nt, each worker
+    // thread has its own instance.
+    struct GeomProcessingState
+    {
+        bool m_bWarnedClipSrcSRS = false;
+        std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS{};
+        const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS =
+            nullptr;
+        // Prepared version of the geometry returned by GetSrcClipGeom(),
+        // used to skip features that do not intersect it.
+        const OGRGeometry *m_poClipSrcPreparedGeomSrc = nullptr;
+        OGRPreparedGeometryUniquePtr m_poClipSrcPreparedGeom{};
+        bool m_bWarnedClipDstSRS = false;
+        std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS{};
+        const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS =
+            nullptr;
+        OGRGeometryFactory::TransformWithOptionsCache
+            m_transformWithOptionsCache{};
+        bool m_bRunSetPrecisionEvaluated = false;
+        bool m_bRunSetPrecision = false;
+
+        // Whether m_apoCTClones must be used instead of
+        // TargetLayerInfo::ReprojectionInfo::m_poCT (worker threads).
+        bool m_bUseCTClones = false;
+        std::vector<std::unique_ptr<OGRCoordinateTransformation>>
+            m_apoCTClones{};
+        // Mutex taken when reprojecting the clip geometries, when their
+        // spatial reference systems may be shared with other threads.
+        std::mutex *m_poClipGeomMutex = nullptr;
+    };
+
+    GeomProcessingState m_oState{};
 
     bool Translate(OGRFeature *poFeatureIn, TargetLayerInfo *psInfo,
                    GIntBig nCountLayerFeatures, GIntBig *pnReadFeatureCount,
@@ -598,8 +635,31 @@ class LayerTranslator
                    const GDALVectorTranslateOptions *psOptions);
 
   private:
-    const OGRGeometry *GetDstClipGeom(const OGRSpatialReference *poGeomSRS);
-    const OGRGeometry *GetSrcClipGeom(const OGRSpatialReference *poGeomSRS);
+    enum class GeomProcessingResult
+    {
+        OK,
+        SKIP_FEATURE,
+        FAILURE,
+    };
+
+    GeomProcessingResult ProcessGeometries(
+        GeomProcessingState &oState, TargetLayerInfo *psInfo,
+        const OGRFeatureDefn *poDstFDefn, OGRFeature *poDstFeature,
+        OGRGeometryCollection *poCollToExplode, int iGeomCollToExplode,
+        const double *pdfZ, GIntBig nSrcFID, const char *pszSrcLayerName,
+        const OGRSpatialReference *poOutputSRS,
+        const GDALVectorTranslateOptions *psOptions,
+        bool &bReprojectionFailed) const;
+
+    const OGRGeometry *
+    GetDstClipGeom(GeomProcessingState &oState,
+                   const OGRSpatialReference *poGeomSRS) const;
+    const OGRGeometry *
+    GetSrcClipGeom(GeomProcessingState &oState,
+                   const OGRSpatialReference *poGeomSRS) const;
+
+    struct Pipeline;
+    static void ProcessBatchJob(void *pData);
 };
 
 static OGRLayer *GetLayerAndOverwriteIfNecessary(GDALDataset *poDstDS,
@@ -2814,11 +2874,11 @@ GDALDatasetH GDALVectorTranslate(const char *pszDest, GDALDatasetH hDstDS,
     oTranslator.m_dfGeomOpParam = psOptions->dfGeomOpParam;
     // Do not emit warning if the user specified directly the clip source geom
     if (psOptions->osClipSrcDS.empty())
-        oTranslator.m_bWarnedClipSrcSRS = true;
+        oTranslator.m_oState.m_bWarnedClipSrcSRS = true;
     oTranslator.m_poClipSrcOri = psOptions->poClipSrc.get();
     // Do not emit warning if the user specified directly the clip dest geom
     if (psOptions->osClipDstDS.empty())
-        oTranslator.m_bWarnedClipDstSRS = true;
+        oTranslator.m_oState.m_bWarnedClipDstSRS = true;
     oTranslator.m_poClipDstOri = psOptions->poClipDst.get();
     oTranslator.m_bExplodeCollections = psOptions->bExplodeCollections;
     oTranslator.m_bNativeData = psOptions->bNativeData;
@@ -3857,6 +3917,20 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
     // OGR2OGR_USE_ARROW_API config option is mostly for testing purposes
     // or as a safety belt if things turned bad...
     bool bUseWriteArrowBatch = false;
+
+    // Reprojection can be done on the WKB geometries of the Arrow batches,
+    // provided that the coordinate transformation does not depend on the
+    // features.
+    bool bCanTransform = true;
+    if (psOptions->bTransform && psOptions->osSourceSRSDef.empty())
+    {
+        const OGRFeatureDefn *poSrcFDefn = poSrcLayer->GetLayerDefn();
+        for (int i = 0; i < poSrcFDefn->GetGeomFieldCount(); ++i)
+        {
+            if (!poSrcFDefn->GetGeomFieldDefn(i)->GetSpatialRef())
+                bCanTransform = false;
+        }
+    }
     if (((poSrcLayer->TestCapability(OLCFastGetArrowStream) &&
           // As we don't control the input array size when the input or output
           // drivers are Arrow/Parquet (as they don't use the generic
@@ -3866,8 +3940,8 @@ bool SetupTargetLayer::CanUseWriteArrowBatch(
           !psOptions->aosLCO.FetchNameValue("BATCH_SIZE") &&
           CPLTestBool(CPLGetConfigOption("OGR2OGR_USE_ARROW_API", "YES"))) ||
          CPLTestBool(CPLGetConfigOption("OGR2OGR_USE_ARROW_API", "NO"))) &&
-        !psOptions->bSkipFailures && !psOptions->bTransform &&
-        !psOptions->poClipSrc && !psOptions->poClipDst &&
+        !psOptions->bSkipFailures && bCanTransform && !psOptions->poClipSrc &&
+        !psOptions->poClipDst &&
         psOptions->oGCPs.nGCPCount == 0 && !psOptions->bWrapDateline &&
         !m_papszSelFields && !m_bAddMissingFields &&
         m_eGType == GEOMTYPE_UNCHANGED && psOptions->eGeomOp == GEOMOP_NONE &&
@@ -5578,6 +5652,182 @@ SetupCT(TargetLayerInfo *psInfo, OGRLayer *poSrcLayer, bool bTransform,
     return true;
 }
 
+/************************************************************************/
+/*                   CanTransformWKBCoordinatesOnly()                   */
+/************************************************************************/
+
+// Whether OGRGeometryFactory::transformWithOptions() just transforms the
+// coordinates of geometries with poCT, that is without any special processing
+// for geometries crossing the antimeridian or around the poles.
+static bool CanTransformWKBCoordinatesOnly(OGRCoordinateTransformation *poCT)
+{
+    if (!OGRGeometryFactory::haveGEOS())
+        return true;
+    const auto poSourceCRS = poCT->GetSourceCS();
+    const auto poTargetCRS = poCT->GetTargetCS();
+    return !(poSourceCRS && poTargetCRS && poSourceCRS->IsProjected() &&
+             poTargetCRS->IsGeographic());
+}
+
+/************************************************************************/
+/*                      ReprojectedWKBArrayPrivate                      */
+/************************************************************************/
+
+namespace
+{
+template <class OffsetType> struct ReprojectedWKBArrayPrivate
+{
+    struct ArrowArray sOriArray{};
+    std::vector<OffsetType> anOffsets{};
+    std::vector<GByte> abyData{};
+    const void *apBuffers[3] = {nullptr, nullptr, nullptr};
+};
+}  // namespace
+
+/************************************************************************/
+/*                      ReleaseReprojectedWKBArray()                    */
+/************************************************************************/
+
+template <class OffsetType>
+static void ReleaseReprojectedWKBArray(struct ArrowArray *array)
+{
+    auto psPrivate =
+        static_cast<ReprojectedWKBArrayPrivate<OffsetType> *>(
+            array->private_data);
+    if (psPrivate->sOriArray.release)
+        psPrivate->sOriArray.release(&psPrivate->sOriArray);
+    delete psPrivate;
+    array->private_data = nullptr;
+    array->release = nullptr;
+}
+
+/************************************************************************/
+/*                        ReprojectArrowWKBArray()                      */
+/************************************************************************/
+
+// Replaces, in place, a binary (OffsetType = int32_t) or large binary
+// (OffsetType = int64_t) array of WKB geometries by an array with the
+// reprojected geometries. The original array is released when the new one
+// is released.
+template <class OffsetType>
+static bool ReprojectArrowWKBArray(
+    struct ArrowArray *array, OGRCoordinateTransformation *poCT,
+    bool bTransformCoordinatesOnly, OGRWKBTransformCache &oWKBTransformCache,
+    const OGRGeometryFactory::TransformWithOptionsCache &oTransformCache)
+{
+    if (array->n_buffers != 3)
+        return false;
+    const GByte *pabyValidity = static_cast<const GByte *>(array->buffers[0]);
+    const OffsetType *panOffsets =
+        static_cast<const OffsetType *>(array->buffers[1]) + array->offset;
+    const GByte *pabyData = static_cast<const GByte *>(array->buffers[2]);
+
+    auto psPrivate = std::make_unique<ReprojectedWKBArrayPrivate<OffsetType>>();
+    auto &anOffsets = psPrivate->anOffsets;
+    auto &abyData = psPrivate->abyData;
+    try
+    {
+        // Validity bits are still indexed from array->offset, so keep it,
+        // and make the new offsets start at the same index.
+        anOffsets.resize(
+            static_cast<size_t>(array->offset + array->length + 1));
+        abyData.reserve(
+            std::max<size_t>(1, static_cast<size_t>(panOffsets[array->length] -
+                                                    panOffsets[0])));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in ReprojectArrowWKBArray()");
+        return false;
+    }
+
+    for (int64_t i = 0; i < array->length; ++i)
+    {
+        const int64_t iRow = array->offset + i;
+        const bool bIsNull =
+            pabyValidity && array->null_count != 0 &&
+            (pabyValidity[iRow / 8] & (1 << (iRow % 8))) == 0;
+        const size_t nWKBSize =
+            static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]);
+        if (!bIsNull && nWKBSize > 0)
+        {
+            const GByte *pabyWKB = pabyData + panOffsets[i];
+            const size_t nStart = abyData.size();
+            bool bOK = false;
+            try
+            {
+                if (bTransformCoordinatesOnly)
+                {
+                    abyData.insert(abyData.end(), pabyWKB, pabyWKB + nWKBSize);
+                    bOK = OGRWKBTransform(abyData.data() + nStart, nWKBSize,
+                                          poCT, oWKBTransformCache);
+                    if (!bOK)
+                        abyData.resize(nStart);
+                }
+                if (!bOK)
+                {
+                    // Go through OGRGeometry for geometries that need special
+                    // processing, or whose some points cannot be reprojected
+                    // (which is accepted with OGR_ENABLE_PARTIAL_REPROJECTION)
+                    OGRGeometry *poGeom = nullptr;
+                    if (OGRGeometryFactory::createFromWkb(
+                            pabyWKB, nullptr, &poGeom, nWKBSize,
+                            wkbVariantIso) == OGRERR_NONE)
+                    {
+                        std::unique_ptr<OGRGeometry> poReprojectedGeom(
+                            OGRGeometryFactory::transformWithOptions(
+                                poGeom, poCT, nullptr, oTransformCache));
+                        delete poGeom;
+                        if (poReprojectedGeom)
+                        {
+                            abyData.resize(nStart +
+                                           poReprojectedGeom->WkbSize());
+                            poReprojectedGeom->exportToWkb(
+                                wkbNDR, abyData.data() + nStart,
+                                wkbVariantIso);
+                            bOK = true;
+                        }
+                    }
+                }
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory in ReprojectArrowWKBArray()");
+                return false;
+            }
+            if (!bOK)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Failed to reproject feature of index " CPL_FRMT_GIB
+                         " of batch (geometry probably out of source or "
+                         "destination SRS).",
+                         static_cast<GIntBig>(i));
+                return false;
+            }
+        }
+        if (abyData.size() >
+            static_cast<size_t>(std::numeric_limits<OffsetType>::max()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Too large reprojected geometries in batch");
+            return false;
+        }
+        anOffsets[static_cast<size_t>(iRow + 1)] =
+            static_cast<OffsetType>(abyData.size());
+    }
+
+    psPrivate->sOriArray = *array;
+    psPrivate->apBuffers[0] = pabyValidity;
+    psPrivate->apBuffers[1] = anOffsets.data();
+    psPrivate->apBuffers[2] = abyData.data();
+    array->buffers = psPrivate->apBuffers;
+    array->private_data = psPrivate.release();
+    array->release = ReleaseReprojectedWKBArray<OffsetType>;
+    return true;
+}
+
 /************************************************************************/
 /*                 LayerTranslator::TranslateArrow()                    */
 /************************************************************************/
@@ -5633,6 +5883,64 @@ bool LayerTranslator::TranslateArrow(
         return false;
     }
 
+    // Find the geometry columns to reproject
+    struct ReprojectedColumn
+    {
+        int iChild;
+        OGRCoordinateTransformation *poCT;
+        bool bTransformCoordinatesOnly;
+    };
+
+    std::vector<ReprojectedColumn> aoReprojectedColumns;
+    const auto poSrcFDefn = psInfo->m_poSrcLayer->GetLayerDefn();
+    const auto poDstFDefn = psInfo->m_poDstLayer->GetLayerDefn();
+    for (int iGeom = 0;
+         iGeom < static_cast<int>(psInfo->m_aoReprojectionInfo.size()); ++iGeom)
+    {
+        OGRCoordinateTransformation *poCT =
+            psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
+        if (!poCT)
+            continue;
+        int iSrcGeomField = psInfo->m_iRequestedSrcGeomField;
+        if (iSrcGeomField < 0)
+        {
+            iSrcGeomField = poSrcFDefn->GetGeomFieldIndex(
+                poDstFDefn->GetGeomFieldDefn(iGeom)->GetNameRef());
+            if (iSrcGeomField < 0 && poSrcFDefn->GetGeomFieldCount() == 1)
+                iSrcGeomField = 0;
+        }
+        if (iSrcGeomField < 0)
+            continue;
+        const char *pszName =
+            poSrcFDefn->GetGeomFieldDefn(iSrcGeomField)->GetNameRef();
+        if (pszName[0] == 0)
+            pszName = OGRLayer::DEFAULT_ARROW_GEOMETRY_NAME;
+        int iChild = 0;
+        for (; iChild < static_cast<int>(schema.n_children); ++iChild)
+        {
+            const auto psChildSchema = schema.children[iChild];
+            if (strcmp(psChildSchema->name, pszName) == 0 &&
+                (strcmp(psChildSchema->format, "z") == 0 ||
+                 strcmp(psChildSchema->format, "Z") == 0))
+            {
+                break;
+            }
+        }
+        if (iChild == static_cast<int>(schema.n_children))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot find WKB geometry column %s in Arrow stream",
+                     pszName);
+            schema.release(&schema);
+            stream.release(&stream);
+            return false;
+        }
+        aoReprojectedColumns.push_back(
+            {iChild, poCT, CanTransformWKBCoordinatesOnly(poCT)});
+    }
+    OGRWKBTransformCache oWKBTransformCache;
+    OGRGeometryFactory::TransformWithOptionsCache oTransformCache;
+
     bool bRet = true;
 
     GIntBig nCount = 0;
@@ -5673,6 +5981,30 @@ bool LayerTranslator::TranslateArrow(
             nCount += array.length;
         }
 
+        // Reproject geometries
+        for (const auto &oCol : aoReprojectedColumns)
+        {
+            auto psChild = array.children[oCol.iChild];
+            const bool bOK =
+                schema.children[oCol.iChild]->format[0] == 'z'
+                    ? ReprojectArrowWKBArray<int32_t>(
+                          psChild, oCol.poCT, oCol.bTransformCoordinatesOnly,
+                          oWKBTransformCache, oTransformCache)
+                    : ReprojectArrowWKBArray<int64_t>(
+                          psChild, oCol.poCT, oCol.bTransformCoordinatesOnly,
+                          oWKBTransformCache, oTransformCache);
+            if (!bOK)
+            {
+                bRet = false;
+                break;
+            }
+        }
+        if (!bRet)
+        {
+            array.release(&array);
+            break;
+        }
+
         // Write batch to target layer
         if (!psInfo->m_poDstLayer->WriteArrowBatch(
                 &schema, &array, aosOptionsWriteArrowBatch.List()))
@@ -5750,6 +6082,268 @@ bool LayerTranslator::TranslateArrow(
     return bRet;
 }
 
+/************************************************************************/
+/*                      LayerTranslator::Pipeline                       */
+/************************************************************************/
+
+// Used by Translate() when -nt is specified. Features are still read,
+// translated and written by the calling thread, and in the same order, since
+// layers and datasets are not thread-safe. Only ProcessGeometries() is run by
+// worker threads, on batches of features.
+struct LayerTranslator::Pipeline
+{
+    struct Item
+    {
+        std::unique_ptr<OGRFeature> poDstFeature{};
+        GIntBig nSrcFID = OGRNullFID;
+        GIntBig nDesiredFID = OGRNullFID;
+        bool bHasZ = false;
+        double dfZ = 0;
+        GeomProcessingResult eResult = GeomProcessingResult::OK;
+        bool bReprojectionFailed = false;
+    };
+
+    struct Batch
+    {
+        Pipeline *poPipeline = nullptr;
+        std::unique_ptr<GeomProcessingState> poState{};
+        std::vector<Item> aoItems{};
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        bool bDone = false;  // protected by Pipeline::m_oMutex
+    };
+
+    static constexpr size_t BATCH_SIZE = 256;
+
+    const LayerTranslator *const m_poTranslator;
+    TargetLayerInfo *const m_psInfo;
+    OGRFeatureDefn *const m_poDstFDefn;
+    const char *const m_pszSrcLayerName;
+    const OGRSpatialReference *const m_poOutputSRS;
+    const GDALVectorTranslateOptions *const m_psOptions;
+    const size_t m_nMaxBatchesInFlight;
+
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::mutex m_oClipGeomMutex{};
+
+    // Submitted batches, oldest first
+    std::deque<std::unique_ptr<Batch>> m_apoBatches{};
+    std::unique_ptr<Batch> m_poCurBatch{};
+    std::vector<std::unique_ptr<GeomProcessingState>> m_apoFreeStates{};
+    std::vector<std::unique_ptr<OGRFeature>> m_apoFreeDstFeatures{};
+
+    // Must be the last member, so that it is destroyed first, and thus
+    // waits for pending jobs, before the batches they use are destroyed.
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+
+    Pipeline(const LayerTranslator *poTranslator, TargetLayerInfo *psInfo,
+             OGRFeatureDefn *poDstFDefn, const char *pszSrcLayerName,
+             const OGRSpatialReference *poOutputSRS,
+             const GDALVectorTranslateOptions *psOptions)
+        : m_poTranslator(poTranslator), m_psInfo(psInfo),
+          m_poDstFDefn(poDstFDefn), m_pszSrcLayerName(pszSrcLayerName),
+          m_poOutputSRS(poOutputSRS), m_psOptions(psOptions),
+          m_nMaxBatchesInFlight(2 * static_cast<size_t>(psOptions->nThreads))
+    {
+    }
+
+    bool Init();
+    std::unique_ptr<GeomProcessingState> AcquireState();
+    std::unique_ptr<OGRFeature> AcquireDstFeature();
+    void RecycleDstFeature(std::unique_ptr<OGRFeature> poDstFeature);
+    bool AddFeature(std::unique_ptr<OGRFeature> poDstFeature, GIntBig nSrcFID,
+                    GIntBig nDesiredFID, const double *pdfZ);
+    bool SubmitCurrentBatch();
+    std::unique_ptr<Batch> WaitOldestBatch();
+
+    CPL_DISALLOW_COPY_ASSIGN(Pipeline)
+};
+
+/************************************************************************/
+/*                   LayerTranslator::Pipeline::Init()                  */
+/************************************************************************/
+
+// Returns false if geometry processing cannot be done by worker threads.
+bool LayerTranslator::Pipeline::Init()
+{
+    auto poState = AcquireState();
+    if (!poState)
+    {
+        CPLDebug("OGR2OGR", "Coordinate transformation cannot be cloned. "
+                            "Not using worker threads");
+        return false;
+    }
+    m_apoFreeStates.push_back(std::move(poState));
+
+    CPLWorkerThreadPool *poPool =
+        GDALGetGlobalThreadPool(m_psOptions->nThreads);
+    if (!poPool)
+        return false;
+    m_poJobQueue = poPool->CreateJobQueue();
+    return true;
+}
+
+/************************************************************************/
+/*               LayerTranslator::Pipeline::AcquireState()              */
+/************************************************************************/
+
+std::unique_ptr<LayerTranslator::GeomProcessingState>
+LayerTranslator::Pipeline::AcquireState()
+{
+    if (!m_apoFreeStates.empty())
+    {
+        auto poState = std::move(m_apoFreeStates.back());
+        m_apoFreeStates.pop_back();
+        return poState;
+    }
+
+    auto poState = std::make_unique<GeomProcessingState>();
+    poState->m_bWarnedClipSrcSRS = m_poTranslator->m_oState.m_bWarnedClipSrcSRS;
+    poState->m_bWarnedClipDstSRS = m_poTranslator->m_oState.m_bWarnedClipDstSRS;
+    poState->m_poClipGeomMutex = &m_oClipGeomMutex;
+    poState->m_bUseCTClones = true;
+    for (const auto &oReprojectionInfo : m_psInfo->m_aoReprojectionInfo)
+    {
+        const auto poCT = oReprojectionInfo.m_poCT.get();
+        poState->m_apoCTClones.emplace_back(poCT ? poCT->Clone() : nullptr);
+        if (poCT && !poState->m_apoCTClones.back())
+            return nullptr;
+    }
+    return poState;
+}
+
+/************************************************************************/
+/*             LayerTranslator::Pipeline::AcquireDstFeature()           */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature> LayerTranslator::Pipeline::AcquireDstFeature()
+{
+    if (!m_apoFreeDstFeatures.empty())
+    {
+        auto poDstFeature = std::move(m_apoFreeDstFeatures.back());
+        m_apoFreeDstFeatures.pop_back();
+        return poDstFeature;
+    }
+    return std::make_unique<OGRFeature>(m_poDstFDefn);
+}
+
+/************************************************************************/
+/*             LayerTranslator::Pipeline::RecycleDstFeature()           */
+/************************************************************************/
+
+void LayerTranslator::Pipeline::RecycleDstFeature(
+    std::unique_ptr<OGRFeature> poDstFeature)
+{
+    // When m_bCanAvoidSetFrom is set, destination features are the source
+    // features, and are allocated by the source layer.
+    if (poDstFeature && !m_psInfo->m_bCanAvoidSetFrom &&
+        m_apoFreeDstFeatures.size() < m_nMaxBatchesInFlight * BATCH_SIZE)
+    {
+        m_apoFreeDstFeatures.push_back(std::move(poDstFeature));
+    }
+}
+
+/************************************************************************/
+/*                LayerTranslator::Pipeline::AddFeature()               */
+/************************************************************************/
+
+bool LayerTranslator::Pipeline::AddFeature(
+    std::unique_ptr<OGRFeature> poDstFeature, GIntBig nSrcFID,
+    GIntBig nDesiredFID, const double *pdfZ)
+{
+    if (!m_poCurBatch)
+    {
+        m_poCurBatch = std::make_unique<Batch>();
+        m_poCurBatch->poPipeline = this;
+        m_poCurBatch->aoItems.reserve(BATCH_SIZE);
+    }
+    m_poCurBatch->aoItems.emplace_back();
+    auto &oItem = m_poCurBatch->aoItems.back();
+    oItem.poDstFeature = std::move(poDstFeature);
+    oItem.nSrcFID = nSrcFID;
+    oItem.nDesiredFID = nDesiredFID;
+    if (pdfZ)
+    {
+        oItem.bHasZ = true;
+        oItem.dfZ = *pdfZ;
+    }
+    if (m_poCurBatch->aoItems.size() == BATCH_SIZE)
+        return SubmitCurrentBatch();
+    return true;
+}
+
+/************************************************************************/
+/*            LayerTranslator::Pipeline::SubmitCurrentBatch()           */
+/************************************************************************/
+
+bool LayerTranslator::Pipeline::SubmitCurrentBatch()
+{
+    if (!m_poCurBatch)
+        return true;
+    m_poCurBatch->poState = AcquireState();
+    if (!m_poCurBatch->poState)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot clone coordinate transformation");
+        return false;
+    }
+    Batch *poBatch = m_poCurBatch.get();
+    m_apoBatches.push_back(std::move(m_poCurBatch));
+    if (!m_poJobQueue->SubmitJob(LayerTranslator::ProcessBatchJob, poBatch))
+    {
+        m_apoBatches.pop_back();
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*             LayerTranslator::Pipeline::WaitOldestBatch()             */
+/************************************************************************/
+
+std::unique_ptr<LayerTranslator::Pipeline::Batch>
+LayerTranslator::Pipeline::WaitOldestBatch()
+{
+    auto poBatch = std::move(m_apoBatches.front());
+    m_apoBatches.pop_front();
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    m_oCV.wait(oLock, [&poBatch] { return poBatch->bDone; });
+    return poBatch;
+}
+
+/************************************************************************/
+/*                  LayerTranslator::ProcessBatchJob()                  */
+/************************************************************************/
+
+void LayerTranslator::ProcessBatchJob(void *pData)
+{
+    auto poBatch = static_cast<Pipeline::Batch *>(pData);
+    Pipeline *poPipeline = poBatch->poPipeline;
+
+    // Errors are emitted again by the calling thread, when it writes the
+    // features of the batch.
+    CPLInstallErrorHandlerAccumulator(poBatch->aoErrors);
+
+    for (auto &oItem : poBatch->aoItems)
+    {
+        oItem.eResult = poPipeline->m_poTranslator->ProcessGeometries(
+            *(poBatch->poState), poPipeline->m_psInfo, poPipeline->m_poDstFDefn,
+            oItem.poDstFeature.get(), nullptr, -1,
+            oItem.bHasZ ? &oItem.dfZ : nullptr, oItem.nSrcFID,
+            poPipeline->m_pszSrcLayerName, poPipeline->m_poOutputSRS,
+            poPipeline->m_psOptions, oItem.bReprojectionFailed);
+        // The translation will stop at this feature
+        if (oItem.eResult == GeomProcessingResult::FAILURE)
+            break;
+    }
+
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poPipeline->m_oMutex);
+    poBatch->bDone = true;
+    poPipeline->m_oCV.notify_all();
+}
+
 /************************************************************************/
 /*                     LayerTranslator::Translate()                     */
 /************************************************************************/
@@ -5760,13 +6354,6 @@ bool LayerTranslator::Translate(
     GIntBig &nTotalEventsDone, GDALProgressFunc pfnProgress, void *pProgressArg,
     const GDALVectorTranslateOptions *psOptions)
 {
-    if (psInfo->m_bUseWriteArrowBatch)
-    {
-        return TranslateArrow(psInfo, nCountLayerFeatures, pnReadFeatureCount,
-                              pfnProgress, pProgressArg, psOptions);
-    }
-
-    const int eGType = m_eGType;
     const OGRSpatialReference *poOutputSRS = m_poOutputSRS;
 
     OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
@@ -5796,6 +6383,19 @@ bool LayerTranslator::Translate(
         }
     }
 
+    if (psInfo->m_bUseWriteArrowBatch)
+    {
+        if (m_bTransform &&
+            !SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                     m_osDateLineOffset, m_poUserSourceSRS, nullptr,
+                     poOutputSRS, m_poGCPCoordTrans, true))
+        {
+            return false;
+        }
+        return TranslateArrow(psInfo, nCountLayerFeatures, pnReadFeatureCount,
+                              pfnProgress, pProgressArg, psOptions);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Transfer features.                                              */
     /* -------------------------------------------------------------------- */
@@ -5816,60 +6416,214 @@ bool LayerTranslator::Translate(
     int nFeaturesInTransaction = 0;
     GIntBig nCount = 0; /* written + failed */
     GIntBig nFeaturesWritten = 0;
-    bool bRunSetPrecisionEvaluated = false;
-    bool bRunSetPrecision = false;
 
     bool bRet = true;
+    bool bInterrupted = false;
     CPLErrorReset();
 
-    bool bSetupCTOK = false;
-    if (m_bTransform && psInfo->m_nFeaturesRead == 0 &&
-        !psInfo->m_bPerFeatureCT)
-    {
-        bSetupCTOK = SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
-                             m_osDateLineOffset, m_poUserSourceSRS, nullptr,
-                             poOutputSRS, m_poGCPCoordTrans, false);
-    }
-
-    while (true)
+    const auto CommitTransactionIfNeeded = [&]()
     {
-        if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
-        {
-            break;
-        }
-
-        if (poFeatureIn != nullptr)
-            poFeature.reset(poFeatureIn);
-        else if (psOptions->nFIDToFetch != OGRNullFID)
-            poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
-        else
-            poFeature.reset(poSrcLayer->GetNextFeature());
-
-        if (poFeature == nullptr)
+        if (psOptions->nLayerTransaction &&
+            ++nFeaturesInTransaction == psOptions->nGroupTransactions)
         {
-            if (CPLGetLastErrorType() == CE_Failure)
+            if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+                poDstLayer->StartTransaction() == OGRERR_FAILURE)
             {
-                bRet = false;
+                return false;
             }
-            break;
+            nFeaturesInTransaction = 0;
         }
-
-        if (!bSetupCTOK &&
-            (psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT))
+        else if (!psOptions->nLayerTransaction &&
+                 psOptions->nGroupTransactions > 0 &&
+                 ++nTotalEventsDone >= psOptions->nGroupTransactions)
         {
-            if (!SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
-                         m_osDateLineOffset, m_poUserSourceSRS, poFeature.get(),
-                         poOutputSRS, m_poGCPCoordTrans, true))
+            if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+                m_poODS->StartTransaction(psOptions->bForceTransaction) ==
+                    OGRERR_FAILURE)
             {
                 return false;
             }
+            nTotalEventsDone = 0;
         }
+        return true;
+    };
 
-        psInfo->m_nFeaturesRead++;
-
-        int nIters = 1;
-        std::unique_ptr<OGRGeometryCollection> poCollToExplode;
-        int iGeomCollToExplode = -1;
+    const auto CommitTransactionAfterReprojectionFailure = [&]()
+    {
+        if (psOptions->nGroupTransactions)
+        {
+            if (psOptions->nLayerTransaction)
+            {
+                if (poDstLayer->CommitTransaction() != OGRERR_NONE &&
+                    !psOptions->bSkipFailures)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    const auto WriteFeature =
+        [&](OGRFeature *poFeatureToWrite, GIntBig nSrcFID, GIntBig nDesiredFID)
+    {
+        CPLErrorReset();
+        if ((psOptions->bUpsert
+                 ? poDstLayer->UpsertFeature(poFeatureToWrite)
+                 : poDstLayer->CreateFeature(poFeatureToWrite)) == OGRERR_NONE)
+        {
+            nFeaturesWritten++;
+            if (nDesiredFID != OGRNullFID &&
+                poFeatureToWrite->GetFID() != nDesiredFID)
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Feature id " CPL_FRMT_GIB " not preserved",
+                         nDesiredFID);
+            }
+        }
+        else if (!psOptions->bSkipFailures)
+        {
+            if (psOptions->nGroupTransactions)
+            {
+                if (psOptions->nLayerTransaction)
+                    poDstLayer->RollbackTransaction();
+            }
+
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unable to write feature " CPL_FRMT_GIB " from layer %s.",
+                     nSrcFID, poSrcLayer->GetName());
+
+            return false;
+        }
+        else
+        {
+            CPLDebug("GDALVectorTranslate",
+                     "Unable to write feature " CPL_FRMT_GIB " into layer %s.",
+                     nSrcFID, poSrcLayer->GetName());
+            if (psOptions->nGroupTransactions)
+            {
+                if (psOptions->nLayerTransaction)
+                {
+                    poDstLayer->RollbackTransaction();
+                    CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
+                }
+                else
+                {
+                    m_poODS->RollbackTransaction();
+                    m_poODS->StartTransaction(psOptions->bForceTransaction);
+                }
+            }
+        }
+        return true;
+    };
+
+    // With -nt, geometries are processed by worker threads, in batches.
+    std::unique_ptr<Pipeline> poPipeline;
+    bool bTryPipeline = psOptions->nThreads > 1 && poFeatureIn == nullptr &&
+                        psOptions->nFIDToFetch == OGRNullFID &&
+                        !bExplodeCollections && nDstGeomFieldCount > 0;
+
+    // Writes the features of the oldest batches, until there are less than
+    // Pipeline::m_nMaxBatchesInFlight pending ones (or none if bAll is set).
+    const auto DrainPipeline = [&](bool bAll)
+    {
+        while (!poPipeline->m_apoBatches.empty() &&
+               (bAll || poPipeline->m_apoBatches.size() >=
+                            poPipeline->m_nMaxBatchesInFlight))
+        {
+            auto poBatch = poPipeline->WaitOldestBatch();
+            for (const auto &oError : poBatch->aoErrors)
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            for (auto &oItem : poBatch->aoItems)
+            {
+                if (!CommitTransactionIfNeeded())
+                    return false;
+                if (oItem.bReprojectionFailed &&
+                    !CommitTransactionAfterReprojectionFailure())
+                {
+                    return false;
+                }
+                if (oItem.eResult == GeomProcessingResult::FAILURE)
+                    return false;
+                if (oItem.eResult == GeomProcessingResult::OK &&
+                    !WriteFeature(oItem.poDstFeature.get(), oItem.nSrcFID,
+                                  oItem.nDesiredFID))
+                {
+                    return false;
+                }
+                poPipeline->RecycleDstFeature(std::move(oItem.poDstFeature));
+            }
+            poPipeline->m_apoFreeStates.push_back(std::move(poBatch->poState));
+        }
+        return true;
+    };
+
+    bool bSetupCTOK = false;
+    if (m_bTransform && psInfo->m_nFeaturesRead == 0 &&
+        !psInfo->m_bPerFeatureCT)
+    {
+        bSetupCTOK = SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                             m_osDateLineOffset, m_poUserSourceSRS, nullptr,
+                             poOutputSRS, m_poGCPCoordTrans, false);
+    }
+
+    while (true)
+    {
+        if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
+        {
+            break;
+        }
+
+        if (poFeatureIn != nullptr)
+            poFeature.reset(poFeatureIn);
+        else if (psOptions->nFIDToFetch != OGRNullFID)
+            poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
+        else
+            poFeature.reset(poSrcLayer->GetNextFeature());
+
+        if (poFeature == nullptr)
+        {
+            if (CPLGetLastErrorType() == CE_Failure)
+            {
+                bRet = false;
+            }
+            break;
+        }
+
+        if (!bSetupCTOK &&
+            (psInfo->m_nFeaturesRead == 0 || psInfo->m_bPerFeatureCT))
+        {
+            if (!SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
+                         m_osDateLineOffset, m_poUserSourceSRS, poFeature.get(),
+                         poOutputSRS, m_poGCPCoordTrans, true))
+            {
+                return false;
+            }
+        }
+
+        if (bTryPipeline)
+        {
+            bTryPipeline = false;
+            if (psInfo->m_bPerFeatureCT)
+            {
+                CPLDebug("OGR2OGR", "Per-feature coordinate transformation "
+                                    "needed. Not using worker threads");
+            }
+            else
+            {
+                poPipeline = std::make_unique<Pipeline>(
+                    this, psInfo, poDstFDefn, poSrcLayer->GetName(),
+                    poOutputSRS, psOptions);
+                if (!poPipeline->Init())
+                    poPipeline.reset();
+            }
+        }
+
+        psInfo->m_nFeaturesRead++;
+
+        int nIters = 1;
+        std::unique_ptr<OGRGeometryCollection> poCollToExplode;
+        int iGeomCollToExplode = -1;
         if (bExplodeCollections)
         {
             OGRGeometry *poSrcGeometry;
@@ -5908,30 +6662,13 @@ bool LayerTranslator::Translate(
 
         for (int iPart = 0; iPart < nIters; iPart++)
         {
-            if (psOptions->nLayerTransaction &&
-                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
-            {
-                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
-                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nFeaturesInTransaction = 0;
-            }
-            else if (!psOptions->nLayerTransaction &&
-                     psOptions->nGroupTransactions > 0 &&
-                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
-            {
-                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
-                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
-                        OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nTotalEventsDone = 0;
-            }
+            // With the pipeline, this is done when writing the feature
+            if (!poPipeline && !CommitTransactionIfNeeded())
+                return false;
 
             CPLErrorReset();
+            if (poPipeline && !psInfo->m_bCanAvoidSetFrom && !poDstFeature)
+                poDstFeature = poPipeline->AcquireDstFeature();
             if (psInfo->m_bCanAvoidSetFrom)
             {
                 poDstFeature = std::move(poFeature);
@@ -5962,7 +6699,8 @@ bool LayerTranslator::Translate(
                     m_poClipSrcOri)
                 {
                     const OGRGeometry *poClipGeom =
-                        GetSrcClipGeom(poStolenGeometry->getSpatialReference());
+                        GetSrcClipGeom(m_oState,
+                                       poStolenGeometry->getSpatialReference());
 
                     if (poClipGeom != nullptr &&
                         !poClipGeom->Intersects(poStolenGeometry.get()))
@@ -6094,468 +6832,479 @@ bool LayerTranslator::Translate(
                 poDstFeature->SetNativeMediaType(nullptr);
             }
 
-            for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
             {
-                std::unique_ptr<OGRGeometry> poDstGeometry;
-
-                if (poCollToExplode && iGeom == iGeomCollToExplode)
-                {
-                    OGRGeometry *poPart = poCollToExplode->getGeometryRef(0);
-                    poCollToExplode->removeGeometry(0, FALSE);
-                    poDstGeometry.reset(poPart);
-                }
-                else
-                {
-                    poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
-                }
-                if (poDstGeometry == nullptr)
-                    continue;
-
                 // poFeature hasn't been moved if iSrcZField != -1
                 // cppcheck-suppress accessMoved
-                if (iSrcZField != -1 && poFeature != nullptr)
-                {
-                    SetZ(poDstGeometry.get(),
-                         poFeature->GetFieldAsDouble(iSrcZField));
-                    /* This will correct the coordinate dimension to 3 */
-                    poDstGeometry.reset(poDstGeometry->clone());
-                }
+                const bool bHasZ = iSrcZField != -1 && poFeature != nullptr;
+                const double dfZ =
+                    bHasZ ? poFeature->GetFieldAsDouble(iSrcZField) : 0.0;
 
-                if (m_nCoordDim == 2 || m_nCoordDim == 3)
+                if (poPipeline)
                 {
-                    poDstGeometry->setCoordinateDimension(m_nCoordDim);
-                }
-                else if (m_nCoordDim == 4)
-                {
-                    poDstGeometry->set3D(TRUE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_XYM)
-                {
-                    poDstGeometry->set3D(FALSE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
-                {
-                    const OGRwkbGeometryType eDstLayerGeomType =
-                        poDstLayer->GetLayerDefn()
-                            ->GetGeomFieldDefn(iGeom)
-                            ->GetType();
-                    poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
-                    poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+                    if (!poPipeline->AddFeature(std::move(poDstFeature),
+                                                nSrcFID, nDesiredFID,
+                                                bHasZ ? &dfZ : nullptr) ||
+                        !DrainPipeline(false))
+                    {
+                        return false;
+                    }
+                    continue;
                 }
 
-                if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+                bool bReprojectionFailed = false;
+                const auto eResult = ProcessGeometries(
+                    m_oState, psInfo, poDstFDefn, poDstFeature.get(),
+                    poCollToExplode.get(), iGeomCollToExplode,
+                    bHasZ ? &dfZ : nullptr, nSrcFID, poSrcLayer->GetName(),
+                    poOutputSRS, psOptions, bReprojectionFailed);
+                if (bReprojectionFailed &&
+                    !CommitTransactionAfterReprojectionFailure())
                 {
-                    if (m_dfGeomOpParam > 0)
-                        poDstGeometry->segmentize(m_dfGeomOpParam);
+                    return false;
                 }
-                else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+                if (eResult == GeomProcessingResult::FAILURE)
+                    return false;
+                if (eResult == GeomProcessingResult::OK &&
+                    !WriteFeature(poDstFeature.get(), nSrcFID, nDesiredFID))
                 {
-                    if (m_dfGeomOpParam > 0)
-                    {
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->SimplifyPreserveTopology(
-                                m_dfGeomOpParam));
-                        if (poNewGeom)
-                        {
-                            poDstGeometry = std::move(poNewGeom);
-                        }
-                    }
+                    return false;
                 }
+            }
 
-                if (m_poClipSrcOri)
-                {
-
-                    const OGRGeometry *poClipGeom =
-                        GetSrcClipGeom(poDstGeometry->getSpatialReference());
-
-                    std::unique_ptr<OGRGeometry> poClipped;
-                    if (poClipGeom != nullptr)
-                    {
-                        OGREnvelope oClipEnv;
-                        OGREnvelope oDstEnv;
-
-                        poClipGeom->getEnvelope(&oClipEnv);
-                        poDstGeometry->getEnvelope(&oDstEnv);
+        end_loop:;  // nothing
+        }
 
-                        if (oClipEnv.Intersects(oDstEnv))
-                        {
-                            poClipped.reset(
-                                poClipGeom->Intersection(poDstGeometry.get()));
-                        }
-                    }
+        /* Report progress */
+        nCount++;
+        bool bGoOn = true;
+        if (pfnProgress)
+        {
+            bGoOn = pfnProgress(nCountLayerFeatures
+                                    ? nCount * 1.0 / nCountLayerFeatures
+                                    : 1.0,
+                                "", pProgressArg) != FALSE;
+        }
+        if (!bGoOn)
+        {
+            bRet = false;
+            bInterrupted = true;
+            break;
+        }
 
-                    if (poClipped == nullptr || poClipped->IsEmpty())
-                    {
-                        goto end_loop;
-                    }
+        if (pnReadFeatureCount)
+            *pnReadFeatureCount = nCount;
 
-                    const int nDim = poDstGeometry->getDimension();
-                    if (poClipped->getDimension() < nDim &&
-                        wkbFlatten(
-                            poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
-                            wkbUnknown)
-                    {
-                        CPLDebug(
-                            "OGR2OGR",
-                            "Discarding feature " CPL_FRMT_GIB " of layer %s, "
-                            "as its intersection with -clipsrc is a %s "
-                            "whereas the input is a %s",
-                            nSrcFID, poSrcLayer->GetName(),
-                            OGRToOGCGeomType(poClipped->getGeometryType()),
-                            OGRToOGCGeomType(poDstGeometry->getGeometryType()));
-                        goto end_loop;
-                    }
+        if (psOptions->nFIDToFetch != OGRNullFID)
+            break;
+        if (poFeatureIn != nullptr)
+            break;
+    }
 
-                    poDstGeometry = std::move(poClipped);
-                }
-
-                OGRCoordinateTransformation *const poCT =
-                    psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
-                char **const papszTransformOptions =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_aosTransformOptions.List();
-                const bool bReprojCanInvalidateValidity =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_bCanInvalidateValidity;
-
-                if (poCT != nullptr || papszTransformOptions != nullptr)
-                {
-                    // If we need to change the geometry type to linear, and
-                    // we have a geometry with curves, then convert it to
-                    // linear first, to avoid invalidities due to the fact
-                    // that validity of arc portions isn't always kept while
-                    // reprojecting and then discretizing.
-                    if (bReprojCanInvalidateValidity &&
-                        (!psInfo->m_bSupportCurves ||
-                         m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
-                         m_eGeomTypeConversion ==
-                             GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
-                    {
-                        if (poDstGeometry->hasCurveGeometry(TRUE))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                poDstGeometry.release(), eTargetType));
-                        }
-                    }
-                    else if (bReprojCanInvalidateValidity &&
-                             eGType != GEOMTYPE_UNCHANGED &&
-                             !OGR_GT_IsNonLinear(
-                                 static_cast<OGRwkbGeometryType>(eGType)) &&
-                             poDstGeometry->hasCurveGeometry(TRUE))
-                    {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
-                    }
+    if (poPipeline && !bInterrupted)
+    {
+        if (!poPipeline->SubmitCurrentBatch() || !DrainPipeline(true))
+            return false;
+    }
 
-                    for (int iIter = 0; iIter < 2; ++iIter)
-                    {
-                        auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
-                            OGRGeometryFactory::transformWithOptions(
-                                poDstGeometry.get(), poCT,
-                                papszTransformOptions,
-                                m_transformWithOptionsCache));
-                        if (poReprojectedGeom == nullptr)
-                        {
-                            if (psOptions->nGroupTransactions)
-                            {
-                                if (psOptions->nLayerTransaction)
-                                {
-                                    if (poDstLayer->CommitTransaction() !=
-                                            OGRERR_NONE &&
-                                        !psOptions->bSkipFailures)
-                                    {
-                                        return false;
-                                    }
-                                }
-                            }
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+                bRet = false;
+        }
+    }
 
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Failed to reproject feature " CPL_FRMT_GIB
-                                     " (geometry probably out of source or "
-                                     "destination SRS).",
-                                     nSrcFID);
-                            if (!psOptions->bSkipFailures)
-                            {
-                                return false;
-                            }
-                        }
+    if (poFeatureIn == nullptr)
+    {
+        CPLDebug("GDALVectorTranslate",
+                 CPL_FRMT_GIB " features written in layer '%s'",
+                 nFeaturesWritten, poDstLayer->GetName());
+    }
 
-                        // Check if a curve geometry is no longer valid after
-                        // reprojection
-                        const auto eType = poDstGeometry->getGeometryType();
-                        const auto eFlatType = wkbFlatten(eType);
+    return bRet;
+}
 
-                        const auto IsValid = [](const OGRGeometry *poGeom)
-                        {
-                            CPLErrorHandlerPusher oErrorHandler(
-                                CPLQuietErrorHandler);
-                            return poGeom->IsValid();
-                        };
-
-                        if (iIter == 0 && bReprojCanInvalidateValidity &&
-                            OGRGeometryFactory::haveGEOS() &&
-                            (eFlatType == wkbCurvePolygon ||
-                             eFlatType == wkbCompoundCurve ||
-                             eFlatType == wkbMultiCurve ||
-                             eFlatType == wkbMultiSurface) &&
-                            poDstGeometry->hasCurveGeometry(TRUE) &&
-                            IsValid(poDstGeometry.get()))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            auto poDstGeometryTmp =
-                                std::unique_ptr<OGRGeometry>(
-                                    OGRGeometryFactory::forceTo(
-                                        poReprojectedGeom->clone(),
-                                        eTargetType));
-                            if (!IsValid(poDstGeometryTmp.get()))
-                            {
-                                CPLDebug("OGR2OGR",
-                                         "Curve geometry no longer valid after "
-                                         "reprojection: transforming it into "
-                                         "linear one before reprojecting");
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eTargetType));
-                                poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                                    poDstGeometry.release(), eType));
-                            }
-                            else
-                            {
-                                poDstGeometry = std::move(poReprojectedGeom);
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            poDstGeometry = std::move(poReprojectedGeom);
-                            break;
-                        }
-                    }
-                }
-                else if (poOutputSRS != nullptr)
-                {
-                    poDstGeometry->assignSpatialReference(poOutputSRS);
-                }
+/************************************************************************/
+/*                  LayerTranslator::ProcessGeometries()                */
+/************************************************************************/
 
-                if (poDstGeometry != nullptr)
-                {
-                    if (m_poClipDstOri)
-                    {
-                        const OGRGeometry *poClipGeom = GetDstClipGeom(
-                            poDstGeometry->getSpatialReference());
-                        if (poClipGeom == nullptr)
-                        {
-                            goto end_loop;
-                        }
+// Applies the geometry operations (coordinate dimension, segmentize/simplify,
+// clipping, reprojection, makevalid, type conversion, ...) to the geometries
+// of poDstFeature. Only oState is modified, so that this may be called from
+// several threads at once, with a different oState for each of them.
+LayerTranslator::GeomProcessingResult LayerTranslator::ProcessGeometries(
+    GeomProcessingState &oState, TargetLayerInfo *psInfo,
+    const OGRFeatureDefn *poDstFDefn, OGRFeature *poDstFeature,
+    OGRGeometryCollection *poCollToExplode, int iGeomCollToExplode,
+    const double *pdfZ, GIntBig nSrcFID, const char *pszSrcLayerName,
+    const OGRSpatialReference *poOutputSRS,
+    const GDALVectorTranslateOptions *psOptions,
+    bool &bReprojectionFailed) const
+{
+    const int eGType = m_eGType;
+    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
 
-                        std::unique_ptr<OGRGeometry> poClipped;
+    for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
+    {
+        std::unique_ptr<OGRGeometry> poDstGeometry;
 
-                        OGREnvelope oClipEnv;
-                        OGREnvelope oDstEnv;
+        if (poCollToExplode && iGeom == iGeomCollToExplode)
+        {
+            OGRGeometry *poPart = poCollToExplode->getGeometryRef(0);
+            poCollToExplode->removeGeometry(0, FALSE);
+            poDstGeometry.reset(poPart);
+        }
+        else
+        {
+            poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
+        }
+        if (poDstGeometry == nullptr)
+            continue;
 
-                        poClipGeom->getEnvelope(&oClipEnv);
-                        poDstGeometry->getEnvelope(&oDstEnv);
+        if (pdfZ)
+        {
+            SetZ(poDstGeometry.get(), *pdfZ);
+            /* This will correct the coordinate dimension to 3 */
+            poDstGeometry.reset(poDstGeometry->clone());
+        }
 
-                        if (oClipEnv.Intersects(oDstEnv))
-                        {
-                            poClipped.reset(
-                                poClipGeom->Intersection(poDstGeometry.get()));
-                        }
+        if (m_nCoordDim == 2 || m_nCoordDim == 3)
+        {
+            poDstGeometry->setCoordinateDimension(m_nCoordDim);
+        }
+        else if (m_nCoordDim == 4)
+        {
+            poDstGeometry->set3D(TRUE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_XYM)
+        {
+            poDstGeometry->set3D(FALSE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+        {
+            const OGRwkbGeometryType eDstLayerGeomType =
+                poDstFDefn->GetGeomFieldDefn(iGeom)->GetType();
+            poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
+            poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+        }
 
-                        if (poClipped == nullptr || poClipped->IsEmpty())
-                        {
-                            goto end_loop;
-                        }
+        if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+        {
+            if (m_dfGeomOpParam > 0)
+                poDstGeometry->segmentize(m_dfGeomOpParam);
+        }
+        else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+        {
+            if (m_dfGeomOpParam > 0)
+            {
+                auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                    poDstGeometry->SimplifyPreserveTopology(m_dfGeomOpParam));
+                if (poNewGeom)
+                {
+                    poDstGeometry = std::move(poNewGeom);
+                }
+            }
+        }
 
-                        const int nDim = poDstGeometry->getDimension();
-                        if (poClipped->getDimension() < nDim &&
-                            wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
-                                           ->GetType()) != wkbUnknown)
-                        {
-                            CPLDebug(
-                                "OGR2OGR",
-                                "Discarding feature " CPL_FRMT_GIB
-                                " of layer %s, "
-                                "as its intersection with -clipdst is a %s "
-                                "whereas the input is a %s",
-                                nSrcFID, poSrcLayer->GetName(),
-                                OGRToOGCGeomType(poClipped->getGeometryType()),
-                                OGRToOGCGeomType(
-                                    poDstGeometry->getGeometryType()));
-                            goto end_loop;
-                        }
+        if (m_poClipSrcOri)
+        {
 
-                        poDstGeometry = std::move(poClipped);
-                    }
+            const OGRGeometry *poClipGeom =
+                GetSrcClipGeom(oState, poDstGeometry->getSpatialReference());
 
-                    if (psOptions->dfXYRes !=
-                            OGRGeomCoordinatePrecision::UNKNOWN &&
-                        OGRGeometryFactory::haveGEOS() &&
-                        !poDstGeometry->hasCurveGeometry())
-                    {
-                        // OGR_APPLY_GEOM_SET_PRECISION default value for
-                        // OGRLayer::CreateFeature() purposes, but here in the
-                        // ogr2ogr -xyRes context, we force calling SetPrecision(),
-                        // unless the user explicitly asks not to do it by
-                        // setting the config option to NO.
-                        if (!bRunSetPrecisionEvaluated)
-                        {
-                            bRunSetPrecisionEvaluated = true;
-                            bRunSetPrecision = CPLTestBool(CPLGetConfigOption(
-                                "OGR_APPLY_GEOM_SET_PRECISION", "YES"));
-                        }
-                        if (bRunSetPrecision)
-                        {
-                            auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                                poDstGeometry->SetPrecision(psOptions->dfXYRes,
-                                                            /* nFlags = */ 0));
-                            if (!poNewGeom)
-                                goto end_loop;
-                            poDstGeometry = std::move(poNewGeom);
-                        }
-                    }
+            std::unique_ptr<OGRGeometry> poClipped;
+            if (poClipGeom != nullptr)
+            {
+                OGREnvelope oClipEnv;
+                OGREnvelope oDstEnv;
 
-                    if (m_bMakeValid)
-                    {
-                        const bool bIsGeomCollection =
-                            wkbFlatten(poDstGeometry->getGeometryType()) ==
-                            wkbGeometryCollection;
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->MakeValid());
-                        if (!poNewGeom)
-                            goto end_loop;
-                        poDstGeometry = std::move(poNewGeom);
-                        if (!bIsGeomCollection)
-                        {
-                            poDstGeometry.reset(
-                                OGRGeometryFactory::
-                                    removeLowerDimensionSubGeoms(
-                                        poDstGeometry.get()));
-                        }
-                    }
+                poClipGeom->getEnvelope(&oClipEnv);
+                poDstGeometry->getEnvelope(&oDstEnv);
 
-                    if (m_eGeomTypeConversion != GTC_DEFAULT)
+                if (oClipEnv.Intersects(oDstEnv))
+                {
+                    if (oState.m_poClipSrcPreparedGeomSrc != poClipGeom)
                     {
-                        OGRwkbGeometryType eTargetType =
-                            poDstGeometry->getGeometryType();
-                        eTargetType =
-                            ConvertType(m_eGeomTypeConversion, eTargetType);
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(), eTargetType));
+                        oState.m_poClipSrcPreparedGeomSrc = poClipGeom;
+                        oState.m_poClipSrcPreparedGeom.reset(
+                            OGRHasPreparedGeometrySupport()
+                                ? OGRCreatePreparedGeometry(
+                                      OGRGeometry::ToHandle(
+                                          const_cast<OGRGeometry *>(
+                                              poClipGeom)))
+                                : nullptr);
                     }
-                    else if (eGType != GEOMTYPE_UNCHANGED)
+                    // Computing the intersection is much more expensive
+                    // than testing it with the prepared geometry.
+                    if (!oState.m_poClipSrcPreparedGeom ||
+                        OGRPreparedGeometryIntersects(
+                            oState.m_poClipSrcPreparedGeom.get(),
+                            OGRGeometry::ToHandle(poDstGeometry.get())))
                     {
-                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
-                            poDstGeometry.release(),
-                            static_cast<OGRwkbGeometryType>(eGType)));
+                        poClipped.reset(
+                            poClipGeom->Intersection(poDstGeometry.get()));
                     }
                 }
+            }
 
-                poDstFeature->SetGeomFieldDirectly(iGeom,
-                                                   poDstGeometry.release());
+            if (poClipped == nullptr || poClipped->IsEmpty())
+            {
+                return GeomProcessingResult::SKIP_FEATURE;
             }
 
-            CPLErrorReset();
-            if ((psOptions->bUpsert
-                     ? poDstLayer->UpsertFeature(poDstFeature.get())
-                     : poDstLayer->CreateFeature(poDstFeature.get())) ==
-                OGRERR_NONE)
+            const int nDim = poDstGeometry->getDimension();
+            if (poClipped->getDimension() < nDim &&
+                wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                    wkbUnknown)
             {
-                nFeaturesWritten++;
-                if (nDesiredFID != OGRNullFID &&
-                    poDstFeature->GetFID() != nDesiredFID)
-                {
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Feature id " CPL_FRMT_GIB " not preserved",
-                             nDesiredFID);
-                }
+                CPLDebug("OGR2OGR",
+                         "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                         "as its intersection with -clipsrc is a %s "
+                         "whereas the input is a %s",
+                         nSrcFID, pszSrcLayerName,
+                         OGRToOGCGeomType(poClipped->getGeometryType()),
+                         OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                return GeomProcessingResult::SKIP_FEATURE;
             }
-            else if (!psOptions->bSkipFailures)
+
+            poDstGeometry = std::move(poClipped);
+        }
+
+        OGRCoordinateTransformation *const poCT =
+            oState.m_bUseCTClones
+                ? oState.m_apoCTClones[iGeom].get()
+                : psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
+        char **const papszTransformOptions =
+            psInfo->m_aoReprojectionInfo[iGeom].m_aosTransformOptions.List();
+        const bool bReprojCanInvalidateValidity =
+            psInfo->m_aoReprojectionInfo[iGeom].m_bCanInvalidateValidity;
+
+        if (poCT != nullptr || papszTransformOptions != nullptr)
+        {
+            // If we need to change the geometry type to linear, and
+            // we have a geometry with curves, then convert it to
+            // linear first, to avoid invalidities due to the fact
+            // that validity of arc portions isn't always kept while
+            // reprojecting and then discretizing.
+            if (bReprojCanInvalidateValidity &&
+                (!psInfo->m_bSupportCurves ||
+                 m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
+                 m_eGeomTypeConversion ==
+                     GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
             {
-                if (psOptions->nGroupTransactions)
+                if (poDstGeometry->hasCurveGeometry(TRUE))
                 {
-                    if (psOptions->nLayerTransaction)
-                        poDstLayer->RollbackTransaction();
+                    OGRwkbGeometryType eTargetType =
+                        OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                    poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                        poDstGeometry.release(), eTargetType));
                 }
-
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " from layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
-
-                return false;
             }
-            else
+            else if (bReprojCanInvalidateValidity &&
+                     eGType != GEOMTYPE_UNCHANGED &&
+                     !OGR_GT_IsNonLinear(
+                         static_cast<OGRwkbGeometryType>(eGType)) &&
+                     poDstGeometry->hasCurveGeometry(TRUE))
             {
-                CPLDebug("GDALVectorTranslate",
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " into layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
-                if (psOptions->nGroupTransactions)
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(),
+                    static_cast<OGRwkbGeometryType>(eGType)));
+            }
+
+            for (int iIter = 0; iIter < 2; ++iIter)
+            {
+                auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
+                    OGRGeometryFactory::transformWithOptions(
+                        poDstGeometry.get(), poCT, papszTransformOptions,
+                        oState.m_transformWithOptionsCache));
+                if (poReprojectedGeom == nullptr)
                 {
-                    if (psOptions->nLayerTransaction)
+                    // The caller is responsible for committing the
+                    // pending transaction.
+                    bReprojectionFailed = true;
+
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Failed to reproject feature " CPL_FRMT_GIB
+                             " (geometry probably out of source or "
+                             "destination SRS).",
+                             nSrcFID);
+                    if (!psOptions->bSkipFailures)
                     {
-                        poDstLayer->RollbackTransaction();
-                        CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
+                        return GeomProcessingResult::FAILURE;
+                    }
+                }
+
+                // Check if a curve geometry is no longer valid after
+                // reprojection
+                const auto eType = poDstGeometry->getGeometryType();
+                const auto eFlatType = wkbFlatten(eType);
+
+                const auto IsValid = [](const OGRGeometry *poGeom)
+                {
+                    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+                    return poGeom->IsValid();
+                };
+
+                if (iIter == 0 && bReprojCanInvalidateValidity &&
+                    OGRGeometryFactory::haveGEOS() &&
+                    (eFlatType == wkbCurvePolygon ||
+                     eFlatType == wkbCompoundCurve ||
+                     eFlatType == wkbMultiCurve ||
+                     eFlatType == wkbMultiSurface) &&
+                    poDstGeometry->hasCurveGeometry(TRUE) &&
+                    IsValid(poDstGeometry.get()))
+                {
+                    OGRwkbGeometryType eTargetType =
+                        OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                    auto poDstGeometryTmp = std::unique_ptr<OGRGeometry>(
+                        OGRGeometryFactory::forceTo(poReprojectedGeom->clone(),
+                                                    eTargetType));
+                    if (!IsValid(poDstGeometryTmp.get()))
+                    {
+                        CPLDebug("OGR2OGR",
+                                 "Curve geometry no longer valid after "
+                                 "reprojection: transforming it into "
+                                 "linear one before reprojecting");
+                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                            poDstGeometry.release(), eTargetType));
+                        poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                            poDstGeometry.release(), eType));
                     }
                     else
                     {
-                        m_poODS->RollbackTransaction();
-                        m_poODS->StartTransaction(psOptions->bForceTransaction);
+                        poDstGeometry = std::move(poReprojectedGeom);
+                        break;
                     }
                 }
+                else
+                {
+                    poDstGeometry = std::move(poReprojectedGeom);
+                    break;
+                }
             }
-
-        end_loop:;  // nothing
         }
-
-        /* Report progress */
-        nCount++;
-        bool bGoOn = true;
-        if (pfnProgress)
+        else if (poOutputSRS != nullptr)
         {
-            bGoOn = pfnProgress(nCountLayerFeatures
-                                    ? nCount * 1.0 / nCountLayerFeatures
-                                    : 1.0,
-                                "", pProgressArg) != FALSE;
+            poDstGeometry->assignSpatialReference(poOutputSRS);
         }
-        if (!bGoOn)
+
+        if (poDstGeometry != nullptr)
         {
-            bRet = false;
-            break;
-        }
+            if (m_poClipDstOri)
+            {
+                const OGRGeometry *poClipGeom = GetDstClipGeom(
+                    oState, poDstGeometry->getSpatialReference());
+                if (poClipGeom == nullptr)
+                {
+                    return GeomProcessingResult::SKIP_FEATURE;
+                }
 
-        if (pnReadFeatureCount)
-            *pnReadFeatureCount = nCount;
+                std::unique_ptr<OGRGeometry> poClipped;
 
-        if (psOptions->nFIDToFetch != OGRNullFID)
-            break;
-        if (poFeatureIn != nullptr)
-            break;
-    }
+                OGREnvelope oClipEnv;
+                OGREnvelope oDstEnv;
 
-    if (psOptions->nGroupTransactions)
-    {
-        if (psOptions->nLayerTransaction)
-        {
-            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
-                bRet = false;
+                poClipGeom->getEnvelope(&oClipEnv);
+                poDstGeometry->getEnvelope(&oDstEnv);
+
+                if (oClipEnv.Intersects(oDstEnv))
+                {
+                    poClipped.reset(
+                        poClipGeom->Intersection(poDstGeometry.get()));
+                }
+
+                if (poClipped == nullptr || poClipped->IsEmpty())
+                {
+                    return GeomProcessingResult::SKIP_FEATURE;
+                }
+
+                const int nDim = poDstGeometry->getDimension();
+                if (poClipped->getDimension() < nDim &&
+                    wkbFlatten(
+                        poDstFDefn->GetGeomFieldDefn(iGeom)->GetType()) !=
+                        wkbUnknown)
+                {
+                    CPLDebug(
+                        "OGR2OGR",
+                        "Discarding feature " CPL_FRMT_GIB " of layer %s, "
+                        "as its intersection with -clipdst is a %s "
+                        "whereas the input is a %s",
+                        nSrcFID, pszSrcLayerName,
+                        OGRToOGCGeomType(poClipped->getGeometryType()),
+                        OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                    return GeomProcessingResult::SKIP_FEATURE;
+                }
+
+                poDstGeometry = std::move(poClipped);
+            }
+
+            if (psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN &&
+                OGRGeometryFactory::haveGEOS() &&
+                !poDstGeometry->hasCurveGeometry())
+            {
+                // OGR_APPLY_GEOM_SET_PRECISION default value for
+                // OGRLayer::CreateFeature() purposes, but here in the
+                // ogr2ogr -xyRes context, we force calling SetPrecision(),
+                // unless the user explicitly asks not to do it by
+                // setting the config option to NO.
+                if (!oState.m_bRunSetPrecisionEvaluated)
+                {
+                    oState.m_bRunSetPrecisionEvaluated = true;
+                    oState.m_bRunSetPrecision = CPLTestBool(CPLGetConfigOption(
+                        "OGR_APPLY_GEOM_SET_PRECISION", "YES"));
+                }
+                if (oState.m_bRunSetPrecision)
+                {
+                    auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                        poDstGeometry->SetPrecision(psOptions->dfXYRes,
+                                                    /* nFlags = */ 0));
+                    if (!poNewGeom)
+                        return GeomProcessingResult::SKIP_FEATURE;
+                    poDstGeometry = std::move(poNewGeom);
+                }
+            }
+
+            if (m_bMakeValid)
+            {
+                const bool bIsGeomCollection =
+                    wkbFlatten(poDstGeometry->getGeometryType()) ==
+                    wkbGeometryCollection;
+                auto poNewGeom =
+                    std::unique_ptr<OGRGeometry>(poDstGeometry->MakeValid());
+                if (!poNewGeom)
+                    return GeomProcessingResult::SKIP_FEATURE;
+                poDstGeometry = std::move(poNewGeom);
+                if (!bIsGeomCollection)
+                {
+                    poDstGeometry.reset(
+                        OGRGeometryFactory::removeLowerDimensionSubGeoms(
+                            poDstGeometry.get()));
+                }
+            }
+
+            if (m_eGeomTypeConversion != GTC_DEFAULT)
+            {
+                OGRwkbGeometryType eTargetType =
+                    poDstGeometry->getGeometryType();
+                eTargetType = ConvertType(m_eGeomTypeConversion, eTargetType);
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(), eTargetType));
+            }
+            else if (eGType != GEOMTYPE_UNCHANGED)
+            {
+                poDstGeometry.reset(OGRGeometryFactory::forceTo(
+                    poDstGeometry.release(),
+                    static_cast<OGRwkbGeometryType>(eGType)));
+            }
         }
-    }
 
-    if (poFeatureIn == nullptr)
-    {
-        CPLDebug("GDALVectorTranslate",
-                 CPL_FRMT_GIB " features written in layer '%s'",
-                 nFeaturesWritten, poDstLayer->GetName());
+        poDstFeature->SetGeomFieldDirectly(iGeom, poDstGeometry.release());
     }
 
-    return bRet;
+    return GeomProcessingResult::OK;
 }
 
 /************************************************************************/
@@ -6563,27 +7312,33 @@ bool LayerTranslator::Translate(
 /************************************************************************/
 
 const OGRGeometry *
-LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetDstClipGeom(GeomProcessingState &oState,
+                                const OGRSpatialReference *poGeomSRS) const
 {
-    if (m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
+    if (oState.m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
     {
+        std::unique_lock<std::mutex> oLock;
+        if (oState.m_poClipGeomMutex)
+            oLock = std::unique_lock<std::mutex>(*oState.m_poClipGeomMutex);
+
         auto poClipDstSRS = m_poClipDstOri->getSpatialReference();
         if (poClipDstSRS && poGeomSRS && !poClipDstSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipDstReprojectedToDstSRS.reset(m_poClipDstOri->clone());
-            if (m_poClipDstReprojectedToDstSRS->transformTo(poGeomSRS) !=
-                OGRERR_NONE)
+            oState.m_poClipDstReprojectedToDstSRS.reset(
+                m_poClipDstOri->clone());
+            if (oState.m_poClipDstReprojectedToDstSRS->transformTo(
+                    poGeomSRS) != OGRERR_NONE)
             {
                 return nullptr;
             }
-            m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
+            oState.m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
         }
         else if (!poClipDstSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipDstSRS)
+            if (!oState.m_bWarnedClipDstSRS)
             {
-                m_bWarnedClipDstSRS = true;
+                oState.m_bWarnedClipDstSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip destination geometry has no "
                          "attached SRS, but the feature's "
@@ -6594,8 +7349,9 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
         }
     }
 
-    return m_poClipDstReprojectedToDstSRS ? m_poClipDstReprojectedToDstSRS.get()
-                                          : m_poClipDstOri;
+    return oState.m_poClipDstReprojectedToDstSRS
+               ? oState.m_poClipDstReprojectedToDstSRS.get()
+               : m_poClipDstOri;
 }
 
 /************************************************************************/
@@ -6603,27 +7359,35 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
 /************************************************************************/
 
 const OGRGeometry *
-LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetSrcClipGeom(GeomProcessingState &oState,
+                                const OGRSpatialReference *poGeomSRS) const
 {
-    if (m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
+    if (oState.m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
     {
+        std::unique_lock<std::mutex> oLock;
+        if (oState.m_poClipGeomMutex)
+            oLock = std::unique_lock<std::mutex>(*oState.m_poClipGeomMutex);
+
         auto poClipSrcSRS = m_poClipSrcOri->getSpatialReference();
         if (poClipSrcSRS && poGeomSRS && !poClipSrcSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipSrcReprojectedToSrcSRS.reset(m_poClipSrcOri->clone());
-            if (m_poClipSrcReprojectedToSrcSRS->transformTo(poGeomSRS) !=
-                OGRERR_NONE)
+            oState.m_poClipSrcPreparedGeomSrc = nullptr;
+            oState.m_poClipSrcPreparedGeom.reset();
+            oState.m_poClipSrcReprojectedToSrcSRS.reset(
+                m_poClipSrcOri->clone());
+            if (oState.m_poClipSrcReprojectedToSrcSRS->transformTo(
+                    poGeomSRS) != OGRERR_NONE)
             {
                 return nullptr;
             }
-            m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
+            oState.m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
         }
         else if (!poClipSrcSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipSrcSRS)
+            if (!oState.m_bWarnedClipSrcSRS)
             {
-                m_bWarnedClipSrcSRS = true;
+                oState.m_bWarnedClipSrcSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip source geometry has no attached SRS, "
                          "but the feature's geometry has one. "
@@ -6633,8 +7397,9 @@ LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
         }
     }
 
-    return m_poClipSrcReprojectedToSrcSRS ? m_poClipSrcReprojectedToSrcSRS.get()
-                                          : m_poClipSrcOri;
+    return oState.m_poClipSrcReprojectedToSrcSRS
+               ? oState.m_poClipSrcReprojectedToSrcSRS.get()
+               : m_poClipSrcOri;
 }
 
 /************************************************************************/
@@ -7437,6 +8202,20 @@ static std::unique_ptr<GDALArgumentParser> GDALVectorTranslateOptionsGetParser(
         .store_into(psOptions->nLimit)
         .help(_("Limit the number of features per layer."));
 
+    argParser->add_argument("-nt")
+        .metavar("<num_threads>|ALL_CPUS")
+        .action(
+            [psOptions](const std::string &s)
+            {
+                if (EQUAL(s.c_str(), "ALL_CPUS"))
+                    psOptions->nThreads = CPLGetNumCPUs();
+                else
+                    psOptions->nThreads = atoi(s.c_str());
+                if (psOptions->nThreads < 1)
+                    throw std::invalid_argument("Invalid value for -nt: " + s);
+            })
+        .help(_("Number of threads used to process geometries."));
+
     argParser->add_argument("-ds_transaction")
         .flag()
         .action(
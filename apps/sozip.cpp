@@ -447,6 +447,12 @@ MAIN_START(nArgc, papszArgv)
         .help(
             _("Minimum file size to decide if a file should be seek-optimized. "
               "Defaults to 1 MB byte."));
+    argParser.add_argument("--num-threads")
+        .metavar("<number|ALL_CPUS>")
+        .action([&aosOptions](const std::string &s)
+                { aosOptions.SetNameValue("NUM_THREADS", s.c_str()); })
+        .help(_("Number of threads used to compress seek-optimized files. "
+                "Defaults to ALL_CPUS."));
     argParser.add_argument("--content-type")
         .metavar("<string>")
         .action([&aosOptions](const std::string &s)
@@ -401,3 +401,52 @@ def test_contour_raster_acquisition_error():
         gdal.ContourGenerateEx(
             ds.GetRasterBand(1), ogr_lyr, options=["LEVEL_INTERVAL=1", "ID_FIELD=0"]
         )
+
+
+###############################################################################
+
+
+@pytest.mark.parametrize("fixed_levels", [False, True])
+def test_contour_num_threads(fixed_levels):
+
+    import math
+
+    # Tall enough to be split in several strips
+    width = 50
+    height = 2500
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, gdal.GDT_Float32)
+    values = [
+        100 * math.sin(i / 7.0) * math.cos(j / 11.0) + (i * 13 + j * 7) % 5
+        for j in range(height)
+        for i in range(width)
+    ]
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, width, height, struct.pack("f" * (width * height), *values)
+    )
+
+    def get_lines(num_threads):
+        ogr_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+        ogr_lyr = ogr_ds.CreateLayer("contour", geom_type=ogr.wkbLineString)
+        ogr_lyr.CreateField(ogr.FieldDefn("ID", ogr.OFTInteger))
+        ogr_lyr.CreateField(ogr.FieldDefn("elev", ogr.OFTReal))
+        options = ["ID_FIELD=0", "ELEV_FIELD=1", "NUM_THREADS=%d" % num_threads]
+        if fixed_levels:
+            options.append("FIXED_LEVELS=-50,0,12.5,50")
+        else:
+            options.append("LEVEL_INTERVAL=10")
+        gdal.ContourGenerateEx(src_ds.GetRasterBand(1), ogr_lyr, options=options)
+        # Features are not generated in the same order, and rings may
+        # start at a different point
+        return sorted(
+            (
+                f["elev"],
+                f.GetGeometryRef().GetPointCount(),
+                round(f.GetGeometryRef().Length(), 6),
+                f.GetGeometryRef().GetEnvelope(),
+            )
+            for f in ogr_lyr
+        )
+
+    ref = get_lines(1)
+    assert len(ref) > 100
+    assert get_lines(4) == ref
@@ -31,6 +31,8 @@
 ###############################################################################
 
 
+import math
+
 import gdaltest
 import pytest
 
@@ -116,3 +118,43 @@ def test_cutline_4():
 
 
 ###############################################################################
+
+
+###############################################################################
+# Test that splitting a complex cutline into pieces, shared among chunks,
+# gives the same result as using the whole cutline.
+
+
+@pytest.mark.require_geos
+def test_cutline_prepared_cutline():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 2048, 2048)
+    src_ds.SetGeoTransform([0, 1, 0, 2048, 0, -1])
+    src_ds.GetRasterBand(1).Fill(255)
+
+    # Polygon with a hole, with many vertices
+    def circle(r):
+        N = 10000
+        return "(%s)" % ",".join(
+            "%.6f %.6f"
+            % (
+                1024 + r * math.cos(2 * math.pi * i / N),
+                1024 + r * math.sin(2 * math.pi * i / N),
+            )
+            for i in list(range(N)) + [0]
+        )
+
+    wkt = "POLYGON(%s,%s)" % (circle(1000), circle(300))
+
+    def warp():
+        return gdal.Warp(
+            "",
+            src_ds,
+            format="MEM",
+            cutlineWKT=wkt,
+            warpMemoryLimit=1024 * 1024,
+        ).GetRasterBand(1).Checksum()
+
+    with gdal.config_option("GDAL_WARP_PREPARE_CUTLINE", "NO"):
+        ref_cs = warp()
+    assert warp() == ref_cs
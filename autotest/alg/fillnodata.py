@@ -403,3 +403,84 @@ def test_fillnodata_nearest(
         for i in range(height)
     ]
     assert got == expected
+
+
+###############################################################################
+# Test INTERPOLATION=PULL_PUSH
+
+
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_fillnodata_pull_push(num_threads):
+
+    width = 40
+    height = 30
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, gdal.GDT_Float32)
+    band = ds.GetRasterBand(1)
+    band.SetNoDataValue(-1)
+    values = [
+        -1 if (10 <= x < 25 and 8 <= y < 20) else x + 2 * y
+        for y in range(height)
+        for x in range(width)
+    ]
+    band.WriteRaster(
+        0, 0, width, height, struct.pack("f" * (width * height), *values)
+    )
+
+    gdal.FillNodata(
+        targetBand=band,
+        maskBand=None,
+        maxSearchDist=0,
+        smoothingIterations=0,
+        options=["INTERPOLATION=PULL_PUSH", "NUM_THREADS=%d" % num_threads],
+    )
+    got = struct.unpack("f" * (width * height), band.ReadRaster())
+
+    for y in range(height):
+        for x in range(width):
+            v = got[y * width + x]
+            if 10 <= x < 25 and 8 <= y < 20:
+                # Within the range of the values around the hole
+                assert 10 + 2 * 7 <= v <= 25 + 2 * 20, (x, y)
+            else:
+                assert v == x + 2 * y, (x, y)
+
+    # Filling a constant raster gives the same constant
+    band.WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        struct.pack(
+            "f" * (width * height), *[7 if v >= 0 else v for v in values]
+        ),
+    )
+    gdal.FillNodata(
+        targetBand=band,
+        maskBand=None,
+        maxSearchDist=0,
+        smoothingIterations=2,
+        options=["INTERPOLATION=PULL_PUSH", "NUM_THREADS=%d" % num_threads],
+    )
+    got = struct.unpack("f" * (width * height), band.ReadRaster())
+    assert got == pytest.approx([7] * (width * height), rel=1e-6)
+
+
+def test_fillnodata_pull_push_max_search_dist():
+
+    width = 64
+    height = 1
+    ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    band = ds.GetRasterBand(1)
+    band.SetNoDataValue(0)
+    band.WriteRaster(0, 0, width, height, b"\x05" + b"\x00" * (width - 1))
+
+    gdal.FillNodata(
+        targetBand=band,
+        maskBand=None,
+        maxSearchDist=4,
+        smoothingIterations=0,
+        options=["INTERPOLATION=PULL_PUSH"],
+    )
+    got = band.ReadRaster()
+    assert got[0:2] == b"\x05\x05"
+    assert got[-1:] == b"\x00"
@@ -448,3 +448,59 @@ def test_polygonize_8():
         wkt
         == "POLYGON ((1 4,1 3,0 3,0 1,1 1,1 0,3 0,3 1,4 1,4 3,3 3,3 4,1 4),(1 3,3 3,3 1,1 1,1 3))"
     )
+
+
+###############################################################################
+# Test that using several threads gives the same polygons as the sequential
+# algorithm. The raster is small enough that it is split into strips of a
+# few lines, so that most polygons cross strip boundaries.
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+@pytest.mark.parametrize("is_int_polygonize", [True, False])
+def test_polygonize_num_threads(connectedness, is_int_polygonize):
+
+    width = 53
+    height = 47
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_ds.SetGeoTransform([10, 1, 0, 20, 0, -1])
+    src_band = src_ds.GetRasterBand(1)
+    src_band.WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        bytes(
+            (x * x + 3 * y * y + x * y) % 5 % 4 if (x // 8 + y // 6) % 3 else 1
+            for y in range(height)
+            for x in range(width)
+        ),
+    )
+    src_band.SetNoDataValue(3)
+
+    def polygonize(num_threads):
+        mem_ds = ogr.GetDriverByName("Memory").CreateDataSource("out")
+        mem_layer = mem_ds.CreateLayer("poly", None, ogr.wkbPolygon)
+        mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTInteger))
+        options = ["NUM_THREADS=%d" % num_threads]
+        if connectedness == 8:
+            options.append("8CONNECTED=8")
+        if is_int_polygonize:
+            result = gdal.Polygonize(
+                src_band, src_band.GetMaskBand(), mem_layer, 0, options
+            )
+        else:
+            result = gdal.FPolygonize(
+                src_band, src_band.GetMaskBand(), mem_layer, 0, options
+            )
+        assert result == 0, "Polygonize failed"
+        ret = []
+        for f in mem_layer:
+            geom = f.GetGeometryRef()
+            ret.append((f["DN"], geom.GetArea(), geom.GetEnvelope()))
+        return sorted(ret)
+
+    ref = polygonize(1)
+    assert len(ref) > 100
+    assert polygonize(4) == ref
+    assert polygonize(16) == ref
@@ -126,3 +126,56 @@ def test_proximity_3():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test ALGORITHM=EXACT against a brute force computation
+
+
+@pytest.mark.parametrize("num_threads", [1, 3])
+@pytest.mark.parametrize("distunits", ["PIXEL", "GEO"])
+def test_proximity_exact(num_threads, distunits):
+
+    import struct
+
+    width = 37
+    height = 29
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_ds.SetGeoTransform([0, 2, 0, 0, 0, -3])
+    src_band = src_ds.GetRasterBand(1)
+    src_data = bytes(
+        (1 if (x * 7 + y * 13) % 97 == 0 else 0)
+        for y in range(height)
+        for x in range(width)
+    )
+    src_band.WriteRaster(0, 0, width, height, src_data)
+
+    dst_ds = gdal.GetDriverByName("MEM").Create(
+        "", width, height, 1, gdal.GDT_Float32
+    )
+    dst_band = dst_ds.GetRasterBand(1)
+
+    gdal.ComputeProximity(
+        src_band,
+        dst_band,
+        options=[
+            "ALGORITHM=EXACT",
+            "DISTUNITS=" + distunits,
+            "MAXDIST=20",
+            "NODATA=-1",
+            "NUM_THREADS=%d" % num_threads,
+        ],
+    )
+    got = struct.unpack("f" * (width * height), dst_band.ReadRaster())
+
+    sx, sy = (2, 3) if distunits == "GEO" else (1, 1)
+    targets = [
+        (i % width, i // width) for i in range(width * height) if src_data[i]
+    ]
+    for y in range(height):
+        for x in range(width):
+            dist = min(
+                ((tx - x) * sx) ** 2 + ((ty - y) * sy) ** 2 for tx, ty in targets
+            ) ** 0.5
+            expected = dist if dist <= 20 else -1
+            assert got[y * width + x] == pytest.approx(expected, rel=1e-6), (x, y)
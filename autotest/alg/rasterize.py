@@ -1011,3 +1011,185 @@ def test_rasterize_bugfix_gh8918(wkt):
     )
 
     assert target_ds.GetRasterBand(1).Checksum() == 36
+
+
+###############################################################################
+# Test that rasterization with worker threads gives the same result as
+# with a single thread
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        [],
+        ["ALL_TOUCHED=YES"],
+        ["MERGE_ALG=ADD"],
+        ["ALL_TOUCHED=YES", "MERGE_ALG=ADD"],
+    ],
+)
+@pytest.mark.parametrize("use_attribute", [False, True])
+def test_rasterize_num_threads(options, use_attribute):
+
+    import random
+
+    rnd = random.Random(1)
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+    for i in range(300):
+        x = rnd.uniform(-10, 110)
+        y = rnd.uniform(-10, 90)
+        kind = i % 3
+        if kind == 0:
+            w = rnd.uniform(0.5, 30)
+            h = rnd.uniform(0.5, 30)
+            wkt = "POLYGON((%f %f,%f %f,%f %f,%f %f))" % (
+                x,
+                y,
+                x + w,
+                y + h * 0.3,
+                x + w * 0.2,
+                y + h,
+                x,
+                y,
+            )
+        elif kind == 1:
+            wkt = "LINESTRING(%f %f,%f %f,%f %f)" % (
+                x,
+                y,
+                x + rnd.uniform(-40, 40),
+                y + rnd.uniform(-40, 40),
+                x + rnd.uniform(-40, 40),
+                y + rnd.uniform(-40, 40),
+            )
+        else:
+            wkt = "POINT(%f %f)" % (x, y)
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["val"] = i % 7 + 1
+        f.SetGeometryDirectly(ogr.Geometry(wkt=wkt))
+        lyr.CreateFeature(f)
+
+    def rasterize(extra_options):
+        target_ds = gdal.GetDriverByName("MEM").Create("", 100, 80, 2, gdal.GDT_Int16)
+        target_ds.SetGeoTransform((0, 1, 0, 0, 0, 1))
+        if use_attribute:
+            kwargs = {"options": options + extra_options + ["ATTRIBUTE=val"]}
+        else:
+            kwargs = {"burn_values": [3, 5], "options": options + extra_options}
+        assert gdal.RasterizeLayer(target_ds, [1, 2], lyr, **kwargs) == 0
+        return target_ds.ReadRaster()
+
+    ref = rasterize([])
+    assert rasterize(["NUM_THREADS=4"]) == ref
+    assert rasterize(["NUM_THREADS=3", "CHUNKYSIZE=17"]) == rasterize(
+        ["CHUNKYSIZE=17"]
+    )
+
+
+###############################################################################
+# Test COVERAGE_FRACTION=YES
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_rasterize_coverage_fraction(num_threads):
+
+    target_ds = gdal.GetDriverByName("MEM").Create("", 4, 3, 1, gdal.GDT_Float64)
+    target_ds.SetGeoTransform((0, 1, 0, 3, 0, -1))
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    f = ogr.Feature(lyr.GetLayerDefn())
+    # Rectangle with a hole covering exactly the pixel at column 2, line 1
+    f.SetGeometryDirectly(
+        ogr.CreateGeometryFromWkt(
+            "POLYGON((0.5 0.25,3.5 0.25,3.5 2.5,0.5 2.5,0.5 0.25),"
+            "(2 1,2 2,3 2,3 1,2 1))"
+        )
+    )
+    lyr.CreateFeature(f)
+
+    assert (
+        gdal.RasterizeLayer(
+            target_ds,
+            [1],
+            lyr,
+            burn_values=[2],
+            options=["COVERAGE_FRACTION=YES", "NUM_THREADS=%d" % num_threads],
+        )
+        == 0
+    )
+    got = struct.unpack("d" * 12, target_ds.ReadRaster())
+    expected = (
+        0.5,
+        1,
+        1,
+        0.5,
+        1,
+        2,
+        0,
+        1,
+        0.75,
+        1.5,
+        1.5,
+        0.75,
+    )
+    assert got == pytest.approx(expected, abs=1e-12)
+
+    # Area-weighted sum
+    assert (
+        gdal.RasterizeLayer(
+            target_ds,
+            [1],
+            lyr,
+            burn_values=[1],
+            options=["COVERAGE_FRACTION=YES", "MERGE_ALG=ADD"],
+        )
+        == 0
+    )
+    got = struct.unpack("d" * 12, target_ds.ReadRaster())
+    assert got == pytest.approx([v * 1.5 for v in expected], abs=1e-12)
+
+    with pytest.raises(Exception, match="mutually exclusive"):
+        gdal.RasterizeLayer(
+            target_ds,
+            [1],
+            lyr,
+            burn_values=[1],
+            options=["COVERAGE_FRACTION=YES", "ALL_TOUCHED=YES"],
+        )
+
+
+###############################################################################
+# Test that the coverage fractions of a tiling of polygons sum to 1
+
+
+def test_rasterize_coverage_fraction_partition():
+
+    target_ds = gdal.GetDriverByName("MEM").Create("", 10, 10, 1, gdal.GDT_Float32)
+    target_ds.SetGeoTransform((0, 1, 0, 10, 0, -1))
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    # Split the raster extent along a slanted line
+    for wkt in [
+        "POLYGON((0 0,10 0,10 3.3,0 7.1,0 0))",
+        "POLYGON((0 7.1,10 3.3,10 10,0 10,0 7.1))",
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+
+    assert (
+        gdal.RasterizeLayer(
+            target_ds,
+            [1],
+            lyr,
+            burn_values=[1],
+            options=["COVERAGE_FRACTION=YES", "MERGE_ALG=ADD"],
+        )
+        == 0
+    )
+    minval, maxval = target_ds.GetRasterBand(1).ComputeRasterMinMax()
+    assert minval == pytest.approx(1, abs=1e-6)
+    assert maxval == pytest.approx(1, abs=1e-6)
@@ -328,3 +328,47 @@ cellsize     60.000000000000
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test that using worker threads gives the same result as a single thread
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+@pytest.mark.parametrize("use_mask", [False, True])
+def test_sieve_num_threads(connectedness, use_mask):
+
+    width = 53
+    height = 47
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_band = src_ds.GetRasterBand(1)
+    src_band.WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        bytes(
+            (x * x + 3 * y * y + x * y) % 5 if (x // 8 + y // 6) % 3 else 1
+            for y in range(height)
+            for x in range(width)
+        ),
+    )
+    if use_mask:
+        src_band.SetNoDataValue(3)
+    mask_band = src_band.GetMaskBand() if use_mask else None
+
+    def sieve(options):
+        dst_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+        dst_band = dst_ds.GetRasterBand(1)
+        gdal.SieveFilter(
+            src_band, mask_band, dst_band, 6, connectedness, options=options
+        )
+        return dst_band.ReadRaster()
+
+    ref = sieve([])
+    assert ref != src_band.ReadRaster()
+    assert sieve(["NUM_THREADS=1"]) == ref
+    assert sieve(["NUM_THREADS=4"]) == ref
+    assert sieve(["NUM_THREADS=16"]) == ref
+    with gdal.config_option("GDAL_NUM_THREADS", "ALL_CPUS"):
+        assert sieve([]) == ref
@@ -1638,6 +1638,133 @@ def test_warp_mode_ties():
     assert out_ds.GetRasterBand(1).ReadAsArray()[0, 0] == 5
 
 
+###############################################################################
+# Check that integer and floating-point mode resampling agree
+
+
+@pytest.mark.parametrize("dt", [gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Int16])
+def test_warp_mode_integer_vs_float(dt):
+
+    width = 120
+    height = 80
+    data = [
+        ((x // 3 + y // 5) % 7) * (1 if (x + y) % 13 else 30)
+        for y in range(height)
+        for x in range(width)
+    ]
+
+    res = []
+    for src_dt in (dt, gdal.GDT_Float32):
+        src_ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, src_dt)
+        src_ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+        src_ds.GetRasterBand(1).WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            struct.pack("f" * (width * height), *data),
+            buf_type=gdal.GDT_Float32,
+        )
+        out_ds = gdal.Warp(
+            "", src_ds, format="MEM", resampleAlg="mode", xRes=8, yRes=8
+        )
+        res.append(out_ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Float32))
+
+    assert res[0] == res[1]
+
+
+###############################################################################
+# Test that the AVX2 code path of the bilinear and cubic Float32 warp kernels
+# gives the same results as the generic one
+
+
+@pytest.mark.parametrize("resampleAlg", ["bilinear", "cubic"])
+def test_warp_bilinear_cubic_float32_avx2(resampleAlg):
+
+    width = 123
+    height = 97
+    data = [
+        ((x * 37 + y * 101) % 255) * 1.25 - (x % 7) * y
+        for y in range(height)
+        for x in range(width)
+    ]
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height, 2, gdal.GDT_Float32)
+    src_ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    for i in range(2):
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            struct.pack("f" * (width * height), *data[i:], *data[:i]),
+        )
+
+    res = []
+    for use_avx2 in ("NO", "YES"):
+        with gdal.config_option("GDAL_USE_AVX2", use_avx2):
+            out_ds = gdal.Warp(
+                "",
+                src_ds,
+                format="MEM",
+                resampleAlg=resampleAlg,
+                outputBounds=[-3.3, -99.1, 125.7, 2.1],
+                width=141,
+                height=113,
+            )
+        res.append([out_ds.GetRasterBand(i + 1).ReadRaster() for i in range(2)])
+
+    assert res[0] == res[1]
+
+
+###############################################################################
+# Test that source windows without data are not read nor warped
+
+
+def test_warp_skip_empty_source_window(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "sparse.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        src_filename,
+        1024,
+        1024,
+        options=["SPARSE_OK=YES", "TILED=YES"],
+    )
+    src_ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    src_ds.GetRasterBand(1).SetNoDataValue(255)
+    src_ds.GetRasterBand(1).WriteRaster(0, 0, 2, 2, b"\x01\x02\x03\x04")
+    src_ds = None
+    src_ds = gdal.Open(src_filename)
+
+    messages = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug:
+            messages.append(msg)
+
+    res = []
+    for skip in ("NO", "YES"):
+        messages = []
+        with gdaltest.error_handler(my_handler), gdaltest.config_option(
+            "CPL_DEBUG", "ON"
+        ):
+            out_ds = gdal.Warp(
+                "",
+                src_ds,
+                format="MEM",
+                resampleAlg=gdal.GRIORA_Bilinear,
+                warpMemoryLimit=100000,
+                dstNodata=0,
+                warpOptions=["SKIP_EMPTY_SOURCE_WINDOW=" + skip],
+            )
+        res.append(out_ds.GetRasterBand(1).ReadRaster())
+        assert (
+            len([msg for msg in messages if "has no data. Skipping" in msg]) > 0
+        ) == (skip == "YES")
+
+    assert res[0] == res[1]
+    assert struct.unpack("B" * 4, res[1][0:2] + res[1][1024:1026]) == (1, 2, 3, 4)
+
+
 ###############################################################################
 # Test bugfix for #6526
 
@@ -1853,3 +1980,50 @@ def test_warp_average_NODATA_VALUES_PCT_THRESHOLD():
         options="-of MEM -ts 1 1 -r average -wo NODATA_VALUES_PCT_THRESHOLD=25",
     )
     assert struct.unpack("B", out_ds.ReadRaster())[0] == 20
+
+
+###############################################################################
+# Test that the affine no-rotation optimization of average resampling gives
+# the same result as the general case
+
+
+@pytest.mark.parametrize("dt", [gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Float32])
+@pytest.mark.parametrize("nodata", [None, 7])
+def test_warp_average_affine_no_rotation_optimization(dt, nodata):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 103, 97, 2, dt)
+    src_ds.SetGeoTransform([10, 1, 0, 20, 0, -1])
+    for i in range(2):
+        band = src_ds.GetRasterBand(i + 1)
+        band.WriteRaster(
+            0,
+            0,
+            103,
+            97,
+            struct.pack(
+                "B" * (103 * 97),
+                *[(j * (7 + i) + j // 103) % 251 for j in range(103 * 97)],
+            ),
+            buf_type=gdal.GDT_Byte,
+        )
+        if nodata is not None:
+            band.SetNoDataValue(nodata)
+
+    options = "-of MEM -r average -tr 3.3 2.7 -te 9.3 -78.1 114.2 21.4"
+    if nodata is not None:
+        options += " -wo UNIFIED_SRC_NODATA=YES"
+    with gdal.config_option("GDAL_WARP_USE_AFFINE_OPTIMIZATION", "NO"):
+        ref_ds = gdal.Warp("", src_ds, options=options)
+    out_ds = gdal.Warp("", src_ds, options=options)
+
+    for i in range(2):
+        ref = struct.unpack(
+            "d" * (ref_ds.RasterXSize * ref_ds.RasterYSize),
+            ref_ds.GetRasterBand(i + 1).ReadRaster(buf_type=gdal.GDT_Float64),
+        )
+        got = struct.unpack(
+            "d" * (out_ds.RasterXSize * out_ds.RasterYSize),
+            out_ds.GetRasterBand(i + 1).ReadRaster(buf_type=gdal.GDT_Float64),
+        )
+        tolerance = 1e-4 if dt == gdal.GDT_Float32 else 1
+        assert max(abs(a - b) for a, b in zip(ref, got)) <= tolerance
@@ -0,0 +1,221 @@
+#!/usr/bin/env pytest
+###############################################################################
+# $Id$
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  Test ZonalStatistics() algorithm.
+#
+###############################################################################
+# Copyright (c) 2024, GDAL contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import math
+import struct
+
+import pytest
+
+from osgeo import gdal, ogr
+
+###############################################################################
+
+
+def _create_src_ds(width=4, height=4):
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, gdal.GDT_Float32)
+    src_ds.SetGeoTransform([0, 1, 0, height, 0, -1])
+    values = [float(i) for i in range(width * height)]
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, width, height, struct.pack("f" * len(values), *values)
+    )
+    return src_ds, values
+
+
+def _create_out_lyr():
+    out_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    return out_ds, out_ds.CreateLayer("stats")
+
+
+def _stats(values):
+    n = len(values)
+    mean = sum(values) / n
+    return {
+        "count": n,
+        "sum": sum(values),
+        "mean": mean,
+        "min": min(values),
+        "max": max(values),
+        "stddev": math.sqrt(sum((v - mean) ** 2 for v in values) / n),
+    }
+
+
+def _check_feature(f, values):
+    for k, v in _stats(values).items():
+        assert f[k] == pytest.approx(v), k
+
+
+###############################################################################
+# Zones from a raster band
+
+
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_zonalstats_zone_band(num_threads):
+
+    src_ds, values = _create_src_ds()
+    src_ds.GetRasterBand(1).SetNoDataValue(15)
+
+    zone_ds = gdal.GetDriverByName("MEM").Create("", 4, 4, 1, gdal.GDT_Int16)
+    zones = [1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 3, 3, -1, -1, -1, -1]
+    zone_ds.GetRasterBand(1).WriteRaster(
+        0, 0, 4, 4, struct.pack("h" * len(zones), *zones)
+    )
+    zone_ds.GetRasterBand(1).SetNoDataValue(-1)
+
+    out_ds, out_lyr = _create_out_lyr()
+    assert (
+        gdal.ZonalStatistics(
+            src_ds.GetRasterBand(1),
+            zone_ds.GetRasterBand(1),
+            None,
+            out_lyr,
+            options=["NUM_THREADS=%d" % num_threads],
+        )
+        == 0
+    )
+
+    assert out_lyr.GetFeatureCount() == 3
+    out_lyr.ResetReading()
+    for zone in (1, 2, 3):
+        f = out_lyr.GetNextFeature()
+        assert f["zone"] == zone
+        _check_feature(
+            f, [v for v, z in zip(values, zones) if z == zone and v != 15]
+        )
+
+
+###############################################################################
+# Zones from polygons, with a histogram
+
+
+def test_zonalstats_zone_layer():
+
+    src_ds, values = _create_src_ds()
+
+    zone_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    zone_lyr = zone_ds.CreateLayer("zones")
+    for wkt in [
+        "POLYGON((0 4,2 4,2 2,0 2,0 4))",
+        "POLYGON((1 0,4 0,4 1,1 1,1 0))",
+        "POLYGON((10 10,11 10,11 11,10 10))",
+    ]:
+        f = ogr.Feature(zone_lyr.GetLayerDefn())
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+        zone_lyr.CreateFeature(f)
+
+    out_ds, out_lyr = _create_out_lyr()
+    assert (
+        gdal.ZonalStatistics(
+            src_ds.GetRasterBand(1),
+            None,
+            zone_lyr,
+            out_lyr,
+            options=[
+                "HISTOGRAM_BUCKETS=2",
+                "HISTOGRAM_MIN=0",
+                "HISTOGRAM_MAX=16",
+            ],
+        )
+        == 0
+    )
+
+    assert out_lyr.GetFeatureCount() == 3
+    out_lyr.ResetReading()
+
+    f = out_lyr.GetNextFeature()
+    assert f["zone"] == 0
+    _check_feature(f, [0, 1, 4, 5])
+    assert f["histogram"] == [4, 0]
+
+    f = out_lyr.GetNextFeature()
+    assert f["zone"] == 1
+    _check_feature(f, [13, 14, 15])
+    assert f["histogram"] == [0, 3]
+
+    f = out_lyr.GetNextFeature()
+    assert f["zone"] == 2
+    assert f["count"] == 0
+    assert f["mean"] is None
+
+
+###############################################################################
+# Check that the result does not depend on the number of threads and chunks
+
+
+def test_zonalstats_num_threads():
+
+    src_ds, values = _create_src_ds(1500, 2000)
+    zone_ds = gdal.GetDriverByName("MEM").Create("", 1500, 2000, 1, gdal.GDT_Byte)
+    zone_ds.GetRasterBand(1).Fill(7)
+
+    results = []
+    for num_threads in (1, 4):
+        out_ds, out_lyr = _create_out_lyr()
+        gdal.ZonalStatistics(
+            src_ds.GetRasterBand(1),
+            zone_ds.GetRasterBand(1),
+            None,
+            out_lyr,
+            options=["NUM_THREADS=%d" % num_threads],
+        )
+        f = out_lyr.GetNextFeature()
+        results.append((f["count"], f["sum"], f["min"], f["max"], f["mean"]))
+
+    assert results[0][0] == 1500 * 2000
+    assert results[0][2] == 0
+    assert results[0][3] == 1500 * 2000 - 1
+    assert results[0] == pytest.approx(results[1])
+
+
+###############################################################################
+# Test errors
+
+
+def test_zonalstats_errors():
+
+    src_ds, _ = _create_src_ds()
+    out_ds, out_lyr = _create_out_lyr()
+
+    with pytest.raises(Exception, match="exactly one"):
+        gdal.ZonalStatistics(src_ds.GetRasterBand(1), None, None, out_lyr)
+
+    zone_ds = gdal.GetDriverByName("MEM").Create("", 3, 4, 1)
+    with pytest.raises(Exception, match="same dimensions"):
+        gdal.ZonalStatistics(
+            src_ds.GetRasterBand(1), zone_ds.GetRasterBand(1), None, out_lyr
+        )
+
+    zone_ds = gdal.GetDriverByName("MEM").Create("", 4, 4, 1)
+    with pytest.raises(Exception, match="HISTOGRAM_MIN"):
+        gdal.ZonalStatistics(
+            src_ds.GetRasterBand(1),
+            zone_ds.GetRasterBand(1),
+            None,
+            out_lyr,
+            options=["HISTOGRAM_BUCKETS=2"],
+        )
@@ -28,6 +28,7 @@
  ****************************************************************************/
 
 #include <array>
+#include <vector>
 
 #include "gdal_unit_test.h"
 
@@ -41,6 +42,8 @@
 
 #include "test_data.h"
 
+#include "viewshed.h"
+
 namespace
 {
 // Common fixture with test data
@@ -284,6 +287,87 @@ TEST_F(test_alg, GDALAutoCreateWarpedVRT_alpha_band)
     GDALClose(hWarpedVRT);
 }
 
+static int CountingScaleTransformer(void *pTransformerArg, int /*bDstToSrc*/,
+                                    int nPointCount, double *x, double *y,
+                                    double * /* z */, int *panSuccess)
+{
+    *static_cast<int *>(pTransformerArg) += nPointCount;
+    for (int i = 0; i < nPointCount; ++i)
+    {
+        x[i] *= 2;
+        y[i] *= 2;
+        panSuccess[i] = TRUE;
+    }
+    return TRUE;
+}
+
+// Test that GDALWarpOperation::ComputeSourceWindow() reuses already
+// transformed points
+TEST_F(test_alg, GDALWarpOperation_ComputeSourceWindow_cache)
+{
+    auto poDriver = GDALDriver::FromHandle(GDALGetDriverByName("MEM"));
+    GDALDatasetUniquePtr poSrcDS(
+        poDriver->Create("", 200, 200, 1, GDT_Byte, nullptr));
+    GDALDatasetUniquePtr poDstDS(
+        poDriver->Create("", 100, 100, 1, GDT_Byte, nullptr));
+
+    int nTransformedPoints = 0;
+    GDALWarpOptions *psOptions = GDALCreateWarpOptions();
+    psOptions->hSrcDS = GDALDataset::ToHandle(poSrcDS.get());
+    psOptions->hDstDS = GDALDataset::ToHandle(poDstDS.get());
+    psOptions->nBandCount = 1;
+    psOptions->panSrcBands =
+        static_cast<int *>(CPLMalloc(sizeof(int) * psOptions->nBandCount));
+    psOptions->panSrcBands[0] = 1;
+    psOptions->panDstBands =
+        static_cast<int *>(CPLMalloc(sizeof(int) * psOptions->nBandCount));
+    psOptions->panDstBands[0] = 1;
+    psOptions->pfnTransformer = CountingScaleTransformer;
+    psOptions->pTransformerArg = &nTransformedPoints;
+
+    struct MyWarpOperation : public GDALWarpOperation
+    {
+        using GDALWarpOperation::ComputeSourceWindow;
+    };
+
+    MyWarpOperation oWO;
+    ASSERT_EQ(oWO.Initialize(psOptions), CE_None);
+    GDALDestroyWarpOptions(psOptions);
+
+    const std::vector<std::array<int, 4>> aoWindows = {
+        {0, 0, 50, 100}, {50, 0, 50, 100}, {0, 0, 100, 100}};
+    std::vector<std::array<int, 4>> aoResults;
+    std::vector<int> anTransformedPoints;
+    for (int iPass = 0; iPass < 2; ++iPass)
+    {
+        for (size_t i = 0; i < aoWindows.size(); ++i)
+        {
+            const auto &anWindow = aoWindows[i];
+            nTransformedPoints = 0;
+            std::array<int, 4> anSrcWindow = {0, 0, 0, 0};
+            ASSERT_EQ(oWO.ComputeSourceWindow(
+                          anWindow[0], anWindow[1], anWindow[2], anWindow[3],
+                          &anSrcWindow[0], &anSrcWindow[1], &anSrcWindow[2],
+                          &anSrcWindow[3], nullptr, nullptr, nullptr),
+                      CE_None);
+            if (iPass == 0)
+            {
+                aoResults.push_back(anSrcWindow);
+                anTransformedPoints.push_back(nTransformedPoints);
+            }
+            else
+            {
+                // Everything comes from the cache the second time
+                EXPECT_EQ(anSrcWindow, aoResults[i]);
+                EXPECT_EQ(nTransformedPoints, 0);
+            }
+        }
+    }
+    // The corners of the whole window have been already transformed when
+    // processing its 2 halves.
+    EXPECT_LT(anTransformedPoints[2], anTransformedPoints[0]);
+}
+
 // Test GDALIsLineOfSightVisible() with single point dataset
 TEST_F(test_alg, GDALIsLineOfSightVisible_single_point_dataset)
 {
@@ -490,4 +574,94 @@ TEST_F(test_alg, GDALIsLineOfSightVisible_through_mountain)
                                          nullptr, nullptr, nullptr));
 }
 
+// Test that processing the viewshed quadrants in parallel does not change
+// the result
+TEST_F(test_alg, Viewshed_num_threads)
+{
+    GDALAllRegister();
+
+    const std::string path = data_ + SEP + "n43.dt0";
+    const auto poDS = GDALDatasetUniquePtr(
+        GDALDataset::FromHandle(GDALOpen(path.c_str(), GA_ReadOnly)));
+    if (!poDS)
+    {
+        GTEST_SKIP() << "Cannot open " << path;
+    }
+
+    std::vector<GByte> abyRef;
+    for (int nThreads : {1, 4})
+    {
+        gdal::Viewshed::Options oOpts;
+        oOpts.outputFormat = "MEM";
+        oOpts.observer = {-79.5, 43.5, 10};
+        oOpts.numThreads = nThreads;
+        gdal::Viewshed oViewshed(oOpts);
+        ASSERT_TRUE(oViewshed.run(poDS->GetRasterBand(1), nullptr));
+        auto poOutDS = oViewshed.output();
+        ASSERT_TRUE(poOutDS != nullptr);
+        const int nXSize = poOutDS->GetRasterXSize();
+        const int nYSize = poOutDS->GetRasterYSize();
+        std::vector<GByte> abyResult(static_cast<size_t>(nXSize) * nYSize);
+        ASSERT_EQ(poOutDS->GetRasterBand(1)->RasterIO(
+                      GF_Read, 0, 0, nXSize, nYSize, abyResult.data(), nXSize,
+                      nYSize, GDT_Byte, 0, 0, nullptr),
+                  CE_None);
+        if (abyRef.empty())
+            abyRef = std::move(abyResult);
+        else
+            EXPECT_EQ(abyResult, abyRef);
+    }
+}
+
+// Test gdal::Viewshed::runCumulative() on a flat DEM, where all cells within
+// the maximum distance of an observer are visible from it
+TEST_F(test_alg, Viewshed_cumulative)
+{
+    GDALDatasetUniquePtr poDS(
+        GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+            ->Create("", 20, 20, 1, GDT_Int8, nullptr));
+    ASSERT_TRUE(poDS != nullptr);
+
+    gdal::Viewshed::Options oOpts;
+    oOpts.outputFormat = "MEM";
+    oOpts.maxDistance = 3;
+    gdal::Viewshed oViewshed(oOpts);
+    // The last observer falls outside of the DEM and is skipped
+    const std::vector<gdal::Viewshed::Point> aoObservers{
+        {5.5, 5.5, 10}, {8.5, 5.5, 10}, {-50, 10, 10}};
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    const bool bOK =
+        oViewshed.runCumulative(poDS->GetRasterBand(1), aoObservers, nullptr);
+    CPLPopErrorHandler();
+    ASSERT_TRUE(bOK);
+
+    auto poOutDS = oViewshed.output();
+    ASSERT_TRUE(poOutDS != nullptr);
+    // Union of the windows of the two observers
+    EXPECT_EQ(poOutDS->GetRasterXSize(), 10);
+    EXPECT_EQ(poOutDS->GetRasterYSize(), 7);
+    EXPECT_EQ(poOutDS->GetRasterBand(1)->GetRasterDataType(), GDT_UInt32);
+    double adfGeoTransform[6];
+    ASSERT_EQ(poOutDS->GetGeoTransform(adfGeoTransform), CE_None);
+    EXPECT_EQ(adfGeoTransform[0], 2);
+    EXPECT_EQ(adfGeoTransform[3], 1);
+
+    std::vector<uint32_t> anCounts(10 * 7);
+    ASSERT_EQ(poOutDS->GetRasterBand(1)->RasterIO(
+                  GF_Read, 0, 0, 10, 7, anCounts.data(), 10, 7, GDT_UInt32, 0,
+                  0, nullptr),
+              CE_None);
+    const auto count = [&anCounts](int nX, int nY)
+    { return anCounts[(nY - 1) * 10 + (nX - 2)]; };
+    // Seen from both observers
+    EXPECT_EQ(count(5, 5), 2U);
+    EXPECT_EQ(count(8, 5), 2U);
+    // Seen from the first observer only
+    EXPECT_EQ(count(2, 5), 1U);
+    // Seen from the second observer only
+    EXPECT_EQ(count(11, 5), 1U);
+    // Too far from both observers
+    EXPECT_EQ(count(11, 1), 0U);
+}
+
 }  // namespace
@@ -35,9 +35,14 @@
 #include "gdal.h"
 #include "tilematrixset.hpp"
 #include "gdalcachedpixelaccessor.h"
+#include "gdal_proxy.h"
 
+#include <atomic>
 #include <limits>
+#include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "test_data.h"
 
@@ -3790,6 +3795,145 @@ TEST_F(test_gdal, drop_cache)
     }
 }
 
+// Test GDALRasterBand::SamplePoints()
+TEST_F(test_gdal, GDALRasterBand_SamplePoints)
+{
+    GDALDatasetUniquePtr poDS(GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+                                  ->Create("", 5, 5, 1, GDT_Float32, nullptr));
+    auto poBand = poDS->GetRasterBand(1);
+    std::vector<float> afValues;
+    for (int j = 0; j < 5; ++j)
+        for (int i = 0; i < 5; ++i)
+            afValues.push_back(static_cast<float>(i + 10 * j));
+    ASSERT_EQ(poBand->RasterIO(GF_Write, 0, 0, 5, 5, afValues.data(), 5, 5,
+                               GDT_Float32, 0, 0, nullptr),
+              CE_None);
+
+    // Points in random order, the last one being outside of the raster
+    const double adfPixel[] = {2.25, 0.6, 4.9, -1};
+    const double adfLine[] = {2.75, 0.6, 0.1, 0};
+    double adfValues[4] = {};
+    int abSuccess[4] = {};
+
+    EXPECT_EQ(poBand->SamplePoints(4, adfPixel, adfLine,
+                                   GRIORA_NearestNeighbour, adfValues,
+                                   nullptr, abSuccess),
+              CE_None);
+    EXPECT_EQ(adfValues[0], 22);
+    EXPECT_EQ(adfValues[1], 0);
+    EXPECT_EQ(adfValues[2], 4);
+    EXPECT_TRUE(abSuccess[0] && abSuccess[1] && abSuccess[2]);
+    EXPECT_FALSE(abSuccess[3]);
+
+    // Bilinear and cubic interpolation reproduce a linear field away from
+    // the edges
+    EXPECT_EQ(poBand->SamplePoints(4, adfPixel, adfLine, GRIORA_Bilinear,
+                                   adfValues, nullptr, abSuccess),
+              CE_None);
+    EXPECT_NEAR(adfValues[0], 1.75 + 22.5, 1e-10);
+    EXPECT_NEAR(adfValues[1], 0.1 + 1, 1e-10);
+    EXPECT_FALSE(abSuccess[3]);
+
+    EXPECT_EQ(poBand->SamplePoints(4, adfPixel, adfLine, GRIORA_Cubic,
+                                   adfValues, nullptr, abSuccess),
+              CE_None);
+    EXPECT_NEAR(adfValues[0], 1.75 + 22.5, 1e-10);
+
+    // Nodata pixels are excluded from the interpolation
+    poBand->SetNoDataValue(0);
+    const double dfPixel = 1.0;
+    const double dfLine = 1.0;
+    double dfValue = 0;
+    EXPECT_EQ(poBand->SamplePoints(1, &dfPixel, &dfLine, GRIORA_Bilinear,
+                                   &dfValue),
+              CE_None);
+    EXPECT_NEAR(dfValue, (1 + 10 + 11) / 3.0, 1e-10);
+
+    // Unless the pixel containing the point is at nodata
+    EXPECT_EQ(poBand->SamplePoints(1, &adfPixel[1], &adfLine[1],
+                                   GRIORA_Bilinear, &dfValue),
+              CE_None);
+    EXPECT_EQ(dfValue, 0);
+
+    CPLPushErrorHandler(CPLQuietErrorHandler);
+    EXPECT_EQ(poBand->SamplePoints(1, &dfPixel, &dfLine, GRIORA_Lanczos,
+                                   &dfValue),
+              CE_Failure);
+    CPLPopErrorHandler();
+}
+
+// Test GDALDataset dirty region tracking
+TEST_F(test_gdal, GDALDataset_DirtyRegions)
+{
+    GDALDatasetUniquePtr poDS(GDALDriver::FromHandle(GDALGetDriverByName("MEM"))
+                                  ->Create("", 256, 256, 1, GDT_Byte, nullptr));
+    auto poBand = poDS->GetRasterBand(1);
+    GByte abyBuffer[10 * 10] = {};
+
+    // Not tracked by default
+    EXPECT_EQ(poBand->RasterIO(GF_Write, 0, 0, 10, 10, abyBuffer, 10, 10,
+                               GDT_Byte, 0, 0, nullptr),
+              CE_None);
+    EXPECT_TRUE(poDS->GetDirtyRegions().empty());
+
+    poDS->EnableDirtyRegionTracking();
+    EXPECT_TRUE(poDS->IsDirtyRegionTrackingEnabled());
+
+    // Adjacent blocks are coalesced, including across block rows
+    poDS->MarkDirtyRegion(0, 0, 64, 64);
+    poDS->MarkDirtyRegion(64, 0, 64, 64);
+    poDS->MarkDirtyRegion(0, 64, 64, 64);
+    poDS->MarkDirtyRegion(64, 64, 64, 64);
+    {
+        const auto aoRegions = poDS->GetDirtyRegions();
+        ASSERT_EQ(aoRegions.size(), 1U);
+        EXPECT_EQ(aoRegions[0].nXOff, 0);
+        EXPECT_EQ(aoRegions[0].nYOff, 0);
+        EXPECT_EQ(aoRegions[0].nXSize, 128);
+        EXPECT_EQ(aoRegions[0].nYSize, 128);
+    }
+
+    // Writes are recorded
+    EXPECT_EQ(poBand->RasterIO(GF_Write, 200, 210, 10, 10, abyBuffer, 10, 10,
+                               GDT_Byte, 0, 0, nullptr),
+              CE_None);
+    EXPECT_EQ(poBand->RasterIO(GF_Read, 0, 0, 10, 10, abyBuffer, 10, 10,
+                               GDT_Byte, 0, 0, nullptr),
+              CE_None);
+    {
+        const auto aoRegions = poDS->GetDirtyRegions();
+        ASSERT_EQ(aoRegions.size(), 2U);
+        EXPECT_EQ(aoRegions[1].nXOff, 200);
+        EXPECT_EQ(aoRegions[1].nYOff, 210);
+        EXPECT_EQ(aoRegions[1].nXSize, 10);
+        EXPECT_EQ(aoRegions[1].nYSize, 10);
+
+        const std::string osSerialized = GDALSerializeRasterWindows(aoRegions);
+        EXPECT_STREQ(osSerialized.c_str(), "0,0,128,128;200,210,10,10");
+        std::vector<GDALRasterWindow> aoParsed;
+        EXPECT_TRUE(GDALParseRasterWindows(osSerialized.c_str(), aoParsed));
+        EXPECT_EQ(aoParsed.size(), 2U);
+        EXPECT_FALSE(GDALParseRasterWindows("1,2,3", aoParsed));
+    }
+
+    // Fill() covers the whole raster, which absorbs previous regions
+    EXPECT_EQ(poBand->Fill(1), CE_None);
+    {
+        const auto aoRegions = poDS->GetDirtyRegions();
+        ASSERT_EQ(aoRegions.size(), 1U);
+        EXPECT_EQ(aoRegions[0].nXSize, 256);
+        EXPECT_EQ(aoRegions[0].nYSize, 256);
+    }
+
+    poDS->ClearDirtyRegions();
+    EXPECT_TRUE(poDS->GetDirtyRegions().empty());
+    EXPECT_TRUE(poDS->IsDirtyRegionTrackingEnabled());
+
+    poDS->EnableDirtyRegionTracking(false);
+    poDS->MarkDirtyRegion(0, 0, 1, 1);
+    EXPECT_TRUE(poDS->GetDirtyRegions().empty());
+}
+
 // Test gdal::gcp class
 TEST_F(test_gdal, gdal_gcp_class)
 {
@@ -3927,4 +4071,173 @@ TEST_F(test_gdal, gdal_gcp_class)
     }
 }
 
+static void CPL_STDCALL CountThreadExitClosing(CPLErr eErr, CPLErrorNum,
+                                               const char *pszMsg)
+{
+    if (eErr == CE_Debug && strstr(pszMsg, "Thread exit: closing"))
+    {
+        ++(*static_cast<std::atomic<int> *>(CPLGetErrorHandlerUserData()));
+    }
+}
+
+// Test that the per-thread datasets of a GDAL_OF_THREAD_SAFE dataset are
+// closed when their thread exits
+TEST_F(test_gdal, thread_safe_dataset_closed_at_thread_exit)
+{
+    GDALDatasetUniquePtr poDS(
+        GDALDataset::Open(GCORE_DATA_DIR "byte.tif",
+                          GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE));
+    ASSERT_NE(poDS, nullptr);
+    auto poBand = poDS->GetRasterBand(1);
+
+    std::atomic<int> nClosed{0};
+    CPLConfigOptionSetter oSetter("CPL_DEBUG", "ON", false);
+    auto pfnOldHandler =
+        CPLSetErrorHandlerEx(CountThreadExitClosing, &nClosed);
+
+    constexpr int NUM_THREADS = 10;
+    for (int i = 0; i < NUM_THREADS; ++i)
+    {
+        std::thread t(
+            [poBand]()
+            { EXPECT_EQ(GDALChecksumImage(poBand, 0, 0, 20, 20), 4672); });
+        t.join();
+    }
+
+    CPLSetErrorHandler(pfnOldHandler);
+    EXPECT_EQ(nClosed.load(), NUM_THREADS);
+
+    // The dataset is still usable after its per-thread datasets are gone
+    EXPECT_EQ(GDALChecksumImage(poBand, 0, 0, 20, 20), 4672);
+}
+
+static void CPL_STDCALL CollectDatasetPoolStatistics(CPLErr eErr, CPLErrorNum,
+                                                     const char *pszMsg)
+{
+    if (eErr == CE_Debug && STARTS_WITH(pszMsg, "Dataset pool: ") &&
+        strstr(pszMsg, " hits, "))
+    {
+        *static_cast<std::string *>(CPLGetErrorHandlerUserData()) = pszMsg;
+    }
+}
+
+// Test concurrent opening and closing of proxy pool datasets, on the same
+// and on different files, with a pool size that causes evictions
+TEST_F(test_gdal, proxy_pool_dataset_multithreaded)
+{
+    GDALDriver *poGTiffDriver =
+        GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (poGTiffDriver == nullptr ||
+        GetGDALDriverManager()->GetDriverByName("VRT") == nullptr)
+    {
+        GTEST_SKIP() << "GTiff or VRT driver missing";
+    }
+
+    // Half of the files are VRTs, whose opening creates proxy pool datasets
+    // for their sources while the pool is already referenced
+    constexpr int NUM_TIFF_FILES = 8;
+    std::vector<std::string> aosFilenames;
+    std::vector<int> anChecksums;
+    for (int i = 0; i < NUM_TIFF_FILES; ++i)
+    {
+        const std::string osTIFFFilename(
+            CPLSPrintf("/vsimem/proxy_pool_dataset_multithreaded_%d.tif", i));
+        {
+            std::unique_ptr<GDALDataset> poDS(poGTiffDriver->Create(
+                osTIFFFilename.c_str(), 32, 32, 1, GDT_Byte, nullptr));
+            ASSERT_NE(poDS, nullptr);
+            poDS->GetRasterBand(1)->Fill(i + 1);
+            anChecksums.push_back(
+                GDALChecksumImage(poDS->GetRasterBand(1), 0, 0, 32, 32));
+        }
+        aosFilenames.push_back(osTIFFFilename);
+
+        const std::string osVRTFilename(
+            CPLSPrintf("/vsimem/proxy_pool_dataset_multithreaded_%d.vrt", i));
+        const std::string osVRT(CPLSPrintf(
+            "<VRTDataset rasterXSize=\"32\" rasterYSize=\"32\">"
+            "<VRTRasterBand dataType=\"Byte\" band=\"1\">"
+            "<SimpleSource>"
+            "<SourceFilename relativeToVRT=\"0\">%s</SourceFilename>"
+            "<SourceBand>1</SourceBand>"
+            "</SimpleSource>"
+            "</VRTRasterBand>"
+            "</VRTDataset>",
+            osTIFFFilename.c_str()));
+        VSIFCloseL(VSIFileFromMemBuffer(
+            osVRTFilename.c_str(),
+            reinterpret_cast<GByte *>(CPLStrdup(osVRT.c_str())), osVRT.size(),
+            /* bTakeOwnership = */ true));
+        aosFilenames.push_back(osVRTFilename);
+        anChecksums.push_back(anChecksums.back());
+    }
+    const int nFiles = static_cast<int>(aosFilenames.size());
+
+    constexpr int NUM_THREADS = 4;
+    constexpr int NUM_ITERS = 50;
+    std::string osStatistics;
+    {
+        // Each thread references at most 2 entries at a time: a VRT and its
+        // source
+        CPLConfigOptionSetter oPoolSizeSetter("GDAL_MAX_DATASET_POOL_SIZE",
+                                              "10", false);
+        CPLConfigOptionSetter oDebugSetter("CPL_DEBUG", "ON", false);
+        auto pfnOldHandler =
+            CPLSetErrorHandlerEx(CollectDatasetPoolStatistics, &osStatistics);
+
+        {
+            // Keeps the pool alive during the test, so that it uses the above
+            // size. It reports its statistics when it is destroyed.
+            GDALProxyPoolDataset oKeepPoolAlive(aosFilenames[0].c_str(), 32,
+                                                32);
+
+            std::vector<std::thread> aoThreads;
+            for (int iThread = 0; iThread < NUM_THREADS; ++iThread)
+            {
+                aoThreads.emplace_back(
+                    [iThread, nFiles, &aosFilenames, &anChecksums]()
+                    {
+                        for (int iIter = 0; iIter < NUM_ITERS; ++iIter)
+                        {
+                            // Threads go through the same files, in different
+                            // orders
+                            const int iFile =
+                                (iThread + iIter * (2 * iThread + 1)) % nFiles;
+                            auto poDS = std::make_unique<GDALProxyPoolDataset>(
+                                aosFilenames[iFile].c_str(), 32, 32,
+                                GA_ReadOnly, /* bShared = */ (iIter % 2) != 0);
+                            poDS->AddSrcBandDescription(GDT_Byte, 32, 32);
+                            EXPECT_EQ(GDALChecksumImage(poDS->GetRasterBand(1),
+                                                        0, 0, 32, 32),
+                                      anChecksums[iFile]);
+                        }
+                    });
+            }
+            for (auto &oThread : aoThreads)
+                oThread.join();
+        }
+
+        CPLSetErrorHandler(pfnOldHandler);
+    }
+
+    for (const auto &osFilename : aosFilenames)
+        VSIUnlink(osFilename.c_str());
+
+    GIntBig nHits = 0;
+    GIntBig nOpens = 0;
+    GIntBig nConcurrentOpens = 0;
+    GIntBig nEvictions = 0;
+    ASSERT_EQ(sscanf(osStatistics.c_str(),
+                     "Dataset pool: " CPL_FRMT_GIB " hits, " CPL_FRMT_GIB
+                     " opens (" CPL_FRMT_GIB " concurrent with another "
+                     "opening of the same dataset), " CPL_FRMT_GIB
+                     " evictions",
+                     &nHits, &nOpens, &nConcurrentOpens, &nEvictions),
+              4)
+        << osStatistics;
+    EXPECT_GE(nHits + nOpens, NUM_THREADS * NUM_ITERS);
+    EXPECT_GE(nOpens, nFiles);
+    EXPECT_GT(nEvictions, 0);
+}
+
 }  // namespace
@@ -0,0 +1,186 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Project:  C++ Test Suite for GDAL/OGR
+// Purpose:  Test GNMGraph shortest path algorithms
+//
+///////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2024, GDAL contributors
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "gdal_unit_test.h"
+
+#include "gnmgraph.h"
+
+#include "gtest_include.h"
+
+#include <vector>
+
+namespace
+{
+
+struct test_gnm : public ::testing::Test
+{
+};
+
+// Two paths of cost 2 from 1 to 4, through 2 and through 3, and a direct
+// edge of cost 5. If bThroughTwoFirst is false, the edges to 3 are added
+// first.
+static void BuildDiamondGraph(GNMGraph &oGraph, bool bThroughTwoFirst = true)
+{
+    if (bThroughTwoFirst)
+    {
+        oGraph.AddEdge(101, 1, 2, false, 1, 1);
+        oGraph.AddEdge(102, 2, 4, false, 1, 1);
+    }
+    oGraph.AddEdge(103, 1, 3, false, 1, 1);
+    oGraph.AddEdge(104, 3, 4, false, 1, 1);
+    if (!bThroughTwoFirst)
+    {
+        oGraph.AddEdge(101, 1, 2, false, 1, 1);
+        oGraph.AddEdge(102, 2, 4, false, 1, 1);
+    }
+    oGraph.AddEdge(105, 1, 4, false, 5, 5);
+}
+
+static const GNMPATH oPathThroughTwo{{1, -1}, {2, 101}, {4, 102}};
+static const GNMPATH oPathThroughThree{{1, -1}, {3, 103}, {4, 104}};
+static const GNMPATH oPathDirect{{1, -1}, {4, 105}};
+
+// Test GNMGraph::DijkstraShortestPath()
+TEST_F(test_gnm, DijkstraShortestPath)
+{
+    GNMGraph oGraph;
+    BuildDiamondGraph(oGraph);
+
+    // Equal-cost paths: the first reached one is returned
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathThroughTwo);
+
+    // Directed edges
+    EXPECT_TRUE(oGraph.DijkstraShortestPath(4, 1).empty());
+
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 1), (GNMPATH{{1, -1}}));
+    EXPECT_TRUE(oGraph.DijkstraShortestPath(1, 12345).empty());
+
+    // Blocked vertices and edges, changed between queries
+    oGraph.ChangeBlockState(2, true);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathThroughThree);
+    oGraph.ChangeBlockState(3, true);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathDirect);
+    oGraph.ChangeBlockState(105, true);
+    EXPECT_TRUE(oGraph.DijkstraShortestPath(1, 4).empty());
+    oGraph.ChangeAllBlockState(false);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathThroughTwo);
+    oGraph.ChangeBlockState(104, true);
+    oGraph.ChangeBlockState(102, true);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathDirect);
+    oGraph.ChangeAllBlockState(false);
+
+    // Changed cost
+    oGraph.ChangeEdge(105, 1.5, 1.5);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathDirect);
+    oGraph.ChangeEdge(105, 5, 5);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathThroughTwo);
+
+    // Changed topology
+    oGraph.DeleteEdge(102);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathThroughThree);
+    oGraph.DeleteVertex(3);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathDirect);
+    oGraph.AddEdge(106, 1, 5, false, 1, 1);
+    oGraph.AddEdge(107, 5, 4, false, 1, 1);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4),
+              (GNMPATH{{1, -1}, {5, 106}, {4, 107}}));
+}
+
+// Test that ties are resolved in the order the edges were added
+TEST_F(test_gnm, DijkstraShortestPath_ties)
+{
+    GNMGraph oGraph;
+    BuildDiamondGraph(oGraph, /* bThroughTwoFirst = */ false);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathThroughThree);
+}
+
+// Test a bidirectional edge, which is walked with its direct cost in both
+// directions
+TEST_F(test_gnm, DijkstraShortestPath_bidirectional)
+{
+    GNMGraph oGraph;
+    oGraph.AddEdge(101, 1, 2, true, 1, 100);
+    oGraph.AddEdge(102, 3, 2, true, 1, 100);
+    oGraph.AddEdge(103, 1, 3, false, 3, 3);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 3),
+              (GNMPATH{{1, -1}, {2, 101}, {3, 102}}));
+    EXPECT_EQ(oGraph.DijkstraShortestPath(3, 1),
+              (GNMPATH{{3, -1}, {2, 102}, {1, 101}}));
+}
+
+// Test GNMGraph::KShortestPaths()
+TEST_F(test_gnm, KShortestPaths)
+{
+    GNMGraph oGraph;
+    BuildDiamondGraph(oGraph);
+
+    EXPECT_TRUE(oGraph.KShortestPaths(1, 4, 0).empty());
+    EXPECT_EQ(oGraph.KShortestPaths(1, 4, 1),
+              (std::vector<GNMPATH>{oPathThroughTwo}));
+
+    // Equal-cost paths come in the order they were found
+    const std::vector<GNMPATH> aoAllPaths{oPathThroughTwo, oPathThroughThree,
+                                          oPathDirect};
+    EXPECT_EQ(oGraph.KShortestPaths(1, 4, 3), aoAllPaths);
+    // No more paths than there are
+    EXPECT_EQ(oGraph.KShortestPaths(1, 4, 5), aoAllPaths);
+
+    EXPECT_TRUE(oGraph.KShortestPaths(4, 1, 3).empty());
+
+    // Blocked vertex
+    oGraph.ChangeBlockState(2, true);
+    EXPECT_EQ(oGraph.KShortestPaths(1, 4, 3),
+              (std::vector<GNMPATH>{oPathThroughThree, oPathDirect}));
+
+    // Blocked edge
+    oGraph.ChangeAllBlockState(false);
+    oGraph.ChangeBlockState(105, true);
+    EXPECT_EQ(oGraph.KShortestPaths(1, 4, 3),
+              (std::vector<GNMPATH>{oPathThroughTwo, oPathThroughThree}));
+
+    // Nothing reachable
+    oGraph.ChangeBlockState(2, true);
+    oGraph.ChangeBlockState(3, true);
+    EXPECT_TRUE(oGraph.KShortestPaths(1, 4, 3).empty());
+
+    // The spur path searches must not leave the edge costs modified
+    oGraph.ChangeAllBlockState(false);
+    EXPECT_EQ(oGraph.KShortestPaths(1, 4, 3), aoAllPaths);
+    EXPECT_EQ(oGraph.DijkstraShortestPath(1, 4), oPathThroughTwo);
+}
+
+// Test that ties are resolved in the order the edges were added
+TEST_F(test_gnm, KShortestPaths_ties)
+{
+    GNMGraph oGraph;
+    BuildDiamondGraph(oGraph, /* bThroughTwoFirst = */ false);
+    EXPECT_EQ(oGraph.KShortestPaths(1, 4, 3),
+              (std::vector<GNMPATH>{oPathThroughThree, oPathThroughTwo,
+                                    oPathDirect}));
+}
+
+}  // namespace
@@ -31,6 +31,7 @@
 #include "ogr_p.h"
 #include "ogrsf_frmts.h"
 #include "../../ogr/ogrsf_frmts/osm/gpb.h"
+#include "../../ogr/ogrsf_frmts/generic/ogrlayerarrow.h"
 #include "ogr_recordbatch.h"
 
 #include <string>
@@ -1481,6 +1482,76 @@ TEST_F(test_ogr, DatasetFeature_and_LayerFeature_iterators)
     }
 }
 
+// Test OGRLayer::GetNextFeatureReusing()
+TEST_F(test_ogr, OGRLayer_GetNextFeatureReusing)
+{
+    std::string file(data_ + SEP + "poly.shp");
+    GDALDatasetUniquePtr poDS(GDALDataset::Open(file.c_str(), GDAL_OF_VECTOR));
+    ASSERT_TRUE(poDS != nullptr);
+    OGRLayer *poLayer = poDS->GetLayer(0);
+    ASSERT_TRUE(poLayer != nullptr);
+
+    const auto ReadAll = [poLayer](bool bReuse)
+    {
+        std::vector<std::string> aosRet;
+        poLayer->ResetReading();
+        OGRFeature *poFeature = nullptr;
+        while ((poFeature = bReuse ? poLayer->GetNextFeatureReusing(poFeature)
+                                   : poLayer->GetNextFeature()) != nullptr)
+        {
+            aosRet.push_back(std::to_string(poFeature->GetFID()) + " " +
+                             poFeature->GetFieldAsString(1) + " " +
+                             poFeature->GetGeometryRef()->exportToWkt());
+            if (!bReuse)
+                delete poFeature;
+        }
+        return aosRet;
+    };
+
+    const auto aosExpected = ReadAll(false);
+    ASSERT_EQ(aosExpected.size(), 10U);
+    EXPECT_EQ(ReadAll(true), aosExpected);
+
+    // Rejected features are recycled too
+    poLayer->SetAttributeFilter("EAS_ID > 170");
+    const auto aosExpectedFiltered = ReadAll(false);
+    ASSERT_EQ(aosExpectedFiltered.size(), 4U);
+    EXPECT_EQ(ReadAll(true), aosExpectedFiltered);
+    poLayer->SetAttributeFilter(nullptr);
+
+    // Feature of another layer definition: destroyed and not reused
+    OGRFeatureDefn *poOtherDefn = new OGRFeatureDefn();
+    poOtherDefn->Reference();
+    poLayer->ResetReading();
+    OGRFeature *poFeature =
+        poLayer->GetNextFeatureReusing(new OGRFeature(poOtherDefn));
+    ASSERT_TRUE(poFeature != nullptr);
+    EXPECT_EQ(poFeature->GetDefnRef(), poLayer->GetLayerDefn());
+    EXPECT_EQ(poFeature->GetFID(), 0);
+    delete poFeature;
+    poOtherDefn->Release();
+
+    // Default implementation, through the C API
+    auto poMemDriver = GetGDALDriverManager()->GetDriverByName("Memory");
+    if (poMemDriver)
+    {
+        GDALDatasetUniquePtr poMemDS(
+            poMemDriver->Create("", 0, 0, 0, GDT_Unknown, nullptr));
+        OGRLayer *poMemLayer = poMemDS->CopyLayer(poLayer, "poly");
+        ASSERT_TRUE(poMemLayer != nullptr);
+        OGRLayerH hLayer = OGRLayer::ToHandle(poMemLayer);
+        int nCount = 0;
+        OGRFeatureH hFeature = nullptr;
+        while ((hFeature = OGR_L_GetNextFeatureReusing(hLayer, hFeature)) !=
+               nullptr)
+        {
+            EXPECT_EQ(OGR_F_GetFID(hFeature), nCount);
+            ++nCount;
+        }
+        EXPECT_EQ(nCount, 10);
+    }
+}
+
 // Test field iterator
 TEST_F(test_ogr, field_iterator)
 {
@@ -3961,4 +4032,417 @@ TEST_F(test_ogr, OGRFeature_SerializeToBinary)
     }
 }
 
+// Test OGRFeature::SetGeomFieldLazyWKB()
+TEST_F(test_ogr, OGRFeature_SetGeomFieldLazyWKB)
+{
+    OGRFeatureDefn oFDefn;
+    oFDefn.Reference();
+    OGRSpatialReference oSRS;
+    oSRS.importFromEPSG(4326);
+    oFDefn.GetGeomFieldDefn(0)->SetSpatialRef(&oSRS);
+
+    OGRLineString oLS;
+    oLS.addPoint(1, 2);
+    oLS.addPoint(3, 4);
+    std::vector<GByte> abyWKB(oLS.WkbSize());
+    OGRwkbExportOptions sOptions;
+    sOptions.eWkbVariant = wkbVariantIso;
+    oLS.exportToWkb(abyWKB.data(), &sOptions);
+
+    {
+        OGRFeature oFeature(&oFDefn);
+        EXPECT_FALSE(oFeature.SetGeomFieldLazyWKB(1, abyWKB.data(),
+                                                  abyWKB.size()));
+        EXPECT_TRUE(
+            oFeature.SetGeomFieldLazyWKB(0, abyWKB.data(), abyWKB.size()));
+
+        // Envelope computed from the WKB content
+        OGREnvelope sEnvelope;
+        EXPECT_TRUE(oFeature.GetGeomFieldEnvelope(0, sEnvelope));
+        EXPECT_EQ(sEnvelope.MinX, 1);
+        EXPECT_EQ(sEnvelope.MinY, 2);
+        EXPECT_EQ(sEnvelope.MaxX, 3);
+        EXPECT_EQ(sEnvelope.MaxY, 4);
+
+        // Clone keeps the lazy geometry
+        std::unique_ptr<OGRFeature> poClone(oFeature.Clone());
+
+        EXPECT_TRUE(oFeature.IsFieldSetAndNotNull(
+            oFDefn.GetFieldCount() + SPF_OGR_GEOMETRY));
+        const OGRGeometry *poGeom = oFeature.GetGeometryRef();
+        ASSERT_NE(poGeom, nullptr);
+        EXPECT_TRUE(poGeom->Equals(&oLS));
+        EXPECT_EQ(poGeom->getSpatialReference(), &oSRS);
+
+        ASSERT_NE(poClone->GetGeometryRef(), nullptr);
+        EXPECT_TRUE(poClone->GetGeometryRef()->Equals(&oLS));
+        EXPECT_TRUE(poClone->Equal(&oFeature));
+    }
+
+    {
+        OGRFeature oFeature(&oFDefn);
+        // Envelope provided by the caller
+        OGREnvelope sEnvelopeIn;
+        sEnvelopeIn.MinX = -1;
+        sEnvelopeIn.MinY = -2;
+        sEnvelopeIn.MaxX = 5;
+        sEnvelopeIn.MaxY = 6;
+        EXPECT_TRUE(oFeature.SetGeomFieldLazyWKB(0, abyWKB.data(),
+                                                 abyWKB.size(), &sEnvelopeIn));
+        OGREnvelope sEnvelope;
+        EXPECT_TRUE(oFeature.GetGeomFieldEnvelope(0, sEnvelope));
+        EXPECT_EQ(sEnvelope, sEnvelopeIn);
+
+        // Setting a geometry discards the lazy one
+        oFeature.SetGeometry(nullptr);
+        EXPECT_EQ(oFeature.GetGeometryRef(), nullptr);
+        EXPECT_FALSE(oFeature.GetGeomFieldEnvelope(0, sEnvelope));
+    }
+
+    {
+        OGRFeature oFeature(&oFDefn);
+        EXPECT_TRUE(
+            oFeature.SetGeomFieldLazyWKB(0, abyWKB.data(), abyWKB.size()));
+        std::unique_ptr<OGRGeometry> poGeom(oFeature.StealGeometry());
+        ASSERT_NE(poGeom, nullptr);
+        EXPECT_TRUE(poGeom->Equals(&oLS));
+        EXPECT_EQ(oFeature.GetGeometryRef(), nullptr);
+    }
+
+    {
+        // Invalid WKB content is only detected when decoding
+        OGRFeature oFeature(&oFDefn);
+        EXPECT_TRUE(oFeature.SetGeomFieldLazyWKB(0, abyWKB.data(), 5));
+        CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+        CPLErrorReset();
+        EXPECT_EQ(oFeature.GetGeometryRef(), nullptr);
+        EXPECT_EQ(CPLGetLastErrorType(), CE_Failure);
+    }
+}
+
+// Test ownership of geometries whose pointers are allocated in the same block
+// as the fields of the feature. Mostly useful when run under ASan.
+TEST_F(test_ogr, OGRFeature_geometries_in_field_block)
+{
+    OGRFeatureDefn oFDefn;
+    oFDefn.Reference();
+    {
+        OGRFieldDefn oFieldDefn("int", OFTInteger);
+        oFDefn.AddFieldDefn(&oFieldDefn);
+    }
+    {
+        OGRFieldDefn oFieldDefn("str", OFTString);
+        oFDefn.AddFieldDefn(&oFieldDefn);
+    }
+    {
+        OGRGeomFieldDefn oGeomFieldDefn("geom2", wkbPoint);
+        oFDefn.AddGeomFieldDefn(&oGeomFieldDefn);
+    }
+    ASSERT_EQ(oFDefn.GetGeomFieldCount(), 2);
+
+    const auto FillFeature = [](OGRFeature &oFeature)
+    {
+        oFeature.SetField(0, 1);
+        oFeature.SetField(1, "foo");
+        oFeature.SetGeomFieldDirectly(0, new OGRPoint(1, 2));
+        oFeature.SetGeomFieldDirectly(1, new OGRPoint(3, 4));
+    };
+
+    // Steal one geometry, replace the other one, and destroy the feature
+    {
+        OGRFeature oFeature(&oFDefn);
+        FillFeature(oFeature);
+        std::unique_ptr<OGRGeometry> poGeom(oFeature.StealGeometry(0));
+        ASSERT_NE(poGeom, nullptr);
+        EXPECT_TRUE(poGeom->Equals(std::make_unique<OGRPoint>(1, 2).get()));
+        EXPECT_EQ(oFeature.GetGeomFieldRef(0), nullptr);
+        EXPECT_EQ(oFeature.SetGeomFieldDirectly(1, new OGRPoint(5, 6)),
+                  OGRERR_NONE);
+        EXPECT_EQ(oFeature.GetGeomFieldRef(1)->toPoint()->getX(), 5);
+        EXPECT_STREQ(oFeature.GetFieldAsString(1), "foo");
+    }
+
+    // Steal the default geometry, then clone the feature
+    {
+        OGRFeature oFeature(&oFDefn);
+        FillFeature(oFeature);
+        std::unique_ptr<OGRGeometry> poGeom(oFeature.StealGeometry());
+        ASSERT_NE(poGeom, nullptr);
+        std::unique_ptr<OGRFeature> poClone(oFeature.Clone());
+        ASSERT_NE(poClone, nullptr);
+        EXPECT_EQ(poClone->GetGeomFieldRef(0), nullptr);
+        ASSERT_NE(poClone->GetGeomFieldRef(1), nullptr);
+        EXPECT_NE(poClone->GetGeomFieldRef(1), oFeature.GetGeomFieldRef(1));
+        EXPECT_TRUE(poClone->Equal(&oFeature));
+
+        // Replacing a geometry of the clone does not affect the source
+        poClone->SetGeomFieldDirectly(0, poGeom.release());
+        EXPECT_EQ(oFeature.GetGeomFieldRef(0), nullptr);
+        EXPECT_NE(poClone->GetGeomFieldRef(0), nullptr);
+    }
+
+    // Copy between features with SetFrom(), then destroy the source first
+    {
+        auto poSrc = std::make_unique<OGRFeature>(&oFDefn);
+        FillFeature(*poSrc);
+        OGRFeature oDst(&oFDefn);
+        EXPECT_EQ(oDst.SetFrom(poSrc.get()), OGRERR_NONE);
+        poSrc.reset();
+        ASSERT_NE(oDst.GetGeomFieldRef(1), nullptr);
+        EXPECT_EQ(oDst.GetGeomFieldRef(1)->toPoint()->getY(), 4);
+    }
+
+    // Remap fields and geometry fields in place
+    {
+        OGRFeature oFeature(&oFDefn);
+        FillFeature(oFeature);
+        const int anRemap[] = {1, 0};
+        EXPECT_EQ(oFeature.RemapGeomFields(nullptr, anRemap), OGRERR_NONE);
+        EXPECT_EQ(oFeature.GetGeomFieldRef(0)->toPoint()->getX(), 3);
+        EXPECT_EQ(oFeature.GetGeomFieldRef(1)->toPoint()->getX(), 1);
+        std::unique_ptr<OGRGeometry> poGeom(oFeature.StealGeometry(1));
+        ASSERT_NE(poGeom, nullptr);
+        std::unique_ptr<OGRFeature> poClone(oFeature.Clone());
+        EXPECT_TRUE(poClone->Equal(&oFeature));
+    }
+
+    {
+        OGRFeature oFeature(&oFDefn);
+        FillFeature(oFeature);
+        const int anRemap[] = {0, 1};
+        EXPECT_EQ(oFeature.RemapFields(nullptr, anRemap), OGRERR_NONE);
+        EXPECT_EQ(oFeature.GetFieldAsInteger(0), 1);
+        EXPECT_STREQ(oFeature.GetFieldAsString(1), "foo");
+        EXPECT_EQ(oFeature.GetGeomFieldRef(0)->toPoint()->getX(), 1);
+        oFeature.SetGeomFieldDirectly(0, new OGRPoint(7, 8));
+        std::unique_ptr<OGRFeature> poClone(oFeature.Clone());
+        EXPECT_TRUE(poClone->Equal(&oFeature));
+    }
+
+    // Append a field after the feature has been created
+    {
+        OGRFeatureDefn oFDefnAppend;
+        oFDefnAppend.Reference();
+        OGRFeature oFeature(&oFDefnAppend);
+        oFeature.SetGeometryDirectly(new OGRPoint(1, 2));
+        OGRFieldDefn oFieldDefn("int", OFTInteger);
+        oFDefnAppend.AddFieldDefn(&oFieldDefn);
+        oFeature.AppendField();
+        oFeature.SetField(0, 3);
+        ASSERT_NE(oFeature.GetGeometryRef(), nullptr);
+        EXPECT_EQ(oFeature.GetGeometryRef()->toPoint()->getX(), 1);
+        oFeature.SetGeometryDirectly(new OGRPoint(4, 5));
+        std::unique_ptr<OGRFeature> poClone(oFeature.Clone());
+        EXPECT_TRUE(poClone->Equal(&oFeature));
+    }
+
+    // Only geometry fields
+    {
+        OGRFeatureDefn oFDefnGeomOnly;
+        oFDefnGeomOnly.Reference();
+        OGRFeature oFeature(&oFDefnGeomOnly);
+        oFeature.SetGeometryDirectly(new OGRPoint(1, 2));
+        std::unique_ptr<OGRFeature> poClone(oFeature.Clone());
+        EXPECT_TRUE(poClone->Equal(&oFeature));
+        std::unique_ptr<OGRGeometry> poGeom(oFeature.StealGeometry());
+        ASSERT_NE(poGeom, nullptr);
+        oFeature.SetGeometryDirectly(poGeom.release());
+    }
+
+    // Only attribute fields
+    {
+        OGRFeatureDefn oFDefnNoGeom;
+        oFDefnNoGeom.Reference();
+        oFDefnNoGeom.DeleteGeomFieldDefn(0);
+        OGRFieldDefn oFieldDefn("str", OFTString);
+        oFDefnNoGeom.AddFieldDefn(&oFieldDefn);
+        OGRFeature oFeature(&oFDefnNoGeom);
+        oFeature.SetField(0, "foo");
+        EXPECT_EQ(oFeature.StealGeometry(), nullptr);
+        EXPECT_NE(oFeature.SetGeometryDirectly(new OGRPoint(1, 2)),
+                  OGRERR_NONE);
+        std::unique_ptr<OGRFeature> poClone(oFeature.Clone());
+        EXPECT_TRUE(poClone->Equal(&oFeature));
+    }
+}
+
+// Test GetArrowStream() with GEOMETRY_ENCODING=GEOARROW, and WriteArrowBatch()
+// with GeoArrow native encoded geometries
+TEST_F(test_ogr, GetArrowStream_WriteArrowBatch_GEOARROW)
+{
+    auto poDrv = GetGDALDriverManager()->GetDriverByName("Memory");
+    if (!poDrv)
+    {
+        GTEST_SKIP() << "Memory driver missing";
+    }
+
+    const struct
+    {
+        OGRwkbGeometryType eLayerGeomType;
+        const char *pszExtensionName;
+        const char *pszWKT;
+        const char *pszExpectedWKT;
+    } asTests[] = {
+        {wkbPoint, "geoarrow.point", "POINT (1 2)", nullptr},
+        {wkbPoint, "geoarrow.point", "POINT EMPTY", nullptr},
+        {wkbPoint25D, "geoarrow.point", "POINT Z (1 2 3)", nullptr},
+        {wkbPointM, "geoarrow.point", "POINT M (1 2 3)", nullptr},
+        {wkbPointZM, "geoarrow.point", "POINT ZM (1 2 3 4)", nullptr},
+        {wkbLineString, "geoarrow.linestring", "LINESTRING (1 2,3 4)", nullptr},
+        {wkbLineString, "geoarrow.linestring", "LINESTRING EMPTY", nullptr},
+        {wkbLineString25D, "geoarrow.linestring",
+         "LINESTRING Z (1 2 3,4 5 6)", nullptr},
+        {wkbPolygon, "geoarrow.polygon",
+         "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 9,9 9,1 1))", nullptr},
+        {wkbMultiPoint, "geoarrow.multipoint", "MULTIPOINT ((1 2),(3 4))",
+         nullptr},
+        {wkbMultiPoint, "geoarrow.multipoint", "POINT (1 2)",
+         "MULTIPOINT ((1 2))"},
+        {wkbMultiLineString, "geoarrow.multilinestring",
+         "MULTILINESTRING ((1 2,3 4),(5 6,7 8,9 10))", nullptr},
+        {wkbMultiPolygon, "geoarrow.multipolygon",
+         "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((10 10,10 11,11 11,10 10),"
+         "(10.1 10.1,10.1 10.9,10.9 10.9,10.1 10.1)))",
+         nullptr},
+        {wkbMultiPolygonZM, "geoarrow.multipolygon",
+         "MULTIPOLYGON ZM (((0 0 1 2,0 1 3 4,1 1 5 6,0 0 1 2)))", nullptr},
+        {wkbMultiPolygon, "geoarrow.multipolygon",
+         "POLYGON ((0 0,0 1,1 1,0 0))", "MULTIPOLYGON (((0 0,0 1,1 1,0 0)))"},
+        // Incompatible geometry type: written as null
+        {wkbPolygon, "geoarrow.polygon", "POINT (1 2)", ""},
+        // No GeoArrow native encoding: WKB is used
+        {wkbGeometryCollection, "ogc.wkb",
+         "GEOMETRYCOLLECTION (POINT (1 2))", nullptr},
+    };
+
+    OGRWktOptions oWktOptions;
+    oWktOptions.variant = wkbVariantIso;
+
+    for (const auto &sTest : asTests)
+    {
+        SCOPED_TRACE(sTest.pszWKT);
+
+        auto poDS = std::unique_ptr<GDALDataset>(
+            poDrv->Create("", 0, 0, 0, GDT_Unknown, nullptr));
+        auto poSrcLayer =
+            poDS->CreateLayer("src", nullptr, sTest.eLayerGeomType, nullptr);
+        ASSERT_NE(poSrcLayer, nullptr);
+        {
+            OGRFeature oFeature(poSrcLayer->GetLayerDefn());
+            OGRGeometry *poGeom = nullptr;
+            OGRGeometryFactory::createFromWkt(sTest.pszWKT, nullptr, &poGeom);
+            ASSERT_NE(poGeom, nullptr);
+            oFeature.SetGeometryDirectly(poGeom);
+            ASSERT_EQ(poSrcLayer->CreateFeature(&oFeature), OGRERR_NONE);
+        }
+        {
+            OGRFeature oFeature(poSrcLayer->GetLayerDefn());
+            ASSERT_EQ(poSrcLayer->CreateFeature(&oFeature), OGRERR_NONE);
+        }
+
+        struct ArrowArrayStream stream;
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("GEOMETRY_ENCODING", "GEOARROW");
+        ASSERT_TRUE(poSrcLayer->GetArrowStream(&stream, aosOptions.List()));
+
+        struct ArrowSchema schema;
+        ASSERT_EQ(stream.get_schema(&stream, &schema), 0);
+        const struct ArrowSchema *psGeomSchema =
+            schema.children[schema.n_children - 1];
+        ASSERT_NE(psGeomSchema->metadata, nullptr);
+        const auto oMetadata = OGRParseArrowMetadata(psGeomSchema->metadata);
+        const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+        ASSERT_TRUE(oIter != oMetadata.end());
+        EXPECT_STREQ(oIter->second.c_str(), sTest.pszExtensionName);
+
+        struct ArrowArray array;
+        {
+            CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+            ASSERT_EQ(stream.get_next(&stream, &array), 0);
+        }
+        ASSERT_NE(array.release, nullptr);
+        ASSERT_EQ(array.length, 2);
+        EXPECT_EQ(array.children[array.n_children - 1]->null_count,
+                  sTest.pszExpectedWKT && sTest.pszExpectedWKT[0] == 0 ? 2
+                                                                       : 1);
+
+        auto poDstLayer =
+            poDS->CreateLayer("dst", nullptr, sTest.eLayerGeomType, nullptr);
+        ASSERT_NE(poDstLayer, nullptr);
+        EXPECT_TRUE(poDstLayer->WriteArrowBatch(&schema, &array, nullptr));
+
+        if (array.release)
+            array.release(&array);
+        schema.release(&schema);
+        stream.release(&stream);
+
+        ASSERT_EQ(poDstLayer->GetFeatureCount(), 2);
+        auto poFeature = std::unique_ptr<OGRFeature>(poDstLayer->GetFeature(1));
+        ASSERT_NE(poFeature, nullptr);
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (sTest.pszExpectedWKT && sTest.pszExpectedWKT[0] == 0)
+        {
+            EXPECT_EQ(poGeom, nullptr);
+        }
+        else
+        {
+            ASSERT_NE(poGeom, nullptr);
+            EXPECT_STREQ(poGeom->exportToWkt(oWktOptions).c_str(),
+                         sTest.pszExpectedWKT ? sTest.pszExpectedWKT
+                                              : sTest.pszWKT);
+        }
+        poFeature.reset(poDstLayer->GetFeature(2));
+        ASSERT_NE(poFeature, nullptr);
+        EXPECT_EQ(poFeature->GetGeometryRef(), nullptr);
+    }
+}
+
+// Test OGRFormatDoublePrecision()
+TEST_F(test_ogr, OGRFormatDoublePrecision)
+{
+    const double adfValues[] = {0.0,
+                                -0.0,
+                                1.0,
+                                -1.5,
+                                0.1,
+                                1.0 / 3,
+                                123456789.123456789,
+                                1e-20,
+                                -1e20,
+                                1.7976931348623157e308,
+                                std::numeric_limits<double>::denorm_min(),
+                                std::numeric_limits<double>::infinity(),
+                                -std::numeric_limits<double>::infinity(),
+                                std::numeric_limits<double>::quiet_NaN()};
+    for (double dfVal : adfValues)
+    {
+        for (int nPrecision : {-1, 0, 1, 6, 15, 17, 18})
+        {
+            for (char chConversionSpecifier : {'f', 'e', 'E', 'g', 'G'})
+            {
+                char szFormatting[32];
+                snprintf(szFormatting, sizeof(szFormatting), "%%.%d%c",
+                         nPrecision < 0 ? 6 : nPrecision,
+                         chConversionSpecifier);
+                char szExpected[512];
+                const int nExpectedLen = CPLsnprintf(
+                    szExpected, sizeof(szExpected), szFormatting, dfVal);
+                char szGot[512];
+                EXPECT_EQ(OGRFormatDoublePrecision(szGot, sizeof(szGot), dfVal,
+                                                   nPrecision,
+                                                   chConversionSpecifier),
+                          nExpectedLen);
+                EXPECT_STREQ(szGot, szExpected) << szFormatting;
+            }
+        }
+    }
+
+    // Truncation
+    char szBuffer[4];
+    EXPECT_EQ(OGRFormatDoublePrecision(szBuffer, sizeof(szBuffer), 1.25, 2,
+                                       'f'),
+              4);
+    EXPECT_STREQ(szBuffer, "1.2");
+}
+
 }  // namespace
@@ -36,7 +36,9 @@
 #include <geos_c.h>
 #endif
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest_include.h"
 
@@ -88,6 +90,55 @@ TEST_F(test_ogr_geos, exportToGEOS)
 #endif
 }
 
+// Test round trip of OGR geometries through GEOS
+TEST_F(test_ogr_geos, exportToGEOS_createFromGEOS)
+{
+#ifdef HAVE_GEOS
+    std::vector<const char *> apszWKT = {
+        "POINT (1 2)",
+        "POINT Z (1 2 3)",
+        "POINT EMPTY",
+        "LINESTRING (0 0,1 1,2 0)",
+        "LINESTRING Z (0 0 1,1 1 2,2 0 3)",
+        "LINESTRING EMPTY",
+        "POLYGON ((0 0,4 0,4 4,0 4,0 0),(1 1,1 2,2 2,2 1,1 1))",
+        "POLYGON Z ((0 0 1,4 0 2,4 4 3,0 4 4,0 0 1))",
+        "POLYGON EMPTY",
+        "MULTIPOINT ((0 0),(1 1))",
+        "MULTIPOINT Z ((0 0 1),(1 1 2))",
+        "MULTILINESTRING ((0 0,1 1),(2 2,3 3))",
+        "MULTIPOLYGON (((0 0,1 0,1 1,0 0)),((2 2,3 2,3 3,2 2)))",
+        "GEOMETRYCOLLECTION (POINT (0 0),LINESTRING (0 0,1 1))",
+        "GEOMETRYCOLLECTION EMPTY",
+    };
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 12)
+    apszWKT.push_back("POINT M (1 2 4)");
+    apszWKT.push_back("POINT ZM (1 2 3 4)");
+    apszWKT.push_back("LINESTRING M (0 0 1,1 1 2)");
+    apszWKT.push_back("POLYGON ZM ((0 0 1 5,4 0 2 6,4 4 3 7,0 0 1 5))");
+#endif
+
+    GEOSContextHandle_t ctxt = OGRGeometry::createGEOSContext();
+    for (const char *pszWKT : apszWKT)
+    {
+        OGRGeometry *poGeom = nullptr;
+        ASSERT_EQ(OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeom),
+                  OGRERR_NONE);
+        std::unique_ptr<OGRGeometry> poGeomHolder(poGeom);
+
+        GEOSGeom geosGeom = poGeom->exportToGEOS(ctxt);
+        ASSERT_TRUE(geosGeom != nullptr) << pszWKT;
+        std::unique_ptr<OGRGeometry> poGeomRoundTrip(
+            OGRGeometryFactory::createFromGEOS(ctxt, geosGeom));
+        GEOSGeom_destroy_r(ctxt, geosGeom);
+        ASSERT_TRUE(poGeomRoundTrip != nullptr) << pszWKT;
+        EXPECT_STREQ(poGeomRoundTrip->exportToWkt().c_str(), pszWKT);
+    }
+    OGRGeometry::freeGEOSContext(ctxt);
+#endif
+}
+
 // Test OGR_G_Contains function
 TEST_F(test_ogr_geos, OGR_G_Contains)
 {
@@ -524,4 +524,304 @@ INSTANTIATE_TEST_SUITE_P(
         OGRWKBIntersectsPessimisticFixture::ParamType> &l_info)
     { return std::get<6>(l_info.param); });
 
+class OGRWKBTransformFixture
+    : public test_ogr_wkb,
+      public ::testing::WithParamInterface<
+          std::tuple<const char *, OGRwkbByteOrder, const char *>>
+{
+  public:
+    static std::vector<std::tuple<const char *, OGRwkbByteOrder, const char *>>
+    GetTupleValues()
+    {
+        return {
+            std::make_tuple("POINT (1 2)", wkbNDR, "POINT"),
+            std::make_tuple("POINT (1 2)", wkbXDR, "POINT_XDR"),
+            std::make_tuple("POINT EMPTY", wkbNDR, "POINT_EMPTY"),
+            std::make_tuple("POINT Z (1 2 3)", wkbNDR, "POINT_3D"),
+            std::make_tuple("POINT ZM (1 2 3 4)", wkbXDR, "POINT_ZM_XDR"),
+            std::make_tuple("LINESTRING (1 2,3 4)", wkbNDR, "LINESTRING"),
+            std::make_tuple("LINESTRING M (1 2 3,4 5 6)", wkbNDR,
+                            "LINESTRING_M"),
+            std::make_tuple("POLYGON ((0 0,0 1,1 1,0 0),(0.2 0.2,0.2 0.8,0.8 "
+                            "0.8,0.2 0.2))",
+                            wkbXDR, "POLYGON_XDR"),
+            std::make_tuple("MULTIPOINT ((1 2),(3 4))", wkbNDR, "MULTIPOINT"),
+            std::make_tuple("MULTIPOLYGON Z (((0 0 1,0 1 2,1 1 3,0 0 1)))",
+                            wkbNDR, "MULTIPOLYGON_3D"),
+            std::make_tuple("GEOMETRYCOLLECTION (POINT (1 2),LINESTRING (3 4,5 "
+                            "6),GEOMETRYCOLLECTION (POINT EMPTY))",
+                            wkbNDR, "GEOMETRYCOLLECTION"),
+            std::make_tuple("CURVEPOLYGON (COMPOUNDCURVE (CIRCULARSTRING (0 "
+                            "0,1 1,2 0),(2 0,0 0)))",
+                            wkbNDR, "CURVEPOLYGON"),
+        };
+    }
+};
+
+// Applies x' = x + 1000, y' = 2 * y, z' = z + 1, and fails on x = -1
+class OGRWKBTestCT final : public OGRCoordinateTransformation
+{
+  public:
+    const OGRSpatialReference *GetSourceCS() const override
+    {
+        return nullptr;
+    }
+
+    const OGRSpatialReference *GetTargetCS() const override
+    {
+        return nullptr;
+    }
+
+    int Transform(size_t nCount, double *x, double *y, double *z, double *,
+                  int *pabSuccess) override
+    {
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            pabSuccess[i] = x[i] != -1;
+            x[i] += 1000;
+            y[i] *= 2;
+            if (z)
+                z[i] += 1;
+        }
+        return TRUE;
+    }
+
+    OGRCoordinateTransformation *Clone() const override
+    {
+        return new OGRWKBTestCT();
+    }
+
+    OGRCoordinateTransformation *GetInverse() const override
+    {
+        return nullptr;
+    }
+};
+
+TEST_P(OGRWKBTransformFixture, test)
+{
+    const char *pszInput = std::get<0>(GetParam());
+    const OGRwkbByteOrder eByteOrder = std::get<1>(GetParam());
+
+    OGRGeometry *poGeom = nullptr;
+    EXPECT_EQ(OGRGeometryFactory::createFromWkt(pszInput, nullptr, &poGeom),
+              OGRERR_NONE);
+    ASSERT_TRUE(poGeom != nullptr);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+
+    OGRWKBTestCT oCT;
+    OGRWKBTransformCache oCache;
+    EXPECT_TRUE(OGRWKBTransform(abyWkb.data(), abyWkb.size(), &oCT, oCache));
+
+    EXPECT_EQ(poGeom->transform(&oCT), OGRERR_NONE);
+    std::vector<GByte> abyExpectedWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(eByteOrder, abyExpectedWkb.data(), wkbVariantIso);
+    delete poGeom;
+    EXPECT_EQ(abyWkb, abyExpectedWkb);
+
+    // Truncated geometry
+    if (abyWkb.size() > 9)
+    {
+        EXPECT_FALSE(OGRWKBTransform(abyWkb.data(), abyWkb.size() - 1, &oCT,
+                                     oCache));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_ogr_wkb, OGRWKBTransformFixture,
+    ::testing::ValuesIn(OGRWKBTransformFixture::GetTupleValues()),
+    [](const ::testing::TestParamInfo<OGRWKBTransformFixture::ParamType>
+           &l_info) { return std::get<2>(l_info.param); });
+
+TEST_F(test_ogr_wkb, OGRWKBTransform_failure)
+{
+    OGRGeometry *poGeom = nullptr;
+    EXPECT_EQ(OGRGeometryFactory::createFromWkt("LINESTRING (1 2,-1 2)",
+                                                nullptr, &poGeom),
+              OGRERR_NONE);
+    ASSERT_TRUE(poGeom != nullptr);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+    delete poGeom;
+    const auto abyWkbOri = abyWkb;
+
+    OGRWKBTestCT oCT;
+    OGRWKBTransformCache oCache;
+    EXPECT_FALSE(OGRWKBTransform(abyWkb.data(), abyWkb.size(), &oCT, oCache));
+    // Left unmodified
+    EXPECT_EQ(abyWkb, abyWkbOri);
+}
+
+
+class OGRWKBFlatGeometryFixture
+    : public test_ogr_wkb,
+      public ::testing::WithParamInterface<
+          std::tuple<const char *, OGRwkbByteOrder, const char *>>
+{
+  public:
+    static std::vector<std::tuple<const char *, OGRwkbByteOrder, const char *>>
+    GetTupleValues()
+    {
+        return {
+            std::make_tuple("POINT EMPTY", wkbNDR, "POINT_EMPTY"),
+            std::make_tuple("POINT (1 2)", wkbNDR, "POINT_NDR"),
+            std::make_tuple("POINT (1 2)", wkbXDR, "POINT_XDR"),
+            std::make_tuple("POINT Z (1 2 3)", wkbNDR, "POINT_Z"),
+            std::make_tuple("POINT M (1 2 3)", wkbNDR, "POINT_M"),
+            std::make_tuple("POINT ZM (1 2 3 4)", wkbXDR, "POINT_ZM"),
+            std::make_tuple("LINESTRING EMPTY", wkbNDR, "LINESTRING_EMPTY"),
+            std::make_tuple("LINESTRING (1 2,3 4)", wkbNDR, "LINESTRING_NDR"),
+            std::make_tuple("LINESTRING (1 2,3 4)", wkbXDR, "LINESTRING_XDR"),
+            std::make_tuple("LINESTRING ZM (1 2 3 4,5 6 7 8)", wkbNDR,
+                            "LINESTRING_ZM"),
+            std::make_tuple("POLYGON EMPTY", wkbNDR, "POLYGON_EMPTY"),
+            std::make_tuple("POLYGON ((0 0,0 1,1 1,0 0),(0.1 0.1,0.1 0.2,0.2 "
+                            "0.2,0.1 0.1))",
+                            wkbNDR, "POLYGON_NDR"),
+            std::make_tuple("POLYGON Z ((0 0 1,0 1 2,1 1 3,0 0 1))", wkbXDR,
+                            "POLYGON_Z_XDR"),
+            std::make_tuple("MULTIPOINT EMPTY", wkbNDR, "MULTIPOINT_EMPTY"),
+            std::make_tuple("MULTIPOINT ((1 2),EMPTY,(3 4))", wkbNDR,
+                            "MULTIPOINT"),
+            std::make_tuple("MULTIPOINT Z ((1 2 3),(4 5 6))", wkbXDR,
+                            "MULTIPOINT_Z"),
+            std::make_tuple("MULTILINESTRING ((1 2,3 4),EMPTY,(5 6,7 8,9 10))",
+                            wkbNDR, "MULTILINESTRING"),
+            std::make_tuple("MULTILINESTRING M ((1 2 3,4 5 6))", wkbXDR,
+                            "MULTILINESTRING_M"),
+            std::make_tuple("MULTIPOLYGON (((0 0,0 1,1 1,0 0)),EMPTY,((10 "
+                            "10,10 11,11 11,10 10),(10.1 10.1,10.1 10.2,10.2 "
+                            "10.2,10.1 10.1)))",
+                            wkbNDR, "MULTIPOLYGON_NDR"),
+            std::make_tuple("MULTIPOLYGON ZM (((0 0 1 2,0 1 3 4,1 1 5 6,0 0 "
+                            "1 2)))",
+                            wkbXDR, "MULTIPOLYGON_ZM_XDR"),
+        };
+    }
+};
+
+TEST_P(OGRWKBFlatGeometryFixture, test)
+{
+    const char *pszInput = std::get<0>(GetParam());
+    const OGRwkbByteOrder eByteOrder = std::get<1>(GetParam());
+
+    OGRGeometry *poGeomRaw = nullptr;
+    EXPECT_EQ(OGRGeometryFactory::createFromWkt(pszInput, nullptr, &poGeomRaw),
+              OGRERR_NONE);
+    ASSERT_TRUE(poGeomRaw != nullptr);
+    std::unique_ptr<OGRGeometry> poGeom(poGeomRaw);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(eByteOrder, abyWkb.data(), wkbVariantIso);
+
+    OGRWKBFlatGeometry oFlat;
+    // Import a first geometry to check that buffers are properly reset
+    {
+        std::unique_ptr<OGRGeometry> poPoint =
+            std::make_unique<OGRPoint>(10, 20, 30);
+        std::vector<GByte> abyPointWkb(poPoint->WkbSize());
+        poPoint->exportToWkb(wkbNDR, abyPointWkb.data(), wkbVariantIso);
+        EXPECT_TRUE(
+            oFlat.ImportFromWkb(abyPointWkb.data(), abyPointWkb.size()));
+        EXPECT_EQ(oFlat.GetGeometryType(), wkbPoint25D);
+    }
+
+    ASSERT_TRUE(oFlat.ImportFromWkb(abyWkb.data(), abyWkb.size()));
+    EXPECT_EQ(oFlat.GetGeometryType(), poGeom->getGeometryType());
+    EXPECT_EQ(oFlat.WkbSize(), abyWkb.size());
+    std::vector<GByte> abyWkbOut;
+    EXPECT_TRUE(oFlat.ExportToWkb(abyWkbOut, eByteOrder));
+    EXPECT_EQ(abyWkbOut, abyWkb);
+
+    auto poGeomOut = oFlat.ToGeometry();
+    ASSERT_TRUE(poGeomOut != nullptr);
+    EXPECT_STREQ(poGeomOut->exportToWkt().c_str(),
+                 poGeom->exportToWkt().c_str());
+
+    OGREnvelope sEnvelope;
+    oFlat.GetEnvelope(sEnvelope);
+    OGREnvelope sExpectedEnvelope;
+    poGeom->getEnvelope(&sExpectedEnvelope);
+    if (!poGeom->IsEmpty())
+    {
+        EXPECT_EQ(sEnvelope.MinX, sExpectedEnvelope.MinX);
+        EXPECT_EQ(sEnvelope.MinY, sExpectedEnvelope.MinY);
+        EXPECT_EQ(sEnvelope.MaxX, sExpectedEnvelope.MaxX);
+        EXPECT_EQ(sEnvelope.MaxY, sExpectedEnvelope.MaxY);
+    }
+
+    // Truncated geometry
+    EXPECT_FALSE(oFlat.ImportFromWkb(abyWkb.data(), abyWkb.size() - 1));
+    EXPECT_EQ(oFlat.GetGeometryType(), wkbUnknown);
+    EXPECT_EQ(oFlat.WkbSize(), 0U);
+    EXPECT_TRUE(oFlat.ToGeometry() == nullptr);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_ogr_wkb, OGRWKBFlatGeometryFixture,
+    ::testing::ValuesIn(OGRWKBFlatGeometryFixture::GetTupleValues()),
+    [](const ::testing::TestParamInfo<OGRWKBFlatGeometryFixture::ParamType>
+           &l_info) { return std::get<2>(l_info.param); });
+
+TEST_F(test_ogr_wkb, OGRWKBFlatGeometry_accessors)
+{
+    OGRGeometry *poGeomRaw = nullptr;
+    EXPECT_EQ(OGRGeometryFactory::createFromWkt(
+                  "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((10 10,10 11,11 11,10 "
+                  "10),(10.1 10.1,10.1 10.2,10.2 10.2,10.1 10.1)))",
+                  nullptr, &poGeomRaw),
+              OGRERR_NONE);
+    ASSERT_TRUE(poGeomRaw != nullptr);
+    std::unique_ptr<OGRGeometry> poGeom(poGeomRaw);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+
+    OGRWKBFlatGeometry oFlat;
+    ASSERT_TRUE(oFlat.ImportFromWkb(abyWkb.data(), abyWkb.size()));
+    ASSERT_EQ(oFlat.GetPartCount(), 2U);
+    EXPECT_EQ(oFlat.GetRingCount(0), 1U);
+    ASSERT_EQ(oFlat.GetRingCount(1), 2U);
+    EXPECT_EQ(oFlat.GetPointCount(0, 0), 4U);
+    ASSERT_EQ(oFlat.GetPointCount(1, 1), 4U);
+    EXPECT_EQ(oFlat.GetPointCount(), 12U);
+    EXPECT_EQ(oFlat.GetPoints(1, 1)[2].x, 10.2);
+    EXPECT_EQ(oFlat.GetPoints(1, 1)[2].y, 10.2);
+    EXPECT_TRUE(oFlat.GetZ(1, 1) == nullptr);
+    EXPECT_TRUE(oFlat.GetM(1, 1) == nullptr);
+
+    // Views can be used to build curves
+    OGRLinearRing oRing;
+    oRing.setPoints(static_cast<int>(oFlat.GetPointCount(1, 0)),
+                    oFlat.GetPoints(1, 0), oFlat.GetZ(1, 0),
+                    oFlat.GetM(1, 0));
+    EXPECT_STREQ(oRing.exportToWkt().c_str(),
+                 "LINEARRING (10 10,10 11,11 11,10 10)");
+}
+
+TEST_F(test_ogr_wkb, OGRWKBFlatGeometry_unsupported)
+{
+    for (const char *pszWKT :
+         {"CIRCULARSTRING (0 0,1 1,2 0)", "GEOMETRYCOLLECTION (POINT (1 2))",
+          "TIN EMPTY"})
+    {
+        OGRGeometry *poGeomRaw = nullptr;
+        EXPECT_EQ(
+            OGRGeometryFactory::createFromWkt(pszWKT, nullptr, &poGeomRaw),
+            OGRERR_NONE);
+        ASSERT_TRUE(poGeomRaw != nullptr);
+        std::unique_ptr<OGRGeometry> poGeom(poGeomRaw);
+        std::vector<GByte> abyWkb(poGeom->WkbSize());
+        poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+
+        OGRWKBFlatGeometry oFlat;
+        EXPECT_FALSE(oFlat.ImportFromWkb(abyWkb.data(), abyWkb.size()));
+    }
+
+    // Sub-geometry of different dimensionality than its parent
+    // (2D MultiPoint with a single Point Z (0 0 0))
+    std::vector<GByte> abyWkb{1, 4, 0, 0, 0, 1, 0, 0, 0, 1, 0xE9, 3, 0, 0};
+    abyWkb.resize(abyWkb.size() + 3 * sizeof(double));
+    OGRWKBFlatGeometry oFlat;
+    EXPECT_FALSE(oFlat.ImportFromWkb(abyWkb.data(), abyWkb.size()));
+}
+
 }  // namespace
@@ -0,0 +1,238 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test the block cache split in several shards (GDAL_CACHE_SHARDS)
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "gdal_priv.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "gtest_include.h"
+
+// Must be run with --config GDAL_CACHE_SHARDS 4
+
+namespace
+{
+
+constexpr int NUM_SHARDS = 4;
+constexpr int BLOCK_SIZE = 256;
+constexpr GIntBig BLOCK_BYTES = BLOCK_SIZE * BLOCK_SIZE;
+constexpr GIntBig MB = 1024 * 1024;
+
+// ---------------------------------------------------------------------------
+
+// Band of one row of nBlocks blocks of BLOCK_SIZE x BLOCK_SIZE bytes
+class ShardTestRasterBand final : public GDALRasterBand
+{
+  public:
+    int m_nWrittenBlocks = 0;
+
+    ShardTestRasterBand(GDALDataset *poDSIn, int nBlocks)
+    {
+        poDS = poDSIn;
+        nBand = 1;
+        eDataType = GDT_Byte;
+        nRasterXSize = BLOCK_SIZE * nBlocks;
+        nRasterYSize = BLOCK_SIZE;
+        nBlockXSize = BLOCK_SIZE;
+        nBlockYSize = BLOCK_SIZE;
+    }
+
+  protected:
+    CPLErr IReadBlock(int nBlockXOff, int, void *pImage) override
+    {
+        memset(pImage, nBlockXOff & 0xff, static_cast<size_t>(BLOCK_BYTES));
+        return CE_None;
+    }
+
+    CPLErr IWriteBlock(int, int, void *) override
+    {
+        m_nWrittenBlocks++;
+        return CE_None;
+    }
+};
+
+class ShardTestDataset final : public GDALDataset
+{
+  public:
+    explicit ShardTestDataset(int nBlocks)
+    {
+        nRasterXSize = BLOCK_SIZE * nBlocks;
+        nRasterYSize = BLOCK_SIZE;
+        eAccess = GA_Update;
+        SetBand(1, new ShardTestRasterBand(this, nBlocks));
+    }
+
+    ShardTestRasterBand *GetBand()
+    {
+        return static_cast<ShardTestRasterBand *>(GetRasterBand(1));
+    }
+};
+
+// Reads all blocks, so that they are cached
+static void ReadAllBlocks(ShardTestDataset &oDS)
+{
+    auto poBand = oDS.GetBand();
+    for (int i = 0; i < poBand->GetXSize() / BLOCK_SIZE; ++i)
+    {
+        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(i, 0);
+        ASSERT_NE(poBlock, nullptr);
+        EXPECT_EQ(static_cast<GByte *>(poBlock->GetDataRef())[0], i & 0xff);
+        poBlock->DropLock();
+    }
+}
+
+static GIntBig GetCacheStatistic(GDALDataset *poDS, const char *pszKey)
+{
+    CPLStringList aosStats(
+        GDALGetCacheStatistics(GDALDataset::ToHandle(poDS)));
+    return CPLAtoGIntBig(aosStats.FetchNameValueDef(pszKey, "0"));
+}
+
+class testblockcacheshards : public ::testing::Test
+{
+  protected:
+    GIntBig m_nOldCacheMax = 0;
+
+    void SetUp() override
+    {
+        if (atoi(CPLGetConfigOption("GDAL_CACHE_SHARDS", "1")) != NUM_SHARDS)
+        {
+            GTEST_SKIP() << "GDAL_CACHE_SHARDS must be set to " << NUM_SHARDS;
+        }
+        m_nOldCacheMax = GDALGetCacheMax64();
+        // Each shard gets 1 MB
+        GDALSetCacheMax64(NUM_SHARDS * MB);
+    }
+
+    void TearDown() override
+    {
+        if (m_nOldCacheMax)
+            GDALSetCacheMax64(m_nOldCacheMax);
+    }
+};
+
+// ---------------------------------------------------------------------------
+
+// Test that all blocks of a dataset go to the same shard, and that a shard
+// does not use more than its part of the budget
+TEST_F(testblockcacheshards, shard_budget)
+{
+    ShardTestDataset oDS(static_cast<int>(4 * MB / BLOCK_BYTES));
+    ReadAllBlocks(oDS);
+
+    EXPECT_LE(GDALGetCacheUsed64(), MB);
+    EXPECT_GE(GDALGetCacheUsed64(), MB - 2 * BLOCK_BYTES);
+    EXPECT_GT(GetCacheStatistic(&oDS, "EVICTIONS"), 0);
+
+    // The last read blocks are still cached
+    const GIntBig nMisses = GetCacheStatistic(&oDS, "MISSES");
+    auto poBlock = oDS.GetBand()->GetLockedBlockRef(
+        oDS.GetBand()->GetXSize() / BLOCK_SIZE - 1, 0);
+    ASSERT_NE(poBlock, nullptr);
+    poBlock->DropLock();
+    EXPECT_EQ(GetCacheStatistic(&oDS, "MISSES"), nMisses);
+}
+
+// Test that datasets are spread over the shards, so that together they can
+// use more than the budget of a single shard
+TEST_F(testblockcacheshards, datasets_spread_over_shards)
+{
+    std::vector<std::unique_ptr<ShardTestDataset>> apoDS;
+    for (int i = 0; i < 16; ++i)
+    {
+        apoDS.emplace_back(std::make_unique<ShardTestDataset>(
+            static_cast<int>(MB / 4 / BLOCK_BYTES)));
+        ReadAllBlocks(*apoDS.back());
+    }
+
+    EXPECT_GT(GDALGetCacheUsed64(), MB + BLOCK_BYTES);
+    EXPECT_LE(GDALGetCacheUsed64(), NUM_SHARDS * MB);
+}
+
+// Test that GDALSetCacheMax64() enforces the new budget in each shard
+TEST_F(testblockcacheshards, set_cache_max)
+{
+    std::vector<std::unique_ptr<ShardTestDataset>> apoDS;
+    for (int i = 0; i < 16; ++i)
+    {
+        apoDS.emplace_back(std::make_unique<ShardTestDataset>(
+            static_cast<int>(MB / 4 / BLOCK_BYTES)));
+        ReadAllBlocks(*apoDS.back());
+    }
+    ASSERT_GT(GDALGetCacheUsed64(), MB);
+
+    GDALSetCacheMax64(MB);
+    EXPECT_LE(GDALGetCacheUsed64(), MB);
+
+    GDALSetCacheMax64(0);
+    EXPECT_EQ(GDALGetCacheUsed64(), 0);
+}
+
+// Test that GDALFlushCacheBlock() goes through all shards, and writes back
+// dirty blocks
+TEST_F(testblockcacheshards, flush_cache_block)
+{
+    // Less blocks than what a shard can hold, so that none is evicted before
+    // GDALFlushCacheBlock() is called
+    constexpr int NUM_DATASETS = 6;
+    constexpr int NUM_BLOCKS = 2;
+    std::vector<std::unique_ptr<ShardTestDataset>> apoDS;
+    for (int i = 0; i < NUM_DATASETS; ++i)
+    {
+        apoDS.emplace_back(std::make_unique<ShardTestDataset>(NUM_BLOCKS));
+        auto poBand = apoDS.back()->GetBand();
+        for (int iBlock = 0; iBlock < NUM_BLOCKS; ++iBlock)
+        {
+            GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(
+                iBlock, 0, /* bJustInitialize = */ true);
+            ASSERT_NE(poBlock, nullptr);
+            poBlock->MarkDirty();
+            poBlock->DropLock();
+        }
+    }
+    ASSERT_GT(GDALGetCacheUsed64(), 0);
+
+    int nFlushed = 0;
+    while (GDALFlushCacheBlock())
+        ++nFlushed;
+    EXPECT_EQ(nFlushed, NUM_DATASETS * NUM_BLOCKS);
+    EXPECT_EQ(GDALGetCacheUsed64(), 0);
+
+    for (auto &poDS : apoDS)
+    {
+        EXPECT_EQ(poDS->GetBand()->m_nWrittenBlocks, NUM_BLOCKS);
+        EXPECT_EQ(GetCacheStatistic(poDS.get(), "DIRTY_BLOCKS_FLUSHED"),
+                  NUM_BLOCKS);
+        EXPECT_EQ(GetCacheStatistic(poDS.get(), "BYTES_WRITTEN_BACK"),
+                  NUM_BLOCKS * BLOCK_BYTES);
+    }
+}
+
+}  // namespace
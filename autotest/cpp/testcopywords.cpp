@@ -30,8 +30,12 @@
 #include "cpl_conv.h"
 #include "gdal.h"
 
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <vector>
 
 #include "gtest_include.h"
 
@@ -957,6 +961,104 @@ TEST_F(TestCopyWords, ByteToByte)
     CPLSetConfigOption("GDAL_USE_SSSE3", nullptr);
 }
 
+// Check that the code paths optimized for packed buffers (SSE2, AVX2) give
+// the same results as the conversion of values one at a time
+TEST_F(TestCopyWords, PackedConversionsMatchSingleValues)
+{
+    const double adfValues[] = {0,
+                                0.5,
+                                -0.5,
+                                1.5,
+                                -1.5,
+                                2.5,
+                                127.5,
+                                -128.5,
+                                255.5,
+                                256,
+                                -32768.5,
+                                32767.5,
+                                65535.5,
+                                2147483647.5,
+                                -2147483648.5,
+                                4294967295.5,
+                                1e10,
+                                -1e10,
+                                3.5e38,
+                                -3.5e38,
+                                std::numeric_limits<double>::quiet_NaN(),
+                                std::numeric_limits<double>::infinity(),
+                                -std::numeric_limits<double>::infinity()};
+    constexpr int N = 67;
+
+    for (int k = 0; k < 2; k++)
+    {
+        if (k == 1)
+            CPLSetConfigOption("GDAL_USE_AVX2", "NO");
+
+        for (GDALDataType eIn = GDT_Byte; eIn < GDT_TypeCount;
+             eIn = static_cast<GDALDataType>(eIn + 1))
+        {
+            for (GDALDataType eOut = GDT_Byte; eOut < GDT_TypeCount;
+                 eOut = static_cast<GDALDataType>(eOut + 1))
+            {
+                if (eIn == eOut || GDALDataTypeIsComplex(eIn) !=
+                                       GDALDataTypeIsComplex(eOut))
+                    continue;
+                const bool bComplex = GDALDataTypeIsComplex(eIn) != 0;
+                const GDALDataType eInComp = GDALGetNonComplexDataType(eIn);
+                const int nInSize = GDALGetDataTypeSizeBytes(eIn);
+                const int nInCompSize = GDALGetDataTypeSizeBytes(eInComp);
+                const int nOutSize = GDALGetDataTypeSizeBytes(eOut);
+
+                std::vector<GByte> abyIn(N * nInSize);
+                for (int i = 0; i < N * (bComplex ? 2 : 1); i++)
+                {
+                    const double dfVal =
+                        (i % 3) == 0
+                            ? adfValues[(i / 3) % CPL_ARRAYSIZE(adfValues)]
+                            : ((i * 7919) % 1000 - 500) * 0.75;
+                    GDALCopyWords(&dfVal, GDT_Float64, 0,
+                                  abyIn.data() + i * nInCompSize, eInComp, 0,
+                                  1);
+                }
+
+                std::vector<GByte> abyOut(N * nOutSize);
+                GDALCopyWords(abyIn.data(), eIn, nInSize, abyOut.data(), eOut,
+                              nOutSize, N);
+
+                for (int i = 0; i < N; i++)
+                {
+                    std::vector<GByte> abyExpected(nOutSize);
+                    GDALCopyWords(abyIn.data() + i * nInSize, eIn, 0,
+                                  abyExpected.data(), eOut, 0, 1);
+                    if (memcmp(abyExpected.data(), abyOut.data() + i * nOutSize,
+                               nOutSize) == 0)
+                        continue;
+                    // Accept different NaN representations
+                    double adfExpected[2] = {0, 0};
+                    double adfGot[2] = {0, 0};
+                    GDALCopyWords(abyExpected.data(), eOut, 0, adfExpected,
+                                  GDT_CFloat64, 0, 1);
+                    GDALCopyWords(abyOut.data() + i * nOutSize, eOut, 0,
+                                  adfGot, GDT_CFloat64, 0, 1);
+                    for (int j = 0; j < 2; j++)
+                    {
+                        if (!(std::isnan(adfExpected[j]) &&
+                              std::isnan(adfGot[j])))
+                        {
+                            EXPECT_EQ(adfGot[j], adfExpected[j])
+                                << GDALGetDataTypeName(eIn) << " -> "
+                                << GDALGetDataTypeName(eOut) << ", i=" << i
+                                << ", k=" << k;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    CPLSetConfigOption("GDAL_USE_AVX2", nullptr);
+}
+
 TEST_F(TestCopyWords, Int16ToInt16)
 {
     memset(pIn, 0xff, 256);
@@ -32,6 +32,7 @@
 import os
 import subprocess
 import sys
+import time
 
 import gdaltest
 import pytest
@@ -965,3 +966,32 @@ def test_band_getitem():
 
     with pytest.raises(IndexError):
         ds[5]
+
+
+###############################################################################
+# Test that the cached listing of a directory is refreshed when the directory
+# is modified
+
+
+@pytest.mark.parametrize("use_cache", ["YES", "NO"])
+def test_basic_test_sibling_files_cache(tmp_path, use_cache):
+
+    filename = str(tmp_path / "test.tif")
+    gdal.Translate(filename, "data/byte.tif")
+    # Make sure the directory was not modified in the same second as it is
+    # listed, so that its listing is cached.
+    t = time.time() - 10
+    os.utime(tmp_path, (t, t))
+
+    with gdal.config_option("GDAL_READDIR_CACHE_ON_OPEN", use_cache):
+        with gdal.Open(filename) as ds:
+            assert ds.GetMetadataItem("foo") is None
+            assert len(ds.GetFileList()) == 1
+
+        with open(filename + ".aux.xml", "wt") as f:
+            f.write(
+                '<PAMDataset><Metadata><MDI key="foo">bar</MDI></Metadata></PAMDataset>'
+            )
+        with gdal.Open(filename) as ds:
+            assert ds.GetMetadataItem("foo") == "bar"
+            assert len(ds.GetFileList()) == 2
@@ -1706,6 +1706,84 @@ def test_cog_overview_count_existing():
     gdal.Unlink(tmpfilename)
 
 
+###############################################################################
+# Test SINGLE_PASS=YES
+
+
+@pytest.mark.parametrize(
+    "resampling,compress",
+    [
+        ("NEAREST", "LZW"),
+        ("AVERAGE", "DEFLATE"),
+        ("CUBIC", "LZW"),
+        ("BILINEAR", "NONE"),
+    ],
+)
+def test_cog_single_pass(tmp_vsimem, resampling, compress):
+
+    # Odd dimensions so that the overview factor is not exactly 2
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/small_world.tif", format="MEM", srcWin=[0, 0, 397, 199]
+    )
+
+    def create(single_pass):
+        filename = str(
+            tmp_vsimem / f"test_cog_single_pass_{resampling}_{single_pass}.tif"
+        )
+        gdal.GetDriverByName("COG").CreateCopy(
+            filename,
+            src_ds,
+            options=[
+                "BLOCKSIZE=32",
+                "RESAMPLING=" + resampling,
+                "COMPRESS=" + compress,
+                "SINGLE_PASS=" + single_pass,
+            ],
+        )
+        return filename
+
+    ref_filename = create("NO")
+    filename = create("YES")
+    _check_cog(filename)
+
+    ref_ds = gdal.Open(ref_filename)
+    ds = gdal.Open(filename)
+    assert ds.GetRasterBand(1).GetOverviewCount() == 4
+    assert ref_ds.GetRasterBand(1).GetOverviewCount() == 4
+    for i in range(3):
+        band = ds.GetRasterBand(i + 1)
+        ref_band = ref_ds.GetRasterBand(i + 1)
+        assert band.Checksum() == ref_band.Checksum()
+        for j in range(band.GetOverviewCount()):
+            assert (
+                band.GetOverview(j).Checksum() == ref_band.GetOverview(j).Checksum()
+            )
+    ds = None
+    ref_ds = None
+
+    assert gdal.VSIStatL(filename).size == gdal.VSIStatL(ref_filename).size
+
+
+###############################################################################
+# Test SINGLE_PASS=YES fallback when there is a mask
+
+
+def test_cog_single_pass_mask(tmp_vsimem):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 100, 100)
+    src_ds.GetRasterBand(1).Fill(255)
+    src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+    filename = str(tmp_vsimem / "test_cog_single_pass_mask.tif")
+    with gdal.quiet_errors():
+        gdal.GetDriverByName("COG").CreateCopy(
+            filename, src_ds, options=["BLOCKSIZE=32", "SINGLE_PASS=YES"]
+        )
+    assert "SINGLE_PASS=YES ignored" in gdal.GetLastErrorMsg()
+    ds = gdal.Open(filename)
+    assert ds.GetRasterBand(1).GetOverviewCount() == 2
+    assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+
+
 ###############################################################################
 # Test JPEGXL compression with alpha
 
@@ -1922,3 +2000,52 @@ def test_cog_stats(tmp_vsimem, nbands, co, src_has_stats, expected_val):
     if expected_val and ds.RasterCount == 2:
         assert ds.GetRasterBand(2).GetMetadataItem("STATISTICS_MINIMUM") == "255"
     ds = None
+
+
+###############################################################################
+# Test that JPEG tiles of a GTiff source are copied as they are
+
+
+def test_cog_copy_raw_jpeg_tiles(tmp_vsimem):
+
+    if "JPEG" not in gdal.GetDriverByName("COG").GetMetadataItem(
+        gdal.DMD_CREATIONOPTIONLIST
+    ):
+        pytest.skip("JPEG not available")
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    gdal.Translate(
+        src_filename,
+        "../gdrivers/data/small_world.tif",
+        creationOptions=[
+            "TILED=YES",
+            "BLOCKXSIZE=64",
+            "BLOCKYSIZE=64",
+            "COMPRESS=JPEG",
+            "PHOTOMETRIC=YCBCR",
+            "JPEG_QUALITY=90",
+        ],
+    )
+    src_ds = gdal.Open(src_filename)
+
+    filename = str(tmp_vsimem / "out.tif")
+    gdal.GetDriverByName("COG").CreateCopy(
+        filename, src_ds, options=["BLOCKSIZE=64", "COMPRESS=JPEG"]
+    )
+    _check_cog(filename)
+    ds = gdal.Open(filename)
+    # The default quality being 75, identical checksums mean the tiles have
+    # not been re-encoded
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+        src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+    ]
+    ds = None
+
+    # Explicit quality: tiles must be re-encoded
+    gdal.GetDriverByName("COG").CreateCopy(
+        filename, src_ds, options=["BLOCKSIZE=64", "COMPRESS=JPEG", "QUALITY=50"]
+    )
+    ds = gdal.Open(filename)
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] != [
+        src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+    ]
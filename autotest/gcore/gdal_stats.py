@@ -905,3 +905,123 @@ def test_stats_mask_band():
     assert src_ds.GetRasterBand(1).ComputeRasterMinMax(False) == (2, 3)
     assert src_ds.GetRasterBand(1).ComputeStatistics(False) == [2, 3, 2.5, 0.5]
     assert src_ds.GetRasterBand(1).GetHistogram(False) == [0, 0, 1, 1] + ([0] * 252)
+
+
+###############################################################################
+# Test multi-threaded computation of statistics and min/max
+
+
+@pytest.mark.parametrize(
+    "datatype", [gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Int16, gdal.GDT_Float32]
+)
+@pytest.mark.parametrize("nodata", [None, 0])
+@pytest.mark.parametrize("with_mask", [False, True])
+def test_stats_multithreaded(datatype, nodata, with_mask):
+
+    if nodata is not None and with_mask:
+        pytest.skip("nodata takes precedence over mask band")
+
+    ds = gdal.GetDriverByName("MEM").Create("", 97, 211, 1, datatype)
+    # Lines of varying content, with a few nodata pixels
+    data = b"".join(
+        struct.pack("B" * 97, *[(x * y) % 251 for x in range(97)]) for y in range(211)
+    )
+    ds.GetRasterBand(1).WriteRaster(0, 0, 97, 211, data, buf_type=gdal.GDT_Byte)
+    if nodata is not None:
+        ds.GetRasterBand(1).SetNoDataValue(nodata)
+    if with_mask:
+        ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+            0, 0, 97, 211, bytes([255 if i % 7 else 0 for i in range(97 * 211)])
+        )
+
+    ref_stats = ds.GetRasterBand(1).ComputeStatistics(False)
+    ref_minmax = ds.GetRasterBand(1).ComputeRasterMinMax(False)
+
+    for num_threads in ("2", "3", "8"):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            stats = ds.GetRasterBand(1).ComputeStatistics(False)
+            assert ds.GetRasterBand(1).ComputeRasterMinMax(False) == ref_minmax
+        assert stats[0] == ref_stats[0]
+        assert stats[1] == ref_stats[1]
+        assert stats[2] == pytest.approx(ref_stats[2], rel=1e-12)
+        assert stats[3] == pytest.approx(ref_stats[3], rel=1e-12)
+        if num_threads == "2":
+            stats_2_threads = stats
+        else:
+            # Deterministic result whatever the number of threads
+            assert stats == stats_2_threads
+
+
+###############################################################################
+# Test ComputeStatistics(), ComputeRasterMinMax() and GetHistogram() on data
+# types that have a SIMD code path, against a pure Python implementation
+
+
+@pytest.mark.parametrize(
+    "datatype,fmt",
+    [
+        (gdal.GDT_Int16, "h"),
+        (gdal.GDT_UInt16, "H"),
+        (gdal.GDT_Int32, "i"),
+        (gdal.GDT_Float32, "f"),
+        (gdal.GDT_Float64, "d"),
+    ],
+)
+@pytest.mark.parametrize("nodata", [None, 5])
+@pytest.mark.parametrize("with_mask", [False, True])
+def test_stats_simd_data_types(datatype, fmt, nodata, with_mask):
+
+    if nodata is not None and with_mask:
+        pytest.skip("nodata takes precedence over mask band")
+
+    width = 37
+    height = 13
+    values = [((i * 7919) % 201) - 100 for i in range(width * height)]
+    if fmt == "H":
+        values = [abs(v) for v in values]
+    if fmt in "fd":
+        values = [v + 0.25 for v in values]
+        for i in range(3, len(values), 11):
+            values[i] = float("nan")
+    mask_values = [0 if i % 5 == 0 else 255 for i in range(width * height)]
+
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, datatype)
+    ds.GetRasterBand(1).WriteRaster(
+        0, 0, width, height, struct.pack(fmt * len(values), *values)
+    )
+    if nodata is not None:
+        ds.GetRasterBand(1).SetNoDataValue(nodata)
+    if with_mask:
+        ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+            0, 0, width, height, bytes(mask_values)
+        )
+
+    valid = [
+        v
+        for i, v in enumerate(values)
+        if not math.isnan(v)
+        and v != nodata
+        and not (with_mask and mask_values[i] == 0)
+    ]
+    mean = sum(valid) / len(valid)
+    stddev = math.sqrt(sum((v - mean) ** 2 for v in valid) / len(valid))
+
+    assert ds.GetRasterBand(1).ComputeRasterMinMax(False) == (min(valid), max(valid))
+    stats = ds.GetRasterBand(1).ComputeStatistics(False)
+    assert stats[0] == min(valid)
+    assert stats[1] == max(valid)
+    assert stats[2] == pytest.approx(mean, rel=1e-12)
+    assert stats[3] == pytest.approx(stddev, rel=1e-12)
+
+    expected_hist = [0] * 20
+    for v in valid:
+        idx = int(math.floor((v - (-50)) * (20 / 100.0)))
+        expected_hist[min(max(idx, 0), 19)] += 1
+    assert (
+        ds.GetRasterBand(1).GetHistogram(
+            -50, 50, buckets=20, include_out_of_range=1, approx_ok=0
+        )
+        == expected_hist
+    )
@@ -137,6 +137,114 @@ def test_geoloc_fill_line(use_temp_datasets):
         )  # 22336 with Intel(R) oneAPI DPC++/C++ Compiler 2022.1.0
 
 
+###############################################################################
+# Test that the backmap does not depend on the number of threads
+
+
+@pytest.mark.parametrize("use_temp_datasets", ["YES", "NO"])
+def test_geoloc_backmap_num_threads(use_temp_datasets):
+
+    ds = gdal.GetDriverByName("MEM").Create("", 200, 372)
+    md = {
+        "LINE_OFFSET": "0",
+        "LINE_STEP": "1",
+        "PIXEL_OFFSET": "0",
+        "PIXEL_STEP": "1",
+        "X_DATASET": "../alg/data/geoloc/longitude_including_pole.tif",
+        "X_BAND": "1",
+        "Y_DATASET": "../alg/data/geoloc/latitude_including_pole.tif",
+        "Y_BAND": "1",
+        "SRS": 'GEOGCS["WGS 84",DATUM["WGS_1984",SPHEROID["WGS 84",6378137,298.257223563,AUTHORITY["EPSG","7030"]],AUTHORITY["EPSG","6326"]],PRIMEM["Greenwich",0,AUTHORITY["EPSG","8901"]],UNIT["degree",0.0174532925199433,AUTHORITY["EPSG","9122"]],AXIS["Latitude",NORTH],AXIS["Longitude",EAST],AUTHORITY["EPSG","4326"]]',
+    }
+    ds.SetMetadata(md, "GEOLOCATION")
+    ds.GetRasterBand(1).Fill(1)
+
+    with gdaltest.config_option("GDAL_GEOLOC_USE_TEMP_DATASETS", use_temp_datasets):
+        ref_ds = gdal.Warp("", ds, format="MEM", transformerOptions=["NUM_THREADS=1"])
+        for num_threads in ("2", "ALL_CPUS"):
+            warped_ds = gdal.Warp(
+                "",
+                ds,
+                format="MEM",
+                transformerOptions=["NUM_THREADS=" + num_threads],
+            )
+            assert warped_ds.GetGeoTransform() == ref_ds.GetGeoTransform()
+            assert (
+                warped_ds.GetRasterBand(1).ReadRaster()
+                == ref_ds.GetRasterBand(1).ReadRaster()
+            )
+
+
+###############################################################################
+# Test GEOLOC_BACKMAP_CACHE_FILENAME
+
+
+@pytest.mark.parametrize("use_temp_datasets", ["YES", "NO"])
+def test_geoloc_backmap_cache_filename(tmp_vsimem, use_temp_datasets):
+
+    ds = gdal.GetDriverByName("MEM").Create("", 200, 372)
+    md = {
+        "LINE_OFFSET": "0",
+        "LINE_STEP": "1",
+        "PIXEL_OFFSET": "0",
+        "PIXEL_STEP": "1",
+        "X_DATASET": "../alg/data/geoloc/longitude_including_pole.tif",
+        "X_BAND": "1",
+        "Y_DATASET": "../alg/data/geoloc/latitude_including_pole.tif",
+        "Y_BAND": "1",
+        "SRS": 'GEOGCS["WGS 84",DATUM["WGS_1984",SPHEROID["WGS 84",6378137,298.257223563,AUTHORITY["EPSG","7030"]],AUTHORITY["EPSG","6326"]],PRIMEM["Greenwich",0,AUTHORITY["EPSG","8901"]],UNIT["degree",0.0174532925199433,AUTHORITY["EPSG","9122"]],AXIS["Latitude",NORTH],AXIS["Longitude",EAST],AUTHORITY["EPSG","4326"]]',
+    }
+    ds.SetMetadata(md, "GEOLOCATION")
+    ds.GetRasterBand(1).Fill(1)
+
+    cache_filename = str(tmp_vsimem / "backmap.tif")
+
+    with gdaltest.config_option("GDAL_GEOLOC_USE_TEMP_DATASETS", use_temp_datasets):
+        ref_ds = gdal.Warp("", ds, format="MEM")
+
+        opts = ["GEOLOC_BACKMAP_CACHE_FILENAME=" + cache_filename]
+        warped_ds = gdal.Warp("", ds, format="MEM", transformerOptions=opts)
+        assert (
+            warped_ds.GetRasterBand(1).ReadRaster()
+            == ref_ds.GetRasterBand(1).ReadRaster()
+        )
+
+        cache_ds = gdal.Open(cache_filename)
+        assert cache_ds.RasterCount == 2
+        assert cache_ds.GetMetadataItem("OVERSAMPLE_FACTOR") == "1.3"
+        assert cache_ds.GetMetadataItem("GEOLOC_X_SIZE") == "200"
+        assert cache_ds.GetMetadataItem("GEOLOC_Y_SIZE") == "372"
+        cache_ds = None
+
+        tr = gdal.Transformer(ds, None, opts)
+        success, geo_pnt = tr.TransformPoint(False, 20.5, 20.5)
+        assert success
+        success, pnt = tr.TransformPoint(True, geo_pnt[0], geo_pnt[1])
+        assert success
+        assert pnt == pytest.approx((20.5, 20.5, 0), abs=1e-3)
+        tr = None
+
+        # Alter the cached backmap to check that it is used afterwards
+        with gdal.Open(cache_filename, gdal.GA_Update) as cache_ds:
+            cache_ds.GetRasterBand(1).Fill(-10)
+            cache_ds.GetRasterBand(2).Fill(-10)
+
+        tr = gdal.Transformer(ds, None, opts)
+        success, pnt = tr.TransformPoint(True, geo_pnt[0], geo_pnt[1])
+        assert not success
+        tr = None
+
+        # A backmap computed with another oversample factor is regenerated
+        opts2 = opts + ["GEOLOC_BACKMAP_OVERSAMPLE_FACTOR=0.5"]
+        tr = gdal.Transformer(ds, None, opts2)
+        success, pnt = tr.TransformPoint(True, geo_pnt[0], geo_pnt[1])
+        assert success
+        assert pnt == pytest.approx((20.5, 20.5, 0), abs=1e-3)
+        tr = None
+        with gdal.Open(cache_filename) as cache_ds:
+            assert cache_ds.GetMetadataItem("OVERSAMPLE_FACTOR") == "0.5"
+
+
 ###############################################################################
 # Test warping from rectified to referenced-by-geoloc
 
@@ -29,6 +29,8 @@
 ###############################################################################
 
 
+import pytest
+
 from osgeo import gdal
 
 ###############################################################################
@@ -100,3 +102,41 @@ def test_identify_4():
             "../gdrivers/data/envi/aea.dat", sibling_files=["aea.dat", "aea.hdr"]
         )
         assert dr is not None, "Did not get a driver!"
+
+
+###############################################################################
+# Test that drivers declaring DMD_OPEN_SIGNATURES are skipped for files
+# not starting with one of them.
+
+
+def test_identify_open_signatures():
+
+    drv = gdal.GetDriverByName("GTiff")
+    signatures = drv.GetMetadataItem(gdal.DMD_OPEN_SIGNATURES)
+    assert signatures
+    assert "49492A00" in signatures.split(" ")
+
+    assert gdal.IdentifyDriverEx("data/byte.tif").GetDescription() == "GTiff"
+
+    drv.SetMetadataItem(gdal.DMD_OPEN_SIGNATURES, "89504E47")
+    try:
+        assert gdal.IdentifyDriverEx("data/byte.tif", allowed_drivers=["GTiff"]) is None
+        with pytest.raises(Exception):
+            gdal.OpenEx("data/byte.tif", allowed_drivers=["GTiff"])
+
+        # Not a file: signatures are not checked
+        assert (
+            gdal.IdentifyDriverEx("GTIFF_DIR:1:data/byte.tif").GetDescription()
+            == "GTiff"
+        )
+
+        # Invalid signatures are ignored
+        with gdal.quiet_errors():
+            drv.SetMetadataItem(gdal.DMD_OPEN_SIGNATURES, "89504E47 XY")
+        ds = gdal.OpenEx("data/byte.tif", allowed_drivers=["GTiff"])
+        assert ds.GetDriver().GetDescription() == "GTiff"
+    finally:
+        drv.SetMetadataItem(gdal.DMD_OPEN_SIGNATURES, signatures)
+
+    ds = gdal.OpenEx("data/byte.tif", allowed_drivers=["GTiff"])
+    assert ds.GetDriver().GetDescription() == "GTiff"
@@ -31,6 +31,8 @@
 
 import os
 import shutil
+import subprocess
+import sys
 
 import gdaltest
 import pytest
@@ -999,6 +1001,150 @@ def test_misc_general_cmd_line_processor(tmp_path):
 ###############################################################################
 
 
+###############################################################################
+# Test gdal.GetCacheStatistics()
+
+
+def test_misc_get_cache_statistics():
+
+    src_ds = gdal.Open("data/byte.tif")
+    before = gdal.GetCacheStatistics()
+    assert set(before.keys()) == set(
+        [
+            "HITS",
+            "MISSES",
+            "EVICTIONS",
+            "DIRTY_BLOCKS_FLUSHED",
+            "BYTES_WRITTEN_BACK",
+            "COMPRESSED_CACHE_HITS",
+            "LOCK_WAIT_TIME",
+        ]
+    )
+
+    src_ds.GetRasterBand(1).ReadRaster()
+    src_ds.GetRasterBand(1).ReadRaster()
+
+    after = gdal.GetCacheStatistics()
+    assert int(after["MISSES"]) > int(before["MISSES"])
+    assert int(after["HITS"]) > int(before["HITS"])
+
+    ds_stats = gdal.GetCacheStatistics(src_ds)
+    assert "LOCK_WAIT_TIME" not in ds_stats
+    assert int(ds_stats["MISSES"]) > 0
+    assert int(ds_stats["HITS"]) > 0
+    assert ds_stats["DIRTY_BLOCKS_FLUSHED"] == "0"
+
+    ds = gdal.GetDriverByName("GTiff").Create(
+        "/vsimem/test_misc_get_cache_statistics.tif", 20, 20
+    )
+    ds.GetRasterBand(1).Fill(1)
+    ds.GetRasterBand(1).WriteRaster(0, 0, 1, 1, b"\x02")
+    ds.FlushCache()
+    ds_stats = gdal.GetCacheStatistics(ds)
+    assert int(ds_stats["DIRTY_BLOCKS_FLUSHED"]) >= 1
+    assert int(ds_stats["BYTES_WRITTEN_BACK"]) >= 20 * 20
+    ds = None
+    gdal.Unlink("/vsimem/test_misc_get_cache_statistics.tif")
+
+
+###############################################################################
+# Test that with GDAL_CACHE_POLICY=2Q, a hot working set survives a line by
+# line scan of a large tiled raster. It must be run in a subprocess since the
+# configuration option is only read once.
+
+
+@pytest.mark.parametrize("policy", ["LRU", "2Q"])
+def test_misc_block_cache_2q_scan_resistance(policy):
+
+    script = """
+from osgeo import gdal
+gdal.UseExceptions()
+drv = gdal.GetDriverByName("GTiff")
+for name, xsize, ysize in (("hot", 512, 512), ("filler", 2048, 1536),
+                           ("scan", 4096, 4096)):
+    ds = drv.Create("/vsimem/" + name + ".tif", xsize, ysize,
+                    options=["TILED=YES", "BLOCKXSIZE=256", "BLOCKYSIZE=256"])
+    ds.GetRasterBand(1).Fill(1)
+    ds = None
+
+def misses(ds):
+    return int(gdal.GetCacheStatistics(ds)["MISSES"])
+
+hot_ds = gdal.Open("/vsimem/hot.tif")
+filler_ds = gdal.Open("/vsimem/filler.tif")
+scan_ds = gdal.Open("/vsimem/scan.tif")
+
+# Make the 4 tiles of hot_ds hot: read them, read more than a quarter of the
+# cache of other blocks, and read them again.
+hot_ds.ReadRaster()
+filler_ds.ReadRaster()
+hot_ds.ReadRaster()
+assert misses(hot_ds) == 4
+
+# Read scan_ds, larger than the cache, line by line
+scan_band = scan_ds.GetRasterBand(1)
+for y in range(scan_ds.RasterYSize):
+    scan_band.ReadRaster(0, y, scan_ds.RasterXSize, 1)
+assert misses(scan_ds) >= 256
+
+hot_ds.ReadRaster()
+print(misses(hot_ds))
+"""
+    env = os.environ.copy()
+    env["GDAL_CACHEMAX"] = "8"
+    env["GDAL_CACHE_POLICY"] = policy
+    ret = subprocess.check_output([sys.executable, "-c", script], env=env).decode(
+        "utf-8"
+    )
+    if policy == "2Q":
+        # The hot tiles are still cached
+        assert ret.strip() == "4"
+    else:
+        assert int(ret.strip()) > 4
+
+
+###############################################################################
+# Test the compressed second tier of the block cache (GDAL_COMPRESSED_CACHEMAX)
+# It must be run in a subprocess since the configuration option is only read
+# once.
+
+
+def test_misc_compressed_block_cache():
+
+    script = """
+from osgeo import gdal
+gdal.UseExceptions()
+ds = gdal.GetDriverByName("GTiff").Create(
+    "/vsimem/tmp.tif", 1024, 1024, 1, options=["TILED=YES"]
+)
+ds.GetRasterBand(1).WriteRaster(0, 0, 1024, 1024, bytes(range(256)) * 4096)
+ds = None
+ds = gdal.Open("/vsimem/tmp.tif")
+print(ds.GetRasterBand(1).Checksum())
+stats = gdal.GetCacheStatistics(ds)
+assert stats["COMPRESSED_CACHE_HITS"] == "0"
+misses_first_pass = int(stats["MISSES"])
+print(ds.GetRasterBand(1).Checksum())
+# All the blocks that were not in the main cache during the second pass come
+# from the compressed cache
+stats = gdal.GetCacheStatistics(ds)
+compressed_hits = int(stats["COMPRESSED_CACHE_HITS"])
+assert compressed_hits > 0
+assert compressed_hits == int(stats["MISSES"]) - misses_first_pass
+"""
+    env = os.environ.copy()
+    env["GDAL_CACHEMAX"] = "0"
+    env["GDAL_COMPRESSED_CACHEMAX"] = "10"
+    ret = subprocess.check_output([sys.executable, "-c", script], env=env).decode(
+        "utf-8"
+    )
+
+    mem_ds = gdal.GetDriverByName("MEM").Create("", 1024, 1024)
+    mem_ds.GetRasterBand(1).WriteRaster(0, 0, 1024, 1024, bytes(range(256)) * 4096)
+    expected_cs = mem_ds.GetRasterBand(1).Checksum()
+    assert ret.split() == [str(expected_cs), str(expected_cs)]
+
+
 def test_misc_cleanup():
 
     try:
@@ -3282,3 +3282,74 @@ def test_rasterio_overview_selection():
         assert ds.GetRasterBand(1).ReadRaster(0, 0, 100, 100, 29, 29)[0] == 2
         assert ds.GetRasterBand(1).ReadRaster(0, 0, 100, 100, 25, 25)[0] == 3
         assert ds.GetRasterBand(1).ReadRaster(0, 0, 100, 100, 24, 24)[0] == 3
+
+
+###############################################################################
+# Test that resampled RasterIO() gives the same result with several threads
+
+
+@pytest.mark.parametrize(
+    "resample_alg",
+    [
+        gdal.GRIORA_Bilinear,
+        gdal.GRIORA_Cubic,
+        gdal.GRIORA_Lanczos,
+        gdal.GRIORA_Average,
+        gdal.GRIORA_Mode,
+        gdal.GRIORA_Gauss,
+    ],
+)
+@pytest.mark.parametrize("nodata", [None, 0])
+def test_rasterio_resampled_multithreaded(resample_alg, nodata):
+
+    src_ds = gdal.Open("../gdrivers/data/small_world.tif")
+    ds = gdal.GetDriverByName("MEM").CreateCopy("", src_ds)
+    if nodata is not None:
+        ds.GetRasterBand(1).SetNoDataValue(nodata)
+    band = ds.GetRasterBand(1)
+
+    for args in [(0, 0, 400, 200, 133, 67), (7.5, 3.25, 301, 177, 57, 101)]:
+        expected = band.ReadRaster(*args, resample_alg=resample_alg)
+        with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+            got = band.ReadRaster(*args, resample_alg=resample_alg)
+        assert got == expected, args
+
+
+###############################################################################
+# Test that GDALDatasetCopyWholeRaster() and GDALRasterBandCopyWholeRaster()
+# give the same result when reads and writes are pipelined
+
+
+@pytest.mark.parametrize("interleave", ["PIXEL", "BAND"])
+def test_rasterio_copy_whole_raster_multithreaded(tmp_vsimem, interleave):
+
+    src_ds = gdal.GetDriverByName("MEM").CreateCopy(
+        "", gdal.Open("../gdrivers/data/small_world.tif")
+    )
+    src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+    src_ds.GetRasterBand(1).GetMaskBand().Fill(255)
+    src_ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+        10, 20, 100, 30, b"\x00" * (100 * 30)
+    )
+
+    out_filename = str(tmp_vsimem / "out.tif")
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "GDAL_SWATH_SIZE": "10000"}
+    ):
+        out_ds = gdal.GetDriverByName("GTiff").CreateCopy(
+            out_filename,
+            src_ds,
+            options=[
+                "TILED=YES",
+                "BLOCKXSIZE=32",
+                "BLOCKYSIZE=32",
+                "INTERLEAVE=" + interleave,
+            ],
+        )
+    assert [
+        out_ds.GetRasterBand(i + 1).Checksum() for i in range(out_ds.RasterCount)
+    ] == [src_ds.GetRasterBand(i + 1).Checksum() for i in range(src_ds.RasterCount)]
+    assert (
+        out_ds.GetRasterBand(1).GetMaskBand().Checksum()
+        == src_ds.GetRasterBand(1).GetMaskBand().Checksum()
+    )
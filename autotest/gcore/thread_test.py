@@ -75,3 +75,68 @@ def test_thread_test_1():
             ret = False
 
     assert ret
+
+
+###############################################################################
+# Test GDAL_OF_THREAD_SAFE
+
+
+def test_thread_test_thread_safe_dataset():
+
+    ds = gdal.OpenEx("data/byte.tif", gdal.OF_RASTER | gdal.OF_THREAD_SAFE)
+    assert ds.IsThreadSafe(gdal.OF_RASTER)
+    assert not ds.IsThreadSafe(gdal.OF_RASTER | gdal.OF_UPDATE)
+    assert ds.GetDriver().ShortName == "GTiff"
+    assert ds.GetGeoTransform() == gdal.Open("data/byte.tif").GetGeoTransform()
+    assert ds.GetSpatialRef() is not None
+    assert ds.GetMetadataItem("AREA_OR_POINT") == "Area"
+    assert ds.GetFileList() == ["data/byte.tif"]
+
+    res = {"ret": True}
+
+    def worker():
+        for i in range(100):
+            if ds.GetRasterBand(1).Checksum() != 4672:
+                res["ret"] = False
+
+    threads = [threading.Thread(target=worker) for i in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert res["ret"]
+
+    assert not gdal.Open("data/byte.tif").IsThreadSafe(gdal.OF_RASTER)
+
+
+def test_thread_test_thread_safe_dataset_overviews_and_mask():
+
+    ds = gdal.OpenEx(
+        "data/test_with_mask_1bit_and_ovr.tif", gdal.OF_RASTER | gdal.OF_THREAD_SAFE
+    )
+    ref_ds = gdal.Open("data/test_with_mask_1bit_and_ovr.tif")
+    band = ds.GetRasterBand(1)
+    ref_band = ref_ds.GetRasterBand(1)
+    assert band.GetOverviewCount() == ref_band.GetOverviewCount()
+    assert band.GetOverview(0).Checksum() == ref_band.GetOverview(0).Checksum()
+    assert band.GetMaskFlags() == ref_band.GetMaskFlags()
+    assert band.GetMaskBand().Checksum() == ref_band.GetMaskBand().Checksum()
+
+
+def test_thread_test_thread_safe_dataset_errors():
+
+    with pytest.raises(Exception, match="only compatible with GDAL_OF_RASTER"):
+        gdal.OpenEx("data/byte.tif", gdal.OF_VECTOR | gdal.OF_THREAD_SAFE)
+
+    with pytest.raises(Exception, match="only compatible with GDAL_OF_RASTER"):
+        gdal.OpenEx(
+            "data/byte.tif", gdal.OF_RASTER | gdal.OF_UPDATE | gdal.OF_THREAD_SAFE
+        )
+
+    ds = gdal.OpenEx("data/byte.tif", gdal.OF_RASTER | gdal.OF_THREAD_SAFE)
+    with pytest.raises(Exception, match="read-only"):
+        ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    with pytest.raises(Exception, match="read-only"):
+        ds.SetMetadataItem("foo", "bar")
+    with pytest.raises(Exception, match="read-only"):
+        ds.GetRasterBand(1).SetNoDataValue(0)
@@ -720,6 +720,44 @@ def test_tiff_ovr_mode_multiband(multiband, read_only):
     gdal.GetDriverByName("GTiff").Delete("/vsimem/test.tif")
 
 
+###############################################################################
+# Check that the fast path of mode resampling for UInt16 data gives the same
+# result as the generic one used for Float32 data
+
+
+@pytest.mark.parametrize("nodata", [None, 3])
+def test_tiff_ovr_mode_uint16(tmp_vsimem, nodata):
+
+    width = 150
+    height = 100
+    # Categorical values, with a few large ones
+    data = [
+        ((x // 5 + y // 7) % 9) * (1 if (x + y) % 11 else 7000)
+        for y in range(height)
+        for x in range(width)
+    ]
+
+    res = {}
+    for dt, fmt in ((gdal.GDT_UInt16, "H"), (gdal.GDT_Float32, "f")):
+        filename = tmp_vsimem / f"test_{fmt}.tif"
+        ds = gdal.GetDriverByName("GTiff").Create(filename, width, height, 1, dt)
+        if nodata is not None:
+            ds.GetRasterBand(1).SetNoDataValue(nodata)
+        ds.GetRasterBand(1).WriteRaster(
+            0, 0, width, height, array.array(fmt, data).tobytes()
+        )
+        ds.BuildOverviews("MODE", [2, 7, 16])
+        res[fmt] = [
+            ds.GetRasterBand(1)
+            .GetOverview(i)
+            .ReadRaster(buf_type=gdal.GDT_Float32)
+            for i in range(3)
+        ]
+        ds = None
+
+    assert res["H"] == res["f"]
+
+
 ###############################################################################
 # Check that we can create overviews on a newly create file (#2621)
 
@@ -2318,6 +2356,181 @@ def test_tiff_ovr_multithreading_multiband():
 ###############################################################################
 
 
+@pytest.mark.parametrize("num_threads", ["2", "8"])
+def test_tiff_ovr_multithreading_multiband_pipeline(tmp_vsimem, num_threads):
+
+    # Test that the reader/resampler/writer pipeline of
+    # GDALRegenerateOverviewsMultiBand produces the same internal overviews
+    # as the single-threaded code path, on several levels.
+    def build(filename, threads):
+        ds = gdal.Translate(
+            filename,
+            "data/stefan_full_rgba.tif",
+            creationOptions=[
+                "COMPRESS=LZW",
+                "TILED=YES",
+                "BLOCKXSIZE=16",
+                "BLOCKYSIZE=16",
+            ],
+        )
+        with gdaltest.config_options(
+            {"GDAL_NUM_THREADS": threads, "GDAL_OVR_CHUNK_MAX_SIZE": "100"}
+        ):
+            ds.BuildOverviews("AVERAGE", [2, 4, 8])
+        ds = None
+        ds = gdal.Open(filename)
+        return [
+            [
+                ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+                for j in range(ds.GetRasterBand(i + 1).GetOverviewCount())
+            ]
+            for i in range(ds.RasterCount)
+        ]
+
+    ref = build(tmp_vsimem / "ref.tif", "1")
+    assert len(ref[0]) == 3
+    assert build(tmp_vsimem / "test.tif", num_threads) == ref
+
+
+###############################################################################
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("nodata", [None, 0])
+def test_tiff_ovr_streaming(tmp_vsimem, num_threads, nodata):
+
+    # Test that GDAL_OVR_STREAMING=YES produces the same overviews as when
+    # reading back each level to compute the next one.
+    def build(filename, streaming):
+        ds = gdal.Translate(
+            filename,
+            "data/stefan_full_rgba.tif",
+            bandList=[1, 2, 3],
+            noData=nodata,
+            creationOptions=[
+                "COMPRESS=LZW",
+                "TILED=YES",
+                "BLOCKXSIZE=16",
+                "BLOCKYSIZE=16",
+            ],
+        )
+        with gdaltest.config_options(
+            {
+                "GDAL_NUM_THREADS": num_threads,
+                "GDAL_OVR_STREAMING": streaming,
+            }
+        ):
+            ds.BuildOverviews("AVERAGE", [2, 4, 8])
+        ds = None
+        ds = gdal.Open(filename)
+        return [
+            [
+                ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+                for j in range(ds.GetRasterBand(i + 1).GetOverviewCount())
+            ]
+            for i in range(ds.RasterCount)
+        ]
+
+    ref = build(tmp_vsimem / "ref.tif", "NO")
+    assert len(ref[0]) == 3
+    assert build(tmp_vsimem / "test.tif", "YES") == ref
+
+
+###############################################################################
+
+
+@pytest.mark.parametrize("external", [False, True])
+def test_tiff_ovr_multithreaded_compression_update(tmp_vsimem, external):
+
+    # Test that NUM_THREADS enables multi-threaded compression of overviews
+    # (and of the overviews of the internal mask) of an uncompressed dataset
+    # opened in update mode without NUM_THREADS
+    def build(filename, options):
+        src_ds = gdal.Translate(
+            "", "data/stefan_full_rgba.tif", format="MEM", bandList=[1, 2, 3]
+        )
+        ds = gdal.GetDriverByName("GTiff").CreateCopy(
+            filename, src_ds, options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"]
+        )
+        if not external:
+            ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+            ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+                0,
+                0,
+                ds.RasterXSize,
+                ds.RasterYSize,
+                b"\xff" * (ds.RasterXSize * ds.RasterYSize // 2),
+                buf_xsize=ds.RasterXSize,
+                buf_ysize=ds.RasterYSize // 2,
+            )
+        ds = None
+        if external:
+            ds = gdal.Open(filename)
+        else:
+            ds = gdal.Open(filename, gdal.GA_Update)
+        with gdal.config_option("GDAL_TIFF_OVR_BLOCKSIZE", "64"):
+            ds.BuildOverviews("AVERAGE", [2, 4], options=["COMPRESS=DEFLATE"] + options)
+        ds = None
+        ds = gdal.Open(filename)
+        ovr = ds.GetRasterBand(1).GetOverview(0)
+        assert ovr.GetDataset().GetMetadataItem(
+            "COMPRESSION", "IMAGE_STRUCTURE"
+        ) == "DEFLATE"
+        ret = [
+            [
+                ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+                for j in range(ds.GetRasterBand(i + 1).GetOverviewCount())
+            ]
+            for i in range(ds.RasterCount)
+        ]
+        if not external:
+            ret.append(ds.GetRasterBand(1).GetMaskBand().GetOverview(0).Checksum())
+        return ret
+
+    ref = build(tmp_vsimem / "ref.tif", [])
+    assert len(ref[0]) == 2
+    assert build(tmp_vsimem / "test.tif", ["NUM_THREADS=4"]) == ref
+
+
+###############################################################################
+
+
+@pytest.mark.parametrize("resampling", ["CUBIC", "CUBICSPLINE", "LANCZOS"])
+@pytest.mark.parametrize("datatype", [gdal.GDT_Byte, gdal.GDT_UInt16])
+def test_tiff_ovr_convolution_simd(tmp_vsimem, resampling, datatype):
+
+    # Test that the AVX2 convolution kernels give the same results as the
+    # generic ones. The convolution code honours GDAL_USE_AVX2 in all builds.
+    maxval = 65535 if datatype == gdal.GDT_UInt16 else 255
+
+    def build(filename, use_avx2):
+        ds = gdal.Translate(
+            filename,
+            "data/stefan_full_rgba.tif",
+            outputType=datatype,
+            scaleParams=[[0, 255, 0, maxval]],
+            creationOptions=["TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32"],
+        )
+        with gdaltest.config_option("GDAL_USE_AVX2", use_avx2):
+            ds.BuildOverviews(resampling, [2, 3])
+        res = []
+        for i in range(ds.RasterCount):
+            for j in range(2):
+                ovr = ds.GetRasterBand(i + 1).GetOverview(j)
+                data = ovr.ReadRaster(buf_type=gdal.GDT_UInt16)
+                res.append(array.array("H", data))
+        return res
+
+    ref = build(tmp_vsimem / "ref.tif", "NO")
+    got = build(tmp_vsimem / "test.tif", "YES")
+    for a, b in zip(ref, got):
+        # Different order of summations may lead to different rounding
+        assert max(abs(x - y) for x, y in zip(a, b)) <= 1
+
+
+###############################################################################
+
+
 def test_tiff_ovr_multithreading_singleband():
 
     # Test multithreading through GDALRegenerateOverviews
@@ -3940,6 +3940,21 @@ def test_tiff_read_mmap_interface(tmp_vsimem, options):
             ds.GetRasterBand(1).Checksum()
 
 
+@pytest.mark.skipif(sys.platform == "win32", reason="not supported on Windows")
+@pytest.mark.parametrize("options", [[], ["TILED=YES"], ["COMPRESS=LZW"]])
+def test_tiff_read_mmap_interface_local_file(tmp_path, options):
+
+    src_ds = gdal.Open("data/byte.tif")
+    tmpfile = str(tmp_path / "tiff_read_mmap_interface.tif")
+
+    gdal.GetDriverByName("GTiff").CreateCopy(tmpfile, src_ds, options=options)
+    with gdal.config_option("GTIFF_USE_MMAP", "YES"):
+        ds = gdal.Open(tmpfile)
+        cs = ds.GetRasterBand(1).Checksum()
+        ds = None
+    assert cs == 4672, (options, cs)
+
+
 ###############################################################################
 # Test reading JPEG compressed file whole last strip height is the full
 # strip height, instead of just the number of lines needed to reach the
@@ -4169,6 +4184,59 @@ def test_tiff_read_cog_strile_arrays_zeroified_when_possible():
     assert cs_mask == 1222
 
 
+###############################################################################
+# Test batched prefetching of the TileOffsets/TileByteCounts arrays
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        [],
+        ["BIGTIFF=YES"],
+        ["ENDIANNESS=BIG"],
+        ["INTERLEAVE=BAND"],
+        ["BLOCKYSIZE=1", "TILED=NO"],
+    ],
+)
+@pytest.mark.parametrize("num_threads", [None, "2"])
+def test_tiff_read_strile_arrays_prefetch(tmp_vsimem, options, num_threads):
+
+    filename = str(tmp_vsimem / "test.tif")
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1024, 1024, 2)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, 1024, 1024, b"".join(bytes([i % 253]) * 1024 for i in range(1024))
+    )
+    src_ds.GetRasterBand(2).WriteRaster(
+        0, 0, 1024, 1024, b"".join(bytes([i % 251]) * 1024 for i in range(1024))
+    )
+    creation_options = ["COMPRESS=DEFLATE"]
+    if "TILED=NO" not in options:
+        creation_options += ["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"]
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename, src_ds, options=creation_options + options
+    )
+
+    open_options = ["NUM_THREADS=" + num_threads] if num_threads else []
+
+    def read(prefetch):
+        with gdaltest.config_options(
+            {
+                "GTIFF_STRILE_ARRAYS_PREFETCH": prefetch,
+                "GTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE": "YES",
+            }
+        ):
+            ds = gdal.OpenEx(filename, open_options=open_options)
+            data = ds.ReadRaster(100, 50, 900, 900)
+            ds = gdal.OpenEx(filename, open_options=open_options)
+            status = ds.GetRasterBand(2).GetDataCoverageStatus(20, 30, 900, 900)
+            return data, status
+
+    data, status = read("YES")
+    assert (data, status) == read("NO")
+    assert data == src_ds.ReadRaster(100, 50, 900, 900)
+    assert status[0] == gdal.GDAL_DATA_COVERAGE_STATUS_DATA
+
+
 ###############################################################################
 # Check that our reading of a COG with /vsicurl is efficient
 
@@ -4957,6 +5025,62 @@ def test_tiff_read_multi_threaded(
     ds = None
 
 
+###############################################################################
+# Test prefetching of the next blocks when reading block by block with
+# NUM_THREADS
+
+
+@pytest.mark.parametrize(
+    "creation_options",
+    [
+        ["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+        ["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16", "INTERLEAVE=BAND"],
+        ["BLOCKYSIZE=4"],
+    ],
+)
+@pytest.mark.parametrize("prefetch", ["YES", "NO"])
+def test_tiff_read_multi_threaded_block_prefetch(
+    tmp_vsimem, creation_options, prefetch
+):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    tmpfile = tmp_vsimem / "test_tiff_read_multi_threaded_block_prefetch.tif"
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        tmpfile, src_ds, options=["COMPRESS=DEFLATE"] + creation_options
+    )
+
+    with gdaltest.config_option("GTIFF_BLOCK_PREFETCH", prefetch):
+        ds = gdal.OpenEx(tmpfile, open_options=["NUM_THREADS=4"])
+    band = ds.GetRasterBand(1)
+    if "TILED=YES" in creation_options:
+        first_blocks = [(0, 0), (1, 0)]
+        next_blocks = [(2, 0), (3, 0)]
+    else:
+        first_blocks = [(0, 0), (0, 1)]
+        next_blocks = [(0, 2), (0, 3)]
+
+    def is_cached(band, xy):
+        return band.GetMetadataItem("IS_BLOCK_CACHED_%d_%d" % xy, "_DEBUG_") == "1"
+
+    assert not any(is_cached(band, xy) for xy in next_blocks)
+
+    # Two sequential block reads trigger the prefetching of the next blocks
+    for xy in first_blocks:
+        band.ReadBlock(*xy)
+    expected = prefetch == "YES"
+    assert all(is_cached(band, xy) == expected for xy in next_blocks)
+    if "INTERLEAVE=BAND" in creation_options:
+        assert not is_cached(ds.GetRasterBand(2), next_blocks[0])
+    else:
+        assert is_cached(ds.GetRasterBand(2), next_blocks[0]) == expected
+
+    # Check that prefetched blocks have the right content
+    for i in range(ds.RasterCount):
+        assert (
+            ds.GetRasterBand(i + 1).Checksum()
+            == src_ds.GetRasterBand(i + 1).Checksum()
+        )
+
 ###############################################################################
 # Test multi-threaded decoding with /vsicurl
 
@@ -5220,3 +5344,86 @@ def test_tiff_read_jpeg_cached_multi_range_issue_9563(tmp_vsimem):
     out = str(tmp_vsimem / "out.tif")
     with gdal.config_option("GTIFF_HAS_OPTIMIZED_READ_MULTI_RANGE", "YES"):
         gdal.Translate(out, vrt, options="-tr 0.000071806 0.000071806 -f COG")
+
+
+###############################################################################
+# Test reading whole blocks of a pixel-interleaved file, which bypasses the
+# block cache
+
+
+@pytest.mark.parametrize("nbands", [2, 3, 4])
+@pytest.mark.parametrize("datatype", [gdal.GDT_Byte, gdal.GDT_UInt16])
+def test_tiff_read_interleaved_blocks_direct(tmp_vsimem, nbands, datatype):
+
+    filename = str(tmp_vsimem / "test.tif")
+    src_ds = gdal.Translate(
+        "",
+        "../gdrivers/data/small_world.tif",
+        format="MEM",
+        bandList=[1, 2, 3, 1][0:nbands],
+        outputType=datatype,
+    )
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        filename,
+        src_ds,
+        options=[
+            "TILED=YES",
+            "BLOCKXSIZE=64",
+            "BLOCKYSIZE=32",
+            "COMPRESS=LZW",
+            "INTERLEAVE=PIXEL",
+        ],
+    )
+
+    def band_per_band(ds, xoff, yoff, xsize, ysize, band_list, buf_type):
+        return b"".join(
+            ds.GetRasterBand(i).ReadRaster(
+                xoff, yoff, xsize, ysize, buf_type=buf_type
+            )
+            for i in band_list
+        )
+
+    ref_ds = gdal.Open(filename)
+    for (xoff, yoff, xsize, ysize) in [(0, 0, 400, 200), (64, 32, 128, 168)]:
+        for band_list in [list(range(1, nbands + 1)), list(range(nbands, 0, -1))]:
+            for buf_type in [datatype, gdal.GDT_Float32]:
+                ds = gdal.Open(filename)
+                got = ds.ReadRaster(
+                    xoff,
+                    yoff,
+                    xsize,
+                    ysize,
+                    band_list=band_list,
+                    buf_type=buf_type,
+                )
+                assert got == band_per_band(
+                    ref_ds, xoff, yoff, xsize, ysize, band_list, buf_type
+                )
+
+                # Pixel interleaved output buffer
+                buf_dt_size = gdal.GetDataTypeSize(buf_type) // 8
+                got = ds.ReadRaster(
+                    xoff,
+                    yoff,
+                    xsize,
+                    ysize,
+                    band_list=band_list,
+                    buf_type=buf_type,
+                    buf_pixel_space=nbands * buf_dt_size,
+                    buf_band_space=buf_dt_size,
+                )
+                mem_ds = gdal.GetDriverByName("MEM").Create(
+                    "", xsize, ysize, nbands, buf_type
+                )
+                mem_ds.WriteRaster(
+                    0,
+                    0,
+                    xsize,
+                    ysize,
+                    got,
+                    buf_pixel_space=nbands * buf_dt_size,
+                    buf_band_space=buf_dt_size,
+                )
+                assert mem_ds.ReadRaster() == band_per_band(
+                    ref_ds, xoff, yoff, xsize, ysize, band_list, buf_type
+                )
@@ -11523,3 +11523,88 @@ def test_tiff_write_copy_mdd():
     ds = None
 
     gdal.Unlink(filename)
+
+
+###############################################################################
+# Test that CreateCopy() copies the compressed tiles as they are when they are
+# compatible with the target
+
+
+@pytest.mark.parametrize("copy_raw_tiles", ["YES", "NO"])
+def test_tiff_write_copy_raw_tiles(tmp_vsimem, copy_raw_tiles):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    gdal.Translate(
+        src_filename,
+        "../gdrivers/data/small_world.tif",
+        creationOptions=[
+            "TILED=YES",
+            "BLOCKXSIZE=64",
+            "BLOCKYSIZE=64",
+            "COMPRESS=DEFLATE",
+            "ZLEVEL=1",
+        ],
+    )
+    src_ds = gdal.Open(src_filename)
+
+    options = ["TILED=YES", "BLOCKXSIZE=64", "BLOCKYSIZE=64", "COMPRESS=DEFLATE"]
+    with gdal.config_option("GTIFF_COPY_RAW_TILES", copy_raw_tiles):
+        # Full copy
+        filename = str(tmp_vsimem / "out.tif")
+        gdal.GetDriverByName("GTiff").CreateCopy(filename, src_ds, options=options)
+        # Subset aligned on tiles
+        subset_filename = str(tmp_vsimem / "subset.tif")
+        gdal.Translate(
+            subset_filename,
+            src_ds,
+            srcWin=[64, 64, 200, 100],
+            creationOptions=options,
+        )
+
+    ds = gdal.Open(filename)
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+        src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+    ]
+    same_sizes = ds.GetRasterBand(1).GetMetadataItem(
+        "BLOCK_SIZE_0_0", "TIFF"
+    ) == src_ds.GetRasterBand(1).GetMetadataItem("BLOCK_SIZE_0_0", "TIFF")
+    assert same_sizes == (copy_raw_tiles == "YES")
+
+    ds = gdal.Open(subset_filename)
+    ref_ds = gdal.Translate("", src_ds, format="MEM", srcWin=[64, 64, 200, 100])
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+        ref_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+    ]
+    same_sizes = ds.GetRasterBand(1).GetMetadataItem(
+        "BLOCK_SIZE_0_0", "TIFF"
+    ) == src_ds.GetRasterBand(1).GetMetadataItem("BLOCK_SIZE_1_1", "TIFF")
+    assert same_sizes == (copy_raw_tiles == "YES")
+
+
+###############################################################################
+# Test that compressed tiles are not copied when the encoding differs
+
+
+def test_tiff_write_copy_raw_tiles_incompatible(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    gdal.Translate(
+        src_filename,
+        "../gdrivers/data/small_world.tif",
+        creationOptions=["TILED=YES", "COMPRESS=DEFLATE", "ZLEVEL=1"],
+    )
+    src_ds = gdal.Open(src_filename)
+
+    filename = str(tmp_vsimem / "out.tif")
+    for options in (
+        ["TILED=YES", "COMPRESS=DEFLATE", "PREDICTOR=2"],
+        ["TILED=YES", "COMPRESS=LZW"],
+        ["TILED=YES", "BLOCKXSIZE=128", "BLOCKYSIZE=128", "COMPRESS=DEFLATE"],
+        ["TILED=YES", "COMPRESS=DEFLATE", "INTERLEAVE=BAND"],
+    ):
+        gdal.GetDriverByName("GTiff").CreateCopy(filename, src_ds, options=options)
+        ds = gdal.Open(filename)
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+            src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+        ], options
+        ds = None
@@ -360,6 +360,27 @@ def test_transformer_5():
     gdal.Unlink("/vsimem/dem.tif")
 
 
+###############################################################################
+# Test that the batched RPC transformation of several points gives the same
+# results as transforming them one at a time.
+
+
+def test_transformer_rpc_batch_consistency():
+
+    ds = gdal.Open("data/rpc.vrt")
+    tr = gdal.Transformer(ds, None, ["METHOD=RPC", "RPC_PIXEL_ERROR_THRESHOLD=0.05"])
+
+    points = [(0.5 + 3 * i, 0.5 + 2 * i, 10 * (i % 3)) for i in range(15)]
+    for bDstToSrc in (0, 1):
+        if bDstToSrc:
+            points, _ = tr.TransformPoints(0, points)
+        batch_pnts, batch_success = tr.TransformPoints(bDstToSrc, points)
+        for i, pnt in enumerate(points):
+            success, ref_pnt = tr.TransformPoint(bDstToSrc, *pnt)
+            assert batch_success[i] == success
+            assert batch_pnts[i] == pytest.approx(ref_pnt, rel=1e-12)
+
+
 ###############################################################################
 # Test RPC convergence bug (bug # 5395)
 
@@ -1077,6 +1098,77 @@ def test_transformer_tps_precision():
     assert maxDiffResult < 1e-3, "at least one transformation exceeds the error bound"
 
 
+###############################################################################
+# Test the local mode of the thin plate spline transformer
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_transformer_tps_local_mode(num_threads):
+
+    ds = gdal.Open("data/gcps_2115.vrt")
+    tr = gdal.Transformer(
+        ds,
+        None,
+        [
+            "METHOD=GCP_TPS",
+            "TPS_MODE=LOCAL",
+            "TPS_LOCAL_GCP_COUNT=100",
+            "NUM_THREADS=" + num_threads,
+        ],
+    )
+    assert tr, "tps transformation could not be computed"
+
+    # The GCPs are still exactly honoured
+    gcps = ds.GetGCPs()
+    pnts, success = tr.TransformPoints(
+        0, [(gcp.GCPPixel, gcp.GCPLine) for gcp in gcps]
+    )
+    assert all(success)
+    for gcp, pnt in zip(gcps, pnts):
+        assert pnt[0] == pytest.approx(gcp.GCPX, abs=1e-3)
+        assert pnt[1] == pytest.approx(gcp.GCPY, abs=1e-3)
+
+    # And the result does not differ much from the global mode elsewhere
+    tr_global = gdal.Transformer(ds, None, ["METHOD=GCP_TPS"])
+    pnts_in = [
+        (
+            0.5 * (gcps[i].GCPPixel + gcps[i + 1].GCPPixel),
+            0.5 * (gcps[i].GCPLine + gcps[i + 1].GCPLine),
+        )
+        for i in range(0, len(gcps) - 1, 10)
+    ]
+    pnts, success = tr.TransformPoints(0, pnts_in)
+    assert all(success)
+    pnts_global, _ = tr_global.TransformPoints(0, pnts_in)
+    max_diff = max(
+        math.hypot(pnt[0] - ref[0], pnt[1] - ref[1])
+        for pnt, ref in zip(pnts, pnts_global)
+    )
+    assert max_diff < 20
+
+    # Inverse transformation. As with the global mode, a few points fail to
+    # converge with reasonable accuracy.
+    pnts_back, success = tr.TransformPoints(1, pnts)
+    assert all(success)
+    count_ok = sum(
+        1
+        for pnt, ref in zip(pnts_back, pnts_in)
+        if abs(pnt[0] - ref[0]) < 1e-2 and abs(pnt[1] - ref[1]) < 1e-2
+    )
+    assert count_ok >= 0.95 * len(pnts_in)
+
+
+def test_transformer_tps_local_mode_invalid():
+
+    ds = gdal.Open("data/gcps_2115.vrt")
+    with pytest.raises(Exception, match="TPS_MODE"):
+        gdal.Transformer(ds, None, ["METHOD=GCP_TPS", "TPS_MODE=invalid"])
+    with pytest.raises(Exception, match="TPS_LOCAL_GCP_COUNT"):
+        gdal.Transformer(
+            ds, None, ["METHOD=GCP_TPS", "TPS_MODE=LOCAL", "TPS_LOCAL_GCP_COUNT=1"]
+        )
+
+
 ###############################################################################
 def test_transformer_image_no_srs():
 
@@ -2233,6 +2233,101 @@ def test_vrt_read_compute_statistics_mosaic_optimization(
         assert vrt_ds.GetRasterBand(1).GetMetadataItem("STATISTICS_MAXIMUM") == "255"
 
 
+###############################################################################
+# Test multi-threaded RasterIO() over non-overlapping sources
+
+
+@pytest.mark.parametrize("overlapping", [False, True])
+def test_vrt_read_multithreaded_sources(tmp_path, overlapping):
+
+    src_ds = gdal.Translate("", "data/rgbsmall.tif", format="MEM")
+    filenames = []
+    for i, (xoff, yoff, xsize, ysize) in enumerate(
+        [(0, 0, 25, 25), (25, 0, 25, 25), (0, 25, 25, 25), (25, 25, 25, 25)]
+    ):
+        if overlapping:
+            xsize += 5
+            ysize += 5
+        filename = str(tmp_path / f"tile{i}.tif")
+        gdal.Translate(
+            filename, src_ds, srcWin=[xoff, yoff, xsize, ysize], format="GTiff"
+        )
+        filenames.append(filename)
+    vrt_filename = str(tmp_path / "mosaic.vrt")
+    gdal.BuildVRT(vrt_filename, filenames).Close()
+
+    def read(open_options=[], config_options={}):
+        with gdaltest.config_options(config_options):
+            ds = gdal.OpenEx(vrt_filename, open_options=open_options)
+            data = ds.ReadRaster(5, 5, 40, 40)
+            band_data = ds.GetRasterBand(2).ReadRaster(5, 5, 40, 40)
+            downsampled_data = ds.ReadRaster(buf_xsize=20, buf_ysize=20)
+        return data, band_data, downsampled_data
+
+    ref = read()
+    assert ref[0] == src_ds.ReadRaster(5, 5, 40, 40)
+    assert read(config_options={"GDAL_NUM_THREADS": "4"}) == ref
+    assert read(open_options=["NUM_THREADS=ALL_CPUS"]) == ref
+    assert read(open_options=["NUM_THREADS=4"]) == ref
+
+    # Errors raised in worker threads are re-emitted in the calling thread
+    gdal.Unlink(filenames[1])
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(vrt_filename)
+        with pytest.raises(Exception):
+            ds.ReadRaster()
+
+
+###############################################################################
+# Test reading a VRT with enough sources to use the spatial index of sources
+
+
+def test_vrt_read_many_sources_spatial_index(tmp_vsimem):
+
+    src_ds = gdal.Translate("", "data/rgbsmall.tif", format="MEM")
+    filenames = []
+    for yoff in range(0, 48, 4):
+        for xoff in range(0, 48, 4):
+            filename = str(tmp_vsimem / f"tile_{xoff}_{yoff}.tif")
+            gdal.Translate(filename, src_ds, srcWin=[xoff, yoff, 4, 4])
+            filenames.append(filename)
+    vrt_filename = str(tmp_vsimem / "mosaic.vrt")
+    gdal.BuildVRT(vrt_filename, filenames).Close()
+
+    ds = gdal.Open(vrt_filename)
+    assert ds.ReadRaster() == src_ds.ReadRaster(0, 0, 48, 48)
+    assert ds.ReadRaster(5, 7, 13, 11) == src_ds.ReadRaster(5, 7, 13, 11)
+    assert ds.GetRasterBand(2).ReadRaster(44, 44, 4, 4) == src_ds.GetRasterBand(
+        2
+    ).ReadRaster(44, 44, 4, 4)
+    assert ds.ReadRaster(
+        3.5, 3.5, 2, 2, buf_xsize=1, buf_ysize=1, resample_alg=gdal.GRIORA_Bilinear
+    ) == gdal.Open(vrt_filename).ReadRaster(
+        3.5, 3.5, 2, 2, buf_xsize=1, buf_ysize=1, resample_alg=gdal.GRIORA_Bilinear
+    )
+
+    # Adding a source must invalidate the spatial index
+    overlay_filename = str(tmp_vsimem / "overlay.tif")
+    overlay_ds = gdal.GetDriverByName("GTiff").Create(overlay_filename, 2, 2)
+    overlay_ds.GetRasterBand(1).Fill(255)
+    overlay_ds.Close()
+    band = ds.GetRasterBand(1)
+    band.SetMetadataItem(
+        "source_0",
+        f"""<SimpleSource>
+      <SourceFilename>{overlay_filename}</SourceFilename>
+      <SourceBand>1</SourceBand>
+      <SrcRect xOff="0" yOff="0" xSize="2" ySize="2" />
+      <DstRect xOff="10" yOff="10" xSize="2" ySize="2" />
+    </SimpleSource>""",
+        "new_vrt_sources",
+    )
+    assert band.ReadRaster(10, 10, 2, 2) == b"\xff" * 4
+    assert band.ReadRaster(12, 12, 2, 2) == src_ds.GetRasterBand(1).ReadRaster(
+        12, 12, 2, 2
+    )
+
+
 ###############################################################################
 # Test ComputeStatistics() mosaic optimization with nodata at VRT band
 
@@ -2639,3 +2734,41 @@ def test_vrt_read_virtual_overviews_match_src_overviews(tmp_vsimem):
     assert vrt_band.GetOverview(1).YSize == 1024
     assert vrt_band.GetOverview(2).XSize == 1024
     assert vrt_band.GetOverview(2).YSize == 512
+
+
+###############################################################################
+# Test that downsampling requests with non-nearest resampling, that cannot be
+# forwarded to each source, acquire data from the source overviews
+
+
+def test_vrt_read_downsampling_from_source_overviews(tmp_vsimem):
+
+    src_filenames = []
+    for i, ovr_factors in enumerate([[2, 4], [2, 4, 8]]):
+        src_filename = str(tmp_vsimem / f"src{i}.tif")
+        ds = gdal.GetDriverByName("GTiff").Create(src_filename, 256, 256)
+        ds.GetRasterBand(1).Fill(10)
+        ds.BuildOverviews("NONE", ovr_factors)
+        for j, val in enumerate([15, 20, 30][0 : len(ovr_factors)]):
+            ds.GetRasterBand(1).GetOverview(j).Fill(val)
+        ds = None
+        src_filenames.append(src_filename)
+
+    # The VRT nodata value is not the one of the sources, hence requests
+    # cannot be forwarded to each source
+    vrt_filename = str(tmp_vsimem / "test.vrt")
+    ds = gdal.BuildVRT(vrt_filename, src_filenames, VRTNodata=255)
+    assert ds.RasterXSize == 512
+    assert ds.GetRasterBand(1).GetOverviewCount() == 0
+
+    # Closest common overview level of the sources is the one with factor 4
+    data = ds.GetRasterBand(1).ReadRaster(
+        buf_xsize=64, buf_ysize=32, resample_alg=gdal.GRIORA_Bilinear
+    )
+    assert data == b"\x14" * (64 * 32)
+
+    # No source overview suitable: use nominal resolution
+    data = ds.GetRasterBand(1).ReadRaster(
+        buf_xsize=384, buf_ysize=192, resample_alg=gdal.GRIORA_Bilinear
+    )
+    assert data == b"\x0A" * (384 * 192)
@@ -28,6 +28,7 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import json
 import sys
 import time
 
@@ -610,6 +611,305 @@ def test_vsicurl_test_retry(server):
         assert "429" in error_msg
 
 
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    cache_dir = tmp_path / "cache"
+    url = "/vsicurl/http://localhost:%d/test_vsicurl_disk_cache.bin" % server.port
+
+    def read():
+        f = gdal.VSIFOpenL(url, "rb")
+        assert f
+        try:
+            return gdal.VSIFReadL(1, 3, f)
+        finally:
+            gdal.VSIFCloseL(f)
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(cache_dir),
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+        }
+    ):
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"first"'},
+        )
+        handler.add("GET", "/test_vsicurl_disk_cache.bin", 200, {}, "foo")
+        with webserver.install_http_handler(handler):
+            assert read() == b"foo"
+
+        assert len([x for x in cache_dir.glob("*/*") if x.is_file()]) == 1
+
+        # Only the in-memory cache is cleared: the content is read from the
+        # disk cache, without GET request
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"first"'},
+        )
+        with webserver.install_http_handler(handler):
+            assert read() == b"foo"
+
+        # The remote file has changed: the disk cache must not be used
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_disk_cache.bin",
+            200,
+            {"Content-Length": "3", "ETag": '"second"'},
+        )
+        handler.add("GET", "/test_vsicurl_disk_cache.bin", 200, {}, "bar")
+        with webserver.install_http_handler(handler):
+            assert read() == b"bar"
+
+        assert len([x for x in cache_dir.glob("*/*") if x.is_file()]) == 2
+
+    gdal.VSICurlClearCache()
+
+    # Disk cache not enabled
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD",
+        "/test_vsicurl_disk_cache.bin",
+        200,
+        {"Content-Length": "3", "ETag": '"first"'},
+    )
+    handler.add("GET", "/test_vsicurl_disk_cache.bin", 200, {}, "baz")
+    with webserver.install_http_handler(handler):
+        assert read() == b"baz"
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test asynchronous readahead of sequential reads
+
+
+def test_vsicurl_readahead(server):
+
+    gdal.VSICurlClearCache()
+
+    data = bytes(i % 251 for i in range(2 * 1024 * 1024))
+
+    class RangeHandler:
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", len(data))
+            request.end_headers()
+
+        def do_GET(self, request):
+            start, end = request.headers["Range"][len("bytes=") :].split("-")
+            start = int(start)
+            end = min(int(end), len(data) - 1)
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(data))
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.end_headers()
+            request.wfile.write(data[start : end + 1])
+
+    filename = "/vsicurl/http://localhost:%d/test_vsicurl_readahead.bin" % server.port
+
+    gdal.NetworkStatsReset()
+    with webserver.install_http_handler(RangeHandler()), gdal.config_options(
+        {
+            "CPL_VSIL_CURL_READAHEAD_DEPTH": "4",
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+        }
+    ), gdaltest.config_option(
+        "CPL_VSIL_NETWORK_STATS_ENABLED", "YES", thread_local=False
+    ):
+        f = gdal.VSIFOpenL(filename, "rb")
+        assert f
+        got = []
+        try:
+            while True:
+                chunk = gdal.VSIFReadL(1, 10000, f)
+                if not chunk:
+                    break
+                got.append(chunk)
+        finally:
+            gdal.VSIFCloseL(f)
+
+    assert b"".join(got) == data
+
+    j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+    gdal.NetworkStatsReset()
+    assert "ReadAhead" in j["handlers"]["vsicurl"]["files"][filename]["actions"]
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test gdal.PrefetchMetadata()
+
+
+def test_vsicurl_prefetch_metadata(server):
+
+    gdal.VSICurlClearCache()
+
+    base = "/vsicurl/http://localhost:%d/test_vsicurl_prefetch_metadata" % server.port
+    filenames = [base + "/%d.tif" % i for i in range(3)]
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    for i in range(3):
+        handler.add(
+            "HEAD",
+            "/test_vsicurl_prefetch_metadata/%d.tif" % i,
+            200,
+            {"Content-Length": str(i + 1)},
+        )
+        handler.add("HEAD", "/test_vsicurl_prefetch_metadata/%d.tif.aux.xml" % i, 404)
+    with gdaltest.config_option(
+        "GDAL_DISABLE_READDIR_ON_OPEN", "YES"
+    ), webserver.install_http_handler(handler):
+        assert gdal.PrefetchMetadata(
+            filenames, options=["EXTRA_SUFFIXES=.aux.xml", "NUM_THREADS=2"]
+        )
+
+    # Everything is now served from the cache of file properties
+    with gdaltest.config_option(
+        "GDAL_DISABLE_READDIR_ON_OPEN", "YES"
+    ), webserver.install_http_handler(webserver.SequentialHandler()):
+        for i, filename in enumerate(filenames):
+            assert gdal.VSIStatL(filename).size == i + 1
+            assert gdal.VSIStatL(filename + ".aux.xml") is None
+
+
+###############################################################################
+# Test latency histograms, retry, throttling and over-fetch network statistics
+
+
+def test_vsicurl_network_stats_latency(server):
+
+    gdal.VSICurlClearCache()
+
+    data = bytes(i % 251 for i in range(1000000))
+
+    class RangeHandler:
+        def __init__(self):
+            self.throttled = False
+
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", len(data))
+            request.end_headers()
+
+        def do_GET(self, request):
+            if not self.throttled:
+                self.throttled = True
+                request.send_response(503)
+                request.send_header("Content-Length", 0)
+                request.end_headers()
+                return
+            start, end = request.headers["Range"][len("bytes=") :].split("-")
+            start = int(start)
+            end = min(int(end), len(data) - 1)
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(data))
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.end_headers()
+            request.wfile.write(data[start : end + 1])
+
+    filename = "/vsicurl/http://localhost:%d/test_vsicurl_network_stats.bin" % (
+        server.port
+    )
+
+    gdal.NetworkStatsReset()
+    with webserver.install_http_handler(RangeHandler()), gdal.config_options(
+        {
+            "GDAL_HTTP_MAX_RETRY": "1",
+            "GDAL_HTTP_RETRY_DELAY": "0.01",
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+        }
+    ), gdaltest.config_option(
+        "CPL_VSIL_NETWORK_STATS_ENABLED", "YES", thread_local=False
+    ):
+        f = gdal.VSIFOpenL(filename, "rb")
+        assert f
+        try:
+            with gdaltest.error_handler():
+                assert gdal.VSIFReadL(1, 100, f) == data[0:100]
+            # Sequential read: 2 blocks are downloaded, only one is used
+            gdal.VSIFSeekL(f, 16384, 0)
+            assert gdal.VSIFReadL(1, 100, f) == data[16384 : 16384 + 100]
+        finally:
+            gdal.VSIFCloseL(f)
+
+    j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+    gdal.NetworkStatsReset()
+
+    file_stats = j["handlers"]["vsicurl"]["files"][filename]
+    read_stats = file_stats["actions"]["Read"]
+    assert read_stats["retries"]["count"] == 1
+    assert read_stats["throttled"]["count"] == 1
+    for key in ("time_to_first_byte", "total"):
+        latency = read_stats["latency"][key]
+        assert latency["count"] == 3
+        assert sum(latency["histogram_ms"].values()) == 3
+        assert latency["max_ms"] >= latency["mean_ms"]
+    assert file_stats["over_fetch"]["wasted_bytes"] == 16384
+    assert j["over_fetch"]["wasted_bytes"] == 16384
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test reading with and without the process-wide DNS / TLS session share handle
+
+
+@pytest.mark.parametrize("share", ["YES", "NO"])
+def test_vsicurl_share_tls_sessions(server, share):
+
+    gdal.VSICurlClearCache()
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD", "/test_vsicurl_share_tls_sessions.bin", 200, {"Content-Length": "3"}
+    )
+    handler.add("GET", "/test_vsicurl_share_tls_sessions.bin", 200, {}, "foo")
+    with webserver.install_http_handler(handler), gdal.config_options(
+        {
+            "CPL_VSIL_CURL_SHARE_TLS_SESSIONS": share,
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+        }
+    ):
+        f = gdal.VSIFOpenL(
+            "/vsicurl/http://localhost:%d/test_vsicurl_share_tls_sessions.bin"
+            % server.port,
+            "rb",
+        )
+        assert f
+        try:
+            assert gdal.VSIFReadL(1, 3, f) == b"foo"
+        finally:
+            gdal.VSIFCloseL(f)
+
+    gdal.VSICurlClearCache()
+
+
 ###############################################################################
 
 
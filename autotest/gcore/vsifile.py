@@ -30,8 +30,10 @@
 ###############################################################################
 
 import os
+import struct
 import sys
 import time
+import zlib
 
 import gdaltest
 import pytest
@@ -249,6 +251,56 @@ def test_vsifile_5(cache_size):
     gdal.Unlink("tmp/vsifile_5.bin")
 
 
+###############################################################################
+# Test process-wide vsicache shared by handles
+
+
+@pytest.mark.parametrize("prefetch_blocks", ("0", "4"))
+def test_vsifile_vsicache_shared(tmp_path, prefetch_blocks):
+
+    tmpfilename = str(tmp_path / "test_vsifile_vsicache_shared.bin")
+    ref_data = b"".join([b"%08X" % i for i in range(5 * 32768)])
+    with open(tmpfilename, "wb") as f:
+        f.write(ref_data)
+    mtime = int(os.stat(tmpfilename).st_mtime)
+
+    def read_all():
+        fp = gdal.VSIFOpenL(tmpfilename, "rb")
+        assert fp
+        try:
+            data = b""
+            while True:
+                chunk = gdal.VSIFReadL(1, 10000, fp)
+                if not chunk:
+                    break
+                data += chunk
+            gdal.VSIFSeekL(fp, 100000, 0)
+            assert gdal.VSIFReadL(1, 5, fp) == data[100000:100005]
+            return data
+        finally:
+            gdal.VSIFCloseL(fp)
+
+    with gdal.config_options(
+        {
+            "VSI_CACHE": "YES",
+            "VSI_CACHE_SHARED": "YES",
+            "VSI_CACHE_PREFETCH_BLOCKS": prefetch_blocks,
+        }
+    ):
+        assert read_all() == ref_data
+
+        # Rewrite the file with the same size and modification time:
+        # the data cached when reading it from the first handle is reused.
+        with open(tmpfilename, "wb") as f:
+            f.write(b"X" * len(ref_data))
+        os.utime(tmpfilename, (mtime, mtime))
+        assert read_all() == ref_data
+
+        # Blocks are not reused once the modification time changes
+        os.utime(tmpfilename, (mtime + 10, mtime + 10))
+        assert read_all() == b"X" * len(ref_data)
+
+
 ###############################################################################
 # Test vsicache an read errors (https://github.com/qgis/QGIS/issues/45293)
 
@@ -837,6 +889,68 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test reading a BGZF (blocked gzip) file
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_vsigzip_bgzf(tmp_vsimem, num_threads):
+
+    data = b"".join(b"%d,line %d\n" % (i, i * 7) for i in range(50000))
+
+    def bgzf_block(chunk):
+        compressor = zlib.compressobj(6, zlib.DEFLATED, -15)
+        deflated = compressor.compress(chunk) + compressor.flush()
+        header = b"\x1f\x8b\x08\x04\x00\x00\x00\x00\x00\xff\x06\x00"
+        header += b"BC" + struct.pack("<HH", 2, len(deflated) + 25)
+        return header + deflated + struct.pack("<II", zlib.crc32(chunk), len(chunk))
+
+    block_size = 10000
+    bgzf_data = b"".join(
+        bgzf_block(data[i : i + block_size]) for i in range(0, len(data), block_size)
+    )
+    bgzf_data += bgzf_block(b"")
+
+    filename = str(tmp_vsimem / "test.bgz")
+    gdal.FileFromMemBuffer(filename, bgzf_data)
+
+    with gdaltest.config_options(
+        {
+            "GDAL_NUM_THREADS": num_threads,
+            "CPL_VSIL_INFLATE_IN_MEMORY_MAX_SIZE": "0",
+        }
+    ):
+        assert gdal.VSIStatL("/vsigzip/" + filename).size == len(data)
+
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f is not None
+        try:
+            assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+            assert gdal.VSIFEofL(f)
+            for offset in (len(data) - 5, 0, block_size - 3, 12345, 5 * block_size):
+                assert gdal.VSIFSeekL(f, offset, 0) == 0
+                assert gdal.VSIFReadL(1, 2 * block_size, f) == data[
+                    offset : offset + 2 * block_size
+                ]
+            assert gdal.VSIFSeekL(f, 0, 2) == 0
+            assert gdal.VSIFTellL(f) == len(data)
+        finally:
+            gdal.VSIFCloseL(f)
+
+        # Corrupt the deflate stream of the second block
+        corrupted = bytearray(bgzf_data)
+        second_block_offset = len(bgzf_block(data[0:block_size]))
+        corrupted[second_block_offset + 20 : second_block_offset + 40] = b"\xff" * 20
+        gdal.FileFromMemBuffer(filename, bytes(corrupted))
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert f is not None
+        try:
+            with gdal.quiet_errors():
+                assert len(gdal.VSIFReadL(1, len(data), f)) < len(data)
+        finally:
+            gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -2958,6 +2958,193 @@ def test_vsis3_write_multipart_retry(aws_test_config, webserver_port):
                 gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test multipart upload with parts uploaded in parallel
+
+
+def test_vsis3_write_multipart_parallel(aws_test_config, webserver_port):
+
+    import base64
+    import hashlib
+
+    def content_md5(data):
+        return base64.b64encode(hashlib.md5(data).digest()).decode("ascii")
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    response = """<?xml version="1.0" encoding="UTF-8"?>
+    <InitiateMultipartUploadResult>
+    <UploadId>my_id</UploadId>
+    </InitiateMultipartUploadResult>"""
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.bin?uploads",
+        200,
+        {"Content-type": "application/xml", "Content-Length": len(response)},
+        response,
+    )
+    for i, data in enumerate([b"a" * 10, b"b" * 10, b"c" * 5]):
+        handler.add(
+            "PUT",
+            "/s3_fake_bucket4/large_file.bin?partNumber=%d&uploadId=my_id"
+            % (i + 1),
+            200,
+            {"ETag": '"etag%d"' % (i + 1), "Content-Length": "0"},
+            b"",
+            expected_headers={
+                "Content-Length": str(len(data)),
+                "Content-MD5": content_md5(data),
+            },
+            expected_body=data,
+        )
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.bin?uploadId=my_id",
+        200,
+        {},
+        b"",
+        expected_body=b"""<CompleteMultipartUpload>
+<Part>
+<PartNumber>1</PartNumber><ETag>"etag1"</ETag></Part>
+<Part>
+<PartNumber>2</PartNumber><ETag>"etag2"</ETag></Part>
+<Part>
+<PartNumber>3</PartNumber><ETag>"etag3"</ETag></Part>
+</CompleteMultipartUpload>
+""",
+    )
+
+    with gdaltest.config_options(
+        {
+            "VSIS3_CHUNK_SIZE_BYTES": "10",
+            "CPL_VSIL_CURL_UPLOAD_NUM_THREADS": "2",
+            "CPL_VSIL_CURL_UPLOAD_CONTENT_MD5": "YES",
+        }
+    ), webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenL("/vsis3/s3_fake_bucket4/large_file.bin", "wb")
+        assert f is not None
+        assert gdal.VSIFWriteL("a" * 10 + "b" * 10 + "c" * 5, 1, 25, f) == 25
+        gdal.ErrorReset()
+        assert gdal.VSIFCloseL(f) == 0
+        assert gdal.GetLastErrorMsg() == ""
+
+
+###############################################################################
+# Test multipart upload with a part failing while uploaded in parallel
+
+
+def test_vsis3_write_multipart_parallel_error(aws_test_config, webserver_port):
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    response = """<?xml version="1.0" encoding="UTF-8"?>
+    <InitiateMultipartUploadResult>
+    <UploadId>my_id</UploadId>
+    </InitiateMultipartUploadResult>"""
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.bin?uploads",
+        200,
+        {"Content-type": "application/xml", "Content-Length": len(response)},
+        response,
+    )
+    handler.add(
+        "PUT",
+        "/s3_fake_bucket4/large_file.bin?partNumber=1&uploadId=my_id",
+        200,
+        {"ETag": '"etag1"', "Content-Length": "0"},
+        b"",
+    )
+    handler.add(
+        "PUT", "/s3_fake_bucket4/large_file.bin?partNumber=2&uploadId=my_id", 403
+    )
+    handler.add(
+        "PUT",
+        "/s3_fake_bucket4/large_file.bin?partNumber=3&uploadId=my_id",
+        200,
+        {"ETag": '"etag3"', "Content-Length": "0"},
+        b"",
+    )
+    handler.add("DELETE", "/s3_fake_bucket4/large_file.bin?uploadId=my_id", 204)
+
+    with gdaltest.config_options(
+        {
+            "VSIS3_CHUNK_SIZE_BYTES": "10",
+            "CPL_VSIL_CURL_UPLOAD_NUM_THREADS": "2",
+        }
+    ), webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenL("/vsis3/s3_fake_bucket4/large_file.bin", "wb")
+        assert f is not None
+        # The failure of part 2 is detected when waiting for it before
+        # uploading part 4, and the multipart upload is then aborted.
+        with gdal.quiet_errors():
+            assert gdal.VSIFWriteL("a" * 40, 1, 40, f) == 0
+            assert "UploadPart(2)" in gdal.GetLastErrorMsg()
+            gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test multipart upload with CPL_VSIL_WRITE_FIRST_PART_LAST=YES
+
+
+def test_vsis3_write_first_part_last(aws_test_config, webserver_port):
+
+    handler = webserver.SequentialHandler()
+    response = """<?xml version="1.0" encoding="UTF-8"?>
+    <InitiateMultipartUploadResult>
+    <UploadId>my_id</UploadId>
+    </InitiateMultipartUploadResult>"""
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.bin?uploads",
+        200,
+        {"Content-type": "application/xml", "Content-Length": len(response)},
+        response,
+    )
+    for part, data in [(2, b"b" * 10), (3, b"c" * 5), (1, b"aXYaaaaaaa")]:
+        handler.add(
+            "PUT",
+            "/s3_fake_bucket4/large_file.bin?partNumber=%d&uploadId=my_id" % part,
+            200,
+            {"ETag": '"etag%d"' % part, "Content-Length": "0"},
+            b"",
+            expected_headers={"Content-Length": str(len(data))},
+            expected_body=data,
+        )
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.bin?uploadId=my_id",
+        200,
+        {},
+        b"",
+        expected_body=b"""<CompleteMultipartUpload>
+<Part>
+<PartNumber>1</PartNumber><ETag>"etag1"</ETag></Part>
+<Part>
+<PartNumber>2</PartNumber><ETag>"etag2"</ETag></Part>
+<Part>
+<PartNumber>3</PartNumber><ETag>"etag3"</ETag></Part>
+</CompleteMultipartUpload>
+""",
+    )
+
+    with gdaltest.config_options(
+        {
+            "VSIS3_CHUNK_SIZE_BYTES": "10",
+            "CPL_VSIL_WRITE_FIRST_PART_LAST": "YES",
+        }
+    ), webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenL("/vsis3/s3_fake_bucket4/large_file.bin", "wb+")
+        assert f is not None
+        assert gdal.VSIFWriteL("a" * 10 + "b" * 10 + "c" * 5, 1, 25, f) == 25
+        assert gdal.VSIFSeekL(f, 1, 0) == 0
+        assert gdal.VSIFWriteL("XY", 1, 2, f) == 2
+        assert gdal.VSIFSeekL(f, 0, 0) == 0
+        assert gdal.VSIFReadL(1, 4, f) == b"aXYa"
+        assert gdal.VSIFSeekL(f, 25, 0) == 0
+        gdal.ErrorReset()
+        assert gdal.VSIFCloseL(f) == 0
+        assert gdal.GetLastErrorMsg() == ""
+
+
 ###############################################################################
 # Test abort pending multipart uploads
 
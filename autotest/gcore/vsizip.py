@@ -966,3 +966,40 @@ def test_vsizip_sozip_of_file_bigger_than_4GB():
         assert gdal.VSIFReadL(1, 2, f) == b"\x00"
     finally:
         gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test reading small deflate-compressed files, which are decompressed at once
+# with libdeflate when available
+
+
+@pytest.mark.parametrize("max_size", [None, "0", "100K"])
+def test_vsizip_vsigzip_inflate_in_memory(tmp_vsimem, max_size):
+
+    data = bytes([(i * 7 + i // 300) % 251 for i in range(300000)])
+
+    zip_filename = str(tmp_vsimem / "test.zip")
+    f = gdal.VSIFOpenL("/vsizip/" + zip_filename + "/test.bin", "wb")
+    gdal.VSIFWriteL(data, 1, len(data), f)
+    gdal.VSIFCloseL(f)
+
+    gz_filename = str(tmp_vsimem / "test.bin.gz")
+    f = gdal.VSIFOpenL("/vsigzip/" + gz_filename, "wb")
+    gdal.VSIFWriteL(data, 1, len(data), f)
+    gdal.VSIFCloseL(f)
+
+    with gdaltest.config_option("CPL_VSIL_INFLATE_IN_MEMORY_MAX_SIZE", max_size):
+        for filename in [
+            "/vsizip/" + zip_filename + "/test.bin",
+            "/vsigzip/" + gz_filename,
+        ]:
+            f = gdal.VSIFOpenL(filename, "rb")
+            assert f is not None
+            try:
+                assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+                assert gdal.VSIFSeekL(f, 12345, 0) == 0
+                assert gdal.VSIFReadL(1, 10, f) == data[12345 : 12345 + 10]
+                assert gdal.VSIFSeekL(f, 0, 2) == 0
+                assert gdal.VSIFTellL(f) == len(data)
+            finally:
+                gdal.VSIFCloseL(f)
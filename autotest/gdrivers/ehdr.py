@@ -403,3 +403,61 @@ def test_ehdr_approx_stats_flag():
     ds = None
 
     gdal.GetDriverByName("EHDR").Delete(tmpfile)
+
+
+###############################################################################
+# Test that reading blocks through a memory mapped view of the file gives the
+# same result as regular reads
+
+
+@pytest.mark.parametrize("mmap_view", ["YES", "NO"])
+def test_ehdr_read_mmap_view(tmp_path, mmap_view):
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    tmpfile = str(tmp_path / "test.bil")
+    gdal.GetDriverByName("EHdr").CreateCopy(tmpfile, src_ds)
+
+    with gdal.config_option("CPL_VSIL_MMAP_VIEW", mmap_view):
+        ds = gdal.Open(tmpfile)
+        assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+            src_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+        ]
+
+
+###############################################################################
+# Test multi-threaded reading of large RasterIO() requests
+
+
+@pytest.mark.parametrize("layout,nbands", [("BIL", 1), ("BIP", 3)])
+def test_ehdr_read_multithreaded(tmp_path, layout, nbands):
+
+    xsize = 512
+    ysize = 4096
+    tmpfile = str(tmp_path / "test.bil")
+    with open(tmpfile, "wb") as f:
+        f.write(bytes(range(251)) * (xsize * ysize * nbands * 2 // 251 + 1))
+    with open(str(tmp_path / "test.hdr"), "wt") as f:
+        f.write(f"""BYTEORDER M
+LAYOUT {layout}
+NROWS {ysize}
+NCOLS {xsize}
+NBANDS {nbands}
+NBITS 16
+PIXELTYPE UNSIGNEDINT
+""")
+
+    def read():
+        ds = gdal.Open(tmpfile)
+        return ds.ReadRaster(
+            buf_pixel_space=2 * nbands,
+            buf_line_space=2 * nbands * xsize,
+            buf_band_space=2,
+        )
+
+    with gdaltest.config_option("GDAL_ONE_BIG_READ", "YES"):
+        ref_data = read()
+        with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+            assert read() == ref_data
+
+    # Check byte swapping
+    assert ref_data[0:4] == bytes([1, 0, 3, 2])
@@ -4298,3 +4298,38 @@ def test_gpkg_gti_gpkg_ext(tmp_vsimem):
     ds = gdal.Open(filename)
     assert ds.GetDriver().ShortName == "GPKG"
     assert ds.GetRasterBand(1).Checksum() == 4672
+
+
+###############################################################################
+# Test multi-threaded decoding of tiles intersecting a RasterIO() request
+
+
+@pytest.mark.require_driver("PNG")
+@pytest.mark.parametrize("tile_format", ["PNG", "PNG8", "JPEG"])
+def test_gpkg_read_multithreaded_tile_decoding(tmp_vsimem, tile_format):
+
+    if gdal.GetDriverByName(tile_format.replace("PNG8", "PNG")) is None:
+        pytest.skip(f"{tile_format} driver missing")
+
+    filename = str(tmp_vsimem / "test_gpkg_read_multithreaded_tile_decoding.gpkg")
+    gdal.Translate(
+        filename,
+        "data/small_world.tif",
+        format="GPKG",
+        creationOptions=["TILE_FORMAT=" + tile_format, "BLOCKSIZE=32"],
+    )
+
+    ds = gdal.Open(filename)
+    expected_ds = ds.ReadRaster()
+    expected_band = ds.GetRasterBand(1).ReadRaster(10, 20, 300, 150)
+    ds = None
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open(filename)
+        assert ds.ReadRaster() == expected_ds
+        assert ds.ReadRaster() == expected_ds
+        ds = None
+
+        ds = gdal.Open(filename)
+        assert ds.GetRasterBand(1).ReadRaster(10, 20, 300, 150) == expected_band
+        ds = None
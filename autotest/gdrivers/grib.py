@@ -2252,6 +2252,63 @@ def test_grib_grib2_sidecar():
             ) == ds_idx.GetRasterBand(i).GetMetadataItem(key)
 
 
+# Test writing a sidecar file
+
+
+@pytest.mark.parametrize("write_subgrids", ["YES", "NO"])
+def test_grib_grib2_write_idx(tmp_vsimem, write_subgrids):
+
+    src_ds = gdal.OpenEx(
+        "data/grib/gfs.t06z.pgrb2.10p0.f010.grib2", open_options=["USE_IDX=NO"]
+    )
+    out_filename = str(tmp_vsimem / "test_grib_grib2_write_idx.grb2")
+    out_ds = gdaltest.grib_drv.CreateCopy(
+        out_filename,
+        src_ds,
+        options=["WRITE_IDX=YES", "WRITE_SUBGRIDS=" + write_subgrids],
+    )
+    assert out_ds.RasterCount == 6
+    out_ds = None
+
+    f = gdal.VSIFOpenL(out_filename + ".idx", "rb")
+    assert f
+    lines = gdal.VSIFReadL(1, 10000, f).decode("ascii").split("\n")
+    gdal.VSIFCloseL(f)
+    assert len(lines) == 7 and lines[-1] == ""
+    if write_subgrids == "YES":
+        assert lines[0].startswith("1.1:0:d=2021091806:REFD:")
+        assert lines[5].startswith("1.6:")
+    else:
+        assert lines[0].startswith("1:0:d=2021091806:REFD:")
+        assert lines[5].startswith("6:")
+    assert lines[5].endswith(":10 hour fcst:")
+
+    ds = gdal.Open(out_filename)
+    assert ds.RasterCount == 6
+    assert ds.GetRasterBand(1).GetDescription().startswith("REFD:")
+    ds_no_idx = gdal.OpenEx(out_filename, open_options=["USE_IDX=NO"])
+    for i in range(ds.RasterCount):
+        assert (
+            ds.GetRasterBand(i + 1).Checksum()
+            == ds_no_idx.GetRasterBand(i + 1).Checksum()
+        )
+        assert ds.GetRasterBand(i + 1).GetMetadataItem(
+            "GRIB_ELEMENT"
+        ) == src_ds.GetRasterBand(i + 1).GetMetadataItem("GRIB_ELEMENT")
+    ds = None
+    ds_no_idx = None
+
+    # Test the WRITE_IDX open option
+    gdal.Unlink(out_filename + ".idx")
+    ds = gdal.OpenEx(out_filename, open_options=["WRITE_IDX=YES"])
+    assert ds.RasterCount == 6
+    ds = None
+    f = gdal.VSIFOpenL(out_filename + ".idx", "rb")
+    assert f
+    assert gdal.VSIFReadL(1, 10000, f).decode("ascii").split("\n") == lines
+    gdal.VSIFCloseL(f)
+
+
 # Test reading a (broken) mix of GRIBv2/GRIBv1 bands
 
 
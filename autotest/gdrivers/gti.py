@@ -1054,6 +1054,43 @@ def test_gti_rgb_left_right(tmp_vsimem):
     )
 
 
+
+@pytest.mark.parametrize("num_threads", ["2", "ALL_CPUS"])
+def test_gti_rgb_quadrants_multithreaded(tmp_vsimem, num_threads):
+
+    index_filename = str(tmp_vsimem / "index.gti.gpkg")
+
+    src_ds = gdal.Open("data/small_world.tif")
+
+    tiles = []
+    for i, (xoff, yoff) in enumerate([(0, 0), (200, 0), (0, 100), (200, 100)]):
+        filename = str(tmp_vsimem / f"tile{i}.tif")
+        gdal.Translate(filename, src_ds, srcWin=[xoff, yoff, 200, 100])
+        tiles.append(gdal.Open(filename))
+
+    index_ds, lyr = create_basic_tileindex(index_filename, tiles)
+    lyr.SetMetadataItem("NODATA", "255")
+    del index_ds
+
+    vrt_ds = gdal.OpenEx(index_filename, open_options=["NUM_THREADS=" + num_threads])
+    assert vrt_ds.ReadRaster() == src_ds.ReadRaster()
+    assert vrt_ds.GetMetadataItem("NUMBER_OF_CONTRIBUTING_SOURCES", "__DEBUG__") == "4"
+
+    assert vrt_ds.ReadRaster(190, 90, 20, 20) == src_ds.ReadRaster(190, 90, 20, 20)
+
+    # Compare with a single-threaded read of the tile index
+    ref_ds = gdal.Open(index_filename)
+    assert vrt_ds.ReadRaster(
+        buf_xsize=100, buf_ysize=50, resample_alg=gdal.GRIORA_Cubic
+    ) == ref_ds.ReadRaster(buf_xsize=100, buf_ysize=50, resample_alg=gdal.GRIORA_Cubic)
+
+    assert vrt_ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        vrt_ds = gdal.Open(index_filename)
+        assert vrt_ds.ReadRaster() == src_ds.ReadRaster()
+
+
 def test_gti_overlapping_sources(tmp_vsimem):
 
     filename1 = str(tmp_vsimem / "one.tif")
@@ -840,3 +840,38 @@ def test_hdf5_multidim_block_size_structural_info():
     var = rg.OpenMDArray("Band1")
     assert var.GetBlockSize() == [1, 2]
     assert var.GetStructuralInfo() == {"COMPRESSION": "DEFLATE", "FILTER": "SHUFFLE"}
+
+
+###############################################################################
+# Test reading raw chunks and decoding them in worker threads
+
+
+@pytest.mark.parametrize("direct_chunk_read", ["YES", "NO"])
+def test_hdf5_multidim_direct_chunk_read(direct_chunk_read):
+
+    ds = gdal.OpenEx("data/hdf5/deflate.h5", gdal.OF_MULTIDIM_RASTER)
+    rg = ds.GetRootGroup()
+    var = rg.OpenMDArray("Band1")
+    ref_data = var.Read()
+    ref_data_float64 = var.Read(
+        buffer_datatype=gdal.ExtendedDataType.Create(gdal.GDT_Float64)
+    )
+    dims = [dim.GetSize() for dim in var.GetDimensions()]
+    ref_subset = var.Read(array_start_idx=[1, 1], count=[dims[0] - 1, dims[1] - 1])
+    ds = None
+
+    with gdal.config_options(
+        {"GDAL_NUM_THREADS": "4", "GDAL_HDF5_DIRECT_CHUNK_READ": direct_chunk_read}
+    ):
+        ds = gdal.OpenEx("data/hdf5/deflate.h5", gdal.OF_MULTIDIM_RASTER)
+        rg = ds.GetRootGroup()
+        var = rg.OpenMDArray("Band1")
+        assert var.Read() == ref_data
+        assert (
+            var.Read(buffer_datatype=gdal.ExtendedDataType.Create(gdal.GDT_Float64))
+            == ref_data_float64
+        )
+        assert (
+            var.Read(array_start_idx=[1, 1], count=[dims[0] - 1, dims[1] - 1])
+            == ref_subset
+        )
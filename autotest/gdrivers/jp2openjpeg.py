@@ -465,6 +465,39 @@ def test_jp2openjpeg_15(JP2OPENJPEG_USE_THREADED_IO):
     assert got_data == data
 
 
+###############################################################################
+# Test JP2OPENJPEG_REUSE_CODECS=YES
+
+
+@pytest.mark.parametrize("GDAL_NUM_THREADS", ["1", "4"])
+def test_jp2openjpeg_reuse_codecs(tmp_vsimem, GDAL_NUM_THREADS):
+
+    src_ds = gdal.Open("data/byte.tif")
+    filename = str(tmp_vsimem / "test_jp2openjpeg_reuse_codecs.jp2")
+    gdaltest.jp2openjpeg_drv.CreateCopy(
+        filename,
+        src_ds,
+        options=["BLOCKXSIZE=8", "BLOCKYSIZE=8"],
+    )
+    ds = gdal.Open(filename)
+    ref_data = ds.ReadRaster()
+    ds = None
+
+    with gdaltest.config_options(
+        {"JP2OPENJPEG_REUSE_CODECS": "YES", "GDAL_NUM_THREADS": GDAL_NUM_THREADS}
+    ):
+        ds = gdal.Open(filename)
+        # Read twice to exercise codecs taken back from the pool
+        for i in range(2):
+            assert ds.ReadRaster() == ref_data
+            # Block by block, in reverse order
+            band = ds.GetRasterBand(1)
+            for y in range(2, -1, -1):
+                for x in range(2, -1, -1):
+                    assert band.ReadBlock(x, y) is not None
+        ds = None
+
+
 ###############################################################################
 # Test reading PixelIsPoint file (#5437)
 
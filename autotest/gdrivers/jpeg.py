@@ -925,6 +925,32 @@ def test_jpeg_23():
     assert cs == got_cs
 
 
+###############################################################################
+# Test optimized JPEG IRasterIO on a grayscale image
+
+
+def test_jpeg_optimized_irasterio_grayscale(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.jpg")
+    src_ds = gdal.Translate("", "data/jpeg/albania.jpg", format="MEM", bandList=[1])
+    gdal.GetDriverByName("JPEG").CreateCopy(filename, src_ds)
+
+    ds = gdal.Open(filename)
+    ref_data = b"".join(
+        ds.GetRasterBand(1).ReadRaster(0, y, ds.RasterXSize, 1)
+        for y in range(ds.RasterYSize)
+    )
+
+    ds = gdal.Open(filename)
+    assert ds.ReadRaster() == ref_data
+    # Make sure that decoding state is correctly reset afterwards
+    assert (
+        ds.GetRasterBand(1).ReadRaster(0, ds.RasterYSize - 1, ds.RasterXSize, 1)
+        == ref_data[-ds.RasterXSize :]
+    )
+    assert ds.GetRasterBand(1).ReadRaster() == ref_data
+
+
 ###############################################################################
 # Test Arithmetic coding (and if not enabled, will trigger error code handling
 # in CreateCopy())
@@ -704,3 +704,19 @@ def test_mbtiles_webp_write():
     ds = None
 
     gdal.Unlink("/vsimem/mbtiles_webp_write.mbtiles")
+
+
+###############################################################################
+# Test multi-threaded decoding of tiles intersecting a RasterIO() request
+
+
+@pytest.mark.require_driver("PNG")
+def test_mbtiles_read_multithreaded_tile_decoding():
+
+    ds = gdal.Open("data/mbtiles/world_l1.mbtiles")
+    expected = ds.ReadRaster()
+    ds = None
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.Open("data/mbtiles/world_l1.mbtiles")
+        assert ds.ReadRaster() == expected
@@ -2349,6 +2349,86 @@ def test_mem_md_array_statistics_float32():
     assert stats.valid_count == 5
 
 
+def test_mem_md_array_statistics_multithreaded():
+
+    drv = gdal.GetDriverByName("MEM")
+    ds = drv.CreateMultiDimensional("myds")
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 1100)
+    dim1 = rg.CreateDimension("dim1", None, None, 1000)
+    ar = rg.CreateMDArray(
+        "myarray", [dim0, dim1], gdal.ExtendedDataType.Create(gdal.GDT_UInt16)
+    )
+    ar.SetNoDataValueDouble(0)
+    ar.Write(array.array("H", [i % 1001 for i in range(1100 * 1000)]))
+
+    with gdal.config_option("GDAL_SWATH_SIZE", "100000"):
+        ref_stats = ar.ComputeStatistics(False, options=["NUM_THREADS=1"])
+        stats = ar.ComputeStatistics(False, options=["NUM_THREADS=4"])
+    assert stats.min == ref_stats.min == 1
+    assert stats.max == ref_stats.max == 1000
+    assert stats.valid_count == ref_stats.valid_count
+    assert stats.mean == pytest.approx(ref_stats.mean, rel=1e-12)
+    assert stats.std_dev == pytest.approx(ref_stats.std_dev, rel=1e-12)
+
+
+def test_mem_md_array_copy_multithreaded():
+
+    drv = gdal.GetDriverByName("MEM")
+    ds = drv.CreateMultiDimensional("myds")
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 100)
+    dim1 = rg.CreateDimension("dim1", None, None, 1000)
+    ar = rg.CreateMDArray(
+        "myarray", [dim0, dim1], gdal.ExtendedDataType.Create(gdal.GDT_UInt16)
+    )
+    ar.Write(array.array("H", [i % 65535 for i in range(100 * 1000)]))
+    ar_str = rg.CreateMDArray(
+        "mystrarray", [dim0], gdal.ExtendedDataType.CreateString()
+    )
+    ar_str.Write(["val%d" % i for i in range(100)])
+
+    with gdal.config_options({"GDAL_SWATH_SIZE": "10000", "GDAL_NUM_THREADS": "2"}):
+        copy_ds = drv.CreateCopy("", ds)
+    copy_rg = copy_ds.GetRootGroup()
+    assert copy_rg.OpenMDArray("myarray").Read() == ar.Read()
+    assert copy_rg.OpenMDArray("mystrarray").Read() == ar_str.Read()
+
+
+def test_mem_md_array_read_points():
+
+    drv = gdal.GetDriverByName("MEM")
+    ds = drv.CreateMultiDimensional("myds")
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("time", None, None, 10)
+    dim1 = rg.CreateDimension("y", None, None, 3)
+    dim2 = rg.CreateDimension("x", None, None, 4)
+    ar = rg.CreateMDArray(
+        "myarray", [dim0, dim1, dim2], gdal.ExtendedDataType.Create(gdal.GDT_UInt16)
+    )
+    ar.Write(array.array("H", [i for i in range(10 * 3 * 4)]))
+
+    points = [(t, 1, 2) for t in range(10)] + [(3, 0, 0), (3, 2, 3), (3, 1, 2)]
+    got = struct.unpack("H" * len(points), ar.ReadPoints(points))
+    assert list(got) == [t * 12 + y * 4 + x for (t, y, x) in points]
+
+    got = struct.unpack(
+        "d" * 2,
+        ar.ReadPoints(
+            [(9, 2, 3), (0, 0, 1)], gdal.ExtendedDataType.Create(gdal.GDT_Float64)
+        ),
+    )
+    assert list(got) == [119.0, 1.0]
+
+    assert ar.ReadPoints([]) == bytearray()
+
+    with pytest.raises(Exception, match="out of range"):
+        ar.ReadPoints([(10, 0, 0)])
+
+    with pytest.raises(ValueError):
+        ar.ReadPoints([(0, 0)])
+
+
 def test_mem_md_array_copy_autoscale():
 
     drv = gdal.GetDriverByName("MEM")
@@ -4006,3 +4006,39 @@ def test_netcdf_multidim_as_classic_dataset_overview(tmp_path):
 
     test()
     test2()
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("max_cache_size", [None, "0"])
+def test_netcdf_multidim_read_row_by_row_chunked(tmp_path, max_cache_size):
+
+    filename = str(tmp_path / "test_netcdf_multidim_read_row_by_row_chunked.nc")
+
+    ds = gdal.GetDriverByName("netCDF").CreateMultiDimensional(filename)
+    rg = ds.GetRootGroup()
+    dim_y = rg.CreateDimension("Y", None, None, 10)
+    dim_x = rg.CreateDimension("X", None, None, 15)
+    ar = rg.CreateMDArray(
+        "myarray",
+        [dim_y, dim_x],
+        gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+        ["BLOCKSIZE=4,4", "COMPRESS=DEFLATE"],
+    )
+    ar.Write(array.array("H", [i for i in range(150)]))
+    del ds
+
+    with gdal.config_option("GDAL_NETCDF_MAX_CHUNK_CACHE_SIZE", max_cache_size):
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("myarray")
+        assert ar.GetBlockSize() == [4, 4]
+        for y in range(10):
+            assert struct.unpack(
+                "H" * 15, ar.Read(array_start_idx=[y, 0], count=[1, 15])
+            ) == tuple(range(y * 15, (y + 1) * 15))
+        # Column and strided requests
+        assert struct.unpack(
+            "H" * 10, ar.Read(array_start_idx=[0, 1], count=[10, 1])
+        ) == tuple(range(1, 150, 15))
+        assert struct.unpack(
+            "H" * 5, ar.Read(array_start_idx=[9, 0], count=[5, 1], array_step=[-2, 1])
+        ) == tuple(range(135, -1, -30))
@@ -488,3 +488,50 @@ def test_png_copy_mdd():
     ds = None
 
     gdal.Unlink(filename)
+
+
+###############################################################################
+# Test multi-threaded compression
+
+
+@pytest.mark.parametrize(
+    "band_list,datatype,options",
+    [
+        ([1], gdal.GDT_Byte, []),
+        ([1], gdal.GDT_Byte, ["NBITS=1"]),
+        ([1], gdal.GDT_Byte, ["NBITS=4"]),
+        ([1, 2], gdal.GDT_Byte, []),
+        ([1, 2, 3], gdal.GDT_Byte, ["ZLEVEL=1"]),
+        ([1, 2, 3, 1], gdal.GDT_Byte, ["ZLEVEL=9"]),
+        ([1, 2, 3], gdal.GDT_UInt16, []),
+    ],
+)
+def test_png_create_copy_num_threads(tmp_vsimem, band_list, datatype, options):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gcore/data/small_world.tif",
+        format="MEM",
+        bandList=band_list,
+        outputType=datatype,
+        width=1000,
+        height=700,
+    )
+    if "NBITS=1" in options:
+        src_ds = gdal.Translate("", src_ds, format="MEM", scaleParams=[[0, 255, 0, 1]])
+    elif "NBITS=4" in options:
+        src_ds = gdal.Translate("", src_ds, format="MEM", scaleParams=[[0, 255, 0, 15]])
+
+    filename = str(tmp_vsimem / "out.png")
+    ref_filename = str(tmp_vsimem / "ref.png")
+    gdal.GetDriverByName("PNG").CreateCopy(ref_filename, src_ds, options=options)
+    gdal.GetDriverByName("PNG").CreateCopy(
+        filename, src_ds, options=options + ["NUM_THREADS=4"]
+    )
+
+    ds = gdal.Open(filename)
+    ref_ds = gdal.Open(ref_filename)
+    assert ds.RasterCount == len(band_list)
+    assert ds.GetRasterBand(1).DataType == datatype
+    assert ds.ReadRaster() == ref_ds.ReadRaster()
+    assert ds.ReadRaster() == src_ds.ReadRaster()
@@ -2399,3 +2399,54 @@ def test_vrtpansharpen_open_options_input_bands():
         )
         # Not the prettiest way to check that open options are used, but that does the job...
         assert "small_world.tif: Invalid value for NUM_THREADS: foo" in msgs
+
+
+###############################################################################
+# Test that the UInt16 and Float32 code paths (possibly AVX2 accelerated), and
+# the multithreaded nearest neighbour upsampling, give the same results as the
+# generic ones.
+
+
+@pytest.mark.parametrize("dt", ["UInt16", "Float32"])
+@pytest.mark.parametrize("resampling", ["Nearest", "Cubic"])
+def test_vrtpansharpen_simd_and_threads_consistency(tmp_vsimem, dt, resampling):
+
+    pan_filename = str(tmp_vsimem / "pan.tif")
+    ms_filename = str(tmp_vsimem / "ms.tif")
+    gdal.Translate(
+        pan_filename, "tmp/small_world_pan.tif", outputType=gdal.GetDataTypeByName(dt)
+    )
+    gdal.Translate(
+        ms_filename, "data/small_world.tif", outputType=gdal.GetDataTypeByName(dt)
+    )
+
+    def get_checksums(num_threads):
+        xml = f"""<VRTDataset subClass="VRTPansharpenedDataset">
+    <PansharpeningOptions>
+        <NumThreads>{num_threads}</NumThreads>
+        <Resampling>{resampling}</Resampling>
+        <PanchroBand>
+                <SourceFilename>{pan_filename}</SourceFilename>
+                <SourceBand>1</SourceBand>
+        </PanchroBand>
+        <SpectralBand dstBand="1">
+                <SourceFilename>{ms_filename}</SourceFilename>
+                <SourceBand>1</SourceBand>
+        </SpectralBand>
+        <SpectralBand dstBand="2">
+                <SourceFilename>{ms_filename}</SourceFilename>
+                <SourceBand>2</SourceBand>
+        </SpectralBand>
+        <SpectralBand dstBand="3">
+                <SourceFilename>{ms_filename}</SourceFilename>
+                <SourceBand>3</SourceBand>
+        </SpectralBand>
+    </PansharpeningOptions>
+</VRTDataset>"""
+        vrt_ds = gdal.Open(xml)
+        return [vrt_ds.GetRasterBand(i + 1).Checksum() for i in range(3)]
+
+    with gdal.config_option("GDAL_USE_AVX2", "NO"):
+        ref_cs = get_checksums(1)
+    assert get_checksums(1) == ref_cs
+    assert get_checksums(4) == ref_cs
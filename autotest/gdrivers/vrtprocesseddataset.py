@@ -226,6 +226,54 @@ def test_vrtprocesseddataset_several_steps(tmp_vsimem):
     assert ds.GetRasterBand(3).ComputeRasterMinMax(False) == (3, 3)
 
 
+###############################################################################
+# Test that consecutive pixel-wise steps give the same result when processed
+# by chunks in several threads
+
+
+@pytest.mark.parametrize("num_threads", [None, "4"])
+def test_vrtprocesseddataset_pixel_wise_steps_multithreaded(tmp_vsimem, num_threads):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        src_filename, 512, 512, 2, gdal.GDT_UInt16
+    )
+    ar = (np.arange(512 * 512, dtype=np.uint16) % 1000).reshape(512, 512)
+    src_ds.GetRasterBand(1).WriteArray(ar)
+    src_ds.GetRasterBand(2).WriteArray(999 - ar)
+    src_ds.Close()
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Open(
+            f"""<VRTDataset subclass='VRTProcessedDataset'>
+    <Input>
+        <SourceFilename>{src_filename}</SourceFilename>
+    </Input>
+    <BlockXSize>512</BlockXSize>
+    <BlockYSize>512</BlockYSize>
+    <ProcessingSteps>
+        <Step>
+            <Algorithm>BandAffineCombination</Algorithm>
+            <Argument name="coefficients_1">1,1,0</Argument>
+            <Argument name="coefficients_2">0,1,1</Argument>
+        </Step>
+        <Step>
+            <Algorithm>LUT</Algorithm>
+            <Argument name="lut_1">0:0,2000:4000</Argument>
+            <Argument name="lut_2">0:0,2000:2000</Argument>
+        </Step>
+    </ProcessingSteps>
+    </VRTDataset>
+        """
+        )
+        np.testing.assert_equal(
+            ds.GetRasterBand(1).ReadAsArray(), (ar.astype(np.int32) + 1) * 2
+        )
+        np.testing.assert_equal(
+            ds.GetRasterBand(2).ReadAsArray(), np.full((512, 512), 999)
+        )
+
+
 ###############################################################################
 # Test nominal cases of BandAffineCombination algorithm with nodata
 
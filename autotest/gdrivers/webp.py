@@ -193,3 +193,23 @@ def test_webp_lossless_copy_with_xmp():
     gdal.VSIFCloseL(f)
     assert data == open(src_ds.GetDescription(), "rb").read()
     gdaltest.webp_drv.Delete(outfilename)
+
+
+###############################################################################
+# Test multi-threaded encoding
+
+
+@pytest.mark.require_creation_option("WEBP", "NUM_THREADS")
+def test_webp_create_copy_num_threads(tmp_vsimem):
+
+    src_ds = gdal.Open("../gcore/data/stefan_full_rgba.tif")
+    checksums = []
+    for num_threads in ["1", "2"]:
+        filename = str(tmp_vsimem / "out.webp")
+        gdaltest.webp_drv.CreateCopy(
+            filename, src_ds, options=["LOSSLESS=YES", "NUM_THREADS=" + num_threads]
+        )
+        ds = gdal.Open(filename)
+        checksums.append([ds.GetRasterBand(i + 1).Checksum() for i in range(4)])
+        ds = None
+    assert checksums[0] == checksums[1]
@@ -1162,3 +1162,85 @@ def test_wms_cache_path():
 
     with pytest.raises(Exception):
         gdal.Open("<GDAL_WMS><Service/><Cache/></GDAL_WMS>")
+
+
+###############################################################################
+# Test <WriteBehind> cache and <PrefetchMargin>
+
+
+@pytest.mark.require_driver("PNG")
+@pytest.mark.parametrize("prefetch_margin", [0, 1])
+def test_wms_cache_write_behind_and_prefetch(prefetch_margin):
+
+    server_url_mask = "/vsimem/wms_write_behind/${z}/${x}/${y}.png"
+    cache_dir = "/vsimem/wms_write_behind_cache"
+    src_ds = gdal.GetDriverByName("MEM").Create("", 256, 256, 3)
+    for x in range(2):
+        for y in range(2):
+            src_ds.GetRasterBand(1).Fill(10 * x + y + 1)
+            gdal.GetDriverByName("PNG").CreateCopy(
+                f"/vsimem/wms_write_behind/1/{x}/{y}.png", src_ds
+            )
+
+    def get_xml(offline_mode):
+        return f"""<GDAL_WMS>
+    <Service name="TMS">
+        <ServerUrl>{server_url_mask}</ServerUrl>
+    </Service>
+    <DataWindow>
+        <UpperLeftX>-20037508.34</UpperLeftX>
+        <UpperLeftY>20037508.34</UpperLeftY>
+        <LowerRightX>20037508.34</LowerRightX>
+        <LowerRightY>-20037508.34</LowerRightY>
+        <TileLevel>1</TileLevel>
+        <TileCountX>1</TileCountX>
+        <TileCountY>1</TileCountY>
+        <YOrigin>top</YOrigin>
+    </DataWindow>
+    <Projection>EPSG:3857</Projection>
+    <BlockSizeX>256</BlockSizeX>
+    <BlockSizeY>256</BlockSizeY>
+    <BandsCount>3</BandsCount>
+    <PrefetchMargin>{prefetch_margin}</PrefetchMargin>
+    <OfflineMode>{offline_mode}</OfflineMode>
+    <Cache>
+        <Path>{cache_dir}</Path>
+        <Unique>false</Unique>
+        <WriteBehind>true</WriteBehind>
+    </Cache>
+</GDAL_WMS>"""
+
+    def get_cache_filename(x, y):
+        h = hashlib.md5(
+            f"/vsimem/wms_write_behind/1/{x}/{y}.png".encode("utf-8")
+        ).hexdigest()
+        return f"{cache_dir}/{h[0]}/{h[1]}/{h}"
+
+    try:
+        with gdaltest.config_option("CPL_CURL_ENABLE_VSIMEM", "YES"):
+            ds = gdal.Open(get_xml("false"))
+            band = ds.GetRasterBand(1)
+            assert band.ReadRaster(0, 0, 256, 256) == b"\x01" * (256 * 256)
+            # Re-reading a tile whose cache write may still be pending
+            ds.FlushCache()
+            assert band.ReadRaster(0, 0, 256, 256) == b"\x01" * (256 * 256)
+            ds = None
+
+        assert gdal.VSIStatL(get_cache_filename(0, 0)) is not None
+        for x, y in [(0, 1), (1, 0), (1, 1)]:
+            if prefetch_margin:
+                assert gdal.VSIStatL(get_cache_filename(x, y)) is not None
+            else:
+                assert gdal.VSIStatL(get_cache_filename(x, y)) is None
+        assert not [f for f in gdal.ReadDirRecursive(cache_dir) if f.endswith(".tmp")]
+
+        # Read back from the cache only
+        ds = gdal.Open(get_xml("true"))
+        band = ds.GetRasterBand(1)
+        assert band.ReadRaster(0, 0, 256, 256) == b"\x01" * (256 * 256)
+        if prefetch_margin:
+            assert band.ReadRaster(256, 256, 256, 256) == b"\x0c" * (256 * 256)
+        ds = None
+    finally:
+        gdal.RmdirRecursive("/vsimem/wms_write_behind")
+        gdal.RmdirRecursive(cache_dir)
@@ -1903,6 +1903,16 @@ def test_zarr_create_array_compressor(compressor, options, expected_json):
                 }
             ],
         ],
+        [
+            "zstd",
+            [],
+            [{"name": "zstd", "configuration": {"level": 13, "checksum": False}}],
+        ],
+        [
+            "zstd",
+            ["ZSTD_LEVEL=1"],
+            [{"name": "zstd", "configuration": {"level": 1, "checksum": False}}],
+        ],
     ],
 )
 def test_zarr_create_array_compressor_v3(compressor, options, expected_json):
@@ -2040,6 +2050,201 @@ def test_zarr_create_array_endian_v3(options, expected_json, gdal_data_type):
         gdal.RmdirRecursive("/vsimem/test.zarr")
 
 
+@pytest.mark.parametrize("options", [[], ["COMPRESS=GZIP"]])
+def test_zarr_create_array_sharding_v3(tmp_vsimem, options):
+
+    filename = str(tmp_vsimem / "test.zarr")
+
+    def create():
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            filename, options=["FORMAT=ZARR_V3"]
+        )
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, 5)
+        dim1 = rg.CreateDimension("dim1", None, None, 7)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+            ["BLOCKSIZE=2,2", "SHARD_BLOCKSIZE=4,4"] + options,
+        )
+        assert ar
+        ar.SetNoDataValueDouble(0)
+        assert (
+            ar.Write(array.array("H", [i + 1 for i in range(5 * 7)]))
+            == gdal.CE_None
+        )
+
+    create()
+
+    j = json.loads(gdal.VSIFile(filename + "/test/zarr.json", "rb").read())
+    assert j["chunk_grid"]["configuration"]["chunk_shape"] == [4, 4]
+    assert len(j["codecs"]) == 1
+    assert j["codecs"][0]["name"] == "sharding_indexed"
+    assert j["codecs"][0]["configuration"]["chunk_shape"] == [2, 2]
+    assert gdal.VSIStatL(filename + "/test/c/0/0") is not None
+    assert gdal.VSIStatL(filename + "/test/c/1/1") is not None
+    assert gdal.VSIStatL(filename + "/test/c/0/2") is None
+
+    expected = array.array("H", [i + 1 for i in range(5 * 7)])
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert ar.GetBlockSize() == [2, 2]
+    assert ar.Read() == expected.tobytes()
+    assert (
+        ar.Read(array_start_idx=[3, 5], count=[2, 2])
+        == array.array(
+            "H",
+            [
+                expected[3 * 7 + 5],
+                expected[3 * 7 + 6],
+                expected[4 * 7 + 5],
+                expected[4 * 7 + 6],
+            ],
+        ).tobytes()
+    )
+
+    # Update an inner chunk (rewrites its shard) and clear another one
+    assert (
+        ar.Write(
+            array.array("H", [100, 101, 102, 103]),
+            array_start_idx=[0, 0],
+            count=[2, 2],
+        )
+        == gdal.CE_None
+    )
+    assert (
+        ar.Write(array.array("H", [0] * 4), array_start_idx=[4, 4], count=[1, 3])
+        == gdal.CE_None
+    )
+    ds = None
+
+    expected[0] = 100
+    expected[1] = 101
+    expected[7] = 102
+    expected[8] = 103
+    for i in range(4, 7):
+        expected[4 * 7 + i] = 0
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert (
+        ar.AdviseRead(options=["CACHE_SIZE=1000000", "NUM_THREADS=2"])
+        == gdal.CE_None
+    )
+    assert ar.Read() == expected.tobytes()
+    ds = None
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert ar.Read() == expected.tobytes()
+
+
+def test_zarr_create_array_sharding_v3_invalid_shard_size(tmp_vsimem):
+
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        str(tmp_vsimem / "test.zarr"), options=["FORMAT=ZARR_V3"]
+    )
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 5)
+    with gdal.quiet_errors():
+        assert (
+            rg.CreateMDArray(
+                "test",
+                [dim0],
+                gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+                ["BLOCKSIZE=2", "SHARD_BLOCKSIZE=3"],
+            )
+            is None
+        )
+    assert "must be multiple" in gdal.GetLastErrorMsg()
+
+
+def _crc32c(data):
+    crc = 0xFFFFFFFF
+    for b in data:
+        crc ^= b
+        for _ in range(8):
+            crc = (crc >> 1) ^ (0x82F63B78 if crc & 1 else 0)
+    return crc ^ 0xFFFFFFFF
+
+
+@pytest.mark.parametrize("endian", ["little", "big"])
+def test_zarr_read_crc32c_v3(tmp_vsimem, endian):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    j = {
+        "zarr_format": 3,
+        "node_type": "array",
+        "shape": [3],
+        "data_type": "uint16",
+        "chunk_grid": {"name": "regular", "configuration": {"chunk_shape": [3]}},
+        "chunk_key_encoding": {"name": "default"},
+        "fill_value": 0,
+        "codecs": [
+            {"name": "bytes", "configuration": {"endian": endian}},
+            {"name": "crc32c"},
+        ],
+    }
+    gdal.FileFromMemBuffer(filename + "/zarr.json", json.dumps(j))
+    data = struct.pack(("<" if endian == "little" else ">") + "HHH", 1, 2, 65535)
+    gdal.FileFromMemBuffer(
+        filename + "/c/0", data + struct.pack("<I", _crc32c(data))
+    )
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    rg = ds.GetRootGroup()
+    ar = rg.OpenMDArray(rg.GetMDArrayNames()[0])
+    assert struct.unpack("H" * 3, ar.Read()) == (1, 2, 65535)
+    ds = None
+
+    # Corrupted chunk
+    gdal.FileFromMemBuffer(
+        filename + "/c/0", data + struct.pack("<I", _crc32c(data) ^ 1)
+    )
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    rg = ds.GetRootGroup()
+    ar = rg.OpenMDArray(rg.GetMDArrayNames()[0])
+    with gdal.quiet_errors():
+        assert ar.Read() is None
+    assert "checksum of chunk does not match" in gdal.GetLastErrorMsg()
+
+
+def test_zarr_write_crc32c_v3(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    j = {
+        "zarr_format": 3,
+        "node_type": "array",
+        "shape": [3],
+        "data_type": "int32",
+        "chunk_grid": {"name": "regular", "configuration": {"chunk_shape": [3]}},
+        "chunk_key_encoding": {"name": "default"},
+        "fill_value": 0,
+        "codecs": [
+            {"name": "bytes", "configuration": {"endian": "big"}},
+            {"name": "crc32c"},
+        ],
+    }
+    gdal.FileFromMemBuffer(filename + "/zarr.json", json.dumps(j))
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER | gdal.OF_UPDATE)
+    rg = ds.GetRootGroup()
+    ar = rg.OpenMDArray(rg.GetMDArrayNames()[0])
+    assert ar.Write(struct.pack("i" * 3, 1, -2, 3)) == gdal.CE_None
+    ds = None
+
+    content = gdal.VSIFile(filename + "/c/0", "rb").read()
+    assert content[0:12] == struct.pack(">iii", 1, -2, 3)
+    assert content[12:] == struct.pack("<I", _crc32c(content[0:12]))
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    rg = ds.GetRootGroup()
+    ar = rg.OpenMDArray(rg.GetMDArrayNames()[0])
+    assert struct.unpack("i" * 3, ar.Read()) == (1, -2, 3)
+
+
 @pytest.mark.parametrize(
     "j, error_msg",
     [
@@ -3851,6 +4056,55 @@ def test_zarr_advise_read(compression, format):
         gdal.RmdirRecursive(filename)
 
 
+@pytest.mark.parametrize("parallel_read", ["YES", "NO"])
+@pytest.mark.parametrize("format", ["ZARR_V2", "ZARR_V3"])
+def test_zarr_read_implicit_parallel(tmp_vsimem, format, parallel_read):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    dim0_size = 100
+    dim1_size = 150
+    data = array.array("B", [(i % 255) + 1 for i in range(dim0_size * dim1_size)])
+
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+        filename, options=["FORMAT=" + format]
+    )
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+    dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+    ar = rg.CreateMDArray(
+        "test",
+        [dim0, dim1],
+        gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+        ["COMPRESS=GZIP", "BLOCKSIZE=20,30"],
+    )
+    ar.SetNoDataValueDouble(0)
+    assert ar.Write(data) == gdal.CE_None
+    # Read back before closing, with a tile still dirty
+    with gdal.config_options(
+        {"ZARR_PARALLEL_READ": parallel_read, "GDAL_NUM_THREADS": "4"}
+    ):
+        assert ar.Read() == data
+    ds = None
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    with gdal.config_options(
+        {"ZARR_PARALLEL_READ": parallel_read, "GDAL_NUM_THREADS": "4"}
+    ):
+        assert ar.Read() == data
+        got = ar.Read(array_start_idx=[10, 25], count=[50, 70])
+        assert got == b"".join(
+            data[(10 + y) * dim1_size + 25 : (10 + y) * dim1_size + 95].tobytes()
+            for y in range(50)
+        )
+        # Strided request
+        got = ar.Read(array_start_idx=[0, 0], count=[50, 75], array_step=[2, 2])
+        assert got == b"".join(
+            data[2 * y * dim1_size : (2 * y + 1) * dim1_size : 2].tobytes()
+            for y in range(50)
+        )
+
+
 def test_zarr_read_invalid_nczarr_dim():
 
     try:
@@ -5470,3 +5724,79 @@ def test_zarr_read_cf1_zarrv3():
         ds.GetSpatialRef().ExportToProj4()
         == "+proj=utm +zone=11 +ellps=clrk66 +units=m +no_defs"
     )
+
+
+###############################################################################
+# Test that decoded tiles are served from the process-wide chunk cache
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("cache_size", [None, "0"])
+def test_zarr_read_chunk_cache(tmp_vsimem, cache_size):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(filename)
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("dim0", None, None, 2)
+    dim1 = rg.CreateDimension("dim1", None, None, 4)
+    ar = rg.CreateMDArray(
+        "ar",
+        [dim0, dim1],
+        gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+        ["BLOCKSIZE=2,2"],
+    )
+    ar.Write(array.array("B", [1, 2, 3, 4, 5, 6, 7, 8]))
+    ds = None
+
+    with gdaltest.config_option("GDAL_MDARRAY_CHUNK_CACHE_SIZE", cache_size):
+        ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+        ar = ds.GetRootGroup().OpenMDArray("ar")
+        assert ar.Read(array_start_idx=[0, 0], count=[2, 2]) == array.array(
+            "B", [1, 2, 5, 6]
+        )
+        assert ar.Read(array_start_idx=[0, 2], count=[2, 2]) == array.array(
+            "B", [3, 4, 7, 8]
+        )
+
+        # Only the chunk cache can still provide the content of this tile
+        gdal.Unlink(filename + "/ar/0.0")
+        if cache_size == "0":
+            expected = [0, 0, 0, 0]
+        else:
+            expected = [1, 2, 5, 6]
+        assert ar.Read(array_start_idx=[0, 0], count=[2, 2]) == array.array(
+            "B", expected
+        )
+
+
+###############################################################################
+# Test GDALMDArray::ReadPoints() on a chunked array
+
+
+@gdaltest.enable_exceptions()
+def test_zarr_read_points(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(filename)
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("time", None, None, 10)
+    dim1 = rg.CreateDimension("y", None, None, 5)
+    dim2 = rg.CreateDimension("x", None, None, 6)
+    ar = rg.CreateMDArray(
+        "ar",
+        [dim0, dim1, dim2],
+        gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+        ["BLOCKSIZE=3,2,4"],
+    )
+    ar.Write(array.array("H", [i for i in range(10 * 5 * 6)]))
+    ds = None
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("ar")
+    points = (
+        [(t, 1, 2) for t in range(10)]
+        + [(t, 4, 5) for t in range(9, -1, -1)]
+        + [(0, 0, 0), (5, 3, 1), (5, 3, 2), (8, 1, 5)]
+    )
+    got = struct.unpack("H" * len(points), ar.ReadPoints(points))
+    assert list(got) == [t * 30 + y * 6 + x for (t, y, x) in points]
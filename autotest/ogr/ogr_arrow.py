@@ -165,6 +165,20 @@ def test_ogr_arrow_1(use_vsi):
             gdal.Unlink(vsifilename)
 
 
+###############################################################################
+# Read a local file without memory mapping
+
+
+def test_ogr_arrow_1_no_memory_map():
+
+    with gdal.config_option("OGR_ARROW_MEMORY_MAP", "NO"):
+        ogr_parquet._check_test_parquet(
+            "data/arrow/test.feather",
+            expect_fast_get_extent=False,
+            expect_ignore_fields=False,
+        )
+
+
 ###############################################################################
 # Run test_ogrsf on a Feather file
 
@@ -3089,6 +3089,61 @@ def test_ogr_csv_geom_coord_precision_OGR_APPLY_GEOM_SET_PRECISION(tmp_vsimem):
     assert b"MULTIPOLYGON" in data
 
 
+###############################################################################
+# Test that parsing records in several threads through GetArrowStream()
+# gives the same result as sequential reading
+
+
+@pytest.mark.parametrize("chunk_size", ["1", "7", "1048576"])
+@pytest.mark.parametrize("eol", ["\n", "\r\n"])
+def test_ogr_csv_arrow_stream_multithreaded(tmp_vsimem, chunk_size, eol):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_csv_arrow_stream_multithreaded.csv")
+    lines = ["id,str"]
+    for i in range(1000):
+        if i % 10 == 0:
+            lines.append('%d,"multi%sline, ""quoted"" %d"' % (i, eol, i))
+        else:
+            lines.append("%d,foo%d" % (i, i))
+        if i % 100 == 0:
+            lines.append("")
+    gdal.FileFromMemBuffer(filename, eol.join(lines))
+
+    def get_values(num_threads, attr_filter=None):
+        ds = gdal.OpenEx(filename, open_options=["AUTODETECT_TYPE=YES"])
+        lyr = ds.GetLayer(0)
+        lyr.SetAttributeFilter(attr_filter)
+        with gdal.config_options(
+            {
+                "OGR_CSV_NUM_THREADS": num_threads,
+                "OGR_CSV_PARSE_CHUNK_SIZE": chunk_size,
+            }
+        ):
+            stream = lyr.GetArrowStreamAsNumPy(
+                options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=100"]
+            )
+            fids = []
+            ids = []
+            strs = []
+            for batch in stream:
+                fids += list(batch["OGC_FID"])
+                ids += list(batch["id"])
+                strs += [x.decode("utf-8") for x in batch["str"]]
+        return fids, ids, strs
+
+    expected = get_values("1")
+    assert expected[0] == list(range(1, 1001))
+    assert expected[1] == list(range(1000))
+    assert expected[2][10] == 'multi\nline, "quoted" 10'
+    assert get_values("4") == expected
+
+    expected = get_values("1", "id % 3 = 0")
+    assert len(expected[0]) == 334
+    assert get_values("4", "id % 3 = 0") == expected
+
+
 ###############################################################################
 
 
@@ -3103,3 +3158,4 @@ if __name__ == "__main__":
 
     print("Unknown test name")
     sys.exit(1)
+
@@ -3486,3 +3486,142 @@ def test_ogr_elasticsearch_upsert_feature(es_url, handle_get, handle_post):
     assert gdal.GetLastErrorMsg() == ""
 
     ds = None
+
+
+###############################################################################
+# Test SCROLL_SLICES open option
+
+
+def test_ogr_elasticsearch_sliced_scroll(
+    es_url, handle_get, handle_post, handle_delete
+):
+
+    handle_get("/fakeelasticsearch", """{"version":{"number":"7.0.0"}}""")
+
+    handle_get("""/fakeelasticsearch/_cat/indices?h=i""", "some_layer\n")
+
+    handle_get(
+        """/fakeelasticsearch/some_layer/_mapping?pretty""",
+        """
+    {
+        "some_layer":
+        {
+            "mappings":
+            {
+                "properties":
+                {
+                    "some_field": { "type": "long" }
+                }
+            }
+        }
+    }
+    """,
+    )
+
+    ds = gdal.OpenEx(
+        f"ES:{es_url}/fakeelasticsearch",
+        open_options=["SCROLL_SLICES=2", "FEATURE_COUNT_TO_ESTABLISH_FEATURE_DEFN=0"],
+    )
+    assert ds is not None
+    lyr = ds.GetLayer(0)
+
+    handle_post(
+        """/fakeelasticsearch/some_layer/_search?scroll=1m&size=100""",
+        post_body="""{ "slice": { "id": 0, "max": 2 } }""",
+        contents="""{
+        "_scroll_id": "slice0",
+        "hits": { "hits":[ { "_source": { "some_field": 1 } },
+                           { "_source": { "some_field": 2 } } ] }
+    }""",
+    )
+    handle_post(
+        """/fakeelasticsearch/some_layer/_search?scroll=1m&size=100""",
+        post_body="""{ "slice": { "id": 1, "max": 2 } }""",
+        contents="""{
+        "_scroll_id": "slice1",
+        "hits": { "hits":[ { "_source": { "some_field": 3 } } ] }
+    }""",
+    )
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=slice0""",
+        """{ "_scroll_id": "slice0", "hits": { "hits":[] } }""",
+    )
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=slice1""",
+        """{
+        "_scroll_id": "slice1b",
+        "hits": { "hits":[ { "_source": { "some_field": 4 } } ] }
+    }""",
+    )
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=slice1b""",
+        """{ "_scroll_id": "slice1b", "hits": { "hits":[] } }""",
+    )
+
+    assert [f["some_field"] for f in lyr] == [1, 2, 3, 4]
+
+    # Error on one of the slices
+    handle_get(
+        """/fakeelasticsearch/_search/scroll?scroll=1m&scroll_id=slice0""",
+        """{"error":"bad"}""",
+    )
+    handle_delete("/fakeelasticsearch/_search/scroll?scroll_id=slice1b", "{}")
+    lyr.ResetReading()
+    f = lyr.GetNextFeature()
+    assert f["some_field"] == 1
+    assert f.GetFID() == 1
+    lyr.GetNextFeature()
+    lyr.GetNextFeature()
+    gdal.ErrorReset()
+    with gdal.quiet_errors():
+        assert lyr.GetNextFeature() is None
+    assert gdal.GetLastErrorMsg() != ""
+
+
+###############################################################################
+# Test BULK_CONCURRENCY layer creation option
+
+
+def test_ogr_elasticsearch_bulk_concurrency(
+    es_url, handle_get, handle_post, handle_put
+):
+
+    handle_get("/fakeelasticsearch", """{"version":{"number":"7.0.0"}}""")
+
+    ds = ogrtest.elasticsearch_drv.CreateDataSource(f"{es_url}/fakeelasticsearch")
+    assert ds is not None
+
+    handle_put("/fakeelasticsearch/bulk_concurrency", "{}")
+    lyr = ds.CreateLayer(
+        "bulk_concurrency",
+        srs=ogrtest.srs_wgs84,
+        options=["GEO_SHAPE_ENCODING=WKT", "BULK_SIZE=1", "BULK_CONCURRENCY=2"],
+    )
+    handle_post(
+        """/fakeelasticsearch/bulk_concurrency/_mapping""",
+        post_body="""{ "properties": { "geometry": { "type": "geo_shape" } }, "_meta": { "fid": "ogc_fid" } }""",
+        contents="{}",
+    )
+    for i in range(1, 3):
+        handle_post(
+            """/fakeelasticsearch/_bulk""",
+            post_body="""{"index" :{"_index":"bulk_concurrency"}}
+{ "ogc_fid": %d, "geometry": "POINT (2 49)" }
+
+"""
+            % i,
+            contents="{}",
+        )
+
+    for i in range(3):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (2 49)"))
+        assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+
+    # The upload of the third feature fails
+    gdal.ErrorReset()
+    with gdal.quiet_errors():
+        assert lyr.SyncToDisk() != ogr.OGRERR_NONE
+    assert gdal.GetLastErrorMsg() != ""
+
+    ds = None
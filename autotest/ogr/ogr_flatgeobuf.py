@@ -1154,6 +1154,97 @@ def test_ogr_flatgeobuf_arrow_stream_numpy(layer_creation_options):
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test attribute filters evaluated directly on Arrow arrays
+
+
+@pytest.mark.parametrize(
+    "filter",
+    [
+        "int32 = 2",
+        "2 = int32",
+        "int32 <> 2",
+        "int32 > 1",
+        "1 < int32",
+        "int32 >= 2.5",
+        "int32 IN (1, 3)",
+        "int32 IN (1, NULL)",
+        "int32 BETWEEN 1 AND 2",
+        "int32 IS NULL",
+        "int32 IS NOT NULL",
+        "int64 = 1234567890123",
+        "int64 < 0",
+        "float64 = 1.5",
+        "float64 > 1",
+        "float64 BETWEEN -1 AND 1.5",
+        "float32 <= 1.25",
+        "bool = 1",
+        "str = 'ABC'",
+        "str <> 'abc'",
+        "str > 'b'",
+        "str IN ('def', 'xyz')",
+        "str BETWEEN 'a' AND 'c'",
+        "str LIKE 'ab%'",
+        "str LIKE 'AB%'",
+        "str LIKE 'abc'",
+        "str IS NULL",
+        "int32 = 2 AND str = 'def'",
+        "int32 = 2 OR str IS NULL",
+        "int32 IS NULL OR float64 > 1",
+        "NOT (int32 = 2)",
+        "NOT (int32 = 2 OR str = 'abc')",
+        "str LIKE '%b%'",
+        "FID = 1 OR int32 = 3",
+    ],
+)
+def test_ogr_flatgeobuf_arrow_stream_attribute_filter(tmp_vsimem, filter):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    field = ogr.FieldDefn("bool", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    field = ogr.FieldDefn("float32", ogr.OFTReal)
+    field.SetSubType(ogr.OFSTFloat32)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+
+    values = [
+        ("abc", 1, 1, 1234567890123, 1.25, 1.5),
+        ("def", 0, 2, -1, 0.5, -0.5),
+        (None, None, None, None, None, None),
+        ("abcd", 1, 3, 0, 2.5, 2.5),
+        ("xyz", 0, 2, 5, -1, 1),
+    ]
+    for row in values:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        for i, v in enumerate(row):
+            if v is None:
+                f.SetFieldNull(i)
+            else:
+                f.SetField(i, v)
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(1 2)"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetAttributeFilter(filter)
+    expected_fids = [f.GetFID() for f in lyr]
+    for options in ([], ["MAX_FEATURES_IN_BATCH=2"]):
+        stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"] + options)
+        got_fids = []
+        for batch in stream:
+            got_fids += list(batch["OGC_FID"])
+        assert got_fids == expected_fids, (filter, options)
+
+
 ###############################################################################
 # Test reading an empty file with GetArrowStream()
 
@@ -1419,3 +1510,108 @@ def test_ogr_flatgeobuf_write_mismatch_geom_type(tmp_vsimem):
         match="ICreateFeature: Mismatched geometry type. Feature geometry type is Line String, expected layer geometry type is Point",
     ):
         lyr.CreateFeature(f)
+
+
+###############################################################################
+# Test spatial filtering on a remote file, where the features found in the
+# spatial index are prefetched with AdviseRead()
+
+
+@pytest.mark.require_curl()
+def test_ogr_flatgeobuf_spatial_filter_remote_file(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = "x" * (i % 100)
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i % 40} {i // 40})"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    def get_features(filename):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilterRect(5.5, 3.5, 30.5, 20.5)
+        ret = [(f.GetFID(), f["str"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+        # Second iteration, and last feature of the file
+        lyr.SetSpatialFilterRect(38.5, 23.5, 39.5, 24.5)
+        ret += [(f.GetFID(), f["str"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+        return ret
+
+    expected = get_features(filename)
+    assert len(expected) == 25 * 17 + 1
+
+    (webserver_process, webserver_port) = webserver.launch(
+        handler=webserver.DispatcherHttpHandler
+    )
+    if webserver_port == 0:
+        pytest.skip("cannot start HTTP server")
+
+    gdal.VSICurlClearCache()
+    try:
+        f = gdal.VSIFOpenL(filename, "rb")
+        data = gdal.VSIFReadL(1, 1000000, f)
+        gdal.VSIFCloseL(f)
+        handler = webserver.FileHandler({"/test.fgb": data})
+        with webserver.install_http_handler(handler):
+            got = get_features(f"/vsicurl/http://localhost:{webserver_port}/test.fgb")
+        assert got == expected
+    finally:
+        webserver.server_stop(webserver_process, webserver_port)
+        gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test writing with the external merge sort of the feature items, and
+# multi-threading
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("max_items_in_memory", [None, "1", "100", "999"])
+def test_ogr_flatgeobuf_write_external_sort(
+    tmp_vsimem, tmp_path, num_threads, max_items_in_memory
+):
+    def create(filename):
+        ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+        lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        for i in range(1000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["str"] = "x" * (i % 100)
+            # Some duplicated geometries to test ties in the Hilbert sort
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    f"POINT ({(i * 7) % 40} {0 if i % 10 == 0 else (i * 3) % 50})"
+                )
+            )
+            lyr.CreateFeature(f)
+        ds = None
+
+    def read(filename):
+        f = gdal.VSIFOpenL(filename, "rb")
+        data = gdal.VSIFReadL(1, 1000000, f)
+        gdal.VSIFCloseL(f)
+        return data
+
+    ref_filename = str(tmp_vsimem / "ref.fgb")
+    create(ref_filename)
+    ref_data = read(ref_filename)
+
+    for filename in (str(tmp_vsimem / "test.fgb"), str(tmp_path / "test.fgb")):
+        with gdal.config_options(
+            {
+                "OGR_FLATGEOBUF_NUM_THREADS": num_threads,
+                "OGR_FLATGEOBUF_MAX_ITEMS_IN_MEMORY": max_items_in_memory,
+            }
+        ):
+            create(filename)
+        assert read(filename) == ref_data
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 1000
+    lyr.SetSpatialFilterRect(-0.5, -0.5, 0.5, 0.5)
+    assert lyr.GetFeatureCount() == 25
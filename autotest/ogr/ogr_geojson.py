@@ -5151,3 +5151,87 @@ def test_ogr_geojson_geom_coord_precision_RFC7946(tmp_vsimem):
     prec = geom_fld.GetCoordinatePrecision()
     assert prec.GetXYResolution() == pytest.approx(8.983152841195214e-09)
     assert prec.GetZResolution() == 1e-3
+
+
+###############################################################################
+# Test reading LineString and Polygon positions of different dimensions
+
+
+def test_ogr_geojson_read_positions_mixed_dimensions():
+
+    g = ogr.CreateGeometryFromJson(
+        '{"type":"LineString","coordinates":[[1,2],[3.5,4.5,5],[6,7]]}'
+    )
+    assert g.ExportToIsoWkt() == "LINESTRING Z (1 2 0,3.5 4.5 5,6 7 0)"
+
+    g = ogr.CreateGeometryFromJson(
+        '{"type":"Polygon","coordinates":[[[0,0],[0,1],[1,1],[0,0]]]}'
+    )
+    assert g.ExportToIsoWkt() == "POLYGON ((0 0,0 1,1 1,0 0))"
+
+    g = ogr.CreateGeometryFromJson('{"type":"LineString","coordinates":[]}')
+    assert g.ExportToIsoWkt() == "LINESTRING EMPTY"
+
+    with gdal.quiet_errors():
+        assert (
+            ogr.CreateGeometryFromJson(
+                '{"type":"LineString","coordinates":[[1,2],[3,"a"]]}'
+            )
+            is None
+        )
+        assert (
+            ogr.CreateGeometryFromJson(
+                '{"type":"LineString","coordinates":[[1,2],[3]]}'
+            )
+            is None
+        )
+
+
+###############################################################################
+# Test that WriteArrowBatch() with multi-threaded serialization gives the
+# same result as single-threaded writing
+
+
+@pytest.mark.require_driver("Memory")
+def test_ogr_geojson_write_arrow_batch_multithreaded(tmp_vsimem):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("src")
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(2500):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        if i % 7 != 0:
+            f["str"] = "foo%d" % i
+        if i % 11 != 0:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %f)" % (i, i / 3)))
+        src_lyr.CreateFeature(f)
+
+    def write(num_threads):
+        filename = str(tmp_vsimem / ("out_%s.geojson" % num_threads))
+        ds = ogr.GetDriverByName("GeoJSON").CreateDataSource(filename)
+        lyr = ds.CreateLayer("test", options=["ID_GENERATE=YES", "WRITE_BBOX=YES"])
+        stream = src_lyr.GetArrowStream(
+            ["INCLUDE_FID=NO", "MAX_FEATURES_IN_BATCH=1000"]
+        )
+        schema = stream.GetSchema()
+        for i in range(schema.GetChildrenCount()):
+            if schema.GetChild(i).GetName() != "wkb_geometry":
+                lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+        with gdal.config_option("OGR_GEOJSON_NUM_THREADS", num_threads):
+            while True:
+                array = stream.GetNextRecordBatch()
+                if array is None:
+                    break
+                assert lyr.WriteArrowBatch(schema, array) == ogr.OGRERR_NONE
+        ds.Close()
+
+        f = gdal.VSIFOpenL(filename, "rb")
+        data = gdal.VSIFReadL(1, 10000000, f)
+        gdal.VSIFCloseL(f)
+        return data
+
+    expected = write("1")
+    assert b'"id": 2499' in expected
+    assert write("4") == expected
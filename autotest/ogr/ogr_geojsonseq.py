@@ -285,6 +285,72 @@ def test_ogr_geojsonseq_read_rs_json_pretty():
     assert lyr.GetNextFeature() is None
 
 
+###############################################################################
+# Test that parsing objects in several threads through GetArrowStream()
+# gives the same result as sequential reading
+
+
+@pytest.mark.parametrize("chunk_size", ["1", "100", "1048576"])
+@pytest.mark.parametrize("rs", [False, True])
+def test_ogr_geojsonseq_arrow_stream_multithreaded(tmp_vsimem, chunk_size, rs):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_geojsonseq_arrow_stream_multithreaded")
+    filename += ".geojsons" if rs else ".geojsonl"
+    objects = []
+    for i in range(1000):
+        if i % 100 == 0:
+            objects.append('{"type":"Point","coordinates":[%d,0]}' % i)
+        elif rs and i % 10 == 0:
+            objects.append(
+                '{"type":"Feature",\n"properties":{"id":%d,"str":"foo%d"},\n'
+                '"geometry":{"type":"Point","coordinates":[%d,0]}}' % (i, i, i)
+            )
+        else:
+            objects.append(
+                '{"type":"Feature","properties":{"id":%d,"str":"foo%d"},'
+                '"geometry":{"type":"Point","coordinates":[%d,0]}}' % (i, i, i)
+            )
+    if rs:
+        content = "".join("\x1e" + x + "\n" for x in objects)
+    else:
+        content = "\r\n".join(objects)
+    gdal.FileFromMemBuffer(filename, content)
+
+    def get_values(num_threads, attr_filter=None):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        lyr.SetAttributeFilter(attr_filter)
+        with gdal.config_options(
+            {
+                "OGR_GEOJSONSEQ_NUM_THREADS": num_threads,
+                "OGR_GEOJSONSEQ_PARSE_CHUNK_SIZE": chunk_size,
+            }
+        ):
+            stream = lyr.GetArrowStreamAsNumPy(
+                options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=100"]
+            )
+            fids = []
+            ids = []
+            strs = []
+            for batch in stream:
+                fids += list(batch["OGC_FID"])
+                ids += list(batch["id"])
+                strs += [x.decode("utf-8") if x else None for x in batch["str"]]
+        return fids, ids, strs
+
+    expected = get_values("1")
+    assert expected[0] == list(range(1000))
+    assert expected[2][1] == "foo1"
+    assert expected[2][100] is None
+    assert get_values("4") == expected
+
+    expected = get_values("1", "id % 3 = 0")
+    assert len(expected[0]) == 330
+    assert get_values("4", "id % 3 = 0") == expected
+
+
 def test_ogr_geojsonseq_test_ogrsf():
 
     import test_cli_utilities
@@ -490,3 +556,55 @@ def test_ogr_geojsonseq_geom_coord_precision_not_4326(tmp_vsimem):
     gdal.VSIFCloseL(f)
 
     assert b'"coordinates": [ 2.363925, 45.151706, 9.877 ]' in data
+
+
+###############################################################################
+# Test that WriteArrowBatch() with multi-threaded serialization gives the
+# same result as single-threaded writing
+
+
+@pytest.mark.require_driver("Memory")
+@pytest.mark.parametrize("rs", [False, True])
+def test_ogr_geojsonseq_write_arrow_batch_multithreaded(tmp_vsimem, rs):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("src")
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(2500):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        if i % 7 != 0:
+            f["str"] = "foo%d" % i
+        if i % 11 != 0:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %f)" % (i, i / 3)))
+        src_lyr.CreateFeature(f)
+
+    def write(num_threads):
+        filename = str(tmp_vsimem / ("out_%s" % num_threads))
+        filename += ".geojsons" if rs else ".geojsonl"
+        ds = ogr.GetDriverByName("GeoJSONSeq").CreateDataSource(filename)
+        lyr = ds.CreateLayer("test", options=["RS=YES" if rs else "RS=NO"])
+        stream = src_lyr.GetArrowStream(
+            ["INCLUDE_FID=NO", "MAX_FEATURES_IN_BATCH=1000"]
+        )
+        schema = stream.GetSchema()
+        for i in range(schema.GetChildrenCount()):
+            if schema.GetChild(i).GetName() != "wkb_geometry":
+                lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+        with gdal.config_option("OGR_GEOJSONSEQ_NUM_THREADS", num_threads):
+            while True:
+                array = stream.GetNextRecordBatch()
+                if array is None:
+                    break
+                assert lyr.WriteArrowBatch(schema, array) == ogr.OGRERR_NONE
+        ds.Close()
+
+        f = gdal.VSIFOpenL(filename, "rb")
+        data = gdal.VSIFReadL(1, 10000000, f)
+        gdal.VSIFCloseL(f)
+        return data
+
+    expected = write("1")
+    assert expected.count(b"\n") == 2500
+    assert write("4") == expected
@@ -4327,3 +4327,74 @@ def test_ogr_gml_geom_link_to_immediate_child():
         "data/gml/link_to_immediate_child.gml", open_options=["WRITE_GFS=NO"]
     )
     assert ds
+
+
+###############################################################################
+# Test building geometries in worker threads (GML_NUM_THREADS)
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_gml_num_threads(tmp_vsimem, num_threads):
+
+    members = []
+    for i in range(500):
+        if i % 3 == 0:
+            geom = f"<gml:Point><gml:pos>{i} {i}</gml:pos></gml:Point>"
+        elif i % 3 == 1:
+            geom = (
+                "<gml:LineString><gml:posList>"
+                f"{i} 0 {i + 1} 1 {i + 2} 2</gml:posList></gml:LineString>"
+            )
+        else:
+            geom = (
+                "<gml:Polygon><gml:exterior><gml:LinearRing><gml:posList>"
+                f"{i} 0 {i + 1} 0 {i + 1} 1 {i} 0"
+                "</gml:posList></gml:LinearRing></gml:exterior></gml:Polygon>"
+            )
+        if i == 250:
+            # Corrupted geometry
+            geom = "<gml:LineString><gml:posList>0</gml:posList></gml:LineString>"
+        members.append(
+            f"<gml:featureMember><layer1 gml:id='layer1.{i}'>"
+            f"<id>{i}</id><geometry>{geom}</geometry></layer1></gml:featureMember>"
+        )
+    data = (
+        '<FeatureCollection xmlns:gml="http://www.opengis.net/gml">'
+        + "\n".join(members)
+        + "</FeatureCollection>"
+    )
+    filename = tmp_vsimem / "test_ogr_gml_num_threads.gml"
+    gdal.FileFromMemBuffer(filename, data)
+
+    with gdal.config_options(
+        {"GML_NUM_THREADS": num_threads, "GML_SKIP_CORRUPTED_FEATURES": "YES"}
+    ):
+        with gdal.quiet_errors():
+            ds = ogr.Open(filename)
+            lyr = ds.GetLayer(0)
+            gdal.ErrorReset()
+            features = [f for f in lyr]
+        assert "Geometry of feature 250 layer1.250 cannot be parsed" in (
+            gdal.GetLastErrorMsg()
+        )
+
+    assert len(features) == 499
+    for f in features:
+        i = f["id"]
+        assert f.GetFID() == i
+        g = f.GetGeometryRef()
+        if i % 3 == 0:
+            assert g.ExportToWkt() == f"POINT ({i} {i})"
+        elif i % 3 == 1:
+            assert g.ExportToWkt() == f"LINESTRING ({i} 0,{i + 1} 1,{i + 2} 2)"
+        else:
+            assert (
+                g.ExportToWkt() == f"POLYGON (({i} 0,{i + 1} 0,{i + 1} 1,{i} 0))"
+            )
+
+    # Multi-layer file
+    for read_mode in ("STANDARD", "SEQUENTIAL_LAYERS"):
+        with gdal.config_options(
+            {"GML_NUM_THREADS": num_threads, "GML_READ_MODE": read_mode}
+        ):
+            test_ogr_gml_29()
@@ -8408,6 +8408,58 @@ def test_ogr_gpkg_arrow_stream_numpy_multi_threading(
     assert i == num_features
 
 
+###############################################################################
+# Test GetArrowStreamAsNumPy() and multi-threading on a table with holes in
+# FID numbering
+
+
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_ogr_gpkg_arrow_stream_numpy_multi_threading_fid_holes(
+    tmp_vsimem, num_threads
+):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = tmp_vsimem / "test.gpkg"
+
+    ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    lyr.StartTransaction()
+    for i in range(2000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["i"] = i
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+        lyr.CreateFeature(f)
+    lyr.CommitTransaction()
+    # Remove a full batch, and a few other rows
+    ds.ExecuteSQL("DELETE FROM test WHERE fid BETWEEN 301 AND 500")
+    ds.ExecuteSQL("DELETE FROM test WHERE fid % 7 = 0 OR fid <= 5")
+    ds = None
+
+    def get_values(options):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        with gdaltest.config_options(options):
+            stream = lyr.GetArrowStreamAsNumPy(
+                options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=100"]
+            )
+            fids = []
+            values = []
+            for batch in stream:
+                assert len(batch["fid"]) > 0
+                fids += list(batch["fid"])
+                values += list(batch["i"])
+        return fids, values
+
+    expected_fids = [
+        i for i in range(6, 2001) if not (301 <= i <= 500) and i % 7 != 0
+    ]
+    expected = get_values({"OGR_GPKG_STREAM_BASE_IMPL": "YES"})
+    assert expected[0] == expected_fids
+    assert get_values({"OGR_GPKG_NUM_THREADS": str(num_threads)}) == expected
+
+
 ###############################################################################
 # Test Arrow interface with bool fields
 
@@ -8578,11 +8630,20 @@ def test_ogr_gpkg_arrow_stream_numpy_detailed_spatial_filter(tmp_vsimem, layer_t
         batches = [batch for batch in stream]
         if ogrtest.have_geos():
             assert len(batches) == 0
+            assert [f.GetFID() for f in lyr] == []
         else:
             assert len(batches) == 1
             assert list(batches[0]["fid"]) == [4, 5]
             assert [f.GetFID() for f in lyr] == [4, 5]
 
+    # Select everything but empty geometries
+    with ogrtest.spatial_filter(lyr, -1000, -1000, 1000, 1000):
+        stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+        batches = [batch for batch in stream]
+        assert len(batches) == 1
+        assert list(batches[0]["fid"]) == [0, 1, 2, 3, 4, 5]
+        assert [f.GetFID() for f in lyr] == [0, 1, 2, 3, 4, 5]
+
     if layer_type != "direct":
         ds.ReleaseResultSet(lyr)
 
@@ -9067,6 +9128,57 @@ def test_ogr_gpkg_background_rtree_build(
     ds = None
 
 
+###############################################################################
+# Test that the packed R-Tree built by CreateSpatialIndex() is valid
+
+
+@pytest.mark.parametrize("OGR_GPKG_MAX_RAM_USAGE_RTREE", (1000, None))
+def test_ogr_gpkg_create_spatial_index_packed_rtree(
+    tmp_vsimem, OGR_GPKG_MAX_RAM_USAGE_RTREE
+):
+
+    filename = tmp_vsimem / "test_ogr_gpkg_create_spatial_index_packed_rtree.gpkg"
+    ds = gdaltest.gpkg_dr.CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", options=["SPATIAL_INDEX=NO"])
+    lyr.StartTransaction()
+    for i in range(100):
+        for j in range(100):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f.SetGeometryDirectly(
+                ogr.CreateGeometryFromWkt(
+                    "LINESTRING(%d %d,%d %d)" % (i, j, i + 0.5, j + 0.5)
+                )
+            )
+            lyr.CreateFeature(f)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    lyr.CreateFeature(f)
+    lyr.CommitTransaction()
+    with gdaltest.config_option(
+        "OGR_GPKG_MAX_RAM_USAGE_RTREE",
+        (
+            str(OGR_GPKG_MAX_RAM_USAGE_RTREE)
+            if OGR_GPKG_MAX_RAM_USAGE_RTREE is not None
+            else None
+        ),
+    ):
+        with ds.ExecuteSQL("SELECT CreateSpatialIndex('test', 'geom')"):
+            pass
+    ds = None
+
+    ds = ogr.Open(filename)
+    with ds.ExecuteSQL("SELECT rtreecheck('rtree_test_geom')") as sql_lyr:
+        f = sql_lyr.GetNextFeature()
+        assert f.GetField(0) == "ok"
+    with ds.ExecuteSQL("SELECT * FROM rtree_test_geom") as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 100 * 100
+    lyr = ds.GetLayer(0)
+    lyr.SetSpatialFilterRect(10.25, 20.25, 12.75, 25.75)
+    assert lyr.GetFeatureCount() == 3 * 6
+    lyr.SetSpatialFilterRect(-1, -1, 100, 100)
+    assert lyr.GetFeatureCount() == 100 * 100
+    ds = None
+
+
 ###############################################################################
 
 
@@ -9980,6 +10092,54 @@ def test_ogr_gpkg_write_arrow_fallback_types(tmp_vsimem):
     assert f.GetGeometryRef().ExportToIsoWkt() == "POINT (1 2)"
 
 
+###############################################################################
+# Test WriteArrowBatch() with geometry blobs encoded by worker threads
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@gdaltest.enable_exceptions()
+def test_ogr_gpkg_write_arrow_multithreaded_geom_encoding(tmp_vsimem, num_threads):
+
+    src_ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("test")
+    src_lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    wkts = []
+    for i in range(1000):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["id"] = i
+        if i % 4 == 0:
+            wkt = f"POINT ({i} {-i})"
+        elif i % 4 == 1:
+            wkt = f"LINESTRING Z ({i} 0 1,{i + 1} 1 2)"
+        elif i % 4 == 2:
+            wkt = None
+        else:
+            wkt = f"POLYGON (({i} 0,{i} 1,{i + 1} 1,{i} 0))"
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+        wkts.append(wkt)
+
+    filename = tmp_vsimem / "test_ogr_gpkg_write_arrow_multithreaded.gpkg"
+    with gdaltest.config_option("OGR_GPKG_NUM_THREADS", num_threads):
+        ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbUnknown)
+        lyr.WriteArrow(src_lyr)
+        ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == len(wkts)
+    for i, f in enumerate(lyr):
+        assert f["id"] == i
+        g = f.GetGeometryRef()
+        if wkts[i] is None:
+            assert g is None
+        else:
+            assert g.ExportToIsoWkt() == wkts[i]
+    assert lyr.GetExtent() == (0, 1000, -996, 1)
+
+
 ###############################################################################
 # Test a SQL request with the geometry in the first row being null
 
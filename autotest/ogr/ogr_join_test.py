@@ -28,6 +28,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -481,3 +482,61 @@ def test_ogr_join_23():
     ds.ReleaseResultSet(sql_lyr)
 
     ds = None
+
+
+###############################################################################
+# Test that joins through a hash table of the secondary layer give the same
+# results as joins through attribute filters
+
+
+@pytest.mark.parametrize("max_memory", [None, "0", "100"])
+def test_ogr_join_hash(max_memory):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("first", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    for s, i in [("a", 1), ("B", 2), ("c", None), (None, 3), ("b", 4)]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["s"] = s
+        f["i"] = i
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for s, r, val in [
+        ("A", 4.0, "first_a"),
+        ("b", 2.0, "first_b"),
+        ("a", 1.0, "second_a"),
+        (None, 3.0, "null"),
+        ("b", 2.5, "second_b"),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["s"] = s
+        f["r"] = r
+        f["val"] = val
+        lyr.CreateFeature(f)
+
+    with gdaltest.config_option("OGR_SQL_JOIN_HASH_MAX_MEMORY", max_memory):
+        with ds.ExecuteSQL(
+            "SELECT * FROM first LEFT JOIN second ON first.s = second.s"
+        ) as sql_lyr:
+            assert [f["second.val"] for f in sql_lyr] == [
+                "first_a",
+                "first_b",
+                None,
+                None,
+                "first_b",
+            ]
+        with ds.ExecuteSQL(
+            "SELECT * FROM first LEFT JOIN second ON first.i = second.r"
+        ) as sql_lyr:
+            assert [f["second.val"] for f in sql_lyr] == [
+                "second_a",
+                "first_b",
+                None,
+                "null",
+                "first_a",
+            ]
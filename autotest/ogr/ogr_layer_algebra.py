@@ -584,3 +584,65 @@ def test_algebra_erase_5(A, empty, C):
     assert C.GetFeatureCount() == A.GetFeatureCount(), (
         "Layer.Erase returned " + str(C.GetFeatureCount()) + " features"
     )
+
+
+###############################################################################
+# Test that IN_MEMORY_SPATIAL_INDEX=YES gives the same results as setting a
+# spatial filter on the layers for each feature
+
+
+@pytest.mark.parametrize(
+    "method",
+    ["Intersection", "Union", "SymDifference", "Identity", "Update", "Clip", "Erase"],
+)
+@pytest.mark.parametrize("with_method_filter", [False, True])
+def test_algebra_in_memory_spatial_index(mem_ds, method, with_method_filter):
+
+    def create_grid(name, offset, n):
+        lyr = mem_ds.CreateLayer(name)
+        lyr.CreateField(ogr.FieldDefn(name, ogr.OFTInteger))
+        for i in range(n):
+            for j in range(n):
+                x = i * 2 + offset
+                y = j * 2 + offset
+                feat = ogr.Feature(lyr.GetLayerDefn())
+                feat[name] = i * n + j
+                feat.SetGeometryDirectly(
+                    ogr.CreateGeometryFromWkt(
+                        f"POLYGON(({x} {y},{x} {y+1.5},{x+1.5} {y+1.5},"
+                        f"{x+1.5} {y},{x} {y}))"
+                    )
+                )
+                lyr.CreateFeature(feat)
+        # feature without geometry
+        feat = ogr.Feature(lyr.GetLayerDefn())
+        feat[name] = -1
+        lyr.CreateFeature(feat)
+        return lyr
+
+    input_lyr = create_grid("input", 0, 5)
+    method_lyr = create_grid("method", 0.75, 4)
+    if with_method_filter:
+        method_lyr.SetSpatialFilterRect(0, 0, 4, 4)
+
+    results = []
+    for index in ("NO", "YES"):
+        result_lyr = mem_ds.CreateLayer("result_" + index)
+        assert (
+            getattr(input_lyr, method)(
+                method_lyr, result_lyr, options=["IN_MEMORY_SPATIAL_INDEX=" + index]
+            )
+            == ogr.OGRERR_NONE
+        )
+        results.append(result_lyr)
+
+    assert results[0].GetFeatureCount() > 0
+    assert results[0].GetFeatureCount() == results[1].GetFeatureCount()
+    assert is_same(results[0], results[1])
+
+    # The spatial filters of the layers must be left untouched
+    assert input_lyr.GetSpatialFilter() is None
+    if with_method_filter:
+        assert method_lyr.GetSpatialFilter() is not None
+    else:
+        assert method_lyr.GetSpatialFilter() is None
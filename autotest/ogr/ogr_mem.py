@@ -1285,6 +1285,66 @@ def test_ogr_mem_arrow_stream_pyarrow_geoarrow_metadata():
     assert metadata["crs"]["id"] == {"authority": "EPSG", "code": 32631}
 
 
+###############################################################################
+# Test GetArrowStream() with GEOMETRY_ENCODING=GEOARROW
+
+
+@pytest.mark.parametrize(
+    "geom_type,wkt,extension_name",
+    [
+        (ogr.wkbPoint, "POINT (1 2)", "geoarrow.point"),
+        (ogr.wkbPointZM, "POINT ZM (1 2 3 4)", "geoarrow.point"),
+        (ogr.wkbLineString, "LINESTRING (1 2,3 4)", "geoarrow.linestring"),
+        (
+            ogr.wkbPolygon,
+            "POLYGON ((0 0,0 10,10 10,0 0),(1 1,1 9,9 9,1 1))",
+            "geoarrow.polygon",
+        ),
+        (ogr.wkbMultiPoint, "MULTIPOINT ((1 2),(3 4))", "geoarrow.multipoint"),
+        (
+            ogr.wkbMultiLineString,
+            "MULTILINESTRING ((1 2,3 4),(5 6,7 8))",
+            "geoarrow.multilinestring",
+        ),
+        (
+            ogr.wkbMultiPolygon,
+            "MULTIPOLYGON (((0 0,0 1,1 1,0 0)),((10 10,10 11,11 11,10 10)))",
+            "geoarrow.multipolygon",
+        ),
+    ],
+)
+def test_ogr_mem_arrow_stream_pyarrow_geoarrow_native_encoding(
+    geom_type, wkt, extension_name
+):
+    pytest.importorskip("pyarrow")
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("foo", geom_type=geom_type)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+    lyr.CreateFeature(f)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    lyr.CreateFeature(f)
+
+    stream = lyr.GetArrowStreamAsPyArrow(["GEOMETRY_ENCODING=GEOARROW"])
+    md = stream.schema["wkb_geometry"].metadata
+    assert md[b"ARROW:extension:name"] == extension_name.encode("ASCII")
+    batches = [batch for batch in stream]
+    assert len(batches) == 1
+    assert batches[0].num_rows == 2
+
+    out_lyr = ds.CreateLayer("out", geom_type=geom_type)
+    stream = lyr.GetArrowStreamAsPyArrow(["GEOMETRY_ENCODING=GEOARROW"])
+    for batch in stream:
+        out_lyr.WritePyArrow(batch)
+
+    assert out_lyr.GetFeatureCount() == 2
+    f = out_lyr.GetNextFeature()
+    assert f.GetGeometryRef().ExportToIsoWkt() == wkt
+    f = out_lyr.GetNextFeature()
+    assert f.GetGeometryRef() is None
+
+
 ###############################################################################
 # Test upserting a feature.
 
@@ -2860,3 +2920,261 @@ def test_ogr_mem_lyr_get_dataset():
     ds = ogr.GetDriverByName("Memory").CreateDataSource("foo")
     lyr = ds.CreateLayer("test")
     assert lyr.GetDataset().GetDescription() == "foo"
+
+
+###############################################################################
+# Test the spatial index
+
+
+@pytest.mark.parametrize("spatial_index", ["YES", "NO"])
+def test_ogr_mem_spatial_index(spatial_index):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test", options=["SPATIAL_INDEX=" + spatial_index])
+    for i in range(100):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i % 10} {i // 10})"))
+        lyr.CreateFeature(f)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    lyr.CreateFeature(f)
+
+    def get_fids():
+        return [f.GetFID() for f in lyr]
+
+    lyr.SetSpatialFilterRect(1.5, 0.5, 3.5, 2.5)
+    assert get_fids() == [12, 13, 22, 23]
+
+    # Update the index incrementally
+    f = lyr.GetFeature(12)
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (9 9)"))
+    lyr.SetFeature(f)
+    lyr.DeleteFeature(13)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (2 2)"))
+    lyr.CreateFeature(f)
+    assert get_fids() == [22, 23, 101]
+    assert lyr.GetFeatureCount() == 3
+
+    f = lyr.GetFeature(22)
+    f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (5 5)"))
+    lyr.UpdateFeature(f, [], [0], False)
+    assert get_fids() == [23, 101]
+
+    # Feature outside of the extent of the index
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(
+        ogr.CreateGeometryFromWkt("LINESTRING (-100 -100,100 100)")
+    )
+    lyr.CreateFeature(f)
+    assert get_fids() == [23, 101, 102]
+
+    lyr.SetSpatialFilterRect(50, 50, 200, 200)
+    assert get_fids() == [102]
+
+    lyr.SetSpatialFilterRect(1000, 1000, 2000, 2000)
+    assert get_fids() == []
+
+    lyr.SetSpatialFilter(None)
+    assert lyr.GetFeatureCount() == 102
+
+
+###############################################################################
+# Test attribute indexes
+
+
+def test_ogr_mem_attribute_index():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("real_field", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("date_field", ogr.OFTDate))
+    for i in range(100):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_field"] = i % 10
+        f["real_field"] = i % 7
+        f["str_field"] = "foo%d" % (i % 5)
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({i} 0)"))
+        lyr.CreateFeature(f)
+
+    def get_fids(where):
+        lyr.SetAttributeFilter(where)
+        ret = [f.GetFID() for f in lyr]
+        lyr.SetAttributeFilter(None)
+        return ret
+
+    queries = [
+        "int_field = 3",
+        "int_field IN (3, 5)",
+        "real_field = 2",
+        "real_field = 2.0",
+        "str_field = 'foo1'",
+        "str_field = 'FOO1'",
+        "int_field = 3 AND str_field = 'foo3'",
+        "int_field = 3 OR str_field = 'foo0'",
+        "int_field = 3 AND real_field > 3",
+    ]
+    expected = [get_fids(q) for q in queries]
+
+    ds.ExecuteSQL("CREATE INDEX ON test USING int_field")
+    ds.ExecuteSQL("CREATE INDEX ON test USING real_field")
+    ds.ExecuteSQL("CREATE INDEX ON test USING str_field")
+    with gdal.quiet_errors():
+        ds.ExecuteSQL("CREATE INDEX ON test USING date_field")
+        assert gdal.GetLastErrorMsg() != ""
+
+    assert [get_fids(q) for q in queries] == expected
+
+    # Combination with a spatial filter
+    lyr.SetSpatialFilterRect(10, -1, 50, 1)
+    assert get_fids("int_field = 3") == [13, 23, 33, 43]
+    lyr.SetSpatialFilter(None)
+
+    # Index maintenance
+    f = lyr.GetFeature(3)
+    f["int_field"] = 4
+    lyr.SetFeature(f)
+    lyr.DeleteFeature(13)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["int_field"] = 3
+    lyr.CreateFeature(f)
+    assert get_fids("int_field = 3") == [23, 33, 43, 53, 63, 73, 83, 93, 100]
+
+    # Schema changes
+    lyr.DeleteField(lyr.GetLayerDefn().GetFieldIndex("date_field"))
+    lyr.ReorderFields([2, 0, 1])
+    assert get_fids("int_field = 3") == [23, 33, 43, 53, 63, 73, 83, 93, 100]
+    assert get_fids("str_field = 'foo1'") == expected[4]
+    lyr.DeleteField(lyr.GetLayerDefn().GetFieldIndex("str_field"))
+    assert get_fids("int_field = 3") == [23, 33, 43, 53, 63, 73, 83, 93, 100]
+
+    fld_defn = ogr.FieldDefn("int_field", ogr.OFTReal)
+    lyr.AlterFieldDefn(
+        lyr.GetLayerDefn().GetFieldIndex("int_field"), fld_defn, ogr.ALTER_TYPE_FLAG
+    )
+    assert get_fids("int_field = 3.0") == [23, 33, 43, 53, 63, 73, 83, 93, 100]
+
+    ds.ExecuteSQL("DROP INDEX ON test USING int_field")
+    assert get_fids("int_field = 3.0") == [23, 33, 43, 53, 63, 73, 83, 93, 100]
+
+
+###############################################################################
+# Test COLUMNAR=YES layer creation option
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_mem_columnar_layer():
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    src_lyr = ds.CreateLayer("src")
+    src_lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    for i in range(10):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["int_field"] = i
+        f["str_field"] = "foo%d" % i
+        if i != 5:
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d %d)" % (i, -i)))
+        src_lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("test", options=["COLUMNAR=YES"])
+    assert lyr.TestCapability(ogr.OLCFastWriteArrowBatch)
+    stream = src_lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=3"])
+    schema = stream.GetSchema()
+    for i in range(schema.GetChildrenCount()):
+        if schema.GetChild(i).GetName() not in ("OGC_FID", "wkb_geometry"):
+            lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        assert lyr.WriteArrowBatch(schema, array) == ogr.OGRERR_NONE
+
+    assert not lyr.TestCapability(ogr.OLCCreateField)
+    with pytest.raises(Exception):
+        lyr.CreateField(ogr.FieldDefn("other"))
+    with pytest.raises(Exception):
+        lyr.CreateFeature(ogr.Feature(lyr.GetLayerDefn()))
+
+    assert lyr.TestCapability(ogr.OLCFastFeatureCount)
+    assert lyr.GetFeatureCount() == 10
+    assert lyr.TestCapability(ogr.OLCFastGetExtent)
+    assert lyr.GetExtent() == (0, 9, -9, 0)
+
+    for src_f in src_lyr:
+        f = lyr.GetNextFeature()
+        assert f.GetFID() == src_f.GetFID()
+        assert f["int_field"] == src_f["int_field"]
+        assert f["str_field"] == src_f["str_field"]
+        if src_f.GetGeometryRef():
+            assert f.GetGeometryRef().ExportToIsoWkt() == (
+                src_f.GetGeometryRef().ExportToIsoWkt()
+            )
+        else:
+            assert f.GetGeometryRef() is None
+    assert lyr.GetNextFeature() is None
+
+    f = lyr.GetFeature(7)
+    assert f["str_field"] == "foo7"
+    assert lyr.GetFeature(10) is None
+    assert lyr.GetFeature(-1) is None
+
+    lyr.SetAttributeFilter("int_field >= 4")
+    lyr.SetSpatialFilterRect(1.5, -7.5, 7.5, -1.5)
+    assert not lyr.TestCapability(ogr.OLCFastFeatureCount)
+    assert [f.GetFID() for f in lyr] == [4, 6, 7]
+    assert lyr.GetFeatureCount() == 3
+
+    # Arrow stream with filters
+    lyr2 = ds.CreateLayer("test2")
+    lyr2.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr2.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    lyr2.WriteArrow(lyr)
+    assert [f["int_field"] for f in lyr2] == [4, 6, 7]
+
+    lyr.SetAttributeFilter(None)
+    lyr.SetSpatialFilter(None)
+
+    # Arrow stream without filters, with batches split
+    stream = lyr.GetArrowStream(["MAX_FEATURES_IN_BATCH=2"])
+    lengths = []
+    while True:
+        array = stream.GetNextRecordBatch()
+        if array is None:
+            break
+        lengths.append(array.GetLength())
+    assert lengths == [2, 1, 2, 1, 2, 1, 1]
+
+    lyr.SetIgnoredFields(["str_field"])
+    lyr3 = ds.CreateLayer("test3", options=["COLUMNAR=YES"])
+    lyr3.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    lyr3.WriteArrow(lyr)
+    lyr.SetIgnoredFields([])
+    assert lyr3.GetFeatureCount() == 10
+    assert [f["int_field"] for f in lyr3] == list(range(10))
+
+    # Write through CreateFeature()
+    lyr4 = ds.CreateLayer("test4", options=["COLUMNAR=YES", "FID=my_fid"])
+    lyr4.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    for i in range(3):
+        f = ogr.Feature(lyr4.GetLayerDefn())
+        f["str_field"] = "bar%d" % i
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 1)" % i))
+        lyr4.CreateFeature(f)
+        assert f.GetFID() == i
+    f = ogr.Feature(lyr4.GetLayerDefn())
+    f.SetFID(10)
+    lyr4.CreateFeature(f)
+    f = ogr.Feature(lyr4.GetLayerDefn())
+    lyr4.CreateFeature(f)
+    assert f.GetFID() == 11
+    with pytest.raises(Exception):
+        lyr4.WriteArrow(lyr)
+    assert lyr4.GetFIDColumn() == "my_fid"
+    assert lyr4.GetFeatureCount() == 5
+    assert [f.GetFID() for f in lyr4] == [0, 1, 2, 10, 11]
+    assert lyr4.GetFeature(10) is not None
+    assert lyr4.GetFeature(9) is None
+    assert lyr4.GetFeature(1)["str_field"] == "bar1"
+    assert lyr4.GetExtent() == (0, 2, 1, 1)
@@ -1232,6 +1232,54 @@ def test_ogr_mvt_write_mbtiles():
     gdal.Unlink("/vsimem/out.mbtiles")
 
 
+###############################################################################
+# Test that the in-memory temporary store, the temporary database, and the
+# switch from the former to the latter, lead to the same result
+
+
+@pytest.mark.require_driver("SQLite")
+@pytest.mark.require_geos
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_mvt_write_temporary_memory_limit(num_threads):
+
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    for layer_name in ("layer1", "layer2"):
+        lyr = src_ds.CreateLayer(layer_name)
+        lyr.CreateField(ogr.FieldDefn("field"))
+        for i in range(50):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f.SetField("field", "value%d" % i)
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    "LINESTRING(%d %d,%d %d)"
+                    % (i * 10000, i * 5000, 1000000 - i * 10000, i * 20000)
+                )
+            )
+            lyr.CreateFeature(f)
+
+    def get_tiles(limit):
+        options = ["COMPRESS=NO", "MAXZOOM=3"]
+        if limit is not None:
+            options.append("TEMPORARY_MEMORY_LIMIT=" + limit)
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            gdal.VectorTranslate(
+                "/vsimem/out", src_ds, format="MVT", datasetCreationOptions=options
+            )
+        tiles = {}
+        for filename in gdal.ReadDirRecursive("/vsimem/out"):
+            if filename.endswith(".pbf"):
+                f = gdal.VSIFOpenL("/vsimem/out/" + filename, "rb")
+                tiles[filename] = gdal.VSIFReadL(1, 1000000, f)
+                gdal.VSIFCloseL(f)
+        gdal.RmdirRecursive("/vsimem/out")
+        return tiles
+
+    ref = get_tiles("0")
+    assert len(ref) > 1
+    assert get_tiles(None) == ref
+    assert get_tiles("0.001") == ref
+
+
 ###############################################################################
 
 
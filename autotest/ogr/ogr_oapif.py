@@ -313,6 +313,79 @@ def test_ogr_oapif_fc_links_next_geojson():
         pytest.fail()
 
 
+###############################################################################
+# Test PREFETCH_NEXT_PAGE=YES
+
+
+def test_ogr_oapif_fc_links_next_prefetch():
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "GET",
+        "/oapif/collections",
+        200,
+        {"Content-Type": "application/json"},
+        '{ "collections" : [ { "name": "foo" }] }',
+    )
+    with webserver.install_http_handler(handler):
+        ds = gdal.OpenEx(
+            "OAPIF:http://localhost:%d/oapif" % gdaltest.webserver_port,
+            gdal.OF_VECTOR,
+            open_options=["PREFETCH_NEXT_PAGE=YES"],
+        )
+    lyr = ds.GetLayer(0)
+
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "GET",
+        "/oapif/collections/foo/items?limit=20",
+        200,
+        {"Content-Type": "application/geo+json"},
+        """{ "type": "FeatureCollection", "features": [
+                    {
+                        "type": "Feature",
+                        "properties": {
+                            "foo": "bar"
+                        }
+                    }
+                ] }""",
+    )
+    with webserver.install_http_handler(handler):
+        assert lyr.GetLayerDefn().GetFieldCount() == 1
+
+    handler = webserver.SequentialHandler()
+    for i in range(3):
+        handler.add(
+            "GET",
+            "/oapif/collections/foo/items?limit=1000"
+            if i == 0
+            else "/oapif/foo_next%d" % i,
+            200,
+            {"Content-Type": "application/geo+json"},
+            """{ "type": "FeatureCollection",
+                    "links" : [ %s ],
+                    "features": [
+                    {
+                        "type": "Feature",
+                        "properties": {
+                            "foo": "bar%d"
+                        }
+                    }
+                ] }"""
+            % (
+                (
+                    '{ "rel": "next", "type": "application/geo+json", "href": "http://localhost:%d/oapif/foo_next%d" }'
+                    % (gdaltest.webserver_port, i + 1)
+                )
+                if i < 2
+                else "",
+                i,
+            ),
+        )
+    with webserver.install_http_handler(handler):
+        assert [f["foo"] for f in lyr] == ["bar0", "bar1", "bar2"]
+
+
 ###############################################################################
 
 
@@ -2734,3 +2734,92 @@ def test_ogr_openfilegdb_read_cdf():
         "file using Compressed Data Format (CDF) that is unhandled by the OpenFileGDB driver, but could be handled by the FileGDB driver"
         in msgs[0]
     )
+
+
+###############################################################################
+# Test the specialized and multi-threaded implementation of GetArrowStream()
+
+
+@pytest.mark.parametrize(
+    "attr_filter,spatial_filter,ignored_fields,with_index",
+    [
+        (None, None, None, False),
+        (None, None, ["str", "OGR_GEOMETRY"], False),
+        ("int32 % 3 = 0", None, None, False),
+        ("int32 < 200", None, None, False),
+        ("int32 < 200", None, None, True),
+        (None, (200, -1, 700, 1), None, False),
+        ("int32 % 3 = 0", (200, -1, 700, 1), None, False),
+        ("int32 > 300", (200, -1, 700, 1), None, True),
+    ],
+)
+def test_ogr_openfilegdb_arrow_stream(
+    tmp_vsimem, attr_filter, spatial_filter, ignored_fields, with_index
+):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    dirname = str(tmp_vsimem / "test_ogr_openfilegdb_arrow_stream.gdb")
+    ds = ogr.GetDriverByName("OpenFileGDB").CreateDataSource(dirname)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbLineString)
+    fld_defn = ogr.FieldDefn("int16", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTInt16)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    fld_defn = ogr.FieldDefn("float32", ogr.OFTReal)
+    fld_defn.SetSubType(ogr.OFSTFloat32)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("datetime", ogr.OFTDateTime))
+    lyr.CreateField(ogr.FieldDefn("binary", ogr.OFTBinary))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 7 != 0:
+            f["int16"] = -i
+            f["int32"] = i
+            f["float32"] = i + 0.5
+            f["float64"] = i + 0.125
+            f["str"] = "foo%d" % i
+            f["datetime"] = "2022/12/31 12:34:%02d" % (i % 60)
+            f.SetFieldBinaryFromHexString("binary", "DEAD%04X" % i)
+        if i % 11 != 0:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt("LINESTRING (%d 0,%d 0.5)" % (i, i + 1))
+            )
+        lyr.CreateFeature(f)
+    lyr.DeleteFeature(150)
+    if with_index:
+        ds.ExecuteSQL("CREATE INDEX idx_int32 ON test(int32)")
+    ds = None
+
+    def get_values(num_threads, base_impl):
+        ds = ogr.Open(dirname)
+        lyr = ds.GetLayer(0)
+        assert lyr.TestCapability(ogr.OLCFastGetArrowStream) == 1
+        lyr.SetAttributeFilter(attr_filter)
+        if spatial_filter:
+            lyr.SetSpatialFilterRect(*spatial_filter)
+        if ignored_fields:
+            lyr.SetIgnoredFields(ignored_fields)
+        with gdal.config_options(
+            {
+                "OGR_OPENFILEGDB_NUM_THREADS": num_threads,
+                "OGR_OPENFILEGDB_STREAM_BASE_IMPL": base_impl,
+            }
+        ):
+            stream = lyr.GetArrowStreamAsNumPy(
+                options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=100"]
+            )
+            values = {}
+            for batch in stream:
+                for k in batch:
+                    values.setdefault(k, []).extend(list(batch[k]))
+        return values
+
+    expected = get_values("1", "YES")
+    assert expected["OBJECTID"]
+    assert 151 not in expected["OBJECTID"]
+    assert expected["OBJECTID"] == sorted(expected["OBJECTID"])
+    assert get_values("1", "NO") == expected
+    assert get_values("4", "NO") == expected
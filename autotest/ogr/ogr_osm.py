@@ -886,6 +886,78 @@ def test_ogr_osm_18():
     assert count == 2
 
 
+###############################################################################
+# Test that decoding the blocks in worker threads gives the same result as
+# sequential decoding
+
+
+@pytest.mark.parametrize(
+    "filename", ["data/osm/two_points.pbf", "data/osm/base-64.osm.pbf"]
+)
+def test_ogr_osm_num_threads(filename):
+    def get_features(num_threads):
+        with gdaltest.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.OpenEx(filename, open_options=["INTERLEAVED_READING=YES"])
+            ret = []
+            while True:
+                f, lyr = ds.GetNextFeature()
+                if f is None:
+                    break
+                ret.append((lyr.GetName(), f.DumpReadableAsString()))
+            return ret
+
+    ref = get_features("1")
+    assert ref
+    assert get_features("4") == ref
+
+
+###############################################################################
+# Test DENSE_NODES_INDEX_FILE open option
+
+
+@pytest.mark.parametrize("in_vsimem", [False, True])
+def test_ogr_osm_dense_nodes_index(tmp_path, tmp_vsimem, in_vsimem):
+    def get_features(open_options=[]):
+        ds = gdal.OpenEx("data/osm/test.pbf", open_options=open_options)
+        ret = []
+        while True:
+            f, lyr = ds.GetNextFeature()
+            if f is None:
+                break
+            ret.append((lyr.GetName(), f.DumpReadableAsString()))
+        return ret
+
+    ref = get_features()
+
+    index_filename = str((tmp_vsimem if in_vsimem else tmp_path) / "nodes.idx")
+    open_options = ["DENSE_NODES_INDEX_FILE=" + index_filename]
+    assert get_features(open_options) == ref
+
+    # Check that the index is marked as complete
+    f = gdal.VSIFOpenL(index_filename, "rb")
+    assert f
+    header = gdal.VSIFReadL(1, 40, f)
+    gdal.VSIFCloseL(f)
+    assert header.startswith(b"GDAL_OSM_DENSE_NODES_INDEX_1\0")
+    assert header[36] == 1
+
+    # Reuse it
+    assert get_features(open_options) == ref
+
+
+def test_ogr_osm_dense_nodes_index_not_an_index(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "not_an_index.bin")
+    gdal.FileFromMemBuffer(filename, "foo")
+    with pytest.raises(Exception, match="is not a dense nodes index file"):
+        gdal.OpenEx(
+            "data/osm/test.pbf", open_options=["DENSE_NODES_INDEX_FILE=" + filename]
+        )
+    f = gdal.VSIFOpenL(filename, "rb")
+    assert gdal.VSIFReadL(1, 3, f) == b"foo"
+    gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test TAGS_FORMAT=JSON
 
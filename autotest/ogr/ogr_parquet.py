@@ -1654,6 +1654,86 @@ def test_ogr_parquet_read_partitioned_geo():
     gdal.RmdirRecursive("/vsimem/somedir")
 
 
+###############################################################################
+# Test fragment pruning of a partitioned dataset from filters
+
+
+@pytest.mark.skipif(not _has_arrow_dataset(), reason="GDAL not built with ArrowDataset")
+@pytest.mark.parametrize("select_fragments", ["YES", "NO"])
+def test_ogr_parquet_read_partitioned_hive_filter(select_fragments):
+
+    with gdaltest.config_option(
+        "OGR_PARQUET_DATASET_SELECT_FRAGMENTS", select_fragments
+    ):
+        ds = ogr.Open("data/parquet/partitioned_hive")
+        lyr = ds.GetLayer(0)
+
+        for filter, expected in [
+            ("foo = 'baz'", [4, 5, 6]),
+            ("foo <> 'baz'", [1, 2, 3]),
+            ("one >= 5", [5, 6]),
+            ("foo = 'bar' OR one = 6", [1, 2, 3, 6]),
+            ("foo = 'non_existing'", []),
+        ]:
+            lyr.SetAttributeFilter(filter)
+            for _ in range(2):
+                got = [(f.GetFID(), f["one"]) for f in lyr]
+                assert got == [(x - 1, x) for x in expected], filter
+            assert lyr.GetFeatureCount() == len(expected), filter
+            if expected:
+                f = lyr.GetFeature(expected[0] - 1)
+                assert f["one"] == expected[0]
+
+        lyr.SetAttributeFilter(None)
+        assert lyr.GetFeatureCount() == 6
+        assert [f.GetFID() for f in lyr] == list(range(6))
+
+
+###############################################################################
+# Test spatial filter based fragment pruning of a partitioned dataset
+
+
+@pytest.mark.skipif(not _has_arrow_dataset(), reason="GDAL not built with ArrowDataset")
+@pytest.mark.parametrize("select_fragments", ["YES", "NO"])
+def test_ogr_parquet_read_partitioned_geo_filter(select_fragments):
+
+    gdal.Mkdir("/vsimem/somedir", 0o755)
+    try:
+        for name, wkt in [
+            ("part.0.parquet", "POINT(1 2)"),
+            ("part.1.parquet", "POINT(3 4)"),
+            ("part.2.parquet", "POINT(5 6)"),
+        ]:
+            ds = ogr.GetDriverByName("Parquet").CreateDataSource(
+                "/vsimem/somedir/" + name
+            )
+            lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(wkt))
+            assert lyr.CreateFeature(f) == ogr.OGRERR_NONE
+            ds = None
+
+        with gdaltest.config_option(
+            "OGR_PARQUET_DATASET_SELECT_FRAGMENTS", select_fragments
+        ):
+            ds = ogr.Open("/vsimem/somedir")
+            lyr = ds.GetLayer(0)
+
+            lyr.SetSpatialFilterRect(2.5, 3.5, 3.5, 4.5)
+            got = [(f.GetFID(), f.GetGeometryRef().ExportToWkt()) for f in lyr]
+            assert got == [(1, "POINT (3 4)")]
+
+            lyr.SetSpatialFilterRect(2.5, 3.5, 10, 10)
+            got = [(f.GetFID(), f.GetGeometryRef().ExportToWkt()) for f in lyr]
+            assert got == [(1, "POINT (3 4)"), (2, "POINT (5 6)")]
+
+            lyr.SetSpatialFilter(None)
+            assert [f.GetFID() for f in lyr] == [0, 1, 2]
+            ds = None
+    finally:
+        gdal.RmdirRecursive("/vsimem/somedir")
+
+
 ###############################################################################
 # Test that we don't write an id in members of datum ensemble
 # Cf https://github.com/opengeospatial/geoparquet/discussions/110
@@ -3474,47 +3554,48 @@ def test_ogr_parquet_get_extent_3d(tmp_vsimem):
 
 
 @gdaltest.enable_exceptions()
-@pytest.mark.require_driver("GPKG")
 def test_ogr_parquet_sort_by_bbox(tmp_vsimem):
 
     outfilename = str(tmp_vsimem / "test_ogr_parquet_sort_by_bbox.parquet")
-    ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+    ROW_GROUP_SIZE = 100
+    COUNT_NON_SPATIAL = 501
+    COUNT_SPATIAL = 601
 
+    # Check that the GPKG driver is not needed
     gpkg_drv = gdal.GetDriverByName("GPKG")
-    gpkg_drv.Deregister()
-    ROW_GROUP_SIZE = 100
+    if gpkg_drv:
+        gpkg_drv.Deregister()
     try:
-        with pytest.raises(
-            Exception,
-            match="Driver GPKG required for SORT_BY_BBOX layer creation option",
-        ):
-            ds.CreateLayer(
-                "test",
-                geom_type=ogr.wkbPoint,
-                options=["SORT_BY_BBOX=YES", f"ROW_GROUP_SIZE={ROW_GROUP_SIZE}"],
+        ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+        lyr = ds.CreateLayer(
+            "test",
+            geom_type=ogr.wkbPoint,
+            options=[
+                "SORT_BY_BBOX=YES",
+                f"ROW_GROUP_SIZE={ROW_GROUP_SIZE}",
+                "FID=fid",
+            ],
+        )
+        assert lyr.TestCapability(ogr.OLCFastWriteArrowBatch) == 0
+        lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+        for i in range(COUNT_NON_SPATIAL):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["i"] = i
+            lyr.CreateFeature(f)
+        for i in range(COUNT_SPATIAL):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["i"] = i + COUNT_NON_SPATIAL
+            f.SetGeometryDirectly(
+                ogr.CreateGeometryFromWkt(f"POINT({i} {(i * 37) % COUNT_SPATIAL})")
             )
+            lyr.CreateFeature(f)
+        ds = None
     finally:
-        gpkg_drv.Register()
+        if gpkg_drv:
+            gpkg_drv.Register()
 
-    lyr = ds.CreateLayer(
-        "test",
-        geom_type=ogr.wkbPoint,
-        options=["SORT_BY_BBOX=YES", f"ROW_GROUP_SIZE={ROW_GROUP_SIZE}", "FID=fid"],
-    )
-    assert lyr.TestCapability(ogr.OLCFastWriteArrowBatch) == 0
-    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
-    COUNT_NON_SPATIAL = 501
-    COUNT_SPATIAL = 601
-    for i in range(COUNT_NON_SPATIAL):
-        f = ogr.Feature(lyr.GetLayerDefn())
-        f["i"] = i
-        lyr.CreateFeature(f)
-    for i in range(COUNT_SPATIAL):
-        f = ogr.Feature(lyr.GetLayerDefn())
-        f["i"] = i + COUNT_NON_SPATIAL
-        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
-        lyr.CreateFeature(f)
-    ds = None
+    # Temporary file must have been removed
+    assert gdal.VSIStatL(outfilename + ".tmp_sort_by_bbox.bin") is None
 
     with gdaltest.config_option("OGR_PARQUET_SHOW_ROW_GROUP_EXTENT", "YES"):
         ds = ogr.Open(outfilename)
@@ -3547,7 +3628,7 @@ def test_ogr_parquet_sort_by_bbox(tmp_vsimem):
             if not f:
                 break
             assert f["i"] >= COUNT_NON_SPATIAL
-            if f["i"] != i + COUNT_NON_SPATIAL:
+            if f["i"] != count + COUNT_NON_SPATIAL:
                 foundNonSequential = True
             assert f["i"] not in set_i
             set_i.add(f["i"])
@@ -3872,3 +3953,140 @@ def test_ogr_parquet_read_arrow_json_extension():
     assert lyr.GetLayerDefn().GetFieldDefn(0).GetSubType() == ogr.OFSTJSON
     f = lyr.GetNextFeature()
     assert f["extension_json"] == '{"foo":"bar"}'
+
+
+###############################################################################
+# Test that row groups whose statistics overlap the spatial filter, but
+# without any intersecting feature, are discarded by reading the bounding box
+# column first
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_parquet_spatial_filter_prefilter_bbox_rows(tmp_vsimem):
+
+    outfilename = str(tmp_vsimem / "test.parquet")
+    ds = ogr.GetDriverByName("Parquet").CreateDataSource(outfilename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint, options=["ROW_GROUP_SIZE=10"])
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    # Points alternatively along the X and Y axis, so that the extent of each
+    # row group is a square, but no point is in the middle of it.
+    for i in range(100):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["i"] = i
+        if (i % 2) == 0:
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} 0)"))
+        else:
+            f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT(0 {i})"))
+        lyr.CreateFeature(f)
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["i"] = 100
+    f.SetGeometryDirectly(ogr.CreateGeometryFromWkt("POINT(50 50)"))
+    lyr.CreateFeature(f)
+    ds = None
+
+    got_msg = []
+
+    def my_handler(errorClass, errno, msg):
+        if errorClass == gdal.CE_Debug:
+            got_msg.append(msg)
+        return
+
+    def get_values(options={}):
+        with gdaltest.config_options(options):
+            ds = ogr.Open(outfilename)
+            lyr = ds.GetLayer(0)
+            lyr.SetSpatialFilterRect(5, 5, 95, 95)
+            del got_msg[:]
+            with gdaltest.config_option("CPL_DEBUG", "ON"), gdaltest.error_handler(
+                my_handler
+            ):
+                values = [f["i"] for f in lyr]
+            lyr.ResetReading()
+            stream = lyr.GetArrowStream()
+            count_arrow = 0
+            while True:
+                array = stream.GetNextRecordBatch()
+                if array is None:
+                    break
+                count_arrow += array.GetLength()
+            assert count_arrow == len(values)
+            return values
+
+    assert get_values() == [100]
+    assert "10 row groups discarded using bounding box column content" in got_msg
+
+    assert get_values({"OGR_PARQUET_PREFILTER_BBOX_ROWS": "NO"}) == [100]
+    assert not any(
+        "discarded using bounding box column content" in msg for msg in got_msg
+    )
+
+    assert get_values({"OGR_PARQUET_USE_BBOX": "NO"}) == [100]
+
+
+###############################################################################
+# Test that writing with several threads (parallel column encoding, with
+# libarrow >= 13) gives the same result as writing with a single thread
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("sort_by_bbox", [False, True])
+def test_ogr_parquet_write_num_threads(tmp_vsimem, sort_by_bbox):
+
+    ROW_GROUP_SIZE = 100
+    COUNT = 1050
+
+    def write(filename, num_threads):
+        with gdaltest.config_option("GDAL_NUM_THREADS", str(num_threads)):
+            ds = ogr.GetDriverByName("Parquet").CreateDataSource(filename)
+            options = [f"ROW_GROUP_SIZE={ROW_GROUP_SIZE}", "FID=fid"]
+            if sort_by_bbox:
+                options.append("SORT_BY_BBOX=YES")
+            lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint, options=options)
+            lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+            lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+            lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+            lyr.CreateField(ogr.FieldDefn("intlist", ogr.OFTIntegerList))
+            lyr.CreateField(ogr.FieldDefn("dt", ogr.OFTDateTime))
+            for i in range(COUNT):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                if i % 7 != 0:
+                    f["int"] = i
+                f["real"] = i * 0.5
+                f["str"] = "value%d" % (i % 13)
+                f["intlist"] = [i, i + 1]
+                f["dt"] = "2024/01/02 03:04:%02d" % (i % 60)
+                if i % 11 != 0:
+                    f.SetGeometryDirectly(
+                        ogr.CreateGeometryFromWkt(
+                            "POINT (%d %d)" % ((i * 37) % 100, (i * 17) % 100)
+                        )
+                    )
+                lyr.CreateFeature(f)
+            ds = None
+
+    filename_single = str(tmp_vsimem / "single.parquet")
+    filename_multi = str(tmp_vsimem / "multi.parquet")
+    write(filename_single, 1)
+    write(filename_multi, 4)
+
+    ds_single = ogr.Open(filename_single)
+    lyr_single = ds_single.GetLayer(0)
+    ds_multi = ogr.Open(filename_multi)
+    lyr_multi = ds_multi.GetLayer(0)
+
+    num_row_groups = lyr_single.GetMetadataItem("NUM_ROW_GROUPS", "_PARQUET_")
+    assert num_row_groups == str((COUNT + ROW_GROUP_SIZE - 1) // ROW_GROUP_SIZE)
+    assert lyr_multi.GetMetadataItem("NUM_ROW_GROUPS", "_PARQUET_") == num_row_groups
+    for i in range(int(num_row_groups)):
+        item = "ROW_GROUPS[%d].NUM_ROWS" % i
+        num_rows = lyr_single.GetMetadataItem(item, "_PARQUET_")
+        assert lyr_multi.GetMetadataItem(item, "_PARQUET_") == num_rows
+
+    assert lyr_multi.GetLayerDefn().IsSame(lyr_single.GetLayerDefn())
+    assert lyr_multi.GetFeatureCount() == COUNT
+    assert lyr_single.GetFeatureCount() == COUNT
+    for f_single, f_multi in zip(lyr_single, lyr_multi):
+        assert f_multi.Equal(f_single), (
+            f_single.DumpReadableAsString(),
+            f_multi.DumpReadableAsString(),
+        )
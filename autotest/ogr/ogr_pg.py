@@ -647,6 +647,76 @@ def test_ogr_pg_3(pg_ds, poly_feat):
             )
 
 
+###############################################################################
+# Test reading features with a binary cursor (BINARY_CURSOR open option)
+
+
+@pytest.mark.usefixtures("tpoly")
+def test_ogr_pg_binary_cursor(pg_ds, poly_feat):
+
+    ds = reconnect(pg_ds, update=False, open_options={"BINARY_CURSOR": "YES"})
+    pg_lyr = ds.GetLayerByName("tpoly")
+
+    assert pg_lyr.GetFeatureCount() == 10
+
+    for i in range(len(poly_feat)):
+        orig_feat = poly_feat[i]
+        orig_geom = orig_feat.GetGeometryRef().Clone()
+        orig_geom = ogr.ForceTo(orig_geom, ogr.wkbPolygon25D)
+        read_feat = pg_lyr.GetNextFeature()
+
+        ogrtest.check_feature_geometry(read_feat, orig_geom, max_error=0.001)
+
+        for fld in range(3):
+            assert orig_feat.GetField(fld) == read_feat.GetField(fld), (
+                "Attribute %d does not match" % fld
+            )
+
+    with ogrtest.attribute_filter(pg_lyr, "eas_id < 170"):
+        ogrtest.check_features_against_list(
+            pg_lyr, "eas_id", [168, 169, 166, 158, 165]
+        )
+
+
+###############################################################################
+# Test reading features through several connections
+# (PARALLEL_READ_CONNECTIONS open option)
+
+
+@pytest.mark.usefixtures("tpoly")
+def test_ogr_pg_parallel_read(pg_ds, poly_feat):
+
+    ds = reconnect(
+        pg_ds, update=False, open_options={"PARALLEL_READ_CONNECTIONS": "3"}
+    )
+    pg_lyr = ds.GetLayerByName("tpoly")
+
+    assert pg_lyr.TestCapability(ogr.OLCFastSetNextByIndex) == 0
+
+    expected = sorted(
+        (f.GetField(0), f.GetField(1), f.GetField(2)) for f in poly_feat
+    )
+
+    for _ in range(2):
+        got = []
+        fids = set()
+        for f in pg_lyr:
+            got.append((f.GetField(0), f.GetField(1), f.GetField(2)))
+            fids.add(f.GetFID())
+        assert sorted(got) == expected
+        assert len(fids) == len(expected)
+        pg_lyr.ResetReading()
+
+    with ogrtest.attribute_filter(pg_lyr, "eas_id < 170 OR eas_id > 1000000"):
+        assert sorted(f["eas_id"] for f in pg_lyr) == [158, 165, 166, 168, 169]
+
+    # Interrupted read
+    pg_lyr.ResetReading()
+    assert pg_lyr.GetNextFeature() is not None
+    pg_lyr.ResetReading()
+    assert len([f for f in pg_lyr]) == len(expected)
+
+
 ###############################################################################
 # Write more features with a bunch of different geometries, and verify the
 # geometries are still OK.
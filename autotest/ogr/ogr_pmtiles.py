@@ -548,6 +548,79 @@ def test_ogr_pmtiles_write_from_mbtiles_deduplication():
             gdal.Unlink(pmtiles_filename)
 
 
+###############################################################################
+# Test that tiles generated by the PMTiles writer are deduplicated and
+# directly written in a clustered archive
+
+
+@pytest.mark.require_driver("MBTiles")
+# MBTiles vector writing mode requires SQLite and GEOS
+@pytest.mark.require_driver("SQLite")
+@pytest.mark.require_geos
+def test_ogr_pmtiles_write_deduplication(tmp_vsimem):
+
+    wkt = "POLYGON((-20000000 -20000000,-20000000 20000000,20000000 20000000,20000000 -20000000,-20000000 -20000000))"
+
+    mbtiles_filename = str(tmp_vsimem / "test.mbtiles")
+    ds = ogr.GetDriverByName("MBTiles").CreateDataSource(
+        mbtiles_filename, options=["MINZOOM=2", "MAXZOOM=2"]
+    )
+    lyr = ds.CreateLayer("test")
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+    lyr.CreateFeature(f)
+    ds = None
+
+    pmtiles_filename = str(tmp_vsimem / "test.pmtiles")
+    ds = ogr.GetDriverByName("PMTiles").CreateDataSource(
+        pmtiles_filename, options=["MINZOOM=2", "MAXZOOM=2"]
+    )
+    lyr = ds.CreateLayer("test")
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+    lyr.CreateFeature(f)
+    ds = None
+
+    f = gdal.VSIFOpenL(f"/vsipmtiles/{pmtiles_filename}/pmtiles_header.json", "rb")
+    assert f
+    try:
+        data = gdal.VSIFReadL(1, 10000, f)
+    finally:
+        gdal.VSIFCloseL(f)
+    got = json.loads(data)
+
+    expected = {
+        "addressed_tiles_count": 16,
+        "tile_contents_count": 9,
+        "tile_entries_count": 13,
+        "clustered": True,
+        "root_dir_offset": 127,
+        "tile_data_offset": 16384,
+    }
+
+    for key in expected:
+        assert got[key] == expected[key], (key, got)
+
+    src_ds_sqlite3 = gdal.OpenEx(mbtiles_filename, allowed_drivers=["SQLite"])
+    with src_ds_sqlite3.ExecuteSQL(
+        "SELECT zoom_level, tile_column, tile_row, tile_data FROM tiles"
+    ) as lyr:
+        assert lyr.GetFeatureCount() == 16
+        for f in lyr:
+            z = f["zoom_level"]
+            x = f["tile_column"]
+            # MBTiles y=0 origin is bottom-most tile, whereas PMTiles is top-most
+            y = (1 << z) - 1 - f["tile_row"]
+            tile_data = f.GetFieldAsBinary("tile_data")
+            assert gdal.VSIStatL(
+                f"/vsipmtiles/{pmtiles_filename}/{z}/{x}/{y}.mvt"
+            ).size == len(tile_data)
+    src_ds_sqlite3 = None
+
+    ds = ogr.Open(pmtiles_filename)
+    assert ds.GetLayer(0).GetFeatureCount() > 0
+
+
 ###############################################################################
 
 
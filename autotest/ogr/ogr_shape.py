@@ -5903,6 +5903,116 @@ def test_ogr_shape_arrow_stream():
     ]
 
 
+###############################################################################
+# Test multi-threaded GetArrowStream()
+
+
+@pytest.mark.parametrize(
+    "attr_filter,spatial_filter,with_qix",
+    [
+        (None, None, False),
+        ("id % 3 = 0", None, False),
+        (None, (200, 0, 700, 1), False),
+        (None, (200, 0, 700, 1), True),
+        ("id % 3 = 0", (200, 0, 700, 1), True),
+    ],
+)
+def test_ogr_shape_arrow_stream_multithreaded(
+    tmp_vsimem, attr_filter, spatial_filter, with_qix
+):
+    pytest.importorskip("osgeo.gdal_array")
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test_ogr_shape_arrow_stream_multithreaded.shp")
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint, options=["AUTO_REPACK=NO"])
+    lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["id"] = i
+        f["str"] = "foo%d" % i
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 0)" % i))
+        lyr.CreateFeature(f)
+    lyr.DeleteFeature(150)
+    if with_qix:
+        ds.ExecuteSQL(
+            "CREATE SPATIAL INDEX ON test_ogr_shape_arrow_stream_multithreaded"
+        )
+    ds = None
+
+    def get_values(num_threads):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        lyr.SetAttributeFilter(attr_filter)
+        if spatial_filter:
+            lyr.SetSpatialFilterRect(*spatial_filter)
+        with gdal.config_option("OGR_SHAPE_NUM_THREADS", num_threads):
+            stream = lyr.GetArrowStreamAsNumPy(
+                options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=100"]
+            )
+            fids = []
+            ids = []
+            strs = []
+            for batch in stream:
+                fids += list(batch["OGC_FID"])
+                ids += list(batch["id"])
+                strs += [x.decode("utf-8") for x in batch["str"]]
+        return fids, ids, strs
+
+    expected = get_values("1")
+    assert expected[0]
+    assert 150 not in expected[0]
+    assert expected[0] == sorted(expected[0])
+    assert get_values("4") == expected
+
+
+###############################################################################
+# Test OGR_SHAPE_IN_MEMORY_SPATIAL_INDEX
+
+
+@pytest.mark.parametrize("in_memory_index", ["YES", "NO", "100", "10000"])
+def test_ogr_shape_in_memory_spatial_index(tmp_vsimem, in_memory_index):
+
+    filename = str(tmp_vsimem / "test_ogr_shape_in_memory_spatial_index.shp")
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbLineString)
+    for i in range(1000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt(
+                "LINESTRING (%d %d,%d %d)" % (i % 37, i % 41, i % 37 + 1, i % 41 + 1)
+            )
+        )
+        lyr.CreateFeature(f)
+    ds = None
+
+    def get_fids():
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilterRect(10.5, 10.5, 12.5, 12.5)
+        fids = [f.GetFID() for f in lyr]
+        lyr.ResetReading()
+        assert lyr.GetFeatureCount() == len(fids)
+        lyr.SetSpatialFilterRect(100, 100, 101, 101)
+        assert lyr.GetFeatureCount() == 0
+        return fids
+
+    expected = get_fids()
+    assert expected
+
+    with gdal.config_option("OGR_SHAPE_IN_MEMORY_SPATIAL_INDEX", in_memory_index):
+        assert get_fids() == expected
+
+    # Check that CREATE SPATIAL INDEX, which uses the same builder, gives
+    # the same result
+    ds = ogr.Open(filename, update=1)
+    ds.ExecuteSQL("CREATE SPATIAL INDEX ON test_ogr_shape_in_memory_spatial_index")
+    ds = None
+    assert gdal.VSIStatL(filename[0:-4] + ".qix") is not None
+    assert get_fids() == expected
+
+
 ###############################################################################
 # Test GetArrowStream()
 
@@ -6121,3 +6231,57 @@ def test_ogr_shape_logical_field(tmp_vsimem):
     assert f["int_field"] == -1234
     f = lyr.GetNextFeature()
     assert f["bool_field"] is None
+
+
+###############################################################################
+# Test reading numeric fields, with and without ignored fields
+
+
+@pytest.mark.parametrize("ignored_fields", [[], ["str", "int"]])
+def test_ogr_shape_read_numeric_fields(tmp_vsimem, ignored_fields):
+
+    filename = str(tmp_vsimem / "test_ogr_shape_read_numeric_fields.dbf")
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test_ogr_shape_read_numeric_fields", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    fld_defn = ogr.FieldDefn("int", ogr.OFTInteger)
+    fld_defn.SetWidth(11)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    fld_defn = ogr.FieldDefn("real", ogr.OFTReal)
+    fld_defn.SetWidth(24)
+    fld_defn.SetPrecision(15)
+    lyr.CreateField(fld_defn)
+    values = [
+        ("foo", 123, -1234567890123456, 1.5),
+        ("bar", -2147483648, 123456789012345678, -0.125),
+        (None, None, None, None),
+        ("baz", 0, 0, 1.25e-5),
+    ]
+    for str_val, int_val, int64_val, real_val in values:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str"] = str_val
+        f["int"] = int_val
+        f["int64"] = int64_val
+        f["real"] = real_val
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    lyr.SetIgnoredFields(ignored_fields)
+    for str_val, int_val, int64_val, real_val in values:
+        f = lyr.GetNextFeature()
+        if "str" in ignored_fields:
+            assert not f.IsFieldSet("str")
+        else:
+            assert f["str"] == str_val
+        if "int" in ignored_fields:
+            assert not f.IsFieldSet("int")
+        else:
+            assert f["int"] == int_val
+        assert f["int64"] == int64_val
+        if real_val is None:
+            assert f["real"] is None
+        else:
+            assert f["real"] == pytest.approx(real_val, rel=1e-14)
@@ -2510,3 +2510,71 @@ def test_ogr_sql_sqlite_execute_sql_error_on_spatial_filter_shp_layer(tmp_vsimem
         Exception, match="Cannot set spatial filter: no geometry field selected"
     ):
         ds.ExecuteSQL("SELECT 1 FROM test", spatialFilter=geom, dialect="SQLITE")
+
+
+###############################################################################
+# Test that reading through the Arrow interface of the source layer gives the
+# same results as reading through GetNextFeature()
+
+
+@pytest.mark.require_driver("GPKG")
+@pytest.mark.parametrize(
+    "sql",
+    [
+        "SELECT * FROM test",
+        "SELECT * FROM test WHERE int_field = 2",
+        "SELECT * FROM test WHERE real_field > 1.5 ORDER BY int64_field",
+        "SELECT COUNT(*) FROM test",
+        "SELECT rowid, str_field FROM test LIMIT 1 OFFSET 2",
+    ],
+)
+def test_ogr_sql_sqlite_virtual_ogr_arrow(tmp_vsimem, sql):
+
+    filename = str(tmp_vsimem / "test.gpkg")
+    ds = ogr.GetDriverByName("GPKG").CreateDataSource(filename)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    lyr = ds.CreateLayer("test", srs=srs)
+    lyr.CreateField(ogr.FieldDefn("int_field", ogr.OFTInteger))
+    fld_defn = ogr.FieldDefn("bool_field", ogr.OFTInteger)
+    fld_defn.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(fld_defn)
+    lyr.CreateField(ogr.FieldDefn("int64_field", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("real_field", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_field", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("date_field", ogr.OFTDate))
+    lyr.CreateField(ogr.FieldDefn("binary_field", ogr.OFTBinary))
+    for i in range(5):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i != 3:
+            f["int_field"] = i
+            f["bool_field"] = i % 2
+            f["int64_field"] = 1234567890123 * (5 - i)
+            f["real_field"] = i + 0.5
+            f["str_field"] = "foo%d" % i
+            f["date_field"] = "2022/05/%02d" % (i + 1)
+            f.SetFieldBinaryFromHexString("binary_field", "0102%02X" % i)
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 2)" % i))
+        lyr.CreateFeature(f)
+    ds = None
+
+    def get_result():
+        ds = ogr.Open(filename)
+        sql_lyr = ds.ExecuteSQL(sql, dialect="INDIRECT_SQLITE")
+        ret = []
+        for f in sql_lyr:
+            geom = f.GetGeometryRef()
+            ret.append(
+                (
+                    f.GetFID(),
+                    [f.GetField(i) for i in range(f.GetFieldCount())],
+                    geom.ExportToIsoWkt() if geom else None,
+                )
+            )
+        ds.ReleaseResultSet(sql_lyr)
+        return ret
+
+    with gdaltest.config_option("OGR_SQLITE_VIRTUAL_OGR_USE_ARROW", "NO"):
+        expected = get_result()
+    assert len(expected) > 0
+    assert get_result() == expected
@@ -1416,6 +1416,122 @@ def test_ogr_sql_48():
             assert sql_lyr.GetFeature(i)["int_field"] == lyr.GetFeature(i)["int_field"]
 
 
+###############################################################################
+# Test ORDER BY on a layer without efficient random read, with the source
+# features kept in memory or spilled to a temporary file
+
+
+@pytest.mark.require_driver("CSV")
+@pytest.mark.parametrize("max_memory", [None, "0", "1000"])
+def test_ogr_sql_order_by_sorted_rows(tmp_vsimem, max_memory):
+
+    filename = str(tmp_vsimem / "test.csv")
+    with gdal.VSIFile(filename, "wb") as f:
+        f.write(b"id,val,str\n")
+        for i in range(1000):
+            f.write(b"%d,%d,s%d\n" % (i, (i * 7) % 100, i % 10))
+
+    ds = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=["AUTODETECT_TYPE=YES"])
+    with gdaltest.config_option("OGR_SQL_ORDER_BY_MAX_MEMORY", max_memory):
+        with ds.ExecuteSQL(
+            "SELECT * FROM test ORDER BY val DESC, str OFFSET 3"
+        ) as sql_lyr:
+            got = [(f["val"], f["str"], f["id"]) for f in sql_lyr]
+            assert sql_lyr.TestCapability(ogr.OLCFastSetNextByIndex)
+            sql_lyr.SetNextByIndex(500)
+            f = sql_lyr.GetNextFeature()
+            got_500 = (f["val"], f["str"], f["id"])
+            sql_lyr.ResetReading()
+            f = sql_lyr.GetNextFeature()
+            got_first = (f["val"], f["str"], f["id"])
+
+    # Ties on the sort keys are returned in reading order
+    expected = sorted(
+        [((i * 7) % 100, "s%d" % (i % 10), i) for i in range(1000)],
+        key=lambda x: (-x[0], x[1]),
+    )[3:]
+    assert got == expected
+    assert got_500 == expected[500]
+    assert got_first == expected[0]
+
+
+###############################################################################
+# Test GROUP BY
+
+
+@pytest.mark.require_driver("CSV")
+def test_ogr_sql_group_by(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.csv")
+    with gdal.VSIFile(filename, "wb") as f:
+        f.write(b"id,cat,val,str\n")
+        for i in range(100):
+            cat = b"" if i % 10 == 9 else b"%d" % (i % 3)
+            f.write(b"%d,%s,%d,s%d\n" % (i, cat, i, i % 4))
+
+    ds = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=["AUTODETECT_TYPE=YES"])
+
+    with ds.ExecuteSQL(
+        "SELECT cat, COUNT(*), SUM(val), MIN(str), COUNT(DISTINCT str) "
+        "FROM test WHERE id < 90 GROUP BY cat"
+    ) as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 4
+        got = [
+            (f["cat"], f["COUNT_*"], f["SUM_val"], f["MIN_str"], f["COUNT_str"])
+            for f in sql_lyr
+        ]
+    rows = [(i, None if i % 10 == 9 else i % 3) for i in range(90)]
+    expected = []
+    for cat in (0, 1, 2, None):
+        ids = [i for i, c in rows if c == cat]
+        expected.append(
+            (
+                cat,
+                len(ids),
+                sum(ids),
+                min("s%d" % (i % 4) for i in ids),
+                len(set(i % 4 for i in ids)),
+            )
+        )
+    assert got == expected
+
+    with ds.ExecuteSQL(
+        "SELECT str, cat, MAX(val) AS m FROM test GROUP BY cat, str "
+        "ORDER BY cat DESC, str LIMIT 3 OFFSET 1"
+    ) as sql_lyr:
+        got = [(f["cat"], f["str"], f["m"]) for f in sql_lyr]
+        assert sql_lyr.TestCapability(ogr.OLCFastSetNextByIndex)
+        sql_lyr.SetNextByIndex(1)
+        f = sql_lyr.GetNextFeature()
+        assert (f["cat"], f["str"]) == got[1][0:2]
+
+    def max_val(cat, str_idx):
+        return max(
+            i
+            for i in range(100)
+            if i % 10 != 9 and i % 3 == cat and i % 4 == str_idx
+        )
+
+    assert got == [
+        (2, "s1", max_val(2, 1)),
+        (2, "s2", max_val(2, 2)),
+        (2, "s3", max_val(2, 3)),
+    ]
+
+    with gdal.quiet_errors():
+        assert ds.ExecuteSQL("SELECT cat, val FROM test GROUP BY cat") is None
+        assert (
+            ds.ExecuteSQL("SELECT cat, COUNT(*) FROM test GROUP BY cat ORDER BY val")
+            is None
+        )
+        assert ds.ExecuteSQL("SELECT DISTINCT cat FROM test GROUP BY cat") is None
+
+    with gdaltest.config_option("OGR_SQL_GROUP_BY_MAX_MEMORY", "1000"):
+        with ds.ExecuteSQL("SELECT id, COUNT(*) FROM test GROUP BY id") as sql_lyr:
+            with pytest.raises(Exception, match="OGR_SQL_GROUP_BY_MAX_MEMORY"):
+                sql_lyr.GetNextFeature()
+
+
 ###############################################################################
 # Test arithmetic expressions
 
@@ -1998,3 +2114,85 @@ def test_ogr_sql_on_null(where, feature_count, dialect, ds_for_test_ogr_sql_on_n
             "select * from layer where " + where, dialect=dialect
         ) as sql_lyr:
             assert sql_lyr.GetFeatureCount() == feature_count
+
+
+###############################################################################
+# Test attribute filters evaluated through the compiled representation of
+# OGRFeatureQuery, and ones that fall back to the expression tree evaluation
+
+
+@pytest.mark.parametrize(
+    "where,expected_fids",
+    [
+        ("intfield = 2", [2]),
+        ("2 = intfield", [2]),
+        ("2 < intfield", [3]),
+        ("intfield BETWEEN 1 AND 2", [1, 2]),
+        ("intfield BETWEEN 1 AND 2 AND intfield + 0 BETWEEN 1 AND 2", [1, 2]),
+        ("intfield IN (1, 3)", [1, 3]),
+        ("intfield IN (" + ",".join(str(i) for i in range(3, 100)) + ")", [3]),
+        ("intfield > 1.5", [2, 3]),
+        ("intfield NOT IN (1, NULL)", []),
+        ("int64field = 1234567890123", [1]),
+        ("int64field > 1234567890123", [2, 3]),
+        ("realfield = 1.5", [1]),
+        ("realfield < 3", [1, 2]),
+        ("realfield IN (1.5, 3.5)", [1, 3]),
+        ("realfield BETWEEN 2 AND 4", [2, 3]),
+        ("strfield = 'FOO'", [1]),
+        ("strfield <> 'foo'", [2, 3]),
+        ("strfield > 'bar'", [1, 3]),
+        ("strfield IN ('bar', 'baz')", [2, 3]),
+        ("strfield LIKE 'ba%'", [2, 3]),
+        ("strfield LIKE 'BA%'", []),
+        ("strfield ILIKE 'BA_'", [2, 3]),
+        ("strfield LIKE 'b!_%' ESCAPE '!'", []),
+        ("strfield LIKE 'f!o%' ESCAPE '!'", [1]),
+        ("strfield IS NULL", [4]),
+        ("strfield IS NOT NULL", [1, 2, 3]),
+        ("NOT (intfield = 1 OR strfield = 'bar')", [3]),
+        ("NOT (intfield = 1 OR strfield = 'bar') OR intfield IS NULL", [3, 4]),
+        ("intfield >= 2 AND (realfield < 3 OR strfield = 'baz')", [2, 3]),
+        (
+            "(intfield = 1 AND realfield = 1.5) OR (intfield = 3 AND strfield = 'baz')",
+            [1, 3],
+        ),
+        ("FID = 2", [2]),
+        ("FID IN (1, 4)", [1, 4]),
+        ("intfield = int64field", []),
+        ("CAST(intfield AS CHARACTER(10)) = '1'", [1]),
+    ],
+)
+def test_ogr_sql_attribute_filter_compiled(where, expected_fids):
+
+    ds = ogr.GetDriverByName("Memory").CreateDataSource("")
+    lyr = ds.CreateLayer("layer")
+    lyr.CreateField(ogr.FieldDefn("intfield", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64field", ogr.OFTInteger64))
+    lyr.CreateField(ogr.FieldDefn("realfield", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("strfield", ogr.OFTString))
+    for fid, intval, int64val, realval, strval in [
+        (1, 1, 1234567890123, 1.5, "foo"),
+        (2, 2, 1234567890124, 2.5, "bar"),
+        (3, 3, 1234567890125, 3.5, "baz"),
+        (4, None, None, None, None),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f.SetFID(fid)
+        if intval is None:
+            f.SetFieldNull("intfield")
+            f.SetFieldNull("int64field")
+            f.SetFieldNull("realfield")
+            f.SetFieldNull("strfield")
+        else:
+            f["intfield"] = intval
+            f["int64field"] = int64val
+            f["realfield"] = realval
+            f["strfield"] = strval
+        lyr.CreateFeature(f)
+
+    lyr.SetAttributeFilter(where)
+    assert [f.GetFID() for f in lyr] == expected_fids
+
+    with ds.ExecuteSQL("SELECT * FROM layer WHERE " + where) as sql_lyr:
+        assert [f.GetFID() for f in sql_lyr] == expected_fids
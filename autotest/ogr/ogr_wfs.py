@@ -4073,6 +4073,94 @@ def test_ogr_wfs_vsimem_wfs200_with_no_primary_key(with_and_without_streaming):
             assert f is None
 
 
+###############################################################################
+# Test OGR_WFS_PAGING_PREFETCH
+
+
+@pytest.mark.parametrize("prefetch", ["1", "3"])
+def test_ogr_wfs_vsimem_wfs200_paging_prefetch(prefetch):
+
+    endpoint = "/vsimem/wfs200_endpoint_paging_prefetch"
+    with gdaltest.tempfile(
+        endpoint + "?SERVICE=WFS&REQUEST=GetCapabilities",
+        """<WFS_Capabilities version="2.0.0">
+    <OperationsMetadata>
+        <ows:Operation name="GetFeature">
+            <ows:Constraint name="CountDefault">
+                <ows:NoValues/>
+                <ows:DefaultValue>2</ows:DefaultValue>
+            </ows:Constraint>
+        </ows:Operation>
+        <ows:Constraint name="ImplementsResultPaging">
+            <ows:NoValues/><ows:DefaultValue>TRUE</ows:DefaultValue>
+        </ows:Constraint>
+    </OperationsMetadata>
+    <FeatureTypeList>
+        <FeatureType>
+            <Name>my_layer</Name>
+            <DefaultSRS>urn:ogc:def:crs:EPSG::4326</DefaultSRS>
+        </FeatureType>
+    </FeatureTypeList>
+</WFS_Capabilities>
+""",
+    ):
+        ds = ogr.Open("WFS:" + endpoint)
+    lyr = ds.GetLayer(0)
+
+    gdal.FileFromMemBuffer(
+        endpoint
+        + "?SERVICE=WFS&VERSION=2.0.0&REQUEST=DescribeFeatureType&TYPENAME=my_layer",
+        """<xsd:schema xmlns:foo="http://foo" xmlns:gml="http://www.opengis.net/gml" xmlns:xsd="http://www.w3.org/2001/XMLSchema" elementFormDefault="qualified" targetNamespace="http://foo">
+  <xsd:import namespace="http://www.opengis.net/gml" schemaLocation="http://foo/schemas/gml/3.2.1/base/gml.xsd"/>
+  <xsd:complexType name="my_layerType">
+    <xsd:complexContent>
+      <xsd:extension base="gml:AbstractFeatureType">
+        <xsd:sequence>
+          <xsd:element maxOccurs="1" minOccurs="0" name="int" nillable="true" type="xsd:int"/>
+        </xsd:sequence>
+      </xsd:extension>
+    </xsd:complexContent>
+  </xsd:complexType>
+  <xsd:element name="my_layer" substitutionGroup="gml:_Feature" type="foo:my_layerType"/>
+</xsd:schema>
+""",
+    )
+
+    # 3 full pages of 2 features, and a last empty one
+    for start_index in range(0, 8, 2):
+        members = ""
+        for i in range(start_index, min(start_index + 2, 6)):
+            members += f"""<gml:featureMembers>
+        <foo:my_layer gml:id="my_layer.{i + 1}"><foo:int>{i + 1}</foo:int></foo:my_layer>
+    </gml:featureMembers>
+"""
+        gdal.FileFromMemBuffer(
+            endpoint
+            + f"?SERVICE=WFS&VERSION=2.0.0&REQUEST=GetFeature&TYPENAMES=my_layer&STARTINDEX={start_index}&COUNT=2",
+            f"""<wfs:FeatureCollection xmlns:foo="http://foo"
+xmlns:wfs="http://www.opengis.net/wfs"
+xmlns:gml="http://www.opengis.net/gml"
+numberMatched="unknown" numberReturned="2">
+    {members}
+</wfs:FeatureCollection>
+""",
+        )
+
+    try:
+        with gdaltest.config_option("OGR_WFS_PAGING_PREFETCH", prefetch):
+            assert [f["int"] for f in lyr] == [1, 2, 3, 4, 5, 6]
+            lyr.ResetReading()
+            f = lyr.GetNextFeature()
+            assert f["int"] == 1
+            lyr.ResetReading()
+            assert [f["int"] for f in lyr] == [1, 2, 3, 4, 5, 6]
+    finally:
+        ds = None
+        for f in gdal.ReadDir("/vsimem/") or []:
+            if f.startswith("wfs200_endpoint_paging_prefetch"):
+                gdal.Unlink("/vsimem/" + f)
+
+
 ###############################################################################
 def test_ogr_wfs_vsimem_wfs200_json(with_and_without_streaming):
     with gdaltest.tempfile(
@@ -310,6 +310,91 @@ def test_osr_ct_8():
                 pytest.fail("Failed to transform from Pseudo Mercator to LL")
 
 
+###############################################################################
+# Test WGS84 -> WebMercator optimized transform
+
+
+@pytest.mark.parametrize("traditional_gis_order", [True, False])
+def test_osr_ct_wgs84_to_webmercator(traditional_gis_order):
+
+    src_srs = osr.SpatialReference()
+    src_srs.ImportFromEPSG(4326)
+    if traditional_gis_order:
+        src_srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+
+    dst_srs = osr.SpatialReference()
+    dst_srs.ImportFromEPSG(3857)
+
+    def swap(pnts):
+        return pnts if traditional_gis_order else [(p[1], p[0]) for p in pnts]
+
+    ct = osr.CoordinateTransformation(src_srs, dst_srs)
+    result = ct.TransformPoints(
+        swap([(0, 49), (8.9831528411952125e-06, 49), (-170, -49), (190, -49)])
+    )
+    expected_result = [
+        (0.0, 6274861.39400658),
+        (1.0, 6274861.39400658),
+        (-18924313.434856508, -6274861.39400658),
+        (-18924313.434856508, -6274861.39400658),
+    ]
+    for i in range(len(expected_result)):
+        assert result[i][0] == pytest.approx(expected_result[i][0], abs=1e-6)
+        assert result[i][1] == pytest.approx(expected_result[i][1], abs=1e-6)
+
+    # The inverse transformation uses the WebMercator -> WGS84 optimization
+    inv_result = ct.GetInverse().TransformPoints(
+        [(x[0], x[1]) for x in expected_result[0:3]]
+    )
+    expected_inv_result = swap([(0, 49), (8.9831528411952125e-06, 49), (-170, -49)])
+    for i in range(len(expected_inv_result)):
+        assert inv_result[i][0] == pytest.approx(expected_inv_result[i][0], abs=1e-10)
+        assert inv_result[i][1] == pytest.approx(expected_inv_result[i][1], abs=1e-10)
+
+    with osr.ExceptionMgr(useExceptions=False), gdal.quiet_errors():
+        x, y, _, _, error_code = ct.TransformPointWithErrorCode(
+            *swap([(0, 90)])[0], 0, 0
+        )
+    assert math.isinf(x) and math.isinf(y)
+    assert error_code == osr.PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN
+
+    with gdal.config_option("CHECK_WITH_INVERT_PROJ", "YES"):
+        ct = osr.CoordinateTransformation(src_srs, dst_srs)
+    with osr.ExceptionMgr(useExceptions=False), gdal.quiet_errors():
+        x, y, _ = ct.TransformPoint(*swap([(190, -49)])[0])
+    assert math.isinf(x) and math.isinf(y)
+
+
+###############################################################################
+# Test OGR_CT_NUM_THREADS
+
+
+def test_osr_ct_num_threads():
+
+    src_srs = osr.SpatialReference()
+    src_srs.ImportFromEPSG(4326)
+    src_srs.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+
+    dst_srs = osr.SpatialReference()
+    dst_srs.ImportFromEPSG(32631)
+
+    pnts = [(2 + (i % 100) * 0.01, 49 + (i // 100) * 0.01) for i in range(50000)]
+    # Invalid points
+    pnts[10] = (float("nan"), 0)
+    pnts[30000] = (0, 91)
+
+    ct = osr.CoordinateTransformation(src_srs, dst_srs)
+    with osr.ExceptionMgr(useExceptions=False), gdal.quiet_errors():
+        expected_result = ct.TransformPoints(pnts)
+
+    with gdal.config_option("OGR_CT_NUM_THREADS", "4"):
+        ct = osr.CoordinateTransformation(src_srs, dst_srs)
+    for _ in range(2):
+        with osr.ExceptionMgr(useExceptions=False), gdal.quiet_errors():
+            result = ct.TransformPoints(pnts)
+        assert result == expected_result
+
+
 ###############################################################################
 # Test coordinate transformation where only one CRS has a towgs84 clause (#1156)
 
@@ -953,3 +1038,74 @@ def test_osr_ct_fix_9732():
     x, y, _ = ct.TransformPoint(2300000, 2000000, 0)
     assert x == pytest.approx(2301000)
     assert y == pytest.approx(2000000)
+
+
+###############################################################################
+# Test OGR_CT_PIPELINE_CACHE
+
+
+def test_osr_ct_pipeline_cache(tmp_path):
+
+    s = osr.SpatialReference()
+    s.ImportFromEPSG(4326)
+    t = osr.SpatialReference()
+    t.ImportFromEPSG(32633)
+    options = osr.CoordinateTransformationOptions()
+    options.SetAreaOfInterest(14, 45, 15, 46)
+
+    cache_filename = str(tmp_path / "pipelines.txt")
+    with gdal.config_option("OGR_CT_PIPELINE_CACHE", cache_filename):
+        ct = osr.CoordinateTransformation(s, t, options)
+    x, y, _ = ct.TransformPoint(45, 15, 0)
+    assert x == pytest.approx(500000, abs=1e-3)
+
+    with open(cache_filename) as f:
+        lines = f.read().splitlines()
+    assert len(lines) == 1
+    key, pipeline = lines[0].split("\t")
+    assert len(key) == 64
+    assert "+proj=utm" in pipeline
+
+    # Check that the pipeline read from the cache is used, by altering it.
+    # ct is kept alive so that it is not reused from the in-memory cache.
+    other_cache_filename = str(tmp_path / "other_pipelines.txt")
+    with open(other_cache_filename, "w") as f:
+        f.write(key + "\t+proj=affine +xoff=1\n")
+    with gdal.config_option("OGR_CT_PIPELINE_CACHE", other_cache_filename):
+        ct2 = osr.CoordinateTransformation(s, t, options)
+    assert ct2.TransformPoint(45, 15, 0) == pytest.approx((46, 15, 0))
+
+    # Invalid pipelines are ignored
+    invalid_cache_filename = str(tmp_path / "invalid_pipelines.txt")
+    with open(invalid_cache_filename, "w") as f:
+        f.write(key + "\t+proj=i_do_not_exist\n")
+    with gdal.config_option("OGR_CT_PIPELINE_CACHE", invalid_cache_filename):
+        ct3 = osr.CoordinateTransformation(s, t, options)
+    x, y, _ = ct3.TransformPoint(45, 15, 0)
+    assert x == pytest.approx(500000, abs=1e-3)
+    del ct
+    del ct2
+    del ct3
+
+
+###############################################################################
+# Test that a cached transformation can be retrieved several times
+
+
+def test_osr_ct_cache_shared():
+
+    s = osr.SpatialReference()
+    s.ImportFromEPSG(4326)
+    t = osr.SpatialReference()
+    t.ImportFromEPSG(32634)
+
+    ct = osr.CoordinateTransformation(s, t)
+    del ct
+
+    # Both objects come from the same cached transformation
+    ct1 = osr.CoordinateTransformation(s, t)
+    ct2 = osr.CoordinateTransformation(s, t)
+    assert ct1.TransformPoint(45, 21, 0) == pytest.approx(
+        ct2.TransformPoint(45, 21, 0)
+    )
+    assert ct1.TransformPoint(45, 21, 0)[0] == pytest.approx(500000, abs=1e-3)
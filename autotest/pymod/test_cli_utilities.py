@@ -280,5 +280,13 @@ def get_gdal_viewshed_path():
 #
 
 
+def get_gdal_tile_path():
+    return get_cli_utility_path("gdal_tile")
+
+
+###############################################################################
+#
+
+
 def get_gdal_footprint_path():
     return get_cli_utility_path("gdal_footprint")
@@ -36,7 +36,7 @@ import pathlib
 import ogrtest
 import pytest
 
-from osgeo import gdal, osr
+from osgeo import gdal, ogr, osr
 
 pytestmark = pytest.mark.require_geos
 
@@ -370,6 +370,53 @@ def test_gdal_footprint_lib_ovr_georef():
 #
 
 
+@pytest.mark.parametrize("options", [{}, {"ovr": 1}])
+def test_gdal_footprint_lib_adaptive(tmp_vsimem, options):
+
+    filename = str(tmp_vsimem / "test.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        filename, 1024, 1024, 1, options=["TILED=YES", "SPARSE_OK=YES"]
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    # Disk of radius 400 pixels, with a small hole close to its boundary.
+    # Blocks at the corners are left sparse.
+    for y in range(112, 912):
+        dx = int((400 * 400 - (y - 512) ** 2) ** 0.5)
+        src_ds.GetRasterBand(1).WriteRaster(
+            512 - dx, y, 2 * dx, 1, b"\xFF" * (2 * dx)
+        )
+    src_ds.GetRasterBand(1).WriteRaster(150, 500, 3, 3, b"\x00" * 9)
+    src_ds.BuildOverviews("NEAREST", [2, 4, 8, 16])
+
+    ref_ds = gdal.Footprint(
+        "",
+        src_ds,
+        format="Memory",
+        targetCoordinateSystem="pixel",
+        maxPoints="unlimited",
+    )
+    ref_geom = ref_ds.GetLayer(0).GetNextFeature().GetGeometryRef()
+
+    out_ds = gdal.Footprint(
+        "",
+        src_ds,
+        format="Memory",
+        targetCoordinateSystem="pixel",
+        maxPoints="unlimited",
+        adaptive=True,
+        **options,
+    )
+    out_geom = out_ds.GetLayer(0).GetNextFeature().GetGeometryRef()
+    assert out_geom.GetGeometryType() == ogr.wkbMultiPolygon
+    assert out_geom.GetGeometryRef(0).GetGeometryCount() == 2
+    assert out_geom.GetArea() == ref_geom.GetArea()
+    assert out_geom.SymmetricDifference(ref_geom).GetArea() == 0
+
+
+###############################################################################
+#
+
+
 @pytest.mark.require_driver("GPKG")
 def test_gdal_footprint_lib_dsco_lco(tmp_vsimem):
 
@@ -1037,6 +1037,56 @@ def test_gdal_grid_lib_skip_nan_zvalue():
     )
 
 
+###############################################################################
+# Test -tiled mode, where points are read for each output block
+
+
+@pytest.mark.parametrize(
+    "algorithm",
+    [
+        "invdist:radius1=0.02:radius2=0.03:angle=30",
+        "invdistnn:radius=0.02:max_points=12",
+        "average:radius1=0.02:radius2=0.02",
+        "nearest:radius1=0.01:radius2=0.01",
+        "count:radius1=0.02:radius2=0.02",
+        "range:radius1=0.02:radius2=0.02:nodata=-1",
+    ],
+)
+def test_gdal_grid_lib_tiled(tmp_vsimem, n43_shp, algorithm):
+
+    # Several output blocks
+    options = dict(
+        format="GTiff",
+        creationOptions=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+        outputBounds=[-80.0041667, 42.9958333, -78.9958333, 44.0041667],
+        width=50,
+        height=70,
+        outputType=gdal.GDT_Float64,
+        algorithm=algorithm,
+    )
+    ref_ds = gdal.Grid(tmp_vsimem / "ref.tif", n43_shp.GetDescription(), **options)
+    ds = gdal.Grid(
+        tmp_vsimem / "tiled.tif", n43_shp.GetDescription(), tiled=True, **options
+    )
+    ref = struct.unpack("d" * 50 * 70, ref_ds.ReadRaster())
+    got = struct.unpack("d" * 50 * 70, ds.ReadRaster())
+    assert got == pytest.approx(ref, rel=1e-10)
+
+
+def test_gdal_grid_lib_tiled_unsupported_algorithm(n43_shp):
+
+    with pytest.raises(Exception, match="bounded search radius"):
+        gdal.Grid(
+            "",
+            n43_shp.GetDescription(),
+            format="MEM",
+            width=10,
+            height=10,
+            algorithm="linear",
+            tiled=True,
+        )
+
+
 ###############################################################################
 # Test option argument handling
 
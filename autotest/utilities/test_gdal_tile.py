@@ -0,0 +1,190 @@
+#!/usr/bin/env pytest
+# -*- coding: utf-8 -*-
+###############################################################################
+#
+# Project:  GDAL/OGR Test Suite
+# Purpose:  gdal_tile testing
+#
+###############################################################################
+# Copyright (c) 2024, GDAL contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+###############################################################################
+
+import os
+
+import gdaltest
+import pytest
+import test_cli_utilities
+
+from osgeo import gdal
+
+pytestmark = [
+    pytest.mark.skipif(
+        test_cli_utilities.get_gdal_tile_path() is None,
+        reason="gdal_tile not available",
+    ),
+    pytest.mark.require_driver("PNG"),
+]
+
+
+@pytest.fixture()
+def gdal_tile_path():
+    return test_cli_utilities.get_gdal_tile_path()
+
+
+def _list_tiles(dirname):
+    tiles = set()
+    for root, _, files in os.walk(dirname):
+        for f in files:
+            rel = os.path.relpath(os.path.join(root, f), dirname)
+            z, x, yext = rel.replace("\\", "/").split("/")
+            y, ext = yext.split(".")
+            tiles.add((int(z), int(x), int(y), ext))
+    return tiles
+
+
+###############################################################################
+# Generate a pyramid from a gray dataset
+
+
+def test_gdal_tile_basic(gdal_tile_path, tmp_path):
+
+    out_dir = str(tmp_path / "tiles")
+    _, err = gdaltest.runexternal_out_and_err(
+        f"{gdal_tile_path} -q -z 9-11 ../gcore/data/byte.tif {out_dir}"
+    )
+    assert err is None or err == ""
+
+    tiles = _list_tiles(out_dir)
+    assert set(z for z, _, _, _ in tiles) == {9, 10, 11}
+    assert all(ext == "png" for _, _, _, ext in tiles)
+
+    # Each tile of a lower level is the parent of at least one tile of the
+    # next level, and each tile has a parent.
+    for z in (9, 10):
+        parents = set((x, y) for tz, x, y, _ in tiles if tz == z)
+        children = set((x // 2, y // 2) for tz, x, y, _ in tiles if tz == z + 1)
+        assert parents == children
+
+    for z, x, y, ext in tiles:
+        ds = gdal.Open(f"{out_dir}/{z}/{x}/{y}.{ext}")
+        assert ds.RasterXSize == 256
+        assert ds.RasterYSize == 256
+        assert ds.RasterCount == 2
+        assert ds.GetRasterBand(2).GetColorInterpretation() == gdal.GCI_AlphaBand
+        assert ds.GetRasterBand(2).ComputeRasterMinMax(False)[1] > 0
+        assert ds.GetRasterBand(1).Checksum() != 0
+
+
+###############################################################################
+# Check that the result does not depend on the number of threads
+
+
+def test_gdal_tile_threads(gdal_tile_path, tmp_path):
+
+    results = []
+    for options in ("-num_threads 1", "-num_threads 4"):
+        out_dir = str(tmp_path / f"tiles_{len(results)}")
+        _, err = gdaltest.runexternal_out_and_err(
+            f"{gdal_tile_path} -q {options} -z 10-12 -r bilinear "
+            f"../gcore/data/byte.tif {out_dir}"
+        )
+        assert err is None or err == ""
+        tiles = _list_tiles(out_dir)
+        checksums = {}
+        for z, x, y, ext in tiles:
+            ds = gdal.Open(f"{out_dir}/{z}/{x}/{y}.{ext}")
+            checksums[(z, x, y)] = [
+                ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+            ]
+        results.append(checksums)
+
+    assert results[0]
+    assert results[0] == results[1]
+
+
+###############################################################################
+# Test -convention tms
+
+
+def test_gdal_tile_convention_tms(gdal_tile_path, tmp_path):
+
+    out_dir_xyz = str(tmp_path / "xyz")
+    out_dir_tms = str(tmp_path / "tms")
+    gdaltest.runexternal(
+        f"{gdal_tile_path} -q -z 11 ../gcore/data/byte.tif {out_dir_xyz}"
+    )
+    gdaltest.runexternal(
+        f"{gdal_tile_path} -q -z 11 -convention tms ../gcore/data/byte.tif "
+        + out_dir_tms
+    )
+
+    tiles_xyz = _list_tiles(out_dir_xyz)
+    tiles_tms = _list_tiles(out_dir_tms)
+    assert tiles_xyz
+    assert set((z, x, (1 << z) - 1 - y) for z, x, y, _ in tiles_xyz) == set(
+        (z, x, y) for z, x, y, _ in tiles_tms
+    )
+
+
+###############################################################################
+# Test JPEG output
+
+
+@pytest.mark.require_driver("JPEG")
+def test_gdal_tile_jpeg(gdal_tile_path, tmp_path):
+
+    out_dir = str(tmp_path / "tiles")
+    _, err = gdaltest.runexternal_out_and_err(
+        f"{gdal_tile_path} -q -f JPEG -z 10-11 ../gcore/data/rgbsmall.tif {out_dir}"
+    )
+    assert err is None or err == ""
+
+    tiles = _list_tiles(out_dir)
+    assert set(z for z, _, _, _ in tiles) == {10, 11}
+    for z, x, y, ext in tiles:
+        assert ext == "jpg"
+        ds = gdal.Open(f"{out_dir}/{z}/{x}/{y}.{ext}")
+        assert ds.GetDriver().ShortName == "JPEG"
+        assert ds.RasterCount == 3
+
+
+###############################################################################
+# Test error cases
+
+
+def test_gdal_tile_errors(gdal_tile_path, tmp_path):
+
+    out_dir = str(tmp_path / "tiles")
+
+    _, err = gdaltest.runexternal_out_and_err(
+        f"{gdal_tile_path} -q ../gcore/data/int16.tif {out_dir}"
+    )
+    assert "Only Byte datasets are supported" in err
+
+    _, err = gdaltest.runexternal_out_and_err(
+        f"{gdal_tile_path} -q -z 30 ../gcore/data/byte.tif {out_dir}"
+    )
+    assert "Invalid value for -z" in err
+
+    _, err = gdaltest.runexternal_out_and_err(
+        f"{gdal_tile_path} -q ../gcore/data/8bit_pal.bmp {out_dir}"
+    )
+    assert "color table" in err
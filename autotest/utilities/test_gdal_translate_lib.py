@@ -1294,3 +1294,46 @@ def test_gdal_translate_lib_raster_uint16_ct_0_255_range():
     assert out_ds.GetRasterBand(1).DataType == gdal.GDT_Byte
     assert out_ds.GetRasterBand(2).DataType == gdal.GDT_Byte
     assert out_ds.GetRasterBand(3).DataType == gdal.GDT_Byte
+
+
+###############################################################################
+# Test that scaling and data type conversion give the same result when done
+# with several threads
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdal_translate_lib_scale_num_threads(tmp_vsimem, num_threads):
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    src_ds = gdal.GetDriverByName("GTiff").Create(
+        src_filename, 200, 150, 3, gdal.GDT_UInt16, options=["TILED=YES"]
+    )
+    for i in range(3):
+        src_ds.GetRasterBand(i + 1).Fill(1000 * (i + 1))
+        src_ds.GetRasterBand(i + 1).WriteRaster(
+            10 * i, 20, 100, 1, b"\xff\x00" * 100
+        )
+    src_ds = None
+
+    dst_filename = str(tmp_vsimem / "dst.tif")
+    with gdaltest.config_options(
+        {"GDAL_NUM_THREADS": num_threads, "GDAL_SWATH_SIZE": "10000"}
+    ):
+        out_ds = gdal.Translate(
+            dst_filename,
+            src_filename,
+            options="-scale 0 65535 0 255 -ot Byte -co TILED=YES "
+            "-co BLOCKXSIZE=32 -co BLOCKYSIZE=32 -co INTERLEAVE=BAND",
+        )
+    assert [out_ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+        gdal.Translate(
+            "",
+            src_filename,
+            format="MEM",
+            scaleParams=[[0, 65535, 0, 255]],
+            outputType=gdal.GDT_Byte,
+        )
+        .GetRasterBand(i + 1)
+        .Checksum()
+        for i in range(3)
+    ]
@@ -35,7 +35,7 @@ import gdaltest
 import pytest
 import test_cli_utilities
 
-from osgeo import gdal
+from osgeo import gdal, ogr, osr
 
 pytestmark = [
     pytest.mark.skipif(
@@ -192,6 +192,61 @@ def test_gdal_viewshed_api(viewshed_input):
 ###############################################################################
 
 
+@pytest.mark.parametrize(
+    "om,expected_cs", [("NORMAL", 14613), ("DEM", 45734), ("GROUND", 8381)]
+)
+def test_gdal_viewshed_num_threads(
+    gdal_viewshed_path, tmp_path, viewshed_input, om, expected_cs
+):
+
+    viewshed_out = str(tmp_path / "test_gdal_viewshed_out.tif")
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + " --config GDAL_NUM_THREADS 4 -om {} -oz {} -ox {} -oy {} {} {}".format(
+            om, oz[0], ox[0], oy[0], viewshed_input, viewshed_out
+        )
+    )
+    assert err is None or err == ""
+    ds = gdal.Open(viewshed_out)
+    assert ds
+    assert ds.GetRasterBand(1).Checksum() == expected_cs
+
+
+###############################################################################
+
+
+def test_gdal_viewshed_api_num_threads(viewshed_input):
+    src_ds = gdal.Open(viewshed_input)
+
+    def generate(options):
+        return gdal.ViewshedGenerate(
+            src_ds.GetRasterBand(1),
+            "MEM",
+            "unused_target_raster_name",
+            [],
+            ox[0],
+            oy[0],
+            oz[0],
+            0,  # targetHeight
+            255,  # visibleVal
+            0,  # invisibleVal
+            0,  # outOfRangeVal
+            -1.0,  # noDataVal,
+            0.85714,  # dfCurvCoeff
+            gdal.GVM_Edge,
+            10000,  # maxDistance
+            options=options,
+        )
+
+    ref_ds = generate([])
+    ds = generate(["NUM_THREADS=4"])
+    assert ds.ReadRaster() == ref_ds.ReadRaster()
+
+
+###############################################################################
+
+
 def test_gdal_viewshed_all_options(gdal_viewshed_path, tmp_path, viewshed_input):
 
     viewshed_out = str(tmp_path / "test_gdal_viewshed_out.tif")
@@ -424,3 +479,152 @@ def test_gdal_viewshed_south_up(gdal_viewshed_path, tmp_path, viewshed_input):
         struct.unpack("B" * (width * height), ds.GetRasterBand(1).ReadRaster())
         == expected_data
     )
+
+
+###############################################################################
+# Test cumulative viewshed from a layer of observers
+
+
+def _create_observers(filename, points, height_field=False):
+
+    ds = ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32617)
+    lyr = ds.CreateLayer("observers", srs=srs, geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("height", ogr.OFTReal))
+    for x, y, z in points:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if height_field:
+            f["height"] = z
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT ({x} {y})"))
+        lyr.CreateFeature(f)
+    ds.Close()
+
+
+def _sum_pixels(ds):
+    band = ds.GetRasterBand(1)
+    data = band.ReadRaster(buf_type=gdal.GDT_UInt32)
+    return sum(struct.unpack("I" * (ds.RasterXSize * ds.RasterYSize), data))
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdal_viewshed_observers(
+    gdal_viewshed_path, tmp_path, viewshed_input, num_threads
+):
+
+    points = [(ox[0], oy[0], oz[0]), (ox[0] + 3000, oy[0] - 2000, oz[1])]
+    observers = str(tmp_path / "observers.shp")
+    _create_observers(observers, points)
+
+    viewshed_out = str(tmp_path / "test_gdal_viewshed_out.tif")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + " --config GDAL_NUM_THREADS {} -md 5000 -oz {} -observers {} {} {}".format(
+            num_threads, oz[0], observers, viewshed_input, viewshed_out
+        )
+    )
+    assert err is None or err == ""
+    ds = gdal.Open(viewshed_out)
+    assert ds
+    assert ds.GetRasterBand(1).DataType == gdal.GDT_UInt32
+
+    # Compare with the sum of the individual viewsheds
+    expected_sum = 0
+    min_x = min_y = float("inf")
+    max_x = max_y = -float("inf")
+    for i, (x, y, _) in enumerate(points):
+        single_out = str(tmp_path / f"test_gdal_viewshed_single_{i}.tif")
+        _, err = gdaltest.runexternal_out_and_err(
+            gdal_viewshed_path
+            + " -md 5000 -vv 1 -iv 0 -ov 0 -oz {} -ox {} -oy {} {} {}".format(
+                oz[0], x, y, viewshed_input, single_out
+            )
+        )
+        assert err is None or err == ""
+        single_ds = gdal.Open(single_out)
+        expected_sum += _sum_pixels(single_ds)
+        gt = single_ds.GetGeoTransform()
+        min_x = min(min_x, gt[0])
+        max_x = max(max_x, gt[0] + gt[1] * single_ds.RasterXSize)
+        max_y = max(max_y, gt[3])
+        min_y = min(min_y, gt[3] + gt[5] * single_ds.RasterYSize)
+
+    gt = ds.GetGeoTransform()
+    assert gt[0] == pytest.approx(min_x)
+    assert gt[3] == pytest.approx(max_y)
+    assert gt[0] + gt[1] * ds.RasterXSize == pytest.approx(max_x)
+    assert gt[3] + gt[5] * ds.RasterYSize == pytest.approx(min_y)
+    assert _sum_pixels(ds) == expected_sum
+    counts = struct.unpack(
+        "I" * (ds.RasterXSize * ds.RasterYSize), ds.GetRasterBand(1).ReadRaster()
+    )
+    assert max(counts) <= 2
+
+
+###############################################################################
+
+
+def test_gdal_viewshed_observers_height_field(
+    gdal_viewshed_path, tmp_path, viewshed_input
+):
+
+    observers = str(tmp_path / "observers.shp")
+    _create_observers(observers, [(ox[0], oy[0], oz[1])], height_field=True)
+
+    viewshed_out = str(tmp_path / "test_gdal_viewshed_out.tif")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + " -observers {} -observers_layer observers "
+        "-observers_height_field height {} {}".format(
+            observers, viewshed_input, viewshed_out
+        )
+    )
+    assert err is None or err == ""
+
+    single_out = str(tmp_path / "test_gdal_viewshed_single.tif")
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + " -vv 1 -iv 0 -oz {} -ox {} -oy {} {} {}".format(
+            oz[1], ox[0], oy[0], viewshed_input, single_out
+        )
+    )
+    assert err is None or err == ""
+
+    ds = gdal.Open(viewshed_out)
+    single_ds = gdal.Open(single_out)
+    assert ds.GetRasterBand(1).ReadRaster(
+        buf_type=gdal.GDT_Byte
+    ) == single_ds.GetRasterBand(1).ReadRaster()
+
+
+###############################################################################
+
+
+def test_gdal_viewshed_observers_errors(gdal_viewshed_path, tmp_path, viewshed_input):
+
+    observers = str(tmp_path / "observers.shp")
+    _create_observers(observers, [(ox[0], oy[0], oz[0])])
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + f" -ox 0 -oy 0 -observers {observers} {viewshed_input} {tmp_path}/out.tif"
+    )
+    assert "cannot be used together with -observers" in err
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + f" -observers {observers} -observers_layer foo {viewshed_input} {tmp_path}/out.tif"
+    )
+    assert "Cannot find layer foo" in err
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + f" -observers {observers} -observers_height_field foo {viewshed_input} {tmp_path}/out.tif"
+    )
+    assert "Field foo does not exist" in err
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdal_viewshed_path
+        + f" -om DEM -observers {observers} {viewshed_input} {tmp_path}/out.tif"
+    )
+    assert "only supported with the normal output mode" in err
@@ -326,6 +326,67 @@ def test_gdaladdo_partial_refresh_from_source_extent(gdaladdo_path, tmp_path):
     ds = None
 
 
+###############################################################################
+# Test --partial-refresh-from-dirty-regions
+
+
+def test_gdaladdo_partial_refresh_from_dirty_regions(gdaladdo_path, tmp_path):
+
+    tracked_tif = str(tmp_path / "tracked.tif")
+    ref_tif = str(tmp_path / "ref.tif")
+
+    gdal.Translate(
+        tracked_tif,
+        "../gcore/data/byte.tif",
+        options="-outsize 512 512 -r cubic -co TILED=YES -co BLOCKXSIZE=64 "
+        "-co BLOCKYSIZE=64",
+    )
+    addo = f"{gdaladdo_path} --config GDAL_TIFF_OVR_BLOCKSIZE 64 -r bilinear"
+    gdaltest.runexternal(f"{addo} {tracked_tif} 2 4")
+
+    ds = gdal.OpenEx(
+        tracked_tif, gdal.OF_UPDATE, open_options=["TRACK_DIRTY_REGIONS=YES"]
+    )
+    ds.GetRasterBand(1).WriteRaster(128, 192, 64, 64, b"\xff" * (64 * 64))
+    ds = None
+
+    ds = gdal.Open(tracked_tif)
+    assert ds.GetMetadataItem("WINDOWS", "DIRTY_REGIONS") == "128,192,64,64"
+    ds = None
+
+    # Reference: full regeneration after the tracked update only
+    shutil.copy(tracked_tif, ref_tif)
+    gdaltest.runexternal(f"{addo} {ref_tif} 2 4")
+
+    # Untracked update, in an area far from the tracked one, must not be
+    # propagated to the overviews.
+    ds = gdal.Open(tracked_tif, gdal.GA_Update)
+    ds.GetRasterBand(1).WriteRaster(448, 448, 64, 64, b"\x00" * (64 * 64))
+    ds = None
+
+    out, err = gdaltest.runexternal_out_and_err(
+        f"{addo} --partial-refresh-from-dirty-regions {tracked_tif}"
+    )
+    assert "ERROR" not in err, (out, err)
+
+    ds = gdal.Open(tracked_tif)
+    assert ds.GetMetadataItem("WINDOWS", "DIRTY_REGIONS") is None
+    ref_ds = gdal.Open(ref_tif)
+    for i in range(2):
+        assert (
+            ds.GetRasterBand(1).GetOverview(i).Checksum()
+            == ref_ds.GetRasterBand(1).GetOverview(i).Checksum()
+        )
+    ds = None
+    ref_ds = None
+
+    out, err = gdaltest.runexternal_out_and_err(
+        f"{addo} --partial-refresh-from-dirty-regions {tracked_tif}"
+    )
+    assert "ERROR" not in err, (out, err)
+    assert "No dirty region to refresh" in out
+
+
 ###############################################################################
 # Test reuse of previous resampling method and overview levels
 
@@ -903,3 +903,44 @@ def test_gdalbuildvrt_lib_nodataMaxMaskThreshold_rgb_mask(tmp_vsimem):
     assert struct.unpack(
         "f" * 3, vrt_ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Float32)
     ) == pytest.approx((1.0, 1.001, 2.0))
+
+
+###############################################################################
+# Test opening input datasets from several threads
+
+
+@pytest.mark.parametrize("strict", [False, True])
+def test_gdalbuildvrt_lib_num_threads(tmp_vsimem, strict):
+
+    src_filenames = []
+    for i in range(20):
+        filename = str(tmp_vsimem / f"src_{i}.tif")
+        ds = gdal.GetDriverByName("GTiff").Create(filename, 10, 10)
+        ds.SetGeoTransform([2 + 10 * (i % 5), 1, 0, 49 - 10 * (i // 5), 0, -1])
+        ds.GetRasterBand(1).Fill(i)
+        ds.BuildOverviews("NEAR", [2])
+        ds = None
+        src_filenames.append(filename)
+    src_filenames.insert(5, str(tmp_vsimem / "i_dont_exist.tif"))
+
+    if strict:
+        with pytest.raises(Exception, match="i_dont_exist.tif"):
+            gdal.BuildVRT(
+                "", src_filenames, options=["-num_threads", "4", "-strict"]
+            )
+    else:
+
+        def build(num_threads):
+            with gdal.quiet_errors():
+                ds = gdal.BuildVRT(
+                    "", src_filenames, options=["-num_threads", str(num_threads)]
+                )
+            return ds.GetMetadata("xml:VRT")[0]
+
+        ref = build(1)
+        assert "src_19.tif" in ref
+        assert build(4) == ref
+        assert build("ALL_CPUS") == ref
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.BuildVRTOptions(options=["-num_threads", "0"])
@@ -715,3 +715,88 @@ def test_gdaldem_lib_dict_arguments():
     ind = opt.index("-co")
 
     assert opt[ind : ind + 4] == ["-co", "COMPRESS=DEFLATE", "-co", "LEVEL=4"]
+
+
+###############################################################################
+# Test that processing strips of lines in worker threads gives the same
+# result as the single-threaded processing
+
+
+@pytest.mark.parametrize("output_type", [gdal.GDT_Int16, gdal.GDT_Float32])
+@pytest.mark.parametrize(
+    "processing,options",
+    [
+        ("hillshade", {}),
+        ("hillshade", {"computeEdges": True}),
+        ("slope", {}),
+        ("TRI", {"computeEdges": True}),
+    ],
+)
+def test_gdaldem_lib_multithreaded(output_type, processing, options):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gdrivers/data/n43.tif",
+        format="MEM",
+        width=3000,
+        height=1000,
+        outputType=output_type,
+        resampleAlg=gdal.GRIORA_Bilinear,
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    # Add a few nodata pixels
+    src_ds.GetRasterBand(1).WriteRaster(
+        10, 500, 100, 1, b"\x00" * 100, buf_type=gdal.GDT_Byte
+    )
+
+    ds_ref = gdal.DEMProcessing("", src_ds, processing, format="MEM", **options)
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        ds = gdal.DEMProcessing("", src_ds, processing, format="MEM", **options)
+    assert ds.GetRasterBand(1).ReadRaster() == ds_ref.GetRasterBand(1).ReadRaster()
+
+
+###############################################################################
+# Test that the row kernels give the same result as the per-pixel code path
+
+
+@pytest.mark.parametrize("output_type", [gdal.GDT_Int16, gdal.GDT_Float32])
+@pytest.mark.parametrize(
+    "processing,options",
+    [
+        ("hillshade", {}),
+        ("hillshade", {"computeEdges": True}),
+        ("hillshade", {"alg": "ZevenbergenThorne"}),
+        ("hillshade", {"combined": True}),
+        ("hillshade", {"igor": True}),
+        ("hillshade", {"multiDirectional": True}),
+        ("slope", {}),
+        ("slope", {"slopeFormat": "percent", "alg": "ZevenbergenThorne"}),
+        ("aspect", {}),
+        ("aspect", {"trigonometric": True, "zeroForFlat": True}),
+        ("TRI", {}),
+        ("TRI", {"alg": "Riley"}),
+        ("TPI", {}),
+        ("Roughness", {"computeEdges": True}),
+    ],
+)
+def test_gdaldem_lib_row_kernels(output_type, processing, options):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/n43.tif", format="MEM", outputType=output_type
+    )
+    # Non-square pixels, so that the generic hillshade formula is also used
+    gt = src_ds.GetGeoTransform()
+    src_ds.SetGeoTransform([gt[0], gt[1], 0, gt[3], 0, gt[5] * 1.5])
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    src_ds.GetRasterBand(1).WriteRaster(
+        10, 50, 30, 1, b"\x00" * 30, buf_type=gdal.GDT_Byte
+    )
+    src_ds.GetRasterBand(1).WriteRaster(60, 20, 1, 1, b"\x00", buf_type=gdal.GDT_Byte)
+
+    for ds in (src_ds, gdal.Translate("", src_ds, format="MEM", noData="none")):
+        with gdal.config_option("GDAL_USE_SSE", "NO"):
+            ds_ref = gdal.DEMProcessing("", ds, processing, format="MEM", **options)
+        ds_res = gdal.DEMProcessing("", ds, processing, format="MEM", **options)
+        assert (
+            ds_res.GetRasterBand(1).ReadRaster() == ds_ref.GetRasterBand(1).ReadRaster()
+        )
@@ -30,6 +30,7 @@
 ###############################################################################
 
 
+import array
 import pathlib
 import shutil
 
@@ -308,3 +309,132 @@ def test_gdalinfo_lib_json_engineering_crs():
     assert "coordinateSystem" in ret
     assert "cornerCoordinates" in ret
     assert "wgs84Extent" not in ret
+
+
+###############################################################################
+# Test that -stats on a multi-band dataset, where statistics are computed in
+# a single pass over all bands, gives the same result as computing them band
+# after band
+
+
+@pytest.mark.parametrize("datatype", [gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Float32])
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_gdalinfo_lib_stats_multiband(tmp_vsimem, datatype, num_threads):
+
+    filename = str(tmp_vsimem / "test.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        300,
+        200,
+        5,
+        datatype,
+        options=[
+            "TILED=YES",
+            "BLOCKXSIZE=64",
+            "BLOCKYSIZE=64",
+            "INTERLEAVE=PIXEL",
+        ],
+    )
+    for i in range(5):
+        band = ds.GetRasterBand(i + 1)
+        band.WriteRaster(
+            0,
+            0,
+            300,
+            200,
+            bytes(((j * (i + 3)) // 7) % 251 for j in range(300 * 200)),
+            buf_type=gdal.GDT_Byte,
+        )
+    ds.GetRasterBand(2).SetNoDataValue(10)
+    ds.GetRasterBand(4).SetNoDataValue(1)
+    ds = None
+
+    ds = gdal.Open(filename)
+    expected = [ds.GetRasterBand(i + 1).ComputeStatistics(False) for i in range(5)]
+    ds = None
+    gdal.Unlink(filename + ".aux.xml")
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ret = gdal.Info(filename, format="json", stats=True)
+    for i, band in enumerate(ret["bands"]):
+        got = [band["minimum"], band["maximum"], band["mean"], band["stdDev"]]
+        assert got == pytest.approx(expected[i], abs=1e-3)
+
+    ds = gdal.Open(filename)
+    for i in range(5):
+        band = ds.GetRasterBand(i + 1)
+        assert band.GetStatistics(False, False) == pytest.approx(
+            expected[i], rel=1e-12
+        )
+        assert band.GetMetadataItem("STATISTICS_VALID_PERCENT") is not None
+
+
+###############################################################################
+# Test that the checksum does not depend on the number of threads, and
+# test -hash
+
+
+@pytest.mark.parametrize("datatype", [gdal.GDT_Int16, gdal.GDT_Float32])
+def test_gdalinfo_lib_checksum_and_hash_threads(tmp_vsimem, datatype):
+
+    # Large enough to be split into several chunks when multi-threaded
+    xsize = 1100
+    ysize = 700
+    data = array.array(
+        "h", [((j * 37) % 20011) - 10000 for j in range(xsize * ysize)]
+    ).tobytes()
+
+    filenames = []
+    for options in (["TILED=YES"], ["BLOCKYSIZE=3"]):
+        filename = str(tmp_vsimem / f"test{len(filenames)}.tif")
+        ds = gdal.GetDriverByName("GTiff").Create(
+            filename, xsize, ysize, 1, datatype, options=options
+        )
+        ds.GetRasterBand(1).WriteRaster(
+            0, 0, xsize, ysize, data, buf_type=gdal.GDT_Int16
+        )
+        ds = None
+        filenames.append(filename)
+
+    ds = gdal.Open(filenames[0])
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        expected_checksum = ds.GetRasterBand(1).Checksum()
+        expected_window_checksum = ds.GetRasterBand(1).Checksum(
+            3, 5, xsize - 10, ysize - 20
+        )
+    ds = None
+
+    for num_threads in ("1", "3", "8"):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.Open(filenames[0])
+            assert ds.GetRasterBand(1).Checksum() == expected_checksum
+            assert (
+                ds.GetRasterBand(1).Checksum(3, 5, xsize - 10, ysize - 20)
+                == expected_window_checksum
+            )
+            ds = None
+
+    # The hash does not depend on the block structure nor the number of threads
+    hashes = set()
+    for filename in filenames:
+        for num_threads in ("1", "8"):
+            with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+                ret = gdal.Info(filename, format="json", computeHash=True)
+            hashes.add(ret["bands"][0]["hash"])
+    assert len(hashes) == 1
+    expected_hash = hashes.pop()
+    assert len(expected_hash) == 16
+    assert "Hash=" + expected_hash in gdal.Info(filenames[0], computeHash=True)
+
+    # Contrary to the checksum, the hash changes when a decimal part changes
+    if datatype == gdal.GDT_Float32:
+        ds = gdal.Open(filenames[0], gdal.GA_Update)
+        ds.GetRasterBand(1).WriteRaster(
+            0, 0, 1, 1, array.array("f", [-10000.25]).tobytes()
+        )
+        ds = None
+        ret = gdal.Info(
+            filenames[0], format="json", computeHash=True, computeChecksum=True
+        )
+        assert ret["bands"][0]["checksum"] == expected_checksum
+        assert ret["bands"][0]["hash"] != expected_hash
@@ -29,6 +29,7 @@
 # DEALINGS IN THE SOFTWARE.
 ###############################################################################
 
+import array
 import sys
 
 import pytest
@@ -254,3 +255,87 @@ def test_gdallocationinfo_echo(gdallocationinfo_path):
         strin="1 2",
     )
     assert "1,2,132" in ret
+
+
+###############################################################################
+# Test -mdarray
+
+
+def test_gdallocationinfo_mdarray(gdallocationinfo_path, tmp_path):
+
+    filename = str(tmp_path / "test.zarr")
+    ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(filename)
+    rg = ds.GetRootGroup()
+    dim0 = rg.CreateDimension("time", None, None, 3)
+    dim1 = rg.CreateDimension("y", None, None, 2)
+    dim2 = rg.CreateDimension("x", None, None, 2)
+    ar = rg.CreateMDArray(
+        "ar",
+        [dim0, dim1, dim2],
+        gdal.ExtendedDataType.Create(gdal.GDT_Byte),
+        ["BLOCKSIZE=2,1,1"],
+    )
+    ar.Write(array.array("B", [i for i in range(3 * 2 * 2)]))
+    ds = None
+
+    ret = gdaltest.runexternal(
+        gdallocationinfo_path
+        + f" -valonly -field_sep , -mdarray /ar {filename} 1 0"
+    )
+    assert ret.strip() == "1,5,9"
+
+    ret = gdaltest.runexternal(
+        gdallocationinfo_path + f" -valonly -b 3 -b 1 -mdarray ar {filename} 0 1"
+    )
+    assert ret.replace("\r\n", "\n").strip() == "10\n2"
+
+
+###############################################################################
+# Test -r and batch processing of points read from stdin
+
+
+def test_gdallocationinfo_resampling(gdallocationinfo_path, tmp_path):
+
+    filename = str(tmp_path / "test.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        20,
+        20,
+        1,
+        gdal.GDT_Float32,
+        options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+    )
+    ds.GetRasterBand(1).WriteRaster(
+        0,
+        0,
+        20,
+        20,
+        array.array("f", [i + 10 * j for j in range(20) for i in range(20)]),
+    )
+    ds = None
+
+    # Points spread over several blocks, in non-sorted order
+    points = [(17.5, 2.5), (2.25, 2.75), (15.75, 16.25), (1.5, 17.5), (30, 1)]
+
+    ret = gdaltest.runexternal(
+        gdallocationinfo_path + f" -valonly {filename}",
+        strin="\n".join(f"{x} {y}" for x, y in points),
+    )
+    assert ret.replace("\r\n", "\n").split("\n")[:5] == [
+        str(int(x) + 10 * int(y)) if x < 20 else "" for x, y in points
+    ]
+
+    for resampling in ("bilinear", "cubic"):
+        ret = gdaltest.runexternal(
+            gdallocationinfo_path + f" -valonly -r {resampling} {filename}",
+            strin="\n".join(f"{x} {y}" for x, y in points[0:4]),
+        )
+        # Linear field: interpolation is exact away from the edges
+        assert [float(v) for v in ret.split()] == pytest.approx(
+            [x - 0.5 + 10 * (y - 0.5) for x, y in points[0:4]]
+        )
+
+    _, err = gdaltest.runexternal_out_and_err(
+        gdallocationinfo_path + f" -r lanczos {filename} 1 1"
+    )
+    assert "Unsupported value for -r" in err
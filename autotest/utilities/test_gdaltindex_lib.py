@@ -458,3 +458,37 @@ def test_gdaltindex_lib_fetch_md(tmp_path, four_tiles):
     lyr = ds.GetLayer(0)
     f = lyr.GetNextFeature()
     assert f["foo_field"] == "bar"
+
+
+###############################################################################
+# Test opening tiles from several threads
+
+
+@pytest.mark.require_driver("GPKG")
+def test_gdaltindex_lib_num_threads(tmp_path, four_tiles):
+
+    # Repeat the tiles so that more of them than the number of threads are
+    # opened ahead
+    src_filenames = four_tiles * 10
+    src_filenames.insert(3, str(tmp_path / "i_dont_exist.tif"))
+
+    def build(num_threads):
+        index_filename = str(tmp_path / f"test_{num_threads}.gpkg")
+        with gdal.quiet_errors():
+            gdal.TileIndex(
+                index_filename,
+                src_filenames,
+                options=["-num_threads", str(num_threads)],
+            )
+        ds = ogr.Open(index_filename)
+        lyr = ds.GetLayer(0)
+        return [(f["location"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+
+    ref = build(1)
+    assert len(ref) == 40
+    assert [x[0] for x in ref[0:4]] == four_tiles
+    assert build(4) == ref
+    assert build("ALL_CPUS") == ref
+
+    with pytest.raises(Exception, match="Invalid value for -num_threads"):
+        gdal.TileIndexOptions(options=["-num_threads", "0"])
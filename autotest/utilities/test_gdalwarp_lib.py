@@ -4186,3 +4186,44 @@ def test_target_extent_consistent_size():
 
     assert ds.RasterXSize == 4793
     assert ds.RasterYSize == 4143
+
+
+###############################################################################
+# Test -multi with NUM_CHUNK_THREADS
+
+
+@pytest.mark.parametrize("num_threads", [1, 2])
+def test_gdalwarp_lib_multi_num_chunk_threads(num_threads):
+
+    src_ds = gdal.Open("../gcore/data/byte.tif")
+
+    def warp(multithread, warp_options):
+        progress = []
+
+        def callback(pct, msg, user_data):
+            progress.append(pct)
+            return 1
+
+        ds = gdal.Warp(
+            "",
+            src_ds,
+            options=gdal.WarpOptions(
+                format="MEM",
+                dstSRS="EPSG:4326",
+                width=400,
+                height=400,
+                resampleAlg="cubic",
+                warpMemoryLimit=10000,
+                multithread=multithread,
+                warpOptions=warp_options + [f"NUM_THREADS={num_threads}"],
+                callback=callback,
+            ),
+        )
+        assert progress == sorted(progress)
+        assert progress[-1] == 1.0
+        return ds.GetRasterBand(1).Checksum()
+
+    ref_cs = warp(False, [])
+    assert warp(True, []) == ref_cs
+    assert warp(True, ["NUM_CHUNK_THREADS=4"]) == ref_cs
+    assert warp(True, ["NUM_CHUNK_THREADS=ALL_CPUS"]) == ref_cs
@@ -572,3 +572,49 @@ def test_nearblack_lib_dict_arguments():
     ind = opt.index("-co")
 
     assert opt[ind : ind + 4] == ["-co", "COMPRESS=DEFLATE", "-co", "LEVEL=4"]
+
+
+###############################################################################
+# Test that multi-threaded processing gives the same result as single-threaded
+
+
+@pytest.mark.parametrize("alg", ["twopasses", "floodfill"])
+@pytest.mark.parametrize("maxNonBlack", [0, 2])
+def test_nearblack_lib_num_threads(alg, maxNonBlack):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/rgbsmall.tif", format="MEM", scaleParams=[[0, 60]]
+    )
+
+    ref_ds = gdal.Nearblack(
+        "",
+        src_ds,
+        format="MEM",
+        alg=alg,
+        maxNonBlack=maxNonBlack,
+        setMask=True,
+        numThreads=1,
+    )
+    ds = gdal.Nearblack(
+        "",
+        src_ds,
+        format="MEM",
+        alg=alg,
+        maxNonBlack=maxNonBlack,
+        setMask=True,
+        numThreads=4,
+    )
+    assert [ds.GetRasterBand(i + 1).Checksum() for i in range(3)] == [
+        ref_ds.GetRasterBand(i + 1).Checksum() for i in range(3)
+    ]
+    assert (
+        ds.GetRasterBand(1).GetMaskBand().Checksum()
+        == ref_ds.GetRasterBand(1).GetMaskBand().Checksum()
+    )
+
+
+def test_nearblack_lib_num_threads_invalid():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    with pytest.raises(Exception, match="-num_threads"):
+        gdal.Nearblack("", src_ds, format="MEM", numThreads="invalid")
@@ -2321,6 +2321,64 @@ def test_ogr2ogr_lib_OGR2OGR_USE_ARROW_API_YES(limit):
     )
 
 
+###############################################################################
+# Test reprojection with the Arrow interface
+
+
+@pytest.mark.parametrize("dst_srs", ["EPSG:4326", "EPSG:32632"])
+def test_ogr2ogr_lib_OGR2OGR_USE_ARROW_API_YES_reprojection(dst_srs):
+
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32631)
+    src_lyr = src_ds.CreateLayer("test", srs=srs)
+    src_lyr.CreateField(ogr.FieldDefn("str_field"))
+    for i, wkt in enumerate(
+        [
+            "POINT (500000 4500000)",
+            None,
+            "POINT EMPTY",
+            "LINESTRING Z (500000 4500000 10,510000 4510000 20)",
+            "POLYGON ((500000 4500000,500000 4510000,510000 4510000,500000 4500000))",
+            "GEOMETRYCOLLECTION (POINT (500000 4500000),MULTIPOINT ((1 2),(3 4)))",
+        ]
+    ):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["str_field"] = "foo%d" % i
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        src_lyr.CreateFeature(f)
+
+    with gdaltest.config_option("OGR2OGR_USE_ARROW_API", "NO"):
+        ref_ds = gdal.VectorTranslate("", src_ds, format="Memory", dstSRS=dst_srs)
+
+    got_msg = []
+
+    def my_handler(errorClass, errno, msg):
+        got_msg.append(msg)
+        return
+
+    with gdaltest.error_handler(my_handler), gdaltest.config_options(
+        {"CPL_DEBUG": "ON", "OGR2OGR_USE_ARROW_API": "YES"}
+    ):
+        out_ds = gdal.VectorTranslate("", src_ds, format="Memory", dstSRS=dst_srs)
+
+    assert "OGR2OGR: Using WriteArrowBatch()" in got_msg
+
+    ref_lyr = ref_ds.GetLayer(0)
+    out_lyr = out_ds.GetLayer(0)
+    assert out_lyr.GetSpatialRef().IsSame(ref_lyr.GetSpatialRef())
+    assert out_lyr.GetFeatureCount() == ref_lyr.GetFeatureCount()
+    for ref_f, out_f in zip(ref_lyr, out_lyr):
+        assert out_f["str_field"] == ref_f["str_field"]
+        ref_geom = ref_f.GetGeometryRef()
+        out_geom = out_f.GetGeometryRef()
+        if ref_geom is None:
+            assert out_geom is None
+        else:
+            ogrtest.check_feature_geometry(out_geom, ref_geom)
+
+
 ###############################################################################
 # Test JSON types roundtrip
 
@@ -2710,3 +2768,60 @@ def test_ogr2ogr_lib_coordinate_precision_with_geom():
         assert f.GetGeometryRef().ExportToWkt() == "LINESTRING (0 0,10 10)"
     else:
         assert f.GetGeometryRef().ExportToWkt() == "LINESTRING (1 1,9 9)"
+
+
+###############################################################################
+# Test -nt
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        "-t_srs EPSG:4326",
+        "-segmentize 100 -nlt PROMOTE_TO_MULTI",
+        "-s_srs EPSG:32631 -t_srs EPSG:4326 -gt 3",
+    ],
+)
+def test_ogr2ogr_lib_num_threads(options):
+
+    N = 1000
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32631)
+    src_lyr = src_ds.CreateLayer("test", srs=srs)
+    src_lyr.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+    for i in range(N):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        f["val"] = i
+        f.SetGeometry(
+            ogr.CreateGeometryFromWkt(
+                "LINESTRING (%d 4000000,%d 4001000)" % (i * 1000, i * 1000 + 500)
+            )
+        )
+        src_lyr.CreateFeature(f)
+
+    ref_ds = gdal.VectorTranslate("", src_ds, format="Memory", options=options)
+    out_ds = gdal.VectorTranslate(
+        "", src_ds, format="Memory", options=options + " -nt 4"
+    )
+    ref_lyr = ref_ds.GetLayer(0)
+    out_lyr = out_ds.GetLayer(0)
+    assert out_lyr.GetFeatureCount() == N
+    for ref_f, out_f in zip(ref_lyr, out_lyr):
+        assert out_f["val"] == ref_f["val"]
+        assert (
+            out_f.GetGeometryRef().ExportToIsoWkt()
+            == ref_f.GetGeometryRef().ExportToIsoWkt()
+        )
+    assert out_lyr.GetSpatialRef().IsSame(ref_lyr.GetSpatialRef())
+
+
+###############################################################################
+# Test -nt with an invalid value
+
+
+def test_ogr2ogr_lib_num_threads_invalid():
+
+    src_ds = gdal.GetDriverByName("Memory").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    with pytest.raises(Exception, match="Invalid value for -nt"):
+        gdal.VectorTranslate("", src_ds, format="Memory", options="-nt 0")
@@ -131,6 +131,37 @@ def test_sozip_validate(sozip_path, tmp_path):
 ###############################################################################
 
 
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_sozip_create_num_threads(sozip_path, tmp_path, num_threads):
+
+    input_file = str(tmp_path / "test.bin")
+    data = b"".join(b"%d," % i for i in range(200000))
+    with open(input_file, "wb") as f:
+        f.write(data)
+    output_zip = str(tmp_path / "sozip.zip")
+
+    (out, err) = gdaltest.runexternal_out_and_err(
+        f"{sozip_path} -j --enable-sozip=yes --sozip-chunk-size 1000 --num-threads={num_threads} {output_zip} {input_file}"
+    )
+    assert err is None or err == "", "got error/warning"
+
+    (out, err) = gdaltest.runexternal_out_and_err(
+        f"{sozip_path} --validate {output_zip}"
+    )
+    assert err is None or err == "", "got error/warning"
+    assert "File test.bin has a valid SOZip index, using chunk_size = 1000" in out
+
+    f = gdal.VSIFOpenL(f"/vsizip/{output_zip}/test.bin", "rb")
+    assert f is not None
+    try:
+        assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+    finally:
+        gdal.VSIFCloseL(f)
+
+
+###############################################################################
+
+
 def test_sozip_optimize_from(sozip_path, tmp_path):
 
     output_zip = str(tmp_path / "sozip.zip")
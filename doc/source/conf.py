@@ -233,6 +233,13 @@ man_pages = [
         [author_tamass],
         1,
     ),
+    (
+        "programs/gdal_tile",
+        "gdal_tile",
+        "Generates a directory of XYZ/TMS tiles",
+        [author_evenr],
+        1,
+    ),
     (
         "programs/gdal_create",
         "gdal_create",
@@ -2743,5 +2743,13 @@ GDALDataset *GRIBDataset::CreateCopy(const char *pszFilename,
     VSIFCloseL(fp);
 
     GDALOpenInfo oOpenInfo(pszFilename, GA_ReadOnly);
+    CPLStringList aosOpenOptions;
+    if (CPLTestBool(CSLFetchNameValueDef(papszOptions, "WRITE_IDX", "NO")))
+    {
+        // Do not use a potential obsolete .idx file
+        aosOpenOptions.SetNameValue("USE_IDX", "NO");
+        aosOpenOptions.SetNameValue("WRITE_IDX", "YES");
+        oOpenInfo.papszOpenOptions = aosOpenOptions.List();
+    }
     return Open(&oOpenInfo);
 }
@@ -1253,6 +1253,91 @@ class InventoryWrapperSidecar : public gdal::grib::InventoryWrapper
     }
 };
 
+/************************************************************************/
+/*                            WriteIdxFile()                            */
+/************************************************************************/
+
+// Write a <GRIB>.idx sidecar file with the layout of wgrib2 index files,
+// that is one line per GRIB2 message (or sub-message) of the form
+// "msgNum[.subgNum]:start:d=YYYYMMDDHH:element:level:forecast:".
+// The element and level are named as by degrib, which may differ from wgrib2.
+static void WriteIdxFile(const char *pszFilename,
+                         const gdal::grib::InventoryWrapper &oInv)
+{
+    const auto Sanitize = [](const char *pszStr)
+    {
+        std::string osStr(pszStr ? pszStr : "");
+        std::replace(osStr.begin(), osStr.end(), ':', ' ');
+        std::replace(osStr.begin(), osStr.end(), '\n', ' ');
+        return osStr;
+    };
+
+    std::string osContent;
+    for (int i = 0; i < static_cast<int>(oInv.length()); ++i)
+    {
+        const inventoryType *psInv = oInv.get(i);
+        if (psInv->GribVersion != 2)
+        {
+            CPLDebug("GRIB", "Not writing %s.idx: not all messages are GRIB2",
+                     pszFilename);
+            return;
+        }
+        osContent += std::to_string(psInv->msgNum);
+        const inventoryType *psNextInv = oInv.get(i + 1);
+        if (psInv->subgNum > 0 ||
+            (psNextInv && psNextInv->msgNum == psInv->msgNum))
+        {
+            // .idx files use a 1-based indexing of sub-messages
+            osContent += '.';
+            osContent += std::to_string(psInv->subgNum + 1);
+        }
+
+        struct tm brokendowntime;
+        CPLUnixTimeToYMDHMS(static_cast<GIntBig>(psInv->refTime),
+                            &brokendowntime);
+        std::string osForecast;
+        const int nForecastMin = static_cast<int>(psInv->foreSec / 60);
+        if (nForecastMin == 0)
+            osForecast = "anl";
+        else if ((nForecastMin % 60) == 0)
+            osForecast = CPLSPrintf("%d hour fcst", nForecastMin / 60);
+        else
+            osForecast = CPLSPrintf("%d min fcst", nForecastMin);
+
+        osContent += CPLSPrintf(
+            ":" CPL_FRMT_GUIB ":d=%04d%02d%02d%02d:",
+            static_cast<GUIntBig>(psInv->start), brokendowntime.tm_year + 1900,
+            brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
+            brokendowntime.tm_hour);
+        osContent += Sanitize(psInv->element);
+        osContent += ':';
+        osContent += Sanitize(psInv->shortFstLevel);
+        osContent += ':';
+        osContent += osForecast;
+        osContent += ":\n";
+    }
+
+    const std::string osIdxFilename = std::string(pszFilename) + ".idx";
+    VSILFILE *fpIdx = VSIFOpenL(osIdxFilename.c_str(), "wb");
+    if (fpIdx == nullptr)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot create %s",
+                 osIdxFilename.c_str());
+        return;
+    }
+    CPLDebug("GRIB", "Writing inventories to sidecar file %s",
+             osIdxFilename.c_str());
+    bool bOK = VSIFWriteL(osContent.data(), 1, osContent.size(), fpIdx) ==
+               osContent.size();
+    if (VSIFCloseL(fpIdx) != 0)
+        bOK = false;
+    if (!bOK)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Error while writing %s",
+                 osIdxFilename.c_str());
+    }
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                              GRIBDataset                             */
@@ -1486,6 +1571,15 @@ GDALDataset *GRIBDataset::Open(GDALOpenInfo *poOpenInfo)
         poDS->SetBand(bandNr, gribBand);
     }
 
+    // Save the inventory for next openings, if it has not been read from a
+    // sidecar file.
+    if (CPLTestBool(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                         "WRITE_IDX", "NO")) &&
+        dynamic_cast<InventoryWrapperGrib *>(pInventories.get()))
+    {
+        WriteIdxFile(poOpenInfo->pszFilename, *pInventories);
+    }
+
     // Initialize any PAM information.
     poDS->SetDescription(poOpenInfo->pszFilename);
 
@@ -2817,6 +2911,9 @@ char **GDALGRIBDriver::GetMetadata(const char *pszDomain)
                 "or K'/>"
                 "   <Option name='BAND_*' type='string' "
                 "description='Override options at band level'/>"
+                "   <Option name='WRITE_IDX' type='boolean' default='NO' "
+                "description='Whether to write a wgrib2-like .idx sidecar "
+                "file'/>"
                 "</CreationOptionList>";
 
             SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST, osCreationOptionList);
@@ -708,6 +708,487 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     return std::unique_ptr<GDALDataset>(GDALDataset::FromHandle(hRet));
 }
 
+/************************************************************************/
+/*                           COGLevelDataset                            */
+/************************************************************************/
+
+// In SINGLE_PASS mode, the rows of a resolution level that are still
+// needed, either to be written to their target file, or to compute the
+// next (lower resolution) level, are kept in memory, pixel-interleaved.
+// This dataset exposes them with the full dimensions of the level, so that
+// GDALRegenerateOverviewsMultiBand() can operate on them.
+
+namespace
+{
+class COGLevelBand;
+
+class COGLevelDataset final : public GDALDataset
+{
+    friend class COGLevelBand;
+
+    const GDALDataType m_eDT;
+    const size_t m_nPixelSize;
+    std::vector<GByte> m_abyRows{};
+    int m_nFirstRow = 0;
+    int m_nRowCount = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(COGLevelDataset)
+
+  public:
+    COGLevelDataset(GDALDataset *poModelDS, int nXSize, int nYSize,
+                    int nBlockSize);
+
+    int GetFirstRow() const
+    {
+        return m_nFirstRow;
+    }
+
+    int GetEndRow() const
+    {
+        return m_nFirstRow + m_nRowCount;
+    }
+
+    size_t GetPixelSize() const
+    {
+        return m_nPixelSize;
+    }
+
+    size_t GetRowSize() const
+    {
+        return m_nPixelSize * nRasterXSize;
+    }
+
+    GByte *GetRow(int nRow)
+    {
+        return m_abyRows.data() +
+               static_cast<size_t>(nRow - m_nFirstRow) * GetRowSize();
+    }
+
+    bool ExtendTo(int nEndRow);
+    void DiscardRowsBefore(int nRow);
+};
+
+class COGLevelBand final : public GDALRasterBand
+{
+    bool m_bHasNoData = false;
+    double m_dfNoData = 0;
+    GDALColorInterp m_eColorInterp = GCI_Undefined;
+
+  protected:
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage) override;
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
+  public:
+    COGLevelBand(COGLevelDataset *poDSIn, int nBandIn,
+                 GDALRasterBand *poModelBand, int nBlockSize);
+
+    double GetNoDataValue(int *pbSuccess) override
+    {
+        if (pbSuccess)
+            *pbSuccess = m_bHasNoData;
+        return m_dfNoData;
+    }
+
+    GDALColorInterp GetColorInterpretation() override
+    {
+        return m_eColorInterp;
+    }
+};
+
+COGLevelDataset::COGLevelDataset(GDALDataset *poModelDS, int nXSize,
+                                 int nYSize, int nBlockSize)
+    : m_eDT(poModelDS->GetRasterBand(1)->GetRasterDataType()),
+      m_nPixelSize(static_cast<size_t>(GDALGetDataTypeSizeBytes(m_eDT)) *
+                   poModelDS->GetRasterCount())
+{
+    nRasterXSize = nXSize;
+    nRasterYSize = nYSize;
+    eAccess = GA_Update;
+    for (int i = 1; i <= poModelDS->GetRasterCount(); ++i)
+    {
+        SetBand(i, new COGLevelBand(this, i, poModelDS->GetRasterBand(i),
+                                    nBlockSize));
+    }
+}
+
+bool COGLevelDataset::ExtendTo(int nEndRow)
+{
+    if (nEndRow <= GetEndRow())
+        return true;
+    try
+    {
+        m_abyRows.resize(static_cast<size_t>(nEndRow - m_nFirstRow) *
+                         GetRowSize());
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate %d rows of %d pixels", nEndRow - m_nFirstRow,
+                 nRasterXSize);
+        return false;
+    }
+    m_nRowCount = nEndRow - m_nFirstRow;
+    return true;
+}
+
+void COGLevelDataset::DiscardRowsBefore(int nRow)
+{
+    nRow = std::min(nRow, GetEndRow());
+    if (nRow <= m_nFirstRow)
+        return;
+    m_abyRows.erase(m_abyRows.begin(),
+                    m_abyRows.begin() +
+                        static_cast<size_t>(nRow - m_nFirstRow) * GetRowSize());
+    m_nRowCount -= nRow - m_nFirstRow;
+    m_nFirstRow = nRow;
+}
+
+COGLevelBand::COGLevelBand(COGLevelDataset *poDSIn, int nBandIn,
+                           GDALRasterBand *poModelBand, int nBlockSize)
+{
+    poDS = poDSIn;
+    nBand = nBandIn;
+    eDataType = poDSIn->m_eDT;
+    nRasterXSize = poDSIn->GetRasterXSize();
+    nRasterYSize = poDSIn->GetRasterYSize();
+    nBlockXSize = std::min(nBlockSize, nRasterXSize);
+    nBlockYSize = std::min(nBlockSize, nRasterYSize);
+    int bHasNoData = FALSE;
+    m_dfNoData = poModelBand->GetNoDataValue(&bHasNoData);
+    m_bHasNoData = CPL_TO_BOOL(bHasNoData);
+    m_eColorInterp = poModelBand->GetColorInterpretation();
+}
+
+CPLErr COGLevelBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
+{
+    const int nXOff = nBlockXOff * nBlockXSize;
+    const int nYOff = nBlockYOff * nBlockYSize;
+    const int nReqXSize = std::min(nBlockXSize, nRasterXSize - nXOff);
+    const int nReqYSize = std::min(nBlockYSize, nRasterYSize - nYOff);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    GDALRasterIOExtraArg sExtraArg;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    return IRasterIO(GF_Read, nXOff, nYOff, nReqXSize, nReqYSize, pImage,
+                     nReqXSize, nReqYSize, eDataType, nDTSize,
+                     static_cast<GSpacing>(nDTSize) * nBlockXSize, &sExtraArg);
+}
+
+CPLErr COGLevelBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                               int nXSize, int nYSize, void *pData,
+                               int nBufXSize, int nBufYSize,
+                               GDALDataType eBufType, GSpacing nPixelSpace,
+                               GSpacing nLineSpace,
+                               GDALRasterIOExtraArg *psExtraArg)
+{
+    auto poGDS = cpl::down_cast<COGLevelDataset *>(poDS);
+    if (nBufXSize != nXSize || nBufYSize != nYSize)
+    {
+        if (eRWFlag == GF_Read)
+        {
+            return GDALRasterBand::IRasterIO(
+                eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                nBufYSize, eBufType, nPixelSpace, nLineSpace, psExtraArg);
+        }
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "COGLevelBand::IRasterIO(): resampled writing not supported");
+        return CE_Failure;
+    }
+    if (nYOff < poGDS->GetFirstRow() || nYOff + nYSize > poGDS->GetEndRow())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "COGLevelBand::IRasterIO(): rows [%d, %d[ requested, "
+                 "but only rows [%d, %d[ are available",
+                 nYOff, nYOff + nYSize, poGDS->GetFirstRow(),
+                 poGDS->GetEndRow());
+        return CE_Failure;
+    }
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const int nLevelPixelSize = static_cast<int>(poGDS->GetPixelSize());
+    for (int iY = 0; iY < nYSize; ++iY)
+    {
+        GByte *pabyLevel = poGDS->GetRow(nYOff + iY) +
+                           static_cast<size_t>(nXOff) * nLevelPixelSize +
+                           static_cast<size_t>(nBand - 1) * nDTSize;
+        GByte *pabyBuffer = static_cast<GByte *>(pData) + iY * nLineSpace;
+        if (eRWFlag == GF_Read)
+        {
+            GDALCopyWords64(pabyLevel, eDataType, nLevelPixelSize, pabyBuffer,
+                            eBufType, static_cast<int>(nPixelSpace), nXSize);
+        }
+        else
+        {
+            GDALCopyWords64(pabyBuffer, eBufType,
+                            static_cast<int>(nPixelSpace), pabyLevel,
+                            eDataType, nLevelPixelSize, nXSize);
+        }
+    }
+    return CE_None;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                      COGBuildPyramidSinglePass()                     */
+/************************************************************************/
+
+// Reads poSrcDS only once, by strips of nBlockSize rows, and writes its
+// content to poBaseDS, while computing on-the-fly the overview levels,
+// written to apoOvrDS (from the highest to the lowest resolution).
+static bool
+COGBuildPyramidSinglePass(GDALDataset *poSrcDS, GDALDataset *poBaseDS,
+                          const std::vector<GDALDataset *> &apoOvrDS,
+                          int nBlockSize, const char *pszResampling,
+                          GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    int nKernelRadius = 0;
+    if (!GDALGetResampleFunction(pszResampling, &nKernelRadius))
+        return false;
+
+    const int nBands = poSrcDS->GetRasterCount();
+    const auto eDT = poSrcDS->GetRasterBand(1)->GetRasterDataType();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+
+    struct Level
+    {
+        std::unique_ptr<COGLevelDataset> poBuffer{};
+        GDALDataset *poTargetDS = nullptr;
+        int nWrittenRows = 0;
+        int nKernelMargin = 0;  // extra source rows read by the resampling
+    };
+
+    std::vector<Level> aoLevels(1 + apoOvrDS.size());
+    for (size_t i = 0; i < aoLevels.size(); ++i)
+    {
+        auto &oLevel = aoLevels[i];
+        oLevel.poTargetDS = (i == 0) ? poBaseDS : apoOvrDS[i - 1];
+        oLevel.poBuffer = std::make_unique<COGLevelDataset>(
+            poSrcDS, oLevel.poTargetDS->GetRasterXSize(),
+            oLevel.poTargetDS->GetRasterYSize(), nBlockSize);
+        if (i > 0)
+        {
+            // Same logic as in GDALRegenerateOverviewsMultiBand()
+            const auto &oPrevLevel = aoLevels[i - 1];
+            const double dfXRatio =
+                static_cast<double>(oPrevLevel.poBuffer->GetRasterXSize()) /
+                oLevel.poBuffer->GetRasterXSize();
+            const double dfYRatio =
+                static_cast<double>(oPrevLevel.poBuffer->GetRasterYSize()) /
+                oLevel.poBuffer->GetRasterYSize();
+            const int nOvrFactor =
+                std::max(1, std::max(static_cast<int>(0.5 + dfXRatio),
+                                     static_cast<int>(0.5 + dfYRatio)));
+            oLevel.nKernelMargin = nKernelRadius * nOvrFactor;
+        }
+    }
+
+    // Writes the complete tile rows of a level to its target dataset
+    const auto WriteRows = [nBlockSize, nBands, nDTSize, eDT](Level &oLevel)
+    {
+        auto poBuffer = oLevel.poBuffer.get();
+        const int nHeight = poBuffer->GetRasterYSize();
+        const int nEndRow = poBuffer->GetEndRow();
+        const int nNewEndRow =
+            nEndRow == nHeight
+                ? nHeight
+                : oLevel.nWrittenRows +
+                      (nEndRow - oLevel.nWrittenRows) / nBlockSize * nBlockSize;
+        if (nNewEndRow <= oLevel.nWrittenRows)
+            return true;
+        const int nWidth = poBuffer->GetRasterXSize();
+        const int nRows = nNewEndRow - oLevel.nWrittenRows;
+        if (oLevel.poTargetDS->RasterIO(
+                GF_Write, 0, oLevel.nWrittenRows, nWidth, nRows,
+                poBuffer->GetRow(oLevel.nWrittenRows), nWidth, nRows, eDT,
+                nBands, nullptr,
+                static_cast<GSpacing>(poBuffer->GetPixelSize()),
+                static_cast<GSpacing>(poBuffer->GetRowSize()), nDTSize,
+                nullptr) != CE_None)
+        {
+            return false;
+        }
+        oLevel.nWrittenRows = nNewEndRow;
+        return true;
+    };
+
+    // Computes as many rows of level iLevel as allowed by the rows available
+    // in the previous level.
+    const auto ComputeRows = [&aoLevels, nBands, nBlockSize,
+                              pszResampling](size_t iLevel)
+    {
+        auto &oPrevLevel = aoLevels[iLevel - 1];
+        auto &oLevel = aoLevels[iLevel];
+        auto poSrcBuffer = oPrevLevel.poBuffer.get();
+        auto poDstBuffer = oLevel.poBuffer.get();
+        const int nSrcHeight = poSrcBuffer->GetRasterYSize();
+        const int nDstHeight = poDstBuffer->GetRasterYSize();
+        const int nAvailableRows = poSrcBuffer->GetEndRow();
+        const bool bSrcComplete = nAvailableRows == nSrcHeight;
+        const double dfRatio = static_cast<double>(nSrcHeight) / nDstHeight;
+        const int nMargin = oLevel.nKernelMargin;
+
+        const int nDstStart = poDstBuffer->GetEndRow();
+        int nDstEnd = nDstHeight;
+        if (!bSrcComplete)
+        {
+            // The last row requires the whole source to be available
+            nDstEnd = std::min(
+                nDstHeight - 1,
+                static_cast<int>(std::max(0.0, (nAvailableRows - nMargin) /
+                                                   dfRatio)));
+            while (nDstEnd > nDstStart &&
+                   static_cast<int>(std::ceil(nDstEnd * dfRatio)) + nMargin >
+                       nAvailableRows)
+            {
+                --nDstEnd;
+            }
+            // Wait until a tile row can be computed
+            if (nDstEnd - nDstStart < nBlockSize)
+                return 0;
+        }
+        if (nDstEnd <= nDstStart)
+            return 0;
+
+        // Find the source window that GDALRegenerateOverviewsMultiBand()
+        // maps to [nDstStart, nDstEnd[
+        constexpr double EPS = 1e-8;
+        const auto GetDstStart = [nSrcHeight, nDstHeight](int nSrcYOff)
+        {
+            return static_cast<int>(static_cast<double>(nSrcYOff) /
+                                        nSrcHeight * nDstHeight +
+                                    EPS);
+        };
+        const auto GetDstEnd = [nSrcHeight, nDstHeight](int nSrcYEnd)
+        {
+            return std::min(static_cast<int>(std::ceil(
+                                static_cast<double>(nSrcYEnd) / nSrcHeight *
+                                    nDstHeight -
+                                EPS)),
+                            nDstHeight);
+        };
+        int nSrcYOff = std::min(
+            nSrcHeight - 1, static_cast<int>(std::ceil(nDstStart * dfRatio)));
+        while (nSrcYOff > 0 && GetDstStart(nSrcYOff - 1) >= nDstStart)
+            --nSrcYOff;
+        while (nSrcYOff < nSrcHeight - 1 && GetDstStart(nSrcYOff) < nDstStart)
+            ++nSrcYOff;
+        int nSrcYEnd = nDstEnd == nDstHeight
+                           ? nSrcHeight
+                           : static_cast<int>(std::floor(nDstEnd * dfRatio));
+        while (nSrcYEnd > nSrcYOff + 1 && GetDstEnd(nSrcYEnd) > nDstEnd)
+            --nSrcYEnd;
+        while (nSrcYEnd < nSrcHeight && GetDstEnd(nSrcYEnd) < nDstEnd)
+            ++nSrcYEnd;
+        if (GetDstStart(nSrcYOff) != nDstStart ||
+            GetDstEnd(nSrcYEnd) != nDstEnd)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot find source window for overview rows [%d, %d[",
+                     nDstStart, nDstEnd);
+            return -1;
+        }
+
+        if (!poDstBuffer->ExtendTo(nDstEnd))
+            return -1;
+
+        std::vector<GDALRasterBand *> apoSrcBands;
+        std::vector<GDALRasterBand *> apoDstBands;
+        for (int i = 1; i <= nBands; ++i)
+        {
+            apoSrcBands.push_back(poSrcBuffer->GetRasterBand(i));
+            apoDstBands.push_back(poDstBuffer->GetRasterBand(i));
+        }
+        std::vector<GDALRasterBand **> apapoDstBands;
+        for (auto &poBand : apoDstBands)
+            apapoDstBands.push_back(&poBand);
+
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("XOFF", "0");
+        aosOptions.SetNameValue(
+            "XSIZE", CPLSPrintf("%d", poSrcBuffer->GetRasterXSize()));
+        aosOptions.SetNameValue("YOFF", CPLSPrintf("%d", nSrcYOff));
+        aosOptions.SetNameValue("YSIZE", CPLSPrintf("%d", nSrcYEnd - nSrcYOff));
+        if (GDALRegenerateOverviewsMultiBand(
+                nBands, apoSrcBands.data(), 1, apapoDstBands.data(),
+                pszResampling, nullptr, nullptr,
+                aosOptions.List()) != CE_None)
+        {
+            return -1;
+        }
+
+        return nDstEnd - nDstStart;
+    };
+
+    const int nXSize = poSrcDS->GetRasterXSize();
+    const int nYSize = poSrcDS->GetRasterYSize();
+    auto &oBaseLevel = aoLevels[0];
+    auto poBaseBuffer = oBaseLevel.poBuffer.get();
+    for (int nYOff = 0; nYOff < nYSize; nYOff += nBlockSize)
+    {
+        const int nRows = std::min(nBlockSize, nYSize - nYOff);
+        if (!poBaseBuffer->ExtendTo(nYOff + nRows) ||
+            poSrcDS->RasterIO(
+                GF_Read, 0, nYOff, nXSize, nRows, poBaseBuffer->GetRow(nYOff),
+                nXSize, nRows, eDT, nBands, nullptr,
+                static_cast<GSpacing>(poBaseBuffer->GetPixelSize()),
+                static_cast<GSpacing>(poBaseBuffer->GetRowSize()), nDTSize,
+                nullptr) != CE_None ||
+            !WriteRows(oBaseLevel))
+        {
+            return false;
+        }
+
+        for (size_t iLevel = 1; iLevel < aoLevels.size(); ++iLevel)
+        {
+            const int nNewRows = ComputeRows(iLevel);
+            if (nNewRows < 0)
+                return false;
+            if (nNewRows == 0)
+                break;
+            auto &oLevel = aoLevels[iLevel];
+            if (!WriteRows(oLevel))
+                return false;
+
+            // Drop the rows of the previous level that are no longer needed
+            auto &oPrevLevel = aoLevels[iLevel - 1];
+            const double dfRatio =
+                static_cast<double>(oPrevLevel.poBuffer->GetRasterYSize()) /
+                oLevel.poBuffer->GetRasterYSize();
+            oPrevLevel.poBuffer->DiscardRowsBefore(std::min(
+                oPrevLevel.nWrittenRows,
+                static_cast<int>(oLevel.poBuffer->GetEndRow() * dfRatio) -
+                    oLevel.nKernelMargin));
+        }
+        auto &oLastLevel = aoLevels.back();
+        oLastLevel.poBuffer->DiscardRowsBefore(oLastLevel.nWrittenRows);
+
+        if (!pfnProgress(static_cast<double>(nYOff + nRows) / nYSize, "",
+                         pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+    }
+
+    for (auto &oLevel : aoLevels)
+    {
+        if (oLevel.nWrittenRows != oLevel.poBuffer->GetRasterYSize())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Only %d rows out of %d have been generated",
+                     oLevel.nWrittenRows, oLevel.poBuffer->GetRasterYSize());
+            return false;
+        }
+        if (oLevel.poTargetDS->FlushCache(false) != CE_None)
+            return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                            GDALCOGCreator                            */
 /************************************************************************/
@@ -719,6 +1200,7 @@ struct GDALCOGCreator final
     std::unique_ptr<GDALDataset> m_poVRTWithOrWithoutStats{};
     CPLString m_osTmpOverviewFilename{};
     CPLString m_osTmpMskOverviewFilename{};
+    CPLString m_osTmpBaseFilename{};
 
     ~GDALCOGCreator();
 
@@ -751,6 +1233,10 @@ GDALCOGCreator::~GDALCOGCreator()
     {
         VSIUnlink(m_osTmpMskOverviewFilename);
     }
+    if (!m_osTmpBaseFilename.empty())
+    {
+        VSIUnlink(m_osTmpBaseFilename);
+    }
 }
 
 /************************************************************************/
@@ -1100,6 +1586,46 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
         }
     }
 
+    const char *pszOvrResampling = CSLFetchNameValueDef(
+        papszOptions, "OVERVIEW_RESAMPLING",
+        CSLFetchNameValueDef(papszOptions, "RESAMPLING",
+                             GetResampling(poSrcDS)));
+
+    // In SINGLE_PASS mode, the source is read only once: the full resolution
+    // imagery is written to a temporary file with the final encoding, while
+    // the overviews are computed on-the-fly from in-memory rows.
+    bool bSinglePass = CPLFetchBool(papszOptions, "SINGLE_PASS", false);
+    if (bSinglePass)
+    {
+        const char *pszReason = nullptr;
+        const auto poCT = poFirstBand->GetColorTable();
+        if (!bGenerateOvr)
+            pszReason = "no overview needs to be computed";
+        else if (bHasMask)
+            pszReason = "the dataset has a mask band";
+        else if (GDALDataTypeIsComplex(poFirstBand->GetRasterDataType()))
+            pszReason = "the data type is complex";
+        else if (poCT && !poCT->IsIdentity() &&
+                 !STARTS_WITH_CI(pszOvrResampling, "NEAR"))
+            pszReason = "the color table requires a nearest resampling";
+        else if (!STARTS_WITH_CI(pszOvrResampling, "NEAR") &&
+                 !EQUAL(pszOvrResampling, "AVERAGE") &&
+                 !EQUAL(pszOvrResampling, "RMS") &&
+                 !EQUAL(pszOvrResampling, "GAUSS") &&
+                 !EQUAL(pszOvrResampling, "CUBIC") &&
+                 !EQUAL(pszOvrResampling, "CUBICSPLINE") &&
+                 !EQUAL(pszOvrResampling, "LANCZOS") &&
+                 !EQUAL(pszOvrResampling, "BILINEAR") &&
+                 !EQUAL(pszOvrResampling, "MODE"))
+            pszReason = "the resampling method is not supported";
+        if (pszReason)
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "SINGLE_PASS=YES ignored since %s", pszReason);
+            bSinglePass = false;
+        }
+    }
+
     if (dfTotalPixelsToProcess == 0.0)
     {
         dfTotalPixelsToProcess =
@@ -1107,6 +1633,11 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
             (bGenerateOvr ? double(nXSize) * nYSize * nBands / 3 : 0) +
             double(nXSize) * nYSize * (nBands + (bHasMask ? 1 : 0)) * 4. / 3;
     }
+    if (bSinglePass)
+    {
+        // Reading the source and writing the temporary base imagery
+        dfTotalPixelsToProcess += double(nXSize) * nYSize * nBands;
+    }
 
     CPLStringList aosOverviewOptions;
     aosOverviewOptions.SetNameValue(
@@ -1123,10 +1654,7 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
         CPLDebug("COG", "Generating overviews of the mask: start");
         m_osTmpMskOverviewFilename = GetTmpFilename(pszFilename, "msk.ovr.tmp");
         GDALRasterBand *poSrcMask = poFirstBand->GetMaskBand();
-        const char *pszResampling = CSLFetchNameValueDef(
-            papszOptions, "OVERVIEW_RESAMPLING",
-            CSLFetchNameValueDef(papszOptions, "RESAMPLING",
-                                 GetResampling(poSrcDS)));
+        const char *pszResampling = pszOvrResampling;
 
         double dfNextPixels = dfCurPixels + double(nXSize) * nYSize / 3;
         void *pScaledProgress = GDALCreateScaledProgress(
@@ -1149,16 +1677,19 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
     }
 
     if (bGenerateOvr)
+        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
+    if (nBands > 1)
+    {
+        aosOverviewOptions.SetNameValue("INTERLEAVE", "PIXEL");
+    }
+
+    if (bGenerateOvr && !bSinglePass)
     {
         CPLDebug("COG", "Generating overviews of the imagery: start");
-        m_osTmpOverviewFilename = GetTmpFilename(pszFilename, "ovr.tmp");
         std::vector<GDALRasterBand *> apoSrcBands;
         for (int i = 0; i < nBands; i++)
             apoSrcBands.push_back(poCurDS->GetRasterBand(i + 1));
-        const char *pszResampling = CSLFetchNameValueDef(
-            papszOptions, "OVERVIEW_RESAMPLING",
-            CSLFetchNameValueDef(papszOptions, "RESAMPLING",
-                                 GetResampling(poSrcDS)));
+        const char *pszResampling = pszOvrResampling;
 
         double dfNextPixels =
             dfCurPixels + double(nXSize) * nYSize * nBands / 3;
@@ -1167,10 +1698,6 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
             dfNextPixels / dfTotalPixelsToProcess, pfnProgress, pProgressData);
         dfCurPixels = dfNextPixels;
 
-        if (nBands > 1)
-        {
-            aosOverviewOptions.SetNameValue("INTERLEAVE", "PIXEL");
-        }
         if (!m_osTmpMskOverviewFilename.empty())
         {
             aosOverviewOptions.SetNameValue("MASK_OVERVIEW_DATASET",
@@ -1342,6 +1869,112 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
         GDALDriver::FromHandle(GDALGetDriverByName("GTiff"));
     if (!poGTiffDrv)
         return nullptr;
+
+    if (bSinglePass)
+    {
+        CPLDebug("COG", "Generating base imagery and overviews: start");
+
+        // The base imagery is encoded as in the final product, so that its
+        // tiles can be copied as they are. Lossy JPEG is an exception, to
+        // avoid compressing twice.
+        m_osTmpBaseFilename = GetTmpFilename(pszFilename, "base.tmp");
+        CPLStringList aosBaseOptions;
+        for (const auto &[pszKey, pszValue] : cpl::IterateNameValue(aosOptions))
+        {
+            if (pszKey[0] != '@' && !EQUAL(pszKey, "COPY_SRC_OVERVIEWS") &&
+                !EQUAL(pszKey, "GEOTIFF_VERSION"))
+            {
+                aosBaseOptions.SetNameValue(pszKey, pszValue);
+            }
+        }
+        if (EQUAL(osCompress, "JPEG"))
+        {
+            aosBaseOptions.SetNameValue(
+                "COMPRESS", aosOverviewOptions.FetchNameValue("COMPRESS"));
+            aosBaseOptions.SetNameValue("JPEG_QUALITY", nullptr);
+            aosBaseOptions.SetNameValue("PHOTOMETRIC", nullptr);
+        }
+        if (nBands > 1)
+            aosBaseOptions.SetNameValue("INTERLEAVE", "PIXEL");
+        aosBaseOptions.SetNameValue("BIGTIFF", "YES");
+        aosBaseOptions.SetNameValue("SPARSE_OK", "YES");
+        std::unique_ptr<GDALDataset> poBaseDS(poGTiffDrv->Create(
+            m_osTmpBaseFilename, nXSize, nYSize, nBands,
+            poFirstBand->GetRasterDataType(), aosBaseOptions.List()));
+        if (!poBaseDS)
+            return nullptr;
+
+        // Overviews get their final encoding through the *_OVERVIEW
+        // configuration options, except JPEG.
+        CPLStringList aosOvrOptions(aosOverviewOptions);
+        std::unique_ptr<CPLConfigOptionSetter> poNoPhotometricSetter;
+        if (EQUAL(pszOverviewCompress, "JPEG"))
+        {
+            poNoPhotometricSetter = std::make_unique<CPLConfigOptionSetter>(
+                "PHOTOMETRIC_OVERVIEW", nullptr, false);
+        }
+        else
+        {
+            aosOvrOptions.SetNameValue("COMPRESS", nullptr);
+        }
+        std::vector<GDALRasterBand *> apoSrcBands;
+        for (int i = 0; i < nBands; i++)
+            apoSrcBands.push_back(poCurDS->GetRasterBand(i + 1));
+        // Only creates the overview levels
+        if (GTIFFBuildOverviewsEx(m_osTmpOverviewFilename, nBands,
+                                  apoSrcBands.data(),
+                                  static_cast<int>(asOverviewDims.size()),
+                                  nullptr, asOverviewDims.data(), "NONE",
+                                  aosOvrOptions.List(), GDALDummyProgress,
+                                  nullptr) != CE_None)
+        {
+            return nullptr;
+        }
+        poNoPhotometricSetter.reset();
+
+        std::unique_ptr<GDALDataset> poOvrDS(GDALDataset::Open(
+            m_osTmpOverviewFilename, GDAL_OF_RASTER | GDAL_OF_UPDATE));
+        if (!poOvrDS || poOvrDS->GetRasterBand(1)->GetOverviewCount() + 1 !=
+                            static_cast<int>(asOverviewDims.size()))
+        {
+            return nullptr;
+        }
+        std::vector<GDALDataset *> apoOvrDS{poOvrDS.get()};
+        for (int i = 0; i < poOvrDS->GetRasterBand(1)->GetOverviewCount(); ++i)
+        {
+            apoOvrDS.push_back(
+                poOvrDS->GetRasterBand(1)->GetOverview(i)->GetDataset());
+        }
+
+        const double dfNextPixels =
+            dfCurPixels + double(nXSize) * nYSize * nBands * 4. / 3;
+        void *pScaledProgress = GDALCreateScaledProgress(
+            dfCurPixels / dfTotalPixelsToProcess,
+            dfNextPixels / dfTotalPixelsToProcess, pfnProgress, pProgressData);
+        dfCurPixels = dfNextPixels;
+
+        bool bOK;
+        {
+            CPLConfigOptionSetter oSetter(
+                "GDAL_NUM_THREADS",
+                CSLFetchNameValue(papszOptions, "NUM_THREADS"), true);
+            bOK = COGBuildPyramidSinglePass(poCurDS, poBaseDS.get(), apoOvrDS,
+                                            nOvrThresholdSize, pszOvrResampling,
+                                            GDALScaledProgress,
+                                            pScaledProgress);
+        }
+        GDALDestroyScaledProgress(pScaledProgress);
+        if (!bOK || poOvrDS->Close() != CE_None ||
+            poBaseDS->Close() != CE_None)
+        {
+            return nullptr;
+        }
+        CPLDebug("COG", "Generating base imagery and overviews: end");
+
+        aosOptions.SetNameValue("@BASE_DATASET", m_osTmpBaseFilename);
+        aosOptions.SetNameValue("@RAW_COPY_TILES", "YES");
+    }
+
     void *pScaledProgress = GDALCreateScaledProgress(
         dfCurPixels / dfTotalPixelsToProcess, 1.0, pfnProgress, pProgressData);
 
@@ -1357,6 +1990,17 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
         aosOptions.AddNameValue("SRC_MDD", *papszSrcMDDIter);
     CSLDestroy(papszSrcMDD);
 
+    // The COG layout only requires rewriting the header, IFDs and tile
+    // offset/bytecount arrays located at the beginning of the file, the
+    // imagery being appended sequentially. This enables network file systems
+    // with multipart upload to be written without a local temporary file.
+    std::unique_ptr<CPLConfigOptionSetter> poFirstPartLastSetter;
+    if (!VSISupportsRandomWrite(pszFilename, true))
+    {
+        poFirstPartLastSetter = std::make_unique<CPLConfigOptionSetter>(
+            "CPL_VSIL_WRITE_FIRST_PART_LAST", "YES", true);
+    }
+
     CPLDebug("COG", "Generating final product: start");
     auto poRet =
         poGTiffDrv->CreateCopy(pszFilename, poCurDS, false, aosOptions.List(),
@@ -1555,6 +2199,9 @@ void GDALCOGDriver::InitializeCreationOptionList()
         "   </Option>"
         "  <Option name='OVERVIEW_COUNT' type='int' min='0' "
         "description='Number of overviews'/>"
+        "  <Option name='SINGLE_PASS' type='boolean' default='NO' "
+        "description='Whether the source dataset should be read only once "
+        "when computing overviews'/>"
         "  <Option name='TILING_SCHEME' type='string' description='"
         "Which tiling scheme to use pre-defined value or custom inline/outline "
         "JSON definition' default='CUSTOM'>"
@@ -1578,6 +1578,9 @@ void GDALRegister_GTiff()
         "   <Option name='IGNORE_COG_LAYOUT_BREAK' type='boolean' "
         "description='Allow update mode on files with COG structure' "
         "default='FALSE'/>"
+        "   <Option name='TRACK_DIRTY_REGIONS' type='boolean' "
+        "description='Whether to record the regions modified in update mode, "
+        "for later incremental refresh of overviews' default='FALSE'/>"
         "</OpenOptionList>");
     poDriver->SetMetadataItem(GDAL_DMD_SUBDATASETS, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
@@ -1606,6 +1609,11 @@ void GDALRegister_GTiff()
     poDriver->pfnCreateCopy = GTiffDataset::CreateCopy;
     poDriver->pfnUnloadDriver = GDALDeregister_GTiff;
     poDriver->pfnIdentify = GTiffDataset::Identify;
+    // Same combinations of byte order marks and classic/BigTIFF versions as
+    // accepted by GTiffDataset::Identify()
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES,
+                              "49492A00 4949002A 49492B00 4949002B "
+                              "4D4D2A00 4D4D002A 4D4D2B00 4D4D002B");
     poDriver->pfnGetSubdatasetInfoFunc = GTiffDriverGetSubdatasetInfo;
 
     GetGDALDriverManager()->RegisterDriver(poDriver);
@@ -115,7 +115,9 @@ GTiffDataset::GTiffDataset()
       m_bLeaderSizeAsUInt4(false), m_bTrailerRepeatedLast4BytesRepeated(false),
       m_bMaskInterleavedWithImagery(false), m_bKnownIncompatibleEdition(false),
       m_bWriteKnownIncompatibleEdition(false), m_bHasUsedReadEncodedAPI(false),
-      m_bWriteCOGLayout(false)
+      m_bWriteCOGLayout(false),
+      m_bBlockPrefetch(
+          CPLTestBool(CPLGetConfigOption("GTIFF_BLOCK_PREFETCH", "YES")))
 {
     // CPLDebug("GDAL", "sizeof(GTiffDataset) = %d bytes", static_cast<int>(
     //     sizeof(GTiffDataset)));
@@ -677,14 +679,28 @@ CPLErr GTiffDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         }
     }
 
-    if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
-        ++m_nJPEGOverviewVisibilityCounter;
-    const CPLErr eErr = GDALPamDataset::IRasterIO(
-        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
-        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
-        psExtraArg);
-    if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
-        m_nJPEGOverviewVisibilityCounter--;
+    const int nErr =
+        (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize)
+            ? ReadInterleavedBlocksDirect(nXOff, nYOff, nXSize, nYSize, pData,
+                                          eBufType, nBandCount, panBandMap,
+                                          nPixelSpace, nLineSpace, nBandSpace)
+            : -1;
+    CPLErr eErr;
+    if (nErr >= 0)
+    {
+        eErr = static_cast<CPLErr>(nErr);
+    }
+    else
+    {
+        if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+            ++m_nJPEGOverviewVisibilityCounter;
+        eErr = GDALPamDataset::IRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+            eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace,
+            nBandSpace, psExtraArg);
+        if (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour)
+            m_nJPEGOverviewVisibilityCounter--;
+    }
 
     if (pBufferedData)
     {
@@ -34,6 +34,7 @@
 
 #include <mutex>
 #include <queue>
+#include <vector>
 
 #include "cpl_mem_cache.h"
 #include "cpl_worker_thread_pool.h"  // CPLJobQueue, CPLWorkerThreadPool
@@ -170,6 +171,20 @@ class GTiffDataset final : public GDALPamDataset
     lru11::Cache<int, std::pair<vsi_l_offset, vsi_l_offset>>
         m_oCacheStrileToOffsetByteCount{1024};
 
+    // Location in the file of the Strip/TileOffsets (index 0) and
+    // Strip/TileByteCounts (index 1) arrays, used by PrefetchStrileArrays()
+    struct StrileArrayLocation
+    {
+        vsi_l_offset nOffset = 0;  // 0 if the array is inlined in the IFD
+        uint64_t nCount = 0;
+        int nEltSize = 0;
+    };
+
+    StrileArrayLocation m_asStrileArrayLocation[2]{};
+    bool m_bStrileArraysLocationRead = false;
+    bool m_bStrileArraysPrefetched = false;
+    std::vector<GByte> m_abyStrileArraysPrefetch{};
+
     MaskOffset *m_panMaskOffsetLsb = nullptr;
     char *m_pszVertUnit = nullptr;
     char *m_pszFilename = nullptr;
@@ -314,6 +329,7 @@ class GTiffDataset final : public GDALPamDataset
     bool m_bWriteKnownIncompatibleEdition : 1;
     bool m_bHasUsedReadEncodedAPI : 1;  // for debugging
     bool m_bWriteCOGLayout : 1;
+    bool m_bBlockPrefetch : 1;
 
     void ScanDirectories();
     bool ReadStrile(int nBlockId, void *pOutputBuffer,
@@ -339,6 +355,12 @@ class GTiffDataset final : public GDALPamDataset
                           vsi_l_offset *pnSize = nullptr,
                           bool *pbErrOccurred = nullptr);
 
+    bool ReadStrileArraysLocation();
+    bool PrefetchStrileArrays(int nBlockXStart, int nBlockYStart,
+                              int nBlockXEnd, int nBlockYEnd, int nBandCount,
+                              const int *panBandMap);
+    void ReleaseStrileArraysPrefetch();
+
     void ApplyPamInfo();
     void PushMetadataToPam();
 
@@ -358,6 +380,7 @@ class GTiffDataset final : public GDALPamDataset
     CPLErr FillEmptyTiles();
 
     CPLErr FlushDirectory();
+    void PersistDirtyRegions();
     CPLErr CleanOverviews();
 
     void LoadMetadata();
@@ -436,9 +459,18 @@ class GTiffDataset final : public GDALPamDataset
     static CPLErr CopyImageryAndMask(GTiffDataset *poDstDS,
                                      GDALDataset *poSrcDS,
                                      GDALRasterBand *poSrcMaskBand,
+                                     GTiffDataset *poSrcRawDS,
+                                     int nSrcRawXOff, int nSrcRawYOff,
                                      GDALProgressFunc pfnProgress,
                                      void *pProgressData);
 
+    static bool CanCopyRawTiles(GTiffDataset *poSrcDS, int nSrcXOff,
+                                int nSrcYOff, GTiffDataset *poDstDS);
+
+    static GTiffDataset *GetRawTilesSourceDataset(GDALDataset *poSrcDS,
+                                                  CSLConstList papszOptions,
+                                                  int &nSrcXOff, int &nSrcYOff);
+
     bool GetOverviewParameters(int &nCompression, uint16_t &nPlanarConfig,
                                uint16_t &nPredictor, uint16_t &nPhotometric,
                                int &nOvrJpegQuality, std::string &osNoData,
@@ -478,6 +510,12 @@ class GTiffDataset final : public GDALPamDataset
                              void *pData, GDALDataType eBufType, int nBandCount,
                              const int *panBandMap, GSpacing nPixelSpace,
                              GSpacing nLineSpace, GSpacing nBandSpace);
+    int ReadInterleavedBlocksDirect(int nXOff, int nYOff, int nXSize,
+                                    int nYSize, void *pData,
+                                    GDALDataType eBufType, int nBandCount,
+                                    const int *panBandMap,
+                                    GSpacing nPixelSpace, GSpacing nLineSpace,
+                                    GSpacing nBandSpace);
 
     virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                              int nXSize, int nYSize, void *pData, int nBufXSize,
@@ -530,6 +568,9 @@ class GTiffDataset final : public GDALPamDataset
                                         const char *pszDomain = "") override;
     virtual void *GetInternalHandle(const char *) override;
 
+    std::vector<GDALRasterWindow> GetDirtyRegions() override;
+    void ClearDirtyRegions() override;
+
     virtual CPLErr CreateMaskBand(int nFlags) override;
 
     bool GetRawBinaryLayout(GDALDataset::RawBinaryLayout &) override;
@@ -963,6 +963,307 @@ static void CPL_STDCALL ThreadDecompressionFuncErrorHandler(
     }
 }
 
+/************************************************************************/
+/*                      ReadStrileArraysLocation()                      */
+/*                                                                      */
+/*      Parse the current IFD to find where the Strip/TileOffsets and   */
+/*      Strip/TileByteCounts arrays are located.                        */
+/************************************************************************/
+
+bool GTiffDataset::ReadStrileArraysLocation()
+{
+    if (m_bStrileArraysLocationRead)
+        return m_asStrileArrayLocation[0].nEltSize != 0;
+    m_bStrileArraysLocationRead = true;
+    if (!SetDirectory())
+        return false;
+
+    VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF));
+    const bool bBigTIFF = CPL_TO_BOOL(TIFFIsBigTIFF(m_hTIFF));
+    const bool bSwab = CPL_TO_BOOL(TIFFIsByteSwapped(m_hTIFF));
+    const int nCountSize = bBigTIFF ? 8 : 2;
+    const int nEntrySize = bBigTIFF ? 20 : 12;
+    const int nValueSize = bBigTIFF ? 8 : 4;
+
+    const vsi_l_offset nCurOffset = VSIFTellL(fp);
+    GByte abyCount[8] = {0};
+    uint64_t nEntries = 0;
+    if (VSIFSeekL(fp, m_nDirOffset, SEEK_SET) != 0 ||
+        VSIFReadL(abyCount, 1, nCountSize, fp) !=
+            static_cast<size_t>(nCountSize))
+    {
+        VSIFSeekL(fp, nCurOffset, SEEK_SET);
+        return false;
+    }
+    if (bBigTIFF)
+    {
+        memcpy(&nEntries, abyCount, sizeof(nEntries));
+        if (bSwab)
+            CPL_SWAP64PTR(&nEntries);
+    }
+    else
+    {
+        uint16_t nEntries16;
+        memcpy(&nEntries16, abyCount, sizeof(nEntries16));
+        if (bSwab)
+            CPL_SWAP16PTR(&nEntries16);
+        nEntries = nEntries16;
+    }
+    if (nEntries == 0 || nEntries > 65535)
+    {
+        VSIFSeekL(fp, nCurOffset, SEEK_SET);
+        return false;
+    }
+    std::vector<GByte> abyIFD(static_cast<size_t>(nEntries) * nEntrySize);
+    const bool bReadOK =
+        VSIFReadL(abyIFD.data(), 1, abyIFD.size(), fp) == abyIFD.size();
+    VSIFSeekL(fp, nCurOffset, SEEK_SET);
+    if (!bReadOK)
+        return false;
+
+    const bool bIsTiled = CPL_TO_BOOL(TIFFIsTiled(m_hTIFF));
+    const uint16_t anTags[2] = {
+        static_cast<uint16_t>(bIsTiled ? TIFFTAG_TILEOFFSETS
+                                       : TIFFTAG_STRIPOFFSETS),
+        static_cast<uint16_t>(bIsTiled ? TIFFTAG_TILEBYTECOUNTS
+                                       : TIFFTAG_STRIPBYTECOUNTS)};
+    StrileArrayLocation asLocation[2];
+    for (size_t i = 0; i < static_cast<size_t>(nEntries); ++i)
+    {
+        const GByte *pabyEntry = abyIFD.data() + i * nEntrySize;
+        uint16_t nTag;
+        uint16_t nType;
+        memcpy(&nTag, pabyEntry, sizeof(nTag));
+        memcpy(&nType, pabyEntry + 2, sizeof(nType));
+        if (bSwab)
+        {
+            CPL_SWAP16PTR(&nTag);
+            CPL_SWAP16PTR(&nType);
+        }
+        const int iArray = nTag == anTags[0] ? 0 : nTag == anTags[1] ? 1 : -1;
+        if (iArray < 0)
+            continue;
+
+        uint64_t nCount;
+        uint64_t nValue;
+        if (bBigTIFF)
+        {
+            memcpy(&nCount, pabyEntry + 4, sizeof(nCount));
+            memcpy(&nValue, pabyEntry + 12, sizeof(nValue));
+            if (bSwab)
+            {
+                CPL_SWAP64PTR(&nCount);
+                CPL_SWAP64PTR(&nValue);
+            }
+        }
+        else
+        {
+            uint32_t nCount32;
+            uint32_t nValue32;
+            memcpy(&nCount32, pabyEntry + 4, sizeof(nCount32));
+            memcpy(&nValue32, pabyEntry + 8, sizeof(nValue32));
+            if (bSwab)
+            {
+                CPL_SWAP32PTR(&nCount32);
+                CPL_SWAP32PTR(&nValue32);
+            }
+            nCount = nCount32;
+            nValue = nValue32;
+        }
+
+        int nEltSize = 0;
+        if (nType == TIFF_SHORT)
+            nEltSize = 2;
+        else if (nType == TIFF_LONG)
+            nEltSize = 4;
+        else if (nType == TIFF_LONG8 || nType == TIFF_SLONG8)
+            nEltSize = 8;
+        if (nEltSize == 0 || nCount == 0 ||
+            nCount > std::numeric_limits<uint64_t>::max() / nEltSize)
+            return false;
+
+        asLocation[iArray].nEltSize = nEltSize;
+        asLocation[iArray].nCount = nCount;
+        // Arrays that fit in the IFD entry are already known by libtiff.
+        asLocation[iArray].nOffset =
+            nCount * nEltSize <= static_cast<uint64_t>(nValueSize) ? 0
+                                                                   : nValue;
+    }
+    if (asLocation[0].nEltSize == 0 || asLocation[1].nEltSize == 0)
+        return false;
+
+    m_asStrileArrayLocation[0] = asLocation[0];
+    m_asStrileArrayLocation[1] = asLocation[1];
+    return true;
+}
+
+/************************************************************************/
+/*                        PrefetchStrileArrays()                        */
+/*                                                                      */
+/*      With deferred strile loading, libtiff reads the offset and      */
+/*      bytecount arrays by 4 KB pages, one strile at a time.  For a    */
+/*      window spanning many tile rows, this results in many small      */
+/*      sequential reads, which is costly on network file systems.      */
+/*      This method fetches the pages covering the striles of the       */
+/*      window with a single VSIFReadMultiRangeL() call, and exposes    */
+/*      them to libtiff as cached ranges, until                         */
+/*      ReleaseStrileArraysPrefetch() is called.                        */
+/*                                                                      */
+/*      Returns true if cached ranges have been installed.              */
+/************************************************************************/
+
+bool GTiffDataset::PrefetchStrileArrays(int nBlockXStart, int nBlockYStart,
+                                        int nBlockXEnd, int nBlockYEnd,
+                                        int nBandCount, const int *panBandMap)
+{
+    if (m_bStrileArraysPrefetched || eAccess != GA_ReadOnly ||
+        m_bStreamingIn ||
+        VSI_TIFFHasCachedRanges(TIFFClientdata(m_hTIFF)) ||
+        !CPLTestBool(CPLGetConfigOption("GTIFF_USE_DEFER_STRILE_LOADING",
+                                        "YES")) ||
+        !CPLTestBool(
+            CPLGetConfigOption("GTIFF_STRILE_ARRAYS_PREFETCH", "YES")) ||
+        !ReadStrileArraysLocation())
+    {
+        return false;
+    }
+
+    // Must be consistent with IO_CACHE_PAGE_SIZE of libtiff
+    // _TIFFPartialReadStripArray()
+    constexpr vsi_l_offset PAGE_SIZE = 4096;
+    if (m_nPlanarConfig == PLANARCONFIG_CONTIG)
+        nBandCount = 1;
+
+    std::vector<std::pair<vsi_l_offset, vsi_l_offset>> aoRanges;
+    for (const auto &sLocation : m_asStrileArrayLocation)
+    {
+        if (sLocation.nOffset == 0)
+            continue;
+        const vsi_l_offset nArrayEnd =
+            sLocation.nOffset + sLocation.nCount * sLocation.nEltSize;
+        for (int iBand = 0; iBand < nBandCount; ++iBand)
+        {
+            const int nBandOffset =
+                m_nPlanarConfig == PLANARCONFIG_SEPARATE
+                    ? (panBandMap[iBand] - 1) * m_nBlocksPerBand
+                    : 0;
+            for (int iY = nBlockYStart; iY <= nBlockYEnd; ++iY)
+            {
+                const uint64_t nFirst = static_cast<uint64_t>(nBandOffset) +
+                                        iY * m_nBlocksPerRow + nBlockXStart;
+                // Include the strile following the last one, since the
+                // optimized retrieval of COG tile sizes uses its offset.
+                const uint64_t nLast = std::min<uint64_t>(
+                    static_cast<uint64_t>(nBandOffset) + iY * m_nBlocksPerRow +
+                        nBlockXEnd + 1,
+                    sLocation.nCount - 1);
+                if (nFirst > nLast)
+                    continue;
+                const vsi_l_offset nStart =
+                    sLocation.nOffset + nFirst * sLocation.nEltSize;
+                const vsi_l_offset nEnd =
+                    sLocation.nOffset + (nLast + 1) * sLocation.nEltSize;
+                aoRanges.emplace_back(
+                    (nStart / PAGE_SIZE) * PAGE_SIZE,
+                    std::min(nArrayEnd,
+                             ((nEnd + PAGE_SIZE - 1) / PAGE_SIZE) * PAGE_SIZE));
+            }
+        }
+    }
+    if (aoRanges.empty())
+        return false;
+
+    // Merge overlapping or contiguous ranges, as
+    // VSI_TIFFGetCachedRange() only serves reads fully contained in a single
+    // range, and requires sorted non-overlapping ranges.
+    std::sort(aoRanges.begin(), aoRanges.end());
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    // Upper bound on the amount of memory used for the prefetch
+    constexpr size_t MAX_PREFETCH_SIZE = 10 * 1024 * 1024;
+    size_t nTotalSize = 0;
+    vsi_l_offset nCurStart = aoRanges[0].first;
+    vsi_l_offset nCurEnd = aoRanges[0].second;
+    const auto AddRange = [&]()
+    {
+        const size_t nSize = static_cast<size_t>(nCurEnd - nCurStart);
+        if (nTotalSize + nSize > MAX_PREFETCH_SIZE)
+            return false;
+        anOffsets.push_back(nCurStart);
+        anSizes.push_back(nSize);
+        nTotalSize += nSize;
+        return true;
+    };
+    bool bGoOn = true;
+    for (size_t i = 1; bGoOn && i < aoRanges.size(); ++i)
+    {
+        if (aoRanges[i].first <= nCurEnd)
+        {
+            nCurEnd = std::max(nCurEnd, aoRanges[i].second);
+        }
+        else
+        {
+            bGoOn = AddRange();
+            nCurStart = aoRanges[i].first;
+            nCurEnd = aoRanges[i].second;
+        }
+    }
+    if (bGoOn)
+        AddRange();
+
+    // Not worth it: libtiff would not need more read calls than that.
+    if (nTotalSize <= 2 * PAGE_SIZE)
+        return false;
+
+    m_abyStrileArraysPrefetch.resize(nTotalSize);
+    std::vector<void *> apData;
+    size_t nAccSize = 0;
+    for (size_t nSize : anSizes)
+    {
+        apData.push_back(m_abyStrileArraysPrefetch.data() + nAccSize);
+        nAccSize += nSize;
+    }
+
+    VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF));
+    const vsi_l_offset nCurOffset = VSIFTellL(fp);
+    const int nRet = VSIFReadMultiRangeL(static_cast<int>(anSizes.size()),
+                                         apData.data(), anOffsets.data(),
+                                         anSizes.data(), fp);
+    VSIFSeekL(fp, nCurOffset, SEEK_SET);
+    if (nRet != 0)
+    {
+        CPLDebug("GTiff", "Prefetching of strile arrays failed");
+        m_abyStrileArraysPrefetch.clear();
+        return false;
+    }
+
+    CPLDebugOnly("GTiff",
+                 "Prefetched %d range(s) of strile arrays, %d bytes in total",
+                 static_cast<int>(anSizes.size()),
+                 static_cast<int>(nTotalSize));
+    VSI_TIFFSetCachedRanges(TIFFClientdata(m_hTIFF),
+                            static_cast<int>(anSizes.size()), apData.data(),
+                            anOffsets.data(), anSizes.data());
+    m_bStrileArraysPrefetched = true;
+    return true;
+}
+
+/************************************************************************/
+/*                     ReleaseStrileArraysPrefetch()                    */
+/************************************************************************/
+
+void GTiffDataset::ReleaseStrileArraysPrefetch()
+{
+    if (m_bStrileArraysPrefetched)
+    {
+        m_bStrileArraysPrefetched = false;
+        VSI_TIFFSetCachedRanges(TIFFClientdata(m_hTIFF), 0, nullptr, nullptr,
+                                nullptr);
+        m_abyStrileArraysPrefetch.clear();
+        m_abyStrileArraysPrefetch.shrink_to_fit();
+    }
+}
+
 /************************************************************************/
 /*                    IsMultiThreadedReadCompatible()                   */
 /************************************************************************/
@@ -1277,6 +1578,8 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
     const size_t nAdviseReadTotalBytesLimit =
         sContext.poHandle->GetAdviseReadTotalBytesLimit();
     size_t nAdviseReadAccBytes = 0;
+    PrefetchStrileArrays(nBlockXStart, nBlockYStart, nBlockXEnd, nBlockYEnd,
+                         nBandCount, panBandMap);
     for (int y = 0; y < nYBlocks; ++y)
     {
         for (int x = 0; x < nXBlocks; ++x)
@@ -1410,6 +1713,7 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
                         anOffsets.clear();
                         anSizes.clear();
                         poQueue.reset();
+                        ReleaseStrileArraysPrefetch();
 
                         CPLErr eErr = MultiThreadedRead(
                             nXOff, nYOff, nXSize, nYOff2 - nYOff, pData,
@@ -1435,6 +1739,7 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
             }
         }
     }
+    ReleaseStrileArraysPrefetch();
 
     if (sContext.bSuccess)
     {
@@ -1470,6 +1775,126 @@ CPLErr GTiffDataset::MultiThreadedRead(int nXOff, int nYOff, int nXSize,
     return sContext.bSuccess ? CE_None : CE_Failure;
 }
 
+/************************************************************************/
+/*                     ReadInterleavedBlocksDirect()                    */
+/************************************************************************/
+
+// Read optimization for reading whole blocks of all bands of a
+// pixel-interleaved file: each block is decoded once in m_pabyBlockBuf and
+// deinterleaved directly into the output buffer, instead of being split into
+// the block cache of each band, which would multiply the cache footprint by
+// the number of bands.
+// We require the block cache to be non instantiated, so that there is no
+// cached (and possibly more recent) block to take into account.
+// Returns -1 if the optimization cannot be applied, or a CPLErr otherwise.
+int GTiffDataset::ReadInterleavedBlocksDirect(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+    GDALDataType eBufType, int nBandCount, const int *panBandMap,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace)
+{
+    const auto eDataType = papoBands[0]->GetRasterDataType();
+    if (eAccess != GA_ReadOnly || nBands == 1 ||
+        m_nPlanarConfig != PLANARCONFIG_CONTIG || m_bStreamingIn ||
+        m_bDebugDontWriteBlocks || nBandCount != nBands ||
+        // Could be extended to "odd bit" case, but more work
+        m_nBitsPerSample != GDALGetDataTypeSize(eDataType) ||
+        (nXOff % m_nBlockXSize) != 0 || (nYOff % m_nBlockYSize) != 0 ||
+        !(nXOff + nXSize == nRasterXSize || (nXSize % m_nBlockXSize) == 0) ||
+        !(nYOff + nYSize == nRasterYSize || (nYSize % m_nBlockYSize) == 0))
+    {
+        return -1;
+    }
+
+    bool bOrderedBands = true;
+    for (int i = 0; i < nBands; ++i)
+    {
+        if (panBandMap[i] != i + 1)
+            bOrderedBands = false;
+        const auto poBand = cpl::down_cast<GTiffRasterBand *>(papoBands[i]);
+        if (!poBand->IsBaseGTiffClass() || poBand->HasBlockCache())
+            return -1;
+    }
+
+    const int nYBlockStart = nYOff / m_nBlockYSize;
+    const int nYBlockEnd = 1 + (nYOff + nYSize - 1) / m_nBlockYSize;
+    const int nXBlockStart = nXOff / m_nBlockXSize;
+    const int nXBlockEnd = 1 + (nXOff + nXSize - 1) / m_nBlockXSize;
+    const auto poFirstBand = cpl::down_cast<GTiffRasterBand *>(papoBands[0]);
+
+    // Missing blocks must be filled with the nodata value, which is done by
+    // the regular code path.
+    for (int nYBlock = nYBlockStart; nYBlock < nYBlockEnd; ++nYBlock)
+    {
+        for (int nXBlock = nXBlockStart; nXBlock < nXBlockEnd; ++nXBlock)
+        {
+            const int nBlockId = poFirstBand->ComputeBlockId(nXBlock, nYBlock);
+            if (nBlockId != m_nLoadedBlock && !IsBlockAvailable(nBlockId))
+                return -1;
+        }
+    }
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const int nBufDTSize = GDALGetDataTypeSizeBytes(eBufType);
+    const size_t nSrcLineSize =
+        static_cast<size_t>(m_nBlockXSize) * nBands * nDTSize;
+    std::vector<void *> apDstBuffers(nBands);
+    for (int nYBlock = nYBlockStart; nYBlock < nYBlockEnd; ++nYBlock)
+    {
+        const int nValidY =
+            std::min(m_nBlockYSize, nRasterYSize - nYBlock * m_nBlockYSize);
+        for (int nXBlock = nXBlockStart; nXBlock < nXBlockEnd; ++nXBlock)
+        {
+            const int nValidX =
+                std::min(m_nBlockXSize, nRasterXSize - nXBlock * m_nBlockXSize);
+            const int nBlockId = poFirstBand->ComputeBlockId(nXBlock, nYBlock);
+            if (LoadBlockBuf(nBlockId) != CE_None)
+                return CE_Failure;
+
+            GByte *pabyDstData =
+                static_cast<GByte *>(pData) +
+                static_cast<size_t>(nYBlock - nYBlockStart) * m_nBlockYSize *
+                    nLineSpace +
+                static_cast<size_t>(nXBlock - nXBlockStart) * m_nBlockXSize *
+                    nPixelSpace;
+            for (int iY = 0; iY < nValidY; ++iY)
+            {
+                const GByte *pabySrc = m_pabyBlockBuf + iY * nSrcLineSize;
+                GByte *pabyDst = pabyDstData + iY * nLineSpace;
+                if (bOrderedBands && nBandSpace == nBufDTSize &&
+                    nPixelSpace == nBands * nBandSpace)
+                {
+                    // Output buffer is pixel interleaved
+                    GDALCopyWords64(pabySrc, eDataType, nDTSize, pabyDst,
+                                    eBufType, nBufDTSize,
+                                    static_cast<GPtrDiff_t>(nValidX) * nBands);
+                }
+                else if (bOrderedBands && nPixelSpace == nBufDTSize)
+                {
+                    // Output buffer is band sequential
+                    for (int iBand = 0; iBand < nBands; ++iBand)
+                        apDstBuffers[iBand] = pabyDst + iBand * nBandSpace;
+                    GDALDeinterleave(pabySrc, eDataType, nBands,
+                                     apDstBuffers.data(), eBufType, nValidX);
+                }
+                else
+                {
+                    // "Random" spacing for output buffer
+                    for (int iBand = 0; iBand < nBands; ++iBand)
+                    {
+                        GDALCopyWords64(
+                            pabySrc + (panBandMap[iBand] - 1) * nDTSize,
+                            eDataType, nDTSize * nBands,
+                            pabyDst + iBand * nBandSpace, eBufType,
+                            static_cast<int>(nPixelSpace), nValidX);
+                    }
+                }
+            }
+        }
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                        FetchBufferVirtualMemIO                       */
 /************************************************************************/
@@ -3955,6 +4380,13 @@ GDALDataset *GTiffDataset::Open(GDALOpenInfo *poOpenInfo)
     poDS->InitCreationOrOpenOptions(poOpenInfo->eAccess == GA_Update,
                                     poOpenInfo->papszOpenOptions);
 
+    if (poOpenInfo->eAccess == GA_Update &&
+        CPLFetchBool(poOpenInfo->papszOpenOptions, "TRACK_DIRTY_REGIONS",
+                     false))
+    {
+        poDS->EnableDirtyRegionTracking();
+    }
+
     poDS->m_bLoadPam = true;
     poDS->m_bColorProfileMetadataChanged = false;
     poDS->m_bMetadataChanged = false;
@@ -6302,6 +6734,32 @@ char **GTiffDataset::GetMetadata(const char *pszDomain)
     return m_oGTiffMDMD.GetMetadata(pszDomain);
 }
 
+/************************************************************************/
+/*                          GetDirtyRegions()                           */
+/************************************************************************/
+
+std::vector<GDALRasterWindow> GTiffDataset::GetDirtyRegions()
+{
+    std::vector<GDALRasterWindow> aoRegions;
+    const char *pszWindows =
+        m_poBaseDS ? nullptr : GetMetadataItem("WINDOWS", "DIRTY_REGIONS");
+    if (pszWindows && !GDALParseRasterWindows(pszWindows, aoRegions))
+    {
+        ReportError(CE_Warning, CPLE_AppDefined,
+                    "Invalid value for DIRTY_REGIONS metadata: %s. "
+                    "Considering the whole raster as modified",
+                    pszWindows);
+        aoRegions.resize(1);
+        aoRegions[0].nXOff = 0;
+        aoRegions[0].nYOff = 0;
+        aoRegions[0].nXSize = nRasterXSize;
+        aoRegions[0].nYSize = nRasterYSize;
+    }
+    for (const auto &oRegion : GDALDataset::GetDirtyRegions())
+        aoRegions.push_back(oRegion);
+    return aoRegions;
+}
+
 /************************************************************************/
 /*                          GetMetadataItem()                           */
 /************************************************************************/
@@ -60,6 +60,7 @@
 #include "quant_table_md5sum_jpeg9e.h"
 #include "tif_jxl.h"
 #include "tifvsi.h"
+#include "vrt/vrtdataset.h"
 #include "xtiffio.h"
 
 #if LIFFLIB_VERSION > 20230908 || defined(INTERNAL_LIBTIFF)
@@ -915,7 +916,10 @@ void GTiffDataset::InitCompressionThreads(bool bUpdateMode,
             nThreads = 1024;  // to please Coverity
         if (nThreads > 1)
         {
-            if ((bUpdateMode && m_nCompression != COMPRESSION_NONE) ||
+            // In update mode, a compression queue is also useful for
+            // uncompressed datasets, since their internal overviews and mask
+            // may be compressed.
+            if (bUpdateMode ||
                 (nBands >= 1 && IsMultiThreadedReadCompatible()))
             {
                 CPLDebug("GTiff",
@@ -2249,6 +2253,8 @@ CPLErr GTiffDataset::FlushDirectory()
 
     if (eAccess == GA_Update)
     {
+        PersistDirtyRegions();
+
         if (m_bMetadataChanged)
         {
             m_bNeedsRewrite =
@@ -3083,6 +3089,16 @@ CPLErr GTiffDataset::IBuildOverviews(const char *pszResampling, int nOverviews,
 
     CPLErr eErr = CE_None;
 
+    /* -------------------------------------------------------------------- */
+    /*      Honour NUM_THREADS for the compression of the overviews and of  */
+    /*      their mask, even if the dataset was not opened with it.         */
+    /* -------------------------------------------------------------------- */
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    if (pszNumThreads && !m_poCompressQueue)
+        InitCompressionThreads(true, papszOptions);
+    CPLConfigOptionSetter oNumThreadsSetter("GDAL_NUM_THREADS", pszNumThreads,
+                                            true);
+
     /* -------------------------------------------------------------------- */
     /*      Initialize progress counter.                                    */
     /* -------------------------------------------------------------------- */
@@ -6459,18 +6475,209 @@ GDALDataset *GTiffDataset::Create(const char *pszFilename, int nXSize,
     return poDS;
 }
 
+/************************************************************************/
+/*                           CanCopyRawTiles()                          */
+/************************************************************************/
+
+// Returns whether the compressed tiles of poSrcDS, starting at pixel
+// (nSrcXOff, nSrcYOff), can be written as they are in poDstDS, that is if
+// they would be encoded the same way.
+bool GTiffDataset::CanCopyRawTiles(GTiffDataset *poSrcDS, int nSrcXOff,
+                                   int nSrcYOff, GTiffDataset *poDstDS)
+{
+    if (poSrcDS->GetAccess() != GA_ReadOnly || !poSrcDS->SetDirectory() ||
+        !poDstDS->SetDirectory())
+        return false;
+    TIFF *hSrcTIFF = poSrcDS->m_hTIFF;
+    TIFF *hDstTIFF = poDstDS->m_hTIFF;
+    if (!TIFFIsTiled(hSrcTIFF) || !TIFFIsTiled(hDstTIFF) ||
+        TIFFIsByteSwapped(hSrcTIFF) != TIFFIsByteSwapped(hDstTIFF) ||
+        poDstDS->m_poMaskDS != nullptr ||
+        poSrcDS->m_nBlockXSize != poDstDS->m_nBlockXSize ||
+        poSrcDS->m_nBlockYSize != poDstDS->m_nBlockYSize ||
+        (nSrcXOff % poSrcDS->m_nBlockXSize) != 0 ||
+        (nSrcYOff % poSrcDS->m_nBlockYSize) != 0 ||
+        nSrcXOff / poSrcDS->m_nBlockXSize + poDstDS->m_nBlocksPerRow >
+            poSrcDS->m_nBlocksPerRow ||
+        nSrcYOff / poSrcDS->m_nBlockYSize + poDstDS->m_nBlocksPerColumn >
+            poSrcDS->m_nBlocksPerColumn)
+    {
+        return false;
+    }
+
+    // The tiles of old-style JPEG cannot be written.
+    if (poDstDS->m_nCompression == COMPRESSION_OJPEG)
+    {
+        return false;
+    }
+
+    // JPEG tiles are made self-contained by inserting the JPEGTables of the
+    // source into them, but their color space must still be consistent with
+    // the tags of the target.
+    if (poDstDS->m_nCompression == COMPRESSION_JPEG)
+    {
+        if (poSrcDS->m_nPhotometric != poDstDS->m_nPhotometric)
+            return false;
+        if (poDstDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
+        {
+            uint16_t nSrcHorizSubsampling = 0;
+            uint16_t nSrcVertSubsampling = 0;
+            uint16_t nDstHorizSubsampling = 0;
+            uint16_t nDstVertSubsampling = 0;
+            if (!TIFFGetFieldDefaulted(hSrcTIFF, TIFFTAG_YCBCRSUBSAMPLING,
+                                       &nSrcHorizSubsampling,
+                                       &nSrcVertSubsampling) ||
+                !TIFFGetFieldDefaulted(hDstTIFF, TIFFTAG_YCBCRSUBSAMPLING,
+                                       &nDstHorizSubsampling,
+                                       &nDstVertSubsampling) ||
+                nSrcHorizSubsampling != nDstHorizSubsampling ||
+                nSrcVertSubsampling != nDstVertSubsampling)
+            {
+                return false;
+            }
+        }
+    }
+
+    for (const int nTag :
+         {TIFFTAG_COMPRESSION, TIFFTAG_BITSPERSAMPLE, TIFFTAG_SAMPLESPERPIXEL,
+          TIFFTAG_PLANARCONFIG, TIFFTAG_SAMPLEFORMAT, TIFFTAG_PREDICTOR})
+    {
+        uint16_t nSrcVal = 0;
+        uint16_t nDstVal = 0;
+        if (!TIFFGetFieldDefaulted(hSrcTIFF, nTag, &nSrcVal) ||
+            !TIFFGetFieldDefaulted(hDstTIFF, nTag, &nDstVal) ||
+            nSrcVal != nDstVal)
+        {
+            return false;
+        }
+    }
+    for (const int nTag : {TIFFTAG_TILEWIDTH, TIFFTAG_TILELENGTH})
+    {
+        uint32_t nSrcVal = 0;
+        uint32_t nDstVal = 0;
+        if (!TIFFGetField(hSrcTIFF, nTag, &nSrcVal) ||
+            !TIFFGetField(hDstTIFF, nTag, &nDstVal) || nSrcVal != nDstVal)
+        {
+            return false;
+        }
+    }
+
+    if (poDstDS->m_nCompression == COMPRESSION_LERC &&
+        (poSrcDS->m_anLercAddCompressionAndVersion[0] !=
+             poDstDS->m_anLercAddCompressionAndVersion[0] ||
+         poSrcDS->m_anLercAddCompressionAndVersion[1] !=
+             poDstDS->m_anLercAddCompressionAndVersion[1]))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                      GetRawTilesSourceDataset()                      */
+/************************************************************************/
+
+// Returns the GTiff dataset whose compressed tiles might be copied as they
+// are by CreateCopy() of poSrcDS: poSrcDS itself, or the GTiff dataset of
+// which poSrcDS is a VRT subset at full resolution, in which case
+// (nSrcXOff, nSrcYOff) is set to the offset of the subset. Whether the tiles
+// are actually compatible with the target is checked by CanCopyRawTiles().
+GTiffDataset *GTiffDataset::GetRawTilesSourceDataset(GDALDataset *poSrcDS,
+                                                     CSLConstList papszOptions,
+                                                     int &nSrcXOff,
+                                                     int &nSrcYOff)
+{
+    nSrcXOff = 0;
+    nSrcYOff = 0;
+    if (!CPLTestBool(CPLGetConfigOption("GTIFF_COPY_RAW_TILES", "YES")))
+        return nullptr;
+
+    // An explicit setting of the lossy compression parameters requires
+    // tiles to be re-encoded.
+    for (const char *pszKey :
+         {"JPEG_QUALITY", "WEBP_LEVEL", "WEBP_LOSSLESS", "MAX_Z_ERROR",
+          "MAX_Z_ERROR_OVERVIEW", "JXL_LOSSLESS", "JXL_DISTANCE",
+          "JXL_ALPHA_DISTANCE"})
+    {
+        if (CSLFetchNameValue(papszOptions, pszKey))
+            return nullptr;
+    }
+    for (const char *pszKey : {"JPEG_QUALITY_OVERVIEW", "WEBP_LEVEL_OVERVIEW"})
+    {
+        if (CPLGetConfigOption(pszKey, nullptr))
+            return nullptr;
+    }
+
+    GDALDataset *poUnderlyingDS = poSrcDS;
+    if (auto poVRTDS = dynamic_cast<VRTDataset *>(poSrcDS))
+    {
+        if (!poVRTDS->GetShiftedDataset(
+                0, 0, poSrcDS->GetRasterXSize(), poSrcDS->GetRasterYSize(),
+                poUnderlyingDS, nSrcXOff, nSrcYOff))
+        {
+            return nullptr;
+        }
+    }
+    return dynamic_cast<GTiffDataset *>(poUnderlyingDS);
+}
+
 /************************************************************************/
 /*                           CopyImageryAndMask()                       */
 /************************************************************************/
 
+// If poSrcRawDS is not null, it must be a GTiff dataset whose content,
+// starting at pixel (nSrcRawXOff, nSrcRawYOff), is the one of poSrcDS. Its
+// compressed tiles are copied without being decoded and re-encoded, when
+// they are compatible with poDstDS.
 CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                                         GDALDataset *poSrcDS,
                                         GDALRasterBand *poSrcMaskBand,
+                                        GTiffDataset *poSrcRawDS,
+                                        int nSrcRawXOff, int nSrcRawYOff,
                                         GDALProgressFunc pfnProgress,
                                         void *pProgressData)
 {
     CPLErr eErr = CE_None;
 
+    if (poSrcRawDS &&
+        !CanCopyRawTiles(poSrcRawDS, nSrcRawXOff, nSrcRawYOff, poDstDS))
+    {
+        CPLDebug("GTiff",
+                 "Compressed tiles of %s cannot be copied as they are",
+                 poSrcRawDS->GetDescription());
+        poSrcRawDS = nullptr;
+    }
+    else if (poSrcRawDS)
+    {
+        CPLDebug("GTiff", "Copying compressed tiles of %s",
+                 poSrcRawDS->GetDescription());
+    }
+    std::vector<GByte> abyRawTile;
+
+    // Abbreviated JPEG tiles are made self-contained by inserting the
+    // content of the JPEGTables tag of the source (without its SOI and EOI
+    // markers) after their SOI marker, as done by ReadCompressedData()
+    std::vector<GByte> abyJPEGTables;
+    if (poSrcRawDS && poSrcRawDS->m_nCompression == COMPRESSION_JPEG)
+    {
+        uint32_t nJPEGTablesSize = 0;
+        void *pJPEGTables = nullptr;
+        if (TIFFGetField(poSrcRawDS->m_hTIFF, TIFFTAG_JPEGTABLES,
+                         &nJPEGTablesSize, &pJPEGTables) &&
+            pJPEGTables != nullptr && nJPEGTablesSize > 4 &&
+            static_cast<GByte *>(pJPEGTables)[0] == 0xFF &&
+            static_cast<GByte *>(pJPEGTables)[1] == 0xD8 &&
+            static_cast<GByte *>(pJPEGTables)[nJPEGTablesSize - 2] == 0xFF &&
+            static_cast<GByte *>(pJPEGTables)[nJPEGTablesSize - 1] == 0xD9)
+        {
+            abyJPEGTables.assign(static_cast<GByte *>(pJPEGTables) + 2,
+                                 static_cast<GByte *>(pJPEGTables) +
+                                     nJPEGTablesSize - 2);
+        }
+    }
+    const size_t nJPEGTablesSize = abyJPEGTables.size();
+
     const auto eType = poDstDS->GetRasterBand(1)->GetRasterDataType();
     const int nDataTypeSize = GDALGetDataTypeSizeBytes(eType);
     const int l_nBands = poDstDS->GetRasterCount();
@@ -6511,6 +6718,71 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                  nXBlock++)
         {
             const int nReqXSize = std::min(nXSize - iX, poDstDS->m_nBlockXSize);
+
+            if (poSrcRawDS)
+            {
+                const int nSrcBlock =
+                    nSrcRawXOff / poSrcRawDS->m_nBlockXSize + nXBlock +
+                    (nSrcRawYOff / poSrcRawDS->m_nBlockYSize + nYBlock) *
+                        poSrcRawDS->m_nBlocksPerRow;
+                const vsi_l_offset nRawSize =
+                    poSrcRawDS->SetDirectory()
+                        ? TIFFGetStrileByteCount(poSrcRawDS->m_hTIFF,
+                                                 nSrcBlock)
+                        : 0;
+                if (nRawSize > 2 &&
+                    nRawSize + nJPEGTablesSize < static_cast<unsigned>(INT_MAX))
+                {
+                    bool bOK = true;
+                    try
+                    {
+                        abyRawTile.resize(static_cast<size_t>(nRawSize) +
+                                          nJPEGTablesSize);
+                    }
+                    catch (const std::exception &)
+                    {
+                        bOK = false;
+                    }
+                    if (bOK && TIFFReadRawTile(poSrcRawDS->m_hTIFF, nSrcBlock,
+                                               abyRawTile.data(),
+                                               static_cast<tmsize_t>(
+                                                   nRawSize)) ==
+                                   static_cast<tmsize_t>(nRawSize))
+                    {
+                        if (nJPEGTablesSize > 0)
+                        {
+                            memmove(abyRawTile.data() + 2 + nJPEGTablesSize,
+                                    abyRawTile.data() + 2,
+                                    static_cast<size_t>(nRawSize) - 2);
+                            memcpy(abyRawTile.data() + 2, abyJPEGTables.data(),
+                                   nJPEGTablesSize);
+                        }
+                        if (poDstDS->SetDirectory())
+                        {
+                            poDstDS->WriteRawStripOrTile(
+                                iBlock, abyRawTile.data(),
+                                static_cast<GPtrDiff_t>(abyRawTile.size()));
+                        }
+                        else
+                        {
+                            eErr = CE_Failure;
+                        }
+                        if (poDstDS->m_bWriteError)
+                            eErr = CE_Failure;
+
+                        iBlock++;
+                        if (pfnProgress &&
+                            !pfnProgress(static_cast<double>(iBlock) / nBlocks,
+                                         nullptr, pProgressData))
+                        {
+                            eErr = CE_Failure;
+                        }
+                        continue;
+                    }
+                }
+                // Sparse or unreadable tile: go through the regular path
+            }
+
             if (nReqXSize < poDstDS->m_nBlockXSize ||
                 nReqYSize < poDstDS->m_nBlockYSize)
             {
@@ -6532,6 +6804,10 @@ CPLErr GTiffDataset::CopyImageryAndMask(GTiffDataset *poDstDS,
                 {
                     eErr = poDstDS->WriteEncodedTileOrStrip(
                         iBlock, pBlockBuffer, false);
+                    // Make sure that tiles are written in order with the
+                    // ones written by WriteRawStripOrTile()
+                    if (eErr == CE_None && poSrcRawDS)
+                        poDstDS->WaitCompletionForBlock(iBlock);
                 }
             }
             else
@@ -6756,6 +7032,50 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
         }
     }
 
+    // Used by the COG driver in SINGLE_PASS mode: GTiff file with the full
+    // resolution imagery of poSrcDS, already encoded with the target
+    // settings, so that its tiles can be copied without re-encoding.
+    std::unique_ptr<GDALDataset> poBaseImageryDS;
+    const bool bRawCopyTiles =
+        CPLFetchBool(papszCreateOptions, "@RAW_COPY_TILES", false);
+    if (const char *pszBaseDS =
+            CSLFetchNameValue(papszCreateOptions, "@BASE_DATASET"))
+    {
+        poBaseImageryDS.reset(GDALDataset::Open(pszBaseDS, GDAL_OF_RASTER));
+        if (!poBaseImageryDS)
+        {
+            CSLDestroy(papszCreateOptions);
+            return nullptr;
+        }
+        if (poBaseImageryDS->GetRasterCount() != l_nBands ||
+            poBaseImageryDS->GetRasterXSize() != poSrcDS->GetRasterXSize() ||
+            poBaseImageryDS->GetRasterYSize() != poSrcDS->GetRasterYSize())
+        {
+            ReportError(pszFilename, CE_Failure, CPLE_AppDefined,
+                        "%s is not consistent with the source dataset",
+                        pszBaseDS);
+            CSLDestroy(papszCreateOptions);
+            return nullptr;
+        }
+    }
+
+    // GTiff dataset whose compressed tiles are copied without being decoded
+    // and re-encoded, when they are compatible with the target.
+    int nSrcRawXOff = 0;
+    int nSrcRawYOff = 0;
+    GTiffDataset *poSrcRawTilesDS = nullptr;
+    if (poBaseImageryDS)
+    {
+        if (bRawCopyTiles)
+            poSrcRawTilesDS =
+                dynamic_cast<GTiffDataset *>(poBaseImageryDS.get());
+    }
+    else
+    {
+        poSrcRawTilesDS = GetRawTilesSourceDataset(
+            poSrcDS, papszCreateOptions, nSrcRawXOff, nSrcRawYOff);
+    }
+
     double dfExtraSpaceForOverviews = 0;
     const bool bCopySrcOverviews =
         CPLFetchBool(papszCreateOptions, "COPY_SRC_OVERVIEWS", false);
@@ -8010,9 +8330,21 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
                         dfNextCurPixels / dfTotalPixels, pfnProgress,
                         pProgressData);
 
-                    eErr =
-                        CopyImageryAndMask(poDstDS, poSrcOvrDS, poSrcMaskBand,
-                                           GDALScaledProgress, pScaledData);
+                    GTiffDataset *poSrcRawDS = nullptr;
+                    if (bRawCopyTiles && poOvrDS)
+                    {
+                        poSrcRawDS = dynamic_cast<GTiffDataset *>(
+                            iOvrLevel == 0 ? poOvrDS.get()
+                                           : poSrcOvrBand->GetDataset());
+                    }
+                    else if (!poOvrDS && poSrcRawTilesDS == poSrcDS)
+                    {
+                        poSrcRawDS = dynamic_cast<GTiffDataset *>(
+                            poSrcOvrBand->GetDataset());
+                    }
+                    eErr = CopyImageryAndMask(
+                        poDstDS, poSrcOvrDS, poSrcMaskBand, poSrcRawDS, 0, 0,
+                        GDALScaledProgress, pScaledData);
 
                     dfCurPixels = dfNextCurPixels;
                     GDALDestroyScaledProgress(pScaledData);
@@ -8204,8 +8536,8 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
 #endif
         eErr == CE_None)
     {
-        const char *papszCopyWholeRasterOptions[3] = {nullptr, nullptr,
-                                                      nullptr};
+        const char *papszCopyWholeRasterOptions[4] = {nullptr, nullptr,
+                                                      nullptr, nullptr};
         int iNextOption = 0;
         papszCopyWholeRasterOptions[iNextOption++] = "SKIP_HOLES=YES";
         if (l_nCompression != COMPRESSION_NONE)
@@ -8219,6 +8551,18 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
             papszCopyWholeRasterOptions[iNextOption++] = "INTERLEAVE=BAND";
         }
 
+        // Also use NUM_THREADS to read thread-safe sources in parallel
+        std::string osNumThreadsOption;
+        const char *pszNumThreads =
+            CSLFetchNameValue(papszOptions, "NUM_THREADS");
+        if (pszNumThreads && !bStreaming)
+        {
+            osNumThreadsOption = "NUM_THREADS=";
+            osNumThreadsOption += pszNumThreads;
+            papszCopyWholeRasterOptions[iNextOption++] =
+                osNumThreadsOption.c_str();
+        }
+
         if (bCopySrcOverviews &&
             (l_nBands == 1 || poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG))
         {
@@ -8240,14 +8584,29 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
                                              pfnProgress, pProgressData);
             }
 
-            eErr = CopyImageryAndMask(poDS, poSrcDS,
-                                      poSrcDS->GetRasterBand(1)->GetMaskBand(),
-                                      GDALScaledProgress, pScaledData);
+            GDALDataset *poSrcImageryDS =
+                poBaseImageryDS ? poBaseImageryDS.get() : poSrcDS;
+            eErr = CopyImageryAndMask(
+                poDS, poSrcImageryDS,
+                poSrcImageryDS->GetRasterBand(1)->GetMaskBand(),
+                poSrcRawTilesDS, nSrcRawXOff, nSrcRawYOff, GDALScaledProgress,
+                pScaledData);
             if (poDS->m_poMaskDS)
             {
                 bWriteMask = false;
             }
         }
+        else if (poSrcRawTilesDS && !bStreaming &&
+                 (l_nBands == 1 ||
+                  poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG) &&
+                 CanCopyRawTiles(poSrcRawTilesDS, nSrcRawXOff, nSrcRawYOff,
+                                 poDS))
+        {
+            eErr = CopyImageryAndMask(
+                poDS, poSrcDS, poSrcDS->GetRasterBand(1)->GetMaskBand(),
+                poSrcRawTilesDS, nSrcRawXOff, nSrcRawYOff, GDALScaledProgress,
+                pScaledData);
+        }
         else
         {
             eErr = GDALDatasetCopyWholeRaster(
@@ -8649,6 +9008,72 @@ CPLErr GTiffDataset::SetMetadataItem(const char *pszName, const char *pszValue,
     return eErr;
 }
 
+/************************************************************************/
+/*                        PersistDirtyRegions()                         */
+/************************************************************************/
+
+// Append the regions modified during this session, when tracked with the
+// TRACK_DIRTY_REGIONS open option, to the ones stored in the WINDOWS item
+// of the DIRTY_REGIONS metadata domain.
+
+void GTiffDataset::PersistDirtyRegions()
+{
+    if (m_poBaseDS || !IsDirtyRegionTrackingEnabled())
+        return;
+
+    if (GDALDataset::GetDirtyRegions().empty())
+        return;
+
+    std::vector<GDALRasterWindow> aoRegions = GetDirtyRegions();
+    // Avoid the metadata item growing without bounds with scattered updates
+    constexpr size_t MAX_PERSISTED_REGIONS = 1000;
+    if (aoRegions.size() > MAX_PERSISTED_REGIONS)
+    {
+        int nMinX = nRasterXSize;
+        int nMinY = nRasterYSize;
+        int nMaxX = 0;
+        int nMaxY = 0;
+        for (const auto &oRegion : aoRegions)
+        {
+            nMinX = std::min(nMinX, oRegion.nXOff);
+            nMinY = std::min(nMinY, oRegion.nYOff);
+            nMaxX = std::max(nMaxX, oRegion.nXOff + oRegion.nXSize);
+            nMaxY = std::max(nMaxY, oRegion.nYOff + oRegion.nYSize);
+        }
+        aoRegions.resize(1);
+        aoRegions[0].nXOff = nMinX;
+        aoRegions[0].nYOff = nMinY;
+        aoRegions[0].nXSize = nMaxX - nMinX;
+        aoRegions[0].nYSize = nMaxY - nMinY;
+    }
+
+    SetMetadataItem("WINDOWS", GDALSerializeRasterWindows(aoRegions).c_str(),
+                    "DIRTY_REGIONS");
+    GDALDataset::ClearDirtyRegions();
+}
+
+/************************************************************************/
+/*                         ClearDirtyRegions()                          */
+/************************************************************************/
+
+void GTiffDataset::ClearDirtyRegions()
+{
+    GDALDataset::ClearDirtyRegions();
+    if (m_poBaseDS || !GetMetadataItem("WINDOWS", "DIRTY_REGIONS"))
+        return;
+
+    if (eAccess == GA_Update)
+    {
+        SetMetadataItem("WINDOWS", nullptr, "DIRTY_REGIONS");
+    }
+    else
+    {
+        ReportError(CE_Warning, CPLE_AppDefined,
+                    "Cannot clear the dirty regions of a dataset opened in "
+                    "read-only mode");
+    }
+}
+
 /************************************************************************/
 /*                         CreateMaskBand()                             */
 /************************************************************************/
@@ -58,6 +58,10 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     std::set<GTiffRasterBand **> m_aSetPSelf{};
     bool m_bHaveOffsetScale = false;
 
+    // State of the detection of sequential block reads by IReadBlock()
+    int m_nNextSequentialBlockId = -1;
+    int m_nPrefetchBlockCount = 0;
+
     int DirectIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
                  int nYSize, void *pData, int nBufXSize, int nBufYSize,
                  GDALDataType eBufType, GSpacing nPixelSpace,
@@ -89,6 +93,7 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
     void NullBlock(void *pData);
     CPLErr FillCacheForOtherBands(int nBlockXOff, int nBlockYOff);
     void CacheMaskForBlock(int nBlockXOff, int nBlockYOff);
+    void PrefetchNextBlocks(int nBlockXOff, int nBlockYOff);
     void ResetNoDataValues(bool bResetDatasetToo);
 
     int ComputeBlockId(int nBlockXOff, int nBlockYOff) const;
@@ -936,6 +936,8 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
         const unsigned int nMaxRawBlockCacheSize = atoi(
             CPLGetConfigOption("GDAL_MAX_RAW_BLOCK_CACHE_SIZE", "10485760"));
         bool bGoOn = true;
+        m_poGDS->PrefetchStrileArrays(nBlockX1, nBlockY1, nBlockX2, nBlockY2,
+                                      1, &nBand);
         for (int iY = nBlockY1; bGoOn && iY <= nBlockY2; iY++)
         {
             for (int iX = nBlockX1; bGoOn && iX <= nBlockX2; iX++)
@@ -989,6 +991,7 @@ void *GTiffRasterBand::CacheMultiRange(int nXOff, int nYOff, int nXSize,
                 }
             }
         }
+        m_poGDS->ReleaseStrileArraysPrefetch();
 
         std::sort(aOffsetSize.begin(), aOffsetSize.end());
 
@@ -1098,6 +1101,8 @@ int GTiffRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize,
     int nStatus = 0;
     VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(m_poGDS->m_hTIFF));
     GIntBig nPixelsData = 0;
+    m_poGDS->PrefetchStrileArrays(iXBlockStart, iYBlockStart, iXBlockEnd,
+                                  iYBlockEnd, 1, &nBand);
     for (int iY = iYBlockStart; iY <= iYBlockEnd; ++iY)
     {
         for (int iX = iXBlockStart; iX <= iXBlockEnd; ++iX)
@@ -1160,12 +1165,14 @@ int GTiffRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize,
             }
             if (nMaskFlagStop != 0 && (nMaskFlagStop & nStatus) != 0)
             {
+                m_poGDS->ReleaseStrileArraysPrefetch();
                 if (pdfDataPct)
                     *pdfDataPct = -1.0;
                 return nStatus;
             }
         }
     }
+    m_poGDS->ReleaseStrileArraysPrefetch();
     if (pdfDataPct)
         *pdfDataPct =
             100.0 * nPixelsData / (static_cast<GIntBig>(nXSize) * nYSize);
@@ -1343,9 +1350,137 @@ CPLErr GTiffRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff, void *pImage)
 
     CacheMaskForBlock(nBlockXOff, nBlockYOff);
 
+    if (eErr == CE_None)
+        PrefetchNextBlocks(nBlockXOff, nBlockYOff);
+
     return eErr;
 }
 
+/************************************************************************/
+/*                         PrefetchNextBlocks()                         */
+/************************************************************************/
+
+// Called by IReadBlock() once a block has been read. When blocks are
+// requested in row-major order, which is what block-based readers such as
+// GDALRasterBand::IRasterIO(), the warper or VRT sources do, decode the
+// following blocks of the block row (or of the strip column) in parallel
+// with MultiThreadedRead(), which stores them in the block cache. The number
+// of prefetched blocks doubles at each sequential hit, up to twice the
+// number of worker threads.
+void GTiffRasterBand::PrefetchNextBlocks(int nBlockXOff, int nBlockYOff)
+{
+    const int nBlockIdInBand = nBlockXOff + nBlockYOff * nBlocksPerRow;
+    const bool bSequential = nBlockIdInBand == m_nNextSequentialBlockId;
+    m_nNextSequentialBlockId = nBlockIdInBand + 1;
+    if (!bSequential)
+    {
+        m_nPrefetchBlockCount = 0;
+        return;
+    }
+
+    if (m_poGDS->m_poThreadPool == nullptr || !m_poGDS->m_bBlockPrefetch ||
+        m_poGDS->m_nDisableMultiThreadedRead != 0 ||
+        m_poGDS->m_bLoadingOtherBands || m_poGDS->m_bDirectIO ||
+        eAccess != GA_ReadOnly || !IsBaseGTiffClass() ||
+        !m_poGDS->IsMultiThreadedReadCompatible())
+    {
+        return;
+    }
+
+    int nXBlockEnd = nBlockXOff;
+    int nYBlockEnd = nBlockYOff;
+    int nMaxBlocks = 0;
+    bool bAlongColumn = false;
+    if (nBlockXOff + 1 < nBlocksPerRow)
+    {
+        ++nXBlockEnd;
+        nMaxBlocks = nBlocksPerRow - nXBlockEnd;
+    }
+    else if (nBlocksPerRow == 1 && nBlockYOff + 1 < nBlocksPerColumn)
+    {
+        ++nYBlockEnd;
+        nMaxBlocks = nBlocksPerColumn - nYBlockEnd;
+        bAlongColumn = true;
+    }
+    else
+    {
+        return;
+    }
+
+    // Do not prefetch again blocks that are already cached.
+    {
+        GDALRasterBlock *poBlock =
+            TryGetLockedBlockRef(nXBlockEnd, nYBlockEnd);
+        if (poBlock)
+        {
+            poBlock->DropLock();
+            return;
+        }
+    }
+
+    const bool bAllBands = m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG;
+    const int nBandCount = bAllBands ? m_poGDS->nBands : 1;
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const GIntBig nBytesPerBlock = static_cast<GIntBig>(nBlockXSize) *
+                                   nBlockYSize * nDTSize * nBandCount;
+
+    m_nPrefetchBlockCount =
+        std::min(m_nPrefetchBlockCount == 0 ? 2 : 2 * m_nPrefetchBlockCount,
+                 2 * m_poGDS->m_poThreadPool->GetThreadCount());
+    // Keep the prefetched blocks well below the block cache size, so they
+    // do not evict each other before being used.
+    const GIntBig nMaxBlocksInCache =
+        GDALGetCacheMax64() / (4 * std::max<GIntBig>(1, nBytesPerBlock));
+    const int nBlocks = static_cast<int>(std::min<GIntBig>(
+        std::min(m_nPrefetchBlockCount, nMaxBlocks), nMaxBlocksInCache));
+    if (nBlocks < 2)
+        return;
+
+    const int nXOff = nXBlockEnd * nBlockXSize;
+    const int nYOff = nYBlockEnd * nBlockYSize;
+    if (bAlongColumn)
+        nYBlockEnd += nBlocks - 1;
+    else
+        nXBlockEnd += nBlocks - 1;
+    const int nXSize =
+        std::min((nXBlockEnd + 1) * nBlockXSize, nRasterXSize) - nXOff;
+    const int nYSize =
+        std::min((nYBlockEnd + 1) * nBlockYSize, nRasterYSize) - nYOff;
+
+    // The decoded pixels are also copied into that buffer, which is
+    // discarded: what matters is that the blocks end up in the cache.
+    const size_t nBufSize =
+        static_cast<size_t>(nXSize) * nYSize * nDTSize * nBandCount;
+    GByte *pabyBuffer = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nBufSize));
+    if (pabyBuffer == nullptr)
+        return;
+
+    std::vector<int> anBandMap;
+    if (bAllBands)
+    {
+        for (int i = 1; i <= nBandCount; ++i)
+            anBandMap.push_back(i);
+    }
+    else
+    {
+        anBandMap.push_back(nBand);
+    }
+
+    {
+        // Errors will be reported if the blocks are actually requested.
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        const GSpacing nPixelSpace = nDTSize;
+        const GSpacing nLineSpace = nPixelSpace * nXSize;
+        const GSpacing nBandSpace = nLineSpace * nYSize;
+        CPL_IGNORE_RET_VAL(m_poGDS->MultiThreadedRead(
+            nXOff, nYOff, nXSize, nYSize, pabyBuffer, eDataType, nBandCount,
+            anBandMap.data(), nPixelSpace, nLineSpace, nBandSpace));
+    }
+    VSIFree(pabyBuffer);
+
+    m_nNextSequentialBlockId = nXBlockEnd + nYBlockEnd * nBlocksPerRow + 1;
+}
+
 /************************************************************************/
 /*                           CacheMaskForBlock()                       */
 /************************************************************************/
@@ -1598,6 +1733,21 @@ const char *GTiffRasterBand::GetMetadataItem(const char *pszName,
     {
         if (EQUAL(pszName, "HAS_BLOCK_CACHE"))
             return HasBlockCache() ? "1" : "0";
+
+        int nBlockXOff = 0;
+        int nBlockYOff = 0;
+        if (sscanf(pszName, "IS_BLOCK_CACHED_%d_%d", &nBlockXOff,
+                   &nBlockYOff) == 2)
+        {
+            if (nBlockXOff < 0 || nBlockXOff >= nBlocksPerRow ||
+                nBlockYOff < 0 || nBlockYOff >= nBlocksPerColumn)
+                return nullptr;
+            GDALRasterBlock *poBlock =
+                TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+            if (poBlock)
+                poBlock->DropLock();
+            return poBlock ? "1" : "0";
+        }
     }
 
     const char *pszRet = m_oGTiffMDMD.GetMetadataItem(pszName, pszDomain);
@@ -93,7 +93,8 @@ struct GDALTiffHandle
     GByte *abyWriteBuffer;
     int nWriteBufferSize;
 
-    // For pseudo-mmap'ed /vsimem/ file
+    // View of the whole file content, for read-only files whose file system
+    // can provide it (/vsimem/, memory mapped local files)
     vsi_l_offset nDataLength;
     void *pBase;
 
@@ -277,6 +278,11 @@ static toff_t _tiffSeekProc(thandle_t th, toff_t off, int whence)
 
 static void FreeGTH(GDALTiffHandle *psGTH)
 {
+    if (psGTH->pBase)
+    {
+        VSIFReleaseViewL(psGTH->psShared->fpL, psGTH->pBase,
+                         static_cast<size_t>(psGTH->nDataLength));
+    }
     psGTH->psShared->nUserCounter--;
     if (psGTH->psParent == nullptr)
     {
@@ -423,14 +429,27 @@ static void InitializeWriteBuffer(GDALTiffHandle *psGTH, const char *pszMode)
     bool bAllocBuffer = !bReadOnly;
     if (STARTS_WITH(psGTH->psShared->pszName, "/vsimem/"))
     {
-        if (bReadOnly &&
-            CPLTestBool(CPLGetConfigOption("GTIFF_USE_MMAP", "NO")))
+        bAllocBuffer = false;
+    }
+
+    // Let libtiff read strips and tiles directly from the file content
+    if (bReadOnly && CPLTestBool(CPLGetConfigOption("GTIFF_USE_MMAP", "NO")))
+    {
+        VSILFILE *fpL = psGTH->psShared->fpL;
+        const vsi_l_offset nCurOffset = VSIFTellL(fpL);
+        if (VSIFSeekL(fpL, 0, SEEK_END) == 0)
         {
-            psGTH->nDataLength = 0;
-            psGTH->pBase = VSIGetMemFileBuffer(psGTH->psShared->pszName,
-                                               &psGTH->nDataLength, FALSE);
+            const vsi_l_offset nFileSize = VSIFTellL(fpL);
+            if (nFileSize > 0 &&
+                nFileSize <= std::numeric_limits<size_t>::max())
+            {
+                psGTH->pBase = const_cast<void *>(
+                    VSIFAcquireViewL(fpL, 0, static_cast<size_t>(nFileSize)));
+                if (psGTH->pBase)
+                    psGTH->nDataLength = nFileSize;
+            }
         }
-        bAllocBuffer = false;
+        CPL_IGNORE_RET_VAL(VSIFSeekL(fpL, nCurOffset, SEEK_SET));
     }
 
     psGTH->abyWriteBuffer =
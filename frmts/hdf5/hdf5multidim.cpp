@@ -29,10 +29,24 @@
 #include "hdf5eosparser.h"
 #include "s100.h"
 
+#include "cpl_compressor.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
+
 #include <algorithm>
+#include <climits>
+#include <memory>
 #include <set>
 #include <utility>
 
+#if H5_VERSION_GE(1, 10, 5)
+// H5Dget_chunk_info_by_coord() and H5Dread_chunk() are available
+#define HAVE_H5DREAD_CHUNK
+#endif
+
+// Registered identifier of the Zstandard HDF5 filter
+constexpr int HDF5_FILTER_ZSTD = 32015;
+
 namespace GDAL
 {
 
@@ -294,6 +308,10 @@ class HDF5Array final : public GDALMDArray
     std::shared_ptr<OGRSpatialReference> m_poSRS{};
     haddr_t m_nOffset;
     mutable CPLStringList m_aosStructuralInfo{};
+    mutable bool m_bDirectChunkReadChecked = false;
+    mutable bool m_bCanUseDirectChunkRead = false;
+    mutable std::vector<GUInt64> m_anChunkSize{};
+    mutable std::vector<int> m_anFilters{};
 
     HDF5Array(const std::string &osParentName, const std::string &osName,
               const std::shared_ptr<HDF5SharedResources> &poShared,
@@ -311,6 +329,16 @@ class HDF5Array final : public GDALMDArray
     static herr_t GetAttributesCallback(hid_t hArray, const char *pszObjName,
                                         void *);
 
+#ifdef HAVE_H5DREAD_CHUNK
+    bool CanUseDirectChunkRead() const;
+
+    bool ReadDirectChunks(const GUInt64 *arrayStartIdx, const size_t *count,
+                          const GInt64 *arrayStep,
+                          const GPtrDiff_t *bufferStride,
+                          const GDALExtendedDataType &bufferDataType,
+                          void *pDstBuffer, bool &bFallback) const;
+#endif
+
   protected:
     bool IRead(const GUInt64 *arrayStartIdx, const size_t *count,
                const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
@@ -2456,6 +2484,478 @@ lbl_next_depth:
         goto lbl_return_to_caller_in_loop;
 }
 
+#ifdef HAVE_H5DREAD_CHUNK
+
+/************************************************************************/
+/*                       CanUseDirectChunkRead()                        */
+/************************************************************************/
+
+// Whether chunks can be read raw with H5Dread_chunk() and decoded by GDAL.
+// This requires a chunked and compressed array of a native numeric data type,
+// whose filters are all supported.
+bool HDF5Array::CanUseDirectChunkRead() const
+{
+    if (m_bDirectChunkReadChecked)
+        return m_bCanUseDirectChunkRead;
+    m_bDirectChunkReadChecked = true;
+
+    if (m_dims.empty() || m_dt.GetClass() != GEDTC_NUMERIC ||
+        GDALDataTypeIsComplex(m_dt.GetNumericDataType()) ||
+        m_bHasNonNativeDataType)
+    {
+        return false;
+    }
+    const auto eClass = H5Tget_class(m_hNativeDT);
+    if ((eClass != H5T_INTEGER && eClass != H5T_FLOAT) ||
+        H5Tget_size(m_hNativeDT) != m_dt.GetSize())
+    {
+        return false;
+    }
+    // The raw chunk content must not require any data type conversion
+    const hid_t hFileDT = H5Dget_type(m_hArray);
+    if (hFileDT < 0)
+        return false;
+    const bool bSameDT = H5Tequal(hFileDT, m_hNativeDT) > 0;
+    H5Tclose(hFileDT);
+    if (!bSameDT)
+        return false;
+
+    m_anChunkSize = GetBlockSize();
+    if (m_anChunkSize[0] == 0)
+        return false;
+
+    const hid_t nListId = H5Dget_create_plist(m_hArray);
+    if (nListId < 0)
+        return false;
+    bool bOK = true;
+    bool bCompressed = false;
+    const int nFilters = H5Pget_nfilters(nListId);
+    for (int i = 0; bOK && i < nFilters; ++i)
+    {
+        unsigned int flags = 0;
+        size_t cd_nelmts = 0;
+        char szName[64 + 1] = {0};
+        const auto eFilter = H5Pget_filter(nListId, i, &flags, &cd_nelmts,
+                                           nullptr, 64, szName);
+        if (eFilter == H5Z_FILTER_SHUFFLE)
+        {
+            m_anFilters.push_back(eFilter);
+        }
+        else if ((eFilter == H5Z_FILTER_DEFLATE &&
+                  CPLGetDecompressor("zlib")) ||
+                 (eFilter == HDF5_FILTER_ZSTD && CPLGetDecompressor("zstd")))
+        {
+            m_anFilters.push_back(eFilter);
+            bCompressed = true;
+        }
+        else
+        {
+            CPLDebug("HDF5", "%s: direct chunk reading not possible: filter %s",
+                     GetName().c_str(), szName);
+            bOK = false;
+        }
+    }
+    H5Pclose(nListId);
+
+    m_bCanUseDirectChunkRead = bOK && bCompressed;
+    return m_bCanUseDirectChunkRead;
+}
+
+/************************************************************************/
+/*                         HDF5DirectChunkJob                           */
+/************************************************************************/
+
+namespace
+{
+
+// Parameters common to all the chunks of a ReadDirectChunks() request
+struct HDF5DirectChunkContext
+{
+    std::vector<int> anFilters{};
+    const CPLCompressor *psZlib = nullptr;
+    const CPLCompressor *psZstd = nullptr;
+    size_t nChunkBytes = 0;
+    GDALDataType eSrcDT = GDT_Unknown;
+    int nSrcDTSize = 0;
+    GDALDataType eDstDT = GDT_Unknown;
+    int nDstDTSize = 0;
+    std::vector<size_t> anChunkStride{};  // in elements, within a chunk
+    std::vector<size_t> anSrcStep{};      // in elements, within a chunk
+    const GPtrDiff_t *bufferStride = nullptr;
+    GByte *pabyDstBuffer = nullptr;
+};
+
+// Decoding of a chunk, and copy of its part intersecting the request into
+// the user buffer
+struct HDF5DirectChunkJob
+{
+    const HDF5DirectChunkContext *psCtxt = nullptr;
+    std::vector<GByte> abyRaw{};
+    uint32_t nFilterMask = 0;
+    std::vector<size_t> anChunkStart{};  // first element, in the chunk
+    std::vector<size_t> anCount{};       // number of elements to copy
+    GPtrDiff_t nDstOffset = 0;           // in elements, in the user buffer
+    bool bOK = false;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+    bool Decode();
+    void CopyToUserBuffer(const GByte *pabyChunk) const;
+
+    static void Func(void *pData)
+    {
+        auto psJob = static_cast<HDF5DirectChunkJob *>(pData);
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        psJob->bOK = psJob->Decode();
+        CPLUninstallErrorHandlerAccumulator();
+        psJob->abyRaw.clear();
+        psJob->abyRaw.shrink_to_fit();
+    }
+};
+
+bool HDF5DirectChunkJob::Decode()
+{
+    const auto &sCtxt = *psCtxt;
+    std::vector<GByte> abyCur(std::move(abyRaw));
+    std::vector<GByte> abyOut;
+    // Filters are applied in reverse order of the pipeline when decoding
+    for (size_t k = sCtxt.anFilters.size(); k > 0;)
+    {
+        --k;
+        if (k < 32 && (nFilterMask & (1U << k)) != 0)
+            continue;
+        abyOut.resize(sCtxt.nChunkBytes);
+        const int nFilter = sCtxt.anFilters[k];
+        if (nFilter == H5Z_FILTER_SHUFFLE)
+        {
+            if (abyCur.size() != sCtxt.nChunkBytes)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Unexpected chunk size before unshuffling");
+                return false;
+            }
+            const size_t nEltSize = static_cast<size_t>(sCtxt.nSrcDTSize);
+            const size_t nElts = abyCur.size() / nEltSize;
+            for (size_t j = 0; j < nEltSize; ++j)
+            {
+                const GByte *pabySrc = abyCur.data() + j * nElts;
+                for (size_t i = 0; i < nElts; ++i)
+                {
+                    abyOut[i * nEltSize + j] = pabySrc[i];
+                }
+            }
+            // Trailing bytes are not shuffled
+            memcpy(abyOut.data() + nElts * nEltSize,
+                   abyCur.data() + nElts * nEltSize,
+                   abyCur.size() - nElts * nEltSize);
+        }
+        else
+        {
+            const auto psDecompressor =
+                nFilter == H5Z_FILTER_DEFLATE ? sCtxt.psZlib : sCtxt.psZstd;
+            void *pOutBuffer = abyOut.data();
+            size_t nOutSize = abyOut.size();
+            if (!psDecompressor->pfnFunc(abyCur.data(), abyCur.size(),
+                                         &pOutBuffer, &nOutSize, nullptr,
+                                         psDecompressor->user_data))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "%s decompression of chunk failed",
+                         psDecompressor->pszId);
+                return false;
+            }
+            abyOut.resize(nOutSize);
+        }
+        std::swap(abyCur, abyOut);
+    }
+    if (abyCur.size() != sCtxt.nChunkBytes)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decoded chunk is " CPL_FRMT_GUIB " bytes large, whereas "
+                 "it should be " CPL_FRMT_GUIB " bytes",
+                 static_cast<GUIntBig>(abyCur.size()),
+                 static_cast<GUIntBig>(sCtxt.nChunkBytes));
+        return false;
+    }
+    CopyToUserBuffer(abyCur.data());
+    return true;
+}
+
+void HDF5DirectChunkJob::CopyToUserBuffer(const GByte *pabyChunk) const
+{
+    const auto &sCtxt = *psCtxt;
+    const size_t nDims = anCount.size();
+    const size_t nLastDim = nDims - 1;
+
+    size_t nSrcOffset = 0;
+    for (size_t i = 0; i < nDims; ++i)
+        nSrcOffset += anChunkStart[i] * sCtxt.anChunkStride[i];
+    const GByte *pabySrc = pabyChunk + nSrcOffset * sCtxt.nSrcDTSize;
+    GByte *pabyDst = sCtxt.pabyDstBuffer + nDstOffset * sCtxt.nDstDTSize;
+
+    std::vector<size_t> anIdx(nDims);
+    while (true)
+    {
+        size_t nSrcEltOffset = 0;
+        GPtrDiff_t nDstEltOffset = 0;
+        for (size_t i = 0; i < nLastDim; ++i)
+        {
+            nSrcEltOffset += anIdx[i] * sCtxt.anSrcStep[i];
+            nDstEltOffset +=
+                static_cast<GPtrDiff_t>(anIdx[i]) * sCtxt.bufferStride[i];
+        }
+        GDALCopyWords64(
+            pabySrc + nSrcEltOffset * sCtxt.nSrcDTSize, sCtxt.eSrcDT,
+            static_cast<int>(sCtxt.anSrcStep[nLastDim] * sCtxt.nSrcDTSize),
+            pabyDst + nDstEltOffset * sCtxt.nDstDTSize, sCtxt.eDstDT,
+            static_cast<int>(sCtxt.bufferStride[nLastDim] * sCtxt.nDstDTSize),
+            static_cast<GPtrDiff_t>(anCount[nLastDim]));
+
+        size_t i = nLastDim;
+        for (; i > 0; --i)
+        {
+            if (++anIdx[i - 1] < anCount[i - 1])
+                break;
+            anIdx[i - 1] = 0;
+        }
+        if (i == 0)
+            break;
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                         ReadDirectChunks()                           */
+/************************************************************************/
+
+// Read the raw chunks intersecting the request with H5Dread_chunk(), and
+// decode them in worker threads, since the decoding done by H5Dread() is
+// single-threaded. bFallback is set to true if that method cannot be used
+// for the request, in which case nothing has been done.
+bool HDF5Array::ReadDirectChunks(const GUInt64 *arrayStartIdx,
+                                 const size_t *count, const GInt64 *arrayStep,
+                                 const GPtrDiff_t *bufferStride,
+                                 const GDALExtendedDataType &bufferDataType,
+                                 void *pDstBuffer, bool &bFallback) const
+{
+    bFallback = true;
+
+    if (bufferDataType.GetClass() != GEDTC_NUMERIC)
+        return false;
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                           ? CPLGetNumCPUs()
+                                           : atoi(pszThreads));
+    if (nThreads <= 1 ||
+        !CPLTestBool(
+            CPLGetConfigOption("GDAL_HDF5_DIRECT_CHUNK_READ", "YES")) ||
+        !CanUseDirectChunkRead())
+    {
+        return false;
+    }
+
+    const size_t nDims = m_dims.size();
+    HDF5DirectChunkContext sCtxt;
+    sCtxt.anFilters = m_anFilters;
+    sCtxt.psZlib = CPLGetDecompressor("zlib");
+    sCtxt.psZstd = CPLGetDecompressor("zstd");
+    sCtxt.eSrcDT = m_dt.GetNumericDataType();
+    sCtxt.nSrcDTSize = static_cast<int>(m_dt.GetSize());
+    sCtxt.eDstDT = bufferDataType.GetNumericDataType();
+    sCtxt.nDstDTSize = static_cast<int>(bufferDataType.GetSize());
+    sCtxt.bufferStride = bufferStride;
+    sCtxt.pabyDstBuffer = static_cast<GByte *>(pDstBuffer);
+    sCtxt.anChunkStride.resize(nDims);
+    sCtxt.anSrcStep.resize(nDims);
+
+    std::vector<GUInt64> anStep(nDims);
+    std::vector<GUInt64> anFirstChunk(nDims);
+    std::vector<GUInt64> anLastChunk(nDims);
+    GUInt64 nChunks = 1;
+    GUInt64 nChunkElts = 1;
+    double dfRequestElts = 1;
+    for (size_t i = nDims; i > 0;)
+    {
+        --i;
+        dfRequestElts *= static_cast<double>(count[i]);
+        const GUInt64 nChunkSize = m_anChunkSize[i];
+        anStep[i] = count[i] == 1 ? 1 : static_cast<GUInt64>(arrayStep[i]);
+        const GUInt64 nLastIdx = arrayStartIdx[i] + (count[i] - 1) * anStep[i];
+        anFirstChunk[i] = arrayStartIdx[i] / nChunkSize;
+        anLastChunk[i] = nLastIdx / nChunkSize;
+        nChunks *= anLastChunk[i] - anFirstChunk[i] + 1;
+        sCtxt.anChunkStride[i] = static_cast<size_t>(nChunkElts);
+        sCtxt.anSrcStep[i] = static_cast<size_t>(nChunkElts * anStep[i]);
+        nChunkElts *= nChunkSize;
+        if (nChunkElts > std::numeric_limits<uint32_t>::max())
+            return false;
+    }
+    // Chunks decoded by H5Dread() are kept in the HDF5 chunk cache, whereas
+    // ours are not: only use direct reading when most of the content of the
+    // chunks intersecting the request is needed.
+    if (nChunks < 2 ||
+        dfRequestElts * 2 < static_cast<double>(nChunks) * nChunkElts ||
+        anStep[nDims - 1] * sCtxt.nSrcDTSize > static_cast<GUInt64>(INT_MAX) ||
+        std::abs(bufferStride[nDims - 1]) * sCtxt.nDstDTSize > INT_MAX)
+    {
+        return false;
+    }
+    sCtxt.nChunkBytes = static_cast<size_t>(nChunkElts) * sCtxt.nSrcDTSize;
+
+    // Compute the part of the chunk of index anChunkIdx that intersects the
+    // request. Return false if there is none (strided request)
+    const auto GetChunkIntersection =
+        [this, nDims, arrayStartIdx, count, bufferStride, &anStep](
+            const std::vector<GUInt64> &anChunkIdx, HDF5DirectChunkJob &sJob)
+    {
+        sJob.anChunkStart.resize(nDims);
+        sJob.anCount.resize(nDims);
+        sJob.nDstOffset = 0;
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            const GUInt64 nChunkSize = m_anChunkSize[i];
+            const GUInt64 nChunkStartIdx = anChunkIdx[i] * nChunkSize;
+            const GUInt64 nChunkEndIdx = std::min(
+                nChunkStartIdx + nChunkSize, m_dims[i]->GetSize());
+            const GUInt64 nFirst =
+                nChunkStartIdx <= arrayStartIdx[i]
+                    ? 0
+                    : DIV_ROUND_UP(nChunkStartIdx - arrayStartIdx[i],
+                                   anStep[i]);
+            const GUInt64 nLast =
+                std::min(static_cast<GUInt64>(count[i] - 1),
+                         (nChunkEndIdx - 1 - arrayStartIdx[i]) / anStep[i]);
+            if (nFirst > nLast)
+                return false;
+            sJob.anChunkStart[i] = static_cast<size_t>(
+                arrayStartIdx[i] + nFirst * anStep[i] - nChunkStartIdx);
+            sJob.anCount[i] = static_cast<size_t>(nLast - nFirst + 1);
+            sJob.nDstOffset +=
+                static_cast<GPtrDiff_t>(nFirst) * bufferStride[i];
+        }
+        return true;
+    };
+
+    // Iterate over the chunks intersecting the request, in the order of
+    // their index. Return false if pfnFunc() returns false.
+    const auto IterateChunks = [nDims, &anFirstChunk,
+                                &anLastChunk](const auto &pfnFunc)
+    {
+        std::vector<GUInt64> anChunkIdx(anFirstChunk);
+        while (true)
+        {
+            if (!pfnFunc(anChunkIdx))
+                return false;
+            size_t i = nDims;
+            for (; i > 0; --i)
+            {
+                if (++anChunkIdx[i - 1] <= anLastChunk[i - 1])
+                    break;
+                anChunkIdx[i - 1] = anFirstChunk[i - 1];
+            }
+            if (i == 0)
+                return true;
+        }
+    };
+
+    // First check that all chunks exist, since missing chunks must be
+    // filled with the fill value, which is left to H5Dread().
+    std::vector<hsize_t> anOffset(nDims);
+    HDF5DirectChunkJob sTmpJob;
+    if (!IterateChunks(
+            [this, nDims, &anOffset, &sTmpJob,
+             &GetChunkIntersection](const std::vector<GUInt64> &anChunkIdx)
+            {
+                if (!GetChunkIntersection(anChunkIdx, sTmpJob))
+                    return true;
+                for (size_t i = 0; i < nDims; ++i)
+                    anOffset[i] =
+                        static_cast<hsize_t>(anChunkIdx[i] * m_anChunkSize[i]);
+                unsigned nFilterMask = 0;
+                haddr_t nAddr = HADDR_UNDEF;
+                hsize_t nSize = 0;
+                return H5Dget_chunk_info_by_coord(m_hArray, anOffset.data(),
+                                                  &nFilterMask, &nAddr,
+                                                  &nSize) >= 0 &&
+                       nSize != 0 && nAddr != HADDR_UNDEF;
+            }))
+    {
+        return false;
+    }
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+        return false;
+    bFallback = false;
+
+    // Raw chunks are read in this thread, and decoded in worker threads.
+    std::vector<std::unique_ptr<HDF5DirectChunkJob>> apoJobs;
+    const bool bReadOK = IterateChunks(
+        [this, nDims, nThreads, &anOffset, &sCtxt, &apoJobs, &poJobQueue,
+         &GetChunkIntersection](const std::vector<GUInt64> &anChunkIdx)
+        {
+            auto poJob = std::make_unique<HDF5DirectChunkJob>();
+            if (!GetChunkIntersection(anChunkIdx, *poJob))
+                return true;
+            poJob->psCtxt = &sCtxt;
+            for (size_t i = 0; i < nDims; ++i)
+                anOffset[i] =
+                    static_cast<hsize_t>(anChunkIdx[i] * m_anChunkSize[i]);
+            unsigned nFilterMask = 0;
+            haddr_t nAddr = HADDR_UNDEF;
+            hsize_t nSize = 0;
+            if (H5Dget_chunk_info_by_coord(m_hArray, anOffset.data(),
+                                           &nFilterMask, &nAddr, &nSize) < 0 ||
+                nSize == 0 ||
+                nSize > static_cast<hsize_t>(
+                            std::numeric_limits<size_t>::max() / 2))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot get information on chunk");
+                return false;
+            }
+            try
+            {
+                poJob->abyRaw.resize(static_cast<size_t>(nSize));
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate memory for chunk");
+                return false;
+            }
+            if (H5Dread_chunk(m_hArray, H5P_DEFAULT, anOffset.data(),
+                              &poJob->nFilterMask, poJob->abyRaw.data()) < 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "H5Dread_chunk() failed");
+                return false;
+            }
+            if (!poJobQueue->SubmitJob(HDF5DirectChunkJob::Func, poJob.get()))
+                return false;
+            apoJobs.push_back(std::move(poJob));
+            // Limit the number of raw chunks waiting to be decoded
+            poJobQueue->WaitCompletion(4 * nThreads);
+            return true;
+        });
+    poJobQueue->WaitCompletion();
+
+    bool bRet = bReadOK;
+    for (const auto &poJob : apoJobs)
+    {
+        for (const auto &oError : poJob->aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        if (!poJob->bOK)
+            bRet = false;
+    }
+    return bRet;
+}
+
+#endif  // HAVE_H5DREAD_CHUNK
+
 /************************************************************************/
 /*                               IRead()                                */
 /************************************************************************/
@@ -2493,6 +2993,17 @@ bool HDF5Array::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
                                         pDstBuffer);
     }
 
+#ifdef HAVE_H5DREAD_CHUNK
+    {
+        bool bFallback = true;
+        const bool bRet =
+            ReadDirectChunks(arrayStartIdx, count, arrayStep, bufferStride,
+                             bufferDataType, pDstBuffer, bFallback);
+        if (!bFallback)
+            return bRet;
+    }
+#endif
+
     hid_t hBufferType = H5I_INVALID_HID;
     GByte *pabyTemp = nullptr;
     if (m_dt.GetClass() == GEDTC_STRING)
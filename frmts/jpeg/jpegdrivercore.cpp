@@ -165,6 +165,7 @@ void JPEGDriverSetCommonMetadata(GDALDriver *poDriver)
 #endif
 
     poDriver->pfnIdentify = JPEGDriverIdentify;
+    poDriver->SetMetadataItem(GDAL_DMD_OPEN_SIGNATURES, "FFD8FF");
     poDriver->SetMetadataItem(GDAL_DCAP_OPEN, "YES");
     poDriver->SetMetadataItem(GDAL_DCAP_CREATECOPY, "YES");
 }
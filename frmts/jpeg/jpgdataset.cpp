@@ -2217,6 +2217,72 @@ CPLErr JPGDataset::LoadScanline(int iLine, GByte *outBuffer)
     return CE_None;
 }
 
+/************************************************************************/
+/*                           LoadScanlines()                            */
+/*                                                                      */
+/*      Decode nLines scanlines starting at iFirstLine directly into    */
+/*      outBuffer. Passing several output rows to jpeg_read_scanlines() */
+/*      lets libjpeg decode a whole iMCU row per call, and write the    */
+/*      upsampled / color converted lines in place, instead of going    */
+/*      through its spare row buffer.                                   */
+/************************************************************************/
+
+CPLErr JPGDataset::LoadScanlines(int iFirstLine, int nLines, GByte *outBuffer,
+                                 GSpacing nLineSpace)
+
+{
+    if (nLoadedScanline >= iFirstLine && Restart() != CE_None)
+        return CE_Failure;
+    if (iFirstLine > 0 && LoadScanline(iFirstLine - 1, nullptr) != CE_None)
+        return CE_Failure;
+
+    // Allocated before setjmp() so that it is properly freed on error.
+    std::vector<GDAL_JSAMPLE *> apRows(nLines);
+    for (int i = 0; i < nLines; ++i)
+    {
+        apRows[i] = reinterpret_cast<GDAL_JSAMPLE *>(outBuffer + i * nLineSpace);
+    }
+
+    // code path triggered when an active reader has been stopped by another
+    // one, in case of multiple scans datasets and overviews
+    if (!bHasDoneJpegCreateDecompress && Restart() != CE_None)
+        return CE_Failure;
+
+    // The decoded lines do not go to m_pabyScanline, so make sure that the
+    // next LoadScanline() call restarts decompression.
+    nLoadedScanline = nRasterYSize;
+
+    // setup to trap a fatal error.
+    if (setjmp(sUserData.setjmp_buffer))
+        return CE_Failure;
+
+    if (!bHasDoneJpegStartDecompress && StartDecompress() != CE_None)
+        return CE_Failure;
+
+    int iLine = 0;
+    while (iLine < nLines)
+    {
+#if defined(HAVE_JPEGTURBO_DUAL_MODE_8_12) && BITS_IN_JSAMPLE == 12
+        const int nRead = static_cast<int>(jpeg12_read_scanlines(
+            &sDInfo, apRows.data() + iLine, nLines - iLine));
+#else
+        const int nRead = static_cast<int>(jpeg_read_scanlines(
+            &sDInfo, apRows.data() + iLine, nLines - iLine));
+#endif
+        if (ErrorOutOnNonFatalError())
+            return CE_Failure;
+        if (nRead == 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot read scanline %d", iFirstLine + iLine);
+            return CE_Failure;
+        }
+        iLine += nRead;
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                         LoadDefaultTables()                          */
 /************************************************************************/
@@ -2571,11 +2637,26 @@ CPLErr JPGDatasetCommon::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     }
 
 #ifndef JPEG_LIB_MK1
-    if ((eRWFlag == GF_Read) && (nBandCount == 3) && (nBands == 3) &&
-        (nXOff == 0) && (nYOff == 0) && (nXSize == nBufXSize) &&
-        (nXSize == nRasterXSize) && (nYSize == nBufYSize) &&
-        (nYSize == nRasterYSize) && (eBufType == GDT_Byte) &&
-        (GetDataPrecision() != 12) && (pData != nullptr) &&
+    const bool bFullFrameByteRead =
+        (eRWFlag == GF_Read) && (nXOff == 0) && (nYOff == 0) &&
+        (nXSize == nBufXSize) && (nXSize == nRasterXSize) &&
+        (nYSize == nBufYSize) && (nYSize == nRasterYSize) &&
+        (eBufType == GDT_Byte) && (GetDataPrecision() != 12) &&
+        (pData != nullptr) && m_fpImage != nullptr;
+
+    // Single band grayscale image read into a contiguous buffer: decode
+    // directly into the user buffer, without going through the block cache.
+    if (bFullFrameByteRead && nBandCount == 1 && nBands == 1 &&
+        panBandMap[0] == 1 && nPixelSpace == 1 &&
+        GetOutColorSpace() == JCS_GRAYSCALE)
+    {
+        if (Restart() != CE_None)
+            return CE_Failure;
+        return LoadScanlines(0, nYSize, static_cast<GByte *>(pData),
+                             nLineSpace);
+    }
+
+    if (bFullFrameByteRead && (nBandCount == 3) && (nBands == 3) &&
         (panBandMap[0] == 1) && (panBandMap[1] == 2) && (panBandMap[2] == 3) &&
         // These color spaces need to be transformed to RGB.
         GetOutColorSpace() != JCS_YCCK && GetOutColorSpace() != JCS_CMYK)
@@ -2583,32 +2664,26 @@ CPLErr JPGDatasetCommon::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         Restart();
 
         // Pixel interleaved case.
-        if (nBandSpace == 1)
+        if (nBandSpace == 1 && nPixelSpace == 3)
+        {
+            return LoadScanlines(0, nYSize, static_cast<GByte *>(pData),
+                                 nLineSpace);
+        }
+        else if (nBandSpace == 1)
         {
             for (int y = 0; y < nYSize; ++y)
             {
-                if (nPixelSpace == 3)
-                {
-                    CPLErr tmpError =
-                        LoadScanline(y, &(((GByte *)pData)[(y * nLineSpace)]));
-                    if (tmpError != CE_None)
-                        return tmpError;
-                }
-                else
-                {
-                    CPLErr tmpError = LoadScanline(y);
-                    if (tmpError != CE_None)
-                        return tmpError;
+                CPLErr tmpError = LoadScanline(y);
+                if (tmpError != CE_None)
+                    return tmpError;
 
-                    for (int x = 0; x < nXSize; ++x)
-                    {
-                        memcpy(&(((GByte *)pData)[(y * nLineSpace) +
-                                                  (x * nPixelSpace)]),
-                               (const GByte *)&(m_pabyScanline[x * 3]), 3);
-                    }
+                for (int x = 0; x < nXSize; ++x)
+                {
+                    memcpy(&(((GByte *)pData)[(y * nLineSpace) +
+                                              (x * nPixelSpace)]),
+                           (const GByte *)&(m_pabyScanline[x * 3]), 3);
                 }
             }
-            nLoadedScanline = nRasterYSize;
         }
         else
         {
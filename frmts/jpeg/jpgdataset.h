@@ -205,6 +205,8 @@ class JPGDatasetCommon CPL_NON_FINAL : public GDALPamDataset
     std::vector<GByte> m_abyRawThermalImage{};
 
     virtual CPLErr LoadScanline(int, GByte *outBuffer = nullptr) = 0;
+    virtual CPLErr LoadScanlines(int iFirstLine, int nLines, GByte *outBuffer,
+                                 GSpacing nLineSpace) = 0;
     virtual void StopDecompress() = 0;
     virtual CPLErr Restart() = 0;
 
@@ -305,6 +307,8 @@ class JPGDataset final : public JPGDatasetCommon
     struct jpeg_progress_mgr sJProgress;
 
     virtual CPLErr LoadScanline(int, GByte *outBuffer) override;
+    virtual CPLErr LoadScanlines(int iFirstLine, int nLines, GByte *outBuffer,
+                                 GSpacing nLineSpace) override;
     CPLErr StartDecompress();
     virtual void StopDecompress() override;
     virtual CPLErr Restart() override;
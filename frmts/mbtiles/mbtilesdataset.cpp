@@ -201,6 +201,11 @@ class MBTilesDataset final : public GDALPamDataset,
                     bool bZoomLevelFromSpatialFilter, bool bJsonField);
 
   protected:
+    virtual CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                             GDALDataType, int, int *, GSpacing, GSpacing,
+                             GSpacing,
+                             GDALRasterIOExtraArg *psExtraArg) override;
+
     // Coming from GDALGPKGMBTilesLikePseudoDataset
 
     virtual CPLErr IFlushCacheWithErrCode(bool bAtClosing) override;
@@ -1042,6 +1047,30 @@ int MBTilesDataset::GetRowFromIntoTopConvention(int nRow)
     return m_nTileMatrixHeight - 1 - nRow;
 }
 
+/************************************************************************/
+/*                            IRasterIO()                               */
+/************************************************************************/
+
+CPLErr MBTilesDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                 int nXSize, int nYSize, void *pData,
+                                 int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType, int nBandCount,
+                                 int *panBandMap, GSpacing nPixelSpace,
+                                 GSpacing nLineSpace, GSpacing nBandSpace,
+                                 GDALRasterIOExtraArg *psExtraArg)
+{
+    const bool bPrefetched =
+        eRWFlag == GF_Read && PrefetchTiles(nXOff, nYOff, nXSize, nYSize,
+                                            nBufXSize, nBufYSize, psExtraArg);
+    const CPLErr eErr = GDALPamDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+    if (bPrefetched)
+        ClearPrefetchedTiles();
+    return eErr;
+}
+
 /************************************************************************/
 /*                          GetGeoTransform()                           */
 /************************************************************************/
@@ -848,14 +848,16 @@ void netCDFRasterBand::SetBlockSize()
     int nTmpFormat = 0;
     int status = nc_inq_format(cdfid, &nTmpFormat);
     NetCDFFormatEnum eTmpFormat = static_cast<NetCDFFormatEnum>(nTmpFormat);
+    size_t chunksize[MAX_NC_DIMS] = {};
+    bool bChunked = false;
     if ((status == NC_NOERR) &&
         (eTmpFormat == NCDF_FORMAT_NC4 || eTmpFormat == NCDF_FORMAT_NC4C))
     {
-        size_t chunksize[MAX_NC_DIMS] = {};
         // Check for chunksize and set it as the blocksize (optimizes read).
         status = nc_inq_var_chunking(cdfid, nZId, &nTmpFormat, chunksize);
         if ((status == NC_NOERR) && (nTmpFormat == NC_CHUNKED))
         {
+            bChunked = true;
             nBlockXSize = (int)chunksize[nZDim - 1];
             if (nZDim >= 2)
                 nBlockYSize = (int)chunksize[nZDim - 2];
@@ -892,6 +894,33 @@ void netCDFRasterBand::SetBlockSize()
             nBlockYSize = 1;
         }
     }
+
+    // When reading a block does not consume whole netCDF chunks, because
+    // they extend over several bands or because the block height is smaller
+    // than the chunk height, make sure that the HDF5 chunk cache can hold a
+    // whole row of chunks, so that they are not decompressed again when
+    // reading the next band or block row.
+    if (bChunked && poGDS->eAccess == GA_ReadOnly && nZDim >= 2)
+    {
+        size_t nChunkElts = 1;
+        for (int i = 0; i < nZDim; ++i)
+            nChunkElts *= std::max<size_t>(1, chunksize[i]);
+        const size_t nChunkYSize = std::max<size_t>(1, chunksize[nZDim - 2]);
+        const size_t nChunkXSize = std::max<size_t>(1, chunksize[nZDim - 1]);
+        if (nChunkElts > nChunkYSize * nChunkXSize ||
+            static_cast<size_t>(nBlockYSize) < nChunkYSize)
+        {
+            size_t nChunks = static_cast<size_t>(
+                DIV_ROUND_UP(static_cast<size_t>(nRasterXSize), nChunkXSize));
+            if (poGDS->bBottomUp && (nRasterYSize % nChunkYSize) != 0)
+                nChunks *= 2;
+            NCDFAdjustVarChunkCache(
+                cdfid, nZId,
+                nChunkElts *
+                    static_cast<size_t>(GDALGetDataTypeSizeBytes(eDataType)),
+                nChunks);
+        }
+    }
 }
 
 // Constructor in create mode.
@@ -12482,6 +12511,56 @@ bool NCDFIsUserDefinedType(int /*ncid*/, int type)
     return type >= NC_FIRSTUSERTYPEID;
 }
 
+/************************************************************************/
+/*                      NCDFAdjustVarChunkCache()                       */
+/************************************************************************/
+
+// Enlarge the HDF5 chunk cache of a chunked netCDF-4 variable so that it can
+// hold at least nChunks chunks of nChunkSize bytes, within the limit of the
+// GDAL_NETCDF_MAX_CHUNK_CACHE_SIZE configuration option. The cache is never
+// shrunk. hNCMutex must be held by the caller.
+void NCDFAdjustVarChunkCache(int nGroupId, int nVarId, size_t nChunkSize,
+                             size_t nChunks)
+{
+    const GIntBig nMaxCacheSizeBig = CPLAtoGIntBig(
+        CPLGetConfigOption("GDAL_NETCDF_MAX_CHUNK_CACHE_SIZE", "100000000"));
+    if (nChunkSize == 0 || nMaxCacheSizeBig <= 0)
+        return;
+    const size_t nMaxCacheSize = static_cast<size_t>(std::min<GUIntBig>(
+        nMaxCacheSizeBig, std::numeric_limits<size_t>::max()));
+    nChunks = std::min(nChunks, nMaxCacheSize / nChunkSize);
+    if (nChunks == 0)
+        return;
+
+    size_t nCurSize = 0;
+    size_t nCurElems = 0;
+    float fPreemption = 0;
+    if (nc_get_var_chunk_cache(nGroupId, nVarId, &nCurSize, &nCurElems,
+                               &fPreemption) != NC_NOERR)
+    {
+        return;
+    }
+    const size_t nNewSize = nChunkSize * nChunks;
+    if (nNewSize <= nCurSize)
+        return;
+    // HDF5 recommends the number of hash table slots to be much larger than
+    // the number of chunks that fit in the cache.
+    const size_t nNewElems =
+        std::max(nCurElems, std::min<size_t>(nChunks, 1000 * 1000) * 10 + 1);
+    CPLDebug("GDAL_netCDF",
+             "Setting chunk cache of variable %d to " CPL_FRMT_GUIB
+             " bytes and " CPL_FRMT_GUIB " slots",
+             nVarId, static_cast<GUIntBig>(nNewSize),
+             static_cast<GUIntBig>(nNewElems));
+    const int status = nc_set_var_chunk_cache(nGroupId, nVarId, nNewSize,
+                                              nNewElems, fPreemption);
+    if (status != NC_NOERR)
+    {
+        CPLDebug("GDAL_netCDF", "nc_set_var_chunk_cache() failed: %s",
+                 nc_strerror(status));
+    }
+}
+
 char **NCDFTokenizeCoordinatesAttribute(const char *pszCoordinates)
 {
     // CF conventions use space as the separator for variable names in the
@@ -809,6 +809,9 @@ std::string NCDFReadMetadataAsJson(int cdfid);
 
 char **NCDFTokenizeCoordinatesAttribute(const char *pszCoordinates);
 
+void NCDFAdjustVarChunkCache(int nGroupId, int nVarId, size_t nChunkSize,
+                             size_t nChunks);
+
 extern CPLMutex *hNCMutex;
 
 #ifdef ENABLE_NCDUMP
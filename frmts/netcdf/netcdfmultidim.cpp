@@ -529,6 +529,13 @@ class netCDFVariable final : public GDALPamMDArray, public netCDFAttributeHolder
     mutable std::vector<GUInt64> m_cachedArrayStartIdx{};
     mutable std::vector<size_t> m_cachedCount{};
     mutable std::shared_ptr<GDALMDArray> m_poCachedArray{};
+    mutable bool m_bBlockSizeRead = false;
+    mutable std::vector<GUInt64> m_anBlockSize{};
+    mutable GUInt64 m_nChunksInCache = 0;
+
+    void AdjustChunkCacheForRead(const GUInt64 *arrayStartIdx,
+                                 const size_t *count,
+                                 const GInt64 *arrayStep) const;
 
     void ConvertNCToGDAL(GByte *) const;
     void ConvertGDALToNC(GByte *) const;
@@ -3498,11 +3505,70 @@ bool netCDFVariable::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
                                         pDstBuffer);
     }
 
+    AdjustChunkCacheForRead(arrayStartIdx, count, arrayStep);
+
     return IReadWrite(true, arrayStartIdx, count, arrayStep, bufferStride,
                       bufferDataType, pDstBuffer, nc_get_var1, nc_get_vara,
                       nc_get_varm, &netCDFVariable::ReadOneElement);
 }
 
+/************************************************************************/
+/*                      AdjustChunkCacheForRead()                       */
+/************************************************************************/
+
+// When a request only partially covers the chunks it intersects, make sure
+// that the HDF5 chunk cache of the variable can hold all of them, so that
+// they are not decompressed again by the next adjacent request (typically
+// when reading row by row).
+void netCDFVariable::AdjustChunkCacheForRead(const GUInt64 *arrayStartIdx,
+                                             const size_t *count,
+                                             const GInt64 *arrayStep) const
+{
+    if (!m_bBlockSizeRead)
+    {
+        m_bBlockSizeRead = true;
+        if (GetDataType().GetClass() == GEDTC_NUMERIC)
+            m_anBlockSize = GetBlockSize();
+    }
+    const auto nDims = GetDimensionCount();
+    if (nDims == 0 || m_anBlockSize.size() != nDims || m_anBlockSize[0] == 0)
+        return;
+
+    const auto &dims = GetDimensions();
+    constexpr GUInt64 MAX_VAL = std::numeric_limits<uint32_t>::max();
+    GUInt64 nChunkSize = GetDataType().GetSize();
+    GUInt64 nChunks = 1;
+    bool bPartial = false;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        const GUInt64 nBlockSize = std::max<GUInt64>(1, m_anBlockSize[i]);
+        const GUInt64 nAbsStep = static_cast<GUInt64>(
+            arrayStep[i] >= 0 ? arrayStep[i] : -arrayStep[i]);
+        const GUInt64 nSpan = (count[i] - 1) * nAbsStep;
+        const GUInt64 nFirst =
+            arrayStep[i] >= 0 ? arrayStartIdx[i] : arrayStartIdx[i] - nSpan;
+        const GUInt64 nLast = nFirst + nSpan;
+        if ((nFirst % nBlockSize) != 0 ||
+            (((nLast + 1) % nBlockSize) != 0 &&
+             nLast + 1 != dims[i]->GetSize()) ||
+            (count[i] > 1 && nAbsStep > 1))
+        {
+            bPartial = true;
+        }
+        nChunks *= nLast / nBlockSize - nFirst / nBlockSize + 1;
+        nChunkSize *= nBlockSize;
+        if (nChunks > MAX_VAL || nChunkSize > MAX_VAL)
+            return;
+    }
+    if (!bPartial || nChunks <= m_nChunksInCache)
+        return;
+    m_nChunksInCache = nChunks;
+
+    CPLMutexHolderD(&hNCMutex);
+    NCDFAdjustVarChunkCache(m_gid, m_varid, static_cast<size_t>(nChunkSize),
+                            static_cast<size_t>(nChunks));
+}
+
 /************************************************************************/
 /*                             IAdviseRead()                            */
 /************************************************************************/
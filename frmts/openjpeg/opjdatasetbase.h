@@ -29,6 +29,10 @@
 
 #include <limits>
 #include <algorithm>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 /* This file is to be used with openjpeg 2.1 or later */
 #ifdef __clang__
@@ -203,13 +207,16 @@ struct OPJCodecWrapper
 
     explicit OPJCodecWrapper(OPJCodecWrapper *rhs)
         : pCodec(rhs->pCodec), pStream(rhs->pStream), psImage(rhs->psImage),
-          pasBandParams(rhs->pasBandParams), psJP2File(rhs->psJP2File)
+          pasBandParams(rhs->pasBandParams), psJP2File(rhs->psJP2File),
+          bOwnFile(rhs->bOwnFile), bReusable(rhs->bReusable)
     {
         rhs->pCodec = nullptr;
         rhs->pStream = nullptr;
         rhs->psImage = nullptr;
         rhs->pasBandParams = nullptr;
         rhs->psJP2File = nullptr;
+        rhs->bOwnFile = false;
+        rhs->bReusable = false;
     }
 
     ~OPJCodecWrapper(void)
@@ -239,6 +246,19 @@ struct OPJCodecWrapper
         rhs->psImage = nullptr;
         psJP2File = rhs->psJP2File;
         rhs->psJP2File = nullptr;
+        bOwnFile = rhs->bOwnFile;
+        rhs->bOwnFile = false;
+    }
+
+    void swap(OPJCodecWrapper *rhs)
+    {
+        std::swap(pCodec, rhs->pCodec);
+        std::swap(pStream, rhs->pStream);
+        std::swap(psImage, rhs->psImage);
+        std::swap(pasBandParams, rhs->pasBandParams);
+        std::swap(psJP2File, rhs->psJP2File);
+        std::swap(bOwnFile, rhs->bOwnFile);
+        std::swap(bReusable, rhs->bReusable);
     }
 
     static int cvtenum(JP2_ENUM enumeration)
@@ -313,6 +333,10 @@ struct OPJCodecWrapper
         ::free(pasBandParams);
         pasBandParams = nullptr;
 
+        if (bOwnFile && psJP2File && psJP2File->fp_)
+            VSIFCloseL(psJP2File->fp_);
+        bOwnFile = false;
+        bReusable = false;
         CPLFree(psJP2File);
         psJP2File = nullptr;
     }
@@ -757,6 +781,10 @@ struct OPJCodecWrapper
     jp2_image *psImage;
     jp2_image_comp_param *pasBandParams;
     JP2File *psJP2File;
+    // Whether psJP2File->fp_ belongs to this object (pooled codecs)
+    bool bOwnFile = false;
+    // Whether the codec can be put back into the codec pool of its dataset
+    bool bReusable = false;
 };
 
 /************************************************************************/
@@ -772,6 +800,42 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
     int *m_pnLastLevel = nullptr;
     bool m_bStrict = true;
 
+    // Pool of codecs whose main header has already been read, so that
+    // decoding a tile does not require re-creating a codec and re-parsing
+    // the codestream header. Only used for tiled decoding (i.e. when
+    // opj_get_decoded_tile() is used), when JP2OPENJPEG_REUSE_CODECS=YES.
+    std::mutex m_oCodecPoolMutex{};
+    std::vector<std::unique_ptr<OPJCodecWrapper>> m_apoCodecPool{};
+
+    bool acquirePooledCodec(OPJCodecWrapper *codec)
+    {
+        std::lock_guard<std::mutex> oLock(m_oCodecPoolMutex);
+        if (m_apoCodecPool.empty())
+            return false;
+        codec->swap(m_apoCodecPool.back().get());
+        m_apoCodecPool.pop_back();
+        codec->bReusable = false;
+        return true;
+    }
+
+    bool releasePooledCodec(OPJCodecWrapper *codec)
+    {
+        // Release the decoded tile buffers now: they would be reallocated
+        // by the next opj_get_decoded_tile() call anyway.
+        for (unsigned int iBand = 0; iBand < codec->psImage->numcomps;
+             iBand++)
+        {
+            opj_image_data_free(codec->psImage->comps[iBand].data);
+            codec->psImage->comps[iBand].data = nullptr;
+        }
+
+        std::lock_guard<std::mutex> oLock(m_oCodecPoolMutex);
+        if (static_cast<int>(m_apoCodecPool.size()) >= GetNumThreads())
+            return false;
+        m_apoCodecPool.emplace_back(std::make_unique<OPJCodecWrapper>(codec));
+        return true;
+    }
+
     void init(void)
     {
         (void)this;
@@ -815,6 +879,13 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
         }
         *m_pnLastLevel = iLevel;
 
+        const bool bReuseCodec =
+            !bUseSetDecodeArea && m_codec == nullptr &&
+            CPLTestBool(
+                CPLGetConfigOption("JP2OPENJPEG_REUSE_CODECS", "NO"));
+        if (bReuseCodec && codec->pCodec == nullptr)
+            acquirePooledCodec(codec);
+
         if (codec->pCodec == nullptr)
         {
             codec->pCodec = opj_create_decompress(
@@ -852,6 +923,22 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
                 codec->pStream = OPJCodecWrapper::CreateReadStream(
                     m_codec->psJP2File, nCodeStreamLength);
             }
+            else if (bReuseCodec)
+            {
+                // A pooled codec may be used later by another thread than
+                // the one owning fpIn, so it needs its own file handle.
+                VSILFILE *fpCodec = VSIFOpenL(m_osFilename.c_str(), "rb");
+                if (fpCodec == nullptr)
+                {
+                    CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s",
+                             m_osFilename.c_str());
+                    return CE_Failure;
+                }
+                codec->open(fpCodec, nCodeStreamStart);
+                codec->bOwnFile = true;
+                codec->pStream = OPJCodecWrapper::CreateReadStream(
+                    codec->psJP2File, nCodeStreamLength);
+            }
             else
             {
                 codec->open(fpIn, nCodeStreamStart);
@@ -946,6 +1033,7 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
                          "opj_get_decoded_tile() failed");
                 return CE_Failure;
             }
+            codec->bReusable = bReuseCodec;
         }
 
         return CE_None;
@@ -976,6 +1064,9 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
         if (!codec)
             return;
 
+        if (codec->bReusable && releasePooledCodec(codec))
+            return;
+
         if (m_codec && CPLTestBool(CPLGetConfigOption(
                            "USE_OPENJPEG_SINGLE_TILE_OPTIM", "YES")))
         {
@@ -1004,8 +1095,12 @@ struct JP2OPJDatasetBase : public JP2DatasetBase
 
     void closeJP2(void)
     {
-        // prevent linter from treating this as potential static method
-        (void)this;
+        {
+            std::lock_guard<std::mutex> oLock(m_oCodecPoolMutex);
+            for (auto &poCodec : m_apoCodecPool)
+                poCodec->cleanUpDecompress();
+            m_apoCodecPool.clear();
+        }
         if (iLevel == 0)
         {
             if (m_codec)
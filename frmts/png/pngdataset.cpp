@@ -45,12 +45,22 @@
 #include "cpl_string.h"
 #include "gdal_frmts.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "png.h"
+#include "zlib.h"
 
 #include <csetjmp>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 // Note: Callers must provide blocks in increasing Y order.
 // Disclaimer (E. Rouault): this code is not production ready at all. A lot of
@@ -2169,6 +2179,401 @@ static bool safe_png_write_end(jmp_buf sSetJmpContext, png_structp png_ptr,
     return true;
 }
 
+static bool safe_png_write_chunk(jmp_buf sSetJmpContext, png_structp png_ptr,
+                                 const char *pszChunkName,
+                                 const GByte *pabyData, size_t nLength)
+{
+    if (setjmp(sSetJmpContext) != 0)
+    {
+        return false;
+    }
+    png_write_chunk(png_ptr, reinterpret_cast<png_const_bytep>(pszChunkName),
+                    pabyData, nLength);
+    return true;
+}
+
+/************************************************************************/
+/*                           PNGFilterRow()                             */
+/************************************************************************/
+
+// Write in pabyOut the filter type byte followed by the filtered row.
+// If bAdaptive, the filter (among None, Sub, Up, Average and Paeth) that
+// minimizes the sum of absolute differences is selected, as libpng does by
+// default. Otherwise, the None filter is used.
+static void PNGFilterRow(const GByte *pabyRow, const GByte *pabyPrevRow,
+                         size_t nRowBytes, int nBpp, bool bAdaptive,
+                         GByte *pabyOut, std::vector<GByte> &abyTmp)
+{
+    if (!bAdaptive)
+    {
+        pabyOut[0] = PNG_FILTER_VALUE_NONE;
+        memcpy(pabyOut + 1, pabyRow, nRowBytes);
+        return;
+    }
+
+    constexpr int N_FILTERS = 5;
+    abyTmp.resize(N_FILTERS * nRowBytes);
+    GByte *const apabyFiltered[N_FILTERS] = {
+        abyTmp.data(), abyTmp.data() + nRowBytes, abyTmp.data() + 2 * nRowBytes,
+        abyTmp.data() + 3 * nRowBytes, abyTmp.data() + 4 * nRowBytes};
+    for (size_t i = 0; i < nRowBytes; ++i)
+    {
+        const int nCur = pabyRow[i];
+        const bool bHasLeft = i >= static_cast<size_t>(nBpp);
+        const int nLeft = bHasLeft ? pabyRow[i - nBpp] : 0;
+        const int nUp = pabyPrevRow ? pabyPrevRow[i] : 0;
+        const int nUpLeft = pabyPrevRow && bHasLeft ? pabyPrevRow[i - nBpp] : 0;
+        const int nP = nLeft + nUp - nUpLeft;
+        const int nPA = std::abs(nP - nLeft);
+        const int nPB = std::abs(nP - nUp);
+        const int nPC = std::abs(nP - nUpLeft);
+        const int nPaeth = (nPA <= nPB && nPA <= nPC) ? nLeft
+                           : (nPB <= nPC)             ? nUp
+                                                      : nUpLeft;
+        apabyFiltered[PNG_FILTER_VALUE_NONE][i] = static_cast<GByte>(nCur);
+        apabyFiltered[PNG_FILTER_VALUE_SUB][i] =
+            static_cast<GByte>(nCur - nLeft);
+        apabyFiltered[PNG_FILTER_VALUE_UP][i] = static_cast<GByte>(nCur - nUp);
+        apabyFiltered[PNG_FILTER_VALUE_AVG][i] =
+            static_cast<GByte>(nCur - ((nLeft + nUp) >> 1));
+        apabyFiltered[PNG_FILTER_VALUE_PAETH][i] =
+            static_cast<GByte>(nCur - nPaeth);
+    }
+
+    int iBestFilter = 0;
+    uint64_t nBestSum = std::numeric_limits<uint64_t>::max();
+    for (int iFilter = 0; iFilter < N_FILTERS; ++iFilter)
+    {
+        uint64_t nSum = 0;
+        const GByte *pabyFiltered = apabyFiltered[iFilter];
+        for (size_t i = 0; i < nRowBytes; ++i)
+        {
+            // Values are considered as signed differences
+            const int nVal = pabyFiltered[i];
+            nSum += nVal < 128 ? nVal : 256 - nVal;
+        }
+        if (nSum < nBestSum)
+        {
+            nBestSum = nSum;
+            iBestFilter = iFilter;
+        }
+    }
+    pabyOut[0] = static_cast<GByte>(iBestFilter);
+    memcpy(pabyOut + 1, apabyFiltered[iBestFilter], nRowBytes);
+}
+
+/************************************************************************/
+/*                      PNGWriteImageMultiThreaded()                    */
+/************************************************************************/
+
+// Write the IDAT chunks and the IEND chunk of the image, by filtering and
+// compressing chunks of rows in parallel with the global thread pool. Each
+// chunk of rows is compressed as an independent sequence of raw deflate
+// blocks, with a sync flush, so that they can be concatenated, pigz style,
+// into a single zlib stream, whose Adler-32 checksum is computed by combining
+// the ones of the chunks.
+static CPLErr PNGWriteImageMultiThreaded(
+    jmp_buf sSetJmpContext, png_structp hPNG, GDALDataset *poSrcDS,
+    GDALDataType eType, int nBitDepth, int nColorType, int nLevel, int nThreads,
+    GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nXSize = poSrcDS->GetRasterXSize();
+    const int nYSize = poSrcDS->GetRasterYSize();
+    const int nBands = poSrcDS->GetRasterCount();
+    const int nWordSize = GDALGetDataTypeSizeBytes(eType);
+    const size_t nUnpackedRowBytes =
+        static_cast<size_t>(nXSize) * nBands * nWordSize;
+    const size_t nRowBytes =
+        nBitDepth < 8 ? (static_cast<size_t>(nXSize) * nBitDepth + 7) / 8
+                      : nUnpackedRowBytes;
+    const int nBpp = std::max(1, nBands * nBitDepth / 8);
+    // libpng only filters non-paletted images with at least 8 bits per sample
+    const bool bAdaptiveFilter =
+        nColorType != PNG_COLOR_TYPE_PALETTE && nBitDepth >= 8;
+    const int nStrategy = bAdaptiveFilter ? Z_FILTERED : Z_DEFAULT_STRATEGY;
+    // Chunks of about 256 KB
+    const int nRowsPerChunk = static_cast<int>(std::max<size_t>(
+        1, std::min<size_t>(nYSize, 256 * 1024 / (nRowBytes + 1))));
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+        return CE_Failure;
+
+    struct CompressJob
+    {
+        // Input values
+        std::vector<GByte> abyRows{};
+        // Last row of previous chunk, or empty for the first chunk
+        std::vector<GByte> abyPrevRow{};
+        size_t nRowBytes = 0;
+        int nRows = 0;
+        int nBpp = 0;
+        bool bAdaptiveFilter = false;
+        int nLevel = Z_DEFAULT_COMPRESSION;
+        int nStrategy = Z_DEFAULT_STRATEGY;
+        bool bLast = false;
+
+        // Output values
+        std::vector<GByte> abyCompressed{};
+        uLong nAdler = 0;
+        size_t nFilteredSize = 0;
+        bool bOK = false;
+
+        // Synchronization
+        bool bFinished = false;
+        std::mutex mutex{};
+        std::condition_variable cv{};
+
+        CompressJob() = default;
+        CompressJob(const CompressJob &) = delete;
+        CompressJob &operator=(const CompressJob &) = delete;
+    };
+
+    const auto JobCompressFunc = [](void *pJobData)
+    {
+        CompressJob *poJob = static_cast<CompressJob *>(pJobData);
+        const size_t nRowBytesJob = poJob->nRowBytes;
+        std::vector<GByte> abyFiltered;
+        std::vector<GByte> abyTmp;
+        try
+        {
+            abyFiltered.resize(poJob->nRows * (nRowBytesJob + 1));
+            for (int iRow = 0; iRow < poJob->nRows; ++iRow)
+            {
+                const GByte *pabyPrevRow =
+                    iRow > 0 ? poJob->abyRows.data() + (iRow - 1) * nRowBytesJob
+                    : poJob->abyPrevRow.empty() ? nullptr
+                                                : poJob->abyPrevRow.data();
+                PNGFilterRow(poJob->abyRows.data() + iRow * nRowBytesJob,
+                             pabyPrevRow, nRowBytesJob, poJob->nBpp,
+                             poJob->bAdaptiveFilter,
+                             abyFiltered.data() + iRow * (nRowBytesJob + 1),
+                             abyTmp);
+            }
+            poJob->nFilteredSize = abyFiltered.size();
+            poJob->nAdler = adler32(adler32(0, nullptr, 0), abyFiltered.data(),
+                                    static_cast<uInt>(abyFiltered.size()));
+
+            z_stream sStream;
+            memset(&sStream, 0, sizeof(sStream));
+            if (deflateInit2(&sStream, poJob->nLevel, Z_DEFLATED,
+                             /* raw deflate */ -MAX_WBITS, 8,
+                             poJob->nStrategy) == Z_OK)
+            {
+                poJob->abyCompressed.resize(
+                    deflateBound(&sStream,
+                                 static_cast<uLong>(abyFiltered.size())) +
+                    16);
+                sStream.next_in = abyFiltered.data();
+                sStream.avail_in = static_cast<uInt>(abyFiltered.size());
+                const int nFlush = poJob->bLast ? Z_FINISH : Z_SYNC_FLUSH;
+                int nRet = Z_OK;
+                while (true)
+                {
+                    sStream.next_out =
+                        poJob->abyCompressed.data() + sStream.total_out;
+                    sStream.avail_out = static_cast<uInt>(
+                        poJob->abyCompressed.size() - sStream.total_out);
+                    nRet = deflate(&sStream, nFlush);
+                    if (nRet == Z_STREAM_ERROR ||
+                        (sStream.avail_out != 0 &&
+                         (nFlush == Z_SYNC_FLUSH || nRet == Z_STREAM_END)))
+                    {
+                        break;
+                    }
+                    poJob->abyCompressed.resize(poJob->abyCompressed.size() *
+                                                2);
+                }
+                poJob->abyCompressed.resize(sStream.total_out);
+                poJob->bOK = nRet != Z_STREAM_ERROR &&
+                             (nFlush == Z_SYNC_FLUSH || nRet == Z_STREAM_END);
+                deflateEnd(&sStream);
+            }
+        }
+        catch (const std::exception &)
+        {
+            poJob->bOK = false;
+        }
+
+        std::lock_guard<std::mutex> guard(poJob->mutex);
+        poJob->bFinished = true;
+        poJob->cv.notify_one();
+    };
+
+    // zlib stream header, using the same value as deflate() would do
+    const int nEffectiveLevel = nLevel == Z_DEFAULT_COMPRESSION ? 6 : nLevel;
+    const int nLevelFlags =
+        nStrategy >= Z_HUFFMAN_ONLY || nEffectiveLevel < 2 ? 0
+        : nEffectiveLevel < 6                               ? 1
+        : nEffectiveLevel == 6                              ? 2
+                                                            : 3;
+    int nHeader = (0x78 << 8) | (nLevelFlags << 6);
+    nHeader += 31 - (nHeader % 31);
+    std::vector<GByte> abyIDAT{static_cast<GByte>(nHeader >> 8),
+                               static_cast<GByte>(nHeader & 0xff)};
+    uLong nAdler = adler32(0, nullptr, 0);
+
+    std::list<std::unique_ptr<CompressJob>> jobList;
+    int nRowsWritten = 0;
+
+    // Wait for completion of oldest job, and write its IDAT chunk.
+    const auto WaitAndWriteOldestJob =
+        [&jobList, &abyIDAT, &nAdler, &nRowsWritten, sSetJmpContext, hPNG,
+         nYSize, pfnProgress, pProgressData](bool bWrite)
+    {
+        auto poJob = jobList.front().get();
+        {
+            std::unique_lock<std::mutex> oGuard(poJob->mutex);
+            // coverity[missing_lock:FALSE]
+            while (!poJob->bFinished)
+            {
+                poJob->cv.wait(oGuard);
+            }
+        }
+        CPLErr eErr = CE_None;
+        if (!poJob->bOK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Compression of PNG image data failed");
+            eErr = CE_Failure;
+        }
+        else if (bWrite)
+        {
+            nAdler =
+                adler32_combine(nAdler, poJob->nAdler,
+                                static_cast<z_off_t>(poJob->nFilteredSize));
+            abyIDAT.insert(abyIDAT.end(), poJob->abyCompressed.begin(),
+                           poJob->abyCompressed.end());
+            if (poJob->bLast)
+            {
+                abyIDAT.push_back(static_cast<GByte>(nAdler >> 24));
+                abyIDAT.push_back(static_cast<GByte>((nAdler >> 16) & 0xff));
+                abyIDAT.push_back(static_cast<GByte>((nAdler >> 8) & 0xff));
+                abyIDAT.push_back(static_cast<GByte>(nAdler & 0xff));
+            }
+            if (!safe_png_write_chunk(sSetJmpContext, hPNG, "IDAT",
+                                      abyIDAT.data(), abyIDAT.size()))
+            {
+                eErr = CE_Failure;
+            }
+            abyIDAT.clear();
+            nRowsWritten += poJob->nRows;
+            if (eErr == CE_None &&
+                !pfnProgress(nRowsWritten / static_cast<double>(nYSize),
+                             nullptr, pProgressData))
+            {
+                eErr = CE_Failure;
+                CPLError(CE_Failure, CPLE_UserInterrupt,
+                         "User terminated CreateCopy()");
+            }
+        }
+        jobList.pop_front();
+        return eErr;
+    };
+
+    CPLErr eErr = CE_None;
+    std::vector<GByte> abyPrevRow;
+    std::vector<GByte> abyUnpacked;
+    for (int iLine = 0; iLine < nYSize && eErr == CE_None;
+         iLine += nRowsPerChunk)
+    {
+        const int nRows = std::min(nRowsPerChunk, nYSize - iLine);
+        auto poJob = std::make_unique<CompressJob>();
+        try
+        {
+            poJob->abyRows.resize(nRows * nRowBytes);
+            if (nBitDepth < 8)
+                abyUnpacked.resize(nRows * nUnpackedRowBytes);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+            eErr = CE_Failure;
+            break;
+        }
+        GByte *pabyRows =
+            nBitDepth < 8 ? abyUnpacked.data() : poJob->abyRows.data();
+        eErr = poSrcDS->RasterIO(
+            GF_Read, 0, iLine, nXSize, nRows, pabyRows, nXSize, nRows, eType,
+            nBands, nullptr, static_cast<GSpacing>(nBands) * nWordSize,
+            static_cast<GSpacing>(nUnpackedRowBytes), nWordSize, nullptr);
+        if (eErr != CE_None)
+            break;
+#ifdef CPL_LSB
+        if (nBitDepth == 16)
+            GDALSwapWords(pabyRows, 2, nXSize * nBands * nRows, 2);
+#endif
+        if (nBitDepth < 8)
+        {
+            // Pack samples, most significant bits first, as png_set_packing()
+            const int nPixelsPerByte = 8 / nBitDepth;
+            const int nMask = (1 << nBitDepth) - 1;
+            for (int iRow = 0; iRow < nRows; ++iRow)
+            {
+                const GByte *pabySrc = pabyRows + iRow * nUnpackedRowBytes;
+                GByte *pabyDst = poJob->abyRows.data() + iRow * nRowBytes;
+                memset(pabyDst, 0, nRowBytes);
+                for (int iX = 0; iX < nXSize; ++iX)
+                {
+                    const int nVal = nBitDepth == 1 ? (pabySrc[iX] != 0)
+                                                    : (pabySrc[iX] & nMask);
+                    const int nShift =
+                        8 - nBitDepth * (1 + iX % nPixelsPerByte);
+                    pabyDst[iX / nPixelsPerByte] |=
+                        static_cast<GByte>(nVal << nShift);
+                }
+            }
+        }
+
+        poJob->abyPrevRow = abyPrevRow;
+        abyPrevRow.assign(poJob->abyRows.end() - nRowBytes,
+                          poJob->abyRows.end());
+        poJob->nRowBytes = nRowBytes;
+        poJob->nRows = nRows;
+        poJob->nBpp = nBpp;
+        poJob->bAdaptiveFilter = bAdaptiveFilter;
+        poJob->nLevel = nLevel;
+        poJob->nStrategy = nStrategy;
+        poJob->bLast = iLine + nRows == nYSize;
+
+        // Avoid accumulating more pending jobs than threads, to bound RAM
+        // usage.
+        while (eErr == CE_None &&
+               jobList.size() >= static_cast<size_t>(nThreads))
+        {
+            eErr = WaitAndWriteOldestJob(true);
+        }
+        if (eErr != CE_None)
+            break;
+
+        if (!poJobQueue->SubmitJob(JobCompressFunc, poJob.get()))
+        {
+            eErr = CE_Failure;
+            break;
+        }
+        jobList.push_back(std::move(poJob));
+    }
+
+    // Write the remaining chunks, or just wait for the pending jobs in case
+    // of error.
+    while (!jobList.empty())
+    {
+        const CPLErr eErrJob = WaitAndWriteOldestJob(eErr == CE_None);
+        if (eErr == CE_None)
+            eErr = eErrJob;
+    }
+
+    if (eErr == CE_None &&
+        !safe_png_write_chunk(sSetJmpContext, hPNG, "IEND", nullptr, 0))
+    {
+        eErr = CE_Failure;
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                             CreateCopy()                             */
 /************************************************************************/
@@ -2292,10 +2697,12 @@ GDALDataset *PNGDataset::CreateCopy(const char *pszFilename,
 
     // Do we want to control the compression level?
     const char *pszLevel = CSLFetchNameValue(papszOptions, "ZLEVEL");
+    int nZLevel = Z_DEFAULT_COMPRESSION;
 
     if (pszLevel)
     {
         const int nLevel = atoi(pszLevel);
+        nZLevel = nLevel;
         if (nLevel < 1 || nLevel > 9)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -2673,51 +3080,68 @@ GDALDataset *PNGDataset::CreateCopy(const char *pszFilename,
         png_set_packing(hPNG);
     }
 
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nThreads =
+        std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszNumThreads)));
+
     // Loop over the image, copying image data.
     CPLErr eErr = CE_None;
     const int nWordSize = GDALGetDataTypeSize(eType) / 8;
 
-    GByte *pabyScanline = reinterpret_cast<GByte *>(
-        CPLMalloc(cpl::fits_on<int>(nBands * nXSize * nWordSize)));
-
-    for (int iLine = 0; iLine < nYSize && eErr == CE_None; iLine++)
+    if (nThreads > 1)
+    {
+        eErr = PNGWriteImageMultiThreaded(
+            sSetJmpContext, hPNG, poSrcDS, eType, nBitDepth, nColorType,
+            nZLevel, nThreads, pfnProgress, pProgressData);
+    }
+    else
     {
-        png_bytep row = pabyScanline;
+        GByte *pabyScanline = reinterpret_cast<GByte *>(
+            CPLMalloc(cpl::fits_on<int>(nBands * nXSize * nWordSize)));
 
-        eErr = poSrcDS->RasterIO(
-            GF_Read, 0, iLine, nXSize, 1, pabyScanline, nXSize, 1, eType,
-            nBands, nullptr, static_cast<GSpacing>(nBands) * nWordSize,
-            static_cast<GSpacing>(nBands) * nXSize * nWordSize, nWordSize,
-            nullptr);
+        for (int iLine = 0; iLine < nYSize && eErr == CE_None; iLine++)
+        {
+            png_bytep row = pabyScanline;
+
+            eErr = poSrcDS->RasterIO(
+                GF_Read, 0, iLine, nXSize, 1, pabyScanline, nXSize, 1, eType,
+                nBands, nullptr, static_cast<GSpacing>(nBands) * nWordSize,
+                static_cast<GSpacing>(nBands) * nXSize * nWordSize, nWordSize,
+                nullptr);
 
 #ifdef CPL_LSB
-        if (nBitDepth == 16)
-            GDALSwapWords(row, 2, nXSize * nBands, 2);
+            if (nBitDepth == 16)
+                GDALSwapWords(row, 2, nXSize * nBands, 2);
 #endif
-        if (eErr == CE_None)
-        {
-            if (!safe_png_write_rows(sSetJmpContext, hPNG, &row, 1))
+            if (eErr == CE_None)
+            {
+                if (!safe_png_write_rows(sSetJmpContext, hPNG, &row, 1))
+                {
+                    eErr = CE_Failure;
+                }
+            }
+
+            if (eErr == CE_None &&
+                !pfnProgress((iLine + 1) / static_cast<double>(nYSize),
+                             nullptr, pProgressData))
             {
                 eErr = CE_Failure;
+                CPLError(CE_Failure, CPLE_UserInterrupt,
+                         "User terminated CreateCopy()");
             }
         }
 
-        if (eErr == CE_None &&
-            !pfnProgress((iLine + 1) / static_cast<double>(nYSize), nullptr,
-                         pProgressData))
+        CPLFree(pabyScanline);
+
+        if (!safe_png_write_end(sSetJmpContext, hPNG, psPNGInfo))
         {
             eErr = CE_Failure;
-            CPLError(CE_Failure, CPLE_UserInterrupt,
-                     "User terminated CreateCopy()");
         }
     }
-
-    CPLFree(pabyScanline);
-
-    if (!safe_png_write_end(sSetJmpContext, hPNG, psPNGInfo))
-    {
-        eErr = CE_Failure;
-    }
     png_destroy_write_struct(&hPNG, &psPNGInfo);
 
     VSIFCloseL(fpImage);
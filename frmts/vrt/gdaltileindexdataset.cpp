@@ -43,6 +43,7 @@
 #include "vrt_priv.h"
 #include "ogrsf_frmts.h"
 #include "gdal_proxy.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 
 #if defined(__SSE2__) || defined(_M_X64)
@@ -276,6 +277,9 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! Cache of buffers used by VRTComplexSource to avoid memory reallocation.
     VRTSource::WorkingState m_oWorkingState{};
 
+    //! Value of the NUM_THREADS open option (empty if not specified).
+    std::string m_osNumThreads{};
+
     //! Structure describing one of the source raster in the tile index.
     struct SourceDesc
     {
@@ -328,6 +332,16 @@ class GDALTileIndexDataset final : public GDALPamDataset
     //! sources are fully covering it.
     bool NeedInitBuffer(int nBandCount, const int *panBandMap) const;
 
+    //! Return a thread pool if the sources of m_aoSourceDesc[] can be
+    //! rendered in parallel, and fill anSources with their indices.
+    //! Must be called after CollectSources().
+    CPLWorkerThreadPool *
+    GetThreadPoolForSourcesRasterIO(double dfXOff, double dfYOff,
+                                    double dfXSize, double dfYSize,
+                                    int nBufXSize, int nBufYSize,
+                                    const GDALRasterIOExtraArg *psExtraArg,
+                                    std::vector<int> &anSources);
+
     //! Nodata initialize the output buffer.
     void InitBuffer(void *pData, int nBufXSize, int nBufYSize,
                     GDALDataType eBufType, int nBandCount,
@@ -818,6 +832,12 @@ bool GDALTileIndexDataset::Open(GDALOpenInfo *poOpenInfo)
         return m_poLayer->GetMetadataItem(pszItem);
     };
 
+    if (const char *pszNumThreads =
+            CSLFetchNameValue(poOpenInfo->papszOpenOptions, "NUM_THREADS"))
+    {
+        m_osNumThreads = pszNumThreads;
+    }
+
     const char *pszFilter = GetOption("Filter");
     if (pszFilter)
     {
@@ -3231,6 +3251,107 @@ bool GDALTileIndexDataset::NeedInitBuffer(int nBandCount,
     return bNeedInitBuffer;
 }
 
+/************************************************************************/
+/*                  GetThreadPoolForSourcesRasterIO()                   */
+/*                                                                      */
+/*      Sources can be rendered in parallel if there are several of     */
+/*      them, with distinct names, and if their windows in the output   */
+/*      buffer do not overlap (so that their order does not matter).    */
+/*      In that case, each source dataset is only used by one thread.   */
+/************************************************************************/
+
+CPLWorkerThreadPool *GDALTileIndexDataset::GetThreadPoolForSourcesRasterIO(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    int nBufXSize, int nBufYSize, const GDALRasterIOExtraArg *psExtraArg,
+    std::vector<int> &anSources)
+{
+    anSources.clear();
+    if (m_aoSourceDesc.size() < 2 ||
+        VRTSourcedRasterBand::IsInSourcesRasterIOWorkerThread() ||
+        (psExtraArg->pfnProgress != nullptr &&
+         psExtraArg->pfnProgress != GDALDummyProgress))
+    {
+        return nullptr;
+    }
+
+    const char *pszValue =
+        !m_osNumThreads.empty()
+            ? m_osNumThreads.c_str()
+            : CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszValue == nullptr)
+        return nullptr;
+    int nThreads =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    if (nThreads > 1024)
+        nThreads = 1024;  // to please Coverity
+    if (nThreads <= 1)
+        return nullptr;
+
+    struct Window
+    {
+        int nXOff;
+        int nYOff;
+        int nXSize;
+        int nYSize;
+    };
+
+    std::vector<Window> asWindows;
+    std::set<std::string> oSetNames;
+    for (int i = 0; i < static_cast<int>(m_aoSourceDesc.size()); ++i)
+    {
+        auto &oSourceDesc = m_aoSourceDesc[i];
+        if (!oSourceDesc.poDS)
+            continue;
+        if (!oSetNames.insert(oSourceDesc.osName).second)
+            return nullptr;
+
+        double dfReqXOff = 0.0;
+        double dfReqYOff = 0.0;
+        double dfReqXSize = 0.0;
+        double dfReqYSize = 0.0;
+        int nReqXOff = 0;
+        int nReqYOff = 0;
+        int nReqXSize = 0;
+        int nReqYSize = 0;
+        Window sWindow;
+        bool bError = false;
+        auto &poSource = oSourceDesc.poSource;
+        poSource->SetRasterBand(oSourceDesc.poDS->GetRasterBand(1), false);
+        if (poSource->GetSrcDstWindow(
+                dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize,
+                &dfReqXOff, &dfReqYOff, &dfReqXSize, &dfReqYSize, &nReqXOff,
+                &nReqYOff, &nReqXSize, &nReqYSize, &sWindow.nXOff,
+                &sWindow.nYOff, &sWindow.nXSize, &sWindow.nYSize, bError))
+        {
+            for (const auto &sOther : asWindows)
+            {
+                if (sWindow.nXOff < sOther.nXOff + sOther.nXSize &&
+                    sOther.nXOff < sWindow.nXOff + sWindow.nXSize &&
+                    sWindow.nYOff < sOther.nYOff + sOther.nYSize &&
+                    sOther.nYOff < sWindow.nYOff + sWindow.nYSize)
+                {
+                    anSources.clear();
+                    return nullptr;
+                }
+            }
+            asWindows.push_back(sWindow);
+        }
+        else if (bError)
+        {
+            anSources.clear();
+            return nullptr;
+        }
+        anSources.push_back(i);
+    }
+
+    if (asWindows.size() < 2)
+    {
+        anSources.clear();
+        return nullptr;
+    }
+    return GDALGetGlobalThreadPool(nThreads);
+}
+
 /************************************************************************/
 /*                            InitBuffer()                              */
 /************************************************************************/
@@ -3367,11 +3488,12 @@ CPLErr GDALTileIndexDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
     const bool bNeedInitBuffer = NeedInitBuffer(nBandCount, panBandMap);
 
-    const auto RenderSource = [this, bNeedInitBuffer, nBandNrMax, nXOff, nYOff,
-                               nXSize, nYSize, dfXOff, dfYOff, dfXSize, dfYSize,
-                               nBufXSize, nBufYSize, pData, eBufType,
-                               nBandCount, panBandMap, nPixelSpace, nLineSpace,
-                               nBandSpace, psExtraArg](SourceDesc &oSourceDesc)
+    const auto RenderSource =
+        [this, bNeedInitBuffer, nBandNrMax, nXOff, nYOff, nXSize, nYSize,
+         dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize, pData,
+         eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+         psExtraArg](SourceDesc &oSourceDesc,
+                     VRTSource::WorkingState &oWorkingState)
     {
         auto &poTileDS = oSourceDesc.poDS;
         auto &poSource = oSourceDesc.poSource;
@@ -3460,7 +3582,7 @@ CPLErr GDALTileIndexDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     eErr = poSource->RasterIO(
                         poTileBand->GetRasterDataType(), nXOff, nYOff, nXSize,
                         nYSize, pabyBandData, nBufXSize, nBufYSize, eBufType,
-                        nPixelSpace, nLineSpace, &sExtraArg, m_oWorkingState);
+                        nPixelSpace, nLineSpace, &sExtraArg, oWorkingState);
                 }
             }
             return eErr;
@@ -3699,7 +3821,7 @@ CPLErr GDALTileIndexDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                     papoBands[nBandNr - 1]->GetRasterDataType(), nXOff, nYOff,
                     nXSize, nYSize, pabyBandData, nBufXSize, nBufYSize,
                     eBufType, nPixelSpace, nLineSpace, &sExtraArg,
-                    m_oWorkingState);
+                    oWorkingState);
             }
         }
         return eErr;
@@ -3707,17 +3829,33 @@ CPLErr GDALTileIndexDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
     if (!bNeedInitBuffer)
     {
-        return RenderSource(m_aoSourceDesc.back());
+        return RenderSource(m_aoSourceDesc.back(), m_oWorkingState);
     }
     else
     {
         InitBuffer(pData, nBufXSize, nBufYSize, eBufType, nBandCount,
                    panBandMap, nPixelSpace, nLineSpace, nBandSpace);
 
+        std::vector<int> anSources;
+        if (CPLWorkerThreadPool *poThreadPool =
+                GetThreadPoolForSourcesRasterIO(dfXOff, dfYOff, dfXSize,
+                                                dfYSize, nBufXSize, nBufYSize,
+                                                psExtraArg, anSources))
+        {
+            return VRTSourcedRasterBand::RunSourcesRasterIOInParallel(
+                poThreadPool, anSources,
+                [this, &RenderSource](int iSource,
+                                      VRTSource::WorkingState &oWorkingState) {
+                    return RenderSource(m_aoSourceDesc[iSource],
+                                        oWorkingState);
+                });
+        }
+
         // Now render from bottom of the stack to top.
         for (auto &oSourceDesc : m_aoSourceDesc)
         {
-            if (oSourceDesc.poDS && RenderSource(oSourceDesc) != CE_None)
+            if (oSourceDesc.poDS &&
+                RenderSource(oSourceDesc, m_oWorkingState) != CE_None)
                 return CE_Failure;
         }
 
@@ -3761,6 +3899,11 @@ void GDALRegister_GTI()
                               "  <Option name='MINY' type='float'/>"
                               "  <Option name='MAXX' type='float'/>"
                               "  <Option name='MAXY' type='float'/>"
+                              "  <Option name='NUM_THREADS' type='string' "
+                              "description='Number of worker threads used to "
+                              "read non-overlapping tiles in parallel. "
+                              "Integer or ALL_CPUS' "
+                              "default='GDAL_NUM_THREADS config option'/>"
                               "</OpenOptionList>");
 
     GetGDALDriverManager()->RegisterDriver(poDriver.release());
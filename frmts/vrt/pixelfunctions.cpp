@@ -31,7 +31,9 @@
 #include "gdal.h"
 #include "vrtdataset.h"
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 template <typename T>
 inline double GetSrcVal(const void *pSource, GDALDataType eSrcType, T ii)
@@ -77,6 +79,40 @@ inline double GetSrcVal(const void *pSource, GDALDataType eSrcType, T ii)
     return 0;
 }
 
+/************************************************************************/
+/*                        GetSrcLineAsDouble()                          */
+/************************************************************************/
+
+// Convert the nXSize values of line iLine of a non-complex source to double.
+// This is much faster than calling GetSrcVal() on each pixel, as the switch
+// on the data type is done once per line, and GDALCopyWords() has vectorized
+// code paths for the most common data types.
+static void GetSrcLineAsDouble(const void *pSource, GDALDataType eSrcType,
+                               int iLine, int nXSize, double *padfLine)
+{
+    const int nSrcSize = GDALGetDataTypeSizeBytes(eSrcType);
+    GDALCopyWords64(static_cast<const GByte *>(pSource) +
+                        static_cast<size_t>(iLine) * nXSize * nSrcSize,
+                    eSrcType, nSrcSize, padfLine, GDT_Float64,
+                    static_cast<int>(sizeof(double)), nXSize);
+}
+
+/************************************************************************/
+/*                        SetDstLineFromDouble()                        */
+/************************************************************************/
+
+// Write the nXSize double values of padfLine into line iLine of the output
+// buffer.
+static void SetDstLineFromDouble(const double *padfLine, void *pData,
+                                 int iLine, int nXSize, GDALDataType eBufType,
+                                 int nPixelSpace, int nLineSpace)
+{
+    GDALCopyWords64(padfLine, GDT_Float64, static_cast<int>(sizeof(double)),
+                    static_cast<GByte *>(pData) +
+                        static_cast<GSpacing>(nLineSpace) * iLine,
+                    eBufType, nPixelSpace, nXSize);
+}
+
 static CPLErr FetchDoubleArg(CSLConstList papszArgs, const char *pszName,
                              double *pdfX, double *pdfDefault = nullptr)
 {
@@ -543,26 +579,22 @@ static CPLErr SumPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
+        std::vector<double> adfSum(nXSize);
+        std::vector<double> adfSrc(nXSize);
         for (int iLine = 0; iLine < nYSize; ++iLine)
         {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-            {
-                double dfSum = dfK;  // Not complex.
+            std::fill(adfSum.begin(), adfSum.end(), dfK);  // Not complex.
 
-                for (int iSrc = 0; iSrc < nSources; ++iSrc)
-                {
-                    // Source raster pixels may be obtained with GetSrcVal
-                    // macro.
-                    dfSum += GetSrcVal(papoSources[iSrc], eSrcType, ii);
-                }
-
-                GDALCopyWords(&dfSum, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
+            for (int iSrc = 0; iSrc < nSources; ++iSrc)
+            {
+                GetSrcLineAsDouble(papoSources[iSrc], eSrcType, iLine, nXSize,
+                                   adfSrc.data());
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                    adfSum[iCol] += adfSrc[iCol];
             }
+
+            SetDstLineFromDouble(adfSum.data(), pData, iLine, nXSize, eBufType,
+                                 nPixelSpace, nLineSpace);
         }
     }
 
@@ -612,23 +644,20 @@ static CPLErr DiffPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
+        std::vector<double> adfLeft(nXSize);
+        std::vector<double> adfRight(nXSize);
         for (int iLine = 0; iLine < nYSize; ++iLine)
         {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-            {
-                // Source raster pixels may be obtained with GetSrcVal macro.
-                // Not complex.
-                const double dfPixVal =
-                    GetSrcVal(papoSources[0], eSrcType, ii) -
-                    GetSrcVal(papoSources[1], eSrcType, ii);
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
-            }
+            GetSrcLineAsDouble(papoSources[0], eSrcType, iLine, nXSize,
+                               adfLeft.data());
+            GetSrcLineAsDouble(papoSources[1], eSrcType, iLine, nXSize,
+                               adfRight.data());
+            // Not complex.
+            for (int iCol = 0; iCol < nXSize; ++iCol)
+                adfLeft[iCol] -= adfRight[iCol];
+
+            SetDstLineFromDouble(adfLeft.data(), pData, iLine, nXSize,
+                                 eBufType, nPixelSpace, nLineSpace);
         }
     }
 
@@ -697,26 +726,22 @@ static CPLErr MulPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
+        std::vector<double> adfPixVal(nXSize);
+        std::vector<double> adfSrc(nXSize);
         for (int iLine = 0; iLine < nYSize; ++iLine)
         {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-            {
-                double dfPixVal = dfK;  // Not complex.
+            std::fill(adfPixVal.begin(), adfPixVal.end(), dfK);  // Not complex.
 
-                for (int iSrc = 0; iSrc < nSources; ++iSrc)
-                {
-                    // Source raster pixels may be obtained with GetSrcVal
-                    // macro.
-                    dfPixVal *= GetSrcVal(papoSources[iSrc], eSrcType, ii);
-                }
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
+            for (int iSrc = 0; iSrc < nSources; ++iSrc)
+            {
+                GetSrcLineAsDouble(papoSources[iSrc], eSrcType, iLine, nXSize,
+                                   adfSrc.data());
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                    adfPixVal[iCol] *= adfSrc[iCol];
             }
+
+            SetDstLineFromDouble(adfPixVal.data(), pData, iLine, nXSize,
+                                 eBufType, nPixelSpace, nLineSpace);
         }
     }
 
@@ -776,23 +801,24 @@ static CPLErr DivPixelFunc(void **papoSources, int nSources, void *pData,
     else
     {
         /* ---- Set pixels ---- */
-        size_t ii = 0;
+        std::vector<double> adfNum(nXSize);
+        std::vector<double> adfDenom(nXSize);
         for (int iLine = 0; iLine < nYSize; ++iLine)
         {
-            for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+            GetSrcLineAsDouble(papoSources[0], eSrcType, iLine, nXSize,
+                               adfNum.data());
+            GetSrcLineAsDouble(papoSources[1], eSrcType, iLine, nXSize,
+                               adfDenom.data());
+            for (int iCol = 0; iCol < nXSize; ++iCol)
             {
-                const double dfVal = GetSrcVal(papoSources[1], eSrcType, ii);
-                double dfPixVal =
-                    dfVal == 0
-                        ? std::numeric_limits<double>::infinity()
-                        : GetSrcVal(papoSources[0], eSrcType, ii) / dfVal;
-
-                GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                              static_cast<GByte *>(pData) +
-                                  static_cast<GSpacing>(nLineSpace) * iLine +
-                                  iCol * nPixelSpace,
-                              eBufType, nPixelSpace, 1);
+                const double dfVal = adfDenom[iCol];
+                adfNum[iCol] = dfVal == 0
+                                   ? std::numeric_limits<double>::infinity()
+                                   : adfNum[iCol] / dfVal;
             }
+
+            SetDstLineFromDouble(adfNum.data(), pData, iLine, nXSize,
+                                 eBufType, nPixelSpace, nLineSpace);
         }
     }
 
@@ -1451,20 +1477,16 @@ static CPLErr ScalePixelFunc(void **papoSources, int nSources, void *pData,
         return CE_Failure;
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
+    std::vector<double> adfPixVal(nXSize);
     for (int iLine = 0; iLine < nYSize; ++iLine)
     {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
-        {
-            const double dfPixVal =
-                GetSrcVal(papoSources[0], eSrcType, ii) * dfScale + dfOffset;
+        GetSrcLineAsDouble(papoSources[0], eSrcType, iLine, nXSize,
+                           adfPixVal.data());
+        for (int iCol = 0; iCol < nXSize; ++iCol)
+            adfPixVal[iCol] = adfPixVal[iCol] * dfScale + dfOffset;
 
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
-        }
+        SetDstLineFromDouble(adfPixVal.data(), pData, iLine, nXSize, eBufType,
+                             nPixelSpace, nLineSpace);
     }
 
     /* ---- Return success ---- */
@@ -1488,26 +1510,28 @@ static CPLErr NormDiffPixelFunc(void **papoSources, int nSources, void *pData,
     }
 
     /* ---- Set pixels ---- */
-    size_t ii = 0;
+    std::vector<double> adfLeft(nXSize);
+    std::vector<double> adfRight(nXSize);
     for (int iLine = 0; iLine < nYSize; ++iLine)
     {
-        for (int iCol = 0; iCol < nXSize; ++iCol, ++ii)
+        GetSrcLineAsDouble(papoSources[0], eSrcType, iLine, nXSize,
+                           adfLeft.data());
+        GetSrcLineAsDouble(papoSources[1], eSrcType, iLine, nXSize,
+                           adfRight.data());
+        for (int iCol = 0; iCol < nXSize; ++iCol)
         {
-            const double dfLeftVal = GetSrcVal(papoSources[0], eSrcType, ii);
-            const double dfRightVal = GetSrcVal(papoSources[1], eSrcType, ii);
+            const double dfLeftVal = adfLeft[iCol];
+            const double dfRightVal = adfRight[iCol];
 
             const double dfDenom = (dfLeftVal + dfRightVal);
 
-            const double dfPixVal =
-                dfDenom == 0 ? std::numeric_limits<double>::infinity()
-                             : (dfLeftVal - dfRightVal) / dfDenom;
-
-            GDALCopyWords(&dfPixVal, GDT_Float64, 0,
-                          static_cast<GByte *>(pData) +
-                              static_cast<GSpacing>(nLineSpace) * iLine +
-                              iCol * nPixelSpace,
-                          eBufType, nPixelSpace, 1);
+            adfLeft[iCol] = dfDenom == 0
+                                ? std::numeric_limits<double>::infinity()
+                                : (dfLeftVal - dfRightVal) / dfDenom;
         }
+
+        SetDstLineFromDouble(adfLeft.data(), pData, iLine, nXSize, eBufType,
+                             nPixelSpace, nLineSpace);
     }
 
     /* ---- Return success ---- */
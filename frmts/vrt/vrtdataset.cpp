@@ -878,16 +878,37 @@ GDALDataset *VRTDataset::Open(GDALOpenInfo *poOpenInfo)
     /* -------------------------------------------------------------------- */
     /*      Turn the XML representation into a VRTDataset.                  */
     /* -------------------------------------------------------------------- */
-    VRTDataset *poDS = OpenXML(pszXML, pszVRTPath, poOpenInfo->eAccess);
+    bool bIsPansharpened = false;
+    VRTDataset *poDS = nullptr;
+    {
+        CPLXMLTreeCloser psTree(CPLParseXMLString(pszXML));
+
+        // The XML text is no longer needed: free it before instantiating
+        // the sources, to lower the peak memory usage for huge VRTs.
+        CPLFree(pszXML);
+        pszXML = nullptr;
+
+        if (psTree)
+        {
+            bIsPansharpened =
+                EQUAL(CPLGetXMLValue(psTree.get(), "=VRTDataset.subClass", ""),
+                      "VRTPansharpenedDataset");
+            poDS = OpenXMLTree(psTree.get(), pszVRTPath, poOpenInfo->eAccess);
+        }
+    }
 
     if (poDS != nullptr)
+    {
         poDS->m_bNeedsFlush = false;
+        poDS->m_osNumThreads = CSLFetchNameValueDef(
+            poOpenInfo->papszOpenOptions, "NUM_THREADS", "");
+    }
 
     if (poDS != nullptr)
     {
         if (poDS->GetRasterCount() == 0 &&
             (poOpenInfo->nOpenFlags & GDAL_OF_MULTIDIM_RASTER) == 0 &&
-            strstr(pszXML, "VRTPansharpenedDataset") == nullptr)
+            !bIsPansharpened)
         {
             delete poDS;
             poDS = nullptr;
@@ -901,7 +922,6 @@ GDALDataset *VRTDataset::Open(GDALOpenInfo *poOpenInfo)
         }
     }
 
-    CPLFree(pszXML);
     CPLFree(pszVRTPath);
 
     /* -------------------------------------------------------------------- */
@@ -1525,7 +1545,20 @@ VRTDataset *VRTDataset::OpenXML(const char *pszXML, const char *pszVRTPath,
     if (psTree == nullptr)
         return nullptr;
 
-    CPLXMLNode *psRoot = CPLGetXMLNode(psTree.get(), "=VRTDataset");
+    return OpenXMLTree(psTree.get(), pszVRTPath, eAccessIn);
+}
+
+/************************************************************************/
+/*                            OpenXMLTree()                             */
+/*                                                                      */
+/*      Create an open VRTDataset from an already parsed XML tree.      */
+/************************************************************************/
+
+VRTDataset *VRTDataset::OpenXMLTree(CPLXMLNode *psTree, const char *pszVRTPath,
+                                    GDALAccess eAccessIn)
+
+{
+    CPLXMLNode *psRoot = CPLGetXMLNode(psTree, "=VRTDataset");
     if (psRoot == nullptr)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Missing VRTDataset element.");
@@ -2288,14 +2321,56 @@ CPLErr VRTDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         // they don't necessary instantiate all underlying rasterbands.
         VRTSourcedRasterBand *poBand =
             static_cast<VRTSourcedRasterBand *>(papoBands[nBands - 1]);
-        for (int iSource = 0; eErr == CE_None && iSource < poBand->nSources;
-             iSource++)
+
+        // Read non-overlapping sources in parallel if possible.
+        std::vector<int> anContributingSources;
+        if (CPLWorkerThreadPool *poThreadPool =
+                poBand->GetThreadPoolForSourcesRasterIO(
+                    nXOff, nYOff, nXSize, nYSize, nBufXSize, nBufYSize,
+                    psExtraArg, anContributingSources))
+        {
+            return VRTSourcedRasterBand::RunSourcesRasterIOInParallel(
+                poThreadPool, anContributingSources,
+                [poBand, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                 nBufYSize, eBufType, nBandCount, panBandMap, nPixelSpace,
+                 nLineSpace, nBandSpace,
+                 psExtraArg](int iSource, VRTSource::WorkingState &)
+                {
+                    GDALRasterIOExtraArg sExtraArg(*psExtraArg);
+                    VRTSimpleSource *poSource = static_cast<VRTSimpleSource *>(
+                        poBand->papoSources[iSource]);
+                    return poSource->DatasetRasterIO(
+                        poBand->GetRasterDataType(), nXOff, nYOff, nXSize,
+                        nYSize, pData, nBufXSize, nBufYSize, eBufType,
+                        nBandCount, panBandMap, nPixelSpace, nLineSpace,
+                        nBandSpace, &sExtraArg);
+                });
+        }
+
+        double dfXOff = nXOff;
+        double dfYOff = nYOff;
+        double dfXSize = nXSize;
+        double dfYSize = nYSize;
+        if (psExtraArg->bFloatingPointWindowValidity)
         {
+            dfXOff = psExtraArg->dfXOff;
+            dfYOff = psExtraArg->dfYOff;
+            dfXSize = psExtraArg->dfXSize;
+            dfYSize = psExtraArg->dfYSize;
+        }
+
+        std::vector<int> anSources;
+        poBand->GetSourcesIntersectingWindow(dfXOff, dfYOff, dfXSize, dfYSize,
+                                             anSources);
+        const int nCandidateSources = static_cast<int>(anSources.size());
+
+        for (int i = 0; eErr == CE_None && i < nCandidateSources; i++)
+        {
+            const int iSource = anSources[i];
             psExtraArg->pfnProgress = GDALScaledProgress;
             psExtraArg->pProgressData = GDALCreateScaledProgress(
-                1.0 * iSource / poBand->nSources,
-                1.0 * (iSource + 1) / poBand->nSources, pfnProgressGlobal,
-                pProgressDataGlobal);
+                1.0 * i / nCandidateSources, 1.0 * (i + 1) / nCandidateSources,
+                pfnProgressGlobal, pProgressDataGlobal);
 
             VRTSimpleSource *poSource =
                 static_cast<VRTSimpleSource *>(poBand->papoSources[iSource]);
@@ -2815,7 +2890,16 @@ std::string VRTDataset::BuildSourceFilename(const char *pszFilename,
                                             bool bRelativeToVRT)
 {
     std::string osSrcDSName;
-    if (pszVRTPath != nullptr && bRelativeToVRT)
+    if (pszVRTPath != nullptr && bRelativeToVRT &&
+        strchr(pszFilename, ':') == nullptr)
+    {
+        // Fast path for the most common case of a plain relative filename
+        // (e.g. generated by gdalbuildvrt): neither a subdataset name nor
+        // one of the special syntaxes can apply. This avoids iterating over
+        // all drivers for each of the sources of huge VRTs.
+        osSrcDSName = CPLProjectRelativeFilename(pszVRTPath, pszFilename);
+    }
+    else if (pszVRTPath != nullptr && bRelativeToVRT)
     {
         // Try subdatasetinfo API first
         // Note: this will become the only branch when subdatasetinfo will become
@@ -35,6 +35,7 @@
 
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
+#include "cpl_quad_tree.h"
 #include "gdal_pam.h"
 #include "gdal_priv.h"
 #include "gdal_rat.h"
@@ -215,6 +216,7 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
     friend struct VRTFlushCacheStruct<VRTProcessedDataset>;
     friend class VRTSourcedRasterBand;
     friend class VRTSimpleSource;
+    friend class VRTProcessedDataset;
     friend VRTDatasetH CPL_STDCALL VRTCreate(int nXSize, int nYSize);
 
     std::vector<gdal::GCP> m_asGCPs{};
@@ -247,6 +249,8 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
 
     VRTSource::WorkingState m_oWorkingState{};
 
+    CPLString m_osNumThreads{};  // NUM_THREADS open option
+
     static constexpr const char *const apszSpecialSyntax[] = {
         "NITF_IM:{ANY}:{FILENAME}", "PDF:{ANY}:{FILENAME}",
         "RASTERLITE:{FILENAME},{ANY}", "TILEDB:\"{FILENAME}\":{ANY}",
@@ -257,10 +261,6 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
     static GDALDataset *OpenVRTProtocol(const char *pszSpec);
     bool AddVirtualOverview(int nOvFactor, const char *pszResampling);
 
-    bool GetShiftedDataset(int nXOff, int nYOff, int nXSize, int nYSize,
-                           GDALDataset *&poSrcDataset, int &nSrcXOff,
-                           int &nSrcYOff);
-
     CPL_DISALLOW_COPY_ASSIGN(VRTDataset)
 
   protected:
@@ -364,6 +364,10 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
 
     /* Used by PDF driver for example */
     GDALDataset *GetSingleSimpleSource();
+    /* Used by GTiff driver to copy compressed tiles of a subset */
+    bool GetShiftedDataset(int nXOff, int nYOff, int nXSize, int nYSize,
+                           GDALDataset *&poSrcDataset, int &nSrcXOff,
+                           int &nSrcYOff);
     void BuildVirtualOverviews();
 
     void UnsetPreservedRelativeFilenames();
@@ -387,6 +391,8 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
     static GDALDataset *Open(GDALOpenInfo *);
     static VRTDataset *OpenXML(const char *, const char * = nullptr,
                                GDALAccess eAccess = GA_ReadOnly);
+    static VRTDataset *OpenXMLTree(CPLXMLNode *psTree, const char *pszVRTPath,
+                                   GDALAccess eAccess);
     static GDALDataset *Create(const char *pszName, int nXSize, int nYSize,
                                int nBands, GDALDataType eType,
                                char **papszOptions);
@@ -664,6 +670,11 @@ class VRTProcessedDataset final : public VRTDataset
                    std::vector<double> &adfInNoData,
                    std::vector<double> &adfOutNoData);
     bool ProcessRegion(int nXOff, int nYOff, int nBufXSize, int nBufYSize);
+
+    bool ProcessPixelWiseSteps(size_t iFirstStep, size_t iLastStep,
+                               GDALDataType eInDT, int nBufXSize,
+                               int nBufYSize, double dfSrcXOff,
+                               double dfSrcYOff, const double adfSrcGT[6]);
 };
 
 /************************************************************************/
@@ -818,6 +829,7 @@ class CPL_DLL VRTRasterBand CPL_NON_FINAL : public GDALRasterBand
 /************************************************************************/
 
 class VRTSimpleSource;
+class CPLWorkerThreadPool;
 
 class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
 {
@@ -826,6 +838,19 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
     char **m_papszSourceList = nullptr;
     int m_nSkipBufferInitialization = -1;
 
+    //! Spatial index of the destination windows of the sources, lazily
+    //! built by GetSourcesIntersectingWindow() when there are many sources.
+    CPLQuadTree *m_hSourcesQuadTree = nullptr;
+
+    //! Value of nSources when m_hSourcesQuadTree was built.
+    int m_nSourcesInQuadTree = 0;
+
+    //! Allocated size of papoSources, in number of elements.
+    int m_nSourcesAllocated = 0;
+
+    void BuildSourcesQuadTree();
+    void InvalidateSourcesQuadTree();
+
     bool CanUseSourcesMinMaxImplementations();
 
     bool IsMosaicOfNonOverlappingSimpleSourcesOfFullRasterNoResAndTypeChange(
@@ -940,9 +965,32 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
 
     void RemoveCoveredSources(CSLConstList papszOptions = nullptr);
 
+    void GetSourcesIntersectingWindow(double dfXOff, double dfYOff,
+                                      double dfXSize, double dfYSize,
+                                      std::vector<int> &anSources);
+
     bool CanIRasterIOBeForwardedToEachSource(
         GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
-        int nBufXSize, int nBufYSize, GDALRasterIOExtraArg *psExtraArg) const;
+        int nBufXSize, int nBufYSize, GDALRasterIOExtraArg *psExtraArg);
+
+    bool IRasterIOFromSourceOverviews(int nXOff, int nYOff, int nXSize,
+                                      int nYSize, void *pData, int nBufXSize,
+                                      int nBufYSize, GDALDataType eBufType,
+                                      GSpacing nPixelSpace, GSpacing nLineSpace,
+                                      GDALRasterIOExtraArg *psExtraArg,
+                                      CPLErr &eErr);
+
+    CPLWorkerThreadPool *GetThreadPoolForSourcesRasterIO(
+        int nXOff, int nYOff, int nXSize, int nYSize, int nBufXSize,
+        int nBufYSize, const GDALRasterIOExtraArg *psExtraArg,
+        std::vector<int> &anContributingSources);
+
+    static CPLErr RunSourcesRasterIOInParallel(
+        CPLWorkerThreadPool *poThreadPool, const std::vector<int> &anSources,
+        const std::function<CPLErr(int, VRTSource::WorkingState &)>
+            &fnRasterIO);
+
+    static bool IsInSourcesRasterIOWorkerThread();
 
     virtual CPLErr IReadBlock(int, int, void *) override;
 
@@ -557,6 +557,9 @@ void GDALRegister_VRT()
         "relative paths inside the VRT. Mainly useful for inlined VRT, or "
         "in-memory "
         "VRT, where their own directory does not make sense'/>"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "worker threads used to read non-overlapping sources in parallel. "
+        "Integer or ALL_CPUS' default='GDAL_NUM_THREADS config option'/>"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DCAP_VIRTUALIO, "YES");
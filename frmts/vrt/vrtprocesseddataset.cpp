@@ -26,11 +26,15 @@
  * DEALINGS IN THE SOFTWARE.
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
 #include "cpl_minixml.h"
 #include "cpl_string.h"
+#include "gdal_thread_pool.h"
 #include "vrtdataset.h"
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <limits>
 #include <map>
 #include <vector>
@@ -83,6 +87,10 @@ struct VRTProcessedDatasetFunc
 
     //! Required processing function
     GDALVRTProcessedDatasetFuncProcess pfnProcess = nullptr;
+
+    //! Whether each output pixel only depends on the input pixel at the same
+    //! location, and pfnProcess() may be called concurrently (PIXEL_WISE=YES)
+    bool bPixelWise = false;
 };
 
 /************************************************************************/
@@ -956,11 +964,37 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
 
     GDALDataType eLastDT = eFirstDT;
     const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
-    for (const auto &oStep : m_aoSteps)
+    for (size_t iStep = 0; iStep < m_aoSteps.size(); ++iStep)
     {
+        const auto &oStep = m_aoSteps[iStep];
         const auto oIterFunc = oMapFunctions.find(oStep.osAlgorithm);
         CPLAssert(oIterFunc != oMapFunctions.end());
 
+        if (oIterFunc->second.bPixelWise)
+        {
+            // Process together the sequence of consecutive pixel-wise steps
+            size_t iLastStep = iStep;
+            while (iLastStep + 1 < m_aoSteps.size())
+            {
+                const auto oIterNextFunc =
+                    oMapFunctions.find(m_aoSteps[iLastStep + 1].osAlgorithm);
+                CPLAssert(oIterNextFunc != oMapFunctions.end());
+                if (!oIterNextFunc->second.bPixelWise)
+                    break;
+                ++iLastStep;
+            }
+            if (!ProcessPixelWiseSteps(iStep, iLastStep, eLastDT, nBufXSize,
+                                       nBufYSize, dfSrcXOff, dfSrcYOff,
+                                       adfSrcGT))
+            {
+                return false;
+            }
+            std::swap(abyInput, abyOutput);
+            eLastDT = m_aoSteps[iLastStep].eOutDT;
+            iStep = iLastStep;
+            continue;
+        }
+
         // Data type adaptation
         if (eLastDT != oStep.eInDT)
         {
@@ -1020,6 +1054,230 @@ bool VRTProcessedDataset::ProcessRegion(int nXOff, int nYOff, int nBufXSize,
     return true;
 }
 
+/************************************************************************/
+/*                         ProcessPixelWiseSteps()                      */
+/************************************************************************/
+
+// Set in worker threads of ProcessPixelWiseSteps()
+static thread_local bool tl_bInProcessedDatasetWorkerThread = false;
+
+/** Run the sequence of pixel-wise steps [iFirstStep, iLastStep] on
+ * m_abyInput (of data type eInDT), and store the result in m_abyOutput.
+ *
+ * The region is split in chunks of a few lines, and all the steps are
+ * applied on a chunk before moving to the next one, so that intermediate
+ * buffers are chunk-sized (and remain in CPU caches) instead of
+ * region-sized. Chunks are processed in parallel when the NUM_THREADS open
+ * option or the GDAL_NUM_THREADS configuration option is set.
+ */
+bool VRTProcessedDataset::ProcessPixelWiseSteps(
+    size_t iFirstStep, size_t iLastStep, GDALDataType eInDT, int nBufXSize,
+    int nBufYSize, double dfSrcXOff, double dfSrcYOff,
+    const double adfSrcGT[6])
+{
+    const auto &oMapFunctions = GetGlobalMapProcessedDatasetFunc();
+    const size_t nInLineSize = static_cast<size_t>(nBufXSize) *
+                               m_aoSteps[iFirstStep].nInBands *
+                               GDALGetDataTypeSizeBytes(eInDT);
+    const auto &oLastStep = m_aoSteps[iLastStep];
+    const size_t nOutLineSize = static_cast<size_t>(nBufXSize) *
+                                oLastStep.nOutBands *
+                                GDALGetDataTypeSizeBytes(oLastStep.eOutDT);
+    try
+    {
+        m_abyOutput.resize(nOutLineSize * nBufYSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory allocating working buffer");
+        return false;
+    }
+
+    // Process about 64K pixels at a time
+    constexpr int CHUNK_PIXEL_COUNT = 65536;
+    const int nLinesPerChunk =
+        std::min(nBufYSize, std::max(1, CHUNK_PIXEL_COUNT / nBufXSize));
+    const int nChunks = DIV_ROUND_UP(nBufYSize, nLinesPerChunk);
+
+    // Process chunk iChunk, using abyTmp1 and abyTmp2 as intermediate buffers
+    const std::function<bool(int, std::vector<NoInitByte> &,
+                             std::vector<NoInitByte> &)>
+        fnProcessChunk = [&](int iChunk, std::vector<NoInitByte> &abyTmp1,
+                             std::vector<NoInitByte> &abyTmp2)
+    {
+        const int nChunkYOff = iChunk * nLinesPerChunk;
+        const int nChunkLines =
+            std::min(nLinesPerChunk, nBufYSize - nChunkYOff);
+        const size_t nElts = static_cast<size_t>(nBufXSize) * nChunkLines;
+
+        std::vector<NoInitByte> *apabyTmp[] = {&abyTmp1, &abyTmp2};
+        int iTmp = 0;
+        const NoInitByte *pabyIn = m_abyInput.data() + nChunkYOff * nInLineSize;
+        size_t nInSize = nChunkLines * nInLineSize;
+        GDALDataType eCurDT = eInDT;
+        for (size_t iStep = iFirstStep; iStep <= iLastStep; ++iStep)
+        {
+            const auto &oStep = m_aoSteps[iStep];
+
+            try
+            {
+                // Data type adaptation
+                if (eCurDT != oStep.eInDT)
+                {
+                    auto &abyTmp = *(apabyTmp[iTmp]);
+                    iTmp = 1 - iTmp;
+                    abyTmp.resize(nElts * oStep.nInBands *
+                                  GDALGetDataTypeSizeBytes(oStep.eInDT));
+                    GDALCopyWords64(pabyIn, eCurDT,
+                                    GDALGetDataTypeSizeBytes(eCurDT),
+                                    abyTmp.data(), oStep.eInDT,
+                                    GDALGetDataTypeSizeBytes(oStep.eInDT),
+                                    nElts * oStep.nInBands);
+                    pabyIn = abyTmp.data();
+                    nInSize = abyTmp.size();
+                    eCurDT = oStep.eInDT;
+                }
+
+                NoInitByte *pabyOut;
+                const size_t nOutSize = nElts * oStep.nOutBands *
+                                        GDALGetDataTypeSizeBytes(oStep.eOutDT);
+                if (iStep == iLastStep)
+                {
+                    pabyOut = m_abyOutput.data() + nChunkYOff * nOutLineSize;
+                }
+                else
+                {
+                    auto &abyTmp = *(apabyTmp[iTmp]);
+                    iTmp = 1 - iTmp;
+                    abyTmp.resize(nOutSize);
+                    pabyOut = abyTmp.data();
+                }
+
+                const auto &oFunc =
+                    oMapFunctions.find(oStep.osAlgorithm)->second;
+                if (oFunc.pfnProcess(
+                        oStep.osAlgorithm.c_str(), oFunc.pUserData,
+                        oStep.pWorkingData, oStep.aosArguments.List(),
+                        nBufXSize, nChunkLines, pabyIn, nInSize, oStep.eInDT,
+                        oStep.nInBands, oStep.adfInNoData.data(), pabyOut,
+                        nOutSize, oStep.eOutDT, oStep.nOutBands,
+                        oStep.adfOutNoData.data(), dfSrcXOff,
+                        dfSrcYOff + nChunkYOff, nBufXSize, nChunkLines,
+                        adfSrcGT, m_osVRTPath.c_str(),
+                        /*papszExtra=*/nullptr) != CE_None)
+                {
+                    return false;
+                }
+
+                pabyIn = pabyOut;
+                nInSize = nOutSize;
+                eCurDT = oStep.eOutDT;
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating working buffer");
+                return false;
+            }
+        }
+        return true;
+    };
+
+    int nThreads = 1;
+    if (!tl_bInProcessedDatasetWorkerThread &&
+        !VRTSourcedRasterBand::IsInSourcesRasterIOWorkerThread())
+    {
+        const char *pszValue =
+            !m_osNumThreads.empty()
+                ? m_osNumThreads.c_str()
+                : CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+        if (pszValue)
+        {
+            nThreads =
+                EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+            if (nThreads > 1024)
+                nThreads = 1024;  // to please Coverity
+        }
+    }
+    nThreads = std::min(nThreads, nChunks);
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+    {
+        std::vector<NoInitByte> abyTmp1;
+        std::vector<NoInitByte> abyTmp2;
+        for (int iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            if (!fnProcessChunk(iChunk, abyTmp1, abyTmp2))
+                return false;
+        }
+        return true;
+    }
+
+    // Each job processes chunks until there are no more, with its own
+    // intermediate buffers
+    struct Job
+    {
+        const std::function<bool(int, std::vector<NoInitByte> &,
+                                 std::vector<NoInitByte> &)> *pfnProcessChunk =
+            nullptr;
+        std::atomic<int> *pnNextChunk = nullptr;
+        std::atomic<bool> *pbError = nullptr;
+        int nChunks = 0;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+        static void Run(void *pData)
+        {
+            Job *psJob = static_cast<Job *>(pData);
+            tl_bInProcessedDatasetWorkerThread = true;
+            CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+            std::vector<NoInitByte> abyTmp1;
+            std::vector<NoInitByte> abyTmp2;
+            while (!psJob->pbError->load())
+            {
+                const int iChunk = (*psJob->pnNextChunk)++;
+                if (iChunk >= psJob->nChunks)
+                    break;
+                if (!(*psJob->pfnProcessChunk)(iChunk, abyTmp1, abyTmp2))
+                    *psJob->pbError = true;
+            }
+            CPLUninstallErrorHandlerAccumulator();
+            tl_bInProcessedDatasetWorkerThread = false;
+        }
+    };
+
+    CPLDebugOnly("VRT", "Processing %d chunks with %d threads", nChunks,
+                 nThreads);
+    std::atomic<int> nNextChunk{0};
+    std::atomic<bool> bError{false};
+    std::vector<Job> asJobs(nThreads);
+    for (auto &sJob : asJobs)
+    {
+        sJob.pfnProcessChunk = &fnProcessChunk;
+        sJob.pnNextChunk = &nNextChunk;
+        sJob.pbError = &bError;
+        sJob.nChunks = nChunks;
+        if (!poQueue->SubmitJob(Job::Run, &sJob))
+        {
+            bError = true;
+            break;
+        }
+    }
+    poQueue->WaitCompletion();
+
+    // Re-emit errors in the calling thread
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+    }
+    return !bError;
+}
+
 /************************************************************************/
 /*                        VRTProcessedRasterBand()                      */
 /************************************************************************/
@@ -1177,7 +1435,14 @@ CPLErr VRTProcessedRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                 by pfnInit. May be nullptr.
  @param pfnProcess Processing function called to compute pixel values. Must
                    not be nullptr.
- @param papszOptions Unused currently. Must be nullptr.
+ @param papszOptions Options, or nullptr. Supported options (since 3.10):
+                     - PIXEL_WISE=YES/NO: whether the value of each output
+                       pixel only depends on the values of the input pixel at
+                       the same location, and pfnProcess can be called
+                       concurrently from several threads. Consecutive
+                       pixel-wise steps are then processed in a single pass
+                       over sub-regions of the input, potentially in parallel.
+                       Defaults to NO.
  @return CE_None in case of success, error otherwise.
  @since 3.9
  */
@@ -1189,7 +1454,7 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     GDALVRTProcessedDatasetFuncInit pfnInit,
     GDALVRTProcessedDatasetFuncFree pfnFree,
     GDALVRTProcessedDatasetFuncProcess pfnProcess,
-    CPL_UNUSED CSLConstList papszOptions)
+    CSLConstList papszOptions)
 {
     if (pszFuncName == nullptr || pszFuncName[0] == '\0')
     {
@@ -1335,6 +1600,8 @@ CPLErr GDALVRTRegisterProcessedDatasetFunc(
     oFunc.pfnInit = pfnInit;
     oFunc.pfnFree = pfnFree;
     oFunc.pfnProcess = pfnProcess;
+    oFunc.bPixelWise =
+        CPLTestBool(CSLFetchNameValueDef(papszOptions, "PIXEL_WISE", "NO"));
 
     oMap[pszFuncName] = std::move(oFunc);
 
@@ -45,15 +45,18 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_hash_set.h"
 #include "cpl_minixml.h"
 #include "cpl_progress.h"
 #include "cpl_quad_tree.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_thread_pool.h"
+#include "memdataset.h"
 #include "ogr_geometry.h"
 
 /*! @cond Doxygen_Suppress */
@@ -132,13 +135,114 @@ VRTSourcedRasterBand::~VRTSourcedRasterBand()
     CSLDestroy(m_papszSourceList);
 }
 
+/************************************************************************/
+/*                      InvalidateSourcesQuadTree()                     */
+/************************************************************************/
+
+void VRTSourcedRasterBand::InvalidateSourcesQuadTree()
+{
+    if (m_hSourcesQuadTree)
+    {
+        CPLQuadTreeDestroy(m_hSourcesQuadTree);
+        m_hSourcesQuadTree = nullptr;
+    }
+    m_nSourcesInQuadTree = 0;
+}
+
+/************************************************************************/
+/*                        BuildSourcesQuadTree()                        */
+/************************************************************************/
+
+void VRTSourcedRasterBand::BuildSourcesQuadTree()
+{
+    InvalidateSourcesQuadTree();
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = 0;
+    sGlobalBounds.miny = 0;
+    sGlobalBounds.maxx = nRasterXSize;
+    sGlobalBounds.maxy = nRasterYSize;
+    m_hSourcesQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    for (int i = 0; i < nSources; ++i)
+    {
+        // Sources that are not simple sources, or that have no destination
+        // window, are assumed to cover the whole raster.
+        CPLRectObj sBounds = sGlobalBounds;
+        if (papoSources[i]->IsSimpleSource())
+        {
+            const VRTSimpleSource *poSS =
+                static_cast<const VRTSimpleSource *>(papoSources[i]);
+            if (poSS->m_dfDstXOff != -1 || poSS->m_dfDstXSize != -1 ||
+                poSS->m_dfDstYOff != -1 || poSS->m_dfDstYSize != -1)
+            {
+                sBounds.minx = poSS->m_dfDstXOff;
+                sBounds.miny = poSS->m_dfDstYOff;
+                sBounds.maxx = poSS->m_dfDstXOff + poSS->m_dfDstXSize;
+                sBounds.maxy = poSS->m_dfDstYOff + poSS->m_dfDstYSize;
+            }
+        }
+        CPLQuadTreeInsertWithBounds(
+            m_hSourcesQuadTree,
+            reinterpret_cast<void *>(static_cast<uintptr_t>(i)), &sBounds);
+    }
+    m_nSourcesInQuadTree = nSources;
+}
+
+/************************************************************************/
+/*                    GetSourcesIntersectingWindow()                    */
+/*                                                                      */
+/*      Fill anSources with the indices, in increasing order, of the    */
+/*      sources whose destination window may intersect the passed       */
+/*      window. For bands with many sources, this uses a spatial index  */
+/*      of their destination windows, built on first use.               */
+/************************************************************************/
+
+void VRTSourcedRasterBand::GetSourcesIntersectingWindow(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    std::vector<int> &anSources)
+{
+    anSources.clear();
+
+    // Below that number of sources, a linear scan is cheap enough
+    constexpr int MIN_SOURCES_FOR_SPATIAL_INDEX = 64;
+    if (nSources < MIN_SOURCES_FOR_SPATIAL_INDEX)
+    {
+        anSources.reserve(nSources);
+        for (int i = 0; i < nSources; ++i)
+            anSources.push_back(i);
+        return;
+    }
+
+    if (m_hSourcesQuadTree == nullptr || m_nSourcesInQuadTree != nSources)
+        BuildSourcesQuadTree();
+
+    CPLRectObj sBounds;
+    sBounds.minx = dfXOff;
+    sBounds.miny = dfYOff;
+    sBounds.maxx = dfXOff + dfXSize;
+    sBounds.maxy = dfYOff + dfYSize;
+    int nFeatureCount = 0;
+    void **pahRet =
+        CPLQuadTreeSearch(m_hSourcesQuadTree, &sBounds, &nFeatureCount);
+    anSources.reserve(nFeatureCount);
+    for (int i = 0; i < nFeatureCount; ++i)
+    {
+        anSources.push_back(
+            static_cast<int>(reinterpret_cast<uintptr_t>(pahRet[i])));
+    }
+    CPLFree(pahRet);
+
+    // Sources must be composited in their priority order
+    std::sort(anSources.begin(), anSources.end());
+}
+
 /************************************************************************/
 /*                  CanIRasterIOBeForwardedToEachSource()               */
 /************************************************************************/
 
 bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
     GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
-    int nBufXSize, int nBufYSize, GDALRasterIOExtraArg *psExtraArg) const
+    int nBufXSize, int nBufYSize, GDALRasterIOExtraArg *psExtraArg)
 {
     // If resampling with non-nearest neighbour, we need to be careful
     // if the VRT band exposes a nodata value, but the sources do not have it.
@@ -153,7 +257,23 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
         const bool bIsDownsampling = (nBufXSize < nXSize && nBufYSize < nYSize);
         int nContributingSources = 0;
         bool bSourceFullySatisfiesRequest = true;
-        for (int i = 0; i < nSources; i++)
+
+        double dfXOff = nXOff;
+        double dfYOff = nYOff;
+        double dfXSize = nXSize;
+        double dfYSize = nYSize;
+        if (psExtraArg->bFloatingPointWindowValidity)
+        {
+            dfXOff = psExtraArg->dfXOff;
+            dfYOff = psExtraArg->dfYOff;
+            dfXSize = psExtraArg->dfXSize;
+            dfYSize = psExtraArg->dfYSize;
+        }
+
+        std::vector<int> anSources;
+        GetSourcesIntersectingWindow(dfXOff, dfYOff, dfXSize, dfYSize,
+                                     anSources);
+        for (const int i : anSources)
         {
             if (!papoSources[i]->IsSimpleSource())
             {
@@ -164,18 +284,6 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
                 VRTSimpleSource *const poSource =
                     static_cast<VRTSimpleSource *>(papoSources[i]);
 
-                double dfXOff = nXOff;
-                double dfYOff = nYOff;
-                double dfXSize = nXSize;
-                double dfYSize = nYSize;
-                if (psExtraArg->bFloatingPointWindowValidity)
-                {
-                    dfXOff = psExtraArg->dfXOff;
-                    dfYOff = psExtraArg->dfYOff;
-                    dfXSize = psExtraArg->dfXSize;
-                    dfYSize = psExtraArg->dfYSize;
-                }
-
                 // The window we will actually request from the source raster
                 // band.
                 double dfReqXOff = 0.0;
@@ -239,6 +347,396 @@ bool VRTSourcedRasterBand::CanIRasterIOBeForwardedToEachSource(
     return true;
 }
 
+// Set in worker threads of RunSourcesRasterIOInParallel(), so that nested
+// VRTs do not wait for jobs of the same thread pool from one of its threads.
+static thread_local bool tl_bInSourcesRasterIOWorkerThread = false;
+
+/************************************************************************/
+/*                   IRasterIOFromSourceOverviews()                     */
+/*                                                                      */
+/*      Used for downsampling requests with a non-nearest resampling    */
+/*      method that cannot be forwarded to each source.                 */
+/*      Instead of acquiring the window at the nominal resolution of    */
+/*      the VRT, and then resampling it, acquire it with nearest        */
+/*      neighbour at an intermediate resolution corresponding to the    */
+/*      (finest among contributing sources) closest overview level of   */
+/*      each source, so that sources read from their overviews, and     */
+/*      then resample that intermediate buffer.                         */
+/*      Returns false if not applicable.                                */
+/************************************************************************/
+
+bool VRTSourcedRasterBand::IRasterIOFromSourceOverviews(
+    int nXOff, int nYOff, int nXSize, int nYSize, void *pData, int nBufXSize,
+    int nBufYSize, GDALDataType eBufType, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg, CPLErr &eErr)
+{
+    if (nBufXSize >= nXSize || nBufYSize >= nYSize || nBand == 0 ||
+        psExtraArg->eResampleAlg == GRIORA_NearestNeighbour ||
+        m_bNoDataSetAsInt64 || m_bNoDataSetAsUInt64)
+    {
+        return false;
+    }
+
+    // The intermediate buffer being wrapped as a MEM dataset, we can only
+    // deal with the cases where the validity of pixels is fully determined
+    // by the nodata value.
+    const int nThisMaskFlags = GetMaskFlags();
+    if (nThisMaskFlags != GMF_ALL_VALID && nThisMaskFlags != GMF_NODATA)
+        return false;
+
+    double dfXOff = nXOff;
+    double dfYOff = nYOff;
+    double dfXSize = nXSize;
+    double dfYSize = nYSize;
+    if (psExtraArg->bFloatingPointWindowValidity)
+    {
+        dfXOff = psExtraArg->dfXOff;
+        dfYOff = psExtraArg->dfYOff;
+        dfXSize = psExtraArg->dfXSize;
+        dfYSize = psExtraArg->dfYSize;
+    }
+    const double dfReqFactor =
+        std::min(dfXSize / nBufXSize, dfYSize / nBufYSize);
+
+    // Compute the downsampling factor, relative to the VRT, of the
+    // intermediate buffer.
+    std::vector<int> anSources;
+    GetSourcesIntersectingWindow(dfXOff, dfYOff, dfXSize, dfYSize, anSources);
+    double dfFactor = dfReqFactor;
+    int nContributingSources = 0;
+    for (const int i : anSources)
+    {
+        if (!papoSources[i]->IsSimpleSource())
+            return false;
+        VRTSimpleSource *const poSource =
+            static_cast<VRTSimpleSource *>(papoSources[i]);
+
+        double dfReqXOff = 0.0;
+        double dfReqYOff = 0.0;
+        double dfReqXSize = 0.0;
+        double dfReqYSize = 0.0;
+        int nReqXOff = 0;
+        int nReqYOff = 0;
+        int nReqXSize = 0;
+        int nReqYSize = 0;
+        int nOutXOff = 0;
+        int nOutYOff = 0;
+        int nOutXSize = 0;
+        int nOutYSize = 0;
+        bool bError = false;
+        if (!poSource->GetSrcDstWindow(
+                dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize,
+                &dfReqXOff, &dfReqYOff, &dfReqXSize, &dfReqYSize, &nReqXOff,
+                &nReqYOff, &nReqXSize, &nReqYSize, &nOutXOff, &nOutYOff,
+                &nOutXSize, &nOutYSize, bError))
+        {
+            if (bError)
+                return false;
+            continue;
+        }
+        auto poSrcBand = poSource->GetRasterBand();
+        if (poSrcBand == nullptr || poSrcBand->GetXSize() == 0 ||
+            poSrcBand->GetYSize() == 0)
+            return false;
+        ++nContributingSources;
+
+        // Downsampling factor of the source, in source pixels
+        const double dfSrcReqFactor =
+            std::min(dfReqXSize / nOutXSize, dfReqYSize / nOutYSize);
+        // Factor of the closest source overview not coarser than requested
+        double dfSrcOvrFactor = 1.0;
+        const int nOvrCount = poSrcBand->GetOverviewCount();
+        for (int iOvr = 0; iOvr < nOvrCount; ++iOvr)
+        {
+            auto poOvrBand = poSrcBand->GetOverview(iOvr);
+            if (poOvrBand == nullptr || poOvrBand->GetXSize() == 0 ||
+                poOvrBand->GetYSize() == 0)
+                continue;
+            const double dfOvrFactor = std::min(
+                static_cast<double>(poSrcBand->GetXSize()) /
+                    poOvrBand->GetXSize(),
+                static_cast<double>(poSrcBand->GetYSize()) /
+                    poOvrBand->GetYSize());
+            if (dfOvrFactor <= dfSrcReqFactor && dfOvrFactor > dfSrcOvrFactor)
+                dfSrcOvrFactor = dfOvrFactor;
+        }
+        // Expressed relatively to the VRT
+        dfFactor =
+            std::min(dfFactor, dfSrcOvrFactor / dfSrcReqFactor * dfReqFactor);
+        if (dfFactor < 2)
+            return false;
+    }
+    if (nContributingSources == 0)
+        return false;
+
+    const int nTmpXSize = std::min(
+        nXSize, std::max(nBufXSize, static_cast<int>(std::ceil(
+                                        nXSize / dfFactor - 1e-5))));
+    const int nTmpYSize = std::min(
+        nYSize, std::max(nBufYSize, static_cast<int>(std::ceil(
+                                        nYSize / dfFactor - 1e-5))));
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    void *pTmpBuffer = VSI_MALLOC3_VERBOSE(nTmpXSize, nTmpYSize, nDTSize);
+    if (pTmpBuffer == nullptr)
+    {
+        eErr = CE_Failure;
+        return true;
+    }
+
+    CPLDebugOnly("VRT",
+                 "Acquiring %dx%d window at %dx%d before resampling to %dx%d",
+                 nXSize, nYSize, nTmpXSize, nTmpYSize, nBufXSize, nBufYSize);
+
+    GDALRasterIOExtraArg sExtraArg;
+    INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+    sExtraArg.eResampleAlg = GRIORA_NearestNeighbour;
+    sExtraArg.pfnProgress = psExtraArg->pfnProgress;
+    sExtraArg.pProgressData = psExtraArg->pProgressData;
+    eErr = IRasterIO(GF_Read, nXOff, nYOff, nXSize, nYSize, pTmpBuffer,
+                     nTmpXSize, nTmpYSize, eDataType, nDTSize,
+                     static_cast<GSpacing>(nDTSize) * nTmpXSize, &sExtraArg);
+    if (eErr == CE_None)
+    {
+        auto poMEMDS = std::unique_ptr<MEMDataset>(MEMDataset::Create(
+            "", nTmpXSize, nTmpYSize, 0, eDataType, nullptr));
+        if (poMEMDS)
+        {
+            poMEMDS->AddMEMBand(MEMCreateRasterBandEx(
+                poMEMDS.get(), 1, static_cast<GByte *>(pTmpBuffer), eDataType,
+                0, 0, false));
+            auto poMEMBand = poMEMDS->GetRasterBand(1);
+            if (nThisMaskFlags == GMF_NODATA)
+                poMEMBand->SetNoDataValue(m_dfNoDataValue);
+
+            const double dfXRatio = static_cast<double>(nTmpXSize) / nXSize;
+            const double dfYRatio = static_cast<double>(nTmpYSize) / nYSize;
+            INIT_RASTERIO_EXTRA_ARG(sExtraArg);
+            sExtraArg.eResampleAlg = psExtraArg->eResampleAlg;
+            sExtraArg.bFloatingPointWindowValidity = TRUE;
+            sExtraArg.dfXOff = (dfXOff - nXOff) * dfXRatio;
+            sExtraArg.dfYOff = (dfYOff - nYOff) * dfYRatio;
+            sExtraArg.dfXSize = dfXSize * dfXRatio;
+            sExtraArg.dfYSize = dfYSize * dfYRatio;
+            eErr = poMEMBand->RasterIO(
+                GF_Read, 0, 0, nTmpXSize, nTmpYSize, pData, nBufXSize,
+                nBufYSize, eBufType, nPixelSpace, nLineSpace, &sExtraArg);
+        }
+        else
+        {
+            eErr = CE_Failure;
+        }
+    }
+    VSIFree(pTmpBuffer);
+    return true;
+}
+
+/************************************************************************/
+/*                  GetThreadPoolForSourcesRasterIO()                   */
+/*                                                                      */
+/*      Returns a thread pool if the sources contributing to the        */
+/*      request can be read in parallel, that is if there are several   */
+/*      of them, they are all simple sources belonging to different     */
+/*      datasets, and their windows in the output buffer do not         */
+/*      overlap (so that their order does not matter).                  */
+/*      anContributingSources is then filled with their indices.        */
+/************************************************************************/
+
+CPLWorkerThreadPool *VRTSourcedRasterBand::GetThreadPoolForSourcesRasterIO(
+    int nXOff, int nYOff, int nXSize, int nYSize, int nBufXSize,
+    int nBufYSize, const GDALRasterIOExtraArg *psExtraArg,
+    std::vector<int> &anContributingSources)
+{
+    anContributingSources.clear();
+    if (nSources < 2 || tl_bInSourcesRasterIOWorkerThread ||
+        (psExtraArg->pfnProgress != nullptr &&
+         psExtraArg->pfnProgress != GDALDummyProgress))
+    {
+        return nullptr;
+    }
+
+    auto l_poDS = dynamic_cast<const VRTDataset *>(poDS);
+    const char *pszValue =
+        l_poDS && !l_poDS->m_osNumThreads.empty()
+            ? l_poDS->m_osNumThreads.c_str()
+            : CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszValue == nullptr)
+        return nullptr;
+    int nThreads =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    if (nThreads > 1024)
+        nThreads = 1024;  // to please Coverity
+    if (nThreads <= 1)
+        return nullptr;
+
+    double dfXOff = nXOff;
+    double dfYOff = nYOff;
+    double dfXSize = nXSize;
+    double dfYSize = nYSize;
+    if (psExtraArg->bFloatingPointWindowValidity)
+    {
+        dfXOff = psExtraArg->dfXOff;
+        dfYOff = psExtraArg->dfYOff;
+        dfXSize = psExtraArg->dfXSize;
+        dfYSize = psExtraArg->dfYSize;
+    }
+
+    struct Window
+    {
+        int nXOff;
+        int nYOff;
+        int nXSize;
+        int nYSize;
+    };
+
+    std::vector<int> anSources;
+    GetSourcesIntersectingWindow(dfXOff, dfYOff, dfXSize, dfYSize, anSources);
+
+    std::vector<Window> asWindows;
+    std::set<std::string> oSetDatasetNames;
+    std::set<GDALDataset *> oSetDatasetPointers;
+    for (const int i : anSources)
+    {
+        if (!papoSources[i]->IsSimpleSource())
+            return nullptr;
+        VRTSimpleSource *const poSource =
+            static_cast<VRTSimpleSource *>(papoSources[i]);
+
+        double dfReqXOff = 0.0;
+        double dfReqYOff = 0.0;
+        double dfReqXSize = 0.0;
+        double dfReqYSize = 0.0;
+        int nReqXOff = 0;
+        int nReqYOff = 0;
+        int nReqXSize = 0;
+        int nReqYSize = 0;
+        Window sWindow;
+        bool bError = false;
+        if (!poSource->GetSrcDstWindow(
+                dfXOff, dfYOff, dfXSize, dfYSize, nBufXSize, nBufYSize,
+                &dfReqXOff, &dfReqYOff, &dfReqXSize, &dfReqYSize, &nReqXOff,
+                &nReqYOff, &nReqXSize, &nReqYSize, &sWindow.nXOff,
+                &sWindow.nYOff, &sWindow.nXSize, &sWindow.nYSize, bError))
+        {
+            if (bError)
+                return nullptr;
+            continue;
+        }
+
+        // Check that all contributing sources refer to different datasets.
+        // If the datasets belong to the MEM driver, check GDALDataset*
+        // pointer values. Otherwise use dataset name.
+        auto poSourceBand = poSource->GetRasterBand();
+        auto poSourceDataset =
+            poSourceBand ? poSourceBand->GetDataset() : nullptr;
+        if (poSourceDataset == nullptr)
+            return nullptr;
+        auto poDriver = poSourceDataset->GetDriver();
+        if (poDriver && EQUAL(poDriver->GetDescription(), "MEM"))
+        {
+            if (!oSetDatasetPointers.insert(poSourceDataset).second)
+                return nullptr;
+        }
+        else if (!oSetDatasetNames.insert(poSourceDataset->GetDescription())
+                      .second)
+        {
+            return nullptr;
+        }
+
+        for (const auto &sOther : asWindows)
+        {
+            if (sWindow.nXOff < sOther.nXOff + sOther.nXSize &&
+                sOther.nXOff < sWindow.nXOff + sWindow.nXSize &&
+                sWindow.nYOff < sOther.nYOff + sOther.nYSize &&
+                sOther.nYOff < sWindow.nYOff + sWindow.nYSize)
+            {
+                return nullptr;
+            }
+        }
+        asWindows.push_back(sWindow);
+        anContributingSources.push_back(i);
+    }
+
+    if (anContributingSources.size() < 2)
+    {
+        anContributingSources.clear();
+        return nullptr;
+    }
+    return GDALGetGlobalThreadPool(nThreads);
+}
+
+/************************************************************************/
+/*                  IsInSourcesRasterIOWorkerThread()                   */
+/************************************************************************/
+
+//! Whether the current thread is a worker thread of
+//! RunSourcesRasterIOInParallel()
+bool VRTSourcedRasterBand::IsInSourcesRasterIOWorkerThread()
+{
+    return tl_bInSourcesRasterIOWorkerThread;
+}
+
+/************************************************************************/
+/*                    RunSourcesRasterIOInParallel()                    */
+/************************************************************************/
+
+CPLErr VRTSourcedRasterBand::RunSourcesRasterIOInParallel(
+    CPLWorkerThreadPool *poThreadPool, const std::vector<int> &anSources,
+    const std::function<CPLErr(int, VRTSource::WorkingState &)> &fnRasterIO)
+{
+    auto poQueue = poThreadPool->CreateJobQueue();
+    if (!poQueue)
+        return CE_Failure;
+
+    struct Job
+    {
+        const std::function<CPLErr(int, VRTSource::WorkingState &)>
+            *pfnRasterIO = nullptr;
+        int iSource = 0;
+        CPLErr eErr = CE_None;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+        static void Run(void *pData)
+        {
+            Job *psJob = static_cast<Job *>(pData);
+            tl_bInSourcesRasterIOWorkerThread = true;
+            CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+            // Each job has its own working buffers
+            VRTSource::WorkingState oWorkingState;
+            psJob->eErr = (*psJob->pfnRasterIO)(psJob->iSource, oWorkingState);
+            CPLUninstallErrorHandlerAccumulator();
+            tl_bInSourcesRasterIOWorkerThread = false;
+        }
+    };
+
+    CPLDebugOnly("VRT", "Reading %d sources with multi-threading",
+                 static_cast<int>(anSources.size()));
+    std::vector<Job> asJobs(anSources.size());
+    CPLErr eErr = CE_None;
+    for (size_t i = 0; i < anSources.size(); ++i)
+    {
+        asJobs[i].pfnRasterIO = &fnRasterIO;
+        asJobs[i].iSource = anSources[i];
+        if (!poQueue->SubmitJob(Job::Run, &asJobs[i]))
+        {
+            eErr = CE_Failure;
+            break;
+        }
+    }
+    poQueue->WaitCompletion();
+
+    // Re-emit errors in the calling thread
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        if (sJob.eErr != CE_None)
+            eErr = sJob.eErr;
+    }
+    return eErr;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -297,6 +795,18 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
                       eRWFlag, nXOff, nYOff, nXSize, nYSize, nBufXSize,
                       nBufYSize, psExtraArg))
     {
+        // Avoid acquiring sources at their nominal resolution if they all
+        // have overviews
+        CPLErr eErrOvr = CE_None;
+        if (eRWFlag == GF_Read &&
+            IRasterIOFromSourceOverviews(nXOff, nYOff, nXSize, nYSize, pData,
+                                         nBufXSize, nBufYSize, eBufType,
+                                         nPixelSpace, nLineSpace, psExtraArg,
+                                         eErrOvr))
+        {
+            return eErrOvr;
+        }
+
         const bool bBackupEnabledOverviews = l_poDS->AreOverviewsEnabled();
         if (!l_poDS->m_apoOverviews.empty() && l_poDS->AreOverviewsEnabled())
         {
@@ -354,16 +864,55 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
     GDALProgressFunc const pfnProgressGlobal = psExtraArg->pfnProgress;
     void *const pProgressDataGlobal = psExtraArg->pProgressData;
 
+    /* -------------------------------------------------------------------- */
+    /*      Read non-overlapping sources in parallel if possible.           */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anContributingSources;
+    if (CPLWorkerThreadPool *poThreadPool = GetThreadPoolForSourcesRasterIO(
+            nXOff, nYOff, nXSize, nYSize, nBufXSize, nBufYSize, psExtraArg,
+            anContributingSources))
+    {
+        return RunSourcesRasterIOInParallel(
+            poThreadPool, anContributingSources,
+            [this, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+             eBufType, nPixelSpace, nLineSpace,
+             psExtraArg](int iSource, VRTSource::WorkingState &oWorkingState)
+            {
+                GDALRasterIOExtraArg sExtraArg(*psExtraArg);
+                return papoSources[iSource]->RasterIO(
+                    eDataType, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                    nBufYSize, eBufType, nPixelSpace, nLineSpace, &sExtraArg,
+                    oWorkingState);
+            });
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Overlay each source in turn over top this.                      */
     /* -------------------------------------------------------------------- */
+    double dfXOff = nXOff;
+    double dfYOff = nYOff;
+    double dfXSize = nXSize;
+    double dfYSize = nYSize;
+    if (psExtraArg->bFloatingPointWindowValidity)
+    {
+        dfXOff = psExtraArg->dfXOff;
+        dfYOff = psExtraArg->dfYOff;
+        dfXSize = psExtraArg->dfXSize;
+        dfYSize = psExtraArg->dfYSize;
+    }
+
+    std::vector<int> anSources;
+    GetSourcesIntersectingWindow(dfXOff, dfYOff, dfXSize, dfYSize, anSources);
+    const int nCandidateSources = static_cast<int>(anSources.size());
+
     CPLErr eErr = CE_None;
     VRTSource::WorkingState oWorkingState;
-    for (int iSource = 0; eErr == CE_None && iSource < nSources; iSource++)
+    for (int i = 0; eErr == CE_None && i < nCandidateSources; i++)
     {
+        const int iSource = anSources[i];
         psExtraArg->pfnProgress = GDALScaledProgress;
         psExtraArg->pProgressData = GDALCreateScaledProgress(
-            1.0 * iSource / nSources, 1.0 * (iSource + 1) / nSources,
+            1.0 * i / nCandidateSources, 1.0 * (i + 1) / nCandidateSources,
             pfnProgressGlobal, pProgressDataGlobal);
         if (psExtraArg->pProgressData == nullptr)
             psExtraArg->pfnProgress = nullptr;
@@ -416,7 +965,9 @@ int VRTSourcedRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff,
     poLR->addPoint(nXOff, nYOff);
     poPolyNonCoveredBySources->addRingDirectly(poLR);
 
-    for (int iSource = 0; iSource < nSources; iSource++)
+    std::vector<int> anSources;
+    GetSourcesIntersectingWindow(nXOff, nYOff, nXSize, nYSize, anSources);
+    for (const int iSource : anSources)
     {
         if (!papoSources[iSource]->IsSimpleSource())
         {
@@ -1761,10 +2312,35 @@ CPLErr VRTSourcedRasterBand::GetHistogram(double dfMin, double dfMax,
 CPLErr VRTSourcedRasterBand::AddSource(VRTSource *poNewSource)
 
 {
-    nSources++;
+    InvalidateSourcesQuadTree();
 
-    papoSources = static_cast<VRTSource **>(
-        CPLRealloc(papoSources, sizeof(void *) * nSources));
+    // Grow the array geometrically, to avoid a reallocation for each of
+    // the sources of huge VRTs
+    if (nSources == m_nSourcesAllocated)
+    {
+        const int nNewAlloc = m_nSourcesAllocated < 16
+                                  ? 16
+                                  : m_nSourcesAllocated >= INT_MAX / 2
+                                        ? INT_MAX
+                                        : m_nSourcesAllocated * 2;
+        if (nSources == nNewAlloc)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "Too many sources");
+            delete poNewSource;
+            return CE_Failure;
+        }
+        VRTSource **papoNewSources = static_cast<VRTSource **>(
+            VSI_REALLOC_VERBOSE(papoSources, sizeof(void *) * nNewAlloc));
+        if (papoNewSources == nullptr)
+        {
+            delete poNewSource;
+            return CE_Failure;
+        }
+        papoSources = papoNewSources;
+        m_nSourcesAllocated = nNewAlloc;
+    }
+
+    nSources++;
     papoSources[nSources - 1] = poNewSource;
 
     static_cast<VRTDataset *>(poDS)->SetNeedsFlush();
@@ -2580,6 +3156,7 @@ CPLErr VRTSourcedRasterBand::SetMetadataItem(const char *pszName,
         {
             delete papoSources[iSource];
             papoSources[iSource] = poSource;
+            InvalidateSourcesQuadTree();
             static_cast<VRTDataset *>(poDS)->SetNeedsFlush();
             return CE_None;
         }
@@ -2606,11 +3183,13 @@ CPLErr VRTSourcedRasterBand::SetMetadata(char **papszNewMD,
 
         if (EQUAL(pszDomain, "vrt_sources"))
         {
+            InvalidateSourcesQuadTree();
             for (int i = 0; i < nSources; i++)
                 delete papoSources[i];
             CPLFree(papoSources);
             papoSources = nullptr;
             nSources = 0;
+            m_nSourcesAllocated = 0;
         }
 
         for (const char *const pszMDItem :
@@ -2667,6 +3246,8 @@ int VRTSourcedRasterBand::CloseDependentDatasets()
 {
     int ret = VRTRasterBand::CloseDependentDatasets();
 
+    InvalidateSourcesQuadTree();
+
     if (nSources == 0)
         return ret;
 
@@ -2676,6 +3257,7 @@ int VRTSourcedRasterBand::CloseDependentDatasets()
     CPLFree(papoSources);
     papoSources = nullptr;
     nSources = 0;
+    m_nSourcesAllocated = 0;
 
     return TRUE;
 }
@@ -2863,6 +3445,7 @@ void VRTSourcedRasterBand::RemoveCoveredSources(CSLConstList papszOptions)
     }
 
     // Compact the papoSources array
+    InvalidateSourcesQuadTree();
     int iDst = 0;
     for (int iSrc = 0; iSrc < nSources; iSrc++)
     {
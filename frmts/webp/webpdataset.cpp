@@ -912,6 +912,19 @@ GDALDataset *WEBPDataset::CreateCopy(const char *pszFilename,
 #if WEBP_ENCODER_ABI_VERSION >= 0x0209
     FETCH_AND_SET_OPTION_INT("EXACT", exact, 0, 1);
 #endif
+#if WEBP_ENCODER_ABI_VERSION >= 0x0201
+    {
+        // libwebp can only use an extra thread (for the analysis and the
+        // alpha channel encoding), so any value greater than 1 enables it.
+        const char *pszNumThreads =
+            CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                                 CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+        const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(pszNumThreads);
+        sConfig.thread_level = nThreads > 1 ? 1 : 0;
+    }
+#endif
 
     if (!WebPValidateConfig(&sConfig))
     {
@@ -119,6 +119,11 @@ void WEBPDriverSetCommonMetadata(GDALDriver *poDriver)
 #if WEBP_ENCODER_ABI_VERSION >= 0x0209
         "   <Option name='EXACT' type='int' description='preserve the exact "
         "RGB values under transparent area. off=0, on=1' default='0'/>\n"
+#endif
+#if WEBP_ENCODER_ABI_VERSION >= 0x0201
+        "   <Option name='NUM_THREADS' type='string' description='Number of "
+        "worker threads for encoding. Any value greater than 1 enables "
+        "multi-threaded encoding. Can be set to ALL_CPUS' default='1'/>\n"
 #endif
         "</CreationOptionList>\n");
 
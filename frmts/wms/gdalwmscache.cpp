@@ -32,6 +32,11 @@
 #include "cpl_md5.h"
 #include "wmsdriver.h"
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 static void CleanCacheThread(void *pData)
 {
     GDALWMSCache *pCache = static_cast<GDALWMSCache *>(pData);
@@ -50,6 +55,9 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
           m_nMaxSize(67108864),          // 64 Mb
           m_nCleanThreadRunTimeout(120)  // 3 min
     {
+        m_bWriteBehind =
+            CPLTestBool(CPLGetXMLValue(pConfig, "WriteBehind", "false"));
+
         const char *pszCacheDepth = CPLGetXMLValue(pConfig, "Depth", "2");
         if (pszCacheDepth != nullptr)
             m_nDepth = atoi(pszCacheDepth);
@@ -82,6 +90,20 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
         }
     }
 
+    virtual ~GDALWMSFileCache()
+    {
+        // Flush pending writes
+        if (m_oWriterThread.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                m_bStopWriter = true;
+            }
+            m_oCV.notify_all();
+            m_oWriterThread.join();
+        }
+    }
+
     virtual int GetCleanThreadRunTimeout() override
     {
         return m_nCleanThreadRunTimeout;
@@ -92,6 +114,8 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     {
         // Warns if it fails to write, but returns success
         CPLString soFilePath = GetFilePath(pszKey);
+        if (m_bWriteBehind && QueueWrite(soFilePath, osFileName))
+            return CE_None;
         MakeDirs(CPLGetDirname(soFilePath));
         if (CPLCopyFile(soFilePath, osFileName) == CE_None)
             return CE_None;
@@ -104,8 +128,15 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     virtual enum GDALWMSCacheItemStatus
     GetItemStatus(const char *pszKey) const override
     {
+        const CPLString soFilePath = GetFilePath(pszKey);
+        if (m_bWriteBehind)
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            if (m_oPendingPaths.find(soFilePath) != m_oPendingPaths.end())
+                return CACHE_ITEM_OK;
+        }
         VSIStatBufL sStatBuf;
-        if (VSIStatL(GetFilePath(pszKey), &sStatBuf) == 0)
+        if (VSIStatL(soFilePath, &sStatBuf) == 0)
         {
             long seconds = static_cast<long>(time(nullptr) - sStatBuf.st_mtime);
             return seconds < m_nExpires ? CACHE_ITEM_OK : CACHE_ITEM_EXPIRED;
@@ -116,8 +147,16 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     virtual GDALDataset *GetDataset(const char *pszKey,
                                     char **papszOpenOptions) const override
     {
+        const CPLString soFilePath = GetFilePath(pszKey);
+        if (m_bWriteBehind)
+        {
+            // Wait for the tile to be written if it is still queued
+            std::unique_lock<std::mutex> oLock(m_oMutex);
+            m_oCV.wait(oLock, [this, &soFilePath]
+                       { return m_oPendingPaths.count(soFilePath) == 0; });
+        }
         return GDALDataset::FromHandle(GDALOpenEx(
-            GetFilePath(pszKey),
+            soFilePath,
             GDAL_OF_RASTER | GDAL_OF_READONLY | GDAL_OF_VERBOSE_ERROR, nullptr,
             papszOpenOptions, nullptr));
     }
@@ -130,25 +169,31 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
             return;
         }
 
+        struct CacheFile
+        {
+            int nIdx;
+            time_t nMTime;
+            long nSize;
+        };
+
         int counter = 0;
-        std::vector<int> toDelete;
+        std::vector<CacheFile> aoFiles;
         long nSize = 0;
         time_t nTime = time(nullptr);
         while (papszList[counter] != nullptr)
         {
-            const char *pszPath =
-                CPLFormFilename(m_soPath, papszList[counter], nullptr);
-            VSIStatBufL sStatBuf;
-            if (VSIStatL(pszPath, &sStatBuf) == 0)
+            // Skip files being written by the write-behind thread
+            if (!EQUAL(CPLGetExtension(papszList[counter]), "tmp"))
             {
-                if (!VSI_ISDIR(sStatBuf.st_mode))
+                const char *pszPath =
+                    CPLFormFilename(m_soPath, papszList[counter], nullptr);
+                VSIStatBufL sStatBuf;
+                if (VSIStatL(pszPath, &sStatBuf) == 0 &&
+                    !VSI_ISDIR(sStatBuf.st_mode))
                 {
-                    long seconds = static_cast<long>(nTime - sStatBuf.st_mtime);
-                    if (seconds > m_nExpires)
-                    {
-                        toDelete.push_back(counter);
-                    }
-
+                    aoFiles.push_back(
+                        {counter, sStatBuf.st_mtime,
+                         static_cast<long>(sStatBuf.st_size)});
                     nSize += static_cast<long>(sStatBuf.st_size);
                 }
             }
@@ -157,20 +202,109 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
 
         if (nSize > m_nMaxSize)
         {
-            CPLDebug("WMS", "Delete %u items from cache",
-                     static_cast<unsigned int>(toDelete.size()));
-            for (size_t i = 0; i < toDelete.size(); ++i)
+            // Delete expired files first, and then the least recently
+            // written ones until the cache fits in its maximum size.
+            std::sort(aoFiles.begin(), aoFiles.end(),
+                      [](const CacheFile &a, const CacheFile &b)
+                      { return a.nMTime < b.nMTime; });
+            unsigned nDeleted = 0;
+            for (const auto &oFile : aoFiles)
             {
+                const long seconds = static_cast<long>(nTime - oFile.nMTime);
+                if (seconds <= m_nExpires && nSize <= m_nMaxSize)
+                    break;
                 const char *pszPath =
-                    CPLFormFilename(m_soPath, papszList[toDelete[i]], nullptr);
-                VSIUnlink(pszPath);
+                    CPLFormFilename(m_soPath, papszList[oFile.nIdx], nullptr);
+                if (VSIUnlink(pszPath) == 0)
+                {
+                    nSize -= oFile.nSize;
+                    ++nDeleted;
+                }
             }
+            CPLDebug("WMS", "Delete %u items from cache", nDeleted);
         }
 
         CSLDestroy(papszList);
     }
 
   private:
+    bool QueueWrite(const CPLString &soFilePath, const CPLString &osFileName)
+    {
+        vsi_l_offset nDataLength = 0;
+        const GByte *pabyData =
+            VSIGetMemFileBuffer(osFileName, &nDataLength, FALSE);
+        if (pabyData == nullptr)
+            return false;
+
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutex);
+            if (!m_oWriterThread.joinable())
+                m_oWriterThread = std::thread([this]() { WriterThread(); });
+            m_aoPendingWrites.emplace_back(
+                soFilePath, std::vector<GByte>(pabyData,
+                                               pabyData + nDataLength));
+            m_oPendingPaths.insert(soFilePath);
+        }
+        m_oCV.notify_all();
+        return true;
+    }
+
+    void WriterThread()
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        while (true)
+        {
+            m_oCV.wait(oLock, [this]
+                       { return m_bStopWriter || !m_aoPendingWrites.empty(); });
+            if (m_aoPendingWrites.empty())
+                break;
+
+            auto oWrite = std::move(m_aoPendingWrites.front());
+            m_aoPendingWrites.pop_front();
+            oLock.unlock();
+
+            const CPLString &soFilePath = oWrite.first;
+            const std::vector<GByte> &abyData = oWrite.second;
+            MakeDirs(CPLGetDirname(soFilePath));
+            // Write to a temporary file and rename it, so that readers of
+            // the cache never see a partially written tile.
+            const CPLString osTmpFilename(
+                CPLSPrintf("%s.%p.tmp", soFilePath.c_str(), this));
+            bool bOK = false;
+            VSILFILE *fp = VSIFOpenL(osTmpFilename, "wb");
+            if (fp)
+            {
+                bOK = VSIFWriteL(abyData.data(), 1, abyData.size(), fp) ==
+                      abyData.size();
+                bOK = VSIFCloseL(fp) == 0 && bOK;
+                if (bOK)
+                    bOK = VSIRename(osTmpFilename, soFilePath) == 0;
+                if (!bOK)
+                    VSIUnlink(osTmpFilename);
+            }
+            if (!bOK)
+            {
+                CPLError(CE_Warning, CPLE_FileIO,
+                         "Error writing to WMS cache %s", m_soPath.c_str());
+            }
+
+            oLock.lock();
+            // The same tile may have been queued again in the meantime
+            bool bStillPending = false;
+            for (const auto &oOther : m_aoPendingWrites)
+            {
+                if (oOther.first == soFilePath)
+                {
+                    bStillPending = true;
+                    break;
+                }
+            }
+            if (!bStillPending)
+                m_oPendingPaths.erase(soFilePath);
+            m_oCV.notify_all();
+        }
+    }
+
     CPLString GetFilePath(const char *pszKey) const
     {
         CPLString soHash(CPLMD5String(pszKey));
@@ -216,6 +350,15 @@ class GDALWMSFileCache : public GDALWMSCacheImpl
     int m_nExpires;
     long m_nMaxSize;
     int m_nCleanThreadRunTimeout;
+
+    // Write-behind of cache files, done by a background thread
+    bool m_bWriteBehind = false;
+    bool m_bStopWriter = false;
+    mutable std::mutex m_oMutex{};
+    mutable std::condition_variable m_oCV{};
+    std::thread m_oWriterThread{};
+    std::deque<std::pair<CPLString, std::vector<GByte>>> m_aoPendingWrites{};
+    std::set<CPLString> m_oPendingPaths{};
 };
 
 //------------------------------------------------------------------------------
@@ -53,12 +53,12 @@ GDALWMSDataset::GDALWMSDataset()
     : m_mini_driver(nullptr), m_cache(nullptr), m_poColorTable(nullptr),
       m_data_type(GDT_Byte), m_block_size_x(0), m_block_size_y(0),
       m_use_advise_read(0), m_verify_advise_read(0), m_offline_mode(0),
-      m_http_max_conn(0), m_http_timeout(0), m_http_options(nullptr),
-      m_tileOO(nullptr), m_clamp_requests(true), m_unsafeSsl(false),
-      m_zeroblock_on_serverexceptions(0), m_default_block_size_x(1024),
-      m_default_block_size_y(1024), m_default_tile_count_x(1),
-      m_default_tile_count_y(1), m_default_overview_count(-1),
-      m_bNeedsDataWindow(true)
+      m_http_max_conn(0), m_prefetch_margin(0), m_http_timeout(0),
+      m_http_options(nullptr), m_tileOO(nullptr), m_clamp_requests(true),
+      m_unsafeSsl(false), m_zeroblock_on_serverexceptions(0),
+      m_default_block_size_x(1024), m_default_block_size_y(1024),
+      m_default_tile_count_x(1), m_default_tile_count_y(1),
+      m_default_overview_count(-1), m_bNeedsDataWindow(true)
 {
     m_oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
     m_hint.m_valid = false;
@@ -177,6 +177,18 @@ CPLErr GDALWMSDataset::Initialize(CPLXMLNode *config, char **l_papszOpenOptions)
         }
     }
 
+    if (ret == CE_None)
+    {
+        const char *prefetch_margin =
+            CPLGetXMLValue(config, "PrefetchMargin", "");
+        if (prefetch_margin[0] == '\0')
+        {
+            prefetch_margin =
+                CPLGetConfigOption("GDAL_WMS_PREFETCH_MARGIN", "0");
+        }
+        m_prefetch_margin = std::max(0, std::min(atoi(prefetch_margin), 15));
+    }
+
     if (ret == CE_None)
     {
         const char *timeout = CPLGetXMLValue(config, "Timeout", "");
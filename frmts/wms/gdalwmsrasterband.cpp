@@ -354,6 +354,17 @@ CPLErr GDALWMSRasterBand::IReadBlock(int x, int y, void *buffer)
             by1 = std::min(y + 15, tby1);
             bCancelHint =
                 (bx0 == tbx0 && by0 == tby0 && bx1 == tbx1 && by1 == tby1);
+
+            // Also fetch neighbouring tiles in the same batch, so that
+            // panning around the current window hits the block cache.
+            const int nMargin = m_parent_dataset->m_prefetch_margin;
+            if (nMargin > 0 && !m_parent_dataset->m_offline_mode)
+            {
+                bx0 = std::max(bx0 - nMargin, 0);
+                by0 = std::max(by0 - nMargin, 0);
+                bx1 = std::min(bx1 + nMargin, nBlocksPerRow - 1);
+                by1 = std::min(by1 + nMargin, nBlocksPerColumn - 1);
+            }
         }
     }
 
@@ -508,6 +508,8 @@ class GDALWMSDataset final : public GDALPamDataset
     int m_verify_advise_read;
     int m_offline_mode;
     int m_http_max_conn;
+    // Number of neighbouring tiles fetched around a RasterIO() request
+    int m_prefetch_margin;
     int m_http_timeout;
     char **m_http_options;
     // Open Option list for tiles
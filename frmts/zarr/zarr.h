@@ -31,11 +31,13 @@
 
 #include "cpl_compressor.h"
 #include "cpl_json.h"
+#include "cpl_mem_cache.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
 #include "memmultidim.h"
 
 #include <array>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -801,6 +803,16 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
     struct CachedTile
     {
         ZarrByteVectorQuickResize abyDecoded{};
+        CPLMemoryAccountingReservation oMemoryAccounting{};
+
+        //! To call once abyDecoded is set, before inserting in the cache
+        void UpdateMemoryAccounting()
+        {
+            static CPLMemoryAccountingCounter *const hCounter =
+                CPLGetMemoryAccountingCounter("ZARR_TILE_CACHE");
+            oMemoryAccounting = CPLMemoryAccountingReservation(
+                hCounter, static_cast<GIntBig>(abyDecoded.capacity()));
+        }
     };
 
     mutable std::map<uint64_t, CachedTile> m_oMapTileIndexToCachedTile{};
@@ -861,6 +873,9 @@ class ZarrArray CPL_NON_FINAL : public GDALPamMDArray
 
     bool IsEmptyTile(const ZarrByteVectorQuickResize &abyTile) const;
 
+    bool PrefetchTiles(const GUInt64 *arrayStartIdx, const size_t *count,
+                       const GInt64 *arrayStep) const;
+
     bool IAdviseReadCommon(const GUInt64 *arrayStartIdx, const size_t *count,
                            CSLConstList papszOptions,
                            std::vector<uint64_t> &anIndicesCur,
@@ -1211,6 +1226,25 @@ class ZarrV3Codec CPL_NON_FINAL
     virtual bool Decode(const ZarrByteVectorQuickResize &abySrc,
                         ZarrByteVectorQuickResize &abyDst) const = 0;
 
+    // Codecs returning true must implement EncodeInPlace() and
+    // DecodeInPlace(), which avoid a copy to a temporary buffer.
+    virtual bool CanWorkInPlace() const
+    {
+        return false;
+    }
+
+    virtual bool
+    EncodeInPlace(ZarrByteVectorQuickResize & /* abyBuffer */) const
+    {
+        return false;
+    }
+
+    virtual bool
+    DecodeInPlace(ZarrByteVectorQuickResize & /* abyBuffer */) const
+    {
+        return false;
+    }
+
     const std::string &GetName() const
     {
         return m_osName;
@@ -1314,6 +1348,96 @@ class ZarrV3CodecBlosc final : public ZarrV3Codec
                 ZarrByteVectorQuickResize &abyDst) const override;
 };
 
+/************************************************************************/
+/*                           ZarrV3CodecZstd                            */
+/************************************************************************/
+
+// Implements the zstd codec of Zarr V3, whose configuration has a "level"
+// integer and a "checksum" boolean.
+class ZarrV3CodecZstd final : public ZarrV3Codec
+{
+    CPLStringList m_aosCompressorOptions{};
+    const CPLCompressor *m_pDecompressor = nullptr;
+    const CPLCompressor *m_pCompressor = nullptr;
+
+    ZarrV3CodecZstd(const ZarrV3CodecZstd &) = delete;
+    ZarrV3CodecZstd &operator=(const ZarrV3CodecZstd &) = delete;
+
+  public:
+    static constexpr const char *NAME = "zstd";
+
+    ZarrV3CodecZstd();
+    ~ZarrV3CodecZstd() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    static CPLJSONObject GetConfiguration(int nLevel, bool bChecksum);
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+};
+
+/************************************************************************/
+/*                          ZarrV3CodecCRC32C                           */
+/************************************************************************/
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/crc32c/v1.0.html
+class ZarrV3CodecCRC32C final : public ZarrV3Codec
+{
+  public:
+    static constexpr const char *NAME = "crc32c";
+
+    ZarrV3CodecCRC32C();
+    ~ZarrV3CodecCRC32C() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+
+    bool CanWorkInPlace() const override
+    {
+        return true;
+    }
+
+    bool EncodeInPlace(ZarrByteVectorQuickResize &abyBuffer) const override;
+    bool DecodeInPlace(ZarrByteVectorQuickResize &abyBuffer) const override;
+};
+
 /************************************************************************/
 /*                           ZarrV3CodecEndian                          */
 /************************************************************************/
@@ -1364,6 +1488,14 @@ class ZarrV3CodecEndian final : public ZarrV3Codec
                 ZarrByteVectorQuickResize &abyDst) const override;
     bool Decode(const ZarrByteVectorQuickResize &abySrc,
                 ZarrByteVectorQuickResize &abyDst) const override;
+
+    bool CanWorkInPlace() const override
+    {
+        return true;
+    }
+
+    bool EncodeInPlace(ZarrByteVectorQuickResize &abyBuffer) const override;
+    bool DecodeInPlace(ZarrByteVectorQuickResize &abyBuffer) const override;
 };
 
 /************************************************************************/
@@ -1420,6 +1552,93 @@ class ZarrV3CodecTranspose final : public ZarrV3Codec
                 ZarrByteVectorQuickResize &abyDst) const override;
 };
 
+/************************************************************************/
+/*                      ZarrV3CodecShardingIndexed                      */
+/************************************************************************/
+
+class ZarrV3CodecSequence;
+
+// Implements https://zarr-specs.readthedocs.io/en/latest/v3/codecs/sharding-indexed/v1.0.html
+class ZarrV3CodecShardingIndexed final : public ZarrV3Codec
+{
+    // Shape of inner chunks
+    std::vector<size_t> m_anInnerBlockSizes{};
+
+    // Codecs applied to each inner chunk
+    std::unique_ptr<ZarrV3CodecSequence> m_poInnerCodecs{};
+
+    bool m_bIndexLittleEndian = true;
+    bool m_bIndexHasChecksum = false;
+    bool m_bIndexAtEnd = true;
+
+    void CopyInnerChunk(size_t nInnerChunkIdx, GByte *pabyShard,
+                        GByte *pabyInnerChunk, bool bToShard) const;
+
+  public:
+    static constexpr const char *NAME = "sharding_indexed";
+
+    // Value of both the offset and the size of a missing inner chunk in the
+    // shard index
+    static constexpr uint64_t EMPTY_CHUNK =
+        std::numeric_limits<uint64_t>::max();
+
+    ZarrV3CodecShardingIndexed();
+    ~ZarrV3CodecShardingIndexed() override;
+
+    IOType GetInputType() const override
+    {
+        return IOType::ARRAY;
+    }
+
+    IOType GetOutputType() const override
+    {
+        return IOType::BYTES;
+    }
+
+    static CPLJSONObject
+    GetConfiguration(const std::vector<GUInt64> &anInnerBlockSizes,
+                     const CPLJSONArray &oInnerCodecs);
+
+    bool
+    InitFromConfiguration(const CPLJSONObject &configuration,
+                          const ZarrArrayMetadata &oInputArrayMetadata,
+                          ZarrArrayMetadata &oOutputArrayMetadata) override;
+
+    std::unique_ptr<ZarrV3Codec> Clone() const override;
+
+    bool Encode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+    bool Decode(const ZarrByteVectorQuickResize &abySrc,
+                ZarrByteVectorQuickResize &abyDst) const override;
+
+    const std::vector<size_t> &GetInnerBlockSizes() const
+    {
+        return m_anInnerBlockSizes;
+    }
+
+    // May be nullptr if inner chunks are not encoded
+    ZarrV3CodecSequence *GetInnerCodecs() const
+    {
+        return m_poInnerCodecs.get();
+    }
+
+    size_t GetInnerChunkCount() const;
+
+    // Size in bytes of the encoded shard index
+    size_t GetIndexSize() const;
+
+    bool IsIndexAtEnd() const
+    {
+        return m_bIndexAtEnd;
+    }
+
+    // anIndex[] receives (offset, size) pairs for each inner chunk, in C order
+    bool DecodeIndex(const GByte *pabyIndex,
+                     std::vector<uint64_t> &anIndex) const;
+    void EncodeIndex(const std::vector<uint64_t> &anIndex,
+                     std::vector<GByte> &abyIndex) const;
+};
+
 /************************************************************************/
 /*                          ZarrV3CodecSequence                         */
 /************************************************************************/
@@ -1451,6 +1670,10 @@ class ZarrV3CodecSequence
 
     bool Encode(ZarrByteVectorQuickResize &abyBuffer);
     bool Decode(ZarrByteVectorQuickResize &abyBuffer);
+
+    // Returns the sharding codec if it is the only (non no-op) codec of the
+    // sequence, which enables reading and writing individual inner chunks.
+    ZarrV3CodecShardingIndexed *GetShardingIndexedCodec() const;
 };
 
 /************************************************************************/
@@ -1462,6 +1685,23 @@ class ZarrV3Array final : public ZarrArray
     bool m_bV2ChunkKeyEncoding = false;
     std::unique_ptr<ZarrV3CodecSequence> m_poCodecs{};
 
+    // Shape of shards (that is of the chunk_grid) when the only codec is
+    // sharding_indexed, in which case m_anBlockSize is the shape of the inner
+    // chunks. Empty otherwise.
+    std::vector<GUInt64> m_anShardSize{};
+
+    // Decoded shard indices, by shard filename. An empty index means a missing
+    // shard.
+    mutable std::mutex m_oShardIndexCacheMutex{};
+    mutable lru11::Cache<std::string, std::shared_ptr<std::vector<uint64_t>>>
+        m_oShardIndexCache{256};
+
+    // Shard being written: filename and encoded inner chunks, by index of the
+    // inner chunk in the shard.
+    mutable std::string m_osWriteShardFilename{};
+    mutable std::map<size_t, std::vector<GByte>> m_oMapWriteShardChunks{};
+    mutable bool m_bWriteShardDirty = false;
+
     ZarrV3Array(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
                 const std::string &osParentName, const std::string &osName,
                 const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -1483,6 +1723,35 @@ class ZarrV3Array final : public ZarrArray
                       ZarrByteVectorQuickResize &abyDecodedTileData,
                       bool &bMissingTileOut) const;
 
+    void DecodeRawTileData(const ZarrByteVectorQuickResize &abyRawTileData,
+                           ZarrByteVectorQuickResize &abyDecodedTileData) const;
+
+    void GetShardLocation(const uint64_t *tileIndices, std::string &osFilename,
+                          size_t &nInnerChunkIdx) const;
+
+    bool IsSameShard(const uint64_t *tileIndices1,
+                     const uint64_t *tileIndices2) const;
+
+    bool GetShardIndex(const std::string &osFilename, VSILFILE *fp,
+                       const ZarrV3CodecShardingIndexed *poSharding,
+                       std::shared_ptr<std::vector<uint64_t>> &panIndex) const;
+
+    bool DecodeInnerChunk(const std::string &osFilename,
+                          const ZarrV3CodecShardingIndexed *poSharding,
+                          ZarrByteVectorQuickResize &abyRawTileData) const;
+
+    bool LoadInnerChunksFromShard(
+        const uint64_t *panTileIndices, size_t nTiles,
+        ZarrV3CodecSequence *poCodecs,
+        std::vector<ZarrByteVectorQuickResize> &aabyRawTileData,
+        std::vector<bool> &abMissingTile) const;
+
+    bool FlushDirtyInnerChunk() const;
+
+    bool FlushShardWriteBuffer() const;
+
+    bool LoadShardForWrite(const std::string &osFilename) const;
+
   public:
     ~ZarrV3Array() override;
 
@@ -1504,6 +1773,16 @@ class ZarrV3Array final : public ZarrArray
         m_poCodecs = std::move(poCodecs);
     }
 
+    void SetShardSize(const std::vector<GUInt64> &anShardSize)
+    {
+        m_anShardSize = anShardSize;
+    }
+
+    bool IsSharded() const
+    {
+        return !m_anShardSize.empty();
+    }
+
     void Flush() override;
 
   protected:
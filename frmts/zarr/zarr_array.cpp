@@ -1026,6 +1026,79 @@ lbl_next_depth:
     return true;
 }
 
+/************************************************************************/
+/*                      ZarrArray::PrefetchTiles()                      */
+/************************************************************************/
+
+// Decodes in parallel, through IAdviseRead(), the tiles intersecting a read
+// request, when there are several of them and they fit in the available
+// cache. This gives multi-threaded decoding (and concurrent downloads on
+// network file systems) to read requests not preceded by AdviseRead().
+bool ZarrArray::PrefetchTiles(const GUInt64 *arrayStartIdx, const size_t *count,
+                              const GInt64 *arrayStep) const
+{
+    const size_t nDims = m_aoDims.size();
+    if (nDims == 0 ||
+        !CPLTestBool(CPLGetConfigOption("ZARR_PARALLEL_READ", "YES")))
+    {
+        return true;
+    }
+
+    std::vector<uint64_t> anIndicesMin(nDims);
+    std::vector<uint64_t> anIndicesMax(nDims);
+    uint64_t nReqTiles = 1;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        // With a stride, not all tiles of the bounding box are needed
+        if (count[i] > 1 && arrayStep[i] != 1)
+            return true;
+        anIndicesMin[i] = arrayStartIdx[i] / m_anBlockSize[i];
+        anIndicesMax[i] = (arrayStartIdx[i] + count[i] - 1) / m_anBlockSize[i];
+        nReqTiles *= anIndicesMax[i] - anIndicesMin[i] + 1;
+    }
+    if (nReqTiles <= 1)
+        return true;
+
+    // Skip if the tiles have already been prefetched, by an explicit
+    // AdviseRead() or a previous read request.
+    const auto GetTileIdx = [this, nDims](const std::vector<uint64_t> &indices)
+    {
+        uint64_t nTileIdx = 0;
+        for (size_t j = 0; j < nDims; ++j)
+        {
+            if (j > 0)
+                nTileIdx *= m_aoDims[j - 1]->GetSize();
+            nTileIdx += indices[j];
+        }
+        return nTileIdx;
+    };
+    if (m_oMapTileIndexToCachedTile.find(GetTileIdx(anIndicesMin)) !=
+            m_oMapTileIndexToCachedTile.end() &&
+        m_oMapTileIndexToCachedTile.find(GetTileIdx(anIndicesMax)) !=
+            m_oMapTileIndexToCachedTile.end())
+    {
+        return true;
+    }
+
+    // Silently fallback to sequential decoding if the tiles do not fit in
+    // half of the remaining block cache.
+    const uint64_t nCacheSize = static_cast<uint64_t>(
+        std::max<GIntBig>(0, GDALGetCacheMax64() - GDALGetCacheUsed64()) / 2);
+    if (nReqTiles > nCacheSize / std::max(m_nTileSize, nDims))
+        return true;
+
+    // Tiles are read from storage, so the content of the cached tile must
+    // be there.
+    if (!FlushDirtyTile())
+        return false;
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("CACHE_SIZE",
+                            CPLSPrintf(CPL_FRMT_GUIB,
+                                       static_cast<GUIntBig>(nCacheSize)));
+    return IAdviseRead(arrayStartIdx, count, aosOptions.List());
+}
+
 /************************************************************************/
 /*                           ZarrArray::IRead()                         */
 /************************************************************************/
@@ -1098,6 +1171,9 @@ bool ZarrArray::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
         bufferStride = bufferStrideMod.data();
     }
 
+    if (!PrefetchTiles(arrayStartIdx, count, arrayStep))
+        return false;
+
     std::vector<uint64_t> indicesOuterLoop(nDims + 1);
     std::vector<GByte *> dstPtrStackOuterLoop(nDims + 1);
 
@@ -1178,14 +1254,33 @@ lbl_next_depth:
             }
         }
 
+        // Decoded tile from the process-wide chunk cache, when it is used.
+        // Must be kept alive while pabySrcTile points to it.
+        std::shared_ptr<const std::vector<GByte>> poCachedChunk;
+
         if (!bMatchFoundInMapTileIndexToCachedTile)
         {
+            // The chunk cache is only used on read-only arrays, so that
+            // it does not need to be invalidated on writes.
+            std::vector<GUInt64> anChunkIdx;
+            if (!m_bUpdatable)
+            {
+                anChunkIdx.assign(tileIndices.begin(), tileIndices.end());
+            }
+
             if (!tileIndices.empty() && tileIndices == m_anCachedTiledIndices)
             {
                 if (!m_bCachedTiledValid)
                     return false;
                 bEmptyTile = m_bCachedTiledEmpty;
             }
+            else if (!anChunkIdx.empty() &&
+                     (poCachedChunk = GetChunkFromCache(anChunkIdx.data())) !=
+                         nullptr)
+            {
+                // An empty cached chunk means a missing tile
+                bEmptyTile = poCachedChunk->empty();
+            }
             else
             {
                 if (!FlushDirtyTile())
@@ -1199,11 +1294,28 @@ lbl_next_depth:
                     return false;
                 }
                 m_bCachedTiledEmpty = bEmptyTile;
+
+                if (!anChunkIdx.empty())
+                {
+                    const auto &abyTile = m_abyDecodedTileData.empty()
+                                              ? m_abyRawTileData
+                                              : m_abyDecodedTileData;
+                    PutChunkInCache(
+                        anChunkIdx.data(),
+                        bEmptyTile
+                            ? std::make_shared<const std::vector<GByte>>()
+                            : std::make_shared<const std::vector<GByte>>(
+                                  abyTile.data(),
+                                  abyTile.data() + abyTile.size()));
+                }
             }
 
-            pabySrcTile = m_abyDecodedTileData.empty()
-                              ? m_abyRawTileData.data()
-                              : m_abyDecodedTileData.data();
+            if (poCachedChunk)
+                pabySrcTile = poCachedChunk->data();
+            else
+                pabySrcTile = m_abyDecodedTileData.empty()
+                                  ? m_abyRawTileData.data()
+                                  : m_abyDecodedTileData.data();
         }
         const size_t nSrcDTSize =
             m_abyDecodedTileData.empty() ? nSourceSize : nDTSize;
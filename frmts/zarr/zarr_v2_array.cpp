@@ -772,6 +772,7 @@ bool ZarrV2Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                 else
                     std::swap(cachedTile.abyDecoded, abyRawTileData);
             }
+            cachedTile.UpdateMemoryAccounting();
             poArray->m_oMapTileIndexToCachedTile[nTileIdx] =
                 std::move(cachedTile);
         }
@@ -94,6 +94,8 @@ void ZarrV3Array::Flush()
         return;
 
     ZarrV3Array::FlushDirtyTile();
+    if (IsSharded())
+        FlushShardWriteBuffer();
 
     if (!m_aoDims.empty())
     {
@@ -159,7 +161,9 @@ void ZarrV3Array::Serialize(const CPLJSONObject &oAttrs)
         CPLJSONObject oConfiguration;
         oChunkGrid.Add("configuration", oConfiguration);
         CPLJSONArray oChunks;
-        for (const auto nBlockSize : m_anBlockSize)
+        // For sharded arrays, the chunk grid is the one of the shards
+        for (const auto nBlockSize :
+             IsSharded() ? m_anShardSize : m_anBlockSize)
         {
             oChunks.Add(static_cast<GInt64>(nBlockSize));
         }
@@ -394,6 +398,22 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
 
     bMissingTileOut = false;
 
+    if (IsSharded())
+    {
+        std::vector<ZarrByteVectorQuickResize> aabyRawTileData(1);
+        std::vector<bool> abMissingTile;
+        aabyRawTileData[0] = std::move(abyRawTileData);
+        const bool bOK = LoadInnerChunksFromShard(
+            tileIndices, 1, poCodecs, aabyRawTileData, abMissingTile);
+        abyRawTileData = std::move(aabyRawTileData[0]);
+        if (!bOK)
+            return false;
+        bMissingTileOut = abMissingTile[0];
+        if (!bMissingTileOut && !abyDecodedTileData.empty())
+            DecodeRawTileData(abyRawTileData, abyDecodedTileData);
+        return true;
+    }
+
     std::string osFilename = BuildTileFilename(tileIndices);
 
     // For network file systems, get the streaming version of the filename,
@@ -535,26 +555,300 @@ bool ZarrV3Array::LoadTileData(const uint64_t *tileIndices, bool bUseMutex,
     }
 
     if (!abyDecodedTileData.empty())
+        DecodeRawTileData(abyRawTileData, abyDecodedTileData);
+
+    return true;
+
+#undef m_abyRawTileData
+#undef m_abyDecodedTileData
+#undef m_poCodecs
+}
+
+/************************************************************************/
+/*                   ZarrV3Array::DecodeRawTileData()                   */
+/************************************************************************/
+
+void ZarrV3Array::DecodeRawTileData(
+    const ZarrByteVectorQuickResize &abyRawTileData,
+    ZarrByteVectorQuickResize &abyDecodedTileData) const
+{
+    const size_t nSourceSize =
+        m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
+    const auto nDTSize = m_oType.GetSize();
+    const size_t nValues = abyDecodedTileData.size() / nDTSize;
+    CPLAssert(nValues == m_nTileSize / nSourceSize);
+    const GByte *pSrc = abyRawTileData.data();
+    GByte *pDst = &abyDecodedTileData[0];
+    for (size_t i = 0; i < nValues; i++, pSrc += nSourceSize, pDst += nDTSize)
     {
-        const size_t nSourceSize =
-            m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
-        const auto nDTSize = m_oType.GetSize();
-        const size_t nValues = abyDecodedTileData.size() / nDTSize;
-        CPLAssert(nValues == m_nTileSize / nSourceSize);
-        const GByte *pSrc = abyRawTileData.data();
-        GByte *pDst = &abyDecodedTileData[0];
-        for (size_t i = 0; i < nValues;
-             i++, pSrc += nSourceSize, pDst += nDTSize)
+        DecodeSourceElt(m_aoDtypeElts, pSrc, pDst);
+    }
+}
+
+/************************************************************************/
+/*                   ZarrV3Array::GetShardLocation()                    */
+/************************************************************************/
+
+// Returns the filename of the shard containing the inner chunk of indices
+// tileIndices[], and the index of that inner chunk in the shard index.
+void ZarrV3Array::GetShardLocation(const uint64_t *tileIndices,
+                                   std::string &osFilename,
+                                   size_t &nInnerChunkIdx) const
+{
+    const size_t nDims = m_aoDims.size();
+    std::vector<uint64_t> anShardIndices(nDims);
+    nInnerChunkIdx = 0;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        const uint64_t nRatio = m_anShardSize[i] / m_anBlockSize[i];
+        anShardIndices[i] = tileIndices[i] / nRatio;
+        nInnerChunkIdx = static_cast<size_t>(nInnerChunkIdx * nRatio +
+                                             tileIndices[i] % nRatio);
+    }
+    osFilename = BuildTileFilename(anShardIndices.data());
+}
+
+/************************************************************************/
+/*                      ZarrV3Array::IsSameShard()                      */
+/************************************************************************/
+
+bool ZarrV3Array::IsSameShard(const uint64_t *tileIndices1,
+                              const uint64_t *tileIndices2) const
+{
+    for (size_t i = 0; i < m_aoDims.size(); ++i)
+    {
+        const uint64_t nRatio = m_anShardSize[i] / m_anBlockSize[i];
+        if (tileIndices1[i] / nRatio != tileIndices2[i] / nRatio)
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3Array::GetShardIndex()                     */
+/************************************************************************/
+
+bool ZarrV3Array::GetShardIndex(
+    const std::string &osFilename, VSILFILE *fp,
+    const ZarrV3CodecShardingIndexed *poSharding,
+    std::shared_ptr<std::vector<uint64_t>> &panIndex) const
+{
+    const size_t nIndexSize = poSharding->GetIndexSize();
+    vsi_l_offset nIndexOffset = 0;
+    if (poSharding->IsIndexAtEnd())
+    {
+        VSIFSeekL(fp, 0, SEEK_END);
+        const vsi_l_offset nFileSize = VSIFTellL(fp);
+        if (nFileSize < nIndexSize)
         {
-            DecodeSourceElt(m_aoDtypeElts, pSrc, pDst);
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Shard %s is smaller than its index", osFilename.c_str());
+            return false;
         }
+        nIndexOffset = nFileSize - nIndexSize;
+    }
+
+    std::vector<GByte> abyIndex;
+    try
+    {
+        abyIndex.resize(nIndexSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for index of shard %s",
+                 osFilename.c_str());
+        return false;
+    }
+    if (VSIFSeekL(fp, nIndexOffset, SEEK_SET) != 0 ||
+        VSIFReadL(abyIndex.data(), 1, nIndexSize, fp) != nIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot read index of shard %s",
+                 osFilename.c_str());
+        return false;
     }
 
+    auto panNewIndex = std::make_shared<std::vector<uint64_t>>();
+    if (!poSharding->DecodeIndex(abyIndex.data(), *panNewIndex))
+        return false;
+
+    std::lock_guard oLock(m_oShardIndexCacheMutex);
+    m_oShardIndexCache.insert(osFilename, panNewIndex);
+    panIndex = std::move(panNewIndex);
     return true;
+}
 
-#undef m_abyRawTileData
-#undef m_abyDecodedTileData
-#undef m_poCodecs
+/************************************************************************/
+/*                   ZarrV3Array::DecodeInnerChunk()                    */
+/************************************************************************/
+
+bool ZarrV3Array::DecodeInnerChunk(
+    const std::string &osFilename, const ZarrV3CodecShardingIndexed *poSharding,
+    ZarrByteVectorQuickResize &abyRawTileData) const
+{
+    auto poInnerCodecs = poSharding->GetInnerCodecs();
+    if (poInnerCodecs && !poInnerCodecs->Decode(abyRawTileData))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decompression of inner chunk of shard %s failed",
+                 osFilename.c_str());
+        return false;
+    }
+    if (abyRawTileData.size() != m_nTileSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Decompressed inner chunk of shard %s has not expected size. "
+                 "Got %u instead of %u",
+                 osFilename.c_str(),
+                 static_cast<unsigned>(abyRawTileData.size()),
+                 static_cast<unsigned>(m_nTileSize));
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*               ZarrV3Array::LoadInnerChunksFromShard()                */
+/************************************************************************/
+
+// Loads the raw (decoded, but not yet converted to the GDAL data type)
+// content of nTiles inner chunks that belong to the same shard. The shard
+// index is cached, and the inner chunks are fetched with a single
+// ReadMultiRange() call, which network file systems can turn into parallel
+// (and merged) HTTP range requests.
+bool ZarrV3Array::LoadInnerChunksFromShard(
+    const uint64_t *panTileIndices, size_t nTiles,
+    ZarrV3CodecSequence *poCodecs,
+    std::vector<ZarrByteVectorQuickResize> &aabyRawTileData,
+    std::vector<bool> &abMissingTile) const
+{
+    // This method should NOT modify any ZarrArray member (except the
+    // mutex-protected shard index cache), as it is going to be called
+    // concurrently from several threads.
+
+    const auto poSharding = poCodecs->GetShardingIndexedCodec();
+    CPLAssert(poSharding);
+    const size_t nDims = m_aoDims.size();
+
+    std::string osFilename;
+    size_t nInnerChunkIdx = 0;
+    GetShardLocation(panTileIndices, osFilename, nInnerChunkIdx);
+    aabyRawTileData.resize(nTiles);
+    abMissingTile.assign(nTiles, true);
+
+    // Inner chunks of the shard being written are taken from the write
+    // buffer
+    if (osFilename == m_osWriteShardFilename)
+    {
+        for (size_t i = 0; i < nTiles; ++i)
+        {
+            GetShardLocation(panTileIndices + i * nDims, osFilename,
+                             nInnerChunkIdx);
+            const auto oIter = m_oMapWriteShardChunks.find(nInnerChunkIdx);
+            if (oIter == m_oMapWriteShardChunks.end())
+                continue;
+            auto &abyRawTileData = aabyRawTileData[i];
+            abyRawTileData.resize(oIter->second.size());
+            memcpy(abyRawTileData.data(), oIter->second.data(),
+                   oIter->second.size());
+            if (!DecodeInnerChunk(osFilename, poSharding, abyRawTileData))
+                return false;
+            abMissingTile[i] = false;
+        }
+        return true;
+    }
+
+    std::shared_ptr<std::vector<uint64_t>> panIndex;
+    {
+        std::lock_guard oLock(m_oShardIndexCacheMutex);
+        m_oShardIndexCache.tryGet(osFilename, panIndex);
+    }
+    if (panIndex && panIndex->empty())
+    {
+        // Missing shard
+        return true;
+    }
+
+    const char *const apszOpenOptions[] = {"IGNORE_FILENAME_RESTRICTIONS=YES",
+                                           nullptr};
+    VSIVirtualHandleUniquePtr fp(
+        VSIFOpenEx2L(osFilename.c_str(), "rb", 0, apszOpenOptions));
+    if (fp == nullptr)
+    {
+        // Missing files are OK and indicate nodata_value
+        CPLDebugOnly(ZARR_DEBUG_KEY, "Shard %s missing (=nodata)",
+                     osFilename.c_str());
+        std::lock_guard oLock(m_oShardIndexCacheMutex);
+        m_oShardIndexCache.insert(osFilename,
+                                  std::make_shared<std::vector<uint64_t>>());
+        return true;
+    }
+
+    if (!panIndex &&
+        !GetShardIndex(osFilename, fp.get(), poSharding, panIndex))
+    {
+        return false;
+    }
+
+    std::vector<size_t> anTileIdx;
+    std::vector<void *> apData;
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    for (size_t i = 0; i < nTiles; ++i)
+    {
+        GetShardLocation(panTileIndices + i * nDims, osFilename,
+                         nInnerChunkIdx);
+        const uint64_t nOffset = (*panIndex)[2 * nInnerChunkIdx];
+        const uint64_t nSize = (*panIndex)[2 * nInnerChunkIdx + 1];
+        if (nOffset == ZarrV3CodecShardingIndexed::EMPTY_CHUNK &&
+            nSize == ZarrV3CodecShardingIndexed::EMPTY_CHUNK)
+        {
+            continue;
+        }
+        if (nSize == 0 ||
+            nSize > static_cast<uint64_t>(std::numeric_limits<int>::max()))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid size for inner chunk of shard %s",
+                     osFilename.c_str());
+            return false;
+        }
+        try
+        {
+            aabyRawTileData[i].resize(static_cast<size_t>(nSize));
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate memory for inner chunk of shard %s",
+                     osFilename.c_str());
+            return false;
+        }
+        anTileIdx.push_back(i);
+        anOffsets.push_back(static_cast<vsi_l_offset>(nOffset));
+        anSizes.push_back(static_cast<size_t>(nSize));
+    }
+    for (const size_t i : anTileIdx)
+        apData.push_back(aabyRawTileData[i].data());
+
+    if (!anTileIdx.empty() &&
+        fp->ReadMultiRange(static_cast<int>(anTileIdx.size()), apData.data(),
+                           anOffsets.data(), anSizes.data()) != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not read inner chunks of shard %s correctly",
+                 osFilename.c_str());
+        return false;
+    }
+    fp.reset();
+
+    for (const size_t i : anTileIdx)
+    {
+        if (!DecodeInnerChunk(osFilename, poSharding, aabyRawTileData[i]))
+            return false;
+        abMissingTile[i] = false;
+    }
+    return true;
 }
 
 /************************************************************************/
@@ -581,6 +875,45 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
     const int nThreads =
         static_cast<int>(std::min(static_cast<size_t>(nThreadsMax), nReqTiles));
 
+    if (IsSharded())
+    {
+        // Group inner chunks by shard, so that each job can fetch the inner
+        // chunks of a shard with a single multi-range request.
+        const size_t nDims = m_aoDims.size();
+        std::vector<size_t> anOrder(nReqTiles);
+        for (size_t i = 0; i < nReqTiles; ++i)
+            anOrder[i] = i;
+        std::vector<uint64_t> anShardIndices(nReqTiles * nDims);
+        for (size_t i = 0; i < nReqTiles; ++i)
+        {
+            for (size_t j = 0; j < nDims; ++j)
+            {
+                anShardIndices[i * nDims + j] =
+                    anReqTilesIndices[i * nDims + j] /
+                    (m_anShardSize[j] / m_anBlockSize[j]);
+            }
+        }
+        std::stable_sort(anOrder.begin(), anOrder.end(),
+                         [&anShardIndices, nDims](size_t a, size_t b)
+                         {
+                             return std::lexicographical_compare(
+                                 anShardIndices.begin() + a * nDims,
+                                 anShardIndices.begin() + (a + 1) * nDims,
+                                 anShardIndices.begin() + b * nDims,
+                                 anShardIndices.begin() + (b + 1) * nDims);
+                         });
+        std::vector<uint64_t> anSortedTilesIndices;
+        anSortedTilesIndices.reserve(anReqTilesIndices.size());
+        for (const size_t i : anOrder)
+        {
+            anSortedTilesIndices.insert(
+                anSortedTilesIndices.end(),
+                anReqTilesIndices.begin() + i * nDims,
+                anReqTilesIndices.begin() + (i + 1) * nDims);
+        }
+        anReqTilesIndices = std::move(anSortedTilesIndices);
+    }
+
     CPLWorkerThreadPool *wtp = GDALGetGlobalThreadPool(nThreadsMax);
     if (wtp == nullptr)
         return false;
@@ -642,8 +975,90 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
             poCodecs = poArray->m_poCodecs->Clone();
         }
 
+        const auto GetTileIdx = [&aoDims, l_nDims](const uint64_t *tileIndices)
+        {
+            uint64_t nTileIdx = 0;
+            for (size_t j = 0; j < l_nDims; ++j)
+            {
+                if (j > 0)
+                    nTileIdx *= aoDims[j - 1]->GetSize();
+                nTileIdx += tileIndices[j];
+            }
+            return nTileIdx;
+        };
+
+        if (poArray->IsSharded())
+        {
+            std::vector<ZarrByteVectorQuickResize> aabyRawTileData;
+            std::vector<bool> abMissingTile;
+            size_t iReq = jobStruct->nFirstIdx;
+            while (iReq < jobStruct->nLastIdxNotIncluded)
+            {
+                // Check if we must early exit
+                {
+                    std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
+                    if (!(*jobStruct->pbGlobalStatus))
+                        return;
+                }
+
+                const uint64_t *tileIndices =
+                    jobStruct->panReqTilesIndices->data() + iReq * l_nDims;
+                size_t iReqEnd = iReq + 1;
+                while (iReqEnd < jobStruct->nLastIdxNotIncluded &&
+                       poArray->IsSameShard(
+                           tileIndices, jobStruct->panReqTilesIndices->data() +
+                                            iReqEnd * l_nDims))
+                {
+                    ++iReqEnd;
+                }
+
+                bool success = poArray->LoadInnerChunksFromShard(
+                    tileIndices, iReqEnd - iReq, poCodecs.get(),
+                    aabyRawTileData, abMissingTile);
+                std::vector<CachedTile> aoCachedTiles(iReqEnd - iReq);
+                for (size_t i = 0; success && i < aoCachedTiles.size(); ++i)
+                {
+                    if (abMissingTile[i])
+                        continue;
+                    if (poArray->NeedDecodedBuffer())
+                    {
+                        success = poArray->AllocateWorkingBuffers(
+                            abyRawTileData, abyDecodedTileData);
+                        if (success)
+                        {
+                            poArray->DecodeRawTileData(aabyRawTileData[i],
+                                                       abyDecodedTileData);
+                            std::swap(aoCachedTiles[i].abyDecoded,
+                                      abyDecodedTileData);
+                        }
+                    }
+                    else
+                    {
+                        std::swap(aoCachedTiles[i].abyDecoded,
+                                  aabyRawTileData[i]);
+                    }
+                }
+
+                std::lock_guard<std::mutex> oLock(poArray->m_oMutex);
+                if (!success)
+                {
+                    *jobStruct->pbGlobalStatus = false;
+                    break;
+                }
+                for (size_t i = 0; i < aoCachedTiles.size(); ++i)
+                {
+                    aoCachedTiles[i].UpdateMemoryAccounting();
+                    poArray->m_oMapTileIndexToCachedTile[GetTileIdx(
+                        tileIndices + i * l_nDims)] =
+                        std::move(aoCachedTiles[i]);
+                }
+                iReq = iReqEnd;
+            }
+        }
+
         for (size_t iReq = jobStruct->nFirstIdx;
-             iReq < jobStruct->nLastIdxNotIncluded; ++iReq)
+             !poArray->IsSharded() && iReq < jobStruct->nLastIdxNotIncluded;
+             ++iReq)
         {
             // Check if we must early exit
             {
@@ -692,6 +1107,7 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                 else
                     std::swap(cachedTile.abyDecoded, abyRawTileData);
             }
+            cachedTile.UpdateMemoryAccounting();
             poArray->m_oMapTileIndexToCachedTile[nTileIdx] =
                 std::move(cachedTile);
         }
@@ -736,6 +1152,9 @@ bool ZarrV3Array::FlushDirtyTile() const
         return true;
     m_bDirtyTile = false;
 
+    if (IsSharded())
+        return FlushDirtyInnerChunk();
+
     std::string osFilename = BuildTileFilename(m_anCachedTiledIndices.data());
 
     const size_t nSourceSize =
@@ -822,6 +1241,210 @@ bool ZarrV3Array::FlushDirtyTile() const
     return bRet;
 }
 
+/************************************************************************/
+/*                 ZarrV3Array::FlushDirtyInnerChunk()                  */
+/************************************************************************/
+
+// Encodes the cached tile, which is an inner chunk of a shard, into the
+// write buffer of its shard. The shard itself is only written when a tile
+// of another shard is flushed, or when the array is flushed.
+bool ZarrV3Array::FlushDirtyInnerChunk() const
+{
+    std::string osFilename;
+    size_t nInnerChunkIdx = 0;
+    GetShardLocation(m_anCachedTiledIndices.data(), osFilename,
+                     nInnerChunkIdx);
+    if (osFilename != m_osWriteShardFilename)
+    {
+        if (!FlushShardWriteBuffer() || !LoadShardForWrite(osFilename))
+            return false;
+    }
+
+    const size_t nSourceSize =
+        m_aoDtypeElts.back().nativeOffset + m_aoDtypeElts.back().nativeSize;
+    const auto &abyTile =
+        m_abyDecodedTileData.empty() ? m_abyRawTileData : m_abyDecodedTileData;
+
+    m_bWriteShardDirty = true;
+    if (IsEmptyTile(abyTile))
+    {
+        m_bCachedTiledEmpty = true;
+        m_oMapWriteShardChunks.erase(nInnerChunkIdx);
+        return true;
+    }
+
+    if (!m_abyDecodedTileData.empty())
+    {
+        const size_t nDTSize = m_oType.GetSize();
+        const size_t nValues = m_abyDecodedTileData.size() / nDTSize;
+        GByte *pDst = &m_abyRawTileData[0];
+        const GByte *pSrc = m_abyDecodedTileData.data();
+        for (size_t i = 0; i < nValues;
+             i++, pDst += nSourceSize, pSrc += nDTSize)
+        {
+            EncodeElt(m_aoDtypeElts, pSrc, pDst);
+        }
+    }
+
+    const size_t nSizeBefore = m_abyRawTileData.size();
+    const auto poInnerCodecs =
+        m_poCodecs->GetShardingIndexedCodec()->GetInnerCodecs();
+    if (poInnerCodecs && !poInnerCodecs->Encode(m_abyRawTileData))
+    {
+        m_abyRawTileData.resize(nSizeBefore);
+        return false;
+    }
+
+    m_oMapWriteShardChunks[nInnerChunkIdx].assign(
+        m_abyRawTileData.data(),
+        m_abyRawTileData.data() + m_abyRawTileData.size());
+    m_abyRawTileData.resize(nSizeBefore);
+
+    return true;
+}
+
+/************************************************************************/
+/*                 ZarrV3Array::FlushShardWriteBuffer()                 */
+/************************************************************************/
+
+bool ZarrV3Array::FlushShardWriteBuffer() const
+{
+    if (!m_bWriteShardDirty)
+        return true;
+    m_bWriteShardDirty = false;
+
+    const std::string &osFilename = m_osWriteShardFilename;
+    {
+        std::lock_guard oLock(m_oShardIndexCacheMutex);
+        m_oShardIndexCache.remove(osFilename);
+    }
+
+    if (m_oMapWriteShardChunks.empty())
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        {
+            CPLDebugOnly(ZARR_DEBUG_KEY,
+                         "Deleting shard %s that has now empty content",
+                         osFilename.c_str());
+            return VSIUnlink(osFilename.c_str()) == 0;
+        }
+        return true;
+    }
+
+    const auto poSharding = m_poCodecs->GetShardingIndexedCodec();
+    const size_t nIndexSize = poSharding->GetIndexSize();
+    const uint64_t nDataOffset = poSharding->IsIndexAtEnd() ? 0 : nIndexSize;
+    std::vector<uint64_t> anIndex(2 * poSharding->GetInnerChunkCount(),
+                                  ZarrV3CodecShardingIndexed::EMPTY_CHUNK);
+    uint64_t nOffset = 0;
+    for (const auto &[nInnerChunkIdx, abyChunk] : m_oMapWriteShardChunks)
+    {
+        anIndex[2 * nInnerChunkIdx] = nDataOffset + nOffset;
+        anIndex[2 * nInnerChunkIdx + 1] = abyChunk.size();
+        nOffset += abyChunk.size();
+    }
+    std::vector<GByte> abyIndex;
+    poSharding->EncodeIndex(anIndex, abyIndex);
+
+    if (m_osDimSeparator == "/")
+    {
+        std::string osDir = CPLGetDirname(osFilename.c_str());
+        VSIStatBufL sStat;
+        if (VSIStatL(osDir.c_str(), &sStat) != 0)
+        {
+            if (VSIMkdirRecursive(osDir.c_str(), 0755) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot create directory %s", osDir.c_str());
+                return false;
+            }
+        }
+    }
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "wb"));
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot create shard %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    bool bRet = true;
+    if (!poSharding->IsIndexAtEnd())
+        bRet = fp->Write(abyIndex.data(), 1, nIndexSize) == nIndexSize;
+    for (const auto &[nInnerChunkIdx, abyChunk] : m_oMapWriteShardChunks)
+    {
+        CPL_IGNORE_RET_VAL(nInnerChunkIdx);
+        bRet = bRet && fp->Write(abyChunk.data(), 1, abyChunk.size()) ==
+                           abyChunk.size();
+    }
+    if (poSharding->IsIndexAtEnd())
+        bRet = bRet && fp->Write(abyIndex.data(), 1, nIndexSize) == nIndexSize;
+    if (fp->Close() != 0)
+        bRet = false;
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Could not write shard %s correctly", osFilename.c_str());
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                   ZarrV3Array::LoadShardForWrite()                   */
+/************************************************************************/
+
+// Makes osFilename the shard being written, and loads the encoded inner
+// chunks it may already contain, so that they are preserved when the shard
+// is rewritten.
+bool ZarrV3Array::LoadShardForWrite(const std::string &osFilename) const
+{
+    m_osWriteShardFilename = osFilename;
+    m_oMapWriteShardChunks.clear();
+    m_bWriteShardDirty = false;
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osFilename.c_str(), "rb"));
+    if (fp == nullptr)
+        return true;
+
+    const auto poSharding = m_poCodecs->GetShardingIndexedCodec();
+    std::shared_ptr<std::vector<uint64_t>> panIndex;
+    if (!GetShardIndex(osFilename, fp.get(), poSharding, panIndex))
+        return false;
+
+    fp->Seek(0, SEEK_END);
+    const vsi_l_offset nFileSize = fp->Tell();
+    for (size_t i = 0; i < panIndex->size() / 2; ++i)
+    {
+        const uint64_t nOffset = (*panIndex)[2 * i];
+        const uint64_t nSize = (*panIndex)[2 * i + 1];
+        if (nOffset == ZarrV3CodecShardingIndexed::EMPTY_CHUNK &&
+            nSize == ZarrV3CodecShardingIndexed::EMPTY_CHUNK)
+        {
+            continue;
+        }
+        if (nOffset > nFileSize || nSize > nFileSize - nOffset)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid index entry for inner chunk of shard %s",
+                     osFilename.c_str());
+            return false;
+        }
+        auto &abyChunk = m_oMapWriteShardChunks[i];
+        abyChunk.resize(static_cast<size_t>(nSize));
+        if (fp->Seek(nOffset, SEEK_SET) != 0 ||
+            fp->Read(abyChunk.data(), 1, abyChunk.size()) != abyChunk.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot read inner chunk of shard %s",
+                     osFilename.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                          BuildTileFilename()                         */
 /************************************************************************/
@@ -1570,11 +2193,27 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
             return nullptr;
     }
 
+    // With the sharding_indexed codec, the chunk grid is the one of the
+    // shards, and the tiles exposed to the rest of the driver are the inner
+    // chunks.
+    std::vector<GUInt64> anShardSize;
+    const auto poSharding =
+        poCodecs ? poCodecs->GetShardingIndexedCodec() : nullptr;
+    if (poSharding && !anBlockSize.empty())
+    {
+        anShardSize = anBlockSize;
+        anBlockSize.clear();
+        for (const size_t nSize : poSharding->GetInnerBlockSizes())
+            anBlockSize.push_back(nSize);
+    }
+
     auto poArray =
         ZarrV3Array::Create(m_poSharedResource, GetFullName(), osArrayName,
                             aoDims, oType, aoDtypeElts, anBlockSize);
     if (!poArray)
         return nullptr;
+    if (!anShardSize.empty())
+        poArray->SetShardSize(anShardSize);
     poArray->SetUpdatable(m_bUpdatable);  // must be set before SetAttributes()
     poArray->SetFilename(osZarrayFilename);
     poArray->SetIsV2ChunkKeyEncoding(bV2ChunkKeyEncoding);
@@ -1603,7 +2242,17 @@ ZarrV3Group::LoadArray(const std::string &osArrayName,
     if (CPLTestBool(m_poSharedResource->GetOpenOptions().FetchNameValueDef(
             "CACHE_TILE_PRESENCE", "NO")))
     {
-        poArray->CacheTilePresence();
+        if (poArray->IsSharded())
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "CACHE_TILE_PRESENCE is not supported for sharded array "
+                     "%s",
+                     poArray->GetName().c_str());
+        }
+        else
+        {
+            poArray->CacheTilePresence();
+        }
     }
 
     return poArray;
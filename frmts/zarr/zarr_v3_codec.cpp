@@ -30,6 +30,8 @@
 
 #include "cpl_compressor.h"
 
+#include <array>
+
 /************************************************************************/
 /*                          ZarrV3Codec()                               */
 /************************************************************************/
@@ -44,6 +46,32 @@ ZarrV3Codec::ZarrV3Codec(const std::string &osName) : m_osName(osName)
 
 ZarrV3Codec::~ZarrV3Codec() = default;
 
+/************************************************************************/
+/*                           ZarrCRC32C()                               */
+/************************************************************************/
+
+// Castagnoli CRC, as used by the crc32c codec and shard indices.
+static uint32_t ZarrCRC32C(const GByte *pabyData, size_t nSize)
+{
+    static const std::array<uint32_t, 256> anTable = []()
+    {
+        std::array<uint32_t, 256> anRet;
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t nCRC = i;
+            for (int k = 0; k < 8; ++k)
+                nCRC = (nCRC >> 1) ^ (0x82F63B78U & (0U - (nCRC & 1U)));
+            anRet[i] = nCRC;
+        }
+        return anRet;
+    }();
+
+    uint32_t nCRC = 0xFFFFFFFFU;
+    for (size_t i = 0; i < nSize; ++i)
+        nCRC = anTable[(nCRC ^ pabyData[i]) & 0xFF] ^ (nCRC >> 8);
+    return ~nCRC;
+}
+
 /************************************************************************/
 /*                        ZarrV3CodecGZip()                             */
 /************************************************************************/
@@ -420,6 +448,305 @@ bool ZarrV3CodecBlosc::Decode(const ZarrByteVectorQuickResize &abySrc,
     return bRet;
 }
 
+/************************************************************************/
+/*                        ZarrV3CodecZstd()                             */
+/************************************************************************/
+
+ZarrV3CodecZstd::ZarrV3CodecZstd() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                       ~ZarrV3CodecZstd()                             */
+/************************************************************************/
+
+ZarrV3CodecZstd::~ZarrV3CodecZstd() = default;
+
+/************************************************************************/
+/*                           GetConfiguration()                         */
+/************************************************************************/
+
+/* static */ CPLJSONObject ZarrV3CodecZstd::GetConfiguration(int nLevel,
+                                                           bool bChecksum)
+{
+    CPLJSONObject oConfig;
+    oConfig.Add("level", nLevel);
+    oConfig.Add("checksum", bChecksum);
+    return oConfig;
+}
+
+/************************************************************************/
+/*                   ZarrV3CodecZstd::InitFromConfiguration()           */
+/************************************************************************/
+
+bool ZarrV3CodecZstd::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_pCompressor = CPLGetCompressor("zstd");
+    m_pDecompressor = CPLGetDecompressor("zstd");
+    if (!m_pCompressor || !m_pDecompressor)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "zstd compressor not available");
+        return false;
+    }
+
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    // byte->byte codec
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    int nLevel = 13;
+
+    if (configuration.IsValid())
+    {
+        if (configuration.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec zstd: configuration is not an object");
+            return false;
+        }
+
+        for (const auto &oChild : configuration.GetChildren())
+        {
+            if (oChild.GetName() != "level" && oChild.GetName() != "checksum")
+            {
+                CPLError(
+                    CE_Failure, CPLE_AppDefined,
+                    "Codec zstd: configuration contains a unhandled member: %s",
+                    oChild.GetName().c_str());
+                return false;
+            }
+        }
+
+        const auto oLevel = configuration.GetObj("level");
+        if (oLevel.IsValid())
+        {
+            if (oLevel.GetType() != CPLJSONObject::Type::Integer)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Codec zstd: level is not an integer");
+                return false;
+            }
+            nLevel = oLevel.ToInteger();
+            if (nLevel < -131072 || nLevel > 22)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Codec zstd: invalid value for level: %d", nLevel);
+                return false;
+            }
+        }
+
+        // The checksum of a zstd frame, if present, is verified by the
+        // decompressor. Frames are written without one.
+        const auto oChecksum = configuration.GetObj("checksum");
+        if (oChecksum.IsValid() &&
+            oChecksum.GetType() != CPLJSONObject::Type::Boolean)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec zstd: checksum is not a boolean");
+            return false;
+        }
+    }
+
+    m_aosCompressorOptions.SetNameValue("LEVEL", CPLSPrintf("%d", nLevel));
+
+    return true;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecZstd::Clone()                        */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecZstd::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecZstd>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecZstd::Encode()                       */
+/************************************************************************/
+
+bool ZarrV3CodecZstd::Encode(const ZarrByteVectorQuickResize &abySrc,
+                             ZarrByteVectorQuickResize &abyDst) const
+{
+    abyDst.resize(abyDst.capacity());
+    void *pOutputData = abyDst.data();
+    size_t nOutputSize = abyDst.size();
+    bool bRet = m_pCompressor->pfnFunc(
+        abySrc.data(), abySrc.size(), &pOutputData, &nOutputSize,
+        m_aosCompressorOptions.List(), m_pCompressor->user_data);
+    if (bRet)
+    {
+        abyDst.resize(nOutputSize);
+    }
+    else if (nOutputSize > abyDst.size())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecZstd::Encode(): output buffer too small");
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                      ZarrV3CodecZstd::Decode()                       */
+/************************************************************************/
+
+bool ZarrV3CodecZstd::Decode(const ZarrByteVectorQuickResize &abySrc,
+                             ZarrByteVectorQuickResize &abyDst) const
+{
+    abyDst.resize(abyDst.capacity());
+    void *pOutputData = abyDst.data();
+    size_t nOutputSize = abyDst.size();
+    bool bRet = m_pDecompressor->pfnFunc(abySrc.data(), abySrc.size(),
+                                         &pOutputData, &nOutputSize, nullptr,
+                                         m_pDecompressor->user_data);
+    if (bRet)
+    {
+        abyDst.resize(nOutputSize);
+    }
+    else if (nOutputSize > abyDst.size())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecZstd::Decode(): output buffer too small");
+    }
+    return bRet;
+}
+
+/************************************************************************/
+/*                       ZarrV3CodecCRC32C()                            */
+/************************************************************************/
+
+ZarrV3CodecCRC32C::ZarrV3CodecCRC32C() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                       ~ZarrV3CodecCRC32C()                           */
+/************************************************************************/
+
+ZarrV3CodecCRC32C::~ZarrV3CodecCRC32C() = default;
+
+/************************************************************************/
+/*                 ZarrV3CodecCRC32C::InitFromConfiguration()           */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    // byte->byte codec
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (configuration.IsValid())
+    {
+        if (configuration.GetType() != CPLJSONObject::Type::Object)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec crc32c: configuration is not an object");
+            return false;
+        }
+
+        for (const auto &oChild : configuration.GetChildren())
+        {
+            CPLError(
+                CE_Failure, CPLE_AppDefined,
+                "Codec crc32c: configuration contains a unhandled member: %s",
+                oChild.GetName().c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Clone()                       */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecCRC32C::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecCRC32C>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*                  ZarrV3CodecCRC32C::EncodeInPlace()                  */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::EncodeInPlace(
+    ZarrByteVectorQuickResize &abyBuffer) const
+{
+    const size_t nSize = abyBuffer.size();
+    uint32_t nCRC = ZarrCRC32C(abyBuffer.data(), nSize);
+    CPL_LSBPTR32(&nCRC);
+    abyBuffer.resize(nSize + sizeof(nCRC));
+    memcpy(abyBuffer.data() + nSize, &nCRC, sizeof(nCRC));
+    return true;
+}
+
+/************************************************************************/
+/*                  ZarrV3CodecCRC32C::DecodeInPlace()                  */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::DecodeInPlace(
+    ZarrByteVectorQuickResize &abyBuffer) const
+{
+    if (abyBuffer.size() < sizeof(uint32_t))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec crc32c: input buffer too small");
+        return false;
+    }
+    const size_t nSize = abyBuffer.size() - sizeof(uint32_t);
+    uint32_t nExpectedCRC;
+    memcpy(&nExpectedCRC, abyBuffer.data() + nSize, sizeof(nExpectedCRC));
+    CPL_LSBPTR32(&nExpectedCRC);
+    if (ZarrCRC32C(abyBuffer.data(), nSize) != nExpectedCRC)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec crc32c: checksum of chunk does not match");
+        return false;
+    }
+    abyBuffer.resize(nSize);
+    return true;
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Encode()                      */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Encode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    abyDst.resize(abySrc.size());
+    memcpy(abyDst.data(), abySrc.data(), abySrc.size());
+    return EncodeInPlace(abyDst);
+}
+
+/************************************************************************/
+/*                     ZarrV3CodecCRC32C::Decode()                      */
+/************************************************************************/
+
+bool ZarrV3CodecCRC32C::Decode(const ZarrByteVectorQuickResize &abySrc,
+                               ZarrByteVectorQuickResize &abyDst) const
+{
+    abyDst.resize(abySrc.size());
+    memcpy(abyDst.data(), abySrc.data(), abySrc.size());
+    return DecodeInPlace(abyDst);
+}
+
 /************************************************************************/
 /*                       ZarrV3CodecEndian()                            */
 /************************************************************************/
@@ -591,6 +918,28 @@ bool ZarrV3CodecEndian::Decode(const ZarrByteVectorQuickResize &abySrc,
     return Encode(abySrc, abyDst);
 }
 
+/************************************************************************/
+/*                  ZarrV3CodecEndian::EncodeInPlace()                  */
+/************************************************************************/
+
+bool ZarrV3CodecEndian::EncodeInPlace(
+    ZarrByteVectorQuickResize &abyBuffer) const
+{
+    // Encode() reads each element before writing it at the same offset, so
+    // it can work with the same source and destination.
+    return Encode(abyBuffer, abyBuffer);
+}
+
+/************************************************************************/
+/*                  ZarrV3CodecEndian::DecodeInPlace()                  */
+/************************************************************************/
+
+bool ZarrV3CodecEndian::DecodeInPlace(
+    ZarrByteVectorQuickResize &abyBuffer) const
+{
+    return Encode(abyBuffer, abyBuffer);
+}
+
 /************************************************************************/
 /*                       ZarrV3CodecTranspose()                         */
 /************************************************************************/
@@ -916,6 +1265,542 @@ bool ZarrV3CodecTranspose::Decode(const ZarrByteVectorQuickResize &abySrc,
     return Transpose(abySrc, abyDst, false);
 }
 
+/************************************************************************/
+/*                     ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::ZarrV3CodecShardingIndexed() : ZarrV3Codec(NAME)
+{
+}
+
+/************************************************************************/
+/*                    ~ZarrV3CodecShardingIndexed()                     */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed::~ZarrV3CodecShardingIndexed() = default;
+
+/************************************************************************/
+/*                           GetConfiguration()                         */
+/************************************************************************/
+
+/* static */ CPLJSONObject ZarrV3CodecShardingIndexed::GetConfiguration(
+    const std::vector<GUInt64> &anInnerBlockSizes,
+    const CPLJSONArray &oInnerCodecs)
+{
+    CPLJSONObject oConfig;
+    CPLJSONArray oChunkShape;
+    for (const auto nSize : anInnerBlockSizes)
+        oChunkShape.Add(static_cast<GInt64>(nSize));
+    oConfig.Add("chunk_shape", oChunkShape);
+
+    // Inner chunks need at least an array -> bytes codec
+    bool bHasArrayToBytesCodec = false;
+    for (const auto &oCodec : oInnerCodecs)
+    {
+        if (oCodec["name"].ToString() != "transpose")
+            bHasArrayToBytesCodec = true;
+    }
+    if (bHasArrayToBytesCodec)
+    {
+        oConfig.Add("codecs", oInnerCodecs);
+    }
+    else
+    {
+        CPLJSONArray oCodecs = oInnerCodecs.Clone().ToArray();
+        CPLJSONObject oCodec;
+        oCodec.Add("name", "endian");
+        oCodec.Add("configuration", ZarrV3CodecEndian::GetConfiguration(true));
+        oCodecs.Add(oCodec);
+        oConfig.Add("codecs", oCodecs);
+    }
+
+    CPLJSONArray oIndexCodecs;
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", "endian");
+        oCodec.Add("configuration", ZarrV3CodecEndian::GetConfiguration(true));
+        oIndexCodecs.Add(oCodec);
+    }
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", "crc32c");
+        oIndexCodecs.Add(oCodec);
+    }
+    oConfig.Add("index_codecs", oIndexCodecs);
+    oConfig.Add("index_location", "end");
+    return oConfig;
+}
+
+/************************************************************************/
+/*              ZarrV3CodecShardingIndexed::InitFromConfiguration()     */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::InitFromConfiguration(
+    const CPLJSONObject &configuration,
+    const ZarrArrayMetadata &oInputArrayMetadata,
+    ZarrArrayMetadata &oOutputArrayMetadata)
+{
+    m_oConfiguration = configuration.Clone();
+    m_oInputArrayMetadata = oInputArrayMetadata;
+    oOutputArrayMetadata = oInputArrayMetadata;
+
+    if (!configuration.IsValid() ||
+        configuration.GetType() != CPLJSONObject::Type::Object)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: configuration missing or not an "
+                 "object");
+        return false;
+    }
+
+    for (const auto &oChild : configuration.GetChildren())
+    {
+        const auto osName = oChild.GetName();
+        if (osName != "chunk_shape" && osName != "codecs" &&
+            osName != "index_codecs" && osName != "index_location")
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: configuration contains a "
+                     "unhandled member: %s",
+                     osName.c_str());
+            return false;
+        }
+    }
+
+    // Parse chunk_shape
+    const auto oChunkShape = configuration.GetArray("chunk_shape");
+    const size_t nDims = oInputArrayMetadata.anBlockSizes.size();
+    if (!oChunkShape.IsValid() ||
+        static_cast<size_t>(oChunkShape.Size()) != nDims)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: chunk_shape missing or not an "
+                 "array with the expected number of elements");
+        return false;
+    }
+    m_anInnerBlockSizes.clear();
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        const auto oVal = oChunkShape[static_cast<int>(i)];
+        const GInt64 nVal = oVal.ToLong();
+        if (oVal.GetType() != CPLJSONObject::Type::Integer &&
+            oVal.GetType() != CPLJSONObject::Type::Long)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: chunk_shape[] contains a "
+                     "non-integer value");
+            return false;
+        }
+        if (nVal <= 0 ||
+            oInputArrayMetadata.anBlockSizes[i] % static_cast<size_t>(nVal) !=
+                0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: chunk_shape[%d] = " CPL_FRMT_GIB
+                     " is not a divisor of the shard shape",
+                     static_cast<int>(i), static_cast<GIntBig>(nVal));
+            return false;
+        }
+        m_anInnerBlockSizes.push_back(static_cast<size_t>(nVal));
+    }
+
+    // Parse codecs applied to inner chunks
+    const auto oCodecs = configuration["codecs"];
+    if (oCodecs.GetType() != CPLJSONObject::Type::Array)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: codecs missing or not an array");
+        return false;
+    }
+    ZarrArrayMetadata oInnerArrayMetadata;
+    oInnerArrayMetadata.oElt = oInputArrayMetadata.oElt;
+    oInnerArrayMetadata.anBlockSizes = m_anInnerBlockSizes;
+    m_poInnerCodecs =
+        std::make_unique<ZarrV3CodecSequence>(oInnerArrayMetadata);
+    if (!m_poInnerCodecs->InitFromJson(oCodecs))
+        return false;
+
+    // Parse index_codecs. We support the sequence of an endian/bytes codec,
+    // optionally followed by a crc32c one, which is what writers produce.
+    const auto oIndexCodecs = configuration["index_codecs"];
+    if (oIndexCodecs.GetType() != CPLJSONObject::Type::Array)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: index_codecs missing or not an "
+                 "array");
+        return false;
+    }
+    m_bIndexLittleEndian = true;
+    m_bIndexHasChecksum = false;
+    int iIndexCodec = 0;
+    for (const auto &oCodec : oIndexCodecs.ToArray())
+    {
+        const auto osName = oCodec["name"].ToString();
+        if (iIndexCodec == 0 && (osName == "endian" || osName == "bytes"))
+        {
+            ZarrV3CodecEndian oEndianCodec;
+            ZarrArrayMetadata oIndexArrayMetadata;
+            oIndexArrayMetadata.oElt.nativeType =
+                DtypeElt::NativeType::UNSIGNED_INT;
+            oIndexArrayMetadata.oElt.nativeSize = sizeof(uint64_t);
+            ZarrArrayMetadata oTmp;
+            if (!oEndianCodec.InitFromConfiguration(
+                    oCodec["configuration"], oIndexArrayMetadata, oTmp))
+                return false;
+            m_bIndexLittleEndian =
+                oCodec["configuration"]["endian"].ToString("little") ==
+                "little";
+        }
+        else if (iIndexCodec == 1 && osName == "crc32c")
+        {
+            m_bIndexHasChecksum = true;
+        }
+        else
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Codec sharding_indexed: unsupported sequence of "
+                     "index_codecs");
+            return false;
+        }
+        ++iIndexCodec;
+    }
+    if (iIndexCodec == 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: index_codecs is empty");
+        return false;
+    }
+
+    const auto osIndexLocation =
+        configuration.GetString("index_location", "end");
+    if (osIndexLocation == "end")
+        m_bIndexAtEnd = true;
+    else if (osIndexLocation == "start")
+        m_bIndexAtEnd = false;
+    else
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Codec sharding_indexed: invalid value for index_location");
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                 ZarrV3CodecShardingIndexed::Clone()                  */
+/************************************************************************/
+
+std::unique_ptr<ZarrV3Codec> ZarrV3CodecShardingIndexed::Clone() const
+{
+    auto psClone = std::make_unique<ZarrV3CodecShardingIndexed>();
+    ZarrArrayMetadata oOutputArrayMetadata;
+    psClone->InitFromConfiguration(m_oConfiguration, m_oInputArrayMetadata,
+                                   oOutputArrayMetadata);
+    return psClone;
+}
+
+/************************************************************************/
+/*           ZarrV3CodecShardingIndexed::GetInnerChunkCount()           */
+/************************************************************************/
+
+size_t ZarrV3CodecShardingIndexed::GetInnerChunkCount() const
+{
+    size_t nCount = 1;
+    for (size_t i = 0; i < m_anInnerBlockSizes.size(); ++i)
+    {
+        nCount *=
+            m_oInputArrayMetadata.anBlockSizes[i] / m_anInnerBlockSizes[i];
+    }
+    return nCount;
+}
+
+/************************************************************************/
+/*             ZarrV3CodecShardingIndexed::GetIndexSize()               */
+/************************************************************************/
+
+size_t ZarrV3CodecShardingIndexed::GetIndexSize() const
+{
+    return GetInnerChunkCount() * 2 * sizeof(uint64_t) +
+           (m_bIndexHasChecksum ? sizeof(uint32_t) : 0);
+}
+
+/************************************************************************/
+/*              ZarrV3CodecShardingIndexed::DecodeIndex()               */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::DecodeIndex(
+    const GByte *pabyIndex, std::vector<uint64_t> &anIndex) const
+{
+    const size_t nValues = 2 * GetInnerChunkCount();
+    const size_t nIndexDataSize = nValues * sizeof(uint64_t);
+    if (m_bIndexHasChecksum)
+    {
+        uint32_t nExpectedCRC;
+        memcpy(&nExpectedCRC, pabyIndex + nIndexDataSize, sizeof(uint32_t));
+        CPL_LSBPTR32(&nExpectedCRC);
+        if (ZarrCRC32C(pabyIndex, nIndexDataSize) != nExpectedCRC)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Codec sharding_indexed: checksum of shard index does "
+                     "not match");
+            return false;
+        }
+    }
+    anIndex.resize(nValues);
+    memcpy(anIndex.data(), pabyIndex, nIndexDataSize);
+#if CPL_IS_LSB
+    const bool bNeedSwap = !m_bIndexLittleEndian;
+#else
+    const bool bNeedSwap = m_bIndexLittleEndian;
+#endif
+    if (bNeedSwap)
+    {
+        for (auto &nVal : anIndex)
+            CPL_SWAP64PTR(&nVal);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*              ZarrV3CodecShardingIndexed::EncodeIndex()               */
+/************************************************************************/
+
+void ZarrV3CodecShardingIndexed::EncodeIndex(
+    const std::vector<uint64_t> &anIndex, std::vector<GByte> &abyIndex) const
+{
+    CPLAssert(anIndex.size() == 2 * GetInnerChunkCount());
+    const size_t nIndexDataSize = anIndex.size() * sizeof(uint64_t);
+    abyIndex.resize(GetIndexSize());
+    memcpy(abyIndex.data(), anIndex.data(), nIndexDataSize);
+#if CPL_IS_LSB
+    const bool bNeedSwap = !m_bIndexLittleEndian;
+#else
+    const bool bNeedSwap = m_bIndexLittleEndian;
+#endif
+    if (bNeedSwap)
+    {
+        for (size_t i = 0; i < anIndex.size(); ++i)
+            CPL_SWAP64PTR(abyIndex.data() + i * sizeof(uint64_t));
+    }
+    if (m_bIndexHasChecksum)
+    {
+        uint32_t nCRC = ZarrCRC32C(abyIndex.data(), nIndexDataSize);
+        CPL_LSBPTR32(&nCRC);
+        memcpy(abyIndex.data() + nIndexDataSize, &nCRC, sizeof(uint32_t));
+    }
+}
+
+/************************************************************************/
+/*             ZarrV3CodecShardingIndexed::CopyInnerChunk()             */
+/************************************************************************/
+
+// Copy an inner chunk from (bToShard = false) or to (bToShard = true)
+// the decoded shard.
+void ZarrV3CodecShardingIndexed::CopyInnerChunk(size_t nInnerChunkIdx,
+                                                GByte *pabyShard,
+                                                GByte *pabyInnerChunk,
+                                                bool bToShard) const
+{
+    const size_t nDims = m_anInnerBlockSizes.size();
+    const size_t nEltSize = m_oInputArrayMetadata.oElt.nativeSize;
+    const auto &anShardSizes = m_oInputArrayMetadata.anBlockSizes;
+    if (nDims == 0)
+    {
+        if (bToShard)
+            memcpy(pabyShard, pabyInnerChunk, nEltSize);
+        else
+            memcpy(pabyInnerChunk, pabyShard, nEltSize);
+        return;
+    }
+
+    // Offset in the shard of the first element of the inner chunk, and
+    // stride (in elements) of each dimension in the shard
+    std::vector<size_t> anShardStrides(nDims);
+    size_t nShardOffset = 0;
+    {
+        size_t nStride = 1;
+        size_t nIdx = nInnerChunkIdx;
+        for (size_t i = nDims; i > 0;)
+        {
+            --i;
+            anShardStrides[i] = nStride;
+            const size_t nChunksInDim =
+                anShardSizes[i] / m_anInnerBlockSizes[i];
+            nShardOffset += (nIdx % nChunksInDim) * m_anInnerBlockSizes[i] *
+                            nStride;
+            nIdx /= nChunksInDim;
+            nStride *= anShardSizes[i];
+        }
+    }
+
+    // Iterate over rows (along the last dimension) of the inner chunk
+    const size_t nRowSize = m_anInnerBlockSizes[nDims - 1] * nEltSize;
+    size_t nRows = 1;
+    for (size_t i = 0; i + 1 < nDims; ++i)
+        nRows *= m_anInnerBlockSizes[i];
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        size_t nOffset = nShardOffset;
+        size_t nIdx = iRow;
+        for (size_t i = nDims - 1; i > 0;)
+        {
+            --i;
+            nOffset += (nIdx % m_anInnerBlockSizes[i]) * anShardStrides[i];
+            nIdx /= m_anInnerBlockSizes[i];
+        }
+        GByte *pabyShardRow = pabyShard + nOffset * nEltSize;
+        GByte *pabyChunkRow = pabyInnerChunk + iRow * nRowSize;
+        if (bToShard)
+            memcpy(pabyShardRow, pabyChunkRow, nRowSize);
+        else
+            memcpy(pabyChunkRow, pabyShardRow, nRowSize);
+    }
+}
+
+/************************************************************************/
+/*               ZarrV3CodecShardingIndexed::Encode()                   */
+/************************************************************************/
+
+bool ZarrV3CodecShardingIndexed::Encode(const ZarrByteVectorQuickResize &abySrc,
+                                        ZarrByteVectorQuickResize &abyDst) const
+{
+    const size_t nEltSize = m_oInputArrayMetadata.oElt.nativeSize;
+    if (abySrc.size() < m_oInputArrayMetadata.GetEltCount() * nEltSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecShardingIndexed::Encode(): input buffer too "
+                 "small");
+        return false;
+    }
+
+    size_t nInnerChunkSize = nEltSize;
+    for (const auto nSize : m_anInnerBlockSizes)
+        nInnerChunkSize *= nSize;
+
+    const size_t nInnerChunkCount = GetInnerChunkCount();
+    const size_t nIndexSize = GetIndexSize();
+    std::vector<uint64_t> anIndex(2 * nInnerChunkCount);
+    std::vector<GByte> abyShard;
+    if (!m_bIndexAtEnd)
+        abyShard.resize(nIndexSize);
+    ZarrByteVectorQuickResize abyInnerChunk;
+    try
+    {
+        for (size_t i = 0; i < nInnerChunkCount; ++i)
+        {
+            abyInnerChunk.resize(nInnerChunkSize);
+            CopyInnerChunk(i, const_cast<GByte *>(abySrc.data()),
+                           abyInnerChunk.data(), false);
+            if (m_poInnerCodecs && !m_poInnerCodecs->Encode(abyInnerChunk))
+                return false;
+            anIndex[2 * i] = abyShard.size();
+            anIndex[2 * i + 1] = abyInnerChunk.size();
+            abyShard.insert(abyShard.end(), abyInnerChunk.data(),
+                            abyInnerChunk.data() + abyInnerChunk.size());
+        }
+
+        std::vector<GByte> abyIndex;
+        EncodeIndex(anIndex, abyIndex);
+        if (m_bIndexAtEnd)
+            abyShard.insert(abyShard.end(), abyIndex.begin(), abyIndex.end());
+        else
+            memcpy(abyShard.data(), abyIndex.data(), nIndexSize);
+
+        abyDst.resize(abyShard.size());
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    memcpy(abyDst.data(), abyShard.data(), abyShard.size());
+    return true;
+}
+
+/************************************************************************/
+/*               ZarrV3CodecShardingIndexed::Decode()                   */
+/************************************************************************/
+
+// Decodes a whole shard. Missing inner chunks are filled with zero bytes:
+// ZarrV3Array uses its own inner chunk based code path, which honours the
+// fill value, when the sharding codec is the only codec.
+bool ZarrV3CodecShardingIndexed::Decode(const ZarrByteVectorQuickResize &abySrc,
+                                        ZarrByteVectorQuickResize &abyDst) const
+{
+    const size_t nIndexSize = GetIndexSize();
+    if (abySrc.size() < nIndexSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "ZarrV3CodecShardingIndexed::Decode(): shard smaller than "
+                 "its index");
+        return false;
+    }
+    std::vector<uint64_t> anIndex;
+    if (!DecodeIndex(abySrc.data() +
+                         (m_bIndexAtEnd ? abySrc.size() - nIndexSize : 0),
+                     anIndex))
+    {
+        return false;
+    }
+
+    const size_t nEltSize = m_oInputArrayMetadata.oElt.nativeSize;
+    size_t nInnerChunkSize = nEltSize;
+    for (const auto nSize : m_anInnerBlockSizes)
+        nInnerChunkSize *= nSize;
+
+    const size_t nShardSize = m_oInputArrayMetadata.GetEltCount() * nEltSize;
+    try
+    {
+        abyDst.resize(nShardSize);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+    memset(abyDst.data(), 0, nShardSize);
+
+    ZarrByteVectorQuickResize abyInnerChunk;
+    const size_t nInnerChunkCount = GetInnerChunkCount();
+    for (size_t i = 0; i < nInnerChunkCount; ++i)
+    {
+        const uint64_t nOffset = anIndex[2 * i];
+        const uint64_t nSize = anIndex[2 * i + 1];
+        if (nOffset == EMPTY_CHUNK && nSize == EMPTY_CHUNK)
+            continue;
+        if (nOffset > abySrc.size() || nSize > abySrc.size() - nOffset)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "ZarrV3CodecShardingIndexed::Decode(): invalid shard "
+                     "index entry");
+            return false;
+        }
+        try
+        {
+            abyInnerChunk.resize(static_cast<size_t>(nSize));
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+            return false;
+        }
+        memcpy(abyInnerChunk.data(), abySrc.data() + nOffset,
+               static_cast<size_t>(nSize));
+        if (m_poInnerCodecs && !m_poInnerCodecs->Decode(abyInnerChunk))
+            return false;
+        if (abyInnerChunk.size() != nInnerChunkSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "ZarrV3CodecShardingIndexed::Decode(): decoded inner "
+                     "chunk has not expected size");
+            return false;
+        }
+        CopyInnerChunk(i, abyDst.data(), abyInnerChunk.data(), true);
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                    ZarrV3CodecSequence::Clone()                      */
 /************************************************************************/
@@ -980,10 +1865,18 @@ bool ZarrV3CodecSequence::InitFromJson(const CPLJSONObject &oCodecs)
             poCodec = std::make_unique<ZarrV3CodecGZip>();
         else if (osName == "blosc")
             poCodec = std::make_unique<ZarrV3CodecBlosc>();
-        else if (osName == "endian")
+        else if (osName == "zstd")
+            poCodec = std::make_unique<ZarrV3CodecZstd>();
+        else if (osName == "crc32c")
+            poCodec = std::make_unique<ZarrV3CodecCRC32C>();
+        // "bytes" is the name of the "endian" codec in the final Zarr V3
+        // specification
+        else if (osName == "endian" || osName == "bytes")
             poCodec = std::make_unique<ZarrV3CodecEndian>();
         else if (osName == "transpose")
             poCodec = std::make_unique<ZarrV3CodecTranspose>();
+        else if (osName == "sharding_indexed")
+            poCodec = std::make_unique<ZarrV3CodecShardingIndexed>();
         else
         {
             CPLError(CE_Failure, CPLE_NotSupported, "Unsupported codec: %s",
@@ -1083,6 +1976,12 @@ bool ZarrV3CodecSequence::Encode(ZarrByteVectorQuickResize &abyBuffer)
         return false;
     for (const auto &poCodec : m_apoCodecs)
     {
+        if (poCodec->CanWorkInPlace())
+        {
+            if (!poCodec->EncodeInPlace(abyBuffer))
+                return false;
+            continue;
+        }
         if (!poCodec->Encode(abyBuffer, m_abyTmp))
             return false;
         std::swap(abyBuffer, m_abyTmp);
@@ -1101,9 +2000,26 @@ bool ZarrV3CodecSequence::Decode(ZarrByteVectorQuickResize &abyBuffer)
     for (auto iter = m_apoCodecs.rbegin(); iter != m_apoCodecs.rend(); ++iter)
     {
         const auto &poCodec = *iter;
+        if (poCodec->CanWorkInPlace())
+        {
+            if (!poCodec->DecodeInPlace(abyBuffer))
+                return false;
+            continue;
+        }
         if (!poCodec->Decode(abyBuffer, m_abyTmp))
             return false;
         std::swap(abyBuffer, m_abyTmp);
     }
     return true;
 }
+
+/************************************************************************/
+/*              ZarrV3CodecSequence::GetShardingIndexedCodec()          */
+/************************************************************************/
+
+ZarrV3CodecShardingIndexed *ZarrV3CodecSequence::GetShardingIndexedCodec() const
+{
+    if (m_apoCodecs.size() != 1)
+        return nullptr;
+    return dynamic_cast<ZarrV3CodecShardingIndexed *>(m_apoCodecs[0].get());
+}
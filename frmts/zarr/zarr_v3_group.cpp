@@ -549,6 +549,36 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
                                   papszOptions))
         return nullptr;
 
+    // Shards group several chunks (that are then inner chunks) in a single
+    // file, with the sharding_indexed codec.
+    std::vector<GUInt64> anShardSize;
+    const char *pszShardBlockSize =
+        CSLFetchNameValue(papszOptions, "SHARD_BLOCKSIZE");
+    if (pszShardBlockSize)
+    {
+        const CPLStringList aosTokens(
+            CSLTokenizeString2(pszShardBlockSize, ",", 0));
+        if (static_cast<size_t>(aosTokens.size()) != anBlockSize.size())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid number of values in SHARD_BLOCKSIZE");
+            return nullptr;
+        }
+        for (size_t i = 0; i < anBlockSize.size(); ++i)
+        {
+            const auto nShardSize =
+                static_cast<GUInt64>(CPLAtoGIntBig(aosTokens[i]));
+            if (nShardSize == 0 || (nShardSize % anBlockSize[i]) != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Values in SHARD_BLOCKSIZE must be multiple of the "
+                         "corresponding values of BLOCKSIZE");
+                return nullptr;
+            }
+            anShardSize.push_back(nShardSize);
+        }
+    }
+
     const char *pszDimSeparator =
         CSLFetchNameValueDef(papszOptions, "DIM_SEPARATOR", "/");
 
@@ -607,6 +637,16 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
                    ZarrV3CodecGZip::GetConfiguration(atoi(pszLevel)));
         oCodecs.Add(oCodec);
     }
+    else if (EQUAL(pszCompressor, "ZSTD"))
+    {
+        CPLJSONObject oCodec;
+        oCodec.Add("name", "zstd");
+        const char *pszLevel =
+            CSLFetchNameValueDef(papszOptions, "ZSTD_LEVEL", "13");
+        oCodec.Add("configuration",
+                   ZarrV3CodecZstd::GetConfiguration(atoi(pszLevel), false));
+        oCodecs.Add(oCodec);
+    }
     else if (EQUAL(pszCompressor, "BLOSC"))
     {
         const auto psCompressor = CPLGetCompressor("blosc");
@@ -666,13 +706,25 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
         return nullptr;
     }
 
+    if (!anShardSize.empty())
+    {
+        // The above codecs become the ones of the inner chunks
+        CPLJSONObject oCodec;
+        oCodec.Add("name", ZarrV3CodecShardingIndexed::NAME);
+        oCodec.Add("configuration",
+                   ZarrV3CodecShardingIndexed::GetConfiguration(anBlockSize,
+                                                                oCodecs));
+        oCodecs = CPLJSONArray();
+        oCodecs.Add(oCodec);
+    }
+
     if (oCodecs.Size() > 0)
     {
         // Byte swapping will be done by the codec chain
         aoDtypeElts.back().needByteSwapping = false;
 
         ZarrArrayMetadata oInputArrayMetadata;
-        for (auto &nSize : anBlockSize)
+        for (auto &nSize : anShardSize.empty() ? anBlockSize : anShardSize)
             oInputArrayMetadata.anBlockSizes.push_back(
                 static_cast<size_t>(nSize));
         oInputArrayMetadata.oElt = aoDtypeElts.back();
@@ -687,6 +739,8 @@ std::shared_ptr<GDALMDArray> ZarrV3Group::CreateMDArray(
 
     if (!poArray)
         return nullptr;
+    if (!anShardSize.empty())
+        poArray->SetShardSize(anShardSize);
     poArray->SetNew(true);
     std::string osFilename =
         CPLFormFilename(osArrayDirectory.c_str(), "zarr.json", nullptr);
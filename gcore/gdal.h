@@ -850,6 +850,22 @@ typedef struct GDALDimensionHS *GDALDimensionH;
  */
 #define GDAL_DMD_SUPPORTED_SQL_DIALECTS "DMD_SUPPORTED_SQL_DIALECTS"
 
+/** List of (space separated) signatures of the files recognized by the driver.
+ *
+ * Each signature is the hexadecimal encoding of the first bytes of a file,
+ * e.g. "89504E470D0A1A0A" for PNG. GDALOpenEx() and GDALIdentifyDriverEx()
+ * skip a driver declaring this item, without calling its Identify() or Open()
+ * methods, for an existing file whose header does not start with any of them.
+ * It is not used for dataset names that are not files (fpL member of
+ * GDALOpenInfo being NULL), such as connection strings.
+ *
+ * A driver should only declare it when its Identify() method always returns
+ * FALSE for files that do not start with one of the signatures.
+ *
+ * @since GDAL 3.10
+ */
+#define GDAL_DMD_OPEN_SIGNATURES "DMD_OPEN_SIGNATURES"
+
 /*! @cond Doxygen_Suppress */
 #define GDAL_DMD_PLUGIN_INSTALLATION_MESSAGE "DMD_PLUGIN_INSTALLATION_MESSAGE"
 /*! @endcond */
@@ -1030,6 +1046,17 @@ GDALDatasetH CPL_DLL CPL_STDCALL GDALOpenShared(const char *, GDALAccess)
 #define GDAL_OF_FROM_GDALOPEN 0x400
 #endif
 
+/** Open in thread-safe mode. Raster read operations of the returned dataset
+ * can be called concurrently from several threads.
+ *
+ * Only compatible with GDAL_OF_RASTER, and not with GDAL_OF_UPDATE or
+ * GDAL_OF_SHARED.
+ *
+ * Used by GDALOpenEx().
+ * @since GDAL 3.10
+ */
+#define GDAL_OF_THREAD_SAFE 0x800
+
 GDALDatasetH CPL_DLL CPL_STDCALL GDALOpenEx(
     const char *pszFilename, unsigned int nOpenFlags,
     const char *const *papszAllowedDrivers, const char *const *papszOpenOptions,
@@ -1247,6 +1274,8 @@ GDALDatasetH CPL_DLL OGR_L_GetDataset(OGRLayerH hLayer);
 
 OGRLayerH CPL_DLL GDALDatasetGetLayerByName(GDALDatasetH, const char *);
 int CPL_DLL GDALDatasetIsLayerPrivate(GDALDatasetH, int);
+bool CPL_DLL GDALDatasetIsThreadSafe(GDALDatasetH, int nScopeFlags,
+                                     CSLConstList papszOptions);
 OGRErr CPL_DLL GDALDatasetDeleteLayer(GDALDatasetH, int);
 OGRLayerH CPL_DLL GDALDatasetCreateLayer(GDALDatasetH, const char *,
                                          OGRSpatialReferenceH,
@@ -1275,6 +1304,9 @@ OGRErr CPL_DLL GDALDatasetStartTransaction(GDALDatasetH hDS, int bForce);
 OGRErr CPL_DLL GDALDatasetCommitTransaction(GDALDatasetH hDS);
 OGRErr CPL_DLL GDALDatasetRollbackTransaction(GDALDatasetH hDS);
 void CPL_DLL GDALDatasetClearStatistics(GDALDatasetH hDS);
+CPLErr CPL_DLL GDALDatasetComputeRasterStatistics(
+    GDALDatasetH hDS, int nBandCount, const int *panBandList, int bApproxOK,
+    GDALProgressFunc pfnProgress, void *pProgressData);
 
 char CPL_DLL **GDALDatasetGetFieldDomainNames(GDALDatasetH, CSLConstList)
     CPL_WARN_UNUSED_RESULT;
@@ -1789,6 +1821,11 @@ int CPL_DLL CPL_STDCALL GDALGetDataCoverageStatus(GDALRasterBandH hBand,
                                                   int nMaskFlagStop,
                                                   double *pdfDataPct);
 
+CPLErr CPL_DLL GDALRasterBandSamplePoints(
+    GDALRasterBandH hBand, size_t nPointCount, const double *padfPixel,
+    const double *padfLine, GDALRIOResampleAlg eResampleAlg,
+    double *padfRealValues, double *padfImagValues, int *pabSuccess);
+
 /* ==================================================================== */
 /*     GDALAsyncReader                                                  */
 /* ==================================================================== */
@@ -2185,6 +2222,8 @@ GIntBig CPL_DLL CPL_STDCALL GDALGetCacheUsed64(void);
 
 int CPL_DLL CPL_STDCALL GDALFlushCacheBlock(void);
 
+char CPL_DLL **GDALGetCacheStatistics(GDALDatasetH hDS);
+
 /* ==================================================================== */
 /*      GDAL virtual memory                                             */
 /* ==================================================================== */
@@ -2397,6 +2436,10 @@ int CPL_DLL GDALMDArrayAdviseReadEx(GDALMDArrayH hArray,
                                     const GUInt64 *arrayStartIdx,
                                     const size_t *count,
                                     CSLConstList papszOptions);
+int CPL_DLL GDALMDArrayReadPoints(GDALMDArrayH hArray, size_t nPoints,
+                                  const GUInt64 *panIndices,
+                                  GDALExtendedDataTypeH hBufferDataType,
+                                  void *pDstBuffer);
 GDALAttributeH CPL_DLL GDALMDArrayGetAttribute(
     GDALMDArrayH hArray, const char *pszName) CPL_WARN_UNUSED_RESULT;
 GDALAttributeH CPL_DLL *
@@ -70,6 +70,7 @@ class GDALRelationship;
 
 #include <stdarg.h>
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <iterator>
@@ -339,6 +340,8 @@ class CPL_DLL GDALOpenInfo
     char **StealSiblingFiles();
     bool AreSiblingFilesLoaded() const;
 
+    static void InvalidateSiblingFilesCache(const char *pszDirname = nullptr);
+
   private:
     CPL_DISALLOW_COPY_ASSIGN(GDALOpenInfo)
 };
@@ -485,6 +488,21 @@ typedef struct GDALSQLParseInfo GDALSQLParseInfo;
 #endif
 //! @endcond
 
+/** Rectangular window of a raster, in pixel coordinates.
+ * @since GDAL 3.10
+ */
+struct GDALRasterWindow
+{
+    /** Left pixel offset */
+    int nXOff = 0;
+    /** Top line offset */
+    int nYOff = 0;
+    /** Width in pixels */
+    int nXSize = 0;
+    /** Height in lines */
+    int nYSize = 0;
+};
+
 /** A set of associated raster bands, usually from one file. */
 class CPL_DLL GDALDataset : public GDALMajorObject
 {
@@ -800,6 +818,8 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     int GetShared() const;
     void MarkAsShared();
 
+    virtual bool IsThreadSafe(int nScopeFlags) const;
+
     void MarkSuppressOnClose();
     void UnMarkSuppressOnClose();
 
@@ -857,6 +877,16 @@ class CPL_DLL GDALDataset : public GDALMajorObject
 
     virtual void ClearStatistics();
 
+    CPLErr ComputeRasterStatistics(int nBandCount, const int *panBandList,
+                                   bool bApproxOK, GDALProgressFunc pfnProgress,
+                                   void *pProgressData);
+
+    void EnableDirtyRegionTracking(bool bEnable = true);
+    bool IsDirtyRegionTrackingEnabled() const;
+    void MarkDirtyRegion(int nXOff, int nYOff, int nXSize, int nYSize);
+    virtual std::vector<GDALRasterWindow> GetDirtyRegions();
+    virtual void ClearDirtyRegions();
+
     /** Convert a GDALDataset* to a GDALDatasetH.
      * @since GDAL 2.3
      */
@@ -1169,6 +1199,10 @@ using GDALDatasetUniquePtr =
 /*                           GDALRasterBlock                            */
 /* ******************************************************************** */
 
+//! @cond Doxygen_Suppress
+struct GDALBlockCacheCounters;
+//! @endcond
+
 /** A single raster block in the block cache.
  *
  * And the global block manager that manages a least-recently-used list of
@@ -1197,8 +1231,29 @@ class CPL_DLL GDALRasterBlock
 
     bool bMustDetach;
 
+    // Index of the partition of the global block cache this block belongs to
+    int nCacheShard;
+
+    // Which list of its cache partition the block is linked to
+    int nCacheList;
+
+    // Value of the inserted bytes counter of its cache partition when the
+    // block was added to it (2Q policy)
+    GIntBig nCacheInsertionPos;
+
     CPL_INTERNAL void Detach_unlocked(void);
     CPL_INTERNAL void Touch_unlocked(void);
+    CPL_INTERNAL void Unlink_unlocked(GDALRasterBlock *&poListOldest,
+                                      GDALRasterBlock *&poListNewest);
+    CPL_INTERNAL void PushNewest_unlocked(GDALRasterBlock *&poListOldest,
+                                          GDALRasterBlock *&poListNewest);
+    CPL_INTERNAL GDALRasterBlock *
+    GetNextEvictionCandidate_unlocked(void) const;
+    CPL_INTERNAL void
+    IncrementCounter(std::atomic<GIntBig> GDALBlockCacheCounters::*pCounter,
+                     GIntBig nInc);
+    CPL_INTERNAL void AccountEviction();
+    CPL_INTERNAL void StoreInCompressedCache();
 
     CPL_INTERNAL void RecycleFor(int nXOffIn, int nYOffIn);
 
@@ -1310,6 +1365,13 @@ class CPL_DLL GDALRasterBlock
     static void EnterDisableDirtyBlockFlush();
     static void LeaveDisableDirtyBlockFlush();
 
+    //! @cond Doxygen_Suppress
+    CPL_INTERNAL static int FlushCacheBlockFromShard(int iShard,
+                                                     int bDirtyBlocksOnly);
+    CPL_INTERNAL static char **GetCacheStatistics(GDALDataset *poDS);
+    CPL_INTERNAL void AccountCompressedCacheHit();
+    //! @endcond
+
 #ifdef notdef
     static void CheckNonOrphanedBlocks(GDALRasterBand *poBand);
     void DumpBlock();
@@ -1377,6 +1439,17 @@ class CPL_DLL GDALColorTable
 
 //! @cond Doxygen_Suppress
 
+//! Counters of the block cache activity (see GDALGetCacheStatistics())
+struct GDALBlockCacheCounters
+{
+    std::atomic<GIntBig> nHits{0};
+    std::atomic<GIntBig> nMisses{0};
+    std::atomic<GIntBig> nEvictions{0};
+    std::atomic<GIntBig> nDirtyBlocksFlushed{0};
+    std::atomic<GIntBig> nBytesWrittenBack{0};
+    std::atomic<GIntBig> nCompressedCacheHits{0};
+};
+
 //! This manages how a raster band store its cached block.
 // only used by GDALRasterBand implementation.
 
@@ -1393,6 +1466,8 @@ class GDALAbstractBandBlockCache
 
     volatile int m_nDirtyBlocks = 0;
 
+    GDALBlockCacheCounters m_sCounters{};
+
     CPL_DISALLOW_COPY_ASSIGN(GDALAbstractBandBlockCache)
 
   protected:
@@ -1433,6 +1508,11 @@ class GDALAbstractBandBlockCache
         return m_nDirtyBlocks > 0;
     }
 
+    GDALBlockCacheCounters &GetCounters()
+    {
+        return m_sCounters;
+    }
+
     virtual bool Init() = 0;
     virtual bool IsInitOK() = 0;
     virtual CPLErr FlushCache() = 0;
@@ -1449,6 +1529,14 @@ GDALArrayBandBlockCacheCreate(GDALRasterBand *poBand);
 GDALAbstractBandBlockCache *
 GDALHashSetBandBlockCacheCreate(GDALRasterBand *poBand);
 
+void GDALCompressedBlockCacheStore(GDALRasterBand *poBand, int nXBlockOff,
+                                   int nYBlockOff, const void *pData,
+                                   size_t nSize);
+bool GDALCompressedBlockCacheRetrieve(GDALRasterBand *poBand, int nXBlockOff,
+                                      int nYBlockOff, void *pData,
+                                      size_t nSize);
+void GDALCompressedBlockCacheDiscardBand(GDALRasterBand *poBand);
+
 //! @endcond
 
 /* ******************************************************************** */
@@ -1589,6 +1677,12 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
     void LeaveReadWrite();
     void InitRWLock();
     void SetValidPercent(GUIntBig nSampleCount, GUIntBig nValidCount);
+    CPLErr StoreComputedStatistics(bool bApproxOK, GUIntBig nSampleCount,
+                                   GUIntBig nValidCount, double dfMin,
+                                   double dfMax, double dfMean,
+                                   double dfStdDev, double *pdfMin,
+                                   double *pdfMax, double *pdfMean,
+                                   double *pdfStdDev);
 
     //! @endcond
 
@@ -1782,6 +1876,13 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                               int nMaskFlagStop = 0,
                               double *pdfDataPct = nullptr);
 
+    CPLErr SamplePoints(size_t nPointCount, const double *padfPixel,
+                        const double *padfLine,
+                        GDALRIOResampleAlg eResampleAlg,
+                        double *padfRealValues,
+                        double *padfImagValues = nullptr,
+                        int *pabSuccess = nullptr);
+
     std::shared_ptr<GDALMDArray> AsMDArray() const;
 
 #ifndef DOXYGEN_XML
@@ -1992,6 +2093,8 @@ class CPL_DLL GDALDriver : public GDALMajorObject
 
     CPLErr SetMetadataItem(const char *pszName, const char *pszValue,
                            const char *pszDomain = "") override;
+    CPLErr SetMetadata(char **papszMetadata,
+                       const char *pszDomain = "") override;
 
     /* -------------------------------------------------------------------- */
     /*      Public C++ methods.                                             */
@@ -2035,6 +2138,10 @@ class CPL_DLL GDALDriver : public GDALMajorObject
     // Not aimed at being used outside of GDAL. Use GDALDataset::Open() instead
     GDALDataset *Open(GDALOpenInfo *poOpenInfo, bool bSetOpenOptions);
 
+    // Used by GDALOpenEx() and GDALIdentifyDriverEx() to skip drivers
+    bool CanOpenKind(int nOpenFlags) const;
+    bool MatchesOpenSignatures(const GDALOpenInfo *poOpenInfo) const;
+
     typedef GDALDataset *(*OpenCallback)(GDALOpenInfo *);
 
     OpenCallback pfnOpen = nullptr;
@@ -2215,6 +2322,16 @@ class CPL_DLL GDALDriver : public GDALMajorObject
     }
 
   private:
+    // Values of metadata items tested for each driver when opening a
+    // dataset, kept up to date by SetMetadataItem() and SetMetadata().
+    bool m_bHasOpenCap = false;
+    bool m_bHasRasterCap = false;
+    bool m_bHasVectorCap = false;
+    bool m_bHasMultiDimRasterCap = false;
+    std::vector<std::string> m_aosOpenSignatures{};
+
+    void UpdateOpenProbeInfo(const char *pszName, const char *pszValue);
+
     CPL_DISALLOW_COPY_ASSIGN(GDALDriver)
 };
 
@@ -2237,6 +2354,7 @@ class CPL_DLL GDALDriver : public GDALMajorObject
  * <li>GDAL_DMD_OPENOPTIONLIST</li>
  * <li>GDAL_DMD_SUBDATASETS</li>
  * <li>GDAL_DMD_CONNECTION_PREFIX</li>
+ * <li>GDAL_DMD_OPEN_SIGNATURES</li>
  * <li>GDAL_DCAP_RASTER</li>
  * <li>GDAL_DCAP_MULTIDIM_RASTER</li>
  * <li>GDAL_DCAP_VECTOR</li>
@@ -3351,11 +3469,23 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
     mutable bool m_bHasTriedCachedArray = false;
     mutable std::shared_ptr<GDALMDArray> m_poCachedArray{};
 
+    // Identifier of this array in the process-wide chunk cache
+    GUInt64 m_nChunkCacheId = 0;
+
   protected:
     //! @cond Doxygen_Suppress
     GDALMDArray(const std::string &osParentName, const std::string &osName,
                 const std::string &osContext = std::string());
 
+    std::shared_ptr<const std::vector<GByte>>
+    GetChunkFromCache(const GUInt64 *panChunkIdx) const;
+
+    void
+    PutChunkInCache(const GUInt64 *panChunkIdx,
+                    std::shared_ptr<const std::vector<GByte>> poData) const;
+
+    void InvalidateChunkCache() const;
+
     virtual bool IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                              CSLConstList papszOptions) const;
 
@@ -3407,6 +3537,8 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
     //! @endcond
 
   public:
+    ~GDALMDArray() override;
+
     GUInt64 GetTotalCopyCost() const;
 
     virtual bool CopyFrom(GDALDataset *poSrcDS, const GDALMDArray *poSrcArray,
@@ -3550,6 +3682,10 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
     bool AdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                     CSLConstList papszOptions = nullptr) const;
 
+    bool ReadPoints(size_t nPoints, const GUInt64 *panIndices,
+                    const GDALExtendedDataType &bufferDataType,
+                    void *pDstBuffer) const;
+
     bool IsRegularlySpaced(double &dfStart, double &dfIncrement) const;
 
     bool GuessGeoTransform(size_t nDimX, size_t nDimY, bool bPixelIsPoint,
@@ -4293,6 +4429,12 @@ void GDALRasterIOExtraArgSetResampleAlg(GDALRasterIOExtraArg *psExtraArg,
 GDALDataset *GDALCreateOverviewDataset(GDALDataset *poDS, int nOvrLevel,
                                        bool bThisLevelOnly);
 
+std::unique_ptr<GDALDataset>
+GDALCreateThreadSafeDataset(std::unique_ptr<GDALDataset> poPrototypeDS,
+                            const char *pszFilename, int nOpenFlags,
+                            CSLConstList papszAllowedDrivers,
+                            CSLConstList papszOpenOptions);
+
 // Should cover particular cases of #3573, #4183, #4506, #6578
 // Behavior is undefined if fVal1 or fVal2 are NaN (should be tested before
 // calling this function)
@@ -4322,6 +4464,11 @@ void GDALSerializeOpenOptionsToXML(CPLXMLNode *psParentNode,
                                    char **papszOpenOptions);
 char **GDALDeserializeOpenOptionsFromXML(const CPLXMLNode *psParentNode);
 
+std::string CPL_DLL
+GDALSerializeRasterWindows(const std::vector<GDALRasterWindow> &aoWindows);
+bool CPL_DLL GDALParseRasterWindows(const char *pszWindows,
+                                    std::vector<GDALRasterWindow> &aoWindows);
+
 int GDALCanFileAcceptSidecarFile(const char *pszFilename);
 
 bool GDALCanReliablyUseSiblingFileList(const char *pszFilename);
@@ -564,6 +564,8 @@ template <>
 inline void GDALCopy4Words(const float *pValueIn, GInt16 *const pValueOut)
 {
     __m128 xmm = _mm_loadu_ps(pValueIn);
+    // NaN -> 0, as _mm_max_ps() would return xmm_min
+    xmm = _mm_and_ps(xmm, _mm_cmpord_ps(xmm, xmm));
 
     const __m128 xmm_min = _mm_set1_ps(-32768);
     const __m128 xmm_max = _mm_set1_ps(32767);
@@ -29,10 +29,144 @@
 #ifndef GDAL_THREAD_POOL_H
 #define GDAL_THREAD_POOL_H
 
+#include "cpl_error.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+
 CPLWorkerThreadPool CPL_DLL *GDALGetGlobalThreadPool(int nThreads);
 
 void GDALDestroyGlobalThreadPool();
 
+/************************************************************************/
+/*                            GDALPendingJob                            */
+/************************************************************************/
+
+/** Base of the jobs run by a worker thread, and whose completion is waited
+ * for by the thread that submitted them. */
+struct GDALPendingJob
+{
+    GDALPendingJob() = default;
+    GDALPendingJob(const GDALPendingJob &) = delete;
+    GDALPendingJob &operator=(const GDALPendingJob &) = delete;
+
+    /** Must be called by the job function once the job is done. */
+    void MarkFinished()
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        m_bFinished = true;
+        m_cv.notify_one();
+    }
+
+    /** Return whether MarkFinished() has been called. */
+    bool IsFinished()
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        return m_bFinished;
+    }
+
+    /** Wait until MarkFinished() has been called. */
+    void WaitFinished()
+    {
+        std::unique_lock<std::mutex> oGuard(m_mutex);
+        // coverity[missing_lock:FALSE]
+        while (!m_bFinished)
+        {
+            m_cv.wait(oGuard);
+        }
+    }
+
+  private:
+    bool m_bFinished = false;
+    std::mutex m_mutex{};
+    std::condition_variable m_cv{};
+};
+
+/************************************************************************/
+/*                          GDALPendingJobList                          */
+/************************************************************************/
+
+/** Jobs submitted to a CPLJobQueue, whose results are finalized (typically
+ * written) in the submitting thread, in submission order.
+ *
+ * Job must derive from GDALPendingJob. The finalization callbacks are called
+ * as pfnFinalize(Job *) and return a CPLErr.
+ */
+template <class Job> class GDALPendingJobList
+{
+    std::list<std::unique_ptr<Job>> m_apoJobs{};
+
+  public:
+    GDALPendingJobList() = default;
+    GDALPendingJobList(const GDALPendingJobList &) = delete;
+    GDALPendingJobList &operator=(const GDALPendingJobList &) = delete;
+
+    /** Return whether there is no pending job. */
+    bool empty() const
+    {
+        return m_apoJobs.empty();
+    }
+
+    /** Submit pfnFunc(poJob) to poJobQueue, and add poJob to the list.
+     * The job is run in the calling thread if it cannot be submitted. */
+    void Submit(CPLJobQueue *poJobQueue, CPLThreadFunc pfnFunc,
+                std::unique_ptr<Job> &&poJob)
+    {
+        if (!poJobQueue->SubmitJob(pfnFunc, poJob.get()))
+            pfnFunc(poJob.get());
+        m_apoJobs.emplace_back(std::move(poJob));
+    }
+
+    /** Wait for the completion of the oldest job, finalize it and remove it
+     * from the list. */
+    template <class Finalize>
+    CPLErr WaitAndFinalizeOldestJob(const Finalize &pfnFinalize)
+    {
+        Job *poOldestJob = m_apoJobs.front().get();
+        poOldestJob->WaitFinished();
+        const CPLErr eErr = pfnFinalize(poOldestJob);
+        m_apoJobs.pop_front();
+        return eErr;
+    }
+
+    /** Finalize the already finished jobs, and wait for the completion of
+     * the oldest ones until less than nMaxPendingJobs remain, to bound RAM
+     * usage. Stops at the first error. */
+    template <class Finalize>
+    CPLErr FinalizeFinishedJobs(size_t nMaxPendingJobs,
+                                const Finalize &pfnFinalize)
+    {
+        CPLErr eErr = CE_None;
+        while (eErr == CE_None && !m_apoJobs.empty() &&
+               m_apoJobs.front()->IsFinished())
+        {
+            eErr = WaitAndFinalizeOldestJob(pfnFinalize);
+        }
+        while (eErr == CE_None && !m_apoJobs.empty() &&
+               m_apoJobs.size() >= nMaxPendingJobs)
+        {
+            eErr = WaitAndFinalizeOldestJob(pfnFinalize);
+        }
+        return eErr;
+    }
+
+    /** Wait for the completion of all jobs and finalize them. Return the
+     * first error. */
+    template <class Finalize>
+    CPLErr FinalizeAllJobs(const Finalize &pfnFinalize)
+    {
+        CPLErr eErr = CE_None;
+        while (!m_apoJobs.empty())
+        {
+            const CPLErr eJobErr = WaitAndFinalizeOldestJob(pfnFinalize);
+            if (eJobErr != CE_None && eErr == CE_None)
+                eErr = eJobErr;
+        }
+        return eErr;
+    }
+};
+
 #endif  // GDAL_THREAD_POOL_H
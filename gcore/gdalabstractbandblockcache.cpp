@@ -62,6 +62,7 @@ GDALAbstractBandBlockCache::GDALAbstractBandBlockCache(GDALRasterBand *poBandIn)
 GDALAbstractBandBlockCache::~GDALAbstractBandBlockCache()
 {
     CPLAssert(nKeepAliveCounter == 0);
+    GDALCompressedBlockCacheDiscardBand(poBand);
     FreeDanglingBlocks();
     if (hSpinLock)
         CPLDestroyLock(hSpinLock);
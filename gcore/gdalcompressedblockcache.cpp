@@ -0,0 +1,330 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Second tier of the raster block cache, that keeps clean blocks
+ *           evicted from the main block cache in a compressed form.
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdal_priv.h"
+
+#include "cpl_compressor.h"
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+
+#include <climits>
+#include <cstring>
+#include <limits>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+
+/************************************************************************/
+/*                     GDALCompressedBlockCache                         */
+/************************************************************************/
+
+class GDALCompressedBlockCache
+{
+    using Key = std::tuple<const GDALRasterBand *, int, int>;
+
+    struct Entry
+    {
+        Key key{};
+        std::vector<GByte> abyCompressed{};
+    };
+
+    std::mutex m_oMutex{};
+    std::list<Entry> m_oList{};  // front is most recently stored
+    std::map<Key, std::list<Entry>::iterator> m_oMap{};
+    size_t m_nUsed = 0;
+    size_t m_nMax = 0;
+    const CPLCompressor *m_psCompressor = nullptr;
+    const CPLCompressor *m_psDecompressor = nullptr;
+    CPLStringList m_aosCompressorOptions{};
+
+    // Approximate memory cost of an entry, in addition to its payload.
+    static constexpr size_t ENTRY_OVERHEAD = 128;
+
+    void RemoveEntry(std::list<Entry>::iterator oIter)
+    {
+        m_nUsed -= oIter->abyCompressed.size() + ENTRY_OVERHEAD;
+        m_oMap.erase(oIter->key);
+        m_oList.erase(oIter);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALCompressedBlockCache)
+
+  public:
+    GDALCompressedBlockCache();
+
+    bool IsEnabled() const
+    {
+        return m_nMax > 0;
+    }
+
+    void Store(const GDALRasterBand *poBand, int nXBlockOff, int nYBlockOff,
+               const void *pData, size_t nSize);
+    bool Retrieve(const GDALRasterBand *poBand, int nXBlockOff, int nYBlockOff,
+                  void *pData, size_t nSize);
+    void DiscardBand(const GDALRasterBand *poBand);
+};
+
+/************************************************************************/
+/*                      GDALCompressedBlockCache()                      */
+/************************************************************************/
+
+GDALCompressedBlockCache::GDALCompressedBlockCache()
+{
+    const char *pszMax = CPLGetConfigOption("GDAL_COMPRESSED_CACHEMAX", "0");
+    double dfMax = CPLAtof(pszMax);
+    if (strchr(pszMax, '%') != nullptr)
+    {
+        const GIntBig nUsablePhysicalRAM = CPLGetUsablePhysicalRAM();
+        dfMax = nUsablePhysicalRAM > 0
+                    ? static_cast<double>(nUsablePhysicalRAM) * dfMax / 100.0
+                    : 0;
+    }
+    else if (dfMax < 100000)
+    {
+        dfMax *= 1024 * 1024;
+    }
+    if (!(dfMax >= 0 && dfMax < 1e15) ||
+        dfMax > static_cast<double>(std::numeric_limits<size_t>::max()))
+    {
+        CPLError(CE_Warning, CPLE_IllegalArg,
+                 "Invalid value for GDAL_COMPRESSED_CACHEMAX. Ignoring it");
+        return;
+    }
+    if (dfMax == 0)
+        return;
+
+    const char *pszMethod =
+        CPLGetConfigOption("GDAL_COMPRESSED_CACHE_METHOD", nullptr);
+    if (pszMethod)
+    {
+        m_psCompressor = CPLGetCompressor(pszMethod);
+        m_psDecompressor = CPLGetDecompressor(pszMethod);
+        if (!m_psCompressor || !m_psDecompressor)
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "Compression method %s for GDAL_COMPRESSED_CACHE_METHOD "
+                     "is not available. Compressed block cache disabled",
+                     pszMethod);
+            return;
+        }
+    }
+    else
+    {
+        // Favor fast codecs
+        for (const char *pszCandidate : {"lz4", "zstd", "zlib"})
+        {
+            m_psCompressor = CPLGetCompressor(pszCandidate);
+            m_psDecompressor = CPLGetDecompressor(pszCandidate);
+            if (m_psCompressor && m_psDecompressor)
+            {
+                pszMethod = pszCandidate;
+                break;
+            }
+        }
+        if (!m_psCompressor || !m_psDecompressor)
+            return;
+    }
+    if (EQUAL(pszMethod, "zstd") || EQUAL(pszMethod, "zlib") ||
+        EQUAL(pszMethod, "gzip"))
+    {
+        m_aosCompressorOptions.SetNameValue("LEVEL", "1");
+    }
+
+    m_nMax = static_cast<size_t>(dfMax);
+    CPLDebug("GDAL", "GDAL_COMPRESSED_CACHEMAX = " CPL_FRMT_GUIB " MB (%s)",
+             static_cast<GUIntBig>(m_nMax / (1024 * 1024)), pszMethod);
+}
+
+/************************************************************************/
+/*                               Store()                                */
+/************************************************************************/
+
+void GDALCompressedBlockCache::Store(const GDALRasterBand *poBand,
+                                     int nXBlockOff, int nYBlockOff,
+                                     const void *pData, size_t nSize)
+{
+    // Only keep blocks that compress to less than 3/4 of their size.
+    size_t nOutSize = nSize - nSize / 4;
+    if (nOutSize + ENTRY_OVERHEAD > m_nMax)
+        return;
+    std::vector<GByte> abyCompressed;
+    try
+    {
+        abyCompressed.resize(nOutSize);
+    }
+    catch (const std::exception &)
+    {
+        return;
+    }
+    void *pOut = abyCompressed.data();
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    if (!m_psCompressor->pfnFunc(pData, nSize, &pOut, &nOutSize,
+                                 m_aosCompressorOptions.List(),
+                                 m_psCompressor->user_data))
+    {
+        return;
+    }
+    abyCompressed.resize(nOutSize);
+    abyCompressed.shrink_to_fit();
+
+    const Key key(poBand, nXBlockOff, nYBlockOff);
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    auto oIterMap = m_oMap.find(key);
+    if (oIterMap != m_oMap.end())
+        RemoveEntry(oIterMap->second);
+    m_nUsed += nOutSize + ENTRY_OVERHEAD;
+    while (m_nUsed > m_nMax && !m_oList.empty())
+        RemoveEntry(std::prev(m_oList.end()));
+    m_oList.emplace_front();
+    m_oList.front().key = key;
+    m_oList.front().abyCompressed = std::move(abyCompressed);
+    m_oMap[key] = m_oList.begin();
+}
+
+/************************************************************************/
+/*                              Retrieve()                              */
+/************************************************************************/
+
+bool GDALCompressedBlockCache::Retrieve(const GDALRasterBand *poBand,
+                                        int nXBlockOff, int nYBlockOff,
+                                        void *pData, size_t nSize)
+{
+    // The block goes back to the main block cache, so remove it from there.
+    std::vector<GByte> abyCompressed;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        auto oIterMap = m_oMap.find(Key(poBand, nXBlockOff, nYBlockOff));
+        if (oIterMap == m_oMap.end())
+            return false;
+        auto oIterList = oIterMap->second;
+        abyCompressed.swap(oIterList->abyCompressed);
+        // RemoveEntry() will only account for the overhead now
+        m_nUsed -= abyCompressed.size();
+        RemoveEntry(oIterList);
+    }
+
+    size_t nOutSize = nSize;
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    return m_psDecompressor->pfnFunc(abyCompressed.data(), abyCompressed.size(),
+                                     &pData, &nOutSize, nullptr,
+                                     m_psDecompressor->user_data) &&
+           nOutSize == nSize;
+}
+
+/************************************************************************/
+/*                             DiscardBand()                            */
+/************************************************************************/
+
+void GDALCompressedBlockCache::DiscardBand(const GDALRasterBand *poBand)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    auto oIter = m_oMap.lower_bound(Key(poBand, INT_MIN, INT_MIN));
+    while (oIter != m_oMap.end() && std::get<0>(oIter->first) == poBand)
+    {
+        auto oIterList = oIter->second;
+        ++oIter;
+        RemoveEntry(oIterList);
+    }
+}
+
+/************************************************************************/
+/*                    GetCompressedBlockCache()                         */
+/************************************************************************/
+
+GDALCompressedBlockCache *GetCompressedBlockCache()
+{
+    static GDALCompressedBlockCache oCache;
+    return oCache.IsEnabled() ? &oCache : nullptr;
+}
+
+/************************************************************************/
+/*                            IsEligible()                              */
+/************************************************************************/
+
+// Only blocks of read-only bands are cached, so that there is no need to
+// track modifications of the underlying data.
+bool IsEligible(GDALRasterBand *poBand)
+{
+    return poBand->GetAccess() == GA_ReadOnly;
+}
+
+}  // namespace
+
+/*! @cond Doxygen_Suppress */
+
+/************************************************************************/
+/*                   GDALCompressedBlockCacheStore()                    */
+/************************************************************************/
+
+/** Store a clean block that is evicted from the main block cache */
+void GDALCompressedBlockCacheStore(GDALRasterBand *poBand, int nXBlockOff,
+                                   int nYBlockOff, const void *pData,
+                                   size_t nSize)
+{
+    auto poCache = GetCompressedBlockCache();
+    if (poCache && IsEligible(poBand))
+        poCache->Store(poBand, nXBlockOff, nYBlockOff, pData, nSize);
+}
+
+/************************************************************************/
+/*                  GDALCompressedBlockCacheRetrieve()                  */
+/************************************************************************/
+
+/** Try to fill pData with a block from the compressed cache.
+ *
+ * @return true if the block was found (in which case it is removed from the
+ * compressed cache).
+ */
+bool GDALCompressedBlockCacheRetrieve(GDALRasterBand *poBand, int nXBlockOff,
+                                      int nYBlockOff, void *pData, size_t nSize)
+{
+    auto poCache = GetCompressedBlockCache();
+    return poCache && IsEligible(poBand) &&
+           poCache->Retrieve(poBand, nXBlockOff, nYBlockOff, pData, nSize);
+}
+
+/************************************************************************/
+/*                 GDALCompressedBlockCacheDiscardBand()                */
+/************************************************************************/
+
+/** Remove all blocks of a band from the compressed cache */
+void GDALCompressedBlockCacheDiscardBand(GDALRasterBand *poBand)
+{
+    auto poCache = GetCompressedBlockCache();
+    if (poCache)
+        poCache->DiscardBand(poBand);
+}
+
+/*! @endcond */
@@ -37,7 +37,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <new>
 #include <set>
 #include <string>
@@ -123,6 +125,12 @@ class GDALDataset::Private
 
     bool m_bOverviewsEnabled = true;
 
+    // Only modified under m_oDirtyRegionMutex, but read without it by
+    // MarkDirtyRegion() to keep writes cheap when tracking is disabled
+    std::atomic<bool> m_bDirtyRegionTracking{false};
+    std::mutex m_oDirtyRegionMutex{};
+    std::vector<GDALRasterWindow> m_aoDirtyRegions{};
+
     Private() = default;
 };
 
@@ -1664,6 +1672,58 @@ int GDALDataset::GetShared() const
     return bShared;
 }
 
+/************************************************************************/
+/*                            IsThreadSafe()                            */
+/************************************************************************/
+
+/**
+ * \brief Returns whether this dataset can be used concurrently from several
+ * threads.
+ *
+ * This is the case of datasets opened with the GDAL_OF_THREAD_SAFE flag of
+ * GDALOpenEx(), for the raster read operations.
+ *
+ * This method is the same as the C function GDALDatasetIsThreadSafe().
+ *
+ * @param nScopeFlags Combination of GDAL_OF_RASTER, GDAL_OF_VECTOR and
+ * GDAL_OF_MULTIDIM_RASTER, for the kinds of operations to test.
+ * @return true if the dataset is thread-safe for all the requested scopes.
+ * @since GDAL 3.10
+ */
+
+bool GDALDataset::IsThreadSafe(CPL_UNUSED int nScopeFlags) const
+{
+    return false;
+}
+
+/************************************************************************/
+/*                       GDALDatasetIsThreadSafe()                      */
+/************************************************************************/
+
+/**
+ * \brief Returns whether this dataset can be used concurrently from several
+ * threads.
+ *
+ * This function is the same as the C++ method GDALDataset::IsThreadSafe()
+ *
+ * @param hDS the dataset handle.
+ * @param nScopeFlags Combination of GDAL_OF_RASTER, GDAL_OF_VECTOR and
+ * GDAL_OF_MULTIDIM_RASTER, for the kinds of operations to test.
+ * @param papszOptions Unused. Should be NULL.
+ * @return true if the dataset is thread-safe for all the requested scopes.
+ * @since GDAL 3.10
+ */
+
+bool GDALDatasetIsThreadSafe(GDALDatasetH hDS, int nScopeFlags,
+                             CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetIsThreadSafe", false);
+
+    CPL_IGNORE_RET_VAL(papszOptions);
+
+    return GDALDataset::FromHandle(hDS)->IsThreadSafe(nScopeFlags);
+}
+
 /************************************************************************/
 /*                            MarkAsShared()                            */
 /************************************************************************/
@@ -2757,6 +2817,9 @@ CPLErr GDALDataset::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     if (eErr != CE_None || bStopProcessing)
         return eErr;
 
+    if (eRWFlag == GF_Write)
+        MarkDirtyRegion(nXOff, nYOff, nXSize, nYSize);
+
     /* -------------------------------------------------------------------- */
     /*      If pixel and line spacing are defaulted assign reasonable      */
     /*      value assuming a packed buffer.                                 */
@@ -3544,6 +3607,12 @@ static GDALDataset *GetSharedDS(const char *pszFilename,
  * from the same thread.</li> <li>Verbose error: GDAL_OF_VERBOSE_ERROR. If set,
  * a failed attempt to open the file will lead to an error message to be
  * reported.</li>
+ * <li>Thread-safe mode: GDAL_OF_THREAD_SAFE (since GDAL 3.10). If set,
+ * the returned dataset can be used to read raster data concurrently from
+ * several threads. Each calling thread transparently gets its own underlying
+ * dataset, opened on the same file, which is closed when that thread exits.
+ * Only compatible with GDAL_OF_RASTER in read-only mode, and without
+ * GDAL_OF_SHARED.</li>
  * </ul>
  *
  * @param papszAllowedDrivers NULL to consider all candidate drivers, or a NULL
@@ -3582,6 +3651,38 @@ GDALDatasetH CPL_STDCALL GDALOpenEx(const char *pszFilename,
 {
     VALIDATE_POINTER1(pszFilename, "GDALOpen", nullptr);
 
+    /* -------------------------------------------------------------------- */
+    /*      In case of thread-safe dataset, open a regular one that will    */
+    /*      serve as a prototype for the per-thread datasets.               */
+    /* -------------------------------------------------------------------- */
+    if (nOpenFlags & GDAL_OF_THREAD_SAFE)
+    {
+        if (nOpenFlags & (GDAL_OF_VECTOR | GDAL_OF_MULTIDIM_RASTER |
+                          GDAL_OF_GNM | GDAL_OF_UPDATE | GDAL_OF_SHARED))
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "GDAL_OF_THREAD_SAFE is only compatible with "
+                     "GDAL_OF_RASTER in read-only mode");
+            return nullptr;
+        }
+        nOpenFlags &= ~GDAL_OF_THREAD_SAFE;
+        nOpenFlags |= GDAL_OF_RASTER;
+        std::unique_ptr<GDALDataset> poPrototypeDS(
+            GDALDataset::FromHandle(GDALOpenEx(
+                pszFilename, nOpenFlags | GDAL_OF_INTERNAL, papszAllowedDrivers,
+                papszOpenOptions, papszSiblingFiles)));
+        if (!poPrototypeDS)
+            return nullptr;
+        auto poDS = GDALCreateThreadSafeDataset(
+            std::move(poPrototypeDS), pszFilename, nOpenFlags,
+            papszAllowedDrivers, papszOpenOptions);
+        if (!poDS)
+            return nullptr;
+        if (!(nOpenFlags & GDAL_OF_INTERNAL))
+            poDS->AddToDatasetOpenList();
+        return poDS.release();
+    }
+
     // If no driver kind is specified, assume all are to be probed.
     if ((nOpenFlags & GDAL_OF_KIND_MASK) == 0)
         nOpenFlags |= GDAL_OF_KIND_MASK & ~GDAL_OF_MULTIDIM_RASTER;
@@ -3701,20 +3802,10 @@ retry:
             continue;
         }
 
-        if (poDriver->GetMetadataItem(GDAL_DCAP_OPEN) == nullptr)
-            continue;
-
-        if ((nOpenFlags & GDAL_OF_RASTER) != 0 &&
-            (nOpenFlags & GDAL_OF_VECTOR) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_RASTER) == nullptr)
-            continue;
-        if ((nOpenFlags & GDAL_OF_VECTOR) != 0 &&
-            (nOpenFlags & GDAL_OF_RASTER) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_VECTOR) == nullptr)
-            continue;
-        if ((nOpenFlags & GDAL_OF_MULTIDIM_RASTER) != 0 &&
-            (nOpenFlags & GDAL_OF_RASTER) == 0 &&
-            poDriver->GetMetadataItem(GDAL_DCAP_MULTIDIM_RASTER) == nullptr)
+        // Cheap checks on cached driver capabilities and file signatures,
+        // that avoid calling Identify() on all drivers.
+        if (!poDriver->CanOpenKind(nOpenFlags) ||
+            !poDriver->MatchesOpenSignatures(&oOpenInfo))
             continue;
 
         // Remove general OVERVIEW_LEVEL open options from list before passing
@@ -9019,6 +9110,235 @@ void GDALDatasetClearStatistics(GDALDatasetH hDS)
     GDALDataset::FromHandle(hDS)->ClearStatistics();
 }
 
+/************************************************************************/
+/*                     EnableDirtyRegionTracking()                      */
+/************************************************************************/
+
+/** Enable or disable tracking of the regions modified by write operations.
+ *
+ * When enabled, GDALDataset::RasterIO(), GDALRasterBand::RasterIO(),
+ * GDALRasterBand::WriteBlock() and GDALRasterBand::Fill() record the
+ * window they write to, so that GetDirtyRegions() can later be used, for
+ * example to only refresh the overview tiles intersecting the modified
+ * areas (see the DIRTY_REGIONS option of GDALRegenerateOverviewsMultiBand()).
+ *
+ * Disabling tracking discards the regions recorded so far.
+ *
+ * Drivers may enable tracking themselves, and persist the regions (e.g.
+ * GTiff with the TRACK_DIRTY_REGIONS=YES open option).
+ *
+ * @param bEnable Whether to enable tracking.
+ * @since GDAL 3.10
+ */
+
+void GDALDataset::EnableDirtyRegionTracking(bool bEnable)
+{
+    if (m_poPrivate)
+    {
+        std::lock_guard oLock(m_poPrivate->m_oDirtyRegionMutex);
+        m_poPrivate->m_bDirtyRegionTracking = bEnable;
+        if (!bEnable)
+            m_poPrivate->m_aoDirtyRegions.clear();
+    }
+}
+
+/************************************************************************/
+/*                    IsDirtyRegionTrackingEnabled()                    */
+/************************************************************************/
+
+/** Return whether tracking of the modified regions is enabled.
+ *
+ * @see EnableDirtyRegionTracking()
+ * @since GDAL 3.10
+ */
+
+bool GDALDataset::IsDirtyRegionTrackingEnabled() const
+{
+    return m_poPrivate && m_poPrivate->m_bDirtyRegionTracking;
+}
+
+/************************************************************************/
+/*                          MarkDirtyRegion()                           */
+/************************************************************************/
+
+/** Record that a window of the dataset has been modified.
+ *
+ * This is a no-op if tracking is not enabled. Consecutive windows that are
+ * adjacent or overlapping enough are coalesced into their bounding box, so
+ * that writing a raster block by block results in a compact list.
+ *
+ * @see EnableDirtyRegionTracking()
+ * @since GDAL 3.10
+ */
+
+void GDALDataset::MarkDirtyRegion(int nXOff, int nYOff, int nXSize,
+                                  int nYSize)
+{
+    if (!m_poPrivate || !m_poPrivate->m_bDirtyRegionTracking ||
+        nXSize <= 0 || nYSize <= 0)
+    {
+        return;
+    }
+
+    std::lock_guard oLock(m_poPrivate->m_oDirtyRegionMutex);
+    // Tracking may have been disabled meanwhile
+    if (!m_poPrivate->m_bDirtyRegionTracking)
+        return;
+    auto &aoRegions = m_poPrivate->m_aoDirtyRegions;
+
+    const auto Area = [](const GDALRasterWindow &w)
+    { return static_cast<GIntBig>(w.nXSize) * w.nYSize; };
+
+    // Returns the bounding box of a and b if it is not larger than the sum
+    // of their areas (adjacent windows, or one containing the other).
+    const auto TryMerge = [&Area](const GDALRasterWindow &a,
+                                  const GDALRasterWindow &b,
+                                  GDALRasterWindow &oUnion)
+    {
+        const int nMinX = std::min(a.nXOff, b.nXOff);
+        const int nMinY = std::min(a.nYOff, b.nYOff);
+        const int nMaxX = std::max(a.nXOff + a.nXSize, b.nXOff + b.nXSize);
+        const int nMaxY = std::max(a.nYOff + a.nYSize, b.nYOff + b.nYSize);
+        oUnion.nXOff = nMinX;
+        oUnion.nYOff = nMinY;
+        oUnion.nXSize = nMaxX - nMinX;
+        oUnion.nYSize = nMaxY - nMinY;
+        return Area(oUnion) <= Area(a) + Area(b);
+    };
+
+    GDALRasterWindow oNew;
+    oNew.nXOff = nXOff;
+    oNew.nYOff = nYOff;
+    oNew.nXSize = nXSize;
+    oNew.nYSize = nYSize;
+
+    GDALRasterWindow oUnion;
+    if (!aoRegions.empty() && TryMerge(aoRegions.back(), oNew, oUnion))
+    {
+        aoRegions.back() = oUnion;
+        // A completed row of blocks may now be mergeable with the previous
+        // row.
+        while (aoRegions.size() >= 2 &&
+               TryMerge(aoRegions[aoRegions.size() - 2], aoRegions.back(),
+                        oUnion))
+        {
+            aoRegions.pop_back();
+            aoRegions.back() = oUnion;
+        }
+        return;
+    }
+
+    constexpr size_t MAX_DIRTY_REGIONS = 65536;
+    if (aoRegions.size() == MAX_DIRTY_REGIONS)
+    {
+        // Too many scattered writes: fall back to their bounding box
+        for (const auto &oRegion : aoRegions)
+        {
+            TryMerge(oRegion, oNew, oUnion);
+            oNew = oUnion;
+        }
+        aoRegions.clear();
+    }
+    aoRegions.push_back(oNew);
+}
+
+/************************************************************************/
+/*                          GetDirtyRegions()                           */
+/************************************************************************/
+
+/** Return the regions modified since tracking was enabled, or since the
+ * last call to ClearDirtyRegions().
+ *
+ * The returned windows may overlap. Drivers that persist the regions
+ * (e.g. GTiff) also return the ones recorded in previous sessions.
+ *
+ * @see EnableDirtyRegionTracking()
+ * @since GDAL 3.10
+ */
+
+std::vector<GDALRasterWindow> GDALDataset::GetDirtyRegions()
+{
+    if (!m_poPrivate)
+        return {};
+    std::lock_guard oLock(m_poPrivate->m_oDirtyRegionMutex);
+    return m_poPrivate->m_aoDirtyRegions;
+}
+
+/************************************************************************/
+/*                         ClearDirtyRegions()                          */
+/************************************************************************/
+
+/** Forget the modified regions recorded so far (and persisted ones, for
+ * drivers that support it). Tracking remains enabled.
+ *
+ * @see EnableDirtyRegionTracking()
+ * @since GDAL 3.10
+ */
+
+void GDALDataset::ClearDirtyRegions()
+{
+    if (m_poPrivate)
+    {
+        std::lock_guard oLock(m_poPrivate->m_oDirtyRegionMutex);
+        m_poPrivate->m_aoDirtyRegions.clear();
+    }
+}
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                     GDALSerializeRasterWindows()                     */
+/************************************************************************/
+
+// Serialize windows as "xoff,yoff,xsize,ysize;xoff,yoff,xsize,ysize;..."
+
+std::string
+GDALSerializeRasterWindows(const std::vector<GDALRasterWindow> &aoWindows)
+{
+    std::string osRet;
+    for (const auto &oWindow : aoWindows)
+    {
+        if (!osRet.empty())
+            osRet += ';';
+        osRet += CPLSPrintf("%d,%d,%d,%d", oWindow.nXOff, oWindow.nYOff,
+                            oWindow.nXSize, oWindow.nYSize);
+    }
+    return osRet;
+}
+
+/************************************************************************/
+/*                       GDALParseRasterWindows()                       */
+/************************************************************************/
+
+// Parse the output of GDALSerializeRasterWindows(), and append the windows
+// to aoWindows. Returns false in case of syntax error.
+
+bool GDALParseRasterWindows(const char *pszWindows,
+                            std::vector<GDALRasterWindow> &aoWindows)
+{
+    const CPLStringList aosWindows(CSLTokenizeString2(pszWindows, ";", 0));
+    for (const char *pszWindow : aosWindows)
+    {
+        const CPLStringList aosTokens(CSLTokenizeString2(pszWindow, ",", 0));
+        if (aosTokens.size() != 4)
+            return false;
+        GDALRasterWindow oWindow;
+        oWindow.nXOff = atoi(aosTokens[0]);
+        oWindow.nYOff = atoi(aosTokens[1]);
+        oWindow.nXSize = atoi(aosTokens[2]);
+        oWindow.nYSize = atoi(aosTokens[3]);
+        if (oWindow.nXOff < 0 || oWindow.nYOff < 0 || oWindow.nXSize <= 0 ||
+            oWindow.nYSize <= 0)
+        {
+            return false;
+        }
+        aoWindows.push_back(oWindow);
+    }
+    return true;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                        GetFieldDomainNames()                         */
 /************************************************************************/
@@ -32,6 +32,8 @@
 #include "gdal_priv.h"
 #include "gdal_rat.h"
 
+#include <algorithm>
+#include <cctype>
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
@@ -2691,6 +2693,9 @@ GDALDriverH CPL_STDCALL GDALIdentifyDriverEx(
             continue;
         }
 
+        if (!poDriver->MatchesOpenSignatures(&oOpenInfo))
+            continue;
+
         if (papszAllowedDrivers != nullptr &&
             CSLFindString(papszAllowedDrivers,
                           GDALGetDriverShortName(poDriver)) == -1)
@@ -2754,6 +2759,9 @@ GDALDriverH CPL_STDCALL GDALIdentifyDriverEx(
             poDriver->GetMetadataItem(GDAL_DCAP_VECTOR) == nullptr)
             continue;
 
+        if (!poDriver->MatchesOpenSignatures(&oOpenInfo))
+            continue;
+
         if (poDriver->pfnIdentifyEx != nullptr)
         {
             if (poDriver->pfnIdentifyEx(poDriver, &oOpenInfo) == 0)
@@ -2819,10 +2827,126 @@ CPLErr GDALDriver::SetMetadataItem(const char *pszName, const char *pszValue,
         {
             GDALMajorObject::SetMetadataItem(GDAL_DMD_EXTENSION, pszValue);
         }
+        UpdateOpenProbeInfo(pszName, pszValue);
     }
     return GDALMajorObject::SetMetadataItem(pszName, pszValue, pszDomain);
 }
 
+/************************************************************************/
+/*                            SetMetadata()                             */
+/************************************************************************/
+
+CPLErr GDALDriver::SetMetadata(char **papszMetadata, const char *pszDomain)
+
+{
+    const CPLErr eErr = GDALMajorObject::SetMetadata(papszMetadata, pszDomain);
+    if (pszDomain == nullptr || pszDomain[0] == '\0')
+    {
+        for (const char *pszName :
+             {GDAL_DCAP_OPEN, GDAL_DCAP_RASTER, GDAL_DCAP_VECTOR,
+              GDAL_DCAP_MULTIDIM_RASTER, GDAL_DMD_OPEN_SIGNATURES})
+        {
+            UpdateOpenProbeInfo(pszName,
+                                GDALMajorObject::GetMetadataItem(pszName));
+        }
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                        UpdateOpenProbeInfo()                         */
+/************************************************************************/
+
+void GDALDriver::UpdateOpenProbeInfo(const char *pszName, const char *pszValue)
+{
+    if (EQUAL(pszName, GDAL_DCAP_OPEN))
+        m_bHasOpenCap = pszValue != nullptr;
+    else if (EQUAL(pszName, GDAL_DCAP_RASTER))
+        m_bHasRasterCap = pszValue != nullptr;
+    else if (EQUAL(pszName, GDAL_DCAP_VECTOR))
+        m_bHasVectorCap = pszValue != nullptr;
+    else if (EQUAL(pszName, GDAL_DCAP_MULTIDIM_RASTER))
+        m_bHasMultiDimRasterCap = pszValue != nullptr;
+    else if (EQUAL(pszName, GDAL_DMD_OPEN_SIGNATURES))
+    {
+        m_aosOpenSignatures.clear();
+        if (pszValue == nullptr)
+            return;
+        const CPLStringList aosTokens(CSLTokenizeString(pszValue));
+        for (const char *pszToken : aosTokens)
+        {
+            const size_t nLen = strlen(pszToken);
+            bool bValid = (nLen % 2) == 0;
+            for (size_t i = 0; bValid && i < nLen; ++i)
+                bValid = isxdigit(static_cast<unsigned char>(pszToken[i])) != 0;
+            if (!bValid)
+            {
+                // Better probe the driver for all files than wrongly skip it
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Invalid signature '%s' in %s of driver %s. "
+                         "Ignoring all its signatures",
+                         pszToken, GDAL_DMD_OPEN_SIGNATURES, GetDescription());
+                m_aosOpenSignatures.clear();
+                return;
+            }
+            int nBytes = 0;
+            GByte *pabyBytes = CPLHexToBinary(pszToken, &nBytes);
+            m_aosOpenSignatures.emplace_back(
+                reinterpret_cast<const char *>(pabyBytes), nBytes);
+            CPLFree(pabyBytes);
+        }
+    }
+}
+
+/************************************************************************/
+/*                            CanOpenKind()                             */
+/************************************************************************/
+
+/** Returns whether the driver has the GDAL_DCAP_OPEN capability, and the
+ * capability of the kind of dataset (raster, vector, multidimensional raster)
+ * requested by the GDAL_OF_xxxx flags, with the same rules as GDALOpenEx().
+ */
+bool GDALDriver::CanOpenKind(int nOpenFlags) const
+{
+    if (!m_bHasOpenCap)
+        return false;
+    if ((nOpenFlags & GDAL_OF_RASTER) != 0 &&
+        (nOpenFlags & GDAL_OF_VECTOR) == 0 && !m_bHasRasterCap)
+        return false;
+    if ((nOpenFlags & GDAL_OF_VECTOR) != 0 &&
+        (nOpenFlags & GDAL_OF_RASTER) == 0 && !m_bHasVectorCap)
+        return false;
+    if ((nOpenFlags & GDAL_OF_MULTIDIM_RASTER) != 0 &&
+        (nOpenFlags & GDAL_OF_RASTER) == 0 && !m_bHasMultiDimRasterCap)
+        return false;
+    return true;
+}
+
+/************************************************************************/
+/*                       MatchesOpenSignatures()                        */
+/************************************************************************/
+
+/** Returns false if the driver declares GDAL_DMD_OPEN_SIGNATURES and that
+ * poOpenInfo is an opened file whose header starts with none of them.
+ */
+bool GDALDriver::MatchesOpenSignatures(const GDALOpenInfo *poOpenInfo) const
+{
+    if (m_aosOpenSignatures.empty() || poOpenInfo->fpL == nullptr)
+        return true;
+    const size_t nHeaderBytes =
+        static_cast<size_t>(std::max(0, poOpenInfo->nHeaderBytes));
+    for (const auto &osSignature : m_aosOpenSignatures)
+    {
+        if (nHeaderBytes >= osSignature.size() &&
+            memcmp(poOpenInfo->pabyHeader, osSignature.data(),
+                   osSignature.size()) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                   DoesDriverHandleExtension()                        */
 /************************************************************************/
@@ -1298,6 +1298,7 @@ static const char *const apszProxyMetadataItems[] = {
     GDAL_DMD_CONNECTION_PREFIX,
     GDAL_DCAP_VECTOR_TRANSLATE_FROM,
     GDAL_DMD_PLUGIN_INSTALLATION_MESSAGE,
+    GDAL_DMD_OPEN_SIGNATURES,
 };
 
 const char *GDALPluginDriverProxy::GetMetadataItem(const char *pszName,
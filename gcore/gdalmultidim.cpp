@@ -30,7 +30,12 @@
 
 #include <assert.h>
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <list>
+#include <map>
+#include <mutex>
+#include <numeric>
 #include <queue>
 #include <set>
 #include <utility>
@@ -41,6 +46,7 @@
 #include "cpl_error_internal.h"
 #include "gdal_priv.h"
 #include "gdal_pam.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "cpl_safemaths.hpp"
 #include "memmultidim.h"
@@ -3648,6 +3654,115 @@ bool GDALAttribute::Write(const double *vals, size_t nVals)
                  static_cast<size_t>(GetTotalElementsCount()) * sizeof(double));
 }
 
+/************************************************************************/
+/*                        GDALMDArrayChunkCache                         */
+/************************************************************************/
+
+namespace
+{
+/** Process-wide LRU cache of decoded chunks of multidimensional arrays.
+ *
+ * Entries are keyed by the identifier of the array that owns them and by
+ * the chunk indices. The total size of the cached chunks is bounded by the
+ * GDAL_MDARRAY_CHUNK_CACHE_SIZE configuration option, which defaults to a
+ * quarter of GDAL_CACHEMAX.
+ */
+class GDALMDArrayChunkCache
+{
+    using Key = std::pair<GUInt64, std::vector<GUInt64>>;
+    using Value = std::shared_ptr<const std::vector<GByte>>;
+    using EntryList = std::list<std::pair<Key, Value>>;
+
+    std::mutex m_oMutex{};
+    EntryList m_oList{};  // most recently used at front
+    std::map<Key, EntryList::iterator> m_oMap{};
+    size_t m_nCurSize = 0;
+    std::atomic<GUInt64> m_nIdCounter{0};
+
+    // Approximate memory used by an entry, including its bookkeeping
+    static size_t EntrySize(const Key &key, const Value &poData)
+    {
+        return poData->size() + 2 * key.second.size() * sizeof(GUInt64) +
+               sizeof(std::pair<Key, Value>) + sizeof(*poData) + 64;
+    }
+
+    void RemoveEntry(EntryList::iterator oIter)
+    {
+        m_nCurSize -= EntrySize(oIter->first, oIter->second);
+        m_oMap.erase(oIter->first);
+        m_oList.erase(oIter);
+    }
+
+  public:
+    static GDALMDArrayChunkCache &Get()
+    {
+        static GDALMDArrayChunkCache oCache;
+        return oCache;
+    }
+
+    // Non-static so that the cache is constructed before, and thus destroyed
+    // after, any array
+    GUInt64 NewId()
+    {
+        return ++m_nIdCounter;
+    }
+
+    static size_t GetMaxSize()
+    {
+        const char *pszSize =
+            CPLGetConfigOption("GDAL_MDARRAY_CHUNK_CACHE_SIZE", nullptr);
+        const GIntBig nSize =
+            pszSize ? CPLAtoGIntBig(pszSize) : GDALGetCacheMax64() / 4;
+        return static_cast<size_t>(std::max<GIntBig>(
+            0,
+            std::min(GIntBig(std::numeric_limits<size_t>::max() / 2), nSize)));
+    }
+
+    Value Find(const Key &key)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const auto oIter = m_oMap.find(key);
+        if (oIter == m_oMap.end())
+            return nullptr;
+        m_oList.splice(m_oList.begin(), m_oList, oIter->second);
+        return oIter->second->second;
+    }
+
+    void Insert(Key &&key, Value &&poData)
+    {
+        const size_t nMaxSize = GetMaxSize();
+        const size_t nEntrySize = EntrySize(key, poData);
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const auto oIter = m_oMap.find(key);
+        if (oIter != m_oMap.end())
+            RemoveEntry(oIter->second);
+        // Evict the least recently used entries. This also takes care of
+        // honouring a cache size that has been reduced.
+        const size_t nTargetSize =
+            nEntrySize > nMaxSize ? nMaxSize : nMaxSize - nEntrySize;
+        while (m_nCurSize > nTargetSize)
+            RemoveEntry(std::prev(m_oList.end()));
+        if (nEntrySize > nMaxSize)
+            return;
+        m_oList.emplace_front(std::move(key), std::move(poData));
+        m_oMap[m_oList.front().first] = m_oList.begin();
+        m_nCurSize += nEntrySize;
+    }
+
+    void Invalidate(GUInt64 nId)
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        auto oIter = m_oMap.lower_bound(Key(nId, std::vector<GUInt64>()));
+        while (oIter != m_oMap.end() && oIter->first.first == nId)
+        {
+            const auto oListIter = oIter->second;
+            ++oIter;
+            RemoveEntry(oListIter);
+        }
+    }
+};
+}  // namespace
+
 /************************************************************************/
 /*                           GDALMDArray()                              */
 /************************************************************************/
@@ -3660,12 +3775,91 @@ GDALMDArray::GDALMDArray(CPL_UNUSED const std::string &osParentName,
 #if !defined(COMPILER_WARNS_ABOUT_ABSTRACT_VBASE_INIT)
       GDALAbstractMDArray(osParentName, osName),
 #endif
-      m_osContext(osContext)
+      m_osContext(osContext),
+      m_nChunkCacheId(GDALMDArrayChunkCache::Get().NewId())
 {
 }
 
 //! @endcond
 
+/************************************************************************/
+/*                           ~GDALMDArray()                             */
+/************************************************************************/
+
+GDALMDArray::~GDALMDArray()
+{
+    InvalidateChunkCache();
+}
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                         GetChunkFromCache()                          */
+/************************************************************************/
+
+/** Return a chunk previously stored with PutChunkInCache().
+ *
+ * The content and layout of the chunk are defined by the driver.
+ * This method may be called concurrently from several threads.
+ *
+ * @param panChunkIdx Chunk indices. Array of GetDimensionCount() values.
+ * @return the chunk, or nullptr if it is not (or no longer) in the cache.
+ * @since GDAL 3.10
+ */
+std::shared_ptr<const std::vector<GByte>>
+GDALMDArray::GetChunkFromCache(const GUInt64 *panChunkIdx) const
+{
+    return GDALMDArrayChunkCache::Get().Find(std::make_pair(
+        m_nChunkCacheId,
+        std::vector<GUInt64>(panChunkIdx, panChunkIdx + GetDimensionCount())));
+}
+
+/************************************************************************/
+/*                          PutChunkInCache()                           */
+/************************************************************************/
+
+/** Store a decoded chunk in the process-wide chunk cache.
+ *
+ * This cache is shared by all arrays that opt into it, and its size is
+ * bounded by the GDAL_MDARRAY_CHUNK_CACHE_SIZE configuration option (in
+ * bytes), which defaults to a quarter of GDAL_CACHEMAX. Setting it to 0
+ * disables the cache. Least recently used chunks are evicted first.
+ *
+ * Drivers that cache chunks must call InvalidateChunkCache() when the array
+ * content is modified.
+ * This method may be called concurrently from several threads.
+ *
+ * @param panChunkIdx Chunk indices. Array of GetDimensionCount() values.
+ * @param poData Chunk content. Must not be null.
+ * @since GDAL 3.10
+ */
+void GDALMDArray::PutChunkInCache(
+    const GUInt64 *panChunkIdx,
+    std::shared_ptr<const std::vector<GByte>> poData) const
+{
+    CPLAssert(poData);
+    GDALMDArrayChunkCache::Get().Insert(
+        std::make_pair(m_nChunkCacheId,
+                       std::vector<GUInt64>(panChunkIdx,
+                                            panChunkIdx + GetDimensionCount())),
+        std::move(poData));
+}
+
+/************************************************************************/
+/*                        InvalidateChunkCache()                        */
+/************************************************************************/
+
+/** Remove all the chunks of this array from the process-wide chunk cache.
+ *
+ * @since GDAL 3.10
+ */
+void GDALMDArray::InvalidateChunkCache() const
+{
+    GDALMDArrayChunkCache::Get().Invalidate(m_nChunkCacheId);
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                           GetTotalCopyCost()                         */
 /************************************************************************/
@@ -3786,6 +3980,12 @@ bool GDALMDArray::CopyFromAllExceptValues(const GDALMDArray *poSrcArray,
  * @param pfnProgress Progress callback, or nullptr.
  * @param pProgressData Progress user data, or nulptr.
  *
+ * The copy is done by chunks that are multiple of the block size of the
+ * destination array, and when possible of the source array. Starting with
+ * GDAL 3.10, if the GDAL_NUM_THREADS configuration option is set to a value
+ * of at least 2 (or ALL_CPUS), a chunk is written in a worker thread while
+ * the next one is read.
+ *
  * @return true in case of success (or partial success if bStrict == false).
  */
 bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
@@ -3841,6 +4041,63 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             GUInt64 nTotalBytesThisArray = 0;
             bool bStop = false;
 
+            // Members used when writing is done in a worker thread, while
+            // the next chunk is read from the calling thread.
+            CPLJobQueue *poJobQueue = nullptr;
+            std::vector<GByte> abyWriteTmp{};
+            std::vector<GUInt64> anWriteStartIdx{};
+            std::vector<size_t> anWriteCount{};
+            bool bWriteRet = true;
+            std::vector<CPLErrorHandlerAccumulatorStruct> aoWriteErrors{};
+
+            static void FreeDynamicMemory(const GDALExtendedDataType &dt,
+                                          GByte *ptr, size_t nDims,
+                                          const size_t *chunkCount)
+            {
+                if (dt.NeedsFreeDynamicMemory())
+                {
+                    const auto l_nDTSize = dt.GetSize();
+                    size_t nEltCount = 1;
+                    for (size_t i = 0; i < nDims; ++i)
+                    {
+                        nEltCount *= chunkCount[i];
+                    }
+                    for (size_t i = 0; i < nEltCount; i++)
+                    {
+                        dt.FreeDynamicMemory(ptr);
+                        ptr += l_nDTSize;
+                    }
+                }
+            }
+
+            static void WriteJob(void *pData)
+            {
+                auto data = static_cast<CopyFunc *>(pData);
+                auto poDstArray = data->poDstArray;
+                const auto &dt(poDstArray->GetDataType());
+                CPLInstallErrorHandlerAccumulator(data->aoWriteErrors);
+                data->bWriteRet = poDstArray->Write(
+                    data->anWriteStartIdx.data(), data->anWriteCount.data(),
+                    nullptr, nullptr, dt, data->abyWriteTmp.data());
+                CPLUninstallErrorHandlerAccumulator();
+                FreeDynamicMemory(dt, data->abyWriteTmp.data(),
+                                  data->anWriteCount.size(),
+                                  data->anWriteCount.data());
+            }
+
+            // Wait for the pending write job (if any) to be finished, and
+            // re-emit its errors in the calling thread.
+            bool WaitPendingWrite()
+            {
+                poJobQueue->WaitCompletion();
+                for (const auto &oError : aoWriteErrors)
+                {
+                    CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+                }
+                aoWriteErrors.clear();
+                return bWriteRet;
+            }
+
             static bool f(GDALAbstractMDArray *l_poSrcArray,
                           const GUInt64 *chunkArrayStartIdx,
                           const size_t *chunkCount, GUInt64 iCurChunk,
@@ -3849,33 +4106,44 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
                 const auto &dt(l_poSrcArray->GetDataType());
                 auto data = static_cast<CopyFunc *>(pUserData);
                 auto poDstArray = data->poDstArray;
+                const size_t l_nDims(l_poSrcArray->GetDimensionCount());
                 if (!l_poSrcArray->Read(chunkArrayStartIdx, chunkCount, nullptr,
                                         nullptr, dt, &data->abyTmp[0]))
                 {
                     return false;
                 }
-                bool bRet =
-                    poDstArray->Write(chunkArrayStartIdx, chunkCount, nullptr,
-                                      nullptr, dt, &data->abyTmp[0]);
-                if (dt.NeedsFreeDynamicMemory())
+                if (data->poJobQueue)
                 {
-                    const auto l_nDTSize = dt.GetSize();
-                    GByte *ptr = &data->abyTmp[0];
-                    const size_t l_nDims(l_poSrcArray->GetDimensionCount());
-                    size_t nEltCount = 1;
-                    for (size_t i = 0; i < l_nDims; ++i)
+                    if (!data->WaitPendingWrite())
                     {
-                        nEltCount *= chunkCount[i];
+                        FreeDynamicMemory(dt, &data->abyTmp[0], l_nDims,
+                                          chunkCount);
+                        return false;
                     }
-                    for (size_t i = 0; i < nEltCount; i++)
+                    std::swap(data->abyTmp, data->abyWriteTmp);
+                    data->anWriteStartIdx.assign(chunkArrayStartIdx,
+                                                 chunkArrayStartIdx + l_nDims);
+                    data->anWriteCount.assign(chunkCount, chunkCount + l_nDims);
+                    if (!data->poJobQueue->SubmitJob(WriteJob, data))
                     {
-                        dt.FreeDynamicMemory(ptr);
-                        ptr += l_nDTSize;
+                        std::swap(data->abyTmp, data->abyWriteTmp);
+                        FreeDynamicMemory(dt, &data->abyTmp[0], l_nDims,
+                                          chunkCount);
+                        return false;
                     }
                 }
-                if (!bRet)
+                else
                 {
-                    return false;
+                    const bool bRet =
+                        poDstArray->Write(chunkArrayStartIdx, chunkCount,
+                                          nullptr, nullptr, dt,
+                                          &data->abyTmp[0]);
+                    FreeDynamicMemory(dt, &data->abyTmp[0], l_nDims,
+                                      chunkCount);
+                    if (!bRet)
+                    {
+                        return false;
+                    }
                 }
 
                 double dfCurCost =
@@ -3899,9 +4167,24 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
         copyFunc.nTotalBytesThisArray = GetTotalElementsCount() * nDTSize;
         copyFunc.pfnProgress = pfnProgress;
         copyFunc.pProgressData = pProgressData;
+
+        // Writing a chunk can be done in a worker thread while the next one
+        // is read, if GDAL_NUM_THREADS is set to a value >= 2.
+        const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        const int nThreads = EQUAL(pszThreads, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(pszThreads);
+        auto poThreadPool =
+            nThreads > 1 && copyFunc.nTotalBytesThisArray != 0
+                ? GDALGetGlobalThreadPool(std::min(nThreads, 128))
+                : nullptr;
+        auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                       : std::unique_ptr<CPLJobQueue>(nullptr);
+        copyFunc.poJobQueue = poJobQueue.get();
+
         const char *pszSwathSize =
             CPLGetConfigOption("GDAL_SWATH_SIZE", nullptr);
-        const size_t nMaxChunkSize =
+        size_t nMaxChunkSize =
             pszSwathSize
                 ? static_cast<size_t>(
                       std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
@@ -3909,15 +4192,72 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
                 : static_cast<size_t>(
                       std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
                                GDALGetCacheMax64() / 4));
-        const auto anChunkSizes(GetProcessingChunkSize(nMaxChunkSize));
+        if (poJobQueue)
+        {
+            // Two chunks are in memory at once
+            nMaxChunkSize = std::max<size_t>(1, nMaxChunkSize / 2);
+        }
+
+        // Chunks are multiple of the destination block size, so that
+        // partially written blocks are avoided.
+        auto anChunkSizes(GetProcessingChunkSize(nMaxChunkSize));
         size_t nRealChunkSize = nDTSize;
         for (const auto &nChunkSize : anChunkSizes)
         {
             nRealChunkSize *= nChunkSize;
         }
+
+        // Try to make them also multiple of the source block size, so that
+        // a source block is not read (and decompressed) several times.
+        const auto anSrcBlockSize = poSrcArray->GetBlockSize();
+        const auto anDstBlockSize = GetBlockSize();
+        if (anSrcBlockSize.size() == dims.size() &&
+            anDstBlockSize.size() == dims.size())
+        {
+            for (size_t i = 0; i < dims.size(); ++i)
+            {
+                const auto nDimSize = dims[i]->GetSize();
+                const auto nSrcBlockSize = anSrcBlockSize[i];
+                const size_t nCurSize = anChunkSizes[i];
+                if (nSrcBlockSize <= 1 || nSrcBlockSize > nDimSize ||
+                    nCurSize == nDimSize || (nCurSize % nSrcBlockSize) == 0)
+                {
+                    continue;
+                }
+                const size_t nOtherSize = nRealChunkSize / nCurSize;
+                const auto nLCM =
+                    std::lcm(static_cast<GUInt64>(nCurSize), nSrcBlockSize);
+                size_t nNewSize = nCurSize;
+                if (nLCM <= nDimSize && nLCM <= nMaxChunkSize / nOtherSize)
+                {
+                    nNewSize = static_cast<size_t>(nLCM);
+                }
+                else if (anDstBlockSize[i] == 0 && nCurSize > nSrcBlockSize)
+                {
+                    // No constraint from the destination: round down
+                    nNewSize = static_cast<size_t>(
+                        (nCurSize / nSrcBlockSize) * nSrcBlockSize);
+                }
+                if (nNewSize != nCurSize)
+                {
+                    CPLDebug("GDAL",
+                             "CopyFrom(%s): using chunk size of " CPL_FRMT_GUIB
+                             " instead of " CPL_FRMT_GUIB
+                             " along dimension %d",
+                             GetName().c_str(), static_cast<GUIntBig>(nNewSize),
+                             static_cast<GUIntBig>(nCurSize),
+                             static_cast<int>(i));
+                    anChunkSizes[i] = nNewSize;
+                    nRealChunkSize = nOtherSize * nNewSize;
+                }
+            }
+        }
+
         try
         {
             copyFunc.abyTmp.resize(nRealChunkSize);
+            if (poJobQueue)
+                copyFunc.abyWriteTmp.resize(nRealChunkSize);
         }
         catch (const std::exception &)
         {
@@ -3926,12 +4266,14 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             nCurCost += copyFunc.nTotalBytesThisArray;
             return false;
         }
-        if (copyFunc.nTotalBytesThisArray != 0 &&
-            !const_cast<GDALMDArray *>(poSrcArray)
-                 ->ProcessPerChunk(arrayStartIdx.data(), count.data(),
-                                   anChunkSizes.data(), CopyFunc::f,
-                                   &copyFunc) &&
-            (bStrict || copyFunc.bStop))
+        bool bRet = copyFunc.nTotalBytesThisArray == 0 ||
+                    const_cast<GDALMDArray *>(poSrcArray)
+                        ->ProcessPerChunk(arrayStartIdx.data(), count.data(),
+                                          anChunkSizes.data(), CopyFunc::f,
+                                          &copyFunc);
+        if (poJobQueue && !copyFunc.WaitPendingWrite())
+            bRet = false;
+        if (!bRet && (bStrict || copyFunc.bStop))
         {
             nCurCost += copyFunc.nTotalBytesThisArray;
             return false;
@@ -4059,6 +4401,245 @@ bool GDALMDArray::IAdviseRead(const GUInt64 *, const size_t *,
 
 //! @endcond
 
+/************************************************************************/
+/*                             ReadPoints()                             */
+/************************************************************************/
+
+/** Read the values of the array at a list of points.
+ *
+ * This is typically used to extract time series at a few locations of a
+ * cube ("pixel drilling"), without reading the whole area covering them.
+ *
+ * Points are grouped by the chunk (see GetBlockSize()) they belong to, and
+ * the points of a chunk are read with a single request, so that each chunk is
+ * read and decoded only once. Requests of consecutive chunks, along the
+ * dimension with the largest number of distinct chunks, that cover the same
+ * points in the other dimensions are merged, so that drivers that decode the
+ * chunks of a request in parallel (e.g. Zarr) can do so.
+ *
+ * This is the same as the C function GDALMDArrayReadPoints().
+ *
+ * @param nPoints Number of points.
+ * @param panIndices Indices of the points, as an array of
+ *                   nPoints * GetDimensionCount() values: the indices of the
+ *                   first point along each dimension, then the ones of the
+ *                   second point, etc.
+ * @param bufferDataType Data type of values in pDstBuffer.
+ * @param pDstBuffer User buffer to store the values read, as an array of
+ *                   nPoints values of type bufferDataType.
+ *
+ * @return true in case of success.
+ *
+ * @since GDAL 3.10
+ */
+bool GDALMDArray::ReadPoints(size_t nPoints, const GUInt64 *panIndices,
+                             const GDALExtendedDataType &bufferDataType,
+                             void *pDstBuffer) const
+{
+    const size_t nDims = GetDimensionCount();
+    const size_t nDTSize = bufferDataType.GetSize();
+    GByte *pabyDst = static_cast<GByte *>(pDstBuffer);
+    if (nDims == 0)
+    {
+        for (size_t iPt = 0; iPt < nPoints; ++iPt)
+        {
+            if (!Read(nullptr, nullptr, nullptr, nullptr, bufferDataType,
+                      pabyDst + iPt * nDTSize))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const auto &dims = GetDimensions();
+    for (size_t iPt = 0; iPt < nPoints; ++iPt)
+    {
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            if (panIndices[iPt * nDims + i] >= dims[i]->GetSize())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Index " CPL_FRMT_GUIB " of point " CPL_FRMT_GUIB
+                         " is out of range for dimension %s",
+                         static_cast<GUIntBig>(panIndices[iPt * nDims + i]),
+                         static_cast<GUIntBig>(iPt),
+                         dims[i]->GetName().c_str());
+                return false;
+            }
+        }
+    }
+
+    // Points are read one by one along dimensions without a chunk size
+    auto anChunkSize = GetBlockSize();
+    for (auto &nChunkSize : anChunkSize)
+    {
+        if (nChunkSize == 0)
+            nChunkSize = 1;
+    }
+
+    // Requests are merged along the dimension with the largest number of
+    // distinct chunks, which is the "time" dimension when drilling.
+    size_t iMergeDim = 0;
+    {
+        size_t nMaxDistinctChunks = 0;
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            std::set<GUInt64> oSetChunks;
+            for (size_t iPt = 0; iPt < nPoints; ++iPt)
+                oSetChunks.insert(panIndices[iPt * nDims + i] / anChunkSize[i]);
+            if (oSetChunks.size() > nMaxDistinctChunks)
+            {
+                nMaxDistinctChunks = oSetChunks.size();
+                iMergeDim = i;
+            }
+        }
+    }
+
+    // Group points by chunk. The chunk index along iMergeDim is put last in
+    // the key, so that chunks that can be merged are consecutive in the map.
+    std::map<std::vector<GUInt64>, std::vector<size_t>> oMapChunkToPoints;
+    {
+        std::vector<GUInt64> anKey(nDims);
+        for (size_t iPt = 0; iPt < nPoints; ++iPt)
+        {
+            for (size_t i = 0, j = 0; i < nDims; ++i)
+            {
+                if (i != iMergeDim)
+                    anKey[j++] = panIndices[iPt * nDims + i] / anChunkSize[i];
+            }
+            anKey[nDims - 1] =
+                panIndices[iPt * nDims + iMergeDim] / anChunkSize[iMergeDim];
+            oMapChunkToPoints[anKey].push_back(iPt);
+        }
+    }
+
+    const size_t nMaxRequestSize = static_cast<size_t>(
+        std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
+                 std::max<GIntBig>(1, GDALGetCacheMax64() / 4)));
+    const bool bNeedsFreeDynamicMemory =
+        bufferDataType.NeedsFreeDynamicMemory();
+
+    std::vector<GUInt64> anReqStart;
+    std::vector<GUInt64> anReqEnd;
+    std::vector<size_t> anReqPoints;
+    const auto ReadRequest = [this, nDims, nDTSize, panIndices, pabyDst,
+                              bNeedsFreeDynamicMemory, &bufferDataType,
+                              &anReqStart, &anReqEnd, &anReqPoints]()
+    {
+        std::vector<size_t> anCount(nDims);
+        std::vector<size_t> anStride(nDims);
+        size_t nElts = 1;
+        for (size_t i = nDims; i > 0;)
+        {
+            --i;
+            anCount[i] = static_cast<size_t>(anReqEnd[i] - anReqStart[i] + 1);
+            anStride[i] = nElts;
+            nElts *= anCount[i];
+        }
+        std::vector<GByte> abyTmp;
+        try
+        {
+            abyTmp.resize(nElts * nDTSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate temporary buffer");
+            return false;
+        }
+        const bool bRet = Read(anReqStart.data(), anCount.data(), nullptr,
+                               nullptr, bufferDataType, abyTmp.data());
+        if (bRet)
+        {
+            for (const size_t iPt : anReqPoints)
+            {
+                size_t nOffset = 0;
+                for (size_t i = 0; i < nDims; ++i)
+                {
+                    nOffset += static_cast<size_t>(panIndices[iPt * nDims + i] -
+                                                   anReqStart[i]) *
+                               anStride[i];
+                }
+                const GByte *pabySrc = abyTmp.data() + nOffset * nDTSize;
+                if (bNeedsFreeDynamicMemory)
+                {
+                    GDALExtendedDataType::CopyValue(pabySrc, bufferDataType,
+                                                    pabyDst + iPt * nDTSize,
+                                                    bufferDataType);
+                }
+                else
+                {
+                    memcpy(pabyDst + iPt * nDTSize, pabySrc, nDTSize);
+                }
+            }
+        }
+        if (bNeedsFreeDynamicMemory)
+        {
+            for (size_t i = 0; i < nElts; ++i)
+                bufferDataType.FreeDynamicMemory(abyTmp.data() + i * nDTSize);
+        }
+        return bRet;
+    };
+
+    const std::vector<GUInt64> *panPrevKey = nullptr;
+    for (const auto &[anKey, anPoints] : oMapChunkToPoints)
+    {
+        // Bounding box of the points of this chunk
+        std::vector<GUInt64> anStart(panIndices + anPoints[0] * nDims,
+                                     panIndices + (anPoints[0] + 1) * nDims);
+        std::vector<GUInt64> anEnd(anStart);
+        for (const size_t iPt : anPoints)
+        {
+            for (size_t i = 0; i < nDims; ++i)
+            {
+                anStart[i] = std::min(anStart[i], panIndices[iPt * nDims + i]);
+                anEnd[i] = std::max(anEnd[i], panIndices[iPt * nDims + i]);
+            }
+        }
+
+        bool bMerge = panPrevKey != nullptr &&
+                      std::equal(anKey.begin(), anKey.end() - 1,
+                                 panPrevKey->begin()) &&
+                      anKey.back() == panPrevKey->back() + 1;
+        if (bMerge)
+        {
+            size_t nElts = nDTSize;
+            for (size_t i = 0; bMerge && i < nDims; ++i)
+            {
+                if (i == iMergeDim)
+                {
+                    nElts *= static_cast<size_t>(anEnd[i] - anReqStart[i] + 1);
+                }
+                else
+                {
+                    bMerge = anStart[i] == anReqStart[i] &&
+                             anEnd[i] == anReqEnd[i];
+                    nElts *= static_cast<size_t>(anEnd[i] - anStart[i] + 1);
+                }
+            }
+            bMerge = bMerge && nElts <= nMaxRequestSize;
+        }
+
+        if (bMerge)
+        {
+            anReqEnd[iMergeDim] = anEnd[iMergeDim];
+            anReqPoints.insert(anReqPoints.end(), anPoints.begin(),
+                               anPoints.end());
+        }
+        else
+        {
+            if (panPrevKey && !ReadRequest())
+                return false;
+            anReqStart = std::move(anStart);
+            anReqEnd = std::move(anEnd);
+            anReqPoints = anPoints;
+        }
+        panPrevKey = &anKey;
+    }
+    return panPrevKey == nullptr || ReadRequest();
+}
+
 /************************************************************************/
 /*                            MassageName()                             */
 /************************************************************************/
@@ -9541,6 +10122,11 @@ CPLErr GDALMDArray::GetStatistics(bool bApproxOK, bool bForce, double *pdfMin,
  *                     computed min/max, only if done on the full array, in non
  *                     approximate mode, and the dataset is opened in update
  *                     mode.
+ *                     Starting with GDAL 3.10, the generic NUM_THREADS=integer
+ *                     or ALL_CPUS option (defaults to the value of the
+ *                     GDAL_NUM_THREADS configuration option, or 1) can be
+ *                     used to compute statistics of chunks in worker threads.
+ *                     Chunks are still read from the calling thread.
  *
  * @return true on success
  *
@@ -9554,20 +10140,84 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
                                     void *pProgressData,
                                     CSLConstList papszOptions)
 {
-    struct StatsPerChunkType
+    // Welford accumulator. Partial results are combined with the formulas
+    // of Chan et al.
+    struct StatsAccumulator
     {
-        const GDALMDArray *array = nullptr;
-        std::shared_ptr<GDALMDArray> poMask{};
         double dfMin = std::numeric_limits<double>::max();
         double dfMax = -std::numeric_limits<double>::max();
         double dfMean = 0.0;
         double dfM2 = 0.0;
         GUInt64 nValidCount = 0;
+
+        void Insert(const GByte *pabyMask, const double *padfValues,
+                    size_t nVals)
+        {
+            for (size_t i = 0; i < nVals; i++)
+            {
+                if (pabyMask[i])
+                {
+                    const double dfValue = padfValues[i];
+                    dfMin = std::min(dfMin, dfValue);
+                    dfMax = std::max(dfMax, dfValue);
+                    nValidCount++;
+                    const double dfDelta = dfValue - dfMean;
+                    dfMean += dfDelta / nValidCount;
+                    dfM2 += dfDelta * (dfValue - dfMean);
+                }
+            }
+        }
+
+        void Merge(const StatsAccumulator &oOther)
+        {
+            if (oOther.nValidCount == 0)
+                return;
+            const GUInt64 nNewValidCount = nValidCount + oOther.nValidCount;
+            const double dfDelta = oOther.dfMean - dfMean;
+            const double dfOtherRatio =
+                static_cast<double>(oOther.nValidCount) / nNewValidCount;
+            dfMean += dfDelta * dfOtherRatio;
+            dfM2 += oOther.dfM2 + dfDelta * dfDelta *
+                                      static_cast<double>(nValidCount) *
+                                      dfOtherRatio;
+            nValidCount = nNewValidCount;
+            dfMin = std::min(dfMin, oOther.dfMin);
+            dfMax = std::max(dfMax, oOther.dfMax);
+        }
+    };
+
+    // Chunk whose statistics are computed by a worker thread
+    struct StatsJob
+    {
+        StatsAccumulator oAccum{};
+        std::vector<double> adfData{};
+        std::vector<GByte> abyMaskData{};
+
+        static void Run(void *pData)
+        {
+            StatsJob *psJob = static_cast<StatsJob *>(pData);
+            psJob->oAccum.Insert(psJob->abyMaskData.data(),
+                                 psJob->adfData.data(),
+                                 psJob->adfData.size());
+            // Release memory as soon as possible
+            psJob->adfData = std::vector<double>();
+            psJob->abyMaskData = std::vector<GByte>();
+        }
+    };
+
+    struct StatsPerChunkType
+    {
+        const GDALMDArray *array = nullptr;
+        std::shared_ptr<GDALMDArray> poMask{};
+        StatsAccumulator oAccum{};
         std::vector<GByte> abyData{};
         std::vector<double> adfData{};
         std::vector<GByte> abyMaskData{};
         GDALProgressFunc pfnProgress = nullptr;
         void *pProgressData = nullptr;
+        CPLJobQueue *poJobQueue = nullptr;
+        int nThreads = 1;
+        std::vector<std::unique_ptr<StatsJob>> apoJobs{};
     };
 
     const auto PerChunkFunc = [](GDALAbstractMDArray *,
@@ -9583,10 +10233,25 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
         for (size_t i = 0; i < nDims; i++)
             nVals *= chunkCount[i];
 
+        // Chunks are always read from the calling thread, so that drivers
+        // do not need to be thread-safe. Only the computation is dispatched
+        // to worker threads.
+        StatsJob *psJob = nullptr;
+        if (data->poJobQueue)
+        {
+            // Limit the number of chunks held in memory
+            data->poJobQueue->WaitCompletion(2 * data->nThreads);
+            data->apoJobs.emplace_back(std::make_unique<StatsJob>());
+            psJob = data->apoJobs.back().get();
+        }
+        std::vector<GByte> &abyMaskData =
+            psJob ? psJob->abyMaskData : data->abyMaskData;
+        std::vector<double> &adfData = psJob ? psJob->adfData : data->adfData;
+
         // Get mask
-        data->abyMaskData.resize(nVals);
+        abyMaskData.resize(nVals);
         if (!(poMask->Read(chunkArrayStartIdx, chunkCount, nullptr, nullptr,
-                           poMask->GetDataType(), &data->abyMaskData[0])))
+                           poMask->GetDataType(), &abyMaskData[0])))
         {
             return false;
         }
@@ -9595,9 +10260,9 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
         const auto &oType = array->GetDataType();
         if (oType.GetNumericDataType() == GDT_Float64)
         {
-            data->adfData.resize(nVals);
+            adfData.resize(nVals);
             if (!array->Read(chunkArrayStartIdx, chunkCount, nullptr, nullptr,
-                             oType, &data->adfData[0]))
+                             oType, &adfData[0]))
             {
                 return false;
             }
@@ -9610,25 +10275,20 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
             {
                 return false;
             }
-            data->adfData.resize(nVals);
+            adfData.resize(nVals);
             GDALCopyWords64(&data->abyData[0], oType.GetNumericDataType(),
-                            static_cast<int>(oType.GetSize()),
-                            &data->adfData[0], GDT_Float64,
-                            static_cast<int>(sizeof(double)),
+                            static_cast<int>(oType.GetSize()), &adfData[0],
+                            GDT_Float64, static_cast<int>(sizeof(double)),
                             static_cast<GPtrDiff_t>(nVals));
         }
-        for (size_t i = 0; i < nVals; i++)
+        if (psJob)
         {
-            if (data->abyMaskData[i])
-            {
-                const double dfValue = data->adfData[i];
-                data->dfMin = std::min(data->dfMin, dfValue);
-                data->dfMax = std::max(data->dfMax, dfValue);
-                data->nValidCount++;
-                const double dfDelta = dfValue - data->dfMean;
-                data->dfMean += dfDelta / data->nValidCount;
-                data->dfM2 += dfDelta * (dfValue - data->dfMean);
-            }
+            if (!data->poJobQueue->SubmitJob(StatsJob::Run, psJob))
+                return false;
+        }
+        else
+        {
+            data->oAccum.Insert(abyMaskData.data(), adfData.data(), nVals);
         }
         if (data->pfnProgress &&
             !data->pfnProgress(static_cast<double>(iCurChunk + 1) / nChunkCount,
@@ -9653,12 +10313,14 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
     std::vector<GUInt64> arrayStartIdx(nDims);
     std::vector<GUInt64> count(nDims);
     const auto &poDims = GetDimensions();
+    GUInt64 nTotalVals = 1;
     for (size_t i = 0; i < nDims; i++)
     {
         count[i] = poDims[i]->GetSize();
+        nTotalVals *= count[i];
     }
     const char *pszSwathSize = CPLGetConfigOption("GDAL_SWATH_SIZE", nullptr);
-    const size_t nMaxChunkSize =
+    size_t nMaxChunkSize =
         pszSwathSize
             ? static_cast<size_t>(
                   std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
@@ -9666,7 +10328,31 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
             : static_cast<size_t>(
                   std::min(GIntBig(std::numeric_limits<size_t>::max() / 2),
                            GDALGetCacheMax64() / 4));
+
+    const char *pszThreads = CSLFetchNameValueDef(
+        papszOptions, "NUM_THREADS",
+        CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    const int nThreads = std::max(
+        1, std::min(128, EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                       : atoi(pszThreads)));
+    // Skip multi-threading for small arrays
+    constexpr GUInt64 MIN_VALS_FOR_MULTITHREADING = 1024 * 1024;
+    auto poThreadPool =
+        nThreads > 1 && nTotalVals >= MIN_VALS_FOR_MULTITHREADING
+            ? GDALGetGlobalThreadPool(nThreads)
+            : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+
     StatsPerChunkType sData;
+    if (poJobQueue)
+    {
+        sData.poJobQueue = poJobQueue.get();
+        sData.nThreads = nThreads;
+        // Up to 2 * nThreads + 1 chunks are in memory at once
+        nMaxChunkSize = std::max<size_t>(
+            1, nMaxChunkSize / (2 * static_cast<size_t>(nThreads) + 1));
+    }
     sData.array = this;
     sData.poMask = GetMask(nullptr);
     if (sData.poMask == nullptr)
@@ -9675,32 +10361,40 @@ bool GDALMDArray::ComputeStatistics(bool bApproxOK, double *pdfMin,
     }
     sData.pfnProgress = pfnProgress;
     sData.pProgressData = pProgressData;
-    if (!ProcessPerChunk(arrayStartIdx.data(), count.data(),
-                         GetProcessingChunkSize(nMaxChunkSize).data(),
-                         PerChunkFunc, &sData))
-    {
+    const bool bRet = ProcessPerChunk(
+        arrayStartIdx.data(), count.data(),
+        GetProcessingChunkSize(nMaxChunkSize).data(), PerChunkFunc, &sData);
+    if (poJobQueue)
+    {
+        poJobQueue->WaitCompletion();
+        // Merge in chunk order, so that the result does not depend on
+        // the scheduling of jobs
+        for (const auto &poJob : sData.apoJobs)
+            sData.oAccum.Merge(poJob->oAccum);
+    }
+    if (!bRet)
         return false;
-    }
 
+    const auto &oAccum = sData.oAccum;
     if (pdfMin)
-        *pdfMin = sData.dfMin;
+        *pdfMin = oAccum.dfMin;
 
     if (pdfMax)
-        *pdfMax = sData.dfMax;
+        *pdfMax = oAccum.dfMax;
 
     if (pdfMean)
-        *pdfMean = sData.dfMean;
+        *pdfMean = oAccum.dfMean;
 
     const double dfStdDev =
-        sData.nValidCount > 0 ? sqrt(sData.dfM2 / sData.nValidCount) : 0.0;
+        oAccum.nValidCount > 0 ? sqrt(oAccum.dfM2 / oAccum.nValidCount) : 0.0;
     if (pdfStdDev)
         *pdfStdDev = dfStdDev;
 
     if (pnValidCount)
-        *pnValidCount = sData.nValidCount;
+        *pnValidCount = oAccum.nValidCount;
 
-    SetStatistics(bApproxOK, sData.dfMin, sData.dfMax, sData.dfMean, dfStdDev,
-                  sData.nValidCount, papszOptions);
+    SetStatistics(bApproxOK, oAccum.dfMin, oAccum.dfMax, oAccum.dfMean,
+                  dfStdDev, oAccum.nValidCount, papszOptions);
 
     return true;
 }
@@ -11515,6 +12209,34 @@ int GDALMDArrayAdviseReadEx(GDALMDArrayH hArray, const GUInt64 *arrayStartIdx,
     return hArray->m_poImpl->AdviseRead(arrayStartIdx, count, papszOptions);
 }
 
+/************************************************************************/
+/*                        GDALMDArrayReadPoints()                       */
+/************************************************************************/
+
+/** Read the values of the array at a list of points.
+ *
+ * This is the same as the C++ method GDALMDArray::ReadPoints()
+ *
+ * @return TRUE in case of success.
+ *
+ * @since GDAL 3.10
+ */
+int GDALMDArrayReadPoints(GDALMDArrayH hArray, size_t nPoints,
+                          const GUInt64 *panIndices,
+                          GDALExtendedDataTypeH hBufferDataType,
+                          void *pDstBuffer)
+{
+    VALIDATE_POINTER1(hArray, __func__, FALSE);
+    VALIDATE_POINTER1(hBufferDataType, __func__, FALSE);
+    if (nPoints == 0)
+        return TRUE;
+    VALIDATE_POINTER1(panIndices, __func__, FALSE);
+    VALIDATE_POINTER1(pDstBuffer, __func__, FALSE);
+    return hArray->m_poImpl->ReadPoints(nPoints, panIndices,
+                                        *(hBufferDataType->m_poImpl),
+                                        pDstBuffer);
+}
+
 /************************************************************************/
 /*                         GDALMDArrayGetAttribute()                    */
 /************************************************************************/
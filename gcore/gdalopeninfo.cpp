@@ -37,13 +37,16 @@
 #endif
 
 #include <algorithm>
+#include <ctime>
 #include <map>
 #include <mutex>
+#include <string>
 #include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_mem_cache.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
@@ -399,6 +402,74 @@ GDALOpenInfo::~GDALOpenInfo()
     CSLDestroy(papszSiblingFiles);
 }
 
+/************************************************************************/
+/*                       Directory listing cache                        */
+/************************************************************************/
+
+/* Opening many files of the same directory, or files of a directory with
+ * a lot of files, would otherwise list that directory again for each file.
+ * Listings of directories of the local file system are reused as long as the
+ * modification time of the directory does not change. Directories, local or
+ * not, with more than GDAL_READDIR_LIMIT_ON_OPEN files are remembered as
+ * such, and the drivers then directly check the existence of the sidecar
+ * files they need.
+ */
+
+namespace
+{
+struct DirListing
+{
+    int nMaxFiles = 0;
+    bool bTooLarge = false;
+    bool bIsLocal = false;
+    time_t nDirMTime = 0;
+    CPLStringList aosFiles{};
+};
+}  // namespace
+
+static std::mutex sDirListingCacheMutex;
+static lru11::Cache<std::string, DirListing> goDirListingCache(100);
+
+// Relative directories are cached by their absolute path, as the current
+// directory may change. Returns an empty string in case of error.
+static std::string GDALGetDirListingCacheKey(const char *pszDirname)
+{
+    if (!CPLIsFilenameRelative(pszDirname))
+        return pszDirname;
+    std::string osKey;
+    char *pszCurDir = CPLGetCurrentDir();
+    if (pszCurDir)
+        osKey = CPLFormFilename(pszCurDir, pszDirname, nullptr);
+    CPLFree(pszCurDir);
+    return osKey;
+}
+
+/************************************************************************/
+/*                    InvalidateSiblingFilesCache()                     */
+/************************************************************************/
+
+/** Invalidate the process-wide cache of directory listings used by
+ * GetSiblingFiles().
+ *
+ * Listings of directories of the local file system are automatically
+ * refreshed when the directory is modified. For other file systems, only
+ * the fact that a directory has more than GDAL_READDIR_LIMIT_ON_OPEN files
+ * is cached, and this method may be used when it is no longer true.
+ *
+ * @param pszDirname Directory name, or nullptr to invalidate all directories.
+ * @since GDAL 3.10
+ */
+void GDALOpenInfo::InvalidateSiblingFilesCache(const char *pszDirname)
+{
+    const std::string osKey =
+        pszDirname ? GDALGetDirListingCacheKey(pszDirname) : std::string();
+    std::lock_guard<std::mutex> oLock(sDirListingCacheMutex);
+    if (!osKey.empty())
+        goDirListingCache.remove(osKey);
+    else
+        goDirListingCache.clear();
+}
+
 /************************************************************************/
 /*                         GetSiblingFiles()                            */
 /************************************************************************/
@@ -418,16 +489,83 @@ char **GDALOpenInfo::GetSiblingFiles()
         return papszSiblingFiles;
     }
 
-    CPLString osDir = CPLGetDirname(pszFilename);
+    const std::string osDir = CPLGetDirname(pszFilename);
     const int nMaxFiles = atoi(VSIGetPathSpecificOption(
         pszFilename, "GDAL_READDIR_LIMIT_ON_OPEN", "1000"));
-    papszSiblingFiles = VSIReadDirEx(osDir, nMaxFiles);
+    const bool bUseCache = CPLTestBool(VSIGetPathSpecificOption(
+        pszFilename, "GDAL_READDIR_CACHE_ON_OPEN", "YES"));
+    if (!bUseCache)
+    {
+        papszSiblingFiles = VSIReadDirEx(osDir.c_str(), nMaxFiles);
+        if (nMaxFiles > 0 && CSLCount(papszSiblingFiles) > nMaxFiles)
+        {
+            CPLDebug("GDAL", "GDAL_READDIR_LIMIT_ON_OPEN reached on %s",
+                     osDir.c_str());
+            CSLDestroy(papszSiblingFiles);
+            papszSiblingFiles = nullptr;
+        }
+        return papszSiblingFiles;
+    }
+
+    // Only the modification time of directories of local (non network)
+    // native file systems can be trusted to detect that their content has
+    // changed. Listing /vsimem/ or archives is cheap anyway.
+    DirListing oListing;
+    oListing.nMaxFiles = nMaxFiles;
+    oListing.bIsLocal =
+        !STARTS_WITH(osDir.c_str(), "/vsi") && VSIIsLocal(osDir.c_str());
+    if (oListing.bIsLocal)
+    {
+        VSIStatBufL sStat;
+        if (VSIStatL(osDir.c_str(), &sStat) == 0)
+            oListing.nDirMTime = sStat.st_mtime;
+        else
+            oListing.bIsLocal = false;
+    }
+
+    const std::string osKey = GDALGetDirListingCacheKey(osDir.c_str());
+    if (osKey.empty())
+        oListing.bIsLocal = false;
+
+    {
+        std::lock_guard<std::mutex> oLock(sDirListingCacheMutex);
+        DirListing oCached;
+        if (goDirListingCache.tryGet(osKey, oCached) &&
+            oCached.nMaxFiles == nMaxFiles &&
+            (oCached.bIsLocal ? oListing.bIsLocal &&
+                                    oCached.nDirMTime == oListing.nDirMTime
+                              : oCached.bTooLarge))
+        {
+            if (!oCached.bTooLarge)
+                papszSiblingFiles = CSLDuplicate(oCached.aosFiles.List());
+            return papszSiblingFiles;
+        }
+    }
+
+    // A modification of the directory in the same second as the listing would
+    // not change its modification time, so do not cache it in that case.
+    const time_t nListingTime = time(nullptr);
+    papszSiblingFiles = VSIReadDirEx(osDir.c_str(), nMaxFiles);
     if (nMaxFiles > 0 && CSLCount(papszSiblingFiles) > nMaxFiles)
     {
         CPLDebug("GDAL", "GDAL_READDIR_LIMIT_ON_OPEN reached on %s",
                  osDir.c_str());
         CSLDestroy(papszSiblingFiles);
         papszSiblingFiles = nullptr;
+        oListing.bTooLarge = true;
+    }
+    else if (oListing.bIsLocal && papszSiblingFiles != nullptr)
+    {
+        oListing.aosFiles = CSLDuplicate(papszSiblingFiles);
+    }
+
+    if (!osKey.empty() &&
+        (oListing.bTooLarge ||
+         (oListing.bIsLocal && papszSiblingFiles != nullptr &&
+          nListingTime > oListing.nDirMTime)))
+    {
+        std::lock_guard<std::mutex> oLock(sDirListingCacheMutex);
+        goDirListingCache.insert(osKey, oListing);
     }
 
     return papszSiblingFiles;
@@ -31,9 +31,14 @@
 #include "gdal_proxy.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -60,6 +65,12 @@
 class GDALDatasetPool;
 static GDALDatasetPool *singleton = nullptr;
 
+/* Per-thread counterpart of GDALDatasetPool::refCountOfDisableRefCount. */
+/* It must be per-thread since the pool mutex is released while a cached */
+/* dataset is opened, so that other threads may create "toplevel" */
+/* GDALProxyPoolDataset during that time. */
+static thread_local int tlsRefCountOfDisableRefCount = 0;
+
 void GDALNullifyProxyPoolSingleton()
 {
     singleton = nullptr;
@@ -76,6 +87,11 @@ struct _GDALProxyPoolCacheEntry
     /* Ref count of the cached dataset */
     int refCount;
 
+    /* Set while GDALDataset::Open() is in progress for this entry. The pool */
+    /* mutex is not held during that time */
+    bool bOpening;
+    GIntBig nOpeningThreadId;
+
     GDALProxyPoolCacheEntry *prev;
     GDALProxyPoolCacheEntry *next;
 };
@@ -111,8 +127,31 @@ class GDALDatasetPool
      * there is */
     /* a high chance that this reference will not be dropped and the pool remain
      * ghost */
+    /* This one is only used by PreventDestroy() / ForceDestroy(). See */
+    /* tlsRefCountOfDisableRefCount for the per-thread version used around */
+    /* opening and closing of cached datasets */
     int refCountOfDisableRefCount = 0;
 
+    /* Statistics, reported as a debug message when the pool is destroyed */
+    int64_t nHits = 0;
+    int64_t nOpens = 0;
+    int64_t nConcurrentOpens = 0;
+    int64_t nEvictions = 0;
+    double dfOpenTime = 0;
+
+    /* Number of times a given file has been opened, and cumulated time */
+    /* spent in opening it, so that thrashing of the pool can be diagnosed */
+    struct OpenCost
+    {
+        int nOpens = 0;
+        double dfTime = 0;
+    };
+
+    std::map<std::string, OpenCost> oMapOpenCost{};
+    static constexpr size_t MAX_TRACKED_FILES = 10000;
+
+    void ReportStatistics() const;
+
     /* Caution : to be sure that we don't run out of entries, size must be at */
     /* least greater or equal than the maximum number of threads */
     explicit GDALDatasetPool(int maxSize, int64_t nMaxRAMUsage);
@@ -168,6 +207,7 @@ GDALDatasetPool::GDALDatasetPool(int maxSizeIn, int64_t nMaxRAMUsageIn)
 GDALDatasetPool::~GDALDatasetPool()
 {
     bInDestruction = true;
+    ReportStatistics();
     GDALProxyPoolCacheEntry *cur = firstEntry;
     GIntBig responsiblePID = GDALGetResponsiblePIDForCurrentThread();
     while (cur)
@@ -187,6 +227,43 @@ GDALDatasetPool::~GDALDatasetPool()
     GDALSetResponsiblePIDForCurrentThread(responsiblePID);
 }
 
+/************************************************************************/
+/*                          ReportStatistics()                          */
+/************************************************************************/
+
+void GDALDatasetPool::ReportStatistics() const
+{
+    if (nOpens == 0 && nHits == 0)
+        return;
+    CPLDebug("GDAL",
+             "Dataset pool: " CPL_FRMT_GIB " hits, " CPL_FRMT_GIB
+             " opens (" CPL_FRMT_GIB " concurrent with another opening of "
+             "the same dataset), " CPL_FRMT_GIB
+             " evictions, %.3f s spent in opening",
+             static_cast<GIntBig>(nHits), static_cast<GIntBig>(nOpens),
+             static_cast<GIntBig>(nConcurrentOpens),
+             static_cast<GIntBig>(nEvictions), dfOpenTime);
+
+    // Report the files that are the most expensive to repeatedly reopen
+    std::vector<const std::pair<const std::string, OpenCost> *> apoReopened;
+    for (const auto &oIter : oMapOpenCost)
+    {
+        if (oIter.second.nOpens > 1)
+            apoReopened.push_back(&oIter);
+    }
+    std::sort(apoReopened.begin(), apoReopened.end(),
+              [](const auto *a, const auto *b)
+              { return a->second.dfTime > b->second.dfTime; });
+    constexpr size_t MAX_REPORTED = 10;
+    for (size_t i = 0; i < std::min(MAX_REPORTED, apoReopened.size()); ++i)
+    {
+        CPLDebug("GDAL",
+                 "Dataset pool: %s opened %d times, %.3f s spent in opening",
+                 apoReopened[i]->first.c_str(), apoReopened[i]->second.nOpens,
+                 apoReopened[i]->second.dfTime);
+    }
+}
+
 #ifdef DEBUG_PROXY_POOL
 /************************************************************************/
 /*                            ShowContent()                             */
@@ -293,9 +370,10 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
             /* dataset */
             GDALSetResponsiblePIDForCurrentThread(candidate->responsiblePID);
 
-            refCountOfDisableRefCount++;
+            tlsRefCountOfDisableRefCount++;
             GDALClose(candidate->poDS);
-            refCountOfDisableRefCount--;
+            tlsRefCountOfDisableRefCount--;
+            nEvictions++;
 
             candidate->poDS = nullptr;
             GDALSetResponsiblePIDForCurrentThread(responsiblePID);
@@ -348,6 +426,16 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
                 strcmp(cur->pszOwner, pszOwner) == 0))) ||
              (!bShared && cur->refCount == 0)))
         {
+            if (cur->bOpening && cur->nOpeningThreadId != CPLGetPID())
+            {
+                /* Another thread is currently opening that dataset. Rather */
+                /* than waiting for it, which could dead-lock if we hold the */
+                /* mutex recursively, open our own instance */
+                nConcurrentOpens++;
+                cur = next;
+                continue;
+            }
+
             if (cur != firstEntry)
             {
                 /* Move to begin */
@@ -367,6 +455,7 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
             }
 
             cur->refCount++;
+            nHits++;
             return cur;
         }
 
@@ -417,13 +506,54 @@ GDALDatasetPool::_RefDataset(const char *pszFileName, GDALAccess eAccess,
     cur->refCount = 1;
     cur->nRAMUsage = 0;
 
-    refCountOfDisableRefCount++;
+    cur->poDS = nullptr;
+    cur->bOpening = true;
+    cur->nOpeningThreadId = CPLGetPID();
+
+    /* Release the pool mutex while opening the dataset, so that other */
+    /* threads are not blocked by a potentially slow opening (network */
+    /* file systems, huge VRTs...). The entry has a non-zero reference */
+    /* count, so it cannot be evicted or closed meanwhile. If the mutex is */
+    /* held recursively by this thread, it remains held, as before. */
+    CPLReleaseMutex(*GDALGetphDLMutex());
+
+    const auto nStart = std::chrono::steady_clock::now();
+    tlsRefCountOfDisableRefCount++;
     int nFlag = ((eAccess == GA_Update) ? GDAL_OF_UPDATE : GDAL_OF_READONLY) |
                 GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR;
-    CPLConfigOptionSetter oSetter("CPL_ALLOW_VSISTDIN", "NO", true);
-    cur->poDS = GDALDataset::Open(pszFileName, nFlag, nullptr, papszOpenOptions,
-                                  nullptr);
-    refCountOfDisableRefCount--;
+    GDALDataset *poDS = nullptr;
+    {
+        CPLConfigOptionSetter oSetter("CPL_ALLOW_VSISTDIN", "NO", true);
+        poDS = GDALDataset::Open(pszFileName, nFlag, nullptr, papszOpenOptions,
+                                 nullptr);
+    }
+    tlsRefCountOfDisableRefCount--;
+    const double dfElapsed =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - nStart)
+            .count();
+
+    CPLAcquireMutex(*GDALGetphDLMutex(), 1000.0);
+
+    cur->poDS = poDS;
+    cur->bOpening = false;
+
+    nOpens++;
+    dfOpenTime += dfElapsed;
+    {
+        auto oIter = oMapOpenCost.find(osFilenameAndOO);
+        if (oIter != oMapOpenCost.end())
+        {
+            oIter->second.nOpens++;
+            oIter->second.dfTime += dfElapsed;
+        }
+        else if (oMapOpenCost.size() < MAX_TRACKED_FILES)
+        {
+            auto &oCost = oMapOpenCost[osFilenameAndOO];
+            oCost.nOpens = 1;
+            oCost.dfTime = dfElapsed;
+        }
+    }
 
     if (cur->poDS)
     {
@@ -489,9 +619,9 @@ void GDALDatasetPool::_CloseDatasetIfZeroRefCount(const char *pszFileName,
             CPLFree(cur->pszOwner);
             cur->pszOwner = nullptr;
 
-            refCountOfDisableRefCount++;
+            tlsRefCountOfDisableRefCount++;
             GDALClose(poDS);
-            refCountOfDisableRefCount--;
+            tlsRefCountOfDisableRefCount--;
 
             GDALSetResponsiblePIDForCurrentThread(responsiblePID);
             break;
@@ -533,7 +663,8 @@ void GDALDatasetPool::Ref()
 
         singleton = new GDALDatasetPool(l_maxSize, l_nMaxRAMUsage);
     }
-    if (singleton->refCountOfDisableRefCount == 0)
+    if (singleton->refCountOfDisableRefCount == 0 &&
+        tlsRefCountOfDisableRefCount == 0)
         singleton->refCount++;
 }
 
@@ -566,7 +697,8 @@ void GDALDatasetPool::Unref()
         CPLAssert(false);
         return;
     }
-    if (singleton->refCountOfDisableRefCount == 0)
+    if (singleton->refCountOfDisableRefCount == 0 &&
+        tlsRefCountOfDisableRefCount == 0)
     {
         singleton->refCount--;
         if (singleton->refCount == 0)
@@ -43,16 +43,22 @@
 #include <memory>
 #include <new>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_rat.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
+#include "gdalrasterband_avx2.h"
 
 /************************************************************************/
 /*                           GDALRasterBand()                           */
@@ -161,6 +167,12 @@ GDALRasterBand::~GDALRasterBand()
  * of downscaling factor 2, 4 and 8, and the desired downscaling factor is
  * 7.99, the overview of factor 4 will be selected for a non nearest resampling.
  *
+ * Starting with GDAL 3.10, when a non nearest resampling is done from the
+ * full resolution band or an overview, the GDAL_NUM_THREADS configuration
+ * option can be set to an integer or ALL_CPUS to resample in parallel strips
+ * of the output buffer. Data is still read from the band in the calling
+ * thread.
+ *
  * For highest performance full resolution data access, read and write
  * on "block boundaries" as returned by GetBlockSize(), or use the
  * ReadBlock() and WriteBlock() methods.
@@ -330,6 +342,19 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     GDALRasterIOExtraArgSetResampleAlg(psExtraArg, nXSize, nYSize, nBufXSize,
                                        nBufYSize);
 
+    CPLTraceSpan oTraceSpan("raster", eRWFlag == GF_Read ? "RasterIO read"
+                                                         : "RasterIO write");
+    if (oTraceSpan.IsEnabled())
+    {
+        oTraceSpan.AddArg("band", nBand);
+        oTraceSpan.AddArg("xoff", nXOff);
+        oTraceSpan.AddArg("yoff", nYOff);
+        oTraceSpan.AddArg("xsize", nXSize);
+        oTraceSpan.AddArg("ysize", nYSize);
+        oTraceSpan.AddArg("buf_xsize", nBufXSize);
+        oTraceSpan.AddArg("buf_ysize", nBufYSize);
+    }
+
     if (nullptr == pData)
     {
         ReportError(CE_Failure, CPLE_AppDefined,
@@ -409,6 +434,9 @@ CPLErr GDALRasterBand::RasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return CE_Failure;
     }
 
+    if (eRWFlag == GF_Write && poDS)
+        poDS->MarkDirtyRegion(nXOff, nYOff, nXSize, nYSize);
+
     /* -------------------------------------------------------------------- */
     /*      Call the format specific function.                              */
     /* -------------------------------------------------------------------- */
@@ -751,6 +779,15 @@ CPLErr GDALRasterBand::WriteBlock(int nXBlockOff, int nYBlockOff, void *pImage)
         return eErr;
     }
 
+    if (poDS && poDS->IsDirtyRegionTrackingEnabled())
+    {
+        const int nXOff = nXBlockOff * nBlockXSize;
+        const int nYOff = nYBlockOff * nBlockYSize;
+        poDS->MarkDirtyRegion(nXOff, nYOff,
+                              std::min(nBlockXSize, nRasterXSize - nXOff),
+                              std::min(nBlockYSize, nRasterYSize - nYOff));
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Invoke underlying implementation method.                        */
     /* -------------------------------------------------------------------- */
@@ -1200,6 +1237,8 @@ CPLErr GDALRasterBand::DropCache()
     if (poBandBlockCache)
         poBandBlockCache->EnableDirtyBlockWriting();
 
+    GDALCompressedBlockCacheDiscardBand(this);
+
     return result;
 }
 
@@ -1493,8 +1532,27 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
             return nullptr;
         }
 
-        if (!bJustInitialize)
+        const bool bFromCompressedCache =
+            !bJustInitialize &&
+            GDALCompressedBlockCacheRetrieve(
+                this, nXBlockOff, nYBlockOff, poBlock->GetDataRef(),
+                static_cast<size_t>(poBlock->GetBlockSize()));
+        if (bFromCompressedCache)
+        {
+            poBlock->AccountCompressedCacheHit();
+        }
+        else if (!bJustInitialize)
         {
+            // Block cache miss
+            CPLTraceSpan oTraceSpan("decode", "IReadBlock");
+            if (oTraceSpan.IsEnabled())
+            {
+                oTraceSpan.AddArg("dataset", poDS ? poDS->GetDescription()
+                                                  : "");
+                oTraceSpan.AddArg("band", nBand);
+                oTraceSpan.AddArg("block_x", nXBlockOff);
+                oTraceSpan.AddArg("block_y", nYBlockOff);
+            }
             const GUInt32 nErrorCounter = CPLGetErrorCounter();
             int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
             eErr = IReadBlock(nXBlockOff, nYBlockOff, poBlock->GetDataRef());
@@ -1595,6 +1653,9 @@ CPLErr GDALRasterBand::Fill(double dfRealValue, double dfImaginaryValue)
     GDALCopyWords64(complexSrc, GDT_CFloat64, 0, srcBlock, eDataType,
                     elementSize, blockSize);
 
+    if (poDS)
+        poDS->MarkDirtyRegion(0, 0, nRasterXSize, nRasterYSize);
+
     const bool bCallLeaveReadWrite = CPL_TO_BOOL(EnterReadWrite(GF_Write));
 
     // Write block to block cache
@@ -3746,6 +3807,10 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
             }
         }
 
+#ifdef HAVE_GDAL_STATISTICS_AVX2
+        const bool bUseAVX2 = CPLHaveRuntimeAVX2();
+#endif
+
         /* --------------------------------------------------------------------
          */
         /*      Read the blocks, and add to histogram. */
@@ -3814,6 +3879,23 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                 continue;  // To next sample block.
             }
 
+#ifdef HAVE_GDAL_STATISTICS_AVX2
+            // The nodata value is ignored for Float32 if it cannot be
+            // represented as a float.
+            if (bUseAVX2 &&
+                GDALComputeBlockHistogram_AVX2(
+                    eDataType, pData, pabyMaskData, nXCheck, nYCheck,
+                    nBlockXSize,
+                    CPL_TO_BOOL(bGotNoDataValue) && eDataType != GDT_Float32,
+                    dfNoDataValue, bGotFloatNoDataValue, fNoDataValue, dfMin,
+                    dfScale, nBuckets, CPL_TO_BOOL(bIncludeOutOfRange),
+                    panHistogram))
+            {
+                poBlock->DropLock();
+                continue;  // To next sample block.
+            }
+#endif
+
             // This isn't the fastest way to do this, but is easier for now.
             for (int iY = 0; iY < nYCheck; iY++)
             {
@@ -5610,6 +5692,535 @@ static inline double GetPixelValue(GDALDataType eDataType, bool bSignedByte,
     return dfValue;
 }
 
+/************************************************************************/
+/*                   GDALGetNumThreadsForStatistics()                   */
+/************************************************************************/
+
+static int GDALGetNumThreadsForStatistics()
+{
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    return std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszThreads)));
+}
+
+/************************************************************************/
+/*                         Statistics accumulators                      */
+/************************************************************************/
+
+namespace
+{
+
+// Accumulator for ComputeStatistics() on GDT_Byte and GDT_UInt16, that only
+// uses integral types for intermediate computations.
+struct GDALIntegralStatsAccumulator
+{
+    GUInt32 nMin = 0;
+    GUInt32 nMax = 0;
+    GUIntBig nSum = 0;
+    GUIntBig nSumSquare = 0;
+    GUIntBig nSampleCount = 0;
+    GUIntBig nValidCount = 0;
+
+    bool IsComplete() const
+    {
+        return false;
+    }
+
+    void Merge(const GDALIntegralStatsAccumulator &oOther)
+    {
+        nMin = std::min(nMin, oOther.nMin);
+        nMax = std::max(nMax, oOther.nMax);
+        nSum += oOther.nSum;
+        nSumSquare += oOther.nSumSquare;
+        nSampleCount += oOther.nSampleCount;
+        nValidCount += oOther.nValidCount;
+    }
+
+    void GetStatistics(double &dfMinOut, double &dfMaxOut, double &dfMeanOut,
+                       double &dfStdDevOut) const
+    {
+        dfMinOut = nMin;
+        dfMaxOut = nMax;
+        dfMeanOut =
+            nValidCount ? static_cast<double>(nSum) / nValidCount : 0.0;
+
+        // To avoid potential precision issues when doing the difference,
+        // we need to do that computation on 128 bit rather than casting
+        // to double
+        const GDALUInt128 nTmpForStdDev(
+            GDALUInt128::Mul(nSumSquare, nValidCount) -
+            GDALUInt128::Mul(nSum, nSum));
+        dfStdDevOut =
+            nValidCount > 0
+                ? sqrt(static_cast<double>(nTmpForStdDev)) / nValidCount
+                : 0.0;
+    }
+};
+
+// Accumulator for ComputeStatistics() using the Welford algorithm:
+// http://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+// to compute standard deviation in a more numerically robust way than
+// the difference of the sum of square values with the square of the sum.
+// dfMean and dfM2 are updated at each sample.
+// dfM2 is the sum of square of differences to the current mean.
+struct GDALWelfordStatsAccumulator
+{
+    double dfMin = std::numeric_limits<double>::max();
+    double dfMax = -std::numeric_limits<double>::max();
+    double dfMean = 0.0;
+    double dfM2 = 0.0;
+    GUIntBig nSampleCount = 0;
+    GUIntBig nValidCount = 0;
+
+    bool IsComplete() const
+    {
+        return false;
+    }
+
+    inline void Insert(double dfValue)
+    {
+        dfMin = std::min(dfMin, dfValue);
+        dfMax = std::max(dfMax, dfValue);
+
+        nValidCount++;
+        const double dfDelta = dfValue - dfMean;
+        dfMean += dfDelta / nValidCount;
+        dfM2 += dfDelta * (dfValue - dfMean);
+    }
+
+    // Combine partial results with the formulas of Chan et al.
+    void Merge(const GDALWelfordStatsAccumulator &oOther)
+    {
+        if (oOther.nValidCount > 0)
+        {
+            const GUIntBig nNewValidCount = nValidCount + oOther.nValidCount;
+            const double dfDelta = oOther.dfMean - dfMean;
+            const double dfOtherRatio =
+                static_cast<double>(oOther.nValidCount) / nNewValidCount;
+            dfMean += dfDelta * dfOtherRatio;
+            dfM2 += oOther.dfM2 + dfDelta * dfDelta *
+                                      static_cast<double>(nValidCount) *
+                                      dfOtherRatio;
+            nValidCount = nNewValidCount;
+            dfMin = std::min(dfMin, oOther.dfMin);
+            dfMax = std::max(dfMax, oOther.dfMax);
+        }
+        nSampleCount += oOther.nSampleCount;
+    }
+
+    void GetStatistics(double &dfMinOut, double &dfMaxOut, double &dfMeanOut,
+                       double &dfStdDevOut) const
+    {
+        dfMinOut = dfMin;
+        dfMaxOut = dfMax;
+        dfMeanOut = dfMean;
+        dfStdDevOut = nValidCount > 0 ? sqrt(dfM2 / nValidCount) : 0.0;
+    }
+};
+
+// Properties of a band needed to accumulate statistics on its blocks, shared
+// by GDALRasterBand::ComputeStatistics() and
+// GDALDataset::ComputeRasterStatistics().
+struct GDALStatsBlockContext
+{
+    GDALDataType eDataType = GDT_Unknown;
+    int nBlockXSize = 0;  // also the line stride of the data buffers
+    int nBlockYSize = 0;
+    bool bSignedByte = false;
+    int bGotNoDataValue = FALSE;
+    double dfNoDataValue = 0.0;
+    bool bGotFloatNoDataValue = false;
+    float fNoDataValue = 0.0f;
+    GDALRasterBand *poMaskBand = nullptr;
+
+    // Only used by AccumulateIntegral()
+    GUInt32 nMaxValueType = 0;
+    GUInt32 nIntNoDataValue = 0;
+
+#ifdef HAVE_GDAL_STATISTICS_AVX2
+    bool bUseAVX2 = false;
+#endif
+
+    void Init(GDALRasterBand *poBand)
+    {
+        eDataType = poBand->GetRasterDataType();
+        poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+
+        dfNoDataValue = poBand->GetNoDataValue(&bGotNoDataValue);
+        bGotNoDataValue = bGotNoDataValue && !CPLIsNan(dfNoDataValue);
+        ComputeFloatNoDataValue(eDataType, dfNoDataValue, bGotNoDataValue,
+                                fNoDataValue, bGotFloatNoDataValue);
+
+        if (!bGotNoDataValue)
+        {
+            const int l_nMaskFlags = poBand->GetMaskFlags();
+            if (l_nMaskFlags != GMF_ALL_VALID && l_nMaskFlags != GMF_NODATA &&
+                poBand->GetColorInterpretation() != GCI_AlphaBand)
+            {
+                poMaskBand = poBand->GetMaskBand();
+            }
+        }
+
+        if (eDataType == GDT_Byte)
+        {
+            poBand->EnablePixelTypeSignedByteWarning(false);
+            const char *pszPixelType =
+                poBand->GetMetadataItem("PIXELTYPE", "IMAGE_STRUCTURE");
+            poBand->EnablePixelTypeSignedByteWarning(true);
+            bSignedByte =
+                pszPixelType != nullptr && EQUAL(pszPixelType, "SIGNEDBYTE");
+        }
+
+        nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
+        // If no valid nodata, map to invalid value (256 for Byte)
+        nIntNoDataValue =
+            (bGotNoDataValue && dfNoDataValue >= 0 &&
+             dfNoDataValue <= nMaxValueType &&
+             fabs(dfNoDataValue -
+                  static_cast<GUInt32>(dfNoDataValue + 1e-10)) < 1e-10)
+                ? static_cast<GUInt32>(dfNoDataValue + 1e-10)
+                : nMaxValueType + 1;
+
+#ifdef HAVE_GDAL_STATISTICS_AVX2
+        bUseAVX2 = CPLHaveRuntimeAVX2();
+#endif
+    }
+
+    inline double GetPixelValue(const void *pData, GPtrDiff_t iOffset,
+                                bool &bValid) const
+    {
+        return ::GetPixelValue(eDataType, bSignedByte, pData, iOffset,
+                               CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
+                               bGotFloatNoDataValue, fNoDataValue, bValid);
+    }
+
+    // Particular case for GDT_Byte that only use integral types for all
+    // intermediate computations. Only possible if the number of pixels
+    // explored is lower than GUINTBIG_MAX / (255*255), so that nSumSquare
+    // can fit on a uint64. Should be 99.99999% of cases.
+    // For GUInt16, this limits to raster of 4 giga pixels
+    bool CanUseIntegralAccumulator(GUIntBig nBlocksToProcess) const
+    {
+        const GUInt64 nBlockPixels = static_cast<GUInt64>(nBlockXSize) *
+                                     static_cast<GUInt64>(nBlockYSize);
+        return (!poMaskBand && eDataType == GDT_Byte && !bSignedByte &&
+                nBlocksToProcess <
+                    GUINTBIG_MAX / (255U * 255U) / nBlockPixels) ||
+               (eDataType == GDT_UInt16 &&
+                nBlocksToProcess <
+                    GUINTBIG_MAX / (65535U * 65535U) / nBlockPixels);
+    }
+
+    void AccumulateIntegral(const void *pData, int nXCheck, int nYCheck,
+                            GDALIntegralStatsAccumulator &oAcc) const
+    {
+        if (eDataType == GDT_Byte)
+        {
+            ComputeStatisticsInternal<GByte,
+                                      /* COMPUTE_OTHER_STATS = */ true>::
+                f(nXCheck, nBlockXSize, nYCheck,
+                  static_cast<const GByte *>(pData),
+                  nIntNoDataValue <= nMaxValueType, nIntNoDataValue, oAcc.nMin,
+                  oAcc.nMax, oAcc.nSum, oAcc.nSumSquare, oAcc.nSampleCount,
+                  oAcc.nValidCount);
+        }
+        else
+        {
+            ComputeStatisticsInternal<GUInt16,
+                                      /* COMPUTE_OTHER_STATS = */ true>::
+                f(nXCheck, nBlockXSize, nYCheck,
+                  static_cast<const GUInt16 *>(pData),
+                  nIntNoDataValue <= nMaxValueType, nIntNoDataValue, oAcc.nMin,
+                  oAcc.nMax, oAcc.nSum, oAcc.nSumSquare, oAcc.nSampleCount,
+                  oAcc.nValidCount);
+        }
+    }
+
+    void AccumulateWelford(const void *pData, const GByte *pabyMaskData,
+                           int nXCheck, int nYCheck,
+                           GDALWelfordStatsAccumulator &oAcc) const
+    {
+#ifdef HAVE_GDAL_STATISTICS_AVX2
+        if (bUseAVX2)
+        {
+            GDALWelfordStatsAccumulator oBlockStats;
+            if (GDALComputeBlockStatistics_AVX2(
+                    eDataType, pData, pabyMaskData, nXCheck, nYCheck,
+                    nBlockXSize, CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
+                    bGotFloatNoDataValue, fNoDataValue,
+                    /* bComputeOtherStats = */ true, oBlockStats.dfMin,
+                    oBlockStats.dfMax, oBlockStats.dfMean, oBlockStats.dfM2,
+                    oBlockStats.nValidCount))
+            {
+                oBlockStats.nSampleCount =
+                    static_cast<GUIntBig>(nXCheck) * nYCheck;
+                oAcc.Merge(oBlockStats);
+                return;
+            }
+        }
+#endif
+
+        // This isn't the fastest way to do this, but is easier for now.
+        for (int iY = 0; iY < nYCheck; iY++)
+        {
+            for (int iX = 0; iX < nXCheck; iX++)
+            {
+                const GPtrDiff_t iOffset =
+                    iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                    continue;
+
+                bool bValid = true;
+                const double dfValue = GetPixelValue(pData, iOffset, bValid);
+                if (!bValid)
+                    continue;
+
+                oAcc.Insert(dfValue);
+            }
+        }
+
+        oAcc.nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+    }
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                      GDALStatisticsIterBlocks()                      */
+/************************************************************************/
+
+// Iterate over the sampled blocks of poBand and call
+// pfnBlockFunc(pData, pabyMaskData, nXCheck, nYCheck, oAccum) on each of them.
+//
+// Blocks (and mask values) are always fetched from the calling thread, so
+// that drivers do not need to be thread-safe. When GDAL_NUM_THREADS is set,
+// the processing of the blocks is dispatched to the global thread pool, per
+// group of BLOCKS_PER_JOB sampled blocks, each group having its own
+// accumulator. Accumulators are then merged in block order, so that the
+// result does not depend on the number of threads.
+template <class Accumulator, class BlockFunc>
+static bool GDALStatisticsIterBlocks(GDALRasterBand *poBand,
+                                     GDALRasterBand *poMaskBand,
+                                     int nTotalBlocks, int nSampleRate,
+                                     int nBlocksPerRow, Accumulator &oAccum,
+                                     const BlockFunc &pfnBlockFunc,
+                                     GDALProgressFunc pfnProgress,
+                                     void *pProgressData)
+{
+    constexpr int BLOCKS_PER_JOB = 16;
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const size_t nBlockPixels = static_cast<size_t>(nBlockXSize) * nBlockYSize;
+
+    const auto ReadMask = [poMaskBand, nBlockXSize, nBlockYSize](
+                              int iXBlock, int iYBlock, int nXCheck,
+                              int nYCheck, GByte *pabyMaskData)
+    {
+        return poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                    iYBlock * nBlockYSize, nXCheck, nYCheck,
+                                    pabyMaskData, nXCheck, nYCheck, GDT_Byte,
+                                    0, nBlockXSize, nullptr) == CE_None;
+    };
+
+    const auto ReportProgress = [pfnProgress, pProgressData,
+                                 nTotalBlocks](int iSampleBlock)
+    {
+        if (pfnProgress &&
+            !pfnProgress(iSampleBlock / static_cast<double>(nTotalBlocks),
+                         "Compute Statistics", pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+        return true;
+    };
+
+    const int nSampledBlocks = DIV_ROUND_UP(nTotalBlocks, nSampleRate);
+    const int nThreads = nSampledBlocks > BLOCKS_PER_JOB
+                             ? GDALGetNumThreadsForStatistics()
+                             : 1;
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+
+    if (!poJobQueue)
+    {
+        std::vector<GByte> abyMaskData;
+        if (poMaskBand)
+        {
+            try
+            {
+                abyMaskData.resize(nBlockPixels);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate mask buffer");
+                return false;
+            }
+        }
+        GByte *const pabyMaskData = poMaskBand ? abyMaskData.data() : nullptr;
+
+        for (int iSampleBlock = 0; iSampleBlock < nTotalBlocks;
+             iSampleBlock += nSampleRate)
+        {
+            const int iYBlock = iSampleBlock / nBlocksPerRow;
+            const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
+
+            GDALRasterBlock *const poBlock =
+                poBand->GetLockedBlockRef(iXBlock, iYBlock);
+            if (poBlock == nullptr)
+                return false;
+
+            int nXCheck = 0, nYCheck = 0;
+            poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+            if (poMaskBand &&
+                !ReadMask(iXBlock, iYBlock, nXCheck, nYCheck, pabyMaskData))
+            {
+                poBlock->DropLock();
+                return false;
+            }
+
+            pfnBlockFunc(poBlock->GetDataRef(), pabyMaskData, nXCheck,
+                         nYCheck, oAccum);
+
+            poBlock->DropLock();
+
+            if (!ReportProgress(iSampleBlock))
+                return false;
+
+            if (oAccum.IsComplete())
+                break;
+        }
+        return true;
+    }
+
+    struct Job
+    {
+        const BlockFunc *pfnBlockFunc = nullptr;
+        Accumulator oAccum;
+        std::vector<GDALRasterBlock *> apoBlocks{};
+        std::vector<std::pair<int, int>> anBlockSizes{};
+        std::vector<std::vector<GByte>> aabyMaskData{};
+
+        CPL_DISALLOW_COPY_ASSIGN(Job)
+
+        Job(const BlockFunc *pfnBlockFuncIn, const Accumulator &oAccumIn)
+            : pfnBlockFunc(pfnBlockFuncIn), oAccum(oAccumIn)
+        {
+        }
+
+        void DropLocks()
+        {
+            for (GDALRasterBlock *poBlock : apoBlocks)
+                poBlock->DropLock();
+            apoBlocks.clear();
+        }
+
+        static void Run(void *pData)
+        {
+            Job *psJob = static_cast<Job *>(pData);
+            for (size_t i = 0; i < psJob->apoBlocks.size(); ++i)
+            {
+                (*psJob->pfnBlockFunc)(psJob->apoBlocks[i]->GetDataRef(),
+                                       psJob->aabyMaskData.empty()
+                                           ? nullptr
+                                           : psJob->aabyMaskData[i].data(),
+                                       psJob->anBlockSizes[i].first,
+                                       psJob->anBlockSizes[i].second,
+                                       psJob->oAccum);
+            }
+            psJob->DropLocks();
+        }
+    };
+
+    const Accumulator oInitAccum(oAccum);
+    std::vector<std::unique_ptr<Job>> apoJobs;
+    std::unique_ptr<Job> poCurJob;
+    bool bRet = true;
+
+    for (int iSampleBlock = 0; iSampleBlock < nTotalBlocks;
+         iSampleBlock += nSampleRate)
+    {
+        const int iYBlock = iSampleBlock / nBlocksPerRow;
+        const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
+
+        if (!poCurJob)
+            poCurJob = std::make_unique<Job>(&pfnBlockFunc, oInitAccum);
+
+        GDALRasterBlock *const poBlock =
+            poBand->GetLockedBlockRef(iXBlock, iYBlock);
+        if (poBlock == nullptr)
+        {
+            bRet = false;
+            break;
+        }
+        poCurJob->apoBlocks.push_back(poBlock);
+
+        int nXCheck = 0, nYCheck = 0;
+        poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+        poCurJob->anBlockSizes.emplace_back(nXCheck, nYCheck);
+
+        if (poMaskBand)
+        {
+            try
+            {
+                poCurJob->aabyMaskData.emplace_back(nBlockPixels);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Cannot allocate mask buffer");
+                bRet = false;
+                break;
+            }
+            if (!ReadMask(iXBlock, iYBlock, nXCheck, nYCheck,
+                          poCurJob->aabyMaskData.back().data()))
+            {
+                bRet = false;
+                break;
+            }
+        }
+
+        if (static_cast<int>(poCurJob->apoBlocks.size()) == BLOCKS_PER_JOB ||
+            iSampleBlock + nSampleRate >= nTotalBlocks)
+        {
+            // Avoid keeping too many blocks locked at once
+            poJobQueue->WaitCompletion(2 * nThreads);
+
+            apoJobs.emplace_back(std::move(poCurJob));
+            if (!poJobQueue->SubmitJob(Job::Run, apoJobs.back().get()))
+            {
+                apoJobs.back()->DropLocks();
+                bRet = false;
+                break;
+            }
+        }
+
+        if (!ReportProgress(iSampleBlock))
+        {
+            bRet = false;
+            break;
+        }
+    }
+
+    if (poCurJob)
+        poCurJob->DropLocks();
+    poJobQueue->WaitCompletion();
+
+    if (bRet)
+    {
+        for (const auto &poJob : apoJobs)
+            oAccum.Merge(poJob->oAccum);
+    }
+    return bRet;
+}
+
 /************************************************************************/
 /*                         SetValidPercent()                            */
 /************************************************************************/
@@ -5677,6 +6288,13 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Starting with GDAL 3.10, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or a integer value to specify the number of threads to
+ * use for the computation. Blocks are still read from the calling thread.
+ * The result does not depend on the number of threads, but may differ in the
+ * last decimals for the mean and standard deviation from the single-threaded
+ * result.
+ *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
@@ -5753,52 +6371,14 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
     /* -------------------------------------------------------------------- */
     /*      Read actual data and compute statistics.                        */
     /* -------------------------------------------------------------------- */
-    // Using Welford algorithm:
-    // http://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
-    // to compute standard deviation in a more numerically robust way than
-    // the difference of the sum of square values with the square of the sum.
-    // dfMean and dfM2 are updated at each sample.
-    // dfM2 is the sum of square of differences to the current mean.
-    double dfMin = std::numeric_limits<double>::max();
-    double dfMax = -std::numeric_limits<double>::max();
-    double dfMean = 0.0;
-    double dfM2 = 0.0;
+    GDALWelfordStatsAccumulator oStats;
 
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
 
-    int bGotNoDataValue = FALSE;
-    const double dfNoDataValue = GetNoDataValue(&bGotNoDataValue);
-    bGotNoDataValue = bGotNoDataValue && !CPLIsNan(dfNoDataValue);
-    bool bGotFloatNoDataValue = false;
-    float fNoDataValue = 0.0f;
-    ComputeFloatNoDataValue(eDataType, dfNoDataValue, bGotNoDataValue,
-                            fNoDataValue, bGotFloatNoDataValue);
-
-    GDALRasterBand *poMaskBand = nullptr;
-    if (!bGotNoDataValue)
-    {
-        const int l_nMaskFlags = GetMaskFlags();
-        if (l_nMaskFlags != GMF_ALL_VALID && l_nMaskFlags != GMF_NODATA &&
-            GetColorInterpretation() != GCI_AlphaBand)
-        {
-            poMaskBand = GetMaskBand();
-        }
-    }
-
-    bool bSignedByte = false;
-    if (eDataType == GDT_Byte)
-    {
-        EnablePixelTypeSignedByteWarning(false);
-        const char *pszPixelType =
-            GetMetadataItem("PIXELTYPE", "IMAGE_STRUCTURE");
-        EnablePixelTypeSignedByteWarning(true);
-        bSignedByte =
-            pszPixelType != nullptr && EQUAL(pszPixelType, "SIGNEDBYTE");
-    }
-
-    GUIntBig nSampleCount = 0;
-    GUIntBig nValidCount = 0;
+    GDALStatsBlockContext oCtxt;
+    oCtxt.Init(this);
+    GDALRasterBand *const poMaskBand = oCtxt.poMaskBand;
 
     if (bApproxOK && HasArbitraryOverviews())
     {
@@ -5868,24 +6448,15 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     continue;
 
                 bool bValid = true;
-                double dfValue =
-                    GetPixelValue(eDataType, bSignedByte, pData, iOffset,
-                                  CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
-                                  bGotFloatNoDataValue, fNoDataValue, bValid);
+                double dfValue = oCtxt.GetPixelValue(pData, iOffset, bValid);
                 if (!bValid)
                     continue;
 
-                dfMin = std::min(dfMin, dfValue);
-                dfMax = std::max(dfMax, dfValue);
-
-                nValidCount++;
-                const double dfDelta = dfValue - dfMean;
-                dfMean += dfDelta / nValidCount;
-                dfM2 += dfDelta * (dfValue - dfMean);
+                oStats.Insert(dfValue);
             }
         }
 
-        nSampleCount = static_cast<GUIntBig>(nXReduced) * nYReduced;
+        oStats.nSampleCount = static_cast<GUIntBig>(nXReduced) * nYReduced;
 
         CPLFree(pData);
         CPLFree(pabyMaskData);
@@ -5917,86 +6488,25 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
         if (nSampleRate == 1)
             bApproxOK = false;
 
-#ifdef CPL_HAS_GINT64
-        // Particular case for GDT_Byte that only use integral types for all
-        // intermediate computations. Only possible if the number of pixels
-        // explored is lower than GUINTBIG_MAX / (255*255), so that nSumSquare
-        // can fit on a uint64. Should be 99.99999% of cases.
-        // For GUInt16, this limits to raster of 4 giga pixels
-        if ((!poMaskBand && eDataType == GDT_Byte && !bSignedByte &&
-             static_cast<GUIntBig>(nBlocksPerRow) * nBlocksPerColumn /
-                     nSampleRate <
-                 GUINTBIG_MAX / (255U * 255U) /
-                     (static_cast<GUInt64>(nBlockXSize) *
-                      static_cast<GUInt64>(nBlockYSize))) ||
-            (eDataType == GDT_UInt16 &&
-             static_cast<GUIntBig>(nBlocksPerRow) * nBlocksPerColumn /
-                     nSampleRate <
-                 GUINTBIG_MAX / (65535U * 65535U) /
-                     (static_cast<GUInt64>(nBlockXSize) *
-                      static_cast<GUInt64>(nBlockYSize))))
-        {
-            const GUInt32 nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
-            GUInt32 nMin = nMaxValueType;
-            GUInt32 nMax = 0;
-            GUIntBig nSum = 0;
-            GUIntBig nSumSquare = 0;
-            // If no valid nodata, map to invalid value (256 for Byte)
-            const GUInt32 nNoDataValue =
-                (bGotNoDataValue && dfNoDataValue >= 0 &&
-                 dfNoDataValue <= nMaxValueType &&
-                 fabs(dfNoDataValue -
-                      static_cast<GUInt32>(dfNoDataValue + 1e-10)) < 1e-10)
-                    ? static_cast<GUInt32>(dfNoDataValue + 1e-10)
-                    : nMaxValueType + 1;
-
-            for (int iSampleBlock = 0;
-                 iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+        if (oCtxt.CanUseIntegralAccumulator(
+                static_cast<GUIntBig>(nBlocksPerRow) * nBlocksPerColumn /
+                nSampleRate))
+        {
+            GDALIntegralStatsAccumulator oIntStats;
+            oIntStats.nMin = oCtxt.nMaxValueType;
+
+            const auto ComputeBlockStats =
+                [&oCtxt](const void *pData, const GByte * /* pabyMaskData */,
+                         int nXCheck, int nYCheck,
+                         GDALIntegralStatsAccumulator &oAcc)
+            { oCtxt.AccumulateIntegral(pData, nXCheck, nYCheck, oAcc); };
+
+            if (!GDALStatisticsIterBlocks(
+                    this, nullptr, nBlocksPerRow * nBlocksPerColumn,
+                    nSampleRate, nBlocksPerRow, oIntStats, ComputeBlockStats,
+                    pfnProgress, pProgressData))
             {
-                const int iYBlock = iSampleBlock / nBlocksPerRow;
-                const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-                GDALRasterBlock *const poBlock =
-                    GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-                if (eDataType == GDT_Byte)
-                {
-                    ComputeStatisticsInternal<
-                        GByte, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-                }
-                else
-                {
-                    ComputeStatisticsInternal<
-                        GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-                }
-
-                poBlock->DropLock();
-
-                if (!pfnProgress(iSampleBlock /
-                                     static_cast<double>(nBlocksPerRow *
-                                                         nBlocksPerColumn),
-                                 "Compute Statistics", pProgressData))
-                {
-                    ReportError(CE_Failure, CPLE_UserInterrupt,
-                                "User terminated");
-                    return CE_Failure;
-                }
+                return CE_Failure;
             }
 
             if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -6005,153 +6515,33 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 return CE_Failure;
             }
 
-            /* --------------------------------------------------------------------
-             */
-            /*      Save computed information. */
-            /* --------------------------------------------------------------------
-             */
-            if (nValidCount)
-                dfMean = static_cast<double>(nSum) / nValidCount;
-
-            // To avoid potential precision issues when doing the difference,
-            // we need to do that computation on 128 bit rather than casting
-            // to double
-            const GDALUInt128 nTmpForStdDev(
-                GDALUInt128::Mul(nSumSquare, nValidCount) -
-                GDALUInt128::Mul(nSum, nSum));
-            const double dfStdDev =
-                nValidCount > 0
-                    ? sqrt(static_cast<double>(nTmpForStdDev)) / nValidCount
-                    : 0.0;
-
-            if (nValidCount > 0)
-            {
-                if (bApproxOK)
-                {
-                    SetMetadataItem("STATISTICS_APPROXIMATE", "YES");
-                }
-                else if (GetMetadataItem("STATISTICS_APPROXIMATE"))
-                {
-                    SetMetadataItem("STATISTICS_APPROXIMATE", nullptr);
-                }
-                SetStatistics(nMin, nMax, dfMean, dfStdDev);
-            }
-
-            SetValidPercent(nSampleCount, nValidCount);
-
-            /* --------------------------------------------------------------------
-             */
-            /*      Record results. */
-            /* --------------------------------------------------------------------
-             */
-            if (pdfMin != nullptr)
-                *pdfMin = nValidCount ? nMin : 0;
-            if (pdfMax != nullptr)
-                *pdfMax = nValidCount ? nMax : 0;
-
-            if (pdfMean != nullptr)
-                *pdfMean = dfMean;
-
-            if (pdfStdDev != nullptr)
-                *pdfStdDev = dfStdDev;
-
-            if (nValidCount > 0)
-                return CE_None;
-
-            ReportError(CE_Failure, CPLE_AppDefined,
-                        "Failed to compute statistics, no valid pixels found "
-                        "in sampling.");
-            return CE_Failure;
+            double dfMin = 0;
+            double dfMax = 0;
+            double dfMean = 0;
+            double dfStdDev = 0;
+            oIntStats.GetStatistics(dfMin, dfMax, dfMean, dfStdDev);
+            return StoreComputedStatistics(
+                CPL_TO_BOOL(bApproxOK), oIntStats.nSampleCount,
+                oIntStats.nValidCount, dfMin, dfMax, dfMean, dfStdDev, pdfMin,
+                pdfMax, pdfMean, pdfStdDev);
         }
-#endif
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
+        const auto ComputeBlockStats =
+            [&oCtxt](const void *pData, const GByte *pabyMaskData, int nXCheck,
+                     int nYCheck, GDALWelfordStatsAccumulator &oAcc)
         {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
-        }
-
-        for (int iSampleBlock = 0;
-             iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+            oCtxt.AccumulateWelford(pData, pabyMaskData, nXCheck, nYCheck,
+                                    oAcc);
+        };
+
+        if (!GDALStatisticsIterBlocks(this, poMaskBand,
+                                      nBlocksPerRow * nBlocksPerColumn,
+                                      nSampleRate, nBlocksPerRow, oStats,
+                                      ComputeBlockStats, pfnProgress,
+                                      pProgressData))
         {
-            const int iYBlock = iSampleBlock / nBlocksPerRow;
-            const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            void *const pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
-            {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
-                return CE_Failure;
-            }
-
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                for (int iX = 0; iX < nXCheck; iX++)
-                {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
-
-                    bool bValid = true;
-                    double dfValue = GetPixelValue(
-                        eDataType, bSignedByte, pData, iOffset,
-                        CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
-                        bGotFloatNoDataValue, fNoDataValue, bValid);
-
-                    if (!bValid)
-                        continue;
-
-                    dfMin = std::min(dfMin, dfValue);
-                    dfMax = std::max(dfMax, dfValue);
-
-                    nValidCount++;
-                    const double dfDelta = dfValue - dfMean;
-                    dfMean += dfDelta / nValidCount;
-                    dfM2 += dfDelta * (dfValue - dfMean);
-                }
-            }
-
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-
-            poBlock->DropLock();
-
-            if (!pfnProgress(
-                    iSampleBlock /
-                        static_cast<double>(nBlocksPerRow * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
-            {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
+            return CE_Failure;
         }
-
-        CPLFree(pabyMaskData);
     }
 
     if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -6160,11 +6550,33 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
         return CE_Failure;
     }
 
+    double dfMin = 0;
+    double dfMax = 0;
+    double dfMean = 0;
+    double dfStdDev = 0;
+    oStats.GetStatistics(dfMin, dfMax, dfMean, dfStdDev);
+    return StoreComputedStatistics(CPL_TO_BOOL(bApproxOK), oStats.nSampleCount,
+                                   oStats.nValidCount, dfMin, dfMax, dfMean,
+                                   dfStdDev, pdfMin, pdfMax, pdfMean,
+                                   pdfStdDev);
+}
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                      StoreComputedStatistics()                       */
+/************************************************************************/
+
+// Save the result of a statistics computation on the band, and record it
+// in the optional output pointers.
+CPLErr GDALRasterBand::StoreComputedStatistics(
+    bool bApproxOK, GUIntBig nSampleCount, GUIntBig nValidCount, double dfMin,
+    double dfMax, double dfMean, double dfStdDev, double *pdfMin,
+    double *pdfMax, double *pdfMean, double *pdfStdDev)
+{
     /* -------------------------------------------------------------------- */
     /*      Save computed information.                                      */
     /* -------------------------------------------------------------------- */
-    const double dfStdDev = nValidCount > 0 ? sqrt(dfM2 / nValidCount) : 0.0;
-
     if (nValidCount > 0)
     {
         if (bApproxOK)
@@ -6208,6 +6620,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
     return CE_Failure;
 }
 
+//! @endcond
+
 /************************************************************************/
 /*                    GDALComputeRasterStatistics()                     */
 /************************************************************************/
@@ -6234,6 +6648,401 @@ CPLErr CPL_STDCALL GDALComputeRasterStatistics(GDALRasterBandH hBand,
                                      pdfStdDev, pfnProgress, pProgressData);
 }
 
+/************************************************************************/
+/*                 GDALComputeStatisticsSinglePass()                    */
+/************************************************************************/
+
+namespace
+{
+struct GDALStatsSinglePassResult
+{
+    GUIntBig nSampleCount = 0;
+    GUIntBig nValidCount = 0;
+    double dfMin = 0;
+    double dfMax = 0;
+    double dfMean = 0;
+    double dfStdDev = 0;
+};
+}  // namespace
+
+// Compute the exact statistics of bands sharing the same data type and block
+// size, by reading each block window once for all of them. The accumulation
+// for each band is done in block order, as in
+// GDALRasterBand::ComputeStatistics(), so results are identical.
+static bool GDALComputeStatisticsSinglePass(
+    GDALDataset *poDS, std::vector<int> &anBands,
+    const std::vector<GDALStatsBlockContext> &aoCtxts,
+    std::vector<GDALStatsSinglePassResult> &aoResults,
+    GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nBandCount = static_cast<int>(anBands.size());
+    const GDALDataType eDT = aoCtxts[0].eDataType;
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const int nBlockXSize = aoCtxts[0].nBlockXSize;
+    const int nBlockYSize = aoCtxts[0].nBlockYSize;
+    const int nXSize = poDS->GetRasterXSize();
+    const int nYSize = poDS->GetRasterYSize();
+    if (nBlockXSize <= 0 || nBlockYSize <= 0)
+        return false;
+    const int nBlocksPerRow = DIV_ROUND_UP(nXSize, nBlockXSize);
+    const int nBlocksPerColumn = DIV_ROUND_UP(nYSize, nBlockYSize);
+    if (static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn > INT_MAX)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too many blocks");
+        return false;
+    }
+    const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
+
+    // Each band of a block gets a 64-byte aligned buffer, as
+    // ComputeStatisticsInternal<GByte> expects for block data.
+    const size_t nBandStride =
+        (static_cast<size_t>(nBlockXSize) * nBlockYSize * nDTSize + 63) / 64 *
+        64;
+    if (nBandStride > std::numeric_limits<size_t>::max() / nBandCount)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Too large block size");
+        return false;
+    }
+    const size_t nBlockStride = nBandStride * nBandCount;
+
+    struct BandStats
+    {
+        const GDALStatsBlockContext *poCtxt = nullptr;
+        bool bIntegral = false;
+        GDALIntegralStatsAccumulator oIntStats{};
+        GDALWelfordStatsAccumulator oStats{};
+    };
+
+    std::vector<BandStats> asBandStats(nBandCount);
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        asBandStats[i].poCtxt = &aoCtxts[i];
+        asBandStats[i].bIntegral =
+            aoCtxts[i].CanUseIntegralAccumulator(nTotalBlocks);
+        asBandStats[i].oIntStats.nMin = aoCtxts[i].nMaxValueType;
+    }
+
+    const int nThreads = std::min(nBandCount, GDALGetNumThreadsForStatistics());
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+
+    // When using threads, read several blocks before dispatching their
+    // processing, to amortize the synchronization.
+    constexpr size_t MAX_BATCH_BYTES = 64 * 1024 * 1024;
+    const int nBlocksPerBatch =
+        poJobQueue ? static_cast<int>(std::max<size_t>(
+                         1, std::min<size_t>(nTotalBlocks,
+                                             MAX_BATCH_BYTES / nBlockStride)))
+                   : 1;
+    if (nBlockStride > std::numeric_limits<size_t>::max() / nBlocksPerBatch)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Too large block size");
+        return false;
+    }
+
+    std::unique_ptr<GByte, decltype(&VSIFreeAligned)> pabyBuffer(
+        static_cast<GByte *>(
+            VSI_MALLOC_ALIGNED_AUTO_VERBOSE(nBlockStride * nBlocksPerBatch)),
+        VSIFreeAligned);
+    if (!pabyBuffer)
+        return false;
+
+    std::vector<std::pair<int, int>> anBlockSizes(nBlocksPerBatch);
+
+    struct Job
+    {
+        BandStats *psBandStats = nullptr;
+        const GByte *pabyData = nullptr;
+        size_t nBlockStride = 0;
+        const std::vector<std::pair<int, int>> *panBlockSizes = nullptr;
+        int nBlocks = 0;
+
+        static void Run(void *pData)
+        {
+            const Job *psJob = static_cast<const Job *>(pData);
+            BandStats &sBandStats = *(psJob->psBandStats);
+            for (int i = 0; i < psJob->nBlocks; ++i)
+            {
+                const GByte *pabyBlock =
+                    psJob->pabyData + i * psJob->nBlockStride;
+                const int nXCheck = (*psJob->panBlockSizes)[i].first;
+                const int nYCheck = (*psJob->panBlockSizes)[i].second;
+                if (sBandStats.bIntegral)
+                {
+                    sBandStats.poCtxt->AccumulateIntegral(
+                        pabyBlock, nXCheck, nYCheck, sBandStats.oIntStats);
+                }
+                else
+                {
+                    sBandStats.poCtxt->AccumulateWelford(
+                        pabyBlock, nullptr, nXCheck, nYCheck,
+                        sBandStats.oStats);
+                }
+            }
+        }
+    };
+
+    std::vector<Job> asJobs(nBandCount);
+
+    for (int iBlock = 0; iBlock < nTotalBlocks; iBlock += nBlocksPerBatch)
+    {
+        const int nBlocks = std::min(nBlocksPerBatch, nTotalBlocks - iBlock);
+        for (int i = 0; i < nBlocks; ++i)
+        {
+            const int iYBlock = (iBlock + i) / nBlocksPerRow;
+            const int iXBlock = (iBlock + i) - iYBlock * nBlocksPerRow;
+            const int nXCheck =
+                std::min(nBlockXSize, nXSize - iXBlock * nBlockXSize);
+            const int nYCheck =
+                std::min(nBlockYSize, nYSize - iYBlock * nBlockYSize);
+            anBlockSizes[i] = std::pair(nXCheck, nYCheck);
+            if (poDS->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                               iYBlock * nBlockYSize, nXCheck, nYCheck,
+                               pabyBuffer.get() + i * nBlockStride, nXCheck,
+                               nYCheck, eDT, nBandCount, anBands.data(),
+                               nDTSize,
+                               static_cast<GSpacing>(nDTSize) * nBlockXSize,
+                               static_cast<GSpacing>(nBandStride),
+                               nullptr) != CE_None)
+            {
+                return false;
+            }
+        }
+
+        for (int iBand = 0; iBand < nBandCount; ++iBand)
+        {
+            Job &sJob = asJobs[iBand];
+            sJob.psBandStats = &asBandStats[iBand];
+            sJob.pabyData = pabyBuffer.get() + iBand * nBandStride;
+            sJob.nBlockStride = nBlockStride;
+            sJob.panBlockSizes = &anBlockSizes;
+            sJob.nBlocks = nBlocks;
+            if (!poJobQueue || !poJobQueue->SubmitJob(Job::Run, &sJob))
+                Job::Run(&sJob);
+        }
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+
+        if (pfnProgress &&
+            !pfnProgress(static_cast<double>(iBlock + nBlocks) / nTotalBlocks,
+                         "Compute Statistics", pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+    }
+
+    aoResults.resize(nBandCount);
+    for (int i = 0; i < nBandCount; ++i)
+    {
+        const BandStats &sBandStats = asBandStats[i];
+        GDALStatsSinglePassResult &sResult = aoResults[i];
+        if (sBandStats.bIntegral)
+        {
+            sBandStats.oIntStats.GetStatistics(sResult.dfMin, sResult.dfMax,
+                                               sResult.dfMean,
+                                               sResult.dfStdDev);
+            sResult.nSampleCount = sBandStats.oIntStats.nSampleCount;
+            sResult.nValidCount = sBandStats.oIntStats.nValidCount;
+        }
+        else
+        {
+            sBandStats.oStats.GetStatistics(sResult.dfMin, sResult.dfMax,
+                                            sResult.dfMean, sResult.dfStdDev);
+            sResult.nSampleCount = sBandStats.oStats.nSampleCount;
+            sResult.nValidCount = sBandStats.oStats.nValidCount;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 GDALDataset::ComputeRasterStatistics()               */
+/************************************************************************/
+
+// Implemented in this file, rather than gdaldataset.cpp, to share the
+// statistics accumulators with GDALRasterBand::ComputeStatistics().
+
+/**
+ * \brief Compute statistics of several bands of the dataset.
+ *
+ * This computes, and sets on each band, the same statistics as
+ * GDALRasterBand::ComputeStatistics() would.
+ *
+ * When exact statistics are requested, bands that do not use a mask band
+ * and share the same data type and block size are processed in a single
+ * pass: each block window is read once for all of them with
+ * GDALDataset::RasterIO(), instead of once per band, which is much faster on
+ * pixel-interleaved datasets with many bands. When the GDAL_NUM_THREADS
+ * configuration option is set, the accumulation for the different bands is
+ * dispatched to worker threads. Blocks are read from the calling thread.
+ *
+ * Other bands, and all bands when bApproxOK is true, are processed with
+ * GDALRasterBand::ComputeStatistics().
+ *
+ * This method is the same as the C function
+ * GDALDatasetComputeRasterStatistics().
+ *
+ * @param nBandCount Number of bands in panBandList, or 0 for all bands.
+ *
+ * @param panBandList List of 1-based band numbers, or NULL for all bands.
+ *
+ * @param bApproxOK If true statistics may be computed based on overviews
+ * or a subset of all tiles.
+ *
+ * @param pfnProgress a function to call to report progress, or NULL.
+ *
+ * @param pProgressData application data to pass to the progress function.
+ *
+ * @return CE_None on success, or CE_Failure if the statistics of at least
+ * one band could not be computed, or processing is terminated by the user.
+ *
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALDataset::ComputeRasterStatistics(int nBandCount,
+                                            const int *panBandList,
+                                            bool bApproxOK,
+                                            GDALProgressFunc pfnProgress,
+                                            void *pProgressData)
+{
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    std::vector<int> anBands;
+    if (nBandCount == 0 || panBandList == nullptr)
+    {
+        for (int i = 1; i <= nBands; ++i)
+            anBands.push_back(i);
+    }
+    else
+    {
+        for (int i = 0; i < nBandCount; ++i)
+        {
+            if (panBandList[i] < 1 || panBandList[i] > nBands)
+            {
+                ReportError(CE_Failure, CPLE_IllegalArg,
+                            "Invalid band number: %d", panBandList[i]);
+                return CE_Failure;
+            }
+            anBands.push_back(panBandList[i]);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Select the bands that can be processed in a single pass.        */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anSinglePassBands;
+    std::vector<GDALStatsBlockContext> aoCtxts;
+    std::vector<int> anOtherBands;
+    for (const int nBand : anBands)
+    {
+        if (!bApproxOK)
+        {
+            GDALStatsBlockContext oCtxt;
+            oCtxt.Init(GetRasterBand(nBand));
+            if (oCtxt.poMaskBand == nullptr &&
+                (aoCtxts.empty() ||
+                 (oCtxt.eDataType == aoCtxts[0].eDataType &&
+                  oCtxt.nBlockXSize == aoCtxts[0].nBlockXSize &&
+                  oCtxt.nBlockYSize == aoCtxts[0].nBlockYSize)))
+            {
+                anSinglePassBands.push_back(nBand);
+                aoCtxts.push_back(oCtxt);
+                continue;
+            }
+        }
+        anOtherBands.push_back(nBand);
+    }
+    if (anSinglePassBands.size() < 2)
+    {
+        anSinglePassBands.clear();
+        aoCtxts.clear();
+        anOtherBands = anBands;
+    }
+
+    const double dfTotalBands = static_cast<double>(anBands.size());
+    CPLErr eErr = CE_None;
+
+    if (!anSinglePassBands.empty())
+    {
+        void *pScaledProgress = GDALCreateScaledProgress(
+            0.0, anSinglePassBands.size() / dfTotalBands, pfnProgress,
+            pProgressData);
+        std::vector<GDALStatsSinglePassResult> aoResults;
+        const bool bOK = GDALComputeStatisticsSinglePass(
+            this, anSinglePassBands, aoCtxts, aoResults,
+            pScaledProgress ? GDALScaledProgress : nullptr, pScaledProgress);
+        GDALDestroyScaledProgress(pScaledProgress);
+        if (!bOK)
+            return CE_Failure;
+
+        for (size_t i = 0; i < anSinglePassBands.size(); ++i)
+        {
+            const auto &sResult = aoResults[i];
+            if (GetRasterBand(anSinglePassBands[i])
+                    ->StoreComputedStatistics(
+                        false, sResult.nSampleCount, sResult.nValidCount,
+                        sResult.dfMin, sResult.dfMax, sResult.dfMean,
+                        sResult.dfStdDev, nullptr, nullptr, nullptr,
+                        nullptr) != CE_None)
+            {
+                eErr = CE_Failure;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < anOtherBands.size(); ++i)
+    {
+        const double dfStart = (anSinglePassBands.size() + i) / dfTotalBands;
+        void *pScaledProgress = GDALCreateScaledProgress(
+            dfStart, dfStart + 1.0 / dfTotalBands, pfnProgress,
+            pProgressData);
+        if (GetRasterBand(anOtherBands[i])
+                ->ComputeStatistics(bApproxOK, nullptr, nullptr, nullptr,
+                                    nullptr, GDALScaledProgress,
+                                    pScaledProgress) != CE_None)
+        {
+            eErr = CE_Failure;
+            if (CPLGetLastErrorNo() == CPLE_UserInterrupt)
+            {
+                GDALDestroyScaledProgress(pScaledProgress);
+                return eErr;
+            }
+        }
+        GDALDestroyScaledProgress(pScaledProgress);
+    }
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                 GDALDatasetComputeRasterStatistics()                 */
+/************************************************************************/
+
+/**
+ * \brief Compute statistics of several bands of the dataset.
+ *
+ * This is the same as the C++ method GDALDataset::ComputeRasterStatistics().
+ *
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALDatasetComputeRasterStatistics(GDALDatasetH hDS, int nBandCount,
+                                          const int *panBandList,
+                                          int bApproxOK,
+                                          GDALProgressFunc pfnProgress,
+                                          void *pProgressData)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetComputeRasterStatistics", CE_Failure);
+
+    return GDALDataset::FromHandle(hDS)->ComputeRasterStatistics(
+        nBandCount, panBandList, CPL_TO_BOOL(bApproxOK), pfnProgress,
+        pProgressData);
+}
+
 /************************************************************************/
 /*                           SetStatistics()                            */
 /************************************************************************/
@@ -6477,67 +7286,54 @@ static void ComputeMinMaxGeneric(const void *pData, GDALDataType eDataType,
     }
 }
 
-static bool ComputeMinMaxGenericIterBlocks(
-    GDALRasterBand *poBand, GDALDataType eDataType, bool bSignedByte,
-    int nTotalBlocks, int nSampleRate, int nBlocksPerRow, bool bGotNoDataValue,
-    double dfNoDataValue, bool bGotFloatNoDataValue, float fNoDataValue,
-    GDALRasterBand *poMaskBand, double &dfMin, double &dfMax)
+namespace
+{
 
+// Accumulator for the generic code path of ComputeRasterMinMax()
+struct GDALMinMaxAccumulator
 {
-    GByte *pabyMaskData = nullptr;
-    int nBlockXSize, nBlockYSize;
-    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    double dfMin = std::numeric_limits<double>::max();
+    double dfMax = -std::numeric_limits<double>::max();
 
-    if (poMaskBand)
+    bool IsComplete() const
     {
-        pabyMaskData =
-            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-        if (!pabyMaskData)
-        {
-            return false;
-        }
+        return false;
     }
 
-    for (int iSampleBlock = 0; iSampleBlock < nTotalBlocks;
-         iSampleBlock += nSampleRate)
+    void Merge(const GDALMinMaxAccumulator &oOther)
     {
-        const int iYBlock = iSampleBlock / nBlocksPerRow;
-        const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(iXBlock, iYBlock);
-        if (poBlock == nullptr)
-        {
-            CPLFree(pabyMaskData);
-            return false;
-        }
-
-        void *const pData = poBlock->GetDataRef();
-
-        int nXCheck = 0, nYCheck = 0;
-        poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+        dfMin = std::min(dfMin, oOther.dfMin);
+        dfMax = std::max(dfMax, oOther.dfMax);
+    }
+};
 
-        if (poMaskBand &&
-            poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                 iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                 pabyMaskData, nXCheck, nYCheck, GDT_Byte, 0,
-                                 nBlockXSize, nullptr) != CE_None)
-        {
-            poBlock->DropLock();
-            CPLFree(pabyMaskData);
-            return false;
-        }
+// Accumulator for the optimized code path of ComputeRasterMinMax(), for
+// GDT_Byte, GDT_UInt16 and GDT_Int16
+struct GDALIntegralMinMaxAccumulator
+{
+    GUInt32 nMin = 0;  // used for GByte & GUInt16 cases
+    GUInt32 nMax = 0;  // used for GByte & GUInt16 cases
+    GInt16 nMinInt16 =
+        std::numeric_limits<GInt16>::max();  // used for GInt16 case
+    GInt16 nMaxInt16 =
+        std::numeric_limits<GInt16>::lowest();  // used for GInt16 case
+    bool bIsByte = false;
 
-        ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXCheck, nYCheck,
-                             nBlockXSize, CPL_TO_BOOL(bGotNoDataValue),
-                             dfNoDataValue, bGotFloatNoDataValue, fNoDataValue,
-                             pabyMaskData, dfMin, dfMax);
+    bool IsComplete() const
+    {
+        return bIsByte && nMin == 0 && nMax == 255;
+    }
 
-        poBlock->DropLock();
+    void Merge(const GDALIntegralMinMaxAccumulator &oOther)
+    {
+        nMin = std::min(nMin, oOther.nMin);
+        nMax = std::max(nMax, oOther.nMax);
+        nMinInt16 = std::min(nMinInt16, oOther.nMinInt16);
+        nMaxInt16 = std::max(nMaxInt16, oOther.nMaxInt16);
     }
+};
 
-    CPLFree(pabyMaskData);
-    return true;
-}
+}  // namespace
 
 /**
  * \brief Compute the min/max values for a band.
@@ -6550,6 +7346,10 @@ static bool ComputeMinMaxGenericIterBlocks(
  * If bApprox is FALSE, then all pixels will be read and used to compute
  * an exact range.
  *
+ * Starting with GDAL 3.10, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or a integer value to specify the number of threads to
+ * use for the computation.
+ *
  * This method is the same as the C function GDALComputeRasterMinMax().
  *
  * @param bApproxOK TRUE if an approximate (faster) answer is OK, otherwise
@@ -6630,27 +7430,23 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
 
-    GUInt32 nMin = (eDataType == GDT_Byte)
-                       ? 255
-                       : 65535;  // used for GByte & GUInt16 cases
-    GUInt32 nMax = 0;            // used for GByte & GUInt16 cases
-    GInt16 nMinInt16 =
-        std::numeric_limits<GInt16>::max();  // used for GInt16 case
-    GInt16 nMaxInt16 =
-        std::numeric_limits<GInt16>::lowest();  // used for GInt16 case
-    double dfMin =
-        std::numeric_limits<double>::max();  // used for generic code path
-    double dfMax =
-        -std::numeric_limits<double>::max();  // used for generic code path
+    GDALIntegralMinMaxAccumulator oIntMinMax;
+    oIntMinMax.nMin = (eDataType == GDT_Byte) ? 255 : 65535;
+    oIntMinMax.bIsByte = eDataType == GDT_Byte && !bSignedByte;
+    GDALMinMaxAccumulator oMinMax;  // used for generic code path
     const bool bUseOptimizedPath =
         !poMaskBand && ((eDataType == GDT_Byte && !bSignedByte) ||
                         eDataType == GDT_Int16 || eDataType == GDT_UInt16);
 
     const auto ComputeMinMaxForBlock =
-        [this, bSignedByte, bGotNoDataValue, dfNoDataValue, &nMin, &nMax,
-         &nMinInt16, &nMaxInt16](const void *pData, int nXCheck,
-                                 int nBufferWidth, int nYCheck)
-    {
+        [this, bSignedByte, bGotNoDataValue,
+         dfNoDataValue](const void *pData, int nXCheck, int nBufferWidth,
+                        int nYCheck, GDALIntegralMinMaxAccumulator &oAcc)
+    {
+        GUInt32 &nMin = oAcc.nMin;
+        GUInt32 &nMax = oAcc.nMax;
+        GInt16 &nMinInt16 = oAcc.nMinInt16;
+        GInt16 &nMaxInt16 = oAcc.nMaxInt16;
         if (eDataType == GDT_Byte && !bSignedByte)
         {
             const bool bHasNoData =
@@ -6769,14 +7565,16 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced);
+            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced,
+                                  oIntMinMax);
         }
         else
         {
-            ComputeMinMaxGeneric(
-                pData, eDataType, bSignedByte, nXReduced, nYReduced, nXReduced,
-                CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
-                bGotFloatNoDataValue, fNoDataValue, pabyMaskData, dfMin, dfMax);
+            ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXReduced,
+                                 nYReduced, nXReduced,
+                                 CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
+                                 bGotFloatNoDataValue, fNoDataValue,
+                                 pabyMaskData, oMinMax.dfMin, oMinMax.dfMax);
         }
 
         CPLFree(pData);
@@ -6808,58 +7606,95 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 nSampleRate += 1;
         }
 
+        const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
         if (bUseOptimizedPath)
         {
-            for (int iSampleBlock = 0;
-                 iSampleBlock < nBlocksPerRow * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            const auto ComputeBlockMinMax =
+                [this, &ComputeMinMaxForBlock](
+                    const void *pData, const GByte * /* pabyMaskData */,
+                    int nXCheck, int nYCheck,
+                    GDALIntegralMinMaxAccumulator &oAcc)
             {
-                const int iYBlock = iSampleBlock / nBlocksPerRow;
-                const int iXBlock = iSampleBlock - nBlocksPerRow * iYBlock;
-
-                GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck);
-
-                poBlock->DropLock();
-
-                if (eDataType == GDT_Byte && !bSignedByte && nMin == 0 &&
-                    nMax == 255)
-                    break;
+                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck,
+                                      oAcc);
+            };
+
+            if (!GDALStatisticsIterBlocks(this, nullptr, nTotalBlocks,
+                                          nSampleRate, nBlocksPerRow,
+                                          oIntMinMax, ComputeBlockMinMax,
+                                          nullptr, nullptr))
+            {
+                return CE_Failure;
             }
         }
         else
         {
-            const int nTotalBlocks = nBlocksPerRow * nBlocksPerColumn;
-            if (!ComputeMinMaxGenericIterBlocks(
-                    this, eDataType, bSignedByte, nTotalBlocks, nSampleRate,
-                    nBlocksPerRow, CPL_TO_BOOL(bGotNoDataValue), dfNoDataValue,
-                    bGotFloatNoDataValue, fNoDataValue, poMaskBand, dfMin,
-                    dfMax))
+#ifdef HAVE_GDAL_STATISTICS_AVX2
+            const bool bUseAVX2 = CPLHaveRuntimeAVX2();
+#endif
+
+            const auto ComputeBlockMinMax =
+                [this, bSignedByte, bGotNoDataValue, dfNoDataValue,
+                 bGotFloatNoDataValue,
+#ifdef HAVE_GDAL_STATISTICS_AVX2
+                 bUseAVX2,
+#endif
+                 fNoDataValue](const void *pData, const GByte *pabyMaskData,
+                               int nXCheck, int nYCheck,
+                               GDALMinMaxAccumulator &oAcc)
+            {
+#ifdef HAVE_GDAL_STATISTICS_AVX2
+                if (bUseAVX2)
+                {
+                    GDALMinMaxAccumulator oBlockMinMax;
+                    double dfMeanUnused = 0;
+                    double dfM2Unused = 0;
+                    GUIntBig nValidCountUnused = 0;
+                    if (GDALComputeBlockStatistics_AVX2(
+                            eDataType, pData, pabyMaskData, nXCheck, nYCheck,
+                            nBlockXSize, CPL_TO_BOOL(bGotNoDataValue),
+                            dfNoDataValue, bGotFloatNoDataValue, fNoDataValue,
+                            /* bComputeOtherStats = */ false,
+                            oBlockMinMax.dfMin, oBlockMinMax.dfMax,
+                            dfMeanUnused, dfM2Unused, nValidCountUnused))
+                    {
+                        oAcc.Merge(oBlockMinMax);
+                        return;
+                    }
+                }
+#endif
+
+                ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXCheck,
+                                     nYCheck, nBlockXSize,
+                                     CPL_TO_BOOL(bGotNoDataValue),
+                                     dfNoDataValue, bGotFloatNoDataValue,
+                                     fNoDataValue, pabyMaskData, oAcc.dfMin,
+                                     oAcc.dfMax);
+            };
+
+            if (!GDALStatisticsIterBlocks(this, poMaskBand, nTotalBlocks,
+                                          nSampleRate, nBlocksPerRow, oMinMax,
+                                          ComputeBlockMinMax, nullptr,
+                                          nullptr))
             {
                 return CE_Failure;
             }
         }
     }
 
+    double dfMin = oMinMax.dfMin;
+    double dfMax = oMinMax.dfMax;
     if (bUseOptimizedPath)
     {
         if ((eDataType == GDT_Byte && !bSignedByte) || eDataType == GDT_UInt16)
         {
-            dfMin = nMin;
-            dfMax = nMax;
+            dfMin = oIntMinMax.nMin;
+            dfMax = oIntMinMax.nMax;
         }
         else if (eDataType == GDT_Int16)
         {
-            dfMin = nMinInt16;
-            dfMax = nMaxInt16;
+            dfMin = oIntMinMax.nMinInt16;
+            dfMax = oIntMinMax.nMaxInt16;
         }
     }
 
@@ -8338,6 +9173,338 @@ int GDALRasterBand::IGetDataCoverageStatus(int /*nXOff*/, int /*nYOff*/,
            GDAL_DATA_COVERAGE_STATUS_DATA;
 }
 
+/************************************************************************/
+/*                            SamplePoints()                            */
+/************************************************************************/
+
+/**
+ * \brief Sample the band values at a set of points.
+ *
+ * Points are expressed in the pixel/line georeferenced space of the band,
+ * that is (0,0) is the top-left corner of the top-left pixel and
+ * (nRasterXSize,nRasterYSize) the bottom-right corner of the bottom-right
+ * pixel.
+ *
+ * With GRIORA_NearestNeighbour, the value returned for a point is the one of
+ * the pixel containing it. With GRIORA_Bilinear and GRIORA_Cubic, the value is
+ * interpolated from the 2x2 or 4x4 pixels whose centers are the closest to the
+ * point (the kernel of cubic interpolation is the one of Keys with a=-0.5).
+ * Pixels beyond the edges of the raster are replaced by the closest edge
+ * pixel. Invalid pixels, i.e. pixels at the nodata value or masked by the mask
+ * band, are excluded from the interpolation, and the weights of the remaining
+ * pixels are renormalized. If the pixel containing the point is itself
+ * invalid, its value is returned without interpolation, as with
+ * GRIORA_NearestNeighbour.
+ *
+ * Points do not need to be sorted: they are processed grouped by the block
+ * that contains them, and the pixels needed by each group are read with a
+ * single RasterIO() request, so that each block is read only once regardless
+ * of the order of the points. This is much more efficient than issuing one
+ * RasterIO() request per point when there are many points.
+ *
+ * Scale and offset are not applied to the returned values.
+ *
+ * This method is the same as the C function GDALRasterBandSamplePoints().
+ *
+ * @param nPointCount Number of points.
+ * @param padfPixel Array of nPointCount pixel (column) coordinates.
+ * @param padfLine Array of nPointCount line (row) coordinates.
+ * @param eResampleAlg GRIORA_NearestNeighbour, GRIORA_Bilinear or
+ * GRIORA_Cubic.
+ * @param padfRealValues Array of nPointCount values, set to the real part of
+ * the value at each point.
+ * @param padfImagValues NULL, or array of nPointCount values, set to the
+ * imaginary part of the value at each point (0 for non-complex data types).
+ * @param pabSuccess NULL, or array of nPointCount values, set to TRUE for the
+ * points that are inside of the raster and FALSE for the other ones (whose
+ * value is set to 0).
+ *
+ * @return CE_None on success or CE_Failure on error.
+ *
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALRasterBand::SamplePoints(size_t nPointCount, const double *padfPixel,
+                                    const double *padfLine,
+                                    GDALRIOResampleAlg eResampleAlg,
+                                    double *padfRealValues,
+                                    double *padfImagValues, int *pabSuccess)
+{
+    int nKernelSize;
+    if (eResampleAlg == GRIORA_NearestNeighbour)
+        nKernelSize = 1;
+    else if (eResampleAlg == GRIORA_Bilinear)
+        nKernelSize = 2;
+    else if (eResampleAlg == GRIORA_Cubic)
+        nKernelSize = 4;
+    else
+    {
+        ReportError(CE_Failure, CPLE_NotSupported,
+                    "SamplePoints(): only nearest, bilinear and cubic "
+                    "resampling methods are supported");
+        return CE_Failure;
+    }
+
+    const bool bIsComplex = CPL_TO_BOOL(GDALDataTypeIsComplex(eDataType));
+    const int nValsPerPixel = bIsComplex ? 2 : 1;
+
+    const int nLocalMaskFlags = GetMaskFlags();
+    bool bHasNoData = false;
+    double dfNoData = 0;
+    GDALRasterBand *poMaskBand = nullptr;
+    if (nLocalMaskFlags & GMF_NODATA)
+    {
+        int bGotNoData = FALSE;
+        dfNoData = GetNoDataValue(&bGotNoData);
+        bHasNoData = bGotNoData != FALSE;
+    }
+    else if (nLocalMaskFlags != GMF_ALL_VALID)
+    {
+        poMaskBand = GetMaskBand();
+    }
+    const bool bNoDataIsNan = bHasNoData && std::isnan(dfNoData);
+
+    // Collect the points inside of the raster, and sort them by the block
+    // of the pixel that contains them.
+    struct SamplePoint
+    {
+        GIntBig nBlockIdx;
+        size_t iPoint;
+        int nX;  // column of the pixel containing the point
+        int nY;  // line of the pixel containing the point
+    };
+
+    std::vector<SamplePoint> asPoints;
+    if (nBlockXSize <= 0 || nBlockYSize <= 0)
+    {
+        ReportError(CE_Failure, CPLE_AppDefined, "Invalid block size");
+        return CE_Failure;
+    }
+    const int nBlocksPerRowLocal = DIV_ROUND_UP(nRasterXSize, nBlockXSize);
+    for (size_t i = 0; i < nPointCount; ++i)
+    {
+        padfRealValues[i] = 0;
+        if (padfImagValues)
+            padfImagValues[i] = 0;
+        if (pabSuccess)
+            pabSuccess[i] = FALSE;
+
+        const double dfX = padfPixel[i];
+        const double dfY = padfLine[i];
+        if (!(dfX >= 0 && dfX < nRasterXSize && dfY >= 0 &&
+              dfY < nRasterYSize))
+        {
+            continue;
+        }
+        SamplePoint sPoint;
+        sPoint.iPoint = i;
+        sPoint.nX = std::min(static_cast<int>(dfX), nRasterXSize - 1);
+        sPoint.nY = std::min(static_cast<int>(dfY), nRasterYSize - 1);
+        sPoint.nBlockIdx =
+            static_cast<GIntBig>(sPoint.nY / nBlockYSize) * nBlocksPerRowLocal +
+            sPoint.nX / nBlockXSize;
+        asPoints.push_back(sPoint);
+    }
+
+    std::sort(asPoints.begin(), asPoints.end(),
+              [](const SamplePoint &a, const SamplePoint &b)
+              {
+                  if (a.nBlockIdx != b.nBlockIdx)
+                      return a.nBlockIdx < b.nBlockIdx;
+                  return a.iPoint < b.iPoint;
+              });
+
+    // Cubic convolution kernel (Keys, a=-0.5)
+    const auto CubicKernel = [](double dfX)
+    {
+        constexpr double A = -0.5;
+        dfX = std::fabs(dfX);
+        if (dfX <= 1)
+            return ((A + 2) * dfX - (A + 3)) * dfX * dfX + 1;
+        if (dfX < 2)
+            return ((A * dfX - 5 * A) * dfX + 8 * A) * dfX - 4 * A;
+        return 0.0;
+    };
+
+    // Return the top-left pixel of the interpolation kernel and its weights
+    // along one dimension.
+    const auto ComputeWeights = [nKernelSize, &CubicKernel](double dfCoord,
+                                                            double *padfW)
+    {
+        const double dfCenter = dfCoord - 0.5;
+        const double dfFloor = std::floor(dfCenter);
+        const double dfFrac = dfCenter - dfFloor;
+        if (nKernelSize == 2)
+        {
+            padfW[0] = 1 - dfFrac;
+            padfW[1] = dfFrac;
+        }
+        else
+        {
+            for (int k = 0; k < 4; ++k)
+                padfW[k] = CubicKernel(dfFrac - (k - 1));
+        }
+        return static_cast<int>(dfFloor) - (nKernelSize / 2 - 1);
+    };
+
+    std::vector<double> adfBuffer;
+    std::vector<GByte> abyMask;
+    for (size_t iStart = 0; iStart < asPoints.size();)
+    {
+        size_t iEnd = iStart + 1;
+        while (iEnd < asPoints.size() &&
+               asPoints[iEnd].nBlockIdx == asPoints[iStart].nBlockIdx)
+        {
+            ++iEnd;
+        }
+
+        // Compute the window needed by the interpolation kernels of the
+        // points of the group.
+        const int nMargin = nKernelSize / 2;
+        int nXMin = INT_MAX;
+        int nXMax = 0;
+        int nYMin = INT_MAX;
+        int nYMax = 0;
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            nXMin = std::min(nXMin, asPoints[i].nX);
+            nXMax = std::max(nXMax, asPoints[i].nX);
+            nYMin = std::min(nYMin, asPoints[i].nY);
+            nYMax = std::max(nYMax, asPoints[i].nY);
+        }
+        nXMin = std::max(0, nXMin - nMargin);
+        nYMin = std::max(0, nYMin - nMargin);
+        nXMax = std::min(nRasterXSize - 1, nXMax + nMargin);
+        nYMax = std::min(nRasterYSize - 1, nYMax + nMargin);
+        const int nWinXSize = nXMax - nXMin + 1;
+        const int nWinYSize = nYMax - nYMin + 1;
+        const size_t nWinPixels = static_cast<size_t>(nWinXSize) * nWinYSize;
+
+        try
+        {
+            adfBuffer.resize(nWinPixels * nValsPerPixel);
+            if (poMaskBand)
+                abyMask.resize(nWinPixels);
+        }
+        catch (const std::exception &)
+        {
+            ReportError(CE_Failure, CPLE_OutOfMemory,
+                        "Out of memory in SamplePoints()");
+            return CE_Failure;
+        }
+
+        if (RasterIO(GF_Read, nXMin, nYMin, nWinXSize, nWinYSize,
+                     adfBuffer.data(), nWinXSize, nWinYSize,
+                     bIsComplex ? GDT_CFloat64 : GDT_Float64, 0, 0,
+                     nullptr) != CE_None ||
+            (poMaskBand &&
+             poMaskBand->RasterIO(GF_Read, nXMin, nYMin, nWinXSize, nWinYSize,
+                                  abyMask.data(), nWinXSize, nWinYSize,
+                                  GDT_Byte, 0, 0, nullptr) != CE_None))
+        {
+            return CE_Failure;
+        }
+
+        const auto IsValid = [&](size_t nOffset)
+        {
+            if (poMaskBand)
+                return abyMask[nOffset] != 0;
+            if (bHasNoData)
+            {
+                const double dfVal = adfBuffer[nOffset * nValsPerPixel];
+                return bNoDataIsNan ? !std::isnan(dfVal) : dfVal != dfNoData;
+            }
+            return true;
+        };
+
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const auto &sPoint = asPoints[i];
+            const size_t iPoint = sPoint.iPoint;
+            if (pabSuccess)
+                pabSuccess[iPoint] = TRUE;
+
+            const size_t nCenterOffset =
+                static_cast<size_t>(sPoint.nY - nYMin) * nWinXSize +
+                (sPoint.nX - nXMin);
+            double dfReal = adfBuffer[nCenterOffset * nValsPerPixel];
+            double dfImag =
+                bIsComplex ? adfBuffer[nCenterOffset * nValsPerPixel + 1] : 0;
+
+            if (nKernelSize > 1 && IsValid(nCenterOffset))
+            {
+                double adfWX[4];
+                double adfWY[4];
+                const int nX0 = ComputeWeights(padfPixel[iPoint], adfWX);
+                const int nY0 = ComputeWeights(padfLine[iPoint], adfWY);
+                double dfSumReal = 0;
+                double dfSumImag = 0;
+                double dfSumWeights = 0;
+                for (int j = 0; j < nKernelSize; ++j)
+                {
+                    const int nY =
+                        std::clamp(nY0 + j, 0, nRasterYSize - 1) - nYMin;
+                    for (int k = 0; k < nKernelSize; ++k)
+                    {
+                        const int nX =
+                            std::clamp(nX0 + k, 0, nRasterXSize - 1) - nXMin;
+                        const size_t nOffset =
+                            static_cast<size_t>(nY) * nWinXSize + nX;
+                        if (!IsValid(nOffset))
+                            continue;
+                        const double dfWeight = adfWX[k] * adfWY[j];
+                        dfSumReal +=
+                            dfWeight * adfBuffer[nOffset * nValsPerPixel];
+                        if (bIsComplex)
+                            dfSumImag += dfWeight *
+                                         adfBuffer[nOffset * nValsPerPixel + 1];
+                        dfSumWeights += dfWeight;
+                    }
+                }
+                if (dfSumWeights > 0)
+                {
+                    dfReal = dfSumReal / dfSumWeights;
+                    dfImag = dfSumImag / dfSumWeights;
+                }
+            }
+
+            padfRealValues[iPoint] = dfReal;
+            if (padfImagValues)
+                padfImagValues[iPoint] = dfImag;
+        }
+
+        iStart = iEnd;
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                      GDALRasterBandSamplePoints()                    */
+/************************************************************************/
+
+/**
+ * \brief Sample the band values at a set of points.
+ *
+ * @see GDALRasterBand::SamplePoints()
+ *
+ * @since GDAL 3.10
+ */
+
+CPLErr GDALRasterBandSamplePoints(GDALRasterBandH hBand, size_t nPointCount,
+                                  const double *padfPixel,
+                                  const double *padfLine,
+                                  GDALRIOResampleAlg eResampleAlg,
+                                  double *padfRealValues,
+                                  double *padfImagValues, int *pabSuccess)
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterBandSamplePoints", CE_Failure);
+
+    return GDALRasterBand::FromHandle(hBand)->SamplePoints(
+        nPointCount, padfPixel, padfLine, eResampleAlg, padfRealValues,
+        padfImagValues, pabSuccess);
+}
+
 //! @cond Doxygen_Suppress
 /************************************************************************/
 /*                          EnterReadWrite()                            */
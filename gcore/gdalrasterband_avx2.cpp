@@ -0,0 +1,531 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of statistics and histogram computations
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+#include "gdalrasterband_avx2.h"
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+
+struct NoDataParams
+{
+    bool bGotNoDataValue;
+    double dfNoDataValue;
+    bool bGotFloatNoDataValue;
+    float fNoDataValue;
+};
+
+/************************************************************************/
+/*                           AreRealEqual()                             */
+/************************************************************************/
+
+// Same as ARE_REAL_EQUAL() of gdal_priv.h
+template <class T> inline bool AreRealEqual(T fVal1, T fVal2)
+{
+    return fVal1 == fVal2 ||
+           std::abs(fVal1 - fVal2) <
+               std::numeric_limits<float>::epsilon() * std::abs(fVal1 + fVal2) *
+                   2;
+}
+
+inline __m256d AreRealEqual(__m256d v, __m256d nd)
+{
+    const __m256d absMask =
+        _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    const __m256d eq = _mm256_cmp_pd(v, nd, _CMP_EQ_OQ);
+    const __m256d absDiff = _mm256_and_pd(_mm256_sub_pd(v, nd), absMask);
+    const __m256d absSum = _mm256_and_pd(_mm256_add_pd(v, nd), absMask);
+    const __m256d threshold = _mm256_mul_pd(
+        _mm256_mul_pd(
+            _mm256_set1_pd(std::numeric_limits<float>::epsilon()), absSum),
+        _mm256_set1_pd(2.0));
+    return _mm256_or_pd(eq, _mm256_cmp_pd(absDiff, threshold, _CMP_LT_OQ));
+}
+
+inline __m128 AreRealEqual(__m128 v, __m128 nd)
+{
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 eq = _mm_cmpeq_ps(v, nd);
+    const __m128 absDiff = _mm_and_ps(_mm_sub_ps(v, nd), absMask);
+    const __m128 absSum = _mm_and_ps(_mm_add_ps(v, nd), absMask);
+    const __m128 threshold = _mm_mul_ps(
+        _mm_mul_ps(_mm_set1_ps(std::numeric_limits<float>::epsilon()), absSum),
+        _mm_set1_ps(2.0f));
+    return _mm_or_ps(eq, _mm_cmplt_ps(absDiff, threshold));
+}
+
+/************************************************************************/
+/*                             LoadValid()                              */
+/************************************************************************/
+
+// Load 4 values as doubles, and compute the mask of valid values (without
+// taking into account the mask band)
+
+inline __m256d ValidNotNoData(__m256d v, __m256d valid,
+                              const NoDataParams &sND)
+{
+    if (sND.bGotNoDataValue)
+    {
+        valid = _mm256_andnot_pd(
+            AreRealEqual(v, _mm256_set1_pd(sND.dfNoDataValue)), valid);
+    }
+    return valid;
+}
+
+inline void LoadValid(const GInt16 *p, const NoDataParams &sND, __m256d &v,
+                      __m256d &valid)
+{
+    v = _mm256_cvtepi32_pd(_mm_cvtepi16_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))));
+    valid = ValidNotNoData(v, _mm256_castsi256_pd(_mm256_set1_epi32(-1)), sND);
+}
+
+inline void LoadValid(const GUInt16 *p, const NoDataParams &sND, __m256d &v,
+                      __m256d &valid)
+{
+    v = _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))));
+    valid = ValidNotNoData(v, _mm256_castsi256_pd(_mm256_set1_epi32(-1)), sND);
+}
+
+inline void LoadValid(const GInt32 *p, const NoDataParams &sND, __m256d &v,
+                      __m256d &valid)
+{
+    v = _mm256_cvtepi32_pd(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+    valid = ValidNotNoData(v, _mm256_castsi256_pd(_mm256_set1_epi32(-1)), sND);
+}
+
+inline void LoadValid(const double *p, const NoDataParams &sND, __m256d &v,
+                      __m256d &valid)
+{
+    v = _mm256_loadu_pd(p);
+    valid = ValidNotNoData(v, _mm256_cmp_pd(v, v, _CMP_ORD_Q), sND);
+}
+
+inline void LoadValid(const float *p, const NoDataParams &sND, __m256d &v,
+                      __m256d &valid)
+{
+    // Nodata comparison must be done on floats
+    const __m128 f = _mm_loadu_ps(p);
+    __m128 validF = _mm_cmpord_ps(f, f);
+    if (sND.bGotFloatNoDataValue)
+    {
+        validF = _mm_andnot_ps(
+            AreRealEqual(f, _mm_set1_ps(sND.fNoDataValue)), validF);
+    }
+    v = _mm256_cvtps_pd(f);
+    valid =
+        _mm256_castsi256_pd(_mm256_cvtepi32_epi64(_mm_castps_si128(validF)));
+}
+
+template <class T>
+inline void LoadValid(const T *p, const GByte *pabyMask,
+                      const NoDataParams &sND, __m256d &v, __m256d &valid)
+{
+    LoadValid(p, sND, v, valid);
+    if (pabyMask)
+    {
+        int nMask4;
+        memcpy(&nMask4, pabyMask, sizeof(nMask4));
+        const __m256i mask64 = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(nMask4));
+        valid = _mm256_andnot_pd(
+            _mm256_castsi256_pd(
+                _mm256_cmpeq_epi64(mask64, _mm256_setzero_si256())),
+            valid);
+    }
+}
+
+/************************************************************************/
+/*                          GetValidValue()                             */
+/************************************************************************/
+
+// Scalar counterpart of LoadValid()
+
+template <class T>
+inline bool GetValidValue(const T *p, const NoDataParams &sND, double &dfValue)
+{
+    dfValue = static_cast<double>(*p);
+    if (std::numeric_limits<T>::is_integer)
+        return !(sND.bGotNoDataValue &&
+                 AreRealEqual(dfValue, sND.dfNoDataValue));
+    return !std::isnan(dfValue) &&
+           !(sND.bGotNoDataValue && AreRealEqual(dfValue, sND.dfNoDataValue));
+}
+
+template <>
+inline bool GetValidValue(const float *p, const NoDataParams &sND,
+                          double &dfValue)
+{
+    const float fValue = *p;
+    dfValue = fValue;
+    return !std::isnan(fValue) &&
+           !(sND.bGotFloatNoDataValue &&
+             AreRealEqual(fValue, sND.fNoDataValue));
+}
+
+/************************************************************************/
+/*                        ComputeBlockStatistics()                      */
+/************************************************************************/
+
+inline double HorizontalSum(__m256d v)
+{
+    const __m128d low = _mm256_castpd256_pd128(v);
+    const __m128d high = _mm256_extractf128_pd(v, 1);
+    const __m128d sum2 = _mm_add_pd(low, high);
+    return _mm_cvtsd_f64(_mm_add_sd(sum2, _mm_unpackhi_pd(sum2, sum2)));
+}
+
+template <class T, bool COMPUTE_OTHER_STATS>
+void ComputeBlockStatisticsT(const T *pData, const GByte *pabyMaskData,
+                            int nXCheck, int nYCheck, int nLineStride,
+                            const NoDataParams &sND, double &dfMinOut,
+                            double &dfMaxOut, double &dfMeanOut,
+                            double &dfM2Out, GUIntBig &nValidCountOut)
+{
+    constexpr double DBL_MAX_ = std::numeric_limits<double>::max();
+    const __m256d vInitMin = _mm256_set1_pd(DBL_MAX_);
+    const __m256d vInitMax = _mm256_set1_pd(-DBL_MAX_);
+
+    // First pass: min, max, count and sum
+    __m256d vMin = vInitMin;
+    __m256d vMax = vInitMax;
+    __m256d vSum = _mm256_setzero_pd();
+    __m256i vCount = _mm256_setzero_si256();
+    double dfMin = DBL_MAX_;
+    double dfMax = -DBL_MAX_;
+    double dfSum = 0;
+    GUIntBig nCount = 0;
+
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        const size_t nLineOffset = static_cast<size_t>(iY) * nLineStride;
+        const T *pLine = pData + nLineOffset;
+        const GByte *pabyMaskLine =
+            pabyMaskData ? pabyMaskData + nLineOffset : nullptr;
+        int iX = 0;
+        for (; iX + 4 <= nXCheck; iX += 4)
+        {
+            __m256d v, valid;
+            LoadValid(pLine + iX, pabyMaskLine ? pabyMaskLine + iX : nullptr,
+                      sND, v, valid);
+            vMin = _mm256_min_pd(vMin, _mm256_blendv_pd(vInitMin, v, valid));
+            vMax = _mm256_max_pd(vMax, _mm256_blendv_pd(vInitMax, v, valid));
+            vCount = _mm256_sub_epi64(vCount, _mm256_castpd_si256(valid));
+            if constexpr (COMPUTE_OTHER_STATS)
+            {
+                vSum = _mm256_add_pd(vSum, _mm256_and_pd(v, valid));
+            }
+        }
+        for (; iX < nXCheck; ++iX)
+        {
+            double dfValue;
+            if ((!pabyMaskLine || pabyMaskLine[iX]) &&
+                GetValidValue(pLine + iX, sND, dfValue))
+            {
+                dfMin = std::min(dfMin, dfValue);
+                dfMax = std::max(dfMax, dfValue);
+                dfSum += dfValue;
+                ++nCount;
+            }
+        }
+    }
+
+    double adfMin[4], adfMax[4];
+    GUIntBig anCount[4];
+    _mm256_storeu_pd(adfMin, vMin);
+    _mm256_storeu_pd(adfMax, vMax);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(anCount), vCount);
+    for (int i = 0; i < 4; ++i)
+    {
+        dfMin = std::min(dfMin, adfMin[i]);
+        dfMax = std::max(dfMax, adfMax[i]);
+        nCount += anCount[i];
+    }
+    if (nCount == 0)
+        return;
+
+    dfMinOut = dfMin;
+    dfMaxOut = dfMax;
+    nValidCountOut = nCount;
+
+    if constexpr (COMPUTE_OTHER_STATS)
+    {
+        // Second pass: sum of differences to the mean of the first pass, and
+        // of their squares, to get a numerically robust variance.
+        dfSum += HorizontalSum(vSum);
+        const double dfMean0 = dfSum / static_cast<double>(nCount);
+        const __m256d vMean0 = _mm256_set1_pd(dfMean0);
+        __m256d vS1 = _mm256_setzero_pd();
+        __m256d vS2 = _mm256_setzero_pd();
+        double dfS1 = 0;
+        double dfS2 = 0;
+
+        for (int iY = 0; iY < nYCheck; iY++)
+        {
+            const size_t nLineOffset = static_cast<size_t>(iY) * nLineStride;
+            const T *pLine = pData + nLineOffset;
+            const GByte *pabyMaskLine =
+                pabyMaskData ? pabyMaskData + nLineOffset : nullptr;
+            int iX = 0;
+            for (; iX + 4 <= nXCheck; iX += 4)
+            {
+                __m256d v, valid;
+                LoadValid(pLine + iX,
+                          pabyMaskLine ? pabyMaskLine + iX : nullptr, sND, v,
+                          valid);
+                const __m256d d =
+                    _mm256_and_pd(_mm256_sub_pd(v, vMean0), valid);
+                vS1 = _mm256_add_pd(vS1, d);
+                vS2 = _mm256_add_pd(vS2, _mm256_mul_pd(d, d));
+            }
+            for (; iX < nXCheck; ++iX)
+            {
+                double dfValue;
+                if ((!pabyMaskLine || pabyMaskLine[iX]) &&
+                    GetValidValue(pLine + iX, sND, dfValue))
+                {
+                    const double d = dfValue - dfMean0;
+                    dfS1 += d;
+                    dfS2 += d * d;
+                }
+            }
+        }
+        dfS1 += HorizontalSum(vS1);
+        dfS2 += HorizontalSum(vS2);
+
+        dfMeanOut = dfMean0 + dfS1 / static_cast<double>(nCount);
+        dfM2Out = dfS2 - dfS1 * dfS1 / static_cast<double>(nCount);
+        if (dfM2Out < 0)
+            dfM2Out = 0;
+    }
+}
+
+template <class T>
+void ComputeBlockStatistics(const T *pData, const GByte *pabyMaskData,
+                            int nXCheck, int nYCheck, int nLineStride,
+                            const NoDataParams &sND, bool bComputeOtherStats,
+                            double &dfMin, double &dfMax, double &dfMean,
+                            double &dfM2, GUIntBig &nValidCount)
+{
+    if (bComputeOtherStats)
+    {
+        ComputeBlockStatisticsT<T, true>(pData, pabyMaskData, nXCheck, nYCheck,
+                                         nLineStride, sND, dfMin, dfMax,
+                                         dfMean, dfM2, nValidCount);
+    }
+    else
+    {
+        ComputeBlockStatisticsT<T, false>(pData, pabyMaskData, nXCheck,
+                                          nYCheck, nLineStride, sND, dfMin,
+                                          dfMax, dfMean, dfM2, nValidCount);
+    }
+}
+
+/************************************************************************/
+/*                        ComputeBlockHistogram()                       */
+/************************************************************************/
+
+template <class T>
+void ComputeBlockHistogram(const T *pData, const GByte *pabyMaskData,
+                           int nXCheck, int nYCheck, int nLineStride,
+                           const NoDataParams &sND, double dfMin,
+                           double dfScale, int nBuckets,
+                           bool bIncludeOutOfRange, GUIntBig *panHistogram)
+{
+    const __m256d vMin = _mm256_set1_pd(dfMin);
+    const __m256d vScale = _mm256_set1_pd(dfScale);
+    const __m256d vZero = _mm256_setzero_pd();
+    const __m256d vBuckets = _mm256_set1_pd(nBuckets);
+    const __m256d vLastBucket = _mm256_set1_pd(nBuckets - 1);
+
+    const auto AddValue = [=](double dfValue)
+    {
+        const double dfIndex = floor((dfValue - dfMin) * dfScale);
+        if (dfIndex < 0)
+        {
+            if (bIncludeOutOfRange)
+                panHistogram[0]++;
+        }
+        else if (dfIndex >= nBuckets)
+        {
+            if (bIncludeOutOfRange)
+                ++panHistogram[nBuckets - 1];
+        }
+        else
+        {
+            ++panHistogram[static_cast<int>(dfIndex)];
+        }
+    };
+
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        const size_t nLineOffset = static_cast<size_t>(iY) * nLineStride;
+        const T *pLine = pData + nLineOffset;
+        const GByte *pabyMaskLine =
+            pabyMaskData ? pabyMaskData + nLineOffset : nullptr;
+        int iX = 0;
+        for (; iX + 4 <= nXCheck; iX += 4)
+        {
+            __m256d v, valid;
+            LoadValid(pLine + iX, pabyMaskLine ? pabyMaskLine + iX : nullptr,
+                      sND, v, valid);
+            __m256d vIndex = _mm256_floor_pd(
+                _mm256_mul_pd(_mm256_sub_pd(v, vMin), vScale));
+            if (!bIncludeOutOfRange)
+            {
+                const __m256d outOfRange =
+                    _mm256_or_pd(_mm256_cmp_pd(vIndex, vZero, _CMP_LT_OQ),
+                                 _mm256_cmp_pd(vIndex, vBuckets, _CMP_GE_OQ));
+                valid = _mm256_andnot_pd(outOfRange, valid);
+            }
+            const int nValidMask = _mm256_movemask_pd(valid);
+            if (nValidMask == 0)
+                continue;
+            // Clamping also gets rid of NaN in invalid lanes
+            vIndex = _mm256_min_pd(_mm256_max_pd(vIndex, vZero), vLastBucket);
+            int anIndex[4];
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(anIndex),
+                             _mm256_cvtpd_epi32(vIndex));
+            for (int i = 0; i < 4; ++i)
+            {
+                if (nValidMask & (1 << i))
+                    ++panHistogram[anIndex[i]];
+            }
+        }
+        for (; iX < nXCheck; ++iX)
+        {
+            double dfValue;
+            if ((!pabyMaskLine || pabyMaskLine[iX]) &&
+                GetValidValue(pLine + iX, sND, dfValue))
+            {
+                AddValue(dfValue);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                   GDALComputeBlockStatistics_AVX2()                  */
+/************************************************************************/
+
+bool GDALComputeBlockStatistics_AVX2(
+    GDALDataType eDataType, const void *pData, const GByte *pabyMaskData,
+    int nXCheck, int nYCheck, int nLineStride, bool bGotNoDataValue,
+    double dfNoDataValue, bool bGotFloatNoDataValue, float fNoDataValue,
+    bool bComputeOtherStats, double &dfMin, double &dfMax, double &dfMean,
+    double &dfM2, GUIntBig &nValidCount)
+{
+    const NoDataParams sND{bGotNoDataValue, dfNoDataValue,
+                           bGotFloatNoDataValue, fNoDataValue};
+
+    const auto Dispatch = [&](auto *pTypedData)
+    {
+        ComputeBlockStatistics(pTypedData, pabyMaskData, nXCheck, nYCheck,
+                               nLineStride, sND, bComputeOtherStats, dfMin,
+                               dfMax, dfMean, dfM2, nValidCount);
+        return true;
+    };
+
+    switch (eDataType)
+    {
+        case GDT_Int16:
+            return Dispatch(static_cast<const GInt16 *>(pData));
+        case GDT_UInt16:
+            return Dispatch(static_cast<const GUInt16 *>(pData));
+        case GDT_Int32:
+            return Dispatch(static_cast<const GInt32 *>(pData));
+        case GDT_Float32:
+            // Nodata value not representable as a float: let the generic
+            // code deal with it.
+            if (bGotNoDataValue)
+                return false;
+            return Dispatch(static_cast<const float *>(pData));
+        case GDT_Float64:
+            return Dispatch(static_cast<const double *>(pData));
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                   GDALComputeBlockHistogram_AVX2()                   */
+/************************************************************************/
+
+bool GDALComputeBlockHistogram_AVX2(
+    GDALDataType eDataType, const void *pData, const GByte *pabyMaskData,
+    int nXCheck, int nYCheck, int nLineStride, bool bGotNoDataValue,
+    double dfNoDataValue, bool bGotFloatNoDataValue, float fNoDataValue,
+    double dfMin, double dfScale, int nBuckets, bool bIncludeOutOfRange,
+    GUIntBig *panHistogram)
+{
+    const NoDataParams sND{bGotNoDataValue, dfNoDataValue,
+                           bGotFloatNoDataValue, fNoDataValue};
+
+    const auto Dispatch = [&](auto *pTypedData)
+    {
+        ComputeBlockHistogram(pTypedData, pabyMaskData, nXCheck, nYCheck,
+                              nLineStride, sND, dfMin, dfScale, nBuckets,
+                              bIncludeOutOfRange, panHistogram);
+        return true;
+    };
+
+    switch (eDataType)
+    {
+        case GDT_Int16:
+            return Dispatch(static_cast<const GInt16 *>(pData));
+        case GDT_UInt16:
+            return Dispatch(static_cast<const GUInt16 *>(pData));
+        case GDT_Int32:
+            return Dispatch(static_cast<const GInt32 *>(pData));
+        case GDT_Float32:
+            if (bGotNoDataValue)
+                return false;
+            return Dispatch(static_cast<const float *>(pData));
+        case GDT_Float64:
+            return Dispatch(static_cast<const double *>(pData));
+        default:
+            break;
+    }
+    return false;
+}
+
+#endif
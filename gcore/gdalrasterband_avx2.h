@@ -0,0 +1,74 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of statistics and histogram computations
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef GDALRASTERBAND_AVX2_H_INCLUDED
+#define GDALRASTERBAND_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+#include "gdal.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+#define HAVE_GDAL_STATISTICS_AVX2
+
+/** Compute the minimum, maximum, and if bComputeOtherStats is set, the mean
+ * and the sum of squares of differences to the mean (dfM2), of the valid
+ * values of a block.
+ *
+ * Handled data types are GDT_Int16, GDT_UInt16, GDT_Int32, GDT_Float32 and
+ * GDT_Float64. Invalid values are NaN, values matching the nodata value
+ * (with the same tolerance as GDALRasterBand::ComputeStatistics()), and values
+ * whose mask byte is 0 when pabyMaskData is not null.
+ *
+ * dfMin, dfMax, dfMean, dfM2 and nValidCount are set to the result for this
+ * block only. They are left unmodified if no value is valid.
+ *
+ * @return false if the data type is not handled.
+ */
+bool GDALComputeBlockStatistics_AVX2(
+    GDALDataType eDataType, const void *pData, const GByte *pabyMaskData,
+    int nXCheck, int nYCheck, int nLineStride, bool bGotNoDataValue,
+    double dfNoDataValue, bool bGotFloatNoDataValue, float fNoDataValue,
+    bool bComputeOtherStats, double &dfMin, double &dfMax, double &dfMean,
+    double &dfM2, GUIntBig &nValidCount);
+
+/** Add the valid values of a block to a histogram, in the same way as
+ * GDALRasterBand::GetHistogram().
+ *
+ * @return false if the data type is not handled.
+ */
+bool GDALComputeBlockHistogram_AVX2(
+    GDALDataType eDataType, const void *pData, const GByte *pabyMaskData,
+    int nXCheck, int nYCheck, int nLineStride, bool bGotNoDataValue,
+    double dfNoDataValue, bool bGotFloatNoDataValue, float fNoDataValue,
+    double dfMin, double dfScale, int nBuckets, bool bIncludeOutOfRange,
+    GUIntBig *panHistogram);
+
+#endif
+
+#endif /* GDALRASTERBAND_AVX2_H_INCLUDED */
@@ -33,6 +33,8 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <climits>
 #include <cstring>
 #include <mutex>
@@ -46,24 +48,132 @@
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
 
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+namespace
+{
+/** One independent partition of the global block cache, with its own LRU
+ * list(s), lock and memory accounting. Blocks are assigned to a shard
+ * according to their dataset (see GetCacheShardIndex()). */
+struct GDALRasterBlockCacheShard
+{
+    CPLLock *hLock = nullptr;
+    GIntBig nCacheUsed = 0;
+
+    // Main list. With the 2Q policy, this is the list of blocks that have
+    // been accessed only once since they were cached (probationary list).
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+
+    // Only used by the 2Q policy: blocks that have been accessed at least
+    // twice since they were cached.
+    GDALRasterBlock *poProtectedOldest = nullptr;  // Tail.
+    GDALRasterBlock *poProtectedNewest = nullptr;  // Head.
+    GIntBig nProtectedUsed = 0;
+
+    // Only used by the 2Q policy: cumulated size of the blocks added to the
+    // shard. Used to determine if a block is still in the window where
+    // re-references are considered as correlated to the first access.
+    GIntBig nInsertedBytes = 0;
+
+    GDALBlockCacheCounters sCounters{};
+
+    // Only updated if GDAL_CACHE_LOCK_WAIT_STATISTICS=YES
+    std::atomic<GIntBig> nLockWaitTimeNS{0};
+};
+
+/** Eviction policy of the global block cache, as set by GDAL_CACHE_POLICY */
+enum class GDALRasterBlockCachePolicy
+{
+    /** Strict least recently used */
+    LRU,
+    /** Scan resistant policy where blocks are first put in a probationary
+     * list, and promoted to a protected list when accessed again once a
+     * quarter of the budget of the shard has been used by newer blocks.
+     * Eviction happens first in the probationary list. */
+    TWO_Q,
+};
+
+// Values of GDALRasterBlock::nCacheList
+constexpr int CACHE_LIST_NONE = 0;
+constexpr int CACHE_LIST_MAIN = 1;
+constexpr int CACHE_LIST_PROTECTED = 2;
+
+}  // namespace
+
+static GDALRasterBlockCachePolicy eCachePolicy =
+    GDALRasterBlockCachePolicy::LRU;
+
+// Upper bound for GDAL_CACHE_SHARDS.
+constexpr int MAX_CACHE_SHARDS = 256;
+
+// Number of shards effectively used, as set by GDAL_CACHE_SHARDS (1 by default)
+static int nCacheShards = 1;
+static GDALRasterBlockCacheShard asCacheShards[MAX_CACHE_SHARDS];
+
+// Index of the shard to start from in FlushCacheBlock()
+static volatile int nFlushShardCounter = 0;
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
+static bool bMeasureLockWaitTime = false;
+
 #if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
+#define INITIALIZE_LOCK(psShard) CPLMutexHolderD(&((psShard)->hLock))
+#define TAKE_LOCK(psShard) CPLMutexHolderOptionalLockD((psShard)->hLock)
+#define DESTROY_LOCK(psShard) CPLDestroyMutex((psShard)->hLock)
 #else
 
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
+namespace
+{
+/** Equivalent of CPLLockHolder, that accumulates the time spent waiting for
+ * the lock of the shard if GDAL_CACHE_LOCK_WAIT_STATISTICS=YES */
+class GDALRasterBlockCacheLockHolder
+{
+    CPLLock *m_hLock = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRasterBlockCacheLockHolder)
+
+  public:
+    explicit GDALRasterBlockCacheLockHolder(GDALRasterBlockCacheShard *psShard)
+        : m_hLock(psShard->hLock)
+    {
+        if (m_hLock == nullptr)
+            return;
+        bool bOK;
+        if (bMeasureLockWaitTime)
+        {
+            const auto nStart = std::chrono::steady_clock::now();
+            bOK = CPL_TO_BOOL(CPLAcquireLock(m_hLock));
+            psShard->nLockWaitTimeNS.fetch_add(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - nStart)
+                    .count(),
+                std::memory_order_relaxed);
+        }
+        else
+        {
+            bOK = CPL_TO_BOOL(CPLAcquireLock(m_hLock));
+        }
+        if (!bOK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "GDALRasterBlockCacheLockHolder: "
+                     "Failed to acquire lock!");
+            m_hLock = nullptr;
+        }
+    }
+
+    ~GDALRasterBlockCacheLockHolder()
+    {
+        if (m_hLock)
+            CPLReleaseLock(m_hLock);
+    }
+};
+}  // namespace
+
 static CPLLockType GetLockType()
 {
     static int nLockType = -1;
@@ -91,14 +201,60 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+#define INITIALIZE_LOCK(psShard)                                               \
+    CPLLockHolderD(&((psShard)->hLock), GetLockType());                        \
+    CPLLockSetDebugPerf((psShard)->hLock, bDebugContention)
+#define TAKE_LOCK(psShard) GDALRasterBlockCacheLockHolder oHolder(psShard)
+#define DESTROY_LOCK(psShard) CPLDestroyLock((psShard)->hLock)
 
 #endif
 
+/************************************************************************/
+/*                        GetCacheShardIndex()                          */
+/************************************************************************/
+
+// Blocks of a same dataset go to the same shard, so that the eviction logic
+// of Internalize(), which favors dirty blocks of the current dataset, keeps
+// working within a shard.
+static int GetCacheShardIndex(GDALRasterBand *poBand)
+{
+    // Make sure GDAL_CACHE_SHARDS has been taken into account
+    GDALGetCacheMax64();
+    if (nCacheShards == 1)
+        return 0;
+    const void *pKey = poBand->GetDataset();
+    if (pKey == nullptr)
+        pKey = poBand;
+    // Fibonacci hashing of the pointer value
+    const uint64_t nHash =
+        static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pKey)) *
+        UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<int>((nHash >> 32) %
+                            static_cast<unsigned>(nCacheShards));
+}
+
+/************************************************************************/
+/*                        GetCacheShardMax()                            */
+/************************************************************************/
+
+// Each shard is given an equal part of the global cache budget.
+static GIntBig GetCacheShardMax(GIntBig nCurCacheMax)
+{
+    return nCurCacheMax / nCacheShards;
+}
+
+/************************************************************************/
+/*                     GetOldestEvictionCandidate()                     */
+/************************************************************************/
+
+// Returns the first block to consider for eviction. Other candidates are
+// obtained with GDALRasterBlock::GetNextEvictionCandidate_unlocked()
+static GDALRasterBlock *
+GetOldestEvictionCandidate(const GDALRasterBlockCacheShard &sShard)
+{
+    return sShard.poOldest ? sShard.poOldest : sShard.poProtectedOldest;
+}
+
 // #define ENABLE_DEBUG
 
 /************************************************************************/
@@ -162,14 +318,19 @@ void CPL_STDCALL GDALSetCacheMax64(GIntBig nNewSizeInBytes)
     /*      Flush blocks till we are under the new limit or till we         */
     /*      can't seem to flush anymore.                                    */
     /* -------------------------------------------------------------------- */
-    while (nCacheUsed > nCacheMax)
+    const GIntBig nShardMax = GetCacheShardMax(nCacheMax);
+    for (int iShard = 0; iShard < nCacheShards; ++iShard)
     {
-        const GIntBig nOldCacheUsed = nCacheUsed;
+        const GDALRasterBlockCacheShard &sShard = asCacheShards[iShard];
+        while (sShard.nCacheUsed > nShardMax)
+        {
+            const GIntBig nOldCacheUsed = sShard.nCacheUsed;
 
-        GDALFlushCacheBlock();
+            GDALRasterBlock::FlushCacheBlockFromShard(iShard, FALSE);
 
-        if (nCacheUsed == nOldCacheUsed)
-            break;
+            if (sShard.nCacheUsed == nOldCacheUsed)
+                break;
+        }
     }
 }
 
@@ -229,6 +390,11 @@ int CPL_STDCALL GDALGetCacheMax()
  * physical RAM (which may potentially be used by other processes). Otherwise
  * it is expected to be a value in MB.
  *
+ * When the GDAL_CACHE_SHARDS configuration option is set to a value N
+ * greater than 1, the cache is split into N independent partitions, each
+ * with its own LRU list and lock and a budget of 1/N of the maximum cache
+ * memory. Blocks of a given dataset are always assigned to the same partition.
+ *
  * @return maximum in bytes.
  *
  * @since GDAL 1.8.0
@@ -241,11 +407,45 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
+            const char *pszCacheShards =
+                CPLGetConfigOption("GDAL_CACHE_SHARDS", nullptr);
+            if (pszCacheShards)
+            {
+                const int nVal = atoi(pszCacheShards);
+                if (nVal < 1 || nVal > MAX_CACHE_SHARDS)
+                {
+                    CPLError(CE_Warning, CPLE_IllegalArg,
+                             "Invalid value for GDAL_CACHE_SHARDS. "
+                             "It should be in [1, %d] range",
+                             MAX_CACHE_SHARDS);
+                }
+                else
+                {
+                    nCacheShards = nVal;
+                }
+            }
+            for (int iShard = 0; iShard < nCacheShards; ++iShard)
             {
-                INITIALIZE_LOCK;
+                INITIALIZE_LOCK(&asCacheShards[iShard]);
+            }
+
+            const char *pszCachePolicy =
+                CPLGetConfigOption("GDAL_CACHE_POLICY", "LRU");
+            if (EQUAL(pszCachePolicy, "2Q"))
+            {
+                eCachePolicy = GDALRasterBlockCachePolicy::TWO_Q;
+            }
+            else if (!EQUAL(pszCachePolicy, "LRU"))
+            {
+                CPLError(CE_Warning, CPLE_NotSupported,
+                         "GDAL_CACHE_POLICY=%s not supported. "
+                         "Falling back to LRU",
+                         pszCachePolicy);
             }
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
+            bMeasureLockWaitTime = CPLTestBool(
+                CPLGetConfigOption("GDAL_CACHE_LOCK_WAIT_STATISTICS", "NO"));
 
             const char *pszCacheMax = CPLGetConfigOption("GDAL_CACHEMAX", "5%");
 
@@ -305,6 +505,8 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
             nCacheMax = nNewCacheMax;
             CPLDebug("GDAL", "GDAL_CACHEMAX = " CPL_FRMT_GIB " MB",
                      nCacheMax / (1024 * 1024));
+            if (nCacheShards > 1)
+                CPLDebug("GDAL", "GDAL_CACHE_SHARDS = %d", nCacheShards);
         });
 
     // coverity[overflow_sink]
@@ -324,6 +526,7 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
+    const GIntBig nCacheUsed = GDALGetCacheUsed64();
     if (nCacheUsed > INT_MAX)
     {
         static bool bHasWarned = false;
@@ -354,6 +557,9 @@ int CPL_STDCALL GDALGetCacheUsed()
 
 GIntBig CPL_STDCALL GDALGetCacheUsed64()
 {
+    GIntBig nCacheUsed = 0;
+    for (int iShard = 0; iShard < nCacheShards; ++iShard)
+        nCacheUsed += asCacheShards[iShard].nCacheUsed;
     return nCacheUsed;
 }
 
@@ -378,6 +584,45 @@ int CPL_STDCALL GDALFlushCacheBlock()
     return GDALRasterBlock::FlushCacheBlock();
 }
 
+/************************************************************************/
+/*                       GDALGetCacheStatistics()                       */
+/************************************************************************/
+
+/**
+ * \brief Return statistics on the activity of the raster block cache.
+ *
+ * The following keys are returned:
+ * <ul>
+ * <li>HITS: number of times a requested block was found in the cache.</li>
+ * <li>MISSES: number of times a requested block was not in the cache, and
+ *     had to be read (or initialized).</li>
+ * <li>EVICTIONS: number of blocks evicted from the cache to stay within the
+ *     limit set by GDALSetCacheMax64().</li>
+ * <li>DIRTY_BLOCKS_FLUSHED: number of modified blocks written back.</li>
+ * <li>BYTES_WRITTEN_BACK: number of bytes of modified blocks written back.</li>
+ * <li>COMPRESSED_CACHE_HITS: number of misses that were served by the
+ *     compressed block cache (see GDAL_COMPRESSED_CACHEMAX), instead of being
+ *     read.</li>
+ * <li>LOCK_WAIT_TIME: cumulated time, in seconds, spent waiting for the
+ *     cache lock(s). Only available for the global statistics, and only
+ *     measured if the GDAL_CACHE_LOCK_WAIT_STATISTICS configuration option is
+ *     set to YES.</li>
+ * </ul>
+ *
+ * Statistics for a dataset are accumulated over its raster bands, and only
+ * take into account the activity since the bands were first accessed.
+ *
+ * @param hDS Dataset for which to return statistics, or NULL to get global
+ *            statistics.
+ * @return a string list of KEY=VALUE pairs, to free with CSLDestroy().
+ *
+ * @since GDAL 3.10
+ */
+char **GDALGetCacheStatistics(GDALDatasetH hDS)
+{
+    return GDALRasterBlock::GetCacheStatistics(GDALDataset::FromHandle(hDS));
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                           GDALRasterBlock                            */
@@ -434,11 +679,36 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
+    // Make sure the shards are initialized
+    GDALGetCacheMax64();
+
+    // Start from a different shard at each call, so that all shards are
+    // equally solicited.
+    const int iFirstShard =
+        (CPLAtomicInc(&nFlushShardCounter) & INT_MAX) % nCacheShards;
+    for (int i = 0; i < nCacheShards; ++i)
+    {
+        if (FlushCacheBlockFromShard((iFirstShard + i) % nCacheShards,
+                                     bDirtyBlocksOnly))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/************************************************************************/
+/*                      FlushCacheBlockFromShard()                      */
+/************************************************************************/
+
+/*! @cond Doxygen_Suppress */
+int GDALRasterBlock::FlushCacheBlockFromShard(int iShard, int bDirtyBlocksOnly)
+
+{
+    GDALRasterBlockCacheShard *psShard = &asCacheShards[iShard];
     GDALRasterBlock *poTarget;
 
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        TAKE_LOCK(psShard);
+        poTarget = GetOldestEvictionCandidate(*psShard);
 
         while (poTarget != nullptr)
         {
@@ -448,7 +718,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
                 if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0, -1))
                     break;
             }
-            poTarget = poTarget->poPrevious;
+            poTarget = poTarget->GetNextEvictionCandidate_unlocked();
         }
 
         if (poTarget == nullptr)
@@ -464,6 +734,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
         poTarget->Detach_unlocked();
         poTarget->GetBand()->UnreferenceBlock(poTarget);
+        poTarget->AccountEviction();
     }
 
     if (bSleepsForBockCacheDebug)
@@ -475,7 +746,11 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
             CPLSleep(dfDelay);
     }
 
-    if (poTarget->GetDirty())
+    if (!poTarget->GetDirty())
+    {
+        poTarget->StoreInCompressedCache();
+    }
+    else
     {
         const CPLErr eErr = poTarget->Write();
         if (eErr != CE_None)
@@ -492,6 +767,8 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
     return TRUE;
 }
 
+/*! @endcond */
+
 /************************************************************************/
 /*                          FlushDirtyBlocks()                          */
 /************************************************************************/
@@ -585,7 +862,9 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
                                  int nYOffIn)
     : eType(poBandIn->GetRasterDataType()), bDirty(false), nLockCount(0),
       nXOff(nXOffIn), nYOff(nYOffIn), nXSize(0), nYSize(0), pData(nullptr),
-      poBand(poBandIn), poNext(nullptr), poPrevious(nullptr), bMustDetach(true)
+      poBand(poBandIn), poNext(nullptr), poPrevious(nullptr), bMustDetach(true),
+      nCacheShard(GetCacheShardIndex(poBandIn)), nCacheList(CACHE_LIST_NONE),
+      nCacheInsertionPos(0)
 {
     CPLAssert(poBandIn != nullptr);
     poBand->GetBlockSize(&nXSize, &nYSize);
@@ -612,7 +891,8 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
 GDALRasterBlock::GDALRasterBlock(int nXOffIn, int nYOffIn)
     : eType(GDT_Unknown), bDirty(false), nLockCount(0), nXOff(nXOffIn),
       nYOff(nYOffIn), nXSize(0), nYSize(0), pData(nullptr), poBand(nullptr),
-      poNext(nullptr), poPrevious(nullptr), bMustDetach(false)
+      poNext(nullptr), poPrevious(nullptr), bMustDetach(false), nCacheShard(0),
+      nCacheList(CACHE_LIST_NONE), nCacheInsertionPos(0)
 {
 }
 
@@ -635,6 +915,7 @@ void GDALRasterBlock::RecycleFor(int nXOffIn, int nYOffIn)
 
     poNext = nullptr;
     poPrevious = nullptr;
+    nCacheList = CACHE_LIST_NONE;
 
     nXOff = nXOffIn;
     nYOff = nYOffIn;
@@ -683,6 +964,19 @@ static size_t GetEffectiveBlockSize(GPtrDiff_t nBlockSize)
                      2 * sizeof(GDALRasterBlock)));
 }
 
+/************************************************************************/
+/*                     GetBlockCacheMemoryCounter()                     */
+/************************************************************************/
+
+// Mirrors the sum of the nCacheUsed of the shards, so that the peak usage of
+// the block cache is reported along other memory accounting counters.
+static CPLMemoryAccountingCounter *GetBlockCacheMemoryCounter()
+{
+    static CPLMemoryAccountingCounter *const hCounter =
+        CPLGetMemoryAccountingCounter("GDAL_BLOCK_CACHE");
+    return hCounter;
+}
+
 /************************************************************************/
 /*                               Detach()                               */
 /************************************************************************/
@@ -701,19 +995,54 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(&asCacheShards[nCacheShard]);
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    GDALRasterBlockCacheShard &sShard = asCacheShards[nCacheShard];
+    if (nCacheList == CACHE_LIST_PROTECTED)
+    {
+        Unlink_unlocked(sShard.poProtectedOldest, sShard.poProtectedNewest);
+        if (pData)
+            sShard.nProtectedUsed -= GetEffectiveBlockSize(GetBlockSize());
+    }
+    else
+    {
+        Unlink_unlocked(sShard.poOldest, sShard.poNewest);
+    }
+    nCacheList = CACHE_LIST_NONE;
+    bMustDetach = false;
+
+    if (pData)
+    {
+        const auto nEffectiveSize = GetEffectiveBlockSize(GetBlockSize());
+        sShard.nCacheUsed -= nEffectiveSize;
+        CPLMemoryAccountingAdd(GetBlockCacheMemoryCounter(),
+                               -static_cast<GIntBig>(nEffectiveSize));
+    }
+
+#ifdef ENABLE_DEBUG
+    Verify();
+#endif
+}
+
+/************************************************************************/
+/*                           Unlink_unlocked()                          */
+/************************************************************************/
+
+/** Remove the block from the linked list whose tail and head are passed */
+void GDALRasterBlock::Unlink_unlocked(GDALRasterBlock *&poListOldest,
+                                      GDALRasterBlock *&poListNewest)
+{
+    if (poListOldest == this)
+        poListOldest = poPrevious;
 
-    if (poNewest == this)
+    if (poListNewest == this)
     {
-        poNewest = poNext;
+        poListNewest = poNext;
     }
 
     if (poPrevious != nullptr)
@@ -724,14 +1053,48 @@ void GDALRasterBlock::Detach_unlocked()
 
     poPrevious = nullptr;
     poNext = nullptr;
-    bMustDetach = false;
+}
 
-    if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+/************************************************************************/
+/*                         PushNewest_unlocked()                        */
+/************************************************************************/
 
-#ifdef ENABLE_DEBUG
-    Verify();
-#endif
+/** Insert the (unlinked) block at the head of the linked list whose tail and
+ * head are passed */
+void GDALRasterBlock::PushNewest_unlocked(GDALRasterBlock *&poListOldest,
+                                          GDALRasterBlock *&poListNewest)
+{
+    CPLAssert(poPrevious == nullptr && poNext == nullptr);
+    poNext = poListNewest;
+
+    if (poListNewest != nullptr)
+    {
+        CPLAssert(poListNewest->poPrevious == nullptr);
+        poListNewest->poPrevious = this;
+    }
+    poListNewest = this;
+
+    if (poListOldest == nullptr)
+    {
+        CPLAssert(poNext == nullptr);
+        poListOldest = this;
+    }
+}
+
+/************************************************************************/
+/*                  GetNextEvictionCandidate_unlocked()                 */
+/************************************************************************/
+
+/** Return the block that should be considered for eviction after this one.
+ *
+ * Blocks of the main (or probationary) list are considered first, from the
+ * oldest to the newest, and then blocks of the protected list.
+ */
+GDALRasterBlock *GDALRasterBlock::GetNextEvictionCandidate_unlocked() const
+{
+    if (poPrevious == nullptr && nCacheList == CACHE_LIST_MAIN)
+        return asCacheShards[nCacheShard].poProtectedOldest;
+    return poPrevious;
 }
 
 /************************************************************************/
@@ -747,26 +1110,46 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (int iShard = 0; iShard < nCacheShards; ++iShard)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        GDALRasterBlockCacheShard *psShard = &asCacheShards[iShard];
+        TAKE_LOCK(psShard);
+
+        GDALRasterBlock *poNewest = psShard->poNewest;
+        GDALRasterBlock *poOldest = psShard->poOldest;
+        CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
+                  (poNewest != nullptr && poOldest != nullptr));
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        if (poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(poNewest->poPrevious == nullptr);
+            CPLAssert(poOldest->poNext == nullptr);
+
+            GDALRasterBlock *poLast = nullptr;
+            for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+                 poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->nCacheShard == iShard);
+                CPLAssert(poBlock->nCacheList == CACHE_LIST_MAIN);
+                CPLAssert(poBlock->poPrevious == poLast);
 
-            poLast = poBlock;
+                poLast = poBlock;
+            }
+
+            CPLAssert(poOldest == poLast);
         }
 
-        CPLAssert(poOldest == poLast);
+        GDALRasterBlock *poProtectedLast = nullptr;
+        for (GDALRasterBlock *poBlock = psShard->poProtectedNewest;
+             poBlock != nullptr; poBlock = poBlock->poNext)
+        {
+            CPLAssert(poBlock->nCacheShard == iShard);
+            CPLAssert(poBlock->nCacheList == CACHE_LIST_PROTECTED);
+            CPLAssert(poBlock->poPrevious == poProtectedLast);
+
+            poProtectedLast = poBlock;
+        }
+        CPLAssert(psShard->poProtectedOldest == poProtectedLast);
     }
 }
 
@@ -779,8 +1162,10 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+    GDALRasterBlockCacheShard *psShard =
+        &asCacheShards[GetCacheShardIndex(poBand)];
+    TAKE_LOCK(psShard);
+    for (GDALRasterBlock *poBlock = psShard->poNewest; poBlock != nullptr;
          poBlock = poBlock->poNext)
     {
         if (poBlock->GetBand() == poBand)
@@ -833,6 +1218,12 @@ CPLErr GDALRasterBlock::Write()
         CPLErr eErr = poBand->IWriteBlock(nXOff, nYOff, pData);
         if (bCallLeaveReadWrite)
             poBand->LeaveReadWrite();
+        if (eErr == CE_None)
+        {
+            IncrementCounter(&GDALBlockCacheCounters::nDirtyBlocksFlushed, 1);
+            IncrementCounter(&GDALBlockCacheCounters::nBytesWrittenBack,
+                             GetBlockSize());
+        }
         return eErr;
     }
     else
@@ -848,16 +1239,27 @@ CPLErr GDALRasterBlock::Write()
  *
  * This method is normally called when a block is used to keep track
  * that it has been recently used.
+ *
+ * With the 2Q policy (GDAL_CACHE_POLICY=2Q), a block that is touched again
+ * after it has been cached is moved to the top of the protected list, unless
+ * blocks using less than a quarter of the budget of its cache partition have
+ * been cached since then. Such re-references, like the ones of a line by line
+ * read of a tiled raster, are considered as correlated to the first access,
+ * and leave the block in its position of the probationary list.
  */
 
 void GDALRasterBlock::Touch()
 
 {
+    GDALRasterBlockCacheShard *psShard = &asCacheShards[nCacheShard];
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (psShard->poProtectedNewest == this ||
+        (psShard->poNewest == this &&
+         eCachePolicy == GDALRasterBlockCachePolicy::LRU))
         return;
 
-    TAKE_LOCK;
+    TAKE_LOCK(psShard);
     Touch_unlocked();
 }
 
@@ -870,36 +1272,68 @@ void GDALRasterBlock::Touch_unlocked()
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    GDALRasterBlockCacheShard &sShard = asCacheShards[nCacheShard];
+    if (sShard.poProtectedNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
-
-    if (poPrevious != nullptr)
-        poPrevious->poNext = poNext;
-
-    if (poNext != nullptr)
-        poNext->poPrevious = poPrevious;
-
-    poPrevious = nullptr;
-    poNext = poNewest;
+    if (nCacheList == CACHE_LIST_NONE ||
+        eCachePolicy == GDALRasterBlockCachePolicy::LRU)
+    {
+        if (sShard.poNewest == this)
+            return;
 
-    if (poNewest != nullptr)
+        if (nCacheList == CACHE_LIST_NONE)
+        {
+            nCacheInsertionPos = sShard.nInsertedBytes;
+            sShard.nInsertedBytes += GetEffectiveBlockSize(GetBlockSize());
+        }
+        Unlink_unlocked(sShard.poOldest, sShard.poNewest);
+        PushNewest_unlocked(sShard.poOldest, sShard.poNewest);
+        nCacheList = CACHE_LIST_MAIN;
+    }
+    else if (nCacheList == CACHE_LIST_MAIN &&
+             sShard.nInsertedBytes - nCacheInsertionPos <=
+                 GetCacheShardMax(nCacheMax) / 4)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        // Correlated reference: the block stays where it is in the FIFO
+        // order of the probationary list.
+        return;
     }
-    poNewest = this;
-
-    if (poOldest == nullptr)
+    else
     {
-        CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        if (nCacheList == CACHE_LIST_MAIN)
+        {
+            Unlink_unlocked(sShard.poOldest, sShard.poNewest);
+            if (pData)
+                sShard.nProtectedUsed += GetEffectiveBlockSize(GetBlockSize());
+        }
+        else
+        {
+            Unlink_unlocked(sShard.poProtectedOldest, sShard.poProtectedNewest);
+        }
+        PushNewest_unlocked(sShard.poProtectedOldest, sShard.poProtectedNewest);
+        nCacheList = CACHE_LIST_PROTECTED;
+
+        // Demote the oldest blocks of the protected list to the probationary
+        // list, so that the protected list does not use more than 3/4 of the
+        // budget of the shard.
+        const GIntBig nProtectedMax = GetCacheShardMax(nCacheMax) / 4 * 3;
+        while (sShard.nProtectedUsed > nProtectedMax &&
+               sShard.poProtectedOldest != this)
+        {
+            GDALRasterBlock *poDemoted = sShard.poProtectedOldest;
+            poDemoted->Unlink_unlocked(sShard.poProtectedOldest,
+                                       sShard.poProtectedNewest);
+            if (poDemoted->pData)
+                sShard.nProtectedUsed -=
+                    GetEffectiveBlockSize(poDemoted->GetBlockSize());
+            poDemoted->PushNewest_unlocked(sShard.poOldest, sShard.poNewest);
+            poDemoted->nCacheList = CACHE_LIST_MAIN;
+        }
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -928,9 +1362,11 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard mutexes. Other call places can
     // only be called if we have go through there.
-    const GIntBig nCurCacheMax = GDALGetCacheMax64();
+    const GIntBig nCurCacheMax = GetCacheShardMax(GDALGetCacheMax64());
+
+    GDALRasterBlockCacheShard &sShard = asCacheShards[nCacheShard];
 
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
@@ -947,12 +1383,18 @@ CPLErr GDALRasterBlock::Internalize()
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
         {
-            TAKE_LOCK;
+            TAKE_LOCK(&sShard);
 
             if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while (nCacheUsed > nCurCacheMax)
+            {
+                const auto nEffectiveSize = GetEffectiveBlockSize(nSizeInBytes);
+                sShard.nCacheUsed += nEffectiveSize;
+                CPLMemoryAccountingAdd(GetBlockCacheMemoryCounter(),
+                                       static_cast<GIntBig>(nEffectiveSize));
+                IncrementCounter(&GDALBlockCacheCounters::nMisses, 1);
+            }
+            GDALRasterBlock *poTarget = GetOldestEvictionCandidate(sShard);
+            while (sShard.nCacheUsed > nCurCacheMax)
             {
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
                 // In this first pass, only discard dirty blocks of this
@@ -985,7 +1427,7 @@ CPLErr GDALRasterBlock::Internalize()
                             poDirtyBlockOtherDataset = poTarget;
                         }
                     }
-                    poTarget = poTarget->poPrevious;
+                    poTarget = poTarget->GetNextEvictionCandidate_unlocked();
                 }
                 if (poTarget == nullptr && poDirtyBlockOtherDataset)
                 {
@@ -998,7 +1440,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = GetOldestEvictionCandidate(sShard);
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -1009,7 +1451,7 @@ CPLErr GDALRasterBlock::Internalize()
                                     "Evicting dirty block of another dataset");
                                 break;
                             }
-                            poTarget = poTarget->poPrevious;
+                            poTarget = poTarget->GetNextEvictionCandidate_unlocked();
                         }
                     }
                 }
@@ -1025,10 +1467,12 @@ CPLErr GDALRasterBlock::Internalize()
                             CPLSleep(dfDelay);
                     }
 
-                    GDALRasterBlock *_poPrevious = poTarget->poPrevious;
+                    GDALRasterBlock *_poPrevious =
+                        poTarget->GetNextEvictionCandidate_unlocked();
 
                     poTarget->Detach_unlocked();
                     poTarget->GetBand()->UnreferenceBlock(poTarget);
+                    poTarget->AccountEviction();
 
                     apoBlocksToFree[nBlocksToFree++] = poTarget;
                     if (poTarget->GetDirty())
@@ -1036,12 +1480,12 @@ CPLErr GDALRasterBlock::Internalize()
                         // Only free one dirty block at a time so that
                         // other dirty blocks of other bands with the same
                         // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
+                        bLoopAgain = sShard.nCacheUsed > nCurCacheMax;
                         break;
                     }
                     if (nBlocksToFree == 64)
                     {
-                        bLoopAgain = (nCacheUsed > nCurCacheMax);
+                        bLoopAgain = (sShard.nCacheUsed > nCurCacheMax);
                         break;
                     }
 
@@ -1069,7 +1513,11 @@ CPLErr GDALRasterBlock::Internalize()
         {
             GDALRasterBlock *const poBlock = apoBlocksToFree[i];
 
-            if (poBlock->GetDirty())
+            if (!poBlock->GetDirty())
+            {
+                poBlock->StoreInCompressedCache();
+            }
+            else
             {
                 if (bSleepsForBockCacheDebug)
                 {
@@ -1120,6 +1568,116 @@ CPLErr GDALRasterBlock::Internalize()
     return CE_None;
 }
 
+/************************************************************************/
+/*                          IncrementCounter()                          */
+/************************************************************************/
+
+/** Increment a statistics counter, both globally and for the band. */
+void GDALRasterBlock::IncrementCounter(
+    std::atomic<GIntBig> GDALBlockCacheCounters::*pCounter, GIntBig nInc)
+{
+    (asCacheShards[nCacheShard].sCounters.*pCounter)
+        .fetch_add(nInc, std::memory_order_relaxed);
+    if (poBand && poBand->poBandBlockCache)
+    {
+        (poBand->poBandBlockCache->GetCounters().*pCounter)
+            .fetch_add(nInc, std::memory_order_relaxed);
+    }
+}
+
+/************************************************************************/
+/*                       StoreInCompressedCache()                       */
+/************************************************************************/
+
+/** Store a clean block that is evicted in the compressed block cache, if
+ * enabled (see GDAL_COMPRESSED_CACHEMAX) */
+void GDALRasterBlock::StoreInCompressedCache()
+{
+    if (pData)
+    {
+        GDALCompressedBlockCacheStore(poBand, nXOff, nYOff, pData,
+                                      static_cast<size_t>(GetBlockSize()));
+    }
+}
+
+/************************************************************************/
+/*                          AccountEviction()                           */
+/************************************************************************/
+
+void GDALRasterBlock::AccountEviction()
+{
+    IncrementCounter(&GDALBlockCacheCounters::nEvictions, 1);
+}
+
+/************************************************************************/
+/*                     AccountCompressedCacheHit()                      */
+/************************************************************************/
+
+/*! @cond Doxygen_Suppress */
+void GDALRasterBlock::AccountCompressedCacheHit()
+{
+    IncrementCounter(&GDALBlockCacheCounters::nCompressedCacheHits, 1);
+}
+
+/*! @endcond */
+
+/************************************************************************/
+/*                         GetCacheStatistics()                         */
+/************************************************************************/
+
+/*! @cond Doxygen_Suppress */
+char **GDALRasterBlock::GetCacheStatistics(GDALDataset *poDS)
+{
+    GIntBig nHits = 0;
+    GIntBig nMisses = 0;
+    GIntBig nEvictions = 0;
+    GIntBig nDirtyBlocksFlushed = 0;
+    GIntBig nBytesWrittenBack = 0;
+    GIntBig nCompressedCacheHits = 0;
+    const auto Accumulate = [&](const GDALBlockCacheCounters &sCounters)
+    {
+        nCompressedCacheHits += sCounters.nCompressedCacheHits;
+        nHits += sCounters.nHits;
+        nMisses += sCounters.nMisses;
+        nEvictions += sCounters.nEvictions;
+        nDirtyBlocksFlushed += sCounters.nDirtyBlocksFlushed;
+        nBytesWrittenBack += sCounters.nBytesWrittenBack;
+    };
+
+    CPLStringList aosRet;
+    if (poDS)
+    {
+        for (auto *poIterBand : poDS->GetBands())
+        {
+            if (poIterBand->poBandBlockCache)
+                Accumulate(poIterBand->poBandBlockCache->GetCounters());
+        }
+    }
+    else
+    {
+        GIntBig nLockWaitTimeNS = 0;
+        for (int iShard = 0; iShard < nCacheShards; ++iShard)
+        {
+            Accumulate(asCacheShards[iShard].sCounters);
+            nLockWaitTimeNS += asCacheShards[iShard].nLockWaitTimeNS;
+        }
+        aosRet.SetNameValue("LOCK_WAIT_TIME",
+                            CPLSPrintf("%.6f", nLockWaitTimeNS * 1e-9));
+    }
+    aosRet.SetNameValue("HITS", CPLSPrintf(CPL_FRMT_GIB, nHits));
+    aosRet.SetNameValue("MISSES", CPLSPrintf(CPL_FRMT_GIB, nMisses));
+    aosRet.SetNameValue("EVICTIONS", CPLSPrintf(CPL_FRMT_GIB, nEvictions));
+    aosRet.SetNameValue("DIRTY_BLOCKS_FLUSHED",
+                        CPLSPrintf(CPL_FRMT_GIB, nDirtyBlocksFlushed));
+    aosRet.SetNameValue("BYTES_WRITTEN_BACK",
+                        CPLSPrintf(CPL_FRMT_GIB, nBytesWrittenBack));
+    aosRet.SetNameValue("COMPRESSED_CACHE_HITS",
+                        CPLSPrintf(CPL_FRMT_GIB, nCompressedCacheHits));
+    return aosRet.StealList();
+}
+
+/*! @endcond */
+
 /************************************************************************/
 /*                             MarkDirty()                              */
 /************************************************************************/
@@ -1167,9 +1725,28 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    GIntBig nHits = 0;
+    GIntBig nMisses = 0;
+    GIntBig nEvictions = 0;
+    for (int iShard = 0; iShard < nCacheShards; ++iShard)
+    {
+        GDALRasterBlockCacheShard *psShard = &asCacheShards[iShard];
+        nHits += psShard->sCounters.nHits;
+        nMisses += psShard->sCounters.nMisses;
+        nEvictions += psShard->sCounters.nEvictions;
+        if (psShard->hLock != nullptr)
+            DESTROY_LOCK(psShard);
+        psShard->hLock = nullptr;
+    }
+    if (nHits || nMisses)
+    {
+        CPLDebug("GDAL",
+                 "Block cache (%s policy): " CPL_FRMT_GIB " hits, " CPL_FRMT_GIB
+                 " misses, " CPL_FRMT_GIB " evictions",
+                 eCachePolicy == GDALRasterBlockCachePolicy::TWO_Q ? "2Q"
+                                                                    : "LRU",
+                 nHits, nMisses, nEvictions);
+    }
 }
 
 /*! @endcond */
@@ -1217,6 +1794,7 @@ int GDALRasterBlock::TakeLock()
 
         return FALSE;
     }
+    IncrementCounter(&GDALBlockCacheCounters::nHits, 1);
     Touch();
     return TRUE;
 }
@@ -1248,7 +1826,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(&asCacheShards[nCacheShard]);
 
     return FALSE;
 }
@@ -1257,14 +1835,17 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    for( int iShard = 0; iShard < nCacheShards; ++iShard )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        for( GDALRasterBlock *poBlock = asCacheShards[iShard].poNewest;
+             poBlock != nullptr;
+             poBlock = poBlock->poNext )
+        {
+            printf("Block %d\n", iBlock);/*ok*/
+            poBlock->DumpBlock();
+            printf("\n");/*ok*/
+            iBlock++;
+        }
     }
 }
 
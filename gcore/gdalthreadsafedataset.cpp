@@ -0,0 +1,779 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Dataset that can be used concurrently from several threads
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdal_priv.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cpl_error.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "gdal.h"
+#include "gdal_proxy.h"
+
+/** A GDALThreadSafeDataset wraps a dataset opened with GDAL_OF_THREAD_SAFE.
+ *
+ * The dataset opened by GDALOpenEx() serves as a prototype, which is used to
+ * answer the metadata related requests (geotransform, SRS, metadata, GCPs,
+ * file list), under a mutex. Raster read requests are forwarded to a
+ * dataset opened on the same file, with the same open options, for each
+ * calling thread, so that they can run concurrently. Those per-thread
+ * datasets share the global block cache, and are closed when their thread
+ * exits, or when the GDALThreadSafeDataset is closed, whichever comes first.
+ */
+
+class GDALThreadSafeRasterBand;
+
+namespace
+{
+
+/** Per-thread datasets of a GDALThreadSafeDataset.
+ *
+ * This is shared between the GDALThreadSafeDataset and the threads that
+ * have a dataset in it, so that a thread that exits after the
+ * GDALThreadSafeDataset has been closed does not access freed memory.
+ */
+struct GDALThreadSafeDatasetPerThread
+{
+    const std::string osFilename;
+    std::mutex oMutex{};
+    std::map<std::thread::id, std::unique_ptr<GDALDataset>> oMapThreadDS{};
+
+    explicit GDALThreadSafeDatasetPerThread(const std::string &osFilenameIn)
+        : osFilename(osFilenameIn)
+    {
+    }
+};
+
+/** Thread-local list of the GDALThreadSafeDatasetPerThread instances in
+ * which the current thread has a dataset. They are released at thread exit.
+ */
+struct GDALThreadSafeDatasetThreadExitHolder
+{
+    const std::thread::id nThreadId = std::this_thread::get_id();
+    std::vector<std::weak_ptr<GDALThreadSafeDatasetPerThread>> apoPerThread{};
+
+    GDALThreadSafeDatasetThreadExitHolder() = default;
+    ~GDALThreadSafeDatasetThreadExitHolder();
+
+    void
+    Add(const std::shared_ptr<GDALThreadSafeDatasetPerThread> &poPerThread);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadSafeDatasetThreadExitHolder)
+};
+
+}  // namespace
+
+/* ******************************************************************** */
+/*                         GDALThreadSafeDataset                        */
+/* ******************************************************************** */
+
+class GDALThreadSafeDataset final : public GDALProxyDataset
+{
+  private:
+    friend class GDALThreadSafeRasterBand;
+
+    std::unique_ptr<GDALDataset> m_poPrototypeDS{};
+    const std::string m_osFilename;
+    const int m_nOpenFlags;
+    const CPLStringList m_aosAllowedDrivers;
+    const CPLStringList m_aosOpenOptions;
+
+    // Protects m_poPrototypeDS
+    mutable std::mutex m_oMutex{};
+    const std::shared_ptr<GDALThreadSafeDatasetPerThread> m_poPerThread;
+
+    static CPLErr ReadOnlyError();
+
+  protected:
+    GDALDataset *RefUnderlyingDataset() const override;
+
+    CPLErr IBuildOverviews(const char *, int, const int *, int, const int *,
+                           GDALProgressFunc, void *,
+                           CSLConstList papszOptions) override;
+
+  public:
+    GDALThreadSafeDataset(std::unique_ptr<GDALDataset> poPrototypeDS,
+                          const char *pszFilename, int nOpenFlagsIn,
+                          CSLConstList papszAllowedDrivers,
+                          CSLConstList papszOpenOptionsIn);
+    ~GDALThreadSafeDataset() override;
+
+    bool IsThreadSafe(int nScopeFlags) const override;
+
+    char **GetMetadataDomainList() override;
+    char **GetMetadata(const char *pszDomain) override;
+    CPLErr SetMetadata(char **papszMetadata, const char *pszDomain) override;
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
+    CPLErr SetMetadataItem(const char *pszName, const char *pszValue,
+                           const char *pszDomain) override;
+
+    CPLErr FlushCache(bool bAtClosing) override;
+
+    const OGRSpatialReference *GetSpatialRef() const override;
+    CPLErr SetSpatialRef(const OGRSpatialReference *poSRS) override;
+
+    CPLErr GetGeoTransform(double *) override;
+    CPLErr SetGeoTransform(double *) override;
+
+    void *GetInternalHandle(const char *) override;
+    GDALDriver *GetDriver() override;
+    char **GetFileList() override;
+
+    int GetGCPCount() override;
+    const OGRSpatialReference *GetGCPSpatialRef() const override;
+    const GDAL_GCP *GetGCPs() override;
+    CPLErr SetGCPs(int nGCPCount, const GDAL_GCP *pasGCPList,
+                   const OGRSpatialReference *poGCP_SRS) override;
+
+    CPLErr CreateMaskBand(int nFlags) override;
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadSafeDataset)
+};
+
+/* ******************************************************************** */
+/*                       GDALThreadSafeRasterBand                       */
+/* ******************************************************************** */
+
+class GDALThreadSafeRasterBand final : public GDALProxyRasterBand
+{
+  private:
+    GDALThreadSafeDataset *const m_poTSDS;
+    // Index of the overview of the band of the per-thread dataset, or -1
+    const int m_iOvr;
+    // Whether this is the mask band of the band of the per-thread dataset
+    const bool m_bMask;
+
+    std::vector<std::unique_ptr<GDALThreadSafeRasterBand>> m_apoOverviews{};
+    std::unique_ptr<GDALThreadSafeRasterBand> m_poMaskBand{};
+
+    static CPLErr ReadOnlyError();
+
+  protected:
+    GDALRasterBand *RefUnderlyingRasterBand(bool bForceOpen) const override;
+
+    int IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize, int nYSize,
+                               int nMaskFlagStop, double *pdfDataPct) override;
+
+  public:
+    GDALThreadSafeRasterBand(GDALThreadSafeDataset *poTSDS,
+                             GDALRasterBand *poPrototypeBand, int nBandIn,
+                             int iOvr, bool bMask);
+
+    int GetOverviewCount() override;
+    GDALRasterBand *GetOverview(int) override;
+    GDALRasterBand *GetRasterSampleOverview(GUIntBig) override;
+    GDALRasterBand *GetMaskBand() override;
+
+    CPLErr SetMetadata(char **papszMetadata, const char *pszDomain) override;
+    CPLErr SetMetadataItem(const char *pszName, const char *pszValue,
+                           const char *pszDomain) override;
+    CPLErr Fill(double dfRealValue, double dfImaginaryValue = 0) override;
+    CPLErr SetCategoryNames(char **) override;
+    CPLErr SetNoDataValue(double) override;
+    CPLErr DeleteNoDataValue() override;
+    CPLErr SetColorTable(GDALColorTable *) override;
+    CPLErr SetColorInterpretation(GDALColorInterp) override;
+    CPLErr SetOffset(double) override;
+    CPLErr SetScale(double) override;
+    CPLErr SetUnitType(const char *) override;
+    CPLErr SetStatistics(double dfMin, double dfMax, double dfMean,
+                         double dfStdDev) override;
+    CPLErr BuildOverviews(const char *, int, const int *, GDALProgressFunc,
+                          void *, CSLConstList papszOptions) override;
+    CPLErr SetDefaultHistogram(double dfMin, double dfMax, int nBuckets,
+                               GUIntBig *panHistogram) override;
+    CPLErr SetDefaultRAT(const GDALRasterAttributeTable *) override;
+    CPLErr CreateMaskBand(int nFlags) override;
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadSafeRasterBand)
+};
+
+/************************************************************************/
+/*                        GDALThreadSafeDataset()                       */
+/************************************************************************/
+
+GDALThreadSafeDataset::GDALThreadSafeDataset(
+    std::unique_ptr<GDALDataset> poPrototypeDS, const char *pszFilename,
+    int nOpenFlagsIn, CSLConstList papszAllowedDrivers,
+    CSLConstList papszOpenOptionsIn)
+    : m_poPrototypeDS(std::move(poPrototypeDS)), m_osFilename(pszFilename),
+      m_nOpenFlags(nOpenFlagsIn), m_aosAllowedDrivers(papszAllowedDrivers),
+      m_aosOpenOptions(papszOpenOptionsIn),
+      m_poPerThread(
+          std::make_shared<GDALThreadSafeDatasetPerThread>(m_osFilename))
+{
+    poDriver = m_poPrototypeDS->GetDriver();
+    eAccess = GA_ReadOnly;
+    nRasterXSize = m_poPrototypeDS->GetRasterXSize();
+    nRasterYSize = m_poPrototypeDS->GetRasterYSize();
+    SetDescription(m_poPrototypeDS->GetDescription());
+
+    for (int i = 1; i <= m_poPrototypeDS->GetRasterCount(); ++i)
+    {
+        SetBand(i, new GDALThreadSafeRasterBand(
+                       this, m_poPrototypeDS->GetRasterBand(i), i,
+                       /* iOvr = */ -1, /* bMask = */ false));
+    }
+}
+
+/************************************************************************/
+/*                       ~GDALThreadSafeDataset()                       */
+/************************************************************************/
+
+GDALThreadSafeDataset::~GDALThreadSafeDataset()
+{
+    // Destroy the bands before the datasets they forward to.
+    for (int i = 0; i < nBands; ++i)
+        delete papoBands[i];
+    CPLFree(papoBands);
+    papoBands = nullptr;
+    nBands = 0;
+}
+
+/************************************************************************/
+/*                             ReadOnlyError()                          */
+/************************************************************************/
+
+CPLErr GDALThreadSafeDataset::ReadOnlyError()
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "Dataset opened with GDAL_OF_THREAD_SAFE is read-only");
+    return CE_Failure;
+}
+
+/************************************************************************/
+/*               ~GDALThreadSafeDatasetThreadExitHolder()               */
+/************************************************************************/
+
+GDALThreadSafeDatasetThreadExitHolder::~GDALThreadSafeDatasetThreadExitHolder()
+{
+    for (const auto &poWeakPerThread : apoPerThread)
+    {
+        auto poPerThread = poWeakPerThread.lock();
+        if (!poPerThread)
+            continue;
+        std::unique_ptr<GDALDataset> poDS;
+        {
+            std::lock_guard<std::mutex> oLock(poPerThread->oMutex);
+            const auto oIter = poPerThread->oMapThreadDS.find(nThreadId);
+            if (oIter == poPerThread->oMapThreadDS.end())
+                continue;
+            poDS = std::move(oIter->second);
+            poPerThread->oMapThreadDS.erase(oIter);
+        }
+        CPLDebug("GDAL", "Thread exit: closing its dataset on %s",
+                 poPerThread->osFilename.c_str());
+        // Close the dataset outside of the lock.
+        poDS.reset();
+    }
+}
+
+/************************************************************************/
+/*                                Add()                                 */
+/************************************************************************/
+
+void GDALThreadSafeDatasetThreadExitHolder::Add(
+    const std::shared_ptr<GDALThreadSafeDatasetPerThread> &poPerThread)
+{
+    // Forget about GDALThreadSafeDataset that have been closed meanwhile.
+    apoPerThread.erase(
+        std::remove_if(apoPerThread.begin(), apoPerThread.end(),
+                       [](const std::weak_ptr<GDALThreadSafeDatasetPerThread>
+                              &poWeakPerThread)
+                       { return poWeakPerThread.expired(); }),
+        apoPerThread.end());
+    apoPerThread.push_back(poPerThread);
+}
+
+/************************************************************************/
+/*                         GetThreadExitHolder()                        */
+/************************************************************************/
+
+#ifdef _WIN32
+// Currently thread_local and C++ objects don't work well with DLL on Windows
+static void FreeThreadExitHolder(void *pData)
+{
+    delete static_cast<GDALThreadSafeDatasetThreadExitHolder *>(pData);
+}
+
+static GDALThreadSafeDatasetThreadExitHolder &GetThreadExitHolder()
+{
+    static GDALThreadSafeDatasetThreadExitHolder dummy;
+    int bMemoryErrorOccurred = false;
+    void *pData =
+        CPLGetTLSEx(CTLS_THREADSAFEDATASET_EXIT, &bMemoryErrorOccurred);
+    if (bMemoryErrorOccurred)
+    {
+        return dummy;
+    }
+    if (pData == nullptr)
+    {
+        auto poHolder = new GDALThreadSafeDatasetThreadExitHolder();
+        CPLSetTLSWithFreeFuncEx(CTLS_THREADSAFEDATASET_EXIT, poHolder,
+                                FreeThreadExitHolder, &bMemoryErrorOccurred);
+        if (bMemoryErrorOccurred)
+        {
+            delete poHolder;
+            return dummy;
+        }
+        return *poHolder;
+    }
+    return *static_cast<GDALThreadSafeDatasetThreadExitHolder *>(pData);
+}
+#else
+static thread_local GDALThreadSafeDatasetThreadExitHolder g_tls_exitHolder;
+
+static GDALThreadSafeDatasetThreadExitHolder &GetThreadExitHolder()
+{
+    return g_tls_exitHolder;
+}
+#endif
+
+/************************************************************************/
+/*                         RefUnderlyingDataset()                       */
+/************************************************************************/
+
+GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
+{
+    const auto nThreadId = std::this_thread::get_id();
+    {
+        std::lock_guard<std::mutex> oLock(m_poPerThread->oMutex);
+        const auto oIter = m_poPerThread->oMapThreadDS.find(nThreadId);
+        if (oIter != m_poPerThread->oMapThreadDS.end())
+            return oIter->second.get();
+    }
+
+    // Open the dataset for this thread outside of the lock, as this can
+    // take some time.
+    std::unique_ptr<GDALDataset> poDS(GDALDataset::Open(
+        m_osFilename.c_str(), m_nOpenFlags | GDAL_OF_INTERNAL,
+        m_aosAllowedDrivers.List(), m_aosOpenOptions.List()));
+    if (!poDS)
+        return nullptr;
+    if (poDS->GetRasterXSize() != nRasterXSize ||
+        poDS->GetRasterYSize() != nRasterYSize ||
+        poDS->GetRasterCount() != nBands)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Dataset %s opened from thread has not the same "
+                 "characteristics as when initially opened",
+                 m_osFilename.c_str());
+        return nullptr;
+    }
+
+    GDALDataset *poRet = nullptr;
+    {
+        std::lock_guard<std::mutex> oLock(m_poPerThread->oMutex);
+        poRet = m_poPerThread->oMapThreadDS.emplace(nThreadId, std::move(poDS))
+                    .first->second.get();
+    }
+    GetThreadExitHolder().Add(m_poPerThread);
+    return poRet;
+}
+
+/************************************************************************/
+/*                            IsThreadSafe()                            */
+/************************************************************************/
+
+bool GDALThreadSafeDataset::IsThreadSafe(int nScopeFlags) const
+{
+    return nScopeFlags == GDAL_OF_RASTER;
+}
+
+/************************************************************************/
+/*                       Metadata related methods                       */
+/************************************************************************/
+
+char **GDALThreadSafeDataset::GetMetadataDomainList()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return m_poPrototypeDS->GetMetadataDomainList();
+}
+
+char **GDALThreadSafeDataset::GetMetadata(const char *pszDomain)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return m_poPrototypeDS->GetMetadata(pszDomain);
+}
+
+const char *GDALThreadSafeDataset::GetMetadataItem(const char *pszName,
+                                                   const char *pszDomain)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return m_poPrototypeDS->GetMetadataItem(pszName, pszDomain);
+}
+
+const OGRSpatialReference *GDALThreadSafeDataset::GetSpatialRef() const
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return m_poPrototypeDS->GetSpatialRef();
+}
+
+CPLErr GDALThreadSafeDataset::GetGeoTransform(double *padfGeoTransform)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return m_poPrototypeDS->GetGeoTransform(padfGeoTransform);
+}
+
+GDALDriver *GDALThreadSafeDataset::GetDriver()
+{
+    return poDriver;
+}
+
+char **GDALThreadSafeDataset::GetFileList()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return m_poPrototypeDS->GetFileList();
+}
+
+int GDALThreadSafeDataset::GetGCPCount()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return m_poPrototypeDS->GetGCPCount();
+}
+
+const OGRSpatialReference *GDALThreadSafeDataset::GetGCPSpatialRef() const
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return m_poPrototypeDS->GetGCPSpatialRef();
+}
+
+const GDAL_GCP *GDALThreadSafeDataset::GetGCPs()
+{
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    return m_poPrototypeDS->GetGCPs();
+}
+
+void *GDALThreadSafeDataset::GetInternalHandle(const char *)
+{
+    // The handles of the per-thread datasets are not meant to be exposed.
+    return nullptr;
+}
+
+CPLErr GDALThreadSafeDataset::FlushCache(bool)
+{
+    // Nothing to write, and the per-thread datasets may be in use.
+    return CE_None;
+}
+
+/************************************************************************/
+/*                      Modification related methods                    */
+/************************************************************************/
+
+CPLErr GDALThreadSafeDataset::SetMetadata(char **, const char *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::SetMetadataItem(const char *, const char *,
+                                              const char *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::SetSpatialRef(const OGRSpatialReference *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::SetGeoTransform(double *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::SetGCPs(int, const GDAL_GCP *,
+                                      const OGRSpatialReference *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::CreateMaskBand(int)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeDataset::IBuildOverviews(const char *, int, const int *,
+                                              int, const int *,
+                                              GDALProgressFunc, void *,
+                                              CSLConstList)
+{
+    return ReadOnlyError();
+}
+
+/************************************************************************/
+/*                      GDALThreadSafeRasterBand()                      */
+/************************************************************************/
+
+GDALThreadSafeRasterBand::GDALThreadSafeRasterBand(
+    GDALThreadSafeDataset *poTSDS, GDALRasterBand *poPrototypeBand,
+    int nBandIn, int iOvr, bool bMask)
+    : m_poTSDS(poTSDS), m_iOvr(iOvr), m_bMask(bMask)
+{
+    // Overview and mask bands are not attached to the dataset, as with
+    // most drivers.
+    if (iOvr < 0 && !bMask)
+        poDS = poTSDS;
+    nBand = nBandIn;
+    eAccess = GA_ReadOnly;
+    eDataType = poPrototypeBand->GetRasterDataType();
+    nRasterXSize = poPrototypeBand->GetXSize();
+    nRasterYSize = poPrototypeBand->GetYSize();
+    poPrototypeBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+
+    if (iOvr < 0 && !bMask)
+    {
+        const int nOvrCount = poPrototypeBand->GetOverviewCount();
+        for (int i = 0; i < nOvrCount; ++i)
+        {
+            auto poOvrBand = poPrototypeBand->GetOverview(i);
+            if (!poOvrBand)
+                break;
+            m_apoOverviews.push_back(std::make_unique<GDALThreadSafeRasterBand>(
+                poTSDS, poOvrBand, nBandIn, i, /* bMask = */ false));
+        }
+        m_poMaskBand = std::make_unique<GDALThreadSafeRasterBand>(
+            poTSDS, poPrototypeBand->GetMaskBand(), nBandIn,
+            /* iOvr = */ -1, /* bMask = */ true);
+    }
+
+    // Initialize the block cache of this band now, as ReadBlock() would
+    // otherwise do it lazily, in a non thread-safe way.
+    InitBlockInfo();
+}
+
+/************************************************************************/
+/*                             ReadOnlyError()                          */
+/************************************************************************/
+
+CPLErr GDALThreadSafeRasterBand::ReadOnlyError()
+{
+    return GDALThreadSafeDataset::ReadOnlyError();
+}
+
+/************************************************************************/
+/*                       RefUnderlyingRasterBand()                      */
+/************************************************************************/
+
+GDALRasterBand *
+GDALThreadSafeRasterBand::RefUnderlyingRasterBand(bool /*bForceOpen*/) const
+{
+    GDALDataset *poThreadDS = m_poTSDS->RefUnderlyingDataset();
+    if (!poThreadDS)
+        return nullptr;
+    GDALRasterBand *poBand = poThreadDS->GetRasterBand(nBand);
+    if (poBand && m_iOvr >= 0)
+        poBand = poBand->GetOverview(m_iOvr);
+    else if (poBand && m_bMask)
+        poBand = poBand->GetMaskBand();
+    return poBand;
+}
+
+/************************************************************************/
+/*                       IGetDataCoverageStatus()                       */
+/************************************************************************/
+
+int GDALThreadSafeRasterBand::IGetDataCoverageStatus(int nXOff, int nYOff,
+                                                     int nXSize, int nYSize,
+                                                     int nMaskFlagStop,
+                                                     double *pdfDataPct)
+{
+    GDALRasterBand *poBand = RefUnderlyingRasterBand(true);
+    if (!poBand)
+    {
+        return GDALRasterBand::IGetDataCoverageStatus(
+            nXOff, nYOff, nXSize, nYSize, nMaskFlagStop, pdfDataPct);
+    }
+    return poBand->GetDataCoverageStatus(nXOff, nYOff, nXSize, nYSize,
+                                         nMaskFlagStop, pdfDataPct);
+}
+
+/************************************************************************/
+/*                      Overview and mask methods                       */
+/************************************************************************/
+
+int GDALThreadSafeRasterBand::GetOverviewCount()
+{
+    if (m_iOvr >= 0 || m_bMask)
+        return GDALProxyRasterBand::GetOverviewCount();
+    return static_cast<int>(m_apoOverviews.size());
+}
+
+GDALRasterBand *GDALThreadSafeRasterBand::GetOverview(int iOvr)
+{
+    // Overviews of overview or mask bands are those of the per-thread
+    // dataset, and can only be used from the calling thread.
+    if (m_iOvr >= 0 || m_bMask)
+        return GDALProxyRasterBand::GetOverview(iOvr);
+    if (iOvr < 0 || iOvr >= static_cast<int>(m_apoOverviews.size()))
+        return nullptr;
+    return m_apoOverviews[iOvr].get();
+}
+
+GDALRasterBand *
+GDALThreadSafeRasterBand::GetRasterSampleOverview(GUIntBig nDesiredSamples)
+{
+    // Use the generic implementation, that relies on GetOverview()
+    return GDALRasterBand::GetRasterSampleOverview(nDesiredSamples);
+}
+
+GDALRasterBand *GDALThreadSafeRasterBand::GetMaskBand()
+{
+    if (m_poMaskBand)
+        return m_poMaskBand.get();
+    return GDALProxyRasterBand::GetMaskBand();
+}
+
+/************************************************************************/
+/*                      Modification related methods                    */
+/************************************************************************/
+
+CPLErr GDALThreadSafeRasterBand::SetMetadata(char **, const char *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetMetadataItem(const char *, const char *,
+                                                 const char *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::Fill(double, double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetCategoryNames(char **)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetNoDataValue(double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::DeleteNoDataValue()
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetColorTable(GDALColorTable *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetColorInterpretation(GDALColorInterp)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetOffset(double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetScale(double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetUnitType(const char *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetStatistics(double, double, double, double)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::BuildOverviews(const char *, int, const int *,
+                                                GDALProgressFunc, void *,
+                                                CSLConstList)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetDefaultHistogram(double, double, int,
+                                                     GUIntBig *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::SetDefaultRAT(const GDALRasterAttributeTable *)
+{
+    return ReadOnlyError();
+}
+
+CPLErr GDALThreadSafeRasterBand::CreateMaskBand(int)
+{
+    return ReadOnlyError();
+}
+
+/************************************************************************/
+/*                     GDALCreateThreadSafeDataset()                    */
+/************************************************************************/
+
+/** Create a thread-safe dataset from a regular one.
+ *
+ * @param poPrototypeDS Dataset opened with GDALOpenEx() with nOpenFlags.
+ * @param pszFilename Filename passed to GDALOpenEx()
+ * @param nOpenFlags Open flags passed to GDALOpenEx(), without
+ * GDAL_OF_THREAD_SAFE.
+ * @param papszAllowedDrivers Allowed drivers passed to GDALOpenEx()
+ * @param papszOpenOptions Open options passed to GDALOpenEx()
+ * @return a new dataset, or nullptr in case of error.
+ */
+std::unique_ptr<GDALDataset>
+GDALCreateThreadSafeDataset(std::unique_ptr<GDALDataset> poPrototypeDS,
+                            const char *pszFilename, int nOpenFlags,
+                            CSLConstList papszAllowedDrivers,
+                            CSLConstList papszOpenOptions)
+{
+    if (poPrototypeDS->GetRasterCount() == 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GDAL_OF_THREAD_SAFE is only supported on datasets with "
+                 "raster bands");
+        return nullptr;
+    }
+    return std::make_unique<GDALThreadSafeDataset>(
+        std::move(poPrototypeDS), pszFilename, nOpenFlags, papszAllowedDrivers,
+        papszOpenOptions);
+}
@@ -42,15 +42,22 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <type_traits>
 #include <vector>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_thread_pool.h"
 #include "gdalwarper.h"
+#include "memdataset.h"
+#include "overview_avx2.h"
 
 // Restrict to 64bit processors because they are guaranteed to have SSE2,
 // or if __AVX2__ is defined.
@@ -2092,6 +2099,9 @@ static CPLErr GDALResampleChunk_Mode_T(
     const int nChunkRightXOff = nChunkXOff + nChunkXSize;
     const int nChunkBottomYOff = nChunkYOff + nChunkYSize;
     std::vector<int> anVals(256, 0);
+    // Counters indexed by pixel value, for the generic case of Byte and
+    // UInt16 data.
+    std::vector<int> anCounters;
 
     /* ==================================================================== */
     /*      Loop over destination scanlines.                                */
@@ -2192,6 +2202,82 @@ static CPLErr GDALResampleChunk_Mode_T(
                 const size_t nNumPx =
                     static_cast<size_t>(nSrcYOff2 - nSrcYOff) *
                     static_cast<size_t>(nSrcXOff2 - nSrcXOff);
+
+                if constexpr (std::is_same<T, GByte>::value ||
+                              std::is_same<T, GUInt16>::value)
+                {
+                    // The values are within a small range, so use an array of
+                    // counters indexed by them, that is reset after use, rather
+                    // than the linear search of the general case, which is
+                    // very slow for large downsampling factors. This selects
+                    // the same value as the general case.
+                    if (anCounters.empty())
+                    {
+                        try
+                        {
+                            anCounters.resize(
+                                static_cast<size_t>(
+                                    std::numeric_limits<T>::max()) +
+                                1);
+                        }
+                        catch (const std::exception &)
+                        {
+                            CPLError(CE_Failure, CPLE_OutOfMemory,
+                                     "Out of memory in mode resampling");
+                            CPLFree(padfVals);
+                            CPLFree(panSums);
+                            return CE_Failure;
+                        }
+                    }
+
+                    int nMaxCount = 0;
+                    int nMaxVal = -1;
+                    for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                    {
+                        const GPtrDiff_t iTotYOff =
+                            static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                nChunkXSize -
+                            nChunkXOff;
+                        for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                        {
+                            if (pabySrcScanlineNodataMask == nullptr ||
+                                pabySrcScanlineNodataMask[iX + iTotYOff])
+                            {
+                                const int nVal = paSrcScanline[iX + iTotYOff];
+                                if (++anCounters[nVal] > nMaxCount)
+                                {
+                                    nMaxCount = anCounters[nVal];
+                                    nMaxVal = nVal;
+                                }
+                            }
+                        }
+                    }
+
+                    if (nMaxVal < 0)
+                        paDstScanline[iDstPixel - nDstXOff] = tNoDataValue;
+                    else
+                        paDstScanline[iDstPixel - nDstXOff] =
+                            static_cast<T>(nMaxVal);
+
+                    if (nNumPx < anCounters.size())
+                    {
+                        for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                        {
+                            const GPtrDiff_t iTotYOff =
+                                static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                    nChunkXSize -
+                                nChunkXOff;
+                            for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                                anCounters[paSrcScanline[iX + iTotYOff]] = 0;
+                        }
+                    }
+                    else
+                    {
+                        std::fill(anCounters.begin(), anCounters.end(), 0);
+                    }
+                    continue;
+                }
+
                 size_t iMaxInd = 0;
                 size_t iMaxVal = 0;
                 bool biMaxValdValid = false;
@@ -2268,11 +2354,6 @@ static CPLErr GDALResampleChunk_Mode_T(
                 int nMaxVal = 0;
                 int iMaxInd = -1;
 
-                // The cost of this zeroing might be high. Perhaps we should
-                // just use the above generic case, and go to this one if the
-                // number of source pixels is large enough
-                std::fill(anVals.begin(), anVals.end(), 0);
-
                 for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
                 {
                     const GPtrDiff_t iTotYOff =
@@ -2300,6 +2381,28 @@ static CPLErr GDALResampleChunk_Mode_T(
                 else
                     paDstScanline[iDstPixel - nDstXOff] =
                         static_cast<T>(iMaxInd);
+
+                // Reset the counters for the next pixel: only the ones that
+                // have been incremented for small windows, or all of them.
+                if (static_cast<size_t>(nSrcYOff2 - nSrcYOff) *
+                        (nSrcXOff2 - nSrcXOff) <
+                    anVals.size())
+                {
+                    for (int iY = nSrcYOff; iY < nSrcYOff2; ++iY)
+                    {
+                        const GPtrDiff_t iTotYOff =
+                            static_cast<GPtrDiff_t>(iY - nSrcYOff) *
+                                nChunkXSize -
+                            nChunkXOff;
+                        for (int iX = nSrcXOff; iX < nSrcXOff2; ++iX)
+                            anVals[static_cast<int>(
+                                paSrcScanline[iX + iTotYOff])] = 0;
+                    }
+                }
+                else
+                {
+                    std::fill(anVals.begin(), anVals.end(), 0);
+                }
             }
         }
     }
@@ -3127,6 +3230,14 @@ static CPLErr GDALResampleChunk_ConvolutionT(
     const int nChunkRightXOff = nChunkXOff + nChunkXSize;
 #ifdef USE_SSE2
     bool bSrcPixelCountLess8 = dfXScaledRadius < 4;
+#endif
+#ifdef HAVE_GDAL_CONVOLUTION_AVX2
+    // Contrary to CPLHaveRuntimeAVX2(), GDAL_USE_AVX2 is also honoured here
+    // in non-DEBUG builds, so that the AVX2 kernels can be checked against
+    // the generic ones. This is only evaluated once per chunk.
+    const bool bUseAVX2 =
+        CPLHaveRuntimeAVX2() &&
+        CPLTestBool(CPLGetConfigOption("GDAL_USE_AVX2", "YES"));
 #endif
     for (int iDstPixel = nDstXOff; iDstPixel < nDstXOff2; ++iDstPixel)
     {
@@ -3186,6 +3297,21 @@ static CPLErr GDALResampleChunk_ConvolutionT(
                     padfWeights[i] *= dfInvWeightSum;
             }
             int iSrcLineOff = 0;
+#ifdef HAVE_GDAL_CONVOLUTION_AVX2
+            if constexpr (std::is_same<T, GByte>::value ||
+                          std::is_same<T, GUInt16>::value)
+            {
+                if (bUseAVX2)
+                {
+                    GDALResampleConvolutionHorizontalRows_AVX2(
+                        pChunk + (nSrcPixelStart - nChunkXOff), nChunkXSize,
+                        nHeight, padfWeights, nSrcPixelCount,
+                        padfHorizontalFiltered + iDstPixel - nDstXOff,
+                        nDstXSize);
+                    iSrcLineOff = nHeight;
+                }
+            }
+#endif
 #ifdef USE_SSE2
             if (nSrcPixelCount == 4)
             {
@@ -3414,6 +3540,23 @@ static CPLErr GDALResampleChunk_ConvolutionT(
 #ifdef USE_SSE2
             if constexpr (eWrkDataType == GDT_Float32)
             {
+#ifdef HAVE_GDAL_CONVOLUTION_AVX2
+                if (bUseAVX2)
+                {
+                    iFilteredPixelOff = GDALResampleConvolutionVertical_AVX2(
+                        padfHorizontalFiltered + j, nDstXSize, padfWeights,
+                        nSrcLineCount, pafDstScanline, nDstXSize);
+                    j += iFilteredPixelOff;
+                    if (bHasNoData)
+                    {
+                        for (int k = 0; k < iFilteredPixelOff; k++)
+                        {
+                            pafDstScanline[k] =
+                                replaceValIfNodata(pafDstScanline[k]);
+                        }
+                    }
+                }
+#endif
 #ifdef __AVX__
                 for (; iFilteredPixelOff + 15 < nDstXSize;
                      iFilteredPixelOff += 16, j += 16)
@@ -4233,6 +4376,13 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
     if (EQUAL(pszResampling, "NONE"))
         return CE_None;
 
+    CPLTraceSpan oTraceSpan("overview", "GDALRegenerateOverviewsEx");
+    if (oTraceSpan.IsEnabled())
+    {
+        oTraceSpan.AddArg("resampling", pszResampling);
+        oTraceSpan.AddArg("overview_count", nOverviewCount);
+    }
+
     int nKernelRadius = 0;
     GDALResampleFunction pfnResampleFn =
         GDALGetResampleFunction(pszResampling, &nKernelRadius);
@@ -4429,7 +4579,7 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
         CPLTestBool(CPLGetConfigOption("GDAL_OVR_PROPAGATE_NODATA", "NO"));
 
     // Structure describing a resampling job
-    struct OvrJob
+    struct OvrJob : public GDALPendingJob
     {
         // Buffers to free when job is finished
         std::shared_ptr<PointerHolder> oSrcMaskBufferHolder{};
@@ -4463,11 +4613,6 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
         void *pDstBuffer = nullptr;
         GDALDataType eDstBufferDataType = GDT_Unknown;
 
-        // Synchronization
-        bool bFinished = false;
-        std::mutex mutex{};
-        std::condition_variable cv{};
-
         void SetSrcMaskBufferHolder(
             const std::shared_ptr<PointerHolder> &oSrcMaskBufferHolderIn)
         {
@@ -4511,16 +4656,14 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
         poJob->oDstBufferHolder =
             std::make_unique<PointerHolder>(poJob->pDstBuffer);
 
-        {
-            std::lock_guard<std::mutex> guard(poJob->mutex);
-            poJob->bFinished = true;
-            poJob->cv.notify_one();
-        }
+        poJob->MarkFinished();
     };
 
-    // Function to write resample data to target band
-    const auto WriteJobData = [](const OvrJob *poJob)
+    // Function to write resample data of a finished job to target band
+    const auto FinalizeJob = [](const OvrJob *poJob)
     {
+        if (poJob->eErr != CE_None)
+            return poJob->eErr;
         return poJob->poDstBand->RasterIO(
             GF_Write, 0, poJob->nDstYOff, poJob->nDstWidth,
             poJob->nDstYOff2 - poJob->nDstYOff, poJob->pDstBuffer,
@@ -4528,31 +4671,8 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
             poJob->eDstBufferDataType, 0, 0, nullptr);
     };
 
-    // Wait for completion of oldest job and serialize it
-    const auto WaitAndFinalizeOldestJob =
-        [WriteJobData](std::list<std::unique_ptr<OvrJob>> &jobList)
-    {
-        auto poOldestJob = jobList.front().get();
-        {
-            std::unique_lock<std::mutex> oGuard(poOldestJob->mutex);
-            // coverity[missing_lock:FALSE]
-            while (!poOldestJob->bFinished)
-            {
-                poOldestJob->cv.wait(oGuard);
-            }
-        }
-        CPLErr l_eErr = poOldestJob->eErr;
-        if (l_eErr == CE_None)
-        {
-            l_eErr = WriteJobData(poOldestJob);
-        }
-
-        jobList.pop_front();
-        return l_eErr;
-    };
-
     // Queue of jobs
-    std::list<std::unique_ptr<OvrJob>> jobList;
+    GDALPendingJobList<OvrJob> jobList;
 
     GByte *pabyChunkNodataMask = nullptr;
     void *pChunk = nullptr;
@@ -4596,33 +4716,13 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
         if (nChunkYOffQueried + nChunkYSizeQueried > nHeight)
             nChunkYSizeQueried = nHeight - nChunkYOffQueried;
 
-        // Avoid accumulating too many tasks and exhaust RAM
-        // Try to complete already finished jobs
-        while (eErr == CE_None && !jobList.empty())
-        {
-            auto poOldestJob = jobList.front().get();
-            {
-                std::lock_guard<std::mutex> oGuard(poOldestJob->mutex);
-                if (!poOldestJob->bFinished)
-                {
-                    break;
-                }
-            }
-            eErr = poOldestJob->eErr;
-            if (eErr == CE_None)
-            {
-                eErr = WriteJobData(poOldestJob);
-            }
-
-            jobList.pop_front();
-        }
-
-        // And in case we have saturated the number of threads,
-        // wait for completion of tasks to go below the threshold.
-        while (eErr == CE_None &&
-               jobList.size() >= static_cast<size_t>(nThreads))
+        // Avoid accumulating too many tasks and exhaust RAM: complete
+        // already finished jobs, and in case we have saturated the number of
+        // threads, wait for completion of tasks to go below the threshold.
+        if (eErr == CE_None)
         {
-            eErr = WaitAndFinalizeOldestJob(jobList);
+            eErr = jobList.FinalizeFinishedJobs(static_cast<size_t>(nThreads),
+                                                FinalizeJob);
         }
 
         // (Re)allocate buffers if needed
@@ -4838,17 +4938,13 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
             {
                 poJob->SetSrcMaskBufferHolder(oSrcMaskBufferHolder);
                 poJob->SetSrcBufferHolder(oSrcBufferHolder);
-                poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
-                jobList.emplace_back(std::move(poJob));
+                jobList.Submit(poJobQueue.get(), JobResampleFunc,
+                               std::move(poJob));
             }
             else
             {
                 JobResampleFunc(poJob.get());
-                eErr = poJob->eErr;
-                if (eErr == CE_None)
-                {
-                    eErr = WriteJobData(poJob.get());
-                }
+                eErr = FinalizeJob(poJob.get());
             }
         }
 
@@ -4863,12 +4959,9 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
     VSIFree(pabyChunkNodataMask);
 
     // Wait for all pending jobs to complete
-    while (!jobList.empty())
-    {
-        const auto l_eErr = WaitAndFinalizeOldestJob(jobList);
-        if (l_eErr != CE_None && eErr == CE_None)
-            eErr = l_eErr;
-    }
+    const CPLErr eJobsErr = jobList.FinalizeAllJobs(FinalizeJob);
+    if (eErr == CE_None)
+        eErr = eJobsErr;
 
     /* -------------------------------------------------------------------- */
     /*      Renormalized overview mean / stddev if needed.                  */
@@ -4896,6 +4989,106 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
     return eErr;
 }
 
+/************************************************************************/
+/*                       GDALOvrGetDirtyChunks()                        */
+/************************************************************************/
+
+// Return the bitmap of the chunks, of nDstChunkXSize x nDstChunkYSize pixels,
+// of an overview level of nDstWidth x nDstHeight pixels, that are affected
+// by the modification of the windows aoSrcRegions of its source, of
+// nSrcWidth x nSrcHeight pixels. nMargin is the number of overview pixels
+// around a modified area that the resampling kernel reaches.
+
+static std::vector<bool>
+GDALOvrGetDirtyChunks(const std::vector<GDALRasterWindow> &aoSrcRegions,
+                      int nSrcWidth, int nSrcHeight, int nDstWidth,
+                      int nDstHeight, int nDstChunkXSize, int nDstChunkYSize,
+                      int nMargin)
+{
+    const int nChunksX = DIV_ROUND_UP(nDstWidth, nDstChunkXSize);
+    const int nChunksY = DIV_ROUND_UP(nDstHeight, nDstChunkYSize);
+    std::vector<bool> abDirty(static_cast<size_t>(nChunksX) * nChunksY);
+
+    constexpr double EPS = 1e-8;
+    const double dfXRatioSrcToDst = static_cast<double>(nDstWidth) / nSrcWidth;
+    const double dfYRatioSrcToDst =
+        static_cast<double>(nDstHeight) / nSrcHeight;
+    for (const auto &oRegion : aoSrcRegions)
+    {
+        const int nDstXOff = std::max(
+            0, static_cast<int>(oRegion.nXOff * dfXRatioSrcToDst + EPS) -
+                   nMargin);
+        const int nDstYOff = std::max(
+            0, static_cast<int>(oRegion.nYOff * dfYRatioSrcToDst + EPS) -
+                   nMargin);
+        const int nDstXEnd = static_cast<int>(std::min<double>(
+            nDstWidth,
+            std::ceil(static_cast<double>(oRegion.nXOff + oRegion.nXSize) *
+                          dfXRatioSrcToDst -
+                      EPS) +
+                nMargin));
+        const int nDstYEnd = static_cast<int>(std::min<double>(
+            nDstHeight,
+            std::ceil(static_cast<double>(oRegion.nYOff + oRegion.nYSize) *
+                          dfYRatioSrcToDst -
+                      EPS) +
+                nMargin));
+        if (nDstXOff >= nDstXEnd || nDstYOff >= nDstYEnd)
+            continue;
+
+        for (int iY = nDstYOff / nDstChunkYSize;
+             iY <= (nDstYEnd - 1) / nDstChunkYSize; ++iY)
+        {
+            for (int iX = nDstXOff / nDstChunkXSize;
+                 iX <= (nDstXEnd - 1) / nDstChunkXSize; ++iX)
+            {
+                abDirty[static_cast<size_t>(iY) * nChunksX + iX] = true;
+            }
+        }
+    }
+    return abDirty;
+}
+
+/************************************************************************/
+/*                    GDALOvrDirtyChunksToWindows()                     */
+/************************************************************************/
+
+// Convert a bitmap returned by GDALOvrGetDirtyChunks() to a list of windows,
+// one per run of consecutive dirty chunks of a chunk row.
+
+static std::vector<GDALRasterWindow>
+GDALOvrDirtyChunksToWindows(const std::vector<bool> &abDirty, int nWidth,
+                            int nHeight, int nChunkXSize, int nChunkYSize)
+{
+    std::vector<GDALRasterWindow> aoWindows;
+    const int nChunksX = DIV_ROUND_UP(nWidth, nChunkXSize);
+    const int nChunksY = DIV_ROUND_UP(nHeight, nChunkYSize);
+    for (int iY = 0; iY < nChunksY; ++iY)
+    {
+        for (int iX = 0; iX < nChunksX;)
+        {
+            if (!abDirty[static_cast<size_t>(iY) * nChunksX + iX])
+            {
+                ++iX;
+                continue;
+            }
+            const int iXStart = iX;
+            while (iX < nChunksX &&
+                   abDirty[static_cast<size_t>(iY) * nChunksX + iX])
+                ++iX;
+            GDALRasterWindow oWindow;
+            oWindow.nXOff = iXStart * nChunkXSize;
+            oWindow.nYOff = iY * nChunkYSize;
+            oWindow.nXSize =
+                std::min(iX * nChunkXSize, nWidth) - oWindow.nXOff;
+            oWindow.nYSize =
+                std::min((iY + 1) * nChunkYSize, nHeight) - oWindow.nYOff;
+            aoWindows.push_back(oWindow);
+        }
+    }
+    return aoWindows;
+}
+
 /************************************************************************/
 /*            GDALRegenerateOverviewsMultiBand()                        */
 /************************************************************************/
@@ -4951,6 +5144,13 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
  *                     options can be specified to express that overviews should
  *                     be regenerated only in the specified subset of the source
  *                     dataset.
+ *                     Starting with GDAL 3.10, the DIRTY_REGIONS option can be
+ *                     set to a list of windows of the source dataset, formatted
+ *                     as "xoff,yoff,xsize,ysize;xoff,yoff,xsize,ysize;...", to
+ *                     only recompute the overview blocks affected by the
+ *                     modification of those windows (see
+ *                     GDALDataset::GetDirtyRegions()). It is mutually exclusive
+ *                     with the XOFF, YOFF, XSIZE and YSIZE options.
  * @return CE_None on success or CE_Failure on failure.
  */
 
@@ -4968,6 +5168,14 @@ CPLErr GDALRegenerateOverviewsMultiBand(
     if (EQUAL(pszResampling, "NONE"))
         return CE_None;
 
+    CPLTraceSpan oTraceSpan("overview", "GDALRegenerateOverviewsMultiBand");
+    if (oTraceSpan.IsEnabled())
+    {
+        oTraceSpan.AddArg("resampling", pszResampling);
+        oTraceSpan.AddArg("band_count", nBands);
+        oTraceSpan.AddArg("overview_count", nOverviews);
+    }
+
     // Sanity checks.
     if (!STARTS_WITH_CI(pszResampling, "NEAR") &&
         !EQUAL(pszResampling, "RMS") && !EQUAL(pszResampling, "AVERAGE") &&
@@ -5043,6 +5251,34 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         }
     }
 
+    // Incremental mode: only the overview blocks affected by the
+    // modification of a list of windows of the source are recomputed.
+    const char *pszDirtyRegions =
+        CSLFetchNameValue(papszOptions, "DIRTY_REGIONS");
+    const bool bDirtyRegionsMode = pszDirtyRegions != nullptr;
+    std::vector<GDALRasterWindow> aoDirtyRegions;
+    if (bDirtyRegionsMode)
+    {
+        if (CSLFetchNameValue(papszOptions, "XOFF") ||
+            CSLFetchNameValue(papszOptions, "YOFF") ||
+            CSLFetchNameValue(papszOptions, "XSIZE") ||
+            CSLFetchNameValue(papszOptions, "YSIZE"))
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "GDALRegenerateOverviewsMultiBand: DIRTY_REGIONS is "
+                     "mutually exclusive with XOFF, YOFF, XSIZE and YSIZE");
+            return CE_Failure;
+        }
+        if (!GDALParseRasterWindows(pszDirtyRegions, aoDirtyRegions))
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "GDALRegenerateOverviewsMultiBand: invalid value for "
+                     "DIRTY_REGIONS: %s",
+                     pszDirtyRegions);
+            return CE_Failure;
+        }
+    }
+
     // First pass to compute the total number of pixels to write.
     double dfTotalPixelCount = 0;
     const int nSrcXOff = atoi(CSLFetchNameValueDef(papszOptions, "XOFF", "0"));
@@ -5051,13 +5287,81 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         papszOptions, "XSIZE", CPLSPrintf("%d", nToplevelSrcWidth)));
     const int nSrcYSize = atoi(CSLFetchNameValueDef(
         papszOptions, "YSIZE", CPLSPrintf("%d", nToplevelSrcHeight)));
+    // In incremental mode, bitmap of the blocks to recompute for each level.
+    std::vector<std::vector<bool>> aabDirtyChunks;
     for (int iOverview = 0; iOverview < nOverviews; ++iOverview)
     {
-        dfTotalPixelCount +=
-            static_cast<double>(nSrcXSize) / nToplevelSrcWidth *
-            papapoOverviewBands[0][iOverview]->GetXSize() *
-            static_cast<double>(nSrcYSize) / nToplevelSrcHeight *
-            papapoOverviewBands[0][iOverview]->GetYSize();
+        if (!bDirtyRegionsMode)
+        {
+            dfTotalPixelCount +=
+                static_cast<double>(nSrcXSize) / nToplevelSrcWidth *
+                papapoOverviewBands[0][iOverview]->GetXSize() *
+                static_cast<double>(nSrcYSize) / nToplevelSrcHeight *
+                papapoOverviewBands[0][iOverview]->GetYSize();
+            continue;
+        }
+
+        auto poOvrBand = papapoOverviewBands[0][iOverview];
+        const int nDstWidth = poOvrBand->GetXSize();
+        const int nDstHeight = poOvrBand->GetYSize();
+        int nDstChunkXSize = 0;
+        int nDstChunkYSize = 0;
+        poOvrBand->GetBlockSize(&nDstChunkXSize, &nDstChunkYSize);
+        nDstChunkXSize = std::min(nDstChunkXSize, nDstWidth);
+        nDstChunkYSize = std::min(nDstChunkYSize, nDstHeight);
+
+        // Same logic as in the second pass to select the source level. If
+        // it is the previous overview level, the modified windows of the
+        // source are the blocks that have been recomputed in that level.
+        int nMargin = nKernelRadius + 1;
+        if (iOverview > 0 &&
+            papapoOverviewBands[0][iOverview - 1]->GetXSize() > nDstWidth)
+        {
+            auto poPrevOvrBand = papapoOverviewBands[0][iOverview - 1];
+            int nPrevChunkXSize = 0;
+            int nPrevChunkYSize = 0;
+            poPrevOvrBand->GetBlockSize(&nPrevChunkXSize, &nPrevChunkYSize);
+            nPrevChunkXSize =
+                std::min(nPrevChunkXSize, poPrevOvrBand->GetXSize());
+            nPrevChunkYSize =
+                std::min(nPrevChunkYSize, poPrevOvrBand->GetYSize());
+            aabDirtyChunks.push_back(GDALOvrGetDirtyChunks(
+                GDALOvrDirtyChunksToWindows(
+                    aabDirtyChunks.back(), poPrevOvrBand->GetXSize(),
+                    poPrevOvrBand->GetYSize(), nPrevChunkXSize,
+                    nPrevChunkYSize),
+                poPrevOvrBand->GetXSize(), poPrevOvrBand->GetYSize(),
+                nDstWidth, nDstHeight, nDstChunkXSize, nDstChunkYSize,
+                nMargin));
+        }
+        else
+        {
+            aabDirtyChunks.push_back(GDALOvrGetDirtyChunks(
+                aoDirtyRegions, nToplevelSrcWidth, nToplevelSrcHeight,
+                nDstWidth, nDstHeight, nDstChunkXSize, nDstChunkYSize,
+                nMargin));
+        }
+
+        const int nChunksX = DIV_ROUND_UP(nDstWidth, nDstChunkXSize);
+        const auto &abDirty = aabDirtyChunks.back();
+        for (size_t i = 0; i < abDirty.size(); ++i)
+        {
+            if (abDirty[i])
+            {
+                const int iX = static_cast<int>(i % nChunksX);
+                const int iY = static_cast<int>(i / nChunksX);
+                dfTotalPixelCount +=
+                    static_cast<double>(
+                        std::min(nDstChunkXSize,
+                                 nDstWidth - iX * nDstChunkXSize)) *
+                    std::min(nDstChunkYSize, nDstHeight - iY * nDstChunkYSize);
+            }
+        }
+    }
+    if (bDirtyRegionsMode && dfTotalPixelCount == 0)
+    {
+        pfnProgress(1.0, nullptr, pProgressData);
+        return CE_None;
     }
 
     const GDALDataType eWrkDataType =
@@ -5105,6 +5409,19 @@ CPLErr GDALRegenerateOverviewsMultiBand(
     const int nChunkMaxSize =
         atoi(CPLGetConfigOption("GDAL_OVR_CHUNK_MAX_SIZE", "10485760"));
 
+    // In streaming mode, a copy of the overview level being computed is kept
+    // in memory, so that the next level can be computed from it, instead of
+    // reading back (and decompressing) the just written overview.
+    // This is not possible when only a subset of the overviews is refreshed,
+    // as pixels outside of it would be missing.
+    const bool bStreaming =
+        CPLTestBool(CPLGetConfigOption("GDAL_OVR_STREAMING", "NO")) &&
+        !bIsMask && !bDirtyRegionsMode && nSrcXOff == 0 && nSrcYOff == 0 &&
+        nSrcXSize == nToplevelSrcWidth && nSrcYSize == nToplevelSrcHeight;
+    const GIntBig nUsablePhysicalRAM =
+        bStreaming ? CPLGetUsablePhysicalRAM() : 0;
+    std::unique_ptr<GDALDataset> poLevelCopyDS;
+
     // Second pass to do the real job.
     double dfCurPixelCount = 0;
     CPLErr eErr = CE_None;
@@ -5158,6 +5475,62 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             iSrcOverview = iOverview - 1;
         }
 
+        // The in-memory copy of the previous level, if any, is only useful
+        // to compute this level.
+        std::unique_ptr<GDALDataset> poSrcLevelDS(std::move(poLevelCopyDS));
+        if (iSrcOverview != iOverview - 1)
+            poSrcLevelDS.reset();
+
+        // Determine if the next level will be computed from this one, and
+        // if so whether we can keep this level in memory.
+        if (bStreaming && iOverview + 1 < nOverviews &&
+            nDstTotalWidth >
+                papapoOverviewBands[0][iOverview + 1]->GetXSize())
+        {
+            bool bCanStream = true;
+            for (int iBand = 0; iBand < nBands && bCanStream; ++iBand)
+            {
+                // Masks derived from other bands, such as alpha or per-dataset
+                // masks, are not replicated in the in-memory copy.
+                const int nMaskFlags =
+                    papapoOverviewBands[iBand][iOverview]->GetMaskFlags();
+                bCanStream = !bUseNoDataMask || nMaskFlags == GMF_ALL_VALID ||
+                             nMaskFlags == GMF_NODATA;
+            }
+            const double dfLevelMem =
+                static_cast<double>(nDstTotalWidth) * nDstTotalHeight *
+                nBands * GDALGetDataTypeSizeBytes(eDataType);
+            const double dfSrcLevelMem =
+                poSrcLevelDS ? static_cast<double>(nSrcWidth) * nSrcHeight *
+                                   nBands *
+                                   GDALGetDataTypeSizeBytes(eDataType)
+                             : 0.0;
+            if (bCanStream && nUsablePhysicalRAM > 0 &&
+                dfLevelMem + dfSrcLevelMem >
+                    static_cast<double>(nUsablePhysicalRAM) / 4)
+            {
+                CPLDebug("GDAL",
+                         "Not enough RAM to keep overview level %d in memory",
+                         iOverview);
+                bCanStream = false;
+            }
+            if (bCanStream)
+            {
+                poLevelCopyDS.reset(MEMDataset::Create(
+                    "", nDstTotalWidth, nDstTotalHeight, nBands, eDataType,
+                    nullptr));
+                for (int iBand = 0; poLevelCopyDS && iBand < nBands; ++iBand)
+                {
+                    auto poOvrBand = papapoOverviewBands[iBand][iOverview];
+                    if (poOvrBand->GetMaskFlags() == GMF_NODATA)
+                    {
+                        poLevelCopyDS->GetRasterBand(iBand + 1)
+                            ->SetNoDataValue(poOvrBand->GetNoDataValue());
+                    }
+                }
+            }
+        }
+
         const double dfXRatioDstToSrc =
             static_cast<double>(nSrcWidth) / nDstTotalWidth;
         const double dfYRatioDstToSrc =
@@ -5175,7 +5548,9 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             2 + static_cast<int>(nDstChunkYSize * dfYRatioDstToSrc);
         const int nFullResYChunkQueried =
             nFullResYChunk + 2 * nKernelRadius * nOvrFactor;
-        while (nDstChunkXSize < nDstWidth)
+        // In incremental mode, keep chunks aligned on the blocks, to avoid
+        // recomputing unmodified areas.
+        while (!bDirtyRegionsMode && nDstChunkXSize < nDstWidth)
         {
             const int nFullResXChunk =
                 2 + static_cast<int>(2 * nDstChunkXSize * dfXRatioDstToSrc);
@@ -5194,6 +5569,9 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             nDstChunkXSize *= 2;
         }
         nDstChunkXSize = std::min(nDstChunkXSize, nDstWidth);
+        if (bDirtyRegionsMode)
+            nDstChunkYSize = std::min(nDstChunkYSize, nDstTotalHeight);
+        const int nDstChunksX = DIV_ROUND_UP(nDstTotalWidth, nDstChunkXSize);
 
         const int nFullResXChunk =
             2 + static_cast<int>(nDstChunkXSize * dfXRatioDstToSrc);
@@ -5201,7 +5579,7 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             nFullResXChunk + 2 * nKernelRadius * nOvrFactor;
 
         // Structure describing a resampling job
-        struct OvrJob
+        struct OvrJob : public GDALPendingJob
         {
             // Buffers to free when job is finished
             std::unique_ptr<PointerHolder> oSrcMaskBufferHolder{};
@@ -5224,6 +5602,7 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             int nDstYOff = 0;
             int nDstYOff2 = 0;
             GDALRasterBand *poOverview = nullptr;
+            GByte *pabyLevelCopy = nullptr;  // in-memory copy of poOverview
             const char *pszResampling = nullptr;
             bool bHasNoData = false;
             double dfNoDataValue = 0.0;
@@ -5234,11 +5613,6 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             CPLErr eErr = CE_Failure;
             void *pDstBuffer = nullptr;
             GDALDataType eDstBufferDataType = GDT_Unknown;
-
-            // Synchronization
-            bool bFinished = false;
-            std::mutex mutex{};
-            std::condition_variable cv{};
         };
 
         // Thread function to resample
@@ -5258,50 +5632,111 @@ CPLErr GDALRegenerateOverviewsMultiBand(
 
             poJob->oDstBufferHolder.reset(new PointerHolder(poJob->pDstBuffer));
 
-            {
-                std::lock_guard<std::mutex> guard(poJob->mutex);
-                poJob->bFinished = true;
-                poJob->cv.notify_one();
-            }
+            poJob->MarkFinished();
         };
 
         // Function to write resample data to target band
-        const auto WriteJobData = [](const OvrJob *poJob)
+        const auto WriteJobData =
+            [nDstTotalWidth, eDataType](const OvrJob *poJob)
         {
-            return poJob->poOverview->RasterIO(
-                GF_Write, poJob->nDstXOff, poJob->nDstYOff,
-                poJob->nDstXOff2 - poJob->nDstXOff,
-                poJob->nDstYOff2 - poJob->nDstYOff, poJob->pDstBuffer,
-                poJob->nDstXOff2 - poJob->nDstXOff,
+            const int nXCount = poJob->nDstXOff2 - poJob->nDstXOff;
+            const CPLErr l_eErr = poJob->poOverview->RasterIO(
+                GF_Write, poJob->nDstXOff, poJob->nDstYOff, nXCount,
+                poJob->nDstYOff2 - poJob->nDstYOff, poJob->pDstBuffer, nXCount,
                 poJob->nDstYOff2 - poJob->nDstYOff, poJob->eDstBufferDataType,
                 0, 0, nullptr);
+            if (l_eErr == CE_None && poJob->pabyLevelCopy)
+            {
+                // Jobs cover disjoint areas, so no lock is needed.
+                const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+                const int nSrcDTSize =
+                    GDALGetDataTypeSizeBytes(poJob->eDstBufferDataType);
+                for (int iY = poJob->nDstYOff; iY < poJob->nDstYOff2; ++iY)
+                {
+                    GDALCopyWords64(
+                        static_cast<const GByte *>(poJob->pDstBuffer) +
+                            static_cast<size_t>(iY - poJob->nDstYOff) *
+                                nXCount * nSrcDTSize,
+                        poJob->eDstBufferDataType, nSrcDTSize,
+                        poJob->pabyLevelCopy +
+                            (static_cast<size_t>(iY) * nDstTotalWidth +
+                             poJob->nDstXOff) *
+                                nDTSize,
+                        eDataType, nDTSize, nXCount);
+                }
+            }
+            return l_eErr;
         };
 
-        // Wait for completion of oldest job and serialize it
-        const auto WaitAndFinalizeOldestJob =
-            [WriteJobData](std::list<std::unique_ptr<OvrJob>> &jobList)
+        // In multi-threaded mode, the processing is a three-stage pipeline:
+        // this thread reads the source chunks, worker threads of the pool
+        // resample them, and a dedicated writer thread writes the resampled
+        // chunks to the overview bands, in the order they have been read.
+        // As the source and overview bands may belong to the same dataset, or
+        // share the same file handle, RasterIO() calls of the reader and of the
+        // writer are serialized.
+        // The writer thread runs with the thread-local configuration options
+        // of this thread, and the errors it emits are re-emitted in this
+        // thread once it is finished.
+        std::mutex oIOMutex;
+        std::mutex oWriterMutex;
+        std::condition_variable oWriterCV;
+        std::list<std::unique_ptr<OvrJob>> jobList;  // Queue of jobs
+        bool bWriterStop = false;
+        CPLErr eWriterErr = CE_None;
+        const CPLStringList aosConfigOptions(CPLGetThreadLocalConfigOptions());
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoWriterErrors;
+
+        const auto WriterFunc = [&oIOMutex, &oWriterMutex, &oWriterCV, &jobList,
+                                 &bWriterStop, &eWriterErr, &aosConfigOptions,
+                                 &aoWriterErrors, WriteJobData]()
         {
-            auto poOldestJob = jobList.front().get();
+            CPLSetThreadLocalConfigOptions(aosConfigOptions.List());
+            CPLInstallErrorHandlerAccumulator(aoWriterErrors);
+            while (true)
             {
-                std::unique_lock<std::mutex> oGuard(poOldestJob->mutex);
-                // coverity[missing_lock:FALSE]
-                while (!poOldestJob->bFinished)
+                OvrJob *poOldestJob = nullptr;
                 {
-                    poOldestJob->cv.wait(oGuard);
+                    std::unique_lock<std::mutex> oGuard(oWriterMutex);
+                    while (jobList.empty() && !bWriterStop)
+                        oWriterCV.wait(oGuard);
+                    if (jobList.empty())
+                        break;
+                    poOldestJob = jobList.front().get();
                 }
-            }
-            CPLErr l_eErr = poOldestJob->eErr;
-            if (l_eErr == CE_None)
-            {
-                l_eErr = WriteJobData(poOldestJob);
-            }
 
-            jobList.pop_front();
-            return l_eErr;
+                poOldestJob->WaitFinished();
+
+                CPLErr l_eErr = poOldestJob->eErr;
+                if (l_eErr == CE_None)
+                {
+                    std::lock_guard<std::mutex> oIOGuard(oIOMutex);
+                    l_eErr = WriteJobData(poOldestJob);
+                }
+
+                std::lock_guard<std::mutex> oGuard(oWriterMutex);
+                jobList.pop_front();
+                if (l_eErr != CE_None && eWriterErr == CE_None)
+                    eWriterErr = l_eErr;
+                oWriterCV.notify_all();
+            }
+            CPLUninstallErrorHandlerAccumulator();
         };
 
-        // Queue of jobs
-        std::list<std::unique_ptr<OvrJob>> jobList;
+        std::thread oWriterThread;
+        if (poJobQueue)
+        {
+            try
+            {
+                oWriterThread = std::thread(WriterFunc);
+            }
+            catch (const std::exception &e)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot start writer thread: %s", e.what());
+                eErr = CE_Failure;
+            }
+        }
 
         std::vector<void *> apaChunk(nBands);
         std::vector<GByte *> apabyChunkNoDataMask(nBands);
@@ -5355,6 +5790,16 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                 else
                     nDstXCount = nDstXOffEnd - nDstXOff;
 
+                if (bDirtyRegionsMode &&
+                    !aabDirtyChunks[iOverview]
+                                   [static_cast<size_t>(nDstYOff /
+                                                        nDstChunkYSize) *
+                                        nDstChunksX +
+                                    nDstXOff / nDstChunkXSize])
+                {
+                    continue;
+                }
+
                 dfCurPixelCount += static_cast<double>(nDstXCount) * nDstYCount;
 
                 int nChunkXOff = static_cast<int>(nDstXOff * dfXRatioDstToSrc);
@@ -5385,34 +5830,17 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                          nDstYOff, nDstXCount, nDstYCount);
 #endif
 
-                // Avoid accumulating too many tasks and exhaust RAM
-
-                // Try to complete already finished jobs
-                while (eErr == CE_None && !jobList.empty())
+                // Avoid accumulating too many tasks and exhaust RAM: wait for
+                // the writer to go below the threshold.
+                if (poJobQueue)
                 {
-                    auto poOldestJob = jobList.front().get();
-                    {
-                        std::lock_guard<std::mutex> oGuard(poOldestJob->mutex);
-                        if (!poOldestJob->bFinished)
-                        {
-                            break;
-                        }
-                    }
-                    eErr = poOldestJob->eErr;
-                    if (eErr == CE_None)
+                    std::unique_lock<std::mutex> oGuard(oWriterMutex);
+                    while (eWriterErr == CE_None &&
+                           jobList.size() >= static_cast<size_t>(nThreads))
                     {
-                        eErr = WriteJobData(poOldestJob);
+                        oWriterCV.wait(oGuard);
                     }
-
-                    jobList.pop_front();
-                }
-
-                // And in case we have saturated the number of threads,
-                // wait for completion of tasks to go below the threshold.
-                while (eErr == CE_None &&
-                       jobList.size() >= static_cast<size_t>(nThreads))
-                {
-                    eErr = WaitAndFinalizeOldestJob(jobList);
+                    eErr = eWriterErr;
                 }
 
                 // (Re)allocate buffers if needed
@@ -5442,10 +5870,13 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                 }
 
                 // Read the source buffers for all the bands.
+                std::unique_lock<std::mutex> oIOGuard(oIOMutex);
                 for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
                 {
                     GDALRasterBand *poSrcBand = nullptr;
-                    if (iSrcOverview == -1)
+                    if (poSrcLevelDS)
+                        poSrcBand = poSrcLevelDS->GetRasterBand(iBand + 1);
+                    else if (iSrcOverview == -1)
                         poSrcBand = papoSrcBands[iBand];
                     else
                         poSrcBand = papapoOverviewBands[iBand][iSrcOverview];
@@ -5467,6 +5898,7 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                             nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
                     }
                 }
+                oIOGuard.unlock();
 
                 // Compute the resulting overview block.
                 for (int iBand = 0; iBand < nBands && eErr == CE_None; ++iBand)
@@ -5487,6 +5919,13 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                     poJob->nDstYOff = nDstYOff;
                     poJob->nDstYOff2 = nDstYOff + nDstYCount;
                     poJob->poOverview = papapoOverviewBands[iBand][iOverview];
+                    if (poLevelCopyDS)
+                    {
+                        poJob->pabyLevelCopy =
+                            cpl::down_cast<MEMRasterBand *>(
+                                poLevelCopyDS->GetRasterBand(iBand + 1))
+                                ->GetData();
+                    }
                     poJob->pszResampling = pszResampling;
                     poJob->bHasNoData = pabHasNoData[iBand];
                     poJob->dfNoDataValue = padfNoDataValue[iBand];
@@ -5504,7 +5943,9 @@ CPLErr GDALRegenerateOverviewsMultiBand(
                         apaChunk[iBand] = nullptr;
 
                         poJobQueue->SubmitJob(JobResampleFunc, poJob.get());
+                        std::lock_guard<std::mutex> oGuard(oWriterMutex);
                         jobList.emplace_back(std::move(poJob));
+                        oWriterCV.notify_all();
                     }
                     else
                     {
@@ -5519,12 +5960,21 @@ CPLErr GDALRegenerateOverviewsMultiBand(
             }
         }
 
-        // Wait for all pending jobs to complete
-        while (!jobList.empty())
+        // Wait for all pending jobs to be written
+        if (oWriterThread.joinable())
         {
-            const auto l_eErr = WaitAndFinalizeOldestJob(jobList);
-            if (l_eErr != CE_None && eErr == CE_None)
-                eErr = l_eErr;
+            {
+                std::lock_guard<std::mutex> oGuard(oWriterMutex);
+                bWriterStop = true;
+                oWriterCV.notify_all();
+            }
+            oWriterThread.join();
+            for (const auto &oError : aoWriterErrors)
+            {
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+            }
+            if (eWriterErr != CE_None && eErr == CE_None)
+                eErr = eWriterErr;
         }
 
         // Flush the data to overviews.
@@ -0,0 +1,224 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of convolution based overview resampling
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+
+#include "cpl_port.h"
+#include "overview_avx2.h"
+
+#ifdef HAVE_GDAL_CONVOLUTION_AVX2
+
+// This file is compiled with AVX2 enabled, so XMMReg4Double uses 256-bit
+// registers.
+#include "gdalsse_priv.h"
+
+namespace
+{
+
+/************************************************************************/
+/*                  ConvolutionHorizontal_3rows<T>                      */
+/************************************************************************/
+
+template <class T>
+inline void ConvolutionHorizontal_3rows(const T *pChunkRow1,
+                                        const T *pChunkRow2,
+                                        const T *pChunkRow3,
+                                        const double *padfWeightsAligned,
+                                        int nSrcPixelCount, double &dfRes1,
+                                        double &dfRes2, double &dfRes3)
+{
+    XMMReg4Double v_acc1 = XMMReg4Double::Zero();
+    XMMReg4Double v_acc2 = XMMReg4Double::Zero();
+    XMMReg4Double v_acc3 = XMMReg4Double::Zero();
+    int i = 0;
+    for (; i + 7 < nSrcPixelCount; i += 8)
+    {
+        const XMMReg4Double v_weight1 =
+            XMMReg4Double::Load4ValAligned(padfWeightsAligned + i);
+        const XMMReg4Double v_weight2 =
+            XMMReg4Double::Load4ValAligned(padfWeightsAligned + i + 4);
+
+        v_acc1 += XMMReg4Double::Load4Val(pChunkRow1 + i) * v_weight1;
+        v_acc1 += XMMReg4Double::Load4Val(pChunkRow1 + i + 4) * v_weight2;
+        v_acc2 += XMMReg4Double::Load4Val(pChunkRow2 + i) * v_weight1;
+        v_acc2 += XMMReg4Double::Load4Val(pChunkRow2 + i + 4) * v_weight2;
+        v_acc3 += XMMReg4Double::Load4Val(pChunkRow3 + i) * v_weight1;
+        v_acc3 += XMMReg4Double::Load4Val(pChunkRow3 + i + 4) * v_weight2;
+    }
+    for (; i + 3 < nSrcPixelCount; i += 4)
+    {
+        const XMMReg4Double v_weight =
+            XMMReg4Double::Load4ValAligned(padfWeightsAligned + i);
+
+        v_acc1 += XMMReg4Double::Load4Val(pChunkRow1 + i) * v_weight;
+        v_acc2 += XMMReg4Double::Load4Val(pChunkRow2 + i) * v_weight;
+        v_acc3 += XMMReg4Double::Load4Val(pChunkRow3 + i) * v_weight;
+    }
+
+    dfRes1 = v_acc1.GetHorizSum();
+    dfRes2 = v_acc2.GetHorizSum();
+    dfRes3 = v_acc3.GetHorizSum();
+    for (; i < nSrcPixelCount; ++i)
+    {
+        dfRes1 += pChunkRow1[i] * padfWeightsAligned[i];
+        dfRes2 += pChunkRow2[i] * padfWeightsAligned[i];
+        dfRes3 += pChunkRow3[i] * padfWeightsAligned[i];
+    }
+}
+
+/************************************************************************/
+/*                     ConvolutionHorizontal<T>                         */
+/************************************************************************/
+
+template <class T>
+inline double ConvolutionHorizontal(const T *pChunk,
+                                    const double *padfWeightsAligned,
+                                    int nSrcPixelCount)
+{
+    XMMReg4Double v_acc = XMMReg4Double::Zero();
+    int i = 0;
+    for (; i + 3 < nSrcPixelCount; i += 4)
+    {
+        v_acc += XMMReg4Double::Load4Val(pChunk + i) *
+                 XMMReg4Double::Load4ValAligned(padfWeightsAligned + i);
+    }
+
+    double dfVal = v_acc.GetHorizSum();
+    for (; i < nSrcPixelCount; ++i)
+    {
+        dfVal += pChunk[i] * padfWeightsAligned[i];
+    }
+    return dfVal;
+}
+
+/************************************************************************/
+/*                   ConvolutionHorizontalRows<T>                       */
+/************************************************************************/
+
+template <class T>
+void ConvolutionHorizontalRows(const T *pChunk, int nChunkXSize, int nHeight,
+                               const double *padfWeightsAligned,
+                               int nSrcPixelCount,
+                               double *padfDst, int nDstStride)
+{
+    int iRow = 0;
+    if (nSrcPixelCount == 4)
+    {
+        const XMMReg4Double v_weight =
+            XMMReg4Double::Load4ValAligned(padfWeightsAligned);
+        for (; iRow < nHeight; ++iRow)
+        {
+            const T *pRow =
+                pChunk + static_cast<GPtrDiff_t>(iRow) * nChunkXSize;
+            padfDst[static_cast<size_t>(iRow) * nDstStride] =
+                (XMMReg4Double::Load4Val(pRow) * v_weight).GetHorizSum();
+        }
+    }
+    else
+    {
+        for (; iRow + 2 < nHeight; iRow += 3)
+        {
+            const T *pRow =
+                pChunk + static_cast<GPtrDiff_t>(iRow) * nChunkXSize;
+            double dfVal1 = 0.0;
+            double dfVal2 = 0.0;
+            double dfVal3 = 0.0;
+            ConvolutionHorizontal_3rows(pRow, pRow + nChunkXSize,
+                                        pRow + 2 * nChunkXSize,
+                                        padfWeightsAligned, nSrcPixelCount,
+                                        dfVal1, dfVal2, dfVal3);
+            padfDst[static_cast<size_t>(iRow) * nDstStride] = dfVal1;
+            padfDst[(static_cast<size_t>(iRow) + 1) * nDstStride] = dfVal2;
+            padfDst[(static_cast<size_t>(iRow) + 2) * nDstStride] = dfVal3;
+        }
+    }
+    for (; iRow < nHeight; ++iRow)
+    {
+        padfDst[static_cast<size_t>(iRow) * nDstStride] = ConvolutionHorizontal(
+            pChunk + static_cast<GPtrDiff_t>(iRow) * nChunkXSize,
+            padfWeightsAligned, nSrcPixelCount);
+    }
+}
+
+}  // namespace
+
+/************************************************************************/
+/*             GDALResampleConvolutionHorizontalRows_AVX2()             */
+/************************************************************************/
+
+void GDALResampleConvolutionHorizontalRows_AVX2(
+    const GByte *pChunk, int nChunkXSize, int nHeight,
+    const double *padfWeightsAligned, int nSrcPixelCount, double *padfDst,
+    int nDstStride)
+{
+    ConvolutionHorizontalRows(pChunk, nChunkXSize, nHeight, padfWeightsAligned,
+                              nSrcPixelCount, padfDst, nDstStride);
+}
+
+void GDALResampleConvolutionHorizontalRows_AVX2(
+    const GUInt16 *pChunk, int nChunkXSize, int nHeight,
+    const double *padfWeightsAligned, int nSrcPixelCount, double *padfDst,
+    int nDstStride)
+{
+    ConvolutionHorizontalRows(pChunk, nChunkXSize, nHeight, padfWeightsAligned,
+                              nSrcPixelCount, padfDst, nDstStride);
+}
+
+/************************************************************************/
+/*                GDALResampleConvolutionVertical_AVX2()                */
+/************************************************************************/
+
+int GDALResampleConvolutionVertical_AVX2(const double *padfSrc, int nStride,
+                                         const double *padfWeights,
+                                         int nSrcLineCount, float *pafDst,
+                                         int nCols)
+{
+    int iCol = 0;
+    for (; iCol + 15 < nCols; iCol += 16)
+    {
+        const double *pSrc = padfSrc + iCol;
+        XMMReg4Double v_acc0 = XMMReg4Double::Zero();
+        XMMReg4Double v_acc1 = XMMReg4Double::Zero();
+        XMMReg4Double v_acc2 = XMMReg4Double::Zero();
+        XMMReg4Double v_acc3 = XMMReg4Double::Zero();
+        for (int i = 0; i < nSrcLineCount; ++i, pSrc += nStride)
+        {
+            const XMMReg4Double w =
+                XMMReg4Double::Load1ValHighAndLow(padfWeights + i);
+            v_acc0 += XMMReg4Double::Load4Val(pSrc + 0) * w;
+            v_acc1 += XMMReg4Double::Load4Val(pSrc + 4) * w;
+            v_acc2 += XMMReg4Double::Load4Val(pSrc + 8) * w;
+            v_acc3 += XMMReg4Double::Load4Val(pSrc + 12) * w;
+        }
+        v_acc0.Store4Val(pafDst + iCol);
+        v_acc1.Store4Val(pafDst + iCol + 4);
+        v_acc2.Store4Val(pafDst + iCol + 8);
+        v_acc3.Store4Val(pafDst + iCol + 12);
+    }
+    return iCol;
+}
+
+#endif  // HAVE_GDAL_CONVOLUTION_AVX2
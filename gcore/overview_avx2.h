@@ -0,0 +1,71 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of convolution based overview resampling
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+
+#ifndef OVERVIEW_AVX2_H_INCLUDED
+#define OVERVIEW_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+#define HAVE_GDAL_CONVOLUTION_AVX2
+
+/** Horizontal pass of the convolution, for a given target pixel, on nHeight
+ * rows of nSrcPixelCount source pixels, starting at pChunk and separated by
+ * nChunkXSize pixels. Results are written in padfDst, with a stride of
+ * nDstStride.
+ *
+ * padfWeightsAligned must be aligned on 32 bytes.
+ */
+void GDALResampleConvolutionHorizontalRows_AVX2(
+    const GByte *pChunk, int nChunkXSize, int nHeight,
+    const double *padfWeightsAligned, int nSrcPixelCount, double *padfDst,
+    int nDstStride);
+
+/** Same as above for unsigned 16-bit source pixels */
+void GDALResampleConvolutionHorizontalRows_AVX2(
+    const GUInt16 *pChunk, int nChunkXSize, int nHeight,
+    const double *padfWeightsAligned, int nSrcPixelCount, double *padfDst,
+    int nDstStride);
+
+/** Vertical pass of the convolution, on nSrcLineCount rows of padfSrc,
+ * separated by nStride values, for the first columns of a target line of
+ * nCols pixels.
+ *
+ * @return the number of columns processed (a multiple of 16). Remaining
+ * columns must be processed by the caller.
+ */
+int GDALResampleConvolutionVertical_AVX2(const double *padfSrc, int nStride,
+                                         const double *padfWeights,
+                                         int nSrcLineCount, float *pafDst,
+                                         int nCols);
+
+#endif
+
+#endif /* OVERVIEW_AVX2_H_INCLUDED */
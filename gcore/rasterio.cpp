@@ -41,20 +41,28 @@
 #include <cstring>
 
 #include <algorithm>
+#include <condition_variable>
 #include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_cpu_features.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_vrt.h"
 #include "gdalwarper.h"
 #include "memdataset.h"
+#include "rasterio_avx2.h"
 #include "vrtdataset.h"
 
 static void GDALFastCopyByte(const GByte *CPL_RESTRICT pSrcData,
@@ -1225,6 +1233,16 @@ CPLErr GDALRasterBand::RasterIOResampled(
 
         int nDstBlockXSize = nBufXSize;
         int nDstBlockYSize = nBufYSize;
+
+        // When several threads can be used, split the output window in at
+        // least as many strips as threads, resampled in parallel.
+        const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+        const int nThreads = std::max(
+            1, std::min(128, EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                           : atoi(pszThreads)));
+        if (nThreads > 1)
+            nDstBlockYSize = std::max(1, DIV_ROUND_UP(nBufYSize, nThreads));
+
         int nFullResXChunk = 0;
         int nFullResYChunk = 0;
         while (true)
@@ -1270,34 +1288,120 @@ CPLErr GDALRasterBand::RasterIOResampled(
         if (nFullResYSizeQueried > nRasterYSize)
             nFullResYSizeQueried = nRasterYSize;
 
-        void *pChunk =
-            VSI_MALLOC3_VERBOSE(GDALGetDataTypeSizeBytes(eWrkDataType),
-                                nFullResXSizeQueried, nFullResYSizeQueried);
-        GByte *pabyChunkNoDataMask = nullptr;
-
         GDALRasterBand *poMaskBand = GetMaskBand();
         int l_nMaskFlags = GetMaskFlags();
 
         bool bUseNoDataMask = ((l_nMaskFlags & GMF_ALL_VALID) == 0);
-        if (bUseNoDataMask)
-        {
-            pabyChunkNoDataMask = static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
-                nFullResXSizeQueried, nFullResYSizeQueried));
-        }
-        if (pChunk == nullptr ||
-            (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
-        {
-            GDALClose(poMEMDS);
-            CPLFree(pChunk);
-            CPLFree(pabyChunkNoDataMask);
-            VSIFree(pTempBuffer);
-            return CE_Failure;
-        }
 
         int nTotalBlocks = ((nBufXSize + nDstBlockXSize - 1) / nDstBlockXSize) *
                            ((nBufYSize + nDstBlockYSize - 1) / nDstBlockYSize);
         int nBlocksDone = 0;
 
+        auto poThreadPool = nThreads > 1 && nTotalBlocks > 1
+                                ? GDALGetGlobalThreadPool(nThreads)
+                                : nullptr;
+        auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                       : std::unique_ptr<CPLJobQueue>(nullptr);
+
+        // Structure describing the resampling of an output block
+        struct ResampleJob : public GDALPendingJob
+        {
+            // Input parameters of pfnResampleFunc
+            GDALResampleFunction pfnResampleFunc = nullptr;
+            double dfXRatioDstToSrc = 0;
+            double dfYRatioDstToSrc = 0;
+            double dfSrcXDelta = 0;
+            double dfSrcYDelta = 0;
+            GDALDataType eWrkDataType = GDT_Unknown;
+            std::unique_ptr<void, VSIFreeReleaser> pChunk{};
+            std::unique_ptr<GByte, VSIFreeReleaser> pabyChunkNoDataMask{};
+            bool bNoDataMaskFullyOpaque = false;
+            int nChunkXOff = 0;
+            int nChunkXSize = 0;
+            int nChunkYOff = 0;
+            int nChunkYSize = 0;
+            int nDstXOff = 0;
+            int nDstXOff2 = 0;
+            int nDstYOff = 0;
+            int nDstYOff2 = 0;
+            GDALRasterBand *poDstBand = nullptr;
+            const char *pszResampling = nullptr;
+            bool bHasNoData = false;
+            double dfNoDataValue = 0;
+            GDALColorTable *poColorTable = nullptr;
+            GDALDataType eSrcDataType = GDT_Unknown;
+
+            // Output values of pfnResampleFunc
+            CPLErr eErr = CE_Failure;
+            void *pDstBuffer = nullptr;
+            GDALDataType eDstBufferDataType = GDT_Unknown;
+
+            ResampleJob() = default;
+            ResampleJob(const ResampleJob &) = delete;
+            ResampleJob &operator=(const ResampleJob &) = delete;
+
+            ~ResampleJob()
+            {
+                CPLFree(pDstBuffer);
+            }
+        };
+
+        // Thread function to resample
+        const auto JobResampleFunc = [](void *pJobData)
+        {
+            ResampleJob *poJob = static_cast<ResampleJob *>(pJobData);
+            const bool bPropagateNoData = false;
+            poJob->eErr = poJob->pfnResampleFunc(
+                poJob->dfXRatioDstToSrc, poJob->dfYRatioDstToSrc,
+                poJob->dfSrcXDelta, poJob->dfSrcYDelta, poJob->eWrkDataType,
+                poJob->pChunk.get(),
+                poJob->bNoDataMaskFullyOpaque
+                    ? nullptr
+                    : poJob->pabyChunkNoDataMask.get(),
+                poJob->nChunkXOff, poJob->nChunkXSize, poJob->nChunkYOff,
+                poJob->nChunkYSize, poJob->nDstXOff, poJob->nDstXOff2,
+                poJob->nDstYOff, poJob->nDstYOff2, poJob->poDstBand,
+                &(poJob->pDstBuffer), &(poJob->eDstBufferDataType),
+                poJob->pszResampling, poJob->bHasNoData, poJob->dfNoDataValue,
+                poJob->poColorTable, poJob->eSrcDataType, bPropagateNoData);
+
+            poJob->MarkFinished();
+        };
+
+        // Write the resampled data of a job to the MEM band, and report
+        // progress. Done in the calling thread.
+        const auto FinalizeJob =
+            [psExtraArg, &nBlocksDone, nTotalBlocks](const ResampleJob *poJob)
+        {
+            CPLErr l_eErr = poJob->eErr;
+            if (l_eErr == CE_None)
+            {
+                const int nDstXCount = poJob->nDstXOff2 - poJob->nDstXOff;
+                const int nDstYCount = poJob->nDstYOff2 - poJob->nDstYOff;
+                l_eErr = poJob->poDstBand->RasterIO(
+                    GF_Write, poJob->nDstXOff, poJob->nDstYOff, nDstXCount,
+                    nDstYCount, poJob->pDstBuffer, nDstXCount, nDstYCount,
+                    poJob->eDstBufferDataType, 0, 0, nullptr);
+            }
+
+            nBlocksDone++;
+            if (l_eErr == CE_None && psExtraArg->pfnProgress != nullptr &&
+                !psExtraArg->pfnProgress(1.0 * nBlocksDone / nTotalBlocks, "",
+                                         psExtraArg->pProgressData))
+            {
+                l_eErr = CE_Failure;
+            }
+            return l_eErr;
+        };
+
+        // Queue of jobs
+        GDALPendingJobList<ResampleJob> jobList;
+
+        // Source buffers, reused from one block to another when not using
+        // threads
+        std::unique_ptr<void, VSIFreeReleaser> pChunk;
+        std::unique_ptr<GByte, VSIFreeReleaser> pabyChunkNoDataMask;
+
         int nDstYOff;
         for (nDstYOff = 0; nDstYOff < nBufYSize && eErr == CE_None;
              nDstYOff += nDstBlockYSize)
@@ -1363,11 +1467,37 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     nChunkXSizeQueried = nRasterXSize - nChunkXOffQueried;
                 CPLAssert(nChunkXSizeQueried <= nFullResXSizeQueried);
 
+                // Finalize already finished jobs, and avoid accumulating
+                // more pending jobs than threads, to bound RAM usage.
+                eErr = jobList.FinalizeFinishedJobs(
+                    static_cast<size_t>(nThreads), FinalizeJob);
+                if (eErr != CE_None)
+                    break;
+
+                if (!pChunk)
+                {
+                    pChunk.reset(VSI_MALLOC3_VERBOSE(
+                        GDALGetDataTypeSizeBytes(eWrkDataType),
+                        nFullResXSizeQueried, nFullResYSizeQueried));
+                }
+                if (bUseNoDataMask && !pabyChunkNoDataMask)
+                {
+                    pabyChunkNoDataMask.reset(
+                        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                            nFullResXSizeQueried, nFullResYSizeQueried)));
+                }
+                if (!pChunk || (bUseNoDataMask && !pabyChunkNoDataMask))
+                {
+                    eErr = CE_Failure;
+                    break;
+                }
+
                 // Read the source buffers.
                 eErr = RasterIO(GF_Read, nChunkXOffQueried, nChunkYOffQueried,
-                                nChunkXSizeQueried, nChunkYSizeQueried, pChunk,
                                 nChunkXSizeQueried, nChunkYSizeQueried,
-                                eWrkDataType, 0, 0, nullptr);
+                                pChunk.get(), nChunkXSizeQueried,
+                                nChunkYSizeQueried, eWrkDataType, 0, 0,
+                                nullptr);
 
                 bool bSkipResample = false;
                 bool bNoDataMaskFullyOpaque = false;
@@ -1376,16 +1506,16 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     eErr = poMaskBand->RasterIO(
                         GF_Read, nChunkXOffQueried, nChunkYOffQueried,
                         nChunkXSizeQueried, nChunkYSizeQueried,
-                        pabyChunkNoDataMask, nChunkXSizeQueried,
+                        pabyChunkNoDataMask.get(), nChunkXSizeQueried,
                         nChunkYSizeQueried, GDT_Byte, 0, 0, nullptr);
 
                     /* Optimizations if mask if fully opaque or transparent */
                     int nPixels = nChunkXSizeQueried * nChunkYSizeQueried;
-                    GByte bVal = pabyChunkNoDataMask[0];
+                    GByte bVal = pabyChunkNoDataMask.get()[0];
                     int i = 1;
                     for (; i < nPixels; i++)
                     {
-                        if (pabyChunkNoDataMask[i] != bVal)
+                        if (pabyChunkNoDataMask.get()[i] != bVal)
                             break;
                     }
                     if (i == nPixels)
@@ -1410,52 +1540,69 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     }
                 }
 
-                if (!bSkipResample && eErr == CE_None)
+                if (bSkipResample && eErr == CE_None)
                 {
-                    const bool bPropagateNoData = false;
-                    void *pDstBuffer = nullptr;
-                    GDALDataType eDstBufferDataType = GDT_Unknown;
-                    GDALRasterBand *poMEMBand =
-                        GDALRasterBand::FromHandle(hMEMBand);
-                    eErr = pfnResampleFunc(
-                        dfXRatioDstToSrc, dfYRatioDstToSrc,
-                        dfXOff - nXOff, /* == 0 if bHasXOffVirtual */
-                        dfYOff - nYOff, /* == 0 if bHasYOffVirtual */
-                        eWrkDataType, pChunk,
-                        bNoDataMaskFullyOpaque ? nullptr : pabyChunkNoDataMask,
-                        nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff),
-                        nChunkXSizeQueried,
-                        nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff),
-                        nChunkYSizeQueried, nDstXOff + nDestXOffVirtual,
-                        nDstXOff + nDestXOffVirtual + nDstXCount,
-                        nDstYOff + nDestYOffVirtual,
-                        nDstYOff + nDestYOffVirtual + nDstYCount, poMEMBand,
-                        &pDstBuffer, &eDstBufferDataType, pszResampling,
-                        bHasNoData, dfNoDataValue, GetColorTable(), eDataType,
-                        bPropagateNoData);
-                    if (eErr == CE_None)
+                    nBlocksDone++;
+                    if (psExtraArg->pfnProgress != nullptr &&
+                        !psExtraArg->pfnProgress(
+                            1.0 * nBlocksDone / nTotalBlocks, "",
+                            psExtraArg->pProgressData))
                     {
-                        eErr = poMEMBand->RasterIO(
-                            GF_Write, nDstXOff + nDestXOffVirtual,
-                            nDstYOff + nDestYOffVirtual, nDstXCount, nDstYCount,
-                            pDstBuffer, nDstXCount, nDstYCount,
-                            eDstBufferDataType, 0, 0, nullptr);
+                        eErr = CE_Failure;
                     }
-                    CPLFree(pDstBuffer);
                 }
-
-                nBlocksDone++;
-                if (eErr == CE_None && psExtraArg->pfnProgress != nullptr &&
-                    !psExtraArg->pfnProgress(1.0 * nBlocksDone / nTotalBlocks,
-                                             "", psExtraArg->pProgressData))
+                else if (eErr == CE_None)
                 {
-                    eErr = CE_Failure;
+                    auto poJob = std::make_unique<ResampleJob>();
+                    poJob->pfnResampleFunc = pfnResampleFunc;
+                    poJob->dfXRatioDstToSrc = dfXRatioDstToSrc;
+                    poJob->dfYRatioDstToSrc = dfYRatioDstToSrc;
+                    // == 0 if bHasXOffVirtual / bHasYOffVirtual
+                    poJob->dfSrcXDelta = dfXOff - nXOff;
+                    poJob->dfSrcYDelta = dfYOff - nYOff;
+                    poJob->eWrkDataType = eWrkDataType;
+                    poJob->pChunk = std::move(pChunk);
+                    poJob->pabyChunkNoDataMask = std::move(pabyChunkNoDataMask);
+                    poJob->bNoDataMaskFullyOpaque = bNoDataMaskFullyOpaque;
+                    poJob->nChunkXOff =
+                        nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff);
+                    poJob->nChunkXSize = nChunkXSizeQueried;
+                    poJob->nChunkYOff =
+                        nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff);
+                    poJob->nChunkYSize = nChunkYSizeQueried;
+                    poJob->nDstXOff = nDstXOff + nDestXOffVirtual;
+                    poJob->nDstXOff2 = nDstXOff + nDestXOffVirtual + nDstXCount;
+                    poJob->nDstYOff = nDstYOff + nDestYOffVirtual;
+                    poJob->nDstYOff2 = nDstYOff + nDestYOffVirtual + nDstYCount;
+                    poJob->poDstBand = GDALRasterBand::FromHandle(hMEMBand);
+                    poJob->pszResampling = pszResampling;
+                    poJob->bHasNoData = bHasNoData;
+                    poJob->dfNoDataValue = dfNoDataValue;
+                    poJob->poColorTable = GetColorTable();
+                    poJob->eSrcDataType = eDataType;
+
+                    if (poJobQueue)
+                    {
+                        jobList.Submit(poJobQueue.get(), JobResampleFunc,
+                                       std::move(poJob));
+                    }
+                    else
+                    {
+                        JobResampleFunc(poJob.get());
+                        eErr = FinalizeJob(poJob.get());
+                        // Reuse the source buffers for next block
+                        pChunk = std::move(poJob->pChunk);
+                        pabyChunkNoDataMask =
+                            std::move(poJob->pabyChunkNoDataMask);
+                    }
                 }
             }
         }
 
-        CPLFree(pChunk);
-        CPLFree(pabyChunkNoDataMask);
+        // Wait for all pending jobs to complete
+        const CPLErr eJobsErr = jobList.FinalizeAllJobs(FinalizeJob);
+        if (eErr == CE_None)
+            eErr = eJobsErr;
     }
 
     if (eBufType != eDataType)
@@ -1959,6 +2106,47 @@ CPLErr GDALDataset::RasterIOResampled(GDALRWFlag /* eRWFlag */, int nXOff,
 
 //! @endcond
 
+#if defined(__x86_64) || defined(_M_X64)
+
+#include <emmintrin.h>
+
+/************************************************************************/
+/*                      GDALSwapWordsPacked_SSE2()                      */
+/************************************************************************/
+
+// Byte swap packed 2, 4 or 8 byte words, 16 bytes at a time. Returns the
+// number of words processed, the caller being responsible for the
+// remaining ones.
+template <int WORD_SIZE>
+static int GDALSwapWordsPacked_SSE2(GByte *pabyData, int nWordCount)
+{
+    constexpr int WORDS_PER_VECTOR = 16 / WORD_SIZE;
+    int i = 0;
+    for (; i + WORDS_PER_VECTOR - 1 < nWordCount; i += WORDS_PER_VECTOR)
+    {
+        __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pabyData));
+        // First reverse the order of the 16 bit halves inside each word...
+        if constexpr (WORD_SIZE == 4)
+        {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        else if constexpr (WORD_SIZE == 8)
+        {
+            v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+            v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        // ... and then swap the bytes of each 16 bit half.
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyData), v);
+        pabyData += 16;
+    }
+    return i;
+}
+
+#endif  // defined(__x86_64) || defined(_M_X64)
+
 /************************************************************************/
 /*                           GDALSwapWords()                            */
 /************************************************************************/
@@ -1996,6 +2184,15 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 2:
             CPLAssert(nWordSkip >= 2 || nWordCount == 1);
+#if defined(__x86_64) || defined(_M_X64)
+            if (nWordSkip == 2)
+            {
+                const int nDone =
+                    GDALSwapWordsPacked_SSE2<2>(pabyData, nWordCount);
+                pabyData += 2 * nDone;
+                nWordCount -= nDone;
+            }
+#endif
             for (int i = 0; i < nWordCount; i++)
             {
                 CPL_SWAP16PTR(pabyData);
@@ -2005,6 +2202,15 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 4:
             CPLAssert(nWordSkip >= 4 || nWordCount == 1);
+#if defined(__x86_64) || defined(_M_X64)
+            if (nWordSkip == 4)
+            {
+                const int nDone =
+                    GDALSwapWordsPacked_SSE2<4>(pabyData, nWordCount);
+                pabyData += 4 * nDone;
+                nWordCount -= nDone;
+            }
+#endif
             if (CPL_IS_ALIGNED(pabyData, 4) && (nWordSkip % 4) == 0)
             {
                 for (int i = 0; i < nWordCount; i++)
@@ -2026,6 +2232,15 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
         case 8:
             CPLAssert(nWordSkip >= 8 || nWordCount == 1);
+#if defined(__x86_64) || defined(_M_X64)
+            if (nWordSkip == 8)
+            {
+                const int nDone =
+                    GDALSwapWordsPacked_SSE2<8>(pabyData, nWordCount);
+                pabyData += 8 * nDone;
+                nWordCount -= nDone;
+            }
+#endif
 #ifdef CPL_HAS_GINT64
             if (CPL_IS_ALIGNED(pabyData, 8) && (nWordSkip % 8) == 0)
             {
@@ -3418,6 +3633,16 @@ void CPL_STDCALL GDALCopyWords64(const void *CPL_RESTRICT pSrcData,
         }
     }
 
+#ifdef HAVE_GDAL_COPYWORDS_AVX2
+    if (nWordCount >= 32 && nSrcPixelStride == nSrcDataTypeSize &&
+        nDstPixelStride == nDstDataTypeSize && CPLHaveRuntimeAVX2() &&
+        GDALCopyWordsContiguous_AVX2(pSrcData, eSrcType, pDstData, eDstType,
+                                     static_cast<size_t>(nWordCount)))
+    {
+        return;
+    }
+#endif
+
     // Handle the more general case -- deals with conversion of data types
     // directly.
     switch (eSrcType)
@@ -3601,8 +3826,10 @@ int GDALBandGetBestOverviewLevel2(GDALRasterBand *poBand, int &nXOff,
     double dfBestDownsamplingFactor = 0;
     int nBestOverviewLevel = -1;
 
-    const char *pszOversampligThreshold =
-        CPLGetConfigOption("GDAL_OVERVIEW_OVERSAMPLING_THRESHOLD", nullptr);
+    // Called for each RasterIO() request on a band with overviews
+    static thread_local CPLCachedConfigOption oOversamplingThreshold(
+        "GDAL_OVERVIEW_OVERSAMPLING_THRESHOLD", nullptr);
+    const char *pszOversampligThreshold = oOversamplingThreshold.Get();
 
     // Cf https://github.com/OSGeo/gdal/pull/9040#issuecomment-1898524693
     // Do not exactly use a oversampling threshold of 1.0 because of numerical
@@ -4538,6 +4765,272 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
     *pnSwathLines = nSwathLines;
 }
 
+/************************************************************************/
+/*                  GDALCopyWholeRasterGetNumThreads()                  */
+/************************************************************************/
+
+static int GDALCopyWholeRasterGetNumThreads(CSLConstList papszOptions)
+{
+    const char *pszThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    return std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszThreads)));
+}
+
+/************************************************************************/
+/*                     GDALCopyWholeRasterParallel()                    */
+/************************************************************************/
+
+// Variant of the copy loops of GDALDatasetCopyWholeRaster() and
+// GDALRasterBandCopyWholeRaster(), where swaths are read (and computed, for
+// virtual datasets) by jobs of the global thread pool, and written in order
+// to the destination by the calling thread.
+// Either poSrcDS and poDstDS, or poSrcBand and poDstBand, must be set.
+// If bSrcThreadSafe is true, up to nThreads swaths are read concurrently.
+// Otherwise, a single swath is read at a time, while the previous one is
+// written.
+static CPLErr GDALCopyWholeRasterParallel(
+    GDALDataset *poSrcDS, GDALDataset *poDstDS, GDALRasterBand *poSrcBand,
+    GDALRasterBand *poDstBand, GDALDataType eDT, bool bInterleave,
+    bool bCheckHoles, int nSwathCols, int nSwathLines, int nThreads,
+    bool bSrcThreadSafe, GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nXSize =
+        poDstBand ? poDstBand->GetXSize() : poDstDS->GetRasterXSize();
+    const int nYSize =
+        poDstBand ? poDstBand->GetYSize() : poDstDS->GetRasterYSize();
+    const int nBandCount = poDstBand ? 1 : poDstDS->GetRasterCount();
+    if (poDstBand)
+        bInterleave = false;
+    const size_t nSwathSize = static_cast<size_t>(nSwathCols) * nSwathLines *
+                              GDALGetDataTypeSizeBytes(eDT) *
+                              (bInterleave ? nBandCount : 1);
+    // Maximum number of swaths read, or being read, but not yet written
+    const size_t nMaxPendingJobs =
+        bSrcThreadSafe ? static_cast<size_t>(nThreads) : 1;
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+        return CE_Failure;
+
+    // Structure describing the reading of a swath
+    struct ReadJob : public GDALPendingJob
+    {
+        // Source dataset, for the pixel-interleaved case
+        GDALDataset *poSrcDS = nullptr;
+        // Source and destination bands, for the band-interleaved case
+        GDALRasterBand *poSrcBand = nullptr;
+        GDALRasterBand *poDstBand = nullptr;
+        GDALDataType eDT = GDT_Unknown;
+        int nXOff = 0;
+        int nYOff = 0;
+        int nXSize = 0;
+        int nYSize = 0;
+        bool bCheckHoles = false;
+        std::unique_ptr<void, VSIFreeReleaser> pBuffer{};
+
+        // Output values
+        bool bHasData = true;
+        CPLErr eErr = CE_Failure;
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    };
+
+    // Thread function to read a swath
+    const auto JobReadFunc = [](void *pJobData)
+    {
+        ReadJob *poJob = static_cast<ReadJob *>(pJobData);
+        CPLInstallErrorHandlerAccumulator(poJob->aoErrors);
+        if (poJob->bCheckHoles)
+        {
+            int nStatus = 0;
+            if (poJob->poSrcBand)
+            {
+                nStatus = poJob->poSrcBand->GetDataCoverageStatus(
+                    poJob->nXOff, poJob->nYOff, poJob->nXSize, poJob->nYSize,
+                    GDAL_DATA_COVERAGE_STATUS_DATA);
+            }
+            else
+            {
+                GDALDataset *l_poSrcDS = poJob->poSrcDS;
+                for (int iBand = 1; iBand <= l_poSrcDS->GetRasterCount() &&
+                                    !(nStatus & GDAL_DATA_COVERAGE_STATUS_DATA);
+                     ++iBand)
+                {
+                    nStatus |=
+                        l_poSrcDS->GetRasterBand(iBand)->GetDataCoverageStatus(
+                            poJob->nXOff, poJob->nYOff, poJob->nXSize,
+                            poJob->nYSize, GDAL_DATA_COVERAGE_STATUS_DATA);
+                }
+            }
+            poJob->bHasData = (nStatus & GDAL_DATA_COVERAGE_STATUS_DATA) != 0;
+        }
+        if (!poJob->bHasData)
+        {
+            poJob->eErr = CE_None;
+        }
+        else if (poJob->poSrcBand)
+        {
+            poJob->eErr = poJob->poSrcBand->RasterIO(
+                GF_Read, poJob->nXOff, poJob->nYOff, poJob->nXSize,
+                poJob->nYSize, poJob->pBuffer.get(), poJob->nXSize,
+                poJob->nYSize, poJob->eDT, 0, 0, nullptr);
+        }
+        else
+        {
+            poJob->eErr = poJob->poSrcDS->RasterIO(
+                GF_Read, poJob->nXOff, poJob->nYOff, poJob->nXSize,
+                poJob->nYSize, poJob->pBuffer.get(), poJob->nXSize,
+                poJob->nYSize, poJob->eDT, poJob->poSrcDS->GetRasterCount(),
+                nullptr, 0, 0, 0, nullptr);
+        }
+        CPLUninstallErrorHandlerAccumulator();
+
+        poJob->MarkFinished();
+    };
+
+    const GIntBig nTotalBlocks =
+        static_cast<GIntBig>(bInterleave ? 1 : nBandCount) *
+        DIV_ROUND_UP(nYSize, nSwathLines) * DIV_ROUND_UP(nXSize, nSwathCols);
+    GIntBig nBlocksDone = 0;
+
+    // Buffers of finalized jobs, reused by next ones
+    std::vector<std::unique_ptr<void, VSIFreeReleaser>> apFreeBuffers;
+
+    // Queue of jobs
+    std::list<std::unique_ptr<ReadJob>> jobList;
+
+    // Wait for completion of oldest job, write its swath and report progress.
+    // Done in the calling thread.
+    const auto WaitAndFinalizeOldestJob =
+        [&jobList, &apFreeBuffers, &nBlocksDone, nTotalBlocks, poDstDS,
+         nBandCount, pfnProgress, pProgressData](bool bWrite)
+    {
+        auto poJob = jobList.front().get();
+        poJob->WaitFinished();
+        for (const auto &oError : poJob->aoErrors)
+        {
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        CPLErr l_eErr = poJob->eErr;
+        if (bWrite && l_eErr == CE_None && poJob->bHasData)
+        {
+            if (poJob->poDstBand)
+            {
+                l_eErr = poJob->poDstBand->RasterIO(
+                    GF_Write, poJob->nXOff, poJob->nYOff, poJob->nXSize,
+                    poJob->nYSize, poJob->pBuffer.get(), poJob->nXSize,
+                    poJob->nYSize, poJob->eDT, 0, 0, nullptr);
+            }
+            else
+            {
+                l_eErr = poDstDS->RasterIO(
+                    GF_Write, poJob->nXOff, poJob->nYOff, poJob->nXSize,
+                    poJob->nYSize, poJob->pBuffer.get(), poJob->nXSize,
+                    poJob->nYSize, poJob->eDT, nBandCount, nullptr, 0, 0, 0,
+                    nullptr);
+            }
+        }
+        nBlocksDone++;
+        if (bWrite && l_eErr == CE_None &&
+            !pfnProgress(nBlocksDone / static_cast<double>(nTotalBlocks),
+                         nullptr, pProgressData))
+        {
+            l_eErr = CE_Failure;
+            CPLError(CE_Failure, CPLE_UserInterrupt,
+                     "User terminated CreateCopy()");
+        }
+        apFreeBuffers.push_back(std::move(poJob->pBuffer));
+        jobList.pop_front();
+        return l_eErr;
+    };
+
+    CPLErr eErr = CE_None;
+    const int nLastBand = bInterleave ? 0 : nBandCount;
+    for (int iBand = bInterleave ? 0 : 1; iBand <= nLastBand && eErr == CE_None;
+         iBand++)
+    {
+        for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nSwathLines)
+        {
+            const int nThisLines = std::min(nSwathLines, nYSize - iY);
+            for (int iX = 0; iX < nXSize && eErr == CE_None; iX += nSwathCols)
+            {
+                const int nThisCols = std::min(nSwathCols, nXSize - iX);
+
+                auto poJob = std::make_unique<ReadJob>();
+                if (bInterleave)
+                {
+                    poJob->poSrcDS = poSrcDS;
+                }
+                else if (poSrcBand)
+                {
+                    poJob->poSrcBand = poSrcBand;
+                    poJob->poDstBand = poDstBand;
+                }
+                else
+                {
+                    poJob->poSrcBand = poSrcDS->GetRasterBand(iBand);
+                    poJob->poDstBand = poDstDS->GetRasterBand(iBand);
+                }
+                poJob->eDT = eDT;
+                poJob->nXOff = iX;
+                poJob->nYOff = iY;
+                poJob->nXSize = nThisCols;
+                poJob->nYSize = nThisLines;
+                poJob->bCheckHoles = bCheckHoles;
+                if (!apFreeBuffers.empty())
+                {
+                    poJob->pBuffer = std::move(apFreeBuffers.back());
+                    apFreeBuffers.pop_back();
+                }
+                else
+                {
+                    poJob->pBuffer.reset(VSI_MALLOC_VERBOSE(nSwathSize));
+                    if (!poJob->pBuffer)
+                    {
+                        eErr = CE_Failure;
+                        break;
+                    }
+                }
+
+                // A source that is not thread-safe must be read by a single
+                // job at a time.
+                if (!bSrcThreadSafe && !jobList.empty())
+                    jobList.back()->WaitFinished();
+
+                if (!poJobQueue->SubmitJob(JobReadFunc, poJob.get()))
+                {
+                    eErr = CE_Failure;
+                    break;
+                }
+                jobList.push_back(std::move(poJob));
+
+                // Write older swaths while the new one is read. Avoid
+                // accumulating more pending jobs than needed, to bound RAM
+                // usage.
+                while (eErr == CE_None && jobList.size() > nMaxPendingJobs)
+                {
+                    eErr = WaitAndFinalizeOldestJob(true);
+                }
+            }
+        }
+    }
+
+    // Write the remaining swaths, or just wait for the pending jobs in case
+    // of error.
+    while (!jobList.empty())
+    {
+        const CPLErr l_eErr = WaitAndFinalizeOldestJob(eErr == CE_None);
+        if (eErr == CE_None)
+            eErr = l_eErr;
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                     GDALDatasetCopyWholeRaster()                     */
 /************************************************************************/
@@ -4563,6 +5056,12 @@ static void GDALCopyWholeRasterGetSwathSize(GDALRasterBand *poSrcPrototypeBand,
  * sizes to achieve best compression.</li> <li>"SKIP_HOLES=YES" to skip chunks
  * for which GDALGetDataCoverageStatus() returns GDAL_DATA_COVERAGE_STATUS_EMPTY
  * (GDAL &gt;= 2.2)</li>
+ * <li>"NUM_THREADS=number_of_threads|ALL_CPUS". When greater than 1, chunks
+ * are read by worker threads, while the previously read ones are written in
+ * order to the destination dataset by the calling thread. Chunks of
+ * thread-safe source datasets (see GDALDataset::IsThreadSafe()) are read in
+ * parallel, and chunks of other datasets one at a time. Defaults to the value
+ * of the GDAL_NUM_THREADS configuration option. (GDAL &gt;= 3.10)</li>
  * </ul>
  * More options may be supported in the future.
  *
@@ -4705,7 +5204,21 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
     const bool bCheckHoles =
         CPLTestBool(CSLFetchNameValueDef(papszOptions, "SKIP_HOLES", "NO"));
 
-    if (!bInterleave)
+    const int nThreads = GDALCopyWholeRasterGetNumThreads(papszOptions);
+    if (nThreads > 1 && poSrcDS != poDstDS &&
+        (nSwathCols < nXSize || nSwathLines < nYSize ||
+         (!bInterleave && nBandCount > 1)))
+    {
+        const bool bSrcThreadSafe = poSrcDS->IsThreadSafe(GDAL_OF_RASTER);
+        CPLDebug("GDAL", "GDALDatasetCopyWholeRaster(): %s with %d threads",
+                 bSrcThreadSafe ? "reading" : "pipelining reads and writes",
+                 nThreads);
+        eErr = GDALCopyWholeRasterParallel(
+            poSrcDS, poDstDS, nullptr, nullptr, eDT, bInterleave, bCheckHoles,
+            nSwathCols, nSwathLines, nThreads, bSrcThreadSafe, pfnProgress,
+            pProgressData);
+    }
+    else if (!bInterleave)
     {
         GDALRasterIOExtraArg sExtraArg;
         INIT_RASTERIO_EXTRA_ARG(sExtraArg);
@@ -4891,6 +5404,10 @@ CPLErr CPL_STDCALL GDALDatasetCopyWholeRaster(GDALDatasetH hSrcDS,
  * achieve best compression.</li>
  * <li>"SKIP_HOLES=YES" to skip chunks for which GDALGetDataCoverageStatus()
  * returns GDAL_DATA_COVERAGE_STATUS_EMPTY (GDAL &gt;= 2.2)</li>
+ * <li>"NUM_THREADS=number_of_threads|ALL_CPUS". When greater than 1, the next
+ * chunk is read by a worker thread, while the previous one is written to the
+ * destination band by the calling thread. Defaults to the value of the
+ * GDAL_NUM_THREADS configuration option. (GDAL &gt;= 3.10)</li>
  * </ul>
  *
  * @param hSrcBand the source band
@@ -4979,6 +5496,20 @@ CPLErr CPL_STDCALL GDALRasterBandCopyWholeRaster(
     // Advise the source raster that we are going to read it completely
     poSrcBand->AdviseRead(0, 0, nXSize, nYSize, nXSize, nYSize, eDT, nullptr);
 
+    const int nThreads = GDALCopyWholeRasterGetNumThreads(papszOptions);
+    if (nThreads > 1 && poSrcBand != poDstBand &&
+        (nSwathCols < nXSize || nSwathLines < nYSize))
+    {
+        CPLDebug("GDAL",
+                 "GDALRasterBandCopyWholeRaster(): pipelining reads and "
+                 "writes");
+        CPLFree(pSwathBuf);
+        return GDALCopyWholeRasterParallel(
+            nullptr, nullptr, poSrcBand, poDstBand, eDT, false, bCheckHoles,
+            nSwathCols, nSwathLines, nThreads, false, pfnProgress,
+            pProgressData);
+    }
+
     /* ==================================================================== */
     /*      Band oriented (uninterleaved) case.                             */
     /* ==================================================================== */
@@ -0,0 +1,531 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of GDALCopyWords() data type conversions
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+#include "rasterio_avx2.h"
+
+#include "gdal_priv_templates.hpp"
+
+#include <immintrin.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace
+{
+
+/************************************************************************/
+/*                            LoadAsInt32()                             */
+/************************************************************************/
+
+// Load 8 integer values as 32-bit lanes. For GUInt32, the lanes contain the
+// unsigned bit pattern.
+
+inline __m256i LoadAsInt32(const GByte *p)
+{
+    return _mm256_cvtepu8_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)));
+}
+
+inline __m256i LoadAsInt32(const GInt8 *p)
+{
+    return _mm256_cvtepi8_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(p)));
+}
+
+inline __m256i LoadAsInt32(const GUInt16 *p)
+{
+    return _mm256_cvtepu16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+}
+
+inline __m256i LoadAsInt32(const GInt16 *p)
+{
+    return _mm256_cvtepi16_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+}
+
+inline __m256i LoadAsInt32(const GUInt32 *p)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+}
+
+inline __m256i LoadAsInt32(const GInt32 *p)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+}
+
+/************************************************************************/
+/*                            StoreInt32()                              */
+/************************************************************************/
+
+// Store 8 32-bit lanes, whose values are already in the range of the
+// target type.
+
+inline void StoreInt32(__m256i v, GByte *p)
+{
+    const __m128i s16 = _mm_packs_epi32(_mm256_castsi256_si128(v),
+                                        _mm256_extracti128_si256(v, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(p),
+                     _mm_packus_epi16(s16, s16));
+}
+
+inline void StoreInt32(__m256i v, GInt8 *p)
+{
+    const __m128i s16 = _mm_packs_epi32(_mm256_castsi256_si128(v),
+                                        _mm256_extracti128_si256(v, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(p),
+                     _mm_packs_epi16(s16, s16));
+}
+
+inline void StoreInt32(__m256i v, GUInt16 *p)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p),
+                     _mm_packus_epi32(_mm256_castsi256_si128(v),
+                                      _mm256_extracti128_si256(v, 1)));
+}
+
+inline void StoreInt32(__m256i v, GInt16 *p)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p),
+                     _mm_packs_epi32(_mm256_castsi256_si128(v),
+                                     _mm256_extracti128_si256(v, 1)));
+}
+
+inline void StoreInt32(__m256i v, GUInt32 *p)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+}
+
+inline void StoreInt32(__m256i v, GInt32 *p)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+}
+
+/************************************************************************/
+/*                            ClampInt32()                              */
+/************************************************************************/
+
+// Clamp 32-bit lanes holding Tin values to the range of Tout
+
+template <class Tin, class Tout> inline __m256i ClampInt32(__m256i v)
+{
+    constexpr int64_t nInMin = std::numeric_limits<Tin>::lowest();
+    constexpr int64_t nInMax = std::numeric_limits<Tin>::max();
+    constexpr int64_t nOutMin = std::numeric_limits<Tout>::lowest();
+    constexpr int64_t nOutMax = std::numeric_limits<Tout>::max();
+    if constexpr (std::is_same_v<Tin, GUInt32>)
+    {
+        v = _mm256_min_epu32(v, _mm256_set1_epi32(static_cast<int>(nOutMax)));
+    }
+    else
+    {
+        if constexpr (nInMin < nOutMin)
+            v = _mm256_max_epi32(v,
+                                 _mm256_set1_epi32(static_cast<int>(nOutMin)));
+        if constexpr (nInMax > nOutMax)
+            v = _mm256_min_epi32(v,
+                                 _mm256_set1_epi32(static_cast<int>(nOutMax)));
+    }
+    return v;
+}
+
+/************************************************************************/
+/*                         RoundClampToInt32()                          */
+/************************************************************************/
+
+// Round 8 floats to the nearest integer and clamp them to the range of Tout,
+// an integer type of at most 16 bits, with the same rules as GDALCopyWord().
+
+template <class Tout> inline __m256i RoundClampToInt32(__m256 v)
+{
+    const __m256 vMin =
+        _mm256_set1_ps(static_cast<float>(std::numeric_limits<Tout>::lowest()));
+    const __m256 vMax =
+        _mm256_set1_ps(static_cast<float>(std::numeric_limits<Tout>::max()));
+    const __m256 half = _mm256_set1_ps(0.5f);
+    if constexpr (std::is_signed_v<Tout>)
+    {
+        // NaN -> 0
+        v = _mm256_and_ps(v, _mm256_cmp_ps(v, v, _CMP_ORD_Q));
+        // v >= 0 ? v + 0.5 : v - 0.5
+        v = _mm256_blendv_ps(
+            _mm256_sub_ps(v, half), _mm256_add_ps(v, half),
+            _mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_GE_OQ));
+        v = _mm256_min_ps(_mm256_max_ps(v, vMin), vMax);
+    }
+    else
+    {
+        // _mm256_max_ps() returns its second argument if the first one is
+        // NaN, hence NaN -> 0
+        v = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(v, half), vMin), vMax);
+    }
+    return _mm256_cvttps_epi32(v);
+}
+
+// Same for 4 doubles, and Tout of at most 32 bits.
+
+template <class Tout> inline __m128i RoundClampToInt32(__m256d v)
+{
+    const __m256d vMin = _mm256_set1_pd(
+        static_cast<double>(std::numeric_limits<Tout>::lowest()));
+    const __m256d vMax =
+        _mm256_set1_pd(static_cast<double>(std::numeric_limits<Tout>::max()));
+    const __m256d half = _mm256_set1_pd(0.5);
+    if constexpr (std::is_signed_v<Tout>)
+    {
+        v = _mm256_and_pd(v, _mm256_cmp_pd(v, v, _CMP_ORD_Q));
+        v = _mm256_blendv_pd(
+            _mm256_sub_pd(v, half), _mm256_add_pd(v, half),
+            _mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_GE_OQ));
+        v = _mm256_min_pd(_mm256_max_pd(v, vMin), vMax);
+        return _mm256_cvttpd_epi32(v);
+    }
+    else
+    {
+        v = _mm256_min_pd(_mm256_max_pd(_mm256_add_pd(v, half), vMin), vMax);
+        if constexpr (std::is_same_v<Tout, GUInt32>)
+        {
+            // _mm256_cvttpd_epi32() only handles the signed range, so
+            // convert from it and flip the sign bit.
+            const __m128i i = _mm256_cvttpd_epi32(_mm256_sub_pd(
+                _mm256_floor_pd(v), _mm256_set1_pd(2147483648.0)));
+            return _mm_xor_si128(
+                i, _mm_set1_epi32(std::numeric_limits<int>::min()));
+        }
+        else
+        {
+            return _mm256_cvttpd_epi32(v);
+        }
+    }
+}
+
+/************************************************************************/
+/*                           UInt32ToDouble()                           */
+/************************************************************************/
+
+inline __m256d UInt32ToDouble(__m128i v)
+{
+    // Exact: convert from the signed range and shift back
+    return _mm256_add_pd(
+        _mm256_cvtepi32_pd(
+            _mm_xor_si128(v, _mm_set1_epi32(std::numeric_limits<int>::min()))),
+        _mm256_set1_pd(2147483648.0));
+}
+
+/************************************************************************/
+/*                       Conversion kernels                             */
+/************************************************************************/
+
+template <class Tin, class Tout>
+void ConvertIntToInt(const Tin *CPL_RESTRICT pSrc, Tout *CPL_RESTRICT pDst,
+                     size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        StoreInt32(ClampInt32<Tin, Tout>(LoadAsInt32(pSrc + i)), pDst + i);
+    }
+    for (; i < nCount; ++i)
+    {
+        GDALCopyWord(pSrc[i], pDst[i]);
+    }
+}
+
+template <class Tin>
+void ConvertIntToFloat32(const Tin *CPL_RESTRICT pSrc,
+                         float *CPL_RESTRICT pDst, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        const __m256i v = LoadAsInt32(pSrc + i);
+        if constexpr (std::is_same_v<Tin, GUInt32>)
+        {
+            // Going through double is exact, hence a single rounding
+            _mm_storeu_ps(pDst + i, _mm256_cvtpd_ps(UInt32ToDouble(
+                                        _mm256_castsi256_si128(v))));
+            _mm_storeu_ps(pDst + i + 4,
+                          _mm256_cvtpd_ps(UInt32ToDouble(
+                              _mm256_extracti128_si256(v, 1))));
+        }
+        else
+        {
+            _mm256_storeu_ps(pDst + i, _mm256_cvtepi32_ps(v));
+        }
+    }
+    for (; i < nCount; ++i)
+    {
+        GDALCopyWord(pSrc[i], pDst[i]);
+    }
+}
+
+template <class Tin>
+void ConvertIntToFloat64(const Tin *CPL_RESTRICT pSrc,
+                         double *CPL_RESTRICT pDst, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        const __m256i v = LoadAsInt32(pSrc + i);
+        const __m128i lo = _mm256_castsi256_si128(v);
+        const __m128i hi = _mm256_extracti128_si256(v, 1);
+        if constexpr (std::is_same_v<Tin, GUInt32>)
+        {
+            _mm256_storeu_pd(pDst + i, UInt32ToDouble(lo));
+            _mm256_storeu_pd(pDst + i + 4, UInt32ToDouble(hi));
+        }
+        else
+        {
+            _mm256_storeu_pd(pDst + i, _mm256_cvtepi32_pd(lo));
+            _mm256_storeu_pd(pDst + i + 4, _mm256_cvtepi32_pd(hi));
+        }
+    }
+    for (; i < nCount; ++i)
+    {
+        GDALCopyWord(pSrc[i], pDst[i]);
+    }
+}
+
+template <class Tout>
+void ConvertFloat32ToInt(const float *CPL_RESTRICT pSrc,
+                         Tout *CPL_RESTRICT pDst, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        StoreInt32(RoundClampToInt32<Tout>(_mm256_loadu_ps(pSrc + i)),
+                   pDst + i);
+    }
+    for (; i < nCount; ++i)
+    {
+        GDALCopyWord(pSrc[i], pDst[i]);
+    }
+}
+
+template <class Tout>
+void ConvertFloat64ToInt(const double *CPL_RESTRICT pSrc,
+                         Tout *CPL_RESTRICT pDst, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        const __m128i lo = RoundClampToInt32<Tout>(_mm256_loadu_pd(pSrc + i));
+        const __m128i hi =
+            RoundClampToInt32<Tout>(_mm256_loadu_pd(pSrc + i + 4));
+        StoreInt32(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1),
+                   pDst + i);
+    }
+    for (; i < nCount; ++i)
+    {
+        GDALCopyWord(pSrc[i], pDst[i]);
+    }
+}
+
+void ConvertFloat32ToFloat64(const float *CPL_RESTRICT pSrc,
+                             double *CPL_RESTRICT pDst, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        const __m256 v = _mm256_loadu_ps(pSrc + i);
+        _mm256_storeu_pd(pDst + i, _mm256_cvtps_pd(_mm256_castps256_ps128(v)));
+        _mm256_storeu_pd(pDst + i + 4,
+                         _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1)));
+    }
+    for (; i < nCount; ++i)
+    {
+        pDst[i] = pSrc[i];
+    }
+}
+
+inline __m128 DoubleToFloat(__m256d v)
+{
+    // Values beyond the float range go to infinity, as in GDALCopyWord()
+    const __m256d posMax = _mm256_set1_pd(std::numeric_limits<float>::max());
+    const __m256d posInf =
+        _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    v = _mm256_blendv_pd(v, posInf, _mm256_cmp_pd(v, posMax, _CMP_GT_OQ));
+    v = _mm256_blendv_pd(
+        v, _mm256_sub_pd(_mm256_setzero_pd(), posInf),
+        _mm256_cmp_pd(v, _mm256_sub_pd(_mm256_setzero_pd(), posMax),
+                      _CMP_LT_OQ));
+    return _mm256_cvtpd_ps(v);
+}
+
+void ConvertFloat64ToFloat32(const double *CPL_RESTRICT pSrc,
+                             float *CPL_RESTRICT pDst, size_t nCount)
+{
+    size_t i = 0;
+    for (; i + 8 <= nCount; i += 8)
+    {
+        const __m128 lo = DoubleToFloat(_mm256_loadu_pd(pSrc + i));
+        const __m128 hi = DoubleToFloat(_mm256_loadu_pd(pSrc + i + 4));
+        _mm256_storeu_ps(
+            pDst + i, _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1));
+    }
+    for (; i < nCount; ++i)
+    {
+        GDALCopyWord(pSrc[i], pDst[i]);
+    }
+}
+
+/************************************************************************/
+/*                              Convert()                               */
+/************************************************************************/
+
+template <class Tin, class Tout>
+bool Convert(const void *pSrcData, void *pDstData, size_t nWordCount)
+{
+    const Tin *pSrc = static_cast<const Tin *>(pSrcData);
+    Tout *pDst = static_cast<Tout *>(pDstData);
+    if constexpr (std::is_same_v<Tin, Tout>)
+    {
+        return false;
+    }
+    else if constexpr (std::is_same_v<Tout, float>)
+    {
+        if constexpr (std::is_same_v<Tin, double>)
+            ConvertFloat64ToFloat32(pSrc, pDst, nWordCount);
+        else
+            ConvertIntToFloat32(pSrc, pDst, nWordCount);
+    }
+    else if constexpr (std::is_same_v<Tout, double>)
+    {
+        if constexpr (std::is_same_v<Tin, float>)
+            ConvertFloat32ToFloat64(pSrc, pDst, nWordCount);
+        else
+            ConvertIntToFloat64(pSrc, pDst, nWordCount);
+    }
+    else if constexpr (std::is_same_v<Tin, float>)
+    {
+        // The rounding rules of GDALCopyWord() for 32-bit integer targets
+        // are not expressible with 32-bit float lanes.
+        if constexpr (sizeof(Tout) == 4)
+            return false;
+        else
+            ConvertFloat32ToInt(pSrc, pDst, nWordCount);
+    }
+    else if constexpr (std::is_same_v<Tin, double>)
+    {
+        ConvertFloat64ToInt(pSrc, pDst, nWordCount);
+    }
+    else
+    {
+        ConvertIntToInt(pSrc, pDst, nWordCount);
+    }
+    return true;
+}
+
+template <class Tin>
+bool ConvertFrom(const void *pSrcData, GDALDataType eDstType, void *pDstData,
+                 size_t nWordCount)
+{
+    switch (eDstType)
+    {
+        case GDT_Byte:
+            return Convert<Tin, GByte>(pSrcData, pDstData, nWordCount);
+        case GDT_Int8:
+            return Convert<Tin, GInt8>(pSrcData, pDstData, nWordCount);
+        case GDT_UInt16:
+            return Convert<Tin, GUInt16>(pSrcData, pDstData, nWordCount);
+        case GDT_Int16:
+            return Convert<Tin, GInt16>(pSrcData, pDstData, nWordCount);
+        case GDT_UInt32:
+            return Convert<Tin, GUInt32>(pSrcData, pDstData, nWordCount);
+        case GDT_Int32:
+            return Convert<Tin, GInt32>(pSrcData, pDstData, nWordCount);
+        case GDT_Float32:
+            return Convert<Tin, float>(pSrcData, pDstData, nWordCount);
+        case GDT_Float64:
+            return Convert<Tin, double>(pSrcData, pDstData, nWordCount);
+        default:
+            break;
+    }
+    return false;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                    GDALCopyWordsContiguous_AVX2()                    */
+/************************************************************************/
+
+bool GDALCopyWordsContiguous_AVX2(const void *pSrcData, GDALDataType eSrcType,
+                                  void *pDstData, GDALDataType eDstType,
+                                  size_t nWordCount)
+{
+    const bool bSrcIsComplex = CPL_TO_BOOL(GDALDataTypeIsComplex(eSrcType));
+    if (bSrcIsComplex != CPL_TO_BOOL(GDALDataTypeIsComplex(eDstType)))
+        return false;
+    if (bSrcIsComplex)
+    {
+        // Converting between complex types is converting twice as many
+        // values of their component types.
+        eSrcType = GDALGetNonComplexDataType(eSrcType);
+        eDstType = GDALGetNonComplexDataType(eDstType);
+        nWordCount *= 2;
+    }
+
+    switch (eSrcType)
+    {
+        case GDT_Byte:
+            return ConvertFrom<GByte>(pSrcData, eDstType, pDstData,
+                                      nWordCount);
+        case GDT_Int8:
+            return ConvertFrom<GInt8>(pSrcData, eDstType, pDstData,
+                                      nWordCount);
+        case GDT_UInt16:
+            return ConvertFrom<GUInt16>(pSrcData, eDstType, pDstData,
+                                        nWordCount);
+        case GDT_Int16:
+            return ConvertFrom<GInt16>(pSrcData, eDstType, pDstData,
+                                       nWordCount);
+        case GDT_UInt32:
+            return ConvertFrom<GUInt32>(pSrcData, eDstType, pDstData,
+                                        nWordCount);
+        case GDT_Int32:
+            return ConvertFrom<GInt32>(pSrcData, eDstType, pDstData,
+                                       nWordCount);
+        case GDT_Float32:
+            return ConvertFrom<float>(pSrcData, eDstType, pDstData,
+                                      nWordCount);
+        case GDT_Float64:
+            return ConvertFrom<double>(pSrcData, eDstType, pDstData,
+                                       nWordCount);
+        default:
+            break;
+    }
+    return false;
+}
+
+#endif
@@ -0,0 +1,56 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 specializations of GDALCopyWords() data type conversions
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef RASTERIO_AVX2_H_INCLUDED
+#define RASTERIO_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+#include "gdal.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) &&                                      \
+    (defined(__x86_64) || defined(_M_X64))
+
+#define HAVE_GDAL_COPYWORDS_AVX2
+
+/** Convert nWordCount packed values of type eSrcType from pSrcData into
+ * packed values of type eDstType in pDstData, with the same rounding and
+ * clamping rules as GDALCopyWord().
+ *
+ * Handled source and target data types are GDT_Byte, GDT_Int8, GDT_UInt16,
+ * GDT_Int16, GDT_UInt32, GDT_Int32, GDT_Float32 and GDT_Float64 (except
+ * GDT_Float32 to GDT_UInt32 and GDT_Int32), and conversions between complex
+ * data types with those component types.
+ *
+ * @return false if the data type pair is not handled.
+ */
+bool GDALCopyWordsContiguous_AVX2(const void *pSrcData, GDALDataType eSrcType,
+                                  void *pDstData, GDALDataType eDstType,
+                                  size_t nWordCount);
+
+#endif
+
+#endif /* RASTERIO_AVX2_H_INCLUDED */
@@ -50,9 +50,11 @@
 #include "cpl_string.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "cpl_safemaths.hpp"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           RawRasterBand()                            */
@@ -654,12 +656,36 @@ CPLErr RawRasterBand::IReadBlock(CPL_UNUSED int nBlockXOff, int nBlockYOff,
 {
     CPLAssert(nBlockXOff == 0);
 
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+
+    // If the file system can expose the file content directly (memory
+    // mapping of local files, /vsimem/), copy from it into the block buffer
+    // without going through the line buffer.
+    if (pLineBuffer != nullptr && nLoadedScanline != nBlockYOff &&
+        poDS != nullptr && poDS->GetAccess() == GA_ReadOnly &&
+        !NeedsByteOrderChange() && !(poDS->GetRasterCount() > 1 && IsBIP()))
+    {
+        const GByte *pabyView = static_cast<const GByte *>(VSIFAcquireViewL(
+            fpRawL, ComputeFileOffset(nBlockYOff), nLineSize));
+        if (pabyView)
+        {
+            const GByte *pabyLineStart =
+                nPixelOffset >= 0
+                    ? pabyView
+                    : pabyView + static_cast<std::ptrdiff_t>(-nPixelOffset) *
+                                     (nBlockXSize - 1);
+            GDALCopyWords(pabyLineStart, eDataType, nPixelOffset, pImage,
+                          eDataType, nDTSize, nBlockXSize);
+            VSIFReleaseViewL(fpRawL, pabyView, nLineSize);
+            return CE_None;
+        }
+    }
+
     const CPLErr eErr = AccessLine(nBlockYOff);
     if (eErr == CE_Failure)
         return eErr;
 
     // Copy data from disk buffer to user block buffer.
-    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
     GDALCopyWords(pLineStart, eDataType, nPixelOffset, pImage, eDataType,
                   nDTSize, nBlockXSize);
 
@@ -954,6 +980,153 @@ CPLErr RawRasterBand::AccessBlock(vsi_l_offset nBlockOff, size_t nBlockSize,
     return CE_None;
 }
 
+namespace
+{
+struct RawReadLinesJob
+{
+    const RawRasterBand *poBand = nullptr;
+    vsi_l_offset nFirstLineOffset = 0;
+    int nLines = 0;
+    size_t nBytesPerLine = 0;
+    size_t nValuesPerLine = 0;
+    int nWordSkip = 0;
+    GByte *pabyDst = nullptr;
+    GSpacing nBufLineSpace = 0;
+};
+
+/************************************************************************/
+/*                          RawPReadFully()                             */
+/************************************************************************/
+
+// Read nSize bytes at nOffset with PRead(), and zero-fill what could not be
+// read, consistently with AccessBlock().
+void RawPReadFully(VSILFILE *fp, GByte *pabyBuffer, size_t nSize,
+                   vsi_l_offset nOffset)
+{
+    size_t nRead = 0;
+    while (nRead < nSize)
+    {
+        const size_t nRet =
+            fp->PRead(pabyBuffer + nRead, nSize - nRead, nOffset + nRead);
+        if (nRet == 0 || nRet > nSize - nRead)
+            break;
+        nRead += nRet;
+    }
+    if (nRead < nSize)
+        memset(pabyBuffer + nRead, 0, nSize - nRead);
+}
+}  // namespace
+
+/************************************************************************/
+/*                           ReadLinesJob()                             */
+/************************************************************************/
+
+void RawRasterBand::ReadLinesJob(void *pData)
+{
+    const auto psJob = static_cast<const RawReadLinesJob *>(pData);
+    const RawRasterBand *poBand = psJob->poBand;
+    const bool bNeedsByteOrderChange = poBand->NeedsByteOrderChange();
+
+    if (psJob->nBytesPerLine == static_cast<size_t>(poBand->nLineOffset) &&
+        psJob->nBufLineSpace == poBand->nLineOffset)
+    {
+        // Lines are contiguous both in the file and in the output buffer:
+        // issue a single read.
+        RawPReadFully(poBand->fpRawL, psJob->pabyDst,
+                      psJob->nBytesPerLine * psJob->nLines,
+                      psJob->nFirstLineOffset);
+        if (bNeedsByteOrderChange)
+        {
+            poBand->DoByteSwap(psJob->pabyDst,
+                               psJob->nValuesPerLine * psJob->nLines,
+                               psJob->nWordSkip, true);
+        }
+        return;
+    }
+
+    for (int i = 0; i < psJob->nLines; ++i)
+    {
+        GByte *pabyLine = psJob->pabyDst + i * psJob->nBufLineSpace;
+        RawPReadFully(poBand->fpRawL, pabyLine, psJob->nBytesPerLine,
+                      psJob->nFirstLineOffset +
+                          static_cast<vsi_l_offset>(i) * poBand->nLineOffset);
+        if (bNeedsByteOrderChange)
+        {
+            poBand->DoByteSwap(pabyLine, psJob->nValuesPerLine,
+                               psJob->nWordSkip, true);
+        }
+    }
+}
+
+/************************************************************************/
+/*                      ReadLinesMultiThreaded()                        */
+/************************************************************************/
+
+// Read nLines consecutive lines, each of nBytesPerLine bytes, starting at
+// nFirstLineOffset in the file, directly into pabyDst, by splitting them
+// among worker threads issuing concurrent PRead() calls, when
+// GDAL_NUM_THREADS is set to a value >= 2.
+// Returns false if that strategy cannot be used, in which case the caller
+// must read the data itself.
+bool RawRasterBand::ReadLinesMultiThreaded(vsi_l_offset nFirstLineOffset,
+                                           int nLines, size_t nBytesPerLine,
+                                           size_t nValuesPerLine,
+                                           int nWordSkip, GByte *pabyDst,
+                                           GSpacing nBufLineSpace) const
+{
+    // PRead() bypasses the buffers of the handle, so do not mix it with
+    // possibly pending writes.
+    if (nLineOffset <= 0 || eAccess != GA_ReadOnly || nLines <= 1 ||
+        !fpRawL->HasPRead())
+    {
+        return false;
+    }
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    // Do not bother dispatching jobs reading less than 1 MB each
+    constexpr size_t MIN_BYTES_PER_JOB = 1024 * 1024;
+    nThreads = static_cast<int>(std::min<size_t>(
+        std::min(std::min(nThreads, 128), nLines),
+        nBytesPerLine * nLines / MIN_BYTES_PER_JOB));
+    if (nThreads <= 1)
+        return false;
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+        return false;
+
+    CPLDebugOnly("RAW", "Reading %d lines with %d threads", nLines, nThreads);
+
+    const int nLinesPerJob = DIV_ROUND_UP(nLines, nThreads);
+    std::vector<RawReadLinesJob> asJobs(nThreads);
+    for (int i = 0; i < nThreads; ++i)
+    {
+        const int iFirstLine = i * nLinesPerJob;
+        if (iFirstLine >= nLines)
+            break;
+        auto &sJob = asJobs[i];
+        sJob.poBand = this;
+        sJob.nFirstLineOffset =
+            nFirstLineOffset +
+            static_cast<vsi_l_offset>(iFirstLine) * nLineOffset;
+        sJob.nLines = std::min(nLinesPerJob, nLines - iFirstLine);
+        sJob.nBytesPerLine = nBytesPerLine;
+        sJob.nValuesPerLine = nValuesPerLine;
+        sJob.nWordSkip = nWordSkip;
+        sJob.pabyDst = pabyDst + iFirstLine * nBufLineSpace;
+        sJob.nBufLineSpace = nBufLineSpace;
+        if (!poJobQueue->SubmitJob(ReadLinesJob, &sJob))
+            ReadLinesJob(&sJob);
+    }
+    poJobQueue->WaitCompletion();
+
+    return true;
+}
+
 /************************************************************************/
 /*               IsSignificantNumberOfLinesLoaded()                     */
 /*                                                                      */
@@ -1137,7 +1310,15 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
             const size_t nValues = static_cast<size_t>(nXSize) * nYSize;
             const size_t nBytesToRead = nValues * nBandDataSize;
-            AccessBlock(nOffset, nBytesToRead, pData, nValues);
+            if (!ReadLinesMultiThreaded(nOffset, nYSize,
+                                        static_cast<size_t>(nXSize) *
+                                            nBandDataSize,
+                                        nXSize, std::abs(nPixelOffset),
+                                        static_cast<GByte *>(pData),
+                                        nLineSpace))
+            {
+                AccessBlock(nOffset, nBytesToRead, pData, nValues);
+            }
         }
         // 2. Case when we need deinterleave and/or subsample data.
         else
@@ -1673,6 +1854,18 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
             const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
             const bool bNeedsByteOrderChange =
                 poFirstBand->NeedsByteOrderChange();
+            if (poFirstBand->ReadLinesMultiThreaded(
+                    poFirstBand->nImgOffset +
+                        static_cast<vsi_l_offset>(nYOff) *
+                            poFirstBand->nLineOffset +
+                        static_cast<vsi_l_offset>(nXOff) *
+                            poFirstBand->nPixelOffset,
+                    nYSize, static_cast<size_t>(nXSize * nPixelSpace),
+                    static_cast<size_t>(nXSize) * nBands, nDTSize,
+                    static_cast<GByte *>(pData), nLineSpace))
+            {
+                return CE_None;
+            }
             for (int iY = 0; iY < nYSize; ++iY)
             {
                 GByte *pabyOut = static_cast<GByte *>(pData) + iY * nLineSpace;
@@ -256,6 +256,11 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     vsi_l_offset ComputeFileOffset(int iLine) const;
     bool FlushCurrentLine(bool bNeedUsableBufferAfter);
     CPLErr BIPWriteBlock(int nBlockYOff, int nCallingBand, const void *pImage);
+    bool ReadLinesMultiThreaded(vsi_l_offset nFirstLineOffset, int nLines,
+                                size_t nBytesPerLine, size_t nValuesPerLine,
+                                int nWordSkip, GByte *pabyDst,
+                                GSpacing nBufLineSpace) const;
+    static void ReadLinesJob(void *pData);
 };
 
 #ifdef GDAL_COMPILATION
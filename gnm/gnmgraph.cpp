@@ -31,6 +31,7 @@
 #include "gnmgraph.h"
 #include "gnm_priv.h"
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <set>
 
@@ -51,6 +52,7 @@ void GNMGraph::AddVertex(GNMGFID nFID)
     GNMStdVertex stVertex;
     stVertex.bIsBlocked = false;
     m_mstVertices[nFID] = std::move(stVertex);
+    m_oCSR.bTopologyValid = false;
 }
 
 void GNMGraph::DeleteVertex(GNMGFID nFID)
@@ -68,6 +70,7 @@ void GNMGraph::DeleteVertex(GNMGFID nFID)
     }
     for (size_t i = 0; i < aoIdsToErase.size(); i++)
         m_mstEdges.erase(aoIdsToErase[i]);
+    m_oCSR.bTopologyValid = false;
 }
 
 void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
@@ -103,6 +106,7 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
     stEdge.bIsBlocked = false;
 
     m_mstEdges[nConFID] = stEdge;
+    m_oCSR.bTopologyValid = false;
 
     if (bIsBidir)
     {
@@ -118,6 +122,7 @@ void GNMGraph::AddEdge(GNMGFID nConFID, GNMGFID nSrcFID, GNMGFID nTgtFID,
 void GNMGraph::DeleteEdge(GNMGFID nConFID)
 {
     m_mstEdges.erase(nConFID);
+    m_oCSR.bTopologyValid = false;
 
     // remove edge from all vertices anOutEdgeFIDs
     for (auto &it : m_mstVertices)
@@ -136,11 +141,14 @@ void GNMGraph::ChangeEdge(GNMGFID nFID, double dfCost, double dfInvCost)
     {
         it->second.dfDirCost = dfCost;
         it->second.dfInvCost = dfInvCost;
+        m_oCSR.bAttributesValid = false;
     }
 }
 
 void GNMGraph::ChangeBlockState(GNMGFID nFID, bool bBlock)
 {
+    m_oCSR.bAttributesValid = false;
+
     // check vertices
     std::map<GNMGFID, GNMStdVertex>::iterator itv = m_mstVertices.find(nFID);
     if (itv != m_mstVertices.end())
@@ -168,6 +176,8 @@ bool GNMGraph::CheckVertexBlocked(GNMGFID nFID) const
 
 void GNMGraph::ChangeAllBlockState(bool bBlock)
 {
+    m_oCSR.bAttributesValid = false;
+
     for (std::map<GNMGFID, GNMStdVertex>::iterator itv = m_mstVertices.begin();
          itv != m_mstVertices.end(); ++itv)
     {
@@ -181,67 +191,238 @@ void GNMGraph::ChangeAllBlockState(bool bBlock)
     }
 }
 
-GNMPATH
-GNMGraph::DijkstraShortestPath(GNMGFID nStartFID, GNMGFID nEndFID,
-                               const std::map<GNMGFID, GNMStdEdge> &mstEdges)
+void GNMGraph::UpdateCSR()
+{
+    CSRGraph &oCSR = m_oCSR;
+    if (!oCSR.bTopologyValid)
+    {
+        // Vertices are the ones of m_mstVertices, plus the ones that would be
+        // only referenced by edges.
+        oCSR.anVertexFIDs.clear();
+        oCSR.anVertexFIDs.reserve(m_mstVertices.size());
+        for (const auto &oIter : m_mstVertices)
+            oCSR.anVertexFIDs.push_back(oIter.first);
+        bool bExtraVertices = false;
+        oCSR.anEdgeFIDs.clear();
+        oCSR.anEdgeFIDs.reserve(m_mstEdges.size());
+        for (const auto &oIter : m_mstEdges)
+        {
+            oCSR.anEdgeFIDs.push_back(oIter.first);
+            for (const GNMGFID nFID :
+                 {oIter.second.nSrcVertexFID, oIter.second.nTgtVertexFID})
+            {
+                if (m_mstVertices.find(nFID) == m_mstVertices.end())
+                {
+                    oCSR.anVertexFIDs.push_back(nFID);
+                    bExtraVertices = true;
+                }
+            }
+        }
+        if (bExtraVertices)
+        {
+            std::sort(oCSR.anVertexFIDs.begin(), oCSR.anVertexFIDs.end());
+            oCSR.anVertexFIDs.erase(std::unique(oCSR.anVertexFIDs.begin(),
+                                                oCSR.anVertexFIDs.end()),
+                                    oCSR.anVertexFIDs.end());
+        }
+
+        // Out arcs of each vertex, in the order of GNMStdVertex::anOutEdgeFIDs
+        oCSR.anArcOffsets.assign(1, 0);
+        oCSR.anArcTargets.clear();
+        oCSR.anArcEdges.clear();
+        for (const GNMGFID nVertexFID : oCSR.anVertexFIDs)
+        {
+            LPGNMCONSTVECTOR panOutEdgeFIDs = GetOutEdges(nVertexFID);
+            if (panOutEdgeFIDs)
+            {
+                for (const GNMGFID nEdgeFID : *panOutEdgeFIDs)
+                {
+                    const int iEdge = GetCSREdgeIndex(nEdgeFID);
+                    if (iEdge < 0)
+                        continue;
+                    const int iTarget = GetCSRVertexIndex(
+                        GetOppositVertex(nEdgeFID, nVertexFID));
+                    if (iTarget < 0)
+                        continue;
+                    oCSR.anArcTargets.push_back(iTarget);
+                    oCSR.anArcEdges.push_back(iEdge);
+                }
+            }
+            oCSR.anArcOffsets.push_back(oCSR.anArcTargets.size());
+        }
+
+        oCSR.bTopologyValid = true;
+        oCSR.bAttributesValid = false;
+    }
+
+    if (!oCSR.bAttributesValid)
+    {
+        // Edges are indexed in the order of m_mstEdges
+        oCSR.adfEdgeCosts.clear();
+        oCSR.abEdgeBlocked.clear();
+        oCSR.adfEdgeCosts.reserve(m_mstEdges.size());
+        oCSR.abEdgeBlocked.reserve(m_mstEdges.size());
+        for (const auto &oIter : m_mstEdges)
+        {
+            oCSR.adfEdgeCosts.push_back(oIter.second.dfDirCost);
+            oCSR.abEdgeBlocked.push_back(oIter.second.bIsBlocked);
+        }
+
+        oCSR.abVertexBlocked.assign(oCSR.anVertexFIDs.size(), false);
+        for (size_t i = 0; i < oCSR.anVertexFIDs.size(); ++i)
+            oCSR.abVertexBlocked[i] = CheckVertexBlocked(oCSR.anVertexFIDs[i]);
+
+        oCSR.bAttributesValid = true;
+    }
+}
+
+int GNMGraph::GetCSRVertexIndex(GNMGFID nFID) const
 {
-    std::map<GNMGFID, GNMGFID> mnShortestTree;
-    DijkstraShortestPathTree(nStartFID, mstEdges, mnShortestTree);
+    const auto &anFIDs = m_oCSR.anVertexFIDs;
+    const auto oIter = std::lower_bound(anFIDs.begin(), anFIDs.end(), nFID);
+    if (oIter == anFIDs.end() || *oIter != nFID)
+        return -1;
+    return static_cast<int>(oIter - anFIDs.begin());
+}
 
-    // We search for a path in the resulting tree, starting from end point to
-    // start point.
+int GNMGraph::GetCSREdgeIndex(GNMGFID nFID) const
+{
+    const auto &anFIDs = m_oCSR.anEdgeFIDs;
+    const auto oIter = std::lower_bound(anFIDs.begin(), anFIDs.end(), nFID);
+    if (oIter == anFIDs.end() || *oIter != nFID)
+        return -1;
+    return static_cast<int>(oIter - anFIDs.begin());
+}
 
+// Dijkstra algorithm on the CSR representation, with a binary heap, stopping
+// as soon as the end vertex is reached. Vertices with the same mark are
+// processed in the order they were reached, so that the returned path is the
+// same as the one found in the tree built by DijkstraShortestPathTree().
+GNMPATH GNMGraph::DijkstraShortestPathCSR(
+    GNMGFID nStartFID, GNMGFID nEndFID, const std::vector<double> &adfEdgeCosts,
+    const std::vector<bool> &abEdgeBlocked)
+{
     GNMPATH aoShortestPath;
-    GNMGFID nNextVertexId = nEndFID;
-    std::map<GNMGFID, GNMGFID>::iterator it;
-    EDGEVERTEXPAIR buf;
+    if (nStartFID == nEndFID)
+    {
+        aoShortestPath.push_back(std::make_pair(nStartFID, -1));
+        return aoShortestPath;
+    }
+
+    const CSRGraph &oCSR = m_oCSR;
+    const int iStart = GetCSRVertexIndex(nStartFID);
+    const int iEnd = GetCSRVertexIndex(nEndFID);
+    if (iStart < 0 || iEnd < 0)
+        return aoShortestPath;
+
+    const size_t nVertices = oCSR.anVertexFIDs.size();
+    std::vector<double> adfMarks(nVertices,
+                                 std::numeric_limits<double>::infinity());
+    std::vector<int> anPathTreeEdges(nVertices, -1);
+    std::vector<int> anPathTreeVertices(nVertices, -1);
+    std::vector<bool> abSeen(nVertices, false);
 
-    while (true)
+    struct HeapItem
     {
-        it = mnShortestTree.find(nNextVertexId);
+        double dfMark;
+        size_t nOrder;  // to process equal marks in insertion order
+        int iVertex;
 
-        if (it == mnShortestTree.end())
+        bool operator>(const HeapItem &other) const
         {
-            // We haven't found the start vertex - there is no path between
-            // to given vertices in a shortest-path tree.
-            break;
+            if (dfMark != other.dfMark)
+                return dfMark > other.dfMark;
+            return nOrder > other.nOrder;
         }
-        else if (it->first == nStartFID)
+    };
+
+    std::priority_queue<HeapItem, std::vector<HeapItem>,
+                        std::greater<HeapItem>>
+        oToSee;
+    size_t nOrder = 0;
+    adfMarks[iStart] = 0.0;
+    oToSee.push(HeapItem{0.0, nOrder++, iStart});
+
+    while (!oToSee.empty())
+    {
+        const HeapItem oItem = oToSee.top();
+        oToSee.pop();
+
+        const int iVertex = oItem.iVertex;
+        // Skip outdated items of already seen vertices
+        if (abSeen[iVertex])
+            continue;
+        abSeen[iVertex] = true;
+        if (iVertex == iEnd)
+            break;
+
+        for (size_t iArc = oCSR.anArcOffsets[iVertex];
+             iArc < oCSR.anArcOffsets[iVertex + 1]; ++iArc)
         {
-            // We've reached the start vertex and return an array.
-            aoShortestPath.push_back(std::make_pair(nNextVertexId, -1));
+            const int iEdge = oCSR.anArcEdges[iArc];
+            if (abEdgeBlocked[iEdge])
+                continue;
 
-            // Revert array because the first vertex is now the last in path.
-            int size = static_cast<int>(aoShortestPath.size());
-            for (int i = 0; i < size / 2; ++i)
+            // We go in any edge from source to target so we take only
+            // direct cost (even if an edge is bi-directed).
+            const double dfNewVertexMark = oItem.dfMark + adfEdgeCosts[iEdge];
+
+            const int iTarget = oCSR.anArcTargets[iArc];
+            if (!abSeen[iTarget] && dfNewVertexMark < adfMarks[iTarget] &&
+                !oCSR.abVertexBlocked[iTarget])
             {
-                buf = aoShortestPath[i];
-                aoShortestPath[i] = aoShortestPath[size - i - 1];
-                aoShortestPath[size - i - 1] = buf;
+                adfMarks[iTarget] = dfNewVertexMark;
+                anPathTreeEdges[iTarget] = iEdge;
+                anPathTreeVertices[iTarget] = iVertex;
+                oToSee.push(HeapItem{dfNewVertexMark, nOrder++, iTarget});
             }
-            return aoShortestPath;
         }
-        else
+    }
+
+    if (anPathTreeEdges[iEnd] < 0)
+        return aoShortestPath;
+
+    // Walk the path tree from end point to start point.
+    for (int iVertex = iEnd; iVertex != iStart;
+         iVertex = anPathTreeVertices[iVertex])
+    {
+        aoShortestPath.push_back(
+            std::make_pair(oCSR.anVertexFIDs[iVertex],
+                           oCSR.anEdgeFIDs[anPathTreeEdges[iVertex]]));
+    }
+    aoShortestPath.push_back(std::make_pair(nStartFID, -1));
+    std::reverse(aoShortestPath.begin(), aoShortestPath.end());
+    return aoShortestPath;
+}
+
+GNMPATH
+GNMGraph::DijkstraShortestPath(GNMGFID nStartFID, GNMGFID nEndFID,
+                               const std::map<GNMGFID, GNMStdEdge> &mstEdges)
+{
+    UpdateCSR();
+
+    // Edges missing from mstEdges are considered as blocked
+    std::vector<double> adfEdgeCosts(m_oCSR.anEdgeFIDs.size(), 0.0);
+    std::vector<bool> abEdgeBlocked(m_oCSR.anEdgeFIDs.size(), true);
+    for (const auto &oIter : mstEdges)
+    {
+        const int iEdge = GetCSREdgeIndex(oIter.first);
+        if (iEdge >= 0)
         {
-            // There is only one edge which leads to this vertex, because we
-            // analyse a tree. We add this edge with its target vertex into
-            // final array.
-            aoShortestPath.push_back(std::make_pair(nNextVertexId, it->second));
-
-            // An edge has only two vertices, so we get the opposite one to the
-            // current vertex in order to continue search backwards.
-            nNextVertexId = GetOppositVertex(it->second, it->first);
+            adfEdgeCosts[iEdge] = oIter.second.dfDirCost;
+            abEdgeBlocked[iEdge] = oIter.second.bIsBlocked;
         }
     }
 
-    // return empty array
-    GNMPATH oRet;
-    return oRet;
+    return DijkstraShortestPathCSR(nStartFID, nEndFID, adfEdgeCosts,
+                                   abEdgeBlocked);
 }
 
 GNMPATH GNMGraph::DijkstraShortestPath(GNMGFID nStartFID, GNMGFID nEndFID)
 {
-    return DijkstraShortestPath(nStartFID, nEndFID, m_mstEdges);
+    UpdateCSR();
+    return DijkstraShortestPathCSR(nStartFID, nEndFID, m_oCSR.adfEdgeCosts,
+                                   m_oCSR.abEdgeBlocked);
 }
 
 std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
@@ -270,20 +451,26 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
 
     A.push_back(aoFirstPath);
 
-    size_t i, k, l;
+    size_t i, k;
     GNMPATH::iterator itAk, tempIt, itR;
     std::vector<GNMPATH>::iterator itA;
-    std::map<GNMGFID, double>::iterator itDel;
+    std::map<int, double>::iterator itDel;
     GNMPATH aoRootPath, aoRootPathOther, aoSpurPath;
-    GNMGFID nSpurNode, nVertexToDel, nEdgeToDel;
+    GNMGFID nSpurNode;
     double dfSumCost;
 
-    std::map<GNMGFID, GNMStdEdge> mstEdges = m_mstEdges;
+    // Costs of the edges, indexed as in m_oCSR.anEdgeFIDs
+    UpdateCSR();
+    std::vector<double> adfEdgeCosts = m_oCSR.adfEdgeCosts;
+    const auto GetEdgeCost = [this, &adfEdgeCosts](GNMGFID nEdgeFID)
+    {
+        const int iEdge = GetCSREdgeIndex(nEdgeFID);
+        return iEdge >= 0 ? adfEdgeCosts[iEdge] : 0.0;
+    };
 
     for (k = 0; k < nK - 1; ++k)  // -1 because we have already found one
     {
-        std::map<GNMGFID, double>
-            mDeletedEdges;  // for infinity costs assignment
+        std::map<int, double> mDeletedEdges;  // for infinity costs assignment
         itAk = A[k].begin();
 
         for (i = 0; i < A[k].size() - 1; ++i)  // avoid end node
@@ -331,10 +518,14 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
                     (i < aoRootPathOther.size()))
                 {
                     tempIt = itA->begin() + i + 1;
-                    mDeletedEdges.insert(std::make_pair(
-                        tempIt->second, mstEdges[tempIt->second].dfDirCost));
-                    mstEdges[tempIt->second].dfDirCost =
-                        std::numeric_limits<double>::infinity();
+                    const int iEdge = GetCSREdgeIndex(tempIt->second);
+                    if (iEdge >= 0)
+                    {
+                        mDeletedEdges.insert(
+                            std::make_pair(iEdge, adfEdgeCosts[iEdge]));
+                        adfEdgeCosts[iEdge] =
+                            std::numeric_limits<double>::infinity();
+                    }
                 }
             }
 
@@ -347,20 +538,23 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
             // end()-1, because we should not remove the spur node
             for (itR = aoRootPath.begin(); itR != aoRootPath.end() - 1; ++itR)
             {
-                nVertexToDel = itR->first;
-                for (l = 0;
-                     l < m_mstVertices[nVertexToDel].anOutEdgeFIDs.size(); ++l)
+                const int iVertexToDel = GetCSRVertexIndex(itR->first);
+                if (iVertexToDel < 0)
+                    continue;
+                for (size_t iArc = m_oCSR.anArcOffsets[iVertexToDel];
+                     iArc < m_oCSR.anArcOffsets[iVertexToDel + 1]; ++iArc)
                 {
-                    nEdgeToDel = m_mstVertices[nVertexToDel].anOutEdgeFIDs[l];
-                    mDeletedEdges.insert(std::make_pair(
-                        nEdgeToDel, mstEdges[nEdgeToDel].dfDirCost));
-                    mstEdges[nEdgeToDel].dfDirCost =
+                    const int iEdgeToDel = m_oCSR.anArcEdges[iArc];
+                    mDeletedEdges.insert(
+                        std::make_pair(iEdgeToDel, adfEdgeCosts[iEdgeToDel]));
+                    adfEdgeCosts[iEdgeToDel] =
                         std::numeric_limits<double>::infinity();
                 }
             }
 
             // Find the new best path in the modified graph.
-            aoSpurPath = DijkstraShortestPath(nSpurNode, nEndFID, mstEdges);
+            aoSpurPath = DijkstraShortestPathCSR(
+                nSpurNode, nEndFID, adfEdgeCosts, m_oCSR.abEdgeBlocked);
 
             // Firstly, restore deleted edges in order to calculate the summary
             // cost of the path correctly later, because the costs will be
@@ -370,7 +564,7 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
             for (itDel = mDeletedEdges.begin(); itDel != mDeletedEdges.end();
                  ++itDel)
             {
-                mstEdges[itDel->first].dfDirCost = itDel->second;
+                adfEdgeCosts[itDel->first] = itDel->second;
             }
 
             mDeletedEdges.clear();
@@ -392,7 +586,7 @@ std::vector<GNMPATH> GNMGraph::KShortestPaths(GNMGFID nStartFID,
                     // infinity, because every time we assign infinity costs for
                     // edges of old paths, we anyway have the alternative edges
                     // with non-infinity costs.
-                    dfSumCost += mstEdges[itR->second].dfDirCost;
+                    dfSumCost += GetEdgeCost(itR->second);
                 }
 
                 B.insert(std::make_pair(dfSumCost, aoRootPath));
@@ -452,6 +646,7 @@ void GNMGraph::Clear()
 {
     m_mstVertices.clear();
     m_mstEdges.clear();
+    m_oCSR = CSRGraph();
 }
 
 void GNMGraph::DijkstraShortestPathTree(
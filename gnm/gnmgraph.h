@@ -251,6 +251,39 @@ class CPL_DLL GNMGraph
     std::map<GNMGFID, GNMStdVertex> m_mstVertices;
     std::map<GNMGFID, GNMStdEdge> m_mstEdges;
     //! @endcond
+
+  private:
+    //! @cond Doxygen_Suppress
+
+    // Compressed sparse row (CSR) representation of the graph used by the
+    // shortest path algorithms. It is lazily rebuilt from m_mstVertices and
+    // m_mstEdges when they have been modified: bTopologyValid is reset when
+    // vertices or edges are added or removed, bAttributesValid when costs or
+    // block states change.
+    struct CSRGraph
+    {
+        bool bTopologyValid = false;
+        bool bAttributesValid = false;
+        std::vector<GNMGFID> anVertexFIDs{};  // sorted
+        std::vector<GNMGFID> anEdgeFIDs{};    // sorted
+        // Out arcs of vertex i are in [anArcOffsets[i], anArcOffsets[i+1])
+        std::vector<size_t> anArcOffsets{};
+        std::vector<int> anArcTargets{};  // index of the target vertex
+        std::vector<int> anArcEdges{};    // index of the edge
+        std::vector<double> adfEdgeCosts{};
+        std::vector<bool> abEdgeBlocked{};
+        std::vector<bool> abVertexBlocked{};
+    };
+
+    CSRGraph m_oCSR{};
+
+    void UpdateCSR();
+    int GetCSRVertexIndex(GNMGFID nFID) const;
+    int GetCSREdgeIndex(GNMGFID nFID) const;
+    GNMPATH DijkstraShortestPathCSR(GNMGFID nStartFID, GNMGFID nEndFID,
+                                    const std::vector<double> &adfEdgeCosts,
+                                    const std::vector<bool> &abEdgeBlocked);
+    //! @endcond
 };
 
 #endif  // __cplusplus
@@ -47,6 +47,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -580,6 +581,51 @@ static bool ParseGMLCoordinates(const CPLXMLNode *psGeomNode,
             return true;
         }
 
+        // Fast path for curves: decode the coordinates into arrays, and
+        // assign them to the curve at once.
+        const OGRwkbGeometryType eType =
+            wkbFlatten(poGeometry->getGeometryType());
+        if ((eType == wkbLineString || eType == wkbCircularString) &&
+            poGeometry->toSimpleCurve()->getNumPoints() == 0 &&
+            (nDimension == 3 || !poGeometry->Is3D()) &&
+            !poGeometry->IsMeasured())
+        {
+            std::vector<double> adfX, adfY, adfZ;
+            const char *pszCur = pszPosList;
+            while (true)
+            {
+                const char *pszX = GMLGetCoordTokenPos(pszCur, &pszCur);
+                if (pszX == nullptr && !adfX.empty())
+                    break;
+                const char *pszY = (pszCur[0] != '\0')
+                                       ? GMLGetCoordTokenPos(pszCur, &pszCur)
+                                       : nullptr;
+                const char *pszZ = (nDimension == 3 && pszCur[0] != '\0')
+                                       ? GMLGetCoordTokenPos(pszCur, &pszCur)
+                                       : nullptr;
+
+                if (pszY == nullptr || (nDimension == 3 && pszZ == nullptr))
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Did not get at least %d values or invalid "
+                             "number of set of coordinates "
+                             "<gml:posList>%s</gml:posList>",
+                             nDimension, pszPosList);
+                    return false;
+                }
+
+                adfX.push_back(OGRFastAtof(pszX));
+                adfY.push_back(OGRFastAtof(pszY));
+                if (pszZ)
+                    adfZ.push_back(OGRFastAtof(pszZ));
+            }
+
+            poGeometry->toSimpleCurve()->setPoints(
+                static_cast<int>(adfX.size()), adfX.data(), adfY.data(),
+                nDimension == 3 ? adfZ.data() : nullptr);
+            return true;
+        }
+
         bool bSuccess = false;
         const char *pszCur = pszPosList;
         while (true)
@@ -738,6 +738,8 @@ void CPL_DLL OGR_L_SetSpatialFilterRectEx(OGRLayerH, int iGeomField,
 OGRErr CPL_DLL OGR_L_SetAttributeFilter(OGRLayerH, const char *);
 void CPL_DLL OGR_L_ResetReading(OGRLayerH);
 OGRFeatureH CPL_DLL OGR_L_GetNextFeature(OGRLayerH) CPL_WARN_UNUSED_RESULT;
+OGRFeatureH CPL_DLL OGR_L_GetNextFeatureReusing(OGRLayerH, OGRFeatureH)
+    CPL_WARN_UNUSED_RESULT;
 
 /** Conveniency macro to iterate over features of a layer.
  *
@@ -895,11 +895,23 @@ class CPL_DLL OGRFeature
     GIntBig nFID;
     OGRFeatureDefn *poDefn;
     OGRGeometry **papoGeometries;
+    //! @cond Doxygen_Suppress
+    struct LazyGeometry;
+    // Geometries set with SetGeomFieldLazyWKB() not yet decoded, or nullptr
+    LazyGeometry **m_papoLazyGeometries;
+    //! @endcond
     OGRField *pauFields;
+    // Whether papoGeometries is allocated in the same block as pauFields
+    bool m_bGeometriesInFieldBlock;
     char *m_pszNativeData;
     char *m_pszNativeMediaType;
 
     bool SetFieldInternal(int i, const OGRField *puValue);
+    void MaterializeGeometry(int iField) const;
+    void MaterializeGeometries() const;
+    void DiscardLazyGeometry(int iField);
+    void DiscardLazyGeometries();
+    void DetachGeometriesFromFieldBlock();
 
   protected:
     //! @cond Doxygen_Suppress
@@ -1225,6 +1237,9 @@ class CPL_DLL OGRFeature
     const OGRGeometry *GetGeomFieldRef(const char *pszFName) const;
     OGRErr SetGeomFieldDirectly(int iField, OGRGeometry *);
     OGRErr SetGeomField(int iField, const OGRGeometry *);
+    bool SetGeomFieldLazyWKB(int iField, const GByte *pabyWKB, size_t nWKBSize,
+                             const OGREnvelope *psEnvelope = nullptr);
+    bool GetGeomFieldEnvelope(int iField, OGREnvelope &sEnvelope) const;
 
     void Reset();
 
@@ -1950,6 +1965,7 @@ class OGRLayer;
 class swq_expr_node;
 class swq_custom_func_registrar;
 struct swq_evaluation_context;
+class OGRFeatureQueryBytecode;
 
 class CPL_DLL OGRFeatureQuery
 {
@@ -1957,6 +1973,8 @@ class CPL_DLL OGRFeatureQuery
     OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
     swq_evaluation_context *m_psContext = nullptr;
+    // Faster alternative to the evaluation of pSWQExpr, when possible
+    OGRFeatureQueryBytecode *m_poBytecode = nullptr;
 
     char **FieldCollector(void *, char **);
 
@@ -125,6 +125,8 @@ class OGRRawPoint
 typedef struct GEOSGeom_t *GEOSGeom;
 /** GEOS context handle type */
 typedef struct GEOSContextHandle_HS *GEOSContextHandle_t;
+/** GEOS coordinate sequence type */
+struct GEOSCoordSeq_t;
 /** SFCGAL geometry type */
 typedef void sfcgal_geometry_t;
 
@@ -1695,6 +1697,15 @@ class CPL_DLL OGRSimpleCurve : public OGRCurve
                     const double *padfMIn = nullptr);
     void setPoints(int, const double *padfX, const double *padfY,
                    const double *padfZIn, const double *padfMIn);
+
+    //! @cond Doxygen_Suppress
+    GEOSCoordSeq_t *exportToGEOSCoordSeq(GEOSContextHandle_t hGEOSCtxt,
+                                         bool bWithM) const;
+    bool importFromGEOSCoordSeq(GEOSContextHandle_t hGEOSCtxt,
+                                const GEOSCoordSeq_t *hCoordSeq, bool bHasZ,
+                                bool bHasM);
+    //! @endcond
+
     void addPoint(const OGRPoint *);
     void addPoint(double, double);
     void addPoint(double, double, double);
@@ -38,6 +38,13 @@
 #define GEOS_USE_ONLY_R_API
 
 #include <geos_c.h>
+
+// GEOSCoordSeq_copyFromBuffer_r() and GEOSCoordSeq_copyToBuffer_r()
+// are available since GEOS 3.10
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 10)
+#define HAVE_GEOS_COORDSEQ_BUFFER
+#endif
 #else
 
 namespace geos
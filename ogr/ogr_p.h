@@ -101,6 +101,10 @@ void CPL_DLL OGRFormatDouble(char *pszBuffer, int nBufferLen, double dfVal,
                              char chDecimalSep, int nPrecision = 15,
                              char chConversionSpecifier = 'f');
 
+int CPL_DLL OGRFormatDoublePrecision(char *pszBuffer, size_t nBufferLen,
+                                     double dfVal, int nPrecision,
+                                     char chConversionSpecifier);
+
 #ifdef OGR_GEOMETRY_H_INCLUDED
 std::string CPL_DLL OGRFormatDouble(double val, const OGRWktOptions &opts,
                                     int nDimIdx);
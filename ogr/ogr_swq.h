@@ -305,6 +305,7 @@ const char CPL_UNSTABLE_API *SWQFieldTypeToString(swq_field_type field_type);
 #define SWQM_SUMMARY_RECORD 1
 #define SWQM_RECORDSET 2
 #define SWQM_DISTINCT_LIST 3
+#define SWQM_GROUP_BY 4
 
 typedef enum
 {
@@ -371,6 +372,14 @@ typedef struct
     int ascending_flag;
 } swq_order_def;
 
+typedef struct
+{
+    char *table_name;
+    char *field_name;
+    int table_index;
+    int field_index;
+} swq_group_by_def;
+
 typedef struct
 {
     int secondary_table;
@@ -436,6 +445,9 @@ class CPL_UNSTABLE_API swq_select
 
     swq_expr_node *where_expr = nullptr;
 
+    void PushGroupBy(const char *pszTableName, const char *pszFieldName);
+    std::vector<swq_group_by_def> group_by_defs{};
+
     void PushOrderBy(const char *pszTableName, const char *pszFieldName,
                      int bAscending);
     int order_specs = 0;
@@ -475,6 +487,11 @@ const char CPL_UNSTABLE_API *swq_select_summarize(swq_select *select_info,
                                                   int dest_column,
                                                   const char *value);
 
+const char CPL_UNSTABLE_API *
+swq_select_summarize_group(swq_select *select_info,
+                           std::vector<swq_summary> &group_summary,
+                           int dest_column, const char *value);
+
 int CPL_UNSTABLE_API swq_is_reserved_keyword(const char *pszStr);
 
 char CPL_UNSTABLE_API *OGRHStoreGetValue(const char *pszHStore,
@@ -1072,6 +1072,198 @@ void OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb, size_t nWKBSize)
         pabyWkb, nWKBSize, iOffsetInOut, /* nRec = */ 0);
 }
 
+/************************************************************************/
+/*                    OGRWKBTransformCollectPoints()                    */
+/************************************************************************/
+
+// Appends to oCache the offset of each (non empty) point of the geometry.
+static bool OGRWKBTransformCollectPoints(const GByte *data, size_t size,
+                                         size_t &iOffset,
+                                         OGRWKBTransformCache &oCache,
+                                         int nRec)
+{
+    if (size - iOffset < MIN_WKB_SIZE)
+        return false;
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(data[iOffset]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+        return false;
+    const OGRwkbByteOrder eByteOrder = static_cast<OGRwkbByteOrder>(nByteOrder);
+
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    if (OGRReadWKBGeometryType(data + iOffset, wkbVariantIso,
+                               &eGeometryType) != OGRERR_NONE)
+        return false;
+    iOffset += WKB_PREFIX_SIZE;
+    const auto eFlatType = wkbFlatten(eGeometryType);
+    const bool bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eGeometryType));
+    const int nDim = 2 + (bHasZ ? 1 : 0) + (OGR_GT_HasM(eGeometryType) ? 1 : 0);
+    const bool bNeedSwap = OGR_SWAP(eByteOrder);
+
+    const auto AddPoints = [&](uint32_t nPoints)
+    {
+        if (nPoints > (size - iOffset) / (nDim * sizeof(double)))
+            return false;
+        for (uint32_t j = 0; j < nPoints; j++)
+        {
+            oCache.anOffsets.push_back(iOffset);
+            oCache.abNeedSwap.push_back(bNeedSwap);
+            oCache.abHasZ.push_back(bHasZ);
+            iOffset += nDim * sizeof(double);
+        }
+        return true;
+    };
+
+    if (eFlatType == wkbPoint)
+    {
+        if (size - iOffset < nDim * sizeof(double))
+            return false;
+        double dfX = 0;
+        memcpy(&dfX, data + iOffset, sizeof(double));
+        if (std::isnan(dfX))
+        {
+            // Point empty
+            iOffset += nDim * sizeof(double);
+            return true;
+        }
+        return AddPoints(1);
+    }
+
+    if (eFlatType == wkbLineString || eFlatType == wkbCircularString)
+    {
+        return AddPoints(OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset));
+    }
+
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        const uint32_t nRings =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset);
+        if (nRings > (size - iOffset) / sizeof(uint32_t))
+            return false;
+        for (uint32_t i = 0; i < nRings; i++)
+        {
+            if (iOffset + sizeof(uint32_t) > size)
+                return false;
+            if (!AddPoints(
+                    OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset)))
+                return false;
+        }
+        return true;
+    }
+
+    if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+        eFlatType == wkbMultiPolygon || eFlatType == wkbGeometryCollection ||
+        eFlatType == wkbCompoundCurve || eFlatType == wkbCurvePolygon ||
+        eFlatType == wkbMultiCurve || eFlatType == wkbMultiSurface ||
+        eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN)
+    {
+        if (nRec == 128)
+            return false;
+        const uint32_t nParts =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffset);
+        if (nParts > (size - iOffset) / MIN_WKB_SIZE)
+            return false;
+        for (uint32_t k = 0; k < nParts; k++)
+        {
+            if (!OGRWKBTransformCollectPoints(data, size, iOffset, oCache,
+                                              nRec + 1))
+                return false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+/************************************************************************/
+/*                          OGRWKBTransform()                           */
+/************************************************************************/
+
+/** Reprojects in place the coordinates of a WKB geometry.
+ *
+ * All the points of the geometry are transformed with a single call to
+ * OGRCoordinateTransformation::Transform(). Contrary to
+ * OGRGeometryFactory::transformWithOptions(), no special processing is done
+ * for geometries crossing the antimeridian or around the poles.
+ *
+ * @param pabyWkb WKB geometry, modified in place.
+ * @param nWKBSize Size of pabyWkb in bytes.
+ * @param poCT Coordinate transformation.
+ * @param oCache Working buffers, that can be reused by subsequent calls.
+ * @return true in case of success. false if the WKB geometry is invalid, or
+ * if at least one point could not be transformed, in which case pabyWkb is
+ * left unmodified.
+ * @since GDAL 3.10
+ */
+bool OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
+                     OGRCoordinateTransformation *poCT,
+                     OGRWKBTransformCache &oCache)
+{
+    oCache.anOffsets.clear();
+    oCache.abNeedSwap.clear();
+    oCache.abHasZ.clear();
+
+    size_t iOffset = 0;
+    if (!OGRWKBTransformCollectPoints(pabyWkb, nWKBSize, iOffset, oCache,
+                                      /* nRec = */ 0))
+        return false;
+
+    const size_t nPoints = oCache.anOffsets.size();
+    if (nPoints == 0)
+        return true;
+
+    oCache.adfX.resize(nPoints);
+    oCache.adfY.resize(nPoints);
+    oCache.adfZ.resize(nPoints);
+    oCache.abSuccess.resize(nPoints);
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        const GByte *pabyPoint = pabyWkb + oCache.anOffsets[i];
+        memcpy(&oCache.adfX[i], pabyPoint, sizeof(double));
+        memcpy(&oCache.adfY[i], pabyPoint + sizeof(double), sizeof(double));
+        if (oCache.abHasZ[i])
+            memcpy(&oCache.adfZ[i], pabyPoint + 2 * sizeof(double),
+                   sizeof(double));
+        else
+            oCache.adfZ[i] = 0;
+        if (oCache.abNeedSwap[i])
+        {
+            CPL_SWAP64PTR(&oCache.adfX[i]);
+            CPL_SWAP64PTR(&oCache.adfY[i]);
+            if (oCache.abHasZ[i])
+                CPL_SWAP64PTR(&oCache.adfZ[i]);
+        }
+    }
+
+    if (!poCT->Transform(nPoints, oCache.adfX.data(), oCache.adfY.data(),
+                         oCache.adfZ.data(), nullptr, oCache.abSuccess.data()))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        if (!oCache.abSuccess[i])
+            return false;
+    }
+
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        GByte *pabyPoint = pabyWkb + oCache.anOffsets[i];
+        if (oCache.abNeedSwap[i])
+        {
+            CPL_SWAP64PTR(&oCache.adfX[i]);
+            CPL_SWAP64PTR(&oCache.adfY[i]);
+            if (oCache.abHasZ[i])
+                CPL_SWAP64PTR(&oCache.adfZ[i]);
+        }
+        memcpy(pabyPoint, &oCache.adfX[i], sizeof(double));
+        memcpy(pabyPoint + sizeof(double), &oCache.adfY[i], sizeof(double));
+        if (oCache.abHasZ[i])
+            memcpy(pabyPoint + 2 * sizeof(double), &oCache.adfZ[i],
+                   sizeof(double));
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                         OGRAppendBuffer()                            */
 /************************************************************************/
@@ -1319,3 +1511,507 @@ size_t OGRWKTToWKBTranslator::TranslateWKT(void *pabyWKTStart, size_t nLength,
     delete poGeometry;
     return nWKBSize;
 }
+
+/************************************************************************/
+/*                     OGRWKBFlatGeometry::Clear()                      */
+/************************************************************************/
+
+/** Reset the object to an empty state, while keeping its buffers. */
+void OGRWKBFlatGeometry::Clear()
+{
+    m_eGeomType = wkbUnknown;
+    m_bHasZ = false;
+    m_bHasM = false;
+    m_aoPoints.clear();
+    m_adfZ.clear();
+    m_adfM.clear();
+    m_anRingOffsets.resize(1);
+    m_anPartOffsets.resize(1);
+}
+
+/************************************************************************/
+/*                 OGRWKBFlatGeometryReadHeader()                       */
+/************************************************************************/
+
+static bool OGRWKBFlatGeometryReadHeader(const GByte *pabyWkb, size_t nWKBSize,
+                                         size_t &iOffset, bool &bNeedSwap,
+                                         OGRwkbGeometryType &eGeomType)
+{
+    if (nWKBSize - iOffset < WKB_PREFIX_SIZE)
+        return false;
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(pabyWkb[iOffset]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+        return false;
+    bNeedSwap = OGR_SWAP(static_cast<OGRwkbByteOrder>(nByteOrder));
+    if (OGRReadWKBGeometryType(pabyWkb + iOffset, wkbVariantIso, &eGeomType) !=
+        OGRERR_NONE)
+        return false;
+    iOffset += WKB_PREFIX_SIZE;
+    return true;
+}
+
+/************************************************************************/
+/*                  OGRWKBFlatGeometryGetPartType()                     */
+/************************************************************************/
+
+static OGRwkbGeometryType
+OGRWKBFlatGeometryGetPartType(OGRwkbGeometryType eFlatType)
+{
+    if (eFlatType == wkbMultiPoint)
+        return wkbPoint;
+    if (eFlatType == wkbMultiLineString)
+        return wkbLineString;
+    return wkbPolygon;
+}
+
+/************************************************************************/
+/*                   OGRWKBFlatGeometry::ReadPoints()                   */
+/************************************************************************/
+
+bool OGRWKBFlatGeometry::ReadPoints(const GByte *pabyWkb, size_t nWKBSize,
+                                    size_t &iOffset, bool bNeedSwap,
+                                    bool bSinglePoint)
+{
+    uint32_t nPoints = 1;
+    if (!bSinglePoint)
+    {
+        if (nWKBSize - iOffset < sizeof(uint32_t))
+            return false;
+        nPoints = OGRWKBReadUInt32(pabyWkb + iOffset, bNeedSwap);
+        iOffset += sizeof(uint32_t);
+    }
+    const int nDim = 2 + (m_bHasZ ? 1 : 0) + (m_bHasM ? 1 : 0);
+    if (nPoints > (nWKBSize - iOffset) / (nDim * sizeof(double)))
+        return false;
+
+    const size_t nStart = m_aoPoints.size();
+    m_aoPoints.resize(nStart + nPoints);
+    if (m_bHasZ)
+        m_adfZ.resize(nStart + nPoints);
+    if (m_bHasM)
+        m_adfM.resize(nStart + nPoints);
+
+    const GByte *pabyPoints = pabyWkb + iOffset;
+    if (nDim == 2 && !bNeedSwap)
+    {
+        // Fast path: the WKB layout is the one of OGRRawPoint
+        memcpy(m_aoPoints.data() + nStart, pabyPoints,
+               nPoints * 2 * sizeof(double));
+    }
+    else
+    {
+        for (size_t i = 0; i < nPoints; ++i)
+        {
+            const GByte *pabyPoint = pabyPoints + i * nDim * sizeof(double);
+            m_aoPoints[nStart + i].x = OGRWKBReadFloat64(pabyPoint, bNeedSwap);
+            m_aoPoints[nStart + i].y =
+                OGRWKBReadFloat64(pabyPoint + sizeof(double), bNeedSwap);
+            int iDim = 2;
+            if (m_bHasZ)
+            {
+                m_adfZ[nStart + i] = OGRWKBReadFloat64(
+                    pabyPoint + iDim * sizeof(double), bNeedSwap);
+                ++iDim;
+            }
+            if (m_bHasM)
+            {
+                m_adfM[nStart + i] = OGRWKBReadFloat64(
+                    pabyPoint + iDim * sizeof(double), bNeedSwap);
+            }
+        }
+    }
+    iOffset += nPoints * nDim * sizeof(double);
+
+    if (bSinglePoint && std::isnan(m_aoPoints[nStart].x) &&
+        std::isnan(m_aoPoints[nStart].y))
+    {
+        // Empty point
+        m_aoPoints.resize(nStart);
+        if (m_bHasZ)
+            m_adfZ.resize(nStart);
+        if (m_bHasM)
+            m_adfM.resize(nStart);
+    }
+
+    m_anRingOffsets.push_back(m_aoPoints.size());
+    return true;
+}
+
+/************************************************************************/
+/*                    OGRWKBFlatGeometry::ReadRings()                   */
+/************************************************************************/
+
+bool OGRWKBFlatGeometry::ReadRings(const GByte *pabyWkb, size_t nWKBSize,
+                                   size_t &iOffset, bool bNeedSwap)
+{
+    if (nWKBSize - iOffset < sizeof(uint32_t))
+        return false;
+    const uint32_t nRings = OGRWKBReadUInt32(pabyWkb + iOffset, bNeedSwap);
+    iOffset += sizeof(uint32_t);
+    if (nRings > (nWKBSize - iOffset) / sizeof(uint32_t))
+        return false;
+    for (uint32_t i = 0; i < nRings; ++i)
+    {
+        if (!ReadPoints(pabyWkb, nWKBSize, iOffset, bNeedSwap,
+                        /* bSinglePoint = */ false))
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    OGRWKBFlatGeometry::ReadPart()                    */
+/************************************************************************/
+
+bool OGRWKBFlatGeometry::ReadPart(const GByte *pabyWkb, size_t nWKBSize,
+                                  size_t &iOffset, OGRwkbGeometryType eFlatType,
+                                  bool bNeedSwap)
+{
+    bool bRet;
+    if (eFlatType == wkbPoint)
+        bRet = ReadPoints(pabyWkb, nWKBSize, iOffset, bNeedSwap,
+                          /* bSinglePoint = */ true);
+    else if (eFlatType == wkbLineString)
+        bRet = ReadPoints(pabyWkb, nWKBSize, iOffset, bNeedSwap,
+                          /* bSinglePoint = */ false);
+    else
+        bRet = ReadRings(pabyWkb, nWKBSize, iOffset, bNeedSwap);
+    if (bRet)
+        m_anPartOffsets.push_back(m_anRingOffsets.size() - 1);
+    return bRet;
+}
+
+/************************************************************************/
+/*                 OGRWKBFlatGeometry::ImportFromWkb()                  */
+/************************************************************************/
+
+/** Import a WKB geometry.
+ *
+ * ISO and "old-style" 2.5D WKB variants are accepted. The sub-geometries of
+ * a multi geometry must have the same dimensionality as it.
+ *
+ * @param pabyWkb WKB geometry.
+ * @param nWKBSize Size of pabyWkb in bytes.
+ * @return true in case of success. false if the WKB geometry is invalid, or of
+ * an unsupported type, in which case the object is cleared.
+ */
+bool OGRWKBFlatGeometry::ImportFromWkb(const GByte *pabyWkb, size_t nWKBSize)
+{
+    Clear();
+
+    size_t iOffset = 0;
+    bool bNeedSwap = false;
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    if (!OGRWKBFlatGeometryReadHeader(pabyWkb, nWKBSize, iOffset, bNeedSwap,
+                                      eGeomType))
+        return false;
+
+    const auto eFlatType = wkbFlatten(eGeomType);
+    m_bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eGeomType));
+    m_bHasM = CPL_TO_BOOL(OGR_GT_HasM(eGeomType));
+
+    bool bRet = false;
+    if (eFlatType == wkbPoint || eFlatType == wkbLineString ||
+        eFlatType == wkbPolygon)
+    {
+        bRet = ReadPart(pabyWkb, nWKBSize, iOffset, eFlatType, bNeedSwap);
+    }
+    else if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+             eFlatType == wkbMultiPolygon)
+    {
+        const auto eFlatPartType = OGRWKBFlatGeometryGetPartType(eFlatType);
+        uint32_t nParts = 0;
+        if (nWKBSize - iOffset >= sizeof(uint32_t))
+        {
+            nParts = OGRWKBReadUInt32(pabyWkb + iOffset, bNeedSwap);
+            iOffset += sizeof(uint32_t);
+            bRet = nParts <= (nWKBSize - iOffset) / MIN_WKB_SIZE;
+        }
+        for (uint32_t i = 0; bRet && i < nParts; ++i)
+        {
+            bool bPartNeedSwap = false;
+            OGRwkbGeometryType ePartType = wkbUnknown;
+            bRet = OGRWKBFlatGeometryReadHeader(pabyWkb, nWKBSize, iOffset,
+                                                bPartNeedSwap, ePartType) &&
+                   wkbFlatten(ePartType) == eFlatPartType &&
+                   CPL_TO_BOOL(OGR_GT_HasZ(ePartType)) == m_bHasZ &&
+                   CPL_TO_BOOL(OGR_GT_HasM(ePartType)) == m_bHasM &&
+                   ReadPart(pabyWkb, nWKBSize, iOffset, eFlatPartType,
+                            bPartNeedSwap);
+        }
+    }
+
+    if (!bRet)
+    {
+        Clear();
+        return false;
+    }
+    m_eGeomType = OGR_GT_SetModifier(eFlatType, m_bHasZ, m_bHasM);
+    return true;
+}
+
+/************************************************************************/
+/*                    OGRWKBFlatGeometry::WkbSize()                     */
+/************************************************************************/
+
+/** Return the size in bytes of the ISO WKB export of the geometry, or 0 if
+ * no geometry is set.
+ */
+size_t OGRWKBFlatGeometry::WkbSize() const
+{
+    if (m_eGeomType == wkbUnknown)
+        return 0;
+    const auto eFlatType = wkbFlatten(m_eGeomType);
+    const size_t nDim = 2 + (m_bHasZ ? 1 : 0) + (m_bHasM ? 1 : 0);
+    const size_t nParts = GetPartCount();
+    const size_t nRings = m_anRingOffsets.size() - 1;
+    if (eFlatType == wkbPoint)
+        return WKB_PREFIX_SIZE + nDim * sizeof(double);
+    if (eFlatType == wkbMultiPoint)
+        return MIN_WKB_SIZE +
+               nParts * (WKB_PREFIX_SIZE + nDim * sizeof(double));
+
+    // Linestrings and polygons
+    size_t nSize = WKB_PREFIX_SIZE + nRings * sizeof(uint32_t) +
+                   m_aoPoints.size() * nDim * sizeof(double);
+    if (eFlatType == wkbPolygon)
+        nSize += sizeof(uint32_t);
+    else if (eFlatType == wkbMultiLineString)
+        nSize += sizeof(uint32_t) + nParts * WKB_PREFIX_SIZE;
+    else if (eFlatType == wkbMultiPolygon)
+        nSize += sizeof(uint32_t) + nParts * MIN_WKB_SIZE;
+    return nSize;
+}
+
+/************************************************************************/
+/*                  OGRWKBFlatGeometry::ExportToWkb()                   */
+/************************************************************************/
+
+/** Export the geometry as ISO WKB.
+ *
+ * @param abyWkb Output buffer, resized to WkbSize().
+ * @param eByteOrder Byte order of the output.
+ * @return false if no geometry is set.
+ */
+bool OGRWKBFlatGeometry::ExportToWkb(std::vector<GByte> &abyWkb,
+                                     OGRwkbByteOrder eByteOrder) const
+{
+    if (m_eGeomType == wkbUnknown)
+        return false;
+
+    abyWkb.resize(WkbSize());
+    GByte *pabyOut = abyWkb.data();
+    const bool bNeedSwap = OGR_SWAP(eByteOrder);
+
+    const auto WriteUInt32 = [&pabyOut, bNeedSwap](uint32_t nVal)
+    {
+        if (bNeedSwap)
+            CPL_SWAP32PTR(&nVal);
+        memcpy(pabyOut, &nVal, sizeof(nVal));
+        pabyOut += sizeof(nVal);
+    };
+
+    const auto WriteFloat64 = [&pabyOut, bNeedSwap](double dfVal)
+    {
+        if (bNeedSwap)
+            CPL_SWAP64PTR(&dfVal);
+        memcpy(pabyOut, &dfVal, sizeof(dfVal));
+        pabyOut += sizeof(dfVal);
+    };
+
+    const auto WriteHeader = [this, &pabyOut, eByteOrder,
+                              &WriteUInt32](OGRwkbGeometryType eFlatType)
+    {
+        *pabyOut = static_cast<GByte>(eByteOrder);
+        ++pabyOut;
+        WriteUInt32(static_cast<uint32_t>(eFlatType) + (m_bHasZ ? 1000 : 0) +
+                    (m_bHasM ? 2000 : 0));
+    };
+
+    const size_t nDim = 2 + (m_bHasZ ? 1 : 0) + (m_bHasM ? 1 : 0);
+    const auto WritePoints = [this, &pabyOut, bNeedSwap, nDim,
+                              &WriteFloat64](size_t iRing, bool bSinglePoint)
+    {
+        const size_t nStart = m_anRingOffsets[iRing];
+        const size_t nEnd = m_anRingOffsets[iRing + 1];
+        if (bSinglePoint && nStart == nEnd)
+        {
+            // Empty point
+            for (size_t i = 0; i < nDim; ++i)
+                WriteFloat64(std::numeric_limits<double>::quiet_NaN());
+            return;
+        }
+        if (nDim == 2 && !bNeedSwap)
+        {
+            memcpy(pabyOut, m_aoPoints.data() + nStart,
+                   (nEnd - nStart) * 2 * sizeof(double));
+            pabyOut += (nEnd - nStart) * 2 * sizeof(double);
+            return;
+        }
+        for (size_t i = nStart; i < nEnd; ++i)
+        {
+            WriteFloat64(m_aoPoints[i].x);
+            WriteFloat64(m_aoPoints[i].y);
+            if (m_bHasZ)
+                WriteFloat64(m_adfZ[i]);
+            if (m_bHasM)
+                WriteFloat64(m_adfM[i]);
+        }
+    };
+
+    const auto WritePart = [this, &WriteHeader, &WriteUInt32,
+                            &WritePoints](OGRwkbGeometryType eFlatType,
+                                          size_t iPart)
+    {
+        WriteHeader(eFlatType);
+        const size_t iFirstRing = m_anPartOffsets[iPart];
+        const size_t iLastRing = m_anPartOffsets[iPart + 1];
+        if (eFlatType == wkbPoint)
+        {
+            WritePoints(iFirstRing, /* bSinglePoint = */ true);
+            return;
+        }
+        if (eFlatType == wkbPolygon)
+            WriteUInt32(static_cast<uint32_t>(iLastRing - iFirstRing));
+        for (size_t iRing = iFirstRing; iRing < iLastRing; ++iRing)
+        {
+            WriteUInt32(static_cast<uint32_t>(m_anRingOffsets[iRing + 1] -
+                                              m_anRingOffsets[iRing]));
+            WritePoints(iRing, /* bSinglePoint = */ false);
+        }
+    };
+
+    const auto eFlatType = wkbFlatten(m_eGeomType);
+    if (eFlatType == wkbPoint || eFlatType == wkbLineString ||
+        eFlatType == wkbPolygon)
+    {
+        WritePart(eFlatType, 0);
+    }
+    else
+    {
+        WriteHeader(eFlatType);
+        const size_t nParts = GetPartCount();
+        WriteUInt32(static_cast<uint32_t>(nParts));
+        const auto eFlatPartType = OGRWKBFlatGeometryGetPartType(eFlatType);
+        for (size_t iPart = 0; iPart < nParts; ++iPart)
+            WritePart(eFlatPartType, iPart);
+    }
+    CPLAssert(pabyOut == abyWkb.data() + abyWkb.size());
+    return true;
+}
+
+/************************************************************************/
+/*                OGRWKBFlatGeometry::PartToGeometry()                  */
+/************************************************************************/
+
+std::unique_ptr<OGRGeometry>
+OGRWKBFlatGeometry::PartToGeometry(OGRwkbGeometryType eFlatType,
+                                   size_t iPart) const
+{
+    const size_t iFirstRing = m_anPartOffsets[iPart];
+    const size_t iLastRing = m_anPartOffsets[iPart + 1];
+
+    const auto SetPoints = [this](OGRSimpleCurve *poCurve, size_t iRing)
+    {
+        const size_t nStart = m_anRingOffsets[iRing];
+        const size_t nPoints = m_anRingOffsets[iRing + 1] - nStart;
+        if (nPoints > static_cast<size_t>(INT_MAX))
+            return false;
+        poCurve->setPoints(static_cast<int>(nPoints),
+                           m_aoPoints.data() + nStart,
+                           m_bHasZ ? m_adfZ.data() + nStart : nullptr,
+                           m_bHasM ? m_adfM.data() + nStart : nullptr);
+        return static_cast<size_t>(poCurve->getNumPoints()) == nPoints;
+    };
+
+    if (eFlatType == wkbPoint)
+    {
+        auto poPoint = std::make_unique<OGRPoint>();
+        poPoint->set3D(m_bHasZ);
+        poPoint->setMeasured(m_bHasM);
+        const size_t nStart = m_anRingOffsets[iFirstRing];
+        if (m_anRingOffsets[iFirstRing + 1] > nStart)
+        {
+            poPoint->setX(m_aoPoints[nStart].x);
+            poPoint->setY(m_aoPoints[nStart].y);
+            if (m_bHasZ)
+                poPoint->setZ(m_adfZ[nStart]);
+            if (m_bHasM)
+                poPoint->setM(m_adfM[nStart]);
+        }
+        return poPoint;
+    }
+    if (eFlatType == wkbLineString)
+    {
+        auto poLS = std::make_unique<OGRLineString>();
+        poLS->set3D(m_bHasZ);
+        poLS->setMeasured(m_bHasM);
+        if (!SetPoints(poLS.get(), iFirstRing))
+            return nullptr;
+        return poLS;
+    }
+
+    auto poPoly = std::make_unique<OGRPolygon>();
+    poPoly->set3D(m_bHasZ);
+    poPoly->setMeasured(m_bHasM);
+    for (size_t iRing = iFirstRing; iRing < iLastRing; ++iRing)
+    {
+        auto poRing = std::make_unique<OGRLinearRing>();
+        if (!SetPoints(poRing.get(), iRing) ||
+            poPoly->addRing(std::move(poRing)) != OGRERR_NONE)
+            return nullptr;
+    }
+    return poPoly;
+}
+
+/************************************************************************/
+/*                   OGRWKBFlatGeometry::ToGeometry()                   */
+/************************************************************************/
+
+/** Build an OGRGeometry object from the flat representation.
+ *
+ * @return a new geometry, or nullptr if no geometry is set or in case of
+ * error.
+ */
+std::unique_ptr<OGRGeometry> OGRWKBFlatGeometry::ToGeometry() const
+{
+    if (m_eGeomType == wkbUnknown)
+        return nullptr;
+
+    const auto eFlatType = wkbFlatten(m_eGeomType);
+    if (eFlatType == wkbPoint || eFlatType == wkbLineString ||
+        eFlatType == wkbPolygon)
+    {
+        return PartToGeometry(eFlatType, 0);
+    }
+
+    std::unique_ptr<OGRGeometryCollection> poColl(
+        OGRGeometryFactory::createGeometry(m_eGeomType)
+            ->toGeometryCollection());
+    const auto eFlatPartType = OGRWKBFlatGeometryGetPartType(eFlatType);
+    const size_t nParts = GetPartCount();
+    for (size_t iPart = 0; iPart < nParts; ++iPart)
+    {
+        auto poPart = PartToGeometry(eFlatPartType, iPart);
+        if (!poPart || poColl->addGeometry(std::move(poPart)) != OGRERR_NONE)
+            return nullptr;
+    }
+    return poColl;
+}
+
+/************************************************************************/
+/*                  OGRWKBFlatGeometry::GetEnvelope()                   */
+/************************************************************************/
+
+/** Compute the 2D envelope of the geometry. */
+void OGRWKBFlatGeometry::GetEnvelope(OGREnvelope &sEnvelope) const
+{
+    sEnvelope = OGREnvelope();
+    for (const auto &oPoint : m_aoPoints)
+    {
+        sEnvelope.MinX = std::min(sEnvelope.MinX, oPoint.x);
+        sEnvelope.MinY = std::min(sEnvelope.MinY, oPoint.y);
+        sEnvelope.MaxX = std::max(sEnvelope.MaxX, oPoint.x);
+        sEnvelope.MaxY = std::max(sEnvelope.MaxY, oPoint.y);
+    }
+}
@@ -31,6 +31,10 @@
 
 #include "cpl_port.h"
 #include "ogr_core.h"
+#include "ogr_geometry.h"
+
+#include <memory>
+#include <vector>
 
 bool CPL_DLL OGRWKBGetGeomType(const GByte *pabyWkb, size_t nWKBSize,
                                bool &bNeedSwap, uint32_t &nType);
@@ -51,6 +55,28 @@ bool CPL_DLL OGRWKBIntersectsPessimistic(const GByte *pabyWkb, size_t nWKBSize,
 void CPL_DLL OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb,
                                                      size_t nWKBSize);
 
+class OGRCoordinateTransformation;
+
+/** Working buffers of OGRWKBTransform(), that can be reused from one call to
+ * another to save memory allocations.
+ */
+struct CPL_DLL OGRWKBTransformCache
+{
+    /*! @cond Doxygen_Suppress */
+    std::vector<size_t> anOffsets{};
+    std::vector<bool> abNeedSwap{};
+    std::vector<bool> abHasZ{};
+    std::vector<double> adfX{};
+    std::vector<double> adfY{};
+    std::vector<double> adfZ{};
+    std::vector<int> abSuccess{};
+    /*! @endcond */
+};
+
+bool CPL_DLL OGRWKBTransform(GByte *pabyWkb, size_t nWKBSize,
+                             OGRCoordinateTransformation *poCT,
+                             OGRWKBTransformCache &oCache);
+
 /** Modifies a PostGIS-style Extended WKB geometry to a regular WKB one.
  * pabyEWKB will be modified in place.
  * The return value will be either at the beginning of pabyEWKB or 4 bytes
@@ -142,4 +168,127 @@ class CPL_DLL OGRWKTToWKBTranslator
                         bool bCanAlterByteAfter);
 };
 
+/************************************************************************/
+/*                         OGRWKBFlatGeometry                           */
+/************************************************************************/
+
+/** Flat representation of a Point, LineString, Polygon, MultiPoint,
+ * MultiLineString or MultiPolygon geometry.
+ *
+ * All the vertices are stored in a single contiguous array of OGRRawPoint
+ * (plus arrays of Z and M values), whatever the number of parts and rings.
+ * Rings (or linestrings, or points) are delimited by offsets in the array of
+ * vertices, and parts by offsets in the array of rings. A LineString is made
+ * of a single part with a single ring, a Polygon of a single part, and each
+ * point of a MultiPoint is a part made of a single ring of one point (or
+ * zero for an empty point).
+ *
+ * Importing a WKB geometry into an existing object reuses its buffers, and
+ * thus does not involve any dynamic memory allocation once they are large
+ * enough.
+ *
+ * @since GDAL 3.10
+ */
+class CPL_DLL OGRWKBFlatGeometry
+{
+  public:
+    /** Constructor */
+    OGRWKBFlatGeometry() = default;
+
+    void Clear();
+
+    bool ImportFromWkb(const GByte *pabyWkb, size_t nWKBSize);
+
+    size_t WkbSize() const;
+
+    bool ExportToWkb(std::vector<GByte> &abyWkb,
+                     OGRwkbByteOrder eByteOrder = wkbNDR) const;
+
+    std::unique_ptr<OGRGeometry> ToGeometry() const;
+
+    void GetEnvelope(OGREnvelope &sEnvelope) const;
+
+    /** Return the geometry type (wkbUnknown if no geometry is set) */
+    OGRwkbGeometryType GetGeometryType() const
+    {
+        return m_eGeomType;
+    }
+
+    /** Return the number of parts */
+    size_t GetPartCount() const
+    {
+        return m_anPartOffsets.size() - 1;
+    }
+
+    /** Return the number of rings of the part of index iPart */
+    size_t GetRingCount(size_t iPart) const
+    {
+        return m_anPartOffsets[iPart + 1] - m_anPartOffsets[iPart];
+    }
+
+    /** Return the number of points of the ring of index iRing of the part
+     * of index iPart */
+    size_t GetPointCount(size_t iPart, size_t iRing) const
+    {
+        const size_t i = m_anPartOffsets[iPart] + iRing;
+        return m_anRingOffsets[i + 1] - m_anRingOffsets[i];
+    }
+
+    /** Return the total number of points */
+    size_t GetPointCount() const
+    {
+        return m_aoPoints.size();
+    }
+
+    /** Return the X/Y values of the ring of index iRing of the part of index
+     * iPart, in a form suitable for OGRSimpleCurve::setPoints().
+     */
+    const OGRRawPoint *GetPoints(size_t iPart, size_t iRing) const
+    {
+        return m_aoPoints.data() +
+               m_anRingOffsets[m_anPartOffsets[iPart] + iRing];
+    }
+
+    /** Return the Z values of the ring of index iRing of the part of index
+     * iPart, or nullptr if the geometry has no Z dimension.
+     */
+    const double *GetZ(size_t iPart, size_t iRing) const
+    {
+        return m_adfZ.empty()
+                   ? nullptr
+                   : m_adfZ.data() +
+                         m_anRingOffsets[m_anPartOffsets[iPart] + iRing];
+    }
+
+    /** Return the M values of the ring of index iRing of the part of index
+     * iPart, or nullptr if the geometry has no M dimension.
+     */
+    const double *GetM(size_t iPart, size_t iRing) const
+    {
+        return m_adfM.empty()
+                   ? nullptr
+                   : m_adfM.data() +
+                         m_anRingOffsets[m_anPartOffsets[iPart] + iRing];
+    }
+
+  private:
+    OGRwkbGeometryType m_eGeomType = wkbUnknown;
+    bool m_bHasZ = false;
+    bool m_bHasM = false;
+    std::vector<OGRRawPoint> m_aoPoints{};
+    std::vector<double> m_adfZ{};
+    std::vector<double> m_adfM{};
+    std::vector<size_t> m_anRingOffsets{0};
+    std::vector<size_t> m_anPartOffsets{0};
+
+    bool ReadPoints(const GByte *pabyWkb, size_t nWKBSize, size_t &iOffset,
+                    bool bNeedSwap, bool bSinglePoint);
+    bool ReadRings(const GByte *pabyWkb, size_t nWKBSize, size_t &iOffset,
+                   bool bNeedSwap);
+    bool ReadPart(const GByte *pabyWkb, size_t nWKBSize, size_t &iOffset,
+                  OGRwkbGeometryType eFlatType, bool bNeedSwap);
+    std::unique_ptr<OGRGeometry> PartToGeometry(OGRwkbGeometryType eFlatType,
+                                                size_t iPart) const;
+};
+
 #endif  // OGR_WKB_H_INCLUDED
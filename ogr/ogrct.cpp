@@ -31,17 +31,25 @@
 #include "ogr_spatialref.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cmath>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <list>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_mem_cache.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
 #include "ogr_proj_p.h"
@@ -92,6 +100,13 @@ typedef std::string CTCacheKey;
 typedef std::unique_ptr<OGRProjCT> CTCacheValue;
 static lru11::Cache<CTCacheKey, CTCacheValue> *g_poCTCache = nullptr;
 
+// Persistent cache of the PROJ pipelines selected by
+// proj_create_crs_to_crs(), loaded from and saved into the file pointed by
+// the OGR_CT_PIPELINE_CACHE configuration option.
+static std::mutex g_oCTPipelineCacheMutex;
+static std::string g_osCTPipelineCacheFilename;
+static std::map<std::string, std::string> *g_poCTPipelineCache = nullptr;
+
 /************************************************************************/
 /*             OGRCoordinateTransformationOptions::Private              */
 /************************************************************************/
@@ -760,6 +775,7 @@ class OGRProjCT : public OGRCoordinateTransformation
     std::string m_osTargetSRS{};  // WKT, PROJ4 or AUTH:CODE
 
     bool bWebMercatorToWGS84LongLat = false;
+    bool bWGS84LongLatToWebMercator = false;
 
     size_t nErrorCount = 0;
 
@@ -809,8 +825,18 @@ class OGRProjCT : public OGRCoordinateTransformation
     int m_iCurTransformation = -1;
     OGRCoordinateTransformationOptions m_options{};
 
+    // Number of threads among which PROJ transformations of large arrays
+    // are split (OGR_CT_NUM_THREADS)
+    int m_nThreads = 1;
+    // Clones of m_pjThreadSrc, one per worker thread, as a PJ object cannot
+    // be used concurrently.
+    PJ *m_pjThreadSrc = nullptr;
+    std::vector<PjPtr> m_apjThreadClones{};
+
     void ComputeThreshold();
     void DetectWebMercatorToWGS84();
+    void ReportTransformationError(PJ_CONTEXT *ctx, GUInt32 nLastErrorCounter,
+                                   size_t i, int err);
 
     OGRProjCT(const OGRProjCT &other);
     OGRProjCT &operator=(const OGRProjCT &) = delete;
@@ -819,6 +845,13 @@ class OGRProjCT : public OGRCoordinateTransformation
     MakeCacheKey(const OGRSpatialReference *poSRS1, const char *pszSrcSRS,
                  const OGRSpatialReference *poSRS2, const char *pszTargetSRS,
                  const OGRCoordinateTransformationOptions &options);
+    static std::string GetPipelineCacheKey(const CTCacheKey &osCTKey,
+                                           double dfSourceEpoch,
+                                           double dfTargetEpoch);
+    static PJ *FindPipelineFromCache(const char *pszFilename,
+                                     const std::string &osKey);
+    static void InsertPipelineIntoCache(const char *pszFilename,
+                                        const std::string &osKey, PJ *pj);
     bool ContainsNorthPole(const double xmin, const double ymin,
                            const double xmax, const double ymax,
                            bool lon_lat_order);
@@ -1276,13 +1309,14 @@ OGRProjCT::OGRProjCT(const OGRProjCT &other)
       dfTargetCoordinateEpoch(other.dfTargetCoordinateEpoch),
       m_osTargetSRS(other.m_osTargetSRS),
       bWebMercatorToWGS84LongLat(other.bWebMercatorToWGS84LongLat),
+      bWGS84LongLatToWebMercator(other.bWGS84LongLatToWebMercator),
       nErrorCount(other.nErrorCount), dfThreshold(other.dfThreshold),
       m_pj(other.m_pj), m_bReversePj(other.m_bReversePj),
       m_bEmitErrors(other.m_bEmitErrors), bNoTransform(other.bNoTransform),
       m_eStrategy(other.m_eStrategy),
       m_oTransformations(other.m_oTransformations),
       m_iCurTransformation(other.m_iCurTransformation),
-      m_options(other.m_options)
+      m_options(other.m_options), m_nThreads(other.m_nThreads)
 {
 }
 
@@ -1326,118 +1360,142 @@ void OGRProjCT::ComputeThreshold()
 }
 
 /************************************************************************/
-/*                        DetectWebMercatorToWGS84()                    */
+/*                        IsWebMercatorToWGS84()                        */
 /************************************************************************/
 
-void OGRProjCT::DetectWebMercatorToWGS84()
+// Returns whether the transformation from poSRSWebMercator to poSRSWGS84 is
+// the one between EPSG:3857 and EPSG:4326 (in longitude, latitude order),
+// which can be done without PROJ.
+static bool IsWebMercatorToWGS84(const OGRSpatialReference *poSRSWebMercator,
+                                 const OGRSpatialReference *poSRSWGS84,
+                                 OGRAxisOrientation eWGS84FirstAxisOrient)
 {
-    // Detect webmercator to WGS84
-    if (m_options.d->osCoordOperation.empty() && poSRSSource && poSRSTarget &&
-        poSRSSource->IsProjected() && poSRSTarget->IsGeographic() &&
-        ((m_eTargetFirstAxisOrient == OAO_North &&
-          poSRSTarget->GetDataAxisToSRSAxisMapping() ==
-              std::vector<int>{2, 1}) ||
-         (m_eTargetFirstAxisOrient == OAO_East &&
-          poSRSTarget->GetDataAxisToSRSAxisMapping() ==
-              std::vector<int>{1, 2})))
-    {
-        // Examine SRS ID before going to Proj4 string for faster execution
-        // This assumes that the SRS definition is "not lying", that is, it
-        // is equivalent to the resolution of the official EPSG code.
-        const char *pszSourceAuth = poSRSSource->GetAuthorityName(nullptr);
-        const char *pszSourceCode = poSRSSource->GetAuthorityCode(nullptr);
-        const char *pszTargetAuth = poSRSTarget->GetAuthorityName(nullptr);
-        const char *pszTargetCode = poSRSTarget->GetAuthorityCode(nullptr);
-        if (pszSourceAuth && pszSourceCode && pszTargetAuth && pszTargetCode &&
-            EQUAL(pszSourceAuth, "EPSG") && EQUAL(pszTargetAuth, "EPSG"))
-        {
-            bWebMercatorToWGS84LongLat =
-                (EQUAL(pszSourceCode, "3857") ||
-                 EQUAL(pszSourceCode, "3785") ||     // deprecated
-                 EQUAL(pszSourceCode, "900913")) &&  // deprecated
-                EQUAL(pszTargetCode, "4326");
-        }
-        else
-        {
-            CPLPushErrorHandler(CPLQuietErrorHandler);
-            char *pszSrcProj4Defn = nullptr;
-            poSRSSource->exportToProj4(&pszSrcProj4Defn);
+    if (!poSRSWebMercator->IsProjected() || !poSRSWGS84->IsGeographic() ||
+        !((eWGS84FirstAxisOrient == OAO_North &&
+           poSRSWGS84->GetDataAxisToSRSAxisMapping() ==
+               std::vector<int>{2, 1}) ||
+          (eWGS84FirstAxisOrient == OAO_East &&
+           poSRSWGS84->GetDataAxisToSRSAxisMapping() ==
+               std::vector<int>{1, 2})))
+    {
+        return false;
+    }
+
+    // Examine SRS ID before going to Proj4 string for faster execution
+    // This assumes that the SRS definition is "not lying", that is, it
+    // is equivalent to the resolution of the official EPSG code.
+    const char *pszSourceAuth = poSRSWebMercator->GetAuthorityName(nullptr);
+    const char *pszSourceCode = poSRSWebMercator->GetAuthorityCode(nullptr);
+    const char *pszTargetAuth = poSRSWGS84->GetAuthorityName(nullptr);
+    const char *pszTargetCode = poSRSWGS84->GetAuthorityCode(nullptr);
+    if (pszSourceAuth && pszSourceCode && pszTargetAuth && pszTargetCode &&
+        EQUAL(pszSourceAuth, "EPSG") && EQUAL(pszTargetAuth, "EPSG"))
+    {
+        return (EQUAL(pszSourceCode, "3857") ||
+                EQUAL(pszSourceCode, "3785") ||     // deprecated
+                EQUAL(pszSourceCode, "900913")) &&  // deprecated
+               EQUAL(pszTargetCode, "4326");
+    }
+    else
+    {
+        bool bRet = false;
+        CPLPushErrorHandler(CPLQuietErrorHandler);
+        char *pszSrcProj4Defn = nullptr;
+        poSRSWebMercator->exportToProj4(&pszSrcProj4Defn);
 
-            char *pszDstProj4Defn = nullptr;
-            poSRSTarget->exportToProj4(&pszDstProj4Defn);
-            CPLPopErrorHandler();
+        char *pszDstProj4Defn = nullptr;
+        poSRSWGS84->exportToProj4(&pszDstProj4Defn);
+        CPLPopErrorHandler();
 
-            if (pszSrcProj4Defn && pszDstProj4Defn)
+        if (pszSrcProj4Defn && pszDstProj4Defn)
+        {
+            if (pszSrcProj4Defn[0] != '\0' &&
+                pszSrcProj4Defn[strlen(pszSrcProj4Defn) - 1] == ' ')
+                pszSrcProj4Defn[strlen(pszSrcProj4Defn) - 1] = 0;
+            if (pszDstProj4Defn[0] != '\0' &&
+                pszDstProj4Defn[strlen(pszDstProj4Defn) - 1] == ' ')
+                pszDstProj4Defn[strlen(pszDstProj4Defn) - 1] = 0;
+            char *pszNeedle = strstr(pszSrcProj4Defn, "  ");
+            if (pszNeedle)
+                memmove(pszNeedle, pszNeedle + 1, strlen(pszNeedle + 1) + 1);
+            pszNeedle = strstr(pszDstProj4Defn, "  ");
+            if (pszNeedle)
+                memmove(pszNeedle, pszNeedle + 1, strlen(pszNeedle + 1) + 1);
+
+            if ((strstr(pszDstProj4Defn, "+datum=WGS84") != nullptr ||
+                 strstr(pszDstProj4Defn,
+                        "+ellps=WGS84 +towgs84=0,0,0,0,0,0,0 ") != nullptr) &&
+                strstr(pszSrcProj4Defn, "+nadgrids=@null ") != nullptr &&
+                strstr(pszSrcProj4Defn, "+towgs84") == nullptr)
             {
-                if (pszSrcProj4Defn[0] != '\0' &&
-                    pszSrcProj4Defn[strlen(pszSrcProj4Defn) - 1] == ' ')
-                    pszSrcProj4Defn[strlen(pszSrcProj4Defn) - 1] = 0;
-                if (pszDstProj4Defn[0] != '\0' &&
-                    pszDstProj4Defn[strlen(pszDstProj4Defn) - 1] == ' ')
-                    pszDstProj4Defn[strlen(pszDstProj4Defn) - 1] = 0;
-                char *pszNeedle = strstr(pszSrcProj4Defn, "  ");
-                if (pszNeedle)
-                    memmove(pszNeedle, pszNeedle + 1,
-                            strlen(pszNeedle + 1) + 1);
-                pszNeedle = strstr(pszDstProj4Defn, "  ");
-                if (pszNeedle)
-                    memmove(pszNeedle, pszNeedle + 1,
-                            strlen(pszNeedle + 1) + 1);
-
-                if ((strstr(pszDstProj4Defn, "+datum=WGS84") != nullptr ||
-                     strstr(pszDstProj4Defn,
-                            "+ellps=WGS84 +towgs84=0,0,0,0,0,0,0 ") !=
-                         nullptr) &&
-                    strstr(pszSrcProj4Defn, "+nadgrids=@null ") != nullptr &&
-                    strstr(pszSrcProj4Defn, "+towgs84") == nullptr)
+                char *pszDst =
+                    strstr(pszDstProj4Defn, "+towgs84=0,0,0,0,0,0,0 ");
+                if (pszDst != nullptr)
                 {
-                    char *pszDst =
-                        strstr(pszDstProj4Defn, "+towgs84=0,0,0,0,0,0,0 ");
-                    if (pszDst != nullptr)
-                    {
-                        char *pszSrc =
-                            pszDst + strlen("+towgs84=0,0,0,0,0,0,0 ");
-                        memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
-                    }
-                    else
-                    {
-                        memcpy(strstr(pszDstProj4Defn, "+datum=WGS84"),
-                               "+ellps", 6);
-                    }
-
-                    pszDst = strstr(pszSrcProj4Defn, "+nadgrids=@null ");
-                    char *pszSrc = pszDst + strlen("+nadgrids=@null ");
+                    char *pszSrc = pszDst + strlen("+towgs84=0,0,0,0,0,0,0 ");
                     memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
+                }
+                else
+                {
+                    memcpy(strstr(pszDstProj4Defn, "+datum=WGS84"), "+ellps",
+                           6);
+                }
 
-                    pszDst = strstr(pszSrcProj4Defn, "+wktext ");
-                    if (pszDst)
-                    {
-                        pszSrc = pszDst + strlen("+wktext ");
-                        memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
-                    }
-                    bWebMercatorToWGS84LongLat =
-                        strcmp(pszDstProj4Defn,
-                               "+proj=longlat +ellps=WGS84 +no_defs") == 0 &&
-                        (strcmp(pszSrcProj4Defn,
-                                "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 "
-                                "+lon_0=0.0 "
-                                "+x_0=0.0 +y_0=0 +k=1.0 +units=m +no_defs") ==
-                             0 ||
-                         strcmp(pszSrcProj4Defn,
-                                "+proj=merc +a=6378137 +b=6378137 +lat_ts=0 "
-                                "+lon_0=0 "
-                                "+x_0=0 +y_0=0 +k=1 +units=m +no_defs") == 0);
+                pszDst = strstr(pszSrcProj4Defn, "+nadgrids=@null ");
+                char *pszSrc = pszDst + strlen("+nadgrids=@null ");
+                memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
+
+                pszDst = strstr(pszSrcProj4Defn, "+wktext ");
+                if (pszDst)
+                {
+                    pszSrc = pszDst + strlen("+wktext ");
+                    memmove(pszDst, pszSrc, strlen(pszSrc) + 1);
                 }
+                bRet =
+                    strcmp(pszDstProj4Defn,
+                           "+proj=longlat +ellps=WGS84 +no_defs") == 0 &&
+                    (strcmp(pszSrcProj4Defn,
+                            "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 "
+                            "+lon_0=0.0 "
+                            "+x_0=0.0 +y_0=0 +k=1.0 +units=m +no_defs") ==
+                         0 ||
+                     strcmp(pszSrcProj4Defn,
+                            "+proj=merc +a=6378137 +b=6378137 +lat_ts=0 "
+                            "+lon_0=0 "
+                            "+x_0=0 +y_0=0 +k=1 +units=m +no_defs") == 0);
             }
-
-            CPLFree(pszSrcProj4Defn);
-            CPLFree(pszDstProj4Defn);
         }
 
-        if (bWebMercatorToWGS84LongLat)
-        {
-            CPLDebug("OGRCT", "Using WebMercator to WGS84 optimization");
-        }
+        CPLFree(pszSrcProj4Defn);
+        CPLFree(pszDstProj4Defn);
+        return bRet;
+    }
+}
+
+/************************************************************************/
+/*                        DetectWebMercatorToWGS84()                    */
+/************************************************************************/
+
+void OGRProjCT::DetectWebMercatorToWGS84()
+{
+    if (!m_options.d->osCoordOperation.empty() || !poSRSSource || !poSRSTarget)
+        return;
+
+    // Detect webmercator to WGS84
+    bWebMercatorToWGS84LongLat = IsWebMercatorToWGS84(
+        poSRSSource, poSRSTarget, m_eTargetFirstAxisOrient);
+    if (bWebMercatorToWGS84LongLat)
+    {
+        CPLDebug("OGRCT", "Using WebMercator to WGS84 optimization");
+        return;
+    }
+
+    // and the reverse
+    bWGS84LongLatToWebMercator = IsWebMercatorToWGS84(
+        poSRSTarget, poSRSSource, m_eSourceFirstAxisOrient);
+    if (bWGS84LongLatToWebMercator)
+    {
+        CPLDebug("OGRCT", "Using WGS84 to WebMercator optimization");
     }
 }
 
@@ -1587,6 +1645,11 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
 
     DetectWebMercatorToWGS84();
 
+    const char *pszNumThreads = CPLGetConfigOption("OGR_CT_NUM_THREADS", "1");
+    m_nThreads = std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                               ? CPLGetNumCPUs()
+                                               : atoi(pszNumThreads)));
+
     const char *pszCTOpSelection =
         CPLGetConfigOption("OGR_CT_OP_SELECTION", nullptr);
     if (pszCTOpSelection)
@@ -1640,7 +1703,8 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
                  m_bReversePj ? "(reversed) " : "");
 #endif
     }
-    else if (!bWebMercatorToWGS84LongLat && poSRSSource && poSRSTarget)
+    else if (!bWebMercatorToWGS84LongLat && !bWGS84LongLatToWebMercator &&
+             poSRSSource && poSRSTarget)
     {
 #ifdef DEBUG_PERF
         struct CPLTimeVal tvStart;
@@ -1658,7 +1722,27 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
                      dfTargetCoordinateEpoch);
 #endif
 
-        if (m_eStrategy == Strategy::PROJ)
+        std::string osPipelineCacheKey;
+        const char *pszPipelineCache =
+            CPLGetConfigOption("OGR_CT_PIPELINE_CACHE", nullptr);
+        if (m_eStrategy == Strategy::PROJ && pszPipelineCache &&
+            pszPipelineCache[0])
+        {
+            osPipelineCacheKey = GetPipelineCacheKey(
+                MakeCacheKey(poSRSSource, pszSrcSRS, poSRSTarget, pszTargetSRS,
+                             options),
+                dfSourceCoordinateEpoch, dfTargetCoordinateEpoch);
+            m_pj = FindPipelineFromCache(pszPipelineCache, osPipelineCacheKey);
+        }
+
+        if (m_pj)
+        {
+#ifdef DEBUG
+            auto info = proj_pj_info(m_pj);
+            CPLDebug("OGRCT", "%s (from pipeline cache)", info.definition);
+#endif
+        }
+        else if (m_eStrategy == Strategy::PROJ)
         {
             PJ_AREA *area = nullptr;
             if (options.d->bHasAreaOfInterest)
@@ -1729,6 +1813,11 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
                          pszSrcSRS, pszTargetSRS);
                 return FALSE;
             }
+            if (!osPipelineCacheKey.empty())
+            {
+                InsertPipelineIntoCache(pszPipelineCache, osPipelineCacheKey,
+                                        m_pj);
+            }
         }
         else if (!ListCoordinateOperations(pszSrcSRS, pszTargetSRS, options))
         {
@@ -2280,6 +2369,125 @@ int OGRProjCT::Transform(size_t nCount, double *x, double *y, double *z,
     return bOverallSuccess;
 }
 
+/************************************************************************/
+/*                          GetCTThreadPool()                           */
+/*                                                                      */
+/*      Pool of the worker threads among which the transformation of    */
+/*      large arrays is split. It is distinct from the global GDAL      */
+/*      thread pool, as Transform() may itself be called from a job of  */
+/*      the latter, which would then wait for jobs of its own pool.     */
+/************************************************************************/
+
+static std::mutex g_oCTThreadPoolMutex;
+static CPLWorkerThreadPool *g_poCTThreadPool = nullptr;
+
+static CPLWorkerThreadPool *GetCTThreadPool(int nThreads)
+{
+    std::lock_guard<std::mutex> oGuard(g_oCTThreadPoolMutex);
+    if (g_poCTThreadPool == nullptr)
+    {
+        g_poCTThreadPool = new CPLWorkerThreadPool();
+        if (!g_poCTThreadPool->Setup(nThreads, nullptr, nullptr, false))
+        {
+            delete g_poCTThreadPool;
+            g_poCTThreadPool = nullptr;
+        }
+    }
+    else if (nThreads > g_poCTThreadPool->GetThreadCount())
+    {
+        // Increase size of thread pool
+        g_poCTThreadPool->Setup(nThreads, nullptr, nullptr, false);
+    }
+    return g_poCTThreadPool;
+}
+
+namespace
+{
+struct OGRProjCTJob
+{
+    const std::function<void(PJ *, size_t, size_t)> *pfnFunc = nullptr;
+    PJ *pj = nullptr;
+    size_t iStart = 0;
+    size_t iEnd = 0;
+};
+}  // namespace
+
+static void OGRProjCTJobFunc(void *pData)
+{
+    const auto psJob = static_cast<const OGRProjCTJob *>(pData);
+    // A PJ object must be used with the PROJ context of the current thread
+    proj_assign_context(psJob->pj, OSRGetProjTLSContext());
+    // Errors are reported afterwards by the calling thread
+    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+    (*psJob->pfnFunc)(psJob->pj, psJob->iStart, psJob->iEnd);
+}
+
+/************************************************************************/
+/*                      ReportTransformationError()                     */
+/*                                                                      */
+/*      Try to report an error through CPL.  Get proj error string      */
+/*      if possible.  Try to avoid reporting thousands of errors.       */
+/*      Suppress further error reporting on this OGRProjCT if we        */
+/*      have already reported 20 errors.                                */
+/************************************************************************/
+
+void OGRProjCT::ReportTransformationError(PJ_CONTEXT *ctx,
+                                          GUInt32 nLastErrorCounter, size_t i,
+                                          int err)
+{
+    if (++nErrorCount < 20)
+    {
+#if PROJ_VERSION_MAJOR >= 8
+        const char *pszError = proj_context_errno_string(ctx, err);
+#else
+        CPL_IGNORE_RET_VAL(ctx);
+        const char *pszError = proj_errno_string(err);
+#endif
+        if (m_bEmitErrors
+#ifdef PROJ_ERR_OTHER_NO_INVERSE_OP
+            || (i == 0 && err == PROJ_ERR_OTHER_NO_INVERSE_OP)
+#endif
+        )
+        {
+            if (nLastErrorCounter != CPLGetErrorCounter() &&
+                CPLGetLastErrorType() == CE_Failure &&
+                strstr(CPLGetLastErrorMsg(), "PROJ:"))
+            {
+                // do nothing
+            }
+            else if (pszError == nullptr)
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Reprojection failed, err = %d", err);
+            else
+                CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
+        }
+        else
+        {
+            if (pszError == nullptr)
+                CPLDebug("OGRCT", "Reprojection failed, err = %d", err);
+            else
+                CPLDebug("OGRCT", "%s", pszError);
+        }
+    }
+    else if (nErrorCount == 20)
+    {
+        if (m_bEmitErrors)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Reprojection failed, err = %d, further errors will be "
+                     "suppressed on the transform object.",
+                     err);
+        }
+        else
+        {
+            CPLDebug("OGRCT",
+                     "Reprojection failed, err = %d, further errors will be "
+                     "suppressed on the transform object.",
+                     err);
+        }
+    }
+}
+
 /************************************************************************/
 /*                       TransformWithErrorCodes()                      */
 /************************************************************************/
@@ -2502,6 +2710,73 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
         bTransformDone = true;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Optimized transform from WGS84 to WebMercator                   */
+    /* -------------------------------------------------------------------- */
+    if (bWGS84LongLatToWebMercator)
+    {
+        constexpr double SPHERE_RADIUS = 6378137.0;
+        constexpr double DEG_TO_RAD = M_PI / 180.;
+
+        if (m_eSourceFirstAxisOrient != OAO_East)
+        {
+            std::swap(x, y);
+        }
+
+        const auto nLastErrorCounter = CPLGetErrorCounter();
+        double dfLastLat = HUGE_VAL;
+        double dfLastNorthing = HUGE_VAL;
+        for (size_t i = 0; i < nCount; i++)
+        {
+            double dfLong = x[i] * DEG_TO_RAD;
+            const double dfLat = y[i] * DEG_TO_RAD;
+            // Same validity checks as PROJ, that also reject NaN and HUGE_VAL.
+            // Longitudes out of [-180,180] are wrapped, unless the result
+            // must be checked with the inverse transformation, which would
+            // not give back the input longitude.
+            if (!(std::fabs(dfLat) < M_PI / 2 - 1e-10) ||
+                !(std::fabs(dfLong) <= 10) ||
+                (std::fabs(dfLong) > M_PI + 1e-12 &&
+                 m_options.d->bCheckWithInvertProj))
+            {
+                x[i] = HUGE_VAL;
+                y[i] = HUGE_VAL;
+                constexpr int err =
+                    PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
+                if (panErrorCodes)
+                    panErrorCodes[i] = err;
+                ReportTransformationError(OSRGetProjTLSContext(),
+                                          nLastErrorCounter, i, err);
+                continue;
+            }
+            if (std::fabs(dfLong) > M_PI + 1e-12)
+            {
+                dfLong += M_PI;
+                dfLong -= 2 * M_PI * std::floor(dfLong / (2 * M_PI));
+                dfLong -= M_PI;
+            }
+            x[i] = SPHERE_RADIUS * dfLong;
+
+            // Optimization for the case where we are provided a whole line
+            // of same latitude.
+            if (y[i] != dfLastLat)
+            {
+                dfLastLat = y[i];
+                dfLastNorthing = SPHERE_RADIUS * std::asinh(std::tan(dfLat));
+            }
+            y[i] = dfLastNorthing;
+            if (panErrorCodes)
+                panErrorCodes[i] = 0;
+        }
+
+        if (m_eTargetFirstAxisOrient != OAO_East)
+        {
+            std::swap(x, y);
+        }
+
+        bTransformDone = true;
+    }
+
     // Determine the default coordinate epoch, if not provided in the point to
     // transform.
     // For time-dependent transformations, PROJ can currently only do
@@ -2686,7 +2961,11 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
     {
         const auto nLastErrorCounter = CPLGetErrorCounter();
 
-        for (size_t i = 0; i < nCount; i++)
+        // Transform the i-th point with pjIn, and return the PROJ error code,
+        // or -1 for an invalid input coordinate (which is not reported as an
+        // error).
+        const auto TransformPoint =
+            [this, x, y, z, t, dfDefaultTime](PJ *pjIn, size_t i)
         {
             PJ_COORD coord;
             const double xIn = x[i];
@@ -2695,16 +2974,14 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
             {
                 x[i] = HUGE_VAL;
                 y[i] = HUGE_VAL;
-                if (panErrorCodes)
-                    panErrorCodes[i] = PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
-                continue;
+                return -1;
             }
             coord.xyzt.x = x[i];
             coord.xyzt.y = y[i];
             coord.xyzt.z = z ? z[i] : 0;
             coord.xyzt.t = t ? t[i] : dfDefaultTime;
-            proj_errno_reset(pj);
-            coord = proj_trans(pj, m_bReversePj ? PJ_INV : PJ_FWD, coord);
+            proj_errno_reset(pjIn);
+            coord = proj_trans(pjIn, m_bReversePj ? PJ_INV : PJ_FWD, coord);
             x[i] = coord.xyzt.x;
             y[i] = coord.xyzt.y;
             if (z)
@@ -2721,8 +2998,8 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
                 x[i] = HUGE_VAL;
                 y[i] = HUGE_VAL;
                 err = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
-                static bool bHasWarned = false;
-                if (!bHasWarned)
+                static std::atomic<bool> bHasWarned{false};
+                if (!bHasWarned.exchange(true))
                 {
 #ifdef DEBUG
                     CPLError(CE_Warning, CPLE_AppDefined,
@@ -2731,12 +3008,11 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
                     CPLDebug("OGR_CT",
                              "PROJ returned a NaN value. It should be fixed");
 #endif
-                    bHasWarned = true;
                 }
             }
             else if (coord.xyzt.x == HUGE_VAL)
             {
-                err = proj_errno(pj);
+                err = proj_errno(pjIn);
                 // PROJ should normally emit an error, but in case it does not
                 // (e.g PROJ 6.3 with the +ortho projection), synthetize one
                 if (err == 0)
@@ -2748,7 +3024,8 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
                 // reproject coordinates outside the validity area of the
                 // projection. So let's do the reverse reprojection and compare
                 // with the source coordinates.
-                coord = proj_trans(pj, m_bReversePj ? PJ_FWD : PJ_INV, coord);
+                coord =
+                    proj_trans(pjIn, m_bReversePj ? PJ_FWD : PJ_INV, coord);
                 if (fabs(coord.xyzt.x - xIn) > dfThreshold ||
                     fabs(coord.xyzt.y - yIn) > dfThreshold)
                 {
@@ -2757,75 +3034,98 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
                     y[i] = HUGE_VAL;
                 }
             }
-
-            if (panErrorCodes)
-                panErrorCodes[i] = err;
-
-            /* --------------------------------------------------------------------
-             */
-            /*      Try to report an error through CPL.  Get proj error string
-             */
-            /*      if possible.  Try to avoid reporting thousands of errors. */
-            /*      Suppress further error reporting on this OGRProjCT if we */
-            /*      have already reported 20 errors. */
-            /* --------------------------------------------------------------------
-             */
-            if (err != 0)
+            return err;
+        };
+
+        // Split large arrays among worker threads, each of them using its
+        // own clone of the PJ object.
+        constexpr size_t MIN_POINTS_PER_JOB = 10000;
+        const int nJobs = static_cast<int>(std::min(
+            static_cast<size_t>(m_nThreads), nCount / MIN_POINTS_PER_JOB));
+        std::unique_ptr<CPLJobQueue> poJobQueue;
+        if (nJobs > 1)
+        {
+            auto poThreadPool = GetCTThreadPool(m_nThreads);
+            if (poThreadPool)
+                poJobQueue = poThreadPool->CreateJobQueue();
+        }
+        if (poJobQueue &&
+            (pj != m_pjThreadSrc ||
+             m_apjThreadClones.size() < static_cast<size_t>(nJobs)))
+        {
+            if (pj != m_pjThreadSrc)
+                m_apjThreadClones.clear();
+            m_pjThreadSrc = pj;
+            while (m_apjThreadClones.size() < static_cast<size_t>(nJobs))
             {
-                if (++nErrorCount < 20)
+                PJ *pjClone = proj_clone(ctx, pj);
+                if (!pjClone)
                 {
-#if PROJ_VERSION_MAJOR >= 8
-                    const char *pszError = proj_context_errno_string(ctx, err);
-#else
-                    const char *pszError = proj_errno_string(err);
-#endif
-                    if (m_bEmitErrors
-#ifdef PROJ_ERR_OTHER_NO_INVERSE_OP
-                        || (i == 0 && err == PROJ_ERR_OTHER_NO_INVERSE_OP)
-#endif
-                    )
-                    {
-                        if (nLastErrorCounter != CPLGetErrorCounter() &&
-                            CPLGetLastErrorType() == CE_Failure &&
-                            strstr(CPLGetLastErrorMsg(), "PROJ:"))
-                        {
-                            // do nothing
-                        }
-                        else if (pszError == nullptr)
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Reprojection failed, err = %d", err);
-                        else
-                            CPLError(CE_Failure, CPLE_AppDefined, "%s",
-                                     pszError);
-                    }
-                    else
-                    {
-                        if (pszError == nullptr)
-                            CPLDebug("OGRCT", "Reprojection failed, err = %d",
-                                     err);
-                        else
-                            CPLDebug("OGRCT", "%s", pszError);
-                    }
+                    poJobQueue.reset();
+                    break;
                 }
-                else if (nErrorCount == 20)
+                m_apjThreadClones.emplace_back(pjClone);
+            }
+        }
+
+        std::vector<int> anErrorCodes;
+        if (poJobQueue && !panErrorCodes)
+        {
+            try
+            {
+                anErrorCodes.resize(nCount);
+            }
+            catch (const std::bad_alloc &)
+            {
+                poJobQueue.reset();
+            }
+        }
+
+        if (poJobQueue)
+        {
+            int *panErr = panErrorCodes ? panErrorCodes : anErrorCodes.data();
+
+            const std::function<void(PJ *, size_t, size_t)> oFunc =
+                [&TransformPoint, panErr](PJ *pjJob, size_t iStart, size_t iEnd)
+            {
+                for (size_t i = iStart; i < iEnd; ++i)
+                    panErr[i] = TransformPoint(pjJob, i);
+            };
+            std::vector<OGRProjCTJob> asJobs(nJobs);
+            for (int iJob = 0; iJob < nJobs; ++iJob)
+            {
+                asJobs[iJob].pfnFunc = &oFunc;
+                asJobs[iJob].pj = m_apjThreadClones[iJob];
+                asJobs[iJob].iStart = nCount * iJob / nJobs;
+                asJobs[iJob].iEnd = nCount * (iJob + 1) / nJobs;
+                poJobQueue->SubmitJob(OGRProjCTJobFunc, &asJobs[iJob]);
+            }
+            poJobQueue->WaitCompletion();
+
+            for (size_t i = 0; i < nCount; i++)
+            {
+                if (panErr[i] < 0)
+                    panErr[i] = PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
+                else if (panErr[i] != 0)
+                    ReportTransformationError(ctx, nLastErrorCounter, i,
+                                              panErr[i]);
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < nCount; i++)
+            {
+                const int err = TransformPoint(pj, i);
+                if (err < 0)
                 {
-                    if (m_bEmitErrors)
-                    {
-                        CPLError(CE_Failure, CPLE_AppDefined,
-                                 "Reprojection failed, err = %d, further "
-                                 "errors will be "
-                                 "suppressed on the transform object.",
-                                 err);
-                    }
-                    else
-                    {
-                        CPLDebug("OGRCT",
-                                 "Reprojection failed, err = %d, further "
-                                 "errors will be "
-                                 "suppressed on the transform object.",
-                                 err);
-                    }
+                    if (panErrorCodes)
+                        panErrorCodes[i] = PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
+                    continue;
                 }
+                if (panErrorCodes)
+                    panErrorCodes[i] = err;
+                if (err != 0)
+                    ReportTransformationError(ctx, nLastErrorCounter, i, err);
             }
         }
     }
@@ -3548,7 +3848,8 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
 {
     PJ *new_pj = nullptr;
     // m_pj can be nullptr if using m_eStrategy != PROJ
-    if (m_pj && !bWebMercatorToWGS84LongLat && !bNoTransform)
+    if (m_pj && !bWebMercatorToWGS84LongLat && !bWGS84LongLatToWebMercator &&
+        !bNoTransform)
     {
         // See https://github.com/OSGeo/PROJ/pull/2582
         // This may fail before PROJ 8.0.1 if the m_pj object is a "meta"
@@ -3599,6 +3900,7 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
     poNewCT->bNoTransform = bNoTransform;
     poNewCT->m_eStrategy = m_eStrategy;
     poNewCT->m_options = newOptions;
+    poNewCT->m_nThreads = m_nThreads;
 
     poNewCT->DetectWebMercatorToWGS84();
 
@@ -3611,9 +3913,22 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
 
 void OSRCTCleanCache()
 {
-    std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
-    delete g_poCTCache;
-    g_poCTCache = nullptr;
+    {
+        std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
+        delete g_poCTCache;
+        g_poCTCache = nullptr;
+    }
+
+    {
+        std::lock_guard<std::mutex> oGuard(g_oCTPipelineCacheMutex);
+        delete g_poCTPipelineCache;
+        g_poCTPipelineCache = nullptr;
+        g_osCTPipelineCacheFilename.clear();
+    }
+
+    std::lock_guard<std::mutex> oGuard(g_oCTThreadPoolMutex);
+    delete g_poCTThreadPool;
+    g_poCTThreadPool = nullptr;
 }
 
 /************************************************************************/
@@ -3693,18 +4008,152 @@ OGRProjCT *OGRProjCT::FindFromCache(
 
     const auto key =
         MakeCacheKey(poSource, pszSrcSRS, poTarget, pszTargetSRS, options);
-    // Get value from cache and remove it
+    // Return a copy of the cached value, and leave it in the cache, so that
+    // other threads asking for the same transformation can also use it.
     std::lock_guard<std::mutex> oGuard(g_oCTCacheMutex);
     CTCacheValue *cachedValue = g_poCTCache->getPtr(key);
     if (cachedValue)
     {
-        auto poCT = cachedValue->release();
-        g_poCTCache->remove(key);
+        auto poCT = new OGRProjCT(*(cachedValue->get()));
+        poCT->nErrorCount = 0;
+        poCT->m_bEmitErrors = true;
         return poCT;
     }
     return nullptr;
 }
 
+/************************************************************************/
+/*                        GetPipelineCacheKey()                         */
+/************************************************************************/
+
+std::string OGRProjCT::GetPipelineCacheKey(const CTCacheKey &osCTKey,
+                                           double dfSourceEpoch,
+                                           double dfTargetEpoch)
+{
+    // The selected operation depends on the PROJ version and on the content
+    // of its database, so take them into account.
+    std::string osKey(osCTKey);
+    osKey += std::to_string(dfSourceEpoch);
+    osKey += std::to_string(dfTargetEpoch);
+    osKey += proj_info().version;
+    const char *pszDBPath =
+        proj_context_get_database_path(OSRGetProjTLSContext());
+    if (pszDBPath)
+        osKey += pszDBPath;
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    std::string osRet(pszHex);
+    CPLFree(pszHex);
+    return osRet;
+}
+
+/************************************************************************/
+/*                          LoadPipelineCache()                         */
+/************************************************************************/
+
+// Must be called with g_oCTPipelineCacheMutex held.
+static void LoadPipelineCache(const char *pszFilename)
+{
+    if (g_poCTPipelineCache && g_osCTPipelineCacheFilename == pszFilename)
+        return;
+
+    delete g_poCTPipelineCache;
+    g_poCTPipelineCache = new std::map<std::string, std::string>();
+    g_osCTPipelineCacheFilename = pszFilename;
+
+    VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+    if (fp == nullptr)
+        return;
+    // Each line is made of the hexadecimal SHA256 of the key, a tabulation
+    // and the PROJ pipeline. Incomplete lines, that could result from
+    // concurrent writers, are ignored.
+    while (const char *pszLine = CPLReadLine2L(fp, 1024 * 1024, nullptr))
+    {
+        const char *pszTab = strchr(pszLine, '\t');
+        if (pszTab && pszTab - pszLine == 2 * CPL_SHA256_HASH_SIZE &&
+            STARTS_WITH(pszTab + 1, "+proj="))
+        {
+            (*g_poCTPipelineCache)[std::string(pszLine, pszTab - pszLine)] =
+                pszTab + 1;
+        }
+    }
+    VSIFCloseL(fp);
+    CPLDebug("OGRCT", "%d pipeline(s) loaded from %s",
+             static_cast<int>(g_poCTPipelineCache->size()), pszFilename);
+}
+
+/************************************************************************/
+/*                        FindPipelineFromCache()                       */
+/************************************************************************/
+
+PJ *OGRProjCT::FindPipelineFromCache(const char *pszFilename,
+                                     const std::string &osKey)
+{
+    std::string osPipeline;
+    {
+        std::lock_guard<std::mutex> oGuard(g_oCTPipelineCacheMutex);
+        LoadPipelineCache(pszFilename);
+        const auto oIter = g_poCTPipelineCache->find(osKey);
+        if (oIter == g_poCTPipelineCache->end())
+            return nullptr;
+        osPipeline = oIter->second;
+    }
+
+    // The pipeline might no longer be instantiable, e.g. if it uses a grid
+    // that has been removed. In that case, just do the regular research.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    return proj_create(OSRGetProjTLSContext(), osPipeline.c_str());
+}
+
+/************************************************************************/
+/*                       InsertPipelineIntoCache()                      */
+/************************************************************************/
+
+void OGRProjCT::InsertPipelineIntoCache(const char *pszFilename,
+                                        const std::string &osKey, PJ *pj)
+{
+    // When several candidate operations have been retained by
+    // proj_create_crs_to_crs(), the returned object is not a coordinate
+    // operation by itself, and it cannot be serialized.
+    if (proj_get_type(pj) == PJ_TYPE_UNKNOWN)
+        return;
+
+    auto ctx = OSRGetProjTLSContext();
+    std::string osPipeline;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        const char *const apszOptions[] = {"MULTILINE=NO", nullptr};
+        const char *pszPipeline =
+            proj_as_proj_string(ctx, pj, PJ_PROJ_5, apszOptions);
+        if (pszPipeline == nullptr)
+            return;
+        osPipeline = pszPipeline;
+    }
+
+    std::lock_guard<std::mutex> oGuard(g_oCTPipelineCacheMutex);
+    LoadPipelineCache(pszFilename);
+    if (!g_poCTPipelineCache->insert(std::make_pair(osKey, osPipeline))
+             .second)
+        return;
+
+    // Append a single line in one write, so that several processes can
+    // share the same file.
+    VSILFILE *fp = VSIFOpenL(pszFilename, "ab");
+    if (fp == nullptr)
+    {
+        CPLDebug("OGRCT", "Cannot open %s for writing", pszFilename);
+        return;
+    }
+    const std::string osLine(osKey + '\t' + osPipeline + '\n');
+    if (VSIFWriteL(osLine.data(), osLine.size(), 1, fp) != 1)
+    {
+        CPLDebug("OGRCT", "Cannot write into %s", pszFilename);
+    }
+    VSIFCloseL(fp);
+}
+
 //! @endcond
 
 /************************************************************************/
@@ -42,6 +42,7 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <memory>
 #include <new>
 #include <vector>
 
@@ -54,6 +55,7 @@
 #include "ogr_featurestyle.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
+#include "ogr_wkb.h"
 #include "ogrgeojsonreader.h"
 
 #include "cpl_json_header.h"
@@ -84,18 +86,32 @@
 
 OGRFeature::OGRFeature(OGRFeatureDefn *poDefnIn)
     : nFID(OGRNullFID), poDefn(poDefnIn), papoGeometries(nullptr),
-      pauFields(nullptr), m_pszNativeData(nullptr),
+      m_papoLazyGeometries(nullptr), pauFields(nullptr),
+      m_bGeometriesInFieldBlock(false), m_pszNativeData(nullptr),
       m_pszNativeMediaType(nullptr), m_pszStyleString(nullptr),
       m_poStyleTable(nullptr), m_pszTmpFieldValue(nullptr)
 {
     poDefnIn->Reference();
 
+    // Fields and geometry pointers are allocated in a single block, to
+    // save a heap allocation per feature.
     const int nFieldCount = poDefn->GetFieldCount();
-    pauFields = static_cast<OGRField *>(
-        VSI_MALLOC_VERBOSE(nFieldCount * sizeof(OGRField)));
-
-    papoGeometries = static_cast<OGRGeometry **>(
-        VSI_CALLOC_VERBOSE(poDefn->GetGeomFieldCount(), sizeof(OGRGeometry *)));
+    const int nGeomFieldCount = poDefn->GetGeomFieldCount();
+    static_assert(sizeof(OGRField) % sizeof(OGRGeometry *) == 0,
+                  "geometry pointers should be aligned");
+    const size_t nFieldsSize = nFieldCount * sizeof(OGRField);
+    if (nFieldCount + nGeomFieldCount > 0)
+    {
+        pauFields = static_cast<OGRField *>(VSI_MALLOC_VERBOSE(
+            nFieldsSize + nGeomFieldCount * sizeof(OGRGeometry *)));
+    }
+    if (pauFields != nullptr)
+    {
+        papoGeometries = reinterpret_cast<OGRGeometry **>(
+            reinterpret_cast<GByte *>(pauFields) + nFieldsSize);
+        memset(papoGeometries, 0, nGeomFieldCount * sizeof(OGRGeometry *));
+        m_bGeometriesInFieldBlock = true;
+    }
 
     // Initialize array to the unset special value.
     if (pauFields != nullptr)
@@ -192,12 +208,14 @@ OGRFeature::~OGRFeature()
             delete papoGeometries[i];
         }
     }
+    DiscardLazyGeometries();
 
     if (poDefn)
         poDefn->Release();
 
     CPLFree(pauFields);
-    CPLFree(papoGeometries);
+    if (!m_bGeometriesInFieldBlock)
+        CPLFree(papoGeometries);
     CPLFree(m_pszStyleString);
     CPLFree(m_pszTmpFieldValue);
     CPLFree(m_pszNativeData);
@@ -355,6 +373,7 @@ void OGRFeature::Reset()
             papoGeometries[i] = nullptr;
         }
     }
+    DiscardLazyGeometries();
 
     if (m_pszStyleString)
     {
@@ -604,6 +623,7 @@ OGRGeometry *OGRFeature::StealGeometry()
 {
     if (GetGeomFieldCount() > 0)
     {
+        MaterializeGeometry(0);
         OGRGeometry *poReturn = papoGeometries[0];
         papoGeometries[0] = nullptr;
         return poReturn;
@@ -632,6 +652,7 @@ OGRGeometry *OGRFeature::StealGeometry(int iGeomField)
 {
     if (iGeomField >= 0 && iGeomField < GetGeomFieldCount())
     {
+        MaterializeGeometry(iGeomField);
         OGRGeometry *poReturn = papoGeometries[iGeomField];
         papoGeometries[iGeomField] = nullptr;
         return poReturn;
@@ -806,8 +827,8 @@ OGRGeometry *OGRFeature::GetGeomFieldRef(int iField)
 {
     if (iField < 0 || iField >= GetGeomFieldCount())
         return nullptr;
-    else
-        return papoGeometries[iField];
+    MaterializeGeometry(iField);
+    return papoGeometries[iField];
 }
 
 /**
@@ -826,8 +847,8 @@ const OGRGeometry *OGRFeature::GetGeomFieldRef(int iField) const
 {
     if (iField < 0 || iField >= GetGeomFieldCount())
         return nullptr;
-    else
-        return papoGeometries[iField];
+    MaterializeGeometry(iField);
+    return papoGeometries[iField];
 }
 
 /************************************************************************/
@@ -851,6 +872,7 @@ OGRGeometry *OGRFeature::GetGeomFieldRef(const char *pszFName)
     if (iField < 0)
         return nullptr;
 
+    MaterializeGeometry(iField);
     return papoGeometries[iField];
 }
 
@@ -870,6 +892,7 @@ const OGRGeometry *OGRFeature::GetGeomFieldRef(const char *pszFName) const
     if (iField < 0)
         return nullptr;
 
+    MaterializeGeometry(iField);
     return papoGeometries[iField];
 }
 
@@ -946,6 +969,7 @@ OGRErr OGRFeature::SetGeomFieldDirectly(int iField, OGRGeometry *poGeomIn)
         return OGRERR_FAILURE;
     }
 
+    DiscardLazyGeometry(iField);
     if (papoGeometries[iField] != poGeomIn)
     {
         delete papoGeometries[iField];
@@ -1021,6 +1045,7 @@ OGRErr OGRFeature::SetGeomField(int iField, const OGRGeometry *poGeomIn)
     if (iField < 0 || iField >= GetGeomFieldCount())
         return OGRERR_FAILURE;
 
+    DiscardLazyGeometry(iField);
     if (papoGeometries[iField] != poGeomIn)
     {
         delete papoGeometries[iField];
@@ -1067,6 +1092,209 @@ OGRErr OGR_F_SetGeomField(OGRFeatureH hFeat, int iField, OGRGeometryH hGeom)
         iField, OGRGeometry::FromHandle(hGeom));
 }
 
+/************************************************************************/
+/*                          LazyGeometry                                */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+struct OGRFeature::LazyGeometry
+{
+    std::vector<GByte> abyWKB{};
+    OGREnvelope sEnvelope{};
+    bool bEnvelopeSet = false;
+};
+
+//! @endcond
+
+/************************************************************************/
+/*                        SetGeomFieldLazyWKB()                         */
+/************************************************************************/
+
+/**
+ * \brief Set feature geometry of a specified geometry field from its WKB
+ * representation, without decoding it.
+ *
+ * The WKB content is copied into the feature, and only decoded into a
+ * OGRGeometry when it is first requested (e.g. with GetGeomFieldRef() or
+ * StealGeometry()). This saves the cost of building geometries that are
+ * never accessed by the consumer of the feature. Drivers that read WKB
+ * encoded geometries are expected to use this method when that is
+ * beneficial.
+ *
+ * The geometry will be assigned the spatial reference system of the
+ * geometry field definition when it is decoded. If the WKB content is
+ * invalid, an error is emitted at that time, and the geometry is considered
+ * to be null.
+ *
+ * @param iField geometry field to set.
+ * @param pabyWKB WKB content (ISO or extended WKB, either endianness).
+ * Must not be NULL.
+ * @param nWKBSize size of pabyWKB in bytes.
+ * @param psEnvelope envelope of the geometry, if known by the caller, or
+ * NULL. It will then be returned by GetGeomFieldEnvelope() without parsing
+ * the WKB content.
+ *
+ * @return true in case of success.
+ *
+ * @since GDAL 3.10
+ */
+
+bool OGRFeature::SetGeomFieldLazyWKB(int iField, const GByte *pabyWKB,
+                                     size_t nWKBSize,
+                                     const OGREnvelope *psEnvelope)
+{
+    if (iField < 0 || iField >= GetGeomFieldCount() || pabyWKB == nullptr)
+        return false;
+
+    delete papoGeometries[iField];
+    papoGeometries[iField] = nullptr;
+    DiscardLazyGeometry(iField);
+
+    if (m_papoLazyGeometries == nullptr)
+    {
+        m_papoLazyGeometries = static_cast<LazyGeometry **>(
+            VSI_CALLOC_VERBOSE(GetGeomFieldCount(), sizeof(LazyGeometry *)));
+        if (m_papoLazyGeometries == nullptr)
+            return false;
+    }
+
+    try
+    {
+        auto poLazy = std::make_unique<LazyGeometry>();
+        poLazy->abyWKB.assign(pabyWKB, pabyWKB + nWKBSize);
+        if (psEnvelope)
+        {
+            poLazy->sEnvelope = *psEnvelope;
+            poLazy->bEnvelopeSet = true;
+        }
+        m_papoLazyGeometries[iField] = poLazy.release();
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       GetGeomFieldEnvelope()                         */
+/************************************************************************/
+
+/**
+ * \brief Return the envelope of the geometry of a specified geometry field.
+ *
+ * Contrary to GetGeomFieldRef(iField)->getEnvelope(), this does not
+ * decode a geometry set with SetGeomFieldLazyWKB(): the envelope provided
+ * at that time is returned, or it is computed from the WKB content.
+ *
+ * @param iField geometry field.
+ * @param[out] sEnvelope envelope.
+ *
+ * @return false if the geometry is null or empty, or the envelope cannot be
+ * computed.
+ *
+ * @since GDAL 3.10
+ */
+
+bool OGRFeature::GetGeomFieldEnvelope(int iField, OGREnvelope &sEnvelope) const
+{
+    if (iField < 0 || iField >= GetGeomFieldCount())
+        return false;
+
+    if (m_papoLazyGeometries && m_papoLazyGeometries[iField])
+    {
+        const LazyGeometry *poLazy = m_papoLazyGeometries[iField];
+        if (poLazy->bEnvelopeSet)
+        {
+            sEnvelope = poLazy->sEnvelope;
+            return sEnvelope.IsInit();
+        }
+        return OGRWKBGetBoundingBox(poLazy->abyWKB.data(),
+                                    poLazy->abyWKB.size(), sEnvelope) &&
+               sEnvelope.IsInit();
+    }
+
+    const OGRGeometry *poGeom = papoGeometries[iField];
+    if (poGeom == nullptr || poGeom->IsEmpty())
+        return false;
+    poGeom->getEnvelope(&sEnvelope);
+    return true;
+}
+
+/************************************************************************/
+/*                        MaterializeGeometry()                         */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+/** Decode the lazy geometry of the specified geometry field, if any. */
+void OGRFeature::MaterializeGeometry(int iField) const
+{
+    if (m_papoLazyGeometries == nullptr || m_papoLazyGeometries[iField] == nullptr)
+        return;
+
+    std::unique_ptr<LazyGeometry> poLazy(m_papoLazyGeometries[iField]);
+    m_papoLazyGeometries[iField] = nullptr;
+
+    OGRGeometry *poGeom = nullptr;
+    if (OGRGeometryFactory::createFromWkb(
+            poLazy->abyWKB.data(), poDefn->GetGeomFieldDefn(iField)->GetSpatialRef(),
+            &poGeom, poLazy->abyWKB.size()) != OGRERR_NONE)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unable to read geometry of feature " CPL_FRMT_GIB, nFID);
+        delete poGeom;
+        poGeom = nullptr;
+    }
+    papoGeometries[iField] = poGeom;
+}
+
+/************************************************************************/
+/*                       MaterializeGeometries()                        */
+/************************************************************************/
+
+/** Decode all lazy geometries. */
+void OGRFeature::MaterializeGeometries() const
+{
+    if (m_papoLazyGeometries == nullptr)
+        return;
+    for (int i = 0; i < GetGeomFieldCount(); ++i)
+        MaterializeGeometry(i);
+}
+
+/************************************************************************/
+/*                        DiscardLazyGeometry()                         */
+/************************************************************************/
+
+/** Discard the lazy geometry of the specified geometry field, if any. */
+void OGRFeature::DiscardLazyGeometry(int iField)
+{
+    if (m_papoLazyGeometries)
+    {
+        delete m_papoLazyGeometries[iField];
+        m_papoLazyGeometries[iField] = nullptr;
+    }
+}
+
+/************************************************************************/
+/*                       DiscardLazyGeometries()                        */
+/************************************************************************/
+
+/** Discard all lazy geometries. */
+void OGRFeature::DiscardLazyGeometries()
+{
+    if (m_papoLazyGeometries)
+    {
+        for (int i = 0; i < GetGeomFieldCount(); ++i)
+            delete m_papoLazyGeometries[i];
+        CPLFree(m_papoLazyGeometries);
+        m_papoLazyGeometries = nullptr;
+    }
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                               Clone()                                */
 /************************************************************************/
@@ -1158,6 +1386,17 @@ bool OGRFeature::CopySelfTo(OGRFeature *poNew) const
                     return false;
                 }
             }
+            else if (m_papoLazyGeometries && m_papoLazyGeometries[i])
+            {
+                // Keep the clone lazy as well
+                const LazyGeometry *poLazy = m_papoLazyGeometries[i];
+                if (!poNew->SetGeomFieldLazyWKB(
+                        i, poLazy->abyWKB.data(), poLazy->abyWKB.size(),
+                        poLazy->bEnvelopeSet ? &poLazy->sEnvelope : nullptr))
+                {
+                    return false;
+                }
+            }
         }
     }
 
@@ -1516,13 +1755,13 @@ int OGRFeature::IsFieldSet(int iField) const
 
             case SPF_OGR_GEOM_WKT:
             case SPF_OGR_GEOMETRY:
-                return GetGeomFieldCount() > 0 && papoGeometries[0] != nullptr;
+                return GetGeomFieldCount() > 0 && GetGeometryRef() != nullptr;
 
             case SPF_OGR_STYLE:
                 return GetStyleString() != nullptr;
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeometryRef() == nullptr)
                     return FALSE;
 
                 return OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0])) !=
@@ -2020,7 +2259,7 @@ int OGRFeature::GetFieldAsInteger(int iField) const
             }
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeometryRef() == nullptr)
                     return 0;
                 return static_cast<int>(
                     OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0])));
@@ -2147,7 +2386,7 @@ GIntBig OGRFeature::GetFieldAsInteger64(int iField) const
                 return nFID;
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeometryRef() == nullptr)
                     return 0;
                 return static_cast<int>(
                     OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0])));
@@ -2265,7 +2504,7 @@ double OGRFeature::GetFieldAsDouble(int iField) const
                 return static_cast<double>(GetFID());
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeometryRef() == nullptr)
                     return 0.0;
                 return OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0]));
 
@@ -2458,8 +2697,8 @@ const char *OGRFeature::GetFieldAsString(int iField) const
             }
 
             case SPF_OGR_GEOMETRY:
-                if (GetGeomFieldCount() > 0 && papoGeometries[0] != nullptr)
-                    return papoGeometries[0]->getGeometryName();
+                if (GetGeomFieldCount() > 0 && GetGeometryRef() != nullptr)
+                    return GetGeometryRef()->getGeometryName();
                 else
                     return "";
 
@@ -2471,10 +2710,10 @@ const char *OGRFeature::GetFieldAsString(int iField) const
 
             case SPF_OGR_GEOM_WKT:
             {
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeometryRef() == nullptr)
                     return "";
 
-                if (papoGeometries[0]->exportToWkt(&m_pszTmpFieldValue) ==
+                if (GetGeometryRef()->exportToWkt(&m_pszTmpFieldValue) ==
                     OGRERR_NONE)
                     return m_pszTmpFieldValue;
                 else
@@ -2483,7 +2722,7 @@ const char *OGRFeature::GetFieldAsString(int iField) const
 
             case SPF_OGR_GEOM_AREA:
             {
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldCount() == 0 || GetGeometryRef() == nullptr)
                     return "";
 
                 constexpr size_t MAX_SIZE = 20 + 1;
@@ -2532,17 +2771,14 @@ const char *OGRFeature::GetFieldAsString(int iField) const
     }
     else if (eType == OFTReal)
     {
-        char szFormat[32] = {};
         constexpr int TEMP_BUFFER_SIZE = 80;
         char szTempBuffer[TEMP_BUFFER_SIZE] = {};
 
         if (poFDefn->GetWidth() != 0)
         {
-            snprintf(szFormat, sizeof(szFormat), "%%.%df",
-                     poFDefn->GetPrecision());
-
-            CPLsnprintf(szTempBuffer, TEMP_BUFFER_SIZE, szFormat,
-                        pauFields[iField].Real);
+            OGRFormatDoublePrecision(szTempBuffer, TEMP_BUFFER_SIZE,
+                                     pauFields[iField].Real,
+                                     poFDefn->GetPrecision(), 'f');
         }
         else
         {
@@ -2554,10 +2790,8 @@ const char *OGRFeature::GetFieldAsString(int iField) const
             }
             else
             {
-                strcpy(szFormat, "%.15g");
-
-                CPLsnprintf(szTempBuffer, TEMP_BUFFER_SIZE, szFormat,
-                            pauFields[iField].Real);
+                OGRFormatDoublePrecision(szTempBuffer, TEMP_BUFFER_SIZE,
+                                         pauFields[iField].Real, 15, 'g');
             }
         }
 
@@ -5626,6 +5860,8 @@ void OGRFeature::DumpReadable(FILE *fpOut, CSLConstList papszOptions) const
 
 std::string OGRFeature::DumpReadableAsString(CSLConstList papszOptions) const
 {
+    MaterializeGeometries();
+
     std::string osRet;
 
     osRet += CPLOPrintf("OGRFeature(%s):" CPL_FRMT_GIB "\n", poDefn->GetName(),
@@ -6807,6 +7043,7 @@ OGRErr OGRFeature::RemapFields(OGRFeatureDefn *poNewDefn,
     /* -------------------------------------------------------------------- */
     /*      Apply new definition and fields.                                */
     /* -------------------------------------------------------------------- */
+    DetachGeometriesFromFieldBlock();
     CPLFree(pauFields);
     pauFields = pauNewFields;
 
@@ -6815,6 +7052,26 @@ OGRErr OGRFeature::RemapFields(OGRFeatureDefn *poNewDefn,
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                   DetachGeometriesFromFieldBlock()                   */
+/*                                                                      */
+/*      Moves the array of geometries into its own allocation, before   */
+/*      the field array is reallocated or freed.                        */
+/************************************************************************/
+
+void OGRFeature::DetachGeometriesFromFieldBlock()
+{
+    if (!m_bGeometriesInFieldBlock)
+        return;
+    const int nGeomFieldCount = poDefn->GetGeomFieldCount();
+    OGRGeometry **papoNewGeometries = static_cast<OGRGeometry **>(
+        CPLCalloc(std::max(1, nGeomFieldCount), sizeof(OGRGeometry *)));
+    memcpy(papoNewGeometries, papoGeometries,
+           nGeomFieldCount * sizeof(OGRGeometry *));
+    papoGeometries = papoNewGeometries;
+    m_bGeometriesInFieldBlock = false;
+}
+
 /************************************************************************/
 /*                            AppendField()                             */
 /*                                                                      */
@@ -6824,6 +7081,7 @@ OGRErr OGRFeature::RemapFields(OGRFeatureDefn *poNewDefn,
 
 void OGRFeature::AppendField()
 {
+    DetachGeometriesFromFieldBlock();
     int nFieldCount = poDefn->GetFieldCount();
     pauFields = static_cast<OGRField *>(
         CPLRealloc(pauFields, nFieldCount * sizeof(OGRField)));
@@ -6844,6 +7102,9 @@ OGRErr OGRFeature::RemapGeomFields(OGRFeatureDefn *poNewDefn,
     if (poNewDefn == nullptr)
         poNewDefn = poDefn;
 
+    MaterializeGeometries();
+    DiscardLazyGeometries();
+
     OGRGeometry **papoNewGeomFields = static_cast<OGRGeometry **>(
         CPLCalloc(poNewDefn->GetGeomFieldCount(), sizeof(OGRGeometry *)));
 
@@ -6868,8 +7129,10 @@ OGRErr OGRFeature::RemapGeomFields(OGRFeatureDefn *poNewDefn,
     /* -------------------------------------------------------------------- */
     /*      Apply new definition and fields.                                */
     /* -------------------------------------------------------------------- */
-    CPLFree(papoGeometries);
+    if (!m_bGeometriesInFieldBlock)
+        CPLFree(papoGeometries);
     papoGeometries = papoNewGeomFields;
+    m_bGeometriesInFieldBlock = false;
 
     poDefn = poNewDefn;
 
@@ -7626,6 +7889,8 @@ inline void WriteFloat64(std::vector<GByte> &abyBuffer, double dfVal)
  */
 bool OGRFeature::SerializeToBinary(std::vector<GByte> &abyBuffer) const
 {
+    MaterializeGeometries();
+
     const int nFieldCount = poDefn->GetFieldCount();
     const int nGeomFieldCount = poDefn->GetGeomFieldCount();
     try
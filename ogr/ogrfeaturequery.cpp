@@ -34,7 +34,11 @@
 
 #include <cstddef>
 #include <cstdlib>
+#include <cstring>
 #include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -56,6 +60,594 @@ const char *const SpecialFieldNames[SPECIAL_FIELD_COUNT] = {
 const swq_field_type SpecialFieldTypes[SPECIAL_FIELD_COUNT] = {
     SWQ_INTEGER, SWQ_STRING, SWQ_STRING, SWQ_STRING, SWQ_FLOAT};
 
+static int OGRFeatureFetcherFixFieldIndex(OGRFeatureDefn *poFDefn, int nIdx);
+
+/************************************************************************/
+/*                       OGRFeatureQueryBytecode                        */
+/************************************************************************/
+
+// Flat, register based, representation of the subset of expressions that are
+// the most commonly found in attribute filters: comparisons, IN, BETWEEN,
+// LIKE, ILIKE and IS NULL between a column and constants, combined with AND,
+// OR and NOT. Contrary to swq_expr_node::Evaluate(), evaluating it does not
+// involve any heap allocation. The semantics are the ones of
+// OGRFeatureFetcher() and SWQGeneralEvaluator().
+class OGRFeatureQueryBytecode
+{
+  public:
+    static std::unique_ptr<OGRFeatureQueryBytecode>
+    Compile(const swq_expr_node *poExpr,
+            const swq_evaluation_context &sContext);
+
+    bool Evaluate(OGRFeature *poFeature) const;
+
+  private:
+    // Same members as the ones of swq_expr_node used by SWQGeneralEvaluator()
+    struct Value
+    {
+        swq_field_type eType = SWQ_OTHER;
+        bool bNull = false;
+        GIntBig nInt = 0;
+        double dfFloat = 0;
+        const char *pszStr = nullptr;
+    };
+
+    struct Operand
+    {
+        int iField = -1;  // -1 for a constant
+        swq_field_type eFieldType = SWQ_OTHER;
+        Value sConstant{};
+        bool bHasString = false;
+        std::string osConstant{};
+    };
+
+    enum class Branch
+    {
+        FLOAT,
+        INTEGER,
+        STRING,
+    };
+
+    struct Instruction
+    {
+        swq_op eOp = SWQ_OR;
+        int nDst = 0;   // destination register
+        int nSrc1 = 0;  // source registers of AND, OR and NOT
+        int nSrc2 = 0;
+        Branch eBranch = Branch::INTEGER;
+        int nFirstOperand = 0;  // index in m_aoOperands
+        int nOperandCount = 0;
+        int iColumnOperand = 0;  // index of the column among the operands
+    };
+
+    // Values of the operands of an instruction, once the column is fetched.
+    struct Values
+    {
+        const Operand *paoOperands;
+        int iColumnOperand;
+        const Value &sColumnValue;
+
+        const Value &operator[](int i) const
+        {
+            return i == iColumnOperand ? sColumnValue
+                                       : paoOperands[i].sConstant;
+        }
+    };
+
+    // swq_expr_node::Evaluate() fails beyond 32 recursion levels.
+    static constexpr int MAX_REGISTERS = 30;
+
+    std::vector<Operand> m_aoOperands{};
+    std::vector<Instruction> m_aoInstructions{};
+    bool m_bUTF8Strings = false;
+    bool m_bLikeAsILike = false;
+
+    OGRFeatureQueryBytecode() = default;
+
+    bool CompileNode(const swq_expr_node *poNode, int nDstRegister);
+
+    static Value GetValue(const Operand &oOperand, OGRFeature *poFeature);
+
+    static bool EvaluateFloat(const Instruction &oInstr, const Values &aValues,
+                              bool &bNull);
+    static bool EvaluateInteger(const Instruction &oInstr,
+                                const Values &aValues, bool &bNull);
+    bool EvaluateString(const Instruction &oInstr, const Values &aValues,
+                        bool &bNull) const;
+};
+
+/************************************************************************/
+/*                              Compile()                               */
+/************************************************************************/
+
+std::unique_ptr<OGRFeatureQueryBytecode>
+OGRFeatureQueryBytecode::Compile(const swq_expr_node *poExpr,
+                                 const swq_evaluation_context &sContext)
+{
+    std::unique_ptr<OGRFeatureQueryBytecode> poBytecode(
+        new OGRFeatureQueryBytecode());
+    poBytecode->m_bUTF8Strings = sContext.bUTF8Strings;
+    poBytecode->m_bLikeAsILike =
+        CPLTestBool(CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+    if (!poBytecode->CompileNode(poExpr, 0))
+        return nullptr;
+    // Only now that m_aoOperands will no longer be reallocated
+    for (auto &oOperand : poBytecode->m_aoOperands)
+    {
+        if (oOperand.bHasString)
+            oOperand.sConstant.pszStr = oOperand.osConstant.c_str();
+    }
+    return poBytecode;
+}
+
+/************************************************************************/
+/*                            CompileNode()                             */
+/************************************************************************/
+
+// Emit the instructions that store the value of poNode in register
+// nDstRegister. Registers with a greater index may be used as temporaries.
+bool OGRFeatureQueryBytecode::CompileNode(const swq_expr_node *poNode,
+                                          int nDstRegister)
+{
+    if (nDstRegister + 1 >= MAX_REGISTERS ||
+        poNode->eNodeType != SNT_OPERATION)
+    {
+        return false;
+    }
+
+    Instruction oInstr;
+    oInstr.eOp = static_cast<swq_op>(poNode->nOperation);
+    oInstr.nDst = nDstRegister;
+    switch (oInstr.eOp)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
+        {
+            if (poNode->nSubExprCount != 2 ||
+                !CompileNode(poNode->papoSubExpr[0], nDstRegister) ||
+                !CompileNode(poNode->papoSubExpr[1], nDstRegister + 1))
+            {
+                return false;
+            }
+            oInstr.nSrc1 = nDstRegister;
+            oInstr.nSrc2 = nDstRegister + 1;
+            m_aoInstructions.push_back(oInstr);
+            return true;
+        }
+
+        case SWQ_NOT:
+        {
+            if (poNode->nSubExprCount != 1 ||
+                !CompileNode(poNode->papoSubExpr[0], nDstRegister))
+            {
+                return false;
+            }
+            oInstr.nSrc1 = nDstRegister;
+            m_aoInstructions.push_back(oInstr);
+            return true;
+        }
+
+        case SWQ_ISNULL:
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_GT:
+        case SWQ_LT:
+        case SWQ_GE:
+        case SWQ_LE:
+        case SWQ_IN:
+        case SWQ_BETWEEN:
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+            break;
+
+        default:
+            return false;
+    }
+
+    // Comparison operators: exactly one column, and constants.
+    if (poNode->nSubExprCount < 1 ||
+        (oInstr.eOp == SWQ_ISNULL && poNode->nSubExprCount != 1) ||
+        (oInstr.eOp != SWQ_ISNULL && poNode->nSubExprCount < 2))
+    {
+        return false;
+    }
+    oInstr.nFirstOperand = static_cast<int>(m_aoOperands.size());
+    oInstr.nOperandCount = poNode->nSubExprCount;
+    int nColumnCount = 0;
+    bool bAllNumeric = true;
+    bool bAllString = true;
+    for (int i = 0; i < poNode->nSubExprCount; ++i)
+    {
+        const swq_expr_node *poSubNode = poNode->papoSubExpr[i];
+        Operand oOperand;
+        if (poSubNode->eNodeType == SNT_COLUMN)
+        {
+            ++nColumnCount;
+            oInstr.iColumnOperand = i;
+            oOperand.iField = poSubNode->field_index;
+            oOperand.eFieldType = poSubNode->field_type;
+            // Types of the nodes returned by OGRFeatureFetcher()
+            switch (poSubNode->field_type)
+            {
+                case SWQ_INTEGER:
+                case SWQ_BOOLEAN:
+                    oOperand.sConstant.eType = SWQ_INTEGER;
+                    break;
+                case SWQ_INTEGER64:
+                case SWQ_FLOAT:
+                case SWQ_STRING:
+                    oOperand.sConstant.eType = poSubNode->field_type;
+                    break;
+                default:
+                    return false;
+            }
+        }
+        else if (poSubNode->eNodeType == SNT_CONSTANT)
+        {
+            oOperand.sConstant.eType = poSubNode->field_type;
+            oOperand.sConstant.bNull = CPL_TO_BOOL(poSubNode->is_null);
+            oOperand.sConstant.nInt = poSubNode->int_value;
+            oOperand.sConstant.dfFloat = poSubNode->float_value;
+            if (poSubNode->field_type == SWQ_STRING && poSubNode->string_value)
+            {
+                oOperand.bHasString = true;
+                oOperand.osConstant = poSubNode->string_value;
+            }
+        }
+        else
+        {
+            return false;
+        }
+        const swq_field_type eType = oOperand.sConstant.eType;
+        if (!SWQ_IS_INTEGER(eType) && eType != SWQ_FLOAT &&
+            eType != SWQ_BOOLEAN)
+            bAllNumeric = false;
+        if (eType != SWQ_STRING)
+            bAllString = false;
+        m_aoOperands.push_back(std::move(oOperand));
+    }
+    if (nColumnCount != 1)
+        return false;
+
+    // Same selection of the type of operation as SWQGeneralEvaluator()
+    const swq_field_type eType0 =
+        m_aoOperands[oInstr.nFirstOperand].sConstant.eType;
+    const swq_field_type eType1 =
+        oInstr.nOperandCount > 1
+            ? m_aoOperands[oInstr.nFirstOperand + 1].sConstant.eType
+            : SWQ_OTHER;
+    if (eType0 == SWQ_FLOAT || eType1 == SWQ_FLOAT)
+    {
+        if (!bAllNumeric)
+            return false;
+        oInstr.eBranch = Branch::FLOAT;
+    }
+    else if (SWQ_IS_INTEGER(eType0) || eType0 == SWQ_BOOLEAN)
+    {
+        if (!bAllNumeric)
+            return false;
+        oInstr.eBranch = Branch::INTEGER;
+    }
+    else
+    {
+        if (!bAllString)
+            return false;
+        oInstr.eBranch = Branch::STRING;
+    }
+    if (oInstr.eBranch != Branch::STRING &&
+        (oInstr.eOp == SWQ_LIKE || oInstr.eOp == SWQ_ILIKE))
+    {
+        return false;
+    }
+    if ((oInstr.eOp == SWQ_BETWEEN && oInstr.nOperandCount != 3) ||
+        ((oInstr.eOp == SWQ_LIKE || oInstr.eOp == SWQ_ILIKE) &&
+         oInstr.nOperandCount != 2 && oInstr.nOperandCount != 3) ||
+        (oInstr.eOp != SWQ_IN && oInstr.eOp != SWQ_BETWEEN &&
+         oInstr.eOp != SWQ_LIKE && oInstr.eOp != SWQ_ILIKE &&
+         oInstr.eOp != SWQ_ISNULL && oInstr.nOperandCount != 2))
+    {
+        return false;
+    }
+
+    m_aoInstructions.push_back(oInstr);
+    return true;
+}
+
+/************************************************************************/
+/*                              GetValue()                              */
+/************************************************************************/
+
+OGRFeatureQueryBytecode::Value
+OGRFeatureQueryBytecode::GetValue(const Operand &oOperand, OGRFeature *poFeature)
+{
+    Value sValue;
+    sValue.eType = oOperand.sConstant.eType;
+    const int idx = OGRFeatureFetcherFixFieldIndex(poFeature->GetDefnRef(),
+                                                   oOperand.iField);
+    switch (oOperand.eFieldType)
+    {
+        case SWQ_INTEGER:
+        case SWQ_BOOLEAN:
+            sValue.nInt = poFeature->GetFieldAsInteger(idx);
+            break;
+
+        case SWQ_INTEGER64:
+            sValue.nInt = poFeature->GetFieldAsInteger64(idx);
+            break;
+
+        case SWQ_FLOAT:
+            sValue.dfFloat = poFeature->GetFieldAsDouble(idx);
+            break;
+
+        default:
+        {
+            const char *pszStr = poFeature->GetFieldAsString(idx);
+            sValue.pszStr = pszStr ? pszStr : "";
+            break;
+        }
+    }
+    sValue.bNull = !(poFeature->IsFieldSetAndNotNull(idx));
+    return sValue;
+}
+
+/************************************************************************/
+/*                           EvaluateFloat()                            */
+/************************************************************************/
+
+bool OGRFeatureQueryBytecode::EvaluateFloat(const Instruction &oInstr,
+                                            const Values &aValues, bool &bNull)
+{
+    // Only the first two operands are converted from integer.
+    const auto GetFloat = [&aValues](int i)
+    {
+        return i < 2 && SWQ_IS_INTEGER(aValues[i].eType)
+                   ? static_cast<double>(aValues[i].nInt)
+                   : aValues[i].dfFloat;
+    };
+    switch (oInstr.eOp)
+    {
+        case SWQ_EQ:
+            return GetFloat(0) == GetFloat(1);
+        case SWQ_NE:
+            return GetFloat(0) != GetFloat(1);
+        case SWQ_GT:
+            return GetFloat(0) > GetFloat(1);
+        case SWQ_LT:
+            return GetFloat(0) < GetFloat(1);
+        case SWQ_GE:
+            return GetFloat(0) >= GetFloat(1);
+        case SWQ_LE:
+            return GetFloat(0) <= GetFloat(1);
+        case SWQ_BETWEEN:
+            return GetFloat(0) >= GetFloat(1) && GetFloat(0) <= GetFloat(2);
+        case SWQ_IN:
+        {
+            const double dfValue = GetFloat(0);
+            for (int i = 1; i < oInstr.nOperandCount; ++i)
+            {
+                if (aValues[i].bNull)
+                    bNull = true;
+                else if (dfValue == GetFloat(i))
+                {
+                    bNull = false;
+                    return true;
+                }
+            }
+            return false;
+        }
+        default:
+            break;
+    }
+    CPLAssert(false);
+    return false;
+}
+
+/************************************************************************/
+/*                          EvaluateInteger()                           */
+/************************************************************************/
+
+bool OGRFeatureQueryBytecode::EvaluateInteger(const Instruction &oInstr,
+                                              const Values &aValues,
+                                              bool &bNull)
+{
+    const GIntBig nValue = aValues[0].nInt;
+    switch (oInstr.eOp)
+    {
+        case SWQ_EQ:
+            return nValue == aValues[1].nInt;
+        case SWQ_NE:
+            return nValue != aValues[1].nInt;
+        case SWQ_GT:
+            return nValue > aValues[1].nInt;
+        case SWQ_LT:
+            return nValue < aValues[1].nInt;
+        case SWQ_GE:
+            return nValue >= aValues[1].nInt;
+        case SWQ_LE:
+            return nValue <= aValues[1].nInt;
+        case SWQ_BETWEEN:
+            return nValue >= aValues[1].nInt && nValue <= aValues[2].nInt;
+        case SWQ_IN:
+        {
+            for (int i = 1; i < oInstr.nOperandCount; ++i)
+            {
+                if (aValues[i].bNull)
+                    bNull = true;
+                else if (nValue == aValues[i].nInt)
+                {
+                    bNull = false;
+                    return true;
+                }
+            }
+            return false;
+        }
+        default:
+            break;
+    }
+    CPLAssert(false);
+    return false;
+}
+
+/************************************************************************/
+/*                           EvaluateString()                           */
+/************************************************************************/
+
+bool OGRFeatureQueryBytecode::EvaluateString(const Instruction &oInstr,
+                                             const Values &aValues,
+                                             bool &bNull) const
+{
+    const char *pszValue0 = aValues[0].pszStr;
+    switch (oInstr.eOp)
+    {
+        case SWQ_EQ:
+        {
+            // When comparing timestamps, the +00 at the end might be
+            // discarded if the other member has no explicit timezone.
+            const char *pszValue1 = aValues[1].pszStr;
+            const size_t nLen0 = strlen(pszValue0);
+            const size_t nLen1 = strlen(pszValue1);
+            if (nLen0 > 3 && nLen1 > 3 &&
+                strcmp(pszValue0 + nLen0 - 3, "+00") == 0 &&
+                pszValue1[nLen1 - 3] == ':')
+            {
+                return EQUALN(pszValue0, pszValue1, nLen1);
+            }
+            else if (nLen0 > 3 && nLen1 > 3 && pszValue0[nLen0 - 3] == ':' &&
+                     strcmp(pszValue1 + nLen1 - 3, "+00") == 0)
+            {
+                return EQUALN(pszValue0, pszValue1, nLen0);
+            }
+            return strcasecmp(pszValue0, pszValue1) == 0;
+        }
+        case SWQ_NE:
+            return strcasecmp(pszValue0, aValues[1].pszStr) != 0;
+        case SWQ_GT:
+            return strcasecmp(pszValue0, aValues[1].pszStr) > 0;
+        case SWQ_LT:
+            return strcasecmp(pszValue0, aValues[1].pszStr) < 0;
+        case SWQ_GE:
+            return strcasecmp(pszValue0, aValues[1].pszStr) >= 0;
+        case SWQ_LE:
+            return strcasecmp(pszValue0, aValues[1].pszStr) <= 0;
+        case SWQ_BETWEEN:
+            return strcasecmp(pszValue0, aValues[1].pszStr) >= 0 &&
+                   strcasecmp(pszValue0, aValues[2].pszStr) <= 0;
+        case SWQ_IN:
+        {
+            for (int i = 1; i < oInstr.nOperandCount; ++i)
+            {
+                if (aValues[i].bNull || !aValues[i].pszStr)
+                    bNull = true;
+                else if (strcasecmp(pszValue0, aValues[i].pszStr) == 0)
+                {
+                    bNull = false;
+                    return true;
+                }
+            }
+            return false;
+        }
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+        {
+            const char chEscape =
+                oInstr.nOperandCount == 3 ? aValues[2].pszStr[0] : '\0';
+            return swq_test_like(pszValue0, aValues[1].pszStr, chEscape,
+                                 oInstr.eOp == SWQ_ILIKE || m_bLikeAsILike,
+                                 m_bUTF8Strings) != 0;
+        }
+        default:
+            break;
+    }
+    CPLAssert(false);
+    return false;
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+bool OGRFeatureQueryBytecode::Evaluate(OGRFeature *poFeature) const
+{
+    bool abValue[MAX_REGISTERS];
+    bool abNull[MAX_REGISTERS];
+
+    for (const auto &oInstr : m_aoInstructions)
+    {
+        bool &bValue = abValue[oInstr.nDst];
+        bool &bNull = abNull[oInstr.nDst];
+        switch (oInstr.eOp)
+        {
+            case SWQ_AND:
+                bNull = abNull[oInstr.nSrc1] || abNull[oInstr.nSrc2];
+                bValue =
+                    !bNull && abValue[oInstr.nSrc1] && abValue[oInstr.nSrc2];
+                continue;
+
+            case SWQ_OR:
+                bValue = abValue[oInstr.nSrc1] || abValue[oInstr.nSrc2];
+                bNull = abNull[oInstr.nSrc1] || abNull[oInstr.nSrc2];
+                continue;
+
+            case SWQ_NOT:
+                bNull = abNull[oInstr.nSrc1];
+                bValue = !bNull && !abValue[oInstr.nSrc1];
+                continue;
+
+            default:
+                break;
+        }
+
+        const Operand *paoOperands = &m_aoOperands[oInstr.nFirstOperand];
+        const Value sColumnValue =
+            GetValue(paoOperands[oInstr.iColumnOperand], poFeature);
+        if (oInstr.eOp == SWQ_ISNULL)
+        {
+            bValue = sColumnValue.bNull;
+            bNull = false;
+            continue;
+        }
+
+        const Values aValues{paoOperands, oInstr.iColumnOperand, sColumnValue};
+        bValue = false;
+        bNull = false;
+        if (oInstr.eOp == SWQ_IN)
+        {
+            if (aValues[0].bNull)
+            {
+                bNull = true;
+                continue;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < oInstr.nOperandCount; ++i)
+            {
+                if (aValues[i].bNull)
+                {
+                    bNull = true;
+                    break;
+                }
+            }
+            if (bNull)
+                continue;
+        }
+
+        switch (oInstr.eBranch)
+        {
+            case Branch::FLOAT:
+                bValue = EvaluateFloat(oInstr, aValues, bNull);
+                break;
+            case Branch::INTEGER:
+                bValue = EvaluateInteger(oInstr, aValues, bNull);
+                break;
+            case Branch::STRING:
+                bValue = EvaluateString(oInstr, aValues, bNull);
+                break;
+        }
+    }
+    return abValue[0];
+}
+
 /************************************************************************/
 /*                          OGRFeatureQuery()                           */
 /************************************************************************/
@@ -75,6 +667,7 @@ OGRFeatureQuery::~OGRFeatureQuery()
 {
     delete m_psContext;
     delete static_cast<swq_expr_node *>(pSWQExpr);
+    delete m_poBytecode;
 }
 
 /************************************************************************/
@@ -122,6 +715,8 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
         delete static_cast<swq_expr_node *>(pSWQExpr);
         pSWQExpr = nullptr;
     }
+    delete m_poBytecode;
+    m_poBytecode = nullptr;
 
     const char *pszFIDColumn = nullptr;
     bool bMustAddFID = false;
@@ -243,6 +838,12 @@ OGRFeatureQuery::Compile(OGRLayer *poLayer, OGRFeatureDefn *poDefn,
         eErr = OGRERR_CORRUPT_DATA;
         pSWQExpr = nullptr;
     }
+    else
+    {
+        m_poBytecode = OGRFeatureQueryBytecode::Compile(
+                           static_cast<swq_expr_node *>(pSWQExpr), *m_psContext)
+                           .release();
+    }
 
     CPLFree(papszFieldNames);
     CPLFree(paeFieldTypes);
@@ -328,6 +929,9 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    if (m_poBytecode)
+        return m_poBytecode->Evaluate(poFeature);
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature, *m_psContext);
 
@@ -647,7 +1251,11 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
                     break;
 
                 case OFTReal:
-                    sValue.Real = psExpr->papoSubExpr[iIN]->float_value;
+                    if (psExpr->papoSubExpr[iIN]->field_type == SWQ_FLOAT)
+                        sValue.Real = psExpr->papoSubExpr[iIN]->float_value;
+                    else
+                        sValue.Real = static_cast<double>(
+                            psExpr->papoSubExpr[iIN]->int_value);
                     break;
 
                 case OFTString:
@@ -692,7 +1300,10 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
             break;
 
         case OFTReal:
-            sValue.Real = poValue->float_value;
+            if (poValue->field_type == SWQ_FLOAT)
+                sValue.Real = poValue->float_value;
+            else
+                sValue.Real = static_cast<double>(poValue->int_value);
             break;
 
         case OFTString:
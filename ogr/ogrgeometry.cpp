@@ -40,6 +40,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -3238,6 +3239,173 @@ void OGRGeometry::freeGEOSContext(
 
 #ifdef HAVE_GEOS
 
+#ifdef HAVE_GEOS_COORDSEQ_BUFFER
+
+/************************************************************************/
+/*                       convertToGEOSGeomDirect()                      */
+/************************************************************************/
+
+// Builds the GEOS geometry from the coordinate buffers of the geometry,
+// without a WKB round trip.
+// Returns false if the geometry cannot be converted that way, in which case
+// the caller must go through WKB. When true is returned, hGeom is nullptr if
+// GEOS rejected the geometry.
+static bool convertToGEOSGeomDirect(GEOSContextHandle_t hGEOSCtxt,
+                                    const OGRGeometry *poGeom, GEOSGeom &hGeom)
+{
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 12)
+    constexpr bool bWithM = true;
+#else
+    constexpr bool bWithM = false;
+#endif
+
+    hGeom = nullptr;
+
+    // Let the WKB path deal with the dimensionality of empty geometries.
+    if (poGeom->IsEmpty() &&
+        (poGeom->Is3D() || (bWithM && poGeom->IsMeasured())))
+        return false;
+
+    const OGRwkbGeometryType eType = wkbFlatten(poGeom->getGeometryType());
+    switch (eType)
+    {
+        case wkbPoint:
+        {
+            const OGRPoint *poPoint = poGeom->toPoint();
+            if (poPoint->IsEmpty())
+            {
+                hGeom = GEOSGeom_createEmptyPoint_r(hGEOSCtxt);
+                return true;
+            }
+            const bool bHasZ = CPL_TO_BOOL(poPoint->Is3D());
+            const bool bHasM = bWithM && CPL_TO_BOOL(poPoint->IsMeasured());
+            if (!bHasZ && !bHasM)
+            {
+                hGeom = GEOSGeom_createPointFromXY_r(
+                    hGEOSCtxt, poPoint->getX(), poPoint->getY());
+                return true;
+            }
+            double adfXYZM[4];
+            int nDim = 0;
+            adfXYZM[nDim++] = poPoint->getX();
+            adfXYZM[nDim++] = poPoint->getY();
+            if (bHasZ)
+                adfXYZM[nDim++] = poPoint->getZ();
+            if (bHasM)
+                adfXYZM[nDim++] = poPoint->getM();
+            GEOSCoordSequence *hSeq = GEOSCoordSeq_copyFromBuffer_r(
+                hGEOSCtxt, adfXYZM, 1, bHasZ, bHasM);
+            if (hSeq)
+                hGeom = GEOSGeom_createPoint_r(hGEOSCtxt, hSeq);
+            return true;
+        }
+
+        case wkbLineString:
+        {
+            const OGRLineString *poLS = poGeom->toLineString();
+            if (poLS->IsEmpty())
+            {
+                hGeom = GEOSGeom_createEmptyLineString_r(hGEOSCtxt);
+                return true;
+            }
+            GEOSCoordSequence *hSeq =
+                poLS->exportToGEOSCoordSeq(hGEOSCtxt, bWithM);
+            if (hSeq)
+                hGeom = GEOSGeom_createLineString_r(hGEOSCtxt, hSeq);
+            return true;
+        }
+
+        case wkbPolygon:
+        {
+            const OGRPolygon *poPoly = poGeom->toPolygon();
+            if (poPoly->IsEmpty())
+            {
+                hGeom = GEOSGeom_createEmptyPolygon_r(hGEOSCtxt);
+                return true;
+            }
+            // Empty rings are let to the WKB path
+            for (const auto *poRing : *poPoly)
+            {
+                if (poRing->IsEmpty())
+                    return false;
+            }
+
+            std::vector<GEOSGeom> ahRings;
+            for (const auto *poRing : *poPoly)
+            {
+                GEOSCoordSequence *hSeq =
+                    poRing->exportToGEOSCoordSeq(hGEOSCtxt, bWithM);
+                GEOSGeom hRing =
+                    hSeq ? GEOSGeom_createLinearRing_r(hGEOSCtxt, hSeq)
+                         : nullptr;
+                if (!hRing)
+                {
+                    for (GEOSGeom hOtherRing : ahRings)
+                        GEOSGeom_destroy_r(hGEOSCtxt, hOtherRing);
+                    return true;
+                }
+                ahRings.push_back(hRing);
+            }
+            hGeom = GEOSGeom_createPolygon_r(
+                hGEOSCtxt, ahRings[0],
+                ahRings.size() > 1 ? &ahRings[1] : nullptr,
+                static_cast<unsigned>(ahRings.size() - 1));
+            return true;
+        }
+
+        case wkbMultiPoint:
+        case wkbMultiLineString:
+        case wkbMultiPolygon:
+        case wkbGeometryCollection:
+        {
+            const int nGEOSType =
+                eType == wkbMultiPoint        ? GEOS_MULTIPOINT
+                : eType == wkbMultiLineString ? GEOS_MULTILINESTRING
+                : eType == wkbMultiPolygon    ? GEOS_MULTIPOLYGON
+                                              : GEOS_GEOMETRYCOLLECTION;
+            const OGRGeometryCollection *poGC = poGeom->toGeometryCollection();
+            if (poGC->IsEmpty() && poGC->getNumGeometries() == 0)
+            {
+                hGeom = GEOSGeom_createEmptyCollection_r(hGEOSCtxt, nGEOSType);
+                return true;
+            }
+            // Empty sub-geometries are let to the WKB path
+            for (const auto *poSubGeom : *poGC)
+            {
+                if (poSubGeom->IsEmpty())
+                    return false;
+            }
+
+            std::vector<GEOSGeom> ahSubGeoms;
+            for (const auto *poSubGeom : *poGC)
+            {
+                GEOSGeom hSubGeom = nullptr;
+                const bool bHandled =
+                    convertToGEOSGeomDirect(hGEOSCtxt, poSubGeom, hSubGeom);
+                if (!hSubGeom)
+                {
+                    for (GEOSGeom hOtherGeom : ahSubGeoms)
+                        GEOSGeom_destroy_r(hGEOSCtxt, hOtherGeom);
+                    return bHandled;
+                }
+                ahSubGeoms.push_back(hSubGeom);
+            }
+            hGeom = GEOSGeom_createCollection_r(
+                hGEOSCtxt, nGEOSType, ahSubGeoms.data(),
+                static_cast<unsigned>(ahSubGeoms.size()));
+            return true;
+        }
+
+        default:
+            break;
+    }
+
+    return false;
+}
+
+#endif  // HAVE_GEOS_COORDSEQ_BUFFER
+
 /************************************************************************/
 /*                          convertToGEOSGeom()                         */
 /************************************************************************/
@@ -3246,6 +3414,11 @@ static GEOSGeom convertToGEOSGeom(GEOSContextHandle_t hGEOSCtxt,
                                   OGRGeometry *poGeom)
 {
     GEOSGeom hGeom = nullptr;
+#ifdef HAVE_GEOS_COORDSEQ_BUFFER
+    if (convertToGEOSGeomDirect(hGEOSCtxt, poGeom, hGeom))
+        return hGeom;
+#endif
+
     const size_t nDataSize = poGeom->WkbSize();
     unsigned char *pabyData =
         static_cast<unsigned char *>(CPLMalloc(nDataSize));
@@ -2223,6 +2223,139 @@ OGRGeometry *OGRGeometryFactory::createFromGML(const char *pszData)
 /*                           createFromGEOS()                           */
 /************************************************************************/
 
+#ifdef HAVE_GEOS_COORDSEQ_BUFFER
+
+/************************************************************************/
+/*                        createFromGEOSDirect()                        */
+/************************************************************************/
+
+// Builds the OGR geometry from the coordinate sequences of the GEOS geometry,
+// without a WKB round trip.
+// Returns false if the geometry cannot be converted that way, in which case
+// the caller must go through WKB.
+static bool createFromGEOSDirect(GEOSContextHandle_t hGEOSCtxt,
+                                 const GEOSGeometry *hGeom, bool bHasZ,
+                                 bool bHasM,
+                                 std::unique_ptr<OGRGeometry> &poGeom)
+{
+    // Let the WKB path deal with empty geometries
+    if (GEOSisEmpty_r(hGEOSCtxt, hGeom) != 0)
+        return false;
+
+    const int nGEOSType = GEOSGeomTypeId_r(hGEOSCtxt, hGeom);
+    switch (nGEOSType)
+    {
+        case GEOS_POINT:
+        {
+            const GEOSCoordSequence *hSeq =
+                GEOSGeom_getCoordSeq_r(hGEOSCtxt, hGeom);
+            unsigned int nSize = 0;
+            double adfXYZM[4] = {0, 0, 0, 0};
+            if (!hSeq || !GEOSCoordSeq_getSize_r(hGEOSCtxt, hSeq, &nSize) ||
+                nSize != 1 ||
+                !GEOSCoordSeq_copyToBuffer_r(hGEOSCtxt, hSeq, adfXYZM, bHasZ,
+                                             bHasM))
+            {
+                return false;
+            }
+            auto poPoint = std::make_unique<OGRPoint>(adfXYZM[0], adfXYZM[1]);
+            int iDim = 2;
+            if (bHasZ)
+                poPoint->setZ(adfXYZM[iDim++]);
+            if (bHasM)
+                poPoint->setM(adfXYZM[iDim++]);
+            poGeom = std::move(poPoint);
+            return true;
+        }
+
+        case GEOS_LINESTRING:
+        case GEOS_LINEARRING:
+        {
+            // Consistently with the WKB path, a LinearRing is returned as a
+            // LineString.
+            const GEOSCoordSequence *hSeq =
+                GEOSGeom_getCoordSeq_r(hGEOSCtxt, hGeom);
+            auto poLS = std::make_unique<OGRLineString>();
+            if (!hSeq ||
+                !poLS->importFromGEOSCoordSeq(hGEOSCtxt, hSeq, bHasZ, bHasM))
+            {
+                return false;
+            }
+            poGeom = std::move(poLS);
+            return true;
+        }
+
+        case GEOS_POLYGON:
+        {
+            const int nInteriorRings =
+                GEOSGetNumInteriorRings_r(hGEOSCtxt, hGeom);
+            if (nInteriorRings < 0)
+                return false;
+            auto poPoly = std::make_unique<OGRPolygon>();
+            for (int iRing = -1; iRing < nInteriorRings; ++iRing)
+            {
+                const GEOSGeometry *hRing =
+                    iRing < 0
+                        ? GEOSGetExteriorRing_r(hGEOSCtxt, hGeom)
+                        : GEOSGetInteriorRingN_r(hGEOSCtxt, hGeom, iRing);
+                const GEOSCoordSequence *hSeq =
+                    hRing ? GEOSGeom_getCoordSeq_r(hGEOSCtxt, hRing) : nullptr;
+                auto poRing = std::make_unique<OGRLinearRing>();
+                if (!hSeq ||
+                    !poRing->importFromGEOSCoordSeq(hGEOSCtxt, hSeq, bHasZ,
+                                                    bHasM) ||
+                    poPoly->addRing(std::move(poRing)) != OGRERR_NONE)
+                {
+                    return false;
+                }
+            }
+            poGeom = std::move(poPoly);
+            return true;
+        }
+
+        case GEOS_MULTIPOINT:
+        case GEOS_MULTILINESTRING:
+        case GEOS_MULTIPOLYGON:
+        case GEOS_GEOMETRYCOLLECTION:
+        {
+            std::unique_ptr<OGRGeometryCollection> poGC;
+            if (nGEOSType == GEOS_MULTIPOINT)
+                poGC = std::make_unique<OGRMultiPoint>();
+            else if (nGEOSType == GEOS_MULTILINESTRING)
+                poGC = std::make_unique<OGRMultiLineString>();
+            else if (nGEOSType == GEOS_MULTIPOLYGON)
+                poGC = std::make_unique<OGRMultiPolygon>();
+            else
+                poGC = std::make_unique<OGRGeometryCollection>();
+            const int nGeoms = GEOSGetNumGeometries_r(hGEOSCtxt, hGeom);
+            if (nGeoms < 0)
+                return false;
+            for (int iGeom = 0; iGeom < nGeoms; ++iGeom)
+            {
+                const GEOSGeometry *hSubGeom =
+                    GEOSGetGeometryN_r(hGEOSCtxt, hGeom, iGeom);
+                std::unique_ptr<OGRGeometry> poSubGeom;
+                if (!hSubGeom ||
+                    !createFromGEOSDirect(hGEOSCtxt, hSubGeom, bHasZ, bHasM,
+                                          poSubGeom) ||
+                    poGC->addGeometry(std::move(poSubGeom)) != OGRERR_NONE)
+                {
+                    return false;
+                }
+            }
+            poGeom = std::move(poGC);
+            return true;
+        }
+
+        default:
+            break;
+    }
+
+    return false;
+}
+
+#endif  // HAVE_GEOS_COORDSEQ_BUFFER
+
 /** Builds a OGRGeometry* from a GEOSGeom.
  * @param hGEOSCtxt GEOS context
  * @param geosGeom GEOS geometry
@@ -2249,6 +2382,26 @@ OGRGeometry *OGRGeometryFactory::createFromGEOS(
         GEOSisEmpty_r(hGEOSCtxt, geosGeom))
         return new OGRPoint();
 
+#ifdef HAVE_GEOS_COORDSEQ_BUFFER
+    {
+#if GEOS_VERSION_MAJOR > 3 ||                                                  \
+    (GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR >= 12)
+        const bool bHasZ = GEOSHasZ_r(hGEOSCtxt, geosGeom) == 1;
+        const bool bHasM = GEOSHasM_r(hGEOSCtxt, geosGeom) == 1;
+#else
+        const bool bHasZ =
+            GEOSGeom_getCoordinateDimension_r(hGEOSCtxt, geosGeom) == 3;
+        constexpr bool bHasM = false;
+#endif
+        std::unique_ptr<OGRGeometry> poDirectGeom;
+        if (createFromGEOSDirect(hGEOSCtxt, geosGeom, bHasZ, bHasM,
+                                 poDirectGeom))
+        {
+            return poDirectGeom.release();
+        }
+    }
+#endif
+
     const int nCoordDim =
         GEOSGeom_getCoordinateDimension_r(hGEOSCtxt, geosGeom);
     GEOSWKBWriter *wkbwriter = GEOSWKBWriter_create_r(hGEOSCtxt);
@@ -38,6 +38,7 @@
 #include <algorithm>
 #include <limits>
 #include <new>
+#include <vector>
 
 namespace
 {
@@ -1364,6 +1365,147 @@ void OGRSimpleCurve::getPoints(void *pabyX, int nXStride, void *pabyY,
     }
 }
 
+/************************************************************************/
+/*                        exportToGEOSCoordSeq()                        */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+#ifdef HAVE_GEOS_COORDSEQ_BUFFER
+
+/** Returns a GEOS coordinate sequence with the points of the curve, or
+ * nullptr in case of error.
+ *
+ * M values are only exported if bWithM is true.
+ */
+GEOSCoordSeq_t *OGRSimpleCurve::exportToGEOSCoordSeq(
+    GEOSContextHandle_t hGEOSCtxt, bool bWithM) const
+{
+    const bool bHasZ = CPL_TO_BOOL(Is3D());
+    const bool bHasM = bWithM && CPL_TO_BOOL(IsMeasured());
+    if (nPointCount == 0 || (bHasZ && !padfZ) || (bHasM && !padfM))
+        return nullptr;
+
+    if (!bHasZ && !bHasM)
+    {
+        // The point array is already an interleaved XY buffer.
+        static_assert(sizeof(OGRRawPoint) == 2 * sizeof(double),
+                      "sizeof(OGRRawPoint) == 2 * sizeof(double)");
+        return GEOSCoordSeq_copyFromBuffer_r(
+            hGEOSCtxt, reinterpret_cast<const double *>(paoPoints),
+            static_cast<unsigned>(nPointCount), false, false);
+    }
+
+    const size_t nDim = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+    std::vector<double> adfBuffer;
+    try
+    {
+        adfBuffer.resize(nDim * nPointCount);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate coordinate buffer");
+        return nullptr;
+    }
+    size_t j = 0;
+    for (int i = 0; i < nPointCount; ++i)
+    {
+        adfBuffer[j++] = paoPoints[i].x;
+        adfBuffer[j++] = paoPoints[i].y;
+        if (bHasZ)
+            adfBuffer[j++] = padfZ[i];
+        if (bHasM)
+            adfBuffer[j++] = padfM[i];
+    }
+    return GEOSCoordSeq_copyFromBuffer_r(hGEOSCtxt, adfBuffer.data(),
+                                         static_cast<unsigned>(nPointCount),
+                                         bHasZ, bHasM);
+}
+
+/************************************************************************/
+/*                       importFromGEOSCoordSeq()                       */
+/************************************************************************/
+
+/** Sets the points of the curve from a GEOS coordinate sequence.
+ *
+ * @return true in case of success.
+ */
+bool OGRSimpleCurve::importFromGEOSCoordSeq(GEOSContextHandle_t hGEOSCtxt,
+                                            const GEOSCoordSeq_t *hCoordSeq,
+                                            bool bHasZ, bool bHasM)
+{
+    unsigned int nSize = 0;
+    if (!GEOSCoordSeq_getSize_r(hGEOSCtxt, hCoordSeq, &nSize) ||
+        nSize > static_cast<unsigned>(std::numeric_limits<int>::max()))
+    {
+        return false;
+    }
+
+    set3D(bHasZ);
+    setMeasured(bHasM);
+    setNumPoints(static_cast<int>(nSize), FALSE);
+    if (nPointCount != static_cast<int>(nSize))
+        return false;
+    if (nSize == 0)
+        return true;
+
+    if (!bHasZ && !bHasM)
+    {
+        return GEOSCoordSeq_copyToBuffer_r(
+                   hGEOSCtxt, hCoordSeq, reinterpret_cast<double *>(paoPoints),
+                   false, false) != 0;
+    }
+
+    const size_t nDim = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+    std::vector<double> adfBuffer;
+    try
+    {
+        adfBuffer.resize(nDim * nSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate coordinate buffer");
+        return false;
+    }
+    if (!GEOSCoordSeq_copyToBuffer_r(hGEOSCtxt, hCoordSeq, adfBuffer.data(),
+                                     bHasZ, bHasM))
+    {
+        return false;
+    }
+    size_t j = 0;
+    for (int i = 0; i < nPointCount; ++i)
+    {
+        paoPoints[i].x = adfBuffer[j++];
+        paoPoints[i].y = adfBuffer[j++];
+        if (bHasZ)
+            padfZ[i] = adfBuffer[j++];
+        if (bHasM)
+            padfM[i] = adfBuffer[j++];
+    }
+    return true;
+}
+
+#else
+
+GEOSCoordSeq_t *OGRSimpleCurve::exportToGEOSCoordSeq(GEOSContextHandle_t,
+                                                     bool) const
+{
+    return nullptr;
+}
+
+bool OGRSimpleCurve::importFromGEOSCoordSeq(GEOSContextHandle_t,
+                                            const GEOSCoordSeq_t *, bool,
+                                            bool)
+{
+    return false;
+}
+
+#endif  // HAVE_GEOS_COORDSEQ_BUFFER
+
+//! @endcond
+
 /************************************************************************/
 /*                           reversePoints()                            */
 /************************************************************************/
@@ -162,15 +162,36 @@ static GDALDataset *OGRFeatherDriverOpen(GDALOpenInfo *poOpenInfo)
     }
     else
     {
-        auto result = arrow::io::ReadableFile::Open(poOpenInfo->pszFilename);
-        if (!result.ok())
+        // Memory mapping the file enables record batches to directly
+        // reference the mapped pages, instead of copies of them, for
+        // uncompressed files.
+        if (CPLTestBool(CPLGetConfigOption("OGR_ARROW_MEMORY_MAP", "YES")))
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "ReadableFile::Open() failed with %s",
-                     result.status().message().c_str());
-            return nullptr;
+            auto result = arrow::io::MemoryMappedFile::Open(
+                poOpenInfo->pszFilename, arrow::io::FileMode::READ);
+            if (result.ok())
+            {
+                infile = *result;
+            }
+            else
+            {
+                CPLDebug("ARROW", "MemoryMappedFile::Open() failed with %s",
+                         result.status().message().c_str());
+            }
+        }
+        if (!infile)
+        {
+            auto result =
+                arrow::io::ReadableFile::Open(poOpenInfo->pszFilename);
+            if (!result.ok())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "ReadableFile::Open() failed with %s",
+                         result.status().message().c_str());
+                return nullptr;
+            }
+            infile = *result;
         }
-        infile = *result;
     }
 
     auto poMemoryPool = std::shared_ptr<arrow::MemoryPool>(
@@ -5210,6 +5210,23 @@ inline bool OGRArrowLayer::UseRecordBatchBaseImplementation() const
             }
         }
     }
+    else if (IsGeoArrowGeometryEncodingRequested())
+    {
+        // Geometries stored as WKB or WKT need to go through the base
+        // implementation to be converted to GeoArrow.
+        const int nGeomFieldCount = m_poFeatureDefn->GetGeomFieldCount();
+        for (int i = 0; i < nGeomFieldCount; i++)
+        {
+            if (!m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored() &&
+                (m_aeGeomEncoding[i] == OGRArrowGeomEncoding::WKB ||
+                 m_aeGeomEncoding[i] == OGRArrowGeomEncoding::WKT))
+            {
+                CPLDebug("ARROW", "Geometry encoding not compatible of fast "
+                                  "Arrow implementation");
+                return true;
+            }
+        }
+    }
 
     if (m_bIgnoredFields)
     {
@@ -5518,6 +5535,46 @@ inline int OGRArrowLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
             }
         }
 
+        // Skip batches where the bounding box of no feature intersects the
+        // spatial filter, without exporting them and post-filtering them
+        // on their geometries.
+        if (m_poFilterGeom && m_poArrayBBOX &&
+            (m_poArrayXMinFloat || m_poArrayXMinDouble))
+        {
+            const int64_t nRows = m_poBatch->num_rows();
+            bool bIntersects = false;
+            OGREnvelope sEnvelope;
+            for (int64_t i = 0; i < nRows && !bIntersects; ++i)
+            {
+                if (m_poArrayBBOX->IsNull(i))
+                    continue;
+                if (m_poArrayXMinFloat && !m_poArrayXMinFloat->IsNull(i))
+                {
+                    sEnvelope.MinX = m_poArrayXMinFloat->Value(i);
+                    sEnvelope.MinY = m_poArrayYMinFloat->Value(i);
+                    sEnvelope.MaxX = m_poArrayXMaxFloat->Value(i);
+                    sEnvelope.MaxY = m_poArrayYMaxFloat->Value(i);
+                    bIntersects = m_sFilterEnvelope.Intersects(sEnvelope);
+                }
+                else if (m_poArrayXMinDouble &&
+                         !m_poArrayXMinDouble->IsNull(i))
+                {
+                    sEnvelope.MinX = m_poArrayXMinDouble->Value(i);
+                    sEnvelope.MinY = m_poArrayYMinDouble->Value(i);
+                    sEnvelope.MaxX = m_poArrayXMaxDouble->Value(i);
+                    sEnvelope.MaxY = m_poArrayYMaxDouble->Value(i);
+                    bIntersects = m_sFilterEnvelope.Intersects(sEnvelope);
+                }
+            }
+            if (!bIntersects)
+            {
+                m_nIdxInBatch = nRows;
+                for (int64_t i = 0; i < nRows; ++i)
+                    IncrFeatureIdx();
+                continue;
+            }
+        }
+
         struct ArrowSchema schema;
         memset(&schema, 0, sizeof(schema));
         auto status = arrow::ExportRecordBatch(*m_poBatch, out_array, &schema);
@@ -33,7 +33,16 @@
 
 #include "ogrsf_frmts.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <string>
+#include <vector>
+
+class CPLJobQueue;
 
 typedef enum
 {
@@ -97,7 +106,35 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     bool bHasFieldNames;
 
-    OGRFeature *GetNextUnfilteredFeature();
+    OGRFeature *
+    GetNextUnfilteredFeature(OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *TranslateRecord(char **papszTokens, int nRecord,
+                                OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
+
+    // Parallel parsing of records, when reading through ArrowArray.
+    struct ParseChunk;
+    bool m_bParallelParsingTried = false;
+    std::unique_ptr<CPLJobQueue> m_poParseJobQueue{};
+    std::mutex m_oParseMutex{};
+    std::condition_variable m_oParseCV{};
+    std::deque<std::unique_ptr<ParseChunk>> m_apoParseChunks{};
+    size_t m_nMaxQueuedParseChunks = 0;
+    size_t m_iNextParsedFeature = 0;
+    std::string m_osParseRemainder{};
+    size_t m_nParseRemainderScanned = 0;
+    size_t m_nParseRemainderBoundary = 0;
+    int m_nParseRemainderRecords = 0;
+    bool m_bParseRemainderInQuotes = false;
+    bool m_bParseRemainderInRecord = false;
+    bool m_bParseEOF = false;
+    int m_nParseNextRecord = 1;
+
+    void StartParallelParsing();
+    void StopParallelParsing();
+    bool QueueParseChunk();
+    static void ParseChunkJob(void *pData);
+    OGRFeature *GetNextParsedFeature();
 
     bool bNew;
     bool bInWriteMode;
@@ -138,7 +175,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     char **AutodetectFieldTypes(char **papszOpenOptions, int nFieldCount);
 
-    bool bWarningBadTypeOrWidth;
+    std::atomic<bool> bWarningBadTypeOrWidth;
     bool bKeepSourceColumns;
     bool bKeepGeomColumns;
 
@@ -152,6 +189,9 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     static bool Matches(const char *pszFieldName, char **papszPossibleNames);
 
+  protected:
+    OGRFeature *IGetNextFeatureReusing(OGRFeature *poFeatureToReuse) override;
+
   public:
     OGRCSVLayer(GDALDataset *poDS, const char *pszName, VSILFILE *fp,
                 int nMaxLineSize, const char *pszFilename, int bNew,
@@ -227,6 +267,8 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
     virtual OGRFeature *GetFeature(GIntBig nFID) override;
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
 
     OGRFeatureDefn *GetLayerDefn() override
     {
@@ -47,8 +47,11 @@
 #include "cpl_conv.h"
 #include "cpl_csv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -1251,6 +1254,21 @@ char **OGRCSVLayer::AutodetectFieldTypes(char **papszOpenOptions,
     return papszFieldTypes;
 }
 
+/************************************************************************/
+/*                      OGRCSVLayer::ParseChunk                         */
+/************************************************************************/
+
+// Range of complete records of the file, parsed by a worker thread.
+struct OGRCSVLayer::ParseChunk
+{
+    OGRCSVLayer *poLayer = nullptr;
+    std::string osData{};
+    int nFirstRecord = 0;
+    bool bDone = false;  // protected by poLayer->m_oParseMutex
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+
 /************************************************************************/
 /*                            ~OGRCSVLayer()                            */
 /************************************************************************/
@@ -1258,6 +1276,8 @@ char **OGRCSVLayer::AutodetectFieldTypes(char **papszOpenOptions,
 OGRCSVLayer::~OGRCSVLayer()
 
 {
+    StopParallelParsing();
+
     if (m_nFeaturesRead > 0)
     {
         CPLDebug("CSV", "%d features read on layer '%s'.",
@@ -1284,6 +1304,9 @@ OGRCSVLayer::~OGRCSVLayer()
 void OGRCSVLayer::ResetReading()
 
 {
+    StopParallelParsing();
+    m_bParallelParsingTried = false;
+
     if (fpCSV)
         VSIRewindL(fpCSV);
 
@@ -1333,7 +1356,7 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 {
     if (nFID < 1 || fpCSV == nullptr)
         return nullptr;
-    if (nFID < nNextFID || bNeedRewindBeforeRead)
+    if (nFID < nNextFID || bNeedRewindBeforeRead || m_poParseJobQueue)
         ResetReading();
     while (nNextFID < nFID)
     {
@@ -1350,9 +1373,16 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 /*                      GetNextUnfilteredFeature()                      */
 /************************************************************************/
 
-OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
+// Takes ownership of poFeatureToReuse, which is either returned filled with
+// the next record, or destroyed.
+OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature(OGRFeature *poFeatureToReuse)
 
 {
+    std::unique_ptr<OGRFeature> poFeatureToReuseHolder(poFeatureToReuse);
+
+    if (m_poParseJobQueue)
+        return GetNextParsedFeature();
+
     if (fpCSV == nullptr)
         return nullptr;
 
@@ -1361,8 +1391,34 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if (papszTokens == nullptr)
         return nullptr;
 
+    OGRFeature *poFeature = TranslateRecord(papszTokens, nNextFID,
+                                            poFeatureToReuseHolder.release());
+    CSLDestroy(papszTokens);
+
+    // Translate the record id.
+    poFeature->SetFID(nNextFID++);
+
+    m_nFeaturesRead++;
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                          TranslateRecord()                           */
+/************************************************************************/
+
+// Only depends on the layer definition and immutable settings of the layer,
+// so that it can be called from several threads at once.
+// If poFeatureToReuse is not null, it is reset and returned.
+OGRFeature *OGRCSVLayer::TranslateRecord(char **papszTokens, int nRecord,
+                                         OGRFeature *poFeatureToReuse)
+{
     // Create the OGR feature.
-    OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+        poFeature->Reset();
+    else
+        poFeature = new OGRFeature(poFeatureDefn);
 
     // Set attributes for any indicated attribute records.
     int iOGRField = 0;
@@ -1450,7 +1506,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                         CE_Warning, CPLE_AppDefined,
                         "Invalid value type found in record %d for field %s. "
                         "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
+                        nRecord, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1479,7 +1535,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                  "Invalid value type found in record %d for "
                                  "field %s. "
                                  "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
+                                 nRecord, poFieldDefn->GetNameRef());
                     }
                     else if (!bWarningBadTypeOrWidth &&
                              poFieldDefn->GetWidth() > 0 &&
@@ -1491,7 +1547,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                  "Value with a width greater than field width "
                                  "found in record %d for field %s. "
                                  "This warning will no longer be emitted",
-                                 nNextFID, poFieldDefn->GetNameRef());
+                                 nRecord, poFieldDefn->GetNameRef());
                     }
                     else if (!bWarningBadTypeOrWidth &&
                              eType == CPL_VALUE_REAL &&
@@ -1510,7 +1566,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                                      "field precision found in record %d for "
                                      "field %s. "
                                      "This warning will no longer be emitted",
-                                     nNextFID, poFieldDefn->GetNameRef());
+                                     nRecord, poFieldDefn->GetNameRef());
                         }
                     }
                 }
@@ -1523,7 +1579,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                             CE_Warning, CPLE_AppDefined,
                             "Invalid value type found in record %d for field "
                             "%s. This warning will no longer be emitted.",
-                            nNextFID, poFieldDefn->GetNameRef());
+                            nRecord, poFieldDefn->GetNameRef());
                     }
                 }
             }
@@ -1541,7 +1597,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                         CE_Warning, CPLE_AppDefined,
                         "Invalid value type found in record %d for field %s. "
                         "This warning will no longer be emitted",
-                        nNextFID, poFieldDefn->GetNameRef());
+                        nRecord, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1563,7 +1619,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                              "Value with a width greater than field width "
                              "found in record %d for field %s. "
                              "This warning will no longer be emitted",
-                             nNextFID, poFieldDefn->GetNameRef());
+                             nRecord, poFieldDefn->GetNameRef());
                 }
             }
         }
@@ -1688,13 +1744,6 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         }
     }
 
-    CSLDestroy(papszTokens);
-
-    // Translate the record id.
-    poFeature->SetFID(nNextFID++);
-
-    m_nFeaturesRead++;
-
     return poFeature;
 }
 
@@ -1704,15 +1753,35 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
 OGRFeature *OGRCSVLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                       IGetNextFeatureReusing()                       */
+/************************************************************************/
+
+OGRFeature *OGRCSVLayer::IGetNextFeatureReusing(OGRFeature *poFeatureToReuse)
+
+{
+    return GetNextFeatureInternal(poFeatureToReuse);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+OGRFeature *OGRCSVLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
 {
     if (bNeedRewindBeforeRead)
         ResetReading();
 
     // Read features till we find one that satisfies our current
-    // spatial criteria.
+    // spatial criteria. Rejected features are recycled.
     while (true)
     {
-        OGRFeature *poFeature = GetNextUnfilteredFeature();
+        OGRFeature *poFeature = GetNextUnfilteredFeature(poFeatureToReuse);
         if (poFeature == nullptr)
             return nullptr;
 
@@ -1721,7 +1790,277 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
             return poFeature;
 
-        delete poFeature;
+        poFeatureToReuse = poFeature;
+    }
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+int OGRCSVLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                   struct ArrowArray *out_array)
+{
+    if (bNeedRewindBeforeRead)
+        ResetReading();
+
+    if (!m_bParallelParsingTried)
+    {
+        m_bParallelParsingTried = true;
+        StartParallelParsing();
+    }
+
+    return OGRLayer::GetNextArrowArray(stream, out_array);
+}
+
+/************************************************************************/
+/*                       StartParallelParsing()                         */
+/************************************************************************/
+
+// Records are split from the file by the calling thread, and translated into
+// features by worker threads of the global thread pool. Filters are still
+// evaluated in GetNextFeature().
+void OGRCSVLayer::StartParallelParsing()
+{
+    if (bInWriteMode || fpCSV == nullptr || nNextFID != 1 ||
+        (m_poSharedArrowArrayStreamPrivateData &&
+         !m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty()))
+    {
+        return;
+    }
+
+    const char *pszNumThreads =
+        CPLGetConfigOption("OGR_CSV_NUM_THREADS", nullptr);
+    const int nThreads =
+        pszNumThreads == nullptr        ? std::min(4, CPLGetNumCPUs())
+        : EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                           : atoi(pszNumThreads);
+    if (nThreads < 2)
+        return;
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (poPool == nullptr)
+        return;
+
+    CPLDebug("CSV", "Using %d threads to parse records of layer %s", nThreads,
+             poFeatureDefn->GetName());
+    m_poParseJobQueue = poPool->CreateJobQueue();
+    m_nMaxQueuedParseChunks = 2 * static_cast<size_t>(nThreads);
+    m_nParseNextRecord = nNextFID;
+}
+
+/************************************************************************/
+/*                        StopParallelParsing()                         */
+/************************************************************************/
+
+void OGRCSVLayer::StopParallelParsing()
+{
+    if (m_poParseJobQueue)
+    {
+        m_poParseJobQueue->WaitCompletion();
+        m_poParseJobQueue.reset();
+    }
+    m_apoParseChunks.clear();
+    m_iNextParsedFeature = 0;
+    m_osParseRemainder.clear();
+    m_nParseRemainderScanned = 0;
+    m_nParseRemainderBoundary = 0;
+    m_nParseRemainderRecords = 0;
+    m_bParseRemainderInQuotes = false;
+    m_bParseRemainderInRecord = false;
+    m_bParseEOF = false;
+}
+
+/************************************************************************/
+/*                          QueueParseChunk()                           */
+/************************************************************************/
+
+// Read from fpCSV until at least a chunk worth of complete records is
+// available, and submit them for parsing. Returns false at end of file.
+bool OGRCSVLayer::QueueParseChunk()
+{
+    const size_t nChunkSize = static_cast<size_t>(std::max(
+        1, atoi(CPLGetConfigOption("OGR_CSV_PARSE_CHUNK_SIZE", "1048576"))));
+
+    std::string &osBuffer = m_osParseRemainder;
+    size_t nCut = 0;
+    while (true)
+    {
+        // Look for record boundaries, that is end of lines not within quoted
+        // fields, in the same way as CSVReadParseLine3L() assembles records.
+        // The last byte is only examined once the following one is known, so
+        // that a CR LF sequence is never split.
+        const size_t nSize = osBuffer.size();
+        const size_t nScanLimit =
+            m_bParseEOF ? nSize : nSize > 0 ? nSize - 1 : 0;
+        for (size_t i = m_nParseRemainderScanned; i < nScanLimit; ++i)
+        {
+            const char ch = osBuffer[i];
+            if (ch == '"' && bHonourStrings)
+            {
+                m_bParseRemainderInQuotes = !m_bParseRemainderInQuotes;
+                m_bParseRemainderInRecord = true;
+            }
+            else if ((ch == '\n' || ch == '\r') && !m_bParseRemainderInQuotes)
+            {
+                if (ch == '\r' && i + 1 < nSize && osBuffer[i + 1] == '\n')
+                    continue;
+                if (m_bParseRemainderInRecord)
+                    ++m_nParseRemainderRecords;
+                m_bParseRemainderInRecord = false;
+                m_nParseRemainderBoundary = i + 1;
+            }
+            else if (ch != '\r' && ch != '\n')
+            {
+                m_bParseRemainderInRecord = true;
+            }
+        }
+        m_nParseRemainderScanned =
+            std::max(m_nParseRemainderScanned, nScanLimit);
+
+        if (m_bParseEOF)
+        {
+            nCut = nSize;
+            if (m_bParseRemainderInRecord)
+                ++m_nParseRemainderRecords;
+            break;
+        }
+        if (m_nParseRemainderBoundary > 0 && nSize >= nChunkSize)
+        {
+            nCut = m_nParseRemainderBoundary;
+            break;
+        }
+
+        try
+        {
+            osBuffer.resize(nSize + nChunkSize);
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+            return false;
+        }
+        const size_t nRead = VSIFReadL(&osBuffer[nSize], 1, nChunkSize, fpCSV);
+        osBuffer.resize(nSize + nRead);
+        if (nRead < nChunkSize)
+            m_bParseEOF = true;
+    }
+
+    if (nCut == 0)
+        return false;
+
+    auto poChunk = std::make_unique<ParseChunk>();
+    poChunk->poLayer = this;
+    poChunk->nFirstRecord = m_nParseNextRecord;
+    if (nCut == osBuffer.size())
+    {
+        poChunk->osData = std::move(osBuffer);
+        osBuffer.clear();
+    }
+    else
+    {
+        poChunk->osData.assign(osBuffer, 0, nCut);
+        osBuffer.erase(0, nCut);
+    }
+    m_nParseNextRecord += m_nParseRemainderRecords;
+    m_nParseRemainderScanned -= nCut;
+    m_nParseRemainderBoundary = 0;
+    m_nParseRemainderRecords = 0;
+
+    ParseChunk *psChunk = poChunk.get();
+    m_apoParseChunks.push_back(std::move(poChunk));
+    if (!m_poParseJobQueue->SubmitJob(ParseChunkJob, psChunk))
+        ParseChunkJob(psChunk);
+    return true;
+}
+
+/************************************************************************/
+/*                           ParseChunkJob()                            */
+/************************************************************************/
+
+void OGRCSVLayer::ParseChunkJob(void *pData)
+{
+    ParseChunk *psChunk = static_cast<ParseChunk *>(pData);
+    OGRCSVLayer *poLayer = psChunk->poLayer;
+
+    // Errors are emitted again by the thread that consumes the features.
+    CPLInstallErrorHandlerAccumulator(psChunk->aoErrors);
+
+    const std::string osTmpFilename(
+        CPLSPrintf("/vsimem/ogr_csv_chunk_%p.csv", psChunk));
+    VSILFILE *fp = VSIFileFromMemBuffer(
+        osTmpFilename.c_str(), reinterpret_cast<GByte *>(&psChunk->osData[0]),
+        psChunk->osData.size(), FALSE);
+    if (fp)
+    {
+        int nRecord = psChunk->nFirstRecord;
+        while (true)
+        {
+            char **papszTokens = CSVReadParseLine3L(
+                fp, poLayer->m_nMaxLineSize, poLayer->szDelimiter,
+                poLayer->bHonourStrings,
+                false,  // bKeepLeadingAndClosingQuotes
+                poLayer->bMergeDelimiter,
+                true  // bSkipBOM
+            );
+            if (papszTokens == nullptr)
+                break;
+            if (papszTokens[0] != nullptr)
+            {
+                psChunk->apoFeatures.emplace_back(
+                    poLayer->TranslateRecord(papszTokens, nRecord));
+                ++nRecord;
+            }
+            CSLDestroy(papszTokens);
+        }
+        VSIFCloseL(fp);
+        VSIUnlink(osTmpFilename.c_str());
+    }
+
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poLayer->m_oParseMutex);
+    psChunk->bDone = true;
+    poLayer->m_oParseCV.notify_all();
+}
+
+/************************************************************************/
+/*                        GetNextParsedFeature()                        */
+/************************************************************************/
+
+OGRFeature *OGRCSVLayer::GetNextParsedFeature()
+{
+    while (true)
+    {
+        while (m_apoParseChunks.size() < m_nMaxQueuedParseChunks &&
+               QueueParseChunk())
+        {
+        }
+        if (m_apoParseChunks.empty())
+            return nullptr;
+
+        ParseChunk *psChunk = m_apoParseChunks.front().get();
+        {
+            std::unique_lock<std::mutex> oLock(m_oParseMutex);
+            m_oParseCV.wait(oLock, [psChunk] { return psChunk->bDone; });
+        }
+
+        if (m_iNextParsedFeature == 0)
+        {
+            for (const auto &oError : psChunk->aoErrors)
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        if (m_iNextParsedFeature < psChunk->apoFeatures.size())
+        {
+            OGRFeature *poFeature =
+                psChunk->apoFeatures[m_iNextParsedFeature++].release();
+            poFeature->SetFID(nNextFID++);
+            m_nFeaturesRead++;
+            return poFeature;
+        }
+
+        m_apoParseChunks.pop_front();
+        m_iNextParsedFeature = 0;
     }
 }
 
@@ -38,9 +38,11 @@
 #include "cpl_http.h"
 #include "cpl_json.h"
 
+#include <deque>
 #include <map>
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 typedef enum
@@ -51,6 +53,7 @@ typedef enum
 } ESGeometryTypeMapping;
 
 class OGRElasticDataSource;
+struct OGRElasticBulkUpload;
 
 class OGRESSortDesc
 {
@@ -93,6 +96,8 @@ class OGRElasticLayer final : public OGRLayer
 
     CPLString m_osBulkContent{};
     int m_nBulkUpload{};
+    int m_nBulkConcurrency = 1;
+    std::deque<std::unique_ptr<OGRElasticBulkUpload>> m_apoBulkUploads{};
 
     CPLString m_osFID{};
 
@@ -112,6 +117,10 @@ class OGRElasticLayer final : public OGRLayer
     int m_iCurFeatureInPage = 0;
     std::vector<OGRFeature *> m_apoCachedFeatures{};
     bool m_bEOF = false;
+    //! Whether the current iteration uses a sliced scroll
+    bool m_bSlicedScroll = false;
+    //! Scroll id of each slice. Empty when the slice is exhausted
+    std::vector<CPLString> m_aosSliceScrollIDs{};
 
     json_object *m_poSpatialFilter = nullptr;
     CPLString m_osJSONFilter{};
@@ -140,10 +149,14 @@ class OGRElasticLayer final : public OGRLayer
     void CopyMembersTo(OGRElasticLayer *poNew);
 
     bool PushIndex();
+    bool WaitBulkUploads(size_t nMaxPending);
     CPLString BuildMap();
 
     OGRErr WriteMapIfNecessary();
     OGRFeature *GetNextRawFeature();
+    void AddFeaturesFromHits(json_object *poHits);
+    bool FetchSlicedPages(const CPLString &osFirstRequest,
+                          const std::vector<CPLString> &aosFirstPostData);
     void BuildFeature(OGRFeature *poFeature, json_object *poSource,
                       CPLString osPath);
     void CreateFieldFromSchema(const char *pszName, const char *pszPrefix,
@@ -365,6 +378,7 @@ class OGRElasticDataSource final : public GDALDataset
     char *m_pszWriteMap;
     char *m_pszMapping;
     int m_nBatchSize;
+    int m_nScrollSlices = 1;
     int m_nFeatureCountToEstablishFeatureDefn;
     bool m_bJSonField;
     bool m_bFlattenNestedAttributes;
@@ -411,6 +425,8 @@ class OGRElasticDataSource final : public GDALDataset
     json_object *RunRequest(
         const char *pszURL, const char *pszPostContent = nullptr,
         const std::vector<int> &anSilentedHTTPErrors = std::vector<int>());
+    std::vector<json_object *>
+    RunRequests(const std::vector<std::pair<CPLString, CPLString>> &aoRequests);
 
     const CPLString &GetFID() const
     {
@@ -34,6 +34,10 @@
 #include "cpl_http.h"
 #include "ogrgeojsonreader.h"
 #include "ogr_swq.h"
+#include "cpl_error_internal.h"
+
+#include <algorithm>
+#include <thread>
 
 /************************************************************************/
 /*                        OGRElasticDataSource()                        */
@@ -770,6 +774,50 @@ OGRElasticDataSource::RunRequest(const char *pszURL, const char *pszPostContent,
     return poObj;
 }
 
+/************************************************************************/
+/*                              RunRequests()                           */
+/************************************************************************/
+
+// Runs the (URL, post content) requests concurrently, one thread per request.
+// Errors are emitted from the calling thread once all requests are completed.
+std::vector<json_object *> OGRElasticDataSource::RunRequests(
+    const std::vector<std::pair<CPLString, CPLString>> &aoRequests)
+{
+    std::vector<json_object *> apoResults(aoRequests.size(), nullptr);
+    if (aoRequests.size() == 1)
+    {
+        apoResults[0] =
+            RunRequest(aoRequests[0].first, aoRequests[0].second.c_str());
+        return apoResults;
+    }
+
+    std::vector<std::vector<CPLErrorHandlerAccumulatorStruct>> aaoErrors(
+        aoRequests.size());
+    const CPLStringList aosConfigOptions(CPLGetThreadLocalConfigOptions());
+    std::vector<std::thread> aoThreads;
+    for (size_t i = 0; i < aoRequests.size(); ++i)
+    {
+        aoThreads.emplace_back(
+            [this, &aoRequests, &apoResults, &aaoErrors, &aosConfigOptions, i]()
+            {
+                CPLSetThreadLocalConfigOptions(aosConfigOptions.List());
+                CPLInstallErrorHandlerAccumulator(aaoErrors[i]);
+                apoResults[i] = RunRequest(aoRequests[i].first,
+                                           aoRequests[i].second.c_str());
+                CPLUninstallErrorHandlerAccumulator();
+            });
+    }
+    for (auto &oThread : aoThreads)
+        oThread.join();
+
+    for (const auto &aoErrors : aaoErrors)
+    {
+        for (const auto &oError : aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+    return apoResults;
+}
+
 /************************************************************************/
 /*                           CheckVersion()                             */
 /************************************************************************/
@@ -844,6 +892,10 @@ bool OGRElasticDataSource::Open(GDALOpenInfo *poOpenInfo)
         CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "USERPWD", "");
     m_nBatchSize = atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                                              "BATCH_SIZE", "100"));
+    m_nScrollSlices = std::clamp(
+        atoi(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                  "SCROLL_SLICES", "1")),
+        1, 64);
     m_nFeatureCountToEstablishFeatureDefn = atoi(
         CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                              "FEATURE_COUNT_TO_ESTABLISH_FEATURE_DEFN", "100"));
@@ -1091,6 +1143,7 @@ OGRLayer *OGRElasticDataSource::ExecuteSQL(const char *pszSQLCommand,
             (iLayer = GetLayerIndex(psSelectInfo->table_defs[0].table_name)) >=
                 0 &&
             psSelectInfo->join_count == 0 && psSelectInfo->order_specs > 0 &&
+            psSelectInfo->group_by_defs.empty() &&
             psSelectInfo->poOtherSelect == nullptr)
         {
             OGRElasticLayer *poSrcLayer = m_apoLayers[iLayer].get();
@@ -38,9 +38,26 @@
 #include "../geojson/ogrgeojsonreader.h"
 #include "../geojson/ogrgeojsonutils.h"
 #include "ogr_geo_utils.h"
+#include "cpl_error_internal.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <set>
+#include <thread>
+
+/************************************************************************/
+/*                        OGRElasticBulkUpload                          */
+/************************************************************************/
+
+// _bulk request issued by a worker thread when BULK_CONCURRENCY > 1
+struct OGRElasticBulkUpload
+{
+    std::thread oThread{};
+    CPLString osContent{};
+    CPLStringList aosConfigOptions{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+    bool bRet = true;
+};
 
 /************************************************************************/
 /*                        CPLGettimeofday()                             */
@@ -122,6 +139,9 @@ OGRElasticLayer::OGRElasticLayer(const char *pszLayerName,
         m_nBulkUpload =
             atoi(CSLFetchNameValueDef(papszOptions, "BULK_SIZE", "1000000"));
     }
+    m_nBulkConcurrency = std::clamp(
+        atoi(CSLFetchNameValueDef(papszOptions, "BULK_CONCURRENCY", "1")), 1,
+        64);
 
     const char *pszStoredFields =
         CSLFetchNameValue(papszOptions, "STORED_FIELDS");
@@ -260,6 +280,7 @@ void OGRElasticLayer::CopyMembersTo(OGRElasticLayer *poNew)
     poNew->m_bFeatureDefnFinalized = true;
     poNew->m_osBulkContent = m_osBulkContent;
     poNew->m_nBulkUpload = m_nBulkUpload;
+    poNew->m_nBulkConcurrency = m_nBulkConcurrency;
     poNew->m_osFID = m_osFID;
     poNew->m_aaosFieldPaths = m_aaosFieldPaths;
     poNew->m_aosMapToFieldIndex = m_aosMapToFieldIndex;
@@ -1046,9 +1067,13 @@ void OGRElasticLayer::AddOrUpdateField(const char *pszAttrName,
 OGRErr OGRElasticLayer::SyncToDisk()
 {
     if (WriteMapIfNecessary() != OGRERR_NONE)
+    {
+        WaitBulkUploads(0);
         return OGRERR_FAILURE;
+    }
 
-    if (!PushIndex())
+    const bool bPushOK = PushIndex();
+    if (!WaitBulkUploads(0) || !bPushOK)
         return OGRERR_FAILURE;
 
     return OGRERR_NONE;
@@ -1096,6 +1121,22 @@ void OGRElasticLayer::ResetReading()
 
         m_osScrollID = "";
     }
+    for (const auto &osSliceScrollID : m_aosSliceScrollIDs)
+    {
+        if (osSliceScrollID.empty())
+            continue;
+        char **papszOptions =
+            CSLAddNameValue(nullptr, "CUSTOMREQUEST", "DELETE");
+        CPLHTTPResult *psResult = m_poDS->HTTPFetch(
+            (m_poDS->GetURL() + CPLString("/_search/scroll?scroll_id=") +
+             osSliceScrollID)
+                .c_str(),
+            papszOptions);
+        CSLDestroy(papszOptions);
+        CPLHTTPDestroyResult(psResult);
+    }
+    m_aosSliceScrollIDs.clear();
+    m_bSlicedScroll = false;
     for (int i = 0; i < (int)m_apoCachedFeatures.size(); i++)
         delete m_apoCachedFeatures[i];
     m_apoCachedFeatures.resize(0);
@@ -1202,6 +1243,40 @@ CPLString OGRElasticLayer::BuildQuery(bool bCountOnly)
     return osRet;
 }
 
+/************************************************************************/
+/*                           AddSliceToQuery()                          */
+/************************************************************************/
+
+// Returns a copy of the JSON search request osPostData restricted to one
+// slice of a sliced scroll, or an empty string if osPostData cannot be
+// parsed as a JSON object.
+static CPLString AddSliceToQuery(const CPLString &osPostData, int iSlice,
+                                 int nSlices)
+{
+    json_object *poQuery = nullptr;
+    if (osPostData.empty())
+    {
+        poQuery = json_object_new_object();
+    }
+    else
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        if (!OGRJSonParse(osPostData, &poQuery, false) ||
+            json_object_get_type(poQuery) != json_type_object)
+        {
+            json_object_put(poQuery);
+            return CPLString();
+        }
+    }
+    json_object *poSlice = json_object_new_object();
+    json_object_object_add(poSlice, "id", json_object_new_int(iSlice));
+    json_object_object_add(poSlice, "max", json_object_new_int(nSlices));
+    json_object_object_add(poQuery, "slice", poSlice);
+    CPLString osRet(json_object_to_json_string(poQuery));
+    json_object_put(poQuery);
+    return osRet;
+}
+
 /************************************************************************/
 /*                         GetNextRawFeature()                          */
 /************************************************************************/
@@ -1243,6 +1318,7 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
     m_iCurFeatureInPage = 0;
 
     CPLString osRequest, osPostData;
+    std::vector<CPLString> aosSlicedPostData;
     if (m_nReadFeaturesSinceResetReading == 0)
     {
         if (!m_osESSearch.empty())
@@ -1276,8 +1352,31 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
                 CPLSPrintf("/_search?scroll=1m&size=%d", m_poDS->m_nBatchSize);
             osPostData = m_osJSONFilter;
         }
+
+        // Sliced scrolls are available since Elasticsearch 5.0. They are not
+        // used with sort clauses, since the order of features would be lost
+        // when merging the slices.
+        const int nSlices = m_poDS->m_nScrollSlices;
+        if (nSlices > 1 && m_poDS->m_nMajorVersion >= 5 &&
+            m_osESSearch.empty() && m_aoSortColumns.empty())
+        {
+            for (int i = 0; i < nSlices; ++i)
+            {
+                CPLString osSlicePostData(
+                    AddSliceToQuery(osPostData, i, nSlices));
+                if (osSlicePostData.empty())
+                {
+                    CPLDebug("ES", "Cannot use a sliced scroll with %s",
+                             osPostData.c_str());
+                    aosSlicedPostData.clear();
+                    break;
+                }
+                aosSlicedPostData.push_back(std::move(osSlicePostData));
+            }
+            m_bSlicedScroll = !aosSlicedPostData.empty();
+        }
     }
-    else
+    else if (!m_bSlicedScroll)
     {
         if (m_osScrollID.empty())
         {
@@ -1290,6 +1389,23 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
 
     if (m_bAddPretty)
         osRequest += "&pretty";
+
+    if (m_bSlicedScroll)
+    {
+        // Also handles the first page of a sliced scroll
+        if (!FetchSlicedPages(osRequest, aosSlicedPostData) ||
+            m_apoCachedFeatures.empty())
+        {
+            m_bEOF = true;
+            return nullptr;
+        }
+        OGRFeature *poRet = m_apoCachedFeatures[0];
+        m_apoCachedFeatures[0] = nullptr;
+        m_iCurFeatureInPage++;
+        m_nReadFeaturesSinceResetReading++;
+        return poRet;
+    }
+
     poResponse = m_poDS->RunRequest(osRequest, osPostData);
     if (poResponse == nullptr)
     {
@@ -1328,6 +1444,29 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
         json_object_put(poResponse);
         return nullptr;
     }
+    AddFeaturesFromHits(poHits);
+
+    json_object_put(poResponse);
+    if (!m_apoCachedFeatures.empty())
+    {
+        OGRFeature *poRet = m_apoCachedFeatures[0];
+        m_apoCachedFeatures[0] = nullptr;
+        m_iCurFeatureInPage++;
+        m_nReadFeaturesSinceResetReading++;
+        return poRet;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                        AddFeaturesFromHits()                         */
+/************************************************************************/
+
+// Turns the elements of a hits.hits array into features appended to
+// m_apoCachedFeatures.
+void OGRElasticLayer::AddFeaturesFromHits(json_object *poHits)
+{
+    const auto nHits = json_object_array_length(poHits);
     for (auto i = decltype(nHits){0}; i < nHits; i++)
     {
         json_object *poHit = json_object_array_get_idx(poHits, i);
@@ -1381,16 +1520,90 @@ OGRFeature *OGRElasticLayer::GetNextRawFeature()
         m_apoCachedFeatures.push_back(poFeature);
     }
 
-    json_object_put(poResponse);
-    if (!m_apoCachedFeatures.empty())
+}
+
+/************************************************************************/
+/*                          FetchSlicedPages()                          */
+/************************************************************************/
+
+// Fetches concurrently the next page of each slice that is not exhausted,
+// and appends their hits to m_apoCachedFeatures, in slice order. When
+// aosFirstPostData is not empty, this is the initial search request of each
+// slice.
+bool OGRElasticLayer::FetchSlicedPages(
+    const CPLString &osFirstRequest,
+    const std::vector<CPLString> &aosFirstPostData)
+{
+    std::vector<std::pair<CPLString, CPLString>> aoRequests;
+    std::vector<size_t> anSliceIdx;
+    if (!aosFirstPostData.empty())
     {
-        OGRFeature *poRet = m_apoCachedFeatures[0];
-        m_apoCachedFeatures[0] = nullptr;
-        m_iCurFeatureInPage++;
-        m_nReadFeaturesSinceResetReading++;
-        return poRet;
+        m_aosSliceScrollIDs.clear();
+        m_aosSliceScrollIDs.resize(aosFirstPostData.size());
+        for (size_t i = 0; i < aosFirstPostData.size(); ++i)
+        {
+            aoRequests.emplace_back(osFirstRequest, aosFirstPostData[i]);
+            anSliceIdx.push_back(i);
+        }
     }
-    return nullptr;
+    else
+    {
+        for (size_t i = 0; i < m_aosSliceScrollIDs.size(); ++i)
+        {
+            if (m_aosSliceScrollIDs[i].empty())
+                continue;
+            CPLString osRequest(
+                CPLSPrintf("%s/_search/scroll?scroll=1m&scroll_id=%s",
+                           m_poDS->GetURL(), m_aosSliceScrollIDs[i].c_str()));
+            if (m_bAddPretty)
+                osRequest += "&pretty";
+            aoRequests.emplace_back(osRequest, CPLString());
+            anSliceIdx.push_back(i);
+        }
+    }
+    if (aoRequests.empty())
+        return false;
+
+    // JSON parsing of the responses is done in the worker threads. Building
+    // the features is done afterwards in this thread.
+    const auto apoResponses = m_poDS->RunRequests(aoRequests);
+    bool bRet = true;
+    for (size_t i = 0; i < apoResponses.size(); ++i)
+    {
+        CPLString &osScrollID = m_aosSliceScrollIDs[anSliceIdx[i]];
+        osScrollID.clear();
+        json_object *poResponse = apoResponses[i];
+        if (poResponse == nullptr)
+        {
+            bRet = false;
+            continue;
+        }
+        json_object *poScrollID =
+            CPL_json_object_object_get(poResponse, "_scroll_id");
+        if (poScrollID)
+        {
+            const char *pszScrollID = json_object_get_string(poScrollID);
+            if (pszScrollID)
+                osScrollID = pszScrollID;
+        }
+
+        json_object *poHits = CPL_json_object_object_get(poResponse, "hits");
+        if (poHits && json_object_get_type(poHits) == json_type_object)
+            poHits = CPL_json_object_object_get(poHits, "hits");
+        else
+            poHits = nullptr;
+        if (poHits && json_object_get_type(poHits) == json_type_array &&
+            json_object_array_length(poHits) > 0)
+        {
+            AddFeaturesFromHits(poHits);
+        }
+        else
+        {
+            osScrollID.clear();
+        }
+        json_object_put(poResponse);
+    }
+    return bRet;
 }
 
 /************************************************************************/
@@ -2776,6 +2989,7 @@ OGRErr OGRElasticLayer::ISetFeature(OGRFeature *poFeature)
     if (WriteMapIfNecessary() != OGRERR_NONE)
         return OGRERR_FAILURE;
     PushIndex();
+    WaitBulkUploads(0);
 
     CPLString osFields(BuildJSonFromFeature(poFeature));
 
@@ -2895,10 +3109,60 @@ bool OGRElasticLayer::PushIndex()
         return true;
     }
 
-    const bool bRet = m_poDS->UploadFile(
-        CPLSPrintf("%s/_bulk", m_poDS->GetURL()), m_osBulkContent);
+    if (m_nBulkConcurrency <= 1)
+    {
+        const bool bRet = m_poDS->UploadFile(
+            CPLSPrintf("%s/_bulk", m_poDS->GetURL()), m_osBulkContent);
+        m_osBulkContent.clear();
+
+        return bRet;
+    }
+
+    // Wait for a slot to be available. A failure of a previous upload is
+    // reported now.
+    const bool bRet =
+        WaitBulkUploads(static_cast<size_t>(m_nBulkConcurrency - 1));
+
+    auto poUpload = std::make_unique<OGRElasticBulkUpload>();
+    poUpload->osContent = std::move(m_osBulkContent);
     m_osBulkContent.clear();
+    poUpload->aosConfigOptions.Assign(CPLGetThreadLocalConfigOptions(), true);
+    OGRElasticBulkUpload *poUploadRaw = poUpload.get();
+    OGRElasticDataSource *poDS = m_poDS;
+    poUpload->oThread = std::thread(
+        [poDS, poUploadRaw]()
+        {
+            CPLSetThreadLocalConfigOptions(
+                poUploadRaw->aosConfigOptions.List());
+            CPLInstallErrorHandlerAccumulator(poUploadRaw->aoErrors);
+            poUploadRaw->bRet = poDS->UploadFile(
+                CPLSPrintf("%s/_bulk", poDS->GetURL()), poUploadRaw->osContent);
+            CPLUninstallErrorHandlerAccumulator();
+        });
+    m_apoBulkUploads.push_back(std::move(poUpload));
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                          WaitBulkUploads()                           */
+/************************************************************************/
 
+// Waits until at most nMaxPending bulk uploads are in progress, and emits
+// the errors of the completed ones. Returns false if one of them failed.
+bool OGRElasticLayer::WaitBulkUploads(size_t nMaxPending)
+{
+    bool bRet = true;
+    while (m_apoBulkUploads.size() > nMaxPending)
+    {
+        auto &poUpload = m_apoBulkUploads.front();
+        poUpload->oThread.join();
+        for (const auto &oError : poUpload->aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        if (!poUpload->bRet)
+            bRet = false;
+        m_apoBulkUploads.pop_front();
+    }
     return bRet;
 }
 
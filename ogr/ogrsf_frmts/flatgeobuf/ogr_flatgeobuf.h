@@ -38,6 +38,7 @@
 #include "packedrtree.h"
 
 #include <deque>
+#include <functional>
 #include <limits>
 
 class OGRFlatGeobufDataset;
@@ -51,10 +52,13 @@ static constexpr uint32_t header_max_buffer_size = 1048576 * 10;
 static constexpr uint32_t feature_max_buffer_size =
     static_cast<uint32_t>(std::numeric_limits<int32_t>::max());
 
+class CPLJobQueue;
+
 // holds feature meta needed to build spatial index
 struct FeatureItem : FlatGeobuf::Item
 {
     uint32_t size;
+    uint32_t hilbertValue = 0;  // sort key, computed when writing the index
     uint64_t offset;
 };
 
@@ -99,6 +103,10 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     std::vector<FlatGeobuf::SearchResultItem>
         m_foundItems;  // found node items in spatial index search
     bool m_queriedSpatialIndex = false;
+    // whether to issue AdviseRead() on the features found in the spatial
+    // index search (for network files)
+    bool m_bAdviseRead = false;
+    size_t m_nextAdviseReadPos = 0;  // position of next AdviseRead() call
     bool m_ignoreSpatialFilter = false;
     bool m_ignoreAttributeFilter = false;
 
@@ -107,6 +115,13 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     bool m_create = false;
     std::deque<FeatureItem> m_featureItems;  // feature item description used to
                                              // create spatial index
+    // maximum number of feature items kept in memory, before they are
+    // spilled to a temporary file, and sorted with an external merge sort
+    size_t m_nMaxFeatureItemsInMemory = 0;
+    VSILFILE *m_poFpItems = nullptr;  // temporary file with spilled items
+    std::string m_osTempItemsFile{};
+    uint64_t m_nSpilledItems = 0;  // number of items in m_poFpItems
+    FlatGeobuf::NodeItem m_spilledItemsExtent = FlatGeobuf::NodeItem::create();
     bool m_bCreateSpatialIndexAtClose = true;
     bool m_bVerifyBuffers = true;
     VSILFILE *m_poFpWrite = nullptr;
@@ -129,6 +144,8 @@ class OGRFlatGeobufLayer final : public OGRLayer,
     void ensurePadfBuffers(size_t count);
     OGRErr ensureFeatureBuf(uint32_t featureSize);
     OGRErr parseFeature(OGRFeature *poFeature);
+    void adviseReadFoundItems();
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
     const std::vector<flatbuffers::Offset<FlatGeobuf::Column>>
     writeColumns(flatbuffers::FlatBufferBuilder &fbb);
     void readColumns();
@@ -137,6 +154,15 @@ class OGRFlatGeobufLayer final : public OGRLayer,
 
     // serialize
     bool CreateFinalFile();
+    bool SpillFeatureItems();
+    bool MergeSortSpilledItems(
+        CPLJobQueue *poJobQueue, int nThreads,
+        const FlatGeobuf::NodeItem &extent,
+        const std::vector<std::pair<uint64_t, uint64_t>> &levelBounds,
+        std::vector<FlatGeobuf::NodeItem> &upperNodes);
+    bool WriteSortedFeatures(
+        const std::function<const FeatureItem *()> &getNextItem,
+        uint64_t nTempFileSize, size_t &c);
     void writeHeader(VSILFILE *poFp, uint64_t featuresCount,
                      std::vector<double> *extentVector);
 
@@ -154,6 +180,7 @@ class OGRFlatGeobufLayer final : public OGRLayer,
   protected:
     virtual int GetNextArrowArray(struct ArrowArrayStream *,
                                   struct ArrowArray *out_array) override;
+    OGRFeature *IGetNextFeatureReusing(OGRFeature *poFeatureToReuse) override;
 
     CPLErr Close() override;
 
@@ -35,6 +35,8 @@
 #include "ogr_p.h"
 #include "ograrrowarrayhelper.h"
 #include "ogr_recordbatch.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_flatgeobuf.h"
 #include "cplerrors.h"
@@ -42,8 +44,10 @@
 #include "geometrywriter.h"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <new>
+#include <queue>
 #include <stdexcept>
 
 using namespace flatbuffers;
@@ -223,6 +227,24 @@ OGRFlatGeobufLayer::OGRFlatGeobufLayer(
     SetDescription(m_poFeatureDefn->GetName());
     m_poFeatureDefn->SetGeomType(eGType);
     m_poFeatureDefn->Reference();
+
+    const char *pszMaxItems =
+        CPLGetConfigOption("OGR_FLATGEOBUF_MAX_ITEMS_IN_MEMORY", nullptr);
+    if (pszMaxItems)
+    {
+        m_nMaxFeatureItemsInMemory = static_cast<size_t>(std::max<GIntBig>(
+            1, std::min<GIntBig>(CPLAtoGIntBig(pszMaxItems),
+                                 std::numeric_limits<int>::max())));
+    }
+    else
+    {
+        // Default to a quarter of the usable RAM, and at least 1 million
+        // items (56 MB)
+        const GIntBig nUsableRAM = CPLGetUsablePhysicalRAM();
+        m_nMaxFeatureItemsInMemory = static_cast<size_t>(std::max<GIntBig>(
+            1024 * 1024, std::min<GIntBig>(nUsableRAM / 4 / sizeof(FeatureItem),
+                                           std::numeric_limits<int>::max())));
+    }
 }
 
 OGRwkbGeometryType OGRFlatGeobufLayer::getOGRwkbGeometryType()
@@ -540,6 +562,230 @@ void OGRFlatGeobufLayer::writeHeader(VSILFILE *poFp, uint64_t featuresCount,
     m_writeOffset += c;
 }
 
+/************************************************************************/
+/*                      OGRFlatGeobufGetNumThreads()                    */
+/************************************************************************/
+
+static int OGRFlatGeobufGetNumThreads()
+{
+    const char *pszNumThreads =
+        CPLGetConfigOption("OGR_FLATGEOBUF_NUM_THREADS", nullptr);
+    const int nThreads =
+        pszNumThreads == nullptr        ? std::min(4, CPLGetNumCPUs())
+        : EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                           : atoi(pszNumThreads);
+    return std::max(1, std::min(nThreads, 128));
+}
+
+/************************************************************************/
+/*                      OGRFlatGeobufHilbertSort()                      */
+/************************************************************************/
+
+// Order of the features in the file: decreasing Hilbert value, as done by
+// FlatGeobuf::hilbertSort(), and increasing offset in the temporary file to
+// break ties, so that the result does not depend on the number of threads
+static bool OGRFlatGeobufFeatureItemLess(const FeatureItem &a,
+                                         const FeatureItem &b)
+{
+    if (a.hilbertValue != b.hilbertValue)
+        return a.hilbertValue > b.hilbertValue;
+    return a.offset < b.offset;
+}
+
+// Compute the Hilbert value of the items, and sort them, with chunks of items
+// sorted in parallel and then merged pairwise.
+template <class Iter>
+static void OGRFlatGeobufHilbertSort(Iter begin, Iter end,
+                                     const NodeItem &extent,
+                                     CPLJobQueue *poJobQueue, int nThreads)
+{
+    const size_t nItems = static_cast<size_t>(end - begin);
+    // Below that number of items per thread, multi-threading is not worth it
+    constexpr size_t MIN_ITEMS_PER_JOB = 65536;
+    const int nJobs =
+        poJobQueue ? static_cast<int>(std::max<size_t>(
+                         1, std::min<size_t>(nThreads,
+                                             nItems / MIN_ITEMS_PER_JOB)))
+                   : 1;
+
+    std::vector<size_t> anBounds;
+    for (int iJob = 0; iJob <= nJobs; ++iJob)
+        anBounds.push_back(static_cast<size_t>(
+            static_cast<uint64_t>(nItems) * iJob / nJobs));
+
+    const double minX = extent.minX;
+    const double minY = extent.minY;
+    const double width = extent.width();
+    const double height = extent.height();
+    CPLJobQueueRunRanges(
+        poJobQueue, nJobs, nJobs,
+        [&](int, int iStart, int iEnd)
+        {
+            for (auto iJob = iStart; iJob < iEnd; ++iJob)
+            {
+                const auto chunkBegin = begin + anBounds[iJob];
+                const auto chunkEnd = begin + anBounds[iJob + 1];
+                for (auto it = chunkBegin; it != chunkEnd; ++it)
+                {
+                    it->hilbertValue = hilbert(it->nodeItem, HILBERT_MAX, minX,
+                                               minY, width, height);
+                }
+                std::sort(chunkBegin, chunkEnd, OGRFlatGeobufFeatureItemLess);
+            }
+        });
+
+    while (anBounds.size() > 2)
+    {
+        const int nMerges = static_cast<int>((anBounds.size() - 1) / 2);
+        CPLJobQueueRunRanges(
+            poJobQueue, nMerges, nMerges,
+            [&](int, int iStart, int iEnd)
+            {
+                for (auto i = iStart; i < iEnd; ++i)
+                {
+                    std::inplace_merge(begin + anBounds[2 * i],
+                                       begin + anBounds[2 * i + 1],
+                                       begin + anBounds[2 * i + 2],
+                                       OGRFlatGeobufFeatureItemLess);
+                }
+            });
+        std::vector<size_t> anNewBounds;
+        for (size_t i = 0; i < anBounds.size(); i += 2)
+            anNewBounds.push_back(anBounds[i]);
+        if (anNewBounds.back() != nItems)
+            anNewBounds.push_back(nItems);
+        anBounds = std::move(anNewBounds);
+    }
+}
+
+/************************************************************************/
+/*                   OGRFlatGeobufComputeParentNodes()                  */
+/************************************************************************/
+
+// Compute the nodes of a level of the packed R-tree, from the nChildren nodes
+// of the level below it, starting at node index firstChildPos, and returned
+// by getChild(i), with i in [0, nChildren[. This is the equivalent of
+// PackedRTree::generateNodes() for one level, distributed over threads.
+template <class GetChild>
+static void OGRFlatGeobufComputeParentNodes(NodeItem *parents,
+                                            uint64_t nParents,
+                                            uint64_t firstChildPos,
+                                            uint64_t nChildren,
+                                            uint16_t nodeSize,
+                                            const GetChild &getChild,
+                                            CPLJobQueue *poJobQueue,
+                                            int nThreads)
+{
+    // Below that number of parent nodes per thread, multi-threading is not
+    // worth it
+    constexpr uint64_t MIN_NODES_PER_JOB = 4096;
+    const int nJobs = static_cast<int>(std::max<uint64_t>(
+        1, std::min<uint64_t>(nThreads, nParents / MIN_NODES_PER_JOB)));
+    CPLJobQueueRunRanges(
+        poJobQueue, nJobs, nParents,
+        [&](int, uint64_t iStart, uint64_t iEnd)
+        {
+            for (auto j = iStart; j < iEnd; ++j)
+            {
+                const uint64_t iFirstChild = j * nodeSize;
+                const uint64_t iEndChild =
+                    std::min<uint64_t>(iFirstChild + nodeSize, nChildren);
+                NodeItem node = NodeItem::create(firstChildPos + iFirstChild);
+                for (auto i = iFirstChild; i < iEndChild; ++i)
+                    node.expand(getChild(i));
+                parents[j] = node;
+            }
+        });
+}
+
+/************************************************************************/
+/*                      OGRFlatGeobufWriteNodes()                       */
+/************************************************************************/
+
+static bool OGRFlatGeobufWriteNodes(VSILFILE *fp, const NodeItem *nodes,
+                                    size_t nCount, size_t &c)
+{
+#if CPL_IS_LSB
+    const size_t nWritten = VSIFWriteL(nodes, sizeof(NodeItem), nCount, fp);
+#else
+    std::vector<NodeItem> tmpNodes(nodes, nodes + nCount);
+    for (auto &node : tmpNodes)
+    {
+        CPL_LSBPTR64(&node.minX);
+        CPL_LSBPTR64(&node.minY);
+        CPL_LSBPTR64(&node.maxX);
+        CPL_LSBPTR64(&node.maxY);
+        CPL_LSBPTR64(&node.offset);
+    }
+    const size_t nWritten =
+        VSIFWriteL(tmpNodes.data(), sizeof(NodeItem), nCount, fp);
+#endif
+    c += nWritten * sizeof(NodeItem);
+    return nWritten == nCount;
+}
+
+/************************************************************************/
+/*                       OGRFlatGeobufItemReader                        */
+/************************************************************************/
+
+namespace
+{
+// Sequential reader of the feature items of a temporary file
+class OGRFlatGeobufItemReader
+{
+    VSILFILE *m_fp;
+    vsi_l_offset m_nOffset;
+    uint64_t m_nRemaining;
+    size_t m_nBufferSize;
+    std::vector<FeatureItem> m_buffer{};
+    size_t m_iPos = 0;
+    bool m_bError = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRFlatGeobufItemReader)
+
+  public:
+    OGRFlatGeobufItemReader(VSILFILE *fp, uint64_t nFirstItem, uint64_t nCount,
+                            size_t nBufferSize)
+        : m_fp(fp), m_nOffset(nFirstItem * sizeof(FeatureItem)),
+          m_nRemaining(nCount), m_nBufferSize(nBufferSize)
+    {
+    }
+
+    // Return the next item, or nullptr at the end or in case of error
+    const FeatureItem *Next()
+    {
+        if (m_iPos == m_buffer.size())
+        {
+            if (m_nRemaining == 0)
+                return nullptr;
+            const size_t nToRead = static_cast<size_t>(
+                std::min<uint64_t>(m_nBufferSize, m_nRemaining));
+            m_buffer.resize(nToRead);
+            if (VSIFSeekL(m_fp, m_nOffset, SEEK_SET) != 0 ||
+                VSIFReadL(m_buffer.data(), sizeof(FeatureItem), nToRead,
+                          m_fp) != nToRead)
+            {
+                CPLErrorIO("reading temp feature items");
+                m_bError = true;
+                m_nRemaining = 0;
+                m_buffer.clear();
+                return nullptr;
+            }
+            m_nOffset +=
+                static_cast<vsi_l_offset>(nToRead) * sizeof(FeatureItem);
+            m_nRemaining -= nToRead;
+            m_iPos = 0;
+        }
+        return &m_buffer[m_iPos++];
+    }
+
+    bool HasError() const
+    {
+        return m_bError;
+    }
+};
+}  // namespace
+
 static bool SupportsSeekWhileWriting(const std::string &osFilename)
 {
     return (!STARTS_WITH(osFilename.c_str(), "/vsi")) ||
@@ -605,141 +851,166 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
         return false;
     }
 
-    NodeItem extent = calcExtent(m_featureItems);
+    if (m_poFpItems && !m_featureItems.empty() && !SpillFeatureItems())
+        return false;
+
+    NodeItem extent =
+        m_poFpItems ? m_spilledItemsExtent : calcExtent(m_featureItems);
     auto extentVector = extent.toVector();
 
     writeHeader(m_poFp, m_featuresCount, &extentVector);
 
-    CPLDebugOnly("FlatGeobuf", "Sorting items for Packed R-tree");
-    hilbertSort(m_featureItems);
-    CPLDebugOnly("FlatGeobuf", "Calc new feature offsets");
-    uint64_t featureOffset = 0;
-    for (auto &item : m_featureItems)
+    const int nThreads = OGRFlatGeobufGetNumThreads();
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
     {
-        item.nodeItem.offset = featureOffset;
-        featureOffset += item.size;
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
     }
-    CPLDebugOnly("FlatGeobuf", "Creating Packed R-tree");
-    c = 0;
+
+    // Only the nodes above the leaves of the Packed R-tree are kept in memory.
+    // The leaves are written from the sorted feature items.
+    std::vector<std::pair<uint64_t, uint64_t>> levelBounds;
+    std::vector<NodeItem> upperNodes;
     try
     {
-        const auto fillNodeItems = [this](NodeItem *dest)
-        {
-            size_t i = 0;
-            for (const auto &featureItem : m_featureItems)
-            {
-                dest[i] = featureItem.nodeItem;
-                ++i;
-            }
-        };
-        PackedRTree tree(fillNodeItems, m_featureItems.size(), extent);
-        CPLDebugOnly("FlatGeobuf", "PackedRTree extent %f, %f, %f, %f",
-                     extentVector[0], extentVector[1], extentVector[2],
-                     extentVector[3]);
-        tree.streamWrite([this, &c](uint8_t *data, size_t size)
-                         { c += VSIFWriteL(data, 1, size, m_poFp); });
+        levelBounds =
+            PackedRTree::generateLevelBounds(m_featuresCount, m_indexNodeSize);
+        upperNodes.resize(static_cast<size_t>(levelBounds.front().first));
     }
     catch (const std::exception &e)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Create: %s", e.what());
         return false;
     }
-    CPLDebugOnly("FlatGeobuf", "Wrote tree (%lu bytes)",
-                 static_cast<long unsigned int>(c));
-    m_writeOffset += c;
-
-    CPLDebugOnly("FlatGeobuf", "Writing feature buffers at offset %lu",
-                 static_cast<long unsigned int>(m_writeOffset));
 
-    c = 0;
-
-    // For temporary files not in memory, we use a batch strategy to write the
-    // final file. That is to say we try to separate reads in the source
-    // temporary file and writes in the target file as much as possible, and by
-    // reading source features in increasing offset within a batch.
-    const bool bUseBatchStrategy =
-        !STARTS_WITH(m_osTempFile.c_str(), "/vsimem/");
-    if (bUseBatchStrategy)
-    {
-        const uint32_t nMaxBufferSize = std::max(
-            m_maxFeatureSize,
-            static_cast<uint32_t>(std::min(
-                static_cast<uint64_t>(100 * 1024 * 1024), nTempFileSize)));
-        if (ensureFeatureBuf(nMaxBufferSize) != OGRERR_NONE)
-            return false;
-        uint32_t offsetInBuffer = 0;
-
-        struct BatchItem
+    if (m_poFpItems == nullptr)
+    {
+        CPLDebugOnly("FlatGeobuf", "Sorting items for Packed R-tree");
+        OGRFlatGeobufHilbertSort(m_featureItems.begin(), m_featureItems.end(),
+                                 extent, poJobQueue.get(), nThreads);
+        CPLDebugOnly("FlatGeobuf", "Calc new feature offsets");
+        uint64_t featureOffset = 0;
+        for (auto &item : m_featureItems)
         {
-            size_t featureIdx;  // index of m_featureItems[]
-            uint32_t offsetInBuffer;
-        };
+            item.nodeItem.offset = featureOffset;
+            featureOffset += item.size;
+        }
+        CPLDebugOnly("FlatGeobuf", "Creating Packed R-tree");
+        OGRFlatGeobufComputeParentNodes(
+            upperNodes.data() + levelBounds[1].first,
+            levelBounds[1].second - levelBounds[1].first, levelBounds[0].first,
+            m_featuresCount, m_indexNodeSize,
+            [this](uint64_t i) -> const NodeItem &
+            { return m_featureItems[static_cast<size_t>(i)].nodeItem; },
+            poJobQueue.get(), nThreads);
+    }
+    else
+    {
+        if (!MergeSortSpilledItems(poJobQueue.get(), nThreads, extent,
+                                   levelBounds, upperNodes))
+            return false;
+        CPLDebugOnly("FlatGeobuf", "Creating Packed R-tree");
+    }
+    for (size_t i = 2; i < levelBounds.size(); ++i)
+    {
+        const NodeItem *children = upperNodes.data() + levelBounds[i - 1].first;
+        OGRFlatGeobufComputeParentNodes(
+            upperNodes.data() + levelBounds[i].first,
+            levelBounds[i].second - levelBounds[i].first,
+            levelBounds[i - 1].first,
+            levelBounds[i - 1].second - levelBounds[i - 1].first,
+            m_indexNodeSize, [children](uint64_t j) -> const NodeItem &
+            { return children[j]; }, poJobQueue.get(), nThreads);
+    }
+    CPLDebugOnly("FlatGeobuf", "PackedRTree extent %f, %f, %f, %f",
+                 extentVector[0], extentVector[1], extentVector[2],
+                 extentVector[3]);
 
-        std::vector<BatchItem> batch;
+    c = 0;
+    if (!OGRFlatGeobufWriteNodes(m_poFp, upperNodes.data(), upperNodes.size(),
+                                 c))
+    {
+        CPLErrorIO("writing spatial index");
+        return false;
+    }
+    upperNodes = std::vector<NodeItem>();
 
-        const auto flushBatch = [this, &batch, &offsetInBuffer]()
+    // Items sorted by the external merge sort are located after the runs
+    // in the temporary items file
+    constexpr size_t ITEM_BUFFER_SIZE = 4096;
+    {
+        std::vector<NodeItem> leaves;
+        leaves.reserve(ITEM_BUFFER_SIZE);
+        const auto flushLeaves = [this, &leaves, &c]()
         {
-            // Sort by increasing source offset
-            std::sort(batch.begin(), batch.end(),
-                      [this](const BatchItem &a, const BatchItem &b)
-                      {
-                          return m_featureItems[a.featureIdx].offset <
-                                 m_featureItems[b.featureIdx].offset;
-                      });
-
-            // Read source features
-            for (const auto &batchItem : batch)
-            {
-                const auto &item = m_featureItems[batchItem.featureIdx];
-                if (VSIFSeekL(m_poFpWrite, item.offset, SEEK_SET) == -1)
-                {
-                    CPLErrorIO("seeking to temp feature location");
-                    return false;
-                }
-                if (VSIFReadL(m_featureBuf + batchItem.offsetInBuffer, 1,
-                              item.size, m_poFpWrite) != item.size)
-                {
-                    CPLErrorIO("reading temp feature");
-                    return false;
-                }
-            }
-
-            // Write target features
-            if (offsetInBuffer > 0 &&
-                VSIFWriteL(m_featureBuf, 1, offsetInBuffer, m_poFp) !=
-                    offsetInBuffer)
+            if (!OGRFlatGeobufWriteNodes(m_poFp, leaves.data(), leaves.size(),
+                                         c))
             {
-                CPLErrorIO("writing feature");
+                CPLErrorIO("writing spatial index");
                 return false;
             }
-
-            batch.clear();
-            offsetInBuffer = 0;
+            leaves.clear();
             return true;
         };
-
-        for (size_t i = 0; i < m_featuresCount; i++)
+        if (m_poFpItems == nullptr)
         {
-            const auto &featureItem = m_featureItems[i];
-            const auto featureSize = featureItem.size;
-
-            if (offsetInBuffer + featureSize > m_featureBufSize)
+            for (const auto &item : m_featureItems)
             {
-                if (!flushBatch())
-                {
+                leaves.push_back(item.nodeItem);
+                if (leaves.size() == ITEM_BUFFER_SIZE && !flushLeaves())
                     return false;
-                }
             }
-
-            BatchItem bachItem;
-            bachItem.offsetInBuffer = offsetInBuffer;
-            bachItem.featureIdx = i;
-            batch.emplace_back(bachItem);
-            offsetInBuffer += featureSize;
-            c += featureSize;
         }
+        else
+        {
+            OGRFlatGeobufItemReader oReader(m_poFpItems, m_nSpilledItems,
+                                            m_nSpilledItems, ITEM_BUFFER_SIZE);
+            while (const FeatureItem *item = oReader.Next())
+            {
+                leaves.push_back(item->nodeItem);
+                if (leaves.size() == ITEM_BUFFER_SIZE && !flushLeaves())
+                    return false;
+            }
+            if (oReader.HasError())
+                return false;
+        }
+        if (!leaves.empty() && !flushLeaves())
+            return false;
+    }
+    CPLDebugOnly("FlatGeobuf", "Wrote tree (%lu bytes)",
+                 static_cast<long unsigned int>(c));
+    m_writeOffset += c;
+
+    CPLDebugOnly("FlatGeobuf", "Writing feature buffers at offset %lu",
+                 static_cast<long unsigned int>(m_writeOffset));
 
-        if (!flushBatch())
+    c = 0;
+
+    if (m_poFpItems)
+    {
+        OGRFlatGeobufItemReader oReader(m_poFpItems, m_nSpilledItems,
+                                        m_nSpilledItems, ITEM_BUFFER_SIZE);
+        if (!WriteSortedFeatures([&oReader]() { return oReader.Next(); },
+                                 nTempFileSize, c) ||
+            oReader.HasError())
+        {
+            return false;
+        }
+    }
+    // For temporary files not in memory, we use a batch strategy to write the
+    // final file.
+    else if (!STARTS_WITH(m_osTempFile.c_str(), "/vsimem/"))
+    {
+        size_t i = 0;
+        if (!WriteSortedFeatures(
+                [this, &i]() -> const FeatureItem *
+                {
+                    return i < m_featureItems.size() ? &m_featureItems[i++]
+                                                     : nullptr;
+                },
+                nTempFileSize, c))
         {
             return false;
         }
@@ -787,6 +1058,293 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
     return true;
 }
 
+/************************************************************************/
+/*                         SpillFeatureItems()                          */
+/************************************************************************/
+
+// Move the feature items in memory to the end of a temporary file, to bound
+// the memory needed to write the spatial index of large layers.
+bool OGRFlatGeobufLayer::SpillFeatureItems()
+{
+    if (m_poFpItems == nullptr)
+    {
+        m_osTempItemsFile = CPLResetExtension(m_osTempFile.c_str(), "items");
+        CPLDebug("FlatGeobuf", "Spilling feature items to %s",
+                 m_osTempItemsFile.c_str());
+        m_poFpItems = VSIFOpenL(m_osTempItemsFile.c_str(), "w+b");
+        if (m_poFpItems == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OpenFailed, "Failed to create %s:\n%s",
+                     m_osTempItemsFile.c_str(), VSIStrerror(errno));
+            return false;
+        }
+        // Unlink it now to avoid stale temporary file if killing the process
+        // (only works on Unix)
+        VSIUnlink(m_osTempItemsFile.c_str());
+    }
+
+    constexpr size_t BUFFER_SIZE = 4096;
+    std::vector<FeatureItem> buffer;
+    buffer.reserve(BUFFER_SIZE);
+    const auto flush = [this, &buffer]()
+    {
+        if (VSIFSeekL(m_poFpItems, m_nSpilledItems * sizeof(FeatureItem),
+                      SEEK_SET) != 0 ||
+            VSIFWriteL(buffer.data(), sizeof(FeatureItem), buffer.size(),
+                       m_poFpItems) != buffer.size())
+        {
+            CPLErrorIO("writing temp feature items");
+            return false;
+        }
+        m_nSpilledItems += buffer.size();
+        buffer.clear();
+        return true;
+    };
+    for (const auto &item : m_featureItems)
+    {
+        m_spilledItemsExtent.expand(item.nodeItem);
+        buffer.push_back(item);
+        if (buffer.size() == BUFFER_SIZE && !flush())
+            return false;
+    }
+    if (!buffer.empty() && !flush())
+        return false;
+    m_featureItems.clear();
+    return true;
+}
+
+/************************************************************************/
+/*                       MergeSortSpilledItems()                        */
+/************************************************************************/
+
+// Sort the spilled feature items with an external merge sort: runs of
+// m_nMaxFeatureItemsInMemory items are sorted in memory and written back in
+// place, and then merged. The merged items, with their offset in the final
+// file, are written after the runs in the temporary file. The level of the
+// spatial index just above the leaves is computed during the merge.
+bool OGRFlatGeobufLayer::MergeSortSpilledItems(
+    CPLJobQueue *poJobQueue, int nThreads, const NodeItem &extent,
+    const std::vector<std::pair<uint64_t, uint64_t>> &levelBounds,
+    std::vector<NodeItem> &upperNodes)
+{
+    const uint64_t nItems = m_nSpilledItems;
+    const size_t nRunSize = m_nMaxFeatureItemsInMemory;
+    const uint64_t nRuns = (nItems + nRunSize - 1) / nRunSize;
+    CPLDebug("FlatGeobuf",
+             "External merge sort of " CPL_FRMT_GUIB
+             " feature items in " CPL_FRMT_GUIB " runs",
+             static_cast<GUIntBig>(nItems), static_cast<GUIntBig>(nRuns));
+
+    try
+    {
+        std::vector<FeatureItem> items;
+        for (uint64_t iRun = 0; iRun < nRuns; ++iRun)
+        {
+            const uint64_t nFirstItem = iRun * nRunSize;
+            const size_t nCount = static_cast<size_t>(
+                std::min<uint64_t>(nRunSize, nItems - nFirstItem));
+            items.resize(nCount);
+            const vsi_l_offset nOffset = nFirstItem * sizeof(FeatureItem);
+            if (VSIFSeekL(m_poFpItems, nOffset, SEEK_SET) != 0 ||
+                VSIFReadL(items.data(), sizeof(FeatureItem), nCount,
+                          m_poFpItems) != nCount)
+            {
+                CPLErrorIO("reading temp feature items");
+                return false;
+            }
+            OGRFlatGeobufHilbertSort(items.begin(), items.end(), extent,
+                                     poJobQueue, nThreads);
+            if (VSIFSeekL(m_poFpItems, nOffset, SEEK_SET) != 0 ||
+                VSIFWriteL(items.data(), sizeof(FeatureItem), nCount,
+                           m_poFpItems) != nCount)
+            {
+                CPLErrorIO("writing temp feature items");
+                return false;
+            }
+        }
+        items = std::vector<FeatureItem>();
+
+        // Share the memory budget between the readers of the runs
+        const size_t nBufferSize = std::max<size_t>(
+            1024, static_cast<size_t>(nRunSize / std::max<uint64_t>(1, nRuns)));
+        std::vector<std::unique_ptr<OGRFlatGeobufItemReader>> apoRuns;
+        std::vector<const FeatureItem *> apCurItems;
+        for (uint64_t iRun = 0; iRun < nRuns; ++iRun)
+        {
+            const uint64_t nFirstItem = iRun * nRunSize;
+            apoRuns.push_back(std::make_unique<OGRFlatGeobufItemReader>(
+                m_poFpItems, nFirstItem,
+                std::min<uint64_t>(nRunSize, nItems - nFirstItem),
+                nBufferSize));
+            apCurItems.push_back(apoRuns.back()->Next());
+            if (apCurItems.back() == nullptr)
+                return false;
+        }
+
+        // Smallest item first
+        const auto cmp = [&apCurItems](size_t a, size_t b)
+        {
+            return OGRFlatGeobufFeatureItemLess(*apCurItems[b],
+                                                *apCurItems[a]);
+        };
+        std::priority_queue<size_t, std::vector<size_t>, decltype(cmp)> oQueue(
+            cmp);
+        for (size_t iRun = 0; iRun < apoRuns.size(); ++iRun)
+            oQueue.push(iRun);
+
+        std::vector<FeatureItem> outBuffer;
+        outBuffer.reserve(nBufferSize);
+        vsi_l_offset nOutOffset = nItems * sizeof(FeatureItem);
+        const auto flush = [this, &outBuffer, &nOutOffset]()
+        {
+            if (VSIFSeekL(m_poFpItems, nOutOffset, SEEK_SET) != 0 ||
+                VSIFWriteL(outBuffer.data(), sizeof(FeatureItem),
+                           outBuffer.size(), m_poFpItems) != outBuffer.size())
+            {
+                CPLErrorIO("writing temp feature items");
+                return false;
+            }
+            nOutOffset += outBuffer.size() * sizeof(FeatureItem);
+            outBuffer.clear();
+            return true;
+        };
+
+        const uint64_t firstLeafPos = levelBounds[0].first;
+        const uint64_t firstParentPos = levelBounds[1].first;
+        uint64_t iLeaf = 0;
+        uint64_t featureOffset = 0;
+        while (!oQueue.empty())
+        {
+            const size_t iRun = oQueue.top();
+            oQueue.pop();
+
+            FeatureItem item = *apCurItems[iRun];
+            item.nodeItem.offset = featureOffset;
+            featureOffset += item.size;
+
+            auto &parent = upperNodes[static_cast<size_t>(
+                firstParentPos + iLeaf / m_indexNodeSize)];
+            if ((iLeaf % m_indexNodeSize) == 0)
+                parent = NodeItem::create(firstLeafPos + iLeaf);
+            parent.expand(item.nodeItem);
+            ++iLeaf;
+
+            outBuffer.push_back(item);
+            if (outBuffer.size() == nBufferSize && !flush())
+                return false;
+
+            apCurItems[iRun] = apoRuns[iRun]->Next();
+            if (apCurItems[iRun])
+                oQueue.push(iRun);
+            else if (apoRuns[iRun]->HasError())
+                return false;
+        }
+        if (!outBuffer.empty() && !flush())
+            return false;
+        CPLAssert(iLeaf == nItems);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "MergeSortSpilledItems: Memory allocation failure");
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                        WriteSortedFeatures()                         */
+/************************************************************************/
+
+// Copy the features from the temporary file to the final file, in the order
+// of the items returned by getNextItem(), until it returns nullptr.
+// We use a batch strategy to write the final file. That is to say we try to
+// separate reads in the source temporary file and writes in the target file
+// as much as possible, and by reading source features in increasing offset
+// within a batch.
+bool OGRFlatGeobufLayer::WriteSortedFeatures(
+    const std::function<const FeatureItem *()> &getNextItem,
+    uint64_t nTempFileSize, size_t &c)
+{
+    const uint32_t nMaxBufferSize = std::max(
+        m_maxFeatureSize,
+        static_cast<uint32_t>(std::min(
+            static_cast<uint64_t>(100 * 1024 * 1024), nTempFileSize)));
+    if (ensureFeatureBuf(nMaxBufferSize) != OGRERR_NONE)
+        return false;
+    uint32_t offsetInBuffer = 0;
+
+    struct BatchItem
+    {
+        uint64_t offset;  // offset in the temporary file
+        uint32_t size;
+        uint32_t offsetInBuffer;
+    };
+
+    std::vector<BatchItem> batch;
+
+    const auto flushBatch = [this, &batch, &offsetInBuffer]()
+    {
+        // Sort by increasing source offset
+        std::sort(batch.begin(), batch.end(),
+                  [](const BatchItem &a, const BatchItem &b)
+                  { return a.offset < b.offset; });
+
+        // Read source features
+        for (const auto &batchItem : batch)
+        {
+            if (VSIFSeekL(m_poFpWrite, batchItem.offset, SEEK_SET) == -1)
+            {
+                CPLErrorIO("seeking to temp feature location");
+                return false;
+            }
+            if (VSIFReadL(m_featureBuf + batchItem.offsetInBuffer, 1,
+                          batchItem.size, m_poFpWrite) != batchItem.size)
+            {
+                CPLErrorIO("reading temp feature");
+                return false;
+            }
+        }
+
+        // Write target features
+        if (offsetInBuffer > 0 &&
+            VSIFWriteL(m_featureBuf, 1, offsetInBuffer, m_poFp) !=
+                offsetInBuffer)
+        {
+            CPLErrorIO("writing feature");
+            return false;
+        }
+
+        batch.clear();
+        offsetInBuffer = 0;
+        return true;
+    };
+
+    while (const FeatureItem *featureItem = getNextItem())
+    {
+        const auto featureSize = featureItem->size;
+
+        if (offsetInBuffer + featureSize > m_featureBufSize)
+        {
+            if (!flushBatch())
+            {
+                return false;
+            }
+        }
+
+        BatchItem bachItem;
+        bachItem.offset = featureItem->offset;
+        bachItem.size = featureSize;
+        bachItem.offsetInBuffer = offsetInBuffer;
+        batch.emplace_back(bachItem);
+        offsetInBuffer += featureSize;
+        c += featureSize;
+    }
+
+    return flushBatch();
+}
+
 OGRFlatGeobufLayer::~OGRFlatGeobufLayer()
 {
     OGRFlatGeobufLayer::Close();
@@ -835,6 +1393,14 @@ CPLErr OGRFlatGeobufLayer::Close()
         m_osTempFile.clear();
     }
 
+    if (m_poFpItems)
+    {
+        VSIFCloseL(m_poFpItems);
+        m_poFpItems = nullptr;
+        VSIUnlink(m_osTempItemsFile.c_str());
+        m_osTempItemsFile.clear();
+    }
+
     return eErr;
 }
 
@@ -958,6 +1524,8 @@ OGRErr OGRFlatGeobufLayer::readIndex()
                          static_cast<long unsigned int>(m_featuresCount));
 
             m_queriedSpatialIndex = true;
+            m_bAdviseRead = !VSIIsLocal(m_osFilename.c_str());
+            m_nextAdviseReadPos = 0;
         }
     }
     catch (const std::exception &e)
@@ -992,6 +1560,21 @@ static inline bool ParseDateTime(const char *pszInput, size_t nLen,
 
 OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
 {
+    return GetNextFeatureInternal(nullptr);
+}
+
+OGRFeature *
+OGRFlatGeobufLayer::IGetNextFeatureReusing(OGRFeature *poFeatureToReuse)
+{
+    return GetNextFeatureInternal(poFeatureToReuse);
+}
+
+OGRFeature *
+OGRFlatGeobufLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+{
+    // Also recycles the features rejected by the filters
+    std::unique_ptr<OGRFeature> poFeature(poFeatureToReuse);
+
     if (m_create)
         return nullptr;
 
@@ -1015,7 +1598,10 @@ OGRFeature *OGRFlatGeobufLayer::GetNextFeature()
             return nullptr;
         }
 
-        auto poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+        if (poFeature)
+            poFeature->Reset();
+        else
+            poFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
         if (parseFeature(poFeature.get()) != OGRERR_NONE)
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -1068,12 +1654,81 @@ OGRErr OGRFlatGeobufLayer::ensureFeatureBuf(uint32_t featureSize)
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                        adviseReadFoundItems()                        */
+/************************************************************************/
+
+// Instead of issuing one read per feature found by the spatial index search,
+// which is inefficient on network file systems, coalesce nearby features into
+// ranges, and prefetch the ranges for the next batch of features.
+void OGRFlatGeobufLayer::adviseReadFoundItems()
+{
+    if (!m_bAdviseRead || m_featuresPos < m_nextAdviseReadPos)
+        return;
+
+    // Maximum number of bytes between two features, below which they are
+    // fetched in the same range
+    constexpr uint64_t MAX_GAP = 16 * 1024;
+    // Default limit of the total number of bytes to fetch at once
+    constexpr uint64_t DEFAULT_TOTAL_BYTES_LIMIT = 100 * 1024 * 1024;
+
+    uint64_t nTotalBytesLimit = m_poFp->GetAdviseReadTotalBytesLimit();
+    if (nTotalBytesLimit == 0)
+        nTotalBytesLimit = DEFAULT_TOTAL_BYTES_LIMIT;
+
+    std::vector<vsi_l_offset> anOffsets;
+    std::vector<size_t> anSizes;
+    uint64_t nTotalBytes = 0;
+    size_t i = m_featuresPos;
+    for (; i < m_foundItems.size(); ++i)
+    {
+        const auto &item = m_foundItems[i];
+        // Unknown size (last feature of the file): read it the regular way
+        if (item.size == 0)
+            break;
+        const uint64_t nStart = m_offsetFeatures + item.offset;
+        const uint64_t nPrevEnd =
+            anOffsets.empty() ? 0 : anOffsets.back() + anSizes.back();
+        const bool bMerge = !anOffsets.empty() && nStart >= nPrevEnd &&
+                            nStart - nPrevEnd <= MAX_GAP;
+        const uint64_t nExtraBytes =
+            bMerge ? nStart + item.size - nPrevEnd : item.size;
+        if (nExtraBytes > nTotalBytesLimit - nTotalBytes)
+            break;
+        nTotalBytes += nExtraBytes;
+        if (bMerge)
+        {
+            anSizes.back() += static_cast<size_t>(nExtraBytes);
+        }
+        else
+        {
+            anOffsets.push_back(nStart);
+            anSizes.push_back(static_cast<size_t>(item.size));
+        }
+    }
+    // Make sure we progress, even if the current item could not be prefetched
+    m_nextAdviseReadPos = std::max(i, m_featuresPos + 1);
+
+    if (anOffsets.size() > 1 ||
+        (anOffsets.size() == 1 && m_nextAdviseReadPos > m_featuresPos + 1))
+    {
+        CPLDebugOnly("FlatGeobuf",
+                     "AdviseRead() on %d ranges for features [%lu, %lu[",
+                     static_cast<int>(anOffsets.size()),
+                     static_cast<long unsigned int>(m_featuresPos),
+                     static_cast<long unsigned int>(m_nextAdviseReadPos));
+        m_poFp->AdviseRead(static_cast<int>(anOffsets.size()),
+                           anOffsets.data(), anSizes.data());
+    }
+}
+
 OGRErr OGRFlatGeobufLayer::parseFeature(OGRFeature *poFeature)
 {
     GIntBig fid;
     auto seek = false;
     if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
     {
+        adviseReadFoundItems();
         const auto item = m_foundItems[m_featuresPos];
         m_offset = m_offsetFeatures + item.offset;
         fid = item.index;
@@ -1453,7 +2108,8 @@ int OGRFlatGeobufLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
 {
     if (!m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty() ||
         CPLTestBool(
-            CPLGetConfigOption("OGR_FLATGEOBUF_STREAM_BASE_IMPL", "NO")))
+            CPLGetConfigOption("OGR_FLATGEOBUF_STREAM_BASE_IMPL", "NO")) ||
+        IsGeoArrowGeometryEncodingRequested())
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
@@ -1513,6 +2169,7 @@ begin:
         auto seek = false;
         if (m_queriedSpatialIndex && !m_ignoreSpatialFilter)
         {
+            adviseReadFoundItems();
             const auto item = m_foundItems[m_featuresPos];
             m_offset = m_offsetFeatures + item.offset;
             fid = item.index;
@@ -2375,6 +3032,11 @@ OGRErr OGRFlatGeobufLayer::ICreateFeature(OGRFeature *poNewFeature)
             item.nodeItem = {psEnvelope.MinX, psEnvelope.MinY, psEnvelope.MaxX,
                              psEnvelope.MaxY, 0};
             m_featureItems.emplace_back(std::move(item));
+            if (m_featureItems.size() >= m_nMaxFeatureItemsInMemory &&
+                !SpillFeatureItems())
+            {
+                return OGRERR_FAILURE;
+            }
         }
         m_writeOffset += c;
 
@@ -2440,6 +3102,8 @@ void OGRFlatGeobufLayer::ResetReading()
     m_foundItems.clear();
     m_featuresCount = m_poHeader ? m_poHeader->features_count() : 0;
     m_queriedSpatialIndex = false;
+    m_bAdviseRead = false;
+    m_nextAdviseReadPos = 0;
     m_ignoreSpatialFilter = false;
     m_ignoreAttributeFilter = false;
     return;
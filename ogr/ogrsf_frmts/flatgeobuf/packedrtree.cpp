@@ -371,7 +371,9 @@ std::vector<SearchResultItem> PackedRTree::streamSearch(
     auto levelBounds = generateLevelBounds(numItems, nodeSize);
     uint64_t leafNodesOffset = levelBounds.front().first;
     uint64_t numNodes = levelBounds.front().second;
-    auto nodeItems = std::vector<NodeItem>(nodeSize);
+    // One extra item to get the offset of the item following the last one of
+    // a leaf node, and thus the size of its feature data
+    auto nodeItems = std::vector<NodeItem>(nodeSize + 1);
     uint8_t *nodesBuf = reinterpret_cast<uint8_t *>(nodeItems.data());
     // use ordered search queue to make index traversal in sequential order
     std::map<uint64_t, uint64_t> queue;
@@ -388,6 +390,9 @@ std::vector<SearchResultItem> PackedRTree::streamSearch(
         uint64_t end = std::min(static_cast<uint64_t>(nodeIndex + nodeSize),
                                 levelBounds[static_cast<size_t>(level)].second);
         uint64_t length = end - nodeIndex;
+        const bool hasNextLeafNode = isLeafNode && end < numNodes;
+        if (hasNextLeafNode)
+            length++;
         readNode(nodesBuf, static_cast<size_t>(nodeIndex * sizeof(NodeItem)),
                  static_cast<size_t>(length * sizeof(NodeItem)));
 #if !CPL_IS_LSB
@@ -408,7 +413,18 @@ std::vector<SearchResultItem> PackedRTree::streamSearch(
             if (!item.intersects(nodeItem))
                 continue;
             if (isLeafNode)
-                results.push_back({nodeItem.offset, pos - leafNodesOffset});
+            {
+                SearchResultItem resultItem{nodeItem.offset,
+                                            pos - leafNodesOffset};
+                if (pos + 1 < end || hasNextLeafNode)
+                {
+                    const auto &nextNodeItem =
+                        nodeItems[static_cast<size_t>(nodePos + 1)];
+                    if (nextNodeItem.offset > nodeItem.offset)
+                        resultItem.size = nextNodeItem.offset - nodeItem.offset;
+                }
+                results.push_back(resultItem);
+            }
             else
                 queue.insert(
                     std::pair<uint64_t, uint64_t>(nodeItem.offset, level - 1));
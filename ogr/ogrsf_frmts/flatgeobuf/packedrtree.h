@@ -80,6 +80,9 @@ struct SearchResultItem
 {
     uint64_t offset;
     uint64_t index;
+    // Size of the feature data, deduced from the offset of the next item.
+    // 0 if unknown (last item, or not computed).
+    uint64_t size = 0;
 };
 
 std::ostream &operator<<(std::ostream &os, NodeItem const &value);
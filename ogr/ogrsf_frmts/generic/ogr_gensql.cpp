@@ -32,9 +32,15 @@
 #include "ogr_gensql.h"
 #include "cpl_string.h"
 #include "ogr_api.h"
+#include "ogr_attrind.h"
 #include "cpl_time.h"
 #include <algorithm>
+#include <cmath>
+#include <functional>
 #include <limits>
+#include <queue>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -54,6 +60,625 @@ class OGRGenSQLGeomFieldDefn final : public OGRGeomFieldDefn
     int bForceGeomType;
 };
 
+/************************************************************************/
+/*                         OGRGenSQLSortedRows                          */
+/*                                                                      */
+/*      Copy of the source features used to return them in ORDER BY     */
+/*      order from layers that cannot efficiently fetch features by     */
+/*      FID. Features are serialized in runs, each one sorted on the    */
+/*      ORDER BY keys. When the current run exceeds the memory budget,  */
+/*      it is sorted and written to a temporary file in a worker        */
+/*      thread, while the main thread keeps reading the source layer.   */
+/*      The sorted output is the merge of the runs, so spilled runs     */
+/*      are only read sequentially.                                     */
+/************************************************************************/
+
+class OGRGenSQLSortedRows
+{
+  public:
+    // Sorts in place a list of row indices (in reading order)
+    using SortFunc = std::function<void(std::vector<size_t> &)>;
+    // Compares the ORDER BY keys of two row indices
+    using CompareFunc = std::function<int(size_t, size_t)>;
+
+    OGRGenSQLSortedRows(OGRFeatureDefn *poSrcDefn, GIntBig nMaxMemory)
+        : m_poSrcDefn(poSrcDefn),
+          m_nMaxMemory(static_cast<size_t>(std::min<GUIntBig>(
+              nMaxMemory, std::numeric_limits<size_t>::max())))
+    {
+    }
+
+    ~OGRGenSQLSortedRows();
+
+    bool AddRow(const OGRFeature *poFeature);
+
+    bool MustSpill() const
+    {
+        return !m_apoRuns.empty() && !m_apoRuns.back()->bSpilled &&
+               m_apoRuns.back()->abyData.size() >= m_nMaxMemory;
+    }
+
+    void GetPendingRun(size_t &nStart, size_t &nCount) const
+    {
+        nStart = m_apoRuns.back()->nStart;
+        nCount = m_apoRuns.back()->nCount;
+    }
+
+    bool SpillRun(SortFunc pfnSort);
+    bool Finish(const SortFunc &pfnSort);
+    void Merge(const CompareFunc &pfnCompare, GIntBig *panIndex);
+    OGRFeature *GetRow(const GIntBig *panIndex, GIntBig nPos);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLSortedRows)
+
+    struct Run
+    {
+        // Index, in reading order, of the first row of the run
+        size_t nStart = 0;
+        size_t nCount = 0;
+        bool bSpilled = false;
+        // Serialized rows in reading order for the in-memory run, or
+        // read-ahead buffer of the temporary file for spilled runs.
+        std::vector<GByte> abyData{};
+        vsi_l_offset nDataOffset = 0;
+        // Offsets of the nCount serialized rows, plus the end offset.
+        // For spilled runs, rows are written in sorted order.
+        std::vector<vsi_l_offset> anOffsets{0};
+        // Rows of the run in sorted order. Only used until Merge()
+        std::vector<size_t> anSortedRows{};
+        // Index of the next row of a spilled run returned by GetRow()
+        size_t nNextRecord = 0;
+    };
+
+    static constexpr size_t READ_AHEAD_SIZE = 256 * 1024;
+
+    OGRFeatureDefn *const m_poSrcDefn;
+    const size_t m_nMaxMemory;
+    std::vector<std::unique_ptr<Run>> m_apoRuns{};
+    std::vector<GByte> m_abyBuffer{};
+
+    std::string m_osTmpFilename{};
+    VSILFILE *m_fpTmp = nullptr;
+    vsi_l_offset m_nTmpFileSize = 0;
+
+    std::thread m_oWorker{};
+    bool m_bWorkerError = false;
+
+    GIntBig m_nNextPos = 0;
+
+    bool JoinWorker();
+    bool WriteRun(Run *poRun, const SortFunc &pfnSort);
+    Run *FindRun(size_t iRow);
+};
+
+/************************************************************************/
+/*                       ~OGRGenSQLSortedRows()                         */
+/************************************************************************/
+
+OGRGenSQLSortedRows::~OGRGenSQLSortedRows()
+{
+    JoinWorker();
+    if (m_fpTmp)
+    {
+        VSIFCloseL(m_fpTmp);
+        VSIUnlink(m_osTmpFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                             JoinWorker()                             */
+/************************************************************************/
+
+bool OGRGenSQLSortedRows::JoinWorker()
+{
+    if (m_oWorker.joinable())
+        m_oWorker.join();
+    return !m_bWorkerError;
+}
+
+/************************************************************************/
+/*                               AddRow()                               */
+/************************************************************************/
+
+bool OGRGenSQLSortedRows::AddRow(const OGRFeature *poFeature)
+{
+    if (m_apoRuns.empty() || m_apoRuns.back()->bSpilled)
+    {
+        auto poRun = std::make_unique<Run>();
+        if (!m_apoRuns.empty())
+            poRun->nStart = m_apoRuns.back()->nStart + m_apoRuns.back()->nCount;
+        m_apoRuns.push_back(std::move(poRun));
+    }
+
+    if (!poFeature->SerializeToBinary(m_abyBuffer))
+        return false;
+
+    Run *poRun = m_apoRuns.back().get();
+    try
+    {
+        poRun->abyData.insert(poRun->abyData.end(), m_abyBuffer.begin(),
+                              m_abyBuffer.end());
+        poRun->anOffsets.push_back(poRun->abyData.size());
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot store feature for ORDER BY: %s", e.what());
+        return false;
+    }
+    poRun->nCount++;
+    return true;
+}
+
+/************************************************************************/
+/*                              SpillRun()                              */
+/*                                                                      */
+/*      Sort the current in-memory run and write it to the temporary   */
+/*      file in a worker thread.                                        */
+/************************************************************************/
+
+bool OGRGenSQLSortedRows::SpillRun(SortFunc pfnSort)
+{
+    if (!JoinWorker())
+        return false;
+
+    if (m_fpTmp == nullptr)
+    {
+        m_osTmpFilename = CPLGenerateTempFilename("ogr_gensql_order_by");
+        m_fpTmp = VSIFOpenL(m_osTmpFilename.c_str(), "wb+");
+        if (m_fpTmp == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     m_osTmpFilename.c_str());
+            return false;
+        }
+    }
+
+    Run *poRun = m_apoRuns.back().get();
+    poRun->bSpilled = true;
+    m_oWorker = std::thread(
+        [this, poRun, pfnSort = std::move(pfnSort)]()
+        { m_bWorkerError = !WriteRun(poRun, pfnSort); });
+    return true;
+}
+
+/************************************************************************/
+/*                              WriteRun()                              */
+/************************************************************************/
+
+bool OGRGenSQLSortedRows::WriteRun(Run *poRun, const SortFunc &pfnSort)
+{
+    poRun->anSortedRows.resize(poRun->nCount);
+    for (size_t i = 0; i < poRun->nCount; ++i)
+        poRun->anSortedRows[i] = poRun->nStart + i;
+    pfnSort(poRun->anSortedRows);
+
+    std::vector<vsi_l_offset> anOffsets;
+    anOffsets.reserve(poRun->nCount + 1);
+    for (const size_t iRow : poRun->anSortedRows)
+    {
+        const size_t i = iRow - poRun->nStart;
+        const size_t nSize =
+            static_cast<size_t>(poRun->anOffsets[i + 1] - poRun->anOffsets[i]);
+        anOffsets.push_back(m_nTmpFileSize);
+        if (VSIFWriteL(poRun->abyData.data() + poRun->anOffsets[i], 1, nSize,
+                       m_fpTmp) != nSize)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                     m_osTmpFilename.c_str());
+            return false;
+        }
+        m_nTmpFileSize += nSize;
+    }
+    anOffsets.push_back(m_nTmpFileSize);
+
+    poRun->anOffsets = std::move(anOffsets);
+    std::vector<GByte>().swap(poRun->abyData);
+    return true;
+}
+
+/************************************************************************/
+/*                               Finish()                               */
+/*                                                                      */
+/*      Wait for the last spilled run, and sort the in-memory run.      */
+/************************************************************************/
+
+bool OGRGenSQLSortedRows::Finish(const SortFunc &pfnSort)
+{
+    if (!JoinWorker())
+        return false;
+
+    if (!m_apoRuns.empty() && !m_apoRuns.back()->bSpilled)
+    {
+        Run *poRun = m_apoRuns.back().get();
+        poRun->anSortedRows.resize(poRun->nCount);
+        for (size_t i = 0; i < poRun->nCount; ++i)
+            poRun->anSortedRows[i] = poRun->nStart + i;
+        pfnSort(poRun->anSortedRows);
+    }
+
+    if (m_fpTmp)
+    {
+        CPLDebug("GenSQL",
+                 "ORDER BY: %d runs written in temporary file "
+                 "(" CPL_FRMT_GUIB " bytes)",
+                 static_cast<int>(m_apoRuns.size()) -
+                     (m_apoRuns.back()->bSpilled ? 0 : 1),
+                 static_cast<GUIntBig>(m_nTmpFileSize));
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Merge()                                */
+/*                                                                      */
+/*      Merge the sorted runs into panIndex.                            */
+/************************************************************************/
+
+void OGRGenSQLSortedRows::Merge(const CompareFunc &pfnCompare,
+                                GIntBig *panIndex)
+{
+    const size_t nRuns = m_apoRuns.size();
+    std::vector<size_t> anPos(nRuns);
+
+    // Ties are resolved by the run index, so that the merge is stable
+    const auto IsAfter = [this, &anPos, &pfnCompare](size_t iRun1, size_t iRun2)
+    {
+        const int nRes =
+            pfnCompare(m_apoRuns[iRun1]->anSortedRows[anPos[iRun1]],
+                       m_apoRuns[iRun2]->anSortedRows[anPos[iRun2]]);
+        return nRes > 0 || (nRes == 0 && iRun1 > iRun2);
+    };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(IsAfter)> oHeads(
+        IsAfter);
+    for (size_t iRun = 0; iRun < nRuns; ++iRun)
+    {
+        if (!m_apoRuns[iRun]->anSortedRows.empty())
+            oHeads.push(iRun);
+    }
+
+    size_t i = 0;
+    while (!oHeads.empty())
+    {
+        const size_t iRun = oHeads.top();
+        oHeads.pop();
+        auto &anSortedRows = m_apoRuns[iRun]->anSortedRows;
+        panIndex[i++] = static_cast<GIntBig>(anSortedRows[anPos[iRun]]);
+        if (++anPos[iRun] < anSortedRows.size())
+            oHeads.push(iRun);
+    }
+
+    for (auto &poRun : m_apoRuns)
+        std::vector<size_t>().swap(poRun->anSortedRows);
+}
+
+/************************************************************************/
+/*                              FindRun()                               */
+/************************************************************************/
+
+OGRGenSQLSortedRows::Run *OGRGenSQLSortedRows::FindRun(size_t iRow)
+{
+    auto oIter = std::upper_bound(
+        m_apoRuns.begin(), m_apoRuns.end(), iRow,
+        [](size_t iRowIn, const std::unique_ptr<Run> &poRun)
+        { return iRowIn < poRun->nStart; });
+    CPLAssert(oIter != m_apoRuns.begin());
+    return (oIter - 1)->get();
+}
+
+/************************************************************************/
+/*                               GetRow()                               */
+/*                                                                      */
+/*      Return the source feature at position nPos of the sorted        */
+/*      index.                                                          */
+/************************************************************************/
+
+OGRFeature *OGRGenSQLSortedRows::GetRow(const GIntBig *panIndex, GIntBig nPos)
+{
+    if (nPos != m_nNextPos)
+    {
+        // Non-sequential access: reposition the spilled runs on the first
+        // of their rows after nPos
+        for (auto &poRun : m_apoRuns)
+            poRun->nNextRecord = 0;
+        for (GIntBig i = 0; i < nPos; ++i)
+        {
+            Run *poRun = FindRun(static_cast<size_t>(panIndex[i]));
+            if (poRun->bSpilled)
+                poRun->nNextRecord++;
+        }
+    }
+    m_nNextPos = nPos + 1;
+
+    const size_t iRow = static_cast<size_t>(panIndex[nPos]);
+    Run *poRun = FindRun(iRow);
+    const size_t iRecord =
+        poRun->bSpilled ? poRun->nNextRecord++ : iRow - poRun->nStart;
+    const vsi_l_offset nOffset = poRun->anOffsets[iRecord];
+    const size_t nSize =
+        static_cast<size_t>(poRun->anOffsets[iRecord + 1] - nOffset);
+
+    if (poRun->bSpilled &&
+        (nOffset < poRun->nDataOffset ||
+         nOffset + nSize > poRun->nDataOffset + poRun->abyData.size()))
+    {
+        const size_t nToRead = static_cast<size_t>(
+            std::min<vsi_l_offset>(poRun->anOffsets.back() - nOffset,
+                                   std::max(nSize, READ_AHEAD_SIZE)));
+        poRun->abyData.resize(nToRead);
+        poRun->nDataOffset = nOffset;
+        if (VSIFSeekL(m_fpTmp, nOffset, SEEK_SET) != 0 ||
+            VSIFReadL(poRun->abyData.data(), 1, nToRead, m_fpTmp) != nToRead)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read %s",
+                     m_osTmpFilename.c_str());
+            poRun->abyData.clear();
+            return nullptr;
+        }
+    }
+
+    auto poFeature = std::make_unique<OGRFeature>(m_poSrcDefn);
+    if (!poFeature->DeserializeFromBinary(
+            poRun->abyData.data() + (nOffset - poRun->nDataOffset), nSize))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot deserialize feature for ORDER BY");
+        return nullptr;
+    }
+    return poFeature.release();
+}
+
+/************************************************************************/
+/*                          OGRGenSQLJoinHash                           */
+/*                                                                      */
+/*      Hash table of the features of a secondary layer, keyed on the   */
+/*      value of its join field, for joins on an equality between a     */
+/*      field of the primary layer and a field of the secondary layer.  */
+/*      The secondary layer is read only once, instead of installing an */
+/*      attribute filter on it for each primary feature.                */
+/************************************************************************/
+
+class OGRGenSQLJoinHash
+{
+  public:
+    static std::unique_ptr<OGRGenSQLJoinHash>
+    Create(const swq_join_def *psJoinInfo, OGRLayer *poSrcLayer,
+           OGRLayer *poJoinLayer);
+
+    bool Build();
+    OGRFeature *GetJoinFeature(const OGRFeature *poSrcFeat) const;
+
+  private:
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    OGRLayer *const m_poJoinLayer;
+    const int m_iSrcField;
+    const int m_iJoinField;
+    const KeyType m_eKeyType;
+    const GIntBig m_nMaxMemory;
+
+    bool m_bBuilt = false;
+    bool m_bValid = false;
+    // Key to offset and size of the serialized feature in m_abyData
+    std::unordered_map<std::string, std::pair<size_t, size_t>> m_oMap{};
+    std::vector<GByte> m_abyData{};
+
+    OGRGenSQLJoinHash(OGRLayer *poJoinLayer, int iSrcField, int iJoinField,
+                      KeyType eKeyType, GIntBig nMaxMemory)
+        : m_poJoinLayer(poJoinLayer), m_iSrcField(iSrcField),
+          m_iJoinField(iJoinField), m_eKeyType(eKeyType),
+          m_nMaxMemory(nMaxMemory)
+    {
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLJoinHash)
+
+    bool GetKey(const OGRFeature *poFeature, int iField,
+                std::string &osKey) const;
+};
+
+/************************************************************************/
+/*                               Create()                               */
+/*                                                                      */
+/*      Return nullptr if the join cannot use a hash table.             */
+/************************************************************************/
+
+std::unique_ptr<OGRGenSQLJoinHash>
+OGRGenSQLJoinHash::Create(const swq_join_def *psJoinInfo,
+                          OGRLayer *poSrcLayer, OGRLayer *poJoinLayer)
+{
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_SQL_JOIN_HASH_MAX_MEMORY", nullptr);
+    const GIntBig nMaxMemory = pszMaxMemory
+                                   ? CPLAtoGIntBig(pszMaxMemory)
+                                   : static_cast<GIntBig>(100) * 1024 * 1024;
+    if (nMaxMemory <= 0 || poJoinLayer == poSrcLayer)
+        return nullptr;
+
+    const swq_expr_node *poExpr = psJoinInfo->poExpr;
+    if (poExpr->eNodeType != SNT_OPERATION || poExpr->nOperation != SWQ_EQ ||
+        poExpr->nSubExprCount != 2 ||
+        poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+        poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+    {
+        return nullptr;
+    }
+
+    const swq_expr_node *poSrcCol = poExpr->papoSubExpr[0];
+    const swq_expr_node *poJoinCol = poExpr->papoSubExpr[1];
+    if (poSrcCol->table_index != 0)
+        std::swap(poSrcCol, poJoinCol);
+    if (poSrcCol->table_index != 0 ||
+        poJoinCol->table_index != psJoinInfo->secondary_table)
+    {
+        return nullptr;
+    }
+
+    const OGRFeatureDefn *poSrcDefn = poSrcLayer->GetLayerDefn();
+    const OGRFeatureDefn *poJoinDefn = poJoinLayer->GetLayerDefn();
+    if (poSrcCol->field_index < 0 ||
+        poSrcCol->field_index >= poSrcDefn->GetFieldCount() ||
+        poJoinCol->field_index < 0 ||
+        poJoinCol->field_index >= poJoinDefn->GetFieldCount())
+    {
+        return nullptr;
+    }
+
+    // Let an attribute index of the secondary layer be used
+    OGRLayerAttrIndex *poAttrIndex = poJoinLayer->GetIndex();
+    if (poAttrIndex && poAttrIndex->GetFieldIndex(poJoinCol->field_index))
+        return nullptr;
+
+    const auto IsInteger = [](OGRFieldType eType)
+    { return eType == OFTInteger || eType == OFTInteger64; };
+    const OGRFieldType eSrcType =
+        poSrcDefn->GetFieldDefn(poSrcCol->field_index)->GetType();
+    const OGRFieldType eJoinType =
+        poJoinDefn->GetFieldDefn(poJoinCol->field_index)->GetType();
+    KeyType eKeyType;
+    if (IsInteger(eSrcType) && IsInteger(eJoinType))
+        eKeyType = KeyType::INTEGER;
+    else if ((IsInteger(eSrcType) || eSrcType == OFTReal) &&
+             (IsInteger(eJoinType) || eJoinType == OFTReal))
+        eKeyType = KeyType::REAL;
+    else if (eSrcType == OFTString && eJoinType == OFTString)
+        eKeyType = KeyType::STRING;
+    else
+        return nullptr;
+
+    return std::unique_ptr<OGRGenSQLJoinHash>(
+        new OGRGenSQLJoinHash(poJoinLayer, poSrcCol->field_index,
+                              poJoinCol->field_index, eKeyType, nMaxMemory));
+}
+
+/************************************************************************/
+/*                               GetKey()                               */
+/*                                                                      */
+/*      Return false for null keys, that never match.                   */
+/************************************************************************/
+
+bool OGRGenSQLJoinHash::GetKey(const OGRFeature *poFeature, int iField,
+                               std::string &osKey) const
+{
+    if (!poFeature->IsFieldSetAndNotNull(iField))
+        return false;
+
+    switch (m_eKeyType)
+    {
+        case KeyType::INTEGER:
+        {
+            const GIntBig nVal = poFeature->GetFieldAsInteger64(iField);
+            osKey.assign(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+            break;
+        }
+
+        case KeyType::REAL:
+        {
+            double dfVal = poFeature->GetFieldAsDouble(iField);
+            if (std::isnan(dfVal))
+                return false;
+            if (dfVal == 0)
+                dfVal = 0;  // -0 == 0
+            osKey.assign(reinterpret_cast<const char *>(&dfVal),
+                         sizeof(dfVal));
+            break;
+        }
+
+        case KeyType::STRING:
+        {
+            // Consistent with the case insensitive = operator of OGR SQL
+            osKey = poFeature->GetFieldAsString(iField);
+            for (char &ch : osKey)
+                ch = static_cast<char>(CPLToupper(ch));
+            break;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/*                                                                      */
+/*      Read the secondary layer, on first call. Return false if the    */
+/*      hash table does not fit in the memory budget.                   */
+/************************************************************************/
+
+bool OGRGenSQLJoinHash::Build()
+{
+    if (m_bBuilt)
+        return m_bValid;
+    m_bBuilt = true;
+
+    m_poJoinLayer->SetAttributeFilter(nullptr);
+    m_poJoinLayer->ResetReading();
+
+    // Approximate overhead of a hash table entry
+    constexpr size_t ENTRY_OVERHEAD = 64;
+    GIntBig nMemory = 0;
+    std::string osKey;
+    std::vector<GByte> abyFeature;
+    for (auto &&poFeature : *m_poJoinLayer)
+    {
+        // Only the first matching feature is joined
+        if (!GetKey(poFeature.get(), m_iJoinField, osKey) ||
+            m_oMap.find(osKey) != m_oMap.end())
+        {
+            continue;
+        }
+        if (!poFeature->SerializeToBinary(abyFeature))
+            return false;
+        nMemory += osKey.size() + abyFeature.size() + ENTRY_OVERHEAD;
+        if (nMemory > m_nMaxMemory)
+        {
+            CPLDebug("GenSQL",
+                     "Join on layer %s: hash table exceeds "
+                     "OGR_SQL_JOIN_HASH_MAX_MEMORY. Falling back to "
+                     "attribute filters",
+                     m_poJoinLayer->GetName());
+            m_oMap.clear();
+            std::vector<GByte>().swap(m_abyData);
+            return false;
+        }
+        m_oMap[osKey] = std::make_pair(m_abyData.size(), abyFeature.size());
+        m_abyData.insert(m_abyData.end(), abyFeature.begin(),
+                         abyFeature.end());
+    }
+    m_poJoinLayer->ResetReading();
+
+    m_bValid = true;
+    return true;
+}
+
+/************************************************************************/
+/*                           GetJoinFeature()                           */
+/************************************************************************/
+
+OGRFeature *
+OGRGenSQLJoinHash::GetJoinFeature(const OGRFeature *poSrcFeat) const
+{
+    std::string osKey;
+    if (!GetKey(poSrcFeat, m_iSrcField, osKey))
+        return nullptr;
+    const auto oIter = m_oMap.find(osKey);
+    if (oIter == m_oMap.end())
+        return nullptr;
+
+    auto poFeature =
+        std::make_unique<OGRFeature>(m_poJoinLayer->GetLayerDefn());
+    if (!poFeature->DeserializeFromBinary(
+            m_abyData.data() + oIter->second.first, oIter->second.second))
+    {
+        return nullptr;
+    }
+    return poFeature.release();
+}
+
 /************************************************************************/
 /*               OGRGenSQLResultsLayerHasSpecialField()                 */
 /************************************************************************/
@@ -480,6 +1105,14 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(GDALDataset *poSrcDSIn,
 
     FindAndSetIgnoredFields();
 
+    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+    {
+        const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+        m_apoJoinHashes.push_back(OGRGenSQLJoinHash::Create(
+            psJoinInfo, poSrcLayer,
+            papoTableLayers[psJoinInfo->secondary_table]));
+    }
+
     if (!m_bForwardWhereToSourceLayer)
         OGRLayer::SetAttributeFilter(m_osInitialWHERE.c_str());
 }
@@ -502,6 +1135,8 @@ OGRGenSQLResultsLayer::~OGRGenSQLResultsLayer()
     /* -------------------------------------------------------------------- */
     /*      Free various datastructures.                                    */
     /* -------------------------------------------------------------------- */
+    m_poSortedRows.reset();
+
     CPLFree(papoTableLayers);
     papoTableLayers = nullptr;
 
@@ -670,7 +1305,7 @@ OGRErr OGRGenSQLResultsLayer::SetNextByIndex(GIntBig nIndex)
     }
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
         psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
-        panFIDIndex != nullptr)
+        psSelectInfo->query_mode == SWQM_GROUP_BY || panFIDIndex != nullptr)
     {
         nNextIndexFID = nIndex + psSelectInfo->offset;
         return OGRERR_NONE;
@@ -741,6 +1376,22 @@ GIntBig OGRGenSQLResultsLayer::GetFeatureCount(int bForce)
 
         nRet = psSelectInfo->column_summary[0].count;
     }
+    else if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        if (!PrepareGroupBy())
+            return 0;
+
+        if (m_poAttrQuery == nullptr)
+            nRet = static_cast<GIntBig>(m_apoGroupFeatures.size());
+        else
+        {
+            for (const auto &poFeature : m_apoGroupFeatures)
+            {
+                if (m_poAttrQuery->Evaluate(poFeature.get()))
+                    nRet++;
+            }
+        }
+    }
     else if (psSelectInfo->query_mode != SWQM_RECORDSET)
         return 1;
     else if (m_poAttrQuery == nullptr && !MustEvaluateSpatialFilterOnGenSQL())
@@ -773,6 +1424,7 @@ int OGRGenSQLResultsLayer::TestCapability(const char *pszCap)
     {
         if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
             psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+            psSelectInfo->query_mode == SWQM_GROUP_BY ||
             panFIDIndex != nullptr)
             return TRUE;
         else
@@ -784,6 +1436,12 @@ int OGRGenSQLResultsLayer::TestCapability(const char *pszCap)
          EQUAL(pszCap, OLCFastGetExtent)))
         return poSrcLayer->TestCapability(pszCap);
 
+    else if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        if (EQUAL(pszCap, OLCFastFeatureCount))
+            return m_bGroupByPrepared && m_poAttrQuery == nullptr;
+    }
+
     else if (psSelectInfo->query_mode != SWQM_RECORDSET)
     {
         if (EQUAL(pszCap, OLCFastFeatureCount))
@@ -830,166 +1488,590 @@ int OGRGenSQLResultsLayer::ContainGeomSpecialField(swq_expr_node *expr)
                 return TRUE;
         }
     }
-    return FALSE;
+    return FALSE;
+}
+
+/************************************************************************/
+/*                           PrepareSummary()                           */
+/************************************************************************/
+
+int OGRGenSQLResultsLayer::PrepareSummary()
+
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+
+    if (poSummaryFeature != nullptr)
+        return TRUE;
+
+    poSummaryFeature = new OGRFeature(poDefn);
+    poSummaryFeature->SetFID(0);
+
+    /* -------------------------------------------------------------------- */
+    /*      Ensure our query parameters are in place on the source          */
+    /*      layer.  And initialize reading.                                 */
+    /* -------------------------------------------------------------------- */
+    ApplyFiltersToSource();
+
+    /* -------------------------------------------------------------------- */
+    /*      Ignore geometry reading if no spatial filter in place and that  */
+    /*      the where clause and no column references OGR_GEOMETRY,         */
+    /*      OGR_GEOM_WKT or OGR_GEOM_AREA special fields.                   */
+    /* -------------------------------------------------------------------- */
+    int bSaveIsGeomIgnored = poSrcLayer->GetLayerDefn()->IsGeometryIgnored();
+    if (!IsGeometryNeededForSummary())
+        poSrcLayer->GetLayerDefn()->SetGeometryIgnored(TRUE);
+
+    /* -------------------------------------------------------------------- */
+    /*      We treat COUNT(*) as a special case, and fill with              */
+    /*      GetFeatureCount().                                            */
+    /* -------------------------------------------------------------------- */
+
+    if (psSelectInfo->result_columns() == 1 &&
+        psSelectInfo->column_defs[0].col_func == SWQCF_COUNT &&
+        psSelectInfo->column_defs[0].field_index < 0)
+    {
+        GIntBig nRes = poSrcLayer->GetFeatureCount(TRUE);
+        poSummaryFeature->SetField(0, nRes);
+
+        if (CPL_INT64_FITS_ON_INT32(nRes))
+        {
+            poDefn->GetFieldDefn(0)->SetType(OFTInteger);
+            delete poSummaryFeature;
+            poSummaryFeature = new OGRFeature(poDefn);
+            poSummaryFeature->SetFID(0);
+            poSummaryFeature->SetField(0, static_cast<int>(nRes));
+        }
+
+        poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
+        return TRUE;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Otherwise, process all source feature through the summary       */
+    /*      building facilities of SWQ.                                     */
+    /* -------------------------------------------------------------------- */
+    OGRFeature *poSrcFeature = nullptr;
+
+    while ((poSrcFeature = poSrcLayer->GetNextFeature()) != nullptr)
+    {
+        const char *pszError = SummarizeFeature(poSrcFeature, nullptr);
+        if (pszError != nullptr)
+        {
+            delete poSrcFeature;
+            delete poSummaryFeature;
+            poSummaryFeature = nullptr;
+
+            poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
+
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
+            return FALSE;
+        }
+
+        delete poSrcFeature;
+    }
+
+    poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
+
+    /* -------------------------------------------------------------------- */
+    /*      Clear away the filters we have installed till a next run through*/
+    /*      the features.                                                   */
+    /* -------------------------------------------------------------------- */
+    ClearFilters();
+
+    /* -------------------------------------------------------------------- */
+    /*      Now apply the values to the summary feature.  If we are in      */
+    /*      DISTINCT_LIST mode we don't do this step.                       */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD)
+    {
+        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+        {
+            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+            if (!psSelectInfo->column_summary.empty())
+            {
+                const swq_summary &oSummary =
+                    psSelectInfo->column_summary[iField];
+                if (psColDef->col_func == SWQCF_COUNT)
+                {
+                    if (CPL_INT64_FITS_ON_INT32(oSummary.count))
+                    {
+                        delete poSummaryFeature;
+                        poSummaryFeature = nullptr;
+                        poDefn->GetFieldDefn(iField)->SetType(OFTInteger);
+                    }
+                }
+            }
+        }
+
+        if (poSummaryFeature == nullptr)
+        {
+            poSummaryFeature = new OGRFeature(poDefn);
+            poSummaryFeature->SetFID(0);
+        }
+
+        SetSummaryFields(poSummaryFeature, psSelectInfo->column_summary);
+    }
+
+    return TRUE;
+}
+
+/************************************************************************/
+/*                          SummarizeFeature()                          */
+/*                                                                      */
+/*      Accumulate the values of a source feature in the column         */
+/*      summaries of the select, or in the summaries of a group of a    */
+/*      GROUP BY query if paoGroupSummary is not null.                  */
+/************************************************************************/
+
+const char *OGRGenSQLResultsLayer::SummarizeFeature(
+    OGRFeature *poSrcFeature, std::vector<swq_summary> *paoGroupSummary)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+
+    const auto Summarize = [psSelectInfo, paoGroupSummary](int iField,
+                                                           const char *pszVal)
+    {
+        return paoGroupSummary
+                   ? swq_select_summarize_group(psSelectInfo, *paoGroupSummary,
+                                                iField, pszVal)
+                   : swq_select_summarize(psSelectInfo, iField, pszVal);
+    };
+
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        if (paoGroupSummary != nullptr && psColDef->col_func == SWQCF_NONE)
+            continue;
+
+        const char *pszError = nullptr;
+
+        if (psColDef->col_func == SWQCF_COUNT)
+        {
+            /* psColDef->field_index can be -1 in the case of a COUNT(*) */
+            if (psColDef->field_index < 0)
+                pszError = Summarize(iField, "");
+            else if (IS_GEOM_FIELD_INDEX(poSrcLayer->GetLayerDefn(),
+                                         psColDef->field_index))
+            {
+                int iSrcGeomField = ALL_FIELD_INDEX_TO_GEOM_FIELD_INDEX(
+                    poSrcLayer->GetLayerDefn(), psColDef->field_index);
+                OGRGeometry *poGeom =
+                    poSrcFeature->GetGeomFieldRef(iSrcGeomField);
+                if (poGeom != nullptr)
+                    pszError = Summarize(iField, "");
+                else
+                    pszError = nullptr;
+            }
+            else if (poSrcFeature->IsFieldSetAndNotNull(psColDef->field_index))
+                pszError = Summarize(
+                    iField,
+                    poSrcFeature->GetFieldAsString(psColDef->field_index));
+            else
+                pszError = nullptr;
+        }
+        else
+        {
+            const char *pszVal = nullptr;
+            if (poSrcFeature->IsFieldSetAndNotNull(psColDef->field_index))
+                pszVal = poSrcFeature->GetFieldAsString(psColDef->field_index);
+            pszError = Summarize(iField, pszVal);
+        }
+
+        if (pszError != nullptr)
+            return pszError;
+    }
+
+    return nullptr;
+}
+
+/************************************************************************/
+/*                          SetSummaryFields()                          */
+/*                                                                      */
+/*      Set the aggregated columns of a feature from summaries.         */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::SetSummaryFields(
+    OGRFeature *poDstFeature, const std::vector<swq_summary> &aoSummary)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        if (!aoSummary.empty())
+        {
+            const swq_summary &oSummary = aoSummary[iField];
+
+            if (psColDef->col_func == SWQCF_AVG && oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP)
+                {
+                    struct tm brokendowntime;
+                    double dfAvg = oSummary.sum / oSummary.count;
+                    CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
+                                        &brokendowntime);
+                    poDstFeature->SetField(
+                        iField, brokendowntime.tm_year + 1900,
+                        brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
+                        brokendowntime.tm_hour, brokendowntime.tm_min,
+                        static_cast<float>(brokendowntime.tm_sec +
+                                           fmod(dfAvg, 1)),
+                        0);
+                }
+                else
+                    poDstFeature->SetField(iField,
+                                           oSummary.sum / oSummary.count);
+            }
+            else if (psColDef->col_func == SWQCF_MIN && oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP ||
+                    psColDef->field_type == SWQ_STRING)
+                    poDstFeature->SetField(iField, oSummary.osMin.c_str());
+                else
+                    poDstFeature->SetField(iField, oSummary.min);
+            }
+            else if (psColDef->col_func == SWQCF_MAX && oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP ||
+                    psColDef->field_type == SWQ_STRING)
+                    poDstFeature->SetField(iField, oSummary.osMax.c_str());
+                else
+                    poDstFeature->SetField(iField, oSummary.max);
+            }
+            else if (psColDef->col_func == SWQCF_COUNT)
+                poDstFeature->SetField(iField, oSummary.count);
+            else if (psColDef->col_func == SWQCF_SUM && oSummary.count > 0)
+                poDstFeature->SetField(iField, oSummary.sum);
+        }
+        else if (psColDef->col_func == SWQCF_COUNT)
+            poDstFeature->SetField(iField, 0);
+    }
+}
+
+/************************************************************************/
+/*                     IsGeometryNeededForSummary()                     */
+/*                                                                      */
+/*      Whether the geometry must be read from the source features to  */
+/*      compute a summary, that is if a spatial filter is in place or   */
+/*      the where clause, a column or a GROUP BY field references the   */
+/*      geometry or the OGR_GEOMETRY, OGR_GEOM_WKT or OGR_GEOM_AREA     */
+/*      special fields.                                                 */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::IsGeometryNeededForSummary()
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+
+    if (m_poFilterGeom != nullptr ||
+        (psSelectInfo->where_expr != nullptr &&
+         ContainGeomSpecialField(psSelectInfo->where_expr)))
+    {
+        return true;
+    }
+
+    OGRFeatureDefn *poLayerDefn = papoTableLayers[0]->GetLayerDefn();
+    const auto IsGeomField = [poLayerDefn](int nFieldIndex)
+    {
+        const int nSpecialFieldIdx = nFieldIndex - poLayerDefn->GetFieldCount();
+        return nSpecialFieldIdx == SPF_OGR_GEOMETRY ||
+               nSpecialFieldIdx == SPF_OGR_GEOM_WKT ||
+               nSpecialFieldIdx == SPF_OGR_GEOM_AREA ||
+               nFieldIndex ==
+                   GEOM_FIELD_INDEX_TO_ALL_FIELD_INDEX(poLayerDefn, 0);
+    };
+
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+        if (psColDef->table_index == 0 && psColDef->field_index != -1 &&
+            IsGeomField(psColDef->field_index))
+        {
+            return true;
+        }
+        if (psColDef->expr != nullptr &&
+            ContainGeomSpecialField(psColDef->expr))
+        {
+            return true;
+        }
+    }
+
+    for (const auto &oGroupByDef : psSelectInfo->group_by_defs)
+    {
+        if (IsGeomField(oGroupByDef.field_index))
+            return true;
+    }
+
+    return false;
 }
 
 /************************************************************************/
-/*                           PrepareSummary()                           */
+/*                           PrepareGroupBy()                           */
+/*                                                                      */
+/*      Compute the result of a GROUP BY query in a single pass over    */
+/*      the source layer. The groups are found through a hash table     */
+/*      keyed by the values of the GROUP BY fields, and hold the        */
+/*      running summaries of the aggregated columns, so only one entry  */
+/*      per group, and not per source feature, is kept in memory.       */
 /************************************************************************/
 
-int OGRGenSQLResultsLayer::PrepareSummary()
+bool OGRGenSQLResultsLayer::PrepareGroupBy()
 
 {
+    if (m_bGroupByPrepared)
+        return true;
+
     swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
 
-    if (poSummaryFeature != nullptr)
-        return TRUE;
+    if (poDefn->GetGeomFieldCount() > 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Geometry columns are not supported in a GROUP BY query");
+        return false;
+    }
 
-    poSummaryFeature = new OGRFeature(poDefn);
-    poSummaryFeature->SetFID(0);
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_SQL_GROUP_BY_MAX_MEMORY", nullptr);
+    const GIntBig nMaxMemory = pszMaxMemory
+                                   ? CPLAtoGIntBig(pszMaxMemory)
+                                   : static_cast<GIntBig>(1024) * 1024 * 1024;
 
     /* -------------------------------------------------------------------- */
-    /*      Ensure our query parameters are in place on the source          */
-    /*      layer.  And initialize reading.                                 */
+    /*      Type of the values of the GROUP BY fields in the group keys.    */
     /* -------------------------------------------------------------------- */
-    ApplyFiltersToSource();
+    OGRFeatureDefn *poSrcDefn = poSrcLayer->GetLayerDefn();
+    std::vector<std::pair<int, OGRFieldType>> aoGroupByFields;
+    for (const auto &oGroupByDef : psSelectInfo->group_by_defs)
+    {
+        OGRFieldType eType = OFTString;
+        if (oGroupByDef.field_index >= iFIDFieldIndex)
+        {
+            CPLAssert(oGroupByDef.field_index <
+                      iFIDFieldIndex + SPECIAL_FIELD_COUNT);
+            switch (
+                SpecialFieldTypes[oGroupByDef.field_index - iFIDFieldIndex])
+            {
+                case SWQ_INTEGER:
+                case SWQ_INTEGER64:
+                    eType = OFTInteger64;
+                    break;
+                case SWQ_FLOAT:
+                    eType = OFTReal;
+                    break;
+                default:
+                    break;
+            }
+        }
+        else
+        {
+            eType =
+                poSrcDefn->GetFieldDefn(oGroupByDef.field_index)->GetType();
+        }
+        aoGroupByFields.emplace_back(oGroupByDef.field_index, eType);
+    }
+
+    const auto AppendKey = [&aoGroupByFields, this](OGRFeature *poSrcFeature,
+                                                    std::string &osKey)
+    {
+        osKey.clear();
+        for (const auto &oField : aoGroupByFields)
+        {
+            const int iField = oField.first;
+            if (iField < iFIDFieldIndex &&
+                !poSrcFeature->IsFieldSetAndNotNull(iField))
+            {
+                osKey += 'N';
+                continue;
+            }
+            osKey += 'V';
+            if (oField.second == OFTInteger || oField.second == OFTInteger64)
+            {
+                const GIntBig nVal = poSrcFeature->GetFieldAsInteger64(iField);
+                osKey.append(reinterpret_cast<const char *>(&nVal),
+                             sizeof(nVal));
+            }
+            else if (oField.second == OFTReal)
+            {
+                double dfVal = poSrcFeature->GetFieldAsDouble(iField);
+                if (dfVal == 0)
+                    dfVal = 0;  // normalize negative zero
+                osKey.append(reinterpret_cast<const char *>(&dfVal),
+                             sizeof(dfVal));
+            }
+            else
+            {
+                osKey += poSrcFeature->GetFieldAsString(iField);
+                osKey += '\0';
+            }
+        }
+    };
 
     /* -------------------------------------------------------------------- */
-    /*      Ignore geometry reading if no spatial filter in place and that  */
-    /*      the where clause and no column references OGR_GEOMETRY,         */
-    /*      OGR_GEOM_WKT or OGR_GEOM_AREA special fields.                   */
+    /*      Set the non-aggregated columns of the feature of a new group    */
+    /*      from the first source feature of the group.                     */
     /* -------------------------------------------------------------------- */
-    int bSaveIsGeomIgnored = poSrcLayer->GetLayerDefn()->IsGeometryIgnored();
-    if (m_poFilterGeom == nullptr &&
-        (psSelectInfo->where_expr == nullptr ||
-         !ContainGeomSpecialField(psSelectInfo->where_expr)))
+    const auto SetGroupByFields = [psSelectInfo, this](OGRFeature *poSrcFeature,
+                                                       OGRFeature *poDstFeature)
     {
-        int bFoundGeomExpr = FALSE;
         for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
         {
-            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
-            if (psColDef->table_index == 0 && psColDef->field_index != -1)
+            const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+            if (psColDef->col_func != SWQCF_NONE)
+                continue;
+
+            const int iSrcField = psColDef->field_index;
+            if (iSrcField >= iFIDFieldIndex)
             {
-                OGRLayer *poLayer = papoTableLayers[psColDef->table_index];
-                int nSpecialFieldIdx = psColDef->field_index -
-                                       poLayer->GetLayerDefn()->GetFieldCount();
-                if (nSpecialFieldIdx == SPF_OGR_GEOMETRY ||
-                    nSpecialFieldIdx == SPF_OGR_GEOM_WKT ||
-                    nSpecialFieldIdx == SPF_OGR_GEOM_AREA)
-                {
-                    bFoundGeomExpr = TRUE;
-                    break;
-                }
-                if (psColDef->field_index ==
-                    GEOM_FIELD_INDEX_TO_ALL_FIELD_INDEX(poLayer->GetLayerDefn(),
-                                                        0))
+                switch (SpecialFieldTypes[iSrcField - iFIDFieldIndex])
                 {
-                    bFoundGeomExpr = TRUE;
-                    break;
+                    case SWQ_INTEGER:
+                    case SWQ_INTEGER64:
+                        poDstFeature->SetField(
+                            iField,
+                            poSrcFeature->GetFieldAsInteger64(iSrcField));
+                        break;
+                    case SWQ_FLOAT:
+                        poDstFeature->SetField(
+                            iField, poSrcFeature->GetFieldAsDouble(iSrcField));
+                        break;
+                    default:
+                        poDstFeature->SetField(
+                            iField, poSrcFeature->GetFieldAsString(iSrcField));
+                        break;
                 }
             }
-            if (psColDef->expr != nullptr &&
-                ContainGeomSpecialField(psColDef->expr))
+            else if (poDstFeature->GetFieldDefnRef(iField)->GetType() ==
+                     poSrcFeature->GetFieldDefnRef(iSrcField)->GetType())
             {
-                bFoundGeomExpr = TRUE;
-                break;
+                poDstFeature->SetField(iField,
+                                       poSrcFeature->GetRawFieldRef(iSrcField));
+            }
+            else if (poSrcFeature->IsFieldSetAndNotNull(iSrcField))
+            {
+                poDstFeature->SetField(
+                    iField, poSrcFeature->GetFieldAsString(iSrcField));
+            }
+            else
+            {
+                poDstFeature->SetFieldNull(iField);
             }
         }
-        if (!bFoundGeomExpr)
-            poSrcLayer->GetLayerDefn()->SetGeometryIgnored(TRUE);
-    }
+    };
 
     /* -------------------------------------------------------------------- */
-    /*      We treat COUNT(*) as a special case, and fill with              */
-    /*      GetFeatureCount().                                            */
+    /*      Ensure our query parameters are in place on the source          */
+    /*      layer.  And initialize reading.                                 */
     /* -------------------------------------------------------------------- */
+    ApplyFiltersToSource();
 
-    if (psSelectInfo->result_columns() == 1 &&
-        psSelectInfo->column_defs[0].col_func == SWQCF_COUNT &&
-        psSelectInfo->column_defs[0].field_index < 0)
-    {
-        GIntBig nRes = poSrcLayer->GetFeatureCount(TRUE);
-        poSummaryFeature->SetField(0, nRes);
-
-        if (CPL_INT64_FITS_ON_INT32(nRes))
-        {
-            poDefn->GetFieldDefn(0)->SetType(OFTInteger);
-            delete poSummaryFeature;
-            poSummaryFeature = new OGRFeature(poDefn);
-            poSummaryFeature->SetFID(0);
-            poSummaryFeature->SetField(0, static_cast<int>(nRes));
-        }
-
-        poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
-        return TRUE;
-    }
+    int bSaveIsGeomIgnored = poSrcDefn->IsGeometryIgnored();
+    if (!IsGeometryNeededForSummary())
+        poSrcDefn->SetGeometryIgnored(TRUE);
 
     /* -------------------------------------------------------------------- */
-    /*      Otherwise, process all source feature through the summary       */
-    /*      building facilities of SWQ.                                     */
+    /*      Process all source features, and aggregate them in their        */
+    /*      group.                                                          */
     /* -------------------------------------------------------------------- */
-    const char *pszError = nullptr;
-    OGRFeature *poSrcFeature = nullptr;
+    const int nOrderItems = psSelectInfo->order_specs;
+    const size_t nColumns =
+        static_cast<size_t>(psSelectInfo->result_columns());
+    std::unordered_map<std::string, size_t> oMapKeyToGroup;
+    std::vector<std::unique_ptr<OGRFeature>> apoGroupFeatures;
+    std::vector<std::vector<swq_summary>> aaoGroupSummaries;
+    std::vector<OGRField> asIndexFields;
+    GIntBig nMemoryUsed = 0;
+    std::string osKey;
+    bool bOK = true;
 
-    while ((poSrcFeature = poSrcLayer->GetNextFeature()) != nullptr)
+    const auto GetDistinctCount =
+        [psSelectInfo](const std::vector<swq_summary> &aoSummary)
     {
-        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+        GIntBig nCount = 0;
+        for (size_t i = 0; i < aoSummary.size(); ++i)
         {
-            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+            if (psSelectInfo->column_defs[i].distinct_flag)
+                nCount += aoSummary[i].count;
+        }
+        return nCount;
+    };
 
-            if (psColDef->col_func == SWQCF_COUNT)
+    try
+    {
+        while (bOK)
+        {
+            auto poSrcFeature =
+                std::unique_ptr<OGRFeature>(poSrcLayer->GetNextFeature());
+            if (!poSrcFeature)
+                break;
+
+            AppendKey(poSrcFeature.get(), osKey);
+            size_t iGroup;
+            const auto oIter = oMapKeyToGroup.find(osKey);
+            if (oIter == oMapKeyToGroup.end())
             {
-                /* psColDef->field_index can be -1 in the case of a COUNT(*) */
-                if (psColDef->field_index < 0)
-                    pszError = swq_select_summarize(psSelectInfo, iField, "");
-                else if (IS_GEOM_FIELD_INDEX(poSrcLayer->GetLayerDefn(),
-                                             psColDef->field_index))
+                iGroup = apoGroupFeatures.size();
+                oMapKeyToGroup[osKey] = iGroup;
+
+                auto poDstFeature = std::make_unique<OGRFeature>(poDefn);
+                SetGroupByFields(poSrcFeature.get(), poDstFeature.get());
+                apoGroupFeatures.push_back(std::move(poDstFeature));
+                aaoGroupSummaries.emplace_back();
+
+                if (nOrderItems > 0)
                 {
-                    int iSrcGeomField = ALL_FIELD_INDEX_TO_GEOM_FIELD_INDEX(
-                        poSrcLayer->GetLayerDefn(), psColDef->field_index);
-                    OGRGeometry *poGeom =
-                        poSrcFeature->GetGeomFieldRef(iSrcGeomField);
-                    if (poGeom != nullptr)
-                        pszError =
-                            swq_select_summarize(psSelectInfo, iField, "");
-                    else
-                        pszError = nullptr;
+                    asIndexFields.resize(asIndexFields.size() + nOrderItems);
+                    ReadIndexFields(poSrcFeature.get(), nOrderItems,
+                                    asIndexFields.data() +
+                                        iGroup * nOrderItems);
                 }
-                else if (poSrcFeature->IsFieldSetAndNotNull(
-                             psColDef->field_index))
-                    pszError = swq_select_summarize(
-                        psSelectInfo, iField,
-                        poSrcFeature->GetFieldAsString(psColDef->field_index));
-                else
-                    pszError = nullptr;
+
+                // Rough estimate of the memory used by the group
+                nMemoryUsed +=
+                    2 * osKey.size() + 64 +
+                    nColumns * (sizeof(OGRField) + sizeof(swq_summary)) +
+                    nOrderItems * sizeof(OGRField);
             }
             else
             {
-                const char *pszVal = nullptr;
-                if (poSrcFeature->IsFieldSetAndNotNull(psColDef->field_index))
-                    pszVal =
-                        poSrcFeature->GetFieldAsString(psColDef->field_index);
-                pszError = swq_select_summarize(psSelectInfo, iField, pszVal);
+                iGroup = oIter->second;
             }
 
+            auto &aoSummary = aaoGroupSummaries[iGroup];
+            const GIntBig nDistinctCountBefore = GetDistinctCount(aoSummary);
+            const char *pszError =
+                SummarizeFeature(poSrcFeature.get(), &aoSummary);
             if (pszError != nullptr)
             {
-                delete poSrcFeature;
-                delete poSummaryFeature;
-                poSummaryFeature = nullptr;
-
-                poSrcLayer->GetLayerDefn()->SetGeometryIgnored(
-                    bSaveIsGeomIgnored);
-
                 CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
-                return FALSE;
+                bOK = false;
+                break;
             }
-        }
+            nMemoryUsed +=
+                64 * (GetDistinctCount(aoSummary) - nDistinctCountBefore);
 
-        delete poSrcFeature;
+            if (nMaxMemory > 0 && nMemoryUsed > nMaxMemory)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Too many groups in GROUP BY query. You may "
+                         "increase the value of the "
+                         "OGR_SQL_GROUP_BY_MAX_MEMORY configuration option.");
+                bOK = false;
+            }
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GROUP BY query");
+        bOK = false;
     }
 
-    poSrcLayer->GetLayerDefn()->SetGeometryIgnored(bSaveIsGeomIgnored);
+    poSrcDefn->SetGeometryIgnored(bSaveIsGeomIgnored);
 
     /* -------------------------------------------------------------------- */
     /*      Clear away the filters we have installed till a next run through*/
@@ -997,100 +2079,43 @@ int OGRGenSQLResultsLayer::PrepareSummary()
     /* -------------------------------------------------------------------- */
     ClearFilters();
 
+    const size_t nGroups = apoGroupFeatures.size();
+    if (!bOK)
+    {
+        if (nOrderItems > 0)
+            FreeIndexFields(asIndexFields.data(), nGroups, false);
+        return false;
+    }
+
     /* -------------------------------------------------------------------- */
-    /*      Now apply the values to the summary feature.  If we are in      */
-    /*      DISTINCT_LIST mode we don't do this step.                       */
+    /*      Finalize the aggregated values of each group, and order the     */
+    /*      groups.                                                         */
     /* -------------------------------------------------------------------- */
-    if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD)
+    for (size_t iGroup = 0; iGroup < nGroups; ++iGroup)
     {
-        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
-        {
-            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
-            if (!psSelectInfo->column_summary.empty())
-            {
-                const swq_summary &oSummary =
-                    psSelectInfo->column_summary[iField];
-                if (psColDef->col_func == SWQCF_COUNT)
-                {
-                    if (CPL_INT64_FITS_ON_INT32(oSummary.count))
-                    {
-                        delete poSummaryFeature;
-                        poSummaryFeature = nullptr;
-                        poDefn->GetFieldDefn(iField)->SetType(OFTInteger);
-                    }
-                }
-            }
-        }
-
-        if (poSummaryFeature == nullptr)
-        {
-            poSummaryFeature = new OGRFeature(poDefn);
-            poSummaryFeature->SetFID(0);
-        }
+        SetSummaryFields(apoGroupFeatures[iGroup].get(),
+                         aaoGroupSummaries[iGroup]);
+        std::vector<swq_summary>().swap(aaoGroupSummaries[iGroup]);
+    }
 
-        for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
-        {
-            swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
-            if (!psSelectInfo->column_summary.empty())
-            {
-                const swq_summary &oSummary =
-                    psSelectInfo->column_summary[iField];
+    std::vector<size_t> anOrder(nGroups);
+    for (size_t iGroup = 0; iGroup < nGroups; ++iGroup)
+        anOrder[iGroup] = iGroup;
+    if (nOrderItems > 0)
+    {
+        SortRows(asIndexFields.data(), 0, anOrder);
+        FreeIndexFields(asIndexFields.data(), nGroups, false);
+    }
 
-                if (psColDef->col_func == SWQCF_AVG && oSummary.count > 0)
-                {
-                    if (psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP)
-                    {
-                        struct tm brokendowntime;
-                        double dfAvg = oSummary.sum / oSummary.count;
-                        CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
-                                            &brokendowntime);
-                        poSummaryFeature->SetField(
-                            iField, brokendowntime.tm_year + 1900,
-                            brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
-                            brokendowntime.tm_hour, brokendowntime.tm_min,
-                            static_cast<float>(brokendowntime.tm_sec +
-                                               fmod(dfAvg, 1)),
-                            0);
-                    }
-                    else
-                        poSummaryFeature->SetField(iField, oSummary.sum /
-                                                               oSummary.count);
-                }
-                else if (psColDef->col_func == SWQCF_MIN && oSummary.count > 0)
-                {
-                    if (psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP ||
-                        psColDef->field_type == SWQ_STRING)
-                        poSummaryFeature->SetField(iField,
-                                                   oSummary.osMin.c_str());
-                    else
-                        poSummaryFeature->SetField(iField, oSummary.min);
-                }
-                else if (psColDef->col_func == SWQCF_MAX && oSummary.count > 0)
-                {
-                    if (psColDef->field_type == SWQ_DATE ||
-                        psColDef->field_type == SWQ_TIME ||
-                        psColDef->field_type == SWQ_TIMESTAMP ||
-                        psColDef->field_type == SWQ_STRING)
-                        poSummaryFeature->SetField(iField,
-                                                   oSummary.osMax.c_str());
-                    else
-                        poSummaryFeature->SetField(iField, oSummary.max);
-                }
-                else if (psColDef->col_func == SWQCF_COUNT)
-                    poSummaryFeature->SetField(iField, oSummary.count);
-                else if (psColDef->col_func == SWQCF_SUM && oSummary.count > 0)
-                    poSummaryFeature->SetField(iField, oSummary.sum);
-            }
-            else if (psColDef->col_func == SWQCF_COUNT)
-                poSummaryFeature->SetField(iField, 0);
-        }
+    m_apoGroupFeatures.resize(nGroups);
+    for (size_t i = 0; i < nGroups; ++i)
+    {
+        m_apoGroupFeatures[i] = std::move(apoGroupFeatures[anOrder[i]]);
+        m_apoGroupFeatures[i]->SetFID(static_cast<GIntBig>(i));
     }
 
-    return TRUE;
+    m_bGroupByPrepared = true;
+    return true;
 }
 
 /************************************************************************/
@@ -1341,6 +2366,15 @@ OGRFeature *OGRGenSQLResultsLayer::TranslateFeature(OGRFeature *poSrcFeat)
 
         OGRLayer *poJoinLayer = papoTableLayers[psJoinInfo->secondary_table];
 
+        auto &poJoinHash = m_apoJoinHashes[iJoin];
+        if (poJoinHash && !poJoinHash->Build())
+            poJoinHash.reset();
+        if (poJoinHash)
+        {
+            apoFeatures.push_back(poJoinHash->GetJoinFeature(poSrcFeat));
+            continue;
+        }
+
         osFilter = GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
                                     psJoinInfo->secondary_table);
         // CPLDebug("OGR", "Filter = %s\n", osFilter.c_str());
@@ -1641,6 +2675,27 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
         return GetFeature(nNextIndexFID++);
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Handle GROUP BY results.                                        */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        while (true)
+        {
+            auto poFeature =
+                std::unique_ptr<OGRFeature>(GetFeature(nNextIndexFID++));
+            if (poFeature == nullptr)
+                return nullptr;
+
+            if (m_poAttrQuery == nullptr ||
+                m_poAttrQuery->Evaluate(poFeature.get()))
+            {
+                nIteratedFeatures++;
+                return poFeature.release();
+            }
+        }
+    }
+
     int bEvaluateSpatialFilter = MustEvaluateSpatialFilterOnGenSQL();
 
     /* -------------------------------------------------------------------- */
@@ -1662,7 +2717,12 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
             if (nNextIndexFID >= static_cast<GIntBig>(nIndexSize))
                 return nullptr;
 
-            poSrcFeat.reset(poSrcLayer->GetFeature(panFIDIndex[nNextIndexFID]));
+            if (m_poSortedRows)
+                poSrcFeat.reset(
+                    m_poSortedRows->GetRow(panFIDIndex, nNextIndexFID));
+            else
+                poSrcFeat.reset(
+                    poSrcLayer->GetFeature(panFIDIndex[nNextIndexFID]));
             nNextIndexFID++;
         }
         else
@@ -1780,6 +2840,18 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature(GIntBig nFID)
         return poSummaryFeature->Clone();
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Handle request for a group of a GROUP BY query.                 */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        if (!PrepareGroupBy() || nFID < 0 ||
+            nFID >= static_cast<GIntBig>(m_apoGroupFeatures.size()))
+            return nullptr;
+
+        return m_apoGroupFeatures[static_cast<size_t>(nFID)]->Clone();
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Handle request for random record.                               */
     /* -------------------------------------------------------------------- */
@@ -1947,6 +3019,17 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
     }
 }
 
+/************************************************************************/
+/*                       GetOrderByMemoryCounter()                      */
+/************************************************************************/
+
+static CPLMemoryAccountingCounter *GetOrderByMemoryCounter()
+{
+    static CPLMemoryAccountingCounter *const hCounter =
+        CPLGetMemoryAccountingCounter("OGR_SQL_ORDER_BY");
+    return hCounter;
+}
+
 /************************************************************************/
 /*                         CreateOrderByIndex()                         */
 /*                                                                      */
@@ -1962,6 +3045,11 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*                                                                      */
 /*      Keeping all the key values in memory will *not* scale up to     */
 /*      very large input datasets.                                      */
+/*                                                                      */
+/*      For source layers without efficient random read, the features   */
+/*      themselves are also collected during that pass, in sorted runs  */
+/*      that are spilled to a temporary file beyond a memory budget,    */
+/*      so that the second pass does not need GetFeature().             */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -1977,6 +3065,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         return;
 
     bOrderByValid = TRUE;
+    m_poSortedRows.reset();
 
     ResetReading();
 
@@ -2035,6 +3124,11 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         CPLCalloc(sizeof(OGRField), nOrderItems * nFeaturesAlloc));
     GIntBig *panFIDList =
         static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig) * nFeaturesAlloc));
+    // Key values and FID list, released on all return paths.
+    const GIntBig nBytesPerFeature =
+        static_cast<GIntBig>(sizeof(OGRField) * nOrderItems + sizeof(GIntBig));
+    CPLMemoryAccountingReservation oIndexMemory(
+        GetOrderByMemoryCounter(), nBytesPerFeature * nFeaturesAlloc);
 
     /* -------------------------------------------------------------------- */
     /*      Read in all the key values.                                     */
@@ -2042,6 +3136,20 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     OGRFeature *poSrcFeat = nullptr;
     nIndexSize = 0;
 
+    if (!poSrcLayer->TestCapability(OLCRandomRead))
+    {
+        const char *pszMaxMemory =
+            CPLGetConfigOption("OGR_SQL_ORDER_BY_MAX_MEMORY", nullptr);
+        const GIntBig nMaxMemory = pszMaxMemory
+                                       ? CPLAtoGIntBig(pszMaxMemory)
+                                       : static_cast<GIntBig>(100) * 1024 * 1024;
+        if (nMaxMemory > 0)
+        {
+            m_poSortedRows = std::make_unique<OGRGenSQLSortedRows>(
+                poSrcLayer->GetLayerDefn(), nMaxMemory);
+        }
+    }
+
     while ((poSrcFeat = poSrcLayer->GetNextFeature()) != nullptr)
     {
         if (nIndexSize == nFeaturesAlloc)
@@ -2057,6 +3165,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot allocate pasIndexFields");
+                m_poSortedRows.reset();
                 FreeIndexFields(pasIndexFields, nIndexSize);
                 VSIFree(panFIDList);
                 nIndexSize = 0;
@@ -2073,6 +3182,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot allocate pasIndexFields");
+                m_poSortedRows.reset();
                 FreeIndexFields(pasIndexFields, nIndexSize);
                 VSIFree(panFIDList);
                 nIndexSize = 0;
@@ -2086,6 +3196,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
                 sizeof(GIntBig) * static_cast<size_t>(nNewFeaturesAlloc)));
             if (panNewFIDList == nullptr)
             {
+                m_poSortedRows.reset();
                 FreeIndexFields(pasIndexFields, nIndexSize);
                 VSIFree(panFIDList);
                 nIndexSize = 0;
@@ -2099,17 +3210,52 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
                        static_cast<size_t>(nNewFeaturesAlloc - nFeaturesAlloc));
 
             nFeaturesAlloc = static_cast<size_t>(nNewFeaturesAlloc);
+            oIndexMemory.Set(nBytesPerFeature * nFeaturesAlloc);
         }
 
         ReadIndexFields(poSrcFeat, nOrderItems,
                         pasIndexFields + nIndexSize * nOrderItems);
 
         panFIDList[nIndexSize] = poSrcFeat->GetFID();
+
+        if (m_poSortedRows)
+        {
+            bool bOK = m_poSortedRows->AddRow(poSrcFeat);
+            if (bOK && m_poSortedRows->MustSpill())
+            {
+                size_t nRunStart = 0;
+                size_t nRunCount = 0;
+                m_poSortedRows->GetPendingRun(nRunStart, nRunCount);
+                // The run is sorted in a worker thread, on a copy of its keys
+                // as pasIndexFields may be reallocated in the meantime.
+                std::vector<OGRField> asRunFields(
+                    pasIndexFields + nRunStart * nOrderItems,
+                    pasIndexFields + (nRunStart + nRunCount) * nOrderItems);
+                bOK = m_poSortedRows->SpillRun(
+                    [this, nRunStart, asRunFields = std::move(asRunFields)](
+                        std::vector<size_t> &anRows)
+                    { SortRows(asRunFields.data(), nRunStart, anRows); });
+            }
+            if (!bOK)
+            {
+                CPLDebug("GenSQL", "ORDER BY: falling back to GetFeature()");
+                m_poSortedRows.reset();
+            }
+        }
         delete poSrcFeat;
 
         nIndexSize++;
     }
 
+    if (m_poSortedRows &&
+        !m_poSortedRows->Finish(
+            [this, pasIndexFields](std::vector<size_t> &anRows)
+            { SortRows(pasIndexFields, 0, anRows); }))
+    {
+        CPLDebug("GenSQL", "ORDER BY: falling back to GetFeature()");
+        m_poSortedRows.reset();
+    }
+
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %d features", nIndexSize);
 
     /* -------------------------------------------------------------------- */
@@ -2119,6 +3265,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         VSI_MALLOC_VERBOSE(sizeof(GIntBig) * nIndexSize));
     if (panFIDIndex == nullptr)
     {
+        m_poSortedRows.reset();
         FreeIndexFields(pasIndexFields, nIndexSize);
         VSIFree(panFIDList);
         nIndexSize = 0;
@@ -2128,33 +3275,47 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         panFIDIndex[i] = static_cast<GIntBig>(i);
 
     /* -------------------------------------------------------------------- */
-    /*      Quick sort the records.                                         */
+    /*      Quick sort the records, or merge the sorted runs of features.   */
     /* -------------------------------------------------------------------- */
-
-    GIntBig *panMerged = static_cast<GIntBig *>(
-        VSI_MALLOC_VERBOSE(sizeof(GIntBig) * nIndexSize));
-    if (panMerged == nullptr)
+    if (m_poSortedRows)
     {
-        FreeIndexFields(pasIndexFields, nIndexSize);
-        VSIFree(panFIDList);
-        nIndexSize = 0;
-        VSIFree(panFIDIndex);
-        panFIDIndex = nullptr;
-        return;
+        m_poSortedRows->Merge(
+            [this, pasIndexFields, nOrderItems](size_t i, size_t j)
+            {
+                return Compare(pasIndexFields + i * nOrderItems,
+                               pasIndexFields + j * nOrderItems);
+            },
+            panFIDIndex);
     }
+    else
+    {
+        GIntBig *panMerged = static_cast<GIntBig *>(
+            VSI_MALLOC_VERBOSE(sizeof(GIntBig) * nIndexSize));
+        if (panMerged == nullptr)
+        {
+            FreeIndexFields(pasIndexFields, nIndexSize);
+            VSIFree(panFIDList);
+            nIndexSize = 0;
+            VSIFree(panFIDIndex);
+            panFIDIndex = nullptr;
+            return;
+        }
 
-    SortIndexSection(pasIndexFields, panMerged, 0, nIndexSize);
-    VSIFree(panMerged);
+        SortIndexSection(pasIndexFields, panMerged, 0, nIndexSize);
+        VSIFree(panMerged);
+    }
 
     /* -------------------------------------------------------------------- */
-    /*      Rework the FID map to map to real FIDs.                         */
+    /*      Rework the FID map to map to real FIDs, unless features are     */
+    /*      read from m_poSortedRows.                                       */
     /* -------------------------------------------------------------------- */
     bool bAlreadySorted = true;
     for (size_t i = 0; i < nIndexSize; i++)
     {
         if (panFIDIndex[i] != static_cast<GIntBig>(i))
             bAlreadySorted = false;
-        panFIDIndex[i] = panFIDList[panFIDIndex[i]];
+        if (!m_poSortedRows)
+            panFIDIndex[i] = panFIDList[panFIDIndex[i]];
     }
 
     CPLFree(panFIDList);
@@ -2169,13 +3330,43 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
     {
         CPLFree(panFIDIndex);
         panFIDIndex = nullptr;
+        m_poSortedRows.reset();
 
         nIndexSize = 0;
     }
+    else
+    {
+        m_oFIDIndexMemory = CPLMemoryAccountingReservation(
+            GetOrderByMemoryCounter(),
+            static_cast<GIntBig>(sizeof(GIntBig) * nIndexSize));
+    }
 
     ResetReading();
 }
 
+/************************************************************************/
+/*                              SortRows()                              */
+/*                                                                      */
+/*      Stable sort of row indices, given the key values of the rows    */
+/*      starting at nFirstRow.                                          */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::SortRows(const OGRField *pasIndexFields,
+                                     size_t nFirstRow,
+                                     std::vector<size_t> &anRows)
+{
+    swq_select *psSelectInfo = static_cast<swq_select *>(pSelectInfo);
+    const int nOrderItems = psSelectInfo->order_specs;
+
+    std::stable_sort(
+        anRows.begin(), anRows.end(),
+        [this, pasIndexFields, nFirstRow, nOrderItems](size_t i, size_t j)
+        {
+            return Compare(pasIndexFields + (i - nFirstRow) * nOrderItems,
+                           pasIndexFields + (j - nFirstRow) * nOrderItems) < 0;
+        });
+}
+
 /************************************************************************/
 /*                          SortIndexSection()                          */
 /*                                                                      */
@@ -2418,6 +3609,12 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
                           hSet);
     }
 
+    for (const auto &oGroupByDef : psSelectInfo->group_by_defs)
+    {
+        AddFieldDefnToSet(oGroupByDef.table_index, oGroupByDef.field_index,
+                          hSet);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      2nd phase : now, we can exclude the unused fields               */
     /* -------------------------------------------------------------------- */
@@ -2455,6 +3652,8 @@ void OGRGenSQLResultsLayer::InvalidateOrderByIndex()
 {
     CPLFree(panFIDIndex);
     panFIDIndex = nullptr;
+    m_oFIDIndexMemory.Set(0);
+    m_poSortedRows.reset();
 
     nIndexSize = 0;
     bOrderByValid = FALSE;
@@ -36,6 +36,7 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -51,6 +52,9 @@
 #define ALL_FIELD_INDEX_TO_GEOM_FIELD_INDEX(poFDefn, idx)                      \
     ((idx) - ((poFDefn)->GetFieldCount() + SPECIAL_FIELD_COUNT))
 
+class OGRGenSQLSortedRows;
+class OGRGenSQLJoinHash;
+
 /************************************************************************/
 /*                        OGRGenSQLResultsLayer                         */
 /************************************************************************/
@@ -74,11 +78,22 @@ class OGRGenSQLResultsLayer final : public OGRLayer
 
     size_t nIndexSize;
     GIntBig *panFIDIndex;
+    // Accounts panFIDIndex in the OGR_SQL_ORDER_BY memory counter.
+    CPLMemoryAccountingReservation m_oFIDIndexMemory{};
     int bOrderByValid;
 
     GIntBig nNextIndexFID;
     OGRFeature *poSummaryFeature;
 
+    // Copy of the source features in ORDER BY order, for source layers
+    // without efficient random read. When set, panFIDIndex contains indices
+    // in reading order instead of FIDs.
+    std::unique_ptr<OGRGenSQLSortedRows> m_poSortedRows{};
+
+    // Per join, hash table of the secondary layer, or nullptr when joined
+    // features are fetched with an attribute filter.
+    std::vector<std::unique_ptr<OGRGenSQLJoinHash>> m_apoJoinHashes{};
+
     int iFIDFieldIndex;
 
     int nExtraDSCount;
@@ -87,7 +102,17 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig nIteratedFeatures;
     std::vector<CPLString> m_oDistinctList;
 
+    // Result of a GROUP BY query: one feature per group, in output order.
+    std::vector<std::unique_ptr<OGRFeature>> m_apoGroupFeatures{};
+    bool m_bGroupByPrepared = false;
+
     int PrepareSummary();
+    bool PrepareGroupBy();
+    bool IsGeometryNeededForSummary();
+    const char *SummarizeFeature(OGRFeature *poSrcFeature,
+                                 std::vector<swq_summary> *paoGroupSummary);
+    void SetSummaryFields(OGRFeature *poDstFeature,
+                          const std::vector<swq_summary> &aoSummary);
 
     OGRFeature *TranslateFeature(OGRFeature *);
     void CreateOrderByIndex();
@@ -98,6 +123,8 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     void FreeIndexFields(OGRField *pasIndexFields, size_t l_nIndexSize,
                          bool bFreeArray = true);
     int Compare(const OGRField *pasFirst, const OGRField *pasSecond);
+    void SortRows(const OGRField *pasIndexFields, size_t nFirstRow,
+                  std::vector<size_t> &anRows);
 
     void ClearFilters();
     void ApplyFiltersToSource();
@@ -36,8 +36,11 @@
 #include "ogr_wkb.h"
 #include "ogrlayer_private.h"
 
+#include "cpl_quad_tree.h"
 #include "cpl_time.h"
+#include <algorithm>
 #include <cassert>
+#include <climits>
 #include <limits>
 #include <set>
 
@@ -606,12 +609,11 @@ OGRErr OGRLayer::SetNextByIndex(GIntBig nIndex)
     OGRFeature *poFeature = nullptr;
     while (nIndex-- > 0)
     {
-        poFeature = GetNextFeature();
+        poFeature = GetNextFeatureReusing(poFeature);
         if (poFeature == nullptr)
             return OGRERR_FAILURE;
-
-        delete poFeature;
     }
+    delete poFeature;
 
     return OGRERR_NONE;
 }
@@ -650,6 +652,124 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
     return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                       GetNextFeatureReusing()                        */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer, possibly recycling
+ a previously returned feature.
+
+ This method is similar to GetNextFeature(), except that it takes ownership
+ of poFeatureToReuse, a feature previously returned by this layer (or
+ nullptr). Drivers that support it may reset that feature and fill it with
+ the content of the next feature, instead of allocating a new one, which
+ saves memory allocations when iterating over large layers. Other drivers
+ just destroy it and return the result of GetNextFeature().
+
+ The returned feature (which may be the same object as poFeatureToReuse)
+ becomes the responsibility of the caller. When no more features are
+ available, nullptr is returned, and poFeatureToReuse has been destroyed.
+ Consequently the typical usage is:
+
+ \code{.cpp}
+   OGRFeature* poFeature = nullptr;
+   while( (poFeature = poLayer->GetNextFeatureReusing(poFeature)) != nullptr )
+   {
+       // do something with poFeature, without storing it, nor its geometry
+   }
+ \endcode
+
+ The caller must not keep pointers to the content (fields, geometries) of
+ poFeatureToReuse after this call.
+
+ This method is the same as the C function OGR_L_GetNextFeatureReusing().
+
+ @param poFeatureToReuse feature previously returned by GetNextFeature() or
+ GetNextFeatureReusing() on this layer, or nullptr. If its feature definition
+ is not the one of the layer, it is destroyed and not reused.
+ @return a feature, or NULL if no more features are available.
+
+ @since GDAL 3.10
+*/
+
+OGRFeature *OGRLayer::GetNextFeatureReusing(OGRFeature *poFeatureToReuse)
+{
+    if (poFeatureToReuse && poFeatureToReuse->GetDefnRef() != GetLayerDefn())
+    {
+        delete poFeatureToReuse;
+        poFeatureToReuse = nullptr;
+    }
+    return IGetNextFeatureReusing(poFeatureToReuse);
+}
+
+/************************************************************************/
+/*                       IGetNextFeatureReusing()                       */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer, possibly recycling
+ poFeatureToReuse.
+
+ This method is called by GetNextFeatureReusing(), which has checked that
+ poFeatureToReuse, if not null, uses the feature definition of the layer.
+ The default implementation destroys poFeatureToReuse and returns
+ GetNextFeature(). Drivers overriding it must return poFeatureToReuse (after
+ having reset it) or a new feature, and destroy poFeatureToReuse in the
+ later case.
+
+ @since GDAL 3.10
+*/
+
+OGRFeature *OGRLayer::IGetNextFeatureReusing(OGRFeature *poFeatureToReuse)
+{
+    delete poFeatureToReuse;
+    return GetNextFeature();
+}
+
+/************************************************************************/
+/*                    OGR_L_GetNextFeatureReusing()                     */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer, possibly recycling
+ a previously returned feature.
+
+ This function takes ownership of hFeatureToReuse. The returned feature
+ (which may be the same object as hFeatureToReuse) becomes the responsibility
+ of the caller. When no more features are available, NULL is returned, and
+ hFeatureToReuse has been destroyed. Typical usage is:
+
+ \code{.c}
+   OGRFeatureH hFeature = NULL;
+   while( (hFeature = OGR_L_GetNextFeatureReusing(hLayer, hFeature)) != NULL )
+   {
+       // do something with hFeature
+   }
+ \endcode
+
+ This function is the same as the C++ method
+ OGRLayer::GetNextFeatureReusing().
+
+ @param hLayer handle to the layer from which feature are read.
+ @param hFeatureToReuse feature previously returned by OGR_L_GetNextFeature()
+ or OGR_L_GetNextFeatureReusing() on this layer, or NULL.
+ @return a handle to a feature, or NULL if no more features are available.
+
+ @since GDAL 3.10
+*/
+
+OGRFeatureH OGR_L_GetNextFeatureReusing(OGRLayerH hLayer,
+                                        OGRFeatureH hFeatureToReuse)
+
+{
+    VALIDATE_POINTER1(hLayer, "OGR_L_GetNextFeatureReusing", nullptr);
+
+    return OGRFeature::ToHandle(
+        OGRLayer::FromHandle(hLayer)->GetNextFeatureReusing(
+            OGRFeature::FromHandle(hFeatureToReuse)));
+}
+
 /************************************************************************/
 /*                       ConvertGeomsIfNecessary()                      */
 /************************************************************************/
@@ -1651,6 +1771,19 @@ int OGRLayer::InstallFilter(OGRGeometry *poFilter)
     if (m_poFilterGeom == poFilter)
         return FALSE;
 
+    /* -------------------------------------------------------------------- */
+    /*      Keep the prepared geometry if the new filter has the same       */
+    /*      coordinates as the current one, as it is common to install      */
+    /*      the same filter again before each iteration over the layer.     */
+    /* -------------------------------------------------------------------- */
+    OGRPreparedGeometry *poReusedPreparedGeom = nullptr;
+    if (m_pPreparedFilterGeom != nullptr && m_poFilterGeom != nullptr &&
+        poFilter != nullptr && m_poFilterGeom->Equals(poFilter))
+    {
+        poReusedPreparedGeom = m_pPreparedFilterGeom;
+        m_pPreparedFilterGeom = nullptr;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Replace the existing filter.                                    */
     /* -------------------------------------------------------------------- */
@@ -1678,7 +1811,9 @@ int OGRLayer::InstallFilter(OGRGeometry *poFilter)
 
     /* Compile geometry filter as a prepared geometry */
     m_pPreparedFilterGeom =
-        OGRCreatePreparedGeometry(OGRGeometry::ToHandle(m_poFilterGeom));
+        poReusedPreparedGeom
+            ? poReusedPreparedGeom
+            : OGRCreatePreparedGeometry(OGRGeometry::ToHandle(m_poFilterGeom));
 
     /* -------------------------------------------------------------------- */
     /*      Now try to determine if the filter is really a rectangle.       */
@@ -2533,7 +2668,312 @@ static OGRErr set_result_schema(OGRLayer *pLayerResult,
     return ret;
 }
 
-static OGRGeometry *set_filter_from(OGRLayer *pLayer,
+/************************************************************************/
+/*                       OGRLayerOverlayFeatures                        */
+/************************************************************************/
+
+namespace
+{
+// Iterates over the features of a layer of an overlay operation that
+// intersect the geometry of the current feature of the other layer.
+// By default, that geometry is installed as the spatial filter of the layer,
+// which means that the whole layer is scanned for each feature when the
+// driver has no efficient spatial filtering. When IN_MEMORY_SPATIAL_INDEX is
+// enabled, the features of the layer are instead loaded once in memory, and
+// their envelopes indexed with a quad tree.
+class OGRLayerOverlayFeatures
+{
+    OGRLayer *m_poLayer = nullptr;
+    OGRFeatureUniquePtr m_poCurFeature{};
+
+    bool m_bIndexed = false;
+    std::vector<OGRFeatureUniquePtr> m_apoFeatures{};
+    CPLQuadTree *m_hQuadTree = nullptr;
+    const OGRGeometry *m_poFilterGeomSrc = nullptr;
+    OGRGeometryUniquePtr m_poFilterGeom{};
+    OGRPreparedGeometryUniquePtr m_poPreparedFilterGeom{};
+    const OGRGeometry *m_poPreparedLayerFilterGeomSrc = nullptr;
+    OGRPreparedGeometryUniquePtr m_poPreparedLayerFilterGeom{};
+    std::vector<size_t> m_anCandidates{};
+    size_t m_iNextCandidate = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRLayerOverlayFeatures)
+
+  public:
+    class Iterator
+    {
+        OGRLayerOverlayFeatures *m_poOwner = nullptr;
+        OGRFeature *m_poFeature = nullptr;
+
+      public:
+        Iterator(OGRLayerOverlayFeatures *poOwner, OGRFeature *poFeature)
+            : m_poOwner(poOwner), m_poFeature(poFeature)
+        {
+        }
+
+        OGRFeature *operator*() const
+        {
+            return m_poFeature;
+        }
+
+        Iterator &operator++()
+        {
+            m_poFeature = m_poOwner->GetNextFeature();
+            return *this;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return m_poFeature != other.m_poFeature;
+        }
+    };
+
+    explicit OGRLayerOverlayFeatures(OGRLayer *poLayer) : m_poLayer(poLayer)
+    {
+    }
+
+    ~OGRLayerOverlayFeatures()
+    {
+        if (m_hQuadTree)
+            CPLQuadTreeDestroy(m_hQuadTree);
+    }
+
+    OGRErr Init(CSLConstList papszOptions);
+    void SetSpatialFilter(OGRGeometry *poGeom);
+    void ResetReading();
+    OGRFeature *GetNextFeature();
+    OGRPreparedGeometry *
+    GetPreparedGeometry(OGRGeometry *poGeom,
+                        OGRPreparedGeometryUniquePtr &poPreparedGeomHolder);
+    bool IntersectsLayerFilter(const OGRGeometry *poGeom,
+                               const OGRGeometry *poLayerFilterGeom);
+
+    Iterator begin()
+    {
+        ResetReading();
+        return Iterator(this, GetNextFeature());
+    }
+
+    Iterator end()
+    {
+        return Iterator(this, nullptr);
+    }
+};
+
+/************************************************************************/
+/*                 OGRLayerOverlayFeatures::Init()                      */
+/************************************************************************/
+
+OGRErr OGRLayerOverlayFeatures::Init(CSLConstList papszOptions)
+{
+    const char *pszInMemoryIndex =
+        CSLFetchNameValue(papszOptions, "IN_MEMORY_SPATIAL_INDEX");
+    m_bIndexed = pszInMemoryIndex
+                     ? CPLTestBool(pszInMemoryIndex)
+                     : !m_poLayer->TestCapability(OLCFastSpatialFilter);
+    if (!m_bIndexed)
+        return OGRERR_NONE;
+
+    // Features without geometry would never pass a spatial filter
+    std::vector<OGREnvelope> asEnvelopes;
+    OGREnvelope sGlobalEnvelope;
+    try
+    {
+        m_poLayer->ResetReading();
+        while (OGRFeature *poFeature = m_poLayer->GetNextFeature())
+        {
+            OGRFeatureUniquePtr poFeatureHolder(poFeature);
+            const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+            if (poGeom == nullptr || poGeom->IsEmpty())
+                continue;
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            sGlobalEnvelope.Merge(sEnvelope);
+            asEnvelopes.push_back(sEnvelope);
+            m_apoFeatures.push_back(std::move(poFeatureHolder));
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot load the features of layer %s in memory",
+                 m_poLayer->GetName());
+        return OGRERR_NOT_ENOUGH_MEMORY;
+    }
+
+    if (m_apoFeatures.empty())
+        return OGRERR_NONE;
+
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = sGlobalEnvelope.MinX;
+    sGlobalBounds.miny = sGlobalEnvelope.MinY;
+    sGlobalBounds.maxx = sGlobalEnvelope.MaxX;
+    sGlobalBounds.maxy = sGlobalEnvelope.MaxY;
+    m_hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    CPLQuadTreeSetMaxDepth(m_hQuadTree,
+                           CPLQuadTreeGetAdvisedMaxDepth(
+                               static_cast<int>(std::min<size_t>(
+                                   INT_MAX, m_apoFeatures.size()))));
+    for (size_t i = 0; i < asEnvelopes.size(); ++i)
+    {
+        CPLRectObj sRect;
+        sRect.minx = asEnvelopes[i].MinX;
+        sRect.miny = asEnvelopes[i].MinY;
+        sRect.maxx = asEnvelopes[i].MaxX;
+        sRect.maxy = asEnvelopes[i].MaxY;
+        CPLQuadTreeInsertWithBounds(
+            m_hQuadTree, reinterpret_cast<void *>(static_cast<uintptr_t>(i)),
+            &sRect);
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*               OGRLayerOverlayFeatures::SetSpatialFilter()            */
+/************************************************************************/
+
+void OGRLayerOverlayFeatures::SetSpatialFilter(OGRGeometry *poGeom)
+{
+    if (!m_bIndexed)
+    {
+        m_poLayer->SetSpatialFilter(poGeom);
+        return;
+    }
+
+    m_anCandidates.clear();
+    m_iNextCandidate = 0;
+    m_poPreparedFilterGeom.reset();
+    m_poFilterGeomSrc = poGeom;
+    m_poFilterGeom.reset(poGeom->clone());
+    if (m_hQuadTree == nullptr)
+        return;
+
+    if (OGRHasPreparedGeometrySupport())
+    {
+        m_poPreparedFilterGeom.reset(OGRCreatePreparedGeometry(
+            OGRGeometry::ToHandle(m_poFilterGeom.get())));
+    }
+
+    OGREnvelope sEnvelope;
+    m_poFilterGeom->getEnvelope(&sEnvelope);
+    CPLRectObj sRect;
+    sRect.minx = sEnvelope.MinX;
+    sRect.miny = sEnvelope.MinY;
+    sRect.maxx = sEnvelope.MaxX;
+    sRect.maxy = sEnvelope.MaxY;
+    int nCount = 0;
+    void **pahIndices = CPLQuadTreeSearch(m_hQuadTree, &sRect, &nCount);
+    m_anCandidates.reserve(nCount);
+    for (int i = 0; i < nCount; ++i)
+    {
+        m_anCandidates.push_back(
+            static_cast<size_t>(reinterpret_cast<uintptr_t>(pahIndices[i])));
+    }
+    CPLFree(pahIndices);
+
+    // Return features in the same order as when iterating over the layer
+    std::sort(m_anCandidates.begin(), m_anCandidates.end());
+}
+
+/************************************************************************/
+/*             OGRLayerOverlayFeatures::GetPreparedGeometry()           */
+/************************************************************************/
+
+/** Return a prepared geometry for poGeom.
+ *
+ * If poGeom is the geometry passed to the last SetSpatialFilter() call, the
+ * prepared geometry of the spatial filter is returned. Otherwise a new one is
+ * created and owned by poPreparedGeomHolder.
+ */
+OGRPreparedGeometry *OGRLayerOverlayFeatures::GetPreparedGeometry(
+    OGRGeometry *poGeom, OGRPreparedGeometryUniquePtr &poPreparedGeomHolder)
+{
+    if (m_bIndexed && m_poPreparedFilterGeom && poGeom == m_poFilterGeomSrc)
+        return m_poPreparedFilterGeom.get();
+    poPreparedGeomHolder.reset(
+        OGRCreatePreparedGeometry(OGRGeometry::ToHandle(poGeom)));
+    return poPreparedGeomHolder.get();
+}
+
+/************************************************************************/
+/*            OGRLayerOverlayFeatures::IntersectsLayerFilter()          */
+/************************************************************************/
+
+/** Return whether poGeom intersects poLayerFilterGeom, the spatial filter
+ * of the layer when the overlay operation started.
+ *
+ * That geometry does not change during the operation, so it is only
+ * prepared once.
+ */
+bool OGRLayerOverlayFeatures::IntersectsLayerFilter(
+    const OGRGeometry *poGeom, const OGRGeometry *poLayerFilterGeom)
+{
+    if (poLayerFilterGeom != m_poPreparedLayerFilterGeomSrc)
+    {
+        m_poPreparedLayerFilterGeomSrc = poLayerFilterGeom;
+        m_poPreparedLayerFilterGeom.reset(
+            OGRHasPreparedGeometrySupport()
+                ? OGRCreatePreparedGeometry(OGRGeometry::ToHandle(
+                      const_cast<OGRGeometry *>(poLayerFilterGeom)))
+                : nullptr);
+    }
+    if (m_poPreparedLayerFilterGeom)
+    {
+        return CPL_TO_BOOL(OGRPreparedGeometryIntersects(
+            m_poPreparedLayerFilterGeom.get(),
+            OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poGeom))));
+    }
+    return CPL_TO_BOOL(poGeom->Intersects(poLayerFilterGeom));
+}
+
+/************************************************************************/
+/*                OGRLayerOverlayFeatures::ResetReading()               */
+/************************************************************************/
+
+void OGRLayerOverlayFeatures::ResetReading()
+{
+    if (m_bIndexed)
+        m_iNextCandidate = 0;
+    else
+        m_poLayer->ResetReading();
+}
+
+/************************************************************************/
+/*               OGRLayerOverlayFeatures::GetNextFeature()              */
+/************************************************************************/
+
+/** Return the next feature, which remains owned by this object and is valid
+ * until the next call. */
+OGRFeature *OGRLayerOverlayFeatures::GetNextFeature()
+{
+    if (!m_bIndexed)
+    {
+        m_poCurFeature.reset(m_poLayer->GetNextFeature());
+        return m_poCurFeature.get();
+    }
+
+    // Same test as OGRLayer::FilterGeometry()
+    while (m_iNextCandidate < m_anCandidates.size())
+    {
+        OGRFeature *poFeature =
+            m_apoFeatures[m_anCandidates[m_iNextCandidate++]].get();
+        const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+        if (m_poPreparedFilterGeom
+                ? OGRPreparedGeometryIntersects(m_poPreparedFilterGeom.get(),
+                                                OGRGeometry::ToHandle(
+                                                    const_cast<OGRGeometry *>(
+                                                        poGeom)))
+                : m_poFilterGeom->Intersects(poGeom))
+        {
+            return poFeature;
+        }
+    }
+    return nullptr;
+}
+}  // namespace
+
+static OGRGeometry *set_filter_from(OGRLayerOverlayFeatures &oFeatures,
                                     OGRGeometry *pGeometryExistingFilter,
                                     OGRFeature *pFeature)
 {
@@ -2542,12 +2982,12 @@ static OGRGeometry *set_filter_from(OGRLayer *pLayer,
         return nullptr;
     if (pGeometryExistingFilter)
     {
-        if (!geom->Intersects(pGeometryExistingFilter))
+        if (!oFeatures.IntersectsLayerFilter(geom, pGeometryExistingFilter))
             return nullptr;
         OGRGeometry *intersection = geom->Intersection(pGeometryExistingFilter);
         if (intersection)
         {
-            pLayer->SetSpatialFilter(intersection);
+            oFeatures.SetSpatialFilter(intersection);
             delete intersection;
         }
         else
@@ -2555,7 +2995,7 @@ static OGRGeometry *set_filter_from(OGRLayer *pLayer,
     }
     else
     {
-        pLayer->SetSpatialFilter(geom);
+        oFeatures.SetSpatialFilter(geom);
     }
     return geom;
 }
@@ -2616,6 +3056,11 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Intersection().
@@ -2650,6 +3095,7 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    OGRLayerOverlayFeatures oMethodFeatures(pLayerMethod);
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
     OGREnvelope sEnvelopeMethod;
@@ -2691,6 +3137,9 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    ret = oMethodFeatures.Init(papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
     bEnvelopeSet = pLayerMethod->GetExtent(&sEnvelopeMethod, 1) == OGRERR_NONE;
     if (bKeepLowerDimGeom)
     {
@@ -2746,7 +3195,7 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter for method layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            set_filter_from(oMethodFeatures, pGeometryMethodFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -2765,18 +3214,19 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             continue;
         }
 
-        OGRPreparedGeometryUniquePtr x_prepared_geom;
+        OGRPreparedGeometryUniquePtr x_prepared_geom_holder;
+        OGRPreparedGeometry *x_prepared_geom = nullptr;
         if (bUsePreparedGeometries)
         {
-            x_prepared_geom.reset(
-                OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
+            x_prepared_geom = oMethodFeatures.GetPreparedGeometry(
+                x_geom, x_prepared_geom_holder);
             if (!x_prepared_geom)
             {
                 goto done;
             }
         }
 
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oMethodFeatures)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -2788,14 +3238,14 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 CPLErrorReset();
                 ret = OGRERR_NONE;
                 if (bPretestContainment &&
-                    OGRPreparedGeometryContains(x_prepared_geom.get(),
+                    OGRPreparedGeometryContains(x_prepared_geom,
                                                 OGRGeometry::ToHandle(y_geom)))
                 {
                     if (CPLGetLastErrorType() == CE_None)
                         z_geom.reset(y_geom->clone());
                 }
                 else if (!(OGRPreparedGeometryIntersects(
-                             x_prepared_geom.get(),
+                             x_prepared_geom,
                              OGRGeometry::ToHandle(y_geom))))
                 {
                     if (CPLGetLastErrorType() == CE_None)
@@ -2846,7 +3296,7 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             }
             OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
             z->SetFieldsFrom(x.get(), mapInput);
-            z->SetFieldsFrom(y.get(), mapMethod);
+            z->SetFieldsFrom(y, mapMethod);
             if (bPromoteToMulti)
                 z_geom.reset(promote_to_multi(z_geom.release()));
             z->SetGeometryDirectly(z_geom.release());
@@ -2929,6 +3379,11 @@ done:
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Intersection().
@@ -3017,6 +3472,12 @@ OGRErr OGR_L_Intersection(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer (and of this layer, when
+ *     processing the features of the method layer) in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Union().
@@ -3051,6 +3512,8 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    OGRLayerOverlayFeatures oMethodFeatures(pLayerMethod);
+    OGRLayerOverlayFeatures oInputFeatures(this);
     OGRGeometry *pGeometryInputFilter = nullptr;
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
@@ -3094,6 +3557,9 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    ret = oMethodFeatures.Init(papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
     if (bKeepLowerDimGeom)
     {
         // require that the result layer is of geom type unknown
@@ -3127,7 +3593,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on method layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            set_filter_from(oMethodFeatures, pGeometryMethodFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -3146,11 +3612,12 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             continue;
         }
 
-        OGRPreparedGeometryUniquePtr x_prepared_geom;
+        OGRPreparedGeometryUniquePtr x_prepared_geom_holder;
+        OGRPreparedGeometry *x_prepared_geom = nullptr;
         if (bUsePreparedGeometries)
         {
-            x_prepared_geom.reset(
-                OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
+            x_prepared_geom = oMethodFeatures.GetPreparedGeometry(
+                x_geom, x_prepared_geom_holder);
             if (!x_prepared_geom)
             {
                 goto done;
@@ -3160,7 +3627,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         OGRGeometryUniquePtr x_geom_diff(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oMethodFeatures)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -3170,7 +3637,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
 
             CPLErrorReset();
             if (x_prepared_geom &&
-                !(OGRPreparedGeometryIntersects(x_prepared_geom.get(),
+                !(OGRPreparedGeometryIntersects(x_prepared_geom,
                                                 OGRGeometry::ToHandle(y_geom))))
             {
                 if (CPLGetLastErrorType() == CE_None)
@@ -3219,7 +3686,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
                 z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
+                z->SetFieldsFrom(y, mapMethod);
                 if (bPromoteToMulti)
                     poIntersection.reset(
                         promote_to_multi(poIntersection.release()));
@@ -3264,7 +3731,8 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
                 }
             }
         }
-        x_prepared_geom.reset();
+        x_prepared_geom = nullptr;
+        x_prepared_geom_holder.reset();
 
         if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
         {
@@ -3295,6 +3763,9 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
 
     // restore filter on method layer and add features based on it
     pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
+    ret = oInputFeatures.Init(papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
     for (auto &&x : pLayerMethod)
     {
 
@@ -3316,7 +3787,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on input layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
+            set_filter_from(oInputFeatures, pGeometryInputFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -3338,7 +3809,7 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         OGRGeometryUniquePtr x_geom_diff(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
+        for (OGRFeature *y : oInputFeatures)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -3463,6 +3934,12 @@ done:
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer (and of this layer, when
+ *     processing the features of the method layer) in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Union().
@@ -3542,6 +4019,12 @@ OGRErr OGR_L_Union(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer (and of this layer, when
+ *     processing the features of the method layer) in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_SymDifference().
@@ -3576,6 +4059,8 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    OGRLayerOverlayFeatures oMethodFeatures(pLayerMethod);
+    OGRLayerOverlayFeatures oInputFeatures(this);
     OGRGeometry *pGeometryInputFilter = nullptr;
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
@@ -3613,6 +4098,9 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    ret = oMethodFeatures.Init(papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
 
     // add features based on input layer
     for (auto &&x : this)
@@ -3636,7 +4124,7 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on method layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            set_filter_from(oMethodFeatures, pGeometryMethodFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -3658,7 +4146,7 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         OGRGeometryUniquePtr geom(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oMethodFeatures)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -3716,6 +4204,9 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
 
     // restore filter on method layer and add features based on it
     pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
+    ret = oInputFeatures.Init(papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
     for (auto &&x : pLayerMethod)
     {
 
@@ -3737,7 +4228,7 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on input layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(this, pGeometryInputFilter, x.get());
+            set_filter_from(oInputFeatures, pGeometryInputFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -3759,7 +4250,7 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         OGRGeometryUniquePtr geom(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : this)
+        for (OGRFeature *y : oInputFeatures)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -3870,6 +4361,12 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer (and of this layer, when
+ *     processing the features of the method layer) in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::SymDifference().
@@ -3957,6 +4454,11 @@ OGRErr OGR_L_SymDifference(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Identity().
@@ -3991,6 +4493,7 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    OGRLayerOverlayFeatures oMethodFeatures(pLayerMethod);
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
@@ -4038,6 +4541,9 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    ret = oMethodFeatures.Init(papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
 
     // split the features in input layer to the result layer
     for (auto &&x : this)
@@ -4061,7 +4567,7 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on method layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            set_filter_from(oMethodFeatures, pGeometryMethodFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -4080,11 +4586,12 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             continue;
         }
 
-        OGRPreparedGeometryUniquePtr x_prepared_geom;
+        OGRPreparedGeometryUniquePtr x_prepared_geom_holder;
+        OGRPreparedGeometry *x_prepared_geom = nullptr;
         if (bUsePreparedGeometries)
         {
-            x_prepared_geom.reset(
-                OGRCreatePreparedGeometry(OGRGeometry::ToHandle(x_geom)));
+            x_prepared_geom = oMethodFeatures.GetPreparedGeometry(
+                x_geom, x_prepared_geom_holder);
             if (!x_prepared_geom)
             {
                 goto done;
@@ -4094,7 +4601,7 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         OGRGeometryUniquePtr x_geom_diff(
             x_geom
                 ->clone());  // this will be the geometry of the result feature
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oMethodFeatures)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -4102,7 +4609,7 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
 
             CPLErrorReset();
             if (x_prepared_geom &&
-                !(OGRPreparedGeometryIntersects(x_prepared_geom.get(),
+                !(OGRPreparedGeometryIntersects(x_prepared_geom,
                                                 OGRGeometry::ToHandle(y_geom))))
             {
                 if (CPLGetLastErrorType() == CE_None)
@@ -4151,7 +4658,7 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             {
                 OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
                 z->SetFieldsFrom(x.get(), mapInput);
-                z->SetFieldsFrom(y.get(), mapMethod);
+                z->SetFieldsFrom(y, mapMethod);
                 if (bPromoteToMulti)
                     poIntersection.reset(
                         promote_to_multi(poIntersection.release()));
@@ -4195,7 +4702,8 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             }
         }
 
-        x_prepared_geom.reset();
+        x_prepared_geom = nullptr;
+        x_prepared_geom_holder.reset();
 
         if (x_geom_diff == nullptr || x_geom_diff->IsEmpty())
         {
@@ -4283,6 +4791,11 @@ done:
  *     result features with lower dimension geometry that would
  *     otherwise be added to the result layer. The default is to add
  *     but only if the result layer has an unknown geometry type.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Identity().
@@ -4362,6 +4875,11 @@ OGRErr OGR_L_Identity(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Update().
@@ -4396,6 +4914,7 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnMethod = pLayerMethod->GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    OGRLayerOverlayFeatures oMethodFeatures(pLayerMethod);
     int *mapInput = nullptr;
     int *mapMethod = nullptr;
     double progress_max =
@@ -4429,6 +4948,9 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    ret = oMethodFeatures.Init(papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
 
     // add clipped features from the input layer
     for (auto &&x : this)
@@ -4452,7 +4974,7 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on method layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            set_filter_from(oMethodFeatures, pGeometryMethodFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -4473,7 +4995,7 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
 
         OGRGeometryUniquePtr x_geom_diff(
             x_geom->clone());  // this will be the geometry of a result feature
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oMethodFeatures)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -4627,6 +5149,11 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Update().
@@ -4699,6 +5226,11 @@ OGRErr OGR_L_Update(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Clip().
@@ -4732,6 +5264,7 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnInput = GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    OGRLayerOverlayFeatures oMethodFeatures(pLayerMethod);
     int *mapInput = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
@@ -4759,6 +5292,9 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
 
     poDefnResult = pLayerResult->GetLayerDefn();
+    ret = oMethodFeatures.Init(papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
     for (auto &&x : this)
     {
 
@@ -4780,7 +5316,7 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on method layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            set_filter_from(oMethodFeatures, pGeometryMethodFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -4802,7 +5338,7 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         OGRGeometryUniquePtr
             geom;  // this will be the geometry of the result feature
         // incrementally add area from y to geom
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oMethodFeatures)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -4924,6 +5460,11 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Clip().
@@ -4996,6 +5537,11 @@ OGRErr OGR_L_Clip(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This method is the same as the C function OGR_L_Erase().
@@ -5029,6 +5575,7 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     OGRFeatureDefn *poDefnInput = GetLayerDefn();
     OGRFeatureDefn *poDefnResult = nullptr;
     OGRGeometry *pGeometryMethodFilter = nullptr;
+    OGRLayerOverlayFeatures oMethodFeatures(pLayerMethod);
     int *mapInput = nullptr;
     double progress_max = static_cast<double>(GetFeatureCount(FALSE));
     double progress_counter = 0;
@@ -5056,6 +5603,9 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     if (ret != OGRERR_NONE)
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
+    ret = oMethodFeatures.Init(papszOptions);
+    if (ret != OGRERR_NONE)
+        goto done;
 
     for (auto &&x : this)
     {
@@ -5078,7 +5628,7 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         // set up the filter on the method layer
         CPLErrorReset();
         OGRGeometry *x_geom =
-            set_filter_from(pLayerMethod, pGeometryMethodFilter, x.get());
+            set_filter_from(oMethodFeatures, pGeometryMethodFilter, x.get());
         if (CPLGetLastErrorType() != CE_None)
         {
             if (!bSkipFailures)
@@ -5101,7 +5651,7 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
             x_geom
                 ->clone());  // this will be the geometry of the result feature
         // incrementally erase y from geom
-        for (auto &&y : pLayerMethod)
+        for (OGRFeature *y : oMethodFeatures)
         {
             OGRGeometry *y_geom = y->GetGeometryRef();
             if (!y_geom)
@@ -5200,6 +5750,11 @@ done:
  *     will be created from the fields of the input layer.
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
+ * <li>IN_MEMORY_SPATIAL_INDEX=YES/NO. Set to YES to load the features
+ *     of the method layer in memory, with an index
+ *     on their envelope, instead of setting a spatial filter on it for each
+ *     feature of the other layer. Defaults to YES when the layer does not
+ *     have the OLCFastSpatialFilter capability. (GDAL >= 3.10)
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Erase().
@@ -5310,7 +5865,11 @@ OGRFeatureUniquePtr &OGRLayer::FeatureIterator::operator*()
 
 OGRLayer::FeatureIterator &OGRLayer::FeatureIterator::operator++()
 {
-    m_poPrivate->m_poFeature.reset(m_poPrivate->m_poLayer->GetNextFeature());
+    // The previous feature would be destroyed anyway, so recycle it if the
+    // driver supports it.
+    m_poPrivate->m_poFeature.reset(
+        m_poPrivate->m_poLayer->GetNextFeatureReusing(
+            m_poPrivate->m_poFeature.release()));
     m_poPrivate->m_bEOF = m_poPrivate->m_poFeature == nullptr;
     return *this;
 }
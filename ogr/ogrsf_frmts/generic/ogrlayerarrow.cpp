@@ -362,6 +362,230 @@ static void AddDictToSchema(struct ArrowSchema *psChild,
         psChildDict->flags = ARROW_FLAG_NULLABLE;
 }
 
+/************************************************************************/
+/*                IsGeoArrowGeometryEncodingRequested()                 */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+/** Return whether the GEOMETRY_ENCODING=GEOARROW option has been passed to
+ * GetArrowStream().
+ *
+ * Drivers with a custom GetNextArrowArray() implementation that only
+ * generate WKB geometries should defer to OGRLayer::GetNextArrowArray() when
+ * this returns true.
+ */
+bool OGRLayer::IsGeoArrowGeometryEncodingRequested() const
+{
+    return EQUAL(
+        m_aosArrowArrayStreamOptions.FetchNameValueDef("GEOMETRY_ENCODING", ""),
+        "GEOARROW");
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                     GetGeoArrowExtensionName()                       */
+/************************************************************************/
+
+// Return the name of the GeoArrow native encoding matching eGType, or
+// nullptr if that geometry type has no GeoArrow native encoding.
+static const char *GetGeoArrowExtensionName(OGRwkbGeometryType eGType)
+{
+    switch (wkbFlatten(eGType))
+    {
+        case wkbPoint:
+            return EXTENSION_NAME_GEOARROW_POINT;
+        case wkbLineString:
+            return EXTENSION_NAME_GEOARROW_LINESTRING;
+        case wkbPolygon:
+            return EXTENSION_NAME_GEOARROW_POLYGON;
+        case wkbMultiPoint:
+            return EXTENSION_NAME_GEOARROW_MULTIPOINT;
+        case wkbMultiLineString:
+            return EXTENSION_NAME_GEOARROW_MULTILINESTRING;
+        case wkbMultiPolygon:
+            return EXTENSION_NAME_GEOARROW_MULTIPOLYGON;
+        default:
+            break;
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                     GetGeoArrowNestingLevels()                       */
+/************************************************************************/
+
+// Return the number of list levels above the coordinate array.
+static int GetGeoArrowNestingLevels(OGRwkbGeometryType eGType)
+{
+    switch (wkbFlatten(eGType))
+    {
+        case wkbLineString:
+        case wkbMultiPoint:
+            return 1;
+        case wkbPolygon:
+        case wkbMultiLineString:
+            return 2;
+        case wkbMultiPolygon:
+            return 3;
+        default:
+            break;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                     GetGeoArrowListChildName()                       */
+/************************************************************************/
+
+// Return the name of the child of the list of nesting level iLevel (0 being
+// the outermost list), as recommended by the GeoArrow specification.
+static const char *GetGeoArrowListChildName(OGRwkbGeometryType eGType,
+                                            int iLevel)
+{
+    const auto eFlatType = wkbFlatten(eGType);
+    if (iLevel == GetGeoArrowNestingLevels(eFlatType) - 1)
+        return eFlatType == wkbMultiPoint ? "points" : "vertices";
+    if (eFlatType == wkbMultiPolygon && iLevel == 0)
+        return "polygons";
+    if (eFlatType == wkbMultiLineString)
+        return "linestrings";
+    return "rings";
+}
+
+/************************************************************************/
+/*                     GetGeoArrowExtensionMetadata()                   */
+/************************************************************************/
+
+// Return the value of ARROW:extension:metadata for a GeoArrow extension,
+// or an empty string if there is no CRS
+static std::string
+GetGeoArrowExtensionMetadata(const OGRGeomFieldDefn *poFieldDefn)
+{
+    std::string osExtensionMetadata;
+    const auto poSRS = poFieldDefn->GetSpatialRef();
+    if (poSRS)
+    {
+        char *pszPROJJSON = nullptr;
+        poSRS->exportToPROJJSON(&pszPROJJSON, nullptr);
+        if (pszPROJJSON)
+        {
+            osExtensionMetadata = "{\"crs\":";
+            osExtensionMetadata += pszPROJJSON;
+            osExtensionMetadata += '}';
+            CPLFree(pszPROJJSON);
+        }
+        else
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Cannot export CRS of geometry field %s to PROJJSON",
+                     poFieldDefn->GetNameRef());
+        }
+    }
+    return osExtensionMetadata;
+}
+
+/************************************************************************/
+/*                CreateSchemaForGeoArrowGeometryColumn()               */
+/************************************************************************/
+
+// Return a ArrowSchema* corresponding to the GeoArrow native (separated
+// coordinates) encoding of a geometry column, whose geometry type must be
+// one for which GetGeoArrowExtensionName() returns a non-null value.
+static struct ArrowSchema *
+CreateSchemaForGeoArrowGeometryColumn(const OGRGeomFieldDefn *poFieldDefn)
+{
+    const auto eGType = poFieldDefn->GetType();
+    const char *pszExtensionName = GetGeoArrowExtensionName(eGType);
+    CPLAssert(pszExtensionName);
+    const int nLevels = GetGeoArrowNestingLevels(eGType);
+
+    const auto CreateSchema = [](const char *pszName, const char *pszFormat)
+    {
+        auto psSchema = static_cast<struct ArrowSchema *>(
+            CPLCalloc(1, sizeof(struct ArrowSchema)));
+        psSchema->release = OGRLayerDefaultReleaseSchema;
+        psSchema->name = CPLStrdup(pszName);
+        psSchema->format = pszFormat;
+        return psSchema;
+    };
+
+    const char *pszGeomFieldName = poFieldDefn->GetNameRef();
+    if (pszGeomFieldName[0] == '\0')
+        pszGeomFieldName = OGRLayer::DEFAULT_ARROW_GEOMETRY_NAME;
+
+    std::vector<const char *> apszCoordNames{"x", "y"};
+    if (OGR_GT_HasZ(eGType))
+        apszCoordNames.push_back("z");
+    if (OGR_GT_HasM(eGType))
+        apszCoordNames.push_back("m");
+
+    auto psSchema = CreateSchema(
+        nLevels == 0 ? pszGeomFieldName
+                     : GetGeoArrowListChildName(eGType, nLevels - 1),
+        "+s");
+    psSchema->n_children = static_cast<int64_t>(apszCoordNames.size());
+    psSchema->children = static_cast<struct ArrowSchema **>(
+        CPLCalloc(apszCoordNames.size(), sizeof(struct ArrowSchema *)));
+    for (size_t i = 0; i < apszCoordNames.size(); ++i)
+        psSchema->children[i] = CreateSchema(apszCoordNames[i], "g");
+
+    for (int iLevel = nLevels - 1; iLevel >= 0; --iLevel)
+    {
+        auto psListSchema = CreateSchema(
+            iLevel == 0 ? pszGeomFieldName
+                        : GetGeoArrowListChildName(eGType, iLevel - 1),
+            "+l");
+        psListSchema->n_children = 1;
+        psListSchema->children = static_cast<struct ArrowSchema **>(
+            CPLCalloc(1, sizeof(struct ArrowSchema *)));
+        psListSchema->children[0] = psSchema;
+        psSchema = psListSchema;
+    }
+
+    if (poFieldDefn->IsNullable())
+        psSchema->flags = ARROW_FLAG_NULLABLE;
+
+    std::vector<std::pair<std::string, std::string>> oMetadata;
+    oMetadata.emplace_back(ARROW_EXTENSION_NAME_KEY, pszExtensionName);
+    const std::string osExtensionMetadata =
+        GetGeoArrowExtensionMetadata(poFieldDefn);
+    if (!osExtensionMetadata.empty())
+    {
+        oMetadata.emplace_back(ARROW_EXTENSION_METADATA_KEY,
+                               osExtensionMetadata);
+    }
+
+    size_t nLen = sizeof(int32_t);
+    for (const auto &oPair : oMetadata)
+    {
+        nLen += sizeof(int32_t) + oPair.first.size() + sizeof(int32_t) +
+                oPair.second.size();
+    }
+    char *pszMetadata = static_cast<char *>(CPLMalloc(nLen));
+    psSchema->metadata = pszMetadata;
+    size_t offsetMD = 0;
+    int32_t nSize = static_cast<int32_t>(oMetadata.size());
+    memcpy(pszMetadata + offsetMD, &nSize, sizeof(nSize));
+    offsetMD += sizeof(int32_t);
+    for (const auto &oPair : oMetadata)
+    {
+        for (const std::string *posStr : {&oPair.first, &oPair.second})
+        {
+            nSize = static_cast<int32_t>(posStr->size());
+            memcpy(pszMetadata + offsetMD, &nSize, sizeof(nSize));
+            offsetMD += sizeof(int32_t);
+            memcpy(pszMetadata + offsetMD, posStr->data(), posStr->size());
+            offsetMD += posStr->size();
+        }
+    }
+    CPLAssert(offsetMD == nLen);
+    CPL_IGNORE_RET_VAL(offsetMD);
+
+    return psSchema;
+}
+
 /************************************************************************/
 /*                     DefaultGetArrowSchema()                          */
 /************************************************************************/
@@ -673,6 +897,16 @@ int OGRLayer::GetArrowSchema(struct ArrowArrayStream *,
                      "Unsupported GEOMETRY_METADATA_ENCODING value: %s",
                      pszGeometryMetadataEncoding);
     }
+    const char *pszGeometryEncoding =
+        m_aosArrowArrayStreamOptions.FetchNameValue("GEOMETRY_ENCODING");
+    if (pszGeometryEncoding && !EQUAL(pszGeometryEncoding, "WKB") &&
+        !EQUAL(pszGeometryEncoding, "GEOARROW"))
+    {
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "Unsupported GEOMETRY_ENCODING value: %s",
+                 pszGeometryEncoding);
+    }
+    const bool bGeoArrowEncoding = IsGeoArrowGeometryEncodingRequested();
     for (int i = 0; i < nGeomFieldCount; ++i)
     {
         const auto poFieldDefn = poLayerDefn->GetGeomFieldDefn(i);
@@ -681,8 +915,18 @@ int OGRLayer::GetArrowSchema(struct ArrowArrayStream *,
             continue;
         }
 
-        out_schema->children[iSchemaChild] = CreateSchemaForWKBGeometryColumn(
-            poFieldDefn, "z", pszExtensionName);
+        if (bGeoArrowEncoding &&
+            GetGeoArrowExtensionName(poFieldDefn->GetType()) != nullptr)
+        {
+            out_schema->children[iSchemaChild] =
+                CreateSchemaForGeoArrowGeometryColumn(poFieldDefn);
+        }
+        else
+        {
+            out_schema->children[iSchemaChild] =
+                CreateSchemaForWKBGeometryColumn(poFieldDefn, "z",
+                                                 pszExtensionName);
+        }
 
         ++iSchemaChild;
     }
@@ -729,25 +973,7 @@ OGRLayer::CreateSchemaForWKBGeometryColumn(const OGRGeomFieldDefn *poFieldDefn,
     std::string osExtensionMetadata;
     if (EQUAL(pszExtensionName, EXTENSION_NAME_GEOARROW_WKB))
     {
-        const auto poSRS = poFieldDefn->GetSpatialRef();
-        if (poSRS)
-        {
-            char *pszPROJJSON = nullptr;
-            poSRS->exportToPROJJSON(&pszPROJJSON, nullptr);
-            if (pszPROJJSON)
-            {
-                osExtensionMetadata = "{\"crs\":";
-                osExtensionMetadata += pszPROJJSON;
-                osExtensionMetadata += '}';
-                CPLFree(pszPROJJSON);
-            }
-            else
-            {
-                CPLError(CE_Warning, CPLE_AppDefined,
-                         "Cannot export CRS of geometry field %s to PROJJSON",
-                         poFieldDefn->GetNameRef());
-            }
-        }
+        osExtensionMetadata = GetGeoArrowExtensionMetadata(poFieldDefn);
     }
     size_t nLen = sizeof(int32_t) + sizeof(int32_t) +
                   strlen(ARROW_EXTENSION_NAME_KEY) + sizeof(int32_t) +
@@ -1642,369 +1868,763 @@ FillWKBGeometryArray(struct ArrowArray *psChild,
 }
 
 /************************************************************************/
-/*                        FillDateArray()                               */
+/*                     FillGeoArrowGeometryArray()                      */
 /************************************************************************/
 
-static bool FillDateArray(struct ArrowArray *psChild,
-                          std::deque<std::unique_ptr<OGRFeature>> &apoFeatures,
-                          const size_t nFeatureCountLimit,
-                          const bool bIsNullable, const int i)
+namespace
 {
-    psChild->n_buffers = 2;
-    psChild->buffers = static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
-    uint8_t *pabyValidity = nullptr;
-    int32_t *panValues = static_cast<int32_t *>(
-        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(int32_t) * nFeatureCountLimit));
-    if (panValues == nullptr)
-        return false;
-    psChild->buffers[1] = panValues;
-    for (size_t iFeat = 0; iFeat < nFeatureCountLimit; ++iFeat)
+// Accumulates the coordinates and list offsets of the GeoArrow native
+// encoding of geometries of a given type.
+struct GeoArrowArrayBuilder
+{
+    const OGRwkbGeometryType m_eFlatType;
+    const bool m_bHasZ;
+    const bool m_bHasM;
+    std::vector<double> m_adfX{};
+    std::vector<double> m_adfY{};
+    std::vector<double> m_adfZ{};
+    std::vector<double> m_adfM{};
+    // m_aanOffsets[i] are the offsets of the list of nesting level i,
+    // 0 being the outermost one.
+    std::vector<std::vector<int32_t>> m_aanOffsets;
+
+    explicit GeoArrowArrayBuilder(OGRwkbGeometryType eGType)
+        : m_eFlatType(wkbFlatten(eGType)),
+          m_bHasZ(CPL_TO_BOOL(OGR_GT_HasZ(eGType))),
+          m_bHasM(CPL_TO_BOOL(OGR_GT_HasM(eGType))),
+          m_aanOffsets(GetGeoArrowNestingLevels(eGType),
+                       std::vector<int32_t>{0})
     {
-        auto &poFeature = apoFeatures[iFeat];
-        const auto psRawField = poFeature->GetRawFieldRef(i);
-        if (IsValidField(psRawField))
-        {
-            struct tm brokenDown;
-            memset(&brokenDown, 0, sizeof(brokenDown));
-            brokenDown.tm_year = psRawField->Date.Year - 1900;
-            brokenDown.tm_mon = psRawField->Date.Month - 1;
-            brokenDown.tm_mday = psRawField->Date.Day;
-            panValues[iFeat] =
-                static_cast<int>(CPLYMDHMSToUnixTime(&brokenDown) / 86400);
-        }
-        else if (bIsNullable)
+    }
+
+    int GetDimCount() const
+    {
+        return 2 + (m_bHasZ ? 1 : 0) + (m_bHasM ? 1 : 0);
+    }
+
+    size_t GetMemSize() const
+    {
+        size_t nSize = m_adfX.size() * GetDimCount() * sizeof(double);
+        for (const auto &anOffsets : m_aanOffsets)
+            nSize += anOffsets.size() * sizeof(int32_t);
+        return nSize;
+    }
+
+    struct State
+    {
+        size_t nCoordCount = 0;
+        std::vector<size_t> anOffsetCount{};
+    };
+
+    State GetState() const
+    {
+        State sState;
+        sState.nCoordCount = m_adfX.size();
+        for (const auto &anOffsets : m_aanOffsets)
+            sState.anOffsetCount.push_back(anOffsets.size());
+        return sState;
+    }
+
+    void RestoreState(const State &sState)
+    {
+        m_adfX.resize(sState.nCoordCount);
+        m_adfY.resize(sState.nCoordCount);
+        if (m_bHasZ)
+            m_adfZ.resize(sState.nCoordCount);
+        if (m_bHasM)
+            m_adfM.resize(sState.nCoordCount);
+        for (size_t i = 0; i < m_aanOffsets.size(); ++i)
+            m_aanOffsets[i].resize(sState.anOffsetCount[i]);
+    }
+
+    // Close the current element of the list of nesting level iLevel
+    void EndListElement(int iLevel)
+    {
+        const size_t nChildCount =
+            static_cast<size_t>(iLevel + 1) == m_aanOffsets.size()
+                ? m_adfX.size()
+                : m_aanOffsets[iLevel + 1].size() - 1;
+        m_aanOffsets[iLevel].push_back(static_cast<int32_t>(nChildCount));
+    }
+
+    void AddPoint(const OGRPoint *poPoint)
+    {
+        if (poPoint->IsEmpty())
         {
-            panValues[iFeat] = 0;
-            ++psChild->null_count;
-            if (pabyValidity == nullptr)
-            {
-                pabyValidity = AllocValidityBitmap(nFeatureCountLimit);
-                psChild->buffers[0] = pabyValidity;
-                if (pabyValidity == nullptr)
-                    return false;
-            }
-            UnsetBit(pabyValidity, iFeat);
+            // Empty points are encoded with NaN coordinates
+            constexpr double dfNaN = std::numeric_limits<double>::quiet_NaN();
+            m_adfX.push_back(dfNaN);
+            m_adfY.push_back(dfNaN);
+            if (m_bHasZ)
+                m_adfZ.push_back(dfNaN);
+            if (m_bHasM)
+                m_adfM.push_back(dfNaN);
         }
         else
         {
-            panValues[iFeat] = 0;
+            m_adfX.push_back(poPoint->getX());
+            m_adfY.push_back(poPoint->getY());
+            if (m_bHasZ)
+                m_adfZ.push_back(poPoint->getZ());
+            if (m_bHasM)
+                m_adfM.push_back(poPoint->getM());
         }
     }
-    return true;
-}
 
-/************************************************************************/
-/*                        FillTimeArray()                               */
-/************************************************************************/
+    void AddSimpleCurve(const OGRSimpleCurve *poCurve)
+    {
+        const size_t nOldSize = m_adfX.size();
+        const size_t nPoints = static_cast<size_t>(poCurve->getNumPoints());
+        if (nPoints == 0)
+            return;
+        m_adfX.resize(nOldSize + nPoints);
+        m_adfY.resize(nOldSize + nPoints);
+        if (m_bHasZ)
+            m_adfZ.resize(nOldSize + nPoints);
+        if (m_bHasM)
+            m_adfM.resize(nOldSize + nPoints);
+        poCurve->getPoints(m_adfX.data() + nOldSize, sizeof(double),
+                           m_adfY.data() + nOldSize, sizeof(double),
+                           m_bHasZ ? m_adfZ.data() + nOldSize : nullptr,
+                           sizeof(double),
+                           m_bHasM ? m_adfM.data() + nOldSize : nullptr,
+                           sizeof(double));
+    }
 
-static bool FillTimeArray(struct ArrowArray *psChild,
-                          std::deque<std::unique_ptr<OGRFeature>> &apoFeatures,
-                          const size_t nFeatureCountLimit,
-                          const bool bIsNullable, const int i)
-{
-    psChild->n_buffers = 2;
-    psChild->buffers = static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
-    uint8_t *pabyValidity = nullptr;
-    int32_t *panValues = static_cast<int32_t *>(
-        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(int32_t) * nFeatureCountLimit));
-    if (panValues == nullptr)
-        return false;
-    psChild->buffers[1] = panValues;
-    for (size_t iFeat = 0; iFeat < nFeatureCountLimit; ++iFeat)
+    void AddPolygon(const OGRPolygon *poPolygon, int iLevel)
     {
-        auto &poFeature = apoFeatures[iFeat];
-        const auto psRawField = poFeature->GetRawFieldRef(i);
-        if (IsValidField(psRawField))
+        for (const auto *poRing : *poPolygon)
         {
-            panValues[iFeat] =
-                psRawField->Date.Hour * 3600000 +
-                psRawField->Date.Minute * 60000 +
-                static_cast<int>(psRawField->Date.Second * 1000 + 0.5);
+            AddSimpleCurve(poRing);
+            EndListElement(iLevel + 1);
         }
-        else if (bIsNullable)
+        EndListElement(iLevel);
+    }
+
+    void AddNull()
+    {
+        if (m_eFlatType == wkbPoint)
         {
-            panValues[iFeat] = 0;
-            ++psChild->null_count;
-            if (pabyValidity == nullptr)
-            {
-                pabyValidity = AllocValidityBitmap(nFeatureCountLimit);
-                psChild->buffers[0] = pabyValidity;
-                if (pabyValidity == nullptr)
-                    return false;
-            }
-            UnsetBit(pabyValidity, iFeat);
+            m_adfX.push_back(0);
+            m_adfY.push_back(0);
+            if (m_bHasZ)
+                m_adfZ.push_back(0);
+            if (m_bHasM)
+                m_adfM.push_back(0);
         }
         else
         {
-            panValues[iFeat] = 0;
+            EndListElement(0);
         }
     }
-    return true;
-}
-
-/************************************************************************/
-/*                       FillDateTimeArray()                            */
-/************************************************************************/
 
-static bool
-FillDateTimeArray(struct ArrowArray *psChild,
-                  std::deque<std::unique_ptr<OGRFeature>> &apoFeatures,
-                  const size_t nFeatureCountLimit, const bool bIsNullable,
-                  const int i, int nFieldTZFlag)
-{
-    psChild->n_buffers = 2;
-    psChild->buffers = static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
-    uint8_t *pabyValidity = nullptr;
-    int64_t *panValues = static_cast<int64_t *>(
-        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(int64_t) * nFeatureCountLimit));
-    if (panValues == nullptr)
-        return false;
-    psChild->buffers[1] = panValues;
-    struct tm brokenDown;
-    memset(&brokenDown, 0, sizeof(brokenDown));
-    for (size_t iFeat = 0; iFeat < nFeatureCountLimit; ++iFeat)
+    // Return false if the geometry type is not compatible of the one of
+    // the column.
+    bool AddGeometry(const OGRGeometry *poGeom)
     {
-        auto &poFeature = apoFeatures[iFeat];
-        const auto psRawField = poFeature->GetRawFieldRef(i);
-        if (IsValidField(psRawField))
+        const auto eGeomFlatType = wkbFlatten(poGeom->getGeometryType());
+        switch (m_eFlatType)
         {
-            brokenDown.tm_year = psRawField->Date.Year - 1900;
-            brokenDown.tm_mon = psRawField->Date.Month - 1;
-            brokenDown.tm_mday = psRawField->Date.Day;
-            brokenDown.tm_hour = psRawField->Date.Hour;
-            brokenDown.tm_min = psRawField->Date.Minute;
-            brokenDown.tm_sec = static_cast<int>(psRawField->Date.Second);
-            auto nVal =
-                CPLYMDHMSToUnixTime(&brokenDown) * 1000 +
-                (static_cast<int>(psRawField->Date.Second * 1000 + 0.5) % 1000);
-            if (nFieldTZFlag > OGR_TZFLAG_MIXED_TZ &&
-                psRawField->Date.TZFlag > OGR_TZFLAG_MIXED_TZ)
+            case wkbPoint:
             {
-                // Convert for psRawField->Date.TZFlag to nFieldTZFlag
-                const int TZOffset =
-                    (psRawField->Date.TZFlag - nFieldTZFlag) * 15;
-                const int TZOffsetMS = TZOffset * 60 * 1000;
-                nVal -= TZOffsetMS;
+                if (eGeomFlatType != wkbPoint)
+                    return false;
+                AddPoint(poGeom->toPoint());
+                return true;
             }
-            else if (nFieldTZFlag == OGR_TZFLAG_MIXED_TZ &&
-                     psRawField->Date.TZFlag > OGR_TZFLAG_MIXED_TZ)
+
+            case wkbLineString:
             {
-                // Convert for psRawField->Date.TZFlag to UTC
-                const int TZOffset =
-                    (psRawField->Date.TZFlag - OGR_TZFLAG_UTC) * 15;
-                const int TZOffsetMS = TZOffset * 60 * 1000;
-                nVal -= TZOffsetMS;
+                if (eGeomFlatType != wkbLineString)
+                    return false;
+                AddSimpleCurve(poGeom->toLineString());
+                EndListElement(0);
+                return true;
             }
-            panValues[iFeat] = nVal;
-        }
-        else if (bIsNullable)
-        {
-            panValues[iFeat] = 0;
-            ++psChild->null_count;
-            if (pabyValidity == nullptr)
+
+            case wkbPolygon:
             {
-                pabyValidity = AllocValidityBitmap(nFeatureCountLimit);
-                psChild->buffers[0] = pabyValidity;
-                if (pabyValidity == nullptr)
+                if (eGeomFlatType != wkbPolygon)
                     return false;
+                AddPolygon(poGeom->toPolygon(), 0);
+                return true;
             }
-            UnsetBit(pabyValidity, iFeat);
-        }
-        else
-        {
-            panValues[iFeat] = 0;
-        }
-    }
-    return true;
-}
 
-/************************************************************************/
-/*                          GetNextArrowArray()                         */
-/************************************************************************/
+            case wkbMultiPoint:
+            {
+                if (eGeomFlatType == wkbPoint)
+                {
+                    if (!poGeom->IsEmpty())
+                        AddPoint(poGeom->toPoint());
+                }
+                else if (eGeomFlatType == wkbMultiPoint)
+                {
+                    for (const auto *poPoint : *(poGeom->toMultiPoint()))
+                        AddPoint(poPoint);
+                }
+                else
+                {
+                    return false;
+                }
+                EndListElement(0);
+                return true;
+            }
 
-/** Default implementation of the ArrowArrayStream::get_next() callback.
- *
- * To be used by driver implementations that have a custom GetArrowStream()
- * implementation.
- *
- * @since GDAL 3.6
- */
-int OGRLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
-                                struct ArrowArray *out_array)
-{
-    ArrowArrayStreamPrivateDataSharedDataWrapper *poPrivate =
-        static_cast<ArrowArrayStreamPrivateDataSharedDataWrapper *>(
-            stream->private_data);
+            case wkbMultiLineString:
+            {
+                if (eGeomFlatType == wkbLineString)
+                {
+                    if (!poGeom->IsEmpty())
+                    {
+                        AddSimpleCurve(poGeom->toLineString());
+                        EndListElement(1);
+                    }
+                }
+                else if (eGeomFlatType == wkbMultiLineString)
+                {
+                    for (const auto *poLS : *(poGeom->toMultiLineString()))
+                    {
+                        AddSimpleCurve(poLS);
+                        EndListElement(1);
+                    }
+                }
+                else
+                {
+                    return false;
+                }
+                EndListElement(0);
+                return true;
+            }
 
-    const bool bIncludeFID = CPLTestBool(
-        m_aosArrowArrayStreamOptions.FetchNameValueDef("INCLUDE_FID", "YES"));
-    int nMaxBatchSize = atoi(m_aosArrowArrayStreamOptions.FetchNameValueDef(
-        "MAX_FEATURES_IN_BATCH", "65536"));
-    if (nMaxBatchSize <= 0)
-        nMaxBatchSize = 1;
-    if (nMaxBatchSize > INT_MAX - 1)
-        nMaxBatchSize = INT_MAX - 1;
+            case wkbMultiPolygon:
+            {
+                if (eGeomFlatType == wkbPolygon)
+                {
+                    if (!poGeom->IsEmpty())
+                        AddPolygon(poGeom->toPolygon(), 1);
+                }
+                else if (eGeomFlatType == wkbMultiPolygon)
+                {
+                    for (const auto *poPoly : *(poGeom->toMultiPolygon()))
+                        AddPolygon(poPoly, 1);
+                }
+                else
+                {
+                    return false;
+                }
+                EndListElement(0);
+                return true;
+            }
 
-    auto &oFeatureQueue =
-        m_poSharedArrowArrayStreamPrivateData->m_oFeatureQueue;
+            default:
+                break;
+        }
+        return false;
+    }
+};
+}  // namespace
 
-    memset(out_array, 0, sizeof(*out_array));
+template <class T>
+static const void *CopyToAlignedBuffer(const std::vector<T> &aValues)
+{
+    // Allocate at least one byte, so that a nullptr return can only mean
+    // an allocation failure.
+    void *pBuffer = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
+        std::max<size_t>(1, aValues.size() * sizeof(T)));
+    if (pBuffer && !aValues.empty())
+        memcpy(pBuffer, aValues.data(), aValues.size() * sizeof(T));
+    return pBuffer;
+}
 
-    auto poLayerDefn = GetLayerDefn();
-    const int nFieldCount = poLayerDefn->GetFieldCount();
-    const int nGeomFieldCount = poLayerDefn->GetGeomFieldCount();
-    const int nMaxChildren =
-        (bIncludeFID ? 1 : 0) + nFieldCount + nGeomFieldCount;
-    int iSchemaChild = 0;
+static size_t
+FillGeoArrowGeometryArray(struct ArrowArray *psChild,
+                          std::deque<std::unique_ptr<OGRFeature>> &apoFeatures,
+                          const size_t nFeatureCountLimit,
+                          const OGRGeomFieldDefn *poFieldDefn, const int i,
+                          const size_t nMemLimit)
+{
+    const auto eColumnGType = poFieldDefn->GetType();
+    GeoArrowArrayBuilder oBuilder(eColumnGType);
+    uint8_t *pabyValidity = nullptr;
 
-    if (!m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty())
+    size_t nFeatCount = 0;
+    for (size_t iFeat = 0; iFeat < nFeatureCountLimit; ++iFeat, ++nFeatCount)
     {
-        if (poPrivate->poShared->m_bEOF)
-        {
-            return 0;
-        }
-        if (m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS == 0)
+        const auto sState = oBuilder.GetState();
+        const auto poGeom = apoFeatures[iFeat]->GetGeomFieldRef(i);
+        bool bIsNull = poGeom == nullptr;
+        if (!bIsNull && !oBuilder.AddGeometry(poGeom))
         {
-            CPLDebug("OGR", "Using fast FID filtering");
+            oBuilder.RestoreState(sState);
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Geometry of type %s found, whereas %s is expected. "
+                     "Writing null geometry",
+                     OGRGeometryTypeToName(poGeom->getGeometryType()),
+                     OGRGeometryTypeToName(eColumnGType));
+            bIsNull = true;
         }
-        while (
-            oFeatureQueue.size() < static_cast<size_t>(nMaxBatchSize) &&
-            m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS <
-                m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.size())
+        if (bIsNull)
+            oBuilder.AddNull();
+
+        if (oBuilder.GetMemSize() > nMemLimit)
         {
-            const auto nFID =
-                m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs
-                    [m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS];
-            auto poFeature = std::unique_ptr<OGRFeature>(GetFeature(nFID));
-            ++m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS;
-            if (poFeature && (m_poFilterGeom == nullptr ||
-                              FilterGeometry(poFeature->GetGeomFieldRef(
-                                  m_iGeomFieldFilter))))
+            if (nFeatCount == 0)
             {
-                oFeatureQueue.emplace_back(std::move(poFeature));
+                VSIFreeAligned(pabyValidity);
+                return 0;
             }
+            oBuilder.RestoreState(sState);
+            break;
         }
-        if (m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS ==
-            m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.size())
-        {
-            poPrivate->poShared->m_bEOF = true;
-        }
-    }
-    else if (!poPrivate->poShared->m_bEOF)
-    {
-        while (oFeatureQueue.size() < static_cast<size_t>(nMaxBatchSize))
+
+        if (bIsNull)
         {
-            auto poFeature = std::unique_ptr<OGRFeature>(GetNextFeature());
-            if (!poFeature)
+            ++psChild->null_count;
+            if (pabyValidity == nullptr)
             {
-                poPrivate->poShared->m_bEOF = true;
-                break;
+                pabyValidity = AllocValidityBitmap(nFeatureCountLimit);
+                if (pabyValidity == nullptr)
+                    return 0;
             }
-            oFeatureQueue.emplace_back(std::move(poFeature));
+            UnsetBit(pabyValidity, iFeat);
         }
     }
-    if (oFeatureQueue.empty())
-    {
-        return 0;
-    }
-
-    out_array->release = OGRLayerDefaultReleaseArray;
-    out_array->null_count = 0;
-
-    out_array->n_children = nMaxChildren;
-    out_array->children = static_cast<struct ArrowArray **>(
-        CPLCalloc(nMaxChildren, sizeof(struct ArrowArray *)));
-    out_array->release = OGRLayerDefaultReleaseArray;
-    out_array->n_buffers = 1;
-    out_array->buffers =
-        static_cast<const void **>(CPLCalloc(1, sizeof(void *)));
 
-    size_t nFeatureCount = oFeatureQueue.size();
-    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
-    if (bIncludeFID)
+    const auto CreateArray = [](int nBuffers)
     {
-        out_array->children[iSchemaChild] = static_cast<struct ArrowArray *>(
+        auto psArray = static_cast<struct ArrowArray *>(
             CPLCalloc(1, sizeof(struct ArrowArray)));
-        auto psChild = out_array->children[iSchemaChild];
-        ++iSchemaChild;
-        psChild->release = OGRLayerDefaultReleaseArray;
-        psChild->n_buffers = 2;
+        psArray->release = OGRLayerDefaultReleaseArray;
+        psArray->n_buffers = nBuffers;
+        psArray->buffers = static_cast<const void **>(
+            CPLCalloc(nBuffers, sizeof(const void *)));
+        return psArray;
+    };
+
+    // Build the innermost struct array of coordinates.
+    const int nLevels = static_cast<int>(oBuilder.m_aanOffsets.size());
+    struct ArrowArray *psCoordArray = nLevels == 0 ? psChild : CreateArray(1);
+    if (nLevels == 0)
+    {
+        psChild->n_buffers = 1;
         psChild->buffers =
-            static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
-        int64_t *panValues =
-            static_cast<int64_t *>(VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
-                sizeof(int64_t) * oFeatureQueue.size()));
-        if (panValues == nullptr)
-            goto error;
-        psChild->buffers[1] = panValues;
-        for (size_t iFeat = 0; iFeat < oFeatureQueue.size(); ++iFeat)
-        {
-            panValues[iFeat] = oFeatureQueue[iFeat]->GetFID();
-        }
+            static_cast<const void **>(CPLCalloc(1, sizeof(void *)));
     }
-
-    for (int i = 0; i < nFieldCount; ++i)
+    psCoordArray->length = static_cast<int64_t>(oBuilder.m_adfX.size());
+    const int nDimCount = oBuilder.GetDimCount();
+    psCoordArray->n_children = nDimCount;
+    psCoordArray->children = static_cast<struct ArrowArray **>(
+        CPLCalloc(nDimCount, sizeof(struct ArrowArray *)));
+    bool bOK = true;
+    int iDim = 0;
+    for (const auto *padfValues : {&oBuilder.m_adfX, &oBuilder.m_adfY,
+                                   &oBuilder.m_adfZ, &oBuilder.m_adfM})
     {
-        const auto poFieldDefn = poLayerDefn->GetFieldDefn(i);
-        if (poFieldDefn->IsIgnored())
+        if ((padfValues == &oBuilder.m_adfZ && !oBuilder.m_bHasZ) ||
+            (padfValues == &oBuilder.m_adfM && !oBuilder.m_bHasM))
         {
             continue;
         }
+        auto psDimArray = CreateArray(2);
+        psCoordArray->children[iDim] = psDimArray;
+        ++iDim;
+        psDimArray->length = psCoordArray->length;
+        psDimArray->buffers[1] = CopyToAlignedBuffer(*padfValues);
+        bOK = bOK && psDimArray->buffers[1] != nullptr;
+    }
 
-        out_array->children[iSchemaChild] = static_cast<struct ArrowArray *>(
-            CPLCalloc(1, sizeof(struct ArrowArray)));
-        auto psChild = out_array->children[iSchemaChild];
-        ++iSchemaChild;
-        psChild->release = OGRLayerDefaultReleaseArray;
-        const bool bIsNullable = CPL_TO_BOOL(poFieldDefn->IsNullable());
-        const auto eSubType = poFieldDefn->GetSubType();
-        switch (poFieldDefn->GetType())
+    // Then the list arrays, from the innermost one to the outermost one
+    struct ArrowArray *psChildArray = psCoordArray;
+    for (int iLevel = nLevels - 1; iLevel >= 0; --iLevel)
+    {
+        auto psListArray = iLevel == 0 ? psChild : CreateArray(2);
+        if (iLevel == 0)
         {
-            case OFTInteger:
-            {
-                if (eSubType == OFSTBoolean)
-                {
-                    if (!FillBoolArray(psChild, oFeatureQueue, nFeatureCount,
-                                       bIsNullable, &OGRField::Integer, i))
-                        goto error;
-                }
-                else if (eSubType == OFSTInt16)
-                {
-                    if (!FillArray<int16_t>(psChild, oFeatureQueue,
-                                            nFeatureCount, bIsNullable,
-                                            &OGRField::Integer, i))
-                        goto error;
-                }
-                else
-                {
-                    if (!FillArray<int32_t>(psChild, oFeatureQueue,
-                                            nFeatureCount, bIsNullable,
-                                            &OGRField::Integer, i))
-                        goto error;
-                }
+            psChild->n_buffers = 2;
+            psChild->buffers =
+                static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
+        }
+        const auto &anOffsets = oBuilder.m_aanOffsets[iLevel];
+        psListArray->length = static_cast<int64_t>(anOffsets.size() - 1);
+        psListArray->buffers[1] = CopyToAlignedBuffer(anOffsets);
+        bOK = bOK && psListArray->buffers[1] != nullptr;
+        psListArray->n_children = 1;
+        psListArray->children = static_cast<struct ArrowArray **>(
+            CPLCalloc(1, sizeof(struct ArrowArray *)));
+        psListArray->children[0] = psChildArray;
+        psChildArray = psListArray;
+    }
 
-                const auto &osDomainName = poFieldDefn->GetDomainName();
-                if (!osDomainName.empty())
-                {
-                    auto poDS = GetDataset();
-                    if (poDS)
-                    {
-                        const auto poFieldDomain =
-                            poDS->GetFieldDomain(osDomainName);
-                        if (poFieldDomain &&
-                            poFieldDomain->GetDomainType() == OFDT_CODED)
-                        {
-                            const OGRCodedFieldDomain *poCodedDomain =
-                                static_cast<const OGRCodedFieldDomain *>(
-                                    poFieldDomain);
-                            OGRArrowArrayHelper::FillDict(psChild,
-                                                          poCodedDomain);
-                        }
-                    }
-                }
+    psChild->buffers[0] = pabyValidity;
 
-                break;
-            }
+    return bOK ? nFeatCount : 0;
+}
+
+/************************************************************************/
+/*                        FillDateArray()                               */
+/************************************************************************/
+
+static bool FillDateArray(struct ArrowArray *psChild,
+                          std::deque<std::unique_ptr<OGRFeature>> &apoFeatures,
+                          const size_t nFeatureCountLimit,
+                          const bool bIsNullable, const int i)
+{
+    psChild->n_buffers = 2;
+    psChild->buffers = static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
+    uint8_t *pabyValidity = nullptr;
+    int32_t *panValues = static_cast<int32_t *>(
+        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(int32_t) * nFeatureCountLimit));
+    if (panValues == nullptr)
+        return false;
+    psChild->buffers[1] = panValues;
+    for (size_t iFeat = 0; iFeat < nFeatureCountLimit; ++iFeat)
+    {
+        auto &poFeature = apoFeatures[iFeat];
+        const auto psRawField = poFeature->GetRawFieldRef(i);
+        if (IsValidField(psRawField))
+        {
+            struct tm brokenDown;
+            memset(&brokenDown, 0, sizeof(brokenDown));
+            brokenDown.tm_year = psRawField->Date.Year - 1900;
+            brokenDown.tm_mon = psRawField->Date.Month - 1;
+            brokenDown.tm_mday = psRawField->Date.Day;
+            panValues[iFeat] =
+                static_cast<int>(CPLYMDHMSToUnixTime(&brokenDown) / 86400);
+        }
+        else if (bIsNullable)
+        {
+            panValues[iFeat] = 0;
+            ++psChild->null_count;
+            if (pabyValidity == nullptr)
+            {
+                pabyValidity = AllocValidityBitmap(nFeatureCountLimit);
+                psChild->buffers[0] = pabyValidity;
+                if (pabyValidity == nullptr)
+                    return false;
+            }
+            UnsetBit(pabyValidity, iFeat);
+        }
+        else
+        {
+            panValues[iFeat] = 0;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        FillTimeArray()                               */
+/************************************************************************/
+
+static bool FillTimeArray(struct ArrowArray *psChild,
+                          std::deque<std::unique_ptr<OGRFeature>> &apoFeatures,
+                          const size_t nFeatureCountLimit,
+                          const bool bIsNullable, const int i)
+{
+    psChild->n_buffers = 2;
+    psChild->buffers = static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
+    uint8_t *pabyValidity = nullptr;
+    int32_t *panValues = static_cast<int32_t *>(
+        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(int32_t) * nFeatureCountLimit));
+    if (panValues == nullptr)
+        return false;
+    psChild->buffers[1] = panValues;
+    for (size_t iFeat = 0; iFeat < nFeatureCountLimit; ++iFeat)
+    {
+        auto &poFeature = apoFeatures[iFeat];
+        const auto psRawField = poFeature->GetRawFieldRef(i);
+        if (IsValidField(psRawField))
+        {
+            panValues[iFeat] =
+                psRawField->Date.Hour * 3600000 +
+                psRawField->Date.Minute * 60000 +
+                static_cast<int>(psRawField->Date.Second * 1000 + 0.5);
+        }
+        else if (bIsNullable)
+        {
+            panValues[iFeat] = 0;
+            ++psChild->null_count;
+            if (pabyValidity == nullptr)
+            {
+                pabyValidity = AllocValidityBitmap(nFeatureCountLimit);
+                psChild->buffers[0] = pabyValidity;
+                if (pabyValidity == nullptr)
+                    return false;
+            }
+            UnsetBit(pabyValidity, iFeat);
+        }
+        else
+        {
+            panValues[iFeat] = 0;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       FillDateTimeArray()                            */
+/************************************************************************/
+
+static bool
+FillDateTimeArray(struct ArrowArray *psChild,
+                  std::deque<std::unique_ptr<OGRFeature>> &apoFeatures,
+                  const size_t nFeatureCountLimit, const bool bIsNullable,
+                  const int i, int nFieldTZFlag)
+{
+    psChild->n_buffers = 2;
+    psChild->buffers = static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
+    uint8_t *pabyValidity = nullptr;
+    int64_t *panValues = static_cast<int64_t *>(
+        VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(int64_t) * nFeatureCountLimit));
+    if (panValues == nullptr)
+        return false;
+    psChild->buffers[1] = panValues;
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+    for (size_t iFeat = 0; iFeat < nFeatureCountLimit; ++iFeat)
+    {
+        auto &poFeature = apoFeatures[iFeat];
+        const auto psRawField = poFeature->GetRawFieldRef(i);
+        if (IsValidField(psRawField))
+        {
+            brokenDown.tm_year = psRawField->Date.Year - 1900;
+            brokenDown.tm_mon = psRawField->Date.Month - 1;
+            brokenDown.tm_mday = psRawField->Date.Day;
+            brokenDown.tm_hour = psRawField->Date.Hour;
+            brokenDown.tm_min = psRawField->Date.Minute;
+            brokenDown.tm_sec = static_cast<int>(psRawField->Date.Second);
+            auto nVal =
+                CPLYMDHMSToUnixTime(&brokenDown) * 1000 +
+                (static_cast<int>(psRawField->Date.Second * 1000 + 0.5) % 1000);
+            if (nFieldTZFlag > OGR_TZFLAG_MIXED_TZ &&
+                psRawField->Date.TZFlag > OGR_TZFLAG_MIXED_TZ)
+            {
+                // Convert for psRawField->Date.TZFlag to nFieldTZFlag
+                const int TZOffset =
+                    (psRawField->Date.TZFlag - nFieldTZFlag) * 15;
+                const int TZOffsetMS = TZOffset * 60 * 1000;
+                nVal -= TZOffsetMS;
+            }
+            else if (nFieldTZFlag == OGR_TZFLAG_MIXED_TZ &&
+                     psRawField->Date.TZFlag > OGR_TZFLAG_MIXED_TZ)
+            {
+                // Convert for psRawField->Date.TZFlag to UTC
+                const int TZOffset =
+                    (psRawField->Date.TZFlag - OGR_TZFLAG_UTC) * 15;
+                const int TZOffsetMS = TZOffset * 60 * 1000;
+                nVal -= TZOffsetMS;
+            }
+            panValues[iFeat] = nVal;
+        }
+        else if (bIsNullable)
+        {
+            panValues[iFeat] = 0;
+            ++psChild->null_count;
+            if (pabyValidity == nullptr)
+            {
+                pabyValidity = AllocValidityBitmap(nFeatureCountLimit);
+                psChild->buffers[0] = pabyValidity;
+                if (pabyValidity == nullptr)
+                    return false;
+            }
+            UnsetBit(pabyValidity, iFeat);
+        }
+        else
+        {
+            panValues[iFeat] = 0;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          GetNextArrowArray()                         */
+/************************************************************************/
+
+/** Default implementation of the ArrowArrayStream::get_next() callback.
+ *
+ * To be used by driver implementations that have a custom GetArrowStream()
+ * implementation.
+ *
+ * @since GDAL 3.6
+ */
+int OGRLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                struct ArrowArray *out_array)
+{
+    ArrowArrayStreamPrivateDataSharedDataWrapper *poPrivate =
+        static_cast<ArrowArrayStreamPrivateDataSharedDataWrapper *>(
+            stream->private_data);
+
+    const bool bIncludeFID = CPLTestBool(
+        m_aosArrowArrayStreamOptions.FetchNameValueDef("INCLUDE_FID", "YES"));
+    const bool bGeoArrowEncoding = IsGeoArrowGeometryEncodingRequested();
+    int nMaxBatchSize = atoi(m_aosArrowArrayStreamOptions.FetchNameValueDef(
+        "MAX_FEATURES_IN_BATCH", "65536"));
+    if (nMaxBatchSize <= 0)
+        nMaxBatchSize = 1;
+    if (nMaxBatchSize > INT_MAX - 1)
+        nMaxBatchSize = INT_MAX - 1;
+
+    auto &oFeatureQueue =
+        m_poSharedArrowArrayStreamPrivateData->m_oFeatureQueue;
+
+    memset(out_array, 0, sizeof(*out_array));
+
+    auto poLayerDefn = GetLayerDefn();
+    const int nFieldCount = poLayerDefn->GetFieldCount();
+    const int nGeomFieldCount = poLayerDefn->GetGeomFieldCount();
+    const int nMaxChildren =
+        (bIncludeFID ? 1 : 0) + nFieldCount + nGeomFieldCount;
+    int iSchemaChild = 0;
+
+    if (!m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty())
+    {
+        if (poPrivate->poShared->m_bEOF)
+        {
+            return 0;
+        }
+        if (m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS == 0)
+        {
+            CPLDebug("OGR", "Using fast FID filtering");
+        }
+        while (
+            oFeatureQueue.size() < static_cast<size_t>(nMaxBatchSize) &&
+            m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS <
+                m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.size())
+        {
+            const auto nFID =
+                m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs
+                    [m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS];
+            auto poFeature = std::unique_ptr<OGRFeature>(GetFeature(nFID));
+            ++m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS;
+            if (poFeature && (m_poFilterGeom == nullptr ||
+                              FilterGeometry(poFeature->GetGeomFieldRef(
+                                  m_iGeomFieldFilter))))
+            {
+                oFeatureQueue.emplace_back(std::move(poFeature));
+            }
+        }
+        if (m_poSharedArrowArrayStreamPrivateData->m_iQueriedFIDS ==
+            m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.size())
+        {
+            poPrivate->poShared->m_bEOF = true;
+        }
+    }
+    else if (!poPrivate->poShared->m_bEOF)
+    {
+        while (oFeatureQueue.size() < static_cast<size_t>(nMaxBatchSize))
+        {
+            auto poFeature = std::unique_ptr<OGRFeature>(GetNextFeature());
+            if (!poFeature)
+            {
+                poPrivate->poShared->m_bEOF = true;
+                break;
+            }
+            oFeatureQueue.emplace_back(std::move(poFeature));
+        }
+    }
+    if (oFeatureQueue.empty())
+    {
+        return 0;
+    }
+
+    out_array->release = OGRLayerDefaultReleaseArray;
+    out_array->null_count = 0;
+
+    out_array->n_children = nMaxChildren;
+    out_array->children = static_cast<struct ArrowArray **>(
+        CPLCalloc(nMaxChildren, sizeof(struct ArrowArray *)));
+    out_array->release = OGRLayerDefaultReleaseArray;
+    out_array->n_buffers = 1;
+    out_array->buffers =
+        static_cast<const void **>(CPLCalloc(1, sizeof(void *)));
+
+    size_t nFeatureCount = oFeatureQueue.size();
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    if (bIncludeFID)
+    {
+        out_array->children[iSchemaChild] = static_cast<struct ArrowArray *>(
+            CPLCalloc(1, sizeof(struct ArrowArray)));
+        auto psChild = out_array->children[iSchemaChild];
+        ++iSchemaChild;
+        psChild->release = OGRLayerDefaultReleaseArray;
+        psChild->n_buffers = 2;
+        psChild->buffers =
+            static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
+        int64_t *panValues =
+            static_cast<int64_t *>(VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
+                sizeof(int64_t) * oFeatureQueue.size()));
+        if (panValues == nullptr)
+            goto error;
+        psChild->buffers[1] = panValues;
+        for (size_t iFeat = 0; iFeat < oFeatureQueue.size(); ++iFeat)
+        {
+            panValues[iFeat] = oFeatureQueue[iFeat]->GetFID();
+        }
+    }
+
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        const auto poFieldDefn = poLayerDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+        {
+            continue;
+        }
+
+        out_array->children[iSchemaChild] = static_cast<struct ArrowArray *>(
+            CPLCalloc(1, sizeof(struct ArrowArray)));
+        auto psChild = out_array->children[iSchemaChild];
+        ++iSchemaChild;
+        psChild->release = OGRLayerDefaultReleaseArray;
+        const bool bIsNullable = CPL_TO_BOOL(poFieldDefn->IsNullable());
+        const auto eSubType = poFieldDefn->GetSubType();
+        switch (poFieldDefn->GetType())
+        {
+            case OFTInteger:
+            {
+                if (eSubType == OFSTBoolean)
+                {
+                    if (!FillBoolArray(psChild, oFeatureQueue, nFeatureCount,
+                                       bIsNullable, &OGRField::Integer, i))
+                        goto error;
+                }
+                else if (eSubType == OFSTInt16)
+                {
+                    if (!FillArray<int16_t>(psChild, oFeatureQueue,
+                                            nFeatureCount, bIsNullable,
+                                            &OGRField::Integer, i))
+                        goto error;
+                }
+                else
+                {
+                    if (!FillArray<int32_t>(psChild, oFeatureQueue,
+                                            nFeatureCount, bIsNullable,
+                                            &OGRField::Integer, i))
+                        goto error;
+                }
+
+                const auto &osDomainName = poFieldDefn->GetDomainName();
+                if (!osDomainName.empty())
+                {
+                    auto poDS = GetDataset();
+                    if (poDS)
+                    {
+                        const auto poFieldDomain =
+                            poDS->GetFieldDomain(osDomainName);
+                        if (poFieldDomain &&
+                            poFieldDomain->GetDomainType() == OFDT_CODED)
+                        {
+                            const OGRCodedFieldDomain *poCodedDomain =
+                                static_cast<const OGRCodedFieldDomain *>(
+                                    poFieldDomain);
+                            OGRArrowArrayHelper::FillDict(psChild,
+                                                          poCodedDomain);
+                        }
+                    }
+                }
+
+                break;
+            }
 
             case OFTInteger64:
             {
@@ -2207,8 +2827,15 @@ int OGRLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         ++iSchemaChild;
         psChild->release = OGRLayerDefaultReleaseArray;
         psChild->length = oFeatureQueue.size();
-        const size_t nThisFeatureCount = FillWKBGeometryArray<int32_t>(
-            psChild, oFeatureQueue, nFeatureCount, poFieldDefn, i, nMemLimit);
+        const size_t nThisFeatureCount =
+            bGeoArrowEncoding &&
+                    GetGeoArrowExtensionName(poFieldDefn->GetType()) != nullptr
+                ? FillGeoArrowGeometryArray(psChild, oFeatureQueue,
+                                            nFeatureCount, poFieldDefn, i,
+                                            nMemLimit)
+                : FillWKBGeometryArray<int32_t>(psChild, oFeatureQueue,
+                                                nFeatureCount, poFieldDefn, i,
+                                                nMemLimit);
         if (nThisFeatureCount == 0)
         {
             goto error_max_mem;
@@ -2432,6 +3059,17 @@ From OGR using the Arrow C Stream data interface</a> tutorial.
  *     ARROW:extension:name=geoarrow.wkb and
  *     ARROW:extension:metadata={"crs": &lt;projjson CRS representation>&gt; are set.
  * </li>
+ * <li>GEOMETRY_ENCODING=WKB/GEOARROW (GDAL >= 3.10).
+ *     The default is WKB. If setting GEOMETRY_ENCODING to GEOARROW, geometry
+ *     fields of type Point, LineString, Polygon, MultiPoint, MultiLineString or
+ *     MultiPolygon (with optional Z and/or M dimensions) are returned with the
+ *     GeoArrow native encoding, that is nested lists of structs of
+ *     x, y[, z][, m] coordinates (ARROW:extension:name=geoarrow.point,
+ *     geoarrow.linestring, etc.). Geometries whose type does not match the
+ *     one of their field (except single geometries in a field of the
+ *     corresponding Multi type) are returned as null. Geometry fields of
+ *     other types are returned as WKB.
+ * </li>
  * </ul>
  *
  * The Arrow/Parquet drivers recognize the following option:
@@ -2626,6 +3264,17 @@ YES.</li>
  *     ARROW:extension:name=geoarrow.wkb and
  *     ARROW:extension:metadata={"crs": &lt;projjson CRS representation>&gt; are set.
  * </li>
+ * <li>GEOMETRY_ENCODING=WKB/GEOARROW (GDAL >= 3.10).
+ *     The default is WKB. If setting GEOMETRY_ENCODING to GEOARROW, geometry
+ *     fields of type Point, LineString, Polygon, MultiPoint, MultiLineString or
+ *     MultiPolygon (with optional Z and/or M dimensions) are returned with the
+ *     GeoArrow native encoding, that is nested lists of structs of
+ *     x, y[, z][, m] coordinates (ARROW:extension:name=geoarrow.point,
+ *     geoarrow.linestring, etc.). Geometries whose type does not match the
+ *     one of their field (except single geometries in a field of the
+ *     corresponding Multi type) are returned as null. Geometry fields of
+ *     other types are returned as WKB.
+ * </li>
  * </ul>
  *
  * The Arrow/Parquet drivers recognize the following option:
@@ -4533,150 +5182,814 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
         }
         else if (IsUInt32(childFormat))
         {
-            if (format[1] == ARROW_2ND_LETTER_LIST)
-                FillFieldList<uint32_t, uint32_t, GIntBig>(
-                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
-                    oFeature);
-            else
-                FillFieldList<uint64_t, uint32_t, GIntBig>(
-                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
-                    oFeature);
+            if (format[1] == ARROW_2ND_LETTER_LIST)
+                FillFieldList<uint32_t, uint32_t, GIntBig>(
+                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
+                    oFeature);
+            else
+                FillFieldList<uint64_t, uint32_t, GIntBig>(
+                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
+                    oFeature);
+        }
+        else if (IsInt64(childFormat))
+        {
+            if (format[1] == ARROW_2ND_LETTER_LIST)
+                FillFieldList<uint32_t, int64_t, GIntBig>(array, iOGRFieldIndex,
+                                                          nOffsettedIndex,
+                                                          childArray, oFeature);
+            else
+                FillFieldList<uint64_t, int64_t, GIntBig>(array, iOGRFieldIndex,
+                                                          nOffsettedIndex,
+                                                          childArray, oFeature);
+        }
+        else if (IsUInt64(childFormat))  // (lossy conversion)
+        {
+            if (format[1] == ARROW_2ND_LETTER_LIST)
+                FillFieldList<uint32_t, uint64_t, double>(array, iOGRFieldIndex,
+                                                          nOffsettedIndex,
+                                                          childArray, oFeature);
+            else
+                FillFieldList<uint64_t, uint64_t, double>(array, iOGRFieldIndex,
+                                                          nOffsettedIndex,
+                                                          childArray, oFeature);
+        }
+        else if (IsFloat16(childFormat))
+        {
+            if (format[1] == ARROW_2ND_LETTER_LIST)
+                FillFieldListFromHalfFloat<uint32_t>(array, iOGRFieldIndex,
+                                                     nOffsettedIndex,
+                                                     childArray, oFeature);
+            else
+                FillFieldListFromHalfFloat<uint64_t>(array, iOGRFieldIndex,
+                                                     nOffsettedIndex,
+                                                     childArray, oFeature);
+        }
+        else if (IsFloat32(childFormat))
+        {
+            if (format[1] == ARROW_2ND_LETTER_LIST)
+                FillFieldList<uint32_t, float, double>(array, iOGRFieldIndex,
+                                                       nOffsettedIndex,
+                                                       childArray, oFeature);
+            else
+                FillFieldList<uint64_t, float, double>(array, iOGRFieldIndex,
+                                                       nOffsettedIndex,
+                                                       childArray, oFeature);
+        }
+        else if (IsFloat64(childFormat))
+        {
+            if (format[1] == ARROW_2ND_LETTER_LIST)
+                FillFieldList<uint32_t, double, double>(array, iOGRFieldIndex,
+                                                        nOffsettedIndex,
+                                                        childArray, oFeature);
+            else
+                FillFieldList<uint64_t, double, double>(array, iOGRFieldIndex,
+                                                        nOffsettedIndex,
+                                                        childArray, oFeature);
+        }
+        else if (IsString(childFormat))
+        {
+            if (format[1] == ARROW_2ND_LETTER_LIST)
+                FillFieldListFromString<uint32_t, uint32_t>(
+                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
+                    oFeature);
+            else
+                FillFieldListFromString<uint64_t, uint32_t>(
+                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
+                    oFeature);
+        }
+        else if (IsLargeString(childFormat))
+        {
+            if (format[1] == ARROW_2ND_LETTER_LIST)
+                FillFieldListFromString<uint32_t, uint64_t>(
+                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
+                    oFeature);
+            else
+                FillFieldListFromString<uint64_t, uint64_t>(
+                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
+                    oFeature);
+        }
+        else if (format[1] == ARROW_2ND_LETTER_LIST)
+        {
+            const size_t iFeature =
+                static_cast<size_t>(nOffsettedIndex - array->offset);
+            oFeature.SetField(iOGRFieldIndex,
+                              GetListAsJSON<uint32_t>(schema, array, iFeature)
+                                  .Format(CPLJSONObject::PrettyFormat::Plain)
+                                  .c_str());
+        }
+        else
+        {
+            const size_t iFeature =
+                static_cast<size_t>(nOffsettedIndex - array->offset);
+            oFeature.SetField(iOGRFieldIndex,
+                              GetListAsJSON<uint64_t>(schema, array, iFeature)
+                                  .Format(CPLJSONObject::PrettyFormat::Plain)
+                                  .c_str());
+        }
+    }
+    else if (IsDecimal(format))
+    {
+        int nPrecision = 0;
+        int nScale = 0;
+        int nWidthInBytes = 0;
+        if (!ParseDecimalFormat(format, nPrecision, nScale, nWidthInBytes))
+        {
+            CPLAssert(false);
+        }
+
+        // fits on a int64
+        CPLAssert(nPrecision <= 19);
+        // either 128 or 256 bits
+        CPLAssert((nWidthInBytes % 8) == 0);
+        const int nWidthIn64BitWord = nWidthInBytes / 8;
+        const size_t iFeature =
+            static_cast<size_t>(nOffsettedIndex - array->offset);
+        oFeature.SetField(
+            iOGRFieldIndex,
+            GetValueDecimal(array, nWidthIn64BitWord, nScale, iFeature));
+        return true;
+    }
+    else if (IsMap(format))
+    {
+        const size_t iFeature =
+            static_cast<size_t>(nOffsettedIndex - array->offset);
+        oFeature.SetField(iOGRFieldIndex,
+                          GetMapAsJSON(schema, array, iFeature)
+                              .Format(CPLJSONObject::PrettyFormat::Plain)
+                              .c_str());
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                      OGRArrowColumnarEvaluator                       */
+/************************************************************************/
+
+namespace
+{
+
+// Evaluates an attribute filter directly on the buffers of an ArrowArray,
+// without materializing OGRFeature objects. Only a subset of expressions is
+// handled: comparisons, IN, BETWEEN and IS NULL between a column and
+// constants, LIKE with a pattern without wildcard or ending with a single '%',
+// and combinations of them with AND, OR and NOT. The semantics, in particular
+// regarding NULL values, are the ones of SWQGeneralEvaluator().
+class OGRArrowColumnarEvaluator
+{
+    const OGRFeatureDefn *const m_poFeatureDefn;
+    const std::map<std::string, std::vector<int>> &m_oMapFieldNameToArrowPath;
+    const struct ArrowSchema *const m_schema;
+    const struct ArrowArray *const m_array;
+    const size_t m_nLength;
+
+    struct Column
+    {
+        swq_field_type eType = SWQ_OTHER;
+        const struct ArrowSchema *psSchema = nullptr;
+        const struct ArrowArray *psArray = nullptr;
+        std::vector<uint8_t> abyNull{};
+    };
+
+    bool GetColumn(const swq_expr_node *poNode, Column &sColumn) const;
+
+    template <class ArrowType, class OutType>
+    void CopyValues(const struct ArrowArray *psArray,
+                    std::vector<OutType> &aValues) const
+    {
+        const auto *panData =
+            static_cast<const ArrowType *>(psArray->buffers[1]) +
+            psArray->offset;
+        for (size_t i = 0; i < m_nLength; ++i)
+            aValues[i] = static_cast<OutType>(panData[i]);
+    }
+
+    bool GetIntegerValues(const Column &sColumn,
+                          std::vector<int64_t> &anValues) const;
+    bool GetDoubleValues(const Column &sColumn,
+                         std::vector<double> &adfValues) const;
+
+    template <class T>
+    void Compare(swq_op eOp, const std::vector<T> &aValues,
+                 const std::vector<T> &aConstants,
+                 std::vector<uint8_t> &abyValue) const;
+
+    bool EvaluateNumeric(const swq_expr_node *poNode, const Column &sColumn,
+                         const std::vector<const swq_expr_node *> &apoConstants,
+                         swq_op eOp, bool bFloatOperation,
+                         std::vector<uint8_t> &abyValue) const;
+    bool EvaluateString(const Column &sColumn,
+                        const std::vector<const swq_expr_node *> &apoConstants,
+                        swq_op eOp, std::vector<uint8_t> &abyValue) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRArrowColumnarEvaluator)
+
+  public:
+    OGRArrowColumnarEvaluator(
+        const OGRFeatureDefn *poFeatureDefn,
+        const std::map<std::string, std::vector<int>> &oMapFieldNameToArrowPath,
+        const struct ArrowSchema *schema, const struct ArrowArray *array)
+        : m_poFeatureDefn(poFeatureDefn),
+          m_oMapFieldNameToArrowPath(oMapFieldNameToArrowPath),
+          m_schema(schema), m_array(array),
+          m_nLength(static_cast<size_t>(array->length))
+    {
+    }
+
+    /** Set abyValue[i] and abyNull[i] to the value and nullness of the
+     * expression for each row. Returns false if the expression is not handled.
+     */
+    bool Evaluate(const swq_expr_node *poNode, std::vector<uint8_t> &abyValue,
+                  std::vector<uint8_t> &abyNull) const;
+};
+
+/************************************************************************/
+/*                             GetColumn()                              */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::GetColumn(const swq_expr_node *poNode,
+                                          Column &sColumn) const
+{
+    if (poNode->eNodeType != SNT_COLUMN || poNode->table_index != 0 ||
+        poNode->field_index < 0 ||
+        poNode->field_index >= m_poFeatureDefn->GetFieldCount())
+    {
+        return false;
+    }
+    const auto poFieldDefn = m_poFeatureDefn->GetFieldDefn(poNode->field_index);
+    const auto eOGRType = poFieldDefn->GetType();
+    sColumn.eType = poNode->field_type;
+    if (!((sColumn.eType == SWQ_INTEGER && eOGRType == OFTInteger) ||
+          (sColumn.eType == SWQ_BOOLEAN && eOGRType == OFTInteger) ||
+          (sColumn.eType == SWQ_INTEGER64 && eOGRType == OFTInteger64) ||
+          (sColumn.eType == SWQ_FLOAT && eOGRType == OFTReal) ||
+          (sColumn.eType == SWQ_STRING && eOGRType == OFTString)))
+    {
+        return false;
+    }
+    const auto oIter =
+        m_oMapFieldNameToArrowPath.find(poFieldDefn->GetNameRef());
+    if (oIter == m_oMapFieldNameToArrowPath.end())
+        return false;
+
+    sColumn.abyNull.assign(m_nLength, 0);
+    const auto MarkNulls = [this, &sColumn](const struct ArrowArray *psArray)
+    {
+        if (psArray->null_count != 0 && psArray->buffers[0])
+        {
+            const uint8_t *pabyValidity =
+                static_cast<const uint8_t *>(psArray->buffers[0]);
+            const size_t nOffset = static_cast<size_t>(psArray->offset);
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                if (!TestBit(pabyValidity, i + nOffset))
+                    sColumn.abyNull[i] = 1;
+            }
         }
-        else if (IsInt64(childFormat))
+    };
+
+    const struct ArrowSchema *psSchema = m_schema;
+    const struct ArrowArray *psArray = m_array;
+    for (size_t i = 0; i < oIter->second.size(); ++i)
+    {
+        if (i > 0)
+            MarkNulls(psArray);
+        const int iChild = oIter->second[i];
+        psSchema = psSchema->children[iChild];
+        psArray = psArray->children[iChild];
+    }
+    if (psSchema->dictionary != nullptr)
+        return false;
+    MarkNulls(psArray);
+    sColumn.psSchema = psSchema;
+    sColumn.psArray = psArray;
+    return true;
+}
+
+/************************************************************************/
+/*                          GetIntegerValues()                          */
+/************************************************************************/
+
+// Values as returned by OGRFeature::GetFieldAsInteger[64]() after
+// FillValidityArrayFromAttrQuery() has set them.
+bool OGRArrowColumnarEvaluator::GetIntegerValues(
+    const Column &sColumn, std::vector<int64_t> &anValues) const
+{
+    const char *format = sColumn.psSchema->format;
+    const struct ArrowArray *psArray = sColumn.psArray;
+    anValues.resize(m_nLength);
+    if (IsBoolean(format))
+    {
+        const uint8_t *pabyData =
+            static_cast<const uint8_t *>(psArray->buffers[1]);
+        const size_t nOffset = static_cast<size_t>(psArray->offset);
+        for (size_t i = 0; i < m_nLength; ++i)
+            anValues[i] = TestBit(pabyData, i + nOffset) ? 1 : 0;
+    }
+    else if (IsInt8(format))
+        CopyValues<int8_t>(psArray, anValues);
+    else if (IsUInt8(format))
+        CopyValues<uint8_t>(psArray, anValues);
+    else if (IsInt16(format))
+        CopyValues<int16_t>(psArray, anValues);
+    else if (IsUInt16(format))
+        CopyValues<uint16_t>(psArray, anValues);
+    else if (IsInt32(format))
+        CopyValues<int32_t>(psArray, anValues);
+    else if (IsUInt32(format) && sColumn.eType == SWQ_INTEGER64)
+        CopyValues<uint32_t>(psArray, anValues);
+    else if (IsInt64(format) && sColumn.eType == SWQ_INTEGER64)
+        CopyValues<int64_t>(psArray, anValues);
+    else
+        return false;
+    return true;
+}
+
+/************************************************************************/
+/*                          GetDoubleValues()                           */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::GetDoubleValues(
+    const Column &sColumn, std::vector<double> &adfValues) const
+{
+    if (sColumn.eType != SWQ_FLOAT)
+    {
+        std::vector<int64_t> anValues;
+        if (!GetIntegerValues(sColumn, anValues))
+            return false;
+        adfValues.resize(m_nLength);
+        for (size_t i = 0; i < m_nLength; ++i)
+            adfValues[i] = static_cast<double>(anValues[i]);
+        return true;
+    }
+
+    const char *format = sColumn.psSchema->format;
+    const struct ArrowArray *psArray = sColumn.psArray;
+    adfValues.resize(m_nLength);
+    if (IsFloat32(format))
+        CopyValues<float>(psArray, adfValues);
+    else if (IsFloat64(format))
+        CopyValues<double>(psArray, adfValues);
+    else if (IsInt8(format))
+        CopyValues<int8_t>(psArray, adfValues);
+    else if (IsUInt8(format))
+        CopyValues<uint8_t>(psArray, adfValues);
+    else if (IsInt16(format))
+        CopyValues<int16_t>(psArray, adfValues);
+    else if (IsUInt16(format))
+        CopyValues<uint16_t>(psArray, adfValues);
+    else if (IsInt32(format))
+        CopyValues<int32_t>(psArray, adfValues);
+    else if (IsUInt32(format))
+        CopyValues<uint32_t>(psArray, adfValues);
+    else if (IsInt64(format))
+        CopyValues<int64_t>(psArray, adfValues);
+    else
+        return false;
+    return true;
+}
+
+/************************************************************************/
+/*                              Compare()                               */
+/************************************************************************/
+
+template <class T>
+void OGRArrowColumnarEvaluator::Compare(swq_op eOp,
+                                        const std::vector<T> &aValues,
+                                        const std::vector<T> &aConstants,
+                                        std::vector<uint8_t> &abyValue) const
+{
+    const T c = aConstants[0];
+    switch (eOp)
+    {
+        case SWQ_EQ:
+            for (size_t i = 0; i < m_nLength; ++i)
+                abyValue[i] = aValues[i] == c;
+            break;
+        case SWQ_NE:
+            for (size_t i = 0; i < m_nLength; ++i)
+                abyValue[i] = aValues[i] != c;
+            break;
+        case SWQ_GT:
+            for (size_t i = 0; i < m_nLength; ++i)
+                abyValue[i] = aValues[i] > c;
+            break;
+        case SWQ_LT:
+            for (size_t i = 0; i < m_nLength; ++i)
+                abyValue[i] = aValues[i] < c;
+            break;
+        case SWQ_GE:
+            for (size_t i = 0; i < m_nLength; ++i)
+                abyValue[i] = aValues[i] >= c;
+            break;
+        case SWQ_LE:
+            for (size_t i = 0; i < m_nLength; ++i)
+                abyValue[i] = aValues[i] <= c;
+            break;
+        case SWQ_BETWEEN:
         {
-            if (format[1] == ARROW_2ND_LETTER_LIST)
-                FillFieldList<uint32_t, int64_t, GIntBig>(array, iOGRFieldIndex,
-                                                          nOffsettedIndex,
-                                                          childArray, oFeature);
-            else
-                FillFieldList<uint64_t, int64_t, GIntBig>(array, iOGRFieldIndex,
-                                                          nOffsettedIndex,
-                                                          childArray, oFeature);
+            const T c2 = aConstants[1];
+            for (size_t i = 0; i < m_nLength; ++i)
+                abyValue[i] = aValues[i] >= c && aValues[i] <= c2;
+            break;
         }
-        else if (IsUInt64(childFormat))  // (lossy conversion)
+        case SWQ_IN:
         {
-            if (format[1] == ARROW_2ND_LETTER_LIST)
-                FillFieldList<uint32_t, uint64_t, double>(array, iOGRFieldIndex,
-                                                          nOffsettedIndex,
-                                                          childArray, oFeature);
-            else
-                FillFieldList<uint64_t, uint64_t, double>(array, iOGRFieldIndex,
-                                                          nOffsettedIndex,
-                                                          childArray, oFeature);
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                uint8_t bFound = 0;
+                for (const T cIn : aConstants)
+                    bFound |= aValues[i] == cIn;
+                abyValue[i] = bFound;
+            }
+            break;
         }
-        else if (IsFloat16(childFormat))
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                          EvaluateNumeric()                           */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::EvaluateNumeric(
+    const swq_expr_node *poNode, const Column &sColumn,
+    const std::vector<const swq_expr_node *> &apoConstants, swq_op eOp,
+    bool bFloatOperation, std::vector<uint8_t> &abyValue) const
+{
+    for (const auto *poConstant : apoConstants)
+    {
+        if (!SWQ_IS_INTEGER(poConstant->field_type) &&
+            poConstant->field_type != SWQ_BOOLEAN &&
+            poConstant->field_type != SWQ_FLOAT)
         {
-            if (format[1] == ARROW_2ND_LETTER_LIST)
-                FillFieldListFromHalfFloat<uint32_t>(array, iOGRFieldIndex,
-                                                     nOffsettedIndex,
-                                                     childArray, oFeature);
-            else
-                FillFieldListFromHalfFloat<uint64_t>(array, iOGRFieldIndex,
-                                                     nOffsettedIndex,
-                                                     childArray, oFeature);
+            return false;
         }
-        else if (IsFloat32(childFormat))
+    }
+
+    // Same promotion of values as SWQGeneralEvaluator(): only the first two
+    // operands are converted from integer to floating point.
+    if (bFloatOperation)
+    {
+        std::vector<double> adfValues;
+        if (!GetDoubleValues(sColumn, adfValues))
+            return false;
+        std::vector<double> adfConstants;
+        for (int i = 1; i < poNode->nSubExprCount; ++i)
         {
-            if (format[1] == ARROW_2ND_LETTER_LIST)
-                FillFieldList<uint32_t, float, double>(array, iOGRFieldIndex,
-                                                       nOffsettedIndex,
-                                                       childArray, oFeature);
-            else
-                FillFieldList<uint64_t, float, double>(array, iOGRFieldIndex,
-                                                       nOffsettedIndex,
-                                                       childArray, oFeature);
+            const auto *poConstant = apoConstants[i - 1];
+            adfConstants.push_back(
+                i == 1 && SWQ_IS_INTEGER(poConstant->field_type)
+                    ? static_cast<double>(poConstant->int_value)
+                    : poConstant->float_value);
         }
-        else if (IsFloat64(childFormat))
+        Compare(eOp, adfValues, adfConstants, abyValue);
+    }
+    else
+    {
+        std::vector<int64_t> anValues;
+        if (!GetIntegerValues(sColumn, anValues))
+            return false;
+        std::vector<int64_t> anConstants;
+        for (const auto *poConstant : apoConstants)
+            anConstants.push_back(poConstant->int_value);
+        Compare(eOp, anValues, anConstants, abyValue);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     CompareStringCaseInsensitive()                   */
+/************************************************************************/
+
+// Same result sign as strcasecmp() on the nul-terminated copy of the
+// (pszA, nALen) string done by FillValidityArrayFromAttrQuery().
+static int CompareStringCaseInsensitive(const char *pszA, size_t nALen,
+                                        const char *pszB)
+{
+    for (size_t i = 0;; ++i)
+    {
+        const int chA =
+            i < nALen ? CPLTolower(static_cast<unsigned char>(pszA[i])) : 0;
+        const int chB = CPLTolower(static_cast<unsigned char>(pszB[i]));
+        if (chA != chB)
+            return chA - chB;
+        if (chA == 0)
+            return 0;
+    }
+}
+
+/************************************************************************/
+/*                           EvaluateString()                           */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::EvaluateString(
+    const Column &sColumn,
+    const std::vector<const swq_expr_node *> &apoConstants, swq_op eOp,
+    std::vector<uint8_t> &abyValue) const
+{
+    for (const auto *poConstant : apoConstants)
+    {
+        if (poConstant->field_type != SWQ_STRING ||
+            poConstant->string_value == nullptr)
         {
-            if (format[1] == ARROW_2ND_LETTER_LIST)
-                FillFieldList<uint32_t, double, double>(array, iOGRFieldIndex,
-                                                        nOffsettedIndex,
-                                                        childArray, oFeature);
-            else
-                FillFieldList<uint64_t, double, double>(array, iOGRFieldIndex,
-                                                        nOffsettedIndex,
-                                                        childArray, oFeature);
+            return false;
         }
-        else if (IsString(childFormat))
+    }
+
+    const char *pszConstant = apoConstants[0]->string_value;
+    const size_t nConstantLen = strlen(pszConstant);
+    std::string osLikePrefix;
+    bool bLikePrefixOnly = false;
+    if (eOp == SWQ_EQ && nConstantLen > 3 &&
+        (pszConstant[nConstantLen - 3] == ':' ||
+         strcmp(pszConstant + nConstantLen - 3, "+00") == 0))
+    {
+        // Special comparison rules for timestamps in SWQGeneralEvaluator()
+        return false;
+    }
+    else if (eOp == SWQ_LIKE)
+    {
+        if (CPLTestBool(CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE")))
+            return false;
+        osLikePrefix = pszConstant;
+        if (!osLikePrefix.empty() && osLikePrefix.back() == '%')
         {
-            if (format[1] == ARROW_2ND_LETTER_LIST)
-                FillFieldListFromString<uint32_t, uint32_t>(
-                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
-                    oFeature);
-            else
-                FillFieldListFromString<uint64_t, uint32_t>(
-                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
-                    oFeature);
+            osLikePrefix.pop_back();
+            bLikePrefixOnly = true;
         }
-        else if (IsLargeString(childFormat))
-        {
-            if (format[1] == ARROW_2ND_LETTER_LIST)
-                FillFieldListFromString<uint32_t, uint64_t>(
-                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
-                    oFeature);
-            else
-                FillFieldListFromString<uint64_t, uint64_t>(
-                    array, iOGRFieldIndex, nOffsettedIndex, childArray,
-                    oFeature);
+        if (osLikePrefix.find_first_of("%_") != std::string::npos)
+            return false;
+    }
+
+    const char *format = sColumn.psSchema->format;
+    const struct ArrowArray *psArray = sColumn.psArray;
+    const bool bLargeString = IsLargeString(format);
+    if (!bLargeString && !IsString(format))
+        return false;
+    const uint32_t *panOffsets =
+        static_cast<const uint32_t *>(psArray->buffers[1]) + psArray->offset;
+    const uint64_t *panLargeOffsets =
+        static_cast<const uint64_t *>(psArray->buffers[1]) + psArray->offset;
+    const char *pachData = static_cast<const char *>(psArray->buffers[2]);
+
+    for (size_t i = 0; i < m_nLength; ++i)
+    {
+        if (sColumn.abyNull[i])
+            continue;
+        const uint64_t nStart =
+            bLargeString ? panLargeOffsets[i] : panOffsets[i];
+        const uint64_t nEnd =
+            bLargeString ? panLargeOffsets[i + 1] : panOffsets[i + 1];
+        const char *pszStr = pachData + static_cast<size_t>(nStart);
+        const size_t nLen = static_cast<size_t>(nEnd - nStart);
+        bool bRes = false;
+        switch (eOp)
+        {
+            case SWQ_EQ:
+                bRes = CompareStringCaseInsensitive(pszStr, nLen,
+                                                    pszConstant) == 0;
+                break;
+            case SWQ_NE:
+                bRes = CompareStringCaseInsensitive(pszStr, nLen,
+                                                    pszConstant) != 0;
+                break;
+            case SWQ_GT:
+                bRes =
+                    CompareStringCaseInsensitive(pszStr, nLen, pszConstant) > 0;
+                break;
+            case SWQ_LT:
+                bRes =
+                    CompareStringCaseInsensitive(pszStr, nLen, pszConstant) < 0;
+                break;
+            case SWQ_GE:
+                bRes = CompareStringCaseInsensitive(pszStr, nLen,
+                                                    pszConstant) >= 0;
+                break;
+            case SWQ_LE:
+                bRes = CompareStringCaseInsensitive(pszStr, nLen,
+                                                    pszConstant) <= 0;
+                break;
+            case SWQ_BETWEEN:
+                bRes = CompareStringCaseInsensitive(pszStr, nLen,
+                                                    pszConstant) >= 0 &&
+                       CompareStringCaseInsensitive(
+                           pszStr, nLen, apoConstants[1]->string_value) <= 0;
+                break;
+            case SWQ_IN:
+                for (const auto *poConstant : apoConstants)
+                {
+                    if (CompareStringCaseInsensitive(
+                            pszStr, nLen, poConstant->string_value) == 0)
+                    {
+                        bRes = true;
+                        break;
+                    }
+                }
+                break;
+            case SWQ_LIKE:
+            {
+                // The OGRFeature holds a nul-terminated copy of the value.
+                const size_t nCLen = CPLStrnlen(pszStr, nLen);
+                bRes = (bLikePrefixOnly ? nCLen >= osLikePrefix.size()
+                                        : nCLen == osLikePrefix.size()) &&
+                       memcmp(pszStr, osLikePrefix.data(),
+                              osLikePrefix.size()) == 0;
+                break;
+            }
+            default:
+                CPLAssert(false);
+                break;
         }
-        else if (format[1] == ARROW_2ND_LETTER_LIST)
+        abyValue[i] = bRes;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+bool OGRArrowColumnarEvaluator::Evaluate(const swq_expr_node *poNode,
+                                         std::vector<uint8_t> &abyValue,
+                                         std::vector<uint8_t> &abyNull) const
+{
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    const auto eOp = static_cast<swq_op>(poNode->nOperation);
+    switch (eOp)
+    {
+        case SWQ_AND:
+        case SWQ_OR:
         {
-            const size_t iFeature =
-                static_cast<size_t>(nOffsettedIndex - array->offset);
-            oFeature.SetField(iOGRFieldIndex,
-                              GetListAsJSON<uint32_t>(schema, array, iFeature)
-                                  .Format(CPLJSONObject::PrettyFormat::Plain)
-                                  .c_str());
+            if (poNode->nSubExprCount != 2)
+                return false;
+            std::vector<uint8_t> abyValue2, abyNull2;
+            if (!Evaluate(poNode->papoSubExpr[0], abyValue, abyNull) ||
+                !Evaluate(poNode->papoSubExpr[1], abyValue2, abyNull2))
+            {
+                return false;
+            }
+            if (eOp == SWQ_AND)
+            {
+                for (size_t i = 0; i < m_nLength; ++i)
+                {
+                    const uint8_t bNull = abyNull[i] | abyNull2[i];
+                    abyValue[i] = (abyValue[i] & abyValue2[i]) & (1 - bNull);
+                    abyNull[i] = bNull;
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < m_nLength; ++i)
+                {
+                    abyValue[i] |= abyValue2[i];
+                    abyNull[i] |= abyNull2[i];
+                }
+            }
+            return true;
         }
-        else
+
+        case SWQ_NOT:
         {
-            const size_t iFeature =
-                static_cast<size_t>(nOffsettedIndex - array->offset);
-            oFeature.SetField(iOGRFieldIndex,
-                              GetListAsJSON<uint64_t>(schema, array, iFeature)
-                                  .Format(CPLJSONObject::PrettyFormat::Plain)
-                                  .c_str());
+            if (poNode->nSubExprCount != 1 ||
+                !Evaluate(poNode->papoSubExpr[0], abyValue, abyNull))
+            {
+                return false;
+            }
+            for (size_t i = 0; i < m_nLength; ++i)
+                abyValue[i] = (1 - abyValue[i]) & (1 - abyNull[i]);
+            return true;
         }
-    }
-    else if (IsDecimal(format))
-    {
-        int nPrecision = 0;
-        int nScale = 0;
-        int nWidthInBytes = 0;
-        if (!ParseDecimalFormat(format, nPrecision, nScale, nWidthInBytes))
+
+        case SWQ_ISNULL:
         {
-            CPLAssert(false);
+            Column sColumn;
+            if (poNode->nSubExprCount != 1 ||
+                !GetColumn(poNode->papoSubExpr[0], sColumn))
+            {
+                return false;
+            }
+            abyValue = std::move(sColumn.abyNull);
+            abyNull.assign(m_nLength, 0);
+            return true;
         }
 
-        // fits on a int64
-        CPLAssert(nPrecision <= 19);
-        // either 128 or 256 bits
-        CPLAssert((nWidthInBytes % 8) == 0);
-        const int nWidthIn64BitWord = nWidthInBytes / 8;
-        const size_t iFeature =
-            static_cast<size_t>(nOffsettedIndex - array->offset);
-        oFeature.SetField(
-            iOGRFieldIndex,
-            GetValueDecimal(array, nWidthIn64BitWord, nScale, iFeature));
-        return true;
-    }
-    else if (IsMap(format))
-    {
-        const size_t iFeature =
-            static_cast<size_t>(nOffsettedIndex - array->offset);
-        oFeature.SetField(iOGRFieldIndex,
-                          GetMapAsJSON(schema, array, iFeature)
-                              .Format(CPLJSONObject::PrettyFormat::Plain)
-                              .c_str());
-    }
-    else
-    {
-        return false;
-    }
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_GT:
+        case SWQ_LT:
+        case SWQ_GE:
+        case SWQ_LE:
+        case SWQ_IN:
+        case SWQ_BETWEEN:
+        case SWQ_LIKE:
+        {
+            if (poNode->nSubExprCount < 2 ||
+                (eOp != SWQ_IN && eOp != SWQ_BETWEEN &&
+                 poNode->nSubExprCount != 2) ||
+                (eOp == SWQ_BETWEEN && poNode->nSubExprCount != 3))
+            {
+                return false;
+            }
 
-    return true;
+            // Normalize "constant op column" as "column op' constant"
+            int iColumn = 0;
+            swq_op eColumnOp = eOp;
+            if (poNode->nSubExprCount == 2 &&
+                poNode->papoSubExpr[0]->eNodeType == SNT_CONSTANT &&
+                eOp != SWQ_IN && eOp != SWQ_LIKE)
+            {
+                iColumn = 1;
+                if (eOp == SWQ_GT)
+                    eColumnOp = SWQ_LT;
+                else if (eOp == SWQ_LT)
+                    eColumnOp = SWQ_GT;
+                else if (eOp == SWQ_GE)
+                    eColumnOp = SWQ_LE;
+                else if (eOp == SWQ_LE)
+                    eColumnOp = SWQ_GE;
+            }
+
+            Column sColumn;
+            if (!GetColumn(poNode->papoSubExpr[iColumn], sColumn))
+                return false;
+            std::vector<const swq_expr_node *> apoConstants;
+            bool bHasNullConstant = false;
+            for (int i = 0; i < poNode->nSubExprCount; ++i)
+            {
+                if (i == iColumn)
+                    continue;
+                const auto *poConstant = poNode->papoSubExpr[i];
+                if (poConstant->eNodeType != SNT_CONSTANT)
+                    return false;
+                if (poConstant->is_null)
+                {
+                    // NULL values in the IN list only matter when there
+                    // is no match.
+                    if (eOp != SWQ_IN)
+                        return false;
+                    bHasNullConstant = true;
+                    continue;
+                }
+                apoConstants.push_back(poConstant);
+            }
+            if (apoConstants.empty() || (bHasNullConstant && iColumn != 0))
+                return false;
+
+            // Same selection of the type of operation as
+            // SWQGeneralEvaluator()
+            const bool bFloatOperation =
+                sColumn.eType == SWQ_FLOAT ||
+                poNode->papoSubExpr[1 - iColumn]->field_type == SWQ_FLOAT;
+            abyValue.assign(m_nLength, 0);
+            if (sColumn.eType == SWQ_STRING)
+            {
+                if (bFloatOperation ||
+                    !EvaluateString(sColumn, apoConstants, eColumnOp,
+                                    abyValue))
+                {
+                    return false;
+                }
+            }
+            else if (eOp == SWQ_LIKE ||
+                     (bFloatOperation && bHasNullConstant) ||
+                     !EvaluateNumeric(poNode, sColumn, apoConstants, eColumnOp,
+                                      bFloatOperation, abyValue))
+            {
+                return false;
+            }
+
+            abyNull = std::move(sColumn.abyNull);
+            for (size_t i = 0; i < m_nLength; ++i)
+            {
+                if (abyNull[i])
+                {
+                    abyValue[i] = 0;
+                }
+                else if (bHasNullConstant && !abyValue[i])
+                {
+                    abyNull[i] = 1;
+                }
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
 }
 
+}  // namespace
+
 /************************************************************************/
 /*                 FillValidityArrayFromAttrQuery()                     */
 /************************************************************************/
@@ -4695,6 +6008,29 @@ static size_t FillValidityArrayFromAttrQuery(
     BuildMapFieldNameToArrowPath(schema, oMapFieldNameToArrowPath,
                                  std::string(), anArrowPathTmp);
 
+    // Try first to evaluate the filter directly on the Arrow buffers
+    {
+        const OGRArrowColumnarEvaluator oEvaluator(
+            poFeatureDefn, oMapFieldNameToArrowPath, schema, array);
+        std::vector<uint8_t> abyValue;
+        std::vector<uint8_t> abyNull;
+        if (oEvaluator.Evaluate(
+                static_cast<const swq_expr_node *>(poAttrQuery->GetSWQExpr()),
+                abyValue, abyNull))
+        {
+            for (size_t iRow = 0; iRow < abyValidityFromFilters.size(); ++iRow)
+            {
+                if (!abyValidityFromFilters[iRow])
+                    continue;
+                if (abyValue[iRow])
+                    nCountIntersecting++;
+                else
+                    abyValidityFromFilters[iRow] = false;
+            }
+            return nCountIntersecting;
+        }
+    }
+
     struct UsedFieldsInfo
     {
         int iOGRFieldIndex{};
@@ -5583,6 +6919,92 @@ static bool IsSupportForJSONObj(const struct ArrowSchema *schema)
     return false;
 }
 
+/************************************************************************/
+/*                      GetGeoArrowGeometryType()                       */
+/************************************************************************/
+
+// Return the geometry type of a column using a GeoArrow native encoding
+// (separated or interleaved coordinates), or wkbNone if it is not a column
+// with a supported GeoArrow native encoding.
+static OGRwkbGeometryType
+GetGeoArrowGeometryType(const struct ArrowSchema *schema)
+{
+    if (schema->metadata == nullptr)
+        return wkbNone;
+    const auto oMetadata = OGRParseArrowMetadata(schema->metadata);
+    const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+    if (oIter == oMetadata.end())
+        return wkbNone;
+
+    OGRwkbGeometryType eFlatType = wkbNone;
+    for (const auto eType : {wkbPoint, wkbLineString, wkbPolygon, wkbMultiPoint,
+                             wkbMultiLineString, wkbMultiPolygon})
+    {
+        if (oIter->second == GetGeoArrowExtensionName(eType))
+        {
+            eFlatType = eType;
+            break;
+        }
+    }
+    if (eFlatType == wkbNone)
+        return wkbNone;
+
+    const int nLevels = GetGeoArrowNestingLevels(eFlatType);
+    for (int iLevel = 0; iLevel < nLevels; ++iLevel)
+    {
+        if ((!IsList(schema->format) && !IsLargeList(schema->format)) ||
+            schema->n_children != 1)
+        {
+            return wkbNone;
+        }
+        schema = schema->children[0];
+    }
+
+    bool bHasZ = false;
+    bool bHasM = false;
+    if (IsStructure(schema->format))
+    {
+        if (schema->n_children < 2 || schema->n_children > 4)
+            return wkbNone;
+        for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
+        {
+            const auto psCoordSchema = schema->children[i];
+            if (!IsFloat64(psCoordSchema->format))
+                return wkbNone;
+            if (i >= 2)
+            {
+                const char *pszName =
+                    psCoordSchema->name ? psCoordSchema->name : "";
+                if (i == 2 && strcmp(pszName, "z") == 0)
+                    bHasZ = true;
+                else if (strcmp(pszName, "m") == 0)
+                    bHasM = true;
+                else
+                    return wkbNone;
+            }
+        }
+    }
+    else if (IsFixedSizeList(schema->format))
+    {
+        const int nDimCount = GetFixedSizeList(schema->format);
+        if (nDimCount < 2 || nDimCount > 4 || schema->n_children != 1 ||
+            !IsFloat64(schema->children[0]->format))
+        {
+            return wkbNone;
+        }
+        const char *pszName =
+            schema->children[0]->name ? schema->children[0]->name : "";
+        bHasM = nDimCount == 4 || (nDimCount == 3 && EQUAL(pszName, "xym"));
+        bHasZ = nDimCount == 4 || (nDimCount == 3 && !bHasM);
+    }
+    else
+    {
+        return wkbNone;
+    }
+
+    return OGR_GT_SetModifier(eFlatType, bHasZ, bHasM);
+}
+
 static bool IsArrowSchemaSupportedInternal(const struct ArrowSchema *schema,
                                            const std::string &osFieldPrefix,
                                            std::string &osErrorMsg)
@@ -5594,6 +7016,9 @@ static bool IsArrowSchemaSupportedInternal(const struct ArrowSchema *schema,
         osErrorMsg += osMsg;
     };
 
+    if (GetGeoArrowGeometryType(schema) != wkbNone)
+        return true;
+
     const char *fieldName = schema->name;
     const char *format = schema->format;
     if (IsStructure(format))
@@ -6202,6 +7627,9 @@ struct FieldInfo
     // OGR data type of the feature passed to FillFeature()
     OGRFieldType eSetFeatureFieldType = OFTMaxType;
     bool bIsGeomCol = false;
+    // Only set for geometry columns with a GeoArrow native encoding
+    const struct ArrowSchema *psGeoArrowSchema = nullptr;
+    OGRwkbGeometryType eGeoArrowGeomType = wkbNone;
     bool bUseDictionary = false;
     bool bUseStringOptim = false;
     int nWidthInBytes = 0;  // only used for decimal fields
@@ -6221,6 +7649,37 @@ static bool BuildOGRFieldInfo(
 {
     const char *fieldName = schema->name;
     const char *format = schema->format;
+
+    const OGRwkbGeometryType eGeoArrowGeomType =
+        GetGeoArrowGeometryType(schema);
+    if (eGeoArrowGeomType != wkbNone)
+    {
+        FieldInfo sInfo;
+        sInfo.osName = osFieldPrefix + fieldName;
+        sInfo.format = format;
+        sInfo.bIsGeomCol = true;
+        sInfo.psGeoArrowSchema = schema;
+        sInfo.eGeoArrowGeomType = eGeoArrowGeomType;
+        const auto oIter = oMapArrowFieldNameToOGRFieldName.find(sInfo.osName);
+        sInfo.iOGRFieldIdx = poFeatureDefn->GetGeomFieldIndex(
+            oIter != oMapArrowFieldNameToOGRFieldName.end()
+                ? oIter->second.c_str()
+                : sInfo.osName.c_str());
+        if (sInfo.iOGRFieldIdx < 0)
+        {
+            if (poFeatureDefn->GetGeomFieldCount() == 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot find OGR geometry field for Arrow array %s",
+                         sInfo.osName.c_str());
+                return false;
+            }
+            sInfo.iOGRFieldIdx = 0;
+        }
+        asFieldInfo.emplace_back(std::move(sInfo));
+        return true;
+    }
+
     if (IsStructure(format))
     {
         const std::string osNewPrefix(osFieldPrefix + fieldName + ".");
@@ -6734,6 +8193,12 @@ static size_t GetWorkingBufferSize(const struct ArrowSchema *schema,
 {
     const char *fieldName = schema->name;
     const char *format = schema->format;
+    if (static_cast<size_t>(iArrowIdxInOut) < asFieldInfo.size() &&
+        asFieldInfo[iArrowIdxInOut].psGeoArrowSchema == schema)
+    {
+        ++iArrowIdxInOut;
+        return 0;
+    }
     if (IsStructure(format))
     {
         size_t nRet = 0;
@@ -6896,6 +8361,304 @@ FillFieldBinary(const struct ArrowArray *array, int iOGRFieldIdx,
     return true;
 }
 
+/************************************************************************/
+/*                     FillGeometryFromGeoArrow()                       */
+/************************************************************************/
+
+namespace
+{
+// Gives access to the coordinates of the innermost array of a GeoArrow
+// native encoded column, either a struct of x/y[/z][/m] arrays (separated
+// encoding) or a fixed size list array (interleaved encoding).
+struct GeoArrowCoordReader
+{
+    const double *m_padfX = nullptr;
+    const double *m_padfY = nullptr;
+    const double *m_padfZ = nullptr;
+    const double *m_padfM = nullptr;
+    size_t m_nStride = 1;
+    size_t m_nLength = 0;
+
+    GeoArrowCoordReader(const struct ArrowSchema *schema,
+                        const struct ArrowArray *array, bool bHasZ, bool bHasM)
+        : m_nLength(static_cast<size_t>(array->length))
+    {
+        if (IsStructure(schema->format))
+        {
+            const auto GetValues = [array](int iChild)
+            {
+                const auto psChild = array->children[iChild];
+                return static_cast<const double *>(psChild->buffers[1]) +
+                       static_cast<size_t>(psChild->offset + array->offset);
+            };
+            m_padfX = GetValues(0);
+            m_padfY = GetValues(1);
+            if (bHasZ)
+                m_padfZ = GetValues(2);
+            if (bHasM)
+                m_padfM = GetValues(bHasZ ? 3 : 2);
+        }
+        else
+        {
+            m_nStride = 2 + (bHasZ ? 1 : 0) + (bHasM ? 1 : 0);
+            const auto psChild = array->children[0];
+            const double *padfValues =
+                static_cast<const double *>(psChild->buffers[1]) +
+                static_cast<size_t>(psChild->offset) +
+                static_cast<size_t>(array->offset) * m_nStride;
+            m_padfX = padfValues;
+            m_padfY = padfValues + 1;
+            if (bHasZ)
+                m_padfZ = padfValues + 2;
+            if (bHasM)
+                m_padfM = padfValues + (bHasZ ? 3 : 2);
+        }
+    }
+
+    void SetPoint(OGRPoint *poPoint, size_t iIdx) const
+    {
+        const double dfX = m_padfX[iIdx * m_nStride];
+        const double dfY = m_padfY[iIdx * m_nStride];
+        // Empty points are encoded with NaN coordinates
+        if (std::isnan(dfX) && std::isnan(dfY))
+            return;
+        poPoint->setX(dfX);
+        poPoint->setY(dfY);
+        if (m_padfZ)
+            poPoint->setZ(m_padfZ[iIdx * m_nStride]);
+        if (m_padfM)
+            poPoint->setM(m_padfM[iIdx * m_nStride]);
+    }
+
+    bool SetPoints(OGRSimpleCurve *poCurve, size_t nStart, size_t nEnd) const
+    {
+        if (nEnd > m_nLength ||
+            nEnd - nStart >
+                static_cast<size_t>(std::numeric_limits<int>::max()))
+        {
+            return false;
+        }
+        const int nPoints = static_cast<int>(nEnd - nStart);
+        if (m_nStride == 1)
+        {
+            const double *padfX = m_padfX + nStart;
+            const double *padfY = m_padfY + nStart;
+            if (m_padfZ && m_padfM)
+                poCurve->setPoints(nPoints, padfX, padfY, m_padfZ + nStart,
+                                   m_padfM + nStart);
+            else if (m_padfZ)
+                poCurve->setPoints(nPoints, padfX, padfY, m_padfZ + nStart);
+            else if (m_padfM)
+                poCurve->setPointsM(nPoints, padfX, padfY, m_padfM + nStart);
+            else
+                poCurve->setPoints(nPoints, padfX, padfY);
+        }
+        else
+        {
+            poCurve->setNumPoints(nPoints, /* bZeroizeNewContent = */ FALSE);
+            for (int i = 0; i < nPoints; ++i)
+            {
+                const size_t iIdx = (nStart + i) * m_nStride;
+                if (m_padfZ && m_padfM)
+                    poCurve->setPoint(i, m_padfX[iIdx], m_padfY[iIdx],
+                                      m_padfZ[iIdx], m_padfM[iIdx]);
+                else if (m_padfZ)
+                    poCurve->setPoint(i, m_padfX[iIdx], m_padfY[iIdx],
+                                      m_padfZ[iIdx]);
+                else if (m_padfM)
+                    poCurve->setPointM(i, m_padfX[iIdx], m_padfY[iIdx],
+                                       m_padfM[iIdx]);
+                else
+                    poCurve->setPoint(i, m_padfX[iIdx], m_padfY[iIdx]);
+            }
+        }
+        return true;
+    }
+};
+}  // namespace
+
+// Get the range of child indices of the element iIdx of a list array.
+static bool GetGeoArrowListRange(const struct ArrowSchema *schema,
+                                 const struct ArrowArray *array, size_t iIdx,
+                                 size_t &nStart, size_t &nEnd)
+{
+    int64_t nStart64;
+    int64_t nEnd64;
+    const size_t iOffsettedIdx = iIdx + static_cast<size_t>(array->offset);
+    if (IsList(schema->format))
+    {
+        const auto panOffsets = static_cast<const int32_t *>(array->buffers[1]);
+        nStart64 = panOffsets[iOffsettedIdx];
+        nEnd64 = panOffsets[iOffsettedIdx + 1];
+    }
+    else
+    {
+        const auto panOffsets = static_cast<const int64_t *>(array->buffers[1]);
+        nStart64 = panOffsets[iOffsettedIdx];
+        nEnd64 = panOffsets[iOffsettedIdx + 1];
+    }
+    if (nStart64 < 0 || nStart64 > nEnd64 ||
+        nEnd64 > array->children[0]->length)
+    {
+        return false;
+    }
+    nStart = static_cast<size_t>(nStart64);
+    nEnd = static_cast<size_t>(nEnd64);
+    return true;
+}
+
+static bool FillGeometryFromGeoArrow(const struct ArrowSchema *schema,
+                                     const struct ArrowArray *array,
+                                     size_t iFeature, OGRwkbGeometryType eGType,
+                                     int iOGRFieldIdx, const char *pszFieldName,
+                                     OGRFeature &oFeature)
+{
+    const uint8_t *pabyValidity =
+        static_cast<const uint8_t *>(array->buffers[0]);
+    if (array->null_count != 0 && pabyValidity &&
+        !TestBit(pabyValidity, static_cast<size_t>(iFeature + array->offset)))
+    {
+        oFeature.SetGeomFieldDirectly(iOGRFieldIdx, nullptr);
+        return true;
+    }
+
+    const auto eFlatType = wkbFlatten(eGType);
+    const int nLevels = GetGeoArrowNestingLevels(eFlatType);
+    // Schema and array of each nesting level, the last one being the one of
+    // the coordinates.
+    std::vector<const struct ArrowSchema *> apsSchemas{schema};
+    std::vector<const struct ArrowArray *> apsArrays{array};
+    for (int iLevel = 0; iLevel < nLevels; ++iLevel)
+    {
+        apsSchemas.push_back(apsSchemas.back()->children[0]);
+        apsArrays.push_back(apsArrays.back()->children[0]);
+    }
+    const GeoArrowCoordReader oReader(apsSchemas.back(), apsArrays.back(),
+                                      CPL_TO_BOOL(OGR_GT_HasZ(eGType)),
+                                      CPL_TO_BOOL(OGR_GT_HasM(eGType)));
+
+    const auto FillPolygon =
+        [&apsSchemas, &apsArrays, &oReader](OGRPolygon *poPolygon, int iLevel,
+                                            size_t iIdx)
+    {
+        size_t nStart = 0;
+        size_t nEnd = 0;
+        if (!GetGeoArrowListRange(apsSchemas[iLevel], apsArrays[iLevel], iIdx,
+                                  nStart, nEnd))
+            return false;
+        for (size_t iRing = nStart; iRing < nEnd; ++iRing)
+        {
+            size_t nPointStart = 0;
+            size_t nPointEnd = 0;
+            auto poRing = std::make_unique<OGRLinearRing>();
+            if (!GetGeoArrowListRange(apsSchemas[iLevel + 1],
+                                      apsArrays[iLevel + 1], iRing, nPointStart,
+                                      nPointEnd) ||
+                !oReader.SetPoints(poRing.get(), nPointStart, nPointEnd))
+            {
+                return false;
+            }
+            poPolygon->addRingDirectly(poRing.release());
+        }
+        return true;
+    };
+
+    auto poGeom = std::unique_ptr<OGRGeometry>(
+        OGRGeometryFactory::createGeometry(eGType));
+    bool bOK = poGeom != nullptr;
+    size_t nStart = 0;
+    size_t nEnd = 0;
+    if (bOK && nLevels > 0)
+        bOK = GetGeoArrowListRange(schema, array, iFeature, nStart, nEnd);
+    if (bOK)
+    {
+        switch (eFlatType)
+        {
+            case wkbPoint:
+            {
+                bOK = iFeature < oReader.m_nLength;
+                if (bOK)
+                    oReader.SetPoint(poGeom->toPoint(), iFeature);
+                break;
+            }
+
+            case wkbLineString:
+            {
+                bOK = oReader.SetPoints(poGeom->toLineString(), nStart, nEnd);
+                break;
+            }
+
+            case wkbPolygon:
+            {
+                bOK = FillPolygon(poGeom->toPolygon(), 0, iFeature);
+                break;
+            }
+
+            case wkbMultiPoint:
+            {
+                for (size_t i = nStart; bOK && i < nEnd; ++i)
+                {
+                    bOK = i < oReader.m_nLength;
+                    if (bOK)
+                    {
+                        auto poPoint = std::make_unique<OGRPoint>();
+                        oReader.SetPoint(poPoint.get(), i);
+                        poGeom->toMultiPoint()->addGeometryDirectly(
+                            poPoint.release());
+                    }
+                }
+                break;
+            }
+
+            case wkbMultiLineString:
+            {
+                for (size_t i = nStart; bOK && i < nEnd; ++i)
+                {
+                    size_t nPointStart = 0;
+                    size_t nPointEnd = 0;
+                    auto poLS = std::make_unique<OGRLineString>();
+                    bOK = GetGeoArrowListRange(apsSchemas[1], apsArrays[1], i,
+                                               nPointStart, nPointEnd) &&
+                          oReader.SetPoints(poLS.get(), nPointStart,
+                                            nPointEnd);
+                    if (bOK)
+                        poGeom->toMultiLineString()->addGeometryDirectly(
+                            poLS.release());
+                }
+                break;
+            }
+
+            case wkbMultiPolygon:
+            {
+                for (size_t i = nStart; bOK && i < nEnd; ++i)
+                {
+                    auto poPolygon = std::make_unique<OGRPolygon>();
+                    bOK = FillPolygon(poPolygon.get(), 1, i);
+                    if (bOK)
+                        poGeom->toMultiPolygon()->addGeometryDirectly(
+                            poPolygon.release());
+                }
+                break;
+            }
+
+            default:
+                bOK = false;
+                break;
+        }
+    }
+
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid content in GeoArrow array %s for feature %" PRIu64,
+                 pszFieldName, static_cast<uint64_t>(iFeature));
+        return false;
+    }
+
+    oFeature.SetGeomFieldDirectly(iOGRFieldIdx, poGeom.release());
+    return true;
+}
+
 /************************************************************************/
 /*                             FillFeature()                            */
 /************************************************************************/
@@ -6910,6 +8673,16 @@ static bool FillFeature(OGRLayer *poLayer, const struct ArrowSchema *schema,
 {
     const char *fieldName = schema->name;
     const char *format = schema->format;
+    if (static_cast<size_t>(iArrowIdxInOut) < asFieldInfo.size() &&
+        asFieldInfo[iArrowIdxInOut].psGeoArrowSchema == schema)
+    {
+        const auto &sInfo = asFieldInfo[iArrowIdxInOut];
+        ++iArrowIdxInOut;
+        return FillGeometryFromGeoArrow(schema, array, iFeature,
+                                        sInfo.eGeoArrowGeomType,
+                                        sInfo.iOGRFieldIdx,
+                                        sInfo.osName.c_str(), oFeature);
+    }
     if (IsStructure(format))
     {
         const std::string osNewPrefix(osFieldPrefix + fieldName + ".");
@@ -7225,7 +8998,10 @@ static bool FillFeature(OGRLayer *poLayer, const struct ArrowSchema *schema,
  * can be used to control the behavior in case of lossy conversion.
  *
  * Arrays for geometry columns should be of binary or large binary type and
- * contain WKB geometry.
+ * contain WKB geometry. Starting with GDAL 3.10, geometry columns using the
+ * GeoArrow native encoding for Point, LineString, Polygon, MultiPoint,
+ * MultiLineString and MultiPolygon (with separated or interleaved coordinates,
+ * and identified by their ARROW:extension:name metadata) are also accepted.
  *
  * Note that the passed array may be set to a released state
  * (array->release==NULL) after this call (not by the base implementation,
@@ -7746,7 +9522,10 @@ bool OGRLayer::WriteArrowBatch(const struct ArrowSchema *schema,
  * can be used to control the behavior in case of lossy conversion.
  *
  * Arrays for geometry columns should be of binary or large binary type and
- * contain WKB geometry.
+ * contain WKB geometry. Starting with GDAL 3.10, geometry columns using the
+ * GeoArrow native encoding for Point, LineString, Polygon, MultiPoint,
+ * MultiLineString and MultiPolygon (with separated or interleaved coordinates,
+ * and identified by their ARROW:extension:name metadata) are also accepted.
  *
  * Note that the passed array may be set to a released state
  * (array->release==NULL) after this call (not by the base implementation,
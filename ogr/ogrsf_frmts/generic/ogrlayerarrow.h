@@ -38,6 +38,16 @@ constexpr const char *ARROW_EXTENSION_NAME_KEY = "ARROW:extension:name";
 constexpr const char *ARROW_EXTENSION_METADATA_KEY = "ARROW:extension:metadata";
 constexpr const char *EXTENSION_NAME_OGC_WKB = "ogc.wkb";
 constexpr const char *EXTENSION_NAME_GEOARROW_WKB = "geoarrow.wkb";
+constexpr const char *EXTENSION_NAME_GEOARROW_POINT = "geoarrow.point";
+constexpr const char *EXTENSION_NAME_GEOARROW_LINESTRING =
+    "geoarrow.linestring";
+constexpr const char *EXTENSION_NAME_GEOARROW_POLYGON = "geoarrow.polygon";
+constexpr const char *EXTENSION_NAME_GEOARROW_MULTIPOINT =
+    "geoarrow.multipoint";
+constexpr const char *EXTENSION_NAME_GEOARROW_MULTILINESTRING =
+    "geoarrow.multilinestring";
+constexpr const char *EXTENSION_NAME_GEOARROW_MULTIPOLYGON =
+    "geoarrow.multipolygon";
 constexpr const char *EXTENSION_NAME_ARROW_JSON = "arrow.json";
 
 std::map<std::string, std::string>
@@ -191,6 +191,10 @@ class OGRGeoJSONWriteLayer final : public OGRLayer
                    : OGRERR_FAILURE;
     }
 
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
+
     OGRErr SyncToDisk() override;
 
     GDALDataset *GetDataset() override;
@@ -218,9 +222,17 @@ class OGRGeoJSONWriteLayer final : public OGRLayer
     OGRGeometryFactory::TransformWithOptionsCache oTransformCache_;
     OGRGeoJSONWriteOptions oWriteOptions_;
 
+    // Features queued by ICreateFeature() during WriteArrowBatch(), to be
+    // serialized by worker threads.
+    int m_nBatchWriteThreads = 0;
+    std::vector<std::unique_ptr<OGRFeature>> m_apoPendingFeatures{};
+
     CPL_DISALLOW_COPY_ASSIGN(OGRGeoJSONWriteLayer)
 
     void FinishWriting();
+    OGRErr WriteSerializedFeature(const OGRFeature *poFeature,
+                                  const char *pszJson, size_t nLen);
+    OGRErr FlushPendingFeatures();
 };
 
 /************************************************************************/
@@ -33,9 +33,11 @@
 #include "ogrjsoncollectionstreamingparser.h"
 #include "ogr_api.h"
 
+#include <climits>
 #include <limits>
 #include <set>
 #include <functional>
+#include <vector>
 
 /************************************************************************/
 /*                      OGRGeoJSONReaderStreamingParser                 */
@@ -2694,6 +2696,36 @@ static double OGRGeoJSONGetCoordinate(json_object *poObj,
     return json_object_get_double(poObjCoord);
 }
 
+/************************************************************************/
+/*                        OGRGeoJSONReadPosition()                      */
+/************************************************************************/
+
+static bool OGRGeoJSONReadPosition(json_object *poObj, double &dfX,
+                                   double &dfY, double &dfZ, bool &bHasZ)
+{
+    if (json_type_array != json_object_get_type(poObj))
+        return false;
+
+    const auto nSize = json_object_array_length(poObj);
+    if (nSize < GeoJSONObject::eMinCoordinateDimension)
+    {
+        CPLDebug("GeoJSON", "Invalid coord dimension. "
+                            "At least 2 dimensions must be present.");
+        return false;
+    }
+
+    bool bValid = true;
+    dfX = OGRGeoJSONGetCoordinate(poObj, "x", 0, bValid);
+    dfY = OGRGeoJSONGetCoordinate(poObj, "y", 1, bValid);
+
+    // Read Z coordinate.
+    // Don't *expect* mixed-dimension geometries, although the
+    // spec doesn't explicitly forbid this.
+    bHasZ = nSize >= GeoJSONObject::eMaxCoordinateDimension;
+    dfZ = bHasZ ? OGRGeoJSONGetCoordinate(poObj, "z", 2, bValid) : 0.0;
+    return bValid;
+}
+
 /************************************************************************/
 /*                           OGRGeoJSONReadRawPoint                     */
 /************************************************************************/
@@ -2702,39 +2734,82 @@ bool OGRGeoJSONReadRawPoint(json_object *poObj, OGRPoint &point)
 {
     CPLAssert(nullptr != poObj);
 
-    if (json_type_array == json_object_get_type(poObj))
+    double dfX = 0;
+    double dfY = 0;
+    double dfZ = 0;
+    bool bHasZ = false;
+    if (!OGRGeoJSONReadPosition(poObj, dfX, dfY, dfZ, bHasZ))
+        return false;
+
+    point.setX(dfX);
+    point.setY(dfY);
+    if (bHasZ)
+        point.setZ(dfZ);
+    else
+        point.flattenTo2D();
+    return true;
+}
+
+/************************************************************************/
+/*                        OGRGeoJSONReadPositions()                     */
+/************************************************************************/
+
+// Reads an array of positions into a curve, setting all its points at once
+// rather than going through an intermediate OGRPoint for each position.
+static bool OGRGeoJSONReadPositions(json_object *poObjPoints,
+                                    OGRSimpleCurve *poCurve,
+                                    const char *pszGeomType)
+{
+    const auto nPoints = json_object_array_length(poObjPoints);
+    if (nPoints > static_cast<size_t>(INT_MAX))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "%s: too many points.",
+                 pszGeomType);
+        return false;
+    }
+
+    std::vector<OGRRawPoint> aoPoints;
+    std::vector<double> adfZ;
+    try
+    {
+        aoPoints.resize(nPoints);
+    }
+    catch (const std::exception &)
     {
-        const auto nSize = json_object_array_length(poObj);
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: too many points.",
+                 pszGeomType);
+        return false;
+    }
 
-        if (nSize < GeoJSONObject::eMinCoordinateDimension)
+    for (auto i = decltype(nPoints){0}; i < nPoints; ++i)
+    {
+        json_object *poObjCoords = json_object_array_get_idx(poObjPoints, i);
+        if (poObjCoords == nullptr)
         {
-            CPLDebug("GeoJSON", "Invalid coord dimension. "
-                                "At least 2 dimensions must be present.");
+            CPLDebug("GeoJSON", "%s: got null object.", pszGeomType);
             return false;
         }
 
-        bool bValid = true;
-        const double dfX = OGRGeoJSONGetCoordinate(poObj, "x", 0, bValid);
-        const double dfY = OGRGeoJSONGetCoordinate(poObj, "y", 1, bValid);
-        point.setX(dfX);
-        point.setY(dfY);
-
-        // Read Z coordinate.
-        if (nSize >= GeoJSONObject::eMaxCoordinateDimension)
+        double dfZ = 0;
+        bool bHasZ = false;
+        if (!OGRGeoJSONReadPosition(poObjCoords, aoPoints[i].x, aoPoints[i].y,
+                                    dfZ, bHasZ))
         {
-            // Don't *expect* mixed-dimension geometries, although the
-            // spec doesn't explicitly forbid this.
-            const double dfZ = OGRGeoJSONGetCoordinate(poObj, "z", 2, bValid);
-            point.setZ(dfZ);
+            CPLDebug("GeoJSON", "%s: raw point parsing failure.",
+                     pszGeomType);
+            return false;
         }
-        else
+        if (bHasZ)
         {
-            point.flattenTo2D();
+            if (adfZ.empty())
+                adfZ.resize(nPoints);
+            adfZ[i] = dfZ;
         }
-        return bValid;
     }
 
-    return false;
+    poCurve->setPoints(static_cast<int>(nPoints), aoPoints.data(),
+                       adfZ.empty() ? nullptr : adfZ.data());
+    return true;
 }
 
 /************************************************************************/
@@ -2838,38 +2913,11 @@ OGRLineString *OGRGeoJSONReadLineString(json_object *poObj, bool bRaw)
 
     if (json_type_array == json_object_get_type(poObjPoints))
     {
-        const auto nPoints = json_object_array_length(poObjPoints);
-
         poLine = new OGRLineString();
-        poLine->setNumPoints(static_cast<int>(nPoints));
-
-        for (auto i = decltype(nPoints){0}; i < nPoints; ++i)
+        if (!OGRGeoJSONReadPositions(poObjPoints, poLine, "LineString"))
         {
-            json_object *poObjCoords =
-                json_object_array_get_idx(poObjPoints, i);
-            if (poObjCoords == nullptr)
-            {
-                delete poLine;
-                CPLDebug("GeoJSON", "LineString: got null object.");
-                return nullptr;
-            }
-
-            OGRPoint pt;
-            if (!OGRGeoJSONReadRawPoint(poObjCoords, pt))
-            {
-                delete poLine;
-                CPLDebug("GeoJSON", "LineString: raw point parsing failure.");
-                return nullptr;
-            }
-            if (pt.getCoordinateDimension() == 2)
-            {
-                poLine->setPoint(static_cast<int>(i), pt.getX(), pt.getY());
-            }
-            else
-            {
-                poLine->setPoint(static_cast<int>(i), pt.getX(), pt.getY(),
-                                 pt.getZ());
-            }
+            delete poLine;
+            return nullptr;
         }
     }
 
@@ -2933,34 +2981,11 @@ OGRLinearRing *OGRGeoJSONReadLinearRing(json_object *poObj)
 
     if (json_type_array == json_object_get_type(poObj))
     {
-        const auto nPoints = json_object_array_length(poObj);
-
         poRing = new OGRLinearRing();
-        poRing->setNumPoints(static_cast<int>(nPoints));
-
-        for (auto i = decltype(nPoints){0}; i < nPoints; ++i)
+        if (!OGRGeoJSONReadPositions(poObj, poRing, "LinearRing"))
         {
-            json_object *poObjCoords = json_object_array_get_idx(poObj, i);
-            if (poObjCoords == nullptr)
-            {
-                delete poRing;
-                CPLDebug("GeoJSON", "LinearRing: got null object.");
-                return nullptr;
-            }
-
-            OGRPoint pt;
-            if (!OGRGeoJSONReadRawPoint(poObjCoords, pt))
-            {
-                delete poRing;
-                CPLDebug("GeoJSON", "LinearRing: raw point parsing failure.");
-                return nullptr;
-            }
-
-            if (2 == pt.getCoordinateDimension())
-                poRing->setPoint(static_cast<int>(i), pt.getX(), pt.getY());
-            else
-                poRing->setPoint(static_cast<int>(i), pt.getX(), pt.getY(),
-                                 pt.getZ());
+            delete poRing;
+            return nullptr;
         }
     }
 
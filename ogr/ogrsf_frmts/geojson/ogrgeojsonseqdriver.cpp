@@ -30,13 +30,19 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_vsi_error.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_geojson.h"
 #include "ogrgeojsonreader.h"
 #include "ogrgeojsonwriter.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 
 constexpr char RS = '\x1e';
 
@@ -105,6 +111,34 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     OGRGeoJSONWriteOptions m_oWriteOptions;
 
     json_object *GetNextObject(bool bLooseIdentification);
+    OGRFeature *TranslateObject(json_object *poObject,
+                                const char *pszSerializedObj);
+
+    // Parallel parsing of objects, when reading through ArrowArray.
+    struct ParseChunk;
+    bool m_bParallelParsingTried = false;
+    std::unique_ptr<CPLJobQueue> m_poParseJobQueue{};
+    std::mutex m_oParseMutex{};
+    std::condition_variable m_oParseCV{};
+    std::deque<std::unique_ptr<ParseChunk>> m_apoParseChunks{};
+    size_t m_nMaxQueuedParseChunks = 0;
+    size_t m_iNextParsedFeature = 0;
+    std::string m_osParseRemainder{};
+    bool m_bParseEOF = false;
+
+    void StartParallelParsing();
+    void StopParallelParsing();
+    bool QueueParseChunk();
+    static void ParseChunkJob(void *pData);
+    OGRFeature *GetNextParsedFeature();
+
+    // Features queued by ICreateFeature() during WriteArrowBatch(), to be
+    // serialized by worker threads.
+    int m_nBatchWriteThreads = 0;
+    std::vector<std::unique_ptr<OGRFeature>> m_apoPendingFeatures{};
+
+    OGRErr WriteSerializedFeature(const char *pszJson, size_t nLen);
+    OGRErr FlushPendingFeatures();
 
   public:
     OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS, const char *pszName);
@@ -126,6 +160,8 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
     OGRFeatureDefn *GetLayerDefn() override;
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
 
     const char *GetFIDColumn() override
     {
@@ -136,6 +172,9 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     int TestCapability(const char *) override;
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
     OGRErr CreateField(const OGRFieldDefn *, int) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
 
     GDALDataset *GetDataset() override
     {
@@ -381,6 +420,7 @@ OGRGeoJSONSeqLayer::OGRGeoJSONSeqLayer(
 
 OGRGeoJSONSeqLayer::~OGRGeoJSONSeqLayer()
 {
+    StopParallelParsing();
     m_poFeatureDefn->Release();
 }
 
@@ -472,6 +512,9 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
 
 void OGRGeoJSONSeqLayer::ResetReading()
 {
+    StopParallelParsing();
+    m_bParallelParsingTried = false;
+
     if (!m_poDS->m_bSupportsRead ||
         (m_bWriteOnlyLayer && m_poDS->m_apoLayers.size() > 1))
     {
@@ -614,34 +657,22 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     GetLayerDefn();  // force scan if not already done
     while (true)
     {
-        auto poObject = GetNextObject(false);
-        if (!poObject)
-            return nullptr;
         OGRFeature *poFeature;
-        auto type = OGRGeoJSONGetType(poObject);
-        if (type == GeoJSONObject::eFeature)
-        {
-            poFeature = m_oReader.ReadFeature(this, poObject,
-                                              m_osFeatureBuffer.c_str());
-            json_object_put(poObject);
-        }
-        else if (type == GeoJSONObject::eFeatureCollection ||
-                 type == GeoJSONObject::eUnknown)
+        if (m_poParseJobQueue)
         {
-            json_object_put(poObject);
-            continue;
+            poFeature = GetNextParsedFeature();
+            if (!poFeature)
+                return nullptr;
         }
         else
         {
-            OGRGeometry *poGeom =
-                m_oReader.ReadGeometry(poObject, GetSpatialRef());
+            auto poObject = GetNextObject(false);
+            if (!poObject)
+                return nullptr;
+            poFeature = TranslateObject(poObject, m_osFeatureBuffer.c_str());
             json_object_put(poObject);
-            if (!poGeom)
-            {
+            if (!poFeature)
                 continue;
-            }
-            poFeature = new OGRFeature(m_poFeatureDefn);
-            poFeature->SetGeometryDirectly(poGeom);
         }
 
         if (poFeature->GetFID() == OGRNullFID)
@@ -659,6 +690,301 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                          TranslateObject()                           */
+/************************************************************************/
+
+// Returns nullptr for objects that are not features nor geometries. Only
+// depends on the layer definition, so that it can be called from several
+// threads at once.
+OGRFeature *OGRGeoJSONSeqLayer::TranslateObject(json_object *poObject,
+                                                const char *pszSerializedObj)
+{
+    const auto type = OGRGeoJSONGetType(poObject);
+    if (type == GeoJSONObject::eFeature)
+    {
+        return m_oReader.ReadFeature(this, poObject, pszSerializedObj);
+    }
+    else if (type == GeoJSONObject::eFeatureCollection ||
+             type == GeoJSONObject::eUnknown)
+    {
+        return nullptr;
+    }
+
+    OGRGeometry *poGeom = m_oReader.ReadGeometry(poObject, GetSpatialRef());
+    if (!poGeom)
+        return nullptr;
+    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    poFeature->SetGeometryDirectly(poGeom);
+    return poFeature;
+}
+
+/************************************************************************/
+/*                      OGRGeoJSONSeqLayer::ParseChunk                  */
+/************************************************************************/
+
+// Range of complete objects of the file, parsed by a worker thread.
+struct OGRGeoJSONSeqLayer::ParseChunk
+{
+    OGRGeoJSONSeqLayer *poLayer = nullptr;
+    std::string osData{};
+    bool bDone = false;  // protected by poLayer->m_oParseMutex
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+};
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+int OGRGeoJSONSeqLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                          struct ArrowArray *out_array)
+{
+    if (!m_bParallelParsingTried)
+    {
+        m_bParallelParsingTried = true;
+        StartParallelParsing();
+    }
+
+    return OGRLayer::GetNextArrowArray(stream, out_array);
+}
+
+/************************************************************************/
+/*                       StartParallelParsing()                         */
+/************************************************************************/
+
+// Objects are split from the file by the calling thread, at the sequence
+// separators, and parsed and translated into features by worker threads of
+// the global thread pool. Filters are still evaluated in GetNextFeature().
+void OGRGeoJSONSeqLayer::StartParallelParsing()
+{
+    if (!m_poDS->m_bSupportsRead || m_bWriteOnlyLayer ||
+        (m_poSharedArrowArrayStreamPrivateData &&
+         !m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty()))
+    {
+        return;
+    }
+
+    // Only when starting from the beginning of the file
+    GetLayerDefn();  // force scan if not already done
+    if (m_nNextFID != 0 || VSIFTellL(m_poDS->m_fp) != 0)
+        return;
+
+    const int nThreads = OGRGeoJSONGetNumThreads("OGR_GEOJSONSEQ_NUM_THREADS");
+    if (nThreads < 2)
+        return;
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (poPool == nullptr)
+        return;
+
+    CPLDebug("GeoJSONSeq", "Using %d threads to parse objects of layer %s",
+             nThreads, GetDescription());
+    m_poParseJobQueue = poPool->CreateJobQueue();
+    m_nMaxQueuedParseChunks = 2 * static_cast<size_t>(nThreads);
+}
+
+/************************************************************************/
+/*                        StopParallelParsing()                         */
+/************************************************************************/
+
+void OGRGeoJSONSeqLayer::StopParallelParsing()
+{
+    if (m_poParseJobQueue)
+    {
+        m_poParseJobQueue->WaitCompletion();
+        m_poParseJobQueue.reset();
+    }
+    m_apoParseChunks.clear();
+    m_iNextParsedFeature = 0;
+    m_osParseRemainder.clear();
+    m_bParseEOF = false;
+}
+
+/************************************************************************/
+/*                          QueueParseChunk()                           */
+/************************************************************************/
+
+// Read from the file until at least a chunk worth of complete objects is
+// available, and submit them for parsing. Returns false at end of file.
+bool OGRGeoJSONSeqLayer::QueueParseChunk()
+{
+    // Undocumented: for testing purposes only
+    const size_t nChunkSize = static_cast<size_t>(std::max(
+        1, atoi(CPLGetConfigOption("OGR_GEOJSONSEQ_PARSE_CHUNK_SIZE",
+                                   "1048576"))));
+    const char chSep = m_poDS->m_bIsRSSeparated ? RS : '\n';
+
+    // The remainder of the previous call does not contain any separator.
+    std::string &osBuffer = m_osParseRemainder;
+    size_t nComplete = 0;
+    size_t nCut = 0;
+    while (true)
+    {
+        const size_t nSize = osBuffer.size();
+        if (m_bParseEOF)
+        {
+            nCut = nSize;
+            break;
+        }
+        if (nComplete > 0 && nSize >= nChunkSize)
+        {
+            nCut = nComplete;
+            break;
+        }
+        if (m_nMaxObjectSize > 0 && nSize - nComplete > m_nMaxObjectSize)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Too large feature. You may define the "
+                     "OGR_GEOJSON_MAX_OBJ_SIZE configuration option to "
+                     "a value in megabytes (larger than %u) to allow "
+                     "for larger features, or 0 to remove any size limit.",
+                     static_cast<unsigned>((nSize - nComplete) / 1024 / 1024));
+            m_bParseEOF = true;
+            osBuffer.resize(nComplete);
+            nCut = nComplete;
+            break;
+        }
+
+        try
+        {
+            osBuffer.resize(nSize + nChunkSize);
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+            return false;
+        }
+        const size_t nRead =
+            VSIFReadL(&osBuffer[nSize], 1, nChunkSize, m_poDS->m_fp);
+        osBuffer.resize(nSize + nRead);
+        if (nRead < nChunkSize)
+            m_bParseEOF = true;
+
+        // Only look for the last separator in the newly read bytes
+        for (size_t i = nSize + nRead; i > nSize; --i)
+        {
+            if (osBuffer[i - 1] == chSep)
+            {
+                nComplete = i;
+                break;
+            }
+        }
+    }
+
+    if (nCut == 0)
+    {
+        osBuffer.clear();
+        return false;
+    }
+
+    auto poChunk = std::make_unique<ParseChunk>();
+    poChunk->poLayer = this;
+    if (nCut == osBuffer.size())
+    {
+        poChunk->osData = std::move(osBuffer);
+        osBuffer.clear();
+    }
+    else
+    {
+        poChunk->osData.assign(osBuffer, 0, nCut);
+        osBuffer.erase(0, nCut);
+    }
+
+    ParseChunk *psChunk = poChunk.get();
+    m_apoParseChunks.push_back(std::move(poChunk));
+    if (!m_poParseJobQueue->SubmitJob(ParseChunkJob, psChunk))
+        ParseChunkJob(psChunk);
+    return true;
+}
+
+/************************************************************************/
+/*                           ParseChunkJob()                            */
+/************************************************************************/
+
+void OGRGeoJSONSeqLayer::ParseChunkJob(void *pData)
+{
+    ParseChunk *psChunk = static_cast<ParseChunk *>(pData);
+    OGRGeoJSONSeqLayer *poLayer = psChunk->poLayer;
+    const char chSep = poLayer->m_poDS->m_bIsRSSeparated ? RS : '\n';
+
+    // Errors are emitted again by the thread that consumes the features.
+    CPLInstallErrorHandlerAccumulator(psChunk->aoErrors);
+
+    const std::string &osData = psChunk->osData;
+    std::string osObject;
+    size_t nPos = 0;
+    while (nPos < osData.size())
+    {
+        size_t nEnd = osData.find(chSep, nPos);
+        if (nEnd == std::string::npos)
+            nEnd = osData.size();
+        osObject.assign(osData, nPos, nEnd - nPos);
+        nPos = nEnd + 1;
+
+        while (!osObject.empty() &&
+               (osObject.back() == '\r' || osObject.back() == '\n'))
+        {
+            osObject.pop_back();
+        }
+        if (osObject.empty())
+            continue;
+
+        json_object *poObject = nullptr;
+        CPL_IGNORE_RET_VAL(OGRJSonParse(osObject.c_str(), &poObject));
+        if (json_object_get_type(poObject) == json_type_object)
+        {
+            OGRFeature *poFeature =
+                poLayer->TranslateObject(poObject, osObject.c_str());
+            if (poFeature)
+                psChunk->apoFeatures.emplace_back(poFeature);
+        }
+        json_object_put(poObject);
+    }
+
+    CPLUninstallErrorHandlerAccumulator();
+
+    std::lock_guard<std::mutex> oLock(poLayer->m_oParseMutex);
+    psChunk->bDone = true;
+    poLayer->m_oParseCV.notify_all();
+}
+
+/************************************************************************/
+/*                        GetNextParsedFeature()                        */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONSeqLayer::GetNextParsedFeature()
+{
+    while (true)
+    {
+        while (m_apoParseChunks.size() < m_nMaxQueuedParseChunks &&
+               QueueParseChunk())
+        {
+        }
+        if (m_apoParseChunks.empty())
+            return nullptr;
+
+        ParseChunk *psChunk = m_apoParseChunks.front().get();
+        {
+            std::unique_lock<std::mutex> oLock(m_oParseMutex);
+            m_oParseCV.wait(oLock, [psChunk] { return psChunk->bDone; });
+        }
+
+        if (m_iNextParsedFeature == 0)
+        {
+            for (const auto &oError : psChunk->aoErrors)
+                CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+        }
+        if (m_iNextParsedFeature < psChunk->apoFeatures.size())
+        {
+            return psChunk->apoFeatures[m_iNextParsedFeature++].release();
+        }
+
+        m_apoParseChunks.pop_front();
+        m_iNextParsedFeature = 0;
+    }
+}
+
 /************************************************************************/
 /*                          GetFeatureCount()                           */
 /************************************************************************/
@@ -744,27 +1070,104 @@ OGRErr OGRGeoJSONSeqLayer::ICreateFeature(OGRFeature *poFeature)
 
     ++m_nTotalFeatures;
 
+    if (m_nBatchWriteThreads > 0)
+    {
+        if (!poFeatureToWrite)
+            poFeatureToWrite.reset(poFeature->Clone());
+        m_apoPendingFeatures.push_back(std::move(poFeatureToWrite));
+        // Bound memory usage on large batches
+        constexpr size_t MAX_PENDING_FEATURES_PER_THREAD = 1000;
+        if (m_apoPendingFeatures.size() >=
+            MAX_PENDING_FEATURES_PER_THREAD *
+                static_cast<size_t>(m_nBatchWriteThreads))
+        {
+            return FlushPendingFeatures();
+        }
+        return OGRERR_NONE;
+    }
+
     json_object *poObj = OGRGeoJSONWriteFeature(
         poFeatureToWrite.get() ? poFeatureToWrite.get() : poFeature,
         m_oWriteOptions);
     CPLAssert(nullptr != poObj);
 
     const char *pszJson = json_object_to_json_string(poObj);
+    const OGRErr eErr = WriteSerializedFeature(pszJson, strlen(pszJson));
+
+    json_object_put(poObj);
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                       WriteSerializedFeature()                       */
+/************************************************************************/
 
+OGRErr OGRGeoJSONSeqLayer::WriteSerializedFeature(const char *pszJson,
+                                                  size_t nLen)
+{
     char chEOL = '\n';
-    OGRErr eErr = OGRERR_NONE;
     if ((m_poDS->m_bIsRSSeparated &&
          VSIFWriteL(&RS, 1, 1, m_poDS->m_fp) != 1) ||
-        VSIFWriteL(pszJson, strlen(pszJson), 1, m_poDS->m_fp) != 1 ||
+        VSIFWriteL(pszJson, nLen, 1, m_poDS->m_fp) != 1 ||
         VSIFWriteL(&chEOL, 1, 1, m_poDS->m_fp) != 1)
     {
         CPLError(CE_Failure, CPLE_FileIO, "Cannot write feature");
-        eErr = OGRERR_FAILURE;
+        return OGRERR_FAILURE;
     }
+    return OGRERR_NONE;
+}
 
-    json_object_put(poObj);
+/************************************************************************/
+/*                        FlushPendingFeatures()                        */
+/************************************************************************/
 
-    return eErr;
+OGRErr OGRGeoJSONSeqLayer::FlushPendingFeatures()
+{
+    if (m_apoPendingFeatures.empty())
+        return OGRERR_NONE;
+
+    // Same flags as json_object_to_json_string()
+    const auto aosJson =
+        OGRGeoJSONSerializeFeatures(m_apoPendingFeatures, m_oWriteOptions,
+                                    JSON_C_TO_STRING_SPACED,
+                                    m_nBatchWriteThreads);
+    m_apoPendingFeatures.clear();
+
+    for (const auto &osJson : aosJson)
+    {
+        if (WriteSerializedFeature(osJson.c_str(), osJson.size()) !=
+            OGRERR_NONE)
+        {
+            return OGRERR_FAILURE;
+        }
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+// Features of the batch are converted and reprojected by the generic
+// implementation through ICreateFeature(), and their JSON serialization is
+// done by worker threads.
+bool OGRGeoJSONSeqLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                         struct ArrowArray *array,
+                                         CSLConstList papszOptions)
+{
+    const int nThreads = OGRGeoJSONGetNumThreads("OGR_GEOJSONSEQ_NUM_THREADS");
+    if (nThreads < 2)
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+
+    m_nBatchWriteThreads = nThreads;
+    bool bRet = OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    // Features accepted before a failure are written, as they would have
+    // been without multi-threading.
+    if (FlushPendingFeatures() != OGRERR_NONE)
+        bRet = false;
+    m_nBatchWriteThreads = 0;
+    return bRet;
 }
 
 /************************************************************************/
@@ -34,6 +34,12 @@
 
 #include <algorithm>
 
+constexpr int JSON_FLAGS = JSON_C_TO_STRING_SPACED
+#ifdef JSON_C_TO_STRING_NOSLASHESCAPE
+                           | JSON_C_TO_STRING_NOSLASHESCAPE
+#endif
+    ;
+
 /************************************************************************/
 /*                         OGRGeoJSONWriteLayer()                       */
 /************************************************************************/
@@ -193,8 +199,6 @@ OGRErr OGRGeoJSONWriteLayer::SyncToDisk()
 
 OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
 {
-    VSILFILE *fp = poDS_->GetOutputFile();
-
     OGRFeature *poFeatureToWrite;
     if (poCT_ != nullptr || bRFC7946_)
     {
@@ -287,12 +291,50 @@ OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
 
     if (oWriteOptions_.bGenerateID && poFeatureToWrite->GetFID() == OGRNullFID)
     {
-        poFeatureToWrite->SetFID(nOutCounter_);
+        poFeatureToWrite->SetFID(
+            nOutCounter_ + static_cast<GIntBig>(m_apoPendingFeatures.size()));
     }
+
+    if (m_nBatchWriteThreads > 0)
+    {
+        if (poFeatureToWrite == poFeature)
+            poFeatureToWrite = poFeature->Clone();
+        m_apoPendingFeatures.emplace_back(poFeatureToWrite);
+        // Bound memory usage on large batches
+        constexpr size_t MAX_PENDING_FEATURES_PER_THREAD = 1000;
+        if (m_apoPendingFeatures.size() >=
+            MAX_PENDING_FEATURES_PER_THREAD *
+                static_cast<size_t>(m_nBatchWriteThreads))
+        {
+            return FlushPendingFeatures();
+        }
+        return OGRERR_NONE;
+    }
+
     json_object *poObj =
         OGRGeoJSONWriteFeature(poFeatureToWrite, oWriteOptions_);
     CPLAssert(nullptr != poObj);
 
+    const char *pszJson = json_object_to_json_string_ext(poObj, JSON_FLAGS);
+    const OGRErr eErr =
+        WriteSerializedFeature(poFeatureToWrite, pszJson, strlen(pszJson));
+    json_object_put(poObj);
+
+    if (poFeatureToWrite != poFeature)
+        delete poFeatureToWrite;
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                       WriteSerializedFeature()                       */
+/************************************************************************/
+
+OGRErr OGRGeoJSONWriteLayer::WriteSerializedFeature(
+    const OGRFeature *poFeatureToWrite, const char *pszJson, size_t nLen)
+{
+    VSILFILE *fp = poDS_->GetOutputFile();
+
     if (m_nPositionBeforeFCClosed)
     {
         // If we had called SyncToDisk() previously, undo its effects
@@ -305,15 +347,8 @@ OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
         /* Separate "Feature" entries in "FeatureCollection" object. */
         VSIFPrintfL(fp, ",\n");
     }
-    const char *pszJson = json_object_to_json_string_ext(
-        poObj, JSON_C_TO_STRING_SPACED
-#ifdef JSON_C_TO_STRING_NOSLASHESCAPE
-                   | JSON_C_TO_STRING_NOSLASHESCAPE
-#endif
-    );
 
     OGRErr eErr = OGRERR_NONE;
-    size_t nLen = strlen(pszJson);
     if (!osForeignMembers_.empty())
     {
         if (nLen > 2 && pszJson[nLen - 2] == ' ' && pszJson[nLen - 1] == '}')
@@ -344,11 +379,9 @@ OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
         eErr = OGRERR_FAILURE;
     }
 
-    json_object_put(poObj);
-
     ++nOutCounter_;
 
-    OGRGeometry *poGeometry = poFeatureToWrite->GetGeometryRef();
+    const OGRGeometry *poGeometry = poFeatureToWrite->GetGeometryRef();
     if (poGeometry != nullptr && !poGeometry->IsEmpty())
     {
         OGREnvelope3D sEnvelope = OGRGeoJSONGetBBox(poGeometry, oWriteOptions_);
@@ -429,12 +462,56 @@ OGRErr OGRGeoJSONWriteLayer::ICreateFeature(OGRFeature *poFeature)
         }
     }
 
-    if (poFeatureToWrite != poFeature)
-        delete poFeatureToWrite;
+    return eErr;
+}
+
+/************************************************************************/
+/*                        FlushPendingFeatures()                        */
+/************************************************************************/
 
+OGRErr OGRGeoJSONWriteLayer::FlushPendingFeatures()
+{
+    if (m_apoPendingFeatures.empty())
+        return OGRERR_NONE;
+
+    const auto aosJson = OGRGeoJSONSerializeFeatures(
+        m_apoPendingFeatures, oWriteOptions_, JSON_FLAGS, m_nBatchWriteThreads);
+
+    OGRErr eErr = OGRERR_NONE;
+    for (size_t i = 0; eErr == OGRERR_NONE && i < aosJson.size(); ++i)
+    {
+        eErr = WriteSerializedFeature(m_apoPendingFeatures[i].get(),
+                                      aosJson[i].c_str(), aosJson[i].size());
+    }
+    m_apoPendingFeatures.clear();
     return eErr;
 }
 
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+// Features of the batch are converted and prepared (reprojected, etc.) by
+// the generic implementation through ICreateFeature(), and their JSON
+// serialization is done by worker threads.
+bool OGRGeoJSONWriteLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                           struct ArrowArray *array,
+                                           CSLConstList papszOptions)
+{
+    const int nThreads = OGRGeoJSONGetNumThreads("OGR_GEOJSON_NUM_THREADS");
+    if (nThreads < 2)
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+
+    m_nBatchWriteThreads = nThreads;
+    bool bRet = OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    // Features accepted before a failure are written, as they would have
+    // been without multi-threading.
+    if (FlushPendingFeatures() != OGRERR_NONE)
+        bRet = false;
+    m_nBatchWriteThreads = 0;
+    return bRet;
+}
+
 /************************************************************************/
 /*                           CreateField()                              */
 /************************************************************************/
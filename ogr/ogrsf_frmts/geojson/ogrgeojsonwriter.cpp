@@ -40,6 +40,9 @@
 #endif
 
 #include <printbuf.h>
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_p.h"
 
@@ -784,6 +787,115 @@ json_object *OGRGeoJSONWriteFeature(OGRFeature *poFeature,
     return poObj;
 }
 
+/************************************************************************/
+/*                       OGRGeoJSONGetNumThreads()                      */
+/************************************************************************/
+
+/** Return the number of threads to use, as specified by the value of
+ * pszConfigOption (integer or ALL_CPUS), defaulting to min(4, number of CPUs).
+ */
+int OGRGeoJSONGetNumThreads(const char *pszConfigOption)
+{
+    const char *pszNumThreads = CPLGetConfigOption(pszConfigOption, nullptr);
+    return pszNumThreads == nullptr        ? std::min(4, CPLGetNumCPUs())
+           : EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                              : atoi(pszNumThreads);
+}
+
+/************************************************************************/
+/*                     OGRGeoJSONSerializeFeatures()                    */
+/************************************************************************/
+
+namespace
+{
+struct OGRGeoJSONSerializeJob
+{
+    const std::vector<std::unique_ptr<OGRFeature>> *papoFeatures = nullptr;
+    const OGRGeoJSONWriteOptions *poOptions = nullptr;
+    int nJsonFlags = 0;
+    size_t iStart = 0;
+    size_t iEnd = 0;
+    std::vector<std::string> *paosJson = nullptr;
+    std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+
+    void Run()
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            json_object *poObj =
+                OGRGeoJSONWriteFeature((*papoFeatures)[i].get(), *poOptions);
+            CPLAssert(nullptr != poObj);
+            (*paosJson)[i] = json_object_to_json_string_ext(poObj, nJsonFlags);
+            json_object_put(poObj);
+        }
+    }
+
+    static void Func(void *pData)
+    {
+        auto psJob = static_cast<OGRGeoJSONSerializeJob *>(pData);
+        // Errors are emitted again by the calling thread.
+        CPLInstallErrorHandlerAccumulator(psJob->aoErrors);
+        psJob->Run();
+        CPLUninstallErrorHandlerAccumulator();
+    }
+};
+}  // namespace
+
+/** Serialize features as JSON text with json_object_to_json_string_ext().
+ *
+ * When nThreads >= 2, the features are split into contiguous ranges that
+ * are serialized by worker threads of the global thread pool. Errors emitted
+ * during serialization are re-emitted by the calling thread.
+ */
+std::vector<std::string> OGRGeoJSONSerializeFeatures(
+    const std::vector<std::unique_ptr<OGRFeature>> &apoFeatures,
+    const OGRGeoJSONWriteOptions &oOptions, int nJsonFlags, int nThreads)
+{
+    std::vector<std::string> aosJson(apoFeatures.size());
+
+    // Do not bother with threads for a handful of features.
+    constexpr size_t MIN_FEATURES_PER_JOB = 64;
+    const size_t nJobs = std::min(
+        static_cast<size_t>(std::max(1, nThreads)),
+        (apoFeatures.size() + MIN_FEATURES_PER_JOB - 1) / MIN_FEATURES_PER_JOB);
+    CPLWorkerThreadPool *poPool =
+        nJobs >= 2 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+
+    std::vector<OGRGeoJSONSerializeJob> asJobs(poPool ? nJobs : 1);
+    for (size_t i = 0; i < asJobs.size(); ++i)
+    {
+        auto &sJob = asJobs[i];
+        sJob.papoFeatures = &apoFeatures;
+        sJob.poOptions = &oOptions;
+        sJob.nJsonFlags = nJsonFlags;
+        sJob.iStart = i * apoFeatures.size() / asJobs.size();
+        sJob.iEnd = (i + 1) * apoFeatures.size() / asJobs.size();
+        sJob.paosJson = &aosJson;
+    }
+
+    if (!poPool)
+    {
+        asJobs[0].Run();
+        return aosJson;
+    }
+
+    auto poQueue = poPool->CreateJobQueue();
+    for (auto &sJob : asJobs)
+    {
+        if (!poQueue->SubmitJob(OGRGeoJSONSerializeJob::Func, &sJob))
+            OGRGeoJSONSerializeJob::Func(&sJob);
+    }
+    poQueue->WaitCompletion();
+
+    for (const auto &sJob : asJobs)
+    {
+        for (const auto &oError : sJob.aoErrors)
+            CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    }
+
+    return aosJson;
+}
+
 /************************************************************************/
 /*                        OGRGeoJSONWriteId                            */
 /************************************************************************/
@@ -1630,7 +1742,7 @@ static int OGR_json_double_with_precision_to_string(struct json_object *jso,
     const double dfVal = json_object_get_double(jso);
     if (fabs(dfVal) > 1e50 && !CPLIsInf(dfVal))
     {
-        CPLsnprintf(szBuffer, sizeof(szBuffer), "%.18g", dfVal);
+        OGRFormatDoublePrecision(szBuffer, sizeof(szBuffer), dfVal, 18, 'g');
     }
     else
     {
@@ -1678,7 +1790,6 @@ static int OGR_json_double_with_significant_figures_to_string(
     }
     else
     {
-        char szFormatting[32] = {};
         const void *userData =
 #if (!defined(JSON_C_VERSION_NUM)) || (JSON_C_VERSION_NUM < JSON_C_VER_013)
             jso->_userdata;
@@ -1693,9 +1804,8 @@ static int OGR_json_double_with_significant_figures_to_string(
             bSignificantFiguresIsNegative
                 ? 17
                 : static_cast<int>(nSignificantFigures);
-        CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
-                    nInitialSignificantFigures);
-        nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting, dfVal);
+        nSize = OGRFormatDoublePrecision(szBuffer, sizeof(szBuffer), dfVal,
+                                         nInitialSignificantFigures, 'g');
         const char *pszDot = strchr(szBuffer, '.');
 
         // Try to avoid .xxxx999999y or .xxxx000000y rounding issues by
@@ -1707,10 +1817,9 @@ static int OGR_json_double_with_significant_figures_to_string(
             bool bOK = false;
             for (int i = 1; i <= 3; i++)
             {
-                CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
-                            nInitialSignificantFigures - i);
-                nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting,
-                                    dfVal);
+                nSize = OGRFormatDoublePrecision(
+                    szBuffer, sizeof(szBuffer), dfVal,
+                    nInitialSignificantFigures - i, 'g');
                 pszDot = strchr(szBuffer, '.');
                 if (pszDot != nullptr && strstr(pszDot, "999999") == nullptr &&
                     strstr(pszDot, "000000") == nullptr)
@@ -1721,10 +1830,10 @@ static int OGR_json_double_with_significant_figures_to_string(
             }
             if (!bOK)
             {
-                CPLsnprintf(szFormatting, sizeof(szFormatting), "%%.%dg",
-                            nInitialSignificantFigures);
-                nSize = CPLsnprintf(szBuffer, sizeof(szBuffer), szFormatting,
-                                    dfVal);
+                nSize = OGRFormatDoublePrecision(szBuffer, sizeof(szBuffer),
+                                                 dfVal,
+                                                 nInitialSignificantFigures,
+                                                 'g');
             }
         }
 
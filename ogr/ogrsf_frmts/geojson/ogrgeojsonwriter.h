@@ -36,6 +36,12 @@
 #include "cpl_json_header.h"
 #include "cpl_string.h"
 
+#ifdef __cplusplus
+#include <memory>
+#include <string>
+#include <vector>
+#endif
+
 /************************************************************************/
 /*                         FORWARD DECLARATIONS                         */
 /************************************************************************/
@@ -98,6 +104,10 @@ OGREnvelope3D OGRGeoJSONGetBBox(const OGRGeometry *poGeometry,
                                 const OGRGeoJSONWriteOptions &oOptions);
 json_object *OGRGeoJSONWriteFeature(OGRFeature *poFeature,
                                     const OGRGeoJSONWriteOptions &oOptions);
+int OGRGeoJSONGetNumThreads(const char *pszConfigOption);
+std::vector<std::string> OGRGeoJSONSerializeFeatures(
+    const std::vector<std::unique_ptr<OGRFeature>> &apoFeatures,
+    const OGRGeoJSONWriteOptions &oOptions, int nJsonFlags, int nThreads);
 void OGRGeoJSONWriteId(const OGRFeature *poFeature, json_object *poObj,
                        bool bIdAlreadyWritten,
                        const OGRGeoJSONWriteOptions &oOptions);
@@ -429,7 +429,10 @@ void OGRJSONCollectionStreamingParser::Number(const char *pszValue, size_t nLen)
             m_osJson.append(pszValue, nLen);
         }
 
-        if (CPLGetValueType(pszValue) == CPL_VALUE_REAL)
+        // The syntax of numbers has already been checked by
+        // CPLJSonStreamingParser, so a decimal point or an exponent is
+        // enough to identify a real number.
+        if (strpbrk(pszValue, ".eE") != nullptr)
         {
             AppendObject(json_object_new_double(CPLAtof(pszValue)));
         }
@@ -52,6 +52,21 @@ typedef enum
 /*                            OGRGMLLayer                               */
 /************************************************************************/
 
+/************************************************************************/
+/*                       OGRGMLPrefetchedFeature                        */
+/************************************************************************/
+
+//! Feature read ahead by OGRGMLLayer, whose geometry may have been built
+//! by a worker thread.
+struct OGRGMLPrefetchedFeature
+{
+    GMLFeature *poGMLFeature = nullptr;
+    //! Global SRS name when the feature was read
+    const char *pszSRSName = nullptr;
+    std::unique_ptr<OGRGeometry> poGeom{};
+    bool bGeomBuilt = false;
+};
+
 class OGRGMLLayer final : public OGRLayer
 {
     OGRFeatureDefn *poFeatureDefn;
@@ -73,6 +88,13 @@ class OGRGMLLayer final : public OGRLayer
 
     bool bFaceHoleNegative;
 
+    int m_nGeomBuildThreads = 1;
+    std::vector<OGRGMLPrefetchedFeature> m_asPrefetchedFeatures{};
+    size_t m_iNextPrefetchedFeature = 0;
+
+    void PrefetchFeatures();
+    void ClearPrefetchedFeatures();
+
   public:
     OGRGMLLayer(const char *pszName, bool bWriter, OGRGMLDataSource *poDS);
 
@@ -34,6 +34,9 @@
 #include "cpl_string.h"
 #include "ogr_p.h"
 #include "ogr_api.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
 
 /************************************************************************/
 /*                           OGRGMLLayer()                              */
@@ -60,6 +63,12 @@ OGRGMLLayer::OGRGMLLayer(const char *pszName, bool bWriterIn,
     SetDescription(poFeatureDefn->GetName());
     poFeatureDefn->Reference();
     poFeatureDefn->SetGeomType(wkbNone);
+
+    const char *pszNumThreads = CPLGetConfigOption("GML_NUM_THREADS", "1");
+    m_nGeomBuildThreads = std::clamp(EQUAL(pszNumThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszNumThreads),
+                                     1, 128);
 }
 
 /************************************************************************/
@@ -69,6 +78,8 @@ OGRGMLLayer::OGRGMLLayer(const char *pszName, bool bWriterIn,
 OGRGMLLayer::~OGRGMLLayer()
 
 {
+    ClearPrefetchedFeatures();
+
     CPLFree(pszFIDPrefix);
 
     if (poFeatureDefn)
@@ -100,6 +111,7 @@ void OGRGMLLayer::ResetReading()
         poDS->SetStoredGMLFeature(nullptr);
     }
 
+    ClearPrefetchedFeatures();
     iNextGMLId = 0;
     poDS->GetReader()->ResetReading();
     CPLDebug("GML", "ResetReading()");
@@ -113,6 +125,156 @@ void OGRGMLLayer::ResetReading()
     }
 }
 
+/************************************************************************/
+/*                        OGRGMLGeomBuildJob                            */
+/************************************************************************/
+
+struct OGRGMLGeomBuildJob
+{
+    OGRGMLPrefetchedFeature *pasFeatures = nullptr;
+    size_t nFeatures = 0;
+    const GMLFeatureClass *poFClass = nullptr;
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    bool bInvertAxisOrderIfLatLong = false;
+    bool bConsiderEPSGAsURN = false;
+    GMLSwapCoordinatesEnum eSwapCoordinates = GML_SWAP_AUTO;
+    bool bGetSecondaryGeometryOption = false;
+    bool bFaceHoleNegative = false;
+
+    static void Func(void *pData);
+};
+
+// Builds the geometry of the features of the job, the same way
+// OGRGMLLayer::GetNextFeature() does. Failures are silent: the geometry is
+// then built again by GetNextFeature() so that the error is reported.
+void OGRGMLGeomBuildJob::Func(void *pData)
+{
+    auto psJob = static_cast<OGRGMLGeomBuildJob *>(pData);
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    void *hCacheSRS = GML_BuildOGRGeometryFromList_CreateCache();
+    for (size_t i = 0; i < psJob->nFeatures; ++i)
+    {
+        OGRGMLPrefetchedFeature &sFeature = psJob->pasFeatures[i];
+        const GMLFeature *poGMLFeature = sFeature.poGMLFeature;
+        if (poGMLFeature->GetClass() != psJob->poFClass)
+            continue;
+
+        const CPLXMLNode *const *papsGeometry = poGMLFeature->GetGeometryList();
+        const CPLXMLNode *apsGeometries[2] = {nullptr, nullptr};
+        const CPLXMLNode *psBoundedByGeometry =
+            poGMLFeature->GetBoundedByGeometry();
+        if (psBoundedByGeometry && !(papsGeometry && papsGeometry[0]))
+        {
+            apsGeometries[0] = psBoundedByGeometry;
+            papsGeometry = apsGeometries;
+        }
+        if (papsGeometry == nullptr || papsGeometry[0] == nullptr ||
+            strcmp(papsGeometry[0]->pszValue, "null") == 0)
+        {
+            continue;
+        }
+
+        OGRGeometry *poGeom = GML_BuildOGRGeometryFromList(
+            papsGeometry, true, psJob->bInvertAxisOrderIfLatLong,
+            sFeature.pszSRSName, psJob->bConsiderEPSGAsURN,
+            psJob->eSwapCoordinates, psJob->bGetSecondaryGeometryOption,
+            hCacheSRS, psJob->bFaceHoleNegative);
+        if (poGeom != nullptr)
+        {
+            sFeature.poGeom.reset(
+                OGRGeometryFactory::forceTo(poGeom, psJob->eGeomType));
+            sFeature.bGeomBuilt = true;
+        }
+    }
+    GML_BuildOGRGeometryFromList_DestroyCache(hCacheSRS);
+}
+
+/************************************************************************/
+/*                          PrefetchFeatures()                          */
+/************************************************************************/
+
+// Reads a batch of features from the reader, and builds the geometry of
+// those belonging to this layer with worker threads. Only used in the
+// STANDARD and SEQUENTIAL_LAYERS read modes, and with at most one geometry
+// field. In SEQUENTIAL_LAYERS mode, the batch ends with the first feature of
+// the next layer, which GetNextFeature() will store in the datasource.
+void OGRGMLLayer::PrefetchFeatures()
+{
+    ClearPrefetchedFeatures();
+
+    constexpr size_t FEATURES_PER_THREAD = 64;
+    const size_t nMaxFeatures =
+        static_cast<size_t>(m_nGeomBuildThreads) * FEATURES_PER_THREAD;
+    IGMLReader *poReader = poDS->GetReader();
+    const bool bSequentialLayers = poDS->GetReadMode() == SEQUENTIAL_LAYERS;
+    bool bOwnFeatureFound = iNextGMLId != 0;
+    while (m_asPrefetchedFeatures.size() < nMaxFeatures)
+    {
+        GMLFeature *poGMLFeature = poReader->NextFeature();
+        if (poGMLFeature == nullptr)
+            break;
+        OGRGMLPrefetchedFeature sFeature;
+        sFeature.poGMLFeature = poGMLFeature;
+        // The global SRS name may be set while features are read
+        sFeature.pszSRSName = poDS->GetGlobalSRSName();
+        m_asPrefetchedFeatures.push_back(std::move(sFeature));
+        if (poGMLFeature->GetClass() == poFClass)
+            bOwnFeatureFound = true;
+        else if (bSequentialLayers && bOwnFeatureFound)
+            break;
+    }
+
+    const size_t nCount = m_asPrefetchedFeatures.size();
+    const size_t nJobs =
+        std::min(static_cast<size_t>(m_nGeomBuildThreads),
+                 (nCount + FEATURES_PER_THREAD - 1) / FEATURES_PER_THREAD);
+    CPLWorkerThreadPool *poPool =
+        nJobs >= 2 ? GDALGetGlobalThreadPool(m_nGeomBuildThreads) : nullptr;
+
+    std::vector<OGRGMLGeomBuildJob> asJobs(poPool ? nJobs : 1);
+    for (size_t i = 0; i < asJobs.size(); ++i)
+    {
+        auto &sJob = asJobs[i];
+        const size_t iStart = i * nCount / asJobs.size();
+        const size_t iEnd = (i + 1) * nCount / asJobs.size();
+        sJob.pasFeatures = m_asPrefetchedFeatures.data() + iStart;
+        sJob.nFeatures = iEnd - iStart;
+        sJob.poFClass = poFClass;
+        sJob.eGeomType = GetGeomType();
+        sJob.bInvertAxisOrderIfLatLong = poDS->GetInvertAxisOrderIfLatLong();
+        sJob.bConsiderEPSGAsURN = poDS->GetConsiderEPSGAsURN();
+        sJob.eSwapCoordinates = poDS->GetSwapCoordinates();
+        sJob.bGetSecondaryGeometryOption = poDS->GetSecondaryGeometryOption();
+        sJob.bFaceHoleNegative = bFaceHoleNegative;
+    }
+
+    if (!poPool)
+    {
+        OGRGMLGeomBuildJob::Func(&asJobs[0]);
+        return;
+    }
+
+    auto poQueue = poPool->CreateJobQueue();
+    for (auto &sJob : asJobs)
+    {
+        if (!poQueue->SubmitJob(OGRGMLGeomBuildJob::Func, &sJob))
+            OGRGMLGeomBuildJob::Func(&sJob);
+    }
+    poQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                      ClearPrefetchedFeatures()                       */
+/************************************************************************/
+
+void OGRGMLLayer::ClearPrefetchedFeatures()
+{
+    for (auto &sFeature : m_asPrefetchedFeatures)
+        delete sFeature.poGMLFeature;
+    m_asPrefetchedFeatures.clear();
+    m_iNextPrefetchedFeature = 0;
+}
+
 /************************************************************************/
 /*                              Increment()                             */
 /************************************************************************/
@@ -145,17 +307,34 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
         poDS->SetLastReadLayer(this);
     }
 
+    const bool bPrefetch = m_nGeomBuildThreads >= 2 &&
+                           (poDS->GetReadMode() == STANDARD ||
+                            poDS->GetReadMode() == SEQUENTIAL_LAYERS) &&
+                           poFeatureDefn->GetGeomFieldCount() <= 1;
+
     /* ==================================================================== */
     /*      Loop till we find and translate a feature meeting all our       */
     /*      requirements.                                                   */
     /* ==================================================================== */
     while (true)
     {
+        OGRGMLPrefetchedFeature *psPrefetched = nullptr;
         GMLFeature *poGMLFeature = poDS->PeekStoredGMLFeature();
         if (poGMLFeature != nullptr)
         {
             poDS->SetStoredGMLFeature(nullptr);
         }
+        else if (bPrefetch)
+        {
+            if (m_iNextPrefetchedFeature == m_asPrefetchedFeatures.size())
+                PrefetchFeatures();
+            if (m_iNextPrefetchedFeature == m_asPrefetchedFeatures.size())
+                return nullptr;
+            psPrefetched = &m_asPrefetchedFeatures[m_iNextPrefetchedFeature++];
+            poGMLFeature = psPrefetched->poGMLFeature;
+            psPrefetched->poGMLFeature = nullptr;
+            m_nFeaturesRead++;
+        }
         else
         {
             poGMLFeature = poDS->GetReader()->NextFeature();
@@ -355,21 +534,35 @@ OGRFeature *OGRGMLLayer::GetNextFeature()
         }
         else if (papsGeometry[0] != nullptr)
         {
-            const char *pszSRSName = poDS->GetGlobalSRSName();
-            CPLPushErrorHandler(CPLQuietErrorHandler);
-            poGeom = GML_BuildOGRGeometryFromList(
-                papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(),
-                pszSRSName, poDS->GetConsiderEPSGAsURN(),
-                poDS->GetSwapCoordinates(), poDS->GetSecondaryGeometryOption(),
-                hCacheSRS, bFaceHoleNegative);
-            CPLPopErrorHandler();
-
-            // Do geometry type changes if needed to match layer geometry type.
-            if (poGeom != nullptr)
+            if (psPrefetched && psPrefetched->bGeomBuilt)
             {
-                poGeom = OGRGeometryFactory::forceTo(poGeom, GetGeomType());
+                // Already built and converted by a worker thread
+                poGeom = psPrefetched->poGeom.release();
             }
             else
+            {
+                const char *pszSRSName = psPrefetched
+                                             ? psPrefetched->pszSRSName
+                                             : poDS->GetGlobalSRSName();
+                CPLPushErrorHandler(CPLQuietErrorHandler);
+                poGeom = GML_BuildOGRGeometryFromList(
+                    papsGeometry, true, poDS->GetInvertAxisOrderIfLatLong(),
+                    pszSRSName, poDS->GetConsiderEPSGAsURN(),
+                    poDS->GetSwapCoordinates(),
+                    poDS->GetSecondaryGeometryOption(), hCacheSRS,
+                    bFaceHoleNegative);
+                CPLPopErrorHandler();
+
+                // Do geometry type changes if needed to match layer geometry
+                // type.
+                if (poGeom != nullptr)
+                {
+                    poGeom =
+                        OGRGeometryFactory::forceTo(poGeom, GetGeomType());
+                }
+            }
+
+            if (poGeom == nullptr)
             {
                 const CPLString osLastErrorMsg(CPLGetLastErrorMsg());
 
@@ -1068,8 +1261,8 @@ OGRErr OGRGMLLayer::ICreateFeature(OGRFeature *poFeature)
                 for (int i = 0; i < nCount; i++)
                 {
                     char szBuffer[80] = {};
-                    CPLsnprintf(szBuffer, sizeof(szBuffer), "%.15g",
-                                padfVals[i]);
+                    OGRFormatDoublePrecision(szBuffer, sizeof(szBuffer),
+                                             padfVals[i], 15, 'g');
                     GMLWriteField(poDS, fp, bWriteSpaceIndentation, pszPrefix,
                                   bRemoveAppPrefix, poFieldDefn, szBuffer);
                 }
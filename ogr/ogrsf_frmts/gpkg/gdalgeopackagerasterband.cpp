@@ -31,6 +31,8 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <limits>
@@ -877,6 +879,19 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
         return pabyData;
     }
 
+    if (!m_oMapPrefetchedTiles.empty() && pbIsLossyFormat == nullptr)
+    {
+        const auto oIter = m_oMapPrefetchedTiles.find({nRow, nCol});
+        if (oIter != m_oMapPrefetchedTiles.end())
+        {
+            if (oIter->second.empty())
+                FillEmptyTile(pabyData);
+            else
+                memcpy(pabyData, oIter->second.data(), oIter->second.size());
+            return pabyData;
+        }
+    }
+
 #ifdef DEBUG_VERBOSE
     CPLDebug("GPKG", "ReadTile(row=%d, col=%d)", nRow, nCol);
 #endif
@@ -998,6 +1013,279 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     return pabyData;
 }
 
+/************************************************************************/
+/*                           PrefetchTiles()                            */
+/************************************************************************/
+
+namespace
+{
+struct GPKGTileDecodeJob
+{
+    GDALGPKGMBTilesLikePseudoDataset *poTPD = nullptr;
+    int nRow = 0;
+    int nCol = 0;
+    std::vector<GByte> abyRawData{};
+    double dfTileOffset = 0.0;
+    double dfTileScale = 1.0;
+    size_t nDecodedSize = 0;
+    std::vector<GByte> abyDecodedData{};
+    bool bOK = false;
+
+    static void Func(void *pData)
+    {
+        auto psJob = static_cast<GPKGTileDecodeJob *>(pData);
+        if (psJob->abyRawData.empty())
+        {
+            psJob->bOK = true;
+            return;
+        }
+
+        // Tiles whose decoding emits any error or warning are decoded again
+        // by the calling thread, so that messages are reported there.
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors;
+        CPLInstallErrorHandlerAccumulator(aoErrors);
+        const CPLString osMemFileName(
+            CPLSPrintf("/vsimem/gpkg_prefetch_tile_%p_%d_%d", psJob->poTPD,
+                       psJob->nRow, psJob->nCol));
+        VSIFCloseL(VSIFileFromMemBuffer(
+            osMemFileName.c_str(), psJob->abyRawData.data(),
+            psJob->abyRawData.size(), /* bTakeOwnership = */ FALSE));
+        try
+        {
+            psJob->abyDecodedData.resize(psJob->nDecodedSize);
+            psJob->bOK = psJob->poTPD->ReadTile(
+                             osMemFileName, psJob->abyDecodedData.data(),
+                             psJob->dfTileOffset, psJob->dfTileScale) ==
+                         CE_None;
+        }
+        catch (const std::exception &)
+        {
+        }
+        VSIUnlink(osMemFileName.c_str());
+        CPLUninstallErrorHandlerAccumulator();
+        if (!aoErrors.empty())
+            psJob->bOK = false;
+        psJob->abyRawData.clear();
+    }
+};
+}  // namespace
+
+/** Fetch in a single SQL query the tiles intersecting a read request, and
+ * decode them in worker threads, when the GDAL_NUM_THREADS configuration
+ * option is set. Decoded tiles are then used by ReadTile() until
+ * ClearPrefetchedTiles() is called.
+ *
+ * @return true if tiles have been prefetched.
+ */
+bool GDALGPKGMBTilesLikePseudoDataset::PrefetchTiles(
+    int nXOff, int nYOff, int nXSize, int nYSize, int nBufXSize, int nBufYSize,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    if (m_bPrefetchedTilesActive || IGetUpdate() ||
+        m_pabyCachedTiles == nullptr || nXSize <= 0 || nYSize <= 0)
+    {
+        return false;
+    }
+
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszNumThreads == nullptr)
+        return false;
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : std::min(atoi(pszNumThreads), 1024);
+    if (nThreads <= 1)
+        return false;
+
+    // Nothing to do if the request is going to be served by an overview
+    GDALRasterBand *poBand = IGetRasterBand(1);
+    if ((nBufXSize < nXSize || nBufYSize < nYSize) &&
+        poBand->GetOverviewCount() > 0)
+    {
+        int nXOffOvr = nXOff;
+        int nYOffOvr = nYOff;
+        int nXSizeOvr = nXSize;
+        int nYSizeOvr = nYSize;
+        if (GDALBandGetBestOverviewLevel2(poBand, nXOffOvr, nYOffOvr,
+                                          nXSizeOvr, nYSizeOvr, nBufXSize,
+                                          nBufYSize, psExtraArg) >= 0)
+        {
+            return false;
+        }
+    }
+
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBands = IGetRasterCount();
+
+    const int nColMin = std::max(0, nXOff / nBlockXSize + m_nShiftXTiles);
+    const int nColMax =
+        std::min(m_nTileMatrixWidth - 1, (nXOff + nXSize - 1) / nBlockXSize +
+                                             m_nShiftXTiles +
+                                             (m_nShiftXPixelsMod ? 1 : 0));
+    const int nRowMin = std::max(0, nYOff / nBlockYSize + m_nShiftYTiles);
+    const int nRowMax =
+        std::min(m_nTileMatrixHeight - 1, (nYOff + nYSize - 1) / nBlockYSize +
+                                              m_nShiftYTiles +
+                                              (m_nShiftYPixelsMod ? 1 : 0));
+    if (nColMin > nColMax || nRowMin > nRowMax)
+        return false;
+
+    // Determine which tiles are needed, that is the ones whose corresponding
+    // blocks are not all in the block cache.
+    std::vector<GPKGTileDecodeJob> asJobs;
+    for (int nRow = nRowMin; nRow <= nRowMax; ++nRow)
+    {
+        for (int nCol = nColMin; nCol <= nColMax; ++nCol)
+        {
+            bool bNeeded = true;
+            if (m_nShiftXPixelsMod == 0 && m_nShiftYPixelsMod == 0)
+            {
+                bNeeded = false;
+                for (int iBand = 1; !bNeeded && iBand <= nBands; ++iBand)
+                {
+                    auto poGPKGBand =
+                        cpl::down_cast<GDALGPKGMBTilesLikeRasterBand *>(
+                            IGetRasterBand(iBand));
+                    GDALRasterBlock *poBlock =
+                        poGPKGBand->AccessibleTryGetLockedBlockRef(
+                            nCol - m_nShiftXTiles, nRow - m_nShiftYTiles);
+                    if (poBlock)
+                        poBlock->DropLock();
+                    else
+                        bNeeded = true;
+                }
+            }
+            if (bNeeded)
+            {
+                GPKGTileDecodeJob sJob;
+                sJob.poTPD = this;
+                sJob.nRow = nRow;
+                sJob.nCol = nCol;
+                asJobs.push_back(std::move(sJob));
+            }
+        }
+    }
+    if (asJobs.size() < 2)
+        return false;
+
+    // Decoded tiles only live during the RasterIO() request. Do not use
+    // more than half of the block cache size for them.
+    const int nTileBands = m_eDT == GDT_Byte ? 4 : 1;
+    const size_t nTileSize = static_cast<size_t>(nBlockXSize) * nBlockYSize *
+                             m_nDTSize * nTileBands;
+    const GIntBig nMaxTiles =
+        GDALGetCacheMax64() / 2 / static_cast<GIntBig>(nTileSize);
+    if (static_cast<GIntBig>(asJobs.size()) > nMaxTiles)
+    {
+        return false;
+    }
+
+    std::map<std::pair<int, int>, size_t> oMapTileToJobIdx;
+    for (size_t i = 0; i < asJobs.size(); ++i)
+        oMapTileToJobIdx[{asJobs[i].nRow, asJobs[i].nCol}] = i;
+
+    const int nTopRowA = GetRowFromIntoTopConvention(nRowMin);
+    const int nTopRowB = GetRowFromIntoTopConvention(nRowMax);
+    char *pszSQL = sqlite3_mprintf(
+        "SELECT tile_row, tile_column, tile_data%s FROM \"%w\" "
+        "WHERE zoom_level = %d AND tile_row >= %d AND tile_row <= %d AND "
+        "tile_column >= %d AND tile_column <= %d%s",
+        m_eDT != GDT_Byte ? ", id" : "",  // MBTiles do not have an id
+        m_osRasterTable.c_str(), m_nZoomLevel, std::min(nTopRowA, nTopRowB),
+        std::max(nTopRowA, nTopRowB), nColMin, nColMax,
+        !m_osWHERE.empty() ? CPLSPrintf(" AND (%s)", m_osWHERE.c_str()) : "");
+    sqlite3_stmt *hStmt = nullptr;
+    const int rc = sqlite3_prepare_v2(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    sqlite3_free(pszSQL);
+    if (rc != SQLITE_OK)
+        return false;
+
+    std::vector<std::pair<size_t, GIntBig>> anJobIdxAndTileId;
+    int nStepRet;
+    while ((nStepRet = sqlite3_step(hStmt)) == SQLITE_ROW)
+    {
+        const int nRow =
+            GetRowFromIntoTopConvention(sqlite3_column_int(hStmt, 0));
+        const int nCol = sqlite3_column_int(hStmt, 1);
+        const auto oIter = oMapTileToJobIdx.find({nRow, nCol});
+        if (oIter == oMapTileToJobIdx.end() ||
+            sqlite3_column_type(hStmt, 2) != SQLITE_BLOB)
+        {
+            continue;
+        }
+        auto &sJob = asJobs[oIter->second];
+        const GByte *pabyRawData =
+            static_cast<const GByte *>(sqlite3_column_blob(hStmt, 2));
+        const int nBytes = sqlite3_column_bytes(hStmt, 2);
+        if (nBytes <= 0)
+            continue;
+        try
+        {
+            sJob.abyRawData.assign(pabyRawData, pabyRawData + nBytes);
+        }
+        catch (const std::exception &)
+        {
+            nStepRet = SQLITE_NOMEM;
+            break;
+        }
+        if (m_eDT != GDT_Byte)
+        {
+            anJobIdxAndTileId.emplace_back(oIter->second,
+                                           sqlite3_column_int64(hStmt, 3));
+        }
+    }
+    sqlite3_finalize(hStmt);
+    if (nStepRet != SQLITE_DONE)
+        return false;
+
+    for (const auto &[nJobIdx, nTileId] : anJobIdxAndTileId)
+    {
+        GetTileOffsetAndScale(nTileId, asJobs[nJobIdx].dfTileOffset,
+                              asJobs[nJobIdx].dfTileScale);
+    }
+
+    // Make sure that lazily initialized state used by ReadTile() is set
+    // before running it in worker threads.
+    if (nBands == 1)
+        poBand->GetColorTable();
+    CPL_IGNORE_RET_VAL(poBand->GetNoDataValue());
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poPool)
+        return false;
+    auto poQueue = poPool->CreateJobQueue();
+    for (auto &sJob : asJobs)
+    {
+        sJob.nDecodedSize = nTileSize;
+        if (!poQueue->SubmitJob(GPKGTileDecodeJob::Func, &sJob))
+            GPKGTileDecodeJob::Func(&sJob);
+    }
+    poQueue->WaitCompletion();
+
+    for (auto &sJob : asJobs)
+    {
+        if (sJob.bOK)
+        {
+            m_oMapPrefetchedTiles[{sJob.nRow, sJob.nCol}] =
+                std::move(sJob.abyDecodedData);
+        }
+    }
+    m_bPrefetchedTilesActive = true;
+
+    return true;
+}
+
+/************************************************************************/
+/*                        ClearPrefetchedTiles()                        */
+/************************************************************************/
+
+void GDALGPKGMBTilesLikePseudoDataset::ClearPrefetchedTiles()
+{
+    m_oMapPrefetchedTiles.clear();
+    m_bPrefetchedTilesActive = false;
+}
+
 /************************************************************************/
 /*                         IReadBlock()                                 */
 /************************************************************************/
@@ -1229,6 +1517,28 @@ retry:
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALGPKGMBTilesLikeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    const bool bPrefetched =
+        eRWFlag == GF_Read &&
+        m_poTPD->PrefetchTiles(nXOff, nYOff, nXSize, nYSize, nBufXSize,
+                               nBufYSize, psExtraArg);
+    const CPLErr eErr = GDALPamRasterBand::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nPixelSpace, nLineSpace, psExtraArg);
+    if (bPrefetched)
+        m_poTPD->ClearPrefetchedTiles();
+    return eErr;
+}
+
 /************************************************************************/
 /*                       WEBPSupports4Bands()                           */
 /************************************************************************/
@@ -34,6 +34,10 @@
 #include "gdal_pam.h"
 #include <sqlite3.h>
 
+#include <map>
+#include <utility>
+#include <vector>
+
 typedef struct
 {
     int nRow;
@@ -112,6 +116,11 @@ class GDALGPKGMBTilesLikePseudoDataset
 
     GDALGPKGMBTilesLikePseudoDataset *m_poParentDS = nullptr;
 
+    // Tiles decoded by PrefetchTiles(), indexed by (row, column). An empty
+    // vector stands for a missing tile.
+    std::map<std::pair<int, int>, std::vector<GByte>> m_oMapPrefetchedTiles{};
+    bool m_bPrefetchedTilesActive = false;
+
   private:
     bool m_bInWriteTile = false;
     CPLErr WriteTileInternal(); /* should only be called by WriteTile() */
@@ -140,6 +149,11 @@ class GDALGPKGMBTilesLikePseudoDataset
 
     CPLErr WriteTile();
 
+    bool PrefetchTiles(int nXOff, int nYOff, int nXSize, int nYSize,
+                       int nBufXSize, int nBufYSize,
+                       GDALRasterIOExtraArg *psExtraArg);
+    void ClearPrefetchedTiles();
+
     CPLErr FlushTiles();
     CPLErr FlushRemainingShiftedTiles(bool bPartialFlush);
     CPLErr WriteShiftedTile(int nRow, int nCol, int iBand, int nDstXOffset,
@@ -180,6 +194,12 @@ class GDALGPKGMBTilesLikeRasterBand : public GDALPamRasterBand
                               void *pData) override;
     virtual CPLErr IWriteBlock(int nBlockXOff, int nBlockYOff,
                                void *pData) override;
+    virtual CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                             int nXSize, int nYSize, void *pData,
+                             int nBufXSize, int nBufYSize,
+                             GDALDataType eBufType, GSpacing nPixelSpace,
+                             GSpacing nLineSpace,
+                             GDALRasterIOExtraArg *psExtraArg) override;
     virtual CPLErr FlushCache(bool bAtClosing) override;
 
     virtual GDALColorTable *GetColorTable() override;
@@ -40,11 +40,13 @@
 
 #include <condition_variable>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <vector>
 #include <set>
 #include <thread>
+#include <utility>
 #include <cctype>
 
 #define UNKNOWN_SRID -2
@@ -605,7 +607,10 @@ class OGRGeoPackageLayer CPL_NON_FINAL : public OGRLayer,
 
     void BuildFeatureDefn(const char *pszLayerName, sqlite3_stmt *hStmt);
 
-    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt);
+    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt,
+                                 OGRFeature *poFeatureToReuse = nullptr);
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
+    bool FilterGeometryBlob(sqlite3_stmt *hStmt, bool &bFilterEvaluated);
     bool ParseDateField(const char *pszTxt, OGRField *psField,
                         const OGRFieldDefn *poFieldDefn, GIntBig nFID);
     bool ParseDateField(sqlite3_stmt *hStmt, int iRawField, int nSqlite3ColType,
@@ -723,6 +728,10 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     int m_nIsCompatOfOptimizedGetNextArrowArray = -1;
     bool m_bGetNextArrowArrayCalledSinceResetReading = false;
+    // FID after which rows have not been returned yet, and maximum FID, when
+    // m_nIsCompatOfOptimizedGetNextArrowArray == TRUE
+    GIntBig m_nArrowArrayFIDCursor = 0;
+    GIntBig m_nArrowArrayMaxFID = 0;
 
     int m_nCountInsertInTransactionThreshold = -1;
     GIntBig m_nCountInsertInTransaction = 0;
@@ -761,6 +770,18 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     OGRISO8601Format m_sDateTimeFormat = {OGRISO8601Precision::AUTO};
 
+    // Geometry blobs of the batch being inserted by WriteArrowBatch(),
+    // encoded by worker threads, and consumed in order by
+    // FeatureBindParameters()
+    std::vector<std::pair<std::unique_ptr<GByte, VSIFreeReleaser>, size_t>>
+        m_aoPreparedGeomBlobs{};
+    size_t m_iNextPreparedGeomBlob = 0;
+
+    bool PrepareGeomBlobsFromArrowBatch(const struct ArrowSchema *schema,
+                                        const struct ArrowArray *array,
+                                        CSLConstList papszOptions,
+                                        int nThreads);
+
     void StartAsyncRTree();
     void CancelAsyncRTree();
     void RemoveAsyncRTreeTempDB();
@@ -817,7 +838,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
         std::string m_osErrorMsg{};
         std::unique_ptr<GDALGeoPackageDataset> m_poDS{};
         OGRGeoPackageTableLayer *m_poLayer{};
-        GIntBig m_iStartShapeId = 0;
+        GIntBig m_iStartShapeId = 0;  // value of m_nArrowArrayFIDCursor
         std::unique_ptr<struct ArrowArray> m_psArrowArray = nullptr;
     };
 
@@ -844,6 +865,8 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
                                                    int /*argc*/,
                                                    sqlite3_value **argv);
 
+    OGRFeature *IGetNextFeatureReusing(OGRFeature *poFeatureToReuse) override;
+
   public:
     OGRGeoPackageTableLayer(GDALGeoPackageDataset *poDS,
                             const char *pszTableName);
@@ -880,6 +903,9 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     OGRErr ICreateFeature(OGRFeature *poFeature) override;
     OGRErr ISetFeature(OGRFeature *poFeature) override;
     OGRErr IUpsertFeature(OGRFeature *poFeature) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
     OGRErr IUpdateFeature(OGRFeature *poFeature, int nUpdatedFieldsCount,
                           const int *panUpdatedFieldsIdx,
                           int nUpdatedGeomFieldsCount,
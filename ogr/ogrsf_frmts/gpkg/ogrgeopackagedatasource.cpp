@@ -1137,10 +1137,15 @@ CPLErr GDALGeoPackageDataset::IRasterIO(
     GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
 
 {
+    const bool bPrefetched =
+        eRWFlag == GF_Read && PrefetchTiles(nXOff, nYOff, nXSize, nYSize,
+                                            nBufXSize, nBufYSize, psExtraArg);
     CPLErr eErr = OGRSQLiteBaseDataSource::IRasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
         psExtraArg);
+    if (bPrefetched)
+        ClearPrefetchedTiles();
 
     // If writing all bands, in non-shifted mode, flush all entirely written
     // tiles This can avoid "stressing" the block cache with too many dirty
@@ -93,6 +93,23 @@ void OGRGeoPackageLayer::ClearStatement()
 OGRFeature *OGRGeoPackageLayer::GetNextFeature()
 
 {
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+/** Takes ownership of poFeatureToReuse, which is either recycled into the
+ * returned feature, or destroyed. Features rejected by the filters are
+ * also recycled.
+ */
+OGRFeature *
+OGRGeoPackageLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
+{
+    std::unique_ptr<OGRFeature> poSpareFeature(poFeatureToReuse);
+
     if (m_bEOF)
         return nullptr;
 
@@ -134,15 +151,87 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             m_bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        // Evaluate the spatial filter on the geometry blob, to avoid
+        // building features that are going to be discarded.
+        bool bSpatialFilterEvaluated = false;
+        if (m_poFilterGeom != nullptr &&
+            !FilterGeometryBlob(m_poQueryStatement, bSpatialFilterEvaluated))
+        {
+            // Same as done by TranslateFeature()
+            m_iNextShapeId++;
+            m_nFeaturesRead++;
+            continue;
+        }
 
-        if ((m_poFilterGeom == nullptr ||
+        OGRFeature *poFeature =
+            TranslateFeature(m_poQueryStatement, poSpareFeature.release());
+
+        if ((m_poFilterGeom == nullptr || bSpatialFilterEvaluated ||
              FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
             (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
             return poFeature;
 
-        delete poFeature;
+        poSpareFeature.reset(poFeature);
+    }
+}
+
+/************************************************************************/
+/*                        FilterGeometryBlob()                          */
+/************************************************************************/
+
+/** Evaluates the spatial filter directly on the GeoPackage geometry blob of
+ * the current row, using the envelope of its header and its WKB content,
+ * without building a OGRGeometry when possible.
+ *
+ * @param hStmt Statement whose current row is evaluated.
+ * @param[out] bFilterEvaluated Set to true if the spatial filter could be
+ *                              evaluated. Otherwise FilterGeometry() must be
+ *                              called on the translated feature.
+ * @return false if the row does not pass the spatial filter.
+ */
+bool OGRGeoPackageLayer::FilterGeometryBlob(sqlite3_stmt *hStmt,
+                                            bool &bFilterEvaluated)
+{
+    bFilterEvaluated = false;
+    if (m_iGeomCol < 0 || m_iGeomFieldFilter != 0 ||
+        m_bUndoDiscardCoordLSBOnReading ||
+        m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored() ||
+        sqlite3_column_type(hStmt, m_iGeomCol) != SQLITE_BLOB)
+    {
+        return true;
+    }
+
+    const int nBlobSize = sqlite3_column_bytes(hStmt, m_iGeomCol);
+    // coverity[tainted_data_return]
+    const GByte *pabyBlob =
+        static_cast<const GByte *>(sqlite3_column_blob(hStmt, m_iGeomCol));
+    GPkgHeader oHeader;
+    if (nBlobSize < 8 || pabyBlob == nullptr || pabyBlob[0] != 'G' ||
+        pabyBlob[1] != 'P' ||
+        GPkgHeaderFromWKB(pabyBlob, nBlobSize, &oHeader) != OGRERR_NONE)
+    {
+        return true;
+    }
+
+    OGREnvelope sEnvelope;
+    bool bEnvelopeAlreadySet = false;
+    if (oHeader.bEmpty)
+    {
+        bEnvelopeAlreadySet = true;
+    }
+    else if (oHeader.bExtentHasXY)
+    {
+        bEnvelopeAlreadySet = true;
+        sEnvelope.MinX = oHeader.MinX;
+        sEnvelope.MinY = oHeader.MinY;
+        sEnvelope.MaxX = oHeader.MaxX;
+        sEnvelope.MaxY = oHeader.MaxY;
     }
+
+    bFilterEvaluated = true;
+    return FilterWKBGeometry(pabyBlob + oHeader.nHeaderLen,
+                             nBlobSize - oHeader.nHeaderLen,
+                             bEnvelopeAlreadySet, sEnvelope);
 }
 
 /************************************************************************/
@@ -343,13 +432,19 @@ bool OGRGeoPackageLayer::ParseDateTimeField(const char *pszTxt,
 /*                         TranslateFeature()                           */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
+OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt,
+                                                 OGRFeature *poFeatureToReuse)
 
 {
     /* -------------------------------------------------------------------- */
-    /*      Create a feature from the current result.                       */
+    /*      Create a feature from the current result, or recycle the        */
+    /*      provided one.                                                   */
     /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+        poFeature->Reset();
+    else
+        poFeature = new OGRFeature(m_poFeatureDefn);
 
     /* -------------------------------------------------------------------- */
     /*      Set FID if we have a column to set it from.                     */
@@ -385,29 +480,58 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
             // coverity[tainted_data_return]
             const GByte *pabyGpkg = static_cast<const GByte *>(
                 sqlite3_column_blob(hStmt, m_iGeomCol));
-            OGRGeometry *poGeom =
-                GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
-            if (poGeom == nullptr)
+
+            // Defer parsing of the WKB content until the geometry is
+            // actually requested.
+            bool bLazyGeometry = false;
+            GPkgHeader oHeader;
+            if (!m_bUndoDiscardCoordLSBOnReading && iGpkgSize >= 8 &&
+                pabyGpkg && pabyGpkg[0] == 'G' && pabyGpkg[1] == 'P' &&
+                GPkgHeaderFromWKB(pabyGpkg, iGpkgSize, &oHeader) ==
+                    OGRERR_NONE)
             {
-                // Try also spatialite geometry blobs
-                if (OGRSQLiteImportSpatiaLiteGeometry(pabyGpkg, iGpkgSize,
-                                                      &poGeom) != OGRERR_NONE)
+                OGREnvelope sEnvelope;
+                const bool bEnvelopeKnown =
+                    oHeader.bEmpty || oHeader.bExtentHasXY;
+                if (oHeader.bExtentHasXY)
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Unable to read geometry");
+                    sEnvelope.MinX = oHeader.MinX;
+                    sEnvelope.MinY = oHeader.MinY;
+                    sEnvelope.MaxX = oHeader.MaxX;
+                    sEnvelope.MaxY = oHeader.MaxY;
                 }
+                bLazyGeometry = poFeature->SetGeomFieldLazyWKB(
+                    0, pabyGpkg + oHeader.nHeaderLen,
+                    iGpkgSize - oHeader.nHeaderLen,
+                    bEnvelopeKnown ? &sEnvelope : nullptr);
             }
-            if (poGeom)
+
+            if (!bLazyGeometry)
             {
-                if (m_bUndoDiscardCoordLSBOnReading)
+                OGRGeometry *poGeom =
+                    GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
+                if (poGeom == nullptr)
                 {
-                    poGeom->roundCoordinates(
-                        poGeomFieldDefn->GetCoordinatePrecision());
+                    // Try also spatialite geometry blobs
+                    if (OGRSQLiteImportSpatiaLiteGeometry(
+                            pabyGpkg, iGpkgSize, &poGeom) != OGRERR_NONE)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Unable to read geometry");
+                    }
+                }
+                if (poGeom)
+                {
+                    if (m_bUndoDiscardCoordLSBOnReading)
+                    {
+                        poGeom->roundCoordinates(
+                            poGeomFieldDefn->GetCoordinatePrecision());
+                    }
+                    poGeom->assignSpatialReference(poSrs);
                 }
-                poGeom->assignSpatialReference(poSrs);
-            }
 
-            poFeature->SetGeometryDirectly(poGeom);
+                poFeature->SetGeometryDirectly(poGeom);
+            }
         }
     }
 
@@ -536,7 +660,8 @@ bool OGRGeoPackageLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
 int OGRGeoPackageLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                           struct ArrowArray *out_array)
 {
-    if (CPLTestBool(CPLGetConfigOption("OGR_GPKG_STREAM_BASE_IMPL", "NO")))
+    if (CPLTestBool(CPLGetConfigOption("OGR_GPKG_STREAM_BASE_IMPL", "NO")) ||
+        IsGeoArrowGeometryEncodingRequested())
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
@@ -640,9 +765,8 @@ int OGRGeoPackageLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                 // coverity[tainted_data_return]
                 const GByte *pabyGpkg = static_cast<const GByte *>(
                     sqlite3_column_blob(hStmt, m_iGeomCol));
-                if (m_poFilterGeom == nullptr && iGpkgSize >= 8 && pabyGpkg &&
-                    pabyGpkg[0] == 'G' && pabyGpkg[1] == 'P' &&
-                    !m_bUndoDiscardCoordLSBOnReading)
+                if (iGpkgSize >= 8 && pabyGpkg && pabyGpkg[0] == 'G' &&
+                    pabyGpkg[1] == 'P' && !m_bUndoDiscardCoordLSBOnReading)
                 {
                     GPkgHeader oHeader;
 
@@ -654,6 +778,32 @@ int OGRGeoPackageLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                         /* WKB pointer */
                         pabyWkb = pabyGpkg + oHeader.nHeaderLen;
                         nWKBSize = iGpkgSize - oHeader.nHeaderLen;
+
+                        // Deal with spatial filter, without building
+                        // geometries when possible
+                        if (m_poFilterGeom != nullptr)
+                        {
+                            OGREnvelope sEnvelope;
+                            bool bEnvelopeAlreadySet = false;
+                            if (oHeader.bEmpty)
+                            {
+                                bEnvelopeAlreadySet = true;
+                            }
+                            else if (oHeader.bExtentHasXY)
+                            {
+                                bEnvelopeAlreadySet = true;
+                                sEnvelope.MinX = oHeader.MinX;
+                                sEnvelope.MinY = oHeader.MinY;
+                                sEnvelope.MaxX = oHeader.MaxX;
+                                sEnvelope.MaxY = oHeader.MaxY;
+                            }
+                            if (!FilterWKBGeometry(pabyWkb, nWKBSize,
+                                                   bEnvelopeAlreadySet,
+                                                   sEnvelope))
+                            {
+                                continue;
+                            }
+                        }
                     }
                 }
                 else
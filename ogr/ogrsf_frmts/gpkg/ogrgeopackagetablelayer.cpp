@@ -30,9 +30,11 @@
 #include "ogr_geopackage.h"
 #include "ogrgeopackageutility.h"
 #include "ogrsqliteutility.h"
+#include "ogrlayerarrow.h"
 #include "cpl_md5.h"
 #include "cpl_time.h"
 #include "ogr_p.h"
+#include "gdal_thread_pool.h"
 #include "sqlite_rtree_bulk_load/wrapper.h"
 
 #include <algorithm>
@@ -243,13 +245,29 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
     if ((nUpdatedGeomFieldsCount < 0 || nUpdatedGeomFieldsCount == 1) &&
         poFeatureDefn->GetGeomFieldCount())
     {
+        // Geometry blob already encoded by WriteArrowBatch(), if any
+        std::unique_ptr<GByte, VSIFreeReleaser> pabyPreparedWkb;
+        size_t szPreparedWkb = 0;
+        if (nUpdatedGeomFieldsCount < 0 &&
+            m_iNextPreparedGeomBlob < m_aoPreparedGeomBlobs.size())
+        {
+            auto &oPreparedBlob =
+                m_aoPreparedGeomBlobs[m_iNextPreparedGeomBlob];
+            ++m_iNextPreparedGeomBlob;
+            pabyPreparedWkb = std::move(oPreparedBlob.first);
+            szPreparedWkb = oPreparedBlob.second;
+        }
+
         // Non-NULL geometry.
         OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
         if (poGeom)
         {
-            size_t szWkb = 0;
-            GByte *pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
-                                                 &m_sBinaryPrecision, &szWkb);
+            size_t szWkb = szPreparedWkb;
+            GByte *pabyWkb = pabyPreparedWkb
+                                 ? pabyPreparedWkb.release()
+                                 : GPkgGeometryFromOGR(poGeom, m_iSrs,
+                                                       &m_sBinaryPrecision,
+                                                       &szWkb);
             if (!pabyWkb)
                 return OGRERR_FAILURE;
             int err = sqlite3_bind_blob(poStmt, nColCount++, pabyWkb,
@@ -2630,6 +2648,264 @@ OGRErr OGRGeoPackageTableLayer::ICreateFeature(OGRFeature *poFeature)
     return CreateOrUpsertFeature(poFeature, /* bUpsert=*/false);
 }
 
+/************************************************************************/
+/*                         GPKGGetNumThreads()                          */
+/************************************************************************/
+
+static int GPKGGetNumThreads()
+{
+    const char *pszMaxThreads =
+        CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
+    if (pszMaxThreads == nullptr)
+        return std::min(4, CPLGetNumCPUs());
+    else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
+        return CPLGetNumCPUs();
+    else
+        return atoi(pszMaxThreads);
+}
+
+/************************************************************************/
+/*                     GPKGGeomBlobEncodingJob                          */
+/************************************************************************/
+
+namespace
+{
+struct GPKGGeomBlobEncodingJob
+{
+    const struct ArrowArray *psArray = nullptr;
+    bool bLargeBinary = false;
+    int nSRSId = 0;
+    const OGRGeomCoordinateBinaryPrecision *psPrecision = nullptr;
+    size_t iStart = 0;
+    size_t iEnd = 0;
+    std::vector<std::pair<std::unique_ptr<GByte, VSIFreeReleaser>, size_t>>
+        *paoBlobs = nullptr;
+
+    template <class OffsetType> void Run()
+    {
+        const uint8_t *pabyValidity =
+            psArray->null_count != 0
+                ? static_cast<const uint8_t *>(psArray->buffers[0])
+                : nullptr;
+        const auto *panOffsets =
+            static_cast<const OffsetType *>(psArray->buffers[1]) +
+            psArray->offset;
+        const GByte *pabyData = static_cast<const GByte *>(psArray->buffers[2]);
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const size_t iBit = i + static_cast<size_t>(psArray->offset);
+            if (pabyValidity &&
+                (pabyValidity[iBit / 8] & (1 << (iBit % 8))) == 0)
+            {
+                continue;
+            }
+            OGRGeometry *poGeom = nullptr;
+            size_t nBytesConsumed = 0;
+            OGRGeometryFactory::createFromWkb(
+                pabyData + static_cast<size_t>(panOffsets[i]), nullptr, &poGeom,
+                static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]),
+                wkbVariantIso, nBytesConsumed);
+            if (!poGeom)
+                continue;
+            size_t nBlobSize = 0;
+            GByte *pabyBlob =
+                GPkgGeometryFromOGR(poGeom, nSRSId, psPrecision, &nBlobSize);
+            delete poGeom;
+            (*paoBlobs)[i].first.reset(pabyBlob);
+            (*paoBlobs)[i].second = nBlobSize;
+        }
+    }
+
+    static void Func(void *pData)
+    {
+        auto psJob = static_cast<GPKGGeomBlobEncodingJob *>(pData);
+        // Errors are emitted by the calling thread, which parses the WKB
+        // again, and encodes geometries for which no blob could be prepared.
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        if (psJob->bLargeBinary)
+            psJob->Run<int64_t>();
+        else
+            psJob->Run<int32_t>();
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                   PrepareGeomBlobsFromArrowBatch()                   */
+/************************************************************************/
+
+// Encode in worker threads the GeoPackage geometry blobs corresponding to
+// the WKB geometry column of an Arrow batch, so that the CreateFeature()
+// calls issued by OGRLayer::WriteArrowBatch() just have to bind them.
+// Returns false if no WKB geometry column can be identified unambiguously.
+bool OGRGeoPackageTableLayer::PrepareGeomBlobsFromArrowBatch(
+    const struct ArrowSchema *schema, const struct ArrowArray *array,
+    CSLConstList papszOptions, int nThreads)
+{
+    if (m_poFeatureDefn->GetGeomFieldCount() == 0 ||
+        schema->n_children != array->n_children)
+    {
+        return false;
+    }
+
+    const char *pszFIDName =
+        CSLFetchNameValueDef(papszOptions, "FID", GetFIDColumn());
+    const char *pszGeomFieldName = CSLFetchNameValueDef(
+        papszOptions, "GEOMETRY_NAME", GetGeometryColumn());
+    if (!pszGeomFieldName || pszGeomFieldName[0] == 0)
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+
+    // Mimic the identification of the geometry column done by
+    // OGRLayer::WriteArrowBatch()
+    const struct ArrowArray *psGeomArray = nullptr;
+    bool bLargeBinary = false;
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        const auto psChildSchema = schema->children[i];
+        const char *pszName = psChildSchema->name;
+        const char *pszFormat = psChildSchema->format;
+        if (psChildSchema->dictionary || !pszName ||
+            (strcmp(pszFormat, "z") != 0 && strcmp(pszFormat, "Z") != 0) ||
+            (pszFIDName && strcmp(pszName, pszFIDName) == 0) ||
+            m_poFeatureDefn->GetFieldIndex(pszName) >= 0)
+        {
+            continue;
+        }
+
+        bool bIsGeomCol = m_poFeatureDefn->GetGeomFieldIndex(pszName) == 0 ||
+                          strcmp(pszName, pszGeomFieldName) == 0;
+        if (!bIsGeomCol && psChildSchema->metadata)
+        {
+            const auto oMetadata =
+                OGRParseArrowMetadata(psChildSchema->metadata);
+            const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+            bIsGeomCol = oIter != oMetadata.end() &&
+                         (oIter->second == EXTENSION_NAME_OGC_WKB ||
+                          oIter->second == EXTENSION_NAME_GEOARROW_WKB);
+        }
+        if (bIsGeomCol)
+        {
+            if (psGeomArray)
+                return false;
+            psGeomArray = array->children[i];
+            bLargeBinary = pszFormat[0] == 'Z';
+        }
+    }
+    if (!psGeomArray || psGeomArray->n_buffers != 3 ||
+        psGeomArray->length < array->length)
+    {
+        return false;
+    }
+
+    const size_t nCount = static_cast<size_t>(array->length);
+    try
+    {
+        m_aoPreparedGeomBlobs.resize(nCount);
+    }
+    catch (const std::exception &)
+    {
+        m_aoPreparedGeomBlobs.clear();
+        return false;
+    }
+    m_iNextPreparedGeomBlob = 0;
+
+    constexpr size_t MIN_FEATURES_PER_JOB = 64;
+    const size_t nJobs = std::min(
+        static_cast<size_t>(nThreads),
+        (nCount + MIN_FEATURES_PER_JOB - 1) / MIN_FEATURES_PER_JOB);
+    CPLWorkerThreadPool *poPool =
+        nJobs >= 2 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+
+    std::vector<GPKGGeomBlobEncodingJob> asJobs(poPool ? nJobs : 1);
+    for (size_t i = 0; i < asJobs.size(); ++i)
+    {
+        auto &sJob = asJobs[i];
+        sJob.psArray = psGeomArray;
+        sJob.bLargeBinary = bLargeBinary;
+        sJob.nSRSId = m_iSrs;
+        sJob.psPrecision = &m_sBinaryPrecision;
+        sJob.iStart = i * nCount / asJobs.size();
+        sJob.iEnd = (i + 1) * nCount / asJobs.size();
+        sJob.paoBlobs = &m_aoPreparedGeomBlobs;
+    }
+
+    if (!poPool)
+    {
+        GPKGGeomBlobEncodingJob::Func(&asJobs[0]);
+        return true;
+    }
+
+    auto poQueue = poPool->CreateJobQueue();
+    for (auto &sJob : asJobs)
+    {
+        if (!poQueue->SubmitJob(GPKGGeomBlobEncodingJob::Func, &sJob))
+            GPKGGeomBlobEncodingJob::Func(&sJob);
+    }
+    poQueue->WaitCompletion();
+
+    return true;
+}
+
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+// Features of the batch are inserted by the generic implementation, but
+// their geometry blobs are encoded beforehand by worker threads, and the
+// SQLite page cache is enlarged for the duration of the load.
+bool OGRGeoPackageTableLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                              struct ArrowArray *array,
+                                              CSLConstList papszOptions)
+{
+    if (!m_poDS->GetUpdate())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, UNSUPPORTED_OP_READ_ONLY,
+                 "WriteArrowBatch");
+        return false;
+    }
+
+    sqlite3 *hDB = m_poDS->GetDB();
+    int nOldCacheSize = 0;
+    bool bRestoreCacheSize = false;
+    if (CPLGetConfigOption("OGR_SQLITE_CACHE", nullptr) == nullptr)
+    {
+        // Negative values are in KiB. SQLite default is -2000
+        constexpr int BULK_LOAD_CACHE_SIZE = -64 * 1024;
+        OGRErr eErr = OGRERR_NONE;
+        nOldCacheSize = SQLGetInteger(hDB, "PRAGMA cache_size", &eErr);
+        if (eErr == OGRERR_NONE && nOldCacheSize < 0 &&
+            nOldCacheSize > BULK_LOAD_CACHE_SIZE)
+        {
+            bRestoreCacheSize =
+                SQLCommand(hDB, CPLSPrintf("PRAGMA cache_size = %d",
+                                           BULK_LOAD_CACHE_SIZE)) ==
+                OGRERR_NONE;
+        }
+    }
+
+    // OGR_APPLY_GEOM_SET_PRECISION may modify geometries in CreateFeature(),
+    // after their blobs would have been prepared.
+    const int nThreads = GPKGGetNumThreads();
+    if (nThreads >= 2 && array->length >= 2 &&
+        !CPLTestBool(
+            CPLGetConfigOption("OGR_APPLY_GEOM_SET_PRECISION", "FALSE")))
+    {
+        PrepareGeomBlobsFromArrowBatch(schema, array, papszOptions, nThreads);
+    }
+
+    const bool bRet = OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+
+    m_aoPreparedGeomBlobs.clear();
+    m_iNextPreparedGeomBlob = 0;
+
+    if (bRestoreCacheSize)
+    {
+        SQLCommand(hDB, CPLSPrintf("PRAGMA cache_size = %d", nOldCacheSize));
+    }
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                  SetDeferredSpatialIndexCreation()                   */
 /************************************************************************/
@@ -2740,7 +3016,7 @@ void OGRGeoPackageTableLayer::StartAsyncRTree()
 
             if (eErr == OGRERR_NONE)
             {
-                m_hRTree = gdal_sqlite_rtree_bl_new(nPageSize);
+                m_hRTree = gdal_sqlite_rtree_bl_new_packed(nPageSize);
                 try
                 {
                     m_oThreadRTree =
@@ -3574,6 +3850,18 @@ OGRErr OGRGeoPackageTableLayer::ResetStatementInternal(GIntBig nStartIndex)
 
 OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
 {
+    return IGetNextFeatureReusing(nullptr);
+}
+
+/************************************************************************/
+/*                       IGetNextFeatureReusing()                       */
+/************************************************************************/
+
+OGRFeature *
+OGRGeoPackageTableLayer::IGetNextFeatureReusing(OGRFeature *poFeatureToReuse)
+{
+    std::unique_ptr<OGRFeature> poFeatureToReuseHolder(poFeatureToReuse);
+
     if (!m_bFeatureDefnCompleted)
         GetLayerDefn();
     if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
@@ -3589,7 +3877,8 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
             return nullptr;
     }
 
-    OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeature();
+    OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeatureInternal(
+        poFeatureToReuseHolder.release());
     if (poFeature && m_iFIDAsRegularColumnIndex >= 0)
     {
         poFeature->SetField(m_iFIDAsRegularColumnIndex, poFeature->GetFID());
@@ -8553,7 +8842,8 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         }
     }
 
-    if (CPLTestBool(CPLGetConfigOption("OGR_GPKG_STREAM_BASE_IMPL", "NO")))
+    if (CPLTestBool(CPLGetConfigOption("OGR_GPKG_STREAM_BASE_IMPL", "NO")) ||
+        IsGeoArrowGeometryEncodingRequested())
     {
         return OGRGeoPackageLayer::GetNextArrowArray(stream, out_array);
     }
@@ -8566,268 +8856,290 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return GetNextArrowArrayAsynchronous(stream, out_array);
     }
 
-    // We can use this optimized version only if there is no hole in FID
-    // numbering. That is min(fid) == 1 and max(fid) == m_nTotalFeatureCount
-    if (m_nIsCompatOfOptimizedGetNextArrowArray < 0)
+    // We can use this optimized version only if FIDs are dense enough, since
+    // rows are fetched by ranges of FIDs of the size of a batch.
+    if (m_nIsCompatOfOptimizedGetNextArrowArray < 0 ||
+        !m_bGetNextArrowArrayCalledSinceResetReading)
     {
         m_nIsCompatOfOptimizedGetNextArrowArray = FALSE;
         const auto nTotalFeatureCount = GetTotalFeatureCount();
-        if (nTotalFeatureCount < 0)
+        if (nTotalFeatureCount <= 0)
             return GetNextArrowArrayAsynchronous(stream, out_array);
+        GIntBig nMaxFID;
         {
             char *pszSQL = sqlite3_mprintf("SELECT MAX(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
             OGRErr err;
-            const auto nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            nMaxFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMaxFID != nTotalFeatureCount)
-                return GetNextArrowArrayAsynchronous(stream, out_array);
         }
+        GIntBig nMinFID;
         {
             char *pszSQL = sqlite3_mprintf("SELECT MIN(\"%w\") FROM \"%w\"",
                                            m_pszFidColumn, m_pszTableName);
             OGRErr err;
-            const auto nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
+            nMinFID = SQLGetInteger64(m_poDS->GetDB(), pszSQL, &err);
             sqlite3_free(pszSQL);
-            if (nMinFID != 1)
-                return GetNextArrowArrayAsynchronous(stream, out_array);
+        }
+        // Require at least one row every two FIDs on average
+        if (nMinFID < 1 || nMaxFID < nMinFID ||
+            nMaxFID - nMinFID >= 2 * nTotalFeatureCount)
+        {
+            return GetNextArrowArrayAsynchronous(stream, out_array);
         }
         m_nIsCompatOfOptimizedGetNextArrowArray = TRUE;
+        m_nArrowArrayFIDCursor = nMinFID - 1;
+        m_nArrowArrayMaxFID = nMaxFID;
     }
 
     m_bGetNextArrowArrayCalledSinceResetReading = true;
 
-    // CPLDebug("GPKG", "m_iNextShapeId = " CPL_FRMT_GIB, m_iNextShapeId);
+    // CPLDebug("GPKG", "m_nArrowArrayFIDCursor = " CPL_FRMT_GIB,
+    //          m_nArrowArrayFIDCursor);
 
     const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
         m_aosArrowArrayStreamOptions);
 
-    // Fetch the answer from a potentially queued asynchronous task
-    if (!m_oQueueArrowArrayPrefetchTasks.empty())
+    // Loop as long as ranges of FIDs without any row are met
+    while (true)
     {
-        const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
-        auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
-        m_oQueueArrowArrayPrefetchTasks.pop();
-
-        // Wait for thread to be ready
+        // Fetch the answer from a potentially queued asynchronous task
+        if (!m_oQueueArrowArrayPrefetchTasks.empty())
         {
-            std::unique_lock<std::mutex> oLock(task->m_oMutex);
-            while (!task->m_bArrayReady)
-            {
-                task->m_oCV.wait(oLock);
-            }
-            task->m_bArrayReady = false;
-        }
-        if (!task->m_osErrorMsg.empty())
-            CPLError(CE_Failure, CPLE_AppDefined, "%s",
-                     task->m_osErrorMsg.c_str());
+            const size_t nTasks = m_oQueueArrowArrayPrefetchTasks.size();
+            auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
+            m_oQueueArrowArrayPrefetchTasks.pop();
 
-        const auto stopThread = [&task]()
-        {
+            // Wait for thread to be ready
             {
-                std::lock_guard oLock(task->m_oMutex);
-                task->m_bStop = true;
-                task->m_oCV.notify_one();
+                std::unique_lock<std::mutex> oLock(task->m_oMutex);
+                while (!task->m_bArrayReady)
+                {
+                    task->m_oCV.wait(oLock);
+                }
+                task->m_bArrayReady = false;
             }
-            if (task->m_oThread.joinable())
-                task->m_oThread.join();
-        };
+            if (!task->m_osErrorMsg.empty())
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         task->m_osErrorMsg.c_str());
 
-        if (task->m_iStartShapeId != m_iNextShapeId)
-        {
-            // Should not normally happen, unless the user messes with
-            // GetNextFeature()
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Worker thread task has not expected m_iStartShapeId "
-                     "value. Got " CPL_FRMT_GIB ", expected " CPL_FRMT_GIB,
-                     task->m_iStartShapeId, m_iNextShapeId);
-            if (task->m_psArrowArray->release)
-                task->m_psArrowArray->release(task->m_psArrowArray.get());
-
-            stopThread();
-        }
-        else if (task->m_psArrowArray->release)
-        {
-            m_iNextShapeId += task->m_psArrowArray->length;
+            const auto stopThread = [&task]()
+            {
+                {
+                    std::lock_guard oLock(task->m_oMutex);
+                    task->m_bStop = true;
+                    task->m_oCV.notify_one();
+                }
+                if (task->m_oThread.joinable())
+                    task->m_oThread.join();
+            };
 
-            // Transfer the task ArrowArray to the client array
-            memcpy(out_array, task->m_psArrowArray.get(),
-                   sizeof(struct ArrowArray));
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+            const bool bEmptyRange = task->m_psArrowArray->release == nullptr &&
+                                     task->m_osErrorMsg.empty() &&
+                                     !task->m_bMemoryLimitReached;
 
-            if (task->m_bMemoryLimitReached)
+            if (task->m_iStartShapeId != m_nArrowArrayFIDCursor)
             {
-                m_nIsCompatOfOptimizedGetNextArrowArray = false;
+                // Should not normally happen, unless the user messes with
+                // GetNextFeature()
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Worker thread task has not expected m_iStartShapeId "
+                         "value. Got " CPL_FRMT_GIB ", expected " CPL_FRMT_GIB,
+                         task->m_iStartShapeId, m_nArrowArrayFIDCursor);
+                if (task->m_psArrowArray->release)
+                    task->m_psArrowArray->release(task->m_psArrowArray.get());
+
                 stopThread();
-                CancelAsyncNextArrowArray();
-                return 0;
             }
-            // Are the records still available for reading beyond the current
-            // queued tasks ? If so, recycle this task to read them
-            else if (task->m_iStartShapeId +
-                         static_cast<GIntBig>(nTasks) * nMaxBatchSize <=
-                     m_nTotalFeatureCount)
+            else if (task->m_psArrowArray->release || bEmptyRange)
             {
-                task->m_iStartShapeId +=
-                    static_cast<GIntBig>(nTasks) * nMaxBatchSize;
-                task->m_poLayer->m_iNextShapeId = task->m_iStartShapeId;
-                try
+                m_iNextShapeId += task->m_psArrowArray->length;
+                m_nArrowArrayFIDCursor += nMaxBatchSize;
+
+                // Transfer the task ArrowArray to the client array
+                memcpy(out_array, task->m_psArrowArray.get(),
+                       sizeof(struct ArrowArray));
+                memset(task->m_psArrowArray.get(), 0,
+                       sizeof(struct ArrowArray));
+
+                if (task->m_bMemoryLimitReached)
                 {
-                    // Wake-up thread with new task
+                    m_nIsCompatOfOptimizedGetNextArrowArray = false;
+                    stopThread();
+                    CancelAsyncNextArrowArray();
+                    return 0;
+                }
+                // Are the records still available for reading beyond the
+                // current queued tasks ? If so, recycle this task to read them
+                else if (task->m_iStartShapeId +
+                             static_cast<GIntBig>(nTasks) * nMaxBatchSize <
+                         m_nArrowArrayMaxFID)
+                {
+                    task->m_iStartShapeId +=
+                        static_cast<GIntBig>(nTasks) * nMaxBatchSize;
+                    task->m_poLayer->m_nArrowArrayFIDCursor =
+                        task->m_iStartShapeId;
+                    try
+                    {
+                        // Wake-up thread with new task
+                        {
+                            std::lock_guard oLock(task->m_oMutex);
+                            task->m_bFetchRows = true;
+                            task->m_oCV.notify_one();
+                        }
+                        m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
+                        if (bEmptyRange)
+                            continue;
+                        return 0;
+                    }
+                    catch (const std::exception &e)
                     {
-                        std::lock_guard oLock(task->m_oMutex);
-                        task->m_bFetchRows = true;
-                        task->m_oCV.notify_one();
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Cannot start worker thread: %s", e.what());
                     }
-                    m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
-                    return 0;
                 }
-                catch (const std::exception &e)
+                else
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot start worker thread: %s", e.what());
+                    stopThread();
+                    if (bEmptyRange)
+                        continue;
+                    return 0;
                 }
             }
-            else
-            {
-                stopThread();
-                return 0;
-            }
-        }
-
-        stopThread();
-    }
 
-    const auto GetThreadsAvailable = []()
-    {
-        const char *pszMaxThreads =
-            CPLGetConfigOption("OGR_GPKG_NUM_THREADS", nullptr);
-        if (pszMaxThreads == nullptr)
-            return std::min(4, CPLGetNumCPUs());
-        else if (EQUAL(pszMaxThreads, "ALL_CPUS"))
-            return CPLGetNumCPUs();
-        else
-            return atoi(pszMaxThreads);
-    };
-
-    // Start asynchronous tasks to prefetch the next ArrowArray
-    if (m_poDS->GetAccess() == GA_ReadOnly &&
-        m_oQueueArrowArrayPrefetchTasks.empty() &&
-        m_iNextShapeId + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
-            m_nTotalFeatureCount &&
-        sqlite3_threadsafe() != 0 && GetThreadsAvailable() >= 2 &&
-        CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
-    {
-        const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
-            DIV_ROUND_UP(m_nTotalFeatureCount - nMaxBatchSize - m_iNextShapeId,
-                         nMaxBatchSize),
-            GetThreadsAvailable()));
-        CPLDebug("GPKG", "Using %d threads", nMaxTasks);
-        GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
-        oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
-        oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
-        for (int iTask = 0; iTask < nMaxTasks; ++iTask)
-        {
-            auto task = std::make_unique<ArrowArrayPrefetchTask>();
-            task->m_iStartShapeId =
-                m_iNextShapeId +
-                static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
-            task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
-            if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
-            {
-                break;
-            }
-            auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
-                task->m_poDS->GetLayerByName(GetName()));
-            if (poOtherLayer == nullptr ||
-                poOtherLayer->GetLayerDefn()->GetFieldCount() !=
-                    m_poFeatureDefn->GetFieldCount())
-            {
-                break;
-            }
+            stopThread();
+        }
 
-            // Install query logging callback
-            if (m_poDS->pfnQueryLoggerFunc)
+        // Start asynchronous tasks to prefetch the next ArrowArray
+        if (m_poDS->GetAccess() == GA_ReadOnly &&
+            m_oQueueArrowArrayPrefetchTasks.empty() &&
+            m_nArrowArrayFIDCursor + 2 * static_cast<GIntBig>(nMaxBatchSize) <=
+                m_nArrowArrayMaxFID &&
+            sqlite3_threadsafe() != 0 && GPKGGetNumThreads() >= 2 &&
+            CPLGetUsablePhysicalRAM() > 1024 * 1024 * 1024)
+        {
+            const int nMaxTasks = static_cast<int>(std::min<GIntBig>(
+                DIV_ROUND_UP(m_nArrowArrayMaxFID - nMaxBatchSize -
+                                 m_nArrowArrayFIDCursor,
+                             nMaxBatchSize),
+                GPKGGetNumThreads()));
+            CPLDebug("GPKG", "Using %d threads", nMaxTasks);
+            GDALOpenInfo oOpenInfo(m_poDS->GetDescription(), GA_ReadOnly);
+            oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
+            oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
+            for (int iTask = 0; iTask < nMaxTasks; ++iTask)
             {
-                task->m_poDS->SetQueryLoggerFunc(m_poDS->pfnQueryLoggerFunc,
-                                                 m_poDS->poQueryLoggerArg);
-            }
+                auto task = std::make_unique<ArrowArrayPrefetchTask>();
+                task->m_iStartShapeId =
+                    m_nArrowArrayFIDCursor +
+                    static_cast<GIntBig>(iTask + 1) * nMaxBatchSize;
+                task->m_poDS = std::make_unique<GDALGeoPackageDataset>();
+                if (!task->m_poDS->Open(&oOpenInfo, m_poDS->m_osFilenameInZip))
+                {
+                    break;
+                }
+                auto poOtherLayer = dynamic_cast<OGRGeoPackageTableLayer *>(
+                    task->m_poDS->GetLayerByName(GetName()));
+                if (poOtherLayer == nullptr ||
+                    poOtherLayer->GetLayerDefn()->GetFieldCount() !=
+                        m_poFeatureDefn->GetFieldCount())
+                {
+                    break;
+                }
 
-            task->m_poLayer = poOtherLayer;
-            task->m_psArrowArray = std::make_unique<struct ArrowArray>();
-            memset(task->m_psArrowArray.get(), 0, sizeof(struct ArrowArray));
+                // Install query logging callback
+                if (m_poDS->pfnQueryLoggerFunc)
+                {
+                    task->m_poDS->SetQueryLoggerFunc(
+                        m_poDS->pfnQueryLoggerFunc, m_poDS->poQueryLoggerArg);
+                }
 
-            poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
-            poOtherLayer->m_aosArrowArrayStreamOptions =
-                m_aosArrowArrayStreamOptions;
-            auto poOtherFDefn = poOtherLayer->GetLayerDefn();
-            for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
-            {
-                poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
-            }
-            for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
-            {
-                poOtherFDefn->GetFieldDefn(i)->SetIgnored(
-                    m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
-            }
+                task->m_poLayer = poOtherLayer;
+                task->m_psArrowArray = std::make_unique<struct ArrowArray>();
+                memset(task->m_psArrowArray.get(), 0,
+                       sizeof(struct ArrowArray));
+
+                poOtherLayer->m_nTotalFeatureCount = m_nTotalFeatureCount;
+                poOtherLayer->m_nArrowArrayMaxFID = m_nArrowArrayMaxFID;
+                poOtherLayer->m_aosArrowArrayStreamOptions =
+                    m_aosArrowArrayStreamOptions;
+                auto poOtherFDefn = poOtherLayer->GetLayerDefn();
+                for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
+                }
+                for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+                {
+                    poOtherFDefn->GetFieldDefn(i)->SetIgnored(
+                        m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
+                }
 
-            poOtherLayer->m_iNextShapeId = task->m_iStartShapeId;
+                poOtherLayer->m_nArrowArrayFIDCursor = task->m_iStartShapeId;
 
-            auto taskPtr = task.get();
-            auto taskRunner = [taskPtr]()
-            {
-                std::unique_lock oLock(taskPtr->m_oMutex);
-                do
+                auto taskPtr = task.get();
+                auto taskRunner = [taskPtr]()
                 {
-                    taskPtr->m_bFetchRows = false;
-                    taskPtr->m_poLayer->GetNextArrowArrayInternal(
-                        taskPtr->m_psArrowArray.get(), taskPtr->m_osErrorMsg,
-                        taskPtr->m_bMemoryLimitReached);
-                    taskPtr->m_bArrayReady = true;
-                    taskPtr->m_oCV.notify_one();
-                    if (taskPtr->m_bMemoryLimitReached)
-                        break;
-                    // cppcheck-suppress knownConditionTrueFalse
-                    // Coverity apparently is confused by the fact that we
-                    // use unique_lock here to guard access for m_bStop whereas
-                    // in other places we use a lock_guard, but there's nothing
-                    // wrong.
-                    // coverity[missing_lock:FALSE]
-                    while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                    std::unique_lock oLock(taskPtr->m_oMutex);
+                    do
                     {
-                        taskPtr->m_oCV.wait(oLock);
-                    }
-                } while (!taskPtr->m_bStop);
-            };
+                        taskPtr->m_bFetchRows = false;
+                        taskPtr->m_poLayer->GetNextArrowArrayInternal(
+                            taskPtr->m_psArrowArray.get(),
+                            taskPtr->m_osErrorMsg,
+                            taskPtr->m_bMemoryLimitReached);
+                        taskPtr->m_bArrayReady = true;
+                        taskPtr->m_oCV.notify_one();
+                        if (taskPtr->m_bMemoryLimitReached)
+                            break;
+                        // cppcheck-suppress knownConditionTrueFalse
+                        // Coverity apparently is confused by the fact that we
+                        // use unique_lock here to guard access for m_bStop
+                        // whereas in other places we use a lock_guard, but
+                        // there's nothing wrong.
+                        // coverity[missing_lock:FALSE]
+                        while (!taskPtr->m_bStop && !taskPtr->m_bFetchRows)
+                        {
+                            taskPtr->m_oCV.wait(oLock);
+                        }
+                    } while (!taskPtr->m_bStop);
+                };
 
-            task->m_bFetchRows = true;
-            try
-            {
-                task->m_oThread = std::thread(taskRunner);
-            }
-            catch (const std::exception &e)
-            {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot start worker thread: %s", e.what());
-                break;
+                task->m_bFetchRows = true;
+                try
+                {
+                    task->m_oThread = std::thread(taskRunner);
+                }
+                catch (const std::exception &e)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Cannot start worker thread: %s", e.what());
+                    break;
+                }
+                m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
             }
-            m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
         }
-    }
 
-    std::string osErrorMsg;
-    bool bMemoryLimitReached = false;
-    int ret =
-        GetNextArrowArrayInternal(out_array, osErrorMsg, bMemoryLimitReached);
-    if (!osErrorMsg.empty())
-        CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
-    if (bMemoryLimitReached)
-    {
-        CancelAsyncNextArrowArray();
-        m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        std::string osErrorMsg;
+        bool bMemoryLimitReached = false;
+        int ret = GetNextArrowArrayInternal(out_array, osErrorMsg,
+                                            bMemoryLimitReached);
+        if (!osErrorMsg.empty())
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", osErrorMsg.c_str());
+        if (bMemoryLimitReached)
+        {
+            CancelAsyncNextArrowArray();
+            m_nIsCompatOfOptimizedGetNextArrowArray = false;
+        }
+        else if (ret == 0 && out_array->release == nullptr &&
+                 osErrorMsg.empty() &&
+                 m_nArrowArrayFIDCursor < m_nArrowArrayMaxFID)
+        {
+            // No row in that range of FIDs
+            continue;
+        }
+        return ret;
     }
-    return ret;
 }
 
 /************************************************************************/
@@ -8841,7 +9153,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     bMemoryLimitReached = false;
     memset(out_array, 0, sizeof(*out_array));
 
-    if (m_iNextShapeId >= m_nTotalFeatureCount)
+    if (m_nArrowArrayFIDCursor >= m_nArrowArrayMaxFID)
     {
         return 0;
     }
@@ -8917,9 +9229,9 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     osSQL += "\" WHERE \"";
     osSQL += SQLEscapeName(m_pszFidColumn);
     osSQL += "\" BETWEEN ";
-    osSQL += std::to_string(m_iNextShapeId + 1);
+    osSQL += std::to_string(m_nArrowArrayFIDCursor + 1);
     osSQL += " AND ";
-    osSQL += std::to_string(m_iNextShapeId +
+    osSQL += std::to_string(m_nArrowArrayFIDCursor +
                             sFillArrowArray.psHelper->m_nMaxBatchSize);
 
     // CPLDebug("GPKG", "%s", osSQL.c_str());
@@ -8956,6 +9268,7 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     }
 
     m_iNextShapeId += sFillArrowArray.nCountRows;
+    m_nArrowArrayFIDCursor += sFillArrowArray.psHelper->m_nMaxBatchSize;
 
     return 0;
 }
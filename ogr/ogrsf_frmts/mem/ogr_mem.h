@@ -31,9 +31,15 @@
 #ifndef OGRMEM_H_INCLUDED
 #define OGRMEM_H_INCLUDED
 
+#include "cpl_quad_tree.h"
+#include "ogr_recordbatch.h"
 #include "ogrsf_frmts.h"
 
 #include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 /************************************************************************/
 /*                             OGRMemLayer                              */
@@ -41,6 +47,7 @@
 class OGRMemDataSource;
 
 class IOGRMemLayerFeatureIterator;
+class OGRMemLayerAttrIndex;
 
 class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
 {
@@ -72,12 +79,36 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
 
     GDALDataset *m_poDS{};
 
+    // Spatial index of the features, on the geometry field
+    // m_iSpatialIndexGeomField. Built on the first read with a spatial
+    // filter, and then updated when features are added, modified or removed.
+    bool m_bSpatialIndexEnabled = true;
+    CPLQuadTree *m_hSpatialIndex = nullptr;
+    int m_iSpatialIndexGeomField = -1;
+    CPLRectObj m_sSpatialIndexBounds{};
+
+    // Sorted FIDs of the features to consider in GetNextFeature(), when
+    // they could be computed from the spatial or attribute indexes.
+    bool m_bCandidateFIDsComputed = false;
+    bool m_bUseCandidateFIDs = false;
+    std::vector<GIntBig> m_anCandidateFIDs{};
+    size_t m_iNextCandidateFID = 0;
+
+    friend class OGRMemLayerAttrIndex;
+
     // Only use it in the lifetime of a function where the list of features
     // doesn't change.
     IOGRMemLayerFeatureIterator *GetIterator();
 
     OGRFeature *GetFeatureRef(GIntBig nFeatureId);
 
+    OGRMemLayerAttrIndex *GetMemAttrIndex();
+    void BuildSpatialIndex();
+    void InvalidateSpatialIndex();
+    void AddToIndices(OGRFeature *poFeature);
+    void RemoveFromIndices(OGRFeature *poFeature);
+    void ComputeCandidateFIDs();
+
   public:
     // Clone poSRS if not nullptr
     OGRMemLayer(const char *pszName, const OGRSpatialReference *poSRS,
@@ -146,6 +177,8 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
         m_osFIDColumn = pszFIDColumn;
     }
 
+    void SetSpatialIndexEnabled(bool bEnabled);
+
     bool HasBeenUpdated() const
     {
         return m_bUpdated;
@@ -172,6 +205,145 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
     }
 };
 
+/************************************************************************/
+/*                         OGRMemColumnarLayer                          */
+/************************************************************************/
+
+struct OGRMemColumnarBatch;
+struct OGRMemColumnarStreamPrivate;
+
+// Layer storing its features as the Arrow arrays received by
+// WriteArrowBatch(), instead of OGRFeature objects.
+class OGRMemColumnarLayer final : public OGRLayer
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRMemColumnarLayer)
+
+    OGRFeatureDefn *m_poFeatureDefn = nullptr;
+    std::string m_osFIDColumn{};
+    GDALDataset *m_poDS = nullptr;
+
+    // Used by streams to detect that the layer has been destroyed.
+    std::shared_ptr<OGRMemColumnarLayer *> m_poSelfRef{};
+
+    // CreateFeature() and WriteArrowBatch() are mutually exclusive.
+    enum class WriteMode
+    {
+        NONE,
+        FEATURE,
+        ARROW_BATCH
+    };
+
+    WriteMode m_eWriteMode = WriteMode::NONE;
+
+    // Schema of the stored batches, set by the first batch.
+    struct ArrowSchema m_sSchema{};
+    CPLStringList m_aosDecodeOptions{};
+    int m_iFIDChild = -1;
+    // For each OGR geometry field, index of the Arrow child array, or -1.
+    std::vector<int> m_anGeomFieldChild{};
+    // For each OGR geometry field, whether the extent of each batch is known
+    // (WKB encoding).
+    std::vector<bool> m_abGeomFieldExtentKnown{};
+
+    std::vector<std::shared_ptr<OGRMemColumnarBatch>> m_apoBatches{};
+    GIntBig m_nFeatureCount = 0;
+    GIntBig m_nNextFID = 0;
+
+    // Features from CreateFeature() not yet converted to a batch.
+    std::vector<std::unique_ptr<OGRFeature>> m_apoPendingFeatures{};
+
+    // Features of batch m_iDecodedBatch, for row based access.
+    bool m_bHasDecodedBatch = false;
+    size_t m_iDecodedBatch = 0;
+    std::vector<std::unique_ptr<OGRFeature>> m_apoDecodedFeatures{};
+
+    size_t m_iNextBatch = 0;
+    size_t m_iNextFeatureInBatch = 0;
+
+    // Only used when the batches have a FID column.
+    bool m_bFIDMapBuilt = false;
+    std::unordered_map<GIntBig, std::pair<size_t, size_t>> m_oMapFIDToRow{};
+
+    bool SetSchema(const struct ArrowSchema *schema, struct ArrowArray *array,
+                   CSLConstList papszOptions);
+    bool AppendBatch(const struct ArrowSchema *schema, struct ArrowArray *array,
+                     CSLConstList papszOptions);
+    bool FlushPendingFeatures();
+    bool DecodeBatch(size_t iBatch);
+    void IndexFIDs(size_t iBatch);
+    bool LocateFeature(GIntBig nFID, size_t &iBatch, size_t &iRow);
+    bool BatchIntersectsSpatialFilter(const OGRMemColumnarBatch &oBatch) const;
+    bool BuildStreamSchema(CSLConstList papszOptions,
+                           struct ArrowSchema *out_schema,
+                           std::vector<int> &anSelectedChildren);
+
+    static int StreamGetSchema(struct ArrowArrayStream *stream,
+                               struct ArrowSchema *out_schema);
+    static int StreamGetNext(struct ArrowArrayStream *stream,
+                             struct ArrowArray *out_array);
+    static const char *StreamGetLastError(struct ArrowArrayStream *stream);
+    static void StreamRelease(struct ArrowArrayStream *stream);
+
+  public:
+    // Clone poSRS if not nullptr
+    OGRMemColumnarLayer(const char *pszName, const OGRSpatialReference *poSRS,
+                        OGRwkbGeometryType eGeomType);
+    ~OGRMemColumnarLayer() override;
+
+    void ResetReading() override;
+    OGRFeature *GetNextFeature() override;
+    OGRFeature *GetFeature(GIntBig nFID) override;
+    OGRErr ICreateFeature(OGRFeature *poFeature) override;
+
+    OGRFeatureDefn *GetLayerDefn() override
+    {
+        return m_poFeatureDefn;
+    }
+
+    GIntBig GetFeatureCount(int bForce) override;
+
+    OGRErr GetExtent(OGREnvelope *psExtent, int bForce) override
+    {
+        return GetExtent(0, psExtent, bForce);
+    }
+
+    OGRErr GetExtent(int iGeomField, OGREnvelope *psExtent,
+                     int bForce) override;
+
+    OGRErr CreateField(const OGRFieldDefn *poField,
+                       int bApproxOK = TRUE) override;
+    OGRErr CreateGeomField(const OGRGeomFieldDefn *poGeomField,
+                           int bApproxOK = TRUE) override;
+
+    bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                        CSLConstList papszOptions = nullptr) override;
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
+
+    int TestCapability(const char *) override;
+
+    const char *GetFIDColumn() override
+    {
+        return m_osFIDColumn.c_str();
+    }
+
+    void SetFIDColumn(const char *pszFIDColumn)
+    {
+        m_osFIDColumn = pszFIDColumn;
+    }
+
+    void SetDataset(GDALDataset *poDS)
+    {
+        m_poDS = poDS;
+    }
+
+    GDALDataset *GetDataset() override
+    {
+        return m_poDS;
+    }
+};
+
 /************************************************************************/
 /*                           OGRMemDataSource                           */
 /************************************************************************/
@@ -180,7 +352,7 @@ class OGRMemDataSource CPL_NON_FINAL : public OGRDataSource
 {
     CPL_DISALLOW_COPY_ASSIGN(OGRMemDataSource)
 
-    OGRMemLayer **papoLayers;
+    OGRLayer **papoLayers;
     int nLayers;
 
     char *pszName;
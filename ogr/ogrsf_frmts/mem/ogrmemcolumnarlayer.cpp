@@ -0,0 +1,1356 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implements OGRMemColumnarLayer class.
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "ogr_mem.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "ogr_core.h"
+#include "ogr_feature.h"
+#include "ogr_recordbatch.h"
+#include "ogr_spatialref.h"
+#include "ogr_wkb.h"
+#include "ogrlayerarrow.h"
+#include "ogrsf_frmts.h"
+
+/************************************************************************/
+/*                         OGRMemColumnarBatch                          */
+/************************************************************************/
+
+struct OGRMemColumnarBatch
+{
+    struct ArrowArray sArray{};
+
+    // FID of the first row, when the batches have no FID column.
+    GIntBig nFIDStart = 0;
+
+    // Extent of each geometry field whose encoding is WKB.
+    std::vector<OGREnvelope> asGeomFieldExtent{};
+
+    OGRMemColumnarBatch() = default;
+
+    ~OGRMemColumnarBatch()
+    {
+        if (sArray.release)
+            sArray.release(&sArray);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRMemColumnarBatch)
+};
+
+/************************************************************************/
+/*                     OGRMemColumnarStreamPrivate                      */
+/************************************************************************/
+
+struct OGRMemColumnarStreamPrivate
+{
+    std::shared_ptr<OGRMemColumnarLayer *> poLayerRef{};
+    struct ArrowSchema sSchema{};
+    // Index of the child arrays of the batches returned by the stream.
+    // -1 for a FID column generated on the fly.
+    std::vector<int> anSelectedChildren{};
+    // A snapshot of the batches, so that the stream is not affected by
+    // batches added afterwards.
+    std::vector<std::shared_ptr<OGRMemColumnarBatch>> apoBatches{};
+    CPLStringList aosOptions{};
+    bool bPostFilter = false;
+    size_t nMaxFeaturesInBatch = 65536;
+    size_t iBatch = 0;
+    size_t iRowInBatch = 0;
+    std::string osLastError{};
+
+    OGRMemColumnarStreamPrivate() = default;
+
+    ~OGRMemColumnarStreamPrivate()
+    {
+        if (sSchema.release)
+            sSchema.release(&sSchema);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRMemColumnarStreamPrivate)
+};
+
+/************************************************************************/
+/*                     OGRMemColumnarArrayPrivate                       */
+/************************************************************************/
+
+// Private data of the child arrays returned by the stream, which point to
+// the buffers of a batch.
+struct OGRMemColumnarArrayPrivate
+{
+    std::shared_ptr<OGRMemColumnarBatch> poBatch{};
+};
+
+/************************************************************************/
+/*                       OGRMemColumnarDecoder                          */
+/*                                                                      */
+/*      Layer whose only purpose is to convert the rows of a batch to   */
+/*      OGRFeature objects, with the generic WriteArrowBatch()          */
+/*      implementation.                                                 */
+/************************************************************************/
+
+class OGRMemColumnarDecoder final : public OGRLayer
+{
+    OGRFeatureDefn *const m_poFeatureDefn;
+    std::vector<std::unique_ptr<OGRFeature>> *const m_papoFeatures;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRMemColumnarDecoder)
+
+  public:
+    OGRMemColumnarDecoder(
+        OGRFeatureDefn *poFeatureDefn,
+        std::vector<std::unique_ptr<OGRFeature>> *papoFeatures)
+        : m_poFeatureDefn(poFeatureDefn), m_papoFeatures(papoFeatures)
+    {
+    }
+
+    void ResetReading() override
+    {
+    }
+
+    OGRFeature *GetNextFeature() override
+    {
+        return nullptr;
+    }
+
+    OGRFeatureDefn *GetLayerDefn() override
+    {
+        return m_poFeatureDefn;
+    }
+
+    int TestCapability(const char *pszCap) override
+    {
+        return EQUAL(pszCap, OLCCurveGeometries) ||
+               EQUAL(pszCap, OLCMeasuredGeometries) ||
+               EQUAL(pszCap, OLCZGeometries);
+    }
+
+    OGRErr ICreateFeature(OGRFeature *poFeature) override
+    {
+        if (m_papoFeatures)
+            m_papoFeatures->emplace_back(poFeature->Clone());
+        return OGRERR_NONE;
+    }
+};
+
+/************************************************************************/
+/*                            Arrow helpers                             */
+/************************************************************************/
+
+static inline bool TestBit(const uint8_t *pabyData, size_t nIdx)
+{
+    return (pabyData[nIdx / 8] & (1 << (nIdx % 8))) != 0;
+}
+
+static void OGRMemColumnarReleaseSchema(struct ArrowSchema *schema)
+{
+    CPLFree(const_cast<char *>(schema->format));
+    CPLFree(const_cast<char *>(schema->name));
+    CPLFree(const_cast<char *>(schema->metadata));
+    for (int64_t i = 0; i < schema->n_children; ++i)
+    {
+        if (schema->children[i]->release)
+            schema->children[i]->release(schema->children[i]);
+        CPLFree(schema->children[i]);
+    }
+    CPLFree(schema->children);
+    if (schema->dictionary)
+    {
+        if (schema->dictionary->release)
+            schema->dictionary->release(schema->dictionary);
+        CPLFree(schema->dictionary);
+    }
+    schema->release = nullptr;
+}
+
+static size_t GetArrowMetadataSize(const char *pabyMetadata)
+{
+    int32_t nKVP = 0;
+    memcpy(&nKVP, pabyMetadata, sizeof(int32_t));
+    size_t nSize = sizeof(int32_t);
+    for (int i = 0; i < 2 * nKVP; ++i)
+    {
+        int32_t nLen = 0;
+        memcpy(&nLen, pabyMetadata + nSize, sizeof(int32_t));
+        nSize += sizeof(int32_t) + nLen;
+    }
+    return nSize;
+}
+
+// Deep copy of a schema, whose memory is entirely owned by the copy.
+static void DuplicateArrowSchema(const struct ArrowSchema *src,
+                                 struct ArrowSchema *dst)
+{
+    memset(dst, 0, sizeof(*dst));
+    dst->format = CPLStrdup(src->format);
+    dst->name = src->name ? CPLStrdup(src->name) : nullptr;
+    if (src->metadata)
+    {
+        const size_t nSize = GetArrowMetadataSize(src->metadata);
+        char *pabyMetadata = static_cast<char *>(CPLMalloc(nSize));
+        memcpy(pabyMetadata, src->metadata, nSize);
+        dst->metadata = pabyMetadata;
+    }
+    dst->flags = src->flags;
+    dst->n_children = src->n_children;
+    if (src->n_children)
+    {
+        dst->children = static_cast<struct ArrowSchema **>(
+            CPLCalloc(static_cast<size_t>(src->n_children),
+                      sizeof(struct ArrowSchema *)));
+        for (int64_t i = 0; i < src->n_children; ++i)
+        {
+            dst->children[i] = static_cast<struct ArrowSchema *>(
+                CPLCalloc(1, sizeof(struct ArrowSchema)));
+            DuplicateArrowSchema(src->children[i], dst->children[i]);
+        }
+    }
+    if (src->dictionary)
+    {
+        dst->dictionary = static_cast<struct ArrowSchema *>(
+            CPLCalloc(1, sizeof(struct ArrowSchema)));
+        DuplicateArrowSchema(src->dictionary, dst->dictionary);
+    }
+    dst->release = OGRMemColumnarReleaseSchema;
+}
+
+static struct ArrowSchema *
+DuplicateArrowSchema(const struct ArrowSchema *src)
+{
+    auto dst = static_cast<struct ArrowSchema *>(
+        CPLCalloc(1, sizeof(struct ArrowSchema)));
+    DuplicateArrowSchema(src, dst);
+    return dst;
+}
+
+// Compare the formats and names of two schemas, recursively.
+static bool IsSameArrowSchema(const struct ArrowSchema *a,
+                              const struct ArrowSchema *b)
+{
+    if (strcmp(a->format, b->format) != 0 ||
+        strcmp(a->name ? a->name : "", b->name ? b->name : "") != 0 ||
+        a->n_children != b->n_children ||
+        (a->dictionary == nullptr) != (b->dictionary == nullptr))
+    {
+        return false;
+    }
+    for (int64_t i = 0; i < a->n_children; ++i)
+    {
+        if (!IsSameArrowSchema(a->children[i], b->children[i]))
+            return false;
+    }
+    return a->dictionary == nullptr ||
+           IsSameArrowSchema(a->dictionary, b->dictionary);
+}
+
+static std::string GetArrowExtensionName(const struct ArrowSchema *schema)
+{
+    if (schema->metadata)
+    {
+        const auto oMetadata = OGRParseArrowMetadata(schema->metadata);
+        const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+        if (oIter != oMetadata.end())
+            return oIter->second;
+    }
+    return std::string();
+}
+
+static bool GetFIDValue(const struct ArrowArray *psArray, bool bInt32,
+                        size_t iRow, GIntBig &nFID)
+{
+    const size_t nIdx = static_cast<size_t>(psArray->offset) + iRow;
+    const uint8_t *pabyValidity =
+        static_cast<const uint8_t *>(psArray->buffers[0]);
+    if (psArray->null_count != 0 && pabyValidity &&
+        !TestBit(pabyValidity, nIdx))
+    {
+        return false;
+    }
+    if (bInt32)
+        nFID = static_cast<const int32_t *>(psArray->buffers[1])[nIdx];
+    else
+        nFID = static_cast<const int64_t *>(psArray->buffers[1])[nIdx];
+    return true;
+}
+
+static void ComputeWKBArrayExtent(const struct ArrowArray *psArray,
+                                  bool bLargeBinary, OGREnvelope &sExtent)
+{
+    const uint8_t *pabyValidity =
+        static_cast<const uint8_t *>(psArray->buffers[0]);
+    const GByte *pabyData = static_cast<const GByte *>(psArray->buffers[2]);
+    for (size_t i = 0; i < static_cast<size_t>(psArray->length); ++i)
+    {
+        const size_t nIdx = static_cast<size_t>(psArray->offset) + i;
+        if (psArray->null_count != 0 && pabyValidity &&
+            !TestBit(pabyValidity, nIdx))
+        {
+            continue;
+        }
+        size_t nStart;
+        size_t nEnd;
+        if (bLargeBinary)
+        {
+            const auto panOffsets =
+                static_cast<const int64_t *>(psArray->buffers[1]);
+            nStart = static_cast<size_t>(panOffsets[nIdx]);
+            nEnd = static_cast<size_t>(panOffsets[nIdx + 1]);
+        }
+        else
+        {
+            const auto panOffsets =
+                static_cast<const int32_t *>(psArray->buffers[1]);
+            nStart = static_cast<size_t>(panOffsets[nIdx]);
+            nEnd = static_cast<size_t>(panOffsets[nIdx + 1]);
+        }
+        OGREnvelope sEnvelope;
+        if (nEnd > nStart &&
+            OGRWKBGetBoundingBox(pabyData + nStart, nEnd - nStart, sEnvelope))
+        {
+            sExtent.Merge(sEnvelope);
+        }
+    }
+}
+
+static void ReleaseChildArrayView(struct ArrowArray *array)
+{
+    delete static_cast<OGRMemColumnarArrayPrivate *>(array->private_data);
+    array->private_data = nullptr;
+    array->release = nullptr;
+}
+
+static void ReleaseFIDArray(struct ArrowArray *array)
+{
+    VSIFreeAligned(const_cast<void *>(array->buffers[1]));
+    CPLFree(array->buffers);
+    array->release = nullptr;
+}
+
+static void ReleaseArrayView(struct ArrowArray *array)
+{
+    for (int64_t i = 0; i < array->n_children; ++i)
+    {
+        if (array->children[i]->release)
+            array->children[i]->release(array->children[i]);
+        CPLFree(array->children[i]);
+    }
+    CPLFree(array->children);
+    CPLFree(array->buffers);
+    array->release = nullptr;
+}
+
+// Build an array pointing to the rows [iStart, iStart + nRows[ of a batch,
+// without copying its buffers.
+static bool
+BuildArrayView(const std::shared_ptr<OGRMemColumnarBatch> &poBatch,
+               const std::vector<int> &anSelectedChildren, size_t iStart,
+               size_t nRows, struct ArrowArray *out_array)
+{
+    memset(out_array, 0, sizeof(*out_array));
+    out_array->length = static_cast<int64_t>(nRows);
+    out_array->n_buffers = 1;
+    out_array->buffers =
+        static_cast<const void **>(CPLCalloc(1, sizeof(void *)));
+    out_array->n_children = static_cast<int64_t>(anSelectedChildren.size());
+    out_array->children = static_cast<struct ArrowArray **>(
+        CPLCalloc(anSelectedChildren.size(), sizeof(struct ArrowArray *)));
+    out_array->release = ReleaseArrayView;
+
+    const auto &sBatchArray = poBatch->sArray;
+    for (size_t i = 0; i < anSelectedChildren.size(); ++i)
+    {
+        auto psChild = static_cast<struct ArrowArray *>(
+            CPLCalloc(1, sizeof(struct ArrowArray)));
+        out_array->children[i] = psChild;
+        const int iChild = anSelectedChildren[i];
+        if (iChild < 0)
+        {
+            auto panFIDs = static_cast<int64_t *>(
+                VSI_MALLOC_ALIGNED_AUTO_VERBOSE(sizeof(int64_t) * nRows));
+            if (!panFIDs)
+            {
+                out_array->release(out_array);
+                return false;
+            }
+            for (size_t j = 0; j < nRows; ++j)
+                panFIDs[j] =
+                    poBatch->nFIDStart + static_cast<GIntBig>(iStart + j);
+            psChild->length = static_cast<int64_t>(nRows);
+            psChild->n_buffers = 2;
+            psChild->buffers =
+                static_cast<const void **>(CPLCalloc(2, sizeof(void *)));
+            psChild->buffers[1] = panFIDs;
+            psChild->release = ReleaseFIDArray;
+        }
+        else
+        {
+            const auto psSrcChild = sBatchArray.children[iChild];
+            memcpy(psChild, psSrcChild, sizeof(*psChild));
+            psChild->offset = psSrcChild->offset + static_cast<int64_t>(iStart);
+            psChild->length = static_cast<int64_t>(nRows);
+            if (nRows != static_cast<size_t>(psSrcChild->length) &&
+                psSrcChild->null_count != 0)
+            {
+                psChild->null_count = -1;
+            }
+            auto psPrivate = new OGRMemColumnarArrayPrivate();
+            psPrivate->poBatch = poBatch;
+            psChild->private_data = psPrivate;
+            psChild->release = ReleaseChildArrayView;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        OGRMemColumnarLayer()                         */
+/************************************************************************/
+
+OGRMemColumnarLayer::OGRMemColumnarLayer(const char *pszName,
+                                         const OGRSpatialReference *poSRSIn,
+                                         OGRwkbGeometryType eGeomType)
+    : m_poFeatureDefn(new OGRFeatureDefn(pszName)),
+      m_poSelfRef(std::make_shared<OGRMemColumnarLayer *>(this))
+{
+    m_poFeatureDefn->Reference();
+
+    SetDescription(m_poFeatureDefn->GetName());
+    m_poFeatureDefn->SetGeomType(eGeomType);
+
+    if (eGeomType != wkbNone && poSRSIn != nullptr)
+    {
+        OGRSpatialReference *poSRS = poSRSIn->Clone();
+        m_poFeatureDefn->GetGeomFieldDefn(0)->SetSpatialRef(poSRS);
+        poSRS->Release();
+    }
+
+    m_poFeatureDefn->Seal(/* bSealFields = */ true);
+}
+
+/************************************************************************/
+/*                        ~OGRMemColumnarLayer()                        */
+/************************************************************************/
+
+OGRMemColumnarLayer::~OGRMemColumnarLayer()
+{
+    // Make pending streams aware that the layer no longer exists.
+    *m_poSelfRef = nullptr;
+
+    m_apoPendingFeatures.clear();
+    m_apoDecodedFeatures.clear();
+    m_apoBatches.clear();
+    if (m_sSchema.release)
+        m_sSchema.release(&m_sSchema);
+
+    m_poFeatureDefn->Release();
+}
+
+/************************************************************************/
+/*                             SetSchema()                              */
+/************************************************************************/
+
+bool OGRMemColumnarLayer::SetSchema(const struct ArrowSchema *schema,
+                                    struct ArrowArray *array,
+                                    CSLConstList papszOptions)
+{
+    const char *pszFIDName =
+        CSLFetchNameValueDef(papszOptions, "FID", GetFIDColumn());
+    if (!pszFIDName || pszFIDName[0] == 0)
+        pszFIDName = DEFAULT_ARROW_FID_NAME;
+    const char *pszGeomFieldName = CSLFetchNameValueDef(
+        papszOptions, "GEOMETRY_NAME", GetGeometryColumn());
+    if (!pszGeomFieldName || pszGeomFieldName[0] == 0)
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+
+    CPLStringList aosDecodeOptions(papszOptions);
+    aosDecodeOptions.SetNameValue("FID", pszFIDName);
+    aosDecodeOptions.SetNameValue("GEOMETRY_NAME", pszGeomFieldName);
+
+    // Let the generic implementation check that the schema is compatible
+    // with the layer definition, without decoding any row.
+    {
+        struct ArrowArray sEmptyArray;
+        memcpy(&sEmptyArray, array, sizeof(sEmptyArray));
+        sEmptyArray.length = 0;
+        OGRMemColumnarDecoder oDecoder(m_poFeatureDefn, nullptr);
+        if (!oDecoder.WriteArrowBatch(schema, &sEmptyArray,
+                                      aosDecodeOptions.List()))
+        {
+            return false;
+        }
+    }
+
+    const int nGeomFieldCount = m_poFeatureDefn->GetGeomFieldCount();
+    m_iFIDChild = -1;
+    m_anGeomFieldChild.assign(nGeomFieldCount, -1);
+    m_abGeomFieldExtentKnown.assign(nGeomFieldCount, false);
+    for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
+    {
+        const auto psChild = schema->children[i];
+        const char *pszName = psChild->name ? psChild->name : "";
+        const char *pszFormat = psChild->format;
+        if (m_iFIDChild < 0 && strcmp(pszName, pszFIDName) == 0 &&
+            (strcmp(pszFormat, "i") == 0 || strcmp(pszFormat, "l") == 0))
+        {
+            m_iFIDChild = i;
+            continue;
+        }
+
+        const std::string osExtensionName = GetArrowExtensionName(psChild);
+        const bool bIsWKB =
+            (strcmp(pszFormat, "z") == 0 || strcmp(pszFormat, "Z") == 0) &&
+            (osExtensionName == EXTENSION_NAME_OGC_WKB ||
+             osExtensionName == EXTENSION_NAME_GEOARROW_WKB ||
+             strcmp(pszName, pszGeomFieldName) == 0);
+        const bool bIsGeoArrow =
+            !bIsWKB && STARTS_WITH(osExtensionName.c_str(), "geoarrow.");
+        if (bIsWKB || bIsGeoArrow)
+        {
+            int iGeomField = m_poFeatureDefn->GetGeomFieldIndex(pszName);
+            if (iGeomField < 0)
+                iGeomField = 0;
+            if (iGeomField < nGeomFieldCount &&
+                m_anGeomFieldChild[iGeomField] < 0)
+            {
+                m_anGeomFieldChild[iGeomField] = i;
+                m_abGeomFieldExtentKnown[iGeomField] = bIsWKB;
+            }
+        }
+    }
+
+    DuplicateArrowSchema(schema, &m_sSchema);
+    m_aosDecodeOptions = std::move(aosDecodeOptions);
+    return true;
+}
+
+/************************************************************************/
+/*                            AppendBatch()                             */
+/************************************************************************/
+
+bool OGRMemColumnarLayer::AppendBatch(const struct ArrowSchema *schema,
+                                      struct ArrowArray *array,
+                                      CSLConstList papszOptions)
+{
+    if (strcmp(schema->format, "+s") != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "WriteArrowBatch() should be called on a schema that is a "
+                 "struct of fields");
+        return false;
+    }
+
+    if (schema->n_children != array->n_children)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "WriteArrowBatch(): schema->n_children (%d) != "
+                 "array->n_children (%d)",
+                 int(schema->n_children), int(array->n_children));
+        return false;
+    }
+
+    if (!m_sSchema.release)
+    {
+        if (!SetSchema(schema, array, papszOptions))
+            return false;
+    }
+    else if (!IsSameArrowSchema(&m_sSchema, schema))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "WriteArrowBatch(): the schema of the batch is different "
+                 "from the one of the previously written batches");
+        return false;
+    }
+
+    if (array->length == 0)
+        return true;
+
+    auto poBatch = std::make_shared<OGRMemColumnarBatch>();
+    if (array->offset != 0)
+    {
+        // Row based access assumes a zero offset for the top level array.
+        if (!OGRCloneArrowArray(schema, array, &poBatch->sArray))
+            return false;
+    }
+    else
+    {
+        // Take ownership of the array, as allowed by the WriteArrowBatch()
+        // contract.
+        memcpy(&poBatch->sArray, array, sizeof(*array));
+        array->release = nullptr;
+    }
+
+    const auto &sArray = poBatch->sArray;
+    const size_t nLength = static_cast<size_t>(sArray.length);
+    if (m_iFIDChild >= 0)
+    {
+        const auto psFIDArray = sArray.children[m_iFIDChild];
+        const bool bInt32 =
+            strcmp(m_sSchema.children[m_iFIDChild]->format, "i") == 0;
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            GIntBig nFID = 0;
+            if (GetFIDValue(psFIDArray, bInt32, i, nFID) && nFID >= m_nNextFID)
+                m_nNextFID = nFID + 1;
+        }
+    }
+    else
+    {
+        poBatch->nFIDStart = m_nNextFID;
+        m_nNextFID += static_cast<GIntBig>(nLength);
+    }
+
+    poBatch->asGeomFieldExtent.resize(m_anGeomFieldChild.size());
+    for (size_t i = 0; i < m_anGeomFieldChild.size(); ++i)
+    {
+        if (m_abGeomFieldExtentKnown[i])
+        {
+            const int iChild = m_anGeomFieldChild[i];
+            ComputeWKBArrayExtent(
+                sArray.children[iChild],
+                strcmp(m_sSchema.children[iChild]->format, "Z") == 0,
+                poBatch->asGeomFieldExtent[i]);
+        }
+    }
+
+    m_nFeatureCount += static_cast<GIntBig>(nLength);
+    m_apoBatches.push_back(std::move(poBatch));
+    if (m_bFIDMapBuilt)
+        IndexFIDs(m_apoBatches.size() - 1);
+
+    return true;
+}
+
+/************************************************************************/
+/*                           WriteArrowBatch()                          */
+/************************************************************************/
+
+bool OGRMemColumnarLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                          struct ArrowArray *array,
+                                          CSLConstList papszOptions)
+{
+    if (m_eWriteMode == WriteMode::FEATURE)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "WriteArrowBatch() cannot be used on a columnar layer after "
+                 "CreateFeature()");
+        return false;
+    }
+
+    const bool bRet = AppendBatch(schema, array, papszOptions);
+    if (m_sSchema.release)
+        m_eWriteMode = WriteMode::ARROW_BATCH;
+    return bRet;
+}
+
+/************************************************************************/
+/*                           ICreateFeature()                           */
+/************************************************************************/
+
+OGRErr OGRMemColumnarLayer::ICreateFeature(OGRFeature *poFeature)
+{
+    if (m_eWriteMode == WriteMode::ARROW_BATCH)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "CreateFeature() cannot be used on a columnar layer after "
+                 "WriteArrowBatch()");
+        return OGRERR_FAILURE;
+    }
+    m_eWriteMode = WriteMode::FEATURE;
+
+    if (poFeature->GetFID() == OGRNullFID)
+        poFeature->SetFID(m_nNextFID++);
+    else if (poFeature->GetFID() >= m_nNextFID)
+        m_nNextFID = poFeature->GetFID() + 1;
+
+    auto poNewFeature = std::make_unique<OGRFeature>(m_poFeatureDefn);
+    poNewFeature->SetFrom(poFeature);
+    poNewFeature->SetFID(poFeature->GetFID());
+    m_apoPendingFeatures.push_back(std::move(poNewFeature));
+
+    // Convert the features to a batch once there are enough of them
+    constexpr size_t MAX_PENDING_FEATURES = 65536;
+    if (m_apoPendingFeatures.size() == MAX_PENDING_FEATURES &&
+        !FlushPendingFeatures())
+    {
+        return OGRERR_FAILURE;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                        FlushPendingFeatures()                        */
+/************************************************************************/
+
+bool OGRMemColumnarLayer::FlushPendingFeatures()
+{
+    if (m_apoPendingFeatures.empty())
+        return true;
+
+    // Use the generic GetArrowStream() implementation of a temporary
+    // row based layer to build the batches.
+    OGRMemLayer oTmpLayer(GetName(), nullptr, wkbNone);
+    oTmpLayer.SetFIDColumn(m_osFIDColumn.c_str());
+    for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+    {
+        if (oTmpLayer.CreateField(m_poFeatureDefn->GetFieldDefn(i)) !=
+            OGRERR_NONE)
+        {
+            return false;
+        }
+    }
+    for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+    {
+        if (oTmpLayer.CreateGeomField(m_poFeatureDefn->GetGeomFieldDefn(i)) !=
+            OGRERR_NONE)
+        {
+            return false;
+        }
+    }
+    for (auto &poFeature : m_apoPendingFeatures)
+    {
+        auto poTmpFeature =
+            std::make_unique<OGRFeature>(oTmpLayer.GetLayerDefn());
+        poTmpFeature->SetFrom(poFeature.get());
+        poTmpFeature->SetFID(poFeature->GetFID());
+        poFeature.reset();
+        if (oTmpLayer.CreateFeature(poTmpFeature.get()) != OGRERR_NONE)
+        {
+            m_apoPendingFeatures.clear();
+            return false;
+        }
+    }
+    m_apoPendingFeatures.clear();
+
+    struct ArrowArrayStream stream;
+    if (!oTmpLayer.GetArrowStream(&stream))
+        return false;
+    struct ArrowSchema schema;
+    if (stream.get_schema(&stream, &schema) != 0)
+    {
+        stream.release(&stream);
+        return false;
+    }
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("FID", m_osFIDColumn.empty()
+                                       ? DEFAULT_ARROW_FID_NAME
+                                       : m_osFIDColumn.c_str());
+    bool bRet = true;
+    while (bRet)
+    {
+        struct ArrowArray array;
+        if (stream.get_next(&stream, &array) != 0)
+        {
+            bRet = false;
+            break;
+        }
+        if (!array.release)
+            break;
+        bRet = AppendBatch(&schema, &array, aosOptions.List());
+        if (array.release)
+            array.release(&array);
+    }
+    schema.release(&schema);
+    stream.release(&stream);
+    return bRet;
+}
+
+/************************************************************************/
+/*                             DecodeBatch()                            */
+/************************************************************************/
+
+bool OGRMemColumnarLayer::DecodeBatch(size_t iBatch)
+{
+    m_bHasDecodedBatch = false;
+    m_apoDecodedFeatures.clear();
+
+    const auto &poBatch = m_apoBatches[iBatch];
+    const size_t nLength = static_cast<size_t>(poBatch->sArray.length);
+    m_apoDecodedFeatures.reserve(nLength);
+    OGRMemColumnarDecoder oDecoder(m_poFeatureDefn, &m_apoDecodedFeatures);
+    if (!oDecoder.WriteArrowBatch(&m_sSchema, &poBatch->sArray,
+                                  m_aosDecodeOptions.List()) ||
+        m_apoDecodedFeatures.size() != nLength)
+    {
+        m_apoDecodedFeatures.clear();
+        return false;
+    }
+    if (m_iFIDChild < 0)
+    {
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            m_apoDecodedFeatures[i]->SetFID(poBatch->nFIDStart +
+                                            static_cast<GIntBig>(i));
+        }
+    }
+
+    m_bHasDecodedBatch = true;
+    m_iDecodedBatch = iBatch;
+    return true;
+}
+
+/************************************************************************/
+/*                              IndexFIDs()                             */
+/************************************************************************/
+
+void OGRMemColumnarLayer::IndexFIDs(size_t iBatch)
+{
+    const auto &sArray = m_apoBatches[iBatch]->sArray;
+    const auto psFIDArray = sArray.children[m_iFIDChild];
+    const bool bInt32 =
+        strcmp(m_sSchema.children[m_iFIDChild]->format, "i") == 0;
+    for (size_t i = 0; i < static_cast<size_t>(sArray.length); ++i)
+    {
+        GIntBig nFID = 0;
+        if (GetFIDValue(psFIDArray, bInt32, i, nFID))
+            m_oMapFIDToRow.emplace(nFID, std::make_pair(iBatch, i));
+    }
+}
+
+/************************************************************************/
+/*                            LocateFeature()                           */
+/************************************************************************/
+
+bool OGRMemColumnarLayer::LocateFeature(GIntBig nFID, size_t &iBatch,
+                                        size_t &iRow)
+{
+    if (m_iFIDChild < 0)
+    {
+        const auto oIter = std::upper_bound(
+            m_apoBatches.begin(), m_apoBatches.end(), nFID,
+            [](GIntBig nVal,
+               const std::shared_ptr<OGRMemColumnarBatch> &poBatch)
+            { return nVal < poBatch->nFIDStart; });
+        if (oIter == m_apoBatches.begin())
+            return false;
+        const auto &poBatch = *(oIter - 1);
+        if (nFID - poBatch->nFIDStart >= poBatch->sArray.length)
+            return false;
+        iBatch = static_cast<size_t>(oIter - 1 - m_apoBatches.begin());
+        iRow = static_cast<size_t>(nFID - poBatch->nFIDStart);
+        return true;
+    }
+
+    if (!m_bFIDMapBuilt)
+    {
+        m_bFIDMapBuilt = true;
+        for (size_t i = 0; i < m_apoBatches.size(); ++i)
+            IndexFIDs(i);
+    }
+    const auto oIter = m_oMapFIDToRow.find(nFID);
+    if (oIter == m_oMapFIDToRow.end())
+        return false;
+    iBatch = oIter->second.first;
+    iRow = oIter->second.second;
+    return true;
+}
+
+/************************************************************************/
+/*                    BatchIntersectsSpatialFilter()                    */
+/************************************************************************/
+
+bool OGRMemColumnarLayer::BatchIntersectsSpatialFilter(
+    const OGRMemColumnarBatch &oBatch) const
+{
+    if (m_poFilterGeom == nullptr || m_iGeomFieldFilter < 0 ||
+        m_iGeomFieldFilter >=
+            static_cast<int>(m_abGeomFieldExtentKnown.size()) ||
+        !m_abGeomFieldExtentKnown[m_iGeomFieldFilter])
+    {
+        return true;
+    }
+    return oBatch.asGeomFieldExtent[m_iGeomFieldFilter].Intersects(
+        m_sFilterEnvelope);
+}
+
+/************************************************************************/
+/*                            ResetReading()                            */
+/************************************************************************/
+
+void OGRMemColumnarLayer::ResetReading()
+{
+    m_iNextBatch = 0;
+    m_iNextFeatureInBatch = 0;
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRMemColumnarLayer::GetNextFeature()
+{
+    if (!FlushPendingFeatures())
+        return nullptr;
+
+    while (m_iNextBatch < m_apoBatches.size())
+    {
+        if (m_iNextFeatureInBatch == 0 &&
+            !BatchIntersectsSpatialFilter(*(m_apoBatches[m_iNextBatch])))
+        {
+            ++m_iNextBatch;
+            continue;
+        }
+
+        if (m_iNextFeatureInBatch >=
+            static_cast<size_t>(m_apoBatches[m_iNextBatch]->sArray.length))
+        {
+            ++m_iNextBatch;
+            m_iNextFeatureInBatch = 0;
+            continue;
+        }
+
+        // Features handed over by a previous read are re-decoded
+        if ((!m_bHasDecodedBatch || m_iDecodedBatch != m_iNextBatch ||
+             !m_apoDecodedFeatures[m_iNextFeatureInBatch]) &&
+            !DecodeBatch(m_iNextBatch))
+        {
+            return nullptr;
+        }
+
+        std::unique_ptr<OGRFeature> poFeature(
+            m_apoDecodedFeatures[m_iNextFeatureInBatch].release());
+        ++m_iNextFeatureInBatch;
+
+        if ((m_poFilterGeom == nullptr ||
+             FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
+            (m_poAttrQuery == nullptr ||
+             m_poAttrQuery->Evaluate(poFeature.get())))
+        {
+            m_nFeaturesRead++;
+            return poFeature.release();
+        }
+    }
+
+    return nullptr;
+}
+
+/************************************************************************/
+/*                             GetFeature()                             */
+/************************************************************************/
+
+OGRFeature *OGRMemColumnarLayer::GetFeature(GIntBig nFID)
+{
+    if (!FlushPendingFeatures())
+        return nullptr;
+
+    size_t iBatch = 0;
+    size_t iRow = 0;
+    if (!LocateFeature(nFID, iBatch, iRow))
+        return nullptr;
+
+    if ((!m_bHasDecodedBatch || m_iDecodedBatch != iBatch ||
+         !m_apoDecodedFeatures[iRow]) &&
+        !DecodeBatch(iBatch))
+    {
+        return nullptr;
+    }
+
+    return m_apoDecodedFeatures[iRow]->Clone();
+}
+
+/************************************************************************/
+/*                          GetFeatureCount()                           */
+/************************************************************************/
+
+GIntBig OGRMemColumnarLayer::GetFeatureCount(int bForce)
+{
+    if (!FlushPendingFeatures())
+        return -1;
+
+    if (m_poFilterGeom == nullptr && m_poAttrQuery == nullptr)
+        return m_nFeatureCount;
+
+    return OGRLayer::GetFeatureCount(bForce);
+}
+
+/************************************************************************/
+/*                             GetExtent()                              */
+/************************************************************************/
+
+OGRErr OGRMemColumnarLayer::GetExtent(int iGeomField, OGREnvelope *psExtent,
+                                      int bForce)
+{
+    if (!FlushPendingFeatures())
+        return OGRERR_FAILURE;
+
+    if (iGeomField >= 0 &&
+        iGeomField < static_cast<int>(m_abGeomFieldExtentKnown.size()) &&
+        m_abGeomFieldExtentKnown[iGeomField])
+    {
+        OGREnvelope sExtent;
+        for (const auto &poBatch : m_apoBatches)
+            sExtent.Merge(poBatch->asGeomFieldExtent[iGeomField]);
+        if (!sExtent.IsInit())
+            return OGRERR_FAILURE;
+        *psExtent = sExtent;
+        return OGRERR_NONE;
+    }
+
+    return OGRLayer::GetExtent(iGeomField, psExtent, bForce);
+}
+
+/************************************************************************/
+/*                            CreateField()                             */
+/************************************************************************/
+
+OGRErr OGRMemColumnarLayer::CreateField(const OGRFieldDefn *poField,
+                                        int /* bApproxOK */)
+{
+    if (m_eWriteMode != WriteMode::NONE)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Fields cannot be added to a columnar layer once features "
+                 "have been written");
+        return OGRERR_FAILURE;
+    }
+
+    whileUnsealing(m_poFeatureDefn)->AddFieldDefn(poField);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          CreateGeomField()                           */
+/************************************************************************/
+
+OGRErr OGRMemColumnarLayer::CreateGeomField(const OGRGeomFieldDefn *poGeomField,
+                                            int /* bApproxOK */)
+{
+    if (m_eWriteMode != WriteMode::NONE)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Geometry fields cannot be added to a columnar layer once "
+                 "features have been written");
+        return OGRERR_FAILURE;
+    }
+
+    whileUnsealing(m_poFeatureDefn)->AddGeomFieldDefn(poGeomField);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          BuildStreamSchema()                         */
+/************************************************************************/
+
+// Build the schema of the batches returned by GetArrowStream(), as well as
+// the indices of the stored child arrays they use. Returns false if the
+// options cannot be honoured without converting the stored arrays.
+bool OGRMemColumnarLayer::BuildStreamSchema(
+    CSLConstList papszOptions, struct ArrowSchema *out_schema,
+    std::vector<int> &anSelectedChildren)
+{
+    const char *pszGeomEncoding =
+        CSLFetchNameValue(papszOptions, "GEOMETRY_ENCODING");
+    if (pszGeomEncoding)
+    {
+        for (size_t i = 0; i < m_anGeomFieldChild.size(); ++i)
+        {
+            if (m_anGeomFieldChild[i] >= 0 &&
+                EQUAL(pszGeomEncoding, "WKB") != m_abGeomFieldExtentKnown[i])
+            {
+                return false;
+            }
+        }
+    }
+    const char *pszExtensionName =
+        EQUAL(CSLFetchNameValueDef(papszOptions, "GEOMETRY_METADATA_ENCODING",
+                                   "OGC"),
+              "GEOARROW")
+            ? EXTENSION_NAME_GEOARROW_WKB
+            : EXTENSION_NAME_OGC_WKB;
+
+    std::vector<struct ArrowSchema *> apsChildren;
+    anSelectedChildren.clear();
+    if (CPLTestBool(CSLFetchNameValueDef(papszOptions, "INCLUDE_FID", "YES")))
+    {
+        const char *pszFIDName = m_osFIDColumn.empty() ? DEFAULT_ARROW_FID_NAME
+                                                       : m_osFIDColumn.c_str();
+        struct ArrowSchema *psFIDSchema;
+        if (m_iFIDChild >= 0)
+        {
+            psFIDSchema = DuplicateArrowSchema(m_sSchema.children[m_iFIDChild]);
+            CPLFree(const_cast<char *>(psFIDSchema->name));
+        }
+        else
+        {
+            psFIDSchema = static_cast<struct ArrowSchema *>(
+                CPLCalloc(1, sizeof(struct ArrowSchema)));
+            psFIDSchema->format = CPLStrdup("l");
+            psFIDSchema->release = OGRMemColumnarReleaseSchema;
+        }
+        psFIDSchema->name = CPLStrdup(pszFIDName);
+        apsChildren.push_back(psFIDSchema);
+        anSelectedChildren.push_back(m_iFIDChild);
+    }
+
+    for (int i = 0; i < static_cast<int>(m_sSchema.n_children); ++i)
+    {
+        if (i == m_iFIDChild)
+            continue;
+        const auto psChild = m_sSchema.children[i];
+        const auto oIter =
+            std::find(m_anGeomFieldChild.begin(), m_anGeomFieldChild.end(), i);
+        if (oIter != m_anGeomFieldChild.end())
+        {
+            const int iGeomField =
+                static_cast<int>(oIter - m_anGeomFieldChild.begin());
+            const auto poGeomFieldDefn =
+                m_poFeatureDefn->GetGeomFieldDefn(iGeomField);
+            if (poGeomFieldDefn->IsIgnored())
+                continue;
+            if (m_abGeomFieldExtentKnown[iGeomField])
+            {
+                apsChildren.push_back(CreateSchemaForWKBGeometryColumn(
+                    poGeomFieldDefn, psChild->format, pszExtensionName));
+            }
+            else
+            {
+                apsChildren.push_back(DuplicateArrowSchema(psChild));
+            }
+        }
+        else
+        {
+            const int iField =
+                psChild->name ? m_poFeatureDefn->GetFieldIndex(psChild->name)
+                              : -1;
+            if (iField >= 0 &&
+                m_poFeatureDefn->GetFieldDefn(iField)->IsIgnored())
+            {
+                continue;
+            }
+            apsChildren.push_back(DuplicateArrowSchema(psChild));
+        }
+        anSelectedChildren.push_back(i);
+    }
+
+    memset(out_schema, 0, sizeof(*out_schema));
+    out_schema->format = CPLStrdup("+s");
+    out_schema->name = CPLStrdup("");
+    out_schema->n_children = static_cast<int64_t>(apsChildren.size());
+    out_schema->children = static_cast<struct ArrowSchema **>(
+        CPLCalloc(apsChildren.size() + 1, sizeof(struct ArrowSchema *)));
+    std::copy(apsChildren.begin(), apsChildren.end(), out_schema->children);
+    out_schema->release = OGRMemColumnarReleaseSchema;
+    return true;
+}
+
+/************************************************************************/
+/*                           GetArrowStream()                           */
+/************************************************************************/
+
+bool OGRMemColumnarLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
+                                         CSLConstList papszOptions)
+{
+    if (!FlushPendingFeatures())
+        return false;
+
+    if (!m_sSchema.release || CSLFetchNameValue(papszOptions, "TIMEZONE"))
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+
+    auto psPrivate = std::make_unique<OGRMemColumnarStreamPrivate>();
+    if (!BuildStreamSchema(papszOptions, &psPrivate->sSchema,
+                           psPrivate->anSelectedChildren))
+    {
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    }
+    if (m_poFilterGeom || m_poAttrQuery)
+    {
+        if (!CanPostFilterArrowArray(&psPrivate->sSchema))
+            return OGRLayer::GetArrowStream(out_stream, papszOptions);
+        psPrivate->bPostFilter = true;
+    }
+
+    psPrivate->poLayerRef = m_poSelfRef;
+    psPrivate->apoBatches = m_apoBatches;
+    psPrivate->aosOptions = CSLDuplicate(papszOptions);
+    psPrivate->nMaxFeaturesInBatch = static_cast<size_t>(std::max(
+        1, atoi(CSLFetchNameValueDef(papszOptions, "MAX_FEATURES_IN_BATCH",
+                                     "65536"))));
+
+    memset(out_stream, 0, sizeof(*out_stream));
+    out_stream->get_schema = StreamGetSchema;
+    out_stream->get_next = StreamGetNext;
+    out_stream->get_last_error = StreamGetLastError;
+    out_stream->release = StreamRelease;
+    out_stream->private_data = psPrivate.release();
+    return true;
+}
+
+/************************************************************************/
+/*                          StreamGetSchema()                           */
+/************************************************************************/
+
+int OGRMemColumnarLayer::StreamGetSchema(struct ArrowArrayStream *stream,
+                                         struct ArrowSchema *out_schema)
+{
+    const auto psPrivate =
+        static_cast<OGRMemColumnarStreamPrivate *>(stream->private_data);
+    DuplicateArrowSchema(&psPrivate->sSchema, out_schema);
+    return 0;
+}
+
+/************************************************************************/
+/*                           StreamGetNext()                            */
+/************************************************************************/
+
+int OGRMemColumnarLayer::StreamGetNext(struct ArrowArrayStream *stream,
+                                       struct ArrowArray *out_array)
+{
+    const auto psPrivate =
+        static_cast<OGRMemColumnarStreamPrivate *>(stream->private_data);
+    memset(out_array, 0, sizeof(*out_array));
+
+    OGRMemColumnarLayer *poLayer = *(psPrivate->poLayerRef);
+    if (psPrivate->bPostFilter && poLayer == nullptr)
+    {
+        psPrivate->osLastError =
+            "Calling get_next() on a freed OGRLayer is not supported";
+        CPLError(CE_Failure, CPLE_NotSupported, "%s",
+                 psPrivate->osLastError.c_str());
+        return EINVAL;
+    }
+
+    while (psPrivate->iBatch < psPrivate->apoBatches.size())
+    {
+        const auto &poBatch = psPrivate->apoBatches[psPrivate->iBatch];
+        const size_t nBatchLength = static_cast<size_t>(poBatch->sArray.length);
+        if (psPrivate->bPostFilter && psPrivate->iRowInBatch == 0 &&
+            !poLayer->BatchIntersectsSpatialFilter(*poBatch))
+        {
+            ++psPrivate->iBatch;
+            continue;
+        }
+
+        const size_t iStart = psPrivate->iRowInBatch;
+        const size_t nRows = std::min(psPrivate->nMaxFeaturesInBatch,
+                                      nBatchLength - iStart);
+        auto poCurBatch = poBatch;
+        psPrivate->iRowInBatch += nRows;
+        if (psPrivate->iRowInBatch == nBatchLength)
+        {
+            ++psPrivate->iBatch;
+            psPrivate->iRowInBatch = 0;
+        }
+
+        if (!BuildArrayView(poCurBatch, psPrivate->anSelectedChildren, iStart,
+                            nRows, out_array))
+        {
+            psPrivate->osLastError = "Out of memory";
+            return ENOMEM;
+        }
+        if (!psPrivate->bPostFilter)
+            return 0;
+
+        // The view shares its buffers with the layer, so filter a copy of it.
+        struct ArrowArray sFilteredArray;
+        const bool bOK = OGRCloneArrowArray(&psPrivate->sSchema, out_array,
+                                            &sFilteredArray);
+        out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+        if (!bOK)
+        {
+            psPrivate->osLastError = "Out of memory";
+            return ENOMEM;
+        }
+        poLayer->PostFilterArrowArray(&psPrivate->sSchema, &sFilteredArray,
+                                      psPrivate->aosOptions.List());
+        if (sFilteredArray.length == 0)
+        {
+            if (sFilteredArray.release)
+                sFilteredArray.release(&sFilteredArray);
+            continue;
+        }
+        memcpy(out_array, &sFilteredArray, sizeof(sFilteredArray));
+        return 0;
+    }
+
+    return 0;
+}
+
+/************************************************************************/
+/*                         StreamGetLastError()                         */
+/************************************************************************/
+
+const char *
+OGRMemColumnarLayer::StreamGetLastError(struct ArrowArrayStream *stream)
+{
+    const auto psPrivate =
+        static_cast<OGRMemColumnarStreamPrivate *>(stream->private_data);
+    return psPrivate->osLastError.empty() ? nullptr
+                                          : psPrivate->osLastError.c_str();
+}
+
+/************************************************************************/
+/*                           StreamRelease()                            */
+/************************************************************************/
+
+void OGRMemColumnarLayer::StreamRelease(struct ArrowArrayStream *stream)
+{
+    delete static_cast<OGRMemColumnarStreamPrivate *>(stream->private_data);
+    stream->private_data = nullptr;
+    stream->release = nullptr;
+}
+
+/************************************************************************/
+/*                           TestCapability()                           */
+/************************************************************************/
+
+int OGRMemColumnarLayer::TestCapability(const char *pszCap)
+{
+    if (EQUAL(pszCap, OLCFastFeatureCount))
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr;
+
+    if (EQUAL(pszCap, OLCFastGetExtent))
+        return !m_abGeomFieldExtentKnown.empty() && m_abGeomFieldExtentKnown[0];
+
+    if (EQUAL(pszCap, OLCCreateField) || EQUAL(pszCap, OLCCreateGeomField))
+        return m_eWriteMode == WriteMode::NONE;
+
+    if (EQUAL(pszCap, OLCRandomRead) || EQUAL(pszCap, OLCSequentialWrite) ||
+        EQUAL(pszCap, OLCFastGetArrowStream) ||
+        EQUAL(pszCap, OLCFastWriteArrowBatch) ||
+        EQUAL(pszCap, OLCIgnoreFields) || EQUAL(pszCap, OLCStringsAsUTF8) ||
+        EQUAL(pszCap, OLCCurveGeometries) ||
+        EQUAL(pszCap, OLCMeasuredGeometries) || EQUAL(pszCap, OLCZGeometries))
+    {
+        return TRUE;
+    }
+
+    return FALSE;
+}
@@ -81,21 +81,39 @@ OGRMemDataSource::ICreateLayer(const char *pszLayerName,
         poSRS = poSRSIn->Clone();
         poSRS->SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
     }
-    OGRMemLayer *poLayer = new OGRMemLayer(pszLayerName, poSRS, eType);
-    if (poSRS)
+    OGRLayer *poLayer = nullptr;
+    if (CPLFetchBool(papszOptions, "COLUMNAR", false))
     {
-        poSRS->Release();
+        auto poColumnarLayer =
+            new OGRMemColumnarLayer(pszLayerName, poSRS, eType);
+        poColumnarLayer->SetDataset(this);
+        poColumnarLayer->SetFIDColumn(
+            CSLFetchNameValueDef(papszOptions, "FID", ""));
+        poLayer = poColumnarLayer;
     }
+    else
+    {
+        auto poMemLayer = new OGRMemLayer(pszLayerName, poSRS, eType);
 
-    if (CPLFetchBool(papszOptions, "ADVERTIZE_UTF8", false))
-        poLayer->SetAdvertizeUTF8(true);
+        if (CPLFetchBool(papszOptions, "ADVERTIZE_UTF8", false))
+            poMemLayer->SetAdvertizeUTF8(true);
 
-    poLayer->SetDataset(this);
-    poLayer->SetFIDColumn(CSLFetchNameValueDef(papszOptions, "FID", ""));
+        if (!CPLFetchBool(papszOptions, "SPATIAL_INDEX", true))
+            poMemLayer->SetSpatialIndexEnabled(false);
+
+        poMemLayer->SetDataset(this);
+        poMemLayer->SetFIDColumn(
+            CSLFetchNameValueDef(papszOptions, "FID", ""));
+        poLayer = poMemLayer;
+    }
+    if (poSRS)
+    {
+        poSRS->Release();
+    }
 
     // Add layer to data source layer list.
-    papoLayers = static_cast<OGRMemLayer **>(
-        CPLRealloc(papoLayers, sizeof(OGRMemLayer *) * (nLayers + 1)));
+    papoLayers = static_cast<OGRLayer **>(
+        CPLRealloc(papoLayers, sizeof(OGRLayer *) * (nLayers + 1)));
 
     papoLayers[nLayers++] = poLayer;
 
@@ -203,7 +221,7 @@ bool OGRMemDataSource::DeleteFieldDomain(const std::string &name,
 
     for (int i = 0; i < nLayers; i++)
     {
-        OGRMemLayer *poLayer = papoLayers[i];
+        OGRLayer *poLayer = papoLayers[i];
         for (int j = 0; j < poLayer->GetLayerDefn()->GetFieldCount(); ++j)
         {
             OGRFieldDefn *poFieldDefn =
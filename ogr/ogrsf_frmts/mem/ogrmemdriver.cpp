@@ -125,6 +125,11 @@ void RegisterOGRMEM()
         "the layer will contain UTF-8 strings' default='NO'/>"
         "  <Option name='FID' type='string' description="
         "'Name of the FID column to create' default='' />"
+        "  <Option name='SPATIAL_INDEX' type='boolean' description="
+        "'Whether to build an in-memory spatial index on the first spatially "
+        "filtered read' default='YES'/>"
+        "  <Option name='COLUMNAR' type='boolean' description="
+        "'Whether features should be stored as Arrow arrays' default='NO'/>"
         "</LayerCreationOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DCAP_COORDINATE_EPOCH, "YES");
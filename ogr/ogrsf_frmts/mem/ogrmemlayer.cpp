@@ -30,17 +30,24 @@
 #include "cpl_port.h"
 #include "ogr_mem.h"
 
+#include <climits>
 #include <cstddef>
 #include <cstring>
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <new>
+#include <set>
+#include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_vsi.h"
 #include "ogr_api.h"
+#include "ogr_attrind.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
@@ -62,6 +69,429 @@ class IOGRMemLayerFeatureIterator
     virtual OGRFeature *Next() = 0;
 };
 
+/************************************************************************/
+/*                            OGRMemAttrIndex                           */
+/*                                                                      */
+/*      Hash index of the values of an attribute field.                 */
+/************************************************************************/
+
+class OGRMemAttrIndex final : public OGRAttrIndex
+{
+    const OGRFieldType m_eType;
+    std::unordered_map<std::string, std::set<GIntBig>> m_oMap{};
+
+    bool BuildKey(const OGRField *psKey, std::string &osKey) const;
+
+  public:
+    explicit OGRMemAttrIndex(OGRFieldType eType) : m_eType(eType)
+    {
+    }
+
+    static bool IsSupportedType(OGRFieldType eType)
+    {
+        return eType == OFTInteger || eType == OFTInteger64 ||
+               eType == OFTReal || eType == OFTString;
+    }
+
+    GIntBig GetFirstMatch(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList, int *nFIDCount,
+                           int *nLength) override;
+
+    OGRErr AddEntry(OGRField *psKey, GIntBig nFID) override;
+    OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) override;
+
+    OGRErr Clear() override;
+};
+
+/************************************************************************/
+/*                              BuildKey()                              */
+/************************************************************************/
+
+bool OGRMemAttrIndex::BuildKey(const OGRField *psKey, std::string &osKey) const
+{
+    switch (m_eType)
+    {
+        case OFTInteger:
+        {
+            const GIntBig nVal = psKey->Integer;
+            osKey.assign(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+            return true;
+        }
+
+        case OFTInteger64:
+        {
+            const GIntBig nVal = psKey->Integer64;
+            osKey.assign(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+            return true;
+        }
+
+        case OFTReal:
+        {
+            // So that 0.0 and -0.0 have the same key
+            const double dfVal = psKey->Real == 0 ? 0.0 : psKey->Real;
+            osKey.assign(reinterpret_cast<const char *>(&dfVal), sizeof(dfVal));
+            return true;
+        }
+
+        case OFTString:
+            if (psKey->String == nullptr)
+                return false;
+            // String equality is case insensitive in OGR SQL
+            osKey = CPLString(psKey->String).toupper();
+            return true;
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                           GetFirstMatch()                            */
+/************************************************************************/
+
+GIntBig OGRMemAttrIndex::GetFirstMatch(OGRField *psKey)
+{
+    std::string osKey;
+    if (!BuildKey(psKey, osKey))
+        return OGRNullFID;
+    const auto oIter = m_oMap.find(osKey);
+    if (oIter == m_oMap.end())
+        return OGRNullFID;
+    return *(oIter->second.begin());
+}
+
+/************************************************************************/
+/*                           GetAllMatches()                            */
+/************************************************************************/
+
+GIntBig *OGRMemAttrIndex::GetAllMatches(OGRField *psKey, GIntBig *panFIDList,
+                                        int *nFIDCount, int *nLength)
+{
+    if (panFIDList == nullptr)
+    {
+        panFIDList = static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig) * 2));
+        *nFIDCount = 0;
+        *nLength = 2;
+    }
+
+    std::string osKey;
+    if (BuildKey(psKey, osKey))
+    {
+        const auto oIter = m_oMap.find(osKey);
+        if (oIter != m_oMap.end())
+        {
+            for (const GIntBig nFID : oIter->second)
+            {
+                if (*nFIDCount >= *nLength - 1)
+                {
+                    *nLength = (*nLength) * 2 + 10;
+                    panFIDList = static_cast<GIntBig *>(
+                        CPLRealloc(panFIDList, sizeof(GIntBig) * (*nLength)));
+                }
+                panFIDList[(*nFIDCount)++] = nFID;
+            }
+        }
+    }
+
+    panFIDList[*nFIDCount] = OGRNullFID;
+
+    return panFIDList;
+}
+
+GIntBig *OGRMemAttrIndex::GetAllMatches(OGRField *psKey)
+{
+    int nFIDCount = 0;
+    int nLength = 0;
+    return GetAllMatches(psKey, nullptr, &nFIDCount, &nLength);
+}
+
+/************************************************************************/
+/*                              AddEntry()                              */
+/************************************************************************/
+
+OGRErr OGRMemAttrIndex::AddEntry(OGRField *psKey, GIntBig nFID)
+{
+    std::string osKey;
+    if (!BuildKey(psKey, osKey))
+        return OGRERR_NONE;
+    try
+    {
+        m_oMap[osKey].insert(nFID);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate memory");
+        return OGRERR_NOT_ENOUGH_MEMORY;
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                            RemoveEntry()                             */
+/************************************************************************/
+
+OGRErr OGRMemAttrIndex::RemoveEntry(OGRField *psKey, GIntBig nFID)
+{
+    std::string osKey;
+    if (!BuildKey(psKey, osKey))
+        return OGRERR_NONE;
+    auto oIter = m_oMap.find(osKey);
+    if (oIter != m_oMap.end())
+    {
+        oIter->second.erase(nFID);
+        if (oIter->second.empty())
+            m_oMap.erase(oIter);
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                               Clear()                                */
+/************************************************************************/
+
+OGRErr OGRMemAttrIndex::Clear()
+{
+    m_oMap.clear();
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                         OGRMemLayerAttrIndex                         */
+/*                                                                      */
+/*      Attribute indexes of a OGRMemLayer, created with the            */
+/*      CREATE INDEX ON layer USING field SQL statement.                */
+/************************************************************************/
+
+class OGRMemLayerAttrIndex final : public OGRLayerAttrIndex
+{
+    std::map<int, std::unique_ptr<OGRMemAttrIndex>> m_oMapIndices{};
+
+    OGRMemLayer *GetMemLayer()
+    {
+        return cpl::down_cast<OGRMemLayer *>(poLayer);
+    }
+
+  public:
+    explicit OGRMemLayerAttrIndex(OGRMemLayer *poLayerIn)
+    {
+        poLayer = poLayerIn;
+    }
+
+    OGRErr Initialize(const char *, OGRLayer *) override
+    {
+        return OGRERR_NONE;
+    }
+
+    OGRErr CreateIndex(int iField) override;
+    OGRErr DropIndex(int iField) override;
+    OGRErr IndexAllFeatures(int iField = -1) override;
+
+    OGRErr AddToIndex(OGRFeature *poFeature, int iField = -1) override;
+    OGRErr RemoveFromIndex(OGRFeature *poFeature) override;
+
+    OGRAttrIndex *GetFieldIndex(int iField) override;
+
+    bool IsEmpty() const
+    {
+        return m_oMapIndices.empty();
+    }
+
+    void OnFieldDeleted(int iField);
+    void OnFieldsReordered(const int *panMap);
+    void OnFieldTypeChanged(int iField);
+};
+
+/************************************************************************/
+/*                            CreateIndex()                             */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::CreateIndex(int iField)
+{
+    const OGRFeatureDefn *poFDefn = poLayer->GetLayerDefn();
+    if (iField < 0 || iField >= poFDefn->GetFieldCount())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid field index");
+        return OGRERR_FAILURE;
+    }
+
+    const OGRFieldDefn *poFieldDefn = poFDefn->GetFieldDefn(iField);
+    if (m_oMapIndices.find(iField) != m_oMapIndices.end())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "It seems we already have an index for field %d/%s "
+                 "of layer %s.",
+                 iField, poFieldDefn->GetNameRef(), poLayer->GetName());
+        return OGRERR_FAILURE;
+    }
+
+    if (!OGRMemAttrIndex::IsSupportedType(poFieldDefn->GetType()))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Indexing not supported for field %s of type %s.",
+                 poFieldDefn->GetNameRef(),
+                 OGRFieldDefn::GetFieldTypeName(poFieldDefn->GetType()));
+        return OGRERR_FAILURE;
+    }
+
+    m_oMapIndices[iField] =
+        std::make_unique<OGRMemAttrIndex>(poFieldDefn->GetType());
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             DropIndex()                              */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::DropIndex(int iField)
+{
+    const auto oIter = m_oMapIndices.find(iField);
+    if (oIter == m_oMapIndices.end())
+    {
+        const OGRFeatureDefn *poFDefn = poLayer->GetLayerDefn();
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "DROP INDEX on field (%s) that doesn't have an index.",
+                 iField >= 0 && iField < poFDefn->GetFieldCount()
+                     ? poFDefn->GetFieldDefn(iField)->GetNameRef()
+                     : "");
+        return OGRERR_FAILURE;
+    }
+    m_oMapIndices.erase(oIter);
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          IndexAllFeatures()                          */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::IndexAllFeatures(int iField)
+{
+    // Iterate over the internal features, so that filters are ignored and
+    // features are not cloned.
+    auto poIter = std::unique_ptr<IOGRMemLayerFeatureIterator>(
+        GetMemLayer()->GetIterator());
+    while (OGRFeature *poFeature = poIter->Next())
+    {
+        const OGRErr eErr = AddToIndex(poFeature, iField);
+        if (eErr != OGRERR_NONE)
+            return eErr;
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             AddToIndex()                             */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::AddToIndex(OGRFeature *poFeature, int iTargetField)
+{
+    for (auto &oIter : m_oMapIndices)
+    {
+        const int iField = oIter.first;
+        if (iTargetField != -1 && iTargetField != iField)
+            continue;
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            continue;
+        const OGRErr eErr = oIter.second->AddEntry(
+            poFeature->GetRawFieldRef(iField), poFeature->GetFID());
+        if (eErr != OGRERR_NONE)
+            return eErr;
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          RemoveFromIndex()                           */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::RemoveFromIndex(OGRFeature *poFeature)
+{
+    for (auto &oIter : m_oMapIndices)
+    {
+        const int iField = oIter.first;
+        if (!poFeature->IsFieldSetAndNotNull(iField))
+            continue;
+        oIter.second->RemoveEntry(poFeature->GetRawFieldRef(iField),
+                                  poFeature->GetFID());
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           GetFieldIndex()                            */
+/************************************************************************/
+
+OGRAttrIndex *OGRMemLayerAttrIndex::GetFieldIndex(int iField)
+{
+    const auto oIter = m_oMapIndices.find(iField);
+    return oIter == m_oMapIndices.end() ? nullptr : oIter->second.get();
+}
+
+/************************************************************************/
+/*                           OnFieldDeleted()                           */
+/************************************************************************/
+
+void OGRMemLayerAttrIndex::OnFieldDeleted(int iField)
+{
+    std::map<int, std::unique_ptr<OGRMemAttrIndex>> oNewMap;
+    for (auto &oIter : m_oMapIndices)
+    {
+        if (oIter.first < iField)
+            oNewMap[oIter.first] = std::move(oIter.second);
+        else if (oIter.first > iField)
+            oNewMap[oIter.first - 1] = std::move(oIter.second);
+    }
+    m_oMapIndices = std::move(oNewMap);
+}
+
+/************************************************************************/
+/*                         OnFieldsReordered()                          */
+/************************************************************************/
+
+// panMap[iNewIdx] = iOldIdx, as for OGRFeatureDefn::ReorderFieldDefns()
+void OGRMemLayerAttrIndex::OnFieldsReordered(const int *panMap)
+{
+    std::map<int, std::unique_ptr<OGRMemAttrIndex>> oNewMap;
+    const int nFieldCount = poLayer->GetLayerDefn()->GetFieldCount();
+    for (int iNew = 0; iNew < nFieldCount; ++iNew)
+    {
+        auto oIter = m_oMapIndices.find(panMap[iNew]);
+        if (oIter != m_oMapIndices.end())
+            oNewMap[iNew] = std::move(oIter->second);
+    }
+    m_oMapIndices = std::move(oNewMap);
+}
+
+/************************************************************************/
+/*                         OnFieldTypeChanged()                         */
+/************************************************************************/
+
+// Must be called after the field definition has been updated.
+void OGRMemLayerAttrIndex::OnFieldTypeChanged(int iField)
+{
+    const auto oIter = m_oMapIndices.find(iField);
+    if (oIter == m_oMapIndices.end())
+        return;
+    m_oMapIndices.erase(oIter);
+
+    const OGRFieldDefn *poFieldDefn =
+        poLayer->GetLayerDefn()->GetFieldDefn(iField);
+    if (OGRMemAttrIndex::IsSupportedType(poFieldDefn->GetType()))
+    {
+        if (CreateIndex(iField) == OGRERR_NONE &&
+            IndexAllFeatures(iField) != OGRERR_NONE)
+        {
+            m_oMapIndices.erase(iField);
+        }
+    }
+    else
+    {
+        CPLDebug("Mem", "Dropping index on field %s of layer %s",
+                 poFieldDefn->GetNameRef(), poLayer->GetName());
+    }
+}
+
 /************************************************************************/
 /*                            OGRMemLayer()                             */
 /************************************************************************/
@@ -85,6 +515,8 @@ OGRMemLayer::OGRMemLayer(const char *pszName,
 
     m_oMapFeaturesIter = m_oMapFeatures.begin();
     m_poFeatureDefn->Seal(/* bSealFields = */ true);
+
+    m_poAttrIndex = new OGRMemLayerAttrIndex(this);
 }
 
 /************************************************************************/
@@ -100,6 +532,8 @@ OGRMemLayer::~OGRMemLayer()
                  m_nFeaturesRead, m_poFeatureDefn->GetName());
     }
 
+    InvalidateSpatialIndex();
+
     if (m_papoFeatures != nullptr)
     {
         for (GIntBig i = 0; i < m_nMaxFeatureCount; i++)
@@ -123,6 +557,7 @@ void OGRMemLayer::ResetReading()
 {
     m_iNextReadFID = 0;
     m_oMapFeaturesIter = m_oMapFeatures.begin();
+    m_bCandidateFIDsComputed = false;
 }
 
 /************************************************************************/
@@ -132,10 +567,23 @@ void OGRMemLayer::ResetReading()
 OGRFeature *OGRMemLayer::GetNextFeature()
 
 {
+    if (!m_bCandidateFIDsComputed)
+        ComputeCandidateFIDs();
+
     while (true)
     {
         OGRFeature *poFeature = nullptr;
-        if (m_papoFeatures)
+        if (m_bUseCandidateFIDs)
+        {
+            if (m_iNextCandidateFID >= m_anCandidateFIDs.size())
+                return nullptr;
+            // The feature may have been deleted in the meantime
+            poFeature =
+                GetFeatureRef(m_anCandidateFIDs[m_iNextCandidateFID++]);
+            if (poFeature == nullptr)
+                continue;
+        }
+        else if (m_papoFeatures)
         {
             if (m_iNextReadFID >= m_nMaxFeatureCount)
                 return nullptr;
@@ -309,6 +757,7 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
         }
         catch (const std::bad_alloc &)
         {
+            InvalidateSpatialIndex();
             m_oMapFeatures.clear();
             m_oMapFeaturesIter = m_oMapFeatures.end();
             CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate memory");
@@ -366,6 +815,7 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
 
         if (m_papoFeatures[nFID] != nullptr)
         {
+            RemoveFromIndices(m_papoFeatures[nFID]);
             delete m_papoFeatures[nFID];
             m_papoFeatures[nFID] = nullptr;
         }
@@ -375,21 +825,26 @@ OGRErr OGRMemLayer::ISetFeature(OGRFeature *poFeature)
         }
 
         m_papoFeatures[nFID] = poFeatureCloned.release();
+        AddToIndices(m_papoFeatures[nFID]);
     }
     else
     {
         FeatureIterator oIter = m_oMapFeatures.find(nFID);
         if (oIter != m_oMapFeatures.end())
         {
+            RemoveFromIndices(oIter->second.get());
             oIter->second = std::move(poFeatureCloned);
+            AddToIndices(oIter->second.get());
         }
         else
         {
             try
             {
+                OGRFeature *poNewFeature = poFeatureCloned.get();
                 m_oMapFeatures[nFID] = std::move(poFeatureCloned);
                 m_oMapFeaturesIter = m_oMapFeatures.end();
                 m_nFeatureCount++;
+                AddToIndices(poNewFeature);
             }
             catch (const std::bad_alloc &)
             {
@@ -481,6 +936,8 @@ OGRErr OGRMemLayer::IUpdateFeature(OGRFeature *poFeature,
     if (!poFeatureRef)
         return OGRERR_NON_EXISTING_FEATURE;
 
+    RemoveFromIndices(poFeatureRef);
+
     for (int i = 0; i < nUpdatedFieldsCount; ++i)
     {
         poFeatureRef->SetField(
@@ -497,6 +954,9 @@ OGRErr OGRMemLayer::IUpdateFeature(OGRFeature *poFeature,
     {
         poFeatureRef->SetStyleString(poFeature->GetStyleString());
     }
+
+    AddToIndices(poFeatureRef);
+
     return OGRERR_NONE;
 }
 
@@ -521,6 +981,7 @@ OGRErr OGRMemLayer::DeleteFeature(GIntBig nFID)
         {
             return OGRERR_FAILURE;
         }
+        RemoveFromIndices(m_papoFeatures[nFID]);
         delete m_papoFeatures[nFID];
         m_papoFeatures[nFID] = nullptr;
     }
@@ -531,6 +992,7 @@ OGRErr OGRMemLayer::DeleteFeature(GIntBig nFID)
         {
             return OGRERR_FAILURE;
         }
+        RemoveFromIndices(oIter->second.get());
         m_oMapFeatures.erase(oIter);
     }
 
@@ -542,6 +1004,240 @@ OGRErr OGRMemLayer::DeleteFeature(GIntBig nFID)
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                      SetSpatialIndexEnabled()                        */
+/************************************************************************/
+
+void OGRMemLayer::SetSpatialIndexEnabled(bool bEnabled)
+{
+    m_bSpatialIndexEnabled = bEnabled;
+    if (!bEnabled)
+        InvalidateSpatialIndex();
+    m_bCandidateFIDsComputed = false;
+}
+
+/************************************************************************/
+/*                          GetMemAttrIndex()                           */
+/************************************************************************/
+
+OGRMemLayerAttrIndex *OGRMemLayer::GetMemAttrIndex()
+{
+    return cpl::down_cast<OGRMemLayerAttrIndex *>(m_poAttrIndex);
+}
+
+/************************************************************************/
+/*                         GetFeatureBounds()                           */
+/************************************************************************/
+
+static bool GetFeatureBounds(const OGRFeature *poFeature, int iGeomField,
+                             CPLRectObj &sRect)
+{
+    const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeomField);
+    if (poGeom == nullptr || poGeom->IsEmpty())
+        return false;
+    OGREnvelope sEnvelope;
+    poGeom->getEnvelope(&sEnvelope);
+    sRect.minx = sEnvelope.MinX;
+    sRect.miny = sEnvelope.MinY;
+    sRect.maxx = sEnvelope.MaxX;
+    sRect.maxy = sEnvelope.MaxY;
+    return true;
+}
+
+/************************************************************************/
+/*                         BuildSpatialIndex()                          */
+/************************************************************************/
+
+void OGRMemLayer::BuildSpatialIndex()
+{
+    InvalidateSpatialIndex();
+
+    const int iGeomField = m_iGeomFieldFilter;
+    std::vector<std::pair<OGRFeature *, CPLRectObj>> aoFeatures;
+    OGREnvelope sGlobalEnvelope;
+    try
+    {
+        auto poIter =
+            std::unique_ptr<IOGRMemLayerFeatureIterator>(GetIterator());
+        while (OGRFeature *poFeature = poIter->Next())
+        {
+            CPLRectObj sRect;
+            if (!GetFeatureBounds(poFeature, iGeomField, sRect))
+                continue;
+            sGlobalEnvelope.Merge(sRect.minx, sRect.miny);
+            sGlobalEnvelope.Merge(sRect.maxx, sRect.maxy);
+            aoFeatures.emplace_back(poFeature, sRect);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLDebug("Mem", "Not enough memory to build spatial index of %s",
+                 GetName());
+        return;
+    }
+
+    if (sGlobalEnvelope.IsInit())
+    {
+        m_sSpatialIndexBounds.minx = sGlobalEnvelope.MinX;
+        m_sSpatialIndexBounds.miny = sGlobalEnvelope.MinY;
+        m_sSpatialIndexBounds.maxx = sGlobalEnvelope.MaxX;
+        m_sSpatialIndexBounds.maxy = sGlobalEnvelope.MaxY;
+    }
+    else
+    {
+        m_sSpatialIndexBounds = CPLRectObj();
+    }
+    m_hSpatialIndex = CPLQuadTreeCreate(&m_sSpatialIndexBounds, nullptr);
+    const int nFeatures = static_cast<int>(
+        std::min<size_t>(INT_MAX, std::max<size_t>(1, aoFeatures.size())));
+    CPLQuadTreeSetMaxDepth(m_hSpatialIndex,
+                           CPLQuadTreeGetAdvisedMaxDepth(nFeatures));
+    for (auto &oPair : aoFeatures)
+    {
+        CPLQuadTreeInsertWithBounds(m_hSpatialIndex, oPair.first,
+                                    &oPair.second);
+    }
+    m_iSpatialIndexGeomField = iGeomField;
+}
+
+/************************************************************************/
+/*                       InvalidateSpatialIndex()                       */
+/************************************************************************/
+
+void OGRMemLayer::InvalidateSpatialIndex()
+{
+    if (m_hSpatialIndex)
+    {
+        CPLQuadTreeDestroy(m_hSpatialIndex);
+        m_hSpatialIndex = nullptr;
+    }
+    m_iSpatialIndexGeomField = -1;
+}
+
+/************************************************************************/
+/*                            AddToIndices()                            */
+/************************************************************************/
+
+void OGRMemLayer::AddToIndices(OGRFeature *poFeature)
+{
+    if (!GetMemAttrIndex()->IsEmpty())
+        m_poAttrIndex->AddToIndex(poFeature);
+
+    CPLRectObj sRect;
+    if (m_hSpatialIndex &&
+        GetFeatureBounds(poFeature, m_iSpatialIndexGeomField, sRect))
+    {
+        if (sRect.minx >= m_sSpatialIndexBounds.minx &&
+            sRect.miny >= m_sSpatialIndexBounds.miny &&
+            sRect.maxx <= m_sSpatialIndexBounds.maxx &&
+            sRect.maxy <= m_sSpatialIndexBounds.maxy)
+        {
+            CPLQuadTreeInsertWithBounds(m_hSpatialIndex, poFeature, &sRect);
+        }
+        else
+        {
+            // Features outside of the extent of the quad tree would all end
+            // up in its root node. Rather rebuild it the next time it is
+            // needed.
+            InvalidateSpatialIndex();
+        }
+    }
+}
+
+/************************************************************************/
+/*                         RemoveFromIndices()                          */
+/************************************************************************/
+
+void OGRMemLayer::RemoveFromIndices(OGRFeature *poFeature)
+{
+    if (!GetMemAttrIndex()->IsEmpty())
+        m_poAttrIndex->RemoveFromIndex(poFeature);
+
+    CPLRectObj sRect;
+    if (m_hSpatialIndex &&
+        GetFeatureBounds(poFeature, m_iSpatialIndexGeomField, sRect))
+    {
+        CPLQuadTreeRemove(m_hSpatialIndex, poFeature, &sRect);
+    }
+}
+
+/************************************************************************/
+/*                        ComputeCandidateFIDs()                        */
+/*                                                                      */
+/*      Utilize the spatial and attribute indices to restrict the       */
+/*      features that GetNextFeature() must evaluate.                   */
+/************************************************************************/
+
+void OGRMemLayer::ComputeCandidateFIDs()
+{
+    m_bCandidateFIDsComputed = true;
+    m_bUseCandidateFIDs = false;
+    m_anCandidateFIDs.clear();
+    m_iNextCandidateFID = 0;
+
+    GIntBig *panMatchingFIDs = nullptr;
+    if (m_poAttrQuery != nullptr && !GetMemAttrIndex()->IsEmpty())
+        panMatchingFIDs = m_poAttrQuery->EvaluateAgainstIndices(this, nullptr);
+
+    if (m_poFilterGeom != nullptr && m_bSpatialIndexEnabled &&
+        (m_hSpatialIndex == nullptr ||
+         m_iSpatialIndexGeomField != m_iGeomFieldFilter))
+    {
+        BuildSpatialIndex();
+    }
+
+    try
+    {
+        if (m_poFilterGeom != nullptr && m_hSpatialIndex != nullptr)
+        {
+            CPLRectObj sAoi;
+            sAoi.minx = m_sFilterEnvelope.MinX;
+            sAoi.miny = m_sFilterEnvelope.MinY;
+            sAoi.maxx = m_sFilterEnvelope.MaxX;
+            sAoi.maxy = m_sFilterEnvelope.MaxY;
+            int nCount = 0;
+            void **pahFeatures =
+                CPLQuadTreeSearch(m_hSpatialIndex, &sAoi, &nCount);
+            m_anCandidateFIDs.reserve(nCount);
+            for (int i = 0; i < nCount; ++i)
+            {
+                m_anCandidateFIDs.push_back(
+                    static_cast<const OGRFeature *>(pahFeatures[i])->GetFID());
+            }
+            CPLFree(pahFeatures);
+            // Return features in the same order as without index
+            std::sort(m_anCandidateFIDs.begin(), m_anCandidateFIDs.end());
+
+            if (panMatchingFIDs != nullptr)
+            {
+                GIntBig nMatchingCount = 0;
+                while (panMatchingFIDs[nMatchingCount] != OGRNullFID)
+                    ++nMatchingCount;
+                const auto oEnd = std::set_intersection(
+                    m_anCandidateFIDs.begin(), m_anCandidateFIDs.end(),
+                    panMatchingFIDs, panMatchingFIDs + nMatchingCount,
+                    m_anCandidateFIDs.begin());
+                m_anCandidateFIDs.erase(oEnd, m_anCandidateFIDs.end());
+            }
+            m_bUseCandidateFIDs = true;
+        }
+        else if (panMatchingFIDs != nullptr)
+        {
+            for (GIntBig i = 0; panMatchingFIDs[i] != OGRNullFID; ++i)
+                m_anCandidateFIDs.push_back(panMatchingFIDs[i]);
+            m_bUseCandidateFIDs = true;
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        // Fallback to a full scan
+        m_anCandidateFIDs.clear();
+        m_bUseCandidateFIDs = false;
+    }
+
+    CPLFree(panMatchingFIDs);
+}
+
 /************************************************************************/
 /*                          GetFeatureCount()                           */
 /*                                                                      */
@@ -686,6 +1382,8 @@ OGRErr OGRMemLayer::DeleteField(int iField)
 
     m_bUpdated = true;
 
+    GetMemAttrIndex()->OnFieldDeleted(iField);
+
     return whileUnsealing(m_poFeatureDefn)->DeleteFieldDefn(iField);
 }
 
@@ -716,6 +1414,8 @@ OGRErr OGRMemLayer::ReorderFields(int *panMap)
 
     m_bUpdated = true;
 
+    GetMemAttrIndex()->OnFieldsReordered(panMap);
+
     return whileUnsealing(m_poFeatureDefn)->ReorderFieldDefns(panMap);
 }
 
@@ -849,6 +1549,8 @@ OGRErr OGRMemLayer::AlterFieldDefn(int iField, OGRFieldDefn *poNewFieldDefn,
         poFieldDefn->SetSubType(OFSTNone);
         poFieldDefn->SetType(poNewFieldDefn->GetType());
         poFieldDefn->SetSubType(poNewFieldDefn->GetSubType());
+
+        GetMemAttrIndex()->OnFieldTypeChanged(iField);
     }
 
     if (nFlagsIn & ALTER_NAME_FLAG)
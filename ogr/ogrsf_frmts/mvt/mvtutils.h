@@ -32,6 +32,10 @@
 #include "cpl_json.h"
 #include "ogrsf_frmts.h"
 
+#include <cstdint>
+#include <memory>
+#include <string>
+
 #define MVT_LCO                                                                \
     "<LayerCreationOptionList>"                                                \
     "  <Option name='MINZOOM' type='int' min='0' max='22' "                    \
@@ -65,7 +69,10 @@
     "description='Maximum size of a tile in bytes'/>"                          \
     "  <Option name='MAX_FEATURES' scope='vector' type='unsigned int' "        \
     "min='1' default='200000' "                                                \
-    "description='Maximum number of features per tile'/>"
+    "description='Maximum number of features per tile'/>"                      \
+    "  <Option name='TEMPORARY_MEMORY_LIMIT' scope='vector' type='float' "     \
+    "description='Maximum size in MB of the in-memory temporary store, "       \
+    "before spilling to the temporary database'/>"
 
 #define MVT_MBTILES_COMMON_DSCO                                                \
     MVT_MBTILES_PMTILES_COMMON_DSCO                                            \
@@ -94,6 +101,31 @@ OGRFeature *OGRMVTCreateFeatureFrom(OGRFeature *poSrcFeature,
 GDALDataset *OGRMVTWriterDatasetCreate(const char *pszFilename, int nXSize,
                                        int nYSize, int nBandsIn,
                                        GDALDataType eDT, char **papszOptions);
+
+/** Receives the tiles generated by the MVT writer, instead of them being
+ * written into a directory or a MBTiles file.
+ */
+class OGRMVTWriterTileSink
+{
+  public:
+    virtual ~OGRMVTWriterTileSink();
+
+    /** Returns the rank of a tile. Tiles are passed to WriteTile() by
+     * ascending rank. */
+    virtual uint64_t GetTileRank(int nZ, int nX, int nY) const = 0;
+
+    /** Receives a (GZip compressed) tile. nY=0 is the top-most row. */
+    virtual bool WriteTile(int nZ, int nX, int nY,
+                           const std::string &osTileData) = 0;
+
+    /** Receives the metadata items (the ones of the MBTiles metadata table),
+     * once all tiles have been written. */
+    virtual bool WriteMetadata(const CPLJSONObject &oMetadata) = 0;
+};
+
+GDALDataset *OGRMVTWriterDatasetCreateWithTileSink(
+    const char *pszFilename, char **papszOptions,
+    std::unique_ptr<OGRMVTWriterTileSink> poSink);
 // #endif
 
 #endif  // MVTUTILS_H
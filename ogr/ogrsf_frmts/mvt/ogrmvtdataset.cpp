@@ -77,7 +77,9 @@ constexpr int knMAX_FILES_PER_DIR = 10000;
 
 #include "cpl_worker_thread_pool.h"
 
+#include <limits>
 #include <mutex>
+#include <tuple>
 
 // Limitations from https://github.com/mapbox/mapbox-geostats
 constexpr size_t knMAX_COUNT_LAYERS = 1000;
@@ -3292,6 +3294,18 @@ class OGRMVTWriterDataset final : public GDALDataset
         std::set<CPLString> m_oSetFields;
     };
 
+    // Feature pre-generated for a tile, as stored in the temporary store
+    struct MVTTempFeature
+    {
+        GIntBig nSerial = 0;
+        std::string osBlob{};
+        int nGeomType = 0;
+        double dfAreaOrLength = 0;
+    };
+
+    // Pre-generated features of a tile, per target layer name
+    typedef std::map<CPLString, std::vector<MVTTempFeature>> MVTTempTile;
+
     std::vector<std::unique_ptr<OGRMVTWriterLayer>> m_apoLayers;
     CPLString m_osTempDB;
     mutable std::mutex m_oDBMutex;
@@ -3312,10 +3326,17 @@ class OGRMVTWriterDataset final : public GDALDataset
     mutable CPLWorkerThreadPool m_oThreadPool;
     bool m_bThreadPoolOK = false;
     mutable GIntBig m_nTempTiles = 0;
+    // In-memory temporary store, indexed by (z, x, y), used instead of the
+    // temporary database as long as its size is below m_nTempMemoryLimit.
+    mutable std::map<std::tuple<int, int, int>, MVTTempTile> m_oMapTempTiles{};
+    mutable bool m_bTempTilesInMemory = false;
+    mutable size_t m_nTempMemoryUsage = 0;
+    size_t m_nTempMemoryLimit = 0;
     CPLString m_osName;
     CPLString m_osDescription;
     CPLString m_osType{"overlay"};
     sqlite3 *m_hDBMBTILES = nullptr;
+    std::unique_ptr<OGRMVTWriterTileSink> m_poTileSink{};
     OGREnvelope m_oEnvelope;
     unsigned m_nMaxTileSize = 500000;
     unsigned m_nMaxFeatures = 200000;
@@ -3346,6 +3367,13 @@ class OGRMVTWriterDataset final : public GDALDataset
                                   GIntBig nSerial, const OGRGeometry *poGeom,
                                   const OGREnvelope &sEnvelope) const;
 
+    bool InsertTempFeatureInDB(int nZ, int nTileX, int nTileY,
+                               const CPLString &osTargetName,
+                               const MVTTempFeature &oFeature) const;
+    bool FlushTempTilesToDB() const;
+    bool LoadTempTileFromDB(int nZ, int nX, int nY, sqlite3_stmt *hStmtTile,
+                            MVTTempTile &oTile);
+
     void ConvertToTileCoords(double dfX, double dfY, int &nX, int &nY,
                              double dfTopX, double dfTopY,
                              double dfTileDim) const;
@@ -3376,14 +3404,12 @@ class OGRMVTWriterDataset final : public GDALDataset
                        unsigned &nFeaturesInTile);
 
     std::string
-    EncodeTile(int nZ, int nX, int nY, sqlite3_stmt *hStmtLayer,
-               sqlite3_stmt *hStmtRows,
+    EncodeTile(int nZ, int nX, int nY, const MVTTempTile &oTile,
                std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
                std::set<CPLString> &oSetLayers, GIntBig &nTempTilesRead);
 
-    std::string RecodeTileLowerResolution(int nZ, int nX, int nY, int nExtent,
-                                          sqlite3_stmt *hStmtLayer,
-                                          sqlite3_stmt *hStmtRows);
+    std::string RecodeTileLowerResolution(const MVTTempTile &oTile,
+                                          int nExtent);
 
     bool CreateOutput();
 
@@ -3409,6 +3435,11 @@ class OGRMVTWriterDataset final : public GDALDataset
                                int nBandsIn, GDALDataType eDT,
                                char **papszOptions);
 
+    static GDALDataset *
+    Create(const char *pszFilename, int nXSize, int nYSize, int nBandsIn,
+           GDALDataType eDT, char **papszOptions,
+           std::unique_ptr<OGRMVTWriterTileSink> poTileSink);
+
     OGRSpatialReference *GetSRS()
     {
         return m_poSRS;
@@ -4269,27 +4300,98 @@ OGRErr OGRMVTWriterDataset::PreGenerateForTileReal(
     if (m_bThreadPoolOK)
         poLockGuard = std::make_unique<std::lock_guard<std::mutex>>(m_oDBMutex);
 
+    MVTTempFeature oFeature;
+    oFeature.nSerial = nSerial;
+    oFeature.osBlob = std::move(oBuffer);
+    oFeature.nGeomType = static_cast<int>(poGPBFeature->getType());
+    oFeature.dfAreaOrLength = dfAreaOrLength;
+
     m_nTempTiles++;
+    if (m_bTempTilesInMemory)
+    {
+        const size_t nFeatureMemory =
+            sizeof(MVTTempFeature) + oFeature.osBlob.size();
+        if (m_nTempMemoryUsage + nFeatureMemory <= m_nTempMemoryLimit)
+        {
+            auto &oTile = m_oMapTempTiles[std::make_tuple(nZ, nTileX, nTileY)];
+            oTile[osTargetName].push_back(std::move(oFeature));
+            m_nTempMemoryUsage += nFeatureMemory;
+            return OGRERR_NONE;
+        }
+
+        CPLDebug("MVT",
+                 "In-memory temporary store exceeds %u MB. "
+                 "Switching to temporary database",
+                 static_cast<unsigned>(m_nTempMemoryLimit / (1024 * 1024)));
+        if (!FlushTempTilesToDB())
+            return OGRERR_FAILURE;
+    }
+
+    if (!InsertTempFeatureInDB(nZ, nTileX, nTileY, osTargetName, oFeature))
+    {
+        return OGRERR_FAILURE;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                       InsertTempFeatureInDB()                        */
+/************************************************************************/
+
+bool OGRMVTWriterDataset::InsertTempFeatureInDB(
+    int nZ, int nTileX, int nTileY, const CPLString &osTargetName,
+    const MVTTempFeature &oFeature) const
+{
     sqlite3_bind_int(m_hInsertStmt, 1, nZ);
     sqlite3_bind_int(m_hInsertStmt, 2, nTileX);
     sqlite3_bind_int(m_hInsertStmt, 3, nTileY);
     sqlite3_bind_text(m_hInsertStmt, 4, osTargetName.c_str(), -1,
                       SQLITE_STATIC);
-    sqlite3_bind_int64(m_hInsertStmt, 5, nSerial);
-    sqlite3_bind_blob(m_hInsertStmt, 6, oBuffer.data(),
-                      static_cast<int>(oBuffer.size()), SQLITE_STATIC);
-    sqlite3_bind_int(m_hInsertStmt, 7,
-                     static_cast<int>(poGPBFeature->getType()));
-    sqlite3_bind_double(m_hInsertStmt, 8, dfAreaOrLength);
+    sqlite3_bind_int64(m_hInsertStmt, 5, oFeature.nSerial);
+    sqlite3_bind_blob(m_hInsertStmt, 6, oFeature.osBlob.data(),
+                      static_cast<int>(oFeature.osBlob.size()), SQLITE_STATIC);
+    sqlite3_bind_int(m_hInsertStmt, 7, oFeature.nGeomType);
+    sqlite3_bind_double(m_hInsertStmt, 8, oFeature.dfAreaOrLength);
     int rc = sqlite3_step(m_hInsertStmt);
     sqlite3_reset(m_hInsertStmt);
 
-    if (!(rc == SQLITE_OK || rc == SQLITE_DONE))
-    {
-        return OGRERR_FAILURE;
-    }
+    return rc == SQLITE_OK || rc == SQLITE_DONE;
+}
 
-    return OGRERR_NONE;
+/************************************************************************/
+/*                         FlushTempTilesToDB()                         */
+/************************************************************************/
+
+// Move the content of the in-memory temporary store to the temporary
+// database, which is then used for the rest of the features.
+// Must be called with m_oDBMutex held if m_bThreadPoolOK.
+bool OGRMVTWriterDataset::FlushTempTilesToDB() const
+{
+    m_bTempTilesInMemory = false;
+    bool bRet = SQLCommand(m_hDB, "BEGIN") == OGRERR_NONE;
+    for (const auto &oTileIter : m_oMapTempTiles)
+    {
+        const int nZ = std::get<0>(oTileIter.first);
+        const int nTileX = std::get<1>(oTileIter.first);
+        const int nTileY = std::get<2>(oTileIter.first);
+        for (const auto &oLayerIter : oTileIter.second)
+        {
+            for (const auto &oFeature : oLayerIter.second)
+            {
+                if (bRet)
+                {
+                    bRet = InsertTempFeatureInDB(nZ, nTileX, nTileY,
+                                                 oLayerIter.first, oFeature);
+                }
+            }
+        }
+    }
+    if (bRet)
+        bRet = SQLCommand(m_hDB, "COMMIT") == OGRERR_NONE;
+    m_oMapTempTiles.clear();
+    m_nTempMemoryUsage = 0;
+    return bRet;
 }
 
 /************************************************************************/
@@ -4882,29 +4984,21 @@ void OGRMVTWriterDataset::EncodeFeature(
 /************************************************************************/
 
 std::string OGRMVTWriterDataset::EncodeTile(
-    int nZ, int nX, int nY, sqlite3_stmt *hStmtLayer, sqlite3_stmt *hStmtRows,
+    int nZ, int nX, int nY, const MVTTempTile &oTile,
     std::map<CPLString, MVTLayerProperties> &oMapLayerProps,
     std::set<CPLString> &oSetLayers, GIntBig &nTempTilesRead)
 {
     MVTTile oTargetTile;
 
-    sqlite3_bind_int(hStmtLayer, 1, nZ);
-    sqlite3_bind_int(hStmtLayer, 2, nX);
-    sqlite3_bind_int(hStmtLayer, 3, nY);
-
     unsigned nFeaturesInTile = 0;
     const GIntBig nProgressStep =
         std::max(static_cast<GIntBig>(1), m_nTempTiles / 10);
 
-    while (nFeaturesInTile < m_nMaxFeatures &&
-           sqlite3_step(hStmtLayer) == SQLITE_ROW)
+    for (auto oLayerIter = oTile.begin();
+         nFeaturesInTile < m_nMaxFeatures && oLayerIter != oTile.end();
+         ++oLayerIter)
     {
-        const char *pszLayerName =
-            reinterpret_cast<const char *>(sqlite3_column_text(hStmtLayer, 0));
-        sqlite3_bind_int(hStmtRows, 1, nZ);
-        sqlite3_bind_int(hStmtRows, 2, nX);
-        sqlite3_bind_int(hStmtRows, 3, nY);
-        sqlite3_bind_text(hStmtRows, 4, pszLayerName, -1, SQLITE_STATIC);
+        const char *pszLayerName = oLayerIter->first.c_str();
 
         auto oIterMapLayerProps = oMapLayerProps.find(pszLayerName);
         MVTLayerProperties *poLayerProperties = nullptr;
@@ -4944,15 +5038,15 @@ std::string OGRMVTWriterDataset::EncodeTile(
         std::map<CPLString, GUInt32> oMapKeyToIdx;
         std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
 
-        while (nFeaturesInTile < m_nMaxFeatures &&
-               sqlite3_step(hStmtRows) == SQLITE_ROW)
+        for (auto oFeatureIter = oLayerIter->second.begin();
+             nFeaturesInTile < m_nMaxFeatures &&
+             oFeatureIter != oLayerIter->second.end();
+             ++oFeatureIter)
         {
-            int nBlobSize = sqlite3_column_bytes(hStmtRows, 0);
-            const void *pabyBlob = sqlite3_column_blob(hStmtRows, 0);
-
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, oMapKeyToIdx,
-                          oMapValueToIdx, poLayerProperties, m_nExtent,
-                          nFeaturesInTile);
+            EncodeFeature(oFeatureIter->osBlob.data(),
+                          static_cast<int>(oFeatureIter->osBlob.size()),
+                          poTargetLayer, oMapKeyToIdx, oMapValueToIdx,
+                          poLayerProperties, m_nExtent, nFeaturesInTile);
 
             nTempTilesRead++;
             if (nTempTilesRead == m_nTempTiles ||
@@ -4963,11 +5057,8 @@ std::string OGRMVTWriterDataset::EncodeTile(
                 CPLDebug("MVT", "%d%%...", nPct);
             }
         }
-        sqlite3_reset(hStmtRows);
     }
 
-    sqlite3_reset(hStmtLayer);
-
     std::string oTileBuffer(oTargetTile.write());
     size_t nSizeBefore = oTileBuffer.size();
     if (m_bGZip)
@@ -4987,8 +5078,7 @@ std::string OGRMVTWriterDataset::EncodeTile(
     {
         nExtent /= 2;
         nSizeBefore = oTileBuffer.size();
-        oTileBuffer = RecodeTileLowerResolution(nZ, nX, nY, nExtent, hStmtLayer,
-                                                hStmtRows);
+        oTileBuffer = RecodeTileLowerResolution(oTile, nExtent);
         bTooBigTile = oTileBuffer.size() > m_nMaxTileSize;
         CPLDebug("MVT",
                  "Recoding tile %d/%d/%d with extent = %u. "
@@ -5016,17 +5106,27 @@ std::string OGRMVTWriterDataset::EncodeTile(
 
         const unsigned nTotalFeaturesInTile =
             std::min(m_nMaxFeatures, nFeaturesInTile);
-        char *pszSQL =
-            sqlite3_mprintf("SELECT layer, feature FROM temp "
-                            "WHERE z = %d AND x = %d AND y = %d ORDER BY "
-                            "area_or_length DESC LIMIT %d",
-                            nZ, nX, nY, nTotalFeaturesInTile);
-        sqlite3_stmt *hTmpStmt = nullptr;
-        CPL_IGNORE_RET_VAL(
-            sqlite3_prepare_v2(m_hDB, pszSQL, -1, &hTmpStmt, nullptr));
-        sqlite3_free(pszSQL);
-        if (!hTmpStmt)
-            return std::string();
+
+        // Collect the features of all layers, and sort them by descending
+        // area / length.
+        std::vector<std::pair<const CPLString *, const MVTTempFeature *>>
+            aoSortedFeatures;
+        for (const auto &oLayerIter : oTile)
+        {
+            for (const auto &oFeature : oLayerIter.second)
+                aoSortedFeatures.emplace_back(&oLayerIter.first, &oFeature);
+        }
+        std::stable_sort(aoSortedFeatures.begin(), aoSortedFeatures.end(),
+                         [](const std::pair<const CPLString *,
+                                            const MVTTempFeature *> &a,
+                            const std::pair<const CPLString *,
+                                            const MVTTempFeature *> &b)
+                         {
+                             return a.second->dfAreaOrLength >
+                                    b.second->dfAreaOrLength;
+                         });
+        if (aoSortedFeatures.size() > nTotalFeaturesInTile)
+            aoSortedFeatures.resize(nTotalFeaturesInTile);
 
         class TargetTileLayerProps
         {
@@ -5040,12 +5140,10 @@ std::string OGRMVTWriterDataset::EncodeTile(
 
         nFeaturesInTile = 0;
         const unsigned nCheckStep = std::max(1U, nTotalFeaturesInTile / 100);
-        while (sqlite3_step(hTmpStmt) == SQLITE_ROW)
+        for (const auto &oSortedFeature : aoSortedFeatures)
         {
-            const char *pszLayerName = reinterpret_cast<const char *>(
-                sqlite3_column_text(hTmpStmt, 0));
-            int nBlobSize = sqlite3_column_bytes(hTmpStmt, 1);
-            const void *pabyBlob = sqlite3_column_blob(hTmpStmt, 1);
+            const char *pszLayerName = oSortedFeature.first->c_str();
+            const MVTTempFeature *poFeature = oSortedFeature.second;
 
             std::shared_ptr<MVTTileLayer> poTargetLayer;
             std::map<CPLString, GUInt32> *poMapKeyToIdx;
@@ -5074,8 +5172,10 @@ std::string OGRMVTWriterDataset::EncodeTile(
                 poMapValueToIdx = &oIter->second.m_oMapValueToIdx;
             }
 
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, *poMapKeyToIdx,
-                          *poMapValueToIdx, nullptr, nExtent, nFeaturesInTile);
+            EncodeFeature(poFeature->osBlob.data(),
+                          static_cast<int>(poFeature->osBlob.size()),
+                          poTargetLayer, *poMapKeyToIdx, *poMapValueToIdx,
+                          nullptr, nExtent, nFeaturesInTile);
 
             if (nFeaturesInTile == nTotalFeaturesInTile ||
                 (bTooBigTile && (nFeaturesInTile % nCheckStep == 0)))
@@ -5096,8 +5196,6 @@ std::string OGRMVTWriterDataset::EncodeTile(
             CPLDebug("MVT", "For tile %d/%d/%d, final tile size is %u", nZ, nX,
                      nY, static_cast<unsigned>(oTileBuffer.size()));
         }
-
-        sqlite3_finalize(hTmpStmt);
     }
 
     return oTileBuffer;
@@ -5108,49 +5206,36 @@ std::string OGRMVTWriterDataset::EncodeTile(
 /************************************************************************/
 
 std::string OGRMVTWriterDataset::RecodeTileLowerResolution(
-    int nZ, int nX, int nY, int nExtent, sqlite3_stmt *hStmtLayer,
-    sqlite3_stmt *hStmtRows)
+    const MVTTempTile &oTile, int nExtent)
 {
     MVTTile oTargetTile;
 
-    sqlite3_bind_int(hStmtLayer, 1, nZ);
-    sqlite3_bind_int(hStmtLayer, 2, nX);
-    sqlite3_bind_int(hStmtLayer, 3, nY);
-
     unsigned nFeaturesInTile = 0;
-    while (nFeaturesInTile < m_nMaxFeatures &&
-           sqlite3_step(hStmtLayer) == SQLITE_ROW)
+    for (auto oLayerIter = oTile.begin();
+         nFeaturesInTile < m_nMaxFeatures && oLayerIter != oTile.end();
+         ++oLayerIter)
     {
-        const char *pszLayerName =
-            reinterpret_cast<const char *>(sqlite3_column_text(hStmtLayer, 0));
-        sqlite3_bind_int(hStmtRows, 1, nZ);
-        sqlite3_bind_int(hStmtRows, 2, nX);
-        sqlite3_bind_int(hStmtRows, 3, nY);
-        sqlite3_bind_text(hStmtRows, 4, pszLayerName, -1, SQLITE_STATIC);
-
         std::shared_ptr<MVTTileLayer> poTargetLayer(new MVTTileLayer());
         oTargetTile.addLayer(poTargetLayer);
-        poTargetLayer->setName(pszLayerName);
+        poTargetLayer->setName(oLayerIter->first);
         poTargetLayer->setVersion(m_nMVTVersion);
         poTargetLayer->setExtent(nExtent);
 
         std::map<CPLString, GUInt32> oMapKeyToIdx;
         std::map<MVTTileLayerValue, GUInt32> oMapValueToIdx;
 
-        while (nFeaturesInTile < m_nMaxFeatures &&
-               sqlite3_step(hStmtRows) == SQLITE_ROW)
+        for (auto oFeatureIter = oLayerIter->second.begin();
+             nFeaturesInTile < m_nMaxFeatures &&
+             oFeatureIter != oLayerIter->second.end();
+             ++oFeatureIter)
         {
-            int nBlobSize = sqlite3_column_bytes(hStmtRows, 0);
-            const void *pabyBlob = sqlite3_column_blob(hStmtRows, 0);
-
-            EncodeFeature(pabyBlob, nBlobSize, poTargetLayer, oMapKeyToIdx,
-                          oMapValueToIdx, nullptr, nExtent, nFeaturesInTile);
+            EncodeFeature(oFeatureIter->osBlob.data(),
+                          static_cast<int>(oFeatureIter->osBlob.size()),
+                          poTargetLayer, oMapKeyToIdx, oMapValueToIdx, nullptr,
+                          nExtent, nFeaturesInTile);
         }
-        sqlite3_reset(hStmtRows);
     }
 
-    sqlite3_reset(hStmtLayer);
-
     std::string oTileBuffer(oTargetTile.write());
     if (m_bGZip)
         GZIPCompress(oTileBuffer);
@@ -5158,6 +5243,40 @@ std::string OGRMVTWriterDataset::RecodeTileLowerResolution(
     return oTileBuffer;
 }
 
+/************************************************************************/
+/*                        LoadTempTileFromDB()                          */
+/************************************************************************/
+
+bool OGRMVTWriterDataset::LoadTempTileFromDB(int nZ, int nX, int nY,
+                                             sqlite3_stmt *hStmtTile,
+                                             MVTTempTile &oTile)
+{
+    sqlite3_bind_int(hStmtTile, 1, nZ);
+    sqlite3_bind_int(hStmtTile, 2, nX);
+    sqlite3_bind_int(hStmtTile, 3, nY);
+
+    std::vector<MVTTempFeature> *paoFeatures = nullptr;
+    int rc;
+    while ((rc = sqlite3_step(hStmtTile)) == SQLITE_ROW)
+    {
+        const char *pszLayerName =
+            reinterpret_cast<const char *>(sqlite3_column_text(hStmtTile, 0));
+        if (!paoFeatures || oTile.rbegin()->first != pszLayerName)
+            paoFeatures = &(oTile[pszLayerName]);
+
+        MVTTempFeature oFeature;
+        oFeature.nSerial = sqlite3_column_int64(hStmtTile, 1);
+        oFeature.osBlob.assign(
+            static_cast<const char *>(sqlite3_column_blob(hStmtTile, 2)),
+            sqlite3_column_bytes(hStmtTile, 2));
+        oFeature.dfAreaOrLength = sqlite3_column_double(hStmtTile, 3);
+        paoFeatures->push_back(std::move(oFeature));
+    }
+    sqlite3_reset(hStmtTile);
+
+    return rc == SQLITE_DONE;
+}
+
 /************************************************************************/
 /*                            CreateOutput()                            */
 /************************************************************************/
@@ -5175,42 +5294,37 @@ bool OGRMVTWriterDataset::CreateOutput()
         return GenerateMetadata(0, oMapLayerProps);
     }
 
-    CPLDebug("MVT", "Building output file from temporary database...");
-
     sqlite3_stmt *hStmtZXY = nullptr;
-    CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
-        m_hDB, "SELECT DISTINCT z, x, y FROM temp ORDER BY z, x, y", -1,
-        &hStmtZXY, nullptr));
-    if (hStmtZXY == nullptr)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-        return false;
-    }
-
-    sqlite3_stmt *hStmtLayer = nullptr;
-    CPL_IGNORE_RET_VAL(
-        sqlite3_prepare_v2(m_hDB,
-                           "SELECT DISTINCT layer FROM temp "
-                           "WHERE z = ? AND x = ? AND y = ? ORDER BY layer",
-                           -1, &hStmtLayer, nullptr));
-    if (hStmtLayer == nullptr)
+    sqlite3_stmt *hStmtTile = nullptr;
+    if (m_bTempTilesInMemory)
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-        sqlite3_finalize(hStmtZXY);
-        return false;
+        CPLDebug("MVT", "Building output file from in-memory temporary "
+                        "store...");
     }
-    sqlite3_stmt *hStmtRows = nullptr;
-    CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
-        m_hDB,
-        "SELECT feature FROM temp "
-        "WHERE z = ? AND x = ? AND y = ? AND layer = ? ORDER BY idx",
-        -1, &hStmtRows, nullptr));
-    if (hStmtRows == nullptr)
+    else
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
-        sqlite3_finalize(hStmtZXY);
-        sqlite3_finalize(hStmtLayer);
-        return false;
+        CPLDebug("MVT", "Building output file from temporary database...");
+
+        CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
+            m_hDB, "SELECT DISTINCT z, x, y FROM temp ORDER BY z, x, y", -1,
+            &hStmtZXY, nullptr));
+        if (hStmtZXY == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
+            return false;
+        }
+
+        CPL_IGNORE_RET_VAL(sqlite3_prepare_v2(
+            m_hDB,
+            "SELECT layer, idx, feature, area_or_length FROM temp "
+            "WHERE z = ? AND x = ? AND y = ? ORDER BY layer, idx",
+            -1, &hStmtTile, nullptr));
+        if (hStmtTile == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
+            sqlite3_finalize(hStmtZXY);
+            return false;
+        }
     }
 
     sqlite3_stmt *hInsertStmt = nullptr;
@@ -5225,8 +5339,7 @@ bool OGRMVTWriterDataset::CreateOutput()
         {
             CPLError(CE_Failure, CPLE_AppDefined, "Prepared statement failed");
             sqlite3_finalize(hStmtZXY);
-            sqlite3_finalize(hStmtLayer);
-            sqlite3_finalize(hStmtRows);
+            sqlite3_finalize(hStmtTile);
             return false;
         }
     }
@@ -5236,20 +5349,110 @@ bool OGRMVTWriterDataset::CreateOutput()
     bool bRet = true;
     GIntBig nTempTilesRead = 0;
 
-    while (sqlite3_step(hStmtZXY) == SQLITE_ROW)
+    // The tile sink imposes the order in which tiles are written, instead
+    // of the (z, x, y) one of the temporary store.
+    std::vector<std::pair<uint64_t, std::tuple<int, int, int>>> aoSinkTiles;
+    size_t iSinkTile = 0;
+    if (m_poTileSink)
     {
-        int nZ = sqlite3_column_int(hStmtZXY, 0);
-        int nX = sqlite3_column_int(hStmtZXY, 1);
-        int nY = sqlite3_column_int(hStmtZXY, 2);
+        if (m_bTempTilesInMemory)
+        {
+            for (const auto &oTileIter : m_oMapTempTiles)
+            {
+                const auto &oKey = oTileIter.first;
+                aoSinkTiles.emplace_back(
+                    m_poTileSink->GetTileRank(std::get<0>(oKey),
+                                              std::get<1>(oKey),
+                                              std::get<2>(oKey)),
+                    oKey);
+            }
+        }
+        else
+        {
+            while (sqlite3_step(hStmtZXY) == SQLITE_ROW)
+            {
+                const int nZ = sqlite3_column_int(hStmtZXY, 0);
+                const int nX = sqlite3_column_int(hStmtZXY, 1);
+                const int nY = sqlite3_column_int(hStmtZXY, 2);
+                aoSinkTiles.emplace_back(m_poTileSink->GetTileRank(nZ, nX, nY),
+                                         std::make_tuple(nZ, nX, nY));
+            }
+        }
+        std::sort(aoSinkTiles.begin(), aoSinkTiles.end());
+    }
 
-        std::string oTileBuffer(EncodeTile(nZ, nX, nY, hStmtLayer, hStmtRows,
-                                           oMapLayerProps, oSetLayers,
-                                           nTempTilesRead));
+    while (true)
+    {
+        int nZ;
+        int nX;
+        int nY;
+        MVTTempTile oTileFromDB;
+        const MVTTempTile *poTile;
+        if (m_poTileSink)
+        {
+            if (iSinkTile == aoSinkTiles.size())
+                break;
+            std::tie(nZ, nX, nY) = aoSinkTiles[iSinkTile].second;
+            ++iSinkTile;
+        }
+        else if (m_bTempTilesInMemory)
+        {
+            if (m_oMapTempTiles.empty())
+                break;
+            std::tie(nZ, nX, nY) = m_oMapTempTiles.begin()->first;
+        }
+        else
+        {
+            if (sqlite3_step(hStmtZXY) != SQLITE_ROW)
+                break;
+            nZ = sqlite3_column_int(hStmtZXY, 0);
+            nX = sqlite3_column_int(hStmtZXY, 1);
+            nY = sqlite3_column_int(hStmtZXY, 2);
+        }
+
+        if (m_bTempTilesInMemory)
+        {
+            auto &oTile = m_oMapTempTiles[std::make_tuple(nZ, nX, nY)];
+            // Features may have been inserted out of order by worker threads
+            for (auto &oLayerIter : oTile)
+            {
+                std::sort(oLayerIter.second.begin(), oLayerIter.second.end(),
+                          [](const MVTTempFeature &a, const MVTTempFeature &b)
+                          { return a.nSerial < b.nSerial; });
+            }
+            poTile = &oTile;
+        }
+        else
+        {
+            if (!LoadTempTileFromDB(nZ, nX, nY, hStmtTile, oTileFromDB))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Error while reading tile %d/%d/%d from temporary "
+                         "database",
+                         nZ, nX, nY);
+                bRet = false;
+                break;
+            }
+            poTile = &oTileFromDB;
+        }
+
+        std::string oTileBuffer(EncodeTile(nZ, nX, nY, *poTile, oMapLayerProps,
+                                           oSetLayers, nTempTilesRead));
+
+        if (m_bTempTilesInMemory)
+        {
+            // Release memory as soon as possible
+            m_oMapTempTiles.erase(std::make_tuple(nZ, nX, nY));
+        }
 
         if (oTileBuffer.empty())
         {
             bRet = false;
         }
+        else if (m_poTileSink)
+        {
+            bRet = m_poTileSink->WriteTile(nZ, nX, nY, oTileBuffer);
+        }
         else if (hInsertStmt)
         {
             sqlite3_bind_int(hInsertStmt, 1, nZ);
@@ -5302,9 +5505,12 @@ bool OGRMVTWriterDataset::CreateOutput()
             break;
         }
     }
-    sqlite3_finalize(hStmtZXY);
-    sqlite3_finalize(hStmtLayer);
-    sqlite3_finalize(hStmtRows);
+    m_oMapTempTiles.clear();
+    m_nTempMemoryUsage = 0;
+    if (hStmtZXY)
+        sqlite3_finalize(hStmtZXY);
+    if (hStmtTile)
+        sqlite3_finalize(hStmtTile);
     if (hInsertStmt)
         sqlite3_finalize(hInsertStmt);
 
@@ -5672,6 +5878,11 @@ bool OGRMVTWriterDataset::GenerateMetadata(
         return true;
     }
 
+    if (m_poTileSink)
+    {
+        return m_poTileSink->WriteMetadata(oRoot);
+    }
+
     return oDoc.Save(
         CPLFormFilename(GetDescription(), "metadata.json", nullptr));
 }
@@ -5932,6 +6143,15 @@ OGRMVTWriterDataset::ICreateLayer(const char *pszLayerName,
 GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
                                          int nYSize, int nBandsIn,
                                          GDALDataType eDT, char **papszOptions)
+{
+    return Create(pszFilename, nXSize, nYSize, nBandsIn, eDT, papszOptions,
+                  nullptr);
+}
+
+GDALDataset *
+OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize, int nYSize,
+                            int nBandsIn, GDALDataType eDT, char **papszOptions,
+                            std::unique_ptr<OGRMVTWriterTileSink> poTileSink)
 {
     if (nXSize != 0 || nYSize != 0 || nBandsIn != 0 || eDT != GDT_Unknown)
     {
@@ -5947,12 +6167,19 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
         pszFormat = "MBTILES";
     }
     const bool bMBTILES = pszFormat != nullptr && EQUAL(pszFormat, "MBTILES");
+    // Tiles are written by the tile sink, in an archive with the same
+    // constraints as MBTiles
+    const bool bMBTILESLike = bMBTILES || poTileSink != nullptr;
 
     // For debug only
     bool bReuseTempFile =
         CPLTestBool(CPLGetConfigOption("OGR_MVT_REUSE_TEMP_FILE", "NO"));
 
-    if (bMBTILES)
+    if (poTileSink)
+    {
+        // nothing to do
+    }
+    else if (bMBTILES)
     {
         if (!bMBTILESExt)
         {
@@ -5981,6 +6208,7 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     }
 
     OGRMVTWriterDataset *poDS = new OGRMVTWriterDataset();
+    poDS->m_poTileSink = std::move(poTileSink);
     poDS->m_pMyVFS = OGRSQLiteCreateVFS(nullptr, poDS);
     sqlite3_vfs_register(poDS->m_pMyVFS, 0);
 
@@ -6051,6 +6279,28 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     }
     poDS->m_hInsertStmt = hInsertStmt;
 
+    // Pre-generated tiles are kept in memory, and only spilled to the
+    // temporary database if they exceed that threshold.
+    const char *pszTempMemoryLimit =
+        CSLFetchNameValue(papszOptions, "TEMPORARY_MEMORY_LIMIT");
+    if (pszTempMemoryLimit)
+    {
+        const double dfLimit =
+            std::max(0.0, CPLAtof(pszTempMemoryLimit)) * 1024 * 1024;
+        poDS->m_nTempMemoryLimit = static_cast<size_t>(std::min(
+            static_cast<double>(std::numeric_limits<size_t>::max() / 2),
+            dfLimit));
+    }
+    else
+    {
+        poDS->m_nTempMemoryLimit = static_cast<size_t>(
+            std::min<GUIntBig>(std::numeric_limits<size_t>::max(),
+                               CPLGetUsablePhysicalRAM() / 10));
+    }
+    poDS->m_bTempTilesInMemory =
+        !bReuseTempFile && poDS->m_nTempMemoryLimit > 0 &&
+        CPLTestBool(CPLGetConfigOption("OGR_MVT_REMOVE_TEMP_FILE", "YES"));
+
     poDS->m_nMinZoom = atoi(CSLFetchNameValueDef(
         papszOptions, "MINZOOM", CPLSPrintf("%d", poDS->m_nMinZoom)));
     poDS->m_nMaxZoom = atoi(CSLFetchNameValueDef(
@@ -6116,10 +6366,11 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
         CSLFetchNameValue(papszOptions, "TILING_SCHEME");
     if (pszTilingScheme)
     {
-        if (bMBTILES)
+        if (bMBTILESLike)
         {
             CPLError(CE_Failure, CPLE_NotSupported,
-                     "Custom TILING_SCHEME not supported with MBTILES output");
+                     "Custom TILING_SCHEME not supported with %s output",
+                     poDS->m_poTileSink ? "this" : "MBTILES");
             delete poDS;
             return nullptr;
         }
@@ -6196,6 +6447,24 @@ GDALDataset *OGRMVTWriterDatasetCreate(const char *pszFilename, int nXSize,
                                        eDT, papszOptions);
 }
 
+/************************************************************************/
+/*                 OGRMVTWriterDatasetCreateWithTileSink()              */
+/************************************************************************/
+
+GDALDataset *OGRMVTWriterDatasetCreateWithTileSink(
+    const char *pszFilename, char **papszOptions,
+    std::unique_ptr<OGRMVTWriterTileSink> poSink)
+{
+    return OGRMVTWriterDataset::Create(pszFilename, 0, 0, 0, GDT_Unknown,
+                                       papszOptions, std::move(poSink));
+}
+
+/************************************************************************/
+/*                       ~OGRMVTWriterTileSink()                        */
+/************************************************************************/
+
+OGRMVTWriterTileSink::~OGRMVTWriterTileSink() = default;
+
 #endif  // HAVE_MVT_WRITE_SUPPORT
 
 /************************************************************************/
@@ -121,6 +121,8 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     OGRErr GetExtentInternal(int iGeomField, OGREnvelope *psExtent, int bForce);
     //! @endcond
 
+    virtual OGRFeature *
+    IGetNextFeatureReusing(OGRFeature *poFeatureToReuse) CPL_WARN_UNUSED_RESULT;
     virtual OGRErr ISetFeature(OGRFeature *poFeature) CPL_WARN_UNUSED_RESULT;
     virtual OGRErr ICreateFeature(OGRFeature *poFeature) CPL_WARN_UNUSED_RESULT;
     virtual OGRErr IUpsertFeature(OGRFeature *poFeature) CPL_WARN_UNUSED_RESULT;
@@ -146,6 +148,8 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     std::shared_ptr<ArrowArrayStreamPrivateData>
         m_poSharedArrowArrayStreamPrivateData{};
 
+    bool IsGeoArrowGeometryEncodingRequested() const;
+
     struct ArrowArrayStreamPrivateDataSharedDataWrapper
     {
         std::shared_ptr<ArrowArrayStreamPrivateData> poShared{};
@@ -216,6 +220,8 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual void ResetReading() = 0;
     virtual OGRFeature *GetNextFeature() CPL_WARN_UNUSED_RESULT = 0;
+    OGRFeature *GetNextFeatureReusing(OGRFeature *poFeatureToReuse)
+        CPL_WARN_UNUSED_RESULT;
     virtual OGRErr SetNextByIndex(GIntBig nIndex);
     virtual OGRFeature *GetFeature(GIntBig nFID) CPL_WARN_UNUSED_RESULT;
 
@@ -31,6 +31,7 @@
 #define OGR_OPENFILEGDB_H_INCLUDED
 
 #include "ogrsf_frmts.h"
+#include "ogr_recordbatch.h"
 #include "filegdbtable.h"
 #include "ogr_swq.h"
 #include "cpl_mem_cache.h"
@@ -39,8 +40,13 @@
 #include "gdal_rat.h"
 
 #include <array>
-#include <vector>
+#include <deque>
 #include <map>
+#include <memory>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace OpenFileGDB;
 
@@ -190,6 +196,56 @@ class OGROpenFileGDBLayer final : public OGRLayer
     std::string GetLaunderedLayerName(const std::string &osNameOri) const;
 
     mutable std::vector<std::string> m_aosTempStrings{};
+
+    // Used by GetNextArrowArray()
+    // Row that did not fit in the previous batch.
+    int m_iArrowArrayPendingRow = -1;
+    // In worker layers, end (exclusive) of the range of rows when iterating
+    // sequentially over them.
+    int m_nArrowArrayEndRow = -1;
+    // Whether rows are taken from m_anArrowArrayRows.
+    bool m_bArrowArrayUseRowList = false;
+    std::vector<int> m_anArrowArrayRows{};
+    size_t m_iArrowArrayNextRow = 0;
+
+    // Used by the multi-threaded implementation of GetNextArrowArray()
+    struct ArrowArrayPrefetchTask
+    {
+        std::thread m_oThread{};
+        std::unique_ptr<OGROpenFileGDBDataSource> m_poDS{};
+        OGROpenFileGDBLayer *m_poLayer = nullptr;
+        struct ArrowArrayStream m_sStream{};
+        // Range of candidate rows, in m_anArrowArrayRows if it is not
+        // empty, or row numbers otherwise.
+        int m_iFirstCandidate = 0;
+        int m_iLastCandidate = 0;
+        std::vector<struct ArrowArray> m_asArrays{};
+        std::string m_osErrorMsg{};
+
+        ArrowArrayPrefetchTask() = default;
+        ~ArrowArrayPrefetchTask();
+
+        CPL_DISALLOW_COPY_ASSIGN(ArrowArrayPrefetchTask)
+    };
+
+    bool m_bArrowArrayPrefetchTried = false;
+    bool m_bIsArrowArrayPrefetchWorker = false;
+    int m_nArrowArrayPrefetchCandidates = 0;
+    int m_iArrowArrayPrefetchNextCandidate = 0;
+    std::queue<std::unique_ptr<ArrowArrayPrefetchTask>>
+        m_oQueueArrowArrayPrefetchTasks{};
+    std::deque<struct ArrowArray> m_asArrowArrayPrefetchReady{};
+
+    bool CanUseNativeArrowArray(struct ArrowArrayStream *stream,
+                                bool &bPostFilter);
+    int SelectNextArrowArrayRow();
+    void StartArrowArrayPrefetchTasks();
+    bool LaunchArrowArrayPrefetchTask(ArrowArrayPrefetchTask *task);
+    void RunArrowArrayPrefetchTask(ArrowArrayPrefetchTask *task) const;
+    int GetNextArrowArrayAsynchronous(struct ArrowArrayStream *stream,
+                                      struct ArrowArray *out_array);
+    void CancelAsyncNextArrowArray();
+
     bool PrepareFileGDBFeature(OGRFeature *poFeature,
                                std::vector<OGRField> &fields,
                                const OGRGeometry *&poGeom, bool bUpdate);
@@ -304,6 +360,9 @@ class OGROpenFileGDBLayer final : public OGRLayer
 
     virtual OGRErr SetAttributeFilter(const char *pszFilter) override;
 
+    virtual int GetNextArrowArray(struct ArrowArrayStream *,
+                                  struct ArrowArray *out_array) override;
+
     virtual int TestCapability(const char *) override;
 
     virtual OGRErr Rename(const char *pszNewName) override;
@@ -52,6 +52,7 @@
 #include "ogr_srs_api.h"
 #include "ogrsf_frmts.h"
 #include "filegdbtable.h"
+#include "ograrrowarrayhelper.h"
 #include "ogr_swq.h"
 #include "filegdb_coordprec_read.h"
 
@@ -111,6 +112,8 @@ OGROpenFileGDBLayer::OGROpenFileGDBLayer(OGROpenFileGDBDataSource *poDS,
 
 OGROpenFileGDBLayer::~OGROpenFileGDBLayer()
 {
+    CancelAsyncNextArrowArray();
+
     OGROpenFileGDBLayer::SyncToDisk();
 
     if (m_poFeatureDefn)
@@ -908,6 +911,8 @@ const char *OGROpenFileGDBLayer::GetFIDColumn()
 
 void OGROpenFileGDBLayer::ResetReading()
 {
+    CancelAsyncNextArrowArray();
+
     if (m_iCurFeat != 0)
     {
         if (m_eSpatialIndexState == SPI_IN_BUILDING)
@@ -932,6 +937,8 @@ void OGROpenFileGDBLayer::SetSpatialFilter(OGRGeometry *poGeom)
     if (!BuildLayerDefinition())
         return;
 
+    CancelAsyncNextArrowArray();
+
     OGRLayer::SetSpatialFilter(poGeom);
 
     if (m_bFilterIsEnvelope)
@@ -1647,6 +1654,8 @@ OGRErr OGROpenFileGDBLayer::SetAttributeFilter(const char *pszFilter)
     if (!BuildLayerDefinition())
         return OGRERR_FAILURE;
 
+    CancelAsyncNextArrowArray();
+
     delete m_poAttributeIterator;
     m_poAttributeIterator = nullptr;
     delete m_poCombinedIterator;
@@ -1695,6 +1704,34 @@ void OGROpenFileGDBLayer::BuildCombinedIterator()
     }
 }
 
+/***********************************************************************/
+/*                      PromoteToMultiGeometry()                       */
+/***********************************************************************/
+
+// Layers of polygons or lines are reported as multi-geometry layers
+static OGRGeometry *PromoteToMultiGeometry(OGRGeometry *poGeom)
+{
+    const OGRwkbGeometryType eFlattenType =
+        wkbFlatten(poGeom->getGeometryType());
+    if (eFlattenType == wkbPolygon)
+        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
+    else if (eFlattenType == wkbCurvePolygon)
+    {
+        OGRMultiSurface *poMS = new OGRMultiSurface();
+        poMS->addGeometryDirectly(poGeom);
+        poGeom = poMS;
+    }
+    else if (eFlattenType == wkbLineString)
+        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
+    else if (eFlattenType == wkbCompoundCurve)
+    {
+        OGRMultiCurve *poMC = new OGRMultiCurve();
+        poMC->addGeometryDirectly(poGeom);
+        poGeom = poMC;
+    }
+    return poGeom;
+}
+
 /***********************************************************************/
 /*                         GetCurrentFeature()                         */
 /***********************************************************************/
@@ -1752,26 +1789,7 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                 OGRGeometry *poGeom = m_poGeomConverter->GetAsGeometry(psField);
                 if (poGeom != nullptr)
                 {
-                    OGRwkbGeometryType eFlattenType =
-                        wkbFlatten(poGeom->getGeometryType());
-                    if (eFlattenType == wkbPolygon)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiPolygon(poGeom);
-                    else if (eFlattenType == wkbCurvePolygon)
-                    {
-                        OGRMultiSurface *poMS = new OGRMultiSurface();
-                        poMS->addGeometryDirectly(poGeom);
-                        poGeom = poMS;
-                    }
-                    else if (eFlattenType == wkbLineString)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiLineString(poGeom);
-                    else if (eFlattenType == wkbCompoundCurve)
-                    {
-                        OGRMultiCurve *poMC = new OGRMultiCurve();
-                        poMC->addGeometryDirectly(poGeom);
-                        poGeom = poMC;
-                    }
+                    poGeom = PromoteToMultiGeometry(poGeom);
 
                     poGeom->assignSpatialReference(
                         m_poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
@@ -1943,6 +1961,823 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
     }
 }
 
+/***********************************************************************/
+/*                      CanUseNativeArrowArray()                       */
+/***********************************************************************/
+
+// Whether the specialized implementation of GetNextArrowArray() can be used.
+// bPostFilter is set if the attribute filter must be evaluated on the
+// returned ArrowArray.
+bool OGROpenFileGDBLayer::CanUseNativeArrowArray(
+    struct ArrowArrayStream *stream, bool &bPostFilter)
+{
+    bPostFilter = false;
+    if (!m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty() ||
+        (!m_bIsArrowArrayPrefetchWorker &&
+         CPLTestBool(
+             CPLGetConfigOption("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "NO"))) ||
+        IsGeoArrowGeometryEncodingRequested() || !BuildLayerDefinition() ||
+        m_iFieldToReadAsBinary >= 0 ||
+        m_poLyrTable->HasDeletedFeaturesListed())
+    {
+        return false;
+    }
+
+    if (m_poFilterGeom != nullptr &&
+        (m_iGeomFieldIdx < 0 ||
+         m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored()))
+    {
+        return false;
+    }
+
+    if (m_poAttrQuery != nullptr &&
+        !(m_poAttributeIterator != nullptr &&
+          m_bIteratorSufficientToEvaluateFilter))
+    {
+        // PostFilterArrowArray() needs the FID column to evaluate filters
+        // on it
+        if (!CPLTestBool(m_aosArrowArrayStreamOptions.FetchNameValueDef(
+                "INCLUDE_FID", "YES")))
+        {
+            return false;
+        }
+        struct ArrowSchema schema;
+        if (stream->get_schema(stream, &schema) != 0)
+            return false;
+        // Spatial filter evaluated by GetNextArrowArray()
+        auto poFilterGeomBackup = m_poFilterGeom;
+        m_poFilterGeom = nullptr;
+        bPostFilter = CanPostFilterArrowArray(&schema);
+        m_poFilterGeom = poFilterGeomBackup;
+        schema.release(&schema);
+        if (!bPostFilter)
+            return false;
+    }
+
+    return true;
+}
+
+/***********************************************************************/
+/*                      SelectNextArrowArrayRow()                      */
+/***********************************************************************/
+
+// Select the next candidate row for GetNextArrowArray(). Returns its index,
+// -1 at end of iteration, or -2 in case of error.
+int OGROpenFileGDBLayer::SelectNextArrowArrayRow()
+{
+    FileGDBIterator *poIterator = m_poCombinedIterator ? m_poCombinedIterator
+                                  : m_poSpatialIndexIterator
+                                      ? m_poSpatialIndexIterator
+                                      : m_poAttributeIterator;
+
+    while (true)
+    {
+        int iRow;
+        if (m_iArrowArrayPendingRow >= 0)
+        {
+            iRow = m_iArrowArrayPendingRow;
+            m_iArrowArrayPendingRow = -1;
+        }
+        else if (m_bArrowArrayUseRowList)
+        {
+            if (m_iArrowArrayNextRow >= m_anArrowArrayRows.size())
+                return -1;
+            iRow = m_anArrowArrayRows[m_iArrowArrayNextRow++];
+        }
+        else if (m_nArrowArrayEndRow < 0 && m_nFilteredFeatureCount >= 0)
+        {
+            if (m_iCurFeat >= m_nFilteredFeatureCount)
+                return -1;
+            iRow = static_cast<int>(reinterpret_cast<GUIntptr_t>(
+                m_pahFilteredFeatures[m_iCurFeat++]));
+        }
+        else if (m_nArrowArrayEndRow < 0 && poIterator != nullptr)
+        {
+            iRow = poIterator->GetNextRowSortedByFID();
+            if (iRow < 0)
+                return -1;
+        }
+        else
+        {
+            const int nEndRow = m_nArrowArrayEndRow >= 0
+                                    ? m_nArrowArrayEndRow
+                                    : m_poLyrTable->GetTotalRecordCount();
+            if (m_iCurFeat >= nEndRow)
+                return -1;
+            iRow = m_poLyrTable->GetAndSelectNextNonEmptyRow(m_iCurFeat);
+            if (iRow < 0)
+            {
+                m_iCurFeat = nEndRow;
+                return m_poLyrTable->HasGotError() ? -2 : -1;
+            }
+            if (iRow >= nEndRow)
+            {
+                m_iCurFeat = nEndRow;
+                return -1;
+            }
+            m_iCurFeat = iRow + 1;
+            return iRow;
+        }
+
+        if (m_poLyrTable->SelectRow(iRow))
+            return iRow;
+        if (m_poLyrTable->HasGotError())
+            return -2;
+    }
+}
+
+/***********************************************************************/
+/*                        GetNextArrowArray()                          */
+/***********************************************************************/
+
+// Specialized implementation decoding .gdbtable rows directly into the
+// ArrowArray. Falls back to the generic implementation in configurations it
+// does not handle.
+int OGROpenFileGDBLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *out_array)
+{
+    bool bPostFilter = false;
+    if (!CanUseNativeArrowArray(stream, bPostFilter))
+    {
+        // The generic implementation would not honour the range of rows of
+        // the worker. Should not happen as the main layer checks the same
+        // conditions.
+        if (m_bIsArrowArrayPrefetchWorker)
+            return EIO;
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    if (!m_bIsArrowArrayPrefetchWorker)
+    {
+        if (!m_bArrowArrayPrefetchTried)
+            StartArrowArrayPrefetchTasks();
+        if (m_nArrowArrayPrefetchCandidates > 0)
+            return GetNextArrowArrayAsynchronous(stream, out_array);
+    }
+
+begin:
+    int errorErrno = EIO;
+    memset(out_array, 0, sizeof(*out_array));
+
+    if (m_bEOF)
+        return 0;
+
+    // The in-memory spatial index is only built by GetNextFeature()
+    if (m_eSpatialIndexState == SPI_IN_BUILDING)
+        m_eSpatialIndexState = SPI_INVALID;
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    const int nGDBFieldCount = m_poLyrTable->GetFieldCount();
+    const int iObjectIdFieldIdx = m_poLyrTable->GetObjectIdFieldIdx();
+    const int iGeomArrowField =
+        m_iGeomFieldIdx >= 0 ? sHelper.m_mapOGRGeomFieldToArrowField[0] : -1;
+    std::vector<int> anNullArrowFields;
+
+    // Whether the string/binary content of size nLen can be appended to
+    // the array, without exceeding the memory limit.
+    const auto CanAppend = [nMemLimit, out_array](int iArrowField, int iFeat,
+                                                  size_t nLen)
+    {
+        if (iFeat == 0)
+            return true;
+        const auto psArray = out_array->children[iArrowField];
+        const auto panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]);
+        const uint32_t nCurLength = static_cast<uint32_t>(panOffsets[iFeat]);
+        return !(nLen <= nMemLimit && nLen > nMemLimit - nCurLength);
+    };
+
+    int iFeat = 0;
+    while (iFeat < sHelper.m_nMaxBatchSize)
+    {
+        const int iRow = SelectNextArrowArrayRow();
+        if (iRow == -2)
+        {
+            m_bEOF = TRUE;
+            goto error;
+        }
+        if (iRow < 0)
+        {
+            m_bEOF = TRUE;
+            break;
+        }
+
+        anNullArrowFields.clear();
+
+        if (iGeomArrowField >= 0)
+        {
+            const OGRField *psField =
+                m_poLyrTable->GetFieldValue(m_iGeomFieldIdx);
+            if (psField == nullptr)
+            {
+                if (m_poFilterGeom != nullptr)
+                    continue;
+                anNullArrowFields.push_back(iGeomArrowField);
+            }
+            else
+            {
+                if (m_poFilterGeom != nullptr &&
+                    m_eSpatialIndexState != SPI_COMPLETED &&
+                    !m_poLyrTable->DoesGeometryIntersectsFilterEnvelope(
+                        psField))
+                {
+                    continue;
+                }
+
+                std::unique_ptr<OGRGeometry> poGeom(
+                    m_poGeomConverter->GetAsGeometry(psField));
+                if (poGeom != nullptr)
+                    poGeom.reset(PromoteToMultiGeometry(poGeom.release()));
+                if (m_poFilterGeom != nullptr && !FilterGeometry(poGeom.get()))
+                    continue;
+
+                if (poGeom == nullptr)
+                {
+                    anNullArrowFields.push_back(iGeomArrowField);
+                }
+                else
+                {
+                    const size_t nWKBSize = poGeom->WkbSize();
+                    if (!CanAppend(iGeomArrowField, iFeat, nWKBSize))
+                    {
+                        m_iArrowArrayPendingRow = iRow;
+                        break;
+                    }
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iGeomArrowField, iFeat, nWKBSize);
+                    if (outPtr == nullptr)
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+                }
+            }
+        }
+
+        bool bRowFits = true;
+        int iOGRIdx = 0;
+        for (int iGDBIdx = 0; iGDBIdx < nGDBFieldCount; iGDBIdx++)
+        {
+            if (iOGRIdx == m_iFIDAsRegularColumnIndex)
+                iOGRIdx++;
+
+            if (iGDBIdx == m_iGeomFieldIdx || iGDBIdx == iObjectIdFieldIdx)
+                continue;
+
+            const int iCurOGRIdx = iOGRIdx;
+            iOGRIdx++;
+            const int iArrowField =
+                sHelper.m_mapOGRFieldToArrowField[iCurOGRIdx];
+            if (iArrowField < 0)
+                continue;
+
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefn(iCurOGRIdx);
+            const auto eType = poFieldDefn->GetType();
+            const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+            if (psField == nullptr)
+            {
+                if (sHelper.m_abNullableFields[iCurOGRIdx])
+                    anNullArrowFields.push_back(iArrowField);
+                else if (eType == OFTString || eType == OFTBinary)
+                    sHelper.SetEmptyStringOrBinary(
+                        out_array->children[iArrowField], iFeat);
+                continue;
+            }
+
+            auto psArray = out_array->children[iArrowField];
+            switch (eType)
+            {
+                case OFTInteger:
+                {
+                    const auto eSubType = poFieldDefn->GetSubType();
+                    if (eSubType == OFSTBoolean)
+                    {
+                        if (psField->Integer)
+                            sHelper.SetBoolOn(psArray, iFeat);
+                    }
+                    else if (eSubType == OFSTInt16)
+                    {
+                        sHelper.SetInt16(
+                            psArray, iFeat,
+                            static_cast<int16_t>(psField->Integer));
+                    }
+                    else
+                    {
+                        sHelper.SetInt32(psArray, iFeat, psField->Integer);
+                    }
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    sHelper.SetInt64(psArray, iFeat, psField->Integer64);
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                    {
+                        sHelper.SetFloat(psArray, iFeat,
+                                         static_cast<float>(psField->Real));
+                    }
+                    else
+                    {
+                        sHelper.SetDouble(psArray, iFeat, psField->Real);
+                    }
+                    break;
+                }
+
+                case OFTString:
+                case OFTBinary:
+                {
+                    const GByte *pabyData;
+                    size_t nLen;
+                    if (eType == OFTString)
+                    {
+                        pabyData =
+                            reinterpret_cast<const GByte *>(psField->String);
+                        nLen = strlen(psField->String);
+                    }
+                    else
+                    {
+                        pabyData = psField->Binary.paData;
+                        nLen = static_cast<size_t>(psField->Binary.nCount);
+                    }
+                    if (!CanAppend(iArrowField, iFeat, nLen))
+                    {
+                        bRowFits = false;
+                        break;
+                    }
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                    {
+                        errorErrno = ENOMEM;
+                        goto error;
+                    }
+                    if (nLen)
+                        memcpy(outPtr, pabyData, nLen);
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    sHelper.SetDate(psArray, iFeat, brokenDown, *psField);
+                    break;
+                }
+
+                case OFTTime:
+                {
+                    sHelper.SetInt32(
+                        psArray, iFeat,
+                        psField->Date.Hour * 3600000 +
+                            psField->Date.Minute * 60000 +
+                            static_cast<int>(psField->Date.Second * 1000 +
+                                             0.5));
+                    break;
+                }
+
+                case OFTDateTime:
+                {
+                    OGRField sField = *psField;
+                    if (m_poLyrTable->GetField(iGDBIdx)->GetType() ==
+                        FGFT_DATETIME)
+                    {
+                        sField.Date.TZFlag = m_bTimeInUTC ? 100 : 0;
+                    }
+                    sHelper.SetDateTime(psArray, iFeat, brokenDown,
+                                        sHelper.m_anTZFlags[iCurOGRIdx],
+                                        sField);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+            if (!bRowFits)
+                break;
+        }
+        if (!bRowFits)
+        {
+            m_iArrowArrayPendingRow = iRow;
+            break;
+        }
+
+        // Nulls are only marked once the row is known to fit in the batch,
+        // as SetNull() updates the null_count of the arrays.
+        for (const int iArrowField : anNullArrowFields)
+        {
+            if (!sHelper.SetNull(iArrowField, iFeat))
+            {
+                errorErrno = ENOMEM;
+                goto error;
+            }
+        }
+
+        if (m_iFIDAsRegularColumnIndex >= 0)
+        {
+            const int iArrowField =
+                sHelper.m_mapOGRFieldToArrowField[m_iFIDAsRegularColumnIndex];
+            if (iArrowField >= 0)
+            {
+                auto psArray = out_array->children[iArrowField];
+                if (m_poFeatureDefn->GetFieldDefn(m_iFIDAsRegularColumnIndex)
+                        ->GetType() == OFTInteger64)
+                {
+                    sHelper.SetInt64(psArray, iFeat, iRow + 1);
+                }
+                else
+                {
+                    sHelper.SetInt32(psArray, iFeat, iRow + 1);
+                }
+            }
+        }
+
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = iRow + 1;
+
+        iFeat++;
+    }
+
+    sHelper.Shrink(iFeat);
+
+    if (out_array->length != 0 && bPostFilter)
+    {
+        struct ArrowSchema schema;
+        stream->get_schema(stream, &schema);
+        CPLAssert(schema.release != nullptr);
+        CPLAssert(schema.n_children == out_array->n_children);
+        // Spatial filter already evaluated
+        auto poFilterGeomBackup = m_poFilterGeom;
+        m_poFilterGeom = nullptr;
+        PostFilterArrowArray(&schema, out_array, nullptr);
+        schema.release(&schema);
+        m_poFilterGeom = poFilterGeomBackup;
+    }
+
+    if (out_array->length == 0)
+    {
+        if (out_array->release)
+            out_array->release(out_array);
+        memset(out_array, 0, sizeof(*out_array));
+
+        if (!m_bEOF)
+        {
+            goto begin;
+        }
+    }
+
+    return 0;
+
+error:
+    sHelper.ClearArray();
+    return errorErrno;
+}
+
+/************************************************************************/
+/*            ArrowArrayPrefetchTask::~ArrowArrayPrefetchTask()         */
+/************************************************************************/
+
+OGROpenFileGDBLayer::ArrowArrayPrefetchTask::~ArrowArrayPrefetchTask()
+{
+    if (m_oThread.joinable())
+        m_oThread.join();
+    for (auto &sArray : m_asArrays)
+    {
+        if (sArray.release)
+            sArray.release(&sArray);
+    }
+    if (m_sStream.release)
+        m_sStream.release(&m_sStream);
+}
+
+/************************************************************************/
+/*                    CancelAsyncNextArrowArray()                       */
+/************************************************************************/
+
+void OGROpenFileGDBLayer::CancelAsyncNextArrowArray()
+{
+    // Destroying the tasks waits for their thread to be finished
+    while (!m_oQueueArrowArrayPrefetchTasks.empty())
+        m_oQueueArrowArrayPrefetchTasks.pop();
+
+    for (auto &sArray : m_asArrowArrayPrefetchReady)
+    {
+        if (sArray.release)
+            sArray.release(&sArray);
+    }
+    m_asArrowArrayPrefetchReady.clear();
+
+    m_anArrowArrayRows.clear();
+    m_bArrowArrayUseRowList = false;
+    m_iArrowArrayNextRow = 0;
+    m_iArrowArrayPendingRow = -1;
+    m_nArrowArrayPrefetchCandidates = 0;
+    m_iArrowArrayPrefetchNextCandidate = 0;
+    m_bArrowArrayPrefetchTried = false;
+}
+
+/************************************************************************/
+/*                   StartArrowArrayPrefetchTasks()                     */
+/************************************************************************/
+
+// Start worker threads, each one operating on its own dataset, and decoding
+// successive ranges of candidate rows into ArrowArrays.
+void OGROpenFileGDBLayer::StartArrowArrayPrefetchTasks()
+{
+    m_bArrowArrayPrefetchTried = true;
+
+    // Only at the start of an iteration of a read-only layer
+    if (m_bEditable || m_bEOF || m_iArrowArrayPendingRow >= 0 ||
+        m_bArrowArrayUseRowList || m_iCurFeat != 0)
+    {
+        return;
+    }
+
+    const char *pszMaxThreads =
+        CPLGetConfigOption("OGR_OPENFILEGDB_NUM_THREADS", nullptr);
+    const int nMaxThreads =
+        pszMaxThreads == nullptr        ? std::min(4, CPLGetNumCPUs())
+        : EQUAL(pszMaxThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                           : atoi(pszMaxThreads);
+    if (nMaxThreads < 2 || CPLGetUsablePhysicalRAM() <= 1024 * 1024 * 1024)
+        return;
+
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        m_aosArrowArrayStreamOptions);
+    // Not worth it if everything fits in a single batch (estimated from
+    // the total number of rows, before consuming any index)
+    if (m_poLyrTable->GetValidRecordCount() <= nMaxBatchSize)
+        return;
+
+    // Use the spatial and attribute indices to select candidate rows
+    FileGDBIterator *poIterator = m_poCombinedIterator ? m_poCombinedIterator
+                                  : m_poSpatialIndexIterator
+                                      ? m_poSpatialIndexIterator
+                                      : m_poAttributeIterator;
+    int nCandidates = m_poLyrTable->GetTotalRecordCount();
+    if (m_nFilteredFeatureCount >= 0)
+    {
+        for (int i = 0; i < m_nFilteredFeatureCount; ++i)
+        {
+            m_anArrowArrayRows.push_back(static_cast<int>(
+                reinterpret_cast<GUIntptr_t>(m_pahFilteredFeatures[i])));
+        }
+        m_bArrowArrayUseRowList = true;
+    }
+    else if (poIterator != nullptr)
+    {
+        while (true)
+        {
+            const int iRow = poIterator->GetNextRowSortedByFID();
+            if (iRow < 0)
+                break;
+            m_anArrowArrayRows.push_back(iRow);
+        }
+        m_bArrowArrayUseRowList = true;
+    }
+    if (m_bArrowArrayUseRowList)
+    {
+        // If no task can be started, or a single one would be used, the rows
+        // are decoded from m_anArrowArrayRows by this layer.
+        m_iArrowArrayNextRow = 0;
+        nCandidates = static_cast<int>(m_anArrowArrayRows.size());
+    }
+    if (nCandidates <= nMaxBatchSize)
+        return;
+
+    const int nTasks = static_cast<int>(std::min<GIntBig>(
+        DIV_ROUND_UP(static_cast<GIntBig>(nCandidates), nMaxBatchSize),
+        nMaxThreads));
+    CPLDebug("OpenFileGDB", "Using %d threads", nTasks);
+
+    GDALOpenInfo oOpenInfo(m_poDS->GetName(), GA_ReadOnly);
+    oOpenInfo.papszOpenOptions = m_poDS->GetOpenOptions();
+    oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
+    std::queue<std::unique_ptr<ArrowArrayPrefetchTask>> oQueueTasks;
+    for (int iTask = 0; iTask < nTasks; ++iTask)
+    {
+        auto task = std::make_unique<ArrowArrayPrefetchTask>();
+        task->m_poDS = std::make_unique<OGROpenFileGDBDataSource>();
+        bool bRetryFileGDBUnused = false;
+        if (!task->m_poDS->Open(&oOpenInfo, bRetryFileGDBUnused))
+            break;
+        auto poOtherLayer = task->m_poDS->GetLayerByName(GetName());
+        if (poOtherLayer == nullptr || !poOtherLayer->BuildLayerDefinition() ||
+            poOtherLayer->GetLayerDefn()->GetFieldCount() !=
+                m_poFeatureDefn->GetFieldCount() ||
+            poOtherLayer->GetLayerDefn()->GetGeomFieldCount() !=
+                m_poFeatureDefn->GetGeomFieldCount())
+        {
+            break;
+        }
+        poOtherLayer->m_bIsArrowArrayPrefetchWorker = true;
+
+        auto poOtherFDefn = poOtherLayer->GetLayerDefn();
+        for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+        {
+            poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
+                m_poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
+        }
+        for (int i = 0; i < m_poFeatureDefn->GetFieldCount(); ++i)
+        {
+            poOtherFDefn->GetFieldDefn(i)->SetIgnored(
+                m_poFeatureDefn->GetFieldDefn(i)->IsIgnored());
+        }
+        if (m_pszAttrQueryString &&
+            poOtherLayer->SetAttributeFilter(m_pszAttrQueryString) !=
+                OGRERR_NONE)
+        {
+            break;
+        }
+        if (m_poFilterGeom)
+            poOtherLayer->SetSpatialFilter(m_poFilterGeom);
+
+        task->m_poLayer = poOtherLayer;
+        oQueueTasks.push(std::move(task));
+    }
+
+    // Only start the threads once all workers are ready, so that on failure
+    // this layer can still decode all candidate rows itself.
+    if (static_cast<int>(oQueueTasks.size()) != nTasks)
+        return;
+
+    m_nArrowArrayPrefetchCandidates = nCandidates;
+    m_iArrowArrayPrefetchNextCandidate = 0;
+    while (!oQueueTasks.empty())
+    {
+        auto task = std::move(oQueueTasks.front());
+        oQueueTasks.pop();
+        if (!LaunchArrowArrayPrefetchTask(task.get()))
+            break;
+        m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
+    }
+
+    if (m_oQueueArrowArrayPrefetchTasks.empty())
+    {
+        m_nArrowArrayPrefetchCandidates = 0;
+        m_iArrowArrayPrefetchNextCandidate = 0;
+    }
+}
+
+/************************************************************************/
+/*                   LaunchArrowArrayPrefetchTask()                     */
+/************************************************************************/
+
+// Assign the next range of candidate rows to the task and start its thread
+bool OGROpenFileGDBLayer::LaunchArrowArrayPrefetchTask(
+    ArrowArrayPrefetchTask *task)
+{
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        m_aosArrowArrayStreamOptions);
+    task->m_iFirstCandidate = m_iArrowArrayPrefetchNextCandidate;
+    task->m_iLastCandidate =
+        task->m_iFirstCandidate +
+        std::min(nMaxBatchSize,
+                 m_nArrowArrayPrefetchCandidates - task->m_iFirstCandidate);
+    task->m_osErrorMsg.clear();
+    try
+    {
+        task->m_oThread =
+            std::thread([this, task]() { RunArrowArrayPrefetchTask(task); });
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot start worker thread: %s",
+                 e.what());
+        return false;
+    }
+    m_iArrowArrayPrefetchNextCandidate = task->m_iLastCandidate;
+    return true;
+}
+
+/************************************************************************/
+/*                    RunArrowArrayPrefetchTask()                       */
+/************************************************************************/
+
+// Executed in a worker thread. Only accesses the layer of the task, and
+// read-only members of this layer.
+void OGROpenFileGDBLayer::RunArrowArrayPrefetchTask(
+    ArrowArrayPrefetchTask *task) const
+{
+    OGROpenFileGDBLayer *poLayer = task->m_poLayer;
+
+    // A new stream is needed for each range, since the end of the previous
+    // one was reached.
+    if (task->m_sStream.release)
+        task->m_sStream.release(&task->m_sStream);
+    if (!poLayer->GetArrowStream(&task->m_sStream,
+                                 m_aosArrowArrayStreamOptions.List()))
+    {
+        task->m_osErrorMsg = CPLGetLastErrorMsg();
+        if (task->m_osErrorMsg.empty())
+            task->m_osErrorMsg = "Cannot create worker ArrowArrayStream";
+        return;
+    }
+
+    // Restrict the worker layer to its range of candidate rows
+    if (m_bArrowArrayUseRowList)
+    {
+        poLayer->m_anArrowArrayRows.assign(
+            m_anArrowArrayRows.begin() + task->m_iFirstCandidate,
+            m_anArrowArrayRows.begin() + task->m_iLastCandidate);
+        poLayer->m_iArrowArrayNextRow = 0;
+        poLayer->m_bArrowArrayUseRowList = true;
+    }
+    else
+    {
+        poLayer->m_iCurFeat = task->m_iFirstCandidate;
+        poLayer->m_nArrowArrayEndRow = task->m_iLastCandidate;
+    }
+
+    while (true)
+    {
+        struct ArrowArray sArray;
+        memset(&sArray, 0, sizeof(sArray));
+        if (task->m_sStream.get_next(&task->m_sStream, &sArray) != 0)
+        {
+            const char *pszErrorMsg =
+                task->m_sStream.get_last_error(&task->m_sStream);
+            task->m_osErrorMsg =
+                pszErrorMsg && pszErrorMsg[0] ? pszErrorMsg
+                                              : "Worker get_next() failed";
+            break;
+        }
+        if (sArray.release == nullptr)
+            break;
+        task->m_asArrays.push_back(sArray);
+    }
+}
+
+/************************************************************************/
+/*                   GetNextArrowArrayAsynchronous()                    */
+/************************************************************************/
+
+int OGROpenFileGDBLayer::GetNextArrowArrayAsynchronous(
+    struct ArrowArrayStream *, struct ArrowArray *out_array)
+{
+    memset(out_array, 0, sizeof(*out_array));
+    while (m_asArrowArrayPrefetchReady.empty())
+    {
+        if (m_oQueueArrowArrayPrefetchTasks.empty())
+        {
+            if (m_iArrowArrayPrefetchNextCandidate <
+                m_nArrowArrayPrefetchCandidates)
+            {
+                // All worker threads failed to be restarted
+                CancelAsyncNextArrowArray();
+                m_bArrowArrayPrefetchTried = true;
+                m_bEOF = TRUE;
+                return EIO;
+            }
+            return 0;
+        }
+
+        // Tasks are queued in the order of their range of rows
+        auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
+        m_oQueueArrowArrayPrefetchTasks.pop();
+        task->m_oThread.join();
+        if (!task->m_osErrorMsg.empty())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     task->m_osErrorMsg.c_str());
+            CancelAsyncNextArrowArray();
+            m_bArrowArrayPrefetchTried = true;
+            m_bEOF = TRUE;
+            return EIO;
+        }
+        for (const auto &sArray : task->m_asArrays)
+            m_asArrowArrayPrefetchReady.push_back(sArray);
+        task->m_asArrays.clear();
+
+        // Recycle the task for the next range of rows, if any
+        if (m_iArrowArrayPrefetchNextCandidate <
+                m_nArrowArrayPrefetchCandidates &&
+            LaunchArrowArrayPrefetchTask(task.get()))
+        {
+            m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
+        }
+    }
+
+    memcpy(out_array, &m_asArrowArrayPrefetchReady.front(),
+           sizeof(*out_array));
+    m_asArrowArrayPrefetchReady.pop_front();
+    return 0;
+}
+
 /***********************************************************************/
 /*                          GetFeature()                               */
 /***********************************************************************/
@@ -1986,6 +2821,8 @@ OGRErr OGROpenFileGDBLayer::SetNextByIndex(GIntBig nIndex)
     if (!BuildLayerDefinition())
         return OGRERR_FAILURE;
 
+    CancelAsyncNextArrowArray();
+
     if (m_eSpatialIndexState == SPI_IN_BUILDING)
         m_eSpatialIndexState = SPI_INVALID;
 
@@ -2260,6 +3097,11 @@ int OGROpenFileGDBLayer::TestCapability(const char *pszCap)
     {
         return TRUE;
     }
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+    {
+        return m_iFieldToReadAsBinary < 0 &&
+               !m_poLyrTable->HasDeletedFeaturesListed();
+    }
     else if (EQUAL(pszCap, OLCFastGetExtent))
     {
         return TRUE;
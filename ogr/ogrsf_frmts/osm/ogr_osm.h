@@ -35,6 +35,7 @@
 
 #include "ogrsf_frmts.h"
 #include "cpl_string.h"
+#include "cpl_virtualmem.h"
 
 #include <array>
 #include <set>
@@ -427,6 +428,12 @@ class OGROSMDataSource final : public OGRDataSource
 
     std::vector<LonLat> m_asLonLatCache{};
 
+    // Resolved nodes and geometries of the ways of the current batch, when
+    // computed in worker threads.
+    int m_nNumThreads = 1;
+    std::vector<std::vector<LonLat>> m_aasWayLonLat{};
+    std::vector<std::unique_ptr<OGRLineString>> m_apoWayGeoms{};
+
     std::array<const char *, 7> m_ignoredKeys = {{"area", "created_by",
                                                   "converted_by", "note",
                                                   "todo", "fixme", "FIXME"}};
@@ -512,6 +519,32 @@ class OGROSMDataSource final : public OGRDataSource
     std::map<int, Bucket> m_oMapBuckets{};
     Bucket *GetBucket(int nBucketId);
 
+    // Dense nodes index (DENSE_NODES_INDEX_FILE open option): the
+    // coordinates of the node of id N are stored at offset
+    // DENSE_NODES_INDEX_HEADER_SIZE + N * sizeof(LonLat) of a sparse file,
+    // that is memory-mapped by segments when possible.
+    bool m_bDenseNodesIndex = false;
+    // Whether the index file is the complete one of a previous run on the
+    // same file, and is thus used read-only.
+    bool m_bDenseNodesIndexReused = false;
+    bool m_bDenseNodesIndexMMap = false;
+    // Whether no node has been skipped from indexing in the current pass
+    bool m_bAllNodesIndexed = true;
+    CPLString m_osDenseNodesIndexFilename{};
+    VSILFILE *m_fpDenseNodesIndex = nullptr;
+    vsi_l_offset m_nDenseNodesIndexFileSize = 0;
+    std::map<GIntBig, CPLVirtualMem *> m_oMapDenseNodesIndexSegments{};
+    GIntBig m_nLastDenseNodesIndexSegment = -1;
+    LonLat *m_pasLastDenseNodesIndexSegment = nullptr;
+    size_t m_nLastDenseNodesIndexSegmentNodes = 0;
+
+    bool OpenDenseNodesIndex(const char *pszIndexFilename);
+    void CloseDenseNodesIndex();
+    bool WriteDenseNodesIndexHeader(bool bComplete);
+    LonLat *GetDenseNodesIndexSegment(GIntBig iSegment, size_t &nNodes);
+    bool IndexPointDense(OSMNode *psNode);
+    void LookupNodesDense();
+
     bool m_bNeedsToSaveWayInfo = false;
 
     static const GIntBig FILESIZE_NOT_INIT = -2;
@@ -546,7 +579,9 @@ class OGROSMDataSource final : public OGRDataSource
     bool StartTransactionCacheDB();
     bool CommitTransactionCacheDB();
 
-    int FindNode(GIntBig nID);
+    int FindNode(GIntBig nID) const;
+    void ResolveWayNodes(const WayFeaturePair *psWayFeaturePairs,
+                         std::vector<LonLat> &asLonLat) const;
     void ProcessWaysBatch();
 
     void ProcessPolygonsStandalone();
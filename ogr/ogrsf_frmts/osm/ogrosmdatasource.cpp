@@ -56,6 +56,8 @@
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -98,6 +100,15 @@ static bool VALID_ID_FOR_CUSTOM_INDEXING(GIntBig _id)
     return _id >= 0 && _id / NODE_PER_BUCKET < INT_MAX;
 }
 
+// Size of the header of the dense nodes index file
+constexpr int DENSE_NODES_INDEX_HEADER_SIZE = 4096;
+constexpr char DENSE_NODES_INDEX_SIGNATURE[] = "GDAL_OSM_DENSE_NODES_INDEX_1";
+// Number of nodes of a memory-mapped segment of the dense nodes index (128 MB)
+constexpr GIntBig DENSE_NODES_INDEX_NODES_PER_SEGMENT = 1 << 24;
+// Ids of nodes are currently ~ 1.2e10, so this leaves some room.
+constexpr GIntBig DENSE_NODES_INDEX_MAX_NODE_ID = static_cast<GIntBig>(1)
+                                                  << 40;
+
 // Minimum size of data written on disk, in *uncompressed* case.
 constexpr int SECTOR_SIZE = 512;
 // Which represents, 64 nodes
@@ -313,6 +324,8 @@ OGROSMDataSource::~OGROSMDataSource()
         }
     }
 
+    CloseDenseNodesIndex();
+
     if (m_fpNodes)
         VSIFCloseL(m_fpNodes);
     if (!m_osNodesFilename.empty() && m_bMustUnlinkNodesFile)
@@ -417,7 +430,13 @@ constexpr GByte abyBitsCount[] = {
 bool OGROSMDataSource::IndexPoint(OSMNode *psNode)
 {
     if (!m_bIndexPoints)
+    {
+        m_bAllNodesIndexed = false;
         return true;
+    }
+
+    if (m_bDenseNodesIndex)
+        return IndexPointDense(psNode);
 
     if (m_bCustomIndexing)
         return IndexPointCustom(psNode);
@@ -722,6 +741,280 @@ bool OGROSMDataSource::IndexPointCustom(OSMNode *psNode)
     return true;
 }
 
+/************************************************************************/
+/*                     BuildDenseNodesIndexHeader()                     */
+/************************************************************************/
+
+// The header is made of the signature (NUL padded to 32 bytes), a byte order
+// marker (uint32), a completeness flag (uint32), and the size (uint64) and
+// modification time (int64) of the OSM file, all in native byte order.
+// The index of a file whose size and modification time cannot be determined
+// is never reused.
+static bool BuildDenseNodesIndexHeader(const char *pszOSMFilename,
+                                       bool bComplete, GByte *pabyHeader)
+{
+    memset(pabyHeader, 0, DENSE_NODES_INDEX_HEADER_SIZE);
+    memcpy(pabyHeader, DENSE_NODES_INDEX_SIGNATURE,
+           sizeof(DENSE_NODES_INDEX_SIGNATURE));
+    const uint32_t nByteOrder = 0x01020304U;
+    memcpy(pabyHeader + 32, &nByteOrder, sizeof(nByteOrder));
+    const uint32_t nComplete = bComplete ? 1 : 0;
+    memcpy(pabyHeader + 36, &nComplete, sizeof(nComplete));
+
+    VSIStatBufL sStat;
+    if (VSIStatL(pszOSMFilename, &sStat) != 0)
+        return false;
+    const uint64_t nSize = static_cast<uint64_t>(sStat.st_size);
+    memcpy(pabyHeader + 40, &nSize, sizeof(nSize));
+    const int64_t nMTime = static_cast<int64_t>(sStat.st_mtime);
+    memcpy(pabyHeader + 48, &nMTime, sizeof(nMTime));
+    return true;
+}
+
+/************************************************************************/
+/*                         OpenDenseNodesIndex()                        */
+/************************************************************************/
+
+bool OGROSMDataSource::OpenDenseNodesIndex(const char *pszIndexFilename)
+{
+    m_bDenseNodesIndex = true;
+    m_osDenseNodesIndexFilename = pszIndexFilename;
+
+    std::vector<GByte> abyExpectedHeader(DENSE_NODES_INDEX_HEADER_SIZE);
+    const bool bCanBeReused = BuildDenseNodesIndexHeader(
+        m_pszName, /* bComplete = */ true, abyExpectedHeader.data());
+
+    VSIStatBufL sStat;
+    if (VSIStatL(pszIndexFilename, &sStat) == 0)
+    {
+        m_fpDenseNodesIndex = VSIFOpenL(pszIndexFilename, "rb");
+        if (m_fpDenseNodesIndex == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s",
+                     pszIndexFilename);
+            return false;
+        }
+        std::vector<GByte> abyHeader(DENSE_NODES_INDEX_HEADER_SIZE);
+        if (VSIFReadL(abyHeader.data(), 1, abyHeader.size(),
+                      m_fpDenseNodesIndex) != abyHeader.size() ||
+            memcmp(abyHeader.data(), DENSE_NODES_INDEX_SIGNATURE,
+                   sizeof(DENSE_NODES_INDEX_SIGNATURE)) != 0)
+        {
+            // Do not overwrite a file that is not ours
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "%s exists but is not a dense nodes index file",
+                     pszIndexFilename);
+            VSIFCloseL(m_fpDenseNodesIndex);
+            m_fpDenseNodesIndex = nullptr;
+            return false;
+        }
+        if (bCanBeReused && abyHeader == abyExpectedHeader)
+        {
+            CPLDebug("OSM", "Reusing dense nodes index %s", pszIndexFilename);
+            m_bDenseNodesIndexReused = true;
+            m_nDenseNodesIndexFileSize = sStat.st_size;
+        }
+        else
+        {
+            CPLDebug("OSM",
+                     "Dense nodes index %s is incomplete or does not match "
+                     "%s. Rebuilding it",
+                     pszIndexFilename, m_pszName);
+            VSIFCloseL(m_fpDenseNodesIndex);
+            m_fpDenseNodesIndex = nullptr;
+        }
+    }
+
+    if (m_fpDenseNodesIndex == nullptr)
+    {
+        m_fpDenseNodesIndex = VSIFOpenL(pszIndexFilename, "wb+");
+        if (m_fpDenseNodesIndex == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     pszIndexFilename);
+            return false;
+        }
+        if (!WriteDenseNodesIndexHeader(false))
+            return false;
+    }
+
+    // Memory-mapping segments of 128 MB only makes sense on 64 bit
+    m_bDenseNodesIndexMMap =
+        sizeof(void *) == 8 && CPLIsVirtualMemFileMapAvailable() &&
+        VSIFGetNativeFileDescriptorL(m_fpDenseNodesIndex) != nullptr;
+
+    return true;
+}
+
+/************************************************************************/
+/*                         CloseDenseNodesIndex()                       */
+/************************************************************************/
+
+void OGROSMDataSource::CloseDenseNodesIndex()
+{
+    for (auto &oIter : m_oMapDenseNodesIndexSegments)
+    {
+        if (oIter.second)
+            CPLVirtualMemFree(oIter.second);
+    }
+    m_oMapDenseNodesIndexSegments.clear();
+    m_nLastDenseNodesIndexSegment = -1;
+    m_pasLastDenseNodesIndexSegment = nullptr;
+    m_nLastDenseNodesIndexSegmentNodes = 0;
+
+    if (m_fpDenseNodesIndex)
+        VSIFCloseL(m_fpDenseNodesIndex);
+    m_fpDenseNodesIndex = nullptr;
+}
+
+/************************************************************************/
+/*                       WriteDenseNodesIndexHeader()                   */
+/************************************************************************/
+
+bool OGROSMDataSource::WriteDenseNodesIndexHeader(bool bComplete)
+{
+    std::vector<GByte> abyHeader(DENSE_NODES_INDEX_HEADER_SIZE);
+    if (!BuildDenseNodesIndexHeader(m_pszName, bComplete, abyHeader.data()) &&
+        bComplete)
+    {
+        return true;
+    }
+    if (VSIFSeekL(m_fpDenseNodesIndex, 0, SEEK_SET) != 0 ||
+        VSIFWriteL(abyHeader.data(), 1, abyHeader.size(),
+                   m_fpDenseNodesIndex) != abyHeader.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write header of %s",
+                 m_osDenseNodesIndexFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       GetDenseNodesIndexSegment()                    */
+/************************************************************************/
+
+// Return the memory mapping of a segment of the dense nodes index, and its
+// number of nodes in nNodes (which may be less than
+// DENSE_NODES_INDEX_NODES_PER_SEGMENT for the last segment of a reused
+// index), or nullptr.
+LonLat *OGROSMDataSource::GetDenseNodesIndexSegment(GIntBig iSegment,
+                                                    size_t &nNodes)
+{
+    if (iSegment != m_nLastDenseNodesIndexSegment)
+    {
+        CPLVirtualMem *psVMem = nullptr;
+        const auto oIter = m_oMapDenseNodesIndexSegments.find(iSegment);
+        if (oIter != m_oMapDenseNodesIndexSegments.end())
+        {
+            psVMem = oIter->second;
+        }
+        else
+        {
+            constexpr vsi_l_offset nSegmentSize =
+                DENSE_NODES_INDEX_NODES_PER_SEGMENT * sizeof(LonLat);
+            const vsi_l_offset nOffset =
+                DENSE_NODES_INDEX_HEADER_SIZE +
+                static_cast<vsi_l_offset>(iSegment) * nSegmentSize;
+            vsi_l_offset nLength = nSegmentSize;
+            if (m_bDenseNodesIndexReused)
+            {
+                // Read-only mappings cannot extend the file
+                nLength = nOffset < m_nDenseNodesIndexFileSize
+                              ? std::min(nLength,
+                                         m_nDenseNodesIndexFileSize - nOffset)
+                              : 0;
+                nLength = nLength / sizeof(LonLat) * sizeof(LonLat);
+            }
+            else if (nOffset + nLength > m_nDenseNodesIndexFileSize)
+            {
+                // Extend the (sparse) file before mapping it, as accessing
+                // the mapping beyond the end of file would raise SIGBUS.
+                if (VSIFTruncateL(m_fpDenseNodesIndex, nOffset + nLength) == 0)
+                    m_nDenseNodesIndexFileSize = nOffset + nLength;
+                else
+                    nLength = 0;
+            }
+            if (nLength > 0)
+            {
+                psVMem = CPLVirtualMemFileMapNew(
+                    m_fpDenseNodesIndex, nOffset, nLength,
+                    m_bDenseNodesIndexReused ? VIRTUALMEM_READONLY
+                                             : VIRTUALMEM_READWRITE,
+                    nullptr, nullptr);
+            }
+            m_oMapDenseNodesIndexSegments[iSegment] = psVMem;
+        }
+
+        m_nLastDenseNodesIndexSegment = iSegment;
+        m_pasLastDenseNodesIndexSegment =
+            psVMem ? static_cast<LonLat *>(CPLVirtualMemGetAddr(psVMem))
+                   : nullptr;
+        m_nLastDenseNodesIndexSegmentNodes =
+            psVMem ? CPLVirtualMemGetSize(psVMem) / sizeof(LonLat) : 0;
+    }
+    nNodes = m_nLastDenseNodesIndexSegmentNodes;
+    return m_pasLastDenseNodesIndexSegment;
+}
+
+/************************************************************************/
+/*                           IndexPointDense()                          */
+/************************************************************************/
+
+bool OGROSMDataSource::IndexPointDense(OSMNode *psNode)
+{
+    if (m_bDenseNodesIndexReused)
+        return true;
+
+    if (psNode->nID < 0 || psNode->nID >= DENSE_NODES_INDEX_MAX_NODE_ID)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unsupported node id value (" CPL_FRMT_GIB
+                 ") for the dense nodes index",
+                 psNode->nID);
+        m_bStopParsing = true;
+        return false;
+    }
+
+    LonLat sLonLat;
+    sLonLat.nLon = DBL_TO_INT(psNode->dfLon);
+    sLonLat.nLat = DBL_TO_INT(psNode->dfLat);
+
+    if (m_bDenseNodesIndexMMap)
+    {
+        size_t nNodes = 0;
+        LonLat *pasSegment = GetDenseNodesIndexSegment(
+            psNode->nID / DENSE_NODES_INDEX_NODES_PER_SEGMENT, nNodes);
+        if (pasSegment == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot map dense nodes index %s",
+                     m_osDenseNodesIndexFilename.c_str());
+            m_bStopParsing = true;
+            return false;
+        }
+        pasSegment[psNode->nID % DENSE_NODES_INDEX_NODES_PER_SEGMENT] =
+            sLonLat;
+        return true;
+    }
+
+    // Holes are left for missing ids: this creates a sparse file on
+    // file systems supporting them.
+    if (VSIFSeekL(m_fpDenseNodesIndex,
+                  DENSE_NODES_INDEX_HEADER_SIZE +
+                      static_cast<vsi_l_offset>(psNode->nID) * sizeof(LonLat),
+                  SEEK_SET) != 0 ||
+        VSIFWriteL(&sLonLat, sizeof(LonLat), 1, m_fpDenseNodesIndex) != 1)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot write in dense nodes index %s : %s",
+                 m_osDenseNodesIndexFilename.c_str(), VSIStrerror(errno));
+        m_bStopParsing = true;
+        return false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                             NotifyNodes()                            */
 /************************************************************************/
@@ -739,7 +1032,10 @@ void OGROSMDataSource::NotifyNodes(unsigned int nNodes, OSMNode *pasNodes)
                                        pasNodes[i].dfLon <= psEnvelope->MaxX &&
                                        pasNodes[i].dfLat >= psEnvelope->MinY &&
                                        pasNodes[i].dfLat <= psEnvelope->MaxY))
+        {
+            m_bAllNodesIndexed = false;
             continue;
+        }
 
         if (!IndexPoint(&pasNodes[i]))
             break;
@@ -802,7 +1098,9 @@ static void OGROSMNotifyNodes(unsigned int nNodes, OSMNode *pasNodes,
 
 void OGROSMDataSource::LookupNodes()
 {
-    if (m_bCustomIndexing)
+    if (m_bDenseNodesIndex)
+        LookupNodesDense();
+    else if (m_bCustomIndexing)
         LookupNodesCustom();
     else
         LookupNodesSQLite();
@@ -1298,6 +1596,99 @@ void OGROSMDataSource::LookupNodesCustomNonCompressedCase()
     m_nReqIds = j;
 }
 
+/************************************************************************/
+/*                          LookupNodesDense()                          */
+/************************************************************************/
+
+void OGROSMDataSource::LookupNodesDense()
+{
+    m_nReqIds = 0;
+    for (unsigned int i = 0; i < m_nUnsortedReqIds; i++)
+    {
+        const GIntBig id = m_panUnsortedReqIds[i];
+        if (id >= 0 && id < DENSE_NODES_INDEX_MAX_NODE_ID)
+            m_panReqIds[m_nReqIds++] = id;
+    }
+
+    std::sort(m_panReqIds, m_panReqIds + m_nReqIds);
+
+    /* Remove duplicates */
+    unsigned int j = 0;  // Used after for.
+    for (unsigned int i = 0; i < m_nReqIds; i++)
+    {
+        if (!(i > 0 && m_panReqIds[i] == m_panReqIds[i - 1]))
+            m_panReqIds[j++] = m_panReqIds[i];
+    }
+    m_nReqIds = j;
+
+    // When the index is not memory-mapped, do reads aligned on 4096 byte
+    // offsets, as in LookupNodesCustomNonCompressedCase()
+    constexpr int knDISK_SECTOR_SIZE = 4096;
+    static_assert((DENSE_NODES_INDEX_HEADER_SIZE % knDISK_SECTOR_SIZE) == 0);
+    GByte abyDiskSector[knDISK_SECTOR_SIZE];
+    // Offset in the index file for which abyDiskSector was read
+    vsi_l_offset nOldOffset = 0;
+    // Number of valid bytes in abyDiskSector
+    size_t nValidBytes = 0;
+
+    j = 0;
+    for (unsigned int i = 0; i < m_nReqIds; i++)
+    {
+        const GIntBig id = m_panReqIds[i];
+        LonLat sLonLat;
+        sLonLat.nLon = 0;
+        sLonLat.nLat = 0;
+
+        if (m_bDenseNodesIndexMMap)
+        {
+            size_t nNodes = 0;
+            const LonLat *pasSegment = GetDenseNodesIndexSegment(
+                id / DENSE_NODES_INDEX_NODES_PER_SEGMENT, nNodes);
+            const size_t nIdxInSegment =
+                static_cast<size_t>(id % DENSE_NODES_INDEX_NODES_PER_SEGMENT);
+            if (pasSegment && nIdxInSegment < nNodes)
+                sLonLat = pasSegment[nIdxInSegment];
+        }
+        else
+        {
+            const vsi_l_offset nOffset =
+                DENSE_NODES_INDEX_HEADER_SIZE +
+                static_cast<vsi_l_offset>(id) * sizeof(LonLat);
+            const vsi_l_offset nAlignedOffset =
+                nOffset &
+                ~(static_cast<vsi_l_offset>(knDISK_SECTOR_SIZE) - 1);
+            if (nAlignedOffset != nOldOffset)
+            {
+                nValidBytes = 0;
+                if (VSIFSeekL(m_fpDenseNodesIndex, nAlignedOffset, SEEK_SET) ==
+                    0)
+                {
+                    nValidBytes = VSIFReadL(abyDiskSector, 1,
+                                            knDISK_SECTOR_SIZE,
+                                            m_fpDenseNodesIndex);
+                }
+                nOldOffset = nAlignedOffset;
+            }
+            const size_t nOffsetInDiskSector =
+                static_cast<size_t>(nOffset - nAlignedOffset);
+            if (nOffsetInDiskSector + sizeof(LonLat) <= nValidBytes)
+            {
+                memcpy(&sLonLat, abyDiskSector + nOffsetInDiskSector,
+                       sizeof(LonLat));
+            }
+        }
+
+        // Holes of the index, that is missing nodes, are read as zeroes
+        if (sLonLat.nLon || sLonLat.nLat)
+        {
+            m_panReqIds[j] = id;
+            m_pasLonLatArray[j] = sLonLat;
+            j++;
+        }
+    }
+    m_nReqIds = j;
+}
+
 /************************************************************************/
 /*                            WriteVarInt()                             */
 /************************************************************************/
@@ -1597,7 +1988,7 @@ void OGROSMDataSource::IndexWay(GIntBig nWayID, bool bIsArea,
 /*                              FindNode()                              */
 /************************************************************************/
 
-int OGROSMDataSource::FindNode(GIntBig nID)
+int OGROSMDataSource::FindNode(GIntBig nID) const
 {
     if (m_nReqIds == 0)
         return -1;
@@ -1617,97 +2008,161 @@ int OGROSMDataSource::FindNode(GIntBig nID)
 }
 
 /************************************************************************/
-/*                         ProcessWaysBatch()                           */
+/*                          ResolveWayNodes()                           */
 /************************************************************************/
 
-void OGROSMDataSource::ProcessWaysBatch()
+// Only reads the nodes looked up by LookupNodes(), so it can be called
+// from several threads for different ways.
+void OGROSMDataSource::ResolveWayNodes(const WayFeaturePair *psWayFeaturePairs,
+                                       std::vector<LonLat> &asLonLat) const
 {
-    if (m_nWayFeaturePairs == 0)
-        return;
-
-    // printf("nodes = %d, features = %d\n", nUnsortedReqIds, nWayFeaturePairs);
-    LookupNodes();
-
-    for (int iPair = 0; iPair < m_nWayFeaturePairs; iPair++)
-    {
-        WayFeaturePair *psWayFeaturePairs = &m_pasWayFeaturePairs[iPair];
-
-        const bool bIsArea = psWayFeaturePairs->bIsArea;
-        m_asLonLatCache.clear();
+    asLonLat.clear();
 
 #ifdef ENABLE_NODE_LOOKUP_BY_HASHING
-        if (m_bHashedIndexValid)
+    if (m_bHashedIndexValid)
+    {
+        for (unsigned int i = 0; i < psWayFeaturePairs->nRefs; i++)
         {
-            for (unsigned int i = 0; i < psWayFeaturePairs->nRefs; i++)
+            int nIndInHashArray = static_cast<int>(
+                HASH_ID_FUNC(psWayFeaturePairs->panNodeRefs[i]) %
+                HASHED_INDEXES_ARRAY_SIZE);
+            int nIdx = m_panHashedIndexes[nIndInHashArray];
+            if (nIdx < -1)
             {
-                int nIndInHashArray = static_cast<int>(
-                    HASH_ID_FUNC(psWayFeaturePairs->panNodeRefs[i]) %
-                    HASHED_INDEXES_ARRAY_SIZE);
-                int nIdx = m_panHashedIndexes[nIndInHashArray];
-                if (nIdx < -1)
+                int iBucket = -nIdx - 2;
+                while (true)
                 {
-                    int iBucket = -nIdx - 2;
-                    while (true)
+                    nIdx = m_psCollisionBuckets[iBucket].nInd;
+                    if (m_panReqIds[nIdx] == psWayFeaturePairs->panNodeRefs[i])
+                        break;
+                    iBucket = m_psCollisionBuckets[iBucket].nNext;
+                    if (iBucket < 0)
                     {
-                        nIdx = m_psCollisionBuckets[iBucket].nInd;
-                        if (m_panReqIds[nIdx] ==
-                            psWayFeaturePairs->panNodeRefs[i])
-                            break;
-                        iBucket = m_psCollisionBuckets[iBucket].nNext;
-                        if (iBucket < 0)
-                        {
-                            nIdx = -1;
-                            break;
-                        }
+                        nIdx = -1;
+                        break;
                     }
                 }
-                else if (nIdx >= 0 &&
-                         m_panReqIds[nIdx] != psWayFeaturePairs->panNodeRefs[i])
-                    nIdx = -1;
+            }
+            else if (nIdx >= 0 &&
+                     m_panReqIds[nIdx] != psWayFeaturePairs->panNodeRefs[i])
+                nIdx = -1;
 
-                if (nIdx >= 0)
-                {
-                    m_asLonLatCache.push_back(m_pasLonLatArray[nIdx]);
-                }
+            if (nIdx >= 0)
+            {
+                asLonLat.push_back(m_pasLonLatArray[nIdx]);
             }
         }
-        else
+    }
+    else
 #endif  // ENABLE_NODE_LOOKUP_BY_HASHING
+    {
+        int nIdx = -1;
+        for (unsigned int i = 0; i < psWayFeaturePairs->nRefs; i++)
         {
-            int nIdx = -1;
-            for (unsigned int i = 0; i < psWayFeaturePairs->nRefs; i++)
+            if (nIdx >= 0 && psWayFeaturePairs->panNodeRefs[i] ==
+                                 psWayFeaturePairs->panNodeRefs[i - 1] + 1)
             {
-                if (nIdx >= 0 && psWayFeaturePairs->panNodeRefs[i] ==
-                                     psWayFeaturePairs->panNodeRefs[i - 1] + 1)
-                {
-                    if (nIdx + 1 < (int)m_nReqIds &&
-                        m_panReqIds[nIdx + 1] ==
-                            psWayFeaturePairs->panNodeRefs[i])
-                        nIdx++;
-                    else
-                        nIdx = -1;
-                }
+                if (nIdx + 1 < (int)m_nReqIds &&
+                    m_panReqIds[nIdx + 1] == psWayFeaturePairs->panNodeRefs[i])
+                    nIdx++;
                 else
-                    nIdx = FindNode(psWayFeaturePairs->panNodeRefs[i]);
-                if (nIdx >= 0)
-                {
-                    m_asLonLatCache.push_back(m_pasLonLatArray[nIdx]);
-                }
+                    nIdx = -1;
+            }
+            else
+                nIdx = FindNode(psWayFeaturePairs->panNodeRefs[i]);
+            if (nIdx >= 0)
+            {
+                asLonLat.push_back(m_pasLonLatArray[nIdx]);
             }
         }
+    }
+
+    if (!asLonLat.empty() && psWayFeaturePairs->bIsArea)
+    {
+        asLonLat.push_back(asLonLat[0]);
+    }
+}
+
+/************************************************************************/
+/*                         ProcessWaysBatch()                           */
+/************************************************************************/
+
+void OGROSMDataSource::ProcessWaysBatch()
+{
+    if (m_nWayFeaturePairs == 0)
+        return;
+
+    // printf("nodes = %d, features = %d\n", nUnsortedReqIds, nWayFeaturePairs);
+    LookupNodes();
+
+    // Resolving the nodes of the ways and building their geometries only
+    // reads the looked up nodes, so this is done in worker threads for large
+    // enough batches. Indexing the ways and adding the features is then done
+    // sequentially, in the order of the ways.
+    constexpr int MIN_WAYS_PER_JOB = 1000;
+    const int nJobs =
+        std::min(m_nNumThreads, m_nWayFeaturePairs / MIN_WAYS_PER_JOB);
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nJobs > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(m_nNumThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+    if (poJobQueue)
+    {
+        m_aasWayLonLat.resize(m_nWayFeaturePairs);
+        m_apoWayGeoms.resize(m_nWayFeaturePairs);
+        CPLJobQueueRunRanges(
+            poJobQueue.get(), nJobs, m_nWayFeaturePairs,
+            [this](int, int iStart, int iEnd)
+            {
+                for (int iPair = iStart; iPair < iEnd; iPair++)
+                {
+                    const WayFeaturePair *psWayFeaturePairs =
+                        &m_pasWayFeaturePairs[iPair];
+                    auto &asLonLat = m_aasWayLonLat[iPair];
+                    ResolveWayNodes(psWayFeaturePairs, asLonLat);
+                    if (asLonLat.size() < 2 ||
+                        psWayFeaturePairs->poFeature == nullptr)
+                    {
+                        continue;
+                    }
+                    auto poLS = std::make_unique<OGRLineString>();
+                    const int nPoints = static_cast<int>(asLonLat.size());
+                    poLS->setNumPoints(nPoints);
+                    for (int i = 0; i < nPoints; i++)
+                    {
+                        poLS->setPoint(i, INT_TO_DBL(asLonLat[i].nLon),
+                                       INT_TO_DBL(asLonLat[i].nLat));
+                    }
+                    m_apoWayGeoms[iPair] = std::move(poLS);
+                }
+            });
+    }
+
+    for (int iPair = 0; iPair < m_nWayFeaturePairs; iPair++)
+    {
+        WayFeaturePair *psWayFeaturePairs = &m_pasWayFeaturePairs[iPair];
+
+        const bool bIsArea = psWayFeaturePairs->bIsArea;
+        std::vector<LonLat> &asLonLat =
+            poJobQueue ? m_aasWayLonLat[iPair] : m_asLonLatCache;
+        if (!poJobQueue)
+            ResolveWayNodes(psWayFeaturePairs, asLonLat);
 
         if (!m_asLonLatCache.empty() && bIsArea)
         {
             m_asLonLatCache.push_back(m_asLonLatCache[0]);
         }
 
-        if (m_asLonLatCache.size() < 2)
+        if (asLonLat.size() < 2)
         {
             CPLDebug("OSM",
                      "Way " CPL_FRMT_GIB
                      " with %d nodes that could be found. Discarding it",
                      psWayFeaturePairs->nWayID,
-                     static_cast<int>(m_asLonLatCache.size()));
+                     static_cast<int>(asLonLat.size()));
             delete psWayFeaturePairs->poFeature;
             psWayFeaturePairs->poFeature = nullptr;
             psWayFeaturePairs->bIsArea = false;
@@ -1718,34 +2173,39 @@ void OGROSMDataSource::ProcessWaysBatch()
         {
             IndexWay(psWayFeaturePairs->nWayID, /*bIsArea = */ true,
                      psWayFeaturePairs->nTags, psWayFeaturePairs->pasTags,
-                     m_asLonLatCache.data(),
-                     static_cast<int>(m_asLonLatCache.size()),
+                     asLonLat.data(), static_cast<int>(asLonLat.size()),
                      &psWayFeaturePairs->sInfo);
         }
         else
             IndexWay(psWayFeaturePairs->nWayID, bIsArea, 0, nullptr,
-                     m_asLonLatCache.data(),
-                     static_cast<int>(m_asLonLatCache.size()), nullptr);
+                     asLonLat.data(), static_cast<int>(asLonLat.size()),
+                     nullptr);
 
         if (psWayFeaturePairs->poFeature == nullptr)
         {
             continue;
         }
 
-        OGRLineString *poLS = new OGRLineString();
-        OGRGeometry *poGeom = poLS;
-
-        const int nPoints = static_cast<int>(m_asLonLatCache.size());
-        poLS->setNumPoints(nPoints);
-        for (int i = 0; i < nPoints; i++)
+        const int nPoints = static_cast<int>(asLonLat.size());
+        OGRLineString *poLS;
+        if (poJobQueue)
+        {
+            poLS = m_apoWayGeoms[iPair].release();
+        }
+        else
         {
-            poLS->setPoint(i, INT_TO_DBL(m_asLonLatCache[i].nLon),
-                           INT_TO_DBL(m_asLonLatCache[i].nLat));
+            poLS = new OGRLineString();
+            poLS->setNumPoints(nPoints);
+            for (int i = 0; i < nPoints; i++)
+            {
+                poLS->setPoint(i, INT_TO_DBL(asLonLat[i].nLon),
+                               INT_TO_DBL(asLonLat[i].nLat));
+            }
         }
 
-        psWayFeaturePairs->poFeature->SetGeometryDirectly(poGeom);
+        psWayFeaturePairs->poFeature->SetGeometryDirectly(poLS);
 
-        if (m_asLonLatCache.size() != psWayFeaturePairs->nRefs)
+        if (asLonLat.size() != psWayFeaturePairs->nRefs)
             CPLDebug(
                 "OSM",
                 "For way " CPL_FRMT_GIB ", got only %d nodes instead of %d",
@@ -2756,6 +3216,14 @@ int OGROSMDataSource::Open(const char *pszFilename, char **papszOpenOptionsIn)
     if (m_psParser == nullptr)
         return FALSE;
 
+    // Same number of threads as the one used by the PBF parser
+    const char *pszNumThreads =
+        CPLGetConfigOption("GDAL_NUM_THREADS", "ALL_CPUS");
+    m_nNumThreads = CPLGetNumCPUs();
+    if (!EQUAL(pszNumThreads, "ALL_CPUS"))
+        m_nNumThreads =
+            std::max(1, std::min(2 * m_nNumThreads, atoi(pszNumThreads)));
+
     if (CPLFetchBool(papszOpenOptionsIn, "INTERLEAVED_READING", false))
         m_bInterleavedReading = TRUE;
 
@@ -2778,6 +3246,20 @@ int OGROSMDataSource::Open(const char *pszFilename, char **papszOpenOptionsIn)
     if (m_bCompressNodes)
         CPLDebug("OSM", "Using compression for nodes DB");
 
+    const char *pszDenseNodesIndexFile = CSLFetchNameValueDef(
+        papszOpenOptionsIn, "DENSE_NODES_INDEX_FILE",
+        CPLGetConfigOption("OSM_DENSE_NODES_INDEX_FILE", nullptr));
+    if (pszDenseNodesIndexFile && pszDenseNodesIndexFile[0])
+    {
+        if (!OpenDenseNodesIndex(pszDenseNodesIndexFile))
+            return FALSE;
+        CPLDebug("OSM", "Using dense nodes index %s%s",
+                 pszDenseNodesIndexFile,
+                 m_bDenseNodesIndexMMap ? " (memory-mapped)" : "");
+        // The custom node file is not needed
+        m_bCustomIndexing = false;
+    }
+
     m_nLayers = 5;
     m_papoLayers = static_cast<OGROSMLayer **>(
         CPLMalloc(m_nLayers * sizeof(OGROSMLayer *)));
@@ -3884,6 +4366,7 @@ int OGROSMDataSource::MyResetReading()
     }
 
     m_bStopParsing = false;
+    m_bAllNodesIndexed = true;
     m_poCurrentLayer = nullptr;
 
     return TRUE;
@@ -4011,6 +4494,14 @@ bool OGROSMDataSource::ParseNextChunk(int nIdxLayer,
         {
             if (eRet == OSM_EOF)
             {
+                // All nodes of the file have been indexed: the dense nodes
+                // index can be reused by later runs on the same file.
+                if (m_bDenseNodesIndex && !m_bDenseNodesIndexReused &&
+                    m_bAllNodesIndexed && !m_bStopParsing)
+                {
+                    WriteDenseNodesIndexHeader(true);
+                }
+
                 if (m_nWayFeaturePairs != 0)
                     ProcessWaysBatch();
 
@@ -125,6 +125,9 @@ void RegisterOGROSM()
         "description='Whether to enable custom indexing.' default='YES'/>"
         "  <Option name='COMPRESS_NODES' type='boolean' description='Whether "
         "to compress nodes in temporary DB.' default='NO'/>"
+        "  <Option name='DENSE_NODES_INDEX_FILE' type='string' "
+        "description='Filename of a dense nodes index, that can be reused by "
+        "later runs on the same OSM file.'/>"
         "  <Option name='MAX_TMPFILE_SIZE' type='int' description='Maximum "
         "size in MB of in-memory temporary file. If it exceeds that value, it "
         "will go to disk' default='100'/>"
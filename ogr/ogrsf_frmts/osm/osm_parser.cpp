@@ -123,6 +123,8 @@ typedef struct
     bool bStatus;
 } DecompressionJob;
 
+struct OSMParsedBlock;
+
 struct _OSMContext
 {
     char *pszStrBuf;
@@ -166,6 +168,12 @@ struct _OSMContext
     int nJobs;
     int iNextJob;
 
+    // BLOB_OSMDATA blocks parsed in worker threads, for the jobs in the
+    // [iFirstParsedJob, iFirstParsedJob + nParsedJobs[ range
+    OSMParsedBlock *pasParsedBlocks;  // poWTP->GetThreadCount() large
+    int iFirstParsedJob;
+    int nParsedJobs;
+
 #ifdef HAVE_EXPAT
     XML_Parser hXMLParser;
     bool bEOF;
@@ -1651,6 +1659,7 @@ static void DecompressFunction(void *pDataIn)
 static bool RunDecompressionJobs(OSMContext *psCtxt)
 {
     psCtxt->nTotalUncompressedSize = 0;
+    psCtxt->nParsedJobs = 0;
 
     GByte *pabyDstBase = psCtxt->pabyUncompressed;
     std::vector<void *> ahJobs;
@@ -1676,14 +1685,287 @@ static bool RunDecompressionJobs(OSMContext *psCtxt)
     return bRet;
 }
 
+/************************************************************************/
+/*                           OSMParsedBlock                             */
+/************************************************************************/
+
+// Nodes, ways and relations of a BLOB_OSMDATA block parsed by a worker
+// thread. They are notified afterwards by the main thread, in the order of
+// the file, so that the user callbacks need not be thread-safe.
+// Strings still point into the uncompressed buffer.
+struct OSMParsedBlock
+{
+    enum class Type
+    {
+        NODES,
+        WAY,
+        RELATION
+    };
+
+    struct Event
+    {
+        Type eType;
+        size_t nIdx;  // index in asNodes, asWays or asRelations
+        unsigned int nCount;
+    };
+
+    // Context owning the parsing buffers of the worker thread
+    OSMContext *psParsingCtxt = nullptr;
+    const DecompressionJob *psJob = nullptr;
+    bool bStatus = false;
+    std::string osErrorMsg{};
+
+    std::vector<Event> asEvents{};
+    std::vector<OSMNode> asNodes{};
+    std::vector<OSMWay> asWays{};
+    std::vector<OSMRelation> asRelations{};
+    std::vector<OSMTag> asTags{};
+    std::vector<GIntBig> anNodeRefs{};
+    std::vector<OSMMember> asMembers{};
+
+    // Index in asTags of the first tag of each node, way and relation,
+    // index in anNodeRefs of the first node ref of each way, and index in
+    // asMembers of the first member of each relation.
+    std::vector<size_t> anNodeTagIdx{};
+    std::vector<size_t> anWayTagIdx{};
+    std::vector<size_t> anWayNodeRefIdx{};
+    std::vector<size_t> anRelationTagIdx{};
+    std::vector<size_t> anRelationMemberIdx{};
+
+    void Clear();
+    void FixupPointers();
+};
+
+/************************************************************************/
+/*                      OSMParsedBlock::Clear()                         */
+/************************************************************************/
+
+void OSMParsedBlock::Clear()
+{
+    // Keep the capacity of the vectors for the next block
+    bStatus = false;
+    osErrorMsg.clear();
+    asEvents.clear();
+    asNodes.clear();
+    asWays.clear();
+    asRelations.clear();
+    asTags.clear();
+    anNodeRefs.clear();
+    asMembers.clear();
+    anNodeTagIdx.clear();
+    anWayTagIdx.clear();
+    anWayNodeRefIdx.clear();
+    anRelationTagIdx.clear();
+    anRelationMemberIdx.clear();
+}
+
+/************************************************************************/
+/*                    OSMParsedBlock::FixupPointers()                   */
+/************************************************************************/
+
+// Must be called once the block is entirely parsed, as vectors may have
+// been reallocated in the meantime.
+void OSMParsedBlock::FixupPointers()
+{
+    for (size_t i = 0; i < asNodes.size(); ++i)
+        asNodes[i].pasTags = asTags.data() + anNodeTagIdx[i];
+    for (size_t i = 0; i < asWays.size(); ++i)
+    {
+        asWays[i].pasTags = asTags.data() + anWayTagIdx[i];
+        asWays[i].panNodeRefs = anNodeRefs.data() + anWayNodeRefIdx[i];
+    }
+    for (size_t i = 0; i < asRelations.size(); ++i)
+    {
+        asRelations[i].pasTags = asTags.data() + anRelationTagIdx[i];
+        asRelations[i].pasMembers = asMembers.data() + anRelationMemberIdx[i];
+    }
+}
+
+/************************************************************************/
+/*                         RecordNodesFunc()                            */
+/************************************************************************/
+
+static void RecordNodesFunc(unsigned int nNodes, OSMNode *pasNodes,
+                            OSMContext * /* psCtxt */, void *user_data)
+{
+    OSMParsedBlock *psBlock = static_cast<OSMParsedBlock *>(user_data);
+    psBlock->asEvents.push_back(
+        {OSMParsedBlock::Type::NODES, psBlock->asNodes.size(), nNodes});
+    for (unsigned int i = 0; i < nNodes; ++i)
+    {
+        psBlock->asNodes.push_back(pasNodes[i]);
+        psBlock->anNodeTagIdx.push_back(psBlock->asTags.size());
+        psBlock->asTags.insert(psBlock->asTags.end(), pasNodes[i].pasTags,
+                               pasNodes[i].pasTags + pasNodes[i].nTags);
+    }
+}
+
+/************************************************************************/
+/*                          RecordWayFunc()                             */
+/************************************************************************/
+
+static void RecordWayFunc(OSMWay *psWay, OSMContext * /* psCtxt */,
+                          void *user_data)
+{
+    OSMParsedBlock *psBlock = static_cast<OSMParsedBlock *>(user_data);
+    psBlock->asEvents.push_back(
+        {OSMParsedBlock::Type::WAY, psBlock->asWays.size(), 1});
+    psBlock->asWays.push_back(*psWay);
+    psBlock->anWayTagIdx.push_back(psBlock->asTags.size());
+    psBlock->asTags.insert(psBlock->asTags.end(), psWay->pasTags,
+                           psWay->pasTags + psWay->nTags);
+    psBlock->anWayNodeRefIdx.push_back(psBlock->anNodeRefs.size());
+    psBlock->anNodeRefs.insert(psBlock->anNodeRefs.end(), psWay->panNodeRefs,
+                               psWay->panNodeRefs + psWay->nRefs);
+}
+
+/************************************************************************/
+/*                        RecordRelationFunc()                          */
+/************************************************************************/
+
+static void RecordRelationFunc(OSMRelation *psRelation,
+                               OSMContext * /* psCtxt */, void *user_data)
+{
+    OSMParsedBlock *psBlock = static_cast<OSMParsedBlock *>(user_data);
+    psBlock->asEvents.push_back(
+        {OSMParsedBlock::Type::RELATION, psBlock->asRelations.size(), 1});
+    psBlock->asRelations.push_back(*psRelation);
+    psBlock->anRelationTagIdx.push_back(psBlock->asTags.size());
+    psBlock->asTags.insert(psBlock->asTags.end(), psRelation->pasTags,
+                           psRelation->pasTags + psRelation->nTags);
+    psBlock->anRelationMemberIdx.push_back(psBlock->asMembers.size());
+    psBlock->asMembers.insert(psBlock->asMembers.end(),
+                              psRelation->pasMembers,
+                              psRelation->pasMembers + psRelation->nMembers);
+}
+
+/************************************************************************/
+/*                         ParseBlockFunction()                         */
+/************************************************************************/
+
+static void ParseBlockFunction(void *pDataIn)
+{
+    OSMParsedBlock *psBlock = static_cast<OSMParsedBlock *>(pDataIn);
+    const DecompressionJob *psJob = psBlock->psJob;
+
+    // Errors are re-emitted by the main thread
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    CPLErrorReset();
+    psBlock->bStatus =
+        ReadPrimitiveBlock(psJob->pabyDstBase + psJob->nDstOffset,
+                           psJob->pabyDstBase + psJob->nDstOffset +
+                               psJob->nDstSize,
+                           psBlock->psParsingCtxt);
+    if (!psBlock->bStatus)
+        psBlock->osErrorMsg = CPLGetLastErrorMsg();
+    psBlock->FixupPointers();
+}
+
+/************************************************************************/
+/*                         FreeParsingBuffers()                         */
+/************************************************************************/
+
+static void FreeParsingBuffers(OSMContext *psCtxt)
+{
+    VSIFree(psCtxt->panStrOff);
+    VSIFree(psCtxt->pasNodes);
+    VSIFree(psCtxt->pasTags);
+    VSIFree(psCtxt->pasMembers);
+    VSIFree(psCtxt->panNodeRefs);
+}
+
+/************************************************************************/
+/*                     ParseBlocksInWorkerThreads()                     */
+/************************************************************************/
+
+// Parse in worker threads the BLOB_OSMDATA blocks of the jobs starting at
+// iFirstJob, as many as there are threads.
+static bool ParseBlocksInWorkerThreads(OSMContext *psCtxt, int iFirstJob)
+{
+    const int nThreads = psCtxt->poWTP->GetThreadCount();
+    if (psCtxt->pasParsedBlocks == nullptr)
+    {
+        psCtxt->pasParsedBlocks = new OSMParsedBlock[nThreads];
+        for (int i = 0; i < nThreads; ++i)
+        {
+            OSMParsedBlock *psBlock = &psCtxt->pasParsedBlocks[i];
+            psBlock->psParsingCtxt = static_cast<OSMContext *>(
+                VSI_CALLOC_VERBOSE(1, sizeof(OSMContext)));
+            if (psBlock->psParsingCtxt == nullptr)
+                return false;
+            psBlock->psParsingCtxt->bPBF = true;
+            psBlock->psParsingCtxt->pfnNotifyNodes = RecordNodesFunc;
+            psBlock->psParsingCtxt->pfnNotifyWay = RecordWayFunc;
+            psBlock->psParsingCtxt->pfnNotifyRelation = RecordRelationFunc;
+            psBlock->psParsingCtxt->user_data = psBlock;
+        }
+    }
+    else if (psCtxt->pasParsedBlocks[nThreads - 1].psParsingCtxt == nullptr)
+    {
+        // Previous allocation failure
+        return false;
+    }
+
+    const int nToParse = std::min(nThreads, psCtxt->nJobs - iFirstJob);
+    std::vector<void *> ahJobs;
+    for (int i = 0; i < nToParse; ++i)
+    {
+        OSMParsedBlock *psBlock = &psCtxt->pasParsedBlocks[i];
+        psBlock->Clear();
+        psBlock->psJob = &psCtxt->asJobs[iFirstJob + i];
+        ahJobs.push_back(psBlock);
+    }
+    psCtxt->poWTP->SubmitJobs(ParseBlockFunction, ahJobs);
+    psCtxt->poWTP->WaitCompletion();
+
+    psCtxt->iFirstParsedJob = iFirstJob;
+    psCtxt->nParsedJobs = nToParse;
+    return true;
+}
+
+/************************************************************************/
+/*                          NotifyParsedBlock()                         */
+/************************************************************************/
+
+static bool NotifyParsedBlock(OSMContext *psCtxt, OSMParsedBlock *psBlock)
+{
+    for (const auto &sEvent : psBlock->asEvents)
+    {
+        switch (sEvent.eType)
+        {
+            case OSMParsedBlock::Type::NODES:
+                psCtxt->pfnNotifyNodes(sEvent.nCount,
+                                       psBlock->asNodes.data() + sEvent.nIdx,
+                                       psCtxt, psCtxt->user_data);
+                break;
+            case OSMParsedBlock::Type::WAY:
+                psCtxt->pfnNotifyWay(psBlock->asWays.data() + sEvent.nIdx,
+                                     psCtxt, psCtxt->user_data);
+                break;
+            case OSMParsedBlock::Type::RELATION:
+                psCtxt->pfnNotifyRelation(psBlock->asRelations.data() +
+                                              sEvent.nIdx,
+                                          psCtxt, psCtxt->user_data);
+                break;
+        }
+    }
+    const bool bRet = psBlock->bStatus;
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                 psBlock->osErrorMsg.c_str());
+    }
+    psBlock->Clear();
+    return bRet;
+}
+
 /************************************************************************/
 /*                          ProcessSingleBlob()                         */
 /************************************************************************/
 
-// cppcheck-suppress constParameterReference
-static bool ProcessSingleBlob(OSMContext *psCtxt, DecompressionJob &sJob,
-                              BlobType eType)
+static bool ProcessSingleBlob(OSMContext *psCtxt, int iJob, BlobType eType)
 {
+    const DecompressionJob &sJob = psCtxt->asJobs[iJob];
     if (eType == BLOB_OSMHEADER)
     {
         return ReadOSMHeader(sJob.pabyDstBase + sJob.nDstOffset,
@@ -1693,6 +1975,19 @@ static bool ProcessSingleBlob(OSMContext *psCtxt, DecompressionJob &sJob,
     else
     {
         CPLAssert(eType == BLOB_OSMDATA);
+        if (psCtxt->poWTP && psCtxt->nJobs > 1)
+        {
+            // Parse the next blocks in worker threads if not already done
+            if (iJob < psCtxt->iFirstParsedJob ||
+                iJob >= psCtxt->iFirstParsedJob + psCtxt->nParsedJobs)
+            {
+                if (!ParseBlocksInWorkerThreads(psCtxt, iJob))
+                    return false;
+            }
+            return NotifyParsedBlock(
+                psCtxt,
+                &psCtxt->pasParsedBlocks[iJob - psCtxt->iFirstParsedJob]);
+        }
         return ReadPrimitiveBlock(
             sJob.pabyDstBase + sJob.nDstOffset,
             sJob.pabyDstBase + sJob.nDstOffset + sJob.nDstSize, psCtxt);
@@ -1712,7 +2007,7 @@ static bool RunDecompressionJobsAndProcessAll(OSMContext *psCtxt,
     }
     for (int i = 0; i < psCtxt->nJobs; i++)
     {
-        if (!ProcessSingleBlob(psCtxt, psCtxt->asJobs[i], eType))
+        if (!ProcessSingleBlob(psCtxt, i, eType))
         {
             return false;
         }
@@ -1859,9 +2154,9 @@ static bool ReadBlob(OSMContext *psCtxt, BlobType eType)
                     else
                     {
                         // Make sure that uncompressed blobs are separated by
-                        // EXTRA_BYTES in the case where in the future we would
-                        // implement parallel decoding of them (not sure if
-                        // that's doable)
+                        // EXTRA_BYTES, as they are decoded in parallel and
+                        // ReadPrimitiveBlock() may temporarily NUL-terminate
+                        // the byte after the string table.
                         psCtxt->nTotalUncompressedSize +=
                             nUncompressedSize + EXTRA_BYTES;
                     }
@@ -1886,7 +2181,7 @@ static bool ReadBlob(OSMContext *psCtxt, BlobType eType)
                 THROW_OSM_PARSING_EXCEPTION;
             }
             // Just process one blob at a time
-            if (!ProcessSingleBlob(psCtxt, psCtxt->asJobs[0], eType))
+            if (!ProcessSingleBlob(psCtxt, 0, eType))
             {
                 THROW_OSM_PARSING_EXCEPTION;
             }
@@ -1913,8 +2208,7 @@ static OSMRetCode PBF_ProcessBlock(OSMContext *psCtxt)
     // Process any remaining queued jobs one by one
     if (psCtxt->iNextJob < psCtxt->nJobs)
     {
-        if (!(ProcessSingleBlob(psCtxt, psCtxt->asJobs[psCtxt->iNextJob],
-                                BLOB_OSMDATA)))
+        if (!(ProcessSingleBlob(psCtxt, psCtxt->iNextJob, BLOB_OSMDATA)))
         {
             return OSM_ERROR;
         }
@@ -2808,11 +3102,22 @@ void OSM_Close(OSMContext *psCtxt)
     VSIFree(psCtxt->pabyBlob);
     VSIFree(psCtxt->pabyBlobHeader);
     VSIFree(psCtxt->pabyUncompressed);
-    VSIFree(psCtxt->panStrOff);
-    VSIFree(psCtxt->pasNodes);
-    VSIFree(psCtxt->pasTags);
-    VSIFree(psCtxt->pasMembers);
-    VSIFree(psCtxt->panNodeRefs);
+    FreeParsingBuffers(psCtxt);
+    if (psCtxt->pasParsedBlocks)
+    {
+        const int nThreads = psCtxt->poWTP->GetThreadCount();
+        for (int i = 0; i < nThreads; ++i)
+        {
+            OSMContext *psParsingCtxt =
+                psCtxt->pasParsedBlocks[i].psParsingCtxt;
+            if (psParsingCtxt)
+            {
+                FreeParsingBuffers(psParsingCtxt);
+                VSIFree(psParsingCtxt);
+            }
+        }
+        delete[] psCtxt->pasParsedBlocks;
+    }
     delete psCtxt->poWTP;
 
     VSIFCloseL(psCtxt->fp);
@@ -2830,6 +3135,7 @@ void OSM_ResetReading(OSMContext *psCtxt)
     psCtxt->nBytesRead = 0;
     psCtxt->nJobs = 0;
     psCtxt->iNextJob = 0;
+    psCtxt->nParsedJobs = 0;
     psCtxt->nBlobOffset = 0;
     psCtxt->nBlobSize = 0;
     psCtxt->nTotalUncompressedSize = 0;
@@ -58,6 +58,10 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/arrow/schema.h"
+#include "parquet/parquet_version.h"  // for PARQUET_VERSION_MAJOR
+#if PARQUET_VERSION_MAJOR >= 12
+#include "parquet/page_index.h"
+#endif
 
 #ifdef GDAL_USE_ARROWDATASET
 #include "arrow/filesystem/filesystem.h"
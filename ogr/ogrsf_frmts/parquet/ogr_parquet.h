@@ -30,6 +30,7 @@
 #define OGR_PARQUET_H
 
 #include "ogrsf_frmts.h"
+#include "cpl_vsi_virtual.h"
 
 #include <functional>
 #include <map>
@@ -63,6 +64,13 @@ class OGRParquetLayerBase CPL_NON_FINAL : public OGRArrowLayer
         int iFieldIdx, const std::shared_ptr<arrow::Field> &field,
         std::function<OGRwkbGeometryType(void)> computeGeometryTypeFun);
 
+    static bool ParseGeometryColumnCovering(const CPLJSONObject &oJSONDef,
+                                            std::string &osBBOXColumn,
+                                            std::string &osXMin,
+                                            std::string &osYMin,
+                                            std::string &osXMax,
+                                            std::string &osYMax);
+
   public:
     int TestCapability(const char *) override;
 
@@ -126,6 +134,14 @@ class OGRParquetLayer final : public OGRParquetLayerBase
     bool CreateRecordBatchReader(int iStartingRowGroup);
     bool CreateRecordBatchReader(const std::vector<int> &anRowGroups);
     bool ReadNextBatch() override;
+#if PARQUET_VERSION_MAJOR >= 12
+    bool IsRowGroupIntersectingFilterFromPageIndex(
+        parquet::PageIndexReader *poPageIndexReader, int iRowGroup,
+        const GeomColBBOXParquet &sBBOXParquet) const;
+#endif
+    bool IsRowGroupIntersectingFilterFromBBOXColumn(
+        int iRowGroup, const GeomColBBOX &sBBOX,
+        const GeomColBBOXParquet &sBBOXParquet) const;
 
     void InvalidateCachedBatches() override;
 
@@ -224,9 +240,54 @@ class OGRParquetLayer final : public OGRParquetLayerBase
 
 class OGRParquetDatasetLayer final : public OGRParquetLayerBase
 {
+    bool m_bIsVSI = false;
+    bool m_bRebuildScanner = true;
+    std::shared_ptr<arrow::dataset::Dataset> m_poDataset{};
     std::shared_ptr<arrow::dataset::Scanner> m_poScanner{};
 
+    //! Map from OGR geometry field index to its GeoParquet covering bbox
+    //! column. Contrary to OGRParquetLayer, those columns are also exposed as
+    //! regular fields.
+    std::map<int, GeomColBBOX> m_oMapGeomFieldIndexToCoveringBBOX{};
+
+    //! Information about a fragment (that is a file) of the dataset
+    struct FragmentInfo
+    {
+        std::shared_ptr<arrow::dataset::Fragment> poFragment{};
+        //! Whether the file footer has been read
+        bool bMetadataLoaded = false;
+        //! Whether the file footer could be read
+        bool bMetadataValid = false;
+        //! Number of rows of the fragment
+        int64_t nRowCount = 0;
+        //! Row groups of the file scanned by the fragment
+        std::vector<int> anRowGroups{};
+        //! Map from row group index to (offset in the fragment, row count)
+        std::map<int, std::pair<int64_t, int64_t>> oMapRowGroups{};
+        //! Map from OGR geometry field index to GeoParquet "bbox" of the file
+        std::map<int, OGREnvelope> oMapExtents{};
+    };
+
+    bool m_bFragmentsListed = false;
+    std::vector<FragmentInfo> m_aoFragments{};
+
+    //! Pairs of (selected feature idx, total feature idx) break points.
+    std::vector<std::pair<int64_t, int64_t>> m_asFeatureIdxRemapping{};
+    //! Iterator over m_asFeatureIdxRemapping
+    std::vector<std::pair<int64_t, int64_t>>::iterator
+        m_oFeatureIdxRemappingIter{};
+    //! Feature index among the potentially restricted set of selected fragments
+    int64_t m_nFeatureIdxSelected = 0;
+
     void EstablishFeatureDefn();
+    bool BuildScanner();
+    bool ListFragments();
+    bool LoadFragmentsMetadata();
+    static void LoadFragmentMetadataJob(void *pData);
+    void LoadFragmentMetadata(FragmentInfo &oInfo) const;
+    bool BuildArrowFilter(arrow::compute::Expression &oFilter) const;
+    std::shared_ptr<arrow::dataset::Dataset>
+    SelectFragments(const arrow::compute::Expression &oFilter, bool bHasFilter);
 
   protected:
     std::string GetDriverUCName() const override
@@ -240,13 +301,24 @@ class OGRParquetDatasetLayer final : public OGRParquetLayerBase
 
     bool FastGetExtent(int iGeomField, OGREnvelope *psExtent) const override;
 
+    void IncrFeatureIdx() override;
+
   public:
     OGRParquetDatasetLayer(
-        OGRParquetDataset *poDS, const char *pszLayerName,
-        const std::shared_ptr<arrow::dataset::Scanner> &scanner,
-        const std::shared_ptr<arrow::Schema> &schema,
+        OGRParquetDataset *poDS, const char *pszLayerName, bool bIsVSI,
+        const std::shared_ptr<arrow::dataset::Dataset> &dataset,
         CSLConstList papszOpenOptions);
 
+    void ResetReading() override;
+    OGRErr SetAttributeFilter(const char *pszFilter) override;
+
+    void SetSpatialFilter(OGRGeometry *poGeom) override
+    {
+        SetSpatialFilter(0, poGeom);
+    }
+
+    void SetSpatialFilter(int iGeomField, OGRGeometry *poGeom) override;
+
     GIntBig GetFeatureCount(int bForce) override;
     OGRErr GetExtent(OGREnvelope *psExtent, int bForce = TRUE) override;
     OGRErr GetExtent(int iGeomField, OGREnvelope *psExtent,
@@ -299,10 +371,35 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
     bool m_bEdgesSpherical = false;
     parquet::WriterProperties::Builder m_oWriterPropertiesBuilder{};
 
-    //! Temporary GeoPackage dataset. Only used in SORT_BY_BBOX mode
-    std::unique_ptr<GDALDataset> m_poTmpGPKG{};
-    //! Temporary GeoPackage layer. Only used in SORT_BY_BBOX mode
-    OGRLayer *m_poTmpGPKGLayer = nullptr;
+    //! Whether parquet-cpp may encode columns of a row group in parallel
+    bool m_bUseThreads = false;
+
+    //! Whether the SORT_BY_BBOX layer creation option is set
+    bool m_bSortByBBOX = false;
+
+    //! Sort key of a feature. Only used in SORT_BY_BBOX mode
+    struct SortItem
+    {
+        //! Center of the bounding box, or NaN if no (finite) geometry
+        double dfX = 0;
+        double dfY = 0;
+        //! Offset of the serialized feature in the temporary file
+        uint64_t nOffset = 0;
+        //! Size in bytes of the serialized feature
+        uint32_t nSize = 0;
+        //! Hilbert code of the center, computed just before sorting
+        uint32_t nHilbertCode = 0;
+    };
+
+    //! Sort keys of features. Only used in SORT_BY_BBOX mode
+    std::vector<SortItem> m_asSortItems{};
+    //! Extent of bounding box centers. Only used in SORT_BY_BBOX mode
+    OGREnvelope m_sSortExtent{};
+    //! Temporary file with serialized features. Only used in SORT_BY_BBOX mode
+    std::string m_osTmpFilename{};
+    VSIVirtualHandleUniquePtr m_fpTmp{};
+    //! Current size of m_fpTmp. Only used in SORT_BY_BBOX mode
+    uint64_t m_nTmpFileSize = 0;
     //! Number of features written by ICreateFeature(). Only used in SORT_BY_BBOX mode
     GIntBig m_nTmpFeatureCount = 0;
 
@@ -338,8 +435,10 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
 
     std::string GetGeoMetadata() const;
 
-    //! Copy temporary GeoPackage layer to final Parquet file
-    bool CopyTmpGpkgLayerToFinalFile();
+    //! Copy features of the temporary file, in Hilbert order of their
+    //! bounding box center, to final Parquet file
+    bool CopySortedTmpFeaturesToFinalFile();
+    void CloseAndUnlinkTmpFile();
 
   public:
     OGRParquetWriterLayer(
@@ -347,6 +446,8 @@ class OGRParquetWriterLayer final : public OGRArrowWriterLayer
         const std::shared_ptr<arrow::io::OutputStream> &poOutputStream,
         const char *pszLayerName);
 
+    ~OGRParquetWriterLayer() override;
+
     CPLErr SetMetadata(char **papszMetadata, const char *pszDomain) override;
 
     bool SetOptions(CSLConstList papszOptions,
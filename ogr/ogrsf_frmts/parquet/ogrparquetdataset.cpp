@@ -70,7 +70,7 @@ OGRLayer *OGRParquetDataset::ExecuteSQL(const char *pszSQLCommand,
         if (oSelect.join_count == 0 && oSelect.poOtherSelect == nullptr &&
             oSelect.table_count == 1 && oSelect.order_specs == 0 &&
             oSelect.query_mode != SWQM_DISTINCT_LIST &&
-            oSelect.where_expr == nullptr &&
+            oSelect.group_by_defs.empty() && oSelect.where_expr == nullptr &&
             CPLTestBool(
                 CPLGetConfigOption("OGR_PARQUET_USE_STATISTICS", "YES")))
         {
@@ -27,6 +27,7 @@
  ****************************************************************************/
 
 #include "ogrsf_frmts.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <map>
@@ -43,16 +44,17 @@
 /************************************************************************/
 
 OGRParquetDatasetLayer::OGRParquetDatasetLayer(
-    OGRParquetDataset *poDS, const char *pszLayerName,
-    const std::shared_ptr<arrow::dataset::Scanner> &scanner,
-    const std::shared_ptr<arrow::Schema> &schema, CSLConstList papszOpenOptions)
+    OGRParquetDataset *poDS, const char *pszLayerName, bool bIsVSI,
+    const std::shared_ptr<arrow::dataset::Dataset> &dataset,
+    CSLConstList papszOpenOptions)
     : OGRParquetLayerBase(poDS, pszLayerName, papszOpenOptions),
-      m_poScanner(scanner)
+      m_bIsVSI(bIsVSI), m_poDataset(dataset)
 {
-    m_poSchema = schema;
+    m_poSchema = m_poDataset->schema();
     EstablishFeatureDefn();
     CPLAssert(static_cast<int>(m_aeGeomEncoding.size()) ==
               m_poFeatureDefn->GetGeomFieldCount());
+    m_oFeatureIdxRemappingIter = m_asFeatureIdxRemapping.begin();
 }
 
 /************************************************************************/
@@ -93,6 +95,666 @@ void OGRParquetDatasetLayer::EstablishFeatureDefn()
               m_poFeatureDefn->GetFieldCount());
     CPLAssert(static_cast<int>(m_anMapGeomFieldIndexToArrowColumn.size()) ==
               m_poFeatureDefn->GetGeomFieldCount());
+
+    if (!CPLTestBool(CPLGetConfigOption("OGR_PARQUET_USE_BBOX", "YES")))
+        return;
+
+    // Identify GeoParquet covering bounding box columns, so that spatial
+    // filters can be translated into Arrow filter expressions.
+    for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+    {
+        const auto oIter = m_oMapGeometryColumns.find(
+            m_poFeatureDefn->GetGeomFieldDefn(i)->GetNameRef());
+        std::string osBBOXColumn;
+        std::string osXMin, osYMin, osXMax, osYMax;
+        if (oIter == m_oMapGeometryColumns.end() ||
+            !ParseGeometryColumnCovering(oIter->second, osBBOXColumn, osXMin,
+                                         osYMin, osXMax, osYMax))
+        {
+            continue;
+        }
+
+        GeomColBBOX sDesc;
+        sDesc.iArrowCol = m_poSchema->GetFieldIndex(osBBOXColumn);
+        const auto fieldBBOX = m_poSchema->GetFieldByName(osBBOXColumn);
+        if (sDesc.iArrowCol < 0 || !fieldBBOX ||
+            fieldBBOX->type()->id() != arrow::Type::STRUCT)
+        {
+            continue;
+        }
+        const auto fieldBBOXStruct =
+            std::static_pointer_cast<arrow::StructType>(fieldBBOX->type());
+        sDesc.iArrowSubfieldXMin = fieldBBOXStruct->GetFieldIndex(osXMin);
+        sDesc.iArrowSubfieldYMin = fieldBBOXStruct->GetFieldIndex(osYMin);
+        sDesc.iArrowSubfieldXMax = fieldBBOXStruct->GetFieldIndex(osXMax);
+        sDesc.iArrowSubfieldYMax = fieldBBOXStruct->GetFieldIndex(osYMax);
+        bool bValid = true;
+        for (int iSubField :
+             {sDesc.iArrowSubfieldXMin, sDesc.iArrowSubfieldYMin,
+              sDesc.iArrowSubfieldXMax, sDesc.iArrowSubfieldYMax})
+        {
+            if (iSubField < 0)
+            {
+                bValid = false;
+                break;
+            }
+            const auto eTypeId =
+                fieldBBOXStruct->field(iSubField)->type()->id();
+            if (eTypeId != arrow::Type::FLOAT && eTypeId != arrow::Type::DOUBLE)
+            {
+                bValid = false;
+                break;
+            }
+        }
+        if (bValid)
+        {
+            CPLDebug("PARQUET",
+                     "Bounding box column '%s' detected for "
+                     "geometry column '%s'",
+                     osBBOXColumn.c_str(),
+                     m_poFeatureDefn->GetGeomFieldDefn(i)->GetNameRef());
+            m_oMapGeomFieldIndexToCoveringBBOX[i] = sDesc;
+        }
+    }
+}
+
+/************************************************************************/
+/*                           GetNumThreads()                            */
+/************************************************************************/
+
+static int GetNumThreads()
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    int nNumThreads = 0;
+    if (pszNumThreads == nullptr)
+        nNumThreads = std::min(4, CPLGetNumCPUs());
+    else
+        nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                       : atoi(pszNumThreads);
+    return nNumThreads;
+}
+
+/************************************************************************/
+/*                           ListFragments()                            */
+/************************************************************************/
+
+bool OGRParquetDatasetLayer::ListFragments()
+{
+    if (m_bFragmentsListed)
+        return !m_aoFragments.empty();
+    m_bFragmentsListed = true;
+
+    auto statusFragments = m_poDataset->GetFragments();
+    if (!statusFragments.ok())
+        return false;
+    for (const auto &oFragmentStatus : *statusFragments)
+    {
+        if (!oFragmentStatus.ok())
+        {
+            m_aoFragments.clear();
+            return false;
+        }
+        FragmentInfo oInfo;
+        oInfo.poFragment = *oFragmentStatus;
+        m_aoFragments.push_back(std::move(oInfo));
+    }
+    return !m_aoFragments.empty();
+}
+
+/************************************************************************/
+/*                        LoadFragmentMetadata()                        */
+/************************************************************************/
+
+//! Read the footer of the file of a fragment, to get its row groups and
+//! its GeoParquet bounding boxes. May be called from a worker thread.
+void OGRParquetDatasetLayer::LoadFragmentMetadata(FragmentInfo &oInfo) const
+{
+    oInfo.bMetadataLoaded = true;
+
+    const auto poParquetFragment =
+        std::dynamic_pointer_cast<arrow::dataset::ParquetFileFragment>(
+            oInfo.poFragment);
+    if (!poParquetFragment || !poParquetFragment->EnsureCompleteMetadata().ok())
+        return;
+    const auto &metadata = poParquetFragment->metadata();
+    if (!metadata)
+        return;
+
+    oInfo.anRowGroups = poParquetFragment->row_groups();
+    int64_t nOffset = 0;
+    for (const int iRowGroup : oInfo.anRowGroups)
+    {
+        if (iRowGroup < 0 || iRowGroup >= metadata->num_row_groups())
+            return;
+        const int64_t nRows = metadata->RowGroup(iRowGroup)->num_rows();
+        oInfo.oMapRowGroups[iRowGroup] = std::make_pair(nOffset, nRows);
+        nOffset += nRows;
+    }
+    oInfo.nRowCount = nOffset;
+
+    const auto &kv_metadata = metadata->key_value_metadata();
+    if (kv_metadata && kv_metadata->Contains("geo"))
+    {
+        auto geo = kv_metadata->Get("geo");
+        CPLJSONDocument oDoc;
+        if (geo.ok() && oDoc.LoadMemory(*geo))
+        {
+            const auto oColumns = oDoc.GetRoot().GetObj("columns");
+            for (int i = 0; i < m_poFeatureDefn->GetGeomFieldCount(); ++i)
+            {
+                const auto oCol = oColumns.GetObj(
+                    m_poFeatureDefn->GetGeomFieldDefn(i)->GetNameRef());
+                OGREnvelope3D sExtent;
+                if (oCol.IsValid() &&
+                    GetExtentFromMetadata(oCol, &sExtent) == OGRERR_NONE)
+                {
+                    oInfo.oMapExtents[i] = sExtent;
+                }
+            }
+        }
+    }
+
+    oInfo.bMetadataValid = true;
+}
+
+/************************************************************************/
+/*                      LoadFragmentMetadataJob()                       */
+/************************************************************************/
+
+namespace
+{
+struct LoadFragmentMetadataJobData
+{
+    const OGRParquetDatasetLayer *poLayer = nullptr;
+    void *poInfo = nullptr;
+};
+}  // namespace
+
+void OGRParquetDatasetLayer::LoadFragmentMetadataJob(void *pData)
+{
+    const auto psData = static_cast<LoadFragmentMetadataJobData *>(pData);
+    psData->poLayer->LoadFragmentMetadata(
+        *static_cast<FragmentInfo *>(psData->poInfo));
+}
+
+/************************************************************************/
+/*                       LoadFragmentsMetadata()                        */
+/************************************************************************/
+
+//! Read the footer of all files, in parallel, since this mostly consists
+//! of waiting for network requests for remote datasets.
+bool OGRParquetDatasetLayer::LoadFragmentsMetadata()
+{
+    std::vector<LoadFragmentMetadataJobData> asJobs;
+    for (auto &oInfo : m_aoFragments)
+    {
+        if (!oInfo.bMetadataLoaded)
+        {
+            LoadFragmentMetadataJobData sData;
+            sData.poLayer = this;
+            sData.poInfo = &oInfo;
+            asJobs.push_back(sData);
+        }
+    }
+
+    const int nNumThreads = GetNumThreads();
+    CPLWorkerThreadPool *poPool =
+        nNumThreads > 1 && asJobs.size() > 1
+            ? GDALGetGlobalThreadPool(
+                  std::min(nNumThreads, static_cast<int>(asJobs.size())))
+            : nullptr;
+    if (poPool)
+    {
+        auto poQueue = poPool->CreateJobQueue();
+        for (auto &sData : asJobs)
+        {
+            if (!poQueue->SubmitJob(LoadFragmentMetadataJob, &sData))
+                LoadFragmentMetadataJob(&sData);
+        }
+        poQueue->WaitCompletion();
+    }
+    else
+    {
+        for (auto &sData : asJobs)
+            LoadFragmentMetadataJob(&sData);
+    }
+
+    for (const auto &oInfo : m_aoFragments)
+    {
+        if (!oInfo.bMetadataValid)
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          BuildArrowFilter()                          */
+/************************************************************************/
+
+//! Translate the spatial filter (when there is a covering bounding box
+//! column) and the attribute filter constraints into an Arrow expression.
+//! The expression is a superset of the OGR filters, which are still
+//! evaluated on the returned rows.
+bool OGRParquetDatasetLayer::BuildArrowFilter(
+    arrow::compute::Expression &oFilter) const
+{
+    namespace cp = arrow::compute;
+
+    // Field references must be by name, since column indices may differ
+    // between the dataset schema and the physical schema of each file.
+    const auto BuildFieldRef = [this](const std::vector<int> &anPath)
+    {
+        std::vector<arrow::FieldRef> aoRefs;
+        const arrow::Field *poField = nullptr;
+        for (const int iIdx : anPath)
+        {
+            if (poField == nullptr)
+                poField = m_poSchema->field(iIdx).get();
+            else
+                poField = poField->type()->field(iIdx).get();
+            aoRefs.emplace_back(poField->name());
+        }
+        const auto eTypeId = poField->type()->id();
+        return std::make_pair(aoRefs.size() == 1 ? std::move(aoRefs[0])
+                                                 : arrow::FieldRef(aoRefs),
+                              eTypeId);
+    };
+
+    std::vector<cp::Expression> aoExprs;
+
+    if (m_poFilterGeom)
+    {
+        const auto oIter =
+            m_oMapGeomFieldIndexToCoveringBBOX.find(m_iGeomFieldFilter);
+        if (oIter != m_oMapGeomFieldIndexToCoveringBBOX.end())
+        {
+            const auto &sDesc = oIter->second;
+            const auto SubField = [&sDesc, &BuildFieldRef](int iSubField)
+            {
+                return cp::field_ref(
+                    BuildFieldRef({sDesc.iArrowCol, iSubField}).first);
+            };
+            aoExprs.push_back(
+                cp::less_equal(SubField(sDesc.iArrowSubfieldXMin),
+                               cp::literal(m_sFilterEnvelope.MaxX)));
+            aoExprs.push_back(
+                cp::less_equal(SubField(sDesc.iArrowSubfieldYMin),
+                               cp::literal(m_sFilterEnvelope.MaxY)));
+            aoExprs.push_back(
+                cp::greater_equal(SubField(sDesc.iArrowSubfieldXMax),
+                                  cp::literal(m_sFilterEnvelope.MinX)));
+            aoExprs.push_back(
+                cp::greater_equal(SubField(sDesc.iArrowSubfieldYMax),
+                                  cp::literal(m_sFilterEnvelope.MinY)));
+        }
+    }
+
+    for (const auto &constraint : m_asAttributeFilterConstraints)
+    {
+        std::vector<int> anPath;
+        if (constraint.iField == m_poFeatureDefn->GetFieldCount() + SPF_FID)
+        {
+            if (m_iFIDArrowColumn < 0)
+                continue;
+            anPath.push_back(m_iFIDArrowColumn);
+        }
+        else if (constraint.iField >= 0 &&
+                 constraint.iField < m_poFeatureDefn->GetFieldCount())
+        {
+            anPath = m_anMapFieldIndexToArrowColumn[constraint.iField];
+        }
+        if (anPath.empty())
+            continue;
+
+        auto oFieldRefAndType = BuildFieldRef(anPath);
+        const auto oField = cp::field_ref(std::move(oFieldRefAndType.first));
+        const auto eTypeId = oFieldRefAndType.second;
+
+        if (constraint.nOperation == SWQ_ISNULL)
+        {
+            aoExprs.push_back(cp::is_null(oField));
+            continue;
+        }
+        if (constraint.nOperation == SWQ_ISNOTNULL)
+        {
+            aoExprs.push_back(cp::is_valid(oField));
+            continue;
+        }
+
+        // Only deal with Arrow types whose comparison semantics are the
+        // same as the OGR ones.
+        cp::Expression oValue;
+        switch (constraint.eType)
+        {
+            case Constraint::Type::Integer:
+            case Constraint::Type::Integer64:
+            case Constraint::Type::Real:
+            {
+                const bool bIsNumeric =
+                    eTypeId == arrow::Type::INT8 ||
+                    eTypeId == arrow::Type::UINT8 ||
+                    eTypeId == arrow::Type::INT16 ||
+                    eTypeId == arrow::Type::UINT16 ||
+                    eTypeId == arrow::Type::INT32 ||
+                    eTypeId == arrow::Type::UINT32 ||
+                    eTypeId == arrow::Type::INT64 ||
+                    eTypeId == arrow::Type::FLOAT ||
+                    eTypeId == arrow::Type::DOUBLE;
+                if (!bIsNumeric)
+                    continue;
+                if (constraint.eType == Constraint::Type::Integer)
+                    oValue = cp::literal(
+                        static_cast<int64_t>(constraint.sValue.Integer));
+                else if (constraint.eType == Constraint::Type::Integer64)
+                    oValue = cp::literal(
+                        static_cast<int64_t>(constraint.sValue.Integer64));
+                else
+                    oValue = cp::literal(constraint.sValue.Real);
+                break;
+            }
+
+            case Constraint::Type::String:
+            {
+                if (eTypeId != arrow::Type::STRING &&
+                    eTypeId != arrow::Type::LARGE_STRING)
+                    continue;
+                oValue = cp::literal(
+                    std::make_shared<arrow::StringScalar>(constraint.osValue));
+                break;
+            }
+        }
+
+        switch (constraint.nOperation)
+        {
+            case SWQ_EQ:
+                aoExprs.push_back(cp::equal(oField, oValue));
+                break;
+            case SWQ_NE:
+                aoExprs.push_back(cp::not_equal(oField, oValue));
+                break;
+            case SWQ_LT:
+                aoExprs.push_back(cp::less(oField, oValue));
+                break;
+            case SWQ_LE:
+                aoExprs.push_back(cp::less_equal(oField, oValue));
+                break;
+            case SWQ_GT:
+                aoExprs.push_back(cp::greater(oField, oValue));
+                break;
+            case SWQ_GE:
+                aoExprs.push_back(cp::greater_equal(oField, oValue));
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (aoExprs.empty())
+        return false;
+
+    auto oBoundFilter = cp::and_(aoExprs).Bind(*m_poSchema);
+    if (!oBoundFilter.ok())
+    {
+        CPLDebug("PARQUET", "Cannot bind Arrow filter expression: %s",
+                 oBoundFilter.status().message().c_str());
+        return false;
+    }
+    oFilter = *oBoundFilter;
+    CPLDebugOnly("PARQUET", "Arrow filter expression: %s",
+                 oFilter.ToString().c_str());
+    return true;
+}
+
+/************************************************************************/
+/*                          SelectFragments()                           */
+/************************************************************************/
+
+//! Return a dataset restricted to the fragments, and for each of them to
+//! the row groups, that may match the filters, or nullptr if no pruning can
+//! be done.
+std::shared_ptr<arrow::dataset::Dataset>
+OGRParquetDatasetLayer::SelectFragments(
+    const arrow::compute::Expression &oFilter, bool bHasFilter)
+{
+    const auto poFSDataset =
+        std::dynamic_pointer_cast<arrow::dataset::FileSystemDataset>(
+            m_poDataset);
+    if (!poFSDataset || !ListFragments())
+        return nullptr;
+
+    // Without a FID column, FIDs are the index of the features in the whole
+    // dataset, so we need to know the number of rows of discarded fragments
+    // and row groups.
+    const bool bNeedRowCounts = m_iFIDArrowColumn < 0;
+    if ((bNeedRowCounts || m_poFilterGeom) && !LoadFragmentsMetadata() &&
+        bNeedRowCounts)
+    {
+        return nullptr;
+    }
+
+    std::vector<std::shared_ptr<arrow::dataset::FileFragment>> apoFragments;
+    std::vector<std::pair<int64_t, int64_t>> asFeatureIdxRemapping;
+    int64_t nFeatureIdxTotal = 0;
+    int64_t nFeatureIdxSelected = 0;
+    int nDiscardedByPartition = 0;
+    int nDiscardedByBBOX = 0;
+    int nDiscardedByStatistics = 0;
+    bool bRowGroupsDiscarded = false;
+    for (const auto &oInfo : m_aoFragments)
+    {
+        const int64_t nFragmentStartIdx = nFeatureIdxTotal;
+        nFeatureIdxTotal += oInfo.nRowCount;
+
+        if (bHasFilter)
+        {
+            auto oSimplified = arrow::compute::SimplifyWithGuarantee(
+                oFilter, oInfo.poFragment->partition_expression());
+            if (oSimplified.ok() && !oSimplified->IsSatisfiable())
+            {
+                ++nDiscardedByPartition;
+                continue;
+            }
+        }
+
+        if (m_poFilterGeom)
+        {
+            const auto oIter = oInfo.oMapExtents.find(m_iGeomFieldFilter);
+            if (oIter != oInfo.oMapExtents.end() &&
+                !oIter->second.Intersects(m_sFilterEnvelope))
+            {
+                ++nDiscardedByBBOX;
+                continue;
+            }
+        }
+
+        auto poFragment = oInfo.poFragment;
+        if (bNeedRowCounts)
+        {
+            // When there is a FID column, Arrow does the row group
+            // selection by itself from the filter set on the scanner.
+            std::vector<int> anRowGroups = oInfo.anRowGroups;
+            if (bHasFilter)
+            {
+                // LoadFragmentsMetadata() has checked that this is a
+                // ParquetFileFragment
+                auto poSubset =
+                    std::static_pointer_cast<
+                        arrow::dataset::ParquetFileFragment>(poFragment)
+                        ->Subset(oFilter);
+                if (poSubset.ok())
+                {
+                    poFragment = *poSubset;
+                    anRowGroups =
+                        std::static_pointer_cast<
+                            arrow::dataset::ParquetFileFragment>(poFragment)
+                            ->row_groups();
+                }
+            }
+            if (anRowGroups.empty())
+            {
+                ++nDiscardedByStatistics;
+                continue;
+            }
+            if (anRowGroups.size() != oInfo.anRowGroups.size())
+                bRowGroupsDiscarded = true;
+
+            for (const int iRowGroup : anRowGroups)
+            {
+                const auto oIter = oInfo.oMapRowGroups.find(iRowGroup);
+                if (oIter == oInfo.oMapRowGroups.end())
+                    return nullptr;
+                asFeatureIdxRemapping.emplace_back(
+                    std::make_pair(nFeatureIdxSelected,
+                                   nFragmentStartIdx + oIter->second.first));
+                nFeatureIdxSelected += oIter->second.second;
+            }
+        }
+
+        auto poFileFragment =
+            std::dynamic_pointer_cast<arrow::dataset::FileFragment>(poFragment);
+        if (!poFileFragment)
+            return nullptr;
+        apoFragments.push_back(std::move(poFileFragment));
+    }
+
+    CPLDebug("PARQUET",
+             "%d/%d fragments selected (%d discarded by partitioning, "
+             "%d by bounding box, %d by row group statistics)",
+             static_cast<int>(apoFragments.size()),
+             static_cast<int>(m_aoFragments.size()), nDiscardedByPartition,
+             nDiscardedByBBOX, nDiscardedByStatistics);
+    if (apoFragments.size() == m_aoFragments.size() && !bRowGroupsDiscarded)
+        return nullptr;
+
+    auto poSubsetDataset = arrow::dataset::FileSystemDataset::Make(
+        poFSDataset->schema(), poFSDataset->partition_expression(),
+        poFSDataset->format(), poFSDataset->filesystem(),
+        std::move(apoFragments));
+    if (!poSubsetDataset.ok())
+    {
+        CPLDebug("PARQUET", "FileSystemDataset::Make() failed: %s",
+                 poSubsetDataset.status().message().c_str());
+        return nullptr;
+    }
+
+    if (bNeedRowCounts)
+        m_asFeatureIdxRemapping = std::move(asFeatureIdxRemapping);
+    return *poSubsetDataset;
+}
+
+/************************************************************************/
+/*                            BuildScanner()                            */
+/************************************************************************/
+
+bool OGRParquetDatasetLayer::BuildScanner()
+{
+    m_bRebuildScanner = false;
+    m_poScanner.reset();
+    m_asFeatureIdxRemapping.clear();
+
+    arrow::compute::Expression oFilter;
+    const bool bHasFilter = BuildArrowFilter(oFilter);
+
+    auto poDataset = m_poDataset;
+    if ((bHasFilter || m_poFilterGeom) &&
+        CPLTestBool(
+            CPLGetConfigOption("OGR_PARQUET_DATASET_SELECT_FRAGMENTS", "YES")))
+    {
+        auto poSubsetDataset = SelectFragments(oFilter, bHasFilter);
+        if (poSubsetDataset)
+            poDataset = std::move(poSubsetDataset);
+    }
+
+    m_oFeatureIdxRemappingIter = m_asFeatureIdxRemapping.begin();
+    m_nFeatureIdxSelected = 0;
+    if (!m_asFeatureIdxRemapping.empty())
+    {
+        m_nFeatureIdx = m_oFeatureIdxRemappingIter->second;
+        ++m_oFeatureIdxRemappingIter;
+    }
+
+    auto scannerBuilderResult = poDataset->NewScan();
+    if (!scannerBuilderResult.ok())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "NewScan() failed: %s",
+                 scannerBuilderResult.status().message().c_str());
+        return false;
+    }
+    auto scannerBuilder = *scannerBuilderResult;
+
+    const auto CheckStatus = [](const arrow::Status &status,
+                                const char *pszMethod)
+    {
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s() failed: %s", pszMethod,
+                     status.message().c_str());
+            return false;
+        }
+        return true;
+    };
+
+    // We cannot use the shared memory pool of the dataset. Otherwise we get
+    // random crashes in multi-threaded arrow code (apparently some cleanup
+    // code), that may used the memory pool after it has been destroyed.
+    // scannerBuilder->Pool(m_poMemoryPool);
+
+    if (m_bIsVSI)
+    {
+        const int nFragmentReadAhead =
+            atoi(CPLGetConfigOption("OGR_PARQUET_FRAGMENT_READ_AHEAD", "2"));
+        if (!CheckStatus(scannerBuilder->FragmentReadahead(nFragmentReadAhead),
+                         "FragmentReadahead"))
+            return false;
+
+        const char *pszBatchSize =
+            CPLGetConfigOption("OGR_PARQUET_BATCH_SIZE", nullptr);
+        if (pszBatchSize &&
+            !CheckStatus(scannerBuilder->BatchSize(CPLAtoGIntBig(pszBatchSize)),
+                         "BatchSize"))
+            return false;
+
+#if PARQUET_VERSION_MAJOR >= 10
+        const char *pszBatchReadAhead =
+            CPLGetConfigOption("OGR_PARQUET_BATCH_READ_AHEAD", nullptr);
+        if (pszBatchReadAhead &&
+            !CheckStatus(
+                scannerBuilder->BatchReadahead(atoi(pszBatchReadAhead)),
+                "BatchReadahead"))
+            return false;
+#endif
+    }
+
+    const int nNumThreads = GetNumThreads();
+    if (nNumThreads > 1)
+    {
+        CPL_IGNORE_RET_VAL(arrow::SetCpuThreadPoolCapacity(nNumThreads));
+    }
+
+    // Fragments are read in parallel, while batches are still returned
+    // in order.
+    const char *pszUseThreads =
+        CPLGetConfigOption("OGR_PARQUET_USE_THREADS", nullptr);
+    const bool bUseThreads =
+        pszUseThreads ? CPLTestBool(pszUseThreads) : nNumThreads > 1;
+    if (!CheckStatus(scannerBuilder->UseThreads(bUseThreads), "UseThreads"))
+        return false;
+
+    // Without a FID column, rows cannot be filtered by Arrow, otherwise we
+    // would lose track of FIDs.
+    if (bHasFilter && m_iFIDArrowColumn >= 0 &&
+        !CheckStatus(scannerBuilder->Filter(oFilter), "Filter"))
+        return false;
+
+    auto scannerResult = scannerBuilder->Finish();
+    if (!scannerResult.ok())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Finish() failed: %s",
+                 scannerResult.status().message().c_str());
+        return false;
+    }
+    m_poScanner = *scannerResult;
+    return true;
 }
 
 /************************************************************************/
@@ -105,6 +767,8 @@ bool OGRParquetDatasetLayer::ReadNextBatch()
 
     if (m_poRecordBatchReader == nullptr)
     {
+        if ((m_bRebuildScanner || !m_poScanner) && !BuildScanner())
+            return false;
         auto result = m_poScanner->ToRecordBatchReader();
         if (!result.ok())
         {
@@ -149,16 +813,80 @@ bool OGRParquetDatasetLayer::ReadNextBatch()
 
 void OGRParquetDatasetLayer::InvalidateCachedBatches()
 {
+    m_iRecordBatch = -1;
     ResetReading();
 }
 
+/************************************************************************/
+/*                           ResetReading()                             */
+/************************************************************************/
+
+void OGRParquetDatasetLayer::ResetReading()
+{
+    OGRParquetLayerBase::ResetReading();
+    m_oFeatureIdxRemappingIter = m_asFeatureIdxRemapping.begin();
+    m_nFeatureIdxSelected = 0;
+    if (!m_asFeatureIdxRemapping.empty())
+    {
+        m_nFeatureIdx = m_oFeatureIdxRemappingIter->second;
+        ++m_oFeatureIdxRemappingIter;
+    }
+}
+
+/************************************************************************/
+/*                           IncrFeatureIdx()                           */
+/************************************************************************/
+
+void OGRParquetDatasetLayer::IncrFeatureIdx()
+{
+    ++m_nFeatureIdxSelected;
+    ++m_nFeatureIdx;
+    if (m_iFIDArrowColumn < 0 && !m_asFeatureIdxRemapping.empty() &&
+        m_oFeatureIdxRemappingIter != m_asFeatureIdxRemapping.end())
+    {
+        if (m_nFeatureIdxSelected == m_oFeatureIdxRemappingIter->first)
+        {
+            m_nFeatureIdx = m_oFeatureIdxRemappingIter->second;
+            ++m_oFeatureIdxRemappingIter;
+        }
+    }
+}
+
+/************************************************************************/
+/*                        SetAttributeFilter()                          */
+/************************************************************************/
+
+OGRErr OGRParquetDatasetLayer::SetAttributeFilter(const char *pszFilter)
+{
+    const OGRErr eErr = OGRParquetLayerBase::SetAttributeFilter(pszFilter);
+    if (eErr == OGRERR_NONE)
+    {
+        m_bRebuildScanner = true;
+        InvalidateCachedBatches();
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                         SetSpatialFilter()                           */
+/************************************************************************/
+
+void OGRParquetDatasetLayer::SetSpatialFilter(int iGeomField,
+                                              OGRGeometry *poGeomIn)
+{
+    OGRParquetLayerBase::SetSpatialFilter(iGeomField, poGeomIn);
+    m_bRebuildScanner = true;
+    InvalidateCachedBatches();
+}
+
 /************************************************************************/
 /*                        GetFeatureCount()                             */
 /************************************************************************/
 
 GIntBig OGRParquetDatasetLayer::GetFeatureCount(int bForce)
 {
-    if (m_poAttrQuery == nullptr && m_poFilterGeom == nullptr)
+    if (m_poAttrQuery == nullptr && m_poFilterGeom == nullptr &&
+        ((!m_bRebuildScanner && m_poScanner) || BuildScanner()))
     {
         auto status = m_poScanner->CountRows();
         if (status.ok())
@@ -222,7 +950,7 @@ OGRErr OGRParquetDatasetLayer::GetExtent(int iGeomField, OGREnvelope *psExtent,
     auto oIter = m_oMapGeometryColumns.find(pszGeomFieldName);
     if (oIter != m_oMapGeometryColumns.end())
     {
-        auto statusFragments = m_poScanner->dataset()->GetFragments();
+        auto statusFragments = m_poDataset->GetFragments();
         if (statusFragments.ok())
         {
             *psExtent = OGREnvelope();
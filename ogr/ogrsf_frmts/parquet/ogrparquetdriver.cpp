@@ -246,73 +246,15 @@ static GDALDataset *OpenFromDatasetFactory(
     std::shared_ptr<arrow::dataset::Dataset> dataset;
     PARQUET_ASSIGN_OR_THROW(dataset, factory->Finish());
 
-    std::shared_ptr<arrow::dataset::ScannerBuilder> scannerBuilder;
-    PARQUET_ASSIGN_OR_THROW(scannerBuilder, dataset->NewScan());
-
     auto poMemoryPool = std::shared_ptr<arrow::MemoryPool>(
         arrow::MemoryPool::CreateDefault().release());
 
-    // We cannot use the above shared memory pool. Otherwise we get random
-    // crashes in multi-threaded arrow code (apparently some cleanup code),
-    // that may used the memory pool after it has been destroyed.
-    // PARQUET_THROW_NOT_OK(scannerBuilder->Pool(poMemoryPool.get()));
-
+    // The scanner is built by the layer, since it depends on the filters
     const bool bIsVSI = STARTS_WITH(osBasePath.c_str(), "/vsi");
-    if (bIsVSI)
-    {
-        const int nFragmentReadAhead =
-            atoi(CPLGetConfigOption("OGR_PARQUET_FRAGMENT_READ_AHEAD", "2"));
-        PARQUET_THROW_NOT_OK(
-            scannerBuilder->FragmentReadahead(nFragmentReadAhead));
-
-        const char *pszBatchSize =
-            CPLGetConfigOption("OGR_PARQUET_BATCH_SIZE", nullptr);
-        if (pszBatchSize)
-        {
-            PARQUET_THROW_NOT_OK(
-                scannerBuilder->BatchSize(CPLAtoGIntBig(pszBatchSize)));
-        }
-
-        const char *pszUseThreads =
-            CPLGetConfigOption("OGR_PARQUET_USE_THREADS", nullptr);
-        if (pszUseThreads)
-        {
-            PARQUET_THROW_NOT_OK(
-                scannerBuilder->UseThreads(CPLTestBool(pszUseThreads)));
-        }
-
-        const char *pszNumThreads =
-            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
-        int nNumThreads = 0;
-        if (pszNumThreads == nullptr)
-            nNumThreads = std::min(4, CPLGetNumCPUs());
-        else
-            nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
-                              ? CPLGetNumCPUs()
-                              : atoi(pszNumThreads);
-        if (nNumThreads > 1)
-        {
-            CPL_IGNORE_RET_VAL(arrow::SetCpuThreadPoolCapacity(nNumThreads));
-        }
-
-#if PARQUET_VERSION_MAJOR >= 10
-        const char *pszBatchReadAhead =
-            CPLGetConfigOption("OGR_PARQUET_BATCH_READ_AHEAD", nullptr);
-        if (pszBatchReadAhead)
-        {
-            PARQUET_THROW_NOT_OK(
-                scannerBuilder->BatchReadahead(atoi(pszBatchReadAhead)));
-        }
-#endif
-    }
-
-    std::shared_ptr<arrow::dataset::Scanner> scanner;
-    PARQUET_ASSIGN_OR_THROW(scanner, scannerBuilder->Finish());
-
     auto poDS = std::make_unique<OGRParquetDataset>(poMemoryPool);
     auto poLayer = std::make_unique<OGRParquetDatasetLayer>(
-        poDS.get(), CPLGetBasename(osBasePath.c_str()), scanner,
-        scannerBuilder->schema(), papszOpenOptions);
+        poDS.get(), CPLGetBasename(osBasePath.c_str()), bIsVSI, dataset,
+        papszOpenOptions);
     poDS->SetLayer(std::move(poLayer));
     return poDS.release();
 }
@@ -693,12 +635,43 @@ static GDALDataset *OGRParquetDriverOpen(GDALOpenInfo *poOpenInfo)
                                     arrow::io::ReadableFile::Open(osFilename));
         }
 
+        parquet::ArrowReaderProperties arrowReaderProperties;
+        if (VSIHasOptimizedReadMultiRange(osFilename.c_str()) &&
+            CPLTestBool(CPLGetConfigOption("OGR_PARQUET_PRE_BUFFER", "YES")))
+        {
+            // Let Arrow coalesce the reads of the column chunks of the row
+            // groups, with the same policy as the ReadMultiRange()
+            // implementation of network file systems.
+            const auto sPolicy =
+                VSIGetMultiRangeCoalescingPolicy(osFilename.c_str());
+            auto cacheOptions = arrow::io::CacheOptions::Defaults();
+            if (sPolicy.nMaxGap > 0)
+                cacheOptions.hole_size_limit =
+                    static_cast<int64_t>(sPolicy.nMaxGap);
+            if (sPolicy.nMaxRequestSize > 0)
+                cacheOptions.range_size_limit = std::max(
+                    cacheOptions.hole_size_limit + 1,
+                    static_cast<int64_t>(sPolicy.nMaxRequestSize));
+#if ARROW_VERSION_MAJOR >= 8
+            // Only read the row groups that are actually requested
+            cacheOptions.lazy = true;
+#endif
+            arrowReaderProperties.set_pre_buffer(true);
+            arrowReaderProperties.set_cache_options(cacheOptions);
+        }
+
         // Open Parquet file reader
         std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
         auto poMemoryPool = std::shared_ptr<arrow::MemoryPool>(
             arrow::MemoryPool::CreateDefault().release());
-        auto st = parquet::arrow::OpenFile(std::move(infile),
-                                           poMemoryPool.get(), &arrow_reader);
+        parquet::arrow::FileReaderBuilder fileReaderBuilder;
+        auto st = fileReaderBuilder.Open(std::move(infile));
+        if (st.ok())
+        {
+            st = fileReaderBuilder.memory_pool(poMemoryPool.get())
+                     ->properties(arrowReaderProperties)
+                     ->Build(&arrow_reader);
+        }
         if (!st.ok())
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -938,6 +911,18 @@ void OGRParquetDriver::InitMetadata()
                                    "geometries");
     }
 
+#if PARQUET_VERSION_MAJOR >= 12
+    {
+        auto psOption = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
+        CPLAddXMLAttributeAndValue(psOption, "name", "WRITE_PAGE_INDEX");
+        CPLAddXMLAttributeAndValue(psOption, "type", "boolean");
+        CPLAddXMLAttributeAndValue(psOption, "default", "YES");
+        CPLAddXMLAttributeAndValue(psOption, "description",
+                                   "Whether to write the page index (column "
+                                   "index and offset index)");
+    }
+#endif
+
     {
         auto psOption = CPLCreateXMLNode(oTree.get(), CXT_Element, "Option");
         CPLAddXMLAttributeAndValue(psOption, "name", "SORT_BY_BBOX");
@@ -135,12 +135,10 @@ void OGRParquetLayerBase::LoadGeoMetadata(
 /************************************************************************/
 
 //! Parse bounding box column definition
-static bool ParseGeometryColumnCovering(const CPLJSONObject &oJSONDef,
-                                        std::string &osBBOXColumn,
-                                        std::string &osXMin,
-                                        std::string &osYMin,
-                                        std::string &osXMax,
-                                        std::string &osYMax)
+bool OGRParquetLayerBase::ParseGeometryColumnCovering(
+    const CPLJSONObject &oJSONDef, std::string &osBBOXColumn,
+    std::string &osXMin, std::string &osYMin, std::string &osXMax,
+    std::string &osYMax)
 {
     const auto oCovering = oJSONDef["covering"];
     if (oCovering.IsValid() &&
@@ -1396,6 +1394,286 @@ void OGRParquetLayer::IncrFeatureIdx()
     }
 }
 
+#if PARQUET_VERSION_MAJOR >= 12
+
+/************************************************************************/
+/*                 GetCandidateRowRangesFromPageIndex()                 */
+/************************************************************************/
+
+/** Fill aoRanges with the [start, end[ ranges of rows of a row group that
+ * belong to pages whose minimum value (bTestMin == true) is not greater than
+ * dfBound, or whose maximum value (bTestMin == false) is not lower than
+ * dfBound.
+ *
+ * Pages with only null values are skipped, as features with a null bounding
+ * box are never selected by a spatial filter.
+ *
+ * @return false if the page index is inconsistent.
+ */
+template <class ColumnIndexType>
+static bool GetCandidateRowRangesFromPageIndex(
+    const parquet::ColumnIndex *poColumnIndex,
+    const parquet::OffsetIndex *poOffsetIndex, int64_t nRowGroupRows,
+    bool bTestMin, double dfBound,
+    std::vector<std::pair<int64_t, int64_t>> &aoRanges)
+{
+    const auto poTypedColumnIndex =
+        static_cast<const ColumnIndexType *>(poColumnIndex);
+    const auto &asPageLocations = poOffsetIndex->page_locations();
+    const auto &abNullPages = poColumnIndex->null_pages();
+    const auto &aMinValues = poTypedColumnIndex->min_values();
+    const auto &aMaxValues = poTypedColumnIndex->max_values();
+    const size_t nPages = asPageLocations.size();
+    if (abNullPages.size() != nPages || aMinValues.size() != nPages ||
+        aMaxValues.size() != nPages)
+    {
+        return false;
+    }
+
+    aoRanges.clear();
+    for (size_t i = 0; i < nPages; ++i)
+    {
+        if (abNullPages[i])
+            continue;
+        if (bTestMin ? static_cast<double>(aMinValues[i]) > dfBound
+                     : static_cast<double>(aMaxValues[i]) < dfBound)
+            continue;
+        const int64_t nStart = asPageLocations[i].first_row_index;
+        const int64_t nEnd = i + 1 < nPages
+                                 ? asPageLocations[i + 1].first_row_index
+                                 : nRowGroupRows;
+        if (nStart >= nEnd)
+            continue;
+        if (!aoRanges.empty() && aoRanges.back().second == nStart)
+            aoRanges.back().second = nEnd;
+        else
+            aoRanges.emplace_back(nStart, nEnd);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         IntersectRowRanges()                         */
+/************************************************************************/
+
+/** Return the intersection of two sorted lists of disjoint [start, end[
+ * row ranges. */
+static std::vector<std::pair<int64_t, int64_t>>
+IntersectRowRanges(const std::vector<std::pair<int64_t, int64_t>> &aoA,
+                   const std::vector<std::pair<int64_t, int64_t>> &aoB)
+{
+    std::vector<std::pair<int64_t, int64_t>> aoRet;
+    size_t iA = 0;
+    size_t iB = 0;
+    while (iA < aoA.size() && iB < aoB.size())
+    {
+        const int64_t nStart = std::max(aoA[iA].first, aoB[iB].first);
+        const int64_t nEnd = std::min(aoA[iA].second, aoB[iB].second);
+        if (nStart < nEnd)
+            aoRet.emplace_back(nStart, nEnd);
+        if (aoA[iA].second < aoB[iB].second)
+            ++iA;
+        else
+            ++iB;
+    }
+    return aoRet;
+}
+
+/************************************************************************/
+/*             IsRowGroupIntersectingFilterFromPageIndex()              */
+/************************************************************************/
+
+/** Use the page index (column index and offset index) of the bounding box
+ * columns to determine if at least one row of the row group may intersect
+ * the spatial filter.
+ *
+ * This is finer grained than row group statistics, since the minimum and
+ * maximum values of the 4 columns are combined on ranges of rows instead of
+ * on the whole row group.
+ *
+ * Returns true when the page index is not available.
+ */
+bool OGRParquetLayer::IsRowGroupIntersectingFilterFromPageIndex(
+    parquet::PageIndexReader *poPageIndexReader, int iRowGroup,
+    const GeomColBBOXParquet &sBBOXParquet) const
+{
+    const auto metadata = m_poArrowReader->parquet_reader()->metadata();
+    const int64_t nRowGroupRows = metadata->RowGroup(iRowGroup)->num_rows();
+
+    const struct
+    {
+        int iParquetCol;
+        bool bTestMin;
+        double dfBound;
+    } asTests[] = {
+        {sBBOXParquet.iParquetXMin, true, m_sFilterEnvelope.MaxX},
+        {sBBOXParquet.iParquetYMin, true, m_sFilterEnvelope.MaxY},
+        {sBBOXParquet.iParquetXMax, false, m_sFilterEnvelope.MinX},
+        {sBBOXParquet.iParquetYMax, false, m_sFilterEnvelope.MinY},
+    };
+
+    std::vector<std::pair<int64_t, int64_t>> aoCandidateRanges{
+        {0, nRowGroupRows}};
+    std::vector<std::pair<int64_t, int64_t>> aoRanges;
+    try
+    {
+        const auto poRowGroupPageIndexReader =
+            poPageIndexReader->RowGroup(iRowGroup);
+        if (!poRowGroupPageIndexReader)
+            return true;
+
+        for (const auto &sTest : asTests)
+        {
+            const auto poColumnIndex =
+                poRowGroupPageIndexReader->GetColumnIndex(sTest.iParquetCol);
+            const auto poOffsetIndex =
+                poRowGroupPageIndexReader->GetOffsetIndex(sTest.iParquetCol);
+            if (!poColumnIndex || !poOffsetIndex)
+                continue;
+
+            bool bOK = false;
+            const auto ePhysicalType =
+                metadata->schema()->Column(sTest.iParquetCol)->physical_type();
+            if (ePhysicalType == parquet::Type::DOUBLE)
+            {
+                bOK = GetCandidateRowRangesFromPageIndex<
+                    parquet::DoubleColumnIndex>(
+                    poColumnIndex.get(), poOffsetIndex.get(), nRowGroupRows,
+                    sTest.bTestMin, sTest.dfBound, aoRanges);
+            }
+            else if (ePhysicalType == parquet::Type::FLOAT)
+            {
+                bOK = GetCandidateRowRangesFromPageIndex<
+                    parquet::FloatColumnIndex>(
+                    poColumnIndex.get(), poOffsetIndex.get(), nRowGroupRows,
+                    sTest.bTestMin, sTest.dfBound, aoRanges);
+            }
+            if (!bOK)
+                continue;
+
+            aoCandidateRanges = IntersectRowRanges(aoCandidateRanges, aoRanges);
+            if (aoCandidateRanges.empty())
+                return false;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        CPLDebug("PARQUET", "Cannot use page index of row group %d: %s",
+                 iRowGroup, e.what());
+    }
+
+    return true;
+}
+
+#endif  // PARQUET_VERSION_MAJOR >= 12
+
+/************************************************************************/
+/*                     IsAnyBBOXIntersectingFilter()                    */
+/************************************************************************/
+
+template <class ArrayType>
+static bool IsAnyBBOXIntersectingFilter(const arrow::StructArray *poBBOXArray,
+                                        const arrow::Array *poXMinArray,
+                                        const arrow::Array *poYMinArray,
+                                        const arrow::Array *poXMaxArray,
+                                        const arrow::Array *poYMaxArray,
+                                        const OGREnvelope &sFilterEnvelope)
+{
+    const auto poXMin = static_cast<const ArrayType *>(poXMinArray);
+    const auto poYMin = static_cast<const ArrayType *>(poYMinArray);
+    const auto poXMax = static_cast<const ArrayType *>(poXMaxArray);
+    const auto poYMax = static_cast<const ArrayType *>(poYMaxArray);
+    OGREnvelope sEnvelope;
+    const int64_t nLength = poBBOXArray->length();
+    for (int64_t i = 0; i < nLength; ++i)
+    {
+        if (!poBBOXArray->IsNull(i) && !poXMin->IsNull(i))
+        {
+            sEnvelope.MinX = poXMin->Value(i);
+            sEnvelope.MinY = poYMin->Value(i);
+            sEnvelope.MaxX = poXMax->Value(i);
+            sEnvelope.MaxY = poYMax->Value(i);
+            if (sFilterEnvelope.Intersects(sEnvelope))
+                return true;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*             IsRowGroupIntersectingFilterFromBBOXColumn()             */
+/************************************************************************/
+
+/** Read only the bounding box column of a row group, and check if at least
+ * one of its rows intersects the spatial filter.
+ *
+ * This avoids reading and decoding the geometry column (and other columns)
+ * of row groups whose statistics overlap the spatial filter, but that
+ * contain no feature actually intersecting it, which is typical of files
+ * that are not spatially sorted.
+ *
+ * Returns true in case of error.
+ */
+bool OGRParquetLayer::IsRowGroupIntersectingFilterFromBBOXColumn(
+    int iRowGroup, const GeomColBBOX &sBBOX,
+    const GeomColBBOXParquet &sBBOXParquet) const
+{
+    std::shared_ptr<arrow::Table> poTable;
+    auto status = m_poArrowReader->ReadRowGroup(
+        iRowGroup, sBBOXParquet.anParquetCols, &poTable);
+    if (!status.ok())
+    {
+        CPLDebug("PARQUET", "ReadRowGroup() failed: %s",
+                 status.message().c_str());
+        return true;
+    }
+    if (!poTable || poTable->num_columns() != 1)
+        return true;
+
+    const auto eExpectedType =
+        sBBOX.bIsFloat ? arrow::Type::FLOAT : arrow::Type::DOUBLE;
+    for (const auto &poChunk : poTable->column(0)->chunks())
+    {
+        if (poChunk->type_id() != arrow::Type::STRUCT)
+            return true;
+        const auto poBBOXArray =
+            static_cast<const arrow::StructArray *>(poChunk.get());
+        const auto &subArrays = poBBOXArray->fields();
+        const int nSubArrays = static_cast<int>(subArrays.size());
+        if (sBBOX.iArrowSubfieldXMin >= nSubArrays ||
+            sBBOX.iArrowSubfieldYMin >= nSubArrays ||
+            sBBOX.iArrowSubfieldXMax >= nSubArrays ||
+            sBBOX.iArrowSubfieldYMax >= nSubArrays)
+        {
+            return true;
+        }
+        const auto poXMinArray = subArrays[sBBOX.iArrowSubfieldXMin].get();
+        const auto poYMinArray = subArrays[sBBOX.iArrowSubfieldYMin].get();
+        const auto poXMaxArray = subArrays[sBBOX.iArrowSubfieldXMax].get();
+        const auto poYMaxArray = subArrays[sBBOX.iArrowSubfieldYMax].get();
+        if (poXMinArray->type_id() != eExpectedType ||
+            poYMinArray->type_id() != eExpectedType ||
+            poXMaxArray->type_id() != eExpectedType ||
+            poYMaxArray->type_id() != eExpectedType)
+        {
+            return true;
+        }
+
+        if (sBBOX.bIsFloat
+                ? IsAnyBBOXIntersectingFilter<arrow::FloatArray>(
+                      poBBOXArray, poXMinArray, poYMinArray, poXMaxArray,
+                      poYMaxArray, m_sFilterEnvelope)
+                : IsAnyBBOXIntersectingFilter<arrow::DoubleArray>(
+                      poBBOXArray, poXMinArray, poYMinArray, poXMaxArray,
+                      poYMaxArray, m_sFilterEnvelope))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /************************************************************************/
 /*                           ReadNextBatch()                            */
 /************************************************************************/
@@ -1510,6 +1788,57 @@ bool OGRParquetLayer::ReadNextBatch()
                 iYMaxField = oIterToGeomColBBOX->second.iParquetYMax;
             }
 
+            // Use of the content of the bounding box column, read
+            // separately from the other columns, to discard row groups
+            // whose statistics overlap the spatial filter, but that do not
+            // contain any intersecting feature.
+            const GeomColBBOX *psBBOX = nullptr;
+            if (bUSEBBOXFields && !bIsGeoArrowStruct &&
+                CPLTestBool(CPLGetConfigOption(
+                    "OGR_PARQUET_PREFILTER_BBOX_ROWS", "YES")))
+            {
+                const auto oIterBBOX =
+                    m_oMapGeomFieldIndexToGeomColBBOX.find(m_iGeomFieldFilter);
+                if (oIterBBOX != m_oMapGeomFieldIndexToGeomColBBOX.end())
+                    psBBOX = &(oIterBBOX->second);
+            }
+            int nRowGroupsDiscardedByBBOXRows = 0;
+
+#if PARQUET_VERSION_MAJOR >= 12
+            std::shared_ptr<parquet::PageIndexReader> poPageIndexReader;
+            int nRowGroupsDiscardedByPageIndex = 0;
+            if (bUSEBBOXFields && !bIsGeoArrowStruct &&
+                CPLTestBool(CPLGetConfigOption("OGR_PARQUET_USE_PAGE_INDEX",
+                                               "YES")))
+            {
+                try
+                {
+                    poPageIndexReader =
+                        m_poArrowReader->parquet_reader()->GetPageIndexReader();
+                    if (poPageIndexReader)
+                    {
+                        // Prefetch the column and offset indexes of the
+                        // bounding box columns of all row groups in one go.
+                        std::vector<int32_t> anRowGroups;
+                        for (int i = 0; i < nNumGroups; ++i)
+                            anRowGroups.push_back(i);
+                        const std::vector<int32_t> anCols{
+                            iXMinField, iYMinField, iXMaxField, iYMaxField};
+                        parquet::PageIndexSelection sSelection;
+                        sSelection.column_index = true;
+                        sSelection.offset_index = true;
+                        poPageIndexReader->WillNeed(anRowGroups, anCols,
+                                                    sSelection);
+                    }
+                }
+                catch (const std::exception &e)
+                {
+                    CPLDebug("PARQUET", "Cannot use page index: %s", e.what());
+                    poPageIndexReader.reset();
+                }
+            }
+#endif
+
             for (int iRowGroup = 0;
                  iRowGroup < nNumGroups && !bIterateEverything; ++iRowGroup)
             {
@@ -1571,6 +1900,17 @@ bool OGRParquetLayer::ReadNextBatch()
                     }
                 }
 
+#if PARQUET_VERSION_MAJOR >= 12
+                if (bSelectGroup && poPageIndexReader &&
+                    !IsRowGroupIntersectingFilterFromPageIndex(
+                        poPageIndexReader.get(), iRowGroup,
+                        oIterToGeomColBBOX->second))
+                {
+                    bSelectGroup = false;
+                    ++nRowGroupsDiscardedByPageIndex;
+                }
+#endif
+
                 if (bSelectGroup)
                 {
                     for (auto &constraint : m_asAttributeFilterConstraints)
@@ -1743,6 +2083,14 @@ bool OGRParquetLayer::ReadNextBatch()
                     }
                 }
 
+                if (bSelectGroup && !bIterateEverything && psBBOX &&
+                    !IsRowGroupIntersectingFilterFromBBOXColumn(
+                        iRowGroup, *psBBOX, oIterToGeomColBBOX->second))
+                {
+                    bSelectGroup = false;
+                    ++nRowGroupsDiscardedByBBOXRows;
+                }
+
                 if (bSelectGroup)
                 {
                     // CPLDebug("PARQUET", "Selecting row group %d", iRowGroup);
@@ -1754,6 +2102,21 @@ bool OGRParquetLayer::ReadNextBatch()
 
                 nFeatureIdxTotal += poRowGroup->metadata()->num_rows();
             }
+
+#if PARQUET_VERSION_MAJOR >= 12
+            if (nRowGroupsDiscardedByPageIndex > 0)
+            {
+                CPLDebug("PARQUET", "%d row groups discarded using page index",
+                         nRowGroupsDiscardedByPageIndex);
+            }
+#endif
+            if (nRowGroupsDiscardedByBBOXRows > 0)
+            {
+                CPLDebug("PARQUET",
+                         "%d row groups discarded using bounding box column "
+                         "content",
+                         nRowGroupsDiscardedByBBOXRows);
+            }
         }
 
         if (bIterateEverything)
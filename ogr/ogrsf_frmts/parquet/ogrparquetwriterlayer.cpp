@@ -35,6 +35,9 @@
 
 #include "ogr_wkb.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 /************************************************************************/
@@ -52,15 +55,26 @@ OGRParquetWriterLayer::OGRParquetWriterLayer(
         CPLGetConfigOption("OGR_PARQUET_WRITE_ARROW_EXTENSION_NAME", "NO"));
 }
 
+/************************************************************************/
+/*                     ~OGRParquetWriterLayer()                         */
+/************************************************************************/
+
+OGRParquetWriterLayer::~OGRParquetWriterLayer()
+{
+    CloseAndUnlinkTmpFile();
+}
+
 /************************************************************************/
 /*                                Close()                               */
 /************************************************************************/
 
 bool OGRParquetWriterLayer::Close()
 {
-    if (m_poTmpGPKGLayer)
+    if (m_bSortByBBOX)
     {
-        if (!CopyTmpGpkgLayerToFinalFile())
+        const bool bRet = CopySortedTmpFeaturesToFinalFile();
+        CloseAndUnlinkTmpFile();
+        if (!bRet)
             return false;
     }
 
@@ -74,220 +88,185 @@ bool OGRParquetWriterLayer::Close()
 }
 
 /************************************************************************/
-/*                     CopyTmpGpkgLayerToFinalFile()                    */
+/*                       CloseAndUnlinkTmpFile()                        */
 /************************************************************************/
 
-bool OGRParquetWriterLayer::CopyTmpGpkgLayerToFinalFile()
+void OGRParquetWriterLayer::CloseAndUnlinkTmpFile()
 {
-    if (!m_poTmpGPKGLayer)
+    m_fpTmp.reset();
+    if (!m_osTmpFilename.empty())
     {
-        return true;
+        VSIUnlink(m_osTmpFilename.c_str());
+        m_osTmpFilename.clear();
     }
+    m_asSortItems.clear();
+    m_asSortItems.shrink_to_fit();
+}
+
+/************************************************************************/
+/*                              Hilbert()                               */
+/************************************************************************/
+
+// Based on public domain code at
+// https://github.com/rawrunprotected/hilbert_curves
+static uint32_t Hilbert(uint32_t x, uint32_t y)
+{
+    uint32_t a = x ^ y;
+    uint32_t b = 0xFFFF ^ a;
+    uint32_t c = 0xFFFF ^ (x | y);
+    uint32_t d = x & (y ^ 0xFFFF);
+
+    uint32_t A = a | (b >> 1);
+    uint32_t B = (a >> 1) ^ a;
+    uint32_t C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+    uint32_t D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 2)) ^ (b & (b >> 2)));
+    B = ((a & (b >> 2)) ^ (b & ((a ^ b) >> 2)));
+    C ^= ((a & (c >> 2)) ^ (b & (d >> 2)));
+    D ^= ((b & (c >> 2)) ^ ((a ^ b) & (d >> 2)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    A = ((a & (a >> 4)) ^ (b & (b >> 4)));
+    B = ((a & (b >> 4)) ^ (b & ((a ^ b) >> 4)));
+    C ^= ((a & (c >> 4)) ^ (b & (d >> 4)));
+    D ^= ((b & (c >> 4)) ^ ((a ^ b) & (d >> 4)));
+
+    a = A;
+    b = B;
+    c = C;
+    d = D;
+    C ^= ((a & (c >> 8)) ^ (b & (d >> 8)));
+    D ^= ((b & (c >> 8)) ^ ((a ^ b) & (d >> 8)));
+
+    a = C ^ (C >> 1);
+    b = D ^ (D >> 1);
+
+    uint32_t i0 = x ^ y;
+    uint32_t i1 = b | (0xFFFF ^ (i0 | a));
+
+    i0 = (i0 | (i0 << 8)) & 0x00FF00FF;
+    i0 = (i0 | (i0 << 4)) & 0x0F0F0F0F;
+    i0 = (i0 | (i0 << 2)) & 0x33333333;
+    i0 = (i0 | (i0 << 1)) & 0x55555555;
+
+    i1 = (i1 | (i1 << 8)) & 0x00FF00FF;
+    i1 = (i1 | (i1 << 4)) & 0x0F0F0F0F;
+    i1 = (i1 | (i1 << 2)) & 0x33333333;
+    i1 = (i1 | (i1 << 1)) & 0x55555555;
+
+    return (i1 << 1) | i0;
+}
+
+/************************************************************************/
+/*                  CopySortedTmpFeaturesToFinalFile()                  */
+/************************************************************************/
 
-    CPLDebug("PARQUET", "CopyTmpGpkgLayerToFinalFile(): start...");
+bool OGRParquetWriterLayer::CopySortedTmpFeaturesToFinalFile()
+{
+    if (!m_fpTmp)
+    {
+        return true;
+    }
 
-    VSIUnlink(m_poTmpGPKG->GetDescription());
+    CPLDebug("PARQUET", "CopySortedTmpFeaturesToFinalFile(): start...");
+
+    // Features without geometry go first, in their insertion order. Then
+    // features with geometry, sorted along a Hilbert curve of the center
+    // of their bounding box. The sort is stable so that features with the
+    // same Hilbert code keep their insertion order.
+    const auto oIterFirstSpatial =
+        std::stable_partition(m_asSortItems.begin(), m_asSortItems.end(),
+                              [](const SortItem &item)
+                              { return std::isnan(item.dfX); });
+
+    constexpr uint32_t HILBERT_MAX = (1U << 16) - 1;
+    const double dfWidth = m_sSortExtent.MaxX - m_sSortExtent.MinX;
+    const double dfHeight = m_sSortExtent.MaxY - m_sSortExtent.MinY;
+    for (auto oIter = oIterFirstSpatial; oIter != m_asSortItems.end(); ++oIter)
+    {
+        const uint32_t nX =
+            dfWidth > 0 ? static_cast<uint32_t>(std::floor(
+                              HILBERT_MAX * (oIter->dfX - m_sSortExtent.MinX) /
+                              dfWidth))
+                        : 0;
+        const uint32_t nY =
+            dfHeight > 0 ? static_cast<uint32_t>(std::floor(
+                               HILBERT_MAX *
+                               (oIter->dfY - m_sSortExtent.MinY) / dfHeight))
+                         : 0;
+        oIter->nHilbertCode = Hilbert(nX, nY);
+    }
+    std::stable_sort(oIterFirstSpatial, m_asSortItems.end(),
+                     [](const SortItem &a, const SortItem &b)
+                     { return a.nHilbertCode < b.nHilbertCode; });
 
     OGRFeature oFeat(m_poFeatureDefn);
+    std::vector<GByte> abyBuffer;
 
     // Interval in terms of features between 2 debug progress report messages
     constexpr int PROGRESS_FC_INTERVAL = 100 * 1000;
 
-    // First, write features without geometries
+    for (auto oIter = m_asSortItems.begin(); oIter != m_asSortItems.end();
+         ++oIter)
     {
-        auto poTmpLayer = std::unique_ptr<OGRLayer>(m_poTmpGPKG->ExecuteSQL(
-            "SELECT serialized_feature FROM tmp WHERE fid NOT IN (SELECT id "
-            "FROM rtree_tmp_geom)",
-            nullptr, nullptr));
-        if (!poTmpLayer)
-            return false;
-        for (const auto &poSrcFeature : poTmpLayer.get())
+        if (oIter == oIterFirstSpatial)
         {
-            int nBytesFeature = 0;
-            const GByte *pabyFeatureData =
-                poSrcFeature->GetFieldAsBinary(0, &nBytesFeature);
-            if (!oFeat.DeserializeFromBinary(pabyFeatureData, nBytesFeature))
+            // Start a new row group for features with geometries
+            if (!FlushFeatures())
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Cannot deserialize feature");
                 return false;
             }
-            if (OGRArrowWriterLayer::ICreateFeature(&oFeat) != OGRERR_NONE)
-            {
-                return false;
-            }
-
-            if ((m_nFeatureCount % PROGRESS_FC_INTERVAL) == 0)
-            {
-                CPLDebugProgress(
-                    "PARQUET",
-                    "CopyTmpGpkgLayerToFinalFile(): %.02f%% progress",
-                    100.0 * double(m_nFeatureCount) /
-                        double(m_nTmpFeatureCount));
-            }
         }
 
-        if (!FlushFeatures())
+        const SortItem &item = *oIter;
+        try
         {
-            return false;
+            abyBuffer.resize(item.nSize);
         }
-    }
-
-    // Now walk through the GPKG RTree for features with geometries
-    // Cf https://github.com/sqlite/sqlite/blob/master/ext/rtree/rtree.c
-    // for the description of the content of the rtree _node table
-    std::vector<std::pair<int64_t, int>> aNodeNoDepthPair;
-    int nTreeDepth = 0;
-    // Queue the root node
-    aNodeNoDepthPair.emplace_back(
-        std::make_pair(/* nodeNo = */ 1, /* depth = */ 0));
-    int nCountWrittenFeaturesSinceLastFlush = 0;
-    while (!aNodeNoDepthPair.empty())
-    {
-        const auto &oLastPair = aNodeNoDepthPair.back();
-        const int64_t nNodeNo = oLastPair.first;
-        const int nCurDepth = oLastPair.second;
-        //CPLDebug("PARQUET", "Reading nodeNode=%d, curDepth=%d", int(nNodeNo), nCurDepth);
-        aNodeNoDepthPair.pop_back();
-
-        auto poRTreeLayer = std::unique_ptr<OGRLayer>(m_poTmpGPKG->ExecuteSQL(
-            CPLSPrintf("SELECT data FROM rtree_tmp_geom_node WHERE nodeno "
-                       "= " CPL_FRMT_GIB,
-                       static_cast<GIntBig>(nNodeNo)),
-            nullptr, nullptr));
-        if (!poRTreeLayer)
+        catch (const std::exception &)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read node " CPL_FRMT_GIB,
-                     static_cast<GIntBig>(nNodeNo));
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate %u bytes for feature", item.nSize);
             return false;
         }
-        const auto poRTreeFeature =
-            std::unique_ptr<const OGRFeature>(poRTreeLayer->GetNextFeature());
-        if (!poRTreeFeature)
+        if (m_fpTmp->Seek(item.nOffset, SEEK_SET) != 0 ||
+            m_fpTmp->Read(abyBuffer.data(), 1, item.nSize) != item.nSize)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read node " CPL_FRMT_GIB,
-                     static_cast<GIntBig>(nNodeNo));
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read feature from temporary file %s",
+                     m_osTmpFilename.c_str());
             return false;
         }
-
-        int nNodeBytes = 0;
-        const GByte *pabyNodeData =
-            poRTreeFeature->GetFieldAsBinary(0, &nNodeBytes);
-        constexpr int BLOB_HEADER_SIZE = 4;
-        if (nNodeBytes < BLOB_HEADER_SIZE)
+        if (!oFeat.DeserializeFromBinary(abyBuffer.data(), abyBuffer.size()))
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Not enough bytes when reading node " CPL_FRMT_GIB,
-                     static_cast<GIntBig>(nNodeNo));
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot deserialize feature");
             return false;
         }
-        if (nNodeNo == 1)
+        if (OGRArrowWriterLayer::ICreateFeature(&oFeat) != OGRERR_NONE)
         {
-            // Get the RTree depth from the root node
-            nTreeDepth = (pabyNodeData[0] << 8) | pabyNodeData[1];
-            //CPLDebug("PARQUET", "nTreeDepth = %d", nTreeDepth);
-        }
-
-        const int nCellCount = (pabyNodeData[2] << 8) | pabyNodeData[3];
-        constexpr int SIZEOF_CELL = 24;  // int64_t + 4 float
-        if (nNodeBytes < BLOB_HEADER_SIZE + SIZEOF_CELL * nCellCount)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Not enough bytes when reading node " CPL_FRMT_GIB,
-                     static_cast<GIntBig>(nNodeNo));
             return false;
         }
 
-        size_t nOffset = BLOB_HEADER_SIZE;
-        if (nCurDepth == nTreeDepth)
+        if ((m_nFeatureCount % PROGRESS_FC_INTERVAL) == 0 ||
+            m_nFeatureCount == m_nTmpFeatureCount / 2)
         {
-            // Leaf node: it references feature IDs.
-
-            // If we are about to go above m_nRowGroupSize, flush past
-            // features now, to improve the spatial compacity of the row group.
-            if (m_nRowGroupSize > nCellCount &&
-                nCountWrittenFeaturesSinceLastFlush + nCellCount >
-                    m_nRowGroupSize)
-            {
-                nCountWrittenFeaturesSinceLastFlush = 0;
-                if (!FlushFeatures())
-                {
-                    return false;
-                }
-            }
-
-            // nCellCount shouldn't be over 51 normally, but even 65535
-            // would be fine...
-            // coverity[tainted_data]
-            for (int i = 0; i < nCellCount; ++i)
-            {
-                int64_t nFID;
-                memcpy(&nFID, pabyNodeData + nOffset, sizeof(int64_t));
-                CPL_MSBPTR64(&nFID);
-
-                const auto poSrcFeature = std::unique_ptr<const OGRFeature>(
-                    m_poTmpGPKGLayer->GetFeature(nFID));
-                if (!poSrcFeature)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot get feature " CPL_FRMT_GIB,
-                             static_cast<GIntBig>(nFID));
-                    return false;
-                }
-
-                int nBytesFeature = 0;
-                const GByte *pabyFeatureData =
-                    poSrcFeature->GetFieldAsBinary(0, &nBytesFeature);
-                if (!oFeat.DeserializeFromBinary(pabyFeatureData,
-                                                 nBytesFeature))
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot deserialize feature");
-                    return false;
-                }
-                if (OGRArrowWriterLayer::ICreateFeature(&oFeat) != OGRERR_NONE)
-                {
-                    return false;
-                }
-
-                nOffset += SIZEOF_CELL;
-
-                ++nCountWrittenFeaturesSinceLastFlush;
-
-                if ((m_nFeatureCount % PROGRESS_FC_INTERVAL) == 0 ||
-                    m_nFeatureCount == m_nTmpFeatureCount / 2)
-                {
-                    CPLDebugProgress(
-                        "PARQUET",
-                        "CopyTmpGpkgLayerToFinalFile(): %.02f%% progress",
-                        100.0 * double(m_nFeatureCount) /
-                            double(m_nTmpFeatureCount));
-                }
-            }
-        }
-        else
-        {
-            // Non-leaf node: it references child nodes.
-
-            // nCellCount shouldn't be over 51 normally, but even 65535
-            // would be fine...
-            // coverity[tainted_data]
-            for (int i = 0; i < nCellCount; ++i)
-            {
-                int64_t nNode;
-                memcpy(&nNode, pabyNodeData + nOffset, sizeof(int64_t));
-                CPL_MSBPTR64(&nNode);
-                aNodeNoDepthPair.emplace_back(
-                    std::make_pair(nNode, nCurDepth + 1));
-                nOffset += SIZEOF_CELL;
-            }
+            CPLDebugProgress(
+                "PARQUET",
+                "CopySortedTmpFeaturesToFinalFile(): %.02f%% progress",
+                100.0 * double(m_nFeatureCount) / double(m_nTmpFeatureCount));
         }
     }
 
-    CPLDebug("PARQUET",
-             "CopyTmpGpkgLayerToFinalFile(): 100%%, successfully finished");
+    CPLDebug("PARQUET", "CopySortedTmpFeaturesToFinalFile(): 100%%, "
+                        "successfully finished");
     return true;
 }
 
@@ -332,29 +311,25 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
 
     if (CPLTestBool(CSLFetchNameValueDef(papszOptions, "SORT_BY_BBOX", "NO")))
     {
-        const std::string osTmpGPKG(std::string(m_poDataset->GetDescription()) +
-                                    ".tmp.gpkg");
-        auto poGPKGDrv = GetGDALDriverManager()->GetDriverByName("GPKG");
-        if (!poGPKGDrv)
+        // Serialized features are stored in a temporary file, preferably
+        // next to the final file, and only their sort keys are kept in RAM.
+        std::string osTmpFilename(std::string(m_poDataset->GetDescription()) +
+                                  ".tmp_sort_by_bbox.bin");
+        if (!VSISupportsRandomWrite(osTmpFilename.c_str(), false))
         {
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Driver GPKG required for SORT_BY_BBOX layer creation option");
-            return false;
+            osTmpFilename = CPLGenerateTempFilename("parquet_sort_by_bbox");
         }
-        m_poTmpGPKG.reset(poGPKGDrv->Create(osTmpGPKG.c_str(), 0, 0, 0,
-                                            GDT_Unknown, nullptr));
-        if (!m_poTmpGPKG)
-            return false;
-        m_poTmpGPKG->MarkSuppressOnClose();
-        m_poTmpGPKGLayer = m_poTmpGPKG->CreateLayer("tmp");
-        if (!m_poTmpGPKGLayer)
+        m_fpTmp.reset(VSIFOpenL(osTmpFilename.c_str(), "wb+"));
+        if (!m_fpTmp)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot create temporary file %s, required for "
+                     "SORT_BY_BBOX layer creation option",
+                     osTmpFilename.c_str());
             return false;
-        // Serialized feature
-        m_poTmpGPKGLayer->CreateField(
-            std::make_unique<OGRFieldDefn>("serialized_feature", OFTBinary)
-                .get());
-        CPL_IGNORE_RET_VAL(m_poTmpGPKGLayer->StartTransaction());
+        }
+        m_osTmpFilename = std::move(osTmpFilename);
+        m_bSortByBBOX = true;
     }
 
     const char *pszGeomEncoding =
@@ -479,6 +454,16 @@ bool OGRParquetWriterLayer::SetOptions(CSLConstList papszOptions,
     if (!CPLTestBool(CSLFetchNameValueDef(papszOptions, "STATISTICS", "YES")))
         m_oWriterPropertiesBuilder.disable_statistics();
 
+#if PARQUET_VERSION_MAJOR >= 12
+    // The page index enables readers to skip pages, or row groups, using
+    // the minimum and maximum values of ranges of rows.
+    if (CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "WRITE_PAGE_INDEX", "YES")))
+    {
+        m_oWriterPropertiesBuilder.enable_write_page_index();
+    }
+#endif
+
     if (m_eGeomEncoding == OGRArrowGeomEncoding::WKB && eGType != wkbNone)
     {
         m_oWriterPropertiesBuilder.disable_statistics(
@@ -1015,8 +1000,24 @@ void OGRParquetWriterLayer::CreateWriter()
         FinalizeSchema();
     }
 
-    auto arrowWriterProperties =
-        parquet::ArrowWriterProperties::Builder().store_schema()->build();
+    parquet::ArrowWriterProperties::Builder oArrowWriterPropertiesBuilder;
+    oArrowWriterPropertiesBuilder.store_schema();
+#if PARQUET_VERSION_MAJOR >= 13
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    int nNumThreads = 0;
+    if (pszNumThreads == nullptr)
+        nNumThreads = std::min(4, CPLGetNumCPUs());
+    else
+        nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                       : atoi(pszNumThreads);
+    if (nNumThreads > 1)
+    {
+        CPL_IGNORE_RET_VAL(arrow::SetCpuThreadPoolCapacity(nNumThreads));
+        oArrowWriterPropertiesBuilder.set_use_threads(true);
+        m_bUseThreads = true;
+    }
+#endif
+    auto arrowWriterProperties = oArrowWriterPropertiesBuilder.build();
     CPL_IGNORE_RET_VAL(Open(*m_poSchema, m_poMemoryPool, m_poOutputStream,
                             m_oWriterPropertiesBuilder.build(),
                             std::move(arrowWriterProperties), &m_poFileWriter,
@@ -1031,11 +1032,11 @@ OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
 {
     // If not using SORT_BY_BBOX=YES layer creation option, we can directly
     // write features to the final Parquet file
-    if (!m_poTmpGPKGLayer)
+    if (!m_bSortByBBOX)
         return OGRArrowWriterLayer::ICreateFeature(poFeature);
 
     // SORT_BY_BBOX=YES case: we write for now a serialized version of poFeature
-    // in a temporary GeoPackage file.
+    // in a temporary file, and record its sort key.
 
     GIntBig nFID = poFeature->GetFID();
     if (!m_osFIDColumn.empty() && nFID == OGRNullFID)
@@ -1043,7 +1044,6 @@ OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
         nFID = m_nTmpFeatureCount;
         poFeature->SetFID(nFID);
     }
-    ++m_nTmpFeatureCount;
 
     std::vector<GByte> abyBuffer;
     // Serialize the source feature as a single array of bytes to preserve it
@@ -1053,36 +1053,58 @@ OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
         return OGRERR_FAILURE;
     }
 
-    // SQLite3 limitation: a row must fit in slightly less than 1 GB.
-    constexpr int SOME_MARGIN = 128;
-    if (abyBuffer.size() > 1024 * 1024 * 1024 - SOME_MARGIN)
+    if (abyBuffer.size() > std::numeric_limits<uint32_t>::max())
     {
         CPLError(CE_Failure, CPLE_NotSupported,
-                 "Features larger than 1 GB are not supported");
+                 "Features larger than 4 GB are not supported");
         return OGRERR_FAILURE;
     }
 
-    OGRFeature oFeat(m_poTmpGPKGLayer->GetLayerDefn());
-    oFeat.SetFID(nFID);
-    oFeat.SetField(0, static_cast<int>(abyBuffer.size()), abyBuffer.data());
+    SortItem item;
+    item.nOffset = m_nTmpFileSize;
+    item.nSize = static_cast<uint32_t>(abyBuffer.size());
+    item.dfX = std::numeric_limits<double>::quiet_NaN();
+    item.dfY = std::numeric_limits<double>::quiet_NaN();
     const auto poSrcGeom = poFeature->GetGeometryRef();
     if (poSrcGeom && !poSrcGeom->IsEmpty())
     {
-        // For the purpose of building an RTree, just use the bounding box of
-        // the geometry as the geometry.
         OGREnvelope sEnvelope;
         poSrcGeom->getEnvelope(&sEnvelope);
-        auto poPoly = std::make_unique<OGRPolygon>();
-        auto poLR = std::make_unique<OGRLinearRing>();
-        poLR->addPoint(sEnvelope.MinX, sEnvelope.MinY);
-        poLR->addPoint(sEnvelope.MinX, sEnvelope.MaxY);
-        poLR->addPoint(sEnvelope.MaxX, sEnvelope.MaxY);
-        poLR->addPoint(sEnvelope.MaxX, sEnvelope.MinY);
-        poLR->addPoint(sEnvelope.MinX, sEnvelope.MinY);
-        poPoly->addRingDirectly(poLR.release());
-        oFeat.SetGeometryDirectly(poPoly.release());
+        const double dfX = sEnvelope.MinX / 2 + sEnvelope.MaxX / 2;
+        const double dfY = sEnvelope.MinY / 2 + sEnvelope.MaxY / 2;
+        // Features with non-finite bounding boxes are written together with
+        // the ones without geometry.
+        if (std::isfinite(dfX) && std::isfinite(dfY))
+        {
+            item.dfX = dfX;
+            item.dfY = dfY;
+            m_sSortExtent.Merge(dfX, dfY);
+        }
+    }
+
+    if (m_fpTmp->Write(abyBuffer.data(), 1, abyBuffer.size()) !=
+        abyBuffer.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot write feature in temporary file %s",
+                 m_osTmpFilename.c_str());
+        return OGRERR_FAILURE;
+    }
+    m_nTmpFileSize += abyBuffer.size();
+
+    try
+    {
+        m_asSortItems.push_back(item);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in SORT_BY_BBOX mode");
+        return OGRERR_FAILURE;
     }
-    return m_poTmpGPKGLayer->CreateFeature(&oFeat);
+    ++m_nTmpFeatureCount;
+
+    return OGRERR_NONE;
 }
 
 /************************************************************************/
@@ -1091,6 +1113,48 @@ OGRErr OGRParquetWriterLayer::ICreateFeature(OGRFeature *poFeature)
 
 bool OGRParquetWriterLayer::FlushGroup()
 {
+#if PARQUET_VERSION_MAJOR >= 13
+    const int64_t nRows = m_apoBuilders[0]->length();
+    // Buffered row groups are split by parquet-cpp beyond that limit
+    if (m_bUseThreads && nRows <= parquet::DEFAULT_MAX_ROW_GROUP_LENGTH)
+    {
+        // Hand over the whole row group as a single record batch, so that
+        // parquet-cpp encodes and compresses its columns in parallel.
+        std::vector<std::shared_ptr<arrow::Array>> apoArrays;
+        const bool bRet = WriteArrays(
+            [&apoArrays](const std::shared_ptr<arrow::Field> &,
+                         const std::shared_ptr<arrow::Array> &array)
+            {
+                apoArrays.push_back(array);
+                return true;
+            });
+        ClearArrayBuilers();
+        if (!bRet)
+            return false;
+
+        const auto poBatch =
+            arrow::RecordBatch::Make(m_poSchema, nRows, std::move(apoArrays));
+
+        auto status = m_poFileWriter->NewBufferedRowGroup();
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "NewBufferedRowGroup() failed with %s",
+                     status.message().c_str());
+            return false;
+        }
+
+        status = m_poFileWriter->WriteRecordBatch(*poBatch);
+        if (!status.ok())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "WriteRecordBatch() failed: %s", status.message().c_str());
+            return false;
+        }
+        return true;
+    }
+#endif
+
     auto status = m_poFileWriter->NewRowGroup(m_apoBuilders[0]->length());
     if (!status.ok())
     {
@@ -1177,7 +1241,7 @@ OGRParquetWriterLayer::WriteArrowBatch(const struct ArrowSchema *schema,
                                        struct ArrowArray *array,
                                        CSLConstList papszOptions)
 {
-    if (m_poTmpGPKGLayer)
+    if (m_bSortByBBOX)
     {
         // When using SORT_BY_BBOX=YES option, we can't directly write the
         // input array, because we need to sort features. Hence we fallback
@@ -1224,7 +1288,7 @@ inline int OGRParquetWriterLayer::TestCapability(const char *pszCap)
         return false;
 #endif
 
-    if (m_poTmpGPKGLayer && EQUAL(pszCap, OLCFastWriteArrowBatch))
+    if (m_bSortByBBOX && EQUAL(pszCap, OLCFastWriteArrowBatch))
     {
         // When using SORT_BY_BBOX=YES option, we can't directly write the
         // input array, because we need to sort features. So this is not
@@ -1243,7 +1307,7 @@ inline int OGRParquetWriterLayer::TestCapability(const char *pszCap)
 bool OGRParquetWriterLayer::CreateFieldFromArrowSchema(
     const struct ArrowSchema *schema, CSLConstList papszOptions)
 {
-    if (m_poTmpGPKGLayer)
+    if (m_bSortByBBOX)
     {
         // When using SORT_BY_BBOX=YES option, we can't directly write the
         // input array, because we need to sort features. But this process
@@ -1266,7 +1330,7 @@ bool OGRParquetWriterLayer::IsArrowSchemaSupported(
     const struct ArrowSchema *schema, CSLConstList papszOptions,
     std::string &osErrorMsg) const
 {
-    if (m_poTmpGPKGLayer)
+    if (m_bSortByBBOX)
     {
         // When using SORT_BY_BBOX=YES option, we can't directly write the
         // input array, because we need to sort features. But this process
@@ -378,6 +378,14 @@ class OGRPGTableLayer final : public OGRPGLayer
     void LoadMetadata();
     void SerializeMetadata();
 
+    // State of a read done in parallel by ranges of the primary key
+    struct ParallelReadContext;
+    std::unique_ptr<ParallelReadContext> m_poParallelRead{};
+
+    bool CanUseParallelRead();
+    bool StartParallelRead();
+    OGRFeature *GetNextParallelRawFeature();
+
   public:
     OGRPGTableLayer(OGRPGDataSource *, CPLString &osCurrentSchema,
                     const char *pszTableName, const char *pszSchemaName,
@@ -638,6 +646,12 @@ class OGRPGDataSource final : public OGRDataSource
     int bListAllTables = false;
     bool m_bSkipViews = false;
 
+    // Connection string (without the PG: prefix and the GDAL specific
+    // parameters), and pool of idle connections, used by parallel reads.
+    std::string m_osConnectionString{};
+    int m_nParallelReadConnections = 1;
+    std::vector<PGconn *> m_ahIdleWorkerConns{};
+
     bool m_bOgrSystemTablesMetadataTableExistenceTested = false;
     bool m_bOgrSystemTablesMetadataTableFound = false;
 
@@ -749,6 +763,19 @@ class OGRPGDataSource final : public OGRDataSource
         return bUserTransactionActive;
     }
 
+    bool IsSoftTransactionActive() const
+    {
+        return nSoftTransactionLevel > 0;
+    }
+
+    int GetParallelReadConnections() const
+    {
+        return m_nParallelReadConnections;
+    }
+
+    PGconn *AcquireWorkerConnection();
+    void ReleaseWorkerConnection(PGconn *hConn);
+
     void CreateOgrSystemTablesMetadataTableIfNeeded();
     bool HasOgrSystemTablesMetadataTable();
 };
@@ -32,6 +32,7 @@
 #include "cpl_conv.h"
 #include "cpl_string.h"
 #include "cpl_hash_set.h"
+#include <algorithm>
 #include <cctype>
 #include <set>
 
@@ -90,6 +91,9 @@ OGRPGDataSource::~OGRPGDataSource()
         PQfinish(hPGConn);
         hPGConn = nullptr;
     }
+
+    for (PGconn *hConn : m_ahIdleWorkerConns)
+        PQfinish(hConn);
 }
 
 /************************************************************************/
@@ -287,15 +291,9 @@ int OGRPGDataSource::Open(const char *pszNewName, int bUpdate, int bTestOpen,
     /* -------------------------------------------------------------------- */
     /*      Verify postgresql prefix.                                       */
     /* -------------------------------------------------------------------- */
-    if (STARTS_WITH_CI(pszNewName, "PGB:"))
-    {
-#if defined(BINARY_CURSOR_ENABLED)
-        bUseBinaryCursor = TRUE;
-        CPLDebug("PG", "BINARY cursor is used for geometry fetching");
-#endif
-    }
-    else if (!STARTS_WITH_CI(pszNewName, "PG:") &&
-             !STARTS_WITH(pszNewName, "postgresql://"))
+    if (!STARTS_WITH_CI(pszNewName, "PGB:") &&
+        !STARTS_WITH_CI(pszNewName, "PG:") &&
+        !STARTS_WITH(pszNewName, "postgresql://"))
     {
         if (!bTestOpen)
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -305,6 +303,14 @@ int OGRPGDataSource::Open(const char *pszNewName, int bUpdate, int bTestOpen,
         return FALSE;
     }
 
+    if (STARTS_WITH_CI(pszNewName, "PGB:") ||
+        CPLTestBool(
+            CSLFetchNameValueDef(papszOpenOptions, "BINARY_CURSOR", "NO")))
+    {
+        bUseBinaryCursor = TRUE;
+        CPLDebug("PG", "BINARY cursor is used for geometry fetching");
+    }
+
     pszName = CPLStrdup(pszNewName);
 
     const auto QuoteAndEscapeConnectionParam = [](const char *pszParam)
@@ -551,6 +557,7 @@ int OGRPGDataSource::Open(const char *pszNewName, int bUpdate, int bTestOpen,
     /*      Try to establish connection.                                    */
     /* -------------------------------------------------------------------- */
     hPGConn = PQconnectdb(pszConnectionNameNoPrefix);
+    m_osConnectionString = pszConnectionNameNoPrefix;
     CPLFree(pszConnectionName);
     pszConnectionName = nullptr;
 
@@ -755,7 +762,6 @@ int OGRPGDataSource::Open(const char *pszNewName, int bUpdate, int bTestOpen,
 /* -------------------------------------------------------------------- */
 /*      Test if time binary format is int8 or float8                    */
 /* -------------------------------------------------------------------- */
-#if defined(BINARY_CURSOR_ENABLED)
     if (bUseBinaryCursor)
     {
         SoftStartTransaction();
@@ -809,7 +815,6 @@ int OGRPGDataSource::Open(const char *pszNewName, int bUpdate, int bTestOpen,
 
         SoftCommitTransaction();
     }
-#endif
 
     /* -------------------------------------------------------------------- */
     /*      Test to see if this database instance has support for the       */
@@ -900,9 +905,91 @@ int OGRPGDataSource::Open(const char *pszNewName, int bUpdate, int bTestOpen,
         CSLFetchNameValueDef(papszOpenOptions, "SKIP_VIEWS",
                              CPLGetConfigOption("PG_SKIP_VIEWS", "NO")));
 
+    m_nParallelReadConnections = std::max(
+        1, atoi(CSLFetchNameValueDef(papszOpenOptions,
+                                     "PARALLEL_READ_CONNECTIONS", "1")));
+    if (m_nParallelReadConnections > 1 &&
+        sPostgreSQLVersion.nMajor < 10 &&
+        !(sPostgreSQLVersion.nMajor == 9 && sPostgreSQLVersion.nMinor >= 2))
+    {
+        // pg_export_snapshot() is needed to read with a consistent snapshot
+        CPLError(CE_Warning, CPLE_NotSupported,
+                 "PARALLEL_READ_CONNECTIONS requires PostgreSQL >= 9.2. "
+                 "Ignoring it");
+        m_nParallelReadConnections = 1;
+    }
+
     return TRUE;
 }
 
+/************************************************************************/
+/*                      AcquireWorkerConnection()                       */
+/************************************************************************/
+
+/** Return an additional connection to the database, with the same client
+ * encoding and search_path as the main one, to be used by a single thread.
+ * It must be given back with ReleaseWorkerConnection().
+ */
+PGconn *OGRPGDataSource::AcquireWorkerConnection()
+{
+    if (!m_ahIdleWorkerConns.empty())
+    {
+        PGconn *hConn = m_ahIdleWorkerConns.back();
+        m_ahIdleWorkerConns.pop_back();
+        return hConn;
+    }
+
+    PGconn *hConn = PQconnectdb(m_osConnectionString.c_str());
+    if (hConn == nullptr || PQstatus(hConn) == CONNECTION_BAD)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "PQconnectdb failed.\n%s",
+                 PQerrorMessage(hConn));
+        PQfinish(hConn);
+        return nullptr;
+    }
+    PQsetNoticeProcessor(hConn, OGRPGNoticeProcessor, this);
+
+    const char *pszClientEncoding =
+        PQparameterStatus(hPGConn, "client_encoding");
+    if (pszClientEncoding &&
+        PQsetClientEncoding(hConn, pszClientEncoding) == -1)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "PQsetClientEncoding(%s) failed.\n%s", pszClientEncoding,
+                 PQerrorMessage(hConn));
+    }
+
+    PGresult *hResult = OGRPG_PQexec(hPGConn, "SHOW search_path");
+    if (hResult && PQresultStatus(hResult) == PGRES_TUPLES_OK &&
+        PQntuples(hResult) == 1)
+    {
+        std::string osCommand("SET search_path=");
+        osCommand += PQgetvalue(hResult, 0, 0);
+        PGresult *hResult2 = OGRPG_PQexec(hConn, osCommand.c_str());
+        OGRPGClearResult(hResult2);
+    }
+    OGRPGClearResult(hResult);
+
+    return hConn;
+}
+
+/************************************************************************/
+/*                      ReleaseWorkerConnection()                       */
+/************************************************************************/
+
+void OGRPGDataSource::ReleaseWorkerConnection(PGconn *hConn)
+{
+    if (PQstatus(hConn) == CONNECTION_OK &&
+        PQtransactionStatus(hConn) == PQTRANS_IDLE)
+    {
+        m_ahIdleWorkerConns.push_back(hConn);
+    }
+    else
+    {
+        PQfinish(hConn);
+    }
+}
+
 /************************************************************************/
 /*                            LoadTables()                              */
 /************************************************************************/
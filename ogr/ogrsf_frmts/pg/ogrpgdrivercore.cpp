@@ -92,6 +92,12 @@ void OGRPGDriverSetCommonMetadata(GDALDriver *poDriver)
         "  <Option name='SKIP_VIEWS' type='boolean' description='Whether "
         "views should be omitted from the list' "
         "default='NO'/>"
+        "  <Option name='BINARY_CURSOR' type='boolean' description='Whether "
+        "a binary cursor should be used to fetch geometries of tables' "
+        "default='NO'/>"
+        "  <Option name='PARALLEL_READ_CONNECTIONS' type='int' "
+        "description='Number of connections used to read tables in parallel, "
+        "by ranges of their primary key' default='1'/>"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST,
@@ -163,7 +163,6 @@ void OGRPGLayer::ResetReading()
     bInvalidated = FALSE;
 }
 
-#if defined(BINARY_CURSOR_ENABLED)
 /************************************************************************/
 /*                    OGRPGGetStrFromBinaryNumeric()                    */
 /************************************************************************/
@@ -402,7 +401,6 @@ static int OGRPGTimeStamp2DMYHMS(GIntBig dt, int *year, int *month, int *day,
     return 0;
 }
 
-#endif  // defined(BINARY_CURSOR_ENABLED)
 
 /************************************************************************/
 /*                   TokenizeStringListFromText()                       */
@@ -563,9 +561,12 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
     /* ==================================================================== */
     for (int iField = 0; iField < PQnfields(hResult); iField++)
     {
-#if defined(BINARY_CURSOR_ENABLED)
-        int nTypeOID = PQftype(hResult, iField);
-#endif
+        const int nTypeOID = PQftype(hResult, iField);
+        // With a binary cursor, attribute columns are retrieved as text
+        // (see OGRPGTableLayer::BuildFields()), whose binary representation
+        // is the same as the text one.
+        const bool bBinaryValue =
+            PQfformat(hResult, iField) == 1 && nTypeOID != TEXTOID;
         const char *pszFieldName = PQfname(hResult, iField);
 
         /* --------------------------------------------------------------------
@@ -575,7 +576,6 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
          */
         if (pszFIDColumn != nullptr && EQUAL(pszFieldName, pszFIDColumn))
         {
-#if defined(BINARY_CURSOR_ENABLED)
             if (PQfformat(hResult, iField) == 1)  // Binary data representation
             {
                 if (nTypeOID == INT4OID)
@@ -605,7 +605,6 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
                 }
             }
             else
-#endif /* defined(BINARY_CURSOR_ENABLED) */
             {
                 char *pabyData = PQgetvalue(hResult, iRecord, iField);
                 /* ogr_pg_20 may crash if PostGIS is unavailable and we don't
@@ -801,17 +800,16 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
             }
             else
             {
-#if defined(BINARY_CURSOR_ENABLED)
-                if (poDS->bUseBinaryCursor && PQfformat(hResult, iField) == 1)
+                if (PQfformat(hResult, iField) == 1)
                 {
-                    int nLength = PQgetlength(hResult, iRecord, iField);
-                    const GByte *pabyData =
-                        reinterpret_cast<const GByte *>(pszData);
-                    poGeometry =
-                        OGRGeometryFromEWKB(pabyData, nLength, NULL, false);
+                    // Potentially dangerous to modify the result of
+                    // PQgetvalue...
+                    poGeometry = OGRGeometryFromEWKB(
+                        const_cast<GByte *>(
+                            reinterpret_cast<const GByte *>(pszData)),
+                        PQgetlength(hResult, iRecord, iField), nullptr, false);
                 }
-                if (poGeometry == nullptr)
-#endif
+                else
                 {
                     poGeometry = BYTEAToGeometry(pszData);
                 }
@@ -850,8 +848,7 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
         {
             int *panList, nCount, i;
 
-#if defined(BINARY_CURSOR_ENABLED)
-            if (PQfformat(hResult, iField) == 1)  // Binary data representation
+            if (bBinaryValue)  // Binary data representation
             {
                 if (nTypeOID == INT2ARRAYOID || nTypeOID == INT4ARRAYOID)
                 {
@@ -903,7 +900,6 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
                 }
             }
             else
-#endif
             {
                 char **papszTokens = CSLTokenizeStringComplex(
                     PQgetvalue(hResult, iRecord, iField), "{,}", FALSE, FALSE);
@@ -933,8 +929,7 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
             int nCount = 0;
             GIntBig *panList = nullptr;
 
-#if defined(BINARY_CURSOR_ENABLED)
-            if (PQfformat(hResult, iField) == 1)  // Binary data representation
+            if (bBinaryValue)  // Binary data representation
             {
                 if (nTypeOID == INT8ARRAYOID)
                 {
@@ -977,7 +972,6 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
                 }
             }
             else
-#endif
             {
                 char **papszTokens = CSLTokenizeStringComplex(
                     PQgetvalue(hResult, iRecord, iField), "{,}", FALSE, FALSE);
@@ -1008,8 +1002,7 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
             int nCount, i;
             double *padfList = nullptr;
 
-#if defined(BINARY_CURSOR_ENABLED)
-            if (PQfformat(hResult, iField) == 1)  // Binary data representation
+            if (bBinaryValue)  // Binary data representation
             {
                 if (nTypeOID == FLOAT8ARRAYOID || nTypeOID == FLOAT4ARRAYOID)
                 {
@@ -1065,7 +1058,6 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
                 }
             }
             else
-#endif
             {
                 char **papszTokens = CSLTokenizeStringComplex(
                     PQgetvalue(hResult, iRecord, iField), "{,}", FALSE, FALSE);
@@ -1087,8 +1079,7 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
         {
             char **papszTokens = nullptr;
 
-#if defined(BINARY_CURSOR_ENABLED)
-            if (PQfformat(hResult, iField) == 1)  // Binary data representation
+            if (bBinaryValue)  // Binary data representation
             {
                 char *pData = PQgetvalue(hResult, iRecord, iField);
                 int nCount, i;
@@ -1129,7 +1120,6 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
                 }
             }
             else
-#endif
             {
                 papszTokens = OGRPGTokenizeStringListFromText(
                     PQgetvalue(hResult, iRecord, iField));
@@ -1145,8 +1135,7 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
         else if (eOGRType == OFTDate || eOGRType == OFTTime ||
                  eOGRType == OFTDateTime)
         {
-#if defined(BINARY_CURSOR_ENABLED)
-            if (PQfformat(hResult, iField) == 1)  // Binary data
+            if (bBinaryValue)  // Binary data
             {
                 if (nTypeOID == DATEOID)
                 {
@@ -1231,7 +1220,6 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
                 }
             }
             else
-#endif
             {
                 OGRField sFieldValue;
 
@@ -1244,8 +1232,7 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
         }
         else if (eOGRType == OFTBinary)
         {
-#if defined(BINARY_CURSOR_ENABLED)
-            if (PQfformat(hResult, iField) == 1)
+            if (bBinaryValue)
             {
                 int nLength = PQgetlength(hResult, iRecord, iField);
                 GByte *pabyData = reinterpret_cast<GByte *>(
@@ -1253,7 +1240,6 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
                 poFeature->SetField(iOGRField, nLength, pabyData);
             }
             else
-#endif /* defined(BINARY_CURSOR_ENABLED) */
             {
                 int nLength = PQgetlength(hResult, iRecord, iField);
                 const char *pszBytea = PQgetvalue(hResult, iRecord, iField);
@@ -1264,9 +1250,7 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
         }
         else
         {
-#if defined(BINARY_CURSOR_ENABLED)
-            if (PQfformat(hResult, iField) == 1 &&
-                eOGRType != OFTString)  // Binary data
+            if (bBinaryValue && eOGRType != OFTString)  // Binary data
             {
                 if (nTypeOID == BOOLOID)
                 {
@@ -1369,7 +1353,6 @@ OGRFeature *OGRPGLayer::RecordToFeature(PGresult *hResult,
                 }
             }
             else
-#endif /* defined(BINARY_CURSOR_ENABLED) */
             {
                 if (eOGRType == OFTInteger &&
                     poFeatureDefn->GetFieldDefn(iOGRField)->GetWidth() == 1)
@@ -1490,12 +1473,10 @@ void OGRPGLayer::SetInitialQueryCursor()
 
     poDS->SoftStartTransaction();
 
-#if defined(BINARY_CURSOR_ENABLED)
     if (poDS->bUseBinaryCursor && bCanUseBinaryCursor)
         osCommand.Printf("DECLARE %s BINARY CURSOR for %s", pszCursorName,
                          pszQueryStatement);
     else
-#endif
         osCommand.Printf("DECLARE %s CURSOR for %s", pszCursorName,
                          pszQueryStatement);
 
@@ -2345,12 +2326,10 @@ int OGRPGLayer::ReadResultDefinition(PGresult *hInitialResultIn)
         }
         else if (nTypeOID == TIMESTAMPOID || nTypeOID == TIMESTAMPTZOID)
         {
-#if defined(BINARY_CURSOR_ENABLED)
             /* We can't deserialize properly timestamp with time zone */
             /* with binary cursors */
             if (nTypeOID == TIMESTAMPTZOID)
                 bCanUseBinaryCursor = FALSE;
-#endif
 
             oField.SetType(OFTDateTime);
         }
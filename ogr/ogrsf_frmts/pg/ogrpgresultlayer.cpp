@@ -46,6 +46,10 @@ OGRPGResultLayer::OGRPGResultLayer(OGRPGDataSource *poDSIn,
 
     iNextShapeId = 0;
 
+    // The columns of an arbitrary SQL request might be of types whose
+    // binary representation is not handled by RecordToFeature()
+    bCanUseBinaryCursor = FALSE;
+
     BuildFullQueryStatement();
 
     ReadResultDefinition(hInitialResultIn);
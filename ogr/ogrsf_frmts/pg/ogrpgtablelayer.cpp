@@ -36,6 +36,7 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <thread>
 
@@ -215,6 +216,150 @@ OGRPGTableLayer::OGRPGTableLayer(OGRPGDataSource *poDSIn,
     }
 }
 
+/************************************************************************/
+/*                         ParallelReadContext                          */
+/************************************************************************/
+
+// Each partition of the primary key range is read by a worker thread, on its
+// own connection, through a cursor whose pages are queued for the thread
+// calling GetNextFeature().
+struct OGRPGTableLayer::ParallelReadContext
+{
+    OGRPGDataSource *poDS = nullptr;
+
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+    std::vector<std::thread> aoThreads{};
+    std::vector<PGconn *> ahConns{};
+
+    std::deque<PGresult *> ahResults{};
+    size_t nMaxQueuedResults = 0;
+    int nRunningWorkers = 0;
+    int nPendingSnapshotImports = 0;
+    bool bStop = false;
+    std::string osErrorMsg{};
+
+    // Result being consumed by the thread calling GetNextFeature()
+    PGresult *hCurResult = nullptr;
+    int nCurOffset = 0;
+    bool bFieldMapInitialized = false;
+
+    explicit ParallelReadContext(OGRPGDataSource *poDSIn) : poDS(poDSIn)
+    {
+    }
+
+    ~ParallelReadContext();
+
+    void Worker(PGconn *hConn, const std::string &osSnapshot,
+                const std::string &osDeclareCursor, int nCursorPage);
+};
+
+/************************************************************************/
+/*                        ~ParallelReadContext()                        */
+/************************************************************************/
+
+OGRPGTableLayer::ParallelReadContext::~ParallelReadContext()
+{
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        bStop = true;
+    }
+    oCV.notify_all();
+    for (auto &oThread : aoThreads)
+        oThread.join();
+
+    for (PGresult *hResult : ahResults)
+        OGRPGClearResult(hResult);
+    OGRPGClearResult(hCurResult);
+
+    for (PGconn *hConn : ahConns)
+        poDS->ReleaseWorkerConnection(hConn);
+}
+
+/************************************************************************/
+/*                    ParallelReadContext::Worker()                     */
+/************************************************************************/
+
+void OGRPGTableLayer::ParallelReadContext::Worker(
+    PGconn *hConn, const std::string &osSnapshot,
+    const std::string &osDeclareCursor, int nCursorPage)
+{
+    const auto RecordError = [this, hConn]()
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        if (osErrorMsg.empty())
+            osErrorMsg = PQerrorMessage(hConn);
+    };
+
+    const auto ExecCommand = [hConn, &RecordError](const std::string &osSQL)
+    {
+        PGresult *hResult =
+            OGRPG_PQexec(hConn, osSQL.c_str(), FALSE, /* bErrorAsDebug = */
+                         TRUE);
+        const bool bOK =
+            hResult && PQresultStatus(hResult) == PGRES_COMMAND_OK;
+        if (!bOK)
+            RecordError();
+        OGRPGClearResult(hResult);
+        return bOK;
+    };
+
+    // Use the snapshot exported by the main connection, so that all
+    // partitions see the same state of the table.
+    bool bOK =
+        ExecCommand("BEGIN ISOLATION LEVEL REPEATABLE READ READ ONLY") &&
+        ExecCommand("SET TRANSACTION SNAPSHOT '" + osSnapshot + "'") &&
+        ExecCommand(osDeclareCursor);
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        --nPendingSnapshotImports;
+    }
+    oCV.notify_all();
+
+    const std::string osFetch(
+        CPLSPrintf("FETCH %d IN ogr_parallel_cursor", nCursorPage));
+    while (bOK)
+    {
+        {
+            std::unique_lock<std::mutex> oLock(oMutex);
+            oCV.wait(oLock, [this]
+                     { return bStop || ahResults.size() < nMaxQueuedResults; });
+            if (bStop)
+                break;
+        }
+
+        PGresult *hResult = OGRPG_PQexec(hConn, osFetch.c_str(), FALSE,
+                                         /* bErrorAsDebug = */ TRUE);
+        if (!hResult || PQresultStatus(hResult) != PGRES_TUPLES_OK)
+        {
+            RecordError();
+            OGRPGClearResult(hResult);
+            break;
+        }
+        if (PQntuples(hResult) == 0)
+        {
+            OGRPGClearResult(hResult);
+            break;
+        }
+
+        {
+            std::lock_guard<std::mutex> oLock(oMutex);
+            ahResults.push_back(hResult);
+        }
+        oCV.notify_all();
+    }
+
+    // Also closes the cursor
+    PGresult *hResult = OGRPG_PQexec(hConn, "ROLLBACK", FALSE, TRUE);
+    OGRPGClearResult(hResult);
+
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        --nRunningWorkers;
+    }
+    oCV.notify_all();
+}
+
 //************************************************************************/
 /*                          ~OGRPGTableLayer()                          */
 /************************************************************************/
@@ -222,6 +367,7 @@ OGRPGTableLayer::OGRPGTableLayer(OGRPGDataSource *poDSIn,
 OGRPGTableLayer::~OGRPGTableLayer()
 
 {
+    m_poParallelRead.reset();
     if (bDeferredCreation)
         RunDeferredCreationIfNecessary();
     if (bCopyActive)
@@ -1144,6 +1290,7 @@ void OGRPGTableLayer::ResetReading()
 
     BuildFullQueryStatement();
 
+    m_poParallelRead.reset();
     OGRPGLayer::ResetReading();
 
     bInResetReading = FALSE;
@@ -1168,9 +1315,16 @@ OGRFeature *OGRPGTableLayer::GetNextFeature()
         poGeomFieldDefn = poFeatureDefn->GetGeomFieldDefn(m_iGeomFieldFilter);
     poFeatureDefn->GetFieldCount();
 
+    if (iNextShapeId == 0 && hCursorResult == nullptr && !m_poParallelRead &&
+        !bInvalidated && CanUseParallelRead())
+    {
+        StartParallelRead();
+    }
+
     while (true)
     {
-        OGRFeature *poFeature = GetNextRawFeature();
+        OGRFeature *poFeature = m_poParallelRead ? GetNextParallelRawFeature()
+                                                 : GetNextRawFeature();
         if (poFeature == nullptr)
             return nullptr;
 
@@ -1196,6 +1350,176 @@ OGRFeature *OGRPGTableLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                         CanUseParallelRead()                         */
+/************************************************************************/
+
+bool OGRPGTableLayer::CanUseParallelRead()
+{
+    // Uncommitted changes of the main connection would not be visible from
+    // the other connections.
+    return poDS->GetParallelReadConnections() > 1 && pszFIDColumn != nullptr &&
+           !poDS->IsUserTransactionActive() && !poDS->IsSoftTransactionActive();
+}
+
+/************************************************************************/
+/*                         StartParallelRead()                          */
+/*                                                                      */
+/*      Split the range of values of the primary key in as many         */
+/*      partitions as PARALLEL_READ_CONNECTIONS, and start reading      */
+/*      each of them in a worker thread, on its own connection.         */
+/************************************************************************/
+
+bool OGRPGTableLayer::StartParallelRead()
+{
+    PGconn *hPGConn = poDS->GetPGConn();
+    const CPLString osFIDColumn(OGRPGEscapeColumnName(pszFIDColumn));
+
+    poDS->SoftStartTransaction();
+
+    CPLString osCommand;
+    osCommand.Printf("SELECT pg_export_snapshot(), MIN(%s), MAX(%s) FROM %s",
+                     osFIDColumn.c_str(), osFIDColumn.c_str(),
+                     pszSqlTableName);
+    PGresult *hResult = OGRPG_PQexec(hPGConn, osCommand);
+    if (!hResult || PQresultStatus(hResult) != PGRES_TUPLES_OK ||
+        PQntuples(hResult) != 1 || PQgetisnull(hResult, 0, 1))
+    {
+        OGRPGClearResult(hResult);
+        poDS->SoftCommitTransaction();
+        return false;
+    }
+    const std::string osSnapshot(PQgetvalue(hResult, 0, 0));
+    const GIntBig nMinFID = CPLAtoGIntBig(PQgetvalue(hResult, 0, 1));
+    const GIntBig nMaxFID = CPLAtoGIntBig(PQgetvalue(hResult, 0, 2));
+    OGRPGClearResult(hResult);
+
+    const GUIntBig nSpan =
+        static_cast<GUIntBig>(nMaxFID) - static_cast<GUIntBig>(nMinFID) + 1;
+    const int nPartitions =
+        nSpan == 0 ? poDS->GetParallelReadConnections()
+                   : static_cast<int>(std::min<GUIntBig>(
+                         poDS->GetParallelReadConnections(), nSpan));
+
+    auto poContext = std::make_unique<ParallelReadContext>(poDS);
+    poContext->nMaxQueuedResults = 2 * static_cast<size_t>(nPartitions);
+
+    const CPLString osFields = BuildFields();
+    const bool bBinaryCursor = poDS->bUseBinaryCursor && bCanUseBinaryCursor;
+    GIntBig nLowFID = nMinFID;
+    for (int i = 0; i < nPartitions; ++i)
+    {
+        PGconn *hConn = poDS->AcquireWorkerConnection();
+        if (hConn == nullptr)
+            break;
+        poContext->ahConns.push_back(hConn);
+
+        const GUIntBig nNextOffset =
+            (nSpan / nPartitions) * (i + 1) +
+            (nSpan % nPartitions) * (i + 1) / nPartitions;
+        const GIntBig nHighFID =
+            i + 1 == nPartitions
+                ? nMaxFID
+                : static_cast<GIntBig>(static_cast<GUIntBig>(nMinFID) +
+                                       nNextOffset - 1);
+
+        std::string osDeclareCursor(CPLSPrintf(
+            "DECLARE ogr_parallel_cursor %sCURSOR FOR SELECT %s FROM %s WHERE "
+            "%s BETWEEN " CPL_FRMT_GIB " AND " CPL_FRMT_GIB,
+            bBinaryCursor ? "BINARY " : "", osFields.c_str(), pszSqlTableName,
+            osFIDColumn.c_str(), nLowFID, nHighFID));
+        if (!osWHERE.empty())
+        {
+            CPLAssert(STARTS_WITH(osWHERE.c_str(), "WHERE "));
+            osDeclareCursor += " AND (";
+            osDeclareCursor += osWHERE.c_str() + strlen("WHERE ");
+            osDeclareCursor += ')';
+        }
+        nLowFID = nHighFID + 1;
+
+        {
+            std::lock_guard<std::mutex> oLock(poContext->oMutex);
+            ++poContext->nRunningWorkers;
+            ++poContext->nPendingSnapshotImports;
+        }
+        poContext->aoThreads.emplace_back(&ParallelReadContext::Worker,
+                                          poContext.get(), hConn, osSnapshot,
+                                          osDeclareCursor, nCursorPage);
+    }
+
+    if (!poContext->aoThreads.empty())
+    {
+        // The snapshot must remain valid until all workers have imported it
+        std::unique_lock<std::mutex> oLock(poContext->oMutex);
+        poContext->oCV.wait(
+            oLock,
+            [&poContext]
+            { return poContext->nPendingSnapshotImports == 0; });
+    }
+    poDS->SoftCommitTransaction();
+
+    if (poContext->aoThreads.empty())
+        return false;
+
+    CPLDebug("PG", "Reading table %s with %d parallel connections",
+             pszSqlTableName, static_cast<int>(poContext->aoThreads.size()));
+    m_poParallelRead = std::move(poContext);
+    return true;
+}
+
+/************************************************************************/
+/*                     GetNextParallelRawFeature()                      */
+/************************************************************************/
+
+OGRFeature *OGRPGTableLayer::GetNextParallelRawFeature()
+{
+    auto &oContext = *m_poParallelRead;
+    while (oContext.hCurResult == nullptr ||
+           oContext.nCurOffset == PQntuples(oContext.hCurResult))
+    {
+        OGRPGClearResult(oContext.hCurResult);
+
+        std::unique_lock<std::mutex> oLock(oContext.oMutex);
+        oContext.oCV.wait(oLock,
+                          [&oContext]
+                          {
+                              return !oContext.ahResults.empty() ||
+                                     oContext.nRunningWorkers == 0;
+                          });
+        if (oContext.ahResults.empty())
+        {
+            if (!oContext.osErrorMsg.empty())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         oContext.osErrorMsg.c_str());
+                oContext.osErrorMsg.clear();
+            }
+            return nullptr;
+        }
+        oContext.hCurResult = oContext.ahResults.front();
+        oContext.ahResults.pop_front();
+        oContext.nCurOffset = 0;
+        oLock.unlock();
+        oContext.oCV.notify_all();
+
+        if (!oContext.bFieldMapInitialized)
+        {
+            oContext.bFieldMapInitialized = true;
+            CreateMapFromFieldNameToIndex(oContext.hCurResult, poFeatureDefn,
+                                          m_panMapFieldNameToIndex,
+                                          m_panMapFieldNameToGeomIndex);
+        }
+    }
+
+    OGRFeature *poFeature = RecordToFeature(
+        oContext.hCurResult, m_panMapFieldNameToIndex,
+        m_panMapFieldNameToGeomIndex, oContext.nCurOffset);
+    oContext.nCurOffset++;
+    iNextShapeId++;
+
+    return poFeature;
+}
+
 /************************************************************************/
 /*                            BuildFields()                             */
 /*                                                                      */
@@ -1249,7 +1573,6 @@ CPLString OGRPGTableLayer::BuildFields()
         }
         else if (poGeomFieldDefn->ePostgisType == GEOM_TYPE_GEOGRAPHY)
         {
-#if defined(BINARY_CURSOR_ENABLED)
             if (poDS->bUseBinaryCursor)
             {
                 osFieldList += "ST_AsBinary(";
@@ -1259,7 +1582,6 @@ CPLString OGRPGTableLayer::BuildFields()
                     CPLSPrintf("AsBinary_%s", poGeomFieldDefn->GetNameRef()));
             }
             else
-#endif
                 if (CPLTestBool(CPLGetConfigOption("PG_USE_BASE64", "NO")))
             {
                 osFieldList += "encode(ST_AsEWKB(";
@@ -1286,18 +1608,20 @@ CPLString OGRPGTableLayer::BuildFields()
         if (!osFieldList.empty())
             osFieldList += ", ";
 
-#if defined(BINARY_CURSOR_ENABLED)
-        /* With a binary cursor, it is not possible to get the time zone */
-        /* of a timestamptz column. So we fallback to asking it in text mode */
-        if (poDS->bUseBinaryCursor &&
-            poFeatureDefn->GetFieldDefn(i)->GetType() == OFTDateTime)
+        /* With a binary cursor, only the geometry and FID columns are */
+        /* decoded from their binary representation. Attribute columns are */
+        /* cast to text, whose binary representation is the text itself, */
+        /* so that the decoding does not depend on their exact PostgreSQL */
+        /* type (it is also not possible to get the time zone of a */
+        /* timestamptz column in binary mode). */
+        if (poDS->bUseBinaryCursor)
         {
             osFieldList += "CAST (";
             osFieldList += OGRPGEscapeColumnName(pszName);
-            osFieldList += " AS text)";
+            osFieldList += " AS text) AS ";
+            osFieldList += OGRPGEscapeColumnName(pszName);
         }
         else
-#endif
         {
             osFieldList += OGRPGEscapeColumnName(pszName);
         }
@@ -2254,6 +2578,11 @@ int OGRPGTableLayer::TestCapability(const char *pszCap)
     else if (EQUAL(pszCap, OLCFastFeatureCount) ||
              EQUAL(pszCap, OLCFastSetNextByIndex))
     {
+        // Features are not returned in a deterministic order by parallel
+        // reads
+        if (EQUAL(pszCap, OLCFastSetNextByIndex) &&
+            poDS->GetParallelReadConnections() > 1)
+            return FALSE;
         if (m_poFilterGeom == nullptr)
             return TRUE;
         OGRPGGeomFieldDefn *poGeomFieldDefn = nullptr;
@@ -365,7 +365,7 @@ class OGRPMTilesVectorLayer final
 
 class OGRPMTilesWriterDataset final : public GDALDataset
 {
-    std::unique_ptr<GDALDataset> m_poMBTilesWriterDataset{};
+    std::unique_ptr<GDALDataset> m_poMVTWriterDataset{};
 
   public:
     OGRPMTilesWriterDataset() = default;
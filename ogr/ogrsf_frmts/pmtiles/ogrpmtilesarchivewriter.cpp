@@ -0,0 +1,530 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implementation of PMTiles
+ * Author:   Even Rouault <even.rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2023, Planet Labs
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "ogrpmtilesarchivewriter.h"
+
+#include "cpl_compressor.h"
+#include "cpl_md5.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+// Offset of the tile data when it is directly written in the output file.
+// The header and root directory must fit in the first 16 KB of the file.
+constexpr uint64_t TILE_DATA_OFFSET_DIRECT = 16384;
+
+/************************************************************************/
+/*                     OGRPMTilesProcessMetadata()                      */
+/************************************************************************/
+
+/** Builds the PMTiles JSON metadata and initializes the header, from the
+ * items of a MBTiles metadata table.
+ */
+bool OGRPMTilesProcessMetadata(const CPLJSONObject &oMetadataItems,
+                               pmtiles::headerv3 &sHeader,
+                               std::string &osMetadata)
+{
+    CPLJSONObject oObj;
+    CPLJSONDocument oJsonDoc;
+    for (const auto &oItem : oMetadataItems.GetChildren())
+    {
+        const std::string osName = oItem.GetName();
+        const std::string osValue = oItem.ToString();
+        if (EQUAL(osName.c_str(), "json"))
+        {
+            if (!oJsonDoc.LoadMemory(osValue))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot parse 'json' metadata item");
+                return false;
+            }
+            for (const auto &oChild : oJsonDoc.GetRoot().GetChildren())
+            {
+                oObj.Add(oChild.GetName(), oChild);
+            }
+        }
+        else
+        {
+            oObj.Add(osName, osValue);
+        }
+    }
+
+    // MBTiles advertises scheme=tms. Override this
+    oObj.Set("scheme", "xyz");
+
+    const auto osFormat = oObj.GetString("format", "{missing}");
+    if (osFormat != "pbf")
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "format=%s unhandled",
+                 osFormat.c_str());
+        return false;
+    }
+
+    int nMinZoom = atoi(oObj.GetString("minzoom", "-1").c_str());
+    if (nMinZoom < 0 || nMinZoom > 255)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Missing or invalid minzoom");
+        return false;
+    }
+
+    int nMaxZoom = atoi(oObj.GetString("maxzoom", "-1").c_str());
+    if (nMaxZoom < 0 || nMaxZoom > 255)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Missing or invalid maxzoom");
+        return false;
+    }
+
+    const CPLStringList aosCenter(
+        CSLTokenizeString2(oObj.GetString("center").c_str(), ",", 0));
+    if (aosCenter.size() != 3)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Expected 3 values for center");
+        return false;
+    }
+    const double dfCenterLong = CPLAtof(aosCenter[0]);
+    const double dfCenterLat = CPLAtof(aosCenter[1]);
+    if (std::fabs(dfCenterLong) > 180 || std::fabs(dfCenterLat) > 90)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid center");
+        return false;
+    }
+    const int nCenterZoom = atoi(aosCenter[2]);
+    if (nCenterZoom < 0 || nCenterZoom > 255)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Missing or invalid center zoom");
+        return false;
+    }
+
+    const CPLStringList aosBounds(
+        CSLTokenizeString2(oObj.GetString("bounds").c_str(), ",", 0));
+    if (aosBounds.size() != 4)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Expected 4 values for bounds");
+        return false;
+    }
+    const double dfMinX = CPLAtof(aosBounds[0]);
+    const double dfMinY = CPLAtof(aosBounds[1]);
+    const double dfMaxX = CPLAtof(aosBounds[2]);
+    const double dfMaxY = CPLAtof(aosBounds[3]);
+    if (std::fabs(dfMinX) > 180 || std::fabs(dfMinY) > 90 ||
+        std::fabs(dfMaxX) > 180 || std::fabs(dfMaxY) > 90)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid bounds");
+        return false;
+    }
+
+    CPLJSONDocument oMetadataDoc;
+    oMetadataDoc.SetRoot(oObj);
+    osMetadata = oMetadataDoc.SaveAsString();
+    // CPLDebugOnly("PMTiles", "Metadata = %s", osMetadata.c_str());
+
+    sHeader.root_dir_offset = 127;
+    sHeader.root_dir_bytes = 0;
+    sHeader.json_metadata_offset = 0;
+    sHeader.json_metadata_bytes = 0;
+    sHeader.leaf_dirs_offset = 0;
+    sHeader.leaf_dirs_bytes = 0;
+    sHeader.tile_data_offset = 0;
+    sHeader.tile_data_bytes = 0;
+    sHeader.addressed_tiles_count = 0;
+    sHeader.tile_entries_count = 0;
+    sHeader.tile_contents_count = 0;
+    sHeader.clustered = true;
+    sHeader.internal_compression = pmtiles::COMPRESSION_GZIP;
+    sHeader.tile_compression = pmtiles::COMPRESSION_GZIP;
+    sHeader.tile_type = pmtiles::TILETYPE_MVT;
+    sHeader.min_zoom = static_cast<uint8_t>(nMinZoom);
+    sHeader.max_zoom = static_cast<uint8_t>(nMaxZoom);
+    sHeader.min_lon_e7 = static_cast<int32_t>(dfMinX * 10e6);
+    sHeader.min_lat_e7 = static_cast<int32_t>(dfMinY * 10e6);
+    sHeader.max_lon_e7 = static_cast<int32_t>(dfMaxX * 10e6);
+    sHeader.max_lat_e7 = static_cast<int32_t>(dfMaxY * 10e6);
+    sHeader.center_zoom = static_cast<uint8_t>(nCenterZoom);
+    sHeader.center_lon_e7 = static_cast<int32_t>(dfCenterLong * 10e6);
+    sHeader.center_lat_e7 = static_cast<int32_t>(dfCenterLat * 10e6);
+
+    return true;
+}
+
+/************************************************************************/
+/*                     ~OGRPMTilesArchiveWriter()                       */
+/************************************************************************/
+
+OGRPMTilesArchiveWriter::~OGRPMTilesArchiveWriter()
+{
+    m_poTmpFile.reset();
+    if (!m_osTmpFilename.empty())
+        VSIUnlink(m_osTmpFilename.c_str());
+}
+
+/************************************************************************/
+/*                              Create()                                */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::Create(const char *pszFilename)
+{
+    m_osFilename = pszFilename;
+    m_poFile.reset(VSIFOpenL(pszFilename, "wb"));
+    if (!m_poFile)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s for write",
+                 pszFilename);
+        return false;
+    }
+
+    if (VSISupportsRandomWrite(pszFilename, false))
+    {
+        // Reserve space for the header and root directory, that will be
+        // written at the end, and stream tile data just after it.
+        const std::string osZero(static_cast<size_t>(TILE_DATA_OFFSET_DIRECT),
+                                 '\0');
+        if (m_poFile->Write(osZero.data(), osZero.size(), 1) != 1)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+            return false;
+        }
+        return true;
+    }
+
+    // Let's build a temporary file that contains the tile data in
+    // a way that corresponds to the "clustered" mode, that is
+    // "offsets are either contiguous with the previous offset+length, or
+    // refer to a lesser offset, when writing with deduplication."
+    m_osTmpFilename =
+        std::string(CPLGenerateTempFilename(CPLGetFilename(pszFilename))) +
+        ".tmp";
+
+    m_poTmpFile.reset(VSIFOpenL(m_osTmpFilename.c_str(), "wb+"));
+    VSIUnlink(m_osTmpFilename.c_str());
+    if (!m_poTmpFile)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s for write",
+                 m_osTmpFilename.c_str());
+        m_osTmpFilename.clear();
+        return false;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                          ComputeTileHash()                           */
+/************************************************************************/
+
+/* static */ OGRPMTilesArchiveWriter::TileHash
+OGRPMTilesArchiveWriter::ComputeTileHash(const void *pData, size_t nSize)
+{
+    TileHash abyHash;
+    CPLMD5Context md5context;
+    CPLMD5Init(&md5context);
+    CPLMD5Update(&md5context, pData, nSize);
+    CPLMD5Final(&abyHash[0], &md5context);
+    return abyHash;
+}
+
+/************************************************************************/
+/*                            CheckTileId()                             */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::CheckTileId(uint64_t nTileId)
+{
+    if (m_bError)
+        return false;
+    // Tiles must be sorted by ascending tile_id. This is a requirement to
+    // build the PMTiles directories.
+    if (m_nAddressedTiles > 0 && nTileId <= m_nLastAddressedTileId)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Tiles not written by ascending tile id");
+        m_bError = true;
+        return false;
+    }
+    m_nLastAddressedTileId = nTileId;
+    return true;
+}
+
+/************************************************************************/
+/*                         WriteDuplicateTile()                         */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::WriteDuplicateTile(uint64_t nTileId,
+                                                 const TileHash &abyHash)
+{
+    if (!m_asEntries.empty() && nTileId == m_nLastTileId + 1 &&
+        abyHash == m_abyLastHash)
+    {
+        if (!CheckTileId(nTileId))
+            return false;
+        // If the tile id immediately follows the previous one and
+        // has the same tile data, increase the run_length
+        m_asEntries.back().run_length++;
+        m_nAddressedTiles++;
+        return true;
+    }
+
+    auto oIter = m_oMapHashToOffsetLen.find(abyHash);
+    if (oIter == m_oMapHashToOffsetLen.end())
+        return false;
+    if (!CheckTileId(nTileId))
+        return false;
+
+    // Point to previously written tile data if this content
+    // has already been written
+    pmtiles::entryv3 sPMTilesEntry;
+    sPMTilesEntry.tile_id = nTileId;
+    sPMTilesEntry.run_length = 1;
+    sPMTilesEntry.offset = oIter->second.first;
+    sPMTilesEntry.length = oIter->second.second;
+    m_asEntries.push_back(sPMTilesEntry);
+    m_nAddressedTiles++;
+
+    m_nLastTileId = nTileId;
+    m_abyLastHash = abyHash;
+    return true;
+}
+
+/************************************************************************/
+/*                             WriteTile()                              */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::WriteTile(uint64_t nTileId,
+                                        const TileHash &abyHash,
+                                        const void *pData, size_t nSize)
+{
+    if (m_bError)
+        return false;
+    if (WriteDuplicateTile(nTileId, abyHash))
+        return true;
+    if (!CheckTileId(nTileId))
+        return false;
+    if (nSize > std::numeric_limits<uint32_t>::max())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Too large tile");
+        m_bError = true;
+        return false;
+    }
+
+    pmtiles::entryv3 sPMTilesEntry;
+    sPMTilesEntry.tile_id = nTileId;
+    sPMTilesEntry.run_length = 1;
+    sPMTilesEntry.offset = m_nTileDataSize;
+    sPMTilesEntry.length = static_cast<uint32_t>(nSize);
+
+    auto poFile = m_poTmpFile ? m_poTmpFile.get() : m_poFile.get();
+    if (nSize > 0 && poFile->Write(pData, nSize, 1) != 1)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+        m_bError = true;
+        return false;
+    }
+
+    try
+    {
+        m_asEntries.push_back(sPMTilesEntry);
+        m_oMapHashToOffsetLen[abyHash] = std::pair<uint64_t, uint32_t>(
+            m_nTileDataSize, sPMTilesEntry.length);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Out of memory writing tiles: %s", e.what());
+        m_bError = true;
+        return false;
+    }
+    m_nTileDataSize += nSize;
+    m_nAddressedTiles++;
+
+    m_nLastTileId = nTileId;
+    m_abyLastHash = abyHash;
+    return true;
+}
+
+bool OGRPMTilesArchiveWriter::WriteTile(uint64_t nTileId, const void *pData,
+                                        size_t nSize)
+{
+    return WriteTile(nTileId, ComputeTileHash(pData, nSize), pData, nSize);
+}
+
+/************************************************************************/
+/*                              Finalize()                              */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::Finalize(pmtiles::headerv3 &sHeader,
+                                       const std::string &osMetadata)
+{
+    if (m_bError || !m_poFile)
+        return false;
+
+    const CPLCompressor *psCompressor = CPLGetCompressor("gzip");
+    assert(psCompressor);
+    std::string osCompressed;
+
+    struct compression_exception : std::exception
+    {
+        const char *what() const noexcept override
+        {
+            return "Compression failed";
+        }
+    };
+
+    const auto oCompressFunc = [psCompressor,
+                                &osCompressed](const std::string &osBytes,
+                                               uint8_t) -> std::string
+    {
+        osCompressed.resize(32 + osBytes.size() * 2);
+        size_t nOutputSize = osCompressed.size();
+        void *pOutputData = &osCompressed[0];
+        if (!psCompressor->pfnFunc(osBytes.data(), osBytes.size(), &pOutputData,
+                                   &nOutputSize, nullptr,
+                                   psCompressor->user_data))
+        {
+            throw compression_exception();
+        }
+        osCompressed.resize(nOutputSize);
+        return osCompressed;
+    };
+
+    std::string osCompressedMetadata;
+
+    std::string osRootBytes;
+    std::string osLeaveBytes;
+    int nNumLeaves;
+    try
+    {
+        osCompressedMetadata =
+            oCompressFunc(osMetadata, pmtiles::COMPRESSION_GZIP);
+
+        // Build the root and leave directories (one depth max)
+        std::tie(osRootBytes, osLeaveBytes, nNumLeaves) =
+            pmtiles::make_root_leaves(oCompressFunc, pmtiles::COMPRESSION_GZIP,
+                                      m_asEntries);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot build directories: %s",
+                 e.what());
+        return false;
+    }
+
+    // Finalize the header fields related to offsets and size of the
+    // different parts of the file
+    sHeader.root_dir_offset = 127;
+    sHeader.root_dir_bytes = osRootBytes.size();
+    if (m_poTmpFile)
+    {
+        sHeader.json_metadata_offset =
+            sHeader.root_dir_offset + sHeader.root_dir_bytes;
+        sHeader.json_metadata_bytes = osCompressedMetadata.size();
+        sHeader.leaf_dirs_offset =
+            sHeader.json_metadata_offset + sHeader.json_metadata_bytes;
+        sHeader.leaf_dirs_bytes = osLeaveBytes.size();
+        sHeader.tile_data_offset =
+            sHeader.leaf_dirs_offset + sHeader.leaf_dirs_bytes;
+    }
+    else
+    {
+        // Tile data has been directly written after the space reserved for
+        // the header and root directory
+        sHeader.tile_data_offset = TILE_DATA_OFFSET_DIRECT;
+        sHeader.json_metadata_offset =
+            sHeader.tile_data_offset + m_nTileDataSize;
+        sHeader.json_metadata_bytes = osCompressedMetadata.size();
+        sHeader.leaf_dirs_offset =
+            sHeader.json_metadata_offset + sHeader.json_metadata_bytes;
+        sHeader.leaf_dirs_bytes = osLeaveBytes.size();
+    }
+    sHeader.tile_data_bytes = m_nTileDataSize;
+
+    // Nomber of tiles that are addressable in the PMTiles archive, that is
+    // the number of tiles we would have if not deduplicating them
+    sHeader.addressed_tiles_count = m_nAddressedTiles;
+
+    // Number of tile entries in root and leave directories
+    // ie entries whose run_length >= 1
+    sHeader.tile_entries_count = m_asEntries.size();
+
+    // Number of distinct tile blobs
+    sHeader.tile_contents_count = m_oMapHashToOffsetLen.size();
+
+    const auto osHeader = sHeader.serialize();
+
+    if (!m_poTmpFile)
+    {
+        if (sHeader.root_dir_offset + sHeader.root_dir_bytes >
+                TILE_DATA_OFFSET_DIRECT ||
+            m_poFile->Write(osCompressedMetadata.data(),
+                            osCompressedMetadata.size(), 1) != 1 ||
+            (!osLeaveBytes.empty() &&
+             m_poFile->Write(osLeaveBytes.data(), osLeaveBytes.size(), 1) !=
+                 1) ||
+            m_poFile->Seek(0, SEEK_SET) != 0 ||
+            m_poFile->Write(osHeader.data(), osHeader.size(), 1) != 1 ||
+            m_poFile->Write(osRootBytes.data(), osRootBytes.size(), 1) != 1)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+            return false;
+        }
+
+        return m_poFile->Close() == 0;
+    }
+
+    if (m_poTmpFile->Seek(0, SEEK_SET) != 0 ||
+        m_poFile->Write(osHeader.data(), osHeader.size(), 1) != 1 ||
+        m_poFile->Write(osRootBytes.data(), osRootBytes.size(), 1) != 1 ||
+        m_poFile->Write(osCompressedMetadata.data(),
+                        osCompressedMetadata.size(), 1) != 1 ||
+        (!osLeaveBytes.empty() &&
+         m_poFile->Write(osLeaveBytes.data(), osLeaveBytes.size(), 1) != 1))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+        return false;
+    }
+
+    // Copy content of the temporary file at end of the output file.
+    std::string oCopyBuffer;
+    oCopyBuffer.resize(1024 * 1024);
+    const uint64_t nTotalSize = m_nTileDataSize;
+    uint64_t nFileOffset = 0;
+    while (nFileOffset < nTotalSize)
+    {
+        const size_t nToRead = static_cast<size_t>(
+            std::min<uint64_t>(nTotalSize - nFileOffset, oCopyBuffer.size()));
+        if (m_poTmpFile->Read(&oCopyBuffer[0], nToRead, 1) != 1 ||
+            m_poFile->Write(&oCopyBuffer[0], nToRead, 1) != 1)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+            return false;
+        }
+        nFileOffset += nToRead;
+    }
+
+    return m_poFile->Close() == 0;
+}
@@ -0,0 +1,130 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implementation of PMTiles
+ * Author:   Even Rouault <even.rouault at spatialys.com>
+ *
+ ******************************************************************************
+ * Copyright (c) 2023, Planet Labs
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef OGRPMTILESARCHIVEWRITER_H_INCLUDED
+#define OGRPMTILESARCHIVEWRITER_H_INCLUDED
+
+#include "cpl_json.h"
+#include "cpl_vsi_virtual.h"
+
+#include "include_pmtiles.h"
+
+#include <array>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/************************************************************************/
+/*                               HashArray()                            */
+/************************************************************************/
+
+// From https://codereview.stackexchange.com/questions/171999/specializing-stdhash-for-stdarray
+// We do not use std::hash<std::array<T, N>> as the name of the struct
+// because with gcc 5.4 we get the following error:
+// https://stackoverflow.com/questions/25594644/warning-specialization-of-template-in-different-namespace
+template <class T, size_t N> struct HashArray
+{
+    CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW
+    size_t operator()(const std::array<T, N> &key) const
+    {
+        std::hash<T> hasher;
+        size_t result = 0;
+        for (size_t i = 0; i < N; ++i)
+        {
+            result = result * 31 + hasher(key[i]);
+        }
+        return result;
+    }
+};
+
+bool OGRPMTilesProcessMetadata(const CPLJSONObject &oMetadataItems,
+                               pmtiles::headerv3 &sHeader,
+                               std::string &osMetadata);
+
+/************************************************************************/
+/*                       OGRPMTilesArchiveWriter                        */
+/************************************************************************/
+
+/** Writes a clustered PMTiles v3 archive, from tiles received by ascending
+ * tile id, deduplicating identical tile contents.
+ *
+ * If the output file supports random writing, tile data is directly written
+ * into it, after space reserved for the header and the root directory, and
+ * followed by the metadata and leaf directories. Otherwise tile data is
+ * written into a temporary file, copied at the end of the output file once
+ * the directories are built.
+ */
+class OGRPMTilesArchiveWriter
+{
+  public:
+    typedef std::array<unsigned char, 16> TileHash;
+
+    OGRPMTilesArchiveWriter() = default;
+    ~OGRPMTilesArchiveWriter();
+
+    bool Create(const char *pszFilename);
+
+    static TileHash ComputeTileHash(const void *pData, size_t nSize);
+
+    /** Adds a tile whose content has already been written, and returns
+     * true, or returns false if that content is not known yet. */
+    bool WriteDuplicateTile(uint64_t nTileId, const TileHash &abyHash);
+
+    bool WriteTile(uint64_t nTileId, const TileHash &abyHash,
+                   const void *pData, size_t nSize);
+
+    bool WriteTile(uint64_t nTileId, const void *pData, size_t nSize);
+
+    /** Writes the header, directories and metadata. The header fields not
+     * related to the position and count of tiles must be set. */
+    bool Finalize(pmtiles::headerv3 &sHeader, const std::string &osMetadata);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesArchiveWriter)
+
+    std::string m_osFilename{};
+    VSIVirtualHandleUniquePtr m_poFile{};
+    std::string m_osTmpFilename{};
+    VSIVirtualHandleUniquePtr m_poTmpFile{};
+    std::vector<pmtiles::entryv3> m_asEntries{};
+    uint64_t m_nAddressedTiles = 0;
+    uint64_t m_nTileDataSize = 0;
+    uint64_t m_nLastTileId = 0;
+    uint64_t m_nLastAddressedTileId = 0;
+    TileHash m_abyLastHash{};
+    std::unordered_map<TileHash, std::pair<uint64_t, uint32_t>,
+                       HashArray<unsigned char, 16>>
+        m_oMapHashToOffsetLen{};
+    bool m_bError = false;
+
+    bool CheckTileId(uint64_t nTileId);
+};
+
+#endif /* OGRPMTILESARCHIVEWRITER_H_INCLUDED */
@@ -31,7 +31,66 @@
 #ifdef HAVE_MVT_WRITE_SUPPORT
 
 #include "mvtutils.h"
-#include "ogrpmtilesfrommbtiles.h"
+#include "ogrpmtilesarchivewriter.h"
+
+#include <limits>
+
+/************************************************************************/
+/*                         OGRPMTilesTileSink                           */
+/************************************************************************/
+
+// Receives the tiles generated by the MVT writer, by ascending PMTiles
+// tile_id, and writes them into the PMTiles archive.
+class OGRPMTilesTileSink final : public OGRMVTWriterTileSink
+{
+    OGRPMTilesArchiveWriter m_oWriter{};
+
+  public:
+    bool Create(const char *pszFilename)
+    {
+        return m_oWriter.Create(pszFilename);
+    }
+
+    uint64_t GetTileRank(int nZ, int nX, int nY) const override
+    {
+        try
+        {
+            return pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZ), nX, nY);
+        }
+        catch (const std::exception &)
+        {
+            // shouldn't happen given the MVT writer zoom level limits. Will
+            // be caught by WriteTile()
+            return std::numeric_limits<uint64_t>::max();
+        }
+    }
+
+    bool WriteTile(int nZ, int nX, int nY,
+                   const std::string &osTileData) override
+    {
+        uint64_t nTileId;
+        try
+        {
+            nTileId = pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZ), nX, nY);
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot compute tile id: %s",
+                     e.what());
+            return false;
+        }
+        return m_oWriter.WriteTile(nTileId, osTileData.data(),
+                                   osTileData.size());
+    }
+
+    bool WriteMetadata(const CPLJSONObject &oMetadata) override
+    {
+        pmtiles::headerv3 sHeader;
+        std::string osMetadata;
+        return OGRPMTilesProcessMetadata(oMetadata, sHeader, osMetadata) &&
+               m_oWriter.Finalize(sHeader, osMetadata);
+    }
+};
 
 /************************************************************************/
 /*                     ~OGRPMTilesWriterDataset()                       */
@@ -51,24 +110,14 @@ CPLErr OGRPMTilesWriterDataset::Close()
     CPLErr eErr = CE_None;
     if (nOpenFlags != OPEN_FLAGS_CLOSED)
     {
-        if (m_poMBTilesWriterDataset)
+        if (m_poMVTWriterDataset)
         {
-            if (m_poMBTilesWriterDataset->Close() != CE_None)
+            // Generates the tiles and writes the PMTiles archive
+            if (m_poMVTWriterDataset->Close() != CE_None)
             {
                 eErr = CE_Failure;
             }
-            else
-            {
-                if (!OGRPMTilesConvertFromMBTiles(
-                        GetDescription(),
-                        m_poMBTilesWriterDataset->GetDescription()))
-                {
-                    eErr = CE_Failure;
-                }
-            }
-
-            VSIUnlink(m_poMBTilesWriterDataset->GetDescription());
-            m_poMBTilesWriterDataset.reset();
+            m_poMVTWriterDataset.reset();
         }
 
         if (GDALDataset::Close() != CE_None)
@@ -86,26 +135,29 @@ bool OGRPMTilesWriterDataset::Create(const char *pszFilename,
 {
     SetDescription(pszFilename);
     CPLStringList aosOptions(papszOptions);
-    aosOptions.SetNameValue("FORMAT", "MBTILES");
-
-    // Let's build a temporary file that contains the tile data in
-    // a way that corresponds to the "clustered" mode, that is
-    // "offsets are either contiguous with the previous offset+length, or
-    // refer to a lesser offset, when writing with deduplication."
-    std::string osTmpFile(pszFilename);
-    if (!VSIIsLocal(pszFilename))
+    // PMTiles tiles are advertised as GZip compressed
+    aosOptions.SetNameValue("COMPRESS", "YES");
+
+    if (!aosOptions.FetchNameValue("TEMPORARY_DB") && !VSIIsLocal(pszFilename))
     {
-        osTmpFile = CPLGenerateTempFilename(CPLGetFilename(pszFilename));
+        aosOptions.SetNameValue(
+            "TEMPORARY_DB",
+            (std::string(CPLGenerateTempFilename(CPLGetFilename(pszFilename))) +
+             ".temp.db")
+                .c_str());
     }
-    osTmpFile += ".tmp.mbtiles";
 
     if (!aosOptions.FetchNameValue("NAME"))
         aosOptions.SetNameValue("NAME", CPLGetBasename(pszFilename));
 
-    m_poMBTilesWriterDataset.reset(OGRMVTWriterDatasetCreate(
-        osTmpFile.c_str(), 0, 0, 0, GDT_Unknown, aosOptions.List()));
+    auto poSink = std::make_unique<OGRPMTilesTileSink>();
+    if (!poSink->Create(pszFilename))
+        return false;
+
+    m_poMVTWriterDataset.reset(OGRMVTWriterDatasetCreateWithTileSink(
+        pszFilename, aosOptions.List(), std::move(poSink)));
 
-    return m_poMBTilesWriterDataset != nullptr;
+    return m_poMVTWriterDataset != nullptr;
 }
 
 /************************************************************************/
@@ -117,7 +169,7 @@ OGRPMTilesWriterDataset::ICreateLayer(const char *pszLayerName,
                                       const OGRGeomFieldDefn *poGeomFieldDefn,
                                       CSLConstList papszOptions)
 {
-    return m_poMBTilesWriterDataset->CreateLayer(pszLayerName, poGeomFieldDefn,
+    return m_poMVTWriterDataset->CreateLayer(pszLayerName, poGeomFieldDefn,
                                                  papszOptions);
 }
 
@@ -127,7 +179,7 @@ OGRPMTilesWriterDataset::ICreateLayer(const char *pszLayerName,
 
 int OGRPMTilesWriterDataset::TestCapability(const char *pszCap)
 {
-    return m_poMBTilesWriterDataset->TestCapability(pszCap);
+    return m_poMVTWriterDataset->TestCapability(pszCap);
 }
 
 #endif  // HAVE_MVT_WRITE_SUPPORT
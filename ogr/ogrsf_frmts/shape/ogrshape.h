@@ -37,10 +37,16 @@
 #endif
 
 #include "ogrsf_frmts.h"
+#include "ogr_recordbatch.h"
 #include "shapefil.h"
 #include "shp_vsi.h"
 #include "ogrlayerpool.h"
+#include <deque>
+#include <memory>
+#include <queue>
 #include <set>
+#include <string>
+#include <thread>
 #include <vector>
 
 /* Was limited to 255 until OGR 1.10, but 254 seems to be a more */
@@ -55,7 +61,8 @@
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder);
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse = nullptr);
 OGRGeometry *SHPReadOGRObject(SHPHandle hSHP, int iShape, SHPObject *psShape,
                               bool &bHasWarnedWrongWindingOrder);
 OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
@@ -158,6 +165,14 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     SBNSearchHandle hSBN;
     bool CheckForSBN();
 
+    // Quadtree spatial index built in memory on read-only layers without
+    // .qix/.sbn file, when OGR_SHAPE_IN_MEMORY_SPATIAL_INDEX is set.
+    bool m_bCheckedForInMemorySpatialIndex = false;
+    SHPTree *m_psInMemorySpatialIndex = nullptr;
+    bool CheckForInMemorySpatialIndex();
+
+    SHPTree *BuildSpatialIndexTree(int nMaxDepth);
+
     bool bSbnSbxDeleted;
 
     CPLString ConvertCodePage(const char *);
@@ -191,6 +206,42 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
     bool m_bHasWarnedWrongWindingOrder = false;
     bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
 
+    // Used by the multi-threaded implementation of GetNextArrowArray()
+    struct ArrowArrayPrefetchTask
+    {
+        std::thread m_oThread{};
+        std::unique_ptr<OGRShapeDataSource> m_poDS{};
+        OGRShapeLayer *m_poLayer = nullptr;
+        struct ArrowArrayStream m_sStream{};
+        // Range of candidate shapes, in m_anArrowArrayPrefetchShapeIds if
+        // not empty, or in shape ids otherwise.
+        int m_iFirstCandidate = 0;
+        int m_iLastCandidate = 0;  // exclusive
+        std::vector<struct ArrowArray> m_asArrays{};
+        std::string m_osErrorMsg{};
+
+        ArrowArrayPrefetchTask() = default;
+        ~ArrowArrayPrefetchTask();
+
+        CPL_DISALLOW_COPY_ASSIGN(ArrowArrayPrefetchTask)
+    };
+
+    bool m_bArrowArrayPrefetchTried = false;
+    bool m_bIsArrowArrayPrefetchWorker = false;
+    std::vector<int> m_anArrowArrayPrefetchShapeIds{};
+    int m_nArrowArrayPrefetchCandidates = 0;
+    int m_iArrowArrayPrefetchNextCandidate = 0;
+    std::queue<std::unique_ptr<ArrowArrayPrefetchTask>>
+        m_oQueueArrowArrayPrefetchTasks{};
+    std::deque<struct ArrowArray> m_asArrowArrayPrefetchReady{};
+
+    void StartArrowArrayPrefetchTasks();
+    bool LaunchArrowArrayPrefetchTask(ArrowArrayPrefetchTask *task);
+    void RunArrowArrayPrefetchTask(ArrowArrayPrefetchTask *task) const;
+    int GetNextArrowArrayAsynchronous(struct ArrowArrayStream *stream,
+                                      struct ArrowArray *out_array);
+    void CancelAsyncNextArrowArray();
+
     bool m_bAutoRepack;
 
     typedef enum
@@ -210,6 +261,11 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void CloseUnderlyingLayer() override;
 
+    OGRFeature *GetNextFeatureInternal(OGRFeature *poFeatureToReuse);
+
+  protected:
+    OGRFeature *IGetNextFeatureReusing(OGRFeature *poFeatureToReuse) override;
+
     // WARNING: Each of the below public methods should start with a call to
     // TouchLayer() and test its return value, so as to make sure that
     // the layer is properly re-opened if necessary.
@@ -233,7 +289,8 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     void UpdateFollowingDeOrRecompression();
 
-    OGRFeature *FetchShape(int iShapeId);
+    OGRFeature *FetchShape(int iShapeId,
+                           OGRFeature *poFeatureToReuse = nullptr);
     int GetFeatureCountWithSpatialFilterOnly();
 
     OGRShapeLayer(OGRShapeDataSource *poDSIn, const char *pszName,
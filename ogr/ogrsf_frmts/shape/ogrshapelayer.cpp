@@ -30,6 +30,7 @@
 #include "ogrshape.h"
 
 #include <cerrno>
+#include <climits>
 #include <limits>
 #include <cstddef>
 #include <cstdio>
@@ -37,6 +38,7 @@
 #include <cstring>
 #include <ctime>
 #include <algorithm>
+#include <memory>
 #include <string>
 
 #include "cpl_conv.h"
@@ -46,6 +48,7 @@
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
@@ -243,6 +246,8 @@ OGRShapeLayer::OGRShapeLayer(OGRShapeDataSource *poDSIn,
 OGRShapeLayer::~OGRShapeLayer()
 
 {
+    CancelAsyncNextArrowArray();
+
     if (m_eNeedRepack == YES && m_bAutoRepack)
         Repack();
 
@@ -280,6 +285,9 @@ OGRShapeLayer::~OGRShapeLayer()
 
     if (hSBN != nullptr)
         SBNCloseDiskTree(hSBN);
+
+    if (m_psInMemorySpatialIndex != nullptr)
+        SHPDestroyTree(m_psInMemorySpatialIndex);
 }
 
 /************************************************************************/
@@ -632,6 +640,50 @@ bool OGRShapeLayer::CheckForSBN()
     return hSBN != nullptr;
 }
 
+/************************************************************************/
+/*                    CheckForInMemorySpatialIndex()                    */
+/*                                                                      */
+/*      Build a quadtree in memory, as CREATE SPATIAL INDEX would do    */
+/*      but without writing it to a .qix file, when the user asked      */
+/*      for it and the layer has no spatial index file.                 */
+/************************************************************************/
+
+bool OGRShapeLayer::CheckForInMemorySpatialIndex()
+
+{
+    if (m_bCheckedForInMemorySpatialIndex)
+        return m_psInMemorySpatialIndex != nullptr;
+
+    m_bCheckedForInMemorySpatialIndex = true;
+
+    // The in-memory index would have to be kept up to date with the
+    // modifications of the layer.
+    if (bUpdateAccess || hSHP == nullptr)
+        return false;
+
+    const char *pszInMemory =
+        CPLGetConfigOption("OGR_SHAPE_IN_MEMORY_SPATIAL_INDEX", "NO");
+    GIntBig nMinFeatures = 0;
+    if (CPLGetValueType(pszInMemory) == CPL_VALUE_INTEGER)
+        nMinFeatures = CPLAtoGIntBig(pszInMemory);
+    else if (!CPLTestBool(pszInMemory))
+        return false;
+    if (nTotalShapeCount < nMinFeatures)
+        return false;
+
+    CPLDebug("SHAPE", "Building in-memory spatial index for %s", pszFullName);
+    m_psInMemorySpatialIndex = BuildSpatialIndexTree(0);
+    if (m_psInMemorySpatialIndex != nullptr)
+    {
+        // The tree must not reference hSHP, which may be closed and
+        // re-opened by the layer pool.
+        m_psInMemorySpatialIndex->hSHP = nullptr;
+        SHPTreeTrimExtraNodes(m_psInMemorySpatialIndex);
+    }
+
+    return m_psInMemorySpatialIndex != nullptr;
+}
+
 /************************************************************************/
 /*                            ScanIndices()                             */
 /*                                                                      */
@@ -698,12 +750,16 @@ bool OGRShapeLayer::ScanIndices()
             CPL_IGNORE_RET_VAL(CheckForQIX());
         if (hQIX == nullptr && !bCheckedForSBN)
             CPL_IGNORE_RET_VAL(CheckForSBN());
+        if (hQIX == nullptr && hSBN == nullptr)
+            CPL_IGNORE_RET_VAL(CheckForInMemorySpatialIndex());
     }
 
     /* -------------------------------------------------------------------- */
     /*      Compute spatial index if appropriate.                           */
     /* -------------------------------------------------------------------- */
-    if (bTryQIXorSBN && (hQIX != nullptr || hSBN != nullptr) &&
+    if (bTryQIXorSBN &&
+        (hQIX != nullptr || hSBN != nullptr ||
+         m_psInMemorySpatialIndex != nullptr) &&
         panSpatialFIDs == nullptr)
     {
         double adfBoundsMin[4] = {oSpatialFilterEnvelope.MinX,
@@ -714,9 +770,18 @@ bool OGRShapeLayer::ScanIndices()
         if (hQIX != nullptr)
             panSpatialFIDs = SHPSearchDiskTreeEx(
                 hQIX, adfBoundsMin, adfBoundsMax, &nSpatialFIDCount);
-        else
+        else if (hSBN != nullptr)
             panSpatialFIDs = SBNSearchDiskTree(hSBN, adfBoundsMin, adfBoundsMax,
                                                &nSpatialFIDCount);
+        else
+        {
+            panSpatialFIDs = SHPTreeFindLikelyShapes(
+                m_psInMemorySpatialIndex, adfBoundsMin, adfBoundsMax,
+                &nSpatialFIDCount);
+            // nullptr would mean "no spatial index" below
+            if (panSpatialFIDs == nullptr)
+                panSpatialFIDs = static_cast<int *>(calloc(1, sizeof(int)));
+        }
 
         CPLDebug("SHAPE", "Used spatial index, got %d matches.",
                  nSpatialFIDCount);
@@ -782,6 +847,8 @@ void OGRShapeLayer::ResetReading()
     if (!TouchLayer())
         return;
 
+    CancelAsyncNextArrowArray();
+
     iMatchingFID = 0;
 
     iNextShapeId = 0;
@@ -827,6 +894,7 @@ void OGRShapeLayer::ClearSpatialFIDs()
 
 void OGRShapeLayer::SetSpatialFilter(OGRGeometry *poGeomIn)
 {
+    CancelAsyncNextArrowArray();
     ClearMatchingFIDs();
 
     if (poGeomIn == nullptr)
@@ -858,6 +926,7 @@ void OGRShapeLayer::SetSpatialFilter(OGRGeometry *poGeomIn)
 
 OGRErr OGRShapeLayer::SetAttributeFilter(const char *pszAttributeFilter)
 {
+    CancelAsyncNextArrowArray();
     ClearMatchingFIDs();
 
     return OGRLayer::SetAttributeFilter(pszAttributeFilter);
@@ -879,6 +948,8 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
     if (nIndex < 0 || nIndex > INT_MAX)
         return OGRERR_FAILURE;
 
+    CancelAsyncNextArrowArray();
+
     // Eventually we should try to use panMatchingFIDs list
     // if available and appropriate.
     if (m_poFilterGeom != nullptr || m_poAttrQuery != nullptr)
@@ -894,9 +965,12 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 /*                                                                      */
 /*      Take a shape id, a geometry, and a feature, and set the feature */
 /*      if the shapeid bbox intersects the geometry.                    */
+/*      poFeatureToReuse, if not null, is returned filled on success,   */
+/*      and remains owned by the caller otherwise.                      */
 /************************************************************************/
 
-OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
+OGRFeature *OGRShapeLayer::FetchShape(int iShapeId,
+                                      OGRFeature *poFeatureToReuse)
 
 {
     OGRFeature *poFeature = nullptr;
@@ -917,7 +991,8 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature =
                 SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, psShape,
-                                  osEncoding, m_bHasWarnedWrongWindingOrder);
+                                  osEncoding, m_bHasWarnedWrongWindingOrder,
+                                  poFeatureToReuse);
         }
         else if (m_sFilterEnvelope.MaxX < psShape->dfXMin ||
                  m_sFilterEnvelope.MaxY < psShape->dfYMin ||
@@ -931,14 +1006,16 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         {
             poFeature =
                 SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, psShape,
-                                  osEncoding, m_bHasWarnedWrongWindingOrder);
+                                  osEncoding, m_bHasWarnedWrongWindingOrder,
+                                  poFeatureToReuse);
         }
     }
     else
     {
         poFeature =
             SHPReadOGRFeature(hSHP, hDBF, poFeatureDefn, iShapeId, nullptr,
-                              osEncoding, m_bHasWarnedWrongWindingOrder);
+                              osEncoding, m_bHasWarnedWrongWindingOrder,
+                              poFeatureToReuse);
     }
 
     return poFeature;
@@ -951,6 +1028,29 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
 OGRFeature *OGRShapeLayer::GetNextFeature()
 
 {
+    return GetNextFeatureInternal(nullptr);
+}
+
+/************************************************************************/
+/*                       IGetNextFeatureReusing()                       */
+/************************************************************************/
+
+OGRFeature *OGRShapeLayer::IGetNextFeatureReusing(OGRFeature *poFeatureToReuse)
+
+{
+    return GetNextFeatureInternal(poFeatureToReuse);
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+OGRFeature *OGRShapeLayer::GetNextFeatureInternal(OGRFeature *poFeatureToReuse)
+
+{
+    // Features rejected by the filters are also recycled.
+    std::unique_ptr<OGRFeature> poSpareFeature(poFeatureToReuse);
+
     if (!TouchLayer())
         return nullptr;
 
@@ -982,7 +1082,8 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
             // Check the shape object's geometry, and if it matches
             // any spatial filter, return it.
             poFeature =
-                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]));
+                FetchShape(static_cast<int>(panMatchingFIDs[iMatchingFID]),
+                           poSpareFeature.get());
 
             iMatchingFID++;
         }
@@ -1000,16 +1101,20 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 else if (VSIFEofL(VSI_SHP_GetVSIL(hDBF->fp)))
                     return nullptr;  //* I/O error.
                 else
-                    poFeature = FetchShape(iNextShapeId);
+                    poFeature =
+                        FetchShape(iNextShapeId, poSpareFeature.get());
             }
             else
-                poFeature = FetchShape(iNextShapeId);
+                poFeature = FetchShape(iNextShapeId, poSpareFeature.get());
 
             iNextShapeId++;
         }
 
         if (poFeature != nullptr)
         {
+            if (poFeature == poSpareFeature.get())
+                poSpareFeature.release();
+
             OGRGeometry *poGeom = poFeature->GetGeometryRef();
             if (poGeom != nullptr)
             {
@@ -1025,7 +1130,7 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
                 return poFeature;
             }
 
-            delete poFeature;
+            poSpareFeature.reset(poFeature);
         }
     }
 }
@@ -2685,6 +2790,278 @@ OGRErr OGRShapeLayer::DropSpatialIndex()
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                          ReadShapeBounds()                           */
+/*                                                                      */
+/*      Read the 2D bounds of a shape from the header of its .shp       */
+/*      record, without decoding its vertices.                          */
+/************************************************************************/
+
+static bool ReadShapeBounds(VSILFILE *fp, uint32_t nOffset, uint32_t nSize,
+                            double adfBounds[4])
+{
+    // Record header, shape type, and bounding box of non-point shapes
+    GByte abyRec[8 + 4 + 4 * 8];
+    const size_t nEntitySize = static_cast<size_t>(nSize) + 8;
+    const size_t nToRead = std::min(sizeof(abyRec), nEntitySize);
+    if (nOffset < 100 || nToRead < 8 + 4 ||
+        VSIFSeekL(fp, nOffset, SEEK_SET) != 0 ||
+        VSIFReadL(abyRec, 1, nToRead, fp) != nToRead)
+    {
+        return false;
+    }
+
+    int nSHPType = 0;
+    memcpy(&nSHPType, abyRec + 8, 4);
+    CPL_LSBPTR32(&nSHPType);
+
+    adfBounds[0] = 0;
+    adfBounds[1] = 0;
+    adfBounds[2] = 0;
+    adfBounds[3] = 0;
+
+    const auto ReadDouble = [&abyRec](int nPos)
+    {
+        double dfVal;
+        memcpy(&dfVal, abyRec + nPos, 8);
+        CPL_LSBPTR64(&dfVal);
+        return dfVal;
+    };
+
+    switch (nSHPType)
+    {
+        case SHPT_POLYGON:
+        case SHPT_POLYGONZ:
+        case SHPT_POLYGONM:
+        case SHPT_ARC:
+        case SHPT_ARCZ:
+        case SHPT_ARCM:
+        case SHPT_MULTIPATCH:
+        case SHPT_MULTIPOINT:
+        case SHPT_MULTIPOINTZ:
+        case SHPT_MULTIPOINTM:
+        {
+            // Same minimum sizes as checked by SHPReadObject()
+            const bool bIsMultiPoint = nSHPType == SHPT_MULTIPOINT ||
+                                       nSHPType == SHPT_MULTIPOINTZ ||
+                                       nSHPType == SHPT_MULTIPOINTM;
+            if (nEntitySize < (bIsMultiPoint ? 44 + 4 : 40 + 8 + 4))
+                return false;
+            adfBounds[0] = ReadDouble(8 + 4);
+            adfBounds[1] = ReadDouble(8 + 12);
+            adfBounds[2] = ReadDouble(8 + 20);
+            adfBounds[3] = ReadDouble(8 + 28);
+            break;
+        }
+
+        case SHPT_POINT:
+        case SHPT_POINTZ:
+        case SHPT_POINTM:
+        {
+            if (nEntitySize < 20 + 8)
+                return false;
+            adfBounds[0] = ReadDouble(8 + 4);
+            adfBounds[1] = ReadDouble(8 + 12);
+            adfBounds[2] = adfBounds[0];
+            adfBounds[3] = adfBounds[1];
+            break;
+        }
+
+        default:
+            // Null shapes and unhandled types have empty bounds at origin,
+            // as returned by SHPReadObject()
+            break;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                       BuildSpatialIndexTree()                        */
+/*                                                                      */
+/*      Build the same quadtree as SHPCreateTree(), but only reading    */
+/*      the bounding boxes of the .shp records, in parallel.            */
+/************************************************************************/
+
+SHPTree *OGRShapeLayer::BuildSpatialIndexTree(int nMaxDepth)
+
+{
+    int nShapeCount = 0;
+    double adfBoundsMin[4] = {0, 0, 0, 0};
+    double adfBoundsMax[4] = {0, 0, 0, 0};
+    SHPGetInfo(hSHP, &nShapeCount, nullptr, adfBoundsMin, adfBoundsMax);
+
+    // Same estimation of the tree depth as in SHPCreateTree()
+    if (nMaxDepth == 0)
+    {
+        int nMaxNodeCount = 1;
+        while (nMaxNodeCount * 4 < nShapeCount)
+        {
+            nMaxDepth += 1;
+            nMaxNodeCount = nMaxNodeCount * 2;
+        }
+        CPLDebug("Shape", "Estimated spatial index tree depth: %d", nMaxDepth);
+        nMaxDepth = std::min(nMaxDepth, MAX_DEFAULT_TREE_DEPTH);
+    }
+
+    // Offsets and sizes of the records, from the .shx file if they have
+    // not been loaded yet.
+    std::vector<uint32_t> anRecOffsetSize;
+    try
+    {
+        anRecOffsetSize.resize(2 * static_cast<size_t>(nShapeCount));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for spatial index creation");
+        return nullptr;
+    }
+    bool bNeedSHX = false;
+    for (int i = 0; i < nShapeCount; i++)
+    {
+        anRecOffsetSize[2 * i] = hSHP->panRecOffset[i];
+        anRecOffsetSize[2 * i + 1] = hSHP->panRecSize[i];
+        if (hSHP->panRecOffset[i] == 0 && hSHP->fpSHX != nullptr)
+            bNeedSHX = true;
+    }
+    if (bNeedSHX)
+    {
+        if (hSHP->sHooks.FSeek(hSHP->fpSHX, 100, 0) != 0 ||
+            hSHP->sHooks.FRead(anRecOffsetSize.data(), sizeof(uint32_t) * 2,
+                               nShapeCount, hSHP->fpSHX) !=
+                static_cast<SAOffset>(nShapeCount))
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read .shx file");
+            return nullptr;
+        }
+        // Invalid values are set to 0, so that the records are skipped
+        for (int i = 0; i < nShapeCount; i++)
+        {
+            uint32_t &nOffset = anRecOffsetSize[2 * i];
+            uint32_t &nSize = anRecOffsetSize[2 * i + 1];
+            CPL_MSBPTR32(&nOffset);
+            CPL_MSBPTR32(&nSize);
+            nOffset =
+                nOffset <= static_cast<uint32_t>(INT_MAX) ? nOffset * 2 : 0;
+            nSize =
+                nSize <= static_cast<uint32_t>(INT_MAX / 2 - 4) ? nSize * 2 : 0;
+        }
+    }
+
+    // The .shp file is opened again by each worker thread
+    std::string osSHPFilename(pszFullName);
+    if (!EQUAL(CPLGetExtension(pszFullName), "shp"))
+    {
+        VSIStatBufL sStat;
+        osSHPFilename = CPLResetExtension(pszFullName, "shp");
+        if (VSIStatL(osSHPFilename.c_str(), &sStat) != 0)
+            osSHPFilename = CPLResetExtension(pszFullName, "SHP");
+    }
+
+    const char *pszMaxThreads =
+        CPLGetConfigOption("OGR_SHAPE_NUM_THREADS", nullptr);
+    const int nMaxThreads =
+        pszMaxThreads == nullptr        ? std::min(4, CPLGetNumCPUs())
+        : EQUAL(pszMaxThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                           : atoi(pszMaxThreads);
+    constexpr int SHAPES_PER_THREAD = 65536;
+    const int nThreads = std::max(
+        1, std::min(nMaxThreads, 1 + (nShapeCount - 1) / SHAPES_PER_THREAD));
+
+    SHPTree *psTree =
+        SHPCreateTree(nullptr, 2, nMaxDepth, adfBoundsMin, adfBoundsMax);
+    if (psTree == nullptr)
+        return nullptr;
+    psTree->hSHP = hSHP;
+
+    // Shapes whose bounds are read at once, and then inserted in the tree in
+    // the order of their shape id, so that the tree does not depend on the
+    // number of threads.
+    struct ShapeBounds
+    {
+        double adfBounds[4];
+        bool bValid;
+    };
+
+    std::vector<ShapeBounds> asShapeBounds(
+        std::min(nShapeCount, nThreads * SHAPES_PER_THREAD));
+    std::vector<VSIVirtualHandleUniquePtr> apoFiles(nThreads);
+    for (auto &poFile : apoFiles)
+    {
+        poFile.reset(VSIFOpenL(osSHPFilename.c_str(), "rb"));
+        if (!poFile)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s",
+                     osSHPFilename.c_str());
+            SHPDestroyTree(psTree);
+            return nullptr;
+        }
+    }
+
+    const auto ReadBounds = [&anRecOffsetSize, &asShapeBounds](
+                                VSILFILE *fp, int iFirstShape, int iStart,
+                                int iEnd)
+    {
+        for (int i = iStart; i < iEnd; ++i)
+        {
+            const int iShape = iFirstShape + i;
+            asShapeBounds[i].bValid = ReadShapeBounds(
+                fp, anRecOffsetSize[2 * iShape],
+                anRecOffsetSize[2 * iShape + 1], asShapeBounds[i].adfBounds);
+        }
+    };
+
+    SHPObject sShape;
+    memset(&sShape, 0, sizeof(sShape));
+
+    const int nBatchSize = static_cast<int>(asShapeBounds.size());
+    for (int iFirstShape = 0; iFirstShape < nShapeCount;
+         iFirstShape += nBatchSize)
+    {
+        const int nShapesInBatch =
+            std::min(nBatchSize, nShapeCount - iFirstShape);
+        if (nThreads == 1)
+        {
+            ReadBounds(apoFiles[0].get(), iFirstShape, 0, nShapesInBatch);
+        }
+        else
+        {
+            std::vector<std::thread> aoThreads;
+            const int nShapesPerThread =
+                (nShapesInBatch + nThreads - 1) / nThreads;
+            for (int iThread = 0; iThread < nThreads; ++iThread)
+            {
+                const int iStart = iThread * nShapesPerThread;
+                const int iEnd =
+                    std::min(nShapesInBatch, iStart + nShapesPerThread);
+                if (iStart >= iEnd)
+                    break;
+                aoThreads.emplace_back(ReadBounds, apoFiles[iThread].get(),
+                                       iFirstShape, iStart, iEnd);
+            }
+            for (auto &oThread : aoThreads)
+                oThread.join();
+        }
+
+        for (int i = 0; i < nShapesInBatch; ++i)
+        {
+            if (asShapeBounds[i].bValid)
+            {
+                // Only the id and bounds of the shape are used by the tree
+                sShape.nShapeId = iFirstShape + i;
+                sShape.dfXMin = asShapeBounds[i].adfBounds[0];
+                sShape.dfYMin = asShapeBounds[i].adfBounds[1];
+                sShape.dfXMax = asShapeBounds[i].adfBounds[2];
+                sShape.dfYMax = asShapeBounds[i].adfBounds[3];
+                SHPTreeAddShapeId(psTree, &sShape);
+            }
+        }
+    }
+
+    return psTree;
+}
+
 /************************************************************************/
 /*                         CreateSpatialIndex()                         */
 /************************************************************************/
@@ -2707,7 +3084,7 @@ OGRErr OGRShapeLayer::CreateSpatialIndex(int nMaxDepth)
     /*      Build a quadtree structure for this file.                       */
     /* -------------------------------------------------------------------- */
     OGRShapeLayer::SyncToDisk();
-    SHPTree *psTree = SHPCreateTree(hSHP, 2, nMaxDepth, nullptr, nullptr);
+    SHPTree *psTree = BuildSpatialIndexTree(nMaxDepth);
 
     if (nullptr == psTree)
     {
@@ -3866,7 +4243,7 @@ GDALDataset *OGRShapeLayer::GetDataset()
 
 // Specialized implementation restricted to situations where only retrieving
 // of FID values is asked (without filters)
-// In other cases, fall back to generic implementation.
+// In other cases, fall back to the multi-threaded or generic implementation.
 int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
                                      struct ArrowArray *out_array)
 {
@@ -3877,9 +4254,12 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return EIO;
     }
 
+    if (m_bIsArrowArrayPrefetchWorker)
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+
     if (!hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr)
     {
-        return OGRLayer::GetNextArrowArray(stream, out_array);
+        return GetNextArrowArrayAsynchronous(stream, out_array);
     }
 
     // If any field is not ignored, use generic implementation
@@ -3887,11 +4267,11 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     for (int i = 0; i < nFieldCount; ++i)
     {
         if (!poFeatureDefn->GetFieldDefn(i)->IsIgnored())
-            return OGRLayer::GetNextArrowArray(stream, out_array);
+            return GetNextArrowArrayAsynchronous(stream, out_array);
     }
     if (GetGeomType() != wkbNone &&
         !poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored())
-        return OGRLayer::GetNextArrowArray(stream, out_array);
+        return GetNextArrowArrayAsynchronous(stream, out_array);
 
     OGRArrowArrayHelper sHelper(poDS, poFeatureDefn,
                                 m_aosArrowArrayStreamOptions, out_array);
@@ -3935,6 +4315,325 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     return 0;
 }
 
+/************************************************************************/
+/*            ArrowArrayPrefetchTask::~ArrowArrayPrefetchTask()         */
+/************************************************************************/
+
+OGRShapeLayer::ArrowArrayPrefetchTask::~ArrowArrayPrefetchTask()
+{
+    if (m_oThread.joinable())
+        m_oThread.join();
+    for (auto &sArray : m_asArrays)
+    {
+        if (sArray.release)
+            sArray.release(&sArray);
+    }
+    if (m_sStream.release)
+        m_sStream.release(&m_sStream);
+}
+
+/************************************************************************/
+/*                    CancelAsyncNextArrowArray()                       */
+/************************************************************************/
+
+void OGRShapeLayer::CancelAsyncNextArrowArray()
+{
+    // Destroying the tasks waits for their thread to be finished
+    while (!m_oQueueArrowArrayPrefetchTasks.empty())
+        m_oQueueArrowArrayPrefetchTasks.pop();
+
+    for (auto &sArray : m_asArrowArrayPrefetchReady)
+    {
+        if (sArray.release)
+            sArray.release(&sArray);
+    }
+    m_asArrowArrayPrefetchReady.clear();
+
+    m_anArrowArrayPrefetchShapeIds.clear();
+    m_nArrowArrayPrefetchCandidates = 0;
+    m_iArrowArrayPrefetchNextCandidate = 0;
+    m_bArrowArrayPrefetchTried = false;
+}
+
+/************************************************************************/
+/*                   StartArrowArrayPrefetchTasks()                     */
+/************************************************************************/
+
+// Start worker threads, each one operating on its own dataset, and decoding
+// successive ranges of candidate records into ArrowArrays.
+void OGRShapeLayer::StartArrowArrayPrefetchTasks()
+{
+    m_bArrowArrayPrefetchTried = true;
+
+    // Only at the start of an iteration, and when the generic implementation
+    // does not use its own fast FID filtering.
+    if (bUpdateAccess || iNextShapeId != 0 || iMatchingFID != 0 ||
+        !m_poSharedArrowArrayStreamPrivateData ||
+        !m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty())
+    {
+        return;
+    }
+
+    const char *pszMaxThreads =
+        CPLGetConfigOption("OGR_SHAPE_NUM_THREADS", nullptr);
+    const int nMaxThreads =
+        pszMaxThreads == nullptr        ? std::min(4, CPLGetNumCPUs())
+        : EQUAL(pszMaxThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                           : atoi(pszMaxThreads);
+    if (nMaxThreads < 2 || CPLGetUsablePhysicalRAM() <= 1024 * 1024 * 1024)
+        return;
+
+    // Use the spatial and attribute indices to select candidate records
+    if ((m_poAttrQuery != nullptr || m_poFilterGeom != nullptr) &&
+        panMatchingFIDs == nullptr)
+    {
+        ScanIndices();
+    }
+    int nCandidates = nTotalShapeCount;
+    if (panMatchingFIDs != nullptr)
+    {
+        for (int i = 0; panMatchingFIDs[i] != OGRNullFID; ++i)
+        {
+            m_anArrowArrayPrefetchShapeIds.push_back(
+                static_cast<int>(panMatchingFIDs[i]));
+        }
+        nCandidates = static_cast<int>(m_anArrowArrayPrefetchShapeIds.size());
+    }
+
+    // Not worth it if everything fits in a single batch. This also ensures
+    // that m_anArrowArrayPrefetchShapeIds is not empty if panMatchingFIDs
+    // is used.
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        m_aosArrowArrayStreamOptions);
+    if (nCandidates <= nMaxBatchSize)
+    {
+        m_anArrowArrayPrefetchShapeIds.clear();
+        return;
+    }
+
+    const int nTasks = static_cast<int>(std::min<GIntBig>(
+        DIV_ROUND_UP(static_cast<GIntBig>(nCandidates), nMaxBatchSize),
+        nMaxThreads));
+    CPLDebug("SHAPE", "Using %d threads", nTasks);
+
+    m_nArrowArrayPrefetchCandidates = nCandidates;
+    m_iArrowArrayPrefetchNextCandidate = 0;
+
+    GDALOpenInfo oOpenInfo(pszFullName, GA_ReadOnly);
+    oOpenInfo.papszOpenOptions = poDS->GetOpenOptions();
+    oOpenInfo.nOpenFlags = GDAL_OF_VECTOR;
+    for (int iTask = 0; iTask < nTasks; ++iTask)
+    {
+        auto task = std::make_unique<ArrowArrayPrefetchTask>();
+        task->m_poDS = std::make_unique<OGRShapeDataSource>();
+        if (!task->m_poDS->Open(&oOpenInfo, /* bTestOpen = */ false))
+            break;
+        auto poOtherLayer =
+            dynamic_cast<OGRShapeLayer *>(task->m_poDS->GetLayer(0));
+        if (poOtherLayer == nullptr ||
+            poOtherLayer->GetLayerDefn()->GetFieldCount() !=
+                poFeatureDefn->GetFieldCount() ||
+            poOtherLayer->GetLayerDefn()->GetGeomFieldCount() !=
+                poFeatureDefn->GetGeomFieldCount())
+        {
+            break;
+        }
+        poOtherLayer->m_bIsArrowArrayPrefetchWorker = true;
+
+        auto poOtherFDefn = poOtherLayer->GetLayerDefn();
+        for (int i = 0; i < poFeatureDefn->GetGeomFieldCount(); ++i)
+        {
+            poOtherFDefn->GetGeomFieldDefn(i)->SetIgnored(
+                poFeatureDefn->GetGeomFieldDefn(i)->IsIgnored());
+        }
+        for (int i = 0; i < poFeatureDefn->GetFieldCount(); ++i)
+        {
+            poOtherFDefn->GetFieldDefn(i)->SetIgnored(
+                poFeatureDefn->GetFieldDefn(i)->IsIgnored());
+        }
+        if (m_pszAttrQueryString &&
+            poOtherLayer->SetAttributeFilter(m_pszAttrQueryString) !=
+                OGRERR_NONE)
+        {
+            break;
+        }
+        if (m_poFilterGeom)
+            poOtherLayer->SetSpatialFilter(m_poFilterGeom);
+
+        task->m_poLayer = poOtherLayer;
+        if (!LaunchArrowArrayPrefetchTask(task.get()))
+            break;
+        m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
+    }
+
+    if (m_oQueueArrowArrayPrefetchTasks.empty())
+    {
+        m_anArrowArrayPrefetchShapeIds.clear();
+        m_nArrowArrayPrefetchCandidates = 0;
+    }
+}
+
+/************************************************************************/
+/*                   LaunchArrowArrayPrefetchTask()                     */
+/************************************************************************/
+
+// Assign the next range of candidate records to the task and start its thread
+bool OGRShapeLayer::LaunchArrowArrayPrefetchTask(ArrowArrayPrefetchTask *task)
+{
+    const int nMaxBatchSize = OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+        m_aosArrowArrayStreamOptions);
+    task->m_iFirstCandidate = m_iArrowArrayPrefetchNextCandidate;
+    task->m_iLastCandidate =
+        task->m_iFirstCandidate +
+        std::min(nMaxBatchSize,
+                 m_nArrowArrayPrefetchCandidates - task->m_iFirstCandidate);
+    task->m_osErrorMsg.clear();
+    try
+    {
+        task->m_oThread =
+            std::thread([this, task]() { RunArrowArrayPrefetchTask(task); });
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Cannot start worker thread: %s",
+                 e.what());
+        return false;
+    }
+    m_iArrowArrayPrefetchNextCandidate = task->m_iLastCandidate;
+    return true;
+}
+
+/************************************************************************/
+/*                    RunArrowArrayPrefetchTask()                       */
+/************************************************************************/
+
+// Executed in a worker thread. Only accesses the layer of the task, and
+// read-only members of this layer.
+void OGRShapeLayer::RunArrowArrayPrefetchTask(
+    ArrowArrayPrefetchTask *task) const
+{
+    OGRShapeLayer *poLayer = task->m_poLayer;
+
+    // A new stream is needed for each range, since the generic
+    // implementation remembers that the end of the previous one was reached.
+    if (task->m_sStream.release)
+        task->m_sStream.release(&task->m_sStream);
+    if (!poLayer->TouchLayer() ||
+        !poLayer->GetArrowStream(&task->m_sStream,
+                                 m_aosArrowArrayStreamOptions.List()))
+    {
+        task->m_osErrorMsg = CPLGetLastErrorMsg();
+        if (task->m_osErrorMsg.empty())
+            task->m_osErrorMsg = "Cannot create worker ArrowArrayStream";
+        return;
+    }
+
+    // Install the candidate records as the list of matching FIDs of the
+    // worker layer, so that GetNextFeature() only iterates over them.
+    const int nCandidates = task->m_iLastCandidate - task->m_iFirstCandidate;
+    GIntBig *panFIDs = static_cast<GIntBig *>(
+        VSI_MALLOC2_VERBOSE(nCandidates + 1, sizeof(GIntBig)));
+    if (panFIDs == nullptr)
+    {
+        task->m_osErrorMsg = "Out of memory";
+        return;
+    }
+    int nFIDs = 0;
+    for (int i = task->m_iFirstCandidate; i < task->m_iLastCandidate; ++i)
+    {
+        if (!m_anArrowArrayPrefetchShapeIds.empty())
+        {
+            panFIDs[nFIDs++] = m_anArrowArrayPrefetchShapeIds[i];
+        }
+        // Skip deleted records as the sequential reading does
+        else if (!poLayer->hDBF || !DBFIsRecordDeleted(poLayer->hDBF, i))
+        {
+            panFIDs[nFIDs++] = i;
+        }
+    }
+    panFIDs[nFIDs] = OGRNullFID;
+    poLayer->ClearMatchingFIDs();
+    poLayer->panMatchingFIDs = panFIDs;
+    poLayer->iMatchingFID = 0;
+
+    while (true)
+    {
+        struct ArrowArray sArray;
+        memset(&sArray, 0, sizeof(sArray));
+        if (task->m_sStream.get_next(&task->m_sStream, &sArray) != 0)
+        {
+            const char *pszErrorMsg =
+                task->m_sStream.get_last_error(&task->m_sStream);
+            task->m_osErrorMsg =
+                pszErrorMsg && pszErrorMsg[0] ? pszErrorMsg
+                                              : "Worker get_next() failed";
+            break;
+        }
+        if (sArray.release == nullptr)
+            break;
+        task->m_asArrays.push_back(sArray);
+    }
+}
+
+/************************************************************************/
+/*                   GetNextArrowArrayAsynchronous()                    */
+/************************************************************************/
+
+int OGRShapeLayer::GetNextArrowArrayAsynchronous(
+    struct ArrowArrayStream *stream, struct ArrowArray *out_array)
+{
+    if (!m_bArrowArrayPrefetchTried)
+        StartArrowArrayPrefetchTasks();
+    if (m_nArrowArrayPrefetchCandidates == 0)
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+
+    memset(out_array, 0, sizeof(*out_array));
+    while (m_asArrowArrayPrefetchReady.empty())
+    {
+        if (m_oQueueArrowArrayPrefetchTasks.empty())
+        {
+            if (m_iArrowArrayPrefetchNextCandidate <
+                m_nArrowArrayPrefetchCandidates)
+            {
+                // All worker threads failed to be restarted
+                CancelAsyncNextArrowArray();
+                m_bArrowArrayPrefetchTried = true;
+                return EIO;
+            }
+            return 0;
+        }
+
+        // Tasks are queued in the order of their range of records
+        auto task = std::move(m_oQueueArrowArrayPrefetchTasks.front());
+        m_oQueueArrowArrayPrefetchTasks.pop();
+        task->m_oThread.join();
+        if (!task->m_osErrorMsg.empty())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     task->m_osErrorMsg.c_str());
+            CancelAsyncNextArrowArray();
+            m_bArrowArrayPrefetchTried = true;
+            return EIO;
+        }
+        for (const auto &sArray : task->m_asArrays)
+            m_asArrowArrayPrefetchReady.push_back(sArray);
+        task->m_asArrays.clear();
+
+        // Recycle the task for the next range of records, if any
+        if (m_iArrowArrayPrefetchNextCandidate <
+                m_nArrowArrayPrefetchCandidates &&
+            LaunchArrowArrayPrefetchTask(task.get()))
+        {
+            m_oQueueArrowArrayPrefetchTasks.push(std::move(task));
+        }
+    }
+
+    memcpy(out_array, &m_asArrowArrayPrefetchReady.front(),
+           sizeof(*out_array));
+    m_asArrowArrayPrefetchReady.pop_front();
+    return 0;
+}
+
 /************************************************************************/
 /*                        GetMetadataItem()                             */
 /************************************************************************/
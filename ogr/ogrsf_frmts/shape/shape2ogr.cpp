@@ -31,6 +31,7 @@
 #include "cpl_port.h"
 #include "ogrshape.h"
 
+#include <climits>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
@@ -43,6 +44,7 @@
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
+#include "include_fast_float.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
@@ -1290,14 +1292,91 @@ OGRFeatureDefn *SHPReadOGRFeatureDefn(const char *pszName, SHPHandle hSHP,
     return poDefn;
 }
 
+/************************************************************************/
+/*                      SHPReadNumericFieldFast()                       */
+/*                                                                      */
+/*      Decode a numeric field directly from the raw content of the     */
+/*      DBF record, without the intermediate trimmed copy of            */
+/*      DBFReadStringAttribute() and the generic string conversion of   */
+/*      OGRFeature::SetField(). Returns false if the value is not a     */
+/*      plain number, in which case the generic code path, that emits   */
+/*      the appropriate warnings, must be used.                         */
+/************************************************************************/
+
+static bool SHPReadNumericFieldFast(DBFHandle hDBF, const char *pszRecord,
+                                    int iField, OGRFieldType eType,
+                                    OGRFeature *poFeature)
+{
+    const char chType = hDBF->pachFieldType[iField];
+    if (chType != 'N' && chType != 'F')
+        return false;
+
+    const char *pszStart = pszRecord + hDBF->panFieldOffset[iField];
+    const char *pszEnd = pszStart + hDBF->panFieldSize[iField];
+    while (pszStart < pszEnd && *pszStart == ' ')
+        ++pszStart;
+    while (pszEnd > pszStart && pszEnd[-1] == ' ')
+        --pszEnd;
+
+    // Same rule as DBFIsAttributeNULL(): all blanks or starting with '*'
+    if (pszStart == pszEnd || *pszStart == '*')
+    {
+        poFeature->SetFieldNull(iField);
+        return true;
+    }
+
+    if (eType == OFTReal)
+    {
+        double dfValue = 0;
+        const auto answer = fast_float::from_chars(pszStart, pszEnd, dfValue);
+        if (answer.ec != std::errc() || answer.ptr != pszEnd)
+            return false;
+        poFeature->SetField(iField, dfValue);
+        return true;
+    }
+
+    const char *pszIter = pszStart;
+    const bool bNegative = *pszIter == '-';
+    if (bNegative)
+        ++pszIter;
+    // Up to 18 digits cannot overflow a GIntBig
+    if (pszIter == pszEnd || pszEnd - pszIter > 18)
+        return false;
+    GIntBig nValue = 0;
+    for (; pszIter < pszEnd; ++pszIter)
+    {
+        if (*pszIter < '0' || *pszIter > '9')
+            return false;
+        nValue = nValue * 10 + (*pszIter - '0');
+    }
+    if (bNegative)
+        nValue = -nValue;
+
+    if (eType == OFTInteger)
+    {
+        if (nValue < INT_MIN || nValue > INT_MAX)
+            return false;
+        poFeature->SetField(iField, static_cast<int>(nValue));
+    }
+    else
+    {
+        poFeature->SetField(iField, nValue);
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                         SHPReadOGRFeature()                          */
+/*                                                                      */
+/*      If poFeatureToReuse is not null, it is reset and returned on    */
+/*      success. It remains owned by the caller in case of failure.     */
 /************************************************************************/
 
 OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
                               OGRFeatureDefn *poDefn, int iShape,
                               SHPObject *psShape, const char *pszSHPEncoding,
-                              bool &bHasWarnedWrongWindingOrder)
+                              bool &bHasWarnedWrongWindingOrder,
+                              OGRFeature *poFeatureToReuse)
 
 {
     if (iShape < 0 || (hSHP != nullptr && iShape >= hSHP->nRecords) ||
@@ -1321,7 +1400,11 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
         return nullptr;
     }
 
-    OGRFeature *poFeature = new OGRFeature(poDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature)
+        poFeature->Reset();
+    else
+        poFeature = new OGRFeature(poDefn);
 
     /* -------------------------------------------------------------------- */
     /*      Fetch geometry from Shapefile to OGRFeature.                    */
@@ -1382,6 +1465,11 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
     /*      Fetch feature attributes to OGRFeature fields.                  */
     /* -------------------------------------------------------------------- */
 
+    // Raw content of the DBF record, only loaded if a numeric field is
+    // requested.
+    const char *pszRecord = nullptr;
+    bool bRecordLoaded = false;
+
     for (int iField = 0; hDBF != nullptr && iField < poDefn->GetFieldCount();
          iField++)
     {
@@ -1417,6 +1505,22 @@ OGRFeature *SHPReadOGRFeature(SHPHandle hSHP, DBFHandle hDBF,
             case OFTInteger64:
             case OFTReal:
             {
+                if (poFieldDefn->GetSubType() != OFSTBoolean)
+                {
+                    if (!bRecordLoaded)
+                    {
+                        pszRecord = DBFReadTuple(hDBF, iShape);
+                        bRecordLoaded = true;
+                    }
+                    if (pszRecord != nullptr &&
+                        SHPReadNumericFieldFast(hDBF, pszRecord, iField,
+                                                poFieldDefn->GetType(),
+                                                poFeature))
+                    {
+                        break;
+                    }
+                }
+
                 if (DBFIsAttributeNULL(hDBF, iShape, iField))
                 {
                     poFeature->SetFieldNull(iField);
@@ -1312,6 +1312,22 @@ bool OGRSQLiteBaseDataSource::OpenOrCreateDB(int flagsIn,
         sqlite3_config(SQLITE_CONFIG_MALLOC, &sDebugMemAlloc);
 #endif
 
+    // Page caches, prepared statements, etc. of all SQLite connections of
+    // the process, including the ones of the GPKG driver.
+    static const bool bMemoryAccountingRegistered = []()
+    {
+        CPLRegisterMemoryAccountingProvider(
+            "SQLITE",
+            [](GIntBig *pnPeak) -> GIntBig
+            {
+                if (pnPeak)
+                    *pnPeak = static_cast<GIntBig>(sqlite3_memory_highwater(0));
+                return static_cast<GIntBig>(sqlite3_memory_used());
+            });
+        return true;
+    }();
+    CPL_IGNORE_RET_VAL(bMemoryAccountingRegistered);
+
     if (bRegisterOGR2SQLiteExtensions)
         OGR2SQLITE_Register();
 
@@ -37,6 +37,7 @@
 #include <cstring>
 #include <limits>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -45,6 +46,7 @@
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_string.h"
+#include "cpl_time.h"
 
 /************************************************************************/
 /*                  OGR2SQLITE_GetNameForGeometryColumn()               */
@@ -128,6 +130,7 @@ void OGR2SQLITE_Register()
 #include "ogr_feature.h"
 #include "ogr_geometry.h"
 #include "ogr_p.h"
+#include "ogr_recordbatch.h"
 #include "ogr_spatialref.h"
 #include "ogrsf_frmts.h"
 #include "ogrsqlitesqlfunctions.h"
@@ -389,6 +392,8 @@ typedef struct
     bool bHasFIDColumn;
 } OGR2SQLITE_vtab;
 
+class OGR2SQLITEArrowReader;
+
 /************************************************************************/
 /*                          OGR2SQLITE_vtab_cursor                      */
 /************************************************************************/
@@ -413,8 +418,105 @@ typedef struct
 
     GByte *pabyGeomBLOB;
     int nGeomBLOBLen;
+
+    /* Non-null when features are read through GetArrowStream() */
+    OGR2SQLITEArrowReader *poArrowReader;
 } OGR2SQLITE_vtab_cursor;
 
+/************************************************************************/
+/*                          OGR2SQLITEArrowReader                       */
+/************************************************************************/
+
+// Serves the columns of a OGR2SQLITE_vtab_cursor directly from the Arrow
+// record batches returned by OGRLayer::GetArrowStream(), instead of going
+// through OGRFeature objects created by GetNextFeature().
+class OGR2SQLITEArrowReader
+{
+    enum class ColType
+    {
+        INT8,
+        UINT8,
+        INT16,
+        UINT16,
+        INT32,
+        INT64,
+        BOOLEAN,
+        FLOAT32,
+        FLOAT64,
+        STRING,
+        LARGE_STRING,
+        BINARY,
+        LARGE_BINARY,
+        DATE32,
+        DATE64,
+        TIME32,
+        TIME64,
+        TIMESTAMP,
+        WKB,
+        LARGE_WKB,
+    };
+
+    struct Column
+    {
+        int iChild = -1;
+        ColType eType = ColType::INT32;
+        // Number of sub-second units per second for times and timestamps
+        int64_t nUnitsPerSecond = 1;
+        // For timestamps
+        int nTZFlag = 0;
+        int nTZOffsetSecond = 0;
+        // For geometries
+        const OGRSpatialReference *poSRS = nullptr;
+        int nSRSId = -1;
+    };
+
+    OGR2SQLITE_vtab *m_pVTab = nullptr;
+    struct ArrowArrayStream m_sStream
+    {
+    };
+    struct ArrowSchema m_sSchema
+    {
+    };
+    struct ArrowArray m_sBatch
+    {
+    };
+    bool m_bHasBatch = false;
+    bool m_bEOF = false;
+    int64_t m_iRow = -1;
+
+    int m_iFIDChild = -1;
+    ColType m_eFIDType = ColType::INT64;
+    // Indexed by the attribute field index, and then the geometry field index
+    std::vector<Column> m_aoFields{};
+    std::vector<Column> m_aoGeomFields{};
+
+    OGR2SQLITEArrowReader() = default;
+
+    void ReleaseBatch();
+    bool IsNull(int iChild) const;
+    int64_t GetInt64(int iChild, ColType eType) const;
+    static bool SetType(const ArrowSchema *psChild, OGRFieldType eFieldType,
+                        Column &oCol);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGR2SQLITEArrowReader)
+
+  public:
+    ~OGR2SQLITEArrowReader();
+
+    static OGR2SQLITEArrowReader *Create(OGR2SQLITE_vtab *pVTab,
+                                         OGRLayer *poLayer);
+
+    bool Advance(GIntBig nRows);
+
+    bool IsEOF() const
+    {
+        return !m_bHasBatch && m_bEOF;
+    }
+
+    GIntBig GetFID() const;
+    int GetColumn(sqlite3_context *pContext, int nCol);
+};
+
 #ifdef VIRTUAL_OGR_DYNAMIC_EXTENSION_ENABLED
 
 /************************************************************************/
@@ -1092,6 +1194,8 @@ static int OGR2SQLITE_Open(sqlite3_vtab *pVTab, sqlite3_vtab_cursor **ppCursor)
     pCursor->pabyGeomBLOB = nullptr;
     pCursor->nGeomBLOBLen = -1;
 
+    pCursor->poArrowReader = nullptr;
+
     return SQLITE_OK;
 }
 
@@ -1109,6 +1213,7 @@ static int OGR2SQLITE_Close(sqlite3_vtab_cursor *pCursor)
 #endif
     pMyVTab->nMyRef--;
 
+    delete pMyCursor->poArrowReader;
     delete pMyCursor->poFeature;
     delete pMyCursor->poDupDataSource;
 
@@ -1300,6 +1405,9 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
     CPLDebug("OGR2SQLITE", "Attribute filter : %s", osAttributeFilter.c_str());
 #endif
 
+    delete pMyCursor->poArrowReader;
+    pMyCursor->poArrowReader = nullptr;
+
     if (pMyCursor->poLayer->SetAttributeFilter(!osAttributeFilter.empty()
                                                    ? osAttributeFilter.c_str()
                                                    : nullptr) != OGRERR_NONE)
@@ -1316,7 +1424,15 @@ static int OGR2SQLITE_Filter(sqlite3_vtab_cursor *pCursor,
         pMyCursor->nFeatureCount = -1;
     pMyCursor->poLayer->ResetReading();
 
-    if (pMyCursor->nFeatureCount < 0)
+    pMyCursor->poArrowReader =
+        OGR2SQLITEArrowReader::Create(pMyCursor->pVTab, pMyCursor->poLayer);
+
+    if (pMyCursor->poArrowReader)
+    {
+        if (pMyCursor->nFeatureCount < 0)
+            pMyCursor->poArrowReader->Advance(1);
+    }
+    else if (pMyCursor->nFeatureCount < 0)
     {
         pMyCursor->poFeature = pMyCursor->poLayer->GetNextFeature();
 #ifdef DEBUG_OGR2SQLITE
@@ -1343,7 +1459,12 @@ static int OGR2SQLITE_Next(sqlite3_vtab_cursor *pCursor)
 #endif
 
     pMyCursor->nNextWishedIndex++;
-    if (pMyCursor->nFeatureCount < 0)
+    if (pMyCursor->poArrowReader)
+    {
+        if (pMyCursor->nFeatureCount < 0)
+            pMyCursor->poArrowReader->Advance(1);
+    }
+    else if (pMyCursor->nFeatureCount < 0)
     {
         delete pMyCursor->poFeature;
         pMyCursor->poFeature = pMyCursor->poLayer->GetNextFeature();
@@ -1373,6 +1494,8 @@ static int OGR2SQLITE_Eof(sqlite3_vtab_cursor *pCursor)
 
     if (pMyCursor->nFeatureCount < 0)
     {
+        if (pMyCursor->poArrowReader)
+            return pMyCursor->poArrowReader->IsEOF();
         return pMyCursor->poFeature == nullptr;
     }
     else
@@ -1389,7 +1512,16 @@ static void OGR2SQLITE_GoToWishedIndex(OGR2SQLITE_vtab_cursor *pMyCursor)
 {
     if (pMyCursor->nFeatureCount >= 0)
     {
-        if (pMyCursor->nCurFeatureIndex < pMyCursor->nNextWishedIndex)
+        if (pMyCursor->poArrowReader)
+        {
+            if (pMyCursor->nCurFeatureIndex < pMyCursor->nNextWishedIndex)
+            {
+                pMyCursor->poArrowReader->Advance(
+                    pMyCursor->nNextWishedIndex - pMyCursor->nCurFeatureIndex);
+                pMyCursor->nCurFeatureIndex = pMyCursor->nNextWishedIndex;
+            }
+        }
+        else if (pMyCursor->nCurFeatureIndex < pMyCursor->nNextWishedIndex)
         {
             do
             {
@@ -1446,6 +1578,652 @@ static void OGR2SQLITE_ExportGeometry(OGRGeometry *poGeom, int nSRSId,
     }
 }
 
+/************************************************************************/
+/*                       ~OGR2SQLITEArrowReader()                       */
+/************************************************************************/
+
+OGR2SQLITEArrowReader::~OGR2SQLITEArrowReader()
+{
+    ReleaseBatch();
+    if (m_sSchema.release)
+        m_sSchema.release(&m_sSchema);
+    if (m_sStream.release)
+        m_sStream.release(&m_sStream);
+}
+
+/************************************************************************/
+/*                              SetType()                               */
+/************************************************************************/
+
+bool OGR2SQLITEArrowReader::SetType(const ArrowSchema *psChild,
+                                    OGRFieldType eFieldType, Column &oCol)
+{
+    const char *pszFormat = psChild->format;
+    if (psChild->dictionary != nullptr)
+        return false;
+
+    switch (eFieldType)
+    {
+        case OFTInteger:
+            if (strcmp(pszFormat, "c") == 0)
+                oCol.eType = ColType::INT8;
+            else if (strcmp(pszFormat, "C") == 0)
+                oCol.eType = ColType::UINT8;
+            else if (strcmp(pszFormat, "s") == 0)
+                oCol.eType = ColType::INT16;
+            else if (strcmp(pszFormat, "S") == 0)
+                oCol.eType = ColType::UINT16;
+            else if (strcmp(pszFormat, "i") == 0)
+                oCol.eType = ColType::INT32;
+            else if (strcmp(pszFormat, "b") == 0)
+                oCol.eType = ColType::BOOLEAN;
+            else
+                return false;
+            return true;
+
+        case OFTInteger64:
+            if (strcmp(pszFormat, "l") == 0)
+                oCol.eType = ColType::INT64;
+            else if (strcmp(pszFormat, "i") == 0)
+                oCol.eType = ColType::INT32;
+            else
+                return false;
+            return true;
+
+        case OFTReal:
+            if (strcmp(pszFormat, "f") == 0)
+                oCol.eType = ColType::FLOAT32;
+            else if (strcmp(pszFormat, "g") == 0)
+                oCol.eType = ColType::FLOAT64;
+            else
+                return false;
+            return true;
+
+        case OFTString:
+            if (strcmp(pszFormat, "u") == 0)
+                oCol.eType = ColType::STRING;
+            else if (strcmp(pszFormat, "U") == 0)
+                oCol.eType = ColType::LARGE_STRING;
+            else
+                return false;
+            return true;
+
+        case OFTBinary:
+            if (strcmp(pszFormat, "z") == 0)
+                oCol.eType = ColType::BINARY;
+            else if (strcmp(pszFormat, "Z") == 0)
+                oCol.eType = ColType::LARGE_BINARY;
+            else
+                return false;
+            return true;
+
+        case OFTDate:
+            if (strcmp(pszFormat, "tdD") == 0)
+                oCol.eType = ColType::DATE32;
+            else if (strcmp(pszFormat, "tdm") == 0)
+                oCol.eType = ColType::DATE64;
+            else
+                return false;
+            return true;
+
+        case OFTTime:
+            if (strcmp(pszFormat, "tts") == 0)
+            {
+                oCol.eType = ColType::TIME32;
+                oCol.nUnitsPerSecond = 1;
+            }
+            else if (strcmp(pszFormat, "ttm") == 0)
+            {
+                oCol.eType = ColType::TIME32;
+                oCol.nUnitsPerSecond = 1000;
+            }
+            else if (strcmp(pszFormat, "ttu") == 0)
+            {
+                oCol.eType = ColType::TIME64;
+                oCol.nUnitsPerSecond = 1000 * 1000;
+            }
+            else if (strcmp(pszFormat, "ttn") == 0)
+            {
+                oCol.eType = ColType::TIME64;
+                oCol.nUnitsPerSecond = 1000 * 1000 * 1000;
+            }
+            else
+                return false;
+            return true;
+
+        case OFTDateTime:
+        {
+            if (strncmp(pszFormat, "ts", 2) != 0 || pszFormat[2] == 0 ||
+                pszFormat[3] != ':')
+                return false;
+            oCol.eType = ColType::TIMESTAMP;
+            switch (pszFormat[2])
+            {
+                case 's':
+                    oCol.nUnitsPerSecond = 1;
+                    break;
+                case 'm':
+                    oCol.nUnitsPerSecond = 1000;
+                    break;
+                case 'u':
+                    oCol.nUnitsPerSecond = 1000 * 1000;
+                    break;
+                case 'n':
+                    oCol.nUnitsPerSecond = 1000 * 1000 * 1000;
+                    break;
+                default:
+                    return false;
+            }
+            const char *pszTZ = pszFormat + 4;
+            const size_t nTZLen = strlen(pszTZ);
+            if (nTZLen == 0)
+            {
+                oCol.nTZFlag = 0;
+            }
+            else if (strcmp(pszTZ, "UTC") == 0 || strcmp(pszTZ, "Etc/UTC") == 0)
+            {
+                oCol.nTZFlag = 100;
+            }
+            else if (nTZLen == 6 && (pszTZ[0] == '+' || pszTZ[0] == '-') &&
+                     pszTZ[3] == ':')
+            {
+                const int nTZHour = atoi(pszTZ + 1);
+                const int nTZMin = atoi(pszTZ + 4);
+                if (!(nTZHour >= 0 && nTZHour <= 14 && nTZMin >= 0 &&
+                      nTZMin < 60 && (nTZMin % 15) == 0))
+                    return false;
+                const int nSign = pszTZ[0] == '+' ? 1 : -1;
+                oCol.nTZFlag = 100 + nSign * (nTZHour * 4 + nTZMin / 15);
+                oCol.nTZOffsetSecond = nSign * (nTZHour * 3600 + nTZMin * 60);
+            }
+            else
+            {
+                // Named time zones are not handled
+                return false;
+            }
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+// Returns nullptr if the layer has no efficient Arrow interface, or if its
+// Arrow schema has columns that cannot be served identically to the
+// classic GetNextFeature() code path.
+OGR2SQLITEArrowReader *OGR2SQLITEArrowReader::Create(OGR2SQLITE_vtab *pVTab,
+                                                     OGRLayer *poLayer)
+{
+    if (!CPLTestBool(
+            CPLGetConfigOption("OGR_SQLITE_VIRTUAL_OGR_USE_ARROW", "YES")) ||
+        !poLayer->TestCapability(OLCFastGetArrowStream))
+    {
+        return nullptr;
+    }
+
+    auto poReader =
+        std::unique_ptr<OGR2SQLITEArrowReader>(new OGR2SQLITEArrowReader());
+    poReader->m_pVTab = pVTab;
+
+    const char *const apszOptions[] = {"INCLUDE_FID=YES",
+                                       "GEOMETRY_ENCODING=WKB", nullptr};
+    if (!poLayer->GetArrowStream(&poReader->m_sStream, apszOptions) ||
+        poReader->m_sStream.get_schema(&poReader->m_sStream,
+                                       &poReader->m_sSchema) != 0)
+    {
+        return nullptr;
+    }
+
+    const auto &sSchema = poReader->m_sSchema;
+    if (strcmp(sSchema.format, "+s") != 0)
+        return nullptr;
+
+    std::map<std::string, int> oMapNameToChild;
+    for (int i = 0; i < static_cast<int>(sSchema.n_children); ++i)
+    {
+        oMapNameToChild[sSchema.children[i]->name] = i;
+    }
+
+    const auto GetChildIdx = [&oMapNameToChild](const char *pszName)
+    {
+        const auto oIter = oMapNameToChild.find(pszName);
+        return oIter == oMapNameToChild.end() ? -1 : oIter->second;
+    };
+
+    const char *pszFIDName = poLayer->GetFIDColumn();
+    poReader->m_iFIDChild = GetChildIdx(pszFIDName[0]
+                                            ? pszFIDName
+                                            : OGRLayer::DEFAULT_ARROW_FID_NAME);
+    if (poReader->m_iFIDChild < 0)
+    {
+        CPLDebug("OGR2SQLITE", "%s: no FID column in Arrow stream",
+                 poLayer->GetName());
+        return nullptr;
+    }
+    const char *pszFIDFormat = sSchema.children[poReader->m_iFIDChild]->format;
+    if (strcmp(pszFIDFormat, "l") == 0)
+        poReader->m_eFIDType = ColType::INT64;
+    else if (strcmp(pszFIDFormat, "i") == 0)
+        poReader->m_eFIDType = ColType::INT32;
+    else
+        return nullptr;
+
+    const OGRFeatureDefn *poFDefn = poLayer->GetLayerDefn();
+    for (int i = 0; i < poFDefn->GetFieldCount(); ++i)
+    {
+        const OGRFieldDefn *poFieldDefn = poFDefn->GetFieldDefn(i);
+        Column oCol;
+        oCol.iChild = GetChildIdx(poFieldDefn->GetNameRef());
+        // Unless the time zone of a DateTime field is known at the layer
+        // level, the time zone of individual values cannot be recovered from
+        // the Arrow timestamps.
+        if (oCol.iChild < 0 ||
+            (poFieldDefn->GetType() == OFTDateTime &&
+             poFieldDefn->GetTZFlag() <= OGR_TZFLAG_MIXED_TZ) ||
+            !SetType(sSchema.children[oCol.iChild], poFieldDefn->GetType(),
+                     oCol))
+        {
+            CPLDebug("OGR2SQLITE",
+                     "%s: field %s cannot be read through Arrow stream",
+                     poLayer->GetName(), poFieldDefn->GetNameRef());
+            return nullptr;
+        }
+        poReader->m_aoFields.push_back(oCol);
+    }
+
+    for (int i = 0; i < poFDefn->GetGeomFieldCount(); ++i)
+    {
+        const OGRGeomFieldDefn *poGeomFieldDefn = poFDefn->GetGeomFieldDefn(i);
+        const char *pszName = poGeomFieldDefn->GetNameRef();
+        Column oCol;
+        oCol.iChild = GetChildIdx(
+            pszName[0] ? pszName : OGRLayer::DEFAULT_ARROW_GEOMETRY_NAME);
+        if (oCol.iChild < 0)
+            return nullptr;
+        const auto psChild = sSchema.children[oCol.iChild];
+        if (psChild->dictionary == nullptr && strcmp(psChild->format, "z") == 0)
+            oCol.eType = ColType::WKB;
+        else if (psChild->dictionary == nullptr &&
+                 strcmp(psChild->format, "Z") == 0)
+            oCol.eType = ColType::LARGE_WKB;
+        else
+            return nullptr;
+        oCol.poSRS = poGeomFieldDefn->GetSpatialRef();
+        oCol.nSRSId = pVTab->poModule->FetchSRSId(oCol.poSRS);
+        poReader->m_aoGeomFields.push_back(oCol);
+    }
+
+    return poReader.release();
+}
+
+/************************************************************************/
+/*                           ReleaseBatch()                             */
+/************************************************************************/
+
+void OGR2SQLITEArrowReader::ReleaseBatch()
+{
+    if (m_bHasBatch)
+    {
+        if (m_sBatch.release)
+            m_sBatch.release(&m_sBatch);
+        memset(&m_sBatch, 0, sizeof(m_sBatch));
+        m_bHasBatch = false;
+    }
+}
+
+/************************************************************************/
+/*                              Advance()                               */
+/************************************************************************/
+
+// Moves forward by nRows rows, fetching new batches when needed.
+bool OGR2SQLITEArrowReader::Advance(GIntBig nRows)
+{
+    while (true)
+    {
+        if (m_bHasBatch)
+        {
+            const int64_t nRemaining = m_sBatch.length - 1 - m_iRow;
+            if (nRows <= nRemaining)
+            {
+                m_iRow += nRows;
+                return true;
+            }
+            nRows -= nRemaining;
+            ReleaseBatch();
+        }
+        if (m_bEOF)
+            return false;
+
+        if (m_sStream.get_next(&m_sStream, &m_sBatch) != 0)
+        {
+            const char *pszError = m_sStream.get_last_error(&m_sStream);
+            CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                     pszError ? pszError : "get_next() failed");
+            memset(&m_sBatch, 0, sizeof(m_sBatch));
+            m_bEOF = true;
+            return false;
+        }
+        if (m_sBatch.release == nullptr)
+        {
+            m_bEOF = true;
+            return false;
+        }
+        m_bHasBatch = true;
+        m_iRow = -1;
+        if (m_sBatch.n_children != m_sSchema.n_children)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Arrow batch has an unexpected number of children");
+            ReleaseBatch();
+            m_bEOF = true;
+            return false;
+        }
+    }
+}
+
+/************************************************************************/
+/*                               IsNull()                               */
+/************************************************************************/
+
+bool OGR2SQLITEArrowReader::IsNull(int iChild) const
+{
+    const ArrowArray *psArray = m_sBatch.children[iChild];
+    if (psArray->null_count == 0 || psArray->buffers[0] == nullptr)
+        return false;
+    const int64_t iIdx = psArray->offset + m_sBatch.offset + m_iRow;
+    const GByte *pabyValidity = static_cast<const GByte *>(psArray->buffers[0]);
+    return (pabyValidity[iIdx / 8] & (1 << (iIdx % 8))) == 0;
+}
+
+/************************************************************************/
+/*                              GetInt64()                              */
+/************************************************************************/
+
+int64_t OGR2SQLITEArrowReader::GetInt64(int iChild, ColType eType) const
+{
+    const ArrowArray *psArray = m_sBatch.children[iChild];
+    const int64_t iIdx = psArray->offset + m_sBatch.offset + m_iRow;
+    const void *pValues = psArray->buffers[1];
+    switch (eType)
+    {
+        case ColType::INT8:
+            return static_cast<const int8_t *>(pValues)[iIdx];
+        case ColType::UINT8:
+            return static_cast<const uint8_t *>(pValues)[iIdx];
+        case ColType::INT16:
+            return static_cast<const int16_t *>(pValues)[iIdx];
+        case ColType::UINT16:
+            return static_cast<const uint16_t *>(pValues)[iIdx];
+        case ColType::INT32:
+        case ColType::DATE32:
+        case ColType::TIME32:
+            return static_cast<const int32_t *>(pValues)[iIdx];
+        case ColType::INT64:
+        case ColType::DATE64:
+        case ColType::TIME64:
+        case ColType::TIMESTAMP:
+            return static_cast<const int64_t *>(pValues)[iIdx];
+        case ColType::BOOLEAN:
+            return (static_cast<const GByte *>(pValues)[iIdx / 8] &
+                    (1 << (iIdx % 8))) != 0;
+        default:
+            break;
+    }
+    CPLAssert(false);
+    return 0;
+}
+
+/************************************************************************/
+/*                               GetFID()                               */
+/************************************************************************/
+
+GIntBig OGR2SQLITEArrowReader::GetFID() const
+{
+    if (IsNull(m_iFIDChild))
+        return OGRNullFID;
+    return GetInt64(m_iFIDChild, m_eFIDType);
+}
+
+/************************************************************************/
+/*                             GetColumn()                              */
+/************************************************************************/
+
+// Same column layout and value conversions as OGR2SQLITE_Column()
+int OGR2SQLITEArrowReader::GetColumn(sqlite3_context *pContext, int nCol)
+{
+    if (m_pVTab->bHasFIDColumn)
+    {
+        if (nCol == 0)
+        {
+            sqlite3_result_int64(pContext, GetFID());
+            return SQLITE_OK;
+        }
+        --nCol;
+    }
+
+    const int nFieldCount = static_cast<int>(m_aoFields.size());
+    const int nGeomFieldCount = static_cast<int>(m_aoGeomFields.size());
+    if (nCol < 0 || nCol >= nFieldCount + 1 + nGeomFieldCount + 2)
+        return SQLITE_ERROR;
+
+    // OGR_STYLE, NativeData and NativeMediaType are not available through
+    // the Arrow interface.
+    if (nCol == nFieldCount || nCol > nFieldCount + nGeomFieldCount)
+    {
+        sqlite3_result_null(pContext);
+        return SQLITE_OK;
+    }
+
+    const Column &oCol = nCol < nFieldCount
+                             ? m_aoFields[nCol]
+                             : m_aoGeomFields[nCol - nFieldCount - 1];
+    if (IsNull(oCol.iChild))
+    {
+        sqlite3_result_null(pContext);
+        return SQLITE_OK;
+    }
+
+    const ArrowArray *psArray = m_sBatch.children[oCol.iChild];
+    const int64_t iIdx = psArray->offset + m_sBatch.offset + m_iRow;
+
+    // Returns the start and size of a variable-length value
+    const auto GetVarLength = [psArray, iIdx](bool bLarge, size_t &nSize)
+    {
+        size_t nStart;
+        if (bLarge)
+        {
+            const auto panOffsets =
+                static_cast<const int64_t *>(psArray->buffers[1]);
+            nStart = static_cast<size_t>(panOffsets[iIdx]);
+            nSize = static_cast<size_t>(panOffsets[iIdx + 1] - nStart);
+        }
+        else
+        {
+            const auto panOffsets =
+                static_cast<const int32_t *>(psArray->buffers[1]);
+            nStart = static_cast<size_t>(panOffsets[iIdx]);
+            nSize = static_cast<size_t>(panOffsets[iIdx + 1] - nStart);
+        }
+        return static_cast<const GByte *>(psArray->buffers[2]) + nStart;
+    };
+
+    switch (oCol.eType)
+    {
+        case ColType::INT8:
+        case ColType::UINT8:
+        case ColType::INT16:
+        case ColType::UINT16:
+        case ColType::INT32:
+        case ColType::BOOLEAN:
+            sqlite3_result_int(
+                pContext, static_cast<int>(GetInt64(oCol.iChild, oCol.eType)));
+            break;
+
+        case ColType::INT64:
+            sqlite3_result_int64(pContext, GetInt64(oCol.iChild, oCol.eType));
+            break;
+
+        case ColType::FLOAT32:
+            sqlite3_result_double(
+                pContext,
+                static_cast<const float *>(psArray->buffers[1])[iIdx]);
+            break;
+
+        case ColType::FLOAT64:
+            sqlite3_result_double(
+                pContext,
+                static_cast<const double *>(psArray->buffers[1])[iIdx]);
+            break;
+
+        case ColType::STRING:
+        case ColType::LARGE_STRING:
+        case ColType::BINARY:
+        case ColType::LARGE_BINARY:
+        {
+            size_t nSize = 0;
+            const GByte *pabyData = GetVarLength(
+                oCol.eType == ColType::LARGE_STRING ||
+                    oCol.eType == ColType::LARGE_BINARY,
+                nSize);
+            if (nSize > static_cast<size_t>(std::numeric_limits<int>::max()))
+            {
+                sqlite3_result_error_toobig(pContext);
+            }
+            else if (oCol.eType == ColType::STRING ||
+                     oCol.eType == ColType::LARGE_STRING)
+            {
+                sqlite3_result_text(pContext,
+                                    reinterpret_cast<const char *>(pabyData),
+                                    static_cast<int>(nSize), SQLITE_TRANSIENT);
+            }
+            else
+            {
+                sqlite3_result_blob(pContext, pabyData, static_cast<int>(nSize),
+                                    SQLITE_TRANSIENT);
+            }
+            break;
+        }
+
+        case ColType::DATE32:
+        case ColType::DATE64:
+        {
+            int64_t nVal = GetInt64(oCol.iChild, oCol.eType);
+            GIntBig nUnixTime;
+            if (oCol.eType == ColType::DATE32)
+            {
+                nUnixTime = static_cast<GIntBig>(nVal) * 86400;
+            }
+            else
+            {
+                // Milliseconds, rounded towards minus infinity
+                if (nVal < 0)
+                    nVal -= 999;
+                nUnixTime = static_cast<GIntBig>(nVal / 1000);
+            }
+            struct tm brokenDown;
+            CPLUnixTimeToYMDHMS(nUnixTime, &brokenDown);
+            char szBuffer[64];
+            snprintf(szBuffer, sizeof(szBuffer), "%04d-%02d-%02d",
+                     brokenDown.tm_year + 1900, brokenDown.tm_mon + 1,
+                     brokenDown.tm_mday);
+            sqlite3_result_text(pContext, szBuffer, -1, SQLITE_TRANSIENT);
+            break;
+        }
+
+        case ColType::TIME32:
+        case ColType::TIME64:
+        {
+            const int64_t nVal = GetInt64(oCol.iChild, oCol.eType);
+            const int64_t nSecs = nVal / oCol.nUnitsPerSecond;
+            const int nMS = static_cast<int>(
+                (nVal % oCol.nUnitsPerSecond) * 1000 / oCol.nUnitsPerSecond);
+            const int nHour = static_cast<int>(nSecs / 3600);
+            const int nMinute = static_cast<int>((nSecs / 60) % 60);
+            const float fSecond =
+                static_cast<float>(static_cast<int>(nSecs % 60) + nMS / 1000.0);
+            char szBuffer[64];
+            if (OGR_GET_MS(fSecond) != 0)
+                snprintf(szBuffer, sizeof(szBuffer), "%02d:%02d:%06.3f", nHour,
+                         nMinute, fSecond);
+            else
+                snprintf(szBuffer, sizeof(szBuffer), "%02d:%02d:%02d", nHour,
+                         nMinute, (int)fSecond);
+            sqlite3_result_text(pContext, szBuffer, -1, SQLITE_TRANSIENT);
+            break;
+        }
+
+        case ColType::TIMESTAMP:
+        {
+            const int64_t nVal = GetInt64(oCol.iChild, oCol.eType);
+            int64_t nSecs = nVal / oCol.nUnitsPerSecond;
+            int64_t nRemainder = nVal % oCol.nUnitsPerSecond;
+            if (nRemainder < 0)
+            {
+                nRemainder += oCol.nUnitsPerSecond;
+                --nSecs;
+            }
+            struct tm brokenDown;
+            CPLUnixTimeToYMDHMS(
+                static_cast<GIntBig>(nSecs + oCol.nTZOffsetSecond),
+                &brokenDown);
+            OGRField sField;
+            sField.Date.Year = static_cast<GInt16>(brokenDown.tm_year + 1900);
+            sField.Date.Month = static_cast<GByte>(brokenDown.tm_mon + 1);
+            sField.Date.Day = static_cast<GByte>(brokenDown.tm_mday);
+            sField.Date.Hour = static_cast<GByte>(brokenDown.tm_hour);
+            sField.Date.Minute = static_cast<GByte>(brokenDown.tm_min);
+            sField.Date.TZFlag = static_cast<GByte>(oCol.nTZFlag);
+            sField.Date.Reserved = 0;
+            sField.Date.Second = static_cast<float>(
+                brokenDown.tm_sec +
+                static_cast<double>(nRemainder) / oCol.nUnitsPerSecond);
+            char *pszStr = OGRGetXMLDateTime(&sField);
+            sqlite3_result_text(pContext, pszStr, -1, SQLITE_TRANSIENT);
+            CPLFree(pszStr);
+            break;
+        }
+
+        case ColType::WKB:
+        case ColType::LARGE_WKB:
+        {
+            size_t nSize = 0;
+            const GByte *pabyWKB =
+                GetVarLength(oCol.eType == ColType::LARGE_WKB, nSize);
+            OGRGeometry *poGeomRaw = nullptr;
+            OGRGeometryFactory::createFromWkb(pabyWKB, nullptr, &poGeomRaw,
+                                              nSize);
+            std::unique_ptr<OGRGeometry> poGeom(poGeomRaw);
+            GByte *pabyGeomBLOB = nullptr;
+            int nGeomBLOBLen = 0;
+            if (poGeom)
+            {
+                poGeom->assignSpatialReference(oCol.poSRS);
+                OGR2SQLITE_ExportGeometry(poGeom.get(), oCol.nSRSId,
+                                          pabyGeomBLOB, nGeomBLOBLen);
+            }
+            if (nGeomBLOBLen == 0)
+            {
+                CPLFree(pabyGeomBLOB);
+                sqlite3_result_null(pContext);
+            }
+            else
+            {
+                sqlite3_result_blob(pContext, pabyGeomBLOB, nGeomBLOBLen,
+                                    CPLFree);
+            }
+            break;
+        }
+    }
+
+    return SQLITE_OK;
+}
+
 /************************************************************************/
 /*                         OGR2SQLITE_Column()                          */
 /************************************************************************/
@@ -1461,6 +2239,13 @@ static int OGR2SQLITE_Column(sqlite3_vtab_cursor *pCursor,
 
     OGR2SQLITE_GoToWishedIndex(pMyCursor);
 
+    if (pMyCursor->poArrowReader)
+    {
+        if (pMyCursor->poArrowReader->IsEOF())
+            return SQLITE_ERROR;
+        return pMyCursor->poArrowReader->GetColumn(pContext, nCol);
+    }
+
     OGRFeature *poFeature = pMyCursor->poFeature;
     if (poFeature == nullptr)
         return SQLITE_ERROR;
@@ -1664,6 +2449,14 @@ static int OGR2SQLITE_Rowid(sqlite3_vtab_cursor *pCursor, sqlite3_int64 *pRowid)
 
     OGR2SQLITE_GoToWishedIndex(pMyCursor);
 
+    if (pMyCursor->poArrowReader)
+    {
+        if (pMyCursor->poArrowReader->IsEOF())
+            return SQLITE_ERROR;
+        *pRowid = pMyCursor->poArrowReader->GetFID();
+        return SQLITE_OK;
+    }
+
     if (pMyCursor->poFeature == nullptr)
         return SQLITE_ERROR;
 
@@ -51,6 +51,7 @@
 
 #ifdef __cplusplus
 #define STATIC_CAST(type, value) static_cast<type>(value)
+#define CONST_CAST(type, value) const_cast<type>(value)
 #ifdef NULL
 #undef NULL
 #endif
@@ -59,6 +60,7 @@
 #define SQLITE_STATIC STATIC_CAST(sqlite3_destructor_type, nullptr)
 #else
 #define STATIC_CAST(type, value) (type)(value)
+#define CONST_CAST(type, value) (type)(value)
 #endif
 
 ////////////////////////////////
@@ -110,6 +112,16 @@ struct node_MAXITEMS_plus_ONE {
     };
 };
 
+// Entry of the flat array used by packed trees. At the leaf level, data
+// is the feature id. At upper levels, node is a node of the level below.
+struct packed_item {
+    struct rect rect;
+    union {
+        DATATYPE data;
+        struct node *node;
+    };
+};
+
 struct sqlite_rtree_bl {
     struct rect rect;
     struct node *root;
@@ -118,6 +130,10 @@ struct sqlite_rtree_bl {
     int height;
     int node_size;
     int node_capacity;
+    bool packed;
+    // Only used by packed trees, until the tree is built
+    struct packed_item *packed_items;
+    size_t packed_capacity;
 #ifdef USE_PATHHINT
     int path_hint[16];
 #endif
@@ -515,6 +531,111 @@ static bool node_insert(struct sqlite_rtree_bl *tr,
     return true;
 }
 
+#ifndef USE_CPLUSPLUS
+static int ComparePackedItemAxis0(const void *a, const void *b)
+{
+    const struct packed_item* pa = STATIC_CAST(const struct packed_item*, a);
+    const struct packed_item* pb = STATIC_CAST(const struct packed_item*, b);
+    const NUMTYPE ca = pa->rect.min[0] + pa->rect.max[0];
+    const NUMTYPE cb = pb->rect.min[0] + pb->rect.max[0];
+    return ca < cb ? -1 : ca > cb ? 1 : 0;
+}
+
+static int ComparePackedItemAxis1(const void *a, const void *b)
+{
+    const struct packed_item* pa = STATIC_CAST(const struct packed_item*, a);
+    const struct packed_item* pb = STATIC_CAST(const struct packed_item*, b);
+    const NUMTYPE ca = pa->rect.min[1] + pa->rect.max[1];
+    const NUMTYPE cb = pb->rect.min[1] + pb->rect.max[1];
+    return ca < cb ? -1 : ca > cb ? 1 : 0;
+}
+#endif
+
+// Sort packed items by the center of their rectangle along axis idim
+static void packed_items_sort(struct packed_item *items, size_t n, int idim) {
+#ifndef USE_CPLUSPLUS
+    qsort(items, n, sizeof(struct packed_item),
+          idim == 0 ? ComparePackedItemAxis0 : ComparePackedItemAxis1);
+#else
+    std::sort(items, items + n, [idim](const struct packed_item& a, const struct packed_item& b) {
+        return a.rect.min[idim] + a.rect.max[idim] < b.rect.min[idim] + b.rect.max[idim];
+    });
+#endif
+}
+
+// Build the tree of a packed RTree from its flat array of items, with the
+// Sort-Tile-Recursive algorithm of Leutenegger et al. [1997]: items are
+// sorted along X, split into vertical slices of sqrt(P) full nodes (P being
+// the number of nodes of the level), and each slice is sorted along Y before
+// being cut into nodes. The same process is applied to the resulting nodes,
+// until a single root node remains.
+// The packed_items array is used as a scratch buffer for the upper levels,
+// and freed in case of success. Returns false if out of memory.
+static bool packed_tree_build(struct sqlite_rtree_bl *tr) {
+    struct packed_item *items = tr->packed_items;
+    size_t n = tr->count;
+    const size_t capacity = STATIC_CAST(size_t, tr->node_capacity);
+    enum kind kind = LEAF;
+    int height = 0;
+    while (true) {
+        height++;
+        const size_t node_count = (n + capacity - 1) / capacity;
+        if (node_count > 1) {
+            size_t slice_count = STATIC_CAST(size_t, ceil(sqrt(STATIC_CAST(double, node_count))));
+            const size_t slice_size = ((node_count + slice_count - 1) / slice_count) * capacity;
+            packed_items_sort(items, n, 0);
+            for (size_t i = 0; i < n; i += slice_size) {
+                packed_items_sort(items + i, n - i < slice_size ? n - i : slice_size, 1);
+            }
+        }
+
+        // Nodes of the new level are written at the beginning of the array,
+        // which never overwrites an item not yet consumed.
+        size_t out = 0;
+        for (size_t i = 0; i < n; i += capacity) {
+            struct node *node = node_new(tr, kind);
+            if (!node) {
+                for (size_t j = 0; j < out; ++j) {
+                    node_free(tr, items[j].node);
+                }
+                if (kind == BRANCH) {
+                    for (size_t j = i; j < n; ++j) {
+                        node_free(tr, items[j].node);
+                    }
+                }
+                return false;
+            }
+            const size_t count = n - i < capacity ? n - i : capacity;
+            for (size_t j = 0; j < count; ++j) {
+                node->rects[j] = items[i + j].rect;
+                if (kind == LEAF) {
+                    node->datas[j].data = items[i + j].data;
+                } else {
+                    node->nodes[j] = items[i + j].node;
+                }
+            }
+            node->count = STATIC_CAST(int, count);
+            items[out].rect = node_rect_calc(node);
+            items[out].node = node;
+            out++;
+        }
+
+        n = out;
+        kind = BRANCH;
+        if (n == 1) {
+            break;
+        }
+    }
+
+    tr->root = items[0].node;
+    tr->height = height;
+    tr->free(tr->packed_items);
+    tr->packed_items = NULL;
+    tr->mem_usage -= tr->packed_capacity * sizeof(struct packed_item);
+    tr->packed_capacity = 0;
+    return true;
+}
+
 static
 struct sqlite_rtree_bl *sqlite_rtree_bl_new_with_allocator(int sqlite_page_size,
                                               void *(*pfnMalloc)(size_t),
@@ -544,6 +665,14 @@ struct sqlite_rtree_bl *SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_new)(int sqlite_p
     return sqlite_rtree_bl_new_with_allocator(sqlite_page_size, NULL, NULL);
 }
 
+struct sqlite_rtree_bl *SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_new_packed)(int sqlite_page_size) {
+    struct sqlite_rtree_bl *tr = sqlite_rtree_bl_new_with_allocator(sqlite_page_size, NULL, NULL);
+    if (tr) {
+        tr->packed = true;
+    }
+    return tr;
+}
+
 // Cf https://github.com/sqlite/sqlite/blob/90e4a3b7fcdf63035d6f35eb44d11ff58ff4b068/ext/rtree/rtree.c#L2993C1-L2995C3
 /*
 ** Rounding constants for float->double conversion.
@@ -589,6 +718,40 @@ bool SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_insert)(struct sqlite_rtree_bl *tr,
     struct item item;
     item.data = fid;
 
+    if (tr->packed) {
+        if (tr->root) {
+            // Tree already built by sqlite_rtree_bl_serialize()
+            return false;
+        }
+        if (tr->count == tr->packed_capacity) {
+            const size_t new_capacity = tr->packed_capacity ? tr->packed_capacity * 2 : 1024;
+            if (new_capacity > SIZE_MAX / sizeof(struct packed_item)) {
+                return false;
+            }
+            struct packed_item *new_items = STATIC_CAST(struct packed_item *,
+                tr->malloc(new_capacity * sizeof(struct packed_item)));
+            if (!new_items) {
+                return false;
+            }
+            if (tr->packed_items) {
+                memcpy(new_items, tr->packed_items, tr->count * sizeof(struct packed_item));
+                tr->free(tr->packed_items);
+            }
+            tr->packed_items = new_items;
+            tr->mem_usage += (new_capacity - tr->packed_capacity) * sizeof(struct packed_item);
+            tr->packed_capacity = new_capacity;
+        }
+        tr->packed_items[tr->count].rect = rect;
+        tr->packed_items[tr->count].data = fid;
+        if (tr->count == 0) {
+            tr->rect = rect;
+        } else {
+            rect_expand(&tr->rect, &rect);
+        }
+        tr->count++;
+        return true;
+    }
+
     struct rect rectToInsert;
     struct item itemToInsert;
     struct node* nodeToInsert;
@@ -633,6 +796,13 @@ bool SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_insert)(struct sqlite_rtree_bl *tr,
 }
 
 size_t SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_ram_usage)(const sqlite_rtree_bl* tr) {
+    if (tr->packed_items) {
+        // Account for the leaf nodes that will be allocated by
+        // packed_tree_build() while the array of items is still alive.
+        const size_t capacity = STATIC_CAST(size_t, tr->node_capacity);
+        return tr->mem_usage +
+               (tr->count + capacity - 1) / capacity * sizeof(struct node);
+    }
     return tr->mem_usage;
 }
 
@@ -641,6 +811,9 @@ void SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_free)(struct sqlite_rtree_bl *tr) {
         if (tr->root) {
             node_free(tr, tr->root);
         }
+        if (tr->packed_items) {
+            tr->free(tr->packed_items);
+        }
         tr->free(tr);
     }
 }
@@ -865,6 +1038,16 @@ bool SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_serialize)(
         return true;
     }
 
+    if (tr->packed && !tr->root) {
+        // The tree of packed RTrees is lazily built at that point. This does
+        // not change the content of the RTree, hence the cast.
+        if (!packed_tree_build(CONST_CAST(struct sqlite_rtree_bl *, tr))) {
+            if (p_error_msg)
+                *p_error_msg = my_sqlite3_strdup("not enough memory");
+            return false;
+        }
+    }
+
     // Suppress default root node
     sql = sqlite3_mprintf("DELETE FROM \"%w_node\"", rtree_name);
     ret = sqlite3_exec(hDB, sql, NULL, NULL, p_error_msg);
@@ -949,7 +1132,7 @@ bool SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_from_feature_table)(
     const int page_size = atoi(papszResult[1]);
     sqlite3_free_table(papszResult);
 
-    struct sqlite_rtree_bl* t = SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_new)(page_size);
+    struct sqlite_rtree_bl* t = SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_new_packed)(page_size);
     if (!t) {
         if (p_error_msg)
             *p_error_msg = my_sqlite3_strdup("not enough memory");
@@ -59,6 +59,22 @@ typedef struct sqlite_rtree_bl sqlite_rtree_bl;
  */
 sqlite_rtree_bl *SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_new)(int sqlite_page_size);
 
+/** Creates a new packed RTree.
+ *
+ * Contrary to sqlite_rtree_bl_new(), rows inserted with
+ * sqlite_rtree_bl_insert() are just accumulated, and the tree is built once
+ * for all by sqlite_rtree_bl_serialize() with the Sort-Tile-Recursive (STR)
+ * algorithm. This is faster than R*Tree insertion, and results in a tree
+ * with full nodes and less overlap between them.
+ * No row can be inserted after sqlite_rtree_bl_serialize() has been called.
+ *
+ * @param sqlite_page_size The page size of the target SQLite database, as
+ *                         typically determined by "PRAGMA page_size"
+ * @return a RTree to free with sqlite_rtree_bl_free(), or NULL if the system
+ *         is out of memory.
+ */
+sqlite_rtree_bl *SQLITE_RTREE_BL_SYMBOL(sqlite_rtree_bl_new_packed)(int sqlite_page_size);
+
 /** Insert a new row into the RTree.
  * The double values are rounded to float in an appropriate way by the
  * function.
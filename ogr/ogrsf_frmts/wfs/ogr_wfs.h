@@ -33,6 +33,7 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <memory>
 
 #include "cpl_minixml.h"
 #include "ogrsf_frmts.h"
@@ -72,6 +73,7 @@ class OGRWFSSortDesc
 /************************************************************************/
 
 class OGRWFSDataSource;
+struct OGRWFSPrefetchedPage;
 
 class OGRWFSLayer final : public OGRLayer
 {
@@ -136,6 +138,15 @@ class OGRWFSLayer final : public OGRLayer
     int nPagingStartIndex;
     int nFeatureRead;
 
+    // Pages of a paged GetFeature request downloaded ahead in background
+    // threads, ordered by increasing start index.
+    std::vector<std::unique_ptr<OGRWFSPrefetchedPage>> m_apoPrefetchedPages{};
+    bool m_bPagingPrefetchDisabled = false;
+
+    void PrefetchNextPages(int nPageCount);
+    CPLHTTPResult *TakePrefetchedPage(const CPLString &osURL);
+    void CancelPrefetchedPages();
+
     OGRFeatureDefn *BuildLayerDefnFromFeatureClass(GMLFeatureClass *poClass);
 
     char *pszRequiredOutputFormat;
@@ -498,6 +509,7 @@ class OGRWFSDataSource final : public OGRDataSource
     void SaveLayerSchema(const char *pszLayerName, const CPLXMLNode *psSchema);
 
     CPLHTTPResult *HTTPFetch(const char *pszURL, char **papszOptions);
+    CPLStringList GetHTTPFetchOptions(CSLConstList papszOptions) const;
 
     bool IsPagingAllowed() const
     {
@@ -37,6 +37,7 @@
 #include <memory>
 #include <vector>
 #include <set>
+#include <thread>
 
 // g++ -Wshadow -Wextra -std=c++11 -fPIC -g -Wall
 // ogr/ogrsf_frmts/wfs/ogroapif*.cpp -shared -o ogr_OAPIF.so -Iport -Igcore
@@ -80,6 +81,7 @@ class OGROAPIFDataset final : public GDALDataset
     friend class OGROAPIFLayer;
 
     bool m_bMustCleanPersistent = false;
+    bool m_bPrefetchNextPage = false;
     CPLString m_osRootURL;
     CPLString m_osUserQueryParams;
     CPLString m_osUserPwd;
@@ -102,7 +104,8 @@ class OGROAPIFDataset final : public GDALDataset
 
     bool Download(const CPLString &osURL, const char *pszAccept,
                   CPLString &osResult, CPLString &osContentType,
-                  CPLStringList *paosHeaders = nullptr);
+                  CPLStringList *paosHeaders = nullptr,
+                  const char *pszPersistentSession = nullptr);
 
     bool DownloadJSon(const CPLString &osURL, CPLJSONDocument &oDoc,
                       const char *pszAccept = MEDIA_TYPE_GEOJSON
@@ -137,6 +140,27 @@ class OGROAPIFDataset final : public GDALDataset
     CPLString ReinjectAuthInURL(const CPLString &osURL) const;
 };
 
+/************************************************************************/
+/*                       OGROAPIFPrefetchedPage                         */
+/************************************************************************/
+
+// Page of items downloaded in a background thread
+struct OGROAPIFPrefetchedPage
+{
+    CPLString osURL{};
+    bool bOK = false;
+    CPLString osResult{};
+    CPLString osContentType{};
+    CPLStringList aosHeaders{};
+    std::thread oThread{};
+
+    ~OGROAPIFPrefetchedPage()
+    {
+        if (oThread.joinable())
+            oThread.join();
+    }
+};
+
 /************************************************************************/
 /*                            OGROAPIFLayer                              */
 /************************************************************************/
@@ -181,8 +205,11 @@ class OGROAPIFLayer final : public OGRLayer
     std::vector<std::string> m_aosItemAssetNames{};  // STAC specific
     CPLJSONDocument m_oCurDoc{};
     int m_iFeatureInPage = 0;
+    std::unique_ptr<OGROAPIFPrefetchedPage> m_poPrefetchedPage{};
+    bool m_bMustCleanPrefetchPersistent = false;
 
     void EstablishFeatureDefn();
+    void PrefetchPage(const CPLString &osURL);
     OGRFeature *GetNextRawFeature();
     CPLString AddFilters(const CPLString &osURL);
     CPLString BuildFilter(const swq_expr_node *poNode);
@@ -328,7 +355,8 @@ CPLString OGROAPIFDataset::ReinjectAuthInURL(const CPLString &osURL) const
 
 bool OGROAPIFDataset::Download(const CPLString &osURL, const char *pszAccept,
                                CPLString &osResult, CPLString &osContentType,
-                               CPLStringList *paosHeaders)
+                               CPLStringList *paosHeaders,
+                               const char *pszPersistentSession)
 {
 #ifndef REMOVE_HACK
     VSIStatBufL sStatBuf;
@@ -358,9 +386,17 @@ bool OGROAPIFDataset::Download(const CPLString &osURL, const char *pszAccept,
         papszOptions =
             CSLSetNameValue(papszOptions, "USERPWD", m_osUserPwd.c_str());
     }
-    m_bMustCleanPersistent = true;
-    papszOptions =
-        CSLAddString(papszOptions, CPLSPrintf("PERSISTENT=OAPIF:%p", this));
+    if (pszPersistentSession)
+    {
+        papszOptions =
+            CSLSetNameValue(papszOptions, "PERSISTENT", pszPersistentSession);
+    }
+    else
+    {
+        m_bMustCleanPersistent = true;
+        papszOptions = CSLAddString(papszOptions,
+                                    CPLSPrintf("PERSISTENT=OAPIF:%p", this));
+    }
     CPLString osURLWithQueryParameters(osURL);
     if (!m_osUserQueryParams.empty() &&
         osURL.find('?' + m_osUserQueryParams) == std::string::npos &&
@@ -1094,6 +1130,9 @@ bool OGROAPIFDataset::Open(GDALOpenInfo *poOpenInfo)
         m_bPageSizeSetFromOpenOptions = true;
     }
 
+    m_bPrefetchNextPage = CPLTestBool(CSLFetchNameValueDef(
+        poOpenInfo->papszOpenOptions, "PREFETCH_NEXT_PAGE", "NO"));
+
     const int initialRequestPageSize = atoi(CSLFetchNameValueDef(
         poOpenInfo->papszOpenOptions, "INITIAL_REQUEST_PAGE_SIZE", "-1"));
 
@@ -1371,6 +1410,15 @@ OGROAPIFLayer::OGROAPIFLayer(OGROAPIFDataset *poDS, const CPLString &osName,
 
 OGROAPIFLayer::~OGROAPIFLayer()
 {
+    m_poPrefetchedPage.reset();
+    if (m_bMustCleanPrefetchPersistent)
+    {
+        char **papszOptions =
+            CSLSetNameValue(nullptr, "CLOSE_PERSISTENT",
+                            CPLSPrintf("OAPIF_PREFETCH:%p", this));
+        CPLHTTPDestroyResult(CPLHTTPFetch(m_osURL, papszOptions));
+        CSLDestroy(papszOptions);
+    }
     m_poFeatureDefn->Release();
 }
 
@@ -1900,6 +1948,7 @@ void OGROAPIFLayer::EstablishFeatureDefn()
 
 void OGROAPIFLayer::ResetReading()
 {
+    m_poPrefetchedPage.reset();
     m_poUnderlyingDS.reset();
     m_poUnderlyingLayer = nullptr;
     m_nFID = 1;
@@ -1976,6 +2025,33 @@ CPLString OGROAPIFLayer::AddFilters(const CPLString &osURL)
     return osURLNew;
 }
 
+/************************************************************************/
+/*                           PrefetchPage()                             */
+/************************************************************************/
+
+/** Start downloading osURL in a background thread, so that the download of
+ * the next page overlaps with the consumption of the current one. */
+void OGROAPIFLayer::PrefetchPage(const CPLString &osURL)
+{
+    m_poPrefetchedPage = std::make_unique<OGROAPIFPrefetchedPage>();
+    m_poPrefetchedPage->osURL = osURL;
+    m_bMustCleanPrefetchPersistent = true;
+    const CPLString osSession(CPLSPrintf("OAPIF_PREFETCH:%p", this));
+    OGROAPIFDataset *poDS = m_poDS;
+    OGROAPIFPrefetchedPage *poPage = m_poPrefetchedPage.get();
+    poPage->oThread = std::thread(
+        [poDS, poPage, osSession]()
+        {
+            // Errors are reported when the page is consumed, by downloading
+            // it again from the main thread.
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            poPage->bOK = poDS->Download(
+                poPage->osURL, MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON,
+                poPage->osResult, poPage->osContentType, &poPage->aosHeaders,
+                osSession.c_str());
+        });
+}
+
 /************************************************************************/
 /*                         GetNextRawFeature()                          */
 /************************************************************************/
@@ -1998,7 +2074,22 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
             CPLString osURL(m_osGetURL);
             m_osGetURL.clear();
             CPLStringList aosHeaders;
-            if (!m_poDS->DownloadJSon(osURL, m_oCurDoc,
+            bool bDownloaded = false;
+            if (m_poPrefetchedPage && m_poPrefetchedPage->osURL == osURL)
+            {
+                m_poPrefetchedPage->oThread.join();
+                if (m_poPrefetchedPage->bOK &&
+                    m_oCurDoc.LoadMemory(m_poPrefetchedPage->osResult))
+                {
+                    aosHeaders = std::move(m_poPrefetchedPage->aosHeaders);
+                    bDownloaded = true;
+                }
+            }
+            // In case of failure of the prefetching, download again to get
+            // errors reported.
+            m_poPrefetchedPage.reset();
+            if (!bDownloaded &&
+                !m_poDS->DownloadJSon(osURL, m_oCurDoc,
                                       MEDIA_TYPE_GEOJSON ", " MEDIA_TYPE_JSON,
                                       &aosHeaders))
             {
@@ -2152,6 +2243,8 @@ OGRFeature *OGROAPIFLayer::GetNextRawFeature()
                 if (!m_osGetURL.empty())
                 {
                     m_osGetURL = m_poDS->ReinjectAuthInURL(m_osGetURL);
+                    if (m_poDS->m_bPrefetchNextPage)
+                        PrefetchPage(m_osGetURL);
                 }
             }
         }
@@ -3173,6 +3266,9 @@ void RegisterOGROAPIF()
         "  <Option name='INITIAL_REQUEST_PAGE_SIZE' type='int' "
         "description='Maximum number of features to retrieve in the initial "
         "request issued to determine the schema from a feature sample'/>"
+        "  <Option name='PREFETCH_NEXT_PAGE' type='boolean' "
+        "description='Whether the next page of items should be downloaded in "
+        "a background thread while the current one is read' default='NO'/>"
         "  <Option name='USERPWD' type='string' "
         "description='Basic authentication as username:password'/>"
         "  <Option name='IGNORE_SCHEMA' type='boolean' "
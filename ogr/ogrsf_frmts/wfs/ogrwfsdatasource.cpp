@@ -2170,6 +2170,23 @@ CPLString WFS_DecodeURL(const CPLString &osSrc)
     return ret;
 }
 
+/************************************************************************/
+/*                        GetHTTPFetchOptions()                         */
+/************************************************************************/
+
+/** Return the options passed to CPLHTTPFetch() by HTTPFetch() */
+CPLStringList
+OGRWFSDataSource::GetHTTPFetchOptions(CSLConstList papszOptions) const
+{
+    CPLStringList aosOptions(papszOptions);
+    if (bUseHttp10)
+        aosOptions.AddNameValue("HTTP_VERSION", "1.0");
+    if (papszHttpOptions)
+        aosOptions.Assign(CSLMerge(aosOptions.StealList(), papszHttpOptions),
+                          true);
+    return aosOptions;
+}
+
 /************************************************************************/
 /*                            HTTPFetch()                               */
 /************************************************************************/
@@ -2177,14 +2194,8 @@ CPLString WFS_DecodeURL(const CPLString &osSrc)
 CPLHTTPResult *OGRWFSDataSource::HTTPFetch(const char *pszURL,
                                            char **papszOptions)
 {
-    char **papszNewOptions = CSLDuplicate(papszOptions);
-    if (bUseHttp10)
-        papszNewOptions =
-            CSLAddNameValue(papszNewOptions, "HTTP_VERSION", "1.0");
-    if (papszHttpOptions)
-        papszNewOptions = CSLMerge(papszNewOptions, papszHttpOptions);
-    CPLHTTPResult *psResult = CPLHTTPFetch(pszURL, papszNewOptions);
-    CSLDestroy(papszNewOptions);
+    CPLHTTPResult *psResult =
+        CPLHTTPFetch(pszURL, GetHTTPFetchOptions(papszOptions).List());
 
     if (psResult == nullptr)
     {
@@ -2393,6 +2404,7 @@ OGRLayer *OGRWFSDataSource::ExecuteSQL(const char *pszSQLCommand,
             (iLayer = GetLayerIndex(psSelectInfo->table_defs[0].table_name)) >=
                 0 &&
             psSelectInfo->join_count == 0 && psSelectInfo->order_specs > 0 &&
+            psSelectInfo->group_by_defs.empty() &&
             psSelectInfo->poOtherSelect == nullptr)
         {
             OGRWFSLayer *poSrcLayer = papoLayers[iLayer];
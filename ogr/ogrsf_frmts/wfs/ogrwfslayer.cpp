@@ -33,6 +33,43 @@
 #include "cpl_http.h"
 #include "parsexsd.h"
 
+#include <atomic>
+#include <thread>
+
+/************************************************************************/
+/*                        OGRWFSPrefetchedPage                          */
+/************************************************************************/
+
+struct OGRWFSPrefetchedPage
+{
+    CPLString osURL{};
+    CPLHTTPResult *psResult = nullptr;
+    std::atomic<bool> bStop{false};
+    std::thread oThread{};
+
+    ~OGRWFSPrefetchedPage()
+    {
+        bStop = true;
+        if (oThread.joinable())
+            oThread.join();
+        CPLHTTPDestroyResult(psResult);
+    }
+
+    static int Progress(double, const char *, void *pData)
+    {
+        return !static_cast<OGRWFSPrefetchedPage *>(pData)->bStop;
+    }
+
+    void Fetch(const CPLStringList &aosOptions)
+    {
+        // Errors are reported when the page is consumed, by fetching it
+        // again from the main thread.
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        psResult = CPLHTTPFetchEx(osURL, aosOptions.List(), Progress, this,
+                                  nullptr, nullptr);
+    }
+};
+
 /************************************************************************/
 /*                      OGRWFSRecursiveUnlink()                         */
 /************************************************************************/
@@ -144,6 +181,7 @@ OGRWFSLayer::~OGRWFSLayer()
     CPLFree(pszNS);
     CPLFree(pszNSVal);
 
+    CancelPrefetchedPages();
     GDALClose(poBaseDS);
 
     delete poFetchedFilterGeom;
@@ -750,6 +788,103 @@ bool OGRWFSLayer::MustRetryIfNonCompliantServer(const char *pszServerAnswer)
     return bRetry;
 }
 
+/************************************************************************/
+/*                         PrefetchNextPages()                          */
+/************************************************************************/
+
+/** Start downloading in background threads the nPageCount pages that follow
+ * the current one (at nPagingStartIndex), if not already done. */
+void OGRWFSLayer::PrefetchNextPages(int nPageCount)
+{
+    const int nPageSize = poDS->GetPageSize();
+    const int nCurStartIndex = nPagingStartIndex;
+    const CPLStringList aosOptions(poDS->GetHTTPFetchOptions(nullptr));
+    for (int i = 1; i <= nPageCount; ++i)
+    {
+        if (nPageSize > INT_MAX / i || nCurStartIndex > INT_MAX - i * nPageSize)
+            break;
+        const int nStartIndex = nCurStartIndex + i * nPageSize;
+        if (m_nNumberMatched >= 0 && nStartIndex >= m_nNumberMatched)
+            break;
+        nPagingStartIndex = nStartIndex;
+        const CPLString osURL = MakeGetFeatureURL(0, FALSE);
+        bool bAlreadyQueued = false;
+        for (const auto &poPage : m_apoPrefetchedPages)
+        {
+            if (poPage->osURL == osURL)
+            {
+                bAlreadyQueued = true;
+                break;
+            }
+        }
+        if (bAlreadyQueued)
+            continue;
+
+        CPLDebug("WFS", "Prefetching %s", osURL.c_str());
+        auto poPage = std::make_unique<OGRWFSPrefetchedPage>();
+        poPage->osURL = osURL;
+        poPage->oThread = std::thread(&OGRWFSPrefetchedPage::Fetch,
+                                      poPage.get(), aosOptions);
+        m_apoPrefetchedPages.push_back(std::move(poPage));
+    }
+    nPagingStartIndex = nCurStartIndex;
+}
+
+/************************************************************************/
+/*                        TakePrefetchedPage()                          */
+/************************************************************************/
+
+/** Return the result of a prefetched download of osURL, or nullptr if
+ * it was not prefetched, or if its download failed.
+ */
+CPLHTTPResult *OGRWFSLayer::TakePrefetchedPage(const CPLString &osURL)
+{
+    if (m_apoPrefetchedPages.empty())
+        return nullptr;
+
+    size_t i = 0;
+    while (i < m_apoPrefetchedPages.size() &&
+           m_apoPrefetchedPages[i]->osURL != osURL)
+    {
+        ++i;
+    }
+    if (i == m_apoPrefetchedPages.size())
+    {
+        // The server did not return full pages, or the request changed:
+        // our guesses of the next URLs are wrong.
+        CPLDebug("WFS", "Prefetched pages do not match requested page. "
+                        "Disabling prefetching");
+        m_bPagingPrefetchDisabled = true;
+        CancelPrefetchedPages();
+        return nullptr;
+    }
+
+    auto poPage = std::move(m_apoPrefetchedPages[i]);
+    m_apoPrefetchedPages.erase(m_apoPrefetchedPages.begin(),
+                               m_apoPrefetchedPages.begin() + i + 1);
+    poPage->oThread.join();
+    CPLHTTPResult *psResult = poPage->psResult;
+    if (psResult == nullptr || psResult->nStatus != 0 ||
+        psResult->pszErrBuf != nullptr || psResult->pabyData == nullptr)
+    {
+        // Let the caller fetch it again, with proper error reporting
+        return nullptr;
+    }
+    poPage->psResult = nullptr;
+    return psResult;
+}
+
+/************************************************************************/
+/*                       CancelPrefetchedPages()                        */
+/************************************************************************/
+
+void OGRWFSLayer::CancelPrefetchedPages()
+{
+    for (auto &poPage : m_apoPrefetchedPages)
+        poPage->bStop = true;
+    m_apoPrefetchedPages.clear();
+}
+
 /************************************************************************/
 /*                         FetchGetFeature()                            */
 /************************************************************************/
@@ -764,6 +899,14 @@ GDALDataset *OGRWFSLayer::FetchGetFeature(int nRequestMaxFeatures)
 
     CPLString osOutputFormat = CPLURLGetValue(osURL, "OUTPUTFORMAT");
 
+    // Number of pages downloaded ahead in background threads, while the
+    // current one is parsed.
+    const int nPrefetchPages =
+        bPagingActive && !m_bPagingPrefetchDisabled
+            ? std::min(
+                  atoi(CPLGetConfigOption("OGR_WFS_PAGING_PREFETCH", "0")), 16)
+            : 0;
+
     const auto ReadNumberMatched = [this](const char *pszData)
     {
         const char *pszNumberMatched = strstr(pszData, " numberMatched=\"");
@@ -784,7 +927,9 @@ GDALDataset *OGRWFSLayer::FetchGetFeature(int nRequestMaxFeatures)
         }
     };
 
-    if (CPLTestBool(CPLGetConfigOption("OGR_WFS_USE_STREAMING", "YES")))
+    // Prefetching requires page content to be fully downloaded
+    if (nPrefetchPages <= 0 &&
+        CPLTestBool(CPLGetConfigOption("OGR_WFS_USE_STREAMING", "YES")))
     {
         CPLString osStreamingName;
         if (STARTS_WITH(osURL, "/vsimem/") &&
@@ -910,7 +1055,9 @@ GDALDataset *OGRWFSLayer::FetchGetFeature(int nRequestMaxFeatures)
     }
 
     bStreamingDS = false;
-    psResult = poDS->HTTPFetch(osURL, nullptr);
+    psResult = TakePrefetchedPage(osURL);
+    if (psResult == nullptr)
+        psResult = poDS->HTTPFetch(osURL, nullptr);
     if (psResult == nullptr)
     {
         return nullptr;
@@ -1031,6 +1178,9 @@ GDALDataset *OGRWFSLayer::FetchGetFeature(int nRequestMaxFeatures)
     if (m_nNumberMatched < 0)
         ReadNumberMatched(pszData);
 
+    if (nPrefetchPages > 0)
+        PrefetchNextPages(nPrefetchPages);
+
     CPLString osTmpFileName;
 
     if (!bIsMultiPart)
@@ -1264,6 +1414,7 @@ void OGRWFSLayer::ResetReading()
         return;
     if (bPagingActive)
         bReloadNeeded = true;
+    CancelPrefetchedPages();
     nPagingStartIndex = 0;
     nFeatureRead = 0;
     m_nNumberMatched = -1;
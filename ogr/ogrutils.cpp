@@ -40,8 +40,9 @@
 #include <cstring>
 #include <cctype>
 #include <limits>
-#include <sstream>
-#include <iomanip>
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -70,21 +71,20 @@ namespace
 {
 
 // Remove trailing zeros except the last one.
-std::string removeTrailingZeros(std::string s)
+void removeTrailingZeros(std::string &s)
 {
     auto pos = s.find('.');
     if (pos == std::string::npos)
-        return s;
+        return;
 
     // Remove zeros at the end.  We know this won't be npos because we
     // have a decimal point.
     auto nzpos = s.find_last_not_of('0');
-    s = s.substr(0, nzpos + 1);
+    s.resize(nzpos + 1);
 
     // Make sure there is one 0 after the decimal point.
     if (s.back() == '.')
         s += '0';
-    return s;
 }
 
 // Round a string representing a number by 1 in the least significant digit.
@@ -194,6 +194,71 @@ std::string intelliround(std::string &s)
 
 }  // unnamed namespace
 
+/************************************************************************/
+/*                      OGRFormatDoublePrecision()                      */
+/************************************************************************/
+
+/** Format a double value with a given precision.
+ *
+ * This is equivalent to CPLsnprintf(pszBuffer, nBufferLen, "%.*f",
+ * nPrecision, dfVal) (or with the 'e', 'E', 'g' or 'G' conversion specifier)
+ * and produces the exact same output, but uses std::to_chars() when the
+ * standard library provides it for floating-point types, which is much
+ * faster than printf() style formatting. This is meant for text writers that
+ * format large amounts of coordinates.
+ *
+ * @param pszBuffer Output buffer.
+ * @param nBufferLen Size of pszBuffer, including the nul terminating byte.
+ * @param dfVal Value to format.
+ * @param nPrecision Precision. If negative, 6 is used, as in printf().
+ * @param chConversionSpecifier One of 'f', 'e', 'E', 'g' or 'G'.
+ * @return the number of characters written (excluding the nul terminating
+ * byte), or, in case of truncation, the number of characters that would have
+ * been written, as snprintf().
+ */
+int OGRFormatDoublePrecision(char *pszBuffer, size_t nBufferLen, double dfVal,
+                             int nPrecision, char chConversionSpecifier)
+{
+    if (nPrecision < 0)
+        nPrecision = 6;
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    // std::to_chars() does not write the nul terminating byte, and
+    // formats non-finite values differently from CPLsnprintf()
+    if (nBufferLen > 0 && std::isfinite(dfVal))
+    {
+        const auto eFormat =
+            chConversionSpecifier == 'f' ? std::chars_format::fixed
+            : (chConversionSpecifier == 'e' || chConversionSpecifier == 'E')
+                ? std::chars_format::scientific
+                : std::chars_format::general;
+        const auto sRes = std::to_chars(pszBuffer, pszBuffer + nBufferLen - 1,
+                                        dfVal, eFormat, nPrecision);
+        if (sRes.ec == std::errc())
+        {
+            *sRes.ptr = 0;
+            if (chConversionSpecifier == 'E' || chConversionSpecifier == 'G')
+            {
+                for (char *pszIter = pszBuffer; pszIter != sRes.ptr; ++pszIter)
+                {
+                    if (*pszIter == 'e')
+                    {
+                        *pszIter = 'E';
+                        break;
+                    }
+                }
+            }
+            return static_cast<int>(sRes.ptr - pszBuffer);
+        }
+    }
+#endif
+
+    char szFormatting[32];
+    snprintf(szFormatting, sizeof(szFormatting), "%%.%d%c", nPrecision,
+             chConversionSpecifier);
+    return CPLsnprintf(pszBuffer, nBufferLen, szFormatting, dfVal);
+}
+
 /************************************************************************/
 /*                        OGRFormatDouble()                             */
 /************************************************************************/
@@ -239,28 +304,38 @@ std::string OGRFormatDouble(double val, const OGRWktOptions &opts, int nDimIdx)
     if (std::isnan(val))
         return "nan";
 
-    std::ostringstream oss;
-    oss.imbue(std::locale::classic());  // Make sure we output decimal points.
-    bool l_round(opts.round);
-    if (opts.format == OGRWktFormat::F ||
-        (opts.format == OGRWktFormat::Default && fabs(val) < 1))
-        oss << std::fixed;
-    else
+    const bool bFixed =
+        opts.format == OGRWktFormat::F ||
+        (opts.format == OGRWktFormat::Default && fabs(val) < 1);
+    const bool l_round = bFixed && opts.round;
+    // Uppercase because OGC spec says capital 'E'.
+    const char chConversionSpecifier = bFixed ? 'f' : 'G';
+    const int nPrecision = nDimIdx < 3    ? opts.xyPrecision
+                           : nDimIdx == 3 ? opts.zPrecision
+                                          : opts.mPrecision;
+
+    // Large enough for any %.*f formatting of a double up to 1e50 with the
+    // default precision. Otherwise, fall back to a heap allocated buffer.
+    char szBuffer[96];
+    int nLen = OGRFormatDoublePrecision(szBuffer, sizeof(szBuffer), val,
+                                        nPrecision, chConversionSpecifier);
+    std::string sval;
+    if (nLen >= 0 && nLen < static_cast<int>(sizeof(szBuffer)))
     {
-        // Uppercase because OGC spec says capital 'E'.
-        oss << std::uppercase;
-        l_round = false;
+        sval.assign(szBuffer, nLen);
+    }
+    else if (nLen > 0)
+    {
+        sval.resize(nLen + 1);
+        nLen = OGRFormatDoublePrecision(&sval[0], sval.size(), val,
+                                        nPrecision, chConversionSpecifier);
+        sval.resize(nLen);
     }
-    oss << std::setprecision(nDimIdx < 3    ? opts.xyPrecision
-                             : nDimIdx == 3 ? opts.zPrecision
-                                            : opts.mPrecision);
-    oss << val;
-
-    std::string sval = oss.str();
 
     if (l_round)
         sval = intelliround(sval);
-    return removeTrailingZeros(std::move(sval));
+    removeTrailingZeros(sval);
+    return sval;
 }
 
 /************************************************************************/
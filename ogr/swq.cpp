@@ -269,6 +269,8 @@ int swqlex(YYSTYPE *ppNode, swq_parse_context *context)
             nReturn = SWQT_ORDER;
         else if (EQUAL(osToken, "BY"))
             nReturn = SWQT_BY;
+        else if (EQUAL(osToken, "GROUP"))
+            nReturn = SWQT_GROUP;
         else if (EQUAL(osToken, "FROM"))
             nReturn = SWQT_FROM;
         else if (EQUAL(osToken, "AS"))
@@ -314,88 +316,61 @@ int swqlex(YYSTYPE *ppNode, swq_parse_context *context)
 }
 
 /************************************************************************/
-/*                        swq_select_summarize()                        */
+/*                         swq_init_summaries()                         */
 /************************************************************************/
 
-const char *swq_select_summarize(swq_select *select_info, int dest_column,
-                                 const char *value)
-
+static void swq_init_summaries(const swq_select *select_info,
+                               std::vector<swq_summary> &summaries,
+                               bool bDistinct)
 {
-    /* -------------------------------------------------------------------- */
-    /*      Do various checking.                                            */
-    /* -------------------------------------------------------------------- */
-    if (select_info->query_mode == SWQM_RECORDSET)
-        return "swq_select_summarize() called on non-summary query.";
-
-    if (dest_column < 0 ||
-        dest_column >= static_cast<int>(select_info->column_defs.size()))
-        return "dest_column out of range in swq_select_summarize().";
-
-    swq_col_def *def = &select_info->column_defs[dest_column];
-    if (def->col_func == SWQCF_NONE && !def->distinct_flag)
-        return nullptr;
-
-    if (select_info->query_mode == SWQM_DISTINCT_LIST &&
-        select_info->order_specs > 0)
-    {
-        if (select_info->order_specs > 1)
-            return "Can't ORDER BY a DISTINCT list by more than one key.";
-
-        if (select_info->order_defs[0].field_index !=
-            select_info->column_defs[0].field_index)
-            return "Only selected DISTINCT field can be used for ORDER BY.";
-    }
-
-    /* -------------------------------------------------------------------- */
-    /*      Create the summary information if this is the first row         */
-    /*      being processed.                                                */
-    /* -------------------------------------------------------------------- */
-    if (select_info->column_summary.empty())
+    summaries.resize(select_info->column_defs.size());
+    for (std::size_t i = 0; i < select_info->column_defs.size(); i++)
     {
-        select_info->column_summary.resize(select_info->column_defs.size());
-        for (std::size_t i = 0; i < select_info->column_defs.size(); i++)
+        if (bDistinct || select_info->column_defs[i].distinct_flag)
         {
-            if (def->distinct_flag)
+            swq_summary::Comparator oComparator;
+            if (select_info->query_mode != SWQM_GROUP_BY &&
+                select_info->order_specs > 0)
             {
-                swq_summary::Comparator oComparator;
-                if (select_info->order_specs > 0)
-                {
-                    CPLAssert(select_info->order_specs == 1);
-                    CPLAssert(select_info->column_defs.size() == 1);
-                    oComparator.bSortAsc =
-                        CPL_TO_BOOL(select_info->order_defs[0].ascending_flag);
-                }
-                if (select_info->column_defs[i].field_type == SWQ_INTEGER ||
-                    -select_info->column_defs[i].field_type == SWQ_INTEGER64)
-                {
-                    oComparator.eType = SWQ_INTEGER64;
-                }
-                else if (select_info->column_defs[i].field_type == SWQ_FLOAT)
-                {
-                    oComparator.eType = SWQ_FLOAT;
-                }
-                else
-                {
-                    oComparator.eType = SWQ_STRING;
-                }
-                select_info->column_summary[i].oSetDistinctValues =
-                    std::set<CPLString, swq_summary::Comparator>(oComparator);
+                CPLAssert(select_info->order_specs == 1);
+                CPLAssert(select_info->column_defs.size() == 1);
+                oComparator.bSortAsc =
+                    CPL_TO_BOOL(select_info->order_defs[0].ascending_flag);
+            }
+            if (select_info->column_defs[i].field_type == SWQ_INTEGER ||
+                -select_info->column_defs[i].field_type == SWQ_INTEGER64)
+            {
+                oComparator.eType = SWQ_INTEGER64;
+            }
+            else if (select_info->column_defs[i].field_type == SWQ_FLOAT)
+            {
+                oComparator.eType = SWQ_FLOAT;
             }
-            select_info->column_summary[i].min =
-                std::numeric_limits<double>::infinity();
-            select_info->column_summary[i].max =
-                -std::numeric_limits<double>::infinity();
-            select_info->column_summary[i].osMin = "9999/99/99 99:99:99";
-            select_info->column_summary[i].osMax = "0000/00/00 00:00:00";
+            else
+            {
+                oComparator.eType = SWQ_STRING;
+            }
+            summaries[i].oSetDistinctValues =
+                std::set<CPLString, swq_summary::Comparator>(oComparator);
         }
-        assert(!select_info->column_summary.empty());
+        summaries[i].min = std::numeric_limits<double>::infinity();
+        summaries[i].max = -std::numeric_limits<double>::infinity();
+        summaries[i].osMin = "9999/99/99 99:99:99";
+        summaries[i].osMax = "0000/00/00 00:00:00";
     }
+}
+
+/************************************************************************/
+/*                           swq_summarize()                            */
+/************************************************************************/
 
+static const char *swq_summarize(const swq_select *select_info,
+                                 const swq_col_def *def, swq_summary &summary,
+                                 const char *value)
+{
     /* -------------------------------------------------------------------- */
     /*      If distinct processing is on, process that now.                 */
     /* -------------------------------------------------------------------- */
-    swq_summary &summary = select_info->column_summary[dest_column];
-
     if (def->distinct_flag)
     {
         if (value == nullptr)
@@ -406,7 +381,8 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
                 summary.oSetDistinctValues.end())
             {
                 summary.oSetDistinctValues.insert(value);
-                if (select_info->order_specs == 0)
+                if (select_info->order_specs == 0 &&
+                    select_info->query_mode != SWQM_GROUP_BY)
                 {
                     // If not sorted, keep values in their original order
                     summary.oVectorDistinctValues.emplace_back(value);
@@ -523,6 +499,79 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
     return nullptr;
 }
 
+/************************************************************************/
+/*                        swq_select_summarize()                        */
+/************************************************************************/
+
+const char *swq_select_summarize(swq_select *select_info, int dest_column,
+                                 const char *value)
+
+{
+    /* -------------------------------------------------------------------- */
+    /*      Do various checking.                                            */
+    /* -------------------------------------------------------------------- */
+    if (select_info->query_mode == SWQM_RECORDSET)
+        return "swq_select_summarize() called on non-summary query.";
+
+    if (dest_column < 0 ||
+        dest_column >= static_cast<int>(select_info->column_defs.size()))
+        return "dest_column out of range in swq_select_summarize().";
+
+    swq_col_def *def = &select_info->column_defs[dest_column];
+    if (def->col_func == SWQCF_NONE && !def->distinct_flag)
+        return nullptr;
+
+    if (select_info->query_mode == SWQM_DISTINCT_LIST &&
+        select_info->order_specs > 0)
+    {
+        if (select_info->order_specs > 1)
+            return "Can't ORDER BY a DISTINCT list by more than one key.";
+
+        if (select_info->order_defs[0].field_index !=
+            select_info->column_defs[0].field_index)
+            return "Only selected DISTINCT field can be used for ORDER BY.";
+    }
+
+    if (select_info->column_summary.empty())
+    {
+        swq_init_summaries(select_info, select_info->column_summary,
+                           CPL_TO_BOOL(def->distinct_flag));
+        assert(!select_info->column_summary.empty());
+    }
+
+    return swq_summarize(select_info, def,
+                         select_info->column_summary[dest_column], value);
+}
+
+/************************************************************************/
+/*                     swq_select_summarize_group()                     */
+/*                                                                      */
+/*      Same as swq_select_summarize(), but for the summaries of one of */
+/*      the groups of a GROUP BY query.                                 */
+/************************************************************************/
+
+const char *swq_select_summarize_group(swq_select *select_info,
+                                       std::vector<swq_summary> &group_summary,
+                                       int dest_column, const char *value)
+
+{
+    if (select_info->query_mode != SWQM_GROUP_BY)
+        return "swq_select_summarize_group() called on non GROUP BY query.";
+
+    if (dest_column < 0 ||
+        dest_column >= static_cast<int>(select_info->column_defs.size()))
+        return "dest_column out of range in swq_select_summarize_group().";
+
+    const swq_col_def *def = &select_info->column_defs[dest_column];
+    if (def->col_func == SWQCF_NONE)
+        return nullptr;
+
+    if (group_summary.empty())
+        swq_init_summaries(select_info, group_summary, false);
+
+    return swq_summarize(select_info, def, group_summary[dest_column], value);
+}
+
 /************************************************************************/
 /*                      sort comparison functions.                      */
 /************************************************************************/
@@ -937,7 +986,8 @@ CPLErr swq_expr_compile2(const char *where_clause, swq_field_list *field_list,
 static const char *const apszSQLReservedKeywords[] = {
     "OR",    "AND",      "NOT",    "LIKE",   "IS",   "NULL", "IN",    "BETWEEN",
     "CAST",  "DISTINCT", "ESCAPE", "SELECT", "LEFT", "JOIN", "WHERE", "ON",
-    "ORDER", "BY",       "FROM",   "AS",     "ASC",  "DESC", "UNION", "ALL"};
+    "ORDER", "BY",       "FROM",   "AS",     "ASC",  "DESC", "UNION", "ALL",
+    "GROUP"};
 
 int swq_is_reserved_keyword(const char *pszStr)
 {
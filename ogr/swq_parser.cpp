@@ -63,12 +63,13 @@
 /* Pull parsers.  */
 #define YYPULL 1
 
+
 /* Substitute the variable and function names.  */
-#define yyparse swqparse
-#define yylex swqlex
-#define yyerror swqerror
-#define yydebug swqdebug
-#define yynerrs swqnerrs
+#define yyparse         swqparse
+#define yylex           swqlex
+#define yyerror         swqerror
+#define yydebug         swqdebug
+#define yynerrs         swqnerrs
 
 /* First part of user prologue.  */
 
@@ -114,6 +115,7 @@
 #include "ogr_core.h"
 #include "ogr_geometry.h"
 
+
 #define YYSTYPE swq_expr_node *
 
 /* Defining YYSTYPE_IS_TRIVIAL is needed because the parser is generated as a C++ file. */
@@ -123,116 +125,123 @@
 /* it appears to be a non documented feature of Bison */
 #define YYSTYPE_IS_TRIVIAL 1
 
-#ifndef YY_CAST
-#ifdef __cplusplus
-#define YY_CAST(Type, Val) static_cast<Type>(Val)
-#define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type>(Val)
-#else
-#define YY_CAST(Type, Val) ((Type)(Val))
-#define YY_REINTERPRET_CAST(Type, Val) ((Type)(Val))
-#endif
-#endif
-#ifndef YY_NULLPTR
-#if defined __cplusplus
-#if 201103L <= __cplusplus
-#define YY_NULLPTR nullptr
-#else
-#define YY_NULLPTR 0
-#endif
-#else
-#define YY_NULLPTR ((void *)0)
-#endif
-#endif
 
-#include "swq_parser.hpp"
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
+#include "swq_parser.hpp"
 /* Symbol kind.  */
 enum yysymbol_kind_t
 {
-    YYSYMBOL_YYEMPTY = -2,
-    YYSYMBOL_YYEOF = 0,                   /* "end of string"  */
-    YYSYMBOL_YYerror = 1,                 /* error  */
-    YYSYMBOL_YYUNDEF = 2,                 /* "invalid token"  */
-    YYSYMBOL_SWQT_INTEGER_NUMBER = 3,     /* "integer number"  */
-    YYSYMBOL_SWQT_FLOAT_NUMBER = 4,       /* "floating point number"  */
-    YYSYMBOL_SWQT_STRING = 5,             /* "string"  */
-    YYSYMBOL_SWQT_IDENTIFIER = 6,         /* "identifier"  */
-    YYSYMBOL_SWQT_IN = 7,                 /* "IN"  */
-    YYSYMBOL_SWQT_LIKE = 8,               /* "LIKE"  */
-    YYSYMBOL_SWQT_ILIKE = 9,              /* "ILIKE"  */
-    YYSYMBOL_SWQT_ESCAPE = 10,            /* "ESCAPE"  */
-    YYSYMBOL_SWQT_BETWEEN = 11,           /* "BETWEEN"  */
-    YYSYMBOL_SWQT_NULL = 12,              /* "NULL"  */
-    YYSYMBOL_SWQT_IS = 13,                /* "IS"  */
-    YYSYMBOL_SWQT_SELECT = 14,            /* "SELECT"  */
-    YYSYMBOL_SWQT_LEFT = 15,              /* "LEFT"  */
-    YYSYMBOL_SWQT_JOIN = 16,              /* "JOIN"  */
-    YYSYMBOL_SWQT_WHERE = 17,             /* "WHERE"  */
-    YYSYMBOL_SWQT_ON = 18,                /* "ON"  */
-    YYSYMBOL_SWQT_ORDER = 19,             /* "ORDER"  */
-    YYSYMBOL_SWQT_BY = 20,                /* "BY"  */
-    YYSYMBOL_SWQT_FROM = 21,              /* "FROM"  */
-    YYSYMBOL_SWQT_AS = 22,                /* "AS"  */
-    YYSYMBOL_SWQT_ASC = 23,               /* "ASC"  */
-    YYSYMBOL_SWQT_DESC = 24,              /* "DESC"  */
-    YYSYMBOL_SWQT_DISTINCT = 25,          /* "DISTINCT"  */
-    YYSYMBOL_SWQT_CAST = 26,              /* "CAST"  */
-    YYSYMBOL_SWQT_UNION = 27,             /* "UNION"  */
-    YYSYMBOL_SWQT_ALL = 28,               /* "ALL"  */
-    YYSYMBOL_SWQT_LIMIT = 29,             /* "LIMIT"  */
-    YYSYMBOL_SWQT_OFFSET = 30,            /* "OFFSET"  */
-    YYSYMBOL_SWQT_EXCEPT = 31,            /* "EXCEPT"  */
-    YYSYMBOL_SWQT_EXCLUDE = 32,           /* "EXCLUDE"  */
-    YYSYMBOL_SWQT_VALUE_START = 33,       /* SWQT_VALUE_START  */
-    YYSYMBOL_SWQT_SELECT_START = 34,      /* SWQT_SELECT_START  */
-    YYSYMBOL_SWQT_NOT = 35,               /* "NOT"  */
-    YYSYMBOL_SWQT_OR = 36,                /* "OR"  */
-    YYSYMBOL_SWQT_AND = 37,               /* "AND"  */
-    YYSYMBOL_38_ = 38,                    /* '='  */
-    YYSYMBOL_39_ = 39,                    /* '<'  */
-    YYSYMBOL_40_ = 40,                    /* '>'  */
-    YYSYMBOL_41_ = 41,                    /* '!'  */
-    YYSYMBOL_42_ = 42,                    /* '+'  */
-    YYSYMBOL_43_ = 43,                    /* '-'  */
-    YYSYMBOL_44_ = 44,                    /* '*'  */
-    YYSYMBOL_45_ = 45,                    /* '/'  */
-    YYSYMBOL_46_ = 46,                    /* '%'  */
-    YYSYMBOL_SWQT_UMINUS = 47,            /* SWQT_UMINUS  */
-    YYSYMBOL_SWQT_RESERVED_KEYWORD = 48,  /* "reserved keyword"  */
-    YYSYMBOL_49_ = 49,                    /* '('  */
-    YYSYMBOL_50_ = 50,                    /* ')'  */
-    YYSYMBOL_51_ = 51,                    /* ','  */
-    YYSYMBOL_52_ = 52,                    /* '.'  */
-    YYSYMBOL_YYACCEPT = 53,               /* $accept  */
-    YYSYMBOL_input = 54,                  /* input  */
-    YYSYMBOL_value_expr = 55,             /* value_expr  */
-    YYSYMBOL_value_expr_list = 56,        /* value_expr_list  */
-    YYSYMBOL_field_value = 57,            /* field_value  */
-    YYSYMBOL_value_expr_non_logical = 58, /* value_expr_non_logical  */
-    YYSYMBOL_type_def = 59,               /* type_def  */
-    YYSYMBOL_select_statement = 60,       /* select_statement  */
-    YYSYMBOL_select_core = 61,            /* select_core  */
-    YYSYMBOL_opt_union_all = 62,          /* opt_union_all  */
-    YYSYMBOL_union_all = 63,              /* union_all  */
-    YYSYMBOL_select_field_list = 64,      /* select_field_list  */
-    YYSYMBOL_exclude_field = 65,          /* exclude_field  */
-    YYSYMBOL_exclude_field_list = 66,     /* exclude_field_list  */
-    YYSYMBOL_except_or_exclude = 67,      /* except_or_exclude  */
-    YYSYMBOL_column_spec = 68,            /* column_spec  */
-    YYSYMBOL_as_clause = 69,              /* as_clause  */
-    YYSYMBOL_opt_where = 70,              /* opt_where  */
-    YYSYMBOL_opt_joins = 71,              /* opt_joins  */
-    YYSYMBOL_opt_order_by = 72,           /* opt_order_by  */
-    YYSYMBOL_sort_spec_list = 73,         /* sort_spec_list  */
-    YYSYMBOL_sort_spec = 74,              /* sort_spec  */
-    YYSYMBOL_opt_limit = 75,              /* opt_limit  */
-    YYSYMBOL_opt_offset = 76,             /* opt_offset  */
-    YYSYMBOL_table_def = 77               /* table_def  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of string"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SWQT_INTEGER_NUMBER = 3,        /* "integer number"  */
+  YYSYMBOL_SWQT_FLOAT_NUMBER = 4,          /* "floating point number"  */
+  YYSYMBOL_SWQT_STRING = 5,                /* "string"  */
+  YYSYMBOL_SWQT_IDENTIFIER = 6,            /* "identifier"  */
+  YYSYMBOL_SWQT_IN = 7,                    /* "IN"  */
+  YYSYMBOL_SWQT_LIKE = 8,                  /* "LIKE"  */
+  YYSYMBOL_SWQT_ILIKE = 9,                 /* "ILIKE"  */
+  YYSYMBOL_SWQT_ESCAPE = 10,               /* "ESCAPE"  */
+  YYSYMBOL_SWQT_BETWEEN = 11,              /* "BETWEEN"  */
+  YYSYMBOL_SWQT_NULL = 12,                 /* "NULL"  */
+  YYSYMBOL_SWQT_IS = 13,                   /* "IS"  */
+  YYSYMBOL_SWQT_SELECT = 14,               /* "SELECT"  */
+  YYSYMBOL_SWQT_LEFT = 15,                 /* "LEFT"  */
+  YYSYMBOL_SWQT_JOIN = 16,                 /* "JOIN"  */
+  YYSYMBOL_SWQT_WHERE = 17,                /* "WHERE"  */
+  YYSYMBOL_SWQT_ON = 18,                   /* "ON"  */
+  YYSYMBOL_SWQT_ORDER = 19,                /* "ORDER"  */
+  YYSYMBOL_SWQT_BY = 20,                   /* "BY"  */
+  YYSYMBOL_SWQT_GROUP = 21,                /* "GROUP"  */
+  YYSYMBOL_SWQT_FROM = 22,                 /* "FROM"  */
+  YYSYMBOL_SWQT_AS = 23,                   /* "AS"  */
+  YYSYMBOL_SWQT_ASC = 24,                  /* "ASC"  */
+  YYSYMBOL_SWQT_DESC = 25,                 /* "DESC"  */
+  YYSYMBOL_SWQT_DISTINCT = 26,             /* "DISTINCT"  */
+  YYSYMBOL_SWQT_CAST = 27,                 /* "CAST"  */
+  YYSYMBOL_SWQT_UNION = 28,                /* "UNION"  */
+  YYSYMBOL_SWQT_ALL = 29,                  /* "ALL"  */
+  YYSYMBOL_SWQT_LIMIT = 30,                /* "LIMIT"  */
+  YYSYMBOL_SWQT_OFFSET = 31,               /* "OFFSET"  */
+  YYSYMBOL_SWQT_EXCEPT = 32,               /* "EXCEPT"  */
+  YYSYMBOL_SWQT_EXCLUDE = 33,              /* "EXCLUDE"  */
+  YYSYMBOL_SWQT_VALUE_START = 34,          /* SWQT_VALUE_START  */
+  YYSYMBOL_SWQT_SELECT_START = 35,         /* SWQT_SELECT_START  */
+  YYSYMBOL_SWQT_NOT = 36,                  /* "NOT"  */
+  YYSYMBOL_SWQT_OR = 37,                   /* "OR"  */
+  YYSYMBOL_SWQT_AND = 38,                  /* "AND"  */
+  YYSYMBOL_39_ = 39,                       /* '='  */
+  YYSYMBOL_40_ = 40,                       /* '<'  */
+  YYSYMBOL_41_ = 41,                       /* '>'  */
+  YYSYMBOL_42_ = 42,                       /* '!'  */
+  YYSYMBOL_43_ = 43,                       /* '+'  */
+  YYSYMBOL_44_ = 44,                       /* '-'  */
+  YYSYMBOL_45_ = 45,                       /* '*'  */
+  YYSYMBOL_46_ = 46,                       /* '/'  */
+  YYSYMBOL_47_ = 47,                       /* '%'  */
+  YYSYMBOL_SWQT_UMINUS = 48,               /* SWQT_UMINUS  */
+  YYSYMBOL_SWQT_RESERVED_KEYWORD = 49,     /* "reserved keyword"  */
+  YYSYMBOL_50_ = 50,                       /* '('  */
+  YYSYMBOL_51_ = 51,                       /* ')'  */
+  YYSYMBOL_52_ = 52,                       /* ','  */
+  YYSYMBOL_53_ = 53,                       /* '.'  */
+  YYSYMBOL_YYACCEPT = 54,                  /* $accept  */
+  YYSYMBOL_input = 55,                     /* input  */
+  YYSYMBOL_value_expr = 56,                /* value_expr  */
+  YYSYMBOL_value_expr_list = 57,           /* value_expr_list  */
+  YYSYMBOL_field_value = 58,               /* field_value  */
+  YYSYMBOL_value_expr_non_logical = 59,    /* value_expr_non_logical  */
+  YYSYMBOL_type_def = 60,                  /* type_def  */
+  YYSYMBOL_select_statement = 61,          /* select_statement  */
+  YYSYMBOL_select_core = 62,               /* select_core  */
+  YYSYMBOL_opt_union_all = 63,             /* opt_union_all  */
+  YYSYMBOL_union_all = 64,                 /* union_all  */
+  YYSYMBOL_select_field_list = 65,         /* select_field_list  */
+  YYSYMBOL_exclude_field = 66,             /* exclude_field  */
+  YYSYMBOL_exclude_field_list = 67,        /* exclude_field_list  */
+  YYSYMBOL_except_or_exclude = 68,         /* except_or_exclude  */
+  YYSYMBOL_column_spec = 69,               /* column_spec  */
+  YYSYMBOL_as_clause = 70,                 /* as_clause  */
+  YYSYMBOL_opt_where = 71,                 /* opt_where  */
+  YYSYMBOL_opt_joins = 72,                 /* opt_joins  */
+  YYSYMBOL_opt_group_by = 73,              /* opt_group_by  */
+  YYSYMBOL_group_by_list = 74,             /* group_by_list  */
+  YYSYMBOL_group_by_spec = 75,             /* group_by_spec  */
+  YYSYMBOL_opt_order_by = 76,              /* opt_order_by  */
+  YYSYMBOL_sort_spec_list = 77,            /* sort_spec_list  */
+  YYSYMBOL_sort_spec = 78,                 /* sort_spec  */
+  YYSYMBOL_opt_limit = 79,                 /* opt_limit  */
+  YYSYMBOL_opt_offset = 80,                /* opt_offset  */
+  YYSYMBOL_table_def = 81                  /* table_def  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
+
+
+
 #ifdef short
-#undef short
+# undef short
 #endif
 
 /* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
@@ -240,11 +249,11 @@ typedef enum yysymbol_kind_t yysymbol_kind_t;
    so that the code can choose integer types of a good width.  */
 
 #ifndef __PTRDIFF_MAX__
-#include <limits.h> /* INFRINGES ON USER NAME SPACE */
-#if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
-#include <stdint.h> /* INFRINGES ON USER NAME SPACE */
-#define YY_STDINT_H
-#endif
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
 /* Narrow types that promote to a signed type and that can represent a
@@ -274,16 +283,16 @@ typedef short yytype_int16;
    (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
    <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
 #ifdef __hpux
-#undef UINT_LEAST8_MAX
-#undef UINT_LEAST16_MAX
-#define UINT_LEAST8_MAX 255
-#define UINT_LEAST16_MAX 65535
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
 #if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST8_TYPE__ yytype_uint8;
-#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H &&                  \
-       UINT_LEAST8_MAX <= INT_MAX)
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
 typedef uint_least8_t yytype_uint8;
 #elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
 typedef unsigned char yytype_uint8;
@@ -293,8 +302,8 @@ typedef short yytype_uint8;
 
 #if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
 typedef __UINT_LEAST16_TYPE__ yytype_uint16;
-#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H &&                 \
-       UINT_LEAST16_MAX <= INT_MAX)
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
 typedef uint_least16_t yytype_uint16;
 #elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
 typedef unsigned short yytype_uint16;
@@ -303,40 +312,42 @@ typedef int yytype_uint16;
 #endif
 
 #ifndef YYPTRDIFF_T
-#if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
-#define YYPTRDIFF_T __PTRDIFF_TYPE__
-#define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
-#elif defined PTRDIFF_MAX
-#ifndef ptrdiff_t
-#include <stddef.h> /* INFRINGES ON USER NAME SPACE */
-#endif
-#define YYPTRDIFF_T ptrdiff_t
-#define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
-#else
-#define YYPTRDIFF_T long
-#define YYPTRDIFF_MAXIMUM LONG_MAX
-#endif
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
-#ifdef __SIZE_TYPE__
-#define YYSIZE_T __SIZE_TYPE__
-#elif defined size_t
-#define YYSIZE_T size_t
-#elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
-#include <stddef.h> /* INFRINGES ON USER NAME SPACE */
-#define YYSIZE_T size_t
-#else
-#define YYSIZE_T unsigned
-#endif
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
 #endif
 
-#define YYSIZE_MAXIMUM                                                         \
-    YY_CAST(YYPTRDIFF_T, (YYPTRDIFF_MAXIMUM < YY_CAST(YYSIZE_T, -1)            \
-                              ? YYPTRDIFF_MAXIMUM                              \
-                              : YY_CAST(YYSIZE_T, -1)))
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
-#define YYSIZEOF(X) YY_CAST(YYPTRDIFF_T, sizeof(X))
 
 /* Stored state numbers (used for stacks). */
 typedef yytype_uint8 yy_state_t;
@@ -345,592 +356,660 @@ typedef yytype_uint8 yy_state_t;
 typedef int yy_state_fast_t;
 
 #ifndef YY_
-#if defined YYENABLE_NLS && YYENABLE_NLS
-#if ENABLE_NLS
-#include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#define YY_(Msgid) dgettext("bison-runtime", Msgid)
-#endif
-#endif
-#ifndef YY_
-#define YY_(Msgid) Msgid
-#endif
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
 #endif
 
+
 #ifndef YY_ATTRIBUTE_PURE
-#if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
-#define YY_ATTRIBUTE_PURE __attribute__((__pure__))
-#else
-#define YY_ATTRIBUTE_PURE
-#endif
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-#if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
-#define YY_ATTRIBUTE_UNUSED __attribute__((__unused__))
-#else
-#define YY_ATTRIBUTE_UNUSED
-#endif
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
-#if !defined lint || defined __GNUC__
-#define YY_USE(E) ((void)(E))
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
 #else
-#define YY_USE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-#if defined __GNUC__ && !defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
-#if __GNUC__ * 100 + __GNUC_MINOR__ < 407
-#define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                                    \
-    _Pragma("GCC diagnostic push")                                             \
-        _Pragma("GCC diagnostic ignored \"-Wuninitialized\"")
-#else
-#define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                                    \
-    _Pragma("GCC diagnostic push")                                             \
-        _Pragma("GCC diagnostic ignored \"-Wuninitialized\"")                  \
-            _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-#endif
-#define YY_IGNORE_MAYBE_UNINITIALIZED_END _Pragma("GCC diagnostic pop")
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-#define YY_INITIAL_VALUE(Value) Value
+# define YY_INITIAL_VALUE(Value) Value
 #endif
 #ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-#define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-#define YY_IGNORE_MAYBE_UNINITIALIZED_END
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
 #endif
 #ifndef YY_INITIAL_VALUE
-#define YY_INITIAL_VALUE(Value) /* Nothing. */
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-#if defined __cplusplus && defined __GNUC__ && !defined __ICC && 6 <= __GNUC__
-#define YY_IGNORE_USELESS_CAST_BEGIN                                           \
-    _Pragma("GCC diagnostic push")                                             \
-        _Pragma("GCC diagnostic ignored \"-Wuseless-cast\"")
-#define YY_IGNORE_USELESS_CAST_END _Pragma("GCC diagnostic pop")
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
 #endif
 #ifndef YY_IGNORE_USELESS_CAST_BEGIN
-#define YY_IGNORE_USELESS_CAST_BEGIN
-#define YY_IGNORE_USELESS_CAST_END
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
 #endif
 
-#define YY_ASSERT(E) ((void)(0 && (E)))
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
 
 #if 1
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
-#ifdef YYSTACK_USE_ALLOCA
-#if YYSTACK_USE_ALLOCA
-#ifdef __GNUC__
-#define YYSTACK_ALLOC __builtin_alloca
-#elif defined __BUILTIN_VA_ARG_INCR
-#include <alloca.h> /* INFRINGES ON USER NAME SPACE */
-#elif defined _AIX
-#define YYSTACK_ALLOC __alloca
-#elif defined _MSC_VER
-#include <malloc.h> /* INFRINGES ON USER NAME SPACE */
-#define alloca _alloca
-#else
-#define YYSTACK_ALLOC alloca
-#if !defined _ALLOCA_H && !defined EXIT_SUCCESS
-#include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-/* Use EXIT_SUCCESS as a witness for stdlib.h.  */
-#ifndef EXIT_SUCCESS
-#define EXIT_SUCCESS 0
-#endif
-#endif
-#endif
-#endif
-#endif
-
-#ifdef YYSTACK_ALLOC
-/* Pacify GCC's 'empty if-body' warning.  */
-#define YYSTACK_FREE(Ptr)                                                      \
-    do                                                                         \
-    { /* empty */                                                              \
-        ;                                                                      \
-    } while (0)
-#ifndef YYSTACK_ALLOC_MAXIMUM
-/* The OS might guarantee only one guard page at the bottom of the stack,
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
        invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
        to allow for a few compiler-allocated temporary stack slots.  */
-#define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
-#endif
-#else
-#define YYSTACK_ALLOC YYMALLOC
-#define YYSTACK_FREE YYFREE
-#ifndef YYSTACK_ALLOC_MAXIMUM
-#define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
-#endif
-#if (defined __cplusplus && !defined EXIT_SUCCESS &&                           \
-     !((defined YYMALLOC || defined malloc) &&                                 \
-       (defined YYFREE || defined free)))
-#include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#ifndef EXIT_SUCCESS
-#define EXIT_SUCCESS 0
-#endif
-#endif
-#ifndef YYMALLOC
-#define YYMALLOC malloc
-#if !defined malloc && !defined EXIT_SUCCESS
-void *malloc(YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
-#endif
-#endif
-#ifndef YYFREE
-#define YYFREE free
-#if !defined free && !defined EXIT_SUCCESS
-void free(void *);      /* INFRINGES ON USER NAME SPACE */
-#endif
-#endif
-#endif
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
 #endif /* 1 */
 
-#if (!defined yyoverflow &&                                                    \
-     (!defined __cplusplus ||                                                  \
-      (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-    yy_state_t yyss_alloc;
-    YYSTYPE yyvs_alloc;
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-#define YYSTACK_GAP_MAXIMUM (YYSIZEOF(union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
-#define YYSTACK_BYTES(N)                                                       \
-    ((N) * (YYSIZEOF(yy_state_t) + YYSIZEOF(YYSTYPE)) + YYSTACK_GAP_MAXIMUM)
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
 
-#define YYCOPY_NEEDED 1
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-#define YYSTACK_RELOCATE(Stack_alloc, Stack)                                   \
-    do                                                                         \
-    {                                                                          \
-        YYPTRDIFF_T yynewbytes;                                                \
-        YYCOPY(&yyptr->Stack_alloc, Stack, yysize);                            \
-        Stack = &yyptr->Stack_alloc;                                           \
-        yynewbytes = yystacksize * YYSIZEOF(*Stack) + YYSTACK_GAP_MAXIMUM;     \
-        yyptr += yynewbytes / YYSIZEOF(*yyptr);                                \
-    } while (0)
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
 #if defined YYCOPY_NEEDED && YYCOPY_NEEDED
 /* Copy COUNT objects from SRC to DST.  The source and destination do
    not overlap.  */
-#ifndef YYCOPY
-#if defined __GNUC__ && 1 < __GNUC__
-#define YYCOPY(Dst, Src, Count)                                                \
-    __builtin_memcpy(Dst, Src, YY_CAST(YYSIZE_T, (Count)) * sizeof(*(Src)))
-#else
-#define YYCOPY(Dst, Src, Count)                                                \
-    do                                                                         \
-    {                                                                          \
-        YYPTRDIFF_T yyi;                                                       \
-        for (yyi = 0; yyi < (Count); yyi++)                                    \
-            (Dst)[yyi] = (Src)[yyi];                                           \
-    } while (0)
-#endif
-#endif
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL 20
+#define YYFINAL  20
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST 409
+#define YYLAST   418
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS 53
+#define YYNTOKENS  54
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS 25
+#define YYNNTS  28
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES 101
+#define YYNRULES  106
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES 211
+#define YYNSTATES  220
 
 /* YYMAXUTOK -- Last valid token kind.  */
-#define YYMAXUTOK 294
+#define YYMAXUTOK   295
+
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex, with out-of-bounds checking.  */
-#define YYTRANSLATE(YYX)                                                       \
-    (0 <= (YYX) && (YYX) <= YYMAXUTOK                                          \
-         ? YY_CAST(yysymbol_kind_t, yytranslate[YYX])                          \
-         : YYSYMBOL_YYUNDEF)
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
    as returned by yylex.  */
-static const yytype_int8 yytranslate[] = {
-    0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  41, 2,  2,  2,  46,
-    2,  2,  49, 50, 44, 42, 51, 43, 52, 45, 2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  39, 38, 40, 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
-    2,  2,  2,  2,  2,  2,  2,  2,  2,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10,
-    11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
-    30, 31, 32, 33, 34, 35, 36, 37, 47, 48};
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,    42,     2,     2,     2,    47,     2,     2,
+      50,    51,    45,    43,    52,    44,    53,    46,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      40,    39,    41,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    48,    49
+};
 
 #if YYDEBUG
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_int16 yyrline[] = {
-    0,   124, 124, 125, 131, 138, 143, 148, 153, 160, 168, 176, 184, 192, 200,
-    208, 216, 224, 232, 240, 252, 261, 274, 282, 294, 303, 316, 325, 338, 347,
-    360, 367, 379, 385, 392, 400, 413, 418, 423, 427, 432, 437, 442, 477, 484,
-    491, 498, 505, 512, 548, 556, 562, 569, 578, 596, 616, 617, 620, 625, 631,
-    632, 634, 642, 643, 646, 656, 657, 660, 661, 664, 673, 684, 699, 714, 735,
-    766, 801, 826, 855, 861, 863, 864, 869, 870, 876, 883, 884, 887, 888, 891,
-    897, 903, 910, 911, 918, 919, 927, 937, 948, 959, 972, 983};
+static const yytype_int16 yyrline[] =
+{
+       0,   125,   125,   126,   132,   139,   144,   149,   154,   161,
+     169,   177,   185,   193,   201,   209,   217,   225,   233,   241,
+     253,   262,   275,   283,   295,   304,   317,   326,   339,   348,
+     361,   368,   380,   386,   393,   401,   414,   419,   424,   428,
+     433,   438,   443,   478,   485,   492,   499,   506,   513,   549,
+     557,   563,   570,   579,   597,   617,   618,   621,   626,   632,
+     633,   635,   643,   644,   647,   657,   658,   661,   662,   665,
+     674,   685,   700,   715,   736,   767,   802,   827,   856,   862,
+     864,   865,   870,   871,   877,   884,   885,   888,   889,   892,
+     899,   900,   903,   904,   907,   913,   919,   926,   927,   934,
+     935,   943,   953,   964,   975,   988,   999
+};
 #endif
 
 /** Accessing symbol of state STATE.  */
-#define YY_ACCESSING_SYMBOL(State) YY_CAST(yysymbol_kind_t, yystos[State])
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
 #if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
-static const char *const yytname[] = {"\"end of string\"",
-                                      "error",
-                                      "\"invalid token\"",
-                                      "\"integer number\"",
-                                      "\"floating point number\"",
-                                      "\"string\"",
-                                      "\"identifier\"",
-                                      "\"IN\"",
-                                      "\"LIKE\"",
-                                      "\"ILIKE\"",
-                                      "\"ESCAPE\"",
-                                      "\"BETWEEN\"",
-                                      "\"NULL\"",
-                                      "\"IS\"",
-                                      "\"SELECT\"",
-                                      "\"LEFT\"",
-                                      "\"JOIN\"",
-                                      "\"WHERE\"",
-                                      "\"ON\"",
-                                      "\"ORDER\"",
-                                      "\"BY\"",
-                                      "\"FROM\"",
-                                      "\"AS\"",
-                                      "\"ASC\"",
-                                      "\"DESC\"",
-                                      "\"DISTINCT\"",
-                                      "\"CAST\"",
-                                      "\"UNION\"",
-                                      "\"ALL\"",
-                                      "\"LIMIT\"",
-                                      "\"OFFSET\"",
-                                      "\"EXCEPT\"",
-                                      "\"EXCLUDE\"",
-                                      "SWQT_VALUE_START",
-                                      "SWQT_SELECT_START",
-                                      "\"NOT\"",
-                                      "\"OR\"",
-                                      "\"AND\"",
-                                      "'='",
-                                      "'<'",
-                                      "'>'",
-                                      "'!'",
-                                      "'+'",
-                                      "'-'",
-                                      "'*'",
-                                      "'/'",
-                                      "'%'",
-                                      "SWQT_UMINUS",
-                                      "\"reserved keyword\"",
-                                      "'('",
-                                      "')'",
-                                      "','",
-                                      "'.'",
-                                      "$accept",
-                                      "input",
-                                      "value_expr",
-                                      "value_expr_list",
-                                      "field_value",
-                                      "value_expr_non_logical",
-                                      "type_def",
-                                      "select_statement",
-                                      "select_core",
-                                      "opt_union_all",
-                                      "union_all",
-                                      "select_field_list",
-                                      "exclude_field",
-                                      "exclude_field_list",
-                                      "except_or_exclude",
-                                      "column_spec",
-                                      "as_clause",
-                                      "opt_where",
-                                      "opt_joins",
-                                      "opt_order_by",
-                                      "sort_spec_list",
-                                      "sort_spec",
-                                      "opt_limit",
-                                      "opt_offset",
-                                      "table_def",
-                                      YY_NULLPTR};
+static const char *const yytname[] =
+{
+  "\"end of string\"", "error", "\"invalid token\"", "\"integer number\"",
+  "\"floating point number\"", "\"string\"", "\"identifier\"", "\"IN\"",
+  "\"LIKE\"", "\"ILIKE\"", "\"ESCAPE\"", "\"BETWEEN\"", "\"NULL\"",
+  "\"IS\"", "\"SELECT\"", "\"LEFT\"", "\"JOIN\"", "\"WHERE\"", "\"ON\"",
+  "\"ORDER\"", "\"BY\"", "\"GROUP\"", "\"FROM\"", "\"AS\"", "\"ASC\"",
+  "\"DESC\"", "\"DISTINCT\"", "\"CAST\"", "\"UNION\"", "\"ALL\"",
+  "\"LIMIT\"", "\"OFFSET\"", "\"EXCEPT\"", "\"EXCLUDE\"",
+  "SWQT_VALUE_START", "SWQT_SELECT_START", "\"NOT\"", "\"OR\"", "\"AND\"",
+  "'='", "'<'", "'>'", "'!'", "'+'", "'-'", "'*'", "'/'", "'%'",
+  "SWQT_UMINUS", "\"reserved keyword\"", "'('", "')'", "','", "'.'",
+  "$accept", "input", "value_expr", "value_expr_list", "field_value",
+  "value_expr_non_logical", "type_def", "select_statement", "select_core",
+  "opt_union_all", "union_all", "select_field_list", "exclude_field",
+  "exclude_field_list", "except_or_exclude", "column_spec", "as_clause",
+  "opt_where", "opt_joins", "opt_group_by", "group_by_list",
+  "group_by_spec", "opt_order_by", "sort_spec_list", "sort_spec",
+  "opt_limit", "opt_offset", "table_def", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
 #endif
 
 #define YYPACT_NINF (-137)
 
-#define yypact_value_is_default(Yyn) ((Yyn) == YYPACT_NINF)
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
 #define YYTABLE_NINF (-1)
 
-#define yytable_value_is_error(Yyn) 0
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-static const yytype_int16 yypact[] = {
-    34,   206,  -10,  16,   -137, -137, -137, -35,  -137, -37,  206,  211,
-    206,  326,  -137, 298,  79,   11,   -137, 4,    -137, 206,  23,   206,
-    368,  -137, 254,  -11,  206,  206,  211,  -5,   12,   206,  206,  94,
-    104,  155,  5,    211,  211,  211,  211,  211,  8,    196,  93,   274,
-    48,   26,   30,   65,   -137, -10,  235,  45,   -137, 310,  -137, 206,
-    91,   101,  44,   -137, 103,  68,   206,  206,  211,  345,  361,  206,
-    206,  -137, 206,  206,  -137, 206,  -137, 206,  18,   18,   -137, -137,
-    -137, 145,  -3,   100,  -137, -137, 89,   -137, 140,  -137, 121,  196,
-    4,    -137, -137, 206,  -137, 146,  114,  206,  206,  211,  -137, 206,
-    144,  158,  182,  -137, -137, -137, -137, -137, -137, 159,  119,  -137,
-    121,  159,  -137, 120,  2,    116,  -137, -137, -137, 124,  125,  -137,
-    -137, -137, 298,  127,  206,  206,  211,  122,  128,  20,   116,  -137,
-    131,  129,  177,  178,  -137, 170,  121,  174,  53,   -137, -137, -137,
-    -137, 298,  20,   -137, 174,  159,  -137, 20,   20,   121,  169,  206,
-    173,  90,   105,  -137, 173,  -137, -137, -137, 179,  206,  326,  175,
-    167,  -137, 200,  -137, 202,  167,  206,  290,  159,  203,  183,  157,
-    171,  183,  290,  -137, 139,  -137, 184,  -137, 217,  -137, -137, -137,
-    -137, -137, -137, -137, 159,  -137, -137};
+static const yytype_int16 yypact[] =
+{
+      28,   200,     6,     8,  -137,  -137,  -137,   -34,  -137,   -38,
+     200,   243,   200,   362,  -137,   236,    81,     3,  -137,    11,
+    -137,   200,    19,   200,   376,  -137,   265,    -7,   200,   200,
+     243,     2,   102,   200,   200,    93,   136,   184,    20,   243,
+     243,   243,   243,   243,   -27,   195,    35,   306,    42,   -11,
+      18,    48,  -137,     6,   258,    44,  -137,   326,  -137,   200,
+      90,    96,   124,  -137,    92,    64,   200,   200,   243,   250,
+     369,   200,   200,  -137,   200,   200,  -137,   200,  -137,   200,
+     -16,   -16,  -137,  -137,  -137,   147,    -3,    99,  -137,  -137,
+      72,  -137,   110,  -137,    74,   195,    11,  -137,  -137,   200,
+    -137,   117,    73,   200,   200,   243,  -137,   200,   118,   120,
+     170,  -137,  -137,  -137,  -137,  -137,  -137,   121,    87,  -137,
+      74,   121,  -137,    91,     1,    66,  -137,  -137,  -137,    97,
+      95,  -137,  -137,  -137,   236,   105,   200,   200,   243,   104,
+     107,    -2,    66,  -137,   108,   113,   155,   159,  -137,   162,
+      74,   164,    54,  -137,  -137,  -137,  -137,   236,    -2,  -137,
+     164,   121,  -137,    -2,    -2,    74,   161,   200,   163,    37,
+      40,  -137,   163,  -137,  -137,  -137,   175,   200,   362,   174,
+     176,  -137,   179,  -137,   199,   176,   200,   315,   121,   189,
+     180,   167,   168,   180,   315,  -137,  -137,  -137,   169,   121,
+     221,   194,  -137,  -137,   194,  -137,   121,    94,  -137,   177,
+    -137,   223,  -137,  -137,  -137,  -137,  -137,   121,  -137,  -137
+};
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
    Performed when YYTABLE does not specify something else to do.  Zero
    means the default is an error.  */
-static const yytype_int8 yydefact[] = {
-    2,  0,  0,   0,  36, 37, 38, 34, 41, 0,  0,  0,  0,  3,   39, 5,  0,  0,
-    4,  59, 1,   0,  0,  0,  8,  42, 0,  0,  0,  0,  0,  0,   0,  0,  0,  0,
-    0,  0,  0,   0,  0,  0,  0,  0,  34, 0,  72, 69, 0,  62,  0,  0,  55, 0,
-    33, 0,  35,  0,  40, 0,  18, 22, 0,  30, 0,  0,  0,  0,   0,  7,  6,  0,
-    0,  9,  0,   0,  12, 0,  13, 0,  43, 44, 45, 46, 47, 0,   0,  0,  67, 68,
-    0,  79, 0,   70, 0,  0,  59, 61, 60, 0,  48, 0,  0,  0,   0,  0,  31, 0,
-    19, 23, 0,   15, 16, 14, 10, 17, 11, 0,  0,  73, 0,  0,   78, 0,  96, 82,
-    63, 56, 32,  50, 0,  26, 20, 24, 28, 0,  0,  0,  0,  34,  0,  74, 82, 64,
-    65, 0,  0,   0,  97, 0,  0,  80, 0,  49, 27, 21, 25, 29,  76, 75, 80, 0,
-    71, 98, 100, 0,  0,  0,  85, 0,  0,  77, 85, 66, 99, 101, 0,  0,  81, 0,
-    92, 51, 0,   53, 0,  92, 0,  82, 0,  0,  94, 0,  0,  94,  82, 83, 89, 86,
-    88, 93, 0,   57, 52, 54, 58, 84, 90, 91, 0,  95, 87};
+static const yytype_int8 yydefact[] =
+{
+       2,     0,     0,     0,    36,    37,    38,    34,    41,     0,
+       0,     0,     0,     3,    39,     5,     0,     0,     4,    59,
+       1,     0,     0,     0,     8,    42,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    34,     0,    72,    69,     0,    62,
+       0,     0,    55,     0,    33,     0,    35,     0,    40,     0,
+      18,    22,     0,    30,     0,     0,     0,     0,     0,     7,
+       6,     0,     0,     9,     0,     0,    12,     0,    13,     0,
+      43,    44,    45,    46,    47,     0,     0,     0,    67,    68,
+       0,    79,     0,    70,     0,     0,    59,    61,    60,     0,
+      48,     0,     0,     0,     0,     0,    31,     0,    19,    23,
+       0,    15,    16,    14,    10,    17,    11,     0,     0,    73,
+       0,     0,    78,     0,   101,    82,    63,    56,    32,    50,
+       0,    26,    20,    24,    28,     0,     0,     0,     0,    34,
+       0,    74,    82,    64,    65,     0,     0,     0,   102,     0,
+       0,    80,     0,    49,    27,    21,    25,    29,    76,    75,
+      80,     0,    71,   103,   105,     0,     0,     0,    85,     0,
+       0,    77,    85,    66,   104,   106,     0,     0,    81,     0,
+      90,    51,     0,    53,     0,    90,     0,    82,     0,     0,
+      97,     0,     0,    97,    82,    83,    89,    86,    88,     0,
+       0,    99,    52,    54,    99,    84,     0,    94,    91,    93,
+      98,     0,    57,    58,    87,    95,    96,     0,   100,    92
+};
 
 /* YYPGOTO[NTERM-NUM].  */
-static const yytype_int16 yypgoto[] = {
-    -137, -137, -1,   -46, -116, 7,    -137, 176, 213,  137, -137, -43, -137,
-    73,   -137, -137, -45, 76,   -136, 66,   39,  -137, 67,  57,   -110};
+static const yytype_int16 yypgoto[] =
+{
+    -137,  -137,    -1,   -46,  -116,     7,  -137,   182,   213,   137,
+    -137,   -43,  -137,    71,  -137,  -137,    -9,    77,  -136,    69,
+      32,  -137,    57,    26,  -137,    58,    49,  -110
+};
 
 /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_uint8 yydefgoto[] = {
-    0,   3,  54, 55, 14,  15,  130, 18,  19,  52,  53,  48, 144,
-    145, 90, 49, 93, 168, 151, 180, 197, 198, 190, 201, 125};
+static const yytype_uint8 yydefgoto[] =
+{
+       0,     3,    54,    55,    14,    15,   130,    18,    19,    52,
+      53,    48,   144,   145,    90,    49,    93,   168,   151,   180,
+     197,   198,   190,   208,   209,   201,   212,   125
+};
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
    positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_uint8 yytable[] = {
-    13,  140, 87,  56,  16,  143, 160, 63,  91,  24,  142, 26,  23,  102, 21,
-    47,  20,  22,  25,  65,  66,  67,  57,  68,  92,  16,  91,  60,  61,  56,
-    64,  51,  69,  70,  73,  76,  78,  62,  59,  17,  166, 119, 92,  79,  47,
-    143, 80,  81,  82,  83,  84,  195, 126, 128, 147, 176, 169, 85,  205, 170,
-    86,  135, 41,  42,  43,  108, 109, 1,   2,   94,  111, 112, 196, 113, 114,
-    110, 115, 95,  116, 148, 96,  105, 4,   5,   6,   44,  39,  40,  41,  42,
-    43,  8,   196, 97,  47,  100, 159, 4,   5,   6,   7,   103, 132, 133, 45,
-    9,   8,   4,   5,   6,   7,   104, 134, 171, 10,  106, 8,   107, 174, 175,
-    9,   120, 11,  46,  88,  89,  123, 124, 12,  10,  9,   149, 150, 71,  72,
-    155, 156, 11,  121, 10,  181, 182, 74,  12,  75,  157, 122, 11,  4,   5,
-    6,   7,   129, 12,  136, 183, 184, 8,   4,   5,   6,   7,   206, 207, 131,
-    139, 178, 8,   137, 141, 117, 9,   146, 152, 22,  153, 187, 154, 158, 162,
-    10,  9,   161, 163, 164, 194, 165, 177, 11,  118, 10,  167, 179, 77,  12,
-    188, 189, 186, 11,  4,   5,   6,   44,  191, 12,  192, 199, 202, 8,   4,
-    5,   6,   7,   200, 4,   5,   6,   7,   8,   138, 209, 203, 9,   8,   39,
-    40,  41,  42,  43,  98,  50,  10,  9,   127, 173, 208, 172, 9,   185, 11,
-    46,  10,  27,  28,  29,  12,  30,  210, 31,  11,  204, 0,   193, 0,   11,
-    12,  0,   0,   0,   0,   12,  27,  28,  29,  0,   30,  0,   31,  0,   0,
-    32,  33,  34,  35,  36,  37,  38,  0,   0,   0,   91,  27,  28,  29,  0,
-    30,  99,  31,  0,   32,  33,  34,  35,  36,  37,  38,  92,  27,  28,  29,
-    0,   30,  0,   31,  58,  149, 150, 0,   0,   32,  33,  34,  35,  36,  37,
-    38,  0,   27,  28,  29,  0,   30,  0,   31,  0,   32,  33,  34,  35,  36,
-    37,  38,  101, 27,  28,  29,  0,   30,  0,   31,  39,  40,  41,  42,  43,
-    32,  33,  34,  35,  36,  37,  38,  27,  28,  29,  0,   30,  0,   31,  0,
-    0,   32,  33,  34,  35,  36,  37,  38,  27,  28,  29,  0,   30,  0,   31,
-    27,  28,  29,  0,   30,  32,  31,  34,  35,  36,  37,  38,  0,   0,   0,
-    0,   0,   0,   0,   0,   0,   32,  0,   0,   35,  36,  37,  38,  0,   0,
-    0,   35,  36,  37,  38};
-
-static const yytype_int16 yycheck[] = {
-    1,   117, 45, 6,   14, 121, 142, 12,  6,   10,  120, 12, 49,  59,  49,  16,
-    0,   52,  11, 7,   8,  9,   23,  11,  22,  14,  6,   28, 29,  6,   35,  27,
-    33,  34,  35, 36,  37, 30,  49,  49,  150, 44,  22,  38, 45,  161, 39,  40,
-    41,  42,  43, 187, 95, 99,  52,  165, 3,   49,  194, 6,  52,  107, 44,  45,
-    46,  66,  67, 33,  34, 21,  71,  72,  188, 74,  75,  68, 77,  51,  79,  124,
-    50,  37,  3,  4,   5,  6,   42,  43,  44,  45,  46,  12, 208, 28,  95,  50,
-    141, 3,   4,  5,   6,  10,  103, 104, 25,  26,  12,  3,  4,   5,   6,   10,
-    105, 158, 35, 12,  12, 49,  163, 164, 26,  21,  43,  44, 31,  32,  5,   6,
-    49,  35,  26, 15,  16, 39,  40,  136, 137, 43,  49,  35, 50,  51,  38,  49,
-    40,  138, 6,  43,  3,  4,   5,   6,   6,   49,  10,  50, 51,  12,  3,   4,
-    5,   6,   23, 24,  50, 6,   167, 12,  10,  50,  25,  26, 52,  49,  52,  50,
-    177, 50,  50, 50,  35, 26,  51,  6,   6,   186, 16,  18, 43,  44,  35,  17,
-    19,  38,  49, 20,  29, 18,  43,  3,   4,   5,   6,   3,  49,  3,   3,   50,
-    12,  3,   4,  5,   6,  30,  3,   4,   5,   6,   12,  37, 3,   50,  26,  12,
-    42,  43,  44, 45,  46, 53,  17,  35,  26,  96,  161, 51, 160, 26,  172, 43,
-    44,  35,  7,  8,   9,  49,  11,  208, 13,  43,  193, -1, 185, -1,  43,  49,
-    -1,  -1,  -1, -1,  49, 7,   8,   9,   -1,  11,  -1,  13, -1,  -1,  35,  36,
-    37,  38,  39, 40,  41, -1,  -1,  -1,  6,   7,   8,   9,  -1,  11,  51,  13,
-    -1,  35,  36, 37,  38, 39,  40,  41,  22,  7,   8,   9,  -1,  11,  -1,  13,
-    50,  15,  16, -1,  -1, 35,  36,  37,  38,  39,  40,  41, -1,  7,   8,   9,
-    -1,  11,  -1, 13,  -1, 35,  36,  37,  38,  39,  40,  41, 22,  7,   8,   9,
-    -1,  11,  -1, 13,  42, 43,  44,  45,  46,  35,  36,  37, 38,  39,  40,  41,
-    7,   8,   9,  -1,  11, -1,  13,  -1,  -1,  35,  36,  37, 38,  39,  40,  41,
-    7,   8,   9,  -1,  11, -1,  13,  7,   8,   9,   -1,  11, 35,  13,  37,  38,
-    39,  40,  41, -1,  -1, -1,  -1,  -1,  -1,  -1,  -1,  -1, 35,  -1,  -1,  38,
-    39,  40,  41, -1,  -1, -1,  38,  39,  40,  41};
+static const yytype_uint8 yytable[] =
+{
+      13,   140,    87,    56,    91,   143,   160,    91,    20,    24,
+     142,    26,    23,   102,    63,    47,    21,    16,    25,    22,
+      16,    92,    57,    85,    92,    56,    86,    60,    61,    41,
+      42,    43,    69,    70,    73,    76,    78,    62,    64,    51,
+     166,    95,   119,    59,    47,   143,    80,    81,    82,    83,
+      84,   195,   126,   128,   147,   176,    17,   169,   205,    79,
+     170,   135,     1,     2,    94,   108,   109,    88,    89,    96,
+     111,   112,   196,   113,   114,   110,   115,    97,   116,   123,
+     124,   149,   150,   207,     4,     5,     6,    44,   181,   182,
+     196,   183,   184,     8,    47,   100,     4,     5,     6,     7,
+     103,   207,   132,   133,   106,     8,   104,    45,     9,    65,
+      66,    67,   134,    68,   107,   148,   122,    10,   215,   216,
+       9,   120,   121,   129,   131,    11,    46,   139,   136,    10,
+     137,    12,   159,    71,    72,   155,   156,    11,   141,     4,
+       5,     6,     7,    12,   146,   157,   153,   152,     8,   171,
+       4,     5,     6,     7,   174,   175,   154,    22,   158,     8,
+     161,   163,   105,     9,   162,   164,   178,    39,    40,    41,
+      42,    43,    10,   117,     9,    74,   187,    75,   165,   177,
+      11,   167,   191,    10,   179,   194,    12,     4,     5,     6,
+       7,    11,   118,   186,   188,   189,     8,    12,     4,     5,
+       6,    44,   192,     4,     5,     6,     7,     8,   138,   199,
+     200,     9,     8,    39,    40,    41,    42,    43,   202,   203,
+      10,   206,     9,    77,   210,   211,   218,     9,    11,   217,
+      50,    10,   173,   127,    12,    98,    10,   172,   214,    11,
+      46,   185,   193,   219,    11,    12,     4,     5,     6,     7,
+      12,   204,     0,   213,     0,     8,     0,    27,    28,    29,
+       0,    30,     0,    31,     0,    27,    28,    29,     0,    30,
+       9,    31,    27,    28,    29,     0,    30,     0,    31,    39,
+      40,    41,    42,    43,     0,     0,    32,    11,    34,    35,
+      36,    37,    38,    12,    32,    33,    34,    35,    36,    37,
+      38,    32,    33,    34,    35,    36,    37,    38,     0,     0,
+      99,     0,    91,    27,    28,    29,    58,    30,     0,    31,
+       0,     0,    27,    28,    29,     0,    30,     0,    31,    92,
+     149,   150,     0,    27,    28,    29,     0,    30,     0,    31,
+       0,     0,    32,    33,    34,    35,    36,    37,    38,   101,
+       0,    32,    33,    34,    35,    36,    37,    38,     0,     0,
+       0,     0,    32,    33,    34,    35,    36,    37,    38,    27,
+      28,    29,     0,    30,     0,    31,    27,    28,    29,     0,
+      30,     0,    31,    27,    28,    29,     0,    30,     0,    31,
+       0,     0,     0,     0,     0,     0,     0,     0,    32,    33,
+      34,    35,    36,    37,    38,    32,     0,     0,    35,    36,
+      37,    38,     0,     0,     0,    35,    36,    37,    38
+};
+
+static const yytype_int16 yycheck[] =
+{
+       1,   117,    45,     6,     6,   121,   142,     6,     0,    10,
+     120,    12,    50,    59,    12,    16,    50,    14,    11,    53,
+      14,    23,    23,    50,    23,     6,    53,    28,    29,    45,
+      46,    47,    33,    34,    35,    36,    37,    30,    36,    28,
+     150,    52,    45,    50,    45,   161,    39,    40,    41,    42,
+      43,   187,    95,    99,    53,   165,    50,     3,   194,    39,
+       6,   107,    34,    35,    22,    66,    67,    32,    33,    51,
+      71,    72,   188,    74,    75,    68,    77,    29,    79,     5,
+       6,    15,    16,   199,     3,     4,     5,     6,    51,    52,
+     206,    51,    52,    12,    95,    51,     3,     4,     5,     6,
+      10,   217,   103,   104,    12,    12,    10,    26,    27,     7,
+       8,     9,   105,    11,    50,   124,     6,    36,    24,    25,
+      27,    22,    50,     6,    51,    44,    45,     6,    10,    36,
+      10,    50,   141,    40,    41,   136,   137,    44,    51,     3,
+       4,     5,     6,    50,    53,   138,    51,    50,    12,   158,
+       3,     4,     5,     6,   163,   164,    51,    53,    51,    12,
+      52,     6,    38,    27,    51,     6,   167,    43,    44,    45,
+      46,    47,    36,    26,    27,    39,   177,    41,    16,    18,
+      44,    17,     3,    36,    21,   186,    50,     3,     4,     5,
+       6,    44,    45,    18,    20,    19,    12,    50,     3,     4,
+       5,     6,     3,     3,     4,     5,     6,    12,    38,    20,
+      30,    27,    12,    43,    44,    45,    46,    47,    51,    51,
+      36,    52,    27,    39,     3,    31,     3,    27,    44,    52,
+      17,    36,   161,    96,    50,    53,    36,   160,   206,    44,
+      45,   172,   185,   217,    44,    50,     3,     4,     5,     6,
+      50,   193,    -1,   204,    -1,    12,    -1,     7,     8,     9,
+      -1,    11,    -1,    13,    -1,     7,     8,     9,    -1,    11,
+      27,    13,     7,     8,     9,    -1,    11,    -1,    13,    43,
+      44,    45,    46,    47,    -1,    -1,    36,    44,    38,    39,
+      40,    41,    42,    50,    36,    37,    38,    39,    40,    41,
+      42,    36,    37,    38,    39,    40,    41,    42,    -1,    -1,
+      52,    -1,     6,     7,     8,     9,    51,    11,    -1,    13,
+      -1,    -1,     7,     8,     9,    -1,    11,    -1,    13,    23,
+      15,    16,    -1,     7,     8,     9,    -1,    11,    -1,    13,
+      -1,    -1,    36,    37,    38,    39,    40,    41,    42,    23,
+      -1,    36,    37,    38,    39,    40,    41,    42,    -1,    -1,
+      -1,    -1,    36,    37,    38,    39,    40,    41,    42,     7,
+       8,     9,    -1,    11,    -1,    13,     7,     8,     9,    -1,
+      11,    -1,    13,     7,     8,     9,    -1,    11,    -1,    13,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    36,    37,
+      38,    39,    40,    41,    42,    36,    -1,    -1,    39,    40,
+      41,    42,    -1,    -1,    -1,    39,    40,    41,    42
+};
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
    state STATE-NUM.  */
-static const yytype_int8 yystos[] = {
-    0,  33, 34, 54, 3,  4,  5,  6,  12, 26, 35, 43, 49, 55, 57, 58, 14, 49,
-    60, 61, 0,  49, 52, 49, 55, 58, 55, 7,  8,  9,  11, 13, 35, 36, 37, 38,
-    39, 40, 41, 42, 43, 44, 45, 46, 6,  25, 44, 55, 64, 68, 61, 27, 62, 63,
-    55, 56, 6,  55, 50, 49, 55, 55, 58, 12, 35, 7,  8,  9,  11, 55, 55, 39,
-    40, 55, 38, 40, 55, 38, 55, 38, 58, 58, 58, 58, 58, 49, 52, 64, 31, 32,
-    67, 6,  22, 69, 21, 51, 50, 28, 60, 51, 50, 22, 56, 10, 10, 37, 12, 49,
-    55, 55, 58, 55, 55, 55, 55, 55, 55, 25, 44, 44, 21, 49, 6,  5,  6,  77,
-    64, 62, 56, 6,  59, 50, 55, 55, 58, 56, 10, 10, 37, 6,  57, 50, 77, 57,
-    65, 66, 52, 52, 69, 15, 16, 71, 49, 50, 50, 55, 55, 58, 50, 69, 71, 51,
-    50, 6,  6,  16, 77, 17, 70, 3,  6,  69, 70, 66, 69, 69, 77, 18, 55, 19,
-    72, 50, 51, 50, 51, 72, 18, 55, 20, 29, 75, 3,  3,  75, 55, 71, 57, 73,
-    74, 3,  30, 76, 50, 50, 76, 71, 23, 24, 51, 3,  73};
+static const yytype_int8 yystos[] =
+{
+       0,    34,    35,    55,     3,     4,     5,     6,    12,    27,
+      36,    44,    50,    56,    58,    59,    14,    50,    61,    62,
+       0,    50,    53,    50,    56,    59,    56,     7,     8,     9,
+      11,    13,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,     6,    26,    45,    56,    65,    69,
+      62,    28,    63,    64,    56,    57,     6,    56,    51,    50,
+      56,    56,    59,    12,    36,     7,     8,     9,    11,    56,
+      56,    40,    41,    56,    39,    41,    56,    39,    56,    39,
+      59,    59,    59,    59,    59,    50,    53,    65,    32,    33,
+      68,     6,    23,    70,    22,    52,    51,    29,    61,    52,
+      51,    23,    57,    10,    10,    38,    12,    50,    56,    56,
+      59,    56,    56,    56,    56,    56,    56,    26,    45,    45,
+      22,    50,     6,     5,     6,    81,    65,    63,    57,     6,
+      60,    51,    56,    56,    59,    57,    10,    10,    38,     6,
+      58,    51,    81,    58,    66,    67,    53,    53,    70,    15,
+      16,    72,    50,    51,    51,    56,    56,    59,    51,    70,
+      72,    52,    51,     6,     6,    16,    81,    17,    71,     3,
+       6,    70,    71,    67,    70,    70,    81,    18,    56,    21,
+      73,    51,    52,    51,    52,    73,    18,    56,    20,    19,
+      76,     3,     3,    76,    56,    72,    58,    74,    75,    20,
+      30,    79,    51,    51,    79,    72,    52,    58,    77,    78,
+       3,    31,    80,    80,    74,    24,    25,    52,     3,    77
+};
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
-static const yytype_int8 yyr1[] = {
-    0,  53, 54, 54, 54, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
-    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 56, 56,
-    57, 57, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 59,
-    59, 59, 59, 59, 60, 60, 61, 61, 62, 62, 63, 64, 64, 65, 66, 66, 67,
-    67, 68, 68, 68, 68, 68, 68, 68, 68, 68, 69, 69, 70, 70, 71, 71, 71,
-    72, 72, 73, 73, 74, 74, 74, 75, 75, 76, 76, 77, 77, 77, 77, 77, 77};
+static const yytype_int8 yyr1[] =
+{
+       0,    54,    55,    55,    55,    56,    56,    56,    56,    56,
+      56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
+      56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
+      56,    56,    57,    57,    58,    58,    59,    59,    59,    59,
+      59,    59,    59,    59,    59,    59,    59,    59,    59,    59,
+      60,    60,    60,    60,    60,    61,    61,    62,    62,    63,
+      63,    64,    65,    65,    66,    67,    67,    68,    68,    69,
+      69,    69,    69,    69,    69,    69,    69,    69,    70,    70,
+      71,    71,    72,    72,    72,    73,    73,    74,    74,    75,
+      76,    76,    77,    77,    78,    78,    78,    79,    79,    80,
+      80,    81,    81,    81,    81,    81,    81
+};
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
-static const yytype_int8 yyr2[] = {
-    0, 2, 0, 2, 2, 1, 3, 3, 2, 3, 4, 4, 3, 3, 4, 4, 4,  4, 3, 4, 5,
-    6, 3, 4, 5, 6, 5, 6, 5, 6, 3, 4, 3, 1, 1, 3, 1, 1,  1, 1, 3, 1,
-    2, 3, 3, 3, 3, 3, 4, 6, 1, 4, 6, 4, 6, 2, 4, 9, 10, 0, 2, 2, 1,
-    3, 1, 1, 3, 1, 1, 1, 2, 5, 1, 3, 4, 5, 5, 6, 2, 1,  0, 2, 0, 5,
-    6, 0, 3, 3, 1, 1, 2, 2, 0, 2, 0, 2, 1, 2, 3, 4, 3,  4};
-
-enum
+static const yytype_int8 yyr2[] =
 {
-    YYENOMEM = -2
+       0,     2,     0,     2,     2,     1,     3,     3,     2,     3,
+       4,     4,     3,     3,     4,     4,     4,     4,     3,     4,
+       5,     6,     3,     4,     5,     6,     5,     6,     5,     6,
+       3,     4,     3,     1,     1,     3,     1,     1,     1,     1,
+       3,     1,     2,     3,     3,     3,     3,     3,     4,     6,
+       1,     4,     6,     4,     6,     2,     4,    10,    11,     0,
+       2,     2,     1,     3,     1,     1,     3,     1,     1,     1,
+       2,     5,     1,     3,     4,     5,     5,     6,     2,     1,
+       0,     2,     0,     5,     6,     0,     3,     3,     1,     1,
+       0,     3,     3,     1,     1,     2,     2,     0,     2,     0,
+       2,     1,     2,     3,     4,     3,     4
 };
 
-#define yyerrok (yyerrstatus = 0)
-#define yyclearin (yychar = YYEMPTY)
-
-#define YYACCEPT goto yyacceptlab
-#define YYABORT goto yyabortlab
-#define YYERROR goto yyerrorlab
-#define YYNOMEM goto yyexhaustedlab
-
-#define YYRECOVERING() (!!yyerrstatus)
-
-#define YYBACKUP(Token, Value)                                                 \
-    do                                                                         \
-        if (yychar == YYEMPTY)                                                 \
-        {                                                                      \
-            yychar = (Token);                                                  \
-            yylval = (Value);                                                  \
-            YYPOPSTACK(yylen);                                                 \
-            yystate = *yyssp;                                                  \
-            goto yybackup;                                                     \
-        }                                                                      \
-        else                                                                   \
-        {                                                                      \
-            yyerror(context, YY_("syntax error: cannot back up"));             \
-            YYERROR;                                                           \
-        }                                                                      \
-    while (0)
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (context, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
 
 /* Backward compatibility with an undocumented macro.
    Use YYerror or YYUNDEF. */
 #define YYERRCODE YYUNDEF
 
+
 /* Enable debugging if requested.  */
 #if YYDEBUG
 
-#ifndef YYFPRINTF
-#include <stdio.h> /* INFRINGES ON USER NAME SPACE */
-#define YYFPRINTF fprintf
-#endif
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, context); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
 
-#define YYDPRINTF(Args)                                                        \
-    do                                                                         \
-    {                                                                          \
-        if (yydebug)                                                           \
-            YYFPRINTF Args;                                                    \
-    } while (0)
-
-#define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                          \
-    do                                                                         \
-    {                                                                          \
-        if (yydebug)                                                           \
-        {                                                                      \
-            YYFPRINTF(stderr, "%s ", Title);                                   \
-            yy_symbol_print(stderr, Kind, Value, context);                     \
-            YYFPRINTF(stderr, "\n");                                           \
-        }                                                                      \
-    } while (0)
 
 /*-----------------------------------.
 | Print this symbol's value on YYO.  |
 `-----------------------------------*/
 
-static void yy_symbol_value_print(FILE *yyo, yysymbol_kind_t yykind,
-                                  YYSTYPE const *const yyvaluep,
-                                  swq_parse_context *context)
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, swq_parse_context *context)
 {
-    FILE *yyoutput = yyo;
-    YY_USE(yyoutput);
-    YY_USE(context);
-    if (!yyvaluep)
-        return;
-    YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-    YY_USE(yykind);
-    YY_IGNORE_MAYBE_UNINITIALIZED_END
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (context);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
+
 /*---------------------------.
 | Print this symbol on YYO.  |
 `---------------------------*/
 
-static void yy_symbol_print(FILE *yyo, yysymbol_kind_t yykind,
-                            YYSTYPE const *const yyvaluep,
-                            swq_parse_context *context)
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, swq_parse_context *context)
 {
-    YYFPRINTF(yyo, "%s %s (", yykind < YYNTOKENS ? "token" : "nterm",
-              yysymbol_name(yykind));
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-    yy_symbol_value_print(yyo, yykind, yyvaluep, context);
-    YYFPRINTF(yyo, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, context);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -938,66 +1017,69 @@ static void yy_symbol_print(FILE *yyo, yysymbol_kind_t yykind,
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-static void yy_stack_print(yy_state_t *yybottom, yy_state_t *yytop)
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
-    YYFPRINTF(stderr, "Stack now");
-    for (; yybottom <= yytop; yybottom++)
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
     {
-        int yybot = *yybottom;
-        YYFPRINTF(stderr, " %d", yybot);
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
     }
-    YYFPRINTF(stderr, "\n");
+  YYFPRINTF (stderr, "\n");
 }
 
-#define YY_STACK_PRINT(Bottom, Top)                                            \
-    do                                                                         \
-    {                                                                          \
-        if (yydebug)                                                           \
-            yy_stack_print((Bottom), (Top));                                   \
-    } while (0)
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-static void yy_reduce_print(yy_state_t *yyssp, YYSTYPE *yyvsp, int yyrule,
-                            swq_parse_context *context)
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, swq_parse_context *context)
 {
-    int yylno = yyrline[yyrule];
-    int yynrhs = yyr2[yyrule];
-    int yyi;
-    YYFPRINTF(stderr, "Reducing stack by rule %d (line %d):\n", yyrule - 1,
-              yylno);
-    /* The symbols being reduced.  */
-    for (yyi = 0; yyi < yynrhs; yyi++)
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
     {
-        YYFPRINTF(stderr, "   $%d = ", yyi + 1);
-        yy_symbol_print(stderr, YY_ACCESSING_SYMBOL(+yyssp[yyi + 1 - yynrhs]),
-                        &yyvsp[(yyi + 1) - (yynrhs)], context);
-        YYFPRINTF(stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], context);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-#define YY_REDUCE_PRINT(Rule)                                                  \
-    do                                                                         \
-    {                                                                          \
-        if (yydebug)                                                           \
-            yy_reduce_print(yyssp, yyvsp, Rule, context);                      \
-    } while (0)
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, context); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-#define YYDPRINTF(Args) ((void)0)
-#define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
-#define YY_STACK_PRINT(Bottom, Top)
-#define YY_REDUCE_PRINT(Rule)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
+
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
 #ifndef YYINITDEPTH
-#define YYINITDEPTH 200
+# define YYINITDEPTH 200
 #endif
 
 /* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
@@ -1008,14 +1090,15 @@ int yydebug;
    evaluated with infinite-precision integer arithmetic.  */
 
 #ifndef YYMAXDEPTH
-#define YYMAXDEPTH 10000
+# define YYMAXDEPTH 10000
 #endif
 
+
 /* Context of a parse error.  */
 typedef struct
 {
-    yy_state_t *yyssp;
-    yysymbol_kind_t yytoken;
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
 } yypcontext_t;
 
 /* Put in YYARG at most YYARGN of the expected tokens given the
@@ -1024,71 +1107,77 @@ typedef struct
    be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
    Return 0 if there are more than YYARGN expected tokens, yet fill
    YYARG up to YYARGN. */
-static int yypcontext_expected_tokens(const yypcontext_t *yyctx,
-                                      yysymbol_kind_t yyarg[], int yyargn)
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
 {
-    /* Actual size of YYARG. */
-    int yycount = 0;
-    int yyn = yypact[+*yyctx->yyssp];
-    if (!yypact_value_is_default(yyn))
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
     {
-        /* Start YYX at -YYN if negative to avoid negative indexes in
+      /* Start YYX at -YYN if negative to avoid negative indexes in
          YYCHECK.  In other words, skip the first -YYN actions for
          this state because they are default actions.  */
-        int yyxbegin = yyn < 0 ? -yyn : 0;
-        /* Stay within bounds of both yycheck and yytname.  */
-        int yychecklim = YYLAST - yyn + 1;
-        int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-        int yyx;
-        for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror &&
-                !yytable_value_is_error(yytable[yyx + yyn]))
-            {
-                if (!yyarg)
-                    ++yycount;
-                else if (yycount == yyargn)
-                    return 0;
-                else
-                    yyarg[yycount++] = YY_CAST(yysymbol_kind_t, yyx);
-            }
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
     }
-    if (yyarg && yycount == 0 && 0 < yyargn)
-        yyarg[0] = YYSYMBOL_YYEMPTY;
-    return yycount;
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
 }
 
+
+
+
 #ifndef yystrlen
-#if defined __GLIBC__ && defined _STRING_H
-#define yystrlen(S) (YY_CAST(YYPTRDIFF_T, strlen(S)))
-#else
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-static YYPTRDIFF_T yystrlen(const char *yystr)
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
 {
-    YYPTRDIFF_T yylen;
-    for (yylen = 0; yystr[yylen]; yylen++)
-        continue;
-    return yylen;
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
 }
-#endif
+# endif
 #endif
 
 #ifndef yystpcpy
-#if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#define yystpcpy stpcpy
-#else
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
-static char *yystpcpy(char *yydest, const char *yysrc)
+static char *
+yystpcpy (char *yydest, const char *yysrc)
 {
-    char *yyd = yydest;
-    const char *yys = yysrc;
+  char *yyd = yydest;
+  const char *yys = yysrc;
 
-    while ((*yyd++ = *yys++) != '\0')
-        continue;
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
 
-    return yyd - 1;
+  return yyd - 1;
 }
-#endif
+# endif
 #endif
 
 #ifndef yytnamerr
@@ -1099,53 +1188,56 @@ static char *yystpcpy(char *yydest, const char *yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYPTRDIFF_T yytnamerr(char *yyres, const char *yystr)
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
 {
-    if (*yystr == '"')
+  if (*yystr == '"')
     {
-        YYPTRDIFF_T yyn = 0;
-        char const *yyp = yystr;
-        for (;;)
-            switch (*++yyp)
-            {
-                case '\'':
-                case ',':
-                    goto do_not_strip_quotes;
-
-                case '\\':
-                    if (*++yyp != '\\')
-                        goto do_not_strip_quotes;
-                    else
-                        goto append;
-
-                append:
-                default:
-                    if (yyres)
-                        yyres[yyn] = *yyp;
-                    yyn++;
-                    break;
-
-                case '"':
-                    if (yyres)
-                        yyres[yyn] = '\0';
-                    return yyn;
-            }
-    do_not_strip_quotes:;
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
     }
 
-    if (yyres)
-        return yystpcpy(yyres, yystr) - yyres;
-    else
-        return yystrlen(yystr);
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
 }
 #endif
 
-static int yy_syntax_error_arguments(const yypcontext_t *yyctx,
-                                     yysymbol_kind_t yyarg[], int yyargn)
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-    /* Actual size of YYARG. */
-    int yycount = 0;
-    /* There are many possibilities here to consider:
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
        is an error action.  In that case, don't check for expected
@@ -1168,20 +1260,20 @@ static int yy_syntax_error_arguments(const yypcontext_t *yyctx,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-    if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
     {
-        int yyn;
-        if (yyarg)
-            yyarg[yycount] = yyctx->yytoken;
-        ++yycount;
-        yyn = yypcontext_expected_tokens(yyctx, yyarg ? yyarg + 1 : yyarg,
-                                         yyargn - 1);
-        if (yyn == YYENOMEM)
-            return YYENOMEM;
-        else
-            yycount += yyn;
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
-    return yycount;
+  return yycount;
 }
 
 /* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
@@ -1192,187 +1284,171 @@ static int yy_syntax_error_arguments(const yypcontext_t *yyctx,
    not large enough to hold the message.  In that case, also set
    *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
    required number of bytes is too large to store.  */
-static int yysyntax_error(YYPTRDIFF_T *yymsg_alloc, char **yymsg,
-                          const yypcontext_t *yyctx)
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
 {
-    enum
-    {
-        YYARGS_MAX = 5
-    };
-
-    /* Internationalized format string. */
-    const char *yyformat = YY_NULLPTR;
-    /* Arguments of yyformat: reported tokens (one for the "unexpected",
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
      one per "expected"). */
-    yysymbol_kind_t yyarg[YYARGS_MAX];
-    /* Cumulated lengths of YYARG.  */
-    YYPTRDIFF_T yysize = 0;
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
 
-    /* Actual size of YYARG. */
-    int yycount = yy_syntax_error_arguments(yyctx, yyarg, YYARGS_MAX);
-    if (yycount == YYENOMEM)
-        return YYENOMEM;
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
-    switch (yycount)
+  switch (yycount)
     {
-#define YYCASE_(N, S)                                                          \
-    case N:                                                                    \
-        yyformat = S;                                                          \
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
         break
-        default: /* Avoid compiler warnings. */
-            YYCASE_(0, YY_("syntax error"));
-            YYCASE_(1, YY_("syntax error, unexpected %s"));
-            YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-            YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-            YYCASE_(
-                4,
-                YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-            YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or "
-                           "%s or %s"));
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
     }
 
-    /* Compute error message size.  Don't count the "%s"s, but reserve
+  /* Compute error message size.  Don't count the "%s"s, but reserve
      room for the terminator.  */
-    yysize = yystrlen(yyformat) - 2 * yycount + 1;
-    {
-        int yyi;
-        for (yyi = 0; yyi < yycount; ++yyi)
-        {
-            YYPTRDIFF_T yysize1 =
-                yysize + yytnamerr(YY_NULLPTR, yytname[yyarg[yyi]]);
-            if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
-                yysize = yysize1;
-            else
-                return YYENOMEM;
-        }
-    }
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
 
-    if (*yymsg_alloc < yysize)
+  if (*yymsg_alloc < yysize)
     {
-        *yymsg_alloc = 2 * yysize;
-        if (!(yysize <= *yymsg_alloc && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-            *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-        return -1;
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
     }
 
-    /* Avoid sprintf, as that infringes on the user's name space.
+  /* Avoid sprintf, as that infringes on the user's name space.
      Don't have undefined behavior even if the translation
      produced a string with the wrong number of "%s"s.  */
-    {
-        char *yyp = *yymsg;
-        int yyi = 0;
-        while ((*yyp = *yyformat) != '\0')
-            if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-            {
-                yyp += yytnamerr(yyp, yytname[yyarg[yyi++]]);
-                yyformat += 2;
-            }
-            else
-            {
-                ++yyp;
-                ++yyformat;
-            }
-    }
-    return 0;
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
 }
 
+
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-static void yydestruct(const char *yymsg, yysymbol_kind_t yykind,
-                       YYSTYPE *yyvaluep, swq_parse_context *context)
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, swq_parse_context *context)
 {
-    YY_USE(yyvaluep);
-    YY_USE(context);
-    if (!yymsg)
-        yymsg = "Deleting";
-    YY_SYMBOL_PRINT(yymsg, yykind, yyvaluep, yylocationp);
-
-    YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-    switch (yykind)
+  YY_USE (yyvaluep);
+  YY_USE (context);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  switch (yykind)
     {
-        case YYSYMBOL_SWQT_INTEGER_NUMBER: /* "integer number"  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_SWQT_INTEGER_NUMBER: /* "integer number"  */
+            { delete (*yyvaluep); }
         break;
 
-        case YYSYMBOL_SWQT_FLOAT_NUMBER: /* "floating point number"  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_SWQT_FLOAT_NUMBER: /* "floating point number"  */
+            { delete (*yyvaluep); }
         break;
 
-        case YYSYMBOL_SWQT_STRING: /* "string"  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_SWQT_STRING: /* "string"  */
+            { delete (*yyvaluep); }
         break;
 
-        case YYSYMBOL_SWQT_IDENTIFIER: /* "identifier"  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_SWQT_IDENTIFIER: /* "identifier"  */
+            { delete (*yyvaluep); }
         break;
 
-        case YYSYMBOL_value_expr: /* value_expr  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_value_expr: /* value_expr  */
+            { delete (*yyvaluep); }
         break;
 
-        case YYSYMBOL_value_expr_list: /* value_expr_list  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_value_expr_list: /* value_expr_list  */
+            { delete (*yyvaluep); }
         break;
 
-        case YYSYMBOL_field_value: /* field_value  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_field_value: /* field_value  */
+            { delete (*yyvaluep); }
         break;
 
-        case YYSYMBOL_value_expr_non_logical: /* value_expr_non_logical  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_value_expr_non_logical: /* value_expr_non_logical  */
+            { delete (*yyvaluep); }
         break;
 
-        case YYSYMBOL_type_def: /* type_def  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_type_def: /* type_def  */
+            { delete (*yyvaluep); }
         break;
 
-        case YYSYMBOL_table_def: /* table_def  */
-        {
-            delete (*yyvaluep);
-        }
+    case YYSYMBOL_table_def: /* table_def  */
+            { delete (*yyvaluep); }
         break;
 
-        default:
-            break;
+      default:
+        break;
     }
-    YY_IGNORE_MAYBE_UNINITIALIZED_END
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
+
+
+
+
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-int yyparse(swq_parse_context *context)
+int
+yyparse (swq_parse_context *context)
 {
-    /* Lookahead token kind.  */
-    int yychar;
+/* Lookahead token kind.  */
+int yychar;
 
-    /* The semantic value of the lookahead symbol.  */
-    /* Default value used for initialization, for pacifying older GCCs
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
    or non-GCC compilers.  */
-    YY_INITIAL_VALUE(static YYSTYPE yyval_default;)
-    YYSTYPE yylval YY_INITIAL_VALUE(= yyval_default);
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
     /* Number of syntax errors so far.  */
     int yynerrs = 0;
@@ -1397,207 +1473,215 @@ int yyparse(swq_parse_context *context)
     YYSTYPE *yyvs = yyvsa;
     YYSTYPE *yyvsp = yyvs;
 
-    int yyn;
-    /* The return value of yyparse.  */
-    int yyresult;
-    /* Lookahead symbol kind.  */
-    yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
-    /* The variables used to return semantic value and location from the
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
      action routines.  */
-    YYSTYPE yyval;
+  YYSTYPE yyval;
 
-    /* Buffer for error messages, and its allocated size.  */
-    char yymsgbuf[128];
-    char *yymsg = yymsgbuf;
-    YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
-#define YYPOPSTACK(N) (yyvsp -= (N), yyssp -= (N))
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
-    /* The number of symbols on the RHS of the reduced rule.
+  /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
-    int yylen = 0;
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
 
-    YYDPRINTF((stderr, "Starting parse\n"));
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
-    yychar = YYEMPTY; /* Cause a token to be read.  */
+  goto yysetstate;
 
-    goto yysetstate;
 
 /*------------------------------------------------------------.
 | yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
 yynewstate:
-    /* In all cases, when you get here, the value and location stacks
+  /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
-    yyssp++;
+  yyssp++;
+
 
 /*--------------------------------------------------------------------.
 | yysetstate -- set current state (the top of the stack) to yystate.  |
 `--------------------------------------------------------------------*/
 yysetstate:
-    YYDPRINTF((stderr, "Entering state %d\n", yystate));
-    YY_IGNORE_USELESS_CAST_BEGIN
-    *yyssp = YY_CAST(yy_state_t, yystate);
-    YY_IGNORE_USELESS_CAST_END
-    YY_STACK_PRINT(yyss, yyssp);
-
-    if (yyss + yystacksize - 1 <= yyssp)
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
 #if !defined yyoverflow && !defined YYSTACK_RELOCATE
-        YYNOMEM;
+    YYNOMEM;
 #else
     {
-        /* Get the current used size of the three stacks, in elements.  */
-        YYPTRDIFF_T yysize = yyssp - yyss + 1;
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#if defined yyoverflow
-        {
-            /* Give user a chance to reallocate the stack.  Use copies of
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
-            yy_state_t *yyss1 = yyss;
-            YYSTYPE *yyvs1 = yyvs;
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
 
-            /* Each stack pointer address is followed by the size of the
+        /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
-            yyoverflow(YY_("memory exhausted"), &yyss1,
-                       yysize * YYSIZEOF(*yyssp), &yyvs1,
-                       yysize * YYSIZEOF(*yyvsp), &yystacksize);
-            yyss = yyss1;
-            yyvs = yyvs1;
-        }
-#else /* defined YYSTACK_RELOCATE */
-        /* Extend the stack our own way.  */
-        if (YYMAXDEPTH <= yystacksize)
-            YYNOMEM;
-        yystacksize *= 2;
-        if (YYMAXDEPTH < yystacksize)
-            yystacksize = YYMAXDEPTH;
-
-        {
-            yy_state_t *yyss1 = yyss;
-            union yyalloc *yyptr = YY_CAST(
-                union yyalloc *,
-                YYSTACK_ALLOC(YY_CAST(YYSIZE_T, YYSTACK_BYTES(yystacksize))));
-            if (!yyptr)
-                YYNOMEM;
-            YYSTACK_RELOCATE(yyss_alloc, yyss);
-            YYSTACK_RELOCATE(yyvs_alloc, yyvs);
-#undef YYSTACK_RELOCATE
-            if (yyss1 != yyssa)
-                YYSTACK_FREE(yyss1);
-        }
-#endif
-
-        yyssp = yyss + yysize - 1;
-        yyvsp = yyvs + yysize - 1;
-
-        YY_IGNORE_USELESS_CAST_BEGIN
-        YYDPRINTF((stderr, "Stack size increased to %ld\n",
-                   YY_CAST(long, yystacksize)));
-        YY_IGNORE_USELESS_CAST_END
-
-        if (yyss + yystacksize - 1 <= yyssp)
-            YYABORT;
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
     }
 #endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-    if (yystate == YYFINAL)
-        YYACCEPT;
 
-    goto yybackup;
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
 
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-    /* Do appropriate processing given the current state.  Read a
+  /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
-    /* First try to decide what to do without reference to lookahead token.  */
-    yyn = yypact[yystate];
-    if (yypact_value_is_default(yyn))
-        goto yydefault;
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
 
-    /* Not known => get a lookahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-    /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
-    if (yychar == YYEMPTY)
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
     {
-        YYDPRINTF((stderr, "Reading a token\n"));
-        yychar = yylex(&yylval, context);
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, context);
     }
 
-    if (yychar <= END)
+  if (yychar <= END)
     {
-        yychar = END;
-        yytoken = YYSYMBOL_YYEOF;
-        YYDPRINTF((stderr, "Now at end of input.\n"));
+      yychar = END;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
-    else if (yychar == YYerror)
+  else if (yychar == YYerror)
     {
-        /* The scanner already issued an error message, process directly
+      /* The scanner already issued an error message, process directly
          to error recovery.  But do not keep the error token as
          lookahead, it is too special and may lead us to an endless
          loop in error recovery. */
-        yychar = YYUNDEF;
-        yytoken = YYSYMBOL_YYerror;
-        goto yyerrlab1;
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
     }
-    else
+  else
     {
-        yytoken = YYTRANSLATE(yychar);
-        YY_SYMBOL_PRINT("Next token is", yytoken, &yylval, &yylloc);
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
     }
 
-    /* If the proper action on seeing token YYTOKEN is to reduce or to
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
      detect an error, take that action.  */
-    yyn += yytoken;
-    if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
-        goto yydefault;
-    yyn = yytable[yyn];
-    if (yyn <= 0)
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
     {
-        if (yytable_value_is_error(yyn))
-            goto yyerrlab;
-        yyn = -yyn;
-        goto yyreduce;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
     }
 
-    /* Count tokens shifted since error; after three, turn off error
+  /* Count tokens shifted since error; after three, turn off error
      status.  */
-    if (yyerrstatus)
-        yyerrstatus--;
+  if (yyerrstatus)
+    yyerrstatus--;
 
-    /* Shift the lookahead token.  */
-    YY_SYMBOL_PRINT("Shifting", yytoken, &yylval, &yylloc);
-    yystate = yyn;
-    YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-    *++yyvsp = yylval;
-    YY_IGNORE_MAYBE_UNINITIALIZED_END
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
 
-    /* Discard the shifted token.  */
-    yychar = YYEMPTY;
-    goto yynewstate;
 
 /*-----------------------------------------------------------.
 | yydefault -- do the default action for the current state.  |
 `-----------------------------------------------------------*/
 yydefault:
-    yyn = yydefact[yystate];
-    if (yyn == 0)
-        goto yyerrlab;
-    goto yyreduce;
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
 
 /*-----------------------------.
 | yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
-    /* yyn is the number of a rule to reduce with.  */
-    yylen = yyr2[yyn];
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
 
-    /* If YYLEN is nonzero, implement the default value of the action:
+  /* If YYLEN is nonzero, implement the default value of the action:
      '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
@@ -1605,316 +1689,317 @@ yyreduce:
      users should not rely upon it.  Assigning to YYVAL
      unconditionally makes the parser a bit smaller, and it avoids a
      GCC warning that YYVAL may be used uninitialized.  */
-    yyval = yyvsp[1 - yylen];
+  yyval = yyvsp[1-yylen];
 
-    YY_REDUCE_PRINT(yyn);
-    switch (yyn)
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
     {
-        case 3: /* input: SWQT_VALUE_START value_expr  */
+  case 3: /* input: SWQT_VALUE_START value_expr  */
         {
             context->poRoot = yyvsp[0];
             swq_fixup(context);
         }
-        break;
+    break;
 
-        case 4: /* input: SWQT_SELECT_START select_statement  */
+  case 4: /* input: SWQT_SELECT_START select_statement  */
         {
             context->poRoot = yyvsp[0];
             // swq_fixup() must be done by caller
         }
-        break;
+    break;
 
-        case 5: /* value_expr: value_expr_non_logical  */
+  case 5: /* value_expr: value_expr_non_logical  */
         {
             yyval = yyvsp[0];
         }
-        break;
+    break;
 
-        case 6: /* value_expr: value_expr "AND" value_expr  */
+  case 6: /* value_expr: value_expr "AND" value_expr  */
         {
-            yyval = swq_create_and_or_or(SWQ_AND, yyvsp[-2], yyvsp[0]);
+            yyval = swq_create_and_or_or( SWQ_AND, yyvsp[-2], yyvsp[0] );
         }
-        break;
+    break;
 
-        case 7: /* value_expr: value_expr "OR" value_expr  */
+  case 7: /* value_expr: value_expr "OR" value_expr  */
         {
-            yyval = swq_create_and_or_or(SWQ_OR, yyvsp[-2], yyvsp[0]);
+            yyval = swq_create_and_or_or( SWQ_OR, yyvsp[-2], yyvsp[0] );
         }
-        break;
+    break;
 
-        case 8: /* value_expr: "NOT" value_expr  */
+  case 8: /* value_expr: "NOT" value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_NOT);
+            yyval = new swq_expr_node( SWQ_NOT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 9: /* value_expr: value_expr '=' value_expr  */
+  case 9: /* value_expr: value_expr '=' value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_EQ);
+            yyval = new swq_expr_node( SWQ_EQ );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 10: /* value_expr: value_expr '<' '>' value_expr  */
+  case 10: /* value_expr: value_expr '<' '>' value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_NE);
+            yyval = new swq_expr_node( SWQ_NE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-3]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-3] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 11: /* value_expr: value_expr '!' '=' value_expr  */
+  case 11: /* value_expr: value_expr '!' '=' value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_NE);
+            yyval = new swq_expr_node( SWQ_NE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-3]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-3] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 12: /* value_expr: value_expr '<' value_expr  */
+  case 12: /* value_expr: value_expr '<' value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_LT);
+            yyval = new swq_expr_node( SWQ_LT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 13: /* value_expr: value_expr '>' value_expr  */
+  case 13: /* value_expr: value_expr '>' value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_GT);
+            yyval = new swq_expr_node( SWQ_GT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 14: /* value_expr: value_expr '<' '=' value_expr  */
+  case 14: /* value_expr: value_expr '<' '=' value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_LE);
+            yyval = new swq_expr_node( SWQ_LE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-3]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-3] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 15: /* value_expr: value_expr '=' '<' value_expr  */
+  case 15: /* value_expr: value_expr '=' '<' value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_LE);
+            yyval = new swq_expr_node( SWQ_LE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-3]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-3] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 16: /* value_expr: value_expr '=' '>' value_expr  */
+  case 16: /* value_expr: value_expr '=' '>' value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_LE);
+            yyval = new swq_expr_node( SWQ_LE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-3]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-3] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 17: /* value_expr: value_expr '>' '=' value_expr  */
+  case 17: /* value_expr: value_expr '>' '=' value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_GE);
+            yyval = new swq_expr_node( SWQ_GE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-3]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-3] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 18: /* value_expr: value_expr "LIKE" value_expr  */
+  case 18: /* value_expr: value_expr "LIKE" value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_LIKE);
+            yyval = new swq_expr_node( SWQ_LIKE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 19: /* value_expr: value_expr "NOT" "LIKE" value_expr  */
+  case 19: /* value_expr: value_expr "NOT" "LIKE" value_expr  */
         {
-            swq_expr_node *like = new swq_expr_node(SWQ_LIKE);
+            swq_expr_node *like = new swq_expr_node( SWQ_LIKE );
             like->field_type = SWQ_BOOLEAN;
-            like->PushSubExpression(yyvsp[-3]);
-            like->PushSubExpression(yyvsp[0]);
+            like->PushSubExpression( yyvsp[-3] );
+            like->PushSubExpression( yyvsp[0] );
 
-            yyval = new swq_expr_node(SWQ_NOT);
+            yyval = new swq_expr_node( SWQ_NOT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(like);
+            yyval->PushSubExpression( like );
         }
-        break;
+    break;
 
-        case 20: /* value_expr: value_expr "LIKE" value_expr "ESCAPE" value_expr  */
+  case 20: /* value_expr: value_expr "LIKE" value_expr "ESCAPE" value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_LIKE);
+            yyval = new swq_expr_node( SWQ_LIKE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-4]);
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-4] );
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 21: /* value_expr: value_expr "NOT" "LIKE" value_expr "ESCAPE" value_expr  */
+  case 21: /* value_expr: value_expr "NOT" "LIKE" value_expr "ESCAPE" value_expr  */
         {
-            swq_expr_node *like = new swq_expr_node(SWQ_LIKE);
+            swq_expr_node *like = new swq_expr_node( SWQ_LIKE );
             like->field_type = SWQ_BOOLEAN;
-            like->PushSubExpression(yyvsp[-5]);
-            like->PushSubExpression(yyvsp[-2]);
-            like->PushSubExpression(yyvsp[0]);
+            like->PushSubExpression( yyvsp[-5] );
+            like->PushSubExpression( yyvsp[-2] );
+            like->PushSubExpression( yyvsp[0] );
 
-            yyval = new swq_expr_node(SWQ_NOT);
+            yyval = new swq_expr_node( SWQ_NOT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(like);
+            yyval->PushSubExpression( like );
         }
-        break;
+    break;
 
-        case 22: /* value_expr: value_expr "ILIKE" value_expr  */
+  case 22: /* value_expr: value_expr "ILIKE" value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_ILIKE);
+            yyval = new swq_expr_node( SWQ_ILIKE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 23: /* value_expr: value_expr "NOT" "ILIKE" value_expr  */
+  case 23: /* value_expr: value_expr "NOT" "ILIKE" value_expr  */
         {
-            swq_expr_node *like = new swq_expr_node(SWQ_ILIKE);
+            swq_expr_node *like = new swq_expr_node( SWQ_ILIKE );
             like->field_type = SWQ_BOOLEAN;
-            like->PushSubExpression(yyvsp[-3]);
-            like->PushSubExpression(yyvsp[0]);
+            like->PushSubExpression( yyvsp[-3] );
+            like->PushSubExpression( yyvsp[0] );
 
-            yyval = new swq_expr_node(SWQ_NOT);
+            yyval = new swq_expr_node( SWQ_NOT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(like);
+            yyval->PushSubExpression( like );
         }
-        break;
+    break;
 
-        case 24: /* value_expr: value_expr "ILIKE" value_expr "ESCAPE" value_expr  */
+  case 24: /* value_expr: value_expr "ILIKE" value_expr "ESCAPE" value_expr  */
         {
-            yyval = new swq_expr_node(SWQ_ILIKE);
+            yyval = new swq_expr_node( SWQ_ILIKE );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-4]);
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-4] );
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 25: /* value_expr: value_expr "NOT" "ILIKE" value_expr "ESCAPE" value_expr  */
+  case 25: /* value_expr: value_expr "NOT" "ILIKE" value_expr "ESCAPE" value_expr  */
         {
-            swq_expr_node *like = new swq_expr_node(SWQ_ILIKE);
+            swq_expr_node *like = new swq_expr_node( SWQ_ILIKE );
             like->field_type = SWQ_BOOLEAN;
-            like->PushSubExpression(yyvsp[-5]);
-            like->PushSubExpression(yyvsp[-2]);
-            like->PushSubExpression(yyvsp[0]);
+            like->PushSubExpression( yyvsp[-5] );
+            like->PushSubExpression( yyvsp[-2] );
+            like->PushSubExpression( yyvsp[0] );
 
-            yyval = new swq_expr_node(SWQ_NOT);
+            yyval = new swq_expr_node( SWQ_NOT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(like);
+            yyval->PushSubExpression( like );
         }
-        break;
+    break;
 
-        case 26: /* value_expr: value_expr "IN" '(' value_expr_list ')'  */
+  case 26: /* value_expr: value_expr "IN" '(' value_expr_list ')'  */
         {
             yyval = yyvsp[-1];
             yyval->field_type = SWQ_BOOLEAN;
             yyval->nOperation = SWQ_IN;
-            yyval->PushSubExpression(yyvsp[-4]);
+            yyval->PushSubExpression( yyvsp[-4] );
             yyval->ReverseSubExpressions();
         }
-        break;
+    break;
 
-        case 27: /* value_expr: value_expr "NOT" "IN" '(' value_expr_list ')'  */
+  case 27: /* value_expr: value_expr "NOT" "IN" '(' value_expr_list ')'  */
         {
             swq_expr_node *in = yyvsp[-1];
             in->field_type = SWQ_BOOLEAN;
             in->nOperation = SWQ_IN;
-            in->PushSubExpression(yyvsp[-5]);
+            in->PushSubExpression( yyvsp[-5] );
             in->ReverseSubExpressions();
 
-            yyval = new swq_expr_node(SWQ_NOT);
+            yyval = new swq_expr_node( SWQ_NOT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(in);
+            yyval->PushSubExpression( in );
         }
-        break;
+    break;
 
-        case 28: /* value_expr: value_expr "BETWEEN" value_expr_non_logical "AND" value_expr_non_logical  */
+  case 28: /* value_expr: value_expr "BETWEEN" value_expr_non_logical "AND" value_expr_non_logical  */
         {
-            yyval = new swq_expr_node(SWQ_BETWEEN);
+            yyval = new swq_expr_node( SWQ_BETWEEN );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-4]);
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval->PushSubExpression( yyvsp[-4] );
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 29: /* value_expr: value_expr "NOT" "BETWEEN" value_expr_non_logical "AND" value_expr_non_logical  */
+  case 29: /* value_expr: value_expr "NOT" "BETWEEN" value_expr_non_logical "AND" value_expr_non_logical  */
         {
-            swq_expr_node *between = new swq_expr_node(SWQ_BETWEEN);
+            swq_expr_node *between = new swq_expr_node( SWQ_BETWEEN );
             between->field_type = SWQ_BOOLEAN;
-            between->PushSubExpression(yyvsp[-5]);
-            between->PushSubExpression(yyvsp[-2]);
-            between->PushSubExpression(yyvsp[0]);
+            between->PushSubExpression( yyvsp[-5] );
+            between->PushSubExpression( yyvsp[-2] );
+            between->PushSubExpression( yyvsp[0] );
 
-            yyval = new swq_expr_node(SWQ_NOT);
+            yyval = new swq_expr_node( SWQ_NOT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(between);
+            yyval->PushSubExpression( between );
         }
-        break;
+    break;
 
-        case 30: /* value_expr: value_expr "IS" "NULL"  */
+  case 30: /* value_expr: value_expr "IS" "NULL"  */
         {
-            yyval = new swq_expr_node(SWQ_ISNULL);
+            yyval = new swq_expr_node( SWQ_ISNULL );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(yyvsp[-2]);
+            yyval->PushSubExpression( yyvsp[-2] );
         }
-        break;
+    break;
 
-        case 31: /* value_expr: value_expr "IS" "NOT" "NULL"  */
+  case 31: /* value_expr: value_expr "IS" "NOT" "NULL"  */
         {
-            swq_expr_node *isnull = new swq_expr_node(SWQ_ISNULL);
+            swq_expr_node *isnull = new swq_expr_node( SWQ_ISNULL );
             isnull->field_type = SWQ_BOOLEAN;
-            isnull->PushSubExpression(yyvsp[-3]);
+            isnull->PushSubExpression( yyvsp[-3] );
 
-            yyval = new swq_expr_node(SWQ_NOT);
+            yyval = new swq_expr_node( SWQ_NOT );
             yyval->field_type = SWQ_BOOLEAN;
-            yyval->PushSubExpression(isnull);
+            yyval->PushSubExpression( isnull );
         }
-        break;
+    break;
 
-        case 32: /* value_expr_list: value_expr ',' value_expr_list  */
+  case 32: /* value_expr_list: value_expr ',' value_expr_list  */
         {
             yyval = yyvsp[0];
-            yyvsp[0]->PushSubExpression(yyvsp[-2]);
+            yyvsp[0]->PushSubExpression( yyvsp[-2] );
         }
-        break;
+    break;
 
-        case 33: /* value_expr_list: value_expr  */
-        {
-            yyval = new swq_expr_node(SWQ_ARGUMENT_LIST); /* temporary value */
-            yyval->PushSubExpression(yyvsp[0]);
+  case 33: /* value_expr_list: value_expr  */
+            {
+            yyval = new swq_expr_node( SWQ_ARGUMENT_LIST ); /* temporary value */
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 34: /* field_value: "identifier"  */
+  case 34: /* field_value: "identifier"  */
         {
             yyval = yyvsp[0];  // validation deferred.
             yyval->eNodeType = SNT_COLUMN;
             yyval->field_index = -1;
             yyval->table_index = -1;
         }
-        break;
+    break;
 
-        case 35: /* field_value: "identifier" '.' "identifier"  */
+  case 35: /* field_value: "identifier" '.' "identifier"  */
         {
             yyval = yyvsp[-2];  // validation deferred.
             yyval->eNodeType = SNT_COLUMN;
@@ -1925,63 +2010,61 @@ yyreduce:
             delete yyvsp[0];
             yyvsp[0] = nullptr;
         }
-        break;
+    break;
 
-        case 36: /* value_expr_non_logical: "integer number"  */
+  case 36: /* value_expr_non_logical: "integer number"  */
         {
             yyval = yyvsp[0];
         }
-        break;
+    break;
 
-        case 37: /* value_expr_non_logical: "floating point number"  */
+  case 37: /* value_expr_non_logical: "floating point number"  */
         {
             yyval = yyvsp[0];
         }
-        break;
+    break;
 
-        case 38: /* value_expr_non_logical: "string"  */
+  case 38: /* value_expr_non_logical: "string"  */
         {
             yyval = yyvsp[0];
         }
-        break;
+    break;
 
-        case 39: /* value_expr_non_logical: field_value  */
+  case 39: /* value_expr_non_logical: field_value  */
         {
             yyval = yyvsp[0];
         }
-        break;
+    break;
 
-        case 40: /* value_expr_non_logical: '(' value_expr ')'  */
+  case 40: /* value_expr_non_logical: '(' value_expr ')'  */
         {
             yyval = yyvsp[-1];
         }
-        break;
+    break;
 
-        case 41: /* value_expr_non_logical: "NULL"  */
+  case 41: /* value_expr_non_logical: "NULL"  */
         {
-            yyval = new swq_expr_node(static_cast<const char *>(nullptr));
+            yyval = new swq_expr_node(static_cast<const char*>(nullptr));
         }
-        break;
+    break;
 
-        case 42: /* value_expr_non_logical: '-' value_expr_non_logical  */
+  case 42: /* value_expr_non_logical: '-' value_expr_non_logical  */
         {
             if (yyvsp[0]->eNodeType == SNT_CONSTANT)
             {
-                if (yyvsp[0]->field_type == SWQ_FLOAT &&
+                if( yyvsp[0]->field_type == SWQ_FLOAT &&
                     yyvsp[0]->string_value &&
-                    strcmp(yyvsp[0]->string_value, "9223372036854775808") == 0)
+                    strcmp(yyvsp[0]->string_value, "9223372036854775808") == 0 )
                 {
                     yyval = yyvsp[0];
                     yyval->field_type = SWQ_INTEGER64;
                     yyval->int_value = std::numeric_limits<GIntBig>::min();
-                    yyval->float_value = static_cast<double>(
-                        std::numeric_limits<GIntBig>::min());
+                    yyval->float_value = static_cast<double>(std::numeric_limits<GIntBig>::min());
                 }
                 // - (-9223372036854775808) cannot be represented on int64
                 // the classic overflow is that its negation is itself.
-                else if (yyvsp[0]->field_type == SWQ_INTEGER64 &&
-                         yyvsp[0]->int_value ==
-                             std::numeric_limits<GIntBig>::min())
+                else if( yyvsp[0]->field_type == SWQ_INTEGER64 &&
+                         yyvsp[0]->int_value == std::numeric_limits<GIntBig>::min() )
                 {
                     yyval = yyvsp[0];
                 }
@@ -1994,61 +2077,61 @@ yyreduce:
             }
             else
             {
-                yyval = new swq_expr_node(SWQ_MULTIPLY);
-                yyval->PushSubExpression(new swq_expr_node(-1));
-                yyval->PushSubExpression(yyvsp[0]);
+                yyval = new swq_expr_node( SWQ_MULTIPLY );
+                yyval->PushSubExpression( new swq_expr_node(-1) );
+                yyval->PushSubExpression( yyvsp[0] );
             }
         }
-        break;
+    break;
 
-        case 43: /* value_expr_non_logical: value_expr_non_logical '+' value_expr_non_logical  */
+  case 43: /* value_expr_non_logical: value_expr_non_logical '+' value_expr_non_logical  */
         {
-            yyval = new swq_expr_node(SWQ_ADD);
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval = new swq_expr_node( SWQ_ADD );
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 44: /* value_expr_non_logical: value_expr_non_logical '-' value_expr_non_logical  */
+  case 44: /* value_expr_non_logical: value_expr_non_logical '-' value_expr_non_logical  */
         {
-            yyval = new swq_expr_node(SWQ_SUBTRACT);
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval = new swq_expr_node( SWQ_SUBTRACT );
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 45: /* value_expr_non_logical: value_expr_non_logical '*' value_expr_non_logical  */
+  case 45: /* value_expr_non_logical: value_expr_non_logical '*' value_expr_non_logical  */
         {
-            yyval = new swq_expr_node(SWQ_MULTIPLY);
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval = new swq_expr_node( SWQ_MULTIPLY );
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 46: /* value_expr_non_logical: value_expr_non_logical '/' value_expr_non_logical  */
+  case 46: /* value_expr_non_logical: value_expr_non_logical '/' value_expr_non_logical  */
         {
-            yyval = new swq_expr_node(SWQ_DIVIDE);
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval = new swq_expr_node( SWQ_DIVIDE );
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 47: /* value_expr_non_logical: value_expr_non_logical '%' value_expr_non_logical  */
+  case 47: /* value_expr_non_logical: value_expr_non_logical '%' value_expr_non_logical  */
         {
-            yyval = new swq_expr_node(SWQ_MODULUS);
-            yyval->PushSubExpression(yyvsp[-2]);
-            yyval->PushSubExpression(yyvsp[0]);
+            yyval = new swq_expr_node( SWQ_MODULUS );
+            yyval->PushSubExpression( yyvsp[-2] );
+            yyval->PushSubExpression( yyvsp[0] );
         }
-        break;
+    break;
 
-        case 48: /* value_expr_non_logical: "identifier" '(' value_expr_list ')'  */
+  case 48: /* value_expr_non_logical: "identifier" '(' value_expr_list ')'  */
         {
             const swq_operation *poOp =
-                swq_op_registrar::GetOperator(yyvsp[-3]->string_value);
+                    swq_op_registrar::GetOperator( yyvsp[-3]->string_value );
 
-            if (poOp == nullptr)
+            if( poOp == nullptr )
             {
-                if (context->bAcceptCustomFuncs)
+                if( context->bAcceptCustomFuncs )
                 {
                     yyval = yyvsp[-1];
                     yyval->eNodeType = SNT_OPERATION;
@@ -2059,9 +2142,9 @@ yyreduce:
                 }
                 else
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Undefined function '%s' used.",
-                             yyvsp[-3]->string_value);
+                    CPLError( CE_Failure, CPLE_AppDefined,
+                                    "Undefined function '%s' used.",
+                                    yyvsp[-3]->string_value );
                     delete yyvsp[-3];
                     delete yyvsp[-1];
                     YYERROR;
@@ -2076,125 +2159,122 @@ yyreduce:
                 delete yyvsp[-3];
             }
         }
-        break;
+    break;
 
-        case 49: /* value_expr_non_logical: "CAST" '(' value_expr "AS" type_def ')'  */
+  case 49: /* value_expr_non_logical: "CAST" '(' value_expr "AS" type_def ')'  */
         {
             yyval = yyvsp[-1];
-            yyval->PushSubExpression(yyvsp[-3]);
+            yyval->PushSubExpression( yyvsp[-3] );
             yyval->ReverseSubExpressions();
         }
-        break;
+    break;
 
-        case 50: /* type_def: "identifier"  */
-        {
-            yyval = new swq_expr_node(SWQ_CAST);
-            yyval->PushSubExpression(yyvsp[0]);
-        }
-        break;
-
-        case 51: /* type_def: "identifier" '(' "integer number" ')'  */
-        {
-            yyval = new swq_expr_node(SWQ_CAST);
-            yyval->PushSubExpression(yyvsp[-1]);
-            yyval->PushSubExpression(yyvsp[-3]);
-        }
-        break;
+  case 50: /* type_def: "identifier"  */
+    {
+        yyval = new swq_expr_node( SWQ_CAST );
+        yyval->PushSubExpression( yyvsp[0] );
+    }
+    break;
 
-        case 52: /* type_def: "identifier" '(' "integer number" ',' "integer number" ')'  */
-        {
-            yyval = new swq_expr_node(SWQ_CAST);
-            yyval->PushSubExpression(yyvsp[-1]);
-            yyval->PushSubExpression(yyvsp[-3]);
-            yyval->PushSubExpression(yyvsp[-5]);
-        }
-        break;
+  case 51: /* type_def: "identifier" '(' "integer number" ')'  */
+    {
+        yyval = new swq_expr_node( SWQ_CAST );
+        yyval->PushSubExpression( yyvsp[-1] );
+        yyval->PushSubExpression( yyvsp[-3] );
+    }
+    break;
 
-        case 53: /* type_def: "identifier" '(' "identifier" ')'  */
-        {
-            OGRwkbGeometryType eType =
-                OGRFromOGCGeomType(yyvsp[-1]->string_value);
-            if (!EQUAL(yyvsp[-3]->string_value, "GEOMETRY") ||
-                (wkbFlatten(eType) == wkbUnknown &&
-                 !STARTS_WITH_CI(yyvsp[-1]->string_value, "GEOMETRY")))
-            {
-                yyerror(context, "syntax error");
-                delete yyvsp[-3];
-                delete yyvsp[-1];
-                YYERROR;
-            }
-            yyval = new swq_expr_node(SWQ_CAST);
-            yyval->PushSubExpression(yyvsp[-1]);
-            yyval->PushSubExpression(yyvsp[-3]);
-        }
-        break;
+  case 52: /* type_def: "identifier" '(' "integer number" ',' "integer number" ')'  */
+    {
+        yyval = new swq_expr_node( SWQ_CAST );
+        yyval->PushSubExpression( yyvsp[-1] );
+        yyval->PushSubExpression( yyvsp[-3] );
+        yyval->PushSubExpression( yyvsp[-5] );
+    }
+    break;
 
-        case 54: /* type_def: "identifier" '(' "identifier" ',' "integer number" ')'  */
+  case 53: /* type_def: "identifier" '(' "identifier" ')'  */
+    {
+        OGRwkbGeometryType eType = OGRFromOGCGeomType(yyvsp[-1]->string_value);
+        if( !EQUAL(yyvsp[-3]->string_value, "GEOMETRY") ||
+            (wkbFlatten(eType) == wkbUnknown &&
+            !STARTS_WITH_CI(yyvsp[-1]->string_value, "GEOMETRY")) )
         {
-            OGRwkbGeometryType eType =
-                OGRFromOGCGeomType(yyvsp[-3]->string_value);
-            if (!EQUAL(yyvsp[-5]->string_value, "GEOMETRY") ||
-                (wkbFlatten(eType) == wkbUnknown &&
-                 !STARTS_WITH_CI(yyvsp[-3]->string_value, "GEOMETRY")))
-            {
-                yyerror(context, "syntax error");
-                delete yyvsp[-5];
-                delete yyvsp[-3];
-                delete yyvsp[-1];
-                YYERROR;
-            }
-            yyval = new swq_expr_node(SWQ_CAST);
-            yyval->PushSubExpression(yyvsp[-1]);
-            yyval->PushSubExpression(yyvsp[-3]);
-            yyval->PushSubExpression(yyvsp[-5]);
+            yyerror (context, "syntax error");
+            delete yyvsp[-3];
+            delete yyvsp[-1];
+            YYERROR;
         }
-        break;
+        yyval = new swq_expr_node( SWQ_CAST );
+        yyval->PushSubExpression( yyvsp[-1] );
+        yyval->PushSubExpression( yyvsp[-3] );
+    }
+    break;
 
-        case 57: /* select_core: "SELECT" select_field_list "FROM" table_def opt_joins opt_where opt_order_by opt_limit opt_offset  */
+  case 54: /* type_def: "identifier" '(' "identifier" ',' "integer number" ')'  */
+    {
+        OGRwkbGeometryType eType = OGRFromOGCGeomType(yyvsp[-3]->string_value);
+        if( !EQUAL(yyvsp[-5]->string_value, "GEOMETRY") ||
+            (wkbFlatten(eType) == wkbUnknown &&
+            !STARTS_WITH_CI(yyvsp[-3]->string_value, "GEOMETRY")) )
         {
+            yyerror (context, "syntax error");
             delete yyvsp[-5];
+            delete yyvsp[-3];
+            delete yyvsp[-1];
+            YYERROR;
         }
-        break;
+        yyval = new swq_expr_node( SWQ_CAST );
+        yyval->PushSubExpression( yyvsp[-1] );
+        yyval->PushSubExpression( yyvsp[-3] );
+        yyval->PushSubExpression( yyvsp[-5] );
+    }
+    break;
 
-        case 58: /* select_core: "SELECT" "DISTINCT" select_field_list "FROM" table_def opt_joins opt_where opt_order_by opt_limit opt_offset  */
-        {
-            context->poCurSelect->query_mode = SWQM_DISTINCT_LIST;
-            delete yyvsp[-5];
-        }
-        break;
+  case 57: /* select_core: "SELECT" select_field_list "FROM" table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset  */
+    {
+        delete yyvsp[-6];
+    }
+    break;
 
-        case 61: /* union_all: "UNION" "ALL"  */
-        {
-            swq_select *poNewSelect = new swq_select();
-            context->poCurSelect->PushUnionAll(poNewSelect);
-            context->poCurSelect = poNewSelect;
-        }
-        break;
+  case 58: /* select_core: "SELECT" "DISTINCT" select_field_list "FROM" table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset  */
+    {
+        context->poCurSelect->query_mode = SWQM_DISTINCT_LIST;
+        delete yyvsp[-6];
+    }
+    break;
 
-        case 64: /* exclude_field: field_value  */
+  case 61: /* union_all: "UNION" "ALL"  */
+    {
+        swq_select* poNewSelect = new swq_select();
+        context->poCurSelect->PushUnionAll(poNewSelect);
+        context->poCurSelect = poNewSelect;
+    }
+    break;
+
+  case 64: /* exclude_field: field_value  */
         {
-            if (!context->poCurSelect->PushExcludeField(yyvsp[0]))
+            if ( !context->poCurSelect->PushExcludeField( yyvsp[0] ) )
             {
                 delete yyvsp[0];
                 YYERROR;
             }
         }
-        break;
+    break;
 
-        case 69: /* column_spec: value_expr  */
+  case 69: /* column_spec: value_expr  */
         {
-            if (!context->poCurSelect->PushField(yyvsp[0]))
+            if( !context->poCurSelect->PushField( yyvsp[0] ) )
             {
                 delete yyvsp[0];
                 YYERROR;
             }
         }
-        break;
+    break;
 
-        case 70: /* column_spec: value_expr as_clause  */
+  case 70: /* column_spec: value_expr as_clause  */
         {
-            if (!context->poCurSelect->PushField(yyvsp[-1],
-                                                 yyvsp[0]->string_value))
+            if( !context->poCurSelect->PushField( yyvsp[-1], yyvsp[0]->string_value ) )
             {
                 delete yyvsp[-1];
                 delete yyvsp[0];
@@ -2202,41 +2282,41 @@ yyreduce:
             }
             delete yyvsp[0];
         }
-        break;
+    break;
 
-        case 71: /* column_spec: '*' except_or_exclude '(' exclude_field_list ')'  */
+  case 71: /* column_spec: '*' except_or_exclude '(' exclude_field_list ')'  */
         {
             swq_expr_node *poNode = new swq_expr_node();
             poNode->eNodeType = SNT_COLUMN;
-            poNode->string_value = CPLStrdup("*");
+            poNode->string_value = CPLStrdup( "*" );
             poNode->table_index = -1;
             poNode->field_index = -1;
 
-            if (!context->poCurSelect->PushField(poNode))
+            if( !context->poCurSelect->PushField( poNode ) )
             {
                 delete poNode;
                 YYERROR;
             }
         }
-        break;
+    break;
 
-        case 72: /* column_spec: '*'  */
+  case 72: /* column_spec: '*'  */
         {
             swq_expr_node *poNode = new swq_expr_node();
             poNode->eNodeType = SNT_COLUMN;
-            poNode->string_value = CPLStrdup("*");
+            poNode->string_value = CPLStrdup( "*" );
             poNode->table_index = -1;
             poNode->field_index = -1;
 
-            if (!context->poCurSelect->PushField(poNode))
+            if( !context->poCurSelect->PushField( poNode ) )
             {
                 delete poNode;
                 YYERROR;
             }
         }
-        break;
+    break;
 
-        case 73: /* column_spec: "identifier" '.' '*'  */
+  case 73: /* column_spec: "identifier" '.' '*'  */
         {
             CPLString osTableName = yyvsp[-2]->string_value;
 
@@ -2245,26 +2325,27 @@ yyreduce:
 
             swq_expr_node *poNode = new swq_expr_node();
             poNode->eNodeType = SNT_COLUMN;
-            poNode->table_name = CPLStrdup(osTableName);
-            poNode->string_value = CPLStrdup("*");
+            poNode->table_name = CPLStrdup(osTableName );
+            poNode->string_value = CPLStrdup( "*" );
             poNode->table_index = -1;
             poNode->field_index = -1;
 
-            if (!context->poCurSelect->PushField(poNode))
+            if( !context->poCurSelect->PushField( poNode ) )
             {
                 delete poNode;
                 YYERROR;
             }
         }
-        break;
+    break;
 
-        case 74: /* column_spec: "identifier" '(' '*' ')'  */
+  case 74: /* column_spec: "identifier" '(' '*' ')'  */
         {
-            // special case for COUNT(*), confirm it.
-            if (!EQUAL(yyvsp[-3]->string_value, "COUNT"))
+                // special case for COUNT(*), confirm it.
+            if( !EQUAL(yyvsp[-3]->string_value, "COUNT") )
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Syntax Error with %s(*).", yyvsp[-3]->string_value);
+                CPLError( CE_Failure, CPLE_AppDefined,
+                        "Syntax Error with %s(*).",
+                        yyvsp[-3]->string_value );
                 delete yyvsp[-3];
                 YYERROR;
             }
@@ -2274,28 +2355,29 @@ yyreduce:
 
             swq_expr_node *poNode = new swq_expr_node();
             poNode->eNodeType = SNT_COLUMN;
-            poNode->string_value = CPLStrdup("*");
+            poNode->string_value = CPLStrdup( "*" );
             poNode->table_index = -1;
             poNode->field_index = -1;
 
-            swq_expr_node *count = new swq_expr_node(SWQ_COUNT);
-            count->PushSubExpression(poNode);
+            swq_expr_node *count = new swq_expr_node( SWQ_COUNT );
+            count->PushSubExpression( poNode );
 
-            if (!context->poCurSelect->PushField(count))
+            if( !context->poCurSelect->PushField( count ) )
             {
                 delete count;
                 YYERROR;
             }
         }
-        break;
+    break;
 
-        case 75: /* column_spec: "identifier" '(' '*' ')' as_clause  */
+  case 75: /* column_spec: "identifier" '(' '*' ')' as_clause  */
         {
-            // special case for COUNT(*), confirm it.
-            if (!EQUAL(yyvsp[-4]->string_value, "COUNT"))
+                // special case for COUNT(*), confirm it.
+            if( !EQUAL(yyvsp[-4]->string_value, "COUNT") )
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Syntax Error with %s(*).", yyvsp[-4]->string_value);
+                CPLError( CE_Failure, CPLE_AppDefined,
+                        "Syntax Error with %s(*).",
+                        yyvsp[-4]->string_value );
                 delete yyvsp[-4];
                 delete yyvsp[0];
                 YYERROR;
@@ -2306,14 +2388,14 @@ yyreduce:
 
             swq_expr_node *poNode = new swq_expr_node();
             poNode->eNodeType = SNT_COLUMN;
-            poNode->string_value = CPLStrdup("*");
+            poNode->string_value = CPLStrdup( "*" );
             poNode->table_index = -1;
             poNode->field_index = -1;
 
-            swq_expr_node *count = new swq_expr_node(SWQ_COUNT);
-            count->PushSubExpression(poNode);
+            swq_expr_node *count = new swq_expr_node( SWQ_COUNT );
+            count->PushSubExpression( poNode );
 
-            if (!context->poCurSelect->PushField(count, yyvsp[0]->string_value))
+            if( !context->poCurSelect->PushField( count, yyvsp[0]->string_value ) )
             {
                 delete count;
                 delete yyvsp[0];
@@ -2322,53 +2404,51 @@ yyreduce:
 
             delete yyvsp[0];
         }
-        break;
+    break;
 
-        case 76: /* column_spec: "identifier" '(' "DISTINCT" field_value ')'  */
+  case 76: /* column_spec: "identifier" '(' "DISTINCT" field_value ')'  */
         {
-            // special case for COUNT(DISTINCT x), confirm it.
-            if (!EQUAL(yyvsp[-4]->string_value, "COUNT"))
+                // special case for COUNT(DISTINCT x), confirm it.
+            if( !EQUAL(yyvsp[-4]->string_value, "COUNT") )
             {
                 CPLError(
                     CE_Failure, CPLE_AppDefined,
-                    "DISTINCT keyword can only be used in COUNT() operator.");
+                    "DISTINCT keyword can only be used in COUNT() operator." );
                 delete yyvsp[-4];
                 delete yyvsp[-1];
-                YYERROR;
+                    YYERROR;
             }
 
             delete yyvsp[-4];
 
-            swq_expr_node *count = new swq_expr_node(SWQ_COUNT);
-            count->PushSubExpression(yyvsp[-1]);
+            swq_expr_node *count = new swq_expr_node( SWQ_COUNT );
+            count->PushSubExpression( yyvsp[-1] );
 
-            if (!context->poCurSelect->PushField(count, nullptr, TRUE))
+            if( !context->poCurSelect->PushField( count, nullptr, TRUE ) )
             {
                 delete count;
                 YYERROR;
             }
         }
-        break;
+    break;
 
-        case 77: /* column_spec: "identifier" '(' "DISTINCT" field_value ')' as_clause  */
+  case 77: /* column_spec: "identifier" '(' "DISTINCT" field_value ')' as_clause  */
         {
             // special case for COUNT(DISTINCT x), confirm it.
-            if (!EQUAL(yyvsp[-5]->string_value, "COUNT"))
+            if( !EQUAL(yyvsp[-5]->string_value, "COUNT") )
             {
-                CPLError(
-                    CE_Failure, CPLE_AppDefined,
-                    "DISTINCT keyword can only be used in COUNT() operator.");
+                CPLError( CE_Failure, CPLE_AppDefined,
+                        "DISTINCT keyword can only be used in COUNT() operator." );
                 delete yyvsp[-5];
                 delete yyvsp[-2];
                 delete yyvsp[0];
                 YYERROR;
             }
 
-            swq_expr_node *count = new swq_expr_node(SWQ_COUNT);
-            count->PushSubExpression(yyvsp[-2]);
+            swq_expr_node *count = new swq_expr_node( SWQ_COUNT );
+            count->PushSubExpression( yyvsp[-2] );
 
-            if (!context->poCurSelect->PushField(count, yyvsp[0]->string_value,
-                                                 TRUE))
+            if( !context->poCurSelect->PushField( count, yyvsp[0]->string_value, TRUE ) )
             {
                 delete yyvsp[-5];
                 delete count;
@@ -2379,153 +2459,165 @@ yyreduce:
             delete yyvsp[-5];
             delete yyvsp[0];
         }
-        break;
+    break;
 
-        case 78: /* as_clause: "AS" "identifier"  */
+  case 78: /* as_clause: "AS" "identifier"  */
         {
             delete yyvsp[-1];
             yyval = yyvsp[0];
         }
-        break;
+    break;
 
-        case 81: /* opt_where: "WHERE" value_expr  */
+  case 81: /* opt_where: "WHERE" value_expr  */
         {
             context->poCurSelect->where_expr = yyvsp[0];
         }
-        break;
+    break;
 
-        case 83: /* opt_joins: "JOIN" table_def "ON" value_expr opt_joins  */
+  case 83: /* opt_joins: "JOIN" table_def "ON" value_expr opt_joins  */
         {
-            context->poCurSelect->PushJoin(
-                static_cast<int>(yyvsp[-3]->int_value), yyvsp[-1]);
+            context->poCurSelect->PushJoin( static_cast<int>(yyvsp[-3]->int_value),
+                                            yyvsp[-1] );
             delete yyvsp[-3];
         }
-        break;
+    break;
 
-        case 84: /* opt_joins: "LEFT" "JOIN" table_def "ON" value_expr opt_joins  */
+  case 84: /* opt_joins: "LEFT" "JOIN" table_def "ON" value_expr opt_joins  */
         {
-            context->poCurSelect->PushJoin(
-                static_cast<int>(yyvsp[-3]->int_value), yyvsp[-1]);
+            context->poCurSelect->PushJoin( static_cast<int>(yyvsp[-3]->int_value),
+                                            yyvsp[-1] );
             delete yyvsp[-3];
         }
-        break;
+    break;
 
-        case 89: /* sort_spec: field_value  */
+  case 89: /* group_by_spec: field_value  */
         {
-            context->poCurSelect->PushOrderBy(yyvsp[0]->table_name,
-                                              yyvsp[0]->string_value, TRUE);
+            context->poCurSelect->PushGroupBy( yyvsp[0]->table_name, yyvsp[0]->string_value );
             delete yyvsp[0];
             yyvsp[0] = nullptr;
         }
-        break;
+    break;
 
-        case 90: /* sort_spec: field_value "ASC"  */
+  case 94: /* sort_spec: field_value  */
         {
-            context->poCurSelect->PushOrderBy(yyvsp[-1]->table_name,
-                                              yyvsp[-1]->string_value, TRUE);
-            delete yyvsp[-1];
-            yyvsp[-1] = nullptr;
+            context->poCurSelect->PushOrderBy( yyvsp[0]->table_name, yyvsp[0]->string_value, TRUE );
+            delete yyvsp[0];
+            yyvsp[0] = nullptr;
         }
-        break;
+    break;
 
-        case 91: /* sort_spec: field_value "DESC"  */
+  case 95: /* sort_spec: field_value "ASC"  */
         {
-            context->poCurSelect->PushOrderBy(yyvsp[-1]->table_name,
-                                              yyvsp[-1]->string_value, FALSE);
+            context->poCurSelect->PushOrderBy( yyvsp[-1]->table_name, yyvsp[-1]->string_value, TRUE );
             delete yyvsp[-1];
             yyvsp[-1] = nullptr;
         }
-        break;
+    break;
 
-        case 93: /* opt_limit: "LIMIT" "integer number"  */
+  case 96: /* sort_spec: field_value "DESC"  */
         {
-            context->poCurSelect->SetLimit(yyvsp[0]->int_value);
-            delete yyvsp[0];
-            yyvsp[0] = nullptr;
+            context->poCurSelect->PushOrderBy( yyvsp[-1]->table_name, yyvsp[-1]->string_value, FALSE );
+            delete yyvsp[-1];
+            yyvsp[-1] = nullptr;
         }
-        break;
+    break;
 
-        case 95: /* opt_offset: "OFFSET" "integer number"  */
-        {
-            context->poCurSelect->SetOffset(yyvsp[0]->int_value);
-            delete yyvsp[0];
-            yyvsp[0] = nullptr;
-        }
-        break;
+  case 98: /* opt_limit: "LIMIT" "integer number"  */
+    {
+        context->poCurSelect->SetLimit( yyvsp[0]->int_value );
+        delete yyvsp[0];
+        yyvsp[0] = nullptr;
+    }
+    break;
 
-        case 96: /* table_def: "identifier"  */
-        {
-            const int iTable = context->poCurSelect->PushTableDef(
-                nullptr, yyvsp[0]->string_value, nullptr);
-            delete yyvsp[0];
+  case 100: /* opt_offset: "OFFSET" "integer number"  */
+    {
+        context->poCurSelect->SetOffset( yyvsp[0]->int_value );
+        delete yyvsp[0];
+        yyvsp[0] = nullptr;
+    }
+    break;
 
-            yyval = new swq_expr_node(iTable);
-        }
-        break;
+  case 101: /* table_def: "identifier"  */
+    {
+        const int iTable =
+            context->poCurSelect->PushTableDef( nullptr, yyvsp[0]->string_value,
+                                                nullptr );
+        delete yyvsp[0];
 
-        case 97: /* table_def: "identifier" as_clause  */
-        {
-            const int iTable = context->poCurSelect->PushTableDef(
-                nullptr, yyvsp[-1]->string_value, yyvsp[0]->string_value);
-            delete yyvsp[-1];
-            delete yyvsp[0];
+        yyval = new swq_expr_node( iTable );
+    }
+    break;
 
-            yyval = new swq_expr_node(iTable);
-        }
-        break;
+  case 102: /* table_def: "identifier" as_clause  */
+    {
+        const int iTable =
+            context->poCurSelect->PushTableDef( nullptr, yyvsp[-1]->string_value,
+                                                yyvsp[0]->string_value );
+        delete yyvsp[-1];
+        delete yyvsp[0];
 
-        case 98: /* table_def: "string" '.' "identifier"  */
-        {
-            const int iTable = context->poCurSelect->PushTableDef(
-                yyvsp[-2]->string_value, yyvsp[0]->string_value, nullptr);
-            delete yyvsp[-2];
-            delete yyvsp[0];
+        yyval = new swq_expr_node( iTable );
+    }
+    break;
 
-            yyval = new swq_expr_node(iTable);
-        }
-        break;
+  case 103: /* table_def: "string" '.' "identifier"  */
+    {
+        const int iTable =
+            context->poCurSelect->PushTableDef( yyvsp[-2]->string_value,
+                                                yyvsp[0]->string_value, nullptr );
+        delete yyvsp[-2];
+        delete yyvsp[0];
 
-        case 99: /* table_def: "string" '.' "identifier" as_clause  */
-        {
-            const int iTable = context->poCurSelect->PushTableDef(
-                yyvsp[-3]->string_value, yyvsp[-1]->string_value,
-                yyvsp[0]->string_value);
-            delete yyvsp[-3];
-            delete yyvsp[-1];
-            delete yyvsp[0];
+        yyval = new swq_expr_node( iTable );
+    }
+    break;
 
-            yyval = new swq_expr_node(iTable);
-        }
-        break;
+  case 104: /* table_def: "string" '.' "identifier" as_clause  */
+    {
+        const int iTable =
+            context->poCurSelect->PushTableDef( yyvsp[-3]->string_value,
+                                                yyvsp[-1]->string_value,
+                                                yyvsp[0]->string_value );
+        delete yyvsp[-3];
+        delete yyvsp[-1];
+        delete yyvsp[0];
+
+        yyval = new swq_expr_node( iTable );
+    }
+    break;
 
-        case 100: /* table_def: "identifier" '.' "identifier"  */
-        {
-            const int iTable = context->poCurSelect->PushTableDef(
-                yyvsp[-2]->string_value, yyvsp[0]->string_value, nullptr);
-            delete yyvsp[-2];
-            delete yyvsp[0];
+  case 105: /* table_def: "identifier" '.' "identifier"  */
+    {
+        const int iTable =
+            context->poCurSelect->PushTableDef( yyvsp[-2]->string_value,
+                                                yyvsp[0]->string_value, nullptr );
+        delete yyvsp[-2];
+        delete yyvsp[0];
 
-            yyval = new swq_expr_node(iTable);
-        }
-        break;
+        yyval = new swq_expr_node( iTable );
+    }
+    break;
 
-        case 101: /* table_def: "identifier" '.' "identifier" as_clause  */
-        {
-            const int iTable = context->poCurSelect->PushTableDef(
-                yyvsp[-3]->string_value, yyvsp[-1]->string_value,
-                yyvsp[0]->string_value);
-            delete yyvsp[-3];
-            delete yyvsp[-1];
-            delete yyvsp[0];
+  case 106: /* table_def: "identifier" '.' "identifier" as_clause  */
+    {
+        const int iTable =
+            context->poCurSelect->PushTableDef( yyvsp[-3]->string_value,
+                                                yyvsp[-1]->string_value,
+                                                yyvsp[0]->string_value );
+        delete yyvsp[-3];
+        delete yyvsp[-1];
+        delete yyvsp[0];
+
+        yyval = new swq_expr_node( iTable );
+    }
+    break;
 
-            yyval = new swq_expr_node(iTable);
-        }
-        break;
 
-        default:
-            break;
+
+      default: break;
     }
-    /* User semantic actions sometimes alter yychar, and that requires
+  /* User semantic actions sometimes alter yychar, and that requires
      that yytoken be updated with the new translation.  We take the
      approach of translating immediately before every use of yytoken.
      One alternative is translating here after every semantic action,
@@ -2536,203 +2628,212 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-    YY_SYMBOL_PRINT("-> $$ =", YY_CAST(yysymbol_kind_t, yyr1[yyn]), &yyval,
-                    &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
-    YYPOPSTACK(yylen);
-    yylen = 0;
+  YYPOPSTACK (yylen);
+  yylen = 0;
 
-    *++yyvsp = yyval;
+  *++yyvsp = yyval;
 
-    /* Now 'shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-    {
-        const int yylhs = yyr1[yyn] - YYNTOKENS;
-        const int yyi = yypgoto[yylhs] + *yyssp;
-        yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
-                       ? yytable[yyi]
-                       : yydefgoto[yylhs]);
-    }
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
 
-    goto yynewstate;
 
 /*--------------------------------------.
 | yyerrlab -- here on detecting error.  |
 `--------------------------------------*/
 yyerrlab:
-    /* Make sure we have latest lookahead translation.  See comments at
+  /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-    yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE(yychar);
-    /* If not already recovering from an error, report this error.  */
-    if (!yyerrstatus)
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
     {
-        ++yynerrs;
-        (void)yynerrs;
-        {
-            yypcontext_t yyctx = {yyssp, yytoken};
-            char const *yymsgp = YY_("syntax error");
-            int yysyntax_error_status;
-            yysyntax_error_status =
-                yysyntax_error(&yymsg_alloc, &yymsg, &yyctx);
-            if (yysyntax_error_status == 0)
+      ++yynerrs; (void)yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
                 yymsgp = yymsg;
-            else if (yysyntax_error_status == -1)
-            {
-                if (yymsg != yymsgbuf)
-                    YYSTACK_FREE(yymsg);
-                yymsg = YY_CAST(char *,
-                                YYSTACK_ALLOC(YY_CAST(YYSIZE_T, yymsg_alloc)));
-                if (yymsg)
-                {
-                    yysyntax_error_status =
-                        yysyntax_error(&yymsg_alloc, &yymsg, &yyctx);
-                    yymsgp = yymsg;
-                }
-                else
-                {
-                    yymsg = yymsgbuf;
-                    yymsg_alloc = sizeof yymsgbuf;
-                    yysyntax_error_status = YYENOMEM;
-                }
-            }
-            yyerror(context, yymsgp);
-            if (yysyntax_error_status == YYENOMEM)
-                YYNOMEM;
-        }
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (context, yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
     }
 
-    if (yyerrstatus == 3)
+  if (yyerrstatus == 3)
     {
-        /* If just tried and failed to reuse lookahead token after an
+      /* If just tried and failed to reuse lookahead token after an
          error, discard it.  */
 
-        if (yychar <= END)
+      if (yychar <= END)
         {
-            /* Return failure if at end of input.  */
-            if (yychar == END)
-                YYABORT;
+          /* Return failure if at end of input.  */
+          if (yychar == END)
+            YYABORT;
         }
-        else
+      else
         {
-            yydestruct("Error: discarding", yytoken, &yylval, context);
-            yychar = YYEMPTY;
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, context);
+          yychar = YYEMPTY;
         }
     }
 
-    /* Else will try to reuse lookahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
-    goto yyerrlab1;
+  goto yyerrlab1;
+
 
 /*---------------------------------------------------.
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-    /* Pacify compilers when the user code never invokes YYERROR and the
+  /* Pacify compilers when the user code never invokes YYERROR and the
      label yyerrorlab therefore never appears in user code.  */
-    if (0)
-        YYERROR;
-    ++yynerrs;
-    (void)yynerrs;
+  if (0)
+    YYERROR;
+  ++yynerrs; (void)yynerrs;
 
-    /* Do not reclaim the symbols of the rule whose action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
-    YYPOPSTACK(yylen);
-    yylen = 0;
-    YY_STACK_PRINT(yyss, yyssp);
-    yystate = *yyssp;
-    goto yyerrlab1;
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
 
 /*-------------------------------------------------------------.
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-    yyerrstatus = 3; /* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
-    /* Pop stack until we find a state that shifts the error token.  */
-    for (;;)
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
     {
-        yyn = yypact[yystate];
-        if (!yypact_value_is_default(yyn))
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
         {
-            yyn += YYSYMBOL_YYerror;
-            if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
-                yyn = yytable[yyn];
-                if (0 < yyn)
-                    break;
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
             }
         }
 
-        /* Pop the current state because it cannot handle the error token.  */
-        if (yyssp == yyss)
-            YYABORT;
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
 
-        yydestruct("Error: popping", YY_ACCESSING_SYMBOL(yystate), yyvsp,
-                   context);
-        YYPOPSTACK(1);
-        yystate = *yyssp;
-        YY_STACK_PRINT(yyss, yyssp);
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, context);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
     }
 
-    YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-    *++yyvsp = yylval;
-    YY_IGNORE_MAYBE_UNINITIALIZED_END
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
-    /* Shift the error token.  */
-    YY_SYMBOL_PRINT("Shifting", YY_ACCESSING_SYMBOL(yyn), yyvsp, yylsp);
 
-    yystate = yyn;
-    goto yynewstate;
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
 
 /*-------------------------------------.
 | yyacceptlab -- YYACCEPT comes here.  |
 `-------------------------------------*/
 yyacceptlab:
-    yyresult = 0;
-    goto yyreturnlab;
+  yyresult = 0;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
-    yyresult = 1;
-    goto yyreturnlab;
+  yyresult = 1;
+  goto yyreturnlab;
+
 
 /*-----------------------------------------------------------.
 | yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
 `-----------------------------------------------------------*/
 yyexhaustedlab:
-    yyerror(context, YY_("memory exhausted"));
-    yyresult = 2;
-    goto yyreturnlab;
+  yyerror (context, YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
 
 /*----------------------------------------------------------.
 | yyreturnlab -- parsing is finished, clean up and return.  |
 `----------------------------------------------------------*/
 yyreturnlab:
-    if (yychar != YYEMPTY)
+  if (yychar != YYEMPTY)
     {
-        /* Make sure we have latest lookahead translation.  See comments at
+      /* Make sure we have latest lookahead translation.  See comments at
          user semantic actions for why this is necessary.  */
-        yytoken = YYTRANSLATE(yychar);
-        yydestruct("Cleanup: discarding lookahead", yytoken, &yylval, context);
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, context);
     }
-    /* Do not reclaim the symbols of the rule whose action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
-    YYPOPSTACK(yylen);
-    YY_STACK_PRINT(yyss, yyssp);
-    while (yyssp != yyss)
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
     {
-        yydestruct("Cleanup: popping", YY_ACCESSING_SYMBOL(+*yyssp), yyvsp,
-                   context);
-        YYPOPSTACK(1);
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, context);
+      YYPOPSTACK (1);
     }
 #ifndef yyoverflow
-    if (yyss != yyssa)
-        YYSTACK_FREE(yyss);
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
 #endif
-    if (yymsg != yymsgbuf)
-        YYSTACK_FREE(yymsg);
-    return yyresult;
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
 }
+
@@ -100,6 +100,12 @@ swq_select::~swq_select()
 
     CPLFree(order_defs);
 
+    for (auto &def : group_by_defs)
+    {
+        CPLFree(def.table_name);
+        CPLFree(def.field_name);
+    }
+
     for (int i = 0; i < join_count; i++)
     {
         delete join_defs[i].poExpr;
@@ -286,6 +292,18 @@ char *swq_select::Unparse()
         CPLFree(pszTmp);
     }
 
+    if (!group_by_defs.empty())
+    {
+        osSelect += " GROUP BY ";
+        for (size_t i = 0; i < group_by_defs.size(); i++)
+        {
+            if (i > 0)
+                osSelect += ", ";
+            osSelect += swq_expr_node::QuoteIfNecessary(
+                group_by_defs[i].field_name, '"');
+        }
+    }
+
     if (order_specs > 0)
     {
         osSelect += " ORDER BY ";
@@ -693,6 +711,21 @@ void swq_select::PushOrderBy(const char *pszTableName, const char *pszFieldName,
     order_defs[order_specs - 1].ascending_flag = bAscending;
 }
 
+/************************************************************************/
+/*                            PushGroupBy()                             */
+/************************************************************************/
+
+void swq_select::PushGroupBy(const char *pszTableName, const char *pszFieldName)
+
+{
+    swq_group_by_def def;
+    def.table_name = CPLStrdup(pszTableName ? pszTableName : "");
+    def.field_name = CPLStrdup(pszFieldName);
+    def.table_index = -1;
+    def.field_index = -1;
+    group_by_defs.push_back(def);
+}
+
 /************************************************************************/
 /*                              PushJoin()                              */
 /************************************************************************/
@@ -1016,6 +1049,63 @@ CPLErr swq_select::parse(swq_field_list *field_list,
     /*      indications.                                                    */
     /* -------------------------------------------------------------------- */
 
+    /* -------------------------------------------------------------------- */
+    /*      Process column names in GROUP BY specs.                         */
+    /* -------------------------------------------------------------------- */
+    if (!group_by_defs.empty())
+    {
+        if (query_mode == SWQM_DISTINCT_LIST)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "SELECT DISTINCT not supported with GROUP BY.");
+            return CE_Failure;
+        }
+
+        if (join_count > 0)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "GROUP BY not supported with JOIN.");
+            return CE_Failure;
+        }
+
+        for (auto &def : group_by_defs)
+        {
+            swq_field_type field_type;
+            def.field_index =
+                swq_identify_field(def.table_name, def.field_name, field_list,
+                                   &field_type, &(def.table_index));
+            if (def.field_index == -1)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Unrecognized field name %s in GROUP BY.",
+                         def.table_name[0]
+                             ? CPLSPrintf("%s.%s", def.table_name,
+                                          def.field_name)
+                             : def.field_name);
+                return CE_Failure;
+            }
+
+            if (field_type == SWQ_GEOMETRY)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot use geometry field '%s' in a GROUP BY clause",
+                         def.field_name);
+                return CE_Failure;
+            }
+        }
+    }
+
+    const auto IsGroupByField = [this](int table_index, int field_index)
+    {
+        for (const auto &def : group_by_defs)
+        {
+            if (def.table_index == table_index &&
+                def.field_index == field_index)
+                return true;
+        }
+        return false;
+    };
+
     int bAllowDistinctOnMultipleFields =
         (poParseOptions && poParseOptions->bAllowDistinctOnMultipleFields);
     if (query_mode == SWQM_DISTINCT_LIST && result_columns() > 1 &&
@@ -1067,6 +1157,23 @@ CPLErr swq_select::parse(swq_field_list *field_list,
                 this_indicator = SWQM_RECORDSET;
         }
 
+        if (!group_by_defs.empty())
+        {
+            // Non-aggregated columns must be one of the GROUP BY fields
+            if (this_indicator == SWQM_RECORDSET &&
+                ((def->expr != nullptr && def->expr->eNodeType != SNT_COLUMN) ||
+                 !IsGroupByField(def->table_index, def->field_index)))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Column %s must appear in the GROUP BY clause or be "
+                         "used in an aggregate function.",
+                         def->field_alias ? def->field_alias
+                                          : def->field_name);
+                return CE_Failure;
+            }
+            continue;
+        }
+
         if (this_indicator != query_mode && this_indicator != -1 &&
             query_mode != 0)
         {
@@ -1080,7 +1187,11 @@ CPLErr swq_select::parse(swq_field_list *field_list,
             query_mode = this_indicator;
     }
 
-    if (result_columns() == 0)
+    if (!group_by_defs.empty())
+    {
+        query_mode = SWQM_GROUP_BY;
+    }
+    else if (result_columns() == 0)
     {
         query_mode = SWQM_RECORDSET;
     }
@@ -1137,6 +1248,30 @@ CPLErr swq_select::parse(swq_field_list *field_list,
                      def->field_name);
             return CE_Failure;
         }
+
+        // The result of a GROUP BY query is sorted on its output columns
+        if (query_mode == SWQM_GROUP_BY)
+        {
+            bool bFound = false;
+            for (const auto &col : column_defs)
+            {
+                if (col.col_func == SWQCF_NONE &&
+                    col.table_index == def->table_index &&
+                    col.field_index == def->field_index)
+                {
+                    bFound = true;
+                    break;
+                }
+            }
+            if (!bFound)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Field '%s' in ORDER BY must be a selected GROUP BY "
+                         "field",
+                         def->field_name);
+                return CE_Failure;
+            }
+        }
     }
 
     /* -------------------------------------------------------------------- */
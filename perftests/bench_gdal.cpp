@@ -0,0 +1,1246 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Benchmark suite of the main raster and vector code paths.
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+// Runs a set of benchmarks on synthetic, deterministic datasets, and
+// reports the results on the console or as JSON, with a layout close to the
+// one of google-benchmark, so that results of different GDAL versions can be
+// compared. Run "bench_gdal --help" for the options.
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_string.h"
+#include "cpl_time.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+#include "gdal_priv.h"
+#include "gdal_utils.h"
+#include "ogr_recordbatch.h"
+#include "ogr_spatialref.h"
+#include "ogrsf_frmts.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+/************************************************************************/
+/*                           BenchmarkState                             */
+/************************************************************************/
+
+//! Controls the iterations of a benchmark, and collects its measurements.
+class BenchmarkState
+{
+    using Clock = std::chrono::steady_clock;
+
+    const double m_dfMinTime;
+    bool m_bStarted = false;
+    bool m_bPaused = false;
+    Clock::time_point m_oSegmentStart{};
+    double m_dfElapsed = 0;
+    GIntBig m_nIterations = 0;
+    GIntBig m_nBytesPerIteration = 0;
+    GIntBig m_nItemsPerIteration = 0;
+    std::string m_osError{};
+
+    void AccumulateSegment()
+    {
+        m_dfElapsed +=
+            std::chrono::duration<double>(Clock::now() - m_oSegmentStart)
+                .count();
+    }
+
+  public:
+    explicit BenchmarkState(double dfMinTime) : m_dfMinTime(dfMinTime)
+    {
+    }
+
+    /** To be used as the condition of the timed loop of a benchmark. */
+    bool KeepRunning()
+    {
+        if (!m_osError.empty())
+            return false;
+        if (!m_bStarted)
+        {
+            m_bStarted = true;
+            m_oSegmentStart = Clock::now();
+            return true;
+        }
+        ++m_nIterations;
+        AccumulateSegment();
+        if (m_dfElapsed >= m_dfMinTime)
+            return false;
+        m_oSegmentStart = Clock::now();
+        return true;
+    }
+
+    /** Excludes the following code from the measured time. */
+    void PauseTiming()
+    {
+        CPLAssert(!m_bPaused);
+        AccumulateSegment();
+        m_bPaused = true;
+    }
+
+    void ResumeTiming()
+    {
+        CPLAssert(m_bPaused);
+        m_bPaused = false;
+        m_oSegmentStart = Clock::now();
+    }
+
+    void SetBytesPerIteration(GIntBig nBytes)
+    {
+        m_nBytesPerIteration = nBytes;
+    }
+
+    void SetItemsPerIteration(GIntBig nItems)
+    {
+        m_nItemsPerIteration = nItems;
+    }
+
+    /** Aborts the benchmark. The timed loop must be exited afterwards. */
+    void SkipWithError(const std::string &osError)
+    {
+        m_osError = osError;
+    }
+
+    GIntBig GetIterations() const
+    {
+        return m_nIterations;
+    }
+
+    double GetElapsed() const
+    {
+        return m_dfElapsed;
+    }
+
+    GIntBig GetBytesPerIteration() const
+    {
+        return m_nBytesPerIteration;
+    }
+
+    GIntBig GetItemsPerIteration() const
+    {
+        return m_nItemsPerIteration;
+    }
+
+    const std::string &GetError() const
+    {
+        return m_osError;
+    }
+};
+
+struct Benchmark
+{
+    std::string osName;
+    std::function<void(BenchmarkState &)> fn;
+};
+
+std::vector<Benchmark> gaoBenchmarks;
+
+void RegisterBenchmark(const std::string &osName,
+                       std::function<void(BenchmarkState &)> fn)
+{
+    gaoBenchmarks.push_back(Benchmark{osName, std::move(fn)});
+}
+
+/************************************************************************/
+/*                       Parameters of the datasets                     */
+/************************************************************************/
+
+// Width and height of the synthetic rasters.
+int gnRasterSize = 1024;
+// Number of features of the synthetic vector layers, and of points
+// transformed by the coordinate transformation benchmarks.
+int gnFeatureCount = 100000;
+// Directory for the files that must be on disk (VSI cache benchmarks).
+std::string gosTmpDir;
+
+constexpr const char *BENCH_DIR = "/vsimem/bench_gdal";
+
+/************************************************************************/
+/*                              Hash()                                  */
+/************************************************************************/
+
+// Deterministic pseudo-random noise, independent of the platform and of the
+// C library, so that the datasets are identical on every run.
+GUInt32 Hash(GUInt32 x, GUInt32 y, GUInt32 z)
+{
+    GUInt32 h = x * 73856093U ^ y * 19349663U ^ z * 83492791U;
+    h ^= h >> 13;
+    h *= 0x5bd1e995U;
+    h ^= h >> 15;
+    return h;
+}
+
+/************************************************************************/
+/*                         CreateSourceRaster()                         */
+/************************************************************************/
+
+// Returns a MEM dataset with smooth gradients plus some noise, which
+// compresses like typical imagery rather than like a constant raster.
+std::unique_ptr<GDALDataset> CreateSourceRaster(GDALDataType eDT, int nBands)
+{
+    auto poMEMDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    std::unique_ptr<GDALDataset> poDS(poMEMDriver->Create(
+        "", gnRasterSize, gnRasterSize, nBands, eDT, nullptr));
+    // Roughly 1 km wide pixels around Paris.
+    double adfGT[] = {2.0, 0.01, 0, 49.0, 0, -0.01};
+    poDS->SetGeoTransform(adfGT);
+    OGRSpatialReference oSRS;
+    oSRS.importFromEPSG(4326);
+    poDS->SetSpatialRef(&oSRS);
+
+    std::vector<double> adfLine(gnRasterSize);
+    for (int iBand = 0; iBand < nBands; ++iBand)
+    {
+        auto poBand = poDS->GetRasterBand(iBand + 1);
+        for (int y = 0; y < gnRasterSize; ++y)
+        {
+            for (int x = 0; x < gnRasterSize; ++x)
+            {
+                const double dfNoise = Hash(x, y, iBand) & 15;
+                if (eDT == GDT_Byte)
+                {
+                    adfLine[x] = ((x + 2 * y) / 8 + 64 * iBand) % 240 + dfNoise;
+                }
+                else
+                {
+                    adfLine[x] = 1000 * std::sin(x * 0.01) *
+                                     std::cos(y * 0.013 + iBand) +
+                                 dfNoise / 16;
+                }
+            }
+            CPL_IGNORE_RET_VAL(poBand->RasterIO(GF_Write, 0, y, gnRasterSize,
+                                                1, adfLine.data(), gnRasterSize,
+                                                1, GDT_Float64, 0, 0, nullptr));
+        }
+    }
+    return poDS;
+}
+
+GDALDataset *GetByteRaster()
+{
+    static std::unique_ptr<GDALDataset> poDS = CreateSourceRaster(GDT_Byte, 3);
+    return poDS.get();
+}
+
+GDALDataset *GetFloat32Raster()
+{
+    static std::unique_ptr<GDALDataset> poDS =
+        CreateSourceRaster(GDT_Float32, 1);
+    return poDS.get();
+}
+
+GDALDataset *GetSourceRaster(GDALDataType eDT)
+{
+    return eDT == GDT_Byte ? GetByteRaster() : GetFloat32Raster();
+}
+
+/************************************************************************/
+/*                           ReadWholeRaster()                          */
+/************************************************************************/
+
+CPLErr ReadWholeRaster(GDALDataset *poDS, int nBufXSize, int nBufYSize,
+                       std::vector<GByte> &abyBuffer)
+{
+    const auto eDT = poDS->GetRasterBand(1)->GetRasterDataType();
+    const int nBands = poDS->GetRasterCount();
+    abyBuffer.resize(static_cast<size_t>(nBufXSize) * nBufYSize * nBands *
+                     GDALGetDataTypeSizeBytes(eDT));
+    return poDS->RasterIO(GF_Read, 0, 0, poDS->GetRasterXSize(),
+                          poDS->GetRasterYSize(), abyBuffer.data(), nBufXSize,
+                          nBufYSize, eDT, nBands, nullptr, 0, 0, 0, nullptr);
+}
+
+GIntBig GetRasterBytes(GDALDataset *poDS)
+{
+    return static_cast<GIntBig>(poDS->GetRasterXSize()) *
+           poDS->GetRasterYSize() * poDS->GetRasterCount() *
+           GDALGetDataTypeSizeBytes(
+               poDS->GetRasterBand(1)->GetRasterDataType());
+}
+
+/************************************************************************/
+/*                        GTiff codec benchmarks                        */
+/************************************************************************/
+
+void RegisterGTiffBenchmarks()
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poDriver)
+        return;
+    const char *pszCOList =
+        poDriver->GetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST);
+    for (const char *pszCodec :
+         {"NONE", "PACKBITS", "LZW", "DEFLATE", "ZSTD", "LZMA", "LERC", "JPEG",
+          "WEBP", "JXL"})
+    {
+        if (!EQUAL(pszCodec, "NONE") &&
+            (!pszCOList ||
+             !strstr(pszCOList, CPLSPrintf("<Value>%s</Value>", pszCodec))))
+        {
+            continue;
+        }
+        for (const GDALDataType eDT : {GDT_Byte, GDT_Float32})
+        {
+            const bool bByteOnly =
+                EQUAL(pszCodec, "JPEG") || EQUAL(pszCodec, "WEBP");
+            if (eDT != GDT_Byte && bByteOnly)
+                continue;
+
+            const std::string osCodec(pszCodec);
+            const std::string osSuffix =
+                osCodec + "/" + GDALGetDataTypeName(eDT);
+            const std::string osFilename = std::string(BENCH_DIR) + "/gtiff_" +
+                                           osCodec + "_" +
+                                           GDALGetDataTypeName(eDT) + ".tif";
+            CPLStringList aosOptions;
+            aosOptions.SetNameValue("TILED", "YES");
+            aosOptions.SetNameValue("COMPRESS", pszCodec);
+            if (EQUAL(pszCodec, "WEBP") || EQUAL(pszCodec, "JXL"))
+                aosOptions.SetNameValue(EQUAL(pszCodec, "WEBP")
+                                            ? "WEBP_LOSSLESS"
+                                            : "JXL_LOSSLESS",
+                                        "YES");
+            else if (EQUAL(pszCodec, "LZW") || EQUAL(pszCodec, "DEFLATE") ||
+                     EQUAL(pszCodec, "ZSTD") || EQUAL(pszCodec, "LZMA"))
+                aosOptions.SetNameValue("PREDICTOR", "2");
+
+            RegisterBenchmark(
+                "GTiff/write/" + osSuffix,
+                [poDriver, eDT, aosOptions](BenchmarkState &state)
+                {
+                    GDALDataset *poSrcDS = GetSourceRaster(eDT);
+                    const std::string osTmpFilename =
+                        std::string(BENCH_DIR) + "/gtiff_write.tif";
+                    state.SetBytesPerIteration(GetRasterBytes(poSrcDS));
+                    while (state.KeepRunning())
+                    {
+                        std::unique_ptr<GDALDataset> poDS(poDriver->CreateCopy(
+                            osTmpFilename.c_str(), poSrcDS, false,
+                            aosOptions.List(), nullptr, nullptr));
+                        if (!poDS || poDS->Close() != CE_None)
+                            state.SkipWithError(CPLGetLastErrorMsg());
+                    }
+                    VSIUnlink(osTmpFilename.c_str());
+                });
+
+            RegisterBenchmark(
+                "GTiff/read/" + osSuffix,
+                [poDriver, eDT, aosOptions, osFilename](BenchmarkState &state)
+                {
+                    {
+                        std::unique_ptr<GDALDataset> poDS(poDriver->CreateCopy(
+                            osFilename.c_str(), GetSourceRaster(eDT), false,
+                            aosOptions.List(), nullptr, nullptr));
+                        if (!poDS || poDS->Close() != CE_None)
+                        {
+                            state.SkipWithError(CPLGetLastErrorMsg());
+                            return;
+                        }
+                    }
+                    std::vector<GByte> abyBuffer;
+                    while (state.KeepRunning())
+                    {
+                        // Re-opened at each iteration so that blocks are
+                        // decoded again, and not taken from the block cache.
+                        auto poDS = std::unique_ptr<GDALDataset>(
+                            GDALDataset::Open(osFilename.c_str(),
+                                              GDAL_OF_RASTER));
+                        if (!poDS ||
+                            ReadWholeRaster(poDS.get(), poDS->GetRasterXSize(),
+                                            poDS->GetRasterYSize(),
+                                            abyBuffer) != CE_None)
+                        {
+                            state.SkipWithError(CPLGetLastErrorMsg());
+                            break;
+                        }
+                        state.SetBytesPerIteration(GetRasterBytes(poDS.get()));
+                    }
+                    VSIUnlink(osFilename.c_str());
+                });
+        }
+    }
+}
+
+/************************************************************************/
+/*                           Warp benchmarks                            */
+/************************************************************************/
+
+void RegisterWarpBenchmarks()
+{
+    for (const char *pszResampling :
+         {"near", "bilinear", "cubic", "cubicspline", "lanczos", "average",
+          "mode", "max", "med", "rms"})
+    {
+        for (const GDALDataType eDT : {GDT_Byte, GDT_Float32})
+        {
+            const std::string osResampling(pszResampling);
+            RegisterBenchmark(
+                "Warp/" + osResampling + "/" + GDALGetDataTypeName(eDT),
+                [osResampling, eDT](BenchmarkState &state)
+                {
+                    CPLStringList aosArgv;
+                    aosArgv.AddString("-of");
+                    aosArgv.AddString("MEM");
+                    aosArgv.AddString("-t_srs");
+                    aosArgv.AddString("EPSG:3857");
+                    aosArgv.AddString("-r");
+                    aosArgv.AddString(osResampling.c_str());
+                    aosArgv.AddString("-ts");
+                    aosArgv.AddString(CPLSPrintf("%d", gnRasterSize));
+                    aosArgv.AddString(CPLSPrintf("%d", gnRasterSize));
+                    GDALWarpAppOptions *psOptions =
+                        GDALWarpAppOptionsNew(aosArgv.List(), nullptr);
+                    GDALDatasetH hSrcDS =
+                        GDALDataset::ToHandle(GetSourceRaster(eDT));
+                    state.SetBytesPerIteration(
+                        GetRasterBytes(GetSourceRaster(eDT)));
+                    while (state.KeepRunning())
+                    {
+                        GDALDatasetH hOutDS = GDALWarp(
+                            "", nullptr, 1, &hSrcDS, psOptions, nullptr);
+                        if (!hOutDS)
+                            state.SkipWithError(CPLGetLastErrorMsg());
+                        GDALClose(hOutDS);
+                    }
+                    GDALWarpAppOptionsFree(psOptions);
+                });
+        }
+    }
+}
+
+/************************************************************************/
+/*                          Overview benchmarks                         */
+/************************************************************************/
+
+void RegisterOverviewBenchmarks()
+{
+    for (const char *pszResampling :
+         {"NEAREST", "AVERAGE", "RMS", "BILINEAR", "CUBIC", "CUBICSPLINE",
+          "LANCZOS", "GAUSS", "MODE"})
+    {
+        for (const GDALDataType eDT : {GDT_Byte, GDT_Float32})
+        {
+            const std::string osResampling(pszResampling);
+            RegisterBenchmark(
+                "Overview/" + osResampling + "/" + GDALGetDataTypeName(eDT),
+                [osResampling, eDT](BenchmarkState &state)
+                {
+                    auto poMEMDriver =
+                        GetGDALDriverManager()->GetDriverByName("MEM");
+                    GDALDataset *poSrcDS = GetSourceRaster(eDT);
+                    const int anOverviews[] = {2, 4, 8, 16};
+                    state.SetBytesPerIteration(GetRasterBytes(poSrcDS));
+                    while (state.KeepRunning())
+                    {
+                        state.PauseTiming();
+                        std::unique_ptr<GDALDataset> poDS(
+                            poMEMDriver->CreateCopy("", poSrcDS, false,
+                                                    nullptr, nullptr, nullptr));
+                        state.ResumeTiming();
+                        if (poDS->BuildOverviews(osResampling.c_str(),
+                                                 CPL_ARRAYSIZE(anOverviews),
+                                                 anOverviews, 0, nullptr,
+                                                 nullptr, nullptr,
+                                                 nullptr) != CE_None)
+                        {
+                            state.SkipWithError(CPLGetLastErrorMsg());
+                        }
+                        state.PauseTiming();
+                        poDS.reset();
+                        state.ResumeTiming();
+                    }
+                });
+        }
+    }
+}
+
+/************************************************************************/
+/*                         Statistics benchmarks                        */
+/************************************************************************/
+
+void RegisterStatisticsBenchmarks()
+{
+    for (const GDALDataType eDT : {GDT_Byte, GDT_Float32})
+    {
+        RegisterBenchmark(std::string("Statistics/ComputeStatistics/") +
+                              GDALGetDataTypeName(eDT),
+                          [eDT](BenchmarkState &state)
+                          {
+                              auto poBand =
+                                  GetSourceRaster(eDT)->GetRasterBand(1);
+                              state.SetItemsPerIteration(
+                                  static_cast<GIntBig>(gnRasterSize) *
+                                  gnRasterSize);
+                              double dfMin, dfMax, dfMean, dfStdDev;
+                              while (state.KeepRunning())
+                              {
+                                  if (poBand->ComputeStatistics(
+                                          false, &dfMin, &dfMax, &dfMean,
+                                          &dfStdDev, nullptr,
+                                          nullptr) != CE_None)
+                                  {
+                                      state.SkipWithError(CPLGetLastErrorMsg());
+                                  }
+                              }
+                          });
+
+        RegisterBenchmark(std::string("Statistics/ComputeRasterMinMax/") +
+                              GDALGetDataTypeName(eDT),
+                          [eDT](BenchmarkState &state)
+                          {
+                              auto poBand =
+                                  GetSourceRaster(eDT)->GetRasterBand(1);
+                              state.SetItemsPerIteration(
+                                  static_cast<GIntBig>(gnRasterSize) *
+                                  gnRasterSize);
+                              double adfMinMax[2];
+                              while (state.KeepRunning())
+                              {
+                                  if (poBand->ComputeRasterMinMax(
+                                          false, adfMinMax) != CE_None)
+                                  {
+                                      state.SkipWithError(CPLGetLastErrorMsg());
+                                  }
+                              }
+                          });
+    }
+}
+
+/************************************************************************/
+/*                        VRT mosaic benchmarks                         */
+/************************************************************************/
+
+// Splits the Byte source raster in 4x4 GTiff tiles, mosaiced by a VRT.
+std::string CreateVRTMosaic()
+{
+    constexpr int TILE_COUNT = 4;
+    const int nTileSize = gnRasterSize / TILE_COUNT;
+    GDALDatasetH hSrcDS = GDALDataset::ToHandle(GetByteRaster());
+    std::vector<std::string> aosTiles;
+    for (int j = 0; j < TILE_COUNT; ++j)
+    {
+        for (int i = 0; i < TILE_COUNT; ++i)
+        {
+            CPLStringList aosArgv;
+            aosArgv.AddString("-of");
+            aosArgv.AddString("GTiff");
+            aosArgv.AddString("-co");
+            aosArgv.AddString("TILED=YES");
+            aosArgv.AddString("-srcwin");
+            aosArgv.AddString(CPLSPrintf("%d", i * nTileSize));
+            aosArgv.AddString(CPLSPrintf("%d", j * nTileSize));
+            aosArgv.AddString(CPLSPrintf("%d", nTileSize));
+            aosArgv.AddString(CPLSPrintf("%d", nTileSize));
+            GDALTranslateOptions *psOptions =
+                GDALTranslateOptionsNew(aosArgv.List(), nullptr);
+            aosTiles.push_back(
+                CPLSPrintf("%s/mosaic_tile_%d_%d.tif", BENCH_DIR, i, j));
+            GDALClose(GDALTranslate(aosTiles.back().c_str(), hSrcDS, psOptions,
+                                    nullptr));
+            GDALTranslateOptionsFree(psOptions);
+        }
+    }
+
+    CPLStringList aosTiles2;
+    for (const auto &osTile : aosTiles)
+        aosTiles2.AddString(osTile.c_str());
+    const std::string osVRT = std::string(BENCH_DIR) + "/mosaic.vrt";
+    GDALClose(GDALBuildVRT(osVRT.c_str(), aosTiles2.size(), nullptr,
+                           aosTiles2.List(), nullptr, nullptr));
+    return osVRT;
+}
+
+void RegisterVRTBenchmarks()
+{
+    for (const int nFactor : {1, 4})
+    {
+        RegisterBenchmark(
+            nFactor == 1 ? "VRT/mosaic/full_resolution"
+                         : "VRT/mosaic/downsampled_4x",
+            [nFactor](BenchmarkState &state)
+            {
+                const std::string osVRT = CreateVRTMosaic();
+                std::vector<GByte> abyBuffer;
+                state.SetBytesPerIteration(GetRasterBytes(GetByteRaster()));
+                while (state.KeepRunning())
+                {
+                    auto poDS = std::unique_ptr<GDALDataset>(
+                        GDALDataset::Open(osVRT.c_str(), GDAL_OF_RASTER));
+                    if (!poDS ||
+                        ReadWholeRaster(poDS.get(), gnRasterSize / nFactor,
+                                        gnRasterSize / nFactor,
+                                        abyBuffer) != CE_None)
+                    {
+                        state.SkipWithError(CPLGetLastErrorMsg());
+                    }
+                }
+            });
+    }
+}
+
+/************************************************************************/
+/*                            OGR benchmarks                            */
+/************************************************************************/
+
+struct VectorFormat
+{
+    const char *pszDriver;
+    const char *pszExtension;
+    const char *pszLayerCreationOptions;
+};
+
+constexpr VectorFormat asVectorFormats[] = {
+    {"Memory", "", ""},
+    {"GPKG", "gpkg", ""},
+    {"ESRI Shapefile", "shp", ""},
+    {"FlatGeobuf", "fgb", ""},
+    {"GeoJSON", "geojson", ""},
+    {"GeoJSONSeq", "geojsonl", ""},
+    {"CSV", "csv", "GEOMETRY=AS_XY"},
+    {"Parquet", "parquet", ""},
+    {"Arrow", "arrow", ""},
+};
+
+// Points on a grid, with an integer, a real, a string and a date field.
+void CreateFeatures(OGRLayer *poLayer)
+{
+    OGRFieldDefn oFieldInt("int_field", OFTInteger);
+    poLayer->CreateField(&oFieldInt);
+    OGRFieldDefn oFieldReal("real_field", OFTReal);
+    poLayer->CreateField(&oFieldReal);
+    OGRFieldDefn oFieldStr("str_field", OFTString);
+    poLayer->CreateField(&oFieldStr);
+    OGRFieldDefn oFieldDate("date_field", OFTDate);
+    poLayer->CreateField(&oFieldDate);
+
+    const int nSide =
+        std::max(1, static_cast<int>(std::sqrt(double(gnFeatureCount))));
+    OGRFeature oFeature(poLayer->GetLayerDefn());
+    for (int i = 0; i < gnFeatureCount; ++i)
+    {
+        const GUInt32 nHash = Hash(i, 0, 0);
+        oFeature.SetFID(OGRNullFID);
+        oFeature.SetField(0, static_cast<int>(nHash % 100000));
+        oFeature.SetField(1, (nHash % 1000000) / 1000.0);
+        oFeature.SetField(2, CPLSPrintf("value_%u", nHash % 1000));
+        oFeature.SetField(3, 2000 + static_cast<int>(nHash % 25),
+                          1 + static_cast<int>(nHash % 12),
+                          1 + static_cast<int>(nHash % 28));
+        oFeature.SetGeometryDirectly(
+            new OGRPoint(2.0 + (i % nSide) * 0.001,
+                         49.0 + (i / nSide) * 0.001));
+        if (poLayer->CreateFeature(&oFeature) != OGRERR_NONE)
+            break;
+    }
+}
+
+std::unique_ptr<GDALDataset> CreateVectorDataset(GDALDriver *poDriver,
+                                                 const VectorFormat &sFormat,
+                                                 const std::string &osFilename)
+{
+    std::unique_ptr<GDALDataset> poDS(poDriver->Create(
+        osFilename.c_str(), 0, 0, 0, GDT_Unknown, nullptr));
+    if (!poDS)
+        return nullptr;
+    OGRSpatialReference oSRS;
+    oSRS.importFromEPSG(4326);
+    oSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+    const CPLStringList aosLCO(
+        CSLTokenizeString2(sFormat.pszLayerCreationOptions, " ", 0));
+    auto poLayer =
+        poDS->CreateLayer("test", &oSRS, wkbPoint, aosLCO.List());
+    if (!poLayer)
+        return nullptr;
+    if (poDS->TestCapability(ODsCTransactions))
+    {
+        poDS->StartTransaction();
+        CreateFeatures(poLayer);
+        poDS->CommitTransaction();
+    }
+    else
+    {
+        CreateFeatures(poLayer);
+    }
+    return poDS;
+}
+
+// Returns the source dataset for the read benchmarks. Except for the Memory
+// driver, it is closed and re-opened, so that the benches read what the
+// driver has written.
+std::unique_ptr<GDALDataset> OpenVectorDataset(GDALDriver *poDriver,
+                                               const VectorFormat &sFormat,
+                                               const std::string &osFilename)
+{
+    auto poDS = CreateVectorDataset(poDriver, sFormat, osFilename);
+    if (!poDS || sFormat.pszExtension[0] == 0)
+        return poDS;
+    if (poDS->Close() != CE_None)
+        return nullptr;
+    poDS.reset();
+    const char *const apszDrivers[] = {sFormat.pszDriver, nullptr};
+    return std::unique_ptr<GDALDataset>(GDALDataset::Open(
+        osFilename.c_str(), GDAL_OF_VECTOR, apszDrivers, nullptr, nullptr));
+}
+
+void RegisterOGRBenchmarks()
+{
+    for (const auto &sFormat : asVectorFormats)
+    {
+        auto poDriver =
+            GetGDALDriverManager()->GetDriverByName(sFormat.pszDriver);
+        if (!poDriver || !poDriver->GetMetadataItem(GDAL_DCAP_CREATE))
+            continue;
+        const std::string osDriver(sFormat.pszDriver);
+        const std::string osFilename =
+            std::string(BENCH_DIR) + "/ogr." + sFormat.pszExtension;
+
+        RegisterBenchmark(
+            "OGR/write/" + osDriver,
+            [poDriver, &sFormat, osFilename](BenchmarkState &state)
+            {
+                state.SetItemsPerIteration(gnFeatureCount);
+                while (state.KeepRunning())
+                {
+                    auto poDS =
+                        CreateVectorDataset(poDriver, sFormat, osFilename);
+                    if (!poDS || poDS->Close() != CE_None)
+                        state.SkipWithError(CPLGetLastErrorMsg());
+                    state.PauseTiming();
+                    poDS.reset();
+                    poDriver->Delete(osFilename.c_str());
+                    state.ResumeTiming();
+                }
+            });
+
+        RegisterBenchmark(
+            "OGR/read/" + osDriver,
+            [poDriver, &sFormat, osFilename](BenchmarkState &state)
+            {
+                auto poDS = OpenVectorDataset(poDriver, sFormat, osFilename);
+                if (!poDS || !poDS->GetLayer(0))
+                {
+                    state.SkipWithError(CPLGetLastErrorMsg());
+                    return;
+                }
+                auto poLayer = poDS->GetLayer(0);
+                state.SetItemsPerIteration(gnFeatureCount);
+                while (state.KeepRunning())
+                {
+                    poLayer->ResetReading();
+                    int nCount = 0;
+                    for (auto &&poFeature : *poLayer)
+                    {
+                        CPL_IGNORE_RET_VAL(poFeature);
+                        ++nCount;
+                    }
+                    if (nCount != gnFeatureCount)
+                        state.SkipWithError("Not all features were read");
+                }
+                poDS.reset();
+                poDriver->Delete(osFilename.c_str());
+            });
+
+        RegisterBenchmark(
+            "OGR/arrow_export/" + osDriver,
+            [poDriver, &sFormat, osFilename](BenchmarkState &state)
+            {
+                auto poDS = OpenVectorDataset(poDriver, sFormat, osFilename);
+                if (!poDS || !poDS->GetLayer(0))
+                {
+                    state.SkipWithError(CPLGetLastErrorMsg());
+                    return;
+                }
+                auto poLayer = poDS->GetLayer(0);
+                state.SetItemsPerIteration(gnFeatureCount);
+                while (state.KeepRunning())
+                {
+                    struct ArrowArrayStream stream;
+                    if (!poLayer->GetArrowStream(&stream))
+                    {
+                        state.SkipWithError(CPLGetLastErrorMsg());
+                        break;
+                    }
+                    GIntBig nCount = 0;
+                    while (true)
+                    {
+                        struct ArrowArray array;
+                        if (stream.get_next(&stream, &array) != 0)
+                        {
+                            state.SkipWithError("get_next() failed");
+                            break;
+                        }
+                        if (!array.release)
+                            break;
+                        nCount += array.length;
+                        array.release(&array);
+                    }
+                    stream.release(&stream);
+                    if (nCount != gnFeatureCount)
+                        state.SkipWithError("Not all features were read");
+                }
+                poDS.reset();
+                poDriver->Delete(osFilename.c_str());
+            });
+    }
+}
+
+/************************************************************************/
+/*                 Coordinate transformation benchmarks                 */
+/************************************************************************/
+
+void RegisterCoordinateTransformationBenchmarks()
+{
+    for (const int nTargetEPSG : {3857, 32631, 2154})
+    {
+        RegisterBenchmark(
+            CPLSPrintf("CoordinateTransformation/EPSG:4326_to_EPSG:%d",
+                       nTargetEPSG),
+            [nTargetEPSG](BenchmarkState &state)
+            {
+                OGRSpatialReference oSrcSRS;
+                oSrcSRS.importFromEPSG(4326);
+                oSrcSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+                OGRSpatialReference oDstSRS;
+                oDstSRS.importFromEPSG(nTargetEPSG);
+                oDstSRS.SetAxisMappingStrategy(OAMS_TRADITIONAL_GIS_ORDER);
+                std::unique_ptr<OGRCoordinateTransformation> poCT(
+                    OGRCreateCoordinateTransformation(&oSrcSRS, &oDstSRS));
+                if (!poCT)
+                {
+                    state.SkipWithError(CPLGetLastErrorMsg());
+                    return;
+                }
+                std::vector<double> adfSrcX, adfSrcY;
+                for (int i = 0; i < gnFeatureCount; ++i)
+                {
+                    adfSrcX.push_back(-1.0 + (Hash(i, 0, 0) % 8000) * 0.001);
+                    adfSrcY.push_back(43.0 + (Hash(i, 1, 0) % 8000) * 0.001);
+                }
+                std::vector<double> adfX, adfY;
+                state.SetItemsPerIteration(gnFeatureCount);
+                while (state.KeepRunning())
+                {
+                    state.PauseTiming();
+                    adfX = adfSrcX;
+                    adfY = adfSrcY;
+                    state.ResumeTiming();
+                    if (!poCT->Transform(adfX.size(), adfX.data(), adfY.data()))
+                        state.SkipWithError(CPLGetLastErrorMsg());
+                }
+            });
+    }
+}
+
+/************************************************************************/
+/*                           VSI benchmarks                             */
+/************************************************************************/
+
+void RegisterVSIBenchmarks()
+{
+    constexpr int FILE_SIZE = 32 * 1024 * 1024;
+    constexpr int READ_SIZE = 4096;
+    constexpr int READ_COUNT = 8192;
+
+    for (const bool bVSICache : {false, true})
+    {
+        RegisterBenchmark(
+            bVSICache ? "VSI/random_reads/VSI_CACHE=TRUE"
+                      : "VSI/random_reads/VSI_CACHE=FALSE",
+            [bVSICache](BenchmarkState &state)
+            {
+                const std::string osFilename = CPLFormFilename(
+                    gosTmpDir.c_str(), "bench_gdal_vsi.bin", nullptr);
+                {
+                    VSIVirtualHandleUniquePtr fp(
+                        VSIFOpenL(osFilename.c_str(), "wb"));
+                    std::vector<GByte> abyChunk(1024 * 1024);
+                    for (size_t i = 0; i < abyChunk.size(); ++i)
+                        abyChunk[i] = static_cast<GByte>(Hash(i, 0, 0));
+                    for (int i = 0; fp && i < FILE_SIZE /
+                                                  static_cast<int>(
+                                                      abyChunk.size());
+                         ++i)
+                    {
+                        fp->Write(abyChunk.data(), 1, abyChunk.size());
+                    }
+                    if (!fp)
+                    {
+                        state.SkipWithError("Cannot create " + osFilename);
+                        return;
+                    }
+                }
+
+                // Most reads are close to the previous one, as with the
+                // block to block access of tiled formats.
+                std::vector<vsi_l_offset> anOffsets;
+                vsi_l_offset nOffset = 0;
+                for (int i = 0; i < READ_COUNT; ++i)
+                {
+                    const GUInt32 nHash = Hash(i, 2, 0);
+                    if ((nHash % 8) == 0)
+                        nOffset = nHash % (FILE_SIZE - READ_SIZE);
+                    else
+                        nOffset = (nOffset + READ_SIZE * (1 + nHash % 4)) %
+                                  (FILE_SIZE - READ_SIZE);
+                    anOffsets.push_back(nOffset);
+                }
+
+                std::vector<GByte> abyBuffer(READ_SIZE);
+                CPLConfigOptionSetter oSetter("VSI_CACHE",
+                                              bVSICache ? "TRUE" : "FALSE",
+                                              false);
+                state.SetBytesPerIteration(static_cast<GIntBig>(READ_SIZE) *
+                                           READ_COUNT);
+                while (state.KeepRunning())
+                {
+                    VSIVirtualHandleUniquePtr fp(
+                        VSIFOpenL(osFilename.c_str(), "rb"));
+                    for (const auto nReadOffset : anOffsets)
+                    {
+                        if (!fp || fp->Seek(nReadOffset, SEEK_SET) != 0 ||
+                            fp->Read(abyBuffer.data(), 1, READ_SIZE) !=
+                                READ_SIZE)
+                        {
+                            state.SkipWithError("Read error");
+                            break;
+                        }
+                    }
+                }
+                VSIUnlink(osFilename.c_str());
+            });
+    }
+
+    RegisterBenchmark(
+        "VSI/vsimem/sequential_read",
+        [](BenchmarkState &state)
+        {
+            const std::string osFilename =
+                std::string(BENCH_DIR) + "/vsi_sequential.bin";
+            {
+                VSIVirtualHandleUniquePtr fp(
+                    VSIFOpenL(osFilename.c_str(), "wb"));
+                fp->Truncate(FILE_SIZE);
+            }
+            std::vector<GByte> abyBuffer(READ_SIZE);
+            state.SetBytesPerIteration(FILE_SIZE);
+            while (state.KeepRunning())
+            {
+                VSIVirtualHandleUniquePtr fp(
+                    VSIFOpenL(osFilename.c_str(), "rb"));
+                while (fp->Read(abyBuffer.data(), 1, READ_SIZE) == READ_SIZE)
+                {
+                }
+            }
+            VSIUnlink(osFilename.c_str());
+        });
+}
+
+/************************************************************************/
+/*                             PatternMatch()                           */
+/************************************************************************/
+
+bool PatternMatch(const char *pszStr, const char *pszPattern)
+{
+    for (; *pszPattern; ++pszPattern, ++pszStr)
+    {
+        if (*pszPattern == '*')
+        {
+            for (const char *pszIter = pszStr;; ++pszIter)
+            {
+                if (PatternMatch(pszIter, pszPattern + 1))
+                    return true;
+                if (*pszIter == 0)
+                    return false;
+            }
+        }
+        if (*pszStr == 0 ||
+            (*pszPattern != '?' &&
+             CPLToupper(static_cast<unsigned char>(*pszPattern)) !=
+                 CPLToupper(static_cast<unsigned char>(*pszStr))))
+        {
+            return false;
+        }
+    }
+    return *pszStr == 0;
+}
+
+/************************************************************************/
+/*                              MatchFilter()                           */
+/************************************************************************/
+
+// Comma-separated list of patterns with * and ? wildcards, matched
+// case-insensitively against the whole benchmark name.
+bool MatchFilter(const std::string &osName, const CPLStringList &aosFilters)
+{
+    if (aosFilters.empty())
+        return true;
+    for (const char *pszFilter : aosFilters)
+    {
+        if (PatternMatch(osName.c_str(), pszFilter))
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+void Usage()
+{
+    printf("Usage: bench_gdal [--filter=<pattern>[,<pattern>]...] [--list]\n");
+    printf("                  [--min-time=<seconds>] [--repetitions=<n>]\n");
+    printf("                  [--raster-size=<n>] [--feature-count=<n>]\n");
+    printf("                  [--tmpdir=<dir>] [--format=console|json]\n");
+    printf("                  [--out=<filename>]\n");
+    printf("\n");
+    printf("Patterns may contain * and ? wildcards, e.g. "
+           "--filter=GTiff/read/*,Warp/*/Byte\n");
+    printf("Default: --min-time=0.5 --repetitions=3 --raster-size=1024 "
+           "--feature-count=100000\n");
+    exit(1);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                                main()                                */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    CPLStringList aosFilters;
+    bool bList = false;
+    bool bJSON = false;
+    double dfMinTime = 0.5;
+    int nRepetitions = 3;
+    std::string osOut;
+    gosTmpDir = CPLGetConfigOption("CPL_TMPDIR", ".");
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        const char *pszArg = argv[iArg];
+        if (STARTS_WITH(pszArg, "--filter="))
+            aosFilters = CSLTokenizeString2(pszArg + strlen("--filter="), ",",
+                                            0);
+        else if (strcmp(pszArg, "--list") == 0)
+            bList = true;
+        else if (STARTS_WITH(pszArg, "--min-time="))
+            dfMinTime = CPLAtof(pszArg + strlen("--min-time="));
+        else if (STARTS_WITH(pszArg, "--repetitions="))
+            nRepetitions = std::max(1, atoi(pszArg + strlen("--repetitions=")));
+        else if (STARTS_WITH(pszArg, "--raster-size="))
+            gnRasterSize =
+                std::max(16, atoi(pszArg + strlen("--raster-size=")));
+        else if (STARTS_WITH(pszArg, "--feature-count="))
+            gnFeatureCount =
+                std::max(1, atoi(pszArg + strlen("--feature-count=")));
+        else if (STARTS_WITH(pszArg, "--tmpdir="))
+            gosTmpDir = pszArg + strlen("--tmpdir=");
+        else if (strcmp(pszArg, "--format=json") == 0)
+            bJSON = true;
+        else if (strcmp(pszArg, "--format=console") == 0)
+            bJSON = false;
+        else if (STARTS_WITH(pszArg, "--out="))
+            osOut = pszArg + strlen("--out=");
+        else
+            Usage();
+    }
+
+    GDALAllRegister();
+
+    RegisterGTiffBenchmarks();
+    RegisterWarpBenchmarks();
+    RegisterOverviewBenchmarks();
+    RegisterStatisticsBenchmarks();
+    RegisterVRTBenchmarks();
+    RegisterOGRBenchmarks();
+    RegisterCoordinateTransformationBenchmarks();
+    RegisterVSIBenchmarks();
+
+    if (bList)
+    {
+        for (const auto &oBenchmark : gaoBenchmarks)
+        {
+            if (MatchFilter(oBenchmark.osName, aosFilters))
+                printf("%s\n", oBenchmark.osName.c_str());
+        }
+        GDALDestroy();
+        return 0;
+    }
+
+    CPLJSONDocument oDoc;
+    CPLJSONObject oRoot = oDoc.GetRoot();
+    {
+        CPLJSONObject oContext;
+        char szDate[32] = {};
+        const time_t nNow = time(nullptr);
+        struct tm sTM;
+        CPLUnixTimeToYMDHMS(nNow, &sTM);
+        snprintf(szDate, sizeof(szDate), "%04d-%02d-%02dT%02d:%02d:%02dZ",
+                 sTM.tm_year + 1900, sTM.tm_mon + 1, sTM.tm_mday, sTM.tm_hour,
+                 sTM.tm_min, sTM.tm_sec);
+        oContext.Add("date", szDate);
+        oContext.Add("gdal_version", GDALVersionInfo("RELEASE_NAME"));
+        oContext.Add("gdal_version_num", atoi(GDALVersionInfo("VERSION_NUM")));
+        oContext.Add("num_cpus", CPLGetNumCPUs());
+        oContext.Add("min_time", dfMinTime);
+        oContext.Add("repetitions", nRepetitions);
+        oContext.Add("raster_size", gnRasterSize);
+        oContext.Add("feature_count", gnFeatureCount);
+        oRoot.Add("context", oContext);
+    }
+    CPLJSONArray oResults;
+
+    if (!bJSON)
+    {
+        printf("GDAL %s, %d CPUs\n", GDALVersionInfo("RELEASE_NAME"),
+               CPLGetNumCPUs());
+        printf("%-50s %12s %12s %12s %14s\n", "Benchmark", "Median (ms)",
+               "Min (ms)", "Iterations", "Throughput");
+    }
+
+    VSIMkdir(BENCH_DIR, 0755);
+    int nErrors = 0;
+    for (const auto &oBenchmark : gaoBenchmarks)
+    {
+        if (!MatchFilter(oBenchmark.osName, aosFilters))
+            continue;
+
+        std::vector<double> adfTimes;
+        GIntBig nTotalIterations = 0;
+        GIntBig nBytesPerIteration = 0;
+        GIntBig nItemsPerIteration = 0;
+        std::string osError;
+        for (int iRep = 0; iRep < nRepetitions && osError.empty(); ++iRep)
+        {
+            BenchmarkState state(dfMinTime);
+            oBenchmark.fn(state);
+            osError = state.GetError();
+            if (state.GetIterations() > 0)
+            {
+                adfTimes.push_back(state.GetElapsed() / state.GetIterations());
+                nTotalIterations += state.GetIterations();
+            }
+            nBytesPerIteration = state.GetBytesPerIteration();
+            nItemsPerIteration = state.GetItemsPerIteration();
+        }
+
+        CPLJSONObject oResult;
+        oResult.Add("name", oBenchmark.osName);
+        if (!osError.empty() || adfTimes.empty())
+        {
+            ++nErrors;
+            if (osError.empty())
+                osError = "No iteration completed";
+            oResult.Add("error_occurred", true);
+            oResult.Add("error_message", osError);
+            if (!bJSON)
+                printf("%-50s ERROR: %s\n", oBenchmark.osName.c_str(),
+                       osError.c_str());
+            oResults.Add(oResult);
+            continue;
+        }
+
+        std::sort(adfTimes.begin(), adfTimes.end());
+        const size_t nSize = adfTimes.size();
+        const double dfMedian =
+            (nSize % 2) ? adfTimes[nSize / 2]
+                        : (adfTimes[nSize / 2 - 1] + adfTimes[nSize / 2]) / 2;
+        double dfMean = 0;
+        for (const double dfTime : adfTimes)
+            dfMean += dfTime;
+        dfMean /= static_cast<double>(nSize);
+        double dfVariance = 0;
+        for (const double dfTime : adfTimes)
+            dfVariance += (dfTime - dfMean) * (dfTime - dfMean);
+        dfVariance /= static_cast<double>(nSize);
+
+        oResult.Add("iterations", nTotalIterations);
+        oResult.Add("repetitions", static_cast<int>(nSize));
+        oResult.Add("time_unit", "ms");
+        oResult.Add("real_time", dfMedian * 1e3);
+        oResult.Add("min_time", adfTimes.front() * 1e3);
+        oResult.Add("mean_time", dfMean * 1e3);
+        oResult.Add("stddev_time", std::sqrt(dfVariance) * 1e3);
+        std::string osThroughput;
+        if (nBytesPerIteration > 0)
+        {
+            const double dfBytesPerSecond = nBytesPerIteration / dfMedian;
+            oResult.Add("bytes_per_second", dfBytesPerSecond);
+            osThroughput = CPLSPrintf("%.1f MB/s", dfBytesPerSecond / 1e6);
+        }
+        if (nItemsPerIteration > 0)
+        {
+            const double dfItemsPerSecond = nItemsPerIteration / dfMedian;
+            oResult.Add("items_per_second", dfItemsPerSecond);
+            if (osThroughput.empty())
+                osThroughput = CPLSPrintf("%.3g items/s", dfItemsPerSecond);
+        }
+        oResults.Add(oResult);
+
+        if (!bJSON)
+        {
+            printf("%-50s %12.3f %12.3f %12" CPL_FRMT_GB_WITHOUT_PREFIX
+                   "d %14s\n",
+                   oBenchmark.osName.c_str(), dfMedian * 1e3,
+                   adfTimes.front() * 1e3, nTotalIterations,
+                   osThroughput.c_str());
+            fflush(stdout);
+        }
+    }
+    oRoot.Add("benchmarks", oResults);
+
+    if (!osOut.empty())
+    {
+        if (!oDoc.Save(osOut))
+            ++nErrors;
+    }
+    else if (bJSON)
+    {
+        printf("%s\n", oDoc.SaveAsString().c_str());
+    }
+
+    VSIRmdirRecursive(BENCH_DIR);
+    GDALDestroy();
+    return nErrors == 0 ? 0 : 1;
+}
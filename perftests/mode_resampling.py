@@ -0,0 +1,51 @@
+# SPDX-License-Identifier: MIT
+# Copyright 2024, GDAL contributors
+
+import array
+import time
+
+from osgeo import gdal
+
+
+def create(datatype, width, height):
+
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, datatype)
+    ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    # Categorical data, such as land cover classes
+    line = array.array("H", [(x // 7) % 23 for x in range(width)])
+    for y in range(height):
+        ds.GetRasterBand(1).WriteRaster(
+            0, y, width, 1, line.tobytes(), buf_type=gdal.GDT_UInt16
+        )
+        line.append(line.pop(0))
+    return ds
+
+
+def doit_overview(datatype, factor):
+
+    ds = create(datatype, 8000, 8000)
+    start = time.time()
+    ds.BuildOverviews("MODE", [factor])
+    end = time.time()
+    print(
+        "overview, %s, factor %d: %.2f"
+        % (gdal.GetDataTypeName(datatype), factor, end - start)
+    )
+
+
+def doit_warp(datatype, factor):
+
+    ds = create(datatype, 8000, 8000)
+    start = time.time()
+    gdal.Warp("", ds, format="MEM", resampleAlg="mode", xRes=factor, yRes=factor)
+    end = time.time()
+    print(
+        "warp, %s, factor %d: %.2f"
+        % (gdal.GetDataTypeName(datatype), factor, end - start)
+    )
+
+
+for dt in (gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Int16):
+    for factor in (2, 8, 32):
+        doit_overview(dt, factor)
+        doit_warp(dt, factor)
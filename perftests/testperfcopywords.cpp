@@ -34,50 +34,74 @@
 #include <cstdlib>
 #include <ctime>
 
+/************************************************************************/
+/*                            PrintMatrix()                             */
+/************************************************************************/
+
+// Print a matrix of the time (in ms) taken by nIters conversions of
+// nWordCount values, for all combinations of source and target data types.
+// A stride of 0 means packed values.
+
+static void PrintMatrix(const void *in, void *out, int nStride,
+                        int nWordCount, int nIters)
+{
+    printf("%-9s", "in\\out");
+    for (int outtype = GDT_Byte; outtype < GDT_TypeCount; outtype++)
+    {
+        printf(" %8s", GDALGetDataTypeName((GDALDataType)outtype));
+    }
+    printf("\n");
+
+    for (int intype = GDT_Byte; intype < GDT_TypeCount; intype++)
+    {
+        printf("%-9s", GDALGetDataTypeName((GDALDataType)intype));
+        for (int outtype = GDT_Byte; outtype < GDT_TypeCount; outtype++)
+        {
+            const int nInStride =
+                nStride ? nStride
+                        : GDALGetDataTypeSizeBytes((GDALDataType)intype);
+            const int nOutStride =
+                nStride ? nStride
+                        : GDALGetDataTypeSizeBytes((GDALDataType)outtype);
+
+            const clock_t start = clock();
+            for (int i = 0; i < nIters; i++)
+                GDALCopyWords(in, (GDALDataType)intype, nInStride, out,
+                              (GDALDataType)outtype, nOutStride, nWordCount);
+            const clock_t end = clock();
+
+            printf(" %8.1f", (end - start) * 1000.0 / CLOCKS_PER_SEC);
+        }
+        printf("\n");
+    }
+    printf("\n");
+}
+
 int main(int /* argc */, char * /* argv */[])
 {
     void *in = calloc(1, 256 * 256 * 16);
     void *out = malloc(256 * 256 * 16);
 
     int i;
-    int intype, outtype;
 
     clock_t start, end;
 
-    for (intype = GDT_Byte; intype < GDT_TypeCount; intype++)
+    // GDAL_USE_AVX2 is only taken into account in DEBUG builds
+    for (int k = 0; k < 2; k++)
     {
-        for (outtype = GDT_Byte; outtype < GDT_TypeCount; outtype++)
+        if (k == 1)
         {
-            start = clock();
-
-            for (i = 0; i < 1000; i++)
-                GDALCopyWords(in, (GDALDataType)intype, 16, out,
-                              (GDALDataType)outtype, 16, 256 * 256);
-
-            end = clock();
-
-            printf("%s -> %s : %.2f s\n",
-                   GDALGetDataTypeName((GDALDataType)intype),
-                   GDALGetDataTypeName((GDALDataType)outtype),
-                   (end - start) * 1.0 / CLOCKS_PER_SEC);
-
-            start = clock();
-
-            for (i = 0; i < 1000; i++)
-                GDALCopyWords(in, (GDALDataType)intype,
-                              GDALGetDataTypeSize((GDALDataType)intype) / 8,
-                              out, (GDALDataType)outtype,
-                              GDALGetDataTypeSize((GDALDataType)outtype) / 8,
-                              256 * 256);
+            printf("Disabling AVX2\n");
+            CPLSetConfigOption("GDAL_USE_AVX2", "NO");
+        }
 
-            end = clock();
+        printf("Stride of 16 bytes (ms for 1000 x 65536 values):\n");
+        PrintMatrix(in, out, 16, 256 * 256, 1000);
 
-            printf("%s -> %s (packed) : %.2f s\n",
-                   GDALGetDataTypeName((GDALDataType)intype),
-                   GDALGetDataTypeName((GDALDataType)outtype),
-                   (end - start) * 1.0 / CLOCKS_PER_SEC);
-        }
+        printf("Packed (ms for 1000 x 65536 values):\n");
+        PrintMatrix(in, out, 0, 256 * 256, 1000);
     }
+    CPLSetConfigOption("GDAL_USE_AVX2", nullptr);
 
     for (int k = 0; k < 2; k++)
     {
@@ -78,6 +78,8 @@
 #include <xlocale.h>  // for LC_NUMERIC_MASK on MacOS
 #endif
 
+#include <atomic>
+#include <memory>
 #ifdef DEBUG_CONFIG_OPTIONS
 #include <set>
 #endif
@@ -115,6 +117,9 @@ static bool gbIgnoreEnvVariables =
 static std::vector<std::pair<CPLSetConfigOptionSubscriber, void *>>
     gSetConfigOptionSubscribers{};
 
+// Incremented each time a global or thread-local configuration option is set.
+static std::atomic<GUInt64> gnConfigOptionsGeneration{1};
+
 // Used by CPLOpenShared() and friends.
 static CPLMutex *hSharedFileMutex = nullptr;
 static int nSharedFileCount = 0;
@@ -1656,6 +1661,160 @@ static void CPLAccessConfigOption(const char *pszKey, bool bGet)
 }
 #endif
 
+/************************************************************************/
+/*                      Global config option table                      */
+/************************************************************************/
+
+// Options set with CPLSetConfigOption() are looked up without taking
+// hConfigMutex, in an open-addressing hash table whose load factor is kept
+// below 1/2. A slot is created the first time a key is set, and is never
+// removed, only its value is changed. When the table becomes too full, a
+// larger copy pointing to the same slots is published: a reader still
+// iterating over the old copy thus sees up-to-date values. Old copies are
+// only released by CPLFreeConfig().
+// Modifications are done with hConfigMutex held. g_papszConfigOptions is
+// still maintained, for CPLGetConfigOptions().
+
+namespace
+{
+struct CPLConfigOptionSlot
+{
+    char *pszKey = nullptr;
+    std::atomic<char *> pszValue{nullptr};
+};
+
+struct CPLConfigOptionTable
+{
+    size_t nMask = 0;
+    std::unique_ptr<std::atomic<CPLConfigOptionSlot *>[]> apoSlots{};
+
+    explicit CPLConfigOptionTable(size_t nSize)
+        : nMask(nSize - 1),
+          apoSlots(new std::atomic<CPLConfigOptionSlot *>[nSize])
+    {
+        for (size_t i = 0; i < nSize; ++i)
+            apoSlots[i].store(nullptr, std::memory_order_relaxed);
+    }
+};
+}  // namespace
+
+static std::atomic<CPLConfigOptionTable *> gpoConfigOptionTable{nullptr};
+// Current and previous tables, and slots, protected by hConfigMutex.
+static std::vector<std::unique_ptr<CPLConfigOptionTable>>
+    gapoConfigOptionTables{};
+static std::vector<CPLConfigOptionSlot *> gapoConfigOptionSlots{};
+
+// Case-insensitive FNV-1a hash, consistent with CSLFetchNameValue()
+static size_t CPLConfigOptionHash(const char *pszKey)
+{
+    GUInt32 nHash = 2166136261U;
+    for (; *pszKey; ++pszKey)
+    {
+        GUInt32 ch = static_cast<unsigned char>(*pszKey);
+        if (ch >= 'a' && ch <= 'z')
+            ch -= 'a' - 'A';
+        nHash = (nHash ^ ch) * 16777619U;
+    }
+    return nHash;
+}
+
+static const char *CPLConfigOptionTableLookup(const char *pszKey)
+{
+    const CPLConfigOptionTable *poTable =
+        gpoConfigOptionTable.load(std::memory_order_acquire);
+    if (poTable == nullptr)
+        return nullptr;
+    for (size_t i = CPLConfigOptionHash(pszKey) & poTable->nMask;;
+         i = (i + 1) & poTable->nMask)
+    {
+        const CPLConfigOptionSlot *poSlot =
+            poTable->apoSlots[i].load(std::memory_order_acquire);
+        if (poSlot == nullptr)
+            return nullptr;
+        if (EQUAL(poSlot->pszKey, pszKey))
+            return poSlot->pszValue.load(std::memory_order_acquire);
+    }
+}
+
+// Must be called with hConfigMutex held.
+static void CPLConfigOptionTableSet(const char *pszKey, const char *pszValue)
+{
+    CPLConfigOptionTable *poTable =
+        gpoConfigOptionTable.load(std::memory_order_relaxed);
+    size_t i = 0;
+    if (poTable)
+    {
+        for (i = CPLConfigOptionHash(pszKey) & poTable->nMask;;
+             i = (i + 1) & poTable->nMask)
+        {
+            CPLConfigOptionSlot *poSlot =
+                poTable->apoSlots[i].load(std::memory_order_relaxed);
+            if (poSlot == nullptr)
+                break;
+            if (EQUAL(poSlot->pszKey, pszKey))
+            {
+                char *pszOldValue = poSlot->pszValue.exchange(
+                    pszValue ? CPLStrdup(pszValue) : nullptr,
+                    std::memory_order_acq_rel);
+                CPLFree(pszOldValue);
+                return;
+            }
+        }
+    }
+    if (pszValue == nullptr)
+        return;
+
+    if (poTable == nullptr ||
+        2 * (gapoConfigOptionSlots.size() + 1) > poTable->nMask + 1)
+    {
+        auto poNewTable = std::make_unique<CPLConfigOptionTable>(
+            poTable ? 2 * (poTable->nMask + 1) : 64);
+        for (CPLConfigOptionSlot *poSlot : gapoConfigOptionSlots)
+        {
+            size_t j = CPLConfigOptionHash(poSlot->pszKey) & poNewTable->nMask;
+            while (poNewTable->apoSlots[j].load(std::memory_order_relaxed))
+                j = (j + 1) & poNewTable->nMask;
+            poNewTable->apoSlots[j].store(poSlot, std::memory_order_relaxed);
+        }
+        poTable = poNewTable.get();
+        gapoConfigOptionTables.push_back(std::move(poNewTable));
+        gpoConfigOptionTable.store(poTable, std::memory_order_release);
+
+        i = CPLConfigOptionHash(pszKey) & poTable->nMask;
+        while (poTable->apoSlots[i].load(std::memory_order_relaxed))
+            i = (i + 1) & poTable->nMask;
+    }
+
+    CPLConfigOptionSlot *poSlot = new CPLConfigOptionSlot();
+    poSlot->pszKey = CPLStrdup(pszKey);
+    poSlot->pszValue.store(CPLStrdup(pszValue), std::memory_order_relaxed);
+    gapoConfigOptionSlots.push_back(poSlot);
+    poTable->apoSlots[i].store(poSlot, std::memory_order_release);
+}
+
+// Must be called with hConfigMutex held.
+static void CPLConfigOptionTableClearValues()
+{
+    for (CPLConfigOptionSlot *poSlot : gapoConfigOptionSlots)
+    {
+        CPLFree(poSlot->pszValue.exchange(nullptr, std::memory_order_acq_rel));
+    }
+}
+
+// Must be called with hConfigMutex held.
+static void CPLConfigOptionTableFree()
+{
+    gpoConfigOptionTable.store(nullptr, std::memory_order_release);
+    gapoConfigOptionTables.clear();
+    for (CPLConfigOptionSlot *poSlot : gapoConfigOptionSlots)
+    {
+        CPLFree(poSlot->pszKey);
+        CPLFree(poSlot->pszValue.load(std::memory_order_relaxed));
+        delete poSlot;
+    }
+    gapoConfigOptionSlots.clear();
+}
+
 /************************************************************************/
 /*                         CPLGetConfigOption()                         */
 /************************************************************************/
@@ -1773,6 +1932,18 @@ void CPLSetConfigOptions(const char *const *papszConfigOptions)
     CSLDestroy(const_cast<char **>(g_papszConfigOptions));
     g_papszConfigOptions = const_cast<volatile char **>(
         CSLDuplicate(const_cast<char **>(papszConfigOptions)));
+
+    CPLConfigOptionTableClearValues();
+    for (CSLConstList papszIter = papszConfigOptions; papszIter && *papszIter;
+         ++papszIter)
+    {
+        char *pszKey = nullptr;
+        const char *pszValue = CPLParseNameValue(*papszIter, &pszKey);
+        if (pszKey && pszValue)
+            CPLConfigOptionTableSet(pszKey, pszValue);
+        CPLFree(pszKey);
+    }
+    gnConfigOptionsGeneration++;
 }
 
 /************************************************************************/
@@ -1819,10 +1990,7 @@ const char *CPL_STDCALL CPLGetGlobalConfigOption(const char *pszKey,
     CPLAccessConfigOption(pszKey, TRUE);
 #endif
 
-    CPLMutexHolderD(&hConfigMutex);
-
-    const char *pszResult =
-        CSLFetchNameValue(const_cast<char **>(g_papszConfigOptions), pszKey);
+    const char *pszResult = CPLConfigOptionTableLookup(pszKey);
 
     if (pszResult == nullptr)
         return pszDefault;
@@ -1957,6 +2125,8 @@ void CPL_STDCALL CPLSetConfigOption(const char *pszKey, const char *pszValue)
 
     g_papszConfigOptions = const_cast<volatile char **>(CSLSetNameValue(
         const_cast<char **>(g_papszConfigOptions), pszKey, pszValue));
+    CPLConfigOptionTableSet(pszKey, pszValue);
+    gnConfigOptionsGeneration++;
 
     NotifyOtherComponentsConfigOptionChanged(pszKey, pszValue,
                                              /*bTheadLocal=*/false);
@@ -2020,6 +2190,7 @@ void CPL_STDCALL CPLSetThreadLocalConfigOption(const char *pszKey,
 
     CPLSetTLSWithFreeFunc(CTLS_CONFIGOPTIONS, papszTLConfigOptions,
                           CPLSetThreadLocalTLSFreeFunc);
+    gnConfigOptionsGeneration++;
 
     NotifyOtherComponentsConfigOptionChanged(pszKey, pszValue,
                                              /*bTheadLocal=*/true);
@@ -2080,6 +2251,7 @@ void CPLSetThreadLocalConfigOptions(const char *const *papszConfigOptions)
         CSLDuplicate(const_cast<char **>(papszConfigOptions));
     CPLSetTLSWithFreeFunc(CTLS_CONFIGOPTIONS, papszTLConfigOptions,
                           CPLSetThreadLocalTLSFreeFunc);
+    gnConfigOptionsGeneration++;
 }
 
 /************************************************************************/
@@ -2094,6 +2266,8 @@ void CPL_STDCALL CPLFreeConfig()
 
         CSLDestroy(const_cast<char **>(g_papszConfigOptions));
         g_papszConfigOptions = nullptr;
+        CPLConfigOptionTableFree();
+        gnConfigOptionsGeneration++;
 
         int bMemoryError = FALSE;
         char **papszTLConfigOptions = reinterpret_cast<char **>(
@@ -3509,3 +3683,36 @@ CPLConfigOptionSetter::~CPLConfigOptionSetter()
 }
 
 //! @endcond
+
+/************************************************************************/
+/*                       CPLCachedConfigOption                          */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param pszKey the key of the option. Must remain valid during the lifetime
+ *               of the object.
+ * @param pszDefault a default value if the option is not defined (may be NULL).
+ *                   Must remain valid during the lifetime of the object.
+ */
+CPLCachedConfigOption::CPLCachedConfigOption(const char *pszKey,
+                                             const char *pszDefault)
+    : m_pszKey(pszKey), m_pszDefault(pszDefault)
+{
+}
+
+/** Return the value of the option, as CPLGetConfigOption() would.
+ *
+ * CPLGetConfigOption() is only called again if a configuration option has
+ * been set since the previous call.
+ */
+const char *CPLCachedConfigOption::Get()
+{
+    const GUInt64 nGeneration = gnConfigOptionsGeneration.load();
+    if (nGeneration != m_nGeneration)
+    {
+        m_pszValue = CPLGetConfigOption(m_pszKey, m_pszDefault);
+        m_nGeneration = nGeneration;
+    }
+    return m_pszValue;
+}
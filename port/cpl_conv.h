@@ -248,6 +248,33 @@ void CPL_DLL CPLDumpSharedList(FILE *);
 void CPL_DLL CPLCleanupSharedFileMutex(void);
 /*! @endcond */
 
+/* -------------------------------------------------------------------- */
+/*      Accounting of the memory held by caches and buffers, outside    */
+/*      of the GDAL block cache.                                        */
+/* -------------------------------------------------------------------- */
+
+/** Opaque type for a memory accounting counter.
+ * @since GDAL 3.10
+ */
+typedef struct CPLMemoryAccountingCounter CPLMemoryAccountingCounter;
+
+/** Callback returning the current memory usage of a subsystem, and
+ * optionally its peak usage in *pnPeak.
+ * @since GDAL 3.10
+ */
+typedef GIntBig (*CPLMemoryAccountingProvider)(GIntBig *pnPeak);
+
+CPLMemoryAccountingCounter CPL_DLL *
+CPLGetMemoryAccountingCounter(const char *pszSubsystem);
+void CPL_DLL CPLMemoryAccountingAdd(CPLMemoryAccountingCounter *hCounter,
+                                    GIntBig nDelta);
+void CPL_DLL CPLRegisterMemoryAccountingProvider(
+    const char *pszSubsystem, CPLMemoryAccountingProvider pfnProvider);
+char CPL_DLL **CPLGetMemoryAccountingSubsystems(void);
+GIntBig CPL_DLL CPLGetMemoryAccountingUsage(const char *pszSubsystem,
+                                            GIntBig *pnPeak);
+void CPL_DLL CPLDebugMemoryAccounting(void);
+
 /* -------------------------------------------------------------------- */
 /*      DMS to Dec to DMS conversion.                                   */
 /* -------------------------------------------------------------------- */
@@ -398,6 +425,66 @@ extern "C++"
 
 #if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
 
+extern "C++"
+{
+    /** Cached access to a configuration option, for hot code paths.
+     *
+     * Get() returns the same value as CPLGetConfigOption(), but avoids the
+     * lookup while no configuration option has been set, globally or in any
+     * thread, since the previous call. Changes of environment variables after
+     * the first call are not detected.
+     *
+     * An instance must not be used concurrently by several threads. Declare
+     * it as thread_local if needed.
+     *
+     * @since GDAL 3.10
+     */
+    class CPL_DLL CPLCachedConfigOption
+    {
+        CPL_DISALLOW_COPY_ASSIGN(CPLCachedConfigOption)
+      public:
+        CPLCachedConfigOption(const char *pszKey, const char *pszDefault);
+
+        const char *Get();
+
+      private:
+        const char *m_pszKey;
+        const char *m_pszDefault;
+        const char *m_pszValue = nullptr;
+        GUInt64 m_nGeneration = 0;
+    };
+
+    /** Accounts a block of memory in a memory accounting counter, for the
+     * lifetime of the object.
+     *
+     * @since GDAL 3.10
+     */
+    class CPL_DLL CPLMemoryAccountingReservation
+    {
+        CPL_DISALLOW_COPY_ASSIGN(CPLMemoryAccountingReservation)
+      public:
+        CPLMemoryAccountingReservation() = default;
+        CPLMemoryAccountingReservation(CPLMemoryAccountingCounter *hCounter,
+                                       GIntBig nSize);
+        CPLMemoryAccountingReservation(
+            CPLMemoryAccountingReservation &&other) noexcept;
+        CPLMemoryAccountingReservation &
+        operator=(CPLMemoryAccountingReservation &&other) noexcept;
+        ~CPLMemoryAccountingReservation();
+
+        /** Changes the accounted size (0 to release it). */
+        void Set(GIntBig nSize);
+
+      private:
+        CPLMemoryAccountingCounter *m_hCounter = nullptr;
+        GIntBig m_nSize = 0;
+    };
+}  // extern "C++"
+
+#endif /* def __cplusplus */
+
+#if defined(__cplusplus) && !defined(CPL_SUPRESS_CPLUSPLUS)
+
 extern "C++"
 {
 
@@ -38,6 +38,8 @@
 
 #define CPUID_SSE_EDX_BIT 25
 
+#define CPUID_AVX2_EBX_BIT 5
+
 #define BIT_XMM_STATE (1 << 1)
 #define BIT_YMM_STATE (2 << 1)
 
@@ -212,4 +214,77 @@ bool CPLHaveRuntimeAVX()
 
 #endif  // defined(HAVE_AVX_AT_COMPILE_TIME) && !defined(CPLHaveRuntimeAVX)
 
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX2)
+
+/************************************************************************/
+/*                         CPLHaveRuntimeAVX2()                         */
+/************************************************************************/
+
+#if defined(__GNUC__)
+
+static bool CPLDetectRuntimeAVX2()
+{
+    // Also checks that the OS supports saving the YMM state
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+}
+
+#if !defined(DEBUG)
+bool bCPLHasAVX2 = false;
+static void CPLHaveRuntimeAVX2Initialize() __attribute__((constructor));
+
+static void CPLHaveRuntimeAVX2Initialize()
+{
+    bCPLHasAVX2 = CPLDetectRuntimeAVX2();
+}
+#else
+bool CPLHaveRuntimeAVX2()
+{
+    // This is called in hot paths (e.g. GDALCopyWords()), so only detect
+    // once, and use a cached lookup of GDAL_USE_AVX2
+    static thread_local CPLCachedConfigOption oUseAVX2("GDAL_USE_AVX2", "YES");
+    if (!CPLTestBool(oUseAVX2.Get()))
+        return false;
+    static const bool bHasAVX2 = CPLDetectRuntimeAVX2();
+    return bHasAVX2;
+}
+#endif
+
+#elif defined(_MSC_FULL_VER) && (_MSC_FULL_VER >= 160040219) &&                \
+    (defined(_M_IX86) || defined(_M_X64))
+
+static bool CPLDetectRuntimeAVX2()
+{
+    if (!CPLHaveRuntimeAVX())
+        return false;
+
+    int cpuinfo[4] = {0, 0, 0, 0};
+    __cpuidex(cpuinfo, 7, 0);
+    return (cpuinfo[REG_EBX] & (1 << CPUID_AVX2_EBX_BIT)) != 0;
+}
+
+bool CPLHaveRuntimeAVX2()
+{
+    // This is called in hot paths (e.g. GDALCopyWords()), so only detect
+    // once, and use a cached lookup of GDAL_USE_AVX2
+#ifdef DEBUG
+    static thread_local CPLCachedConfigOption oUseAVX2("GDAL_USE_AVX2", "YES");
+    if (!CPLTestBool(oUseAVX2.Get()))
+        return false;
+#endif
+    static const bool bHasAVX2 = CPLDetectRuntimeAVX2();
+    return bHasAVX2;
+}
+
+#else
+
+bool CPLHaveRuntimeAVX2()
+{
+    return false;
+}
+
+#endif
+
+#endif  // defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(HAVE_INLINE_AVX2)
+
 //! @endcond
@@ -43,6 +43,7 @@
 #include "cpl_http.h"
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
+#include "cpl_trace.h"
 #include "cpl_vsil_curl_class.h"
 
 // gcc or clang complains about C-style cast in #define like
@@ -1073,6 +1074,10 @@ CPLHTTPResult *CPLHTTPFetchEx(const char *pszURL, CSLConstList papszOptions,
                               CPLHTTPFetchWriteFunc pfnWrite, void *pWriteArg)
 
 {
+    CPLTraceSpan oTraceSpan("http", "CPLHTTPFetch");
+    if (oTraceSpan.IsEnabled())
+        oTraceSpan.AddURLArg("url", pszURL);
+
     if (STARTS_WITH(pszURL, "/vsimem/") &&
         // Disabled by default for potential security issues.
         CPLTestBool(CPLGetConfigOption("CPL_CURL_ENABLE_VSIMEM", "FALSE")))
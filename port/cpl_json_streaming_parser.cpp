@@ -32,6 +32,7 @@
 #include <ctype.h>   // isdigit...
 #include <stdio.h>   // snprintf
 #include <string.h>  // strlen
+#include <algorithm>
 #include <vector>
 #include <string>
 
@@ -118,6 +119,22 @@ void CPLJSonStreamingParser::AdvanceChar(const char *&pStr, size_t &nLength)
     m_nCharCounter++;
 }
 
+/************************************************************************/
+/*                              AdvanceRun()                            */
+/************************************************************************/
+
+// Appends the nRun next characters to m_osToken and skips them. They must
+// not contain line breaks.
+void CPLJSonStreamingParser::AdvanceRun(const char *&pStr, size_t &nLength,
+                                        size_t nRun)
+{
+    m_osToken.append(pStr, nRun);
+    m_nLastChar = pStr[nRun - 1];
+    pStr += nRun;
+    nLength -= nRun;
+    m_nCharCounter += static_cast<int>(nRun);
+}
+
 /************************************************************************/
 /*                               SkipSpace()                            */
 /************************************************************************/
@@ -334,6 +351,16 @@ static bool IsHexDigit(char ch)
            (ch >= 'A' && ch <= 'F');
 }
 
+/************************************************************************/
+/*                            IsNumberChar()                            */
+/************************************************************************/
+
+static bool IsNumberChar(char ch)
+{
+    return (ch >= '0' && ch <= '9') || ch == '.' || ch == '-' || ch == '+' ||
+           ch == 'e' || ch == 'E';
+}
+
 /************************************************************************/
 /*                           HexToDecimal()                             */
 /************************************************************************/
@@ -458,6 +485,20 @@ bool CPLJSonStreamingParser::Parse(const char *pStr, size_t nLength,
         {
             while (nLength)
             {
+                // Fast path: consume the run of digits, signs, decimal
+                // points and exponents at once.
+                const size_t nMaxRun = std::min(
+                    nLength, static_cast<size_t>(1024) - m_osToken.size());
+                size_t nRun = 0;
+                while (nRun < nMaxRun && IsNumberChar(pStr[nRun]))
+                    ++nRun;
+                if (nRun > 0)
+                {
+                    AdvanceRun(pStr, nLength, nRun);
+                    if (nLength == 0)
+                        break;
+                }
+
                 char ch = *pStr;
                 if (ch == '+' || ch == '-' ||
                     isdigit(static_cast<unsigned char>(ch)) || ch == '.' ||
@@ -684,8 +725,27 @@ bool CPLJSonStreamingParser::Parse(const char *pStr, size_t nLength,
                     break;
                 }
 
-                m_osToken += ch;
-                AdvanceChar(pStr, nLength);
+                if (ch == '\r' || ch == '\n')
+                {
+                    m_osToken += ch;
+                    AdvanceChar(pStr, nLength);
+                    continue;
+                }
+
+                // Fast path: consume the run of characters up to the next
+                // quote, backslash or line break at once.
+                const size_t nMaxRun =
+                    std::min(nLength, m_nMaxStringSize - m_osToken.size());
+                size_t nRun = 1;
+                while (nRun < nMaxRun)
+                {
+                    const char chNext = pStr[nRun];
+                    if (chNext == '"' || chNext == '\\' || chNext == '\r' ||
+                        chNext == '\n')
+                        break;
+                    ++nRun;
+                }
+                AdvanceRun(pStr, nLength, nRun);
             }
 
             if (nLength == 0)
@@ -90,6 +90,7 @@ class CPL_DLL CPLJSonStreamingParser
 
     void SkipSpace(const char *&pStr, size_t &nLength);
     void AdvanceChar(const char *&pStr, size_t &nLength);
+    void AdvanceRun(const char *&pStr, size_t &nLength, size_t nRun);
     bool EmitUnexpectedChar(char ch, const char *pszExpecting = nullptr);
     bool StartNewToken(const char *&pStr, size_t &nLength);
     bool CheckAndEmitTrueFalseOrNull(char ch);
@@ -0,0 +1,294 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Accounting of the memory held by caches and buffers.
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+
+/*! @cond Doxygen_Suppress */
+struct CPLMemoryAccountingCounter
+{
+    std::atomic<GIntBig> nCurrent{0};
+    std::atomic<GIntBig> nPeak{0};
+};
+
+/*! @endcond */
+
+namespace
+{
+struct CPLMemoryAccountingRegistry
+{
+    std::mutex oMutex{};
+    // std::deque, so that counter addresses are stable.
+    std::deque<CPLMemoryAccountingCounter> aoCounters{};
+    std::map<std::string, CPLMemoryAccountingCounter *> oMapCounters{};
+    std::map<std::string, CPLMemoryAccountingProvider> oMapProviders{};
+};
+}  // namespace
+
+static CPLMemoryAccountingRegistry &GetRegistry()
+{
+    // Never destroyed, as counters may be updated by destructors of other
+    // static objects.
+    static CPLMemoryAccountingRegistry *poRegistry =
+        new CPLMemoryAccountingRegistry();
+    return *poRegistry;
+}
+
+/************************************************************************/
+/*                    CPLGetMemoryAccountingCounter()                   */
+/************************************************************************/
+
+/** Return the memory accounting counter of a subsystem, creating it if
+ * needed.
+ *
+ * Subsystems are identified by an upper-case name, like
+ * "VSICURL_REGION_CACHE". The returned handle is valid until the end of the
+ * process, and is typically stored in a static variable by the caller, so
+ * that CPLMemoryAccountingAdd() does not need any lookup.
+ *
+ * @param pszSubsystem Subsystem name.
+ * @return a counter handle, never NULL.
+ * @since GDAL 3.10
+ */
+CPLMemoryAccountingCounter *
+CPLGetMemoryAccountingCounter(const char *pszSubsystem)
+{
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    auto oIter = oRegistry.oMapCounters.find(pszSubsystem);
+    if (oIter != oRegistry.oMapCounters.end())
+        return oIter->second;
+    oRegistry.aoCounters.emplace_back();
+    auto hCounter = &oRegistry.aoCounters.back();
+    oRegistry.oMapCounters[pszSubsystem] = hCounter;
+    return hCounter;
+}
+
+/************************************************************************/
+/*                       CPLMemoryAccountingAdd()                       */
+/************************************************************************/
+
+/** Add a (possibly negative) number of bytes to a memory accounting counter.
+ *
+ * This is lock-free and can be called from any thread.
+ *
+ * @param hCounter Counter returned by CPLGetMemoryAccountingCounter().
+ * @param nDelta Number of bytes allocated (positive) or freed (negative).
+ * @since GDAL 3.10
+ */
+void CPLMemoryAccountingAdd(CPLMemoryAccountingCounter *hCounter,
+                            GIntBig nDelta)
+{
+    const GIntBig nNew =
+        hCounter->nCurrent.fetch_add(nDelta, std::memory_order_relaxed) +
+        nDelta;
+    GIntBig nPeak = hCounter->nPeak.load(std::memory_order_relaxed);
+    while (nNew > nPeak && !hCounter->nPeak.compare_exchange_weak(
+                               nPeak, nNew, std::memory_order_relaxed))
+    {
+    }
+}
+
+/************************************************************************/
+/*                CPLRegisterMemoryAccountingProvider()                 */
+/************************************************************************/
+
+/** Register a callback reporting the memory usage of a subsystem.
+ *
+ * This is an alternative to counters, for subsystems that already track
+ * their memory usage, like a third-party library. Registering the same
+ * subsystem again replaces the previous callback.
+ *
+ * @param pszSubsystem Subsystem name.
+ * @param pfnProvider Callback, or NULL to unregister it.
+ * @since GDAL 3.10
+ */
+void CPLRegisterMemoryAccountingProvider(
+    const char *pszSubsystem, CPLMemoryAccountingProvider pfnProvider)
+{
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    if (pfnProvider)
+        oRegistry.oMapProviders[pszSubsystem] = pfnProvider;
+    else
+        oRegistry.oMapProviders.erase(pszSubsystem);
+}
+
+/************************************************************************/
+/*                  CPLGetMemoryAccountingSubsystems()                  */
+/************************************************************************/
+
+/** Return the sorted list of the subsystems for which memory is accounted.
+ *
+ * @return a list to free with CSLDestroy().
+ * @since GDAL 3.10
+ */
+char **CPLGetMemoryAccountingSubsystems(void)
+{
+    auto &oRegistry = GetRegistry();
+    std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+    CPLStringList aosList;
+    for (const auto &oIter : oRegistry.oMapCounters)
+        aosList.AddString(oIter.first.c_str());
+    for (const auto &oIter : oRegistry.oMapProviders)
+    {
+        if (oRegistry.oMapCounters.find(oIter.first) ==
+            oRegistry.oMapCounters.end())
+            aosList.AddString(oIter.first.c_str());
+    }
+    aosList.Sort();
+    return aosList.StealList();
+}
+
+/************************************************************************/
+/*                    CPLGetMemoryAccountingUsage()                     */
+/************************************************************************/
+
+/** Return the number of bytes currently accounted for a subsystem.
+ *
+ * @param pszSubsystem Subsystem name.
+ * @param pnPeak Pointer to receive the maximum number of bytes accounted
+ * since the start of the process, or NULL.
+ * @return the current number of bytes, or 0 for an unknown subsystem.
+ * @since GDAL 3.10
+ */
+GIntBig CPLGetMemoryAccountingUsage(const char *pszSubsystem, GIntBig *pnPeak)
+{
+    auto &oRegistry = GetRegistry();
+    CPLMemoryAccountingProvider pfnProvider = nullptr;
+    GIntBig nCurrent = 0;
+    GIntBig nPeak = 0;
+    {
+        std::lock_guard<std::mutex> oLock(oRegistry.oMutex);
+        const auto oIter = oRegistry.oMapCounters.find(pszSubsystem);
+        if (oIter != oRegistry.oMapCounters.end())
+        {
+            nCurrent = oIter->second->nCurrent.load();
+            nPeak = oIter->second->nPeak.load();
+        }
+        const auto oIterProvider = oRegistry.oMapProviders.find(pszSubsystem);
+        if (oIterProvider != oRegistry.oMapProviders.end())
+            pfnProvider = oIterProvider->second;
+    }
+    if (pfnProvider)
+    {
+        // Called without the mutex, as it may use counters itself.
+        GIntBig nProviderPeak = 0;
+        nCurrent += pfnProvider(&nProviderPeak);
+        nPeak = std::max(nPeak + nProviderPeak, nCurrent);
+    }
+    if (pnPeak)
+        *pnPeak = nPeak;
+    return nCurrent;
+}
+
+/************************************************************************/
+/*                      CPLDebugMemoryAccounting()                      */
+/************************************************************************/
+
+/** Emit a CPLDebug() message with the current and peak memory usage of each
+ * subsystem.
+ *
+ * This is done by gdalinfo when run with --debug on.
+ *
+ * @since GDAL 3.10
+ */
+void CPLDebugMemoryAccounting(void)
+{
+    const CPLStringList aosSubsystems(CPLGetMemoryAccountingSubsystems());
+    for (const char *pszSubsystem : aosSubsystems)
+    {
+        GIntBig nPeak = 0;
+        const GIntBig nCurrent =
+            CPLGetMemoryAccountingUsage(pszSubsystem, &nPeak);
+        CPLDebug("MEMORY",
+                 "%s: current=" CPL_FRMT_GIB " bytes, peak=" CPL_FRMT_GIB
+                 " bytes",
+                 pszSubsystem, nCurrent, nPeak);
+    }
+}
+
+/************************************************************************/
+/*                    CPLMemoryAccountingReservation                    */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param hCounter Counter returned by CPLGetMemoryAccountingCounter().
+ * @param nSize Number of bytes to account.
+ */
+CPLMemoryAccountingReservation::CPLMemoryAccountingReservation(
+    CPLMemoryAccountingCounter *hCounter, GIntBig nSize)
+    : m_hCounter(hCounter)
+{
+    Set(nSize);
+}
+
+/** Move constructor. */
+CPLMemoryAccountingReservation::CPLMemoryAccountingReservation(
+    CPLMemoryAccountingReservation &&other) noexcept
+    : m_hCounter(other.m_hCounter), m_nSize(other.m_nSize)
+{
+    other.m_hCounter = nullptr;
+    other.m_nSize = 0;
+}
+
+/** Move assignment operator. */
+CPLMemoryAccountingReservation &CPLMemoryAccountingReservation::operator=(
+    CPLMemoryAccountingReservation &&other) noexcept
+{
+    if (this != &other)
+    {
+        Set(0);
+        m_hCounter = other.m_hCounter;
+        m_nSize = other.m_nSize;
+        other.m_hCounter = nullptr;
+        other.m_nSize = 0;
+    }
+    return *this;
+}
+
+/** Destructor. Releases the accounted size. */
+CPLMemoryAccountingReservation::~CPLMemoryAccountingReservation()
+{
+    Set(0);
+}
+
+void CPLMemoryAccountingReservation::Set(GIntBig nSize)
+{
+    if (m_hCounter && nSize != m_nSize)
+    {
+        CPLMemoryAccountingAdd(m_hCounter, nSize - m_nSize);
+        m_nSize = nSize;
+    }
+}
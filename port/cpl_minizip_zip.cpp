@@ -2307,7 +2307,8 @@ CPLErr CPLCloseFileInZip(void *hZip)
  * generation in SOZIP_ENABLED=AUTO mode. Defaults to 1 MB.
  * </li>
  * <li>NUM_THREADS: number of threads used for SOZip generation. Defaults to
- * ALL_CPUS.</li>
+ * the value of the GDAL_NUM_THREADS configuration option if set (since GDAL
+ * 3.10), or ALL_CPUS otherwise.</li>
  * <li>TIMESTAMP=AUTO/NOW/timestamp_as_epoch_since_jan_1_1970: in AUTO mode,
  * the timestamp of pszInputFilename will be used (if available), otherwise
  * it will fallback to NOW.</li>
@@ -2445,7 +2446,9 @@ CPLErr CPLAddFileInZip(void *hZip, const char *pszArchiveFilename,
 
         zi->nChunkSize = nChunkSize;
 
-        const char *pszThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+        const char *pszThreads = CSLFetchNameValueDef(
+            papszOptions, "NUM_THREADS",
+            CPLGetConfigOption("GDAL_NUM_THREADS", nullptr));
         if (pszThreads == nullptr || EQUAL(pszThreads, "ALL_CPUS"))
             zi->nThreads = CPLGetNumCPUs();
         else
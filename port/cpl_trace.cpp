@@ -0,0 +1,313 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Lightweight tracing spans, output in the Chrome trace format
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#include "cpl_trace.h"
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+namespace
+{
+struct CPLTraceState
+{
+    std::mutex m_mutex{};
+    FILE *m_fp = nullptr;
+    bool m_bFirstEvent = true;
+    std::chrono::steady_clock::time_point m_oStart =
+        std::chrono::steady_clock::now();
+
+    CPLTraceState() = default;
+
+    CPLTraceState(const CPLTraceState &) = delete;
+    CPLTraceState &operator=(const CPLTraceState &) = delete;
+};
+}  // namespace
+
+// The state is intentionally leaked, so that spans that end during the
+// destruction of static objects do not lock a destroyed mutex.
+static CPLTraceState &GetTraceState()
+{
+    static CPLTraceState *poState = new CPLTraceState();
+    return *poState;
+}
+
+// -1: not yet determined, 0: disabled, 1: enabled
+static std::atomic<int> gnTraceEnabled{-1};
+
+/************************************************************************/
+/*                            CPLTraceClose()                           */
+/************************************************************************/
+
+// Terminates the JSON array, so that the file is valid JSON, and closes it.
+static void CPLTraceClose(int nNewEnabledState)
+{
+    auto &oState = GetTraceState();
+    std::lock_guard<std::mutex> oGuard(oState.m_mutex);
+    if (oState.m_fp)
+    {
+        fputs("\n]\n", oState.m_fp);
+        fclose(oState.m_fp);
+        oState.m_fp = nullptr;
+    }
+    oState.m_bFirstEvent = true;
+    gnTraceEnabled = nNewEnabledState;
+}
+
+static void CPLTraceAtExit()
+{
+    // Spans that end after that point are no longer recorded.
+    CPLTraceClose(0);
+}
+
+/************************************************************************/
+/*                           CPLTraceCleanup()                          */
+/************************************************************************/
+
+/** Close the trace file, if any.
+ *
+ * This is done automatically at process termination. After this call, the
+ * CPL_TRACE configuration option is read again when a span is created, and
+ * if it is set, a new trace file is created.
+ *
+ * @since GDAL 3.10
+ */
+void CPLTraceCleanup()
+{
+    CPLTraceClose(-1);
+}
+
+/************************************************************************/
+/*                         CPLIsTraceEnabled()                          */
+/************************************************************************/
+
+/** Return whether tracing is enabled.
+ *
+ * Tracing is enabled if the CPL_TRACE configuration option is set to the
+ * name of a file that can be created, the first time this function is called.
+ *
+ * @since GDAL 3.10
+ */
+bool CPLIsTraceEnabled()
+{
+    const int nEnabled = gnTraceEnabled.load(std::memory_order_relaxed);
+    if (nEnabled >= 0)
+        return nEnabled != 0;
+
+    auto &oState = GetTraceState();
+    std::lock_guard<std::mutex> oGuard(oState.m_mutex);
+    if (gnTraceEnabled.load() < 0)
+    {
+        const char *pszFilename = CPLGetConfigOption("CPL_TRACE", nullptr);
+        if (pszFilename && pszFilename[0])
+        {
+            // Plain stdio, so that writing the trace does not go through
+            // the instrumented VSI layer.
+            oState.m_fp = fopen(pszFilename, "wb");
+            if (oState.m_fp)
+            {
+                fputs("[\n", oState.m_fp);
+                static const bool bAtExitRegistered =
+                    std::atexit(CPLTraceAtExit) == 0;
+                CPL_IGNORE_RET_VAL(bAtExitRegistered);
+            }
+            else
+            {
+                CPLError(CE_Warning, CPLE_FileIO,
+                         "Cannot create trace file %s", pszFilename);
+            }
+        }
+        gnTraceEnabled = oState.m_fp ? 1 : 0;
+    }
+    return gnTraceEnabled.load() != 0;
+}
+
+/************************************************************************/
+/*                            CPLTraceNowUS()                           */
+/************************************************************************/
+
+static GIntBig CPLTraceNowUS()
+{
+    return static_cast<GIntBig>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - GetTraceState().m_oStart)
+            .count());
+}
+
+/************************************************************************/
+/*                          CPLTraceJSONString()                        */
+/************************************************************************/
+
+static std::string CPLTraceJSONString(const char *pszStr)
+{
+    std::string osRet("\"");
+    for (; *pszStr; ++pszStr)
+    {
+        const unsigned char ch = static_cast<unsigned char>(*pszStr);
+        if (ch == '"' || ch == '\\')
+        {
+            osRet += '\\';
+            osRet += static_cast<char>(ch);
+        }
+        else if (ch < 0x20)
+        {
+            osRet += CPLSPrintf("\\u%04X", ch);
+        }
+        else
+        {
+            osRet += static_cast<char>(ch);
+        }
+    }
+    osRet += '"';
+    return osRet;
+}
+
+/************************************************************************/
+/*                          CPLTraceSpan::Start()                       */
+/************************************************************************/
+
+void CPLTraceSpan::Start()
+{
+    m_nStartUS = CPLTraceNowUS();
+}
+
+/************************************************************************/
+/*                          CPLTraceSpan::End()                         */
+/************************************************************************/
+
+void CPLTraceSpan::End()
+{
+    const GIntBig nEndUS = CPLTraceNowUS();
+    std::string osEvent(CPLSPrintf(
+        "{\"name\":%s,\"cat\":%s,\"ph\":\"X\",\"ts\":" CPL_FRMT_GIB
+        ",\"dur\":" CPL_FRMT_GIB ",\"pid\":%d,\"tid\":" CPL_FRMT_GIB,
+        CPLTraceJSONString(m_pszName).c_str(),
+        CPLTraceJSONString(m_pszCategory).c_str(), m_nStartUS,
+        nEndUS - m_nStartUS, CPLGetCurrentProcessID(), CPLGetPID()));
+    if (!m_osArgs.empty())
+    {
+        osEvent += ",\"args\":{";
+        osEvent += m_osArgs;
+        osEvent += '}';
+    }
+    osEvent += '}';
+
+    auto &oState = GetTraceState();
+    std::lock_guard<std::mutex> oGuard(oState.m_mutex);
+    if (oState.m_fp)
+    {
+        if (!oState.m_bFirstEvent)
+            fputs(",\n", oState.m_fp);
+        oState.m_bFirstEvent = false;
+        fputs(osEvent.c_str(), oState.m_fp);
+    }
+}
+
+/************************************************************************/
+/*                     CPLTraceSpan::AddArgInternal()                   */
+/************************************************************************/
+
+void CPLTraceSpan::AddArgInternal(const char *pszKey,
+                                  const std::string &osJSONValue)
+{
+    if (!m_osArgs.empty())
+        m_osArgs += ',';
+    m_osArgs += CPLTraceJSONString(pszKey);
+    m_osArgs += ':';
+    m_osArgs += osJSONValue;
+}
+
+/************************************************************************/
+/*                         CPLTraceSpan::AddArg()                       */
+/************************************************************************/
+
+/** Add an integer argument to the span. */
+void CPLTraceSpan::AddArg(const char *pszKey, GIntBig nValue)
+{
+    if (m_bEnabled)
+        AddArgInternal(pszKey, CPLSPrintf(CPL_FRMT_GIB, nValue));
+}
+
+/** Add a floating-point argument to the span. */
+void CPLTraceSpan::AddArg(const char *pszKey, double dfValue)
+{
+    if (m_bEnabled)
+    {
+        // JSON has no representation for infinity and NaN
+        AddArgInternal(pszKey, std::isfinite(dfValue)
+                                   ? std::string(CPLSPrintf("%.17g", dfValue))
+                                   : CPLTraceJSONString(
+                                         CPLSPrintf("%f", dfValue)));
+    }
+}
+
+/** Add a string argument to the span. */
+void CPLTraceSpan::AddArg(const char *pszKey, const char *pszValue)
+{
+    if (m_bEnabled)
+        AddArgInternal(pszKey, CPLTraceJSONString(pszValue ? pszValue : ""));
+}
+
+/************************************************************************/
+/*                       CPLTraceSpan::AddURLArg()                      */
+/************************************************************************/
+
+/** Add a URL argument to the span.
+ *
+ * The query string, the fragment and the user information of the URL are not
+ * recorded, as they may contain credentials, such as signed URL parameters.
+ */
+void CPLTraceSpan::AddURLArg(const char *pszKey, const char *pszURL)
+{
+    if (!m_bEnabled)
+        return;
+    std::string osURL(pszURL ? pszURL : "");
+    const auto nQueryPos = osURL.find_first_of("?#");
+    if (nQueryPos != std::string::npos)
+        osURL.resize(nQueryPos);
+    const auto nSchemePos = osURL.find("://");
+    if (nSchemePos != std::string::npos)
+    {
+        const auto nAuthorityPos = nSchemePos + strlen("://");
+        const auto nAuthorityEnd = osURL.find('/', nAuthorityPos);
+        const auto nArobasePos =
+            osURL.substr(nAuthorityPos, nAuthorityEnd == std::string::npos
+                                            ? std::string::npos
+                                            : nAuthorityEnd - nAuthorityPos)
+                .rfind('@');
+        if (nArobasePos != std::string::npos)
+            osURL.erase(nAuthorityPos, nArobasePos + 1);
+    }
+    AddArgInternal(pszKey, CPLTraceJSONString(osURL.c_str()));
+}
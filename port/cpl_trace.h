@@ -0,0 +1,117 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Lightweight tracing spans, output in the Chrome trace format
+ *
+ ******************************************************************************
+ * Copyright (c) 2024, GDAL contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ ****************************************************************************/
+
+#ifndef CPL_TRACE_H_INCLUDED
+#define CPL_TRACE_H_INCLUDED
+
+#include "cpl_port.h"
+
+#include <string>
+
+/**
+ * \file cpl_trace.h
+ *
+ * Tracing spans, written to the file pointed by the CPL_TRACE configuration
+ * option, in the JSON array format of the Chrome trace event format, that
+ * can be loaded in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * When tracing is disabled, creating a span costs a call to
+ * CPLIsTraceEnabled(), which then only does a relaxed atomic load.
+ *
+ * @since GDAL 3.10
+ */
+
+bool CPL_DLL CPLIsTraceEnabled();
+
+void CPL_DLL CPLTraceCleanup();
+
+/** Scoped span: the time between its construction and destruction is
+ * recorded as a "complete" event, with the calling thread id.
+ *
+ * \code{.cpp}
+ *     CPLTraceSpan oSpan("io", "VSIFReadL");
+ *     if (oSpan.IsEnabled())
+ *         oSpan.AddArg("size", nSize);
+ * \endcode
+ */
+class CPL_DLL CPLTraceSpan
+{
+    CPL_DISALLOW_COPY_ASSIGN(CPLTraceSpan)
+
+    const bool m_bEnabled;
+    const char *m_pszCategory = nullptr;
+    const char *m_pszName = nullptr;
+    GIntBig m_nStartUS = 0;
+    std::string m_osArgs{};
+
+    void Start();
+    void End();
+    void AddArgInternal(const char *pszKey, const std::string &osJSONValue);
+
+  public:
+    /** Constructor.
+     *
+     * @param pszCategory Category (e.g. "io", "decode"). Must be a literal.
+     * @param pszName Event name. Must be a literal.
+     */
+    CPLTraceSpan(const char *pszCategory, const char *pszName)
+        : m_bEnabled(CPLIsTraceEnabled())
+    {
+        if (m_bEnabled)
+        {
+            m_pszCategory = pszCategory;
+            m_pszName = pszName;
+            Start();
+        }
+    }
+
+    ~CPLTraceSpan()
+    {
+        if (m_bEnabled)
+            End();
+    }
+
+    /** Return whether the span is recorded. */
+    bool IsEnabled() const
+    {
+        return m_bEnabled;
+    }
+
+    void AddArg(const char *pszKey, GIntBig nValue);
+
+    /** Add an integer argument to the span. */
+    void AddArg(const char *pszKey, int nValue)
+    {
+        AddArg(pszKey, static_cast<GIntBig>(nValue));
+    }
+
+    void AddArg(const char *pszKey, double dfValue);
+    void AddArg(const char *pszKey, const char *pszValue);
+    void AddURLArg(const char *pszKey, const char *pszURL);
+};
+
+#endif  // CPL_TRACE_H_INCLUDED
@@ -188,6 +188,10 @@ typedef enum
 VSIRangeStatus CPL_DLL VSIFGetRangeStatusL(VSILFILE *fp, vsi_l_offset nStart,
                                            vsi_l_offset nLength);
 
+const void CPL_DLL *VSIFAcquireViewL(VSILFILE *fp, vsi_l_offset nOffset,
+                                     size_t nSize);
+void CPL_DLL VSIFReleaseViewL(VSILFILE *fp, const void *pView, size_t nSize);
+
 int CPL_DLL VSIIngestFile(VSILFILE *fp, const char *pszFilename,
                           GByte **ppabyRet, vsi_l_offset *pnSize,
                           GIntBig nMaxSize) CPL_WARN_UNUSED_RESULT;
@@ -464,6 +468,8 @@ int CPL_DLL VSISync(const char *pszSource, const char *pszTarget,
                     GDALProgressFunc pProgressFunc, void *pProgressData,
                     char ***ppapszOutputs);
 int CPL_DLL VSIAbortPendingUploads(const char *pszFilename);
+int CPL_DLL VSIPrefetchMetadata(CSLConstList papszFilenames,
+                                CSLConstList papszOptions);
 
 char CPL_DLL *VSIStrerror(int);
 GIntBig CPL_DLL VSIGetDiskFreeSpace(const char *pszDirname);
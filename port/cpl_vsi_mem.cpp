@@ -157,6 +157,8 @@ class VSIMemHandle final : public VSIVirtualHandle
 
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+
+    const void *AcquireView(vsi_l_offset nOffset, size_t nSize) override;
 };
 
 /************************************************************************/
@@ -448,6 +450,23 @@ size_t VSIMemHandle::PRead(void *pBuffer, size_t nSize,
     return 0;
 }
 
+/************************************************************************/
+/*                            AcquireView()                             */
+/************************************************************************/
+
+const void *VSIMemHandle::AcquireView(vsi_l_offset nOffset, size_t nSize)
+{
+    // Writes through a handle in update mode could reallocate the buffer
+    if (bUpdate)
+        return nullptr;
+
+    CPL_SHARED_LOCK oLock(poFile->m_oMutex);
+
+    if (nOffset > poFile->nLength || nSize > poFile->nLength - nOffset)
+        return nullptr;
+    return poFile->pabyData + static_cast<size_t>(nOffset);
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
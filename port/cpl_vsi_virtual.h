@@ -135,6 +135,9 @@ struct CPL_DLL VSIVirtualHandle
     virtual size_t PRead(void *pBuffer, size_t nSize,
                          vsi_l_offset nOffset) const;
 
+    virtual const void *AcquireView(vsi_l_offset nOffset, size_t nSize);
+    virtual void ReleaseView(const void *pView, size_t nSize);
+
     // NOTE: when adding new methods, besides the "actual" implementations,
     // also consider the VSICachedFile one.
 
@@ -166,6 +169,36 @@ struct VSIVirtualHandleCloser
 typedef std::unique_ptr<VSIVirtualHandle, VSIVirtualHandleCloser>
     VSIVirtualHandleUniquePtr;
 
+/************************************************************************/
+/*                    VSIMultiRangeCoalescingPolicy                     */
+/************************************************************************/
+
+/** Policy used to coalesce reads of several ranges of a file into fewer
+ * requests, on network file systems.
+ *
+ * @since GDAL 3.10
+ */
+struct CPL_DLL VSIMultiRangeCoalescingPolicy
+{
+    /** Maximum number of unrequested bytes between two ranges for them
+     * to be merged into a single request. */
+    vsi_l_offset nMaxGap = 0;
+
+    /** Maximum size in bytes of a request resulting from merging ranges,
+     * or 0 for no limit. */
+    size_t nMaxRequestSize = 0;
+
+    /** Maximum number of requests in flight at the same time, or 0 for no
+     * limit. */
+    int nMaxParallelRequests = 0;
+
+    static VSIMultiRangeCoalescingPolicy
+    FromConfigOptions(double dfLatency, double dfThroughput);
+};
+
+VSIMultiRangeCoalescingPolicy CPL_DLL
+VSIGetMultiRangeCoalescingPolicy(const char *pszPath);
+
 /************************************************************************/
 /*                         VSIFilesystemHandler                         */
 /************************************************************************/
@@ -257,6 +290,12 @@ class CPL_DLL VSIFilesystemHandler
         return FALSE;
     }
 
+    virtual VSIMultiRangeCoalescingPolicy
+    GetMultiRangeCoalescingPolicy(const char * /* pszPath */)
+    {
+        return VSIMultiRangeCoalescingPolicy::FromConfigOptions(0, 0);
+    }
+
     virtual const char *GetActualURL(const char * /*pszFilename*/)
     {
         return nullptr;
@@ -306,6 +345,12 @@ class CPL_DLL VSIFilesystemHandler
         return true;
     }
 
+    virtual bool PrefetchMetadata(CSLConstList /* papszFilenames */,
+                                  CSLConstList /* papszOptions */)
+    {
+        return true;
+    }
+
     virtual std::string
     GetStreamingFilename(const std::string &osFilename) const
     {
@@ -529,7 +574,8 @@ constexpr int VSI_CACHED_DEFAULT_CHUNK_SIZE = 32768;
 VSIVirtualHandle CPL_DLL *
 VSICreateCachedFile(VSIVirtualHandle *poBaseHandle,
                     size_t nChunkSize = VSI_CACHED_DEFAULT_CHUNK_SIZE,
-                    size_t nCacheSize = 0);
+                    size_t nCacheSize = 0, const char *pszFilename = nullptr);
+void VSICachedFileDestroySharedCache();
 
 const int CPL_DEFLATE_TYPE_GZIP = 0;
 const int CPL_DEFLATE_TYPE_ZLIB = 1;
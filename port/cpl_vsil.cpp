@@ -54,6 +54,7 @@
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "cpl_trace.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_vsil_curl_class.h"
 
@@ -821,6 +822,67 @@ int VSIAbortPendingUploads(const char *pszFilename)
     return poFSHandler->AbortPendingUploads(pszFilename);
 }
 
+/************************************************************************/
+/*                         VSIPrefetchMetadata()                        */
+/************************************************************************/
+
+/**
+ * \brief Prefetch the properties of a list of files.
+ *
+ * For network file systems (/vsicurl/, /vsis3/, /vsigs/, /vsiaz/, ...),
+ * this issues concurrently the requests (directory listings and HEAD
+ * requests) needed to know whether the files exist and their size, and
+ * stores the results in the cache of file properties. Subsequent calls to
+ * VSIStatL() or VSIFOpenL() on those files, as done when opening datasets,
+ * then do not need any network round trip for that.
+ *
+ * Without effect on other virtual file systems.
+ *
+ * Currently supported options are:
+ * <ul>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of concurrent requests.
+ * Defaults to 10.</li>
+ * <li>EXTRA_SUFFIXES=comma separated list of suffixes, such as
+ * ".aux.xml,.ovr,.msk", that are appended to each filename to form the name
+ * of side-car files whose existence must also be prefetched.</li>
+ * </ul>
+ *
+ * @param papszFilenames NULL terminated list of filenames. UTF-8 encoded.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ *
+ * @return TRUE on success or FALSE on an error.
+ * @since GDAL 3.10
+ */
+
+int VSIPrefetchMetadata(CSLConstList papszFilenames, CSLConstList papszOptions)
+{
+    // Group filenames per file system, preserving their order
+    std::vector<std::pair<VSIFilesystemHandler *, CPLStringList>> aoGroups;
+    for (const char *pszFilename : cpl::Iterate(papszFilenames))
+    {
+        VSIFilesystemHandler *poFSHandler =
+            VSIFileManager::GetHandler(pszFilename);
+        auto oIter = std::find_if(aoGroups.begin(), aoGroups.end(),
+                                  [poFSHandler](const auto &oGroup)
+                                  { return oGroup.first == poFSHandler; });
+        if (oIter == aoGroups.end())
+        {
+            aoGroups.emplace_back(poFSHandler, CPLStringList());
+            oIter = aoGroups.end() - 1;
+        }
+        oIter->second.AddString(pszFilename);
+    }
+
+    bool bRet = true;
+    for (const auto &oGroup : aoGroups)
+    {
+        if (!oGroup.first->PrefetchMetadata(oGroup.second.List(),
+                                            papszOptions))
+            bRet = false;
+    }
+    return bRet ? TRUE : FALSE;
+}
+
 /************************************************************************/
 /*                              VSIRmdir()                              */
 /************************************************************************/
@@ -1276,6 +1338,106 @@ int VSIHasOptimizedReadMultiRange(const char *pszPath)
     return poFSHandler->HasOptimizedReadMultiRange(pszPath);
 }
 
+/************************************************************************/
+/*                  VSIGetMultiRangeCoalescingPolicy()                  */
+/************************************************************************/
+
+/**
+ * \brief Returns the policy to use to coalesce reads of several ranges of a
+ * file.
+ *
+ * Network file systems use it in their ReadMultiRange() and AdviseRead()
+ * implementations. Code that issues its own parallel requests (for example
+ * through a RandomAccessFile adapter for a third-party library) may use it to
+ * coalesce ranges in the same way.
+ *
+ * @param pszPath the path of the filesystem object to be tested.
+ * UTF-8 encoded.
+ *
+ * @return the policy, built from the GDAL_HTTP_MULTIRANGE_MAX_GAP,
+ * GDAL_HTTP_MULTIRANGE_MAX_REQUEST_SIZE and GDAL_HTTP_MULTIRANGE_MAX_PARALLEL
+ * configuration options, and, if GDAL_HTTP_MULTIRANGE_MAX_GAP=AUTO, from the
+ * latency and throughput observed by the file system.
+ *
+ * @since GDAL 3.10
+ */
+
+VSIMultiRangeCoalescingPolicy
+VSIGetMultiRangeCoalescingPolicy(const char *pszPath)
+{
+    VSIFilesystemHandler *poFSHandler = VSIFileManager::GetHandler(pszPath);
+
+    return poFSHandler->GetMultiRangeCoalescingPolicy(pszPath);
+}
+
+/************************************************************************/
+/*          VSIMultiRangeCoalescingPolicy::FromConfigOptions()          */
+/************************************************************************/
+
+/** Build a coalescing policy from configuration options.
+ *
+ * @param dfLatency Estimated latency (time to first byte) of a request, in
+ * seconds, or 0 if unknown.
+ * @param dfThroughput Estimated throughput of a request, in bytes per second,
+ * or 0 if unknown.
+ * @since GDAL 3.10
+ */
+VSIMultiRangeCoalescingPolicy
+VSIMultiRangeCoalescingPolicy::FromConfigOptions(double dfLatency,
+                                                 double dfThroughput)
+{
+    VSIMultiRangeCoalescingPolicy sPolicy;
+
+    const char *pszMaxRequestSize =
+        CPLGetConfigOption("GDAL_HTTP_MULTIRANGE_MAX_REQUEST_SIZE", nullptr);
+    if (pszMaxRequestSize)
+    {
+        sPolicy.nMaxRequestSize = static_cast<size_t>(std::min<GUIntBig>(
+            std::numeric_limits<size_t>::max(),
+            CPLScanUIntBig(pszMaxRequestSize,
+                           static_cast<int>(strlen(pszMaxRequestSize)))));
+    }
+
+    const char *pszMaxGap =
+        CPLGetConfigOption("GDAL_HTTP_MULTIRANGE_MAX_GAP", "0");
+    if (EQUAL(pszMaxGap, "AUTO"))
+    {
+        // Typical values for cloud object storage, used until the file
+        // system has observed actual ones.
+        if (!(dfLatency > 0))
+            dfLatency = 0.05;
+        if (!(dfThroughput > 0))
+            dfThroughput = 10 * 1024 * 1024;
+
+        // Transferring the bytes of the gap between two ranges is cheaper
+        // than issuing a new request as long as it takes less time than
+        // the latency of a request.
+        constexpr double MAX_AUTO_GAP = 16 * 1024 * 1024;
+        sPolicy.nMaxGap = static_cast<vsi_l_offset>(
+            std::min(MAX_AUTO_GAP, dfLatency * dfThroughput));
+
+        if (!pszMaxRequestSize)
+        {
+            // Size for which the latency is 10% of the duration of the
+            // request, so that merged requests use at least 90% of the
+            // available bandwidth without growing arbitrarily.
+            constexpr double MAX_AUTO_REQUEST_SIZE = 64 * 1024 * 1024;
+            sPolicy.nMaxRequestSize = static_cast<size_t>(std::min(
+                MAX_AUTO_REQUEST_SIZE, 9 * dfLatency * dfThroughput));
+        }
+    }
+    else
+    {
+        sPolicy.nMaxGap = static_cast<vsi_l_offset>(
+            CPLScanUIntBig(pszMaxGap, static_cast<int>(strlen(pszMaxGap))));
+    }
+
+    sPolicy.nMaxParallelRequests = std::max(
+        0, atoi(CPLGetConfigOption("GDAL_HTTP_MULTIRANGE_MAX_PARALLEL", "0")));
+
+    return sPolicy;
+}
+
 /************************************************************************/
 /*                        VSIGetActualURL()                             */
 /************************************************************************/
@@ -2384,6 +2546,9 @@ int VSIFFlushL(VSILFILE *fp)
 size_t VSIFReadL(void *pBuffer, size_t nSize, size_t nCount, VSILFILE *fp)
 
 {
+    CPLTraceSpan oTraceSpan("io", "VSIFReadL");
+    if (oTraceSpan.IsEnabled())
+        oTraceSpan.AddArg("size", static_cast<GIntBig>(nSize * nCount));
     return fp->Read(pBuffer, nSize, nCount);
 }
 
@@ -2443,6 +2608,9 @@ int VSIFReadMultiRangeL(int nRanges, void **ppData,
                         const vsi_l_offset *panOffsets, const size_t *panSizes,
                         VSILFILE *fp)
 {
+    CPLTraceSpan oTraceSpan("io", "VSIFReadMultiRangeL");
+    if (oTraceSpan.IsEnabled())
+        oTraceSpan.AddArg("ranges", nRanges);
     return fp->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
 }
 
@@ -2723,6 +2891,83 @@ VSIRangeStatus VSIFGetRangeStatusL(VSILFILE *fp, vsi_l_offset nOffset,
     return fp->GetRangeStatus(nOffset, nLength);
 }
 
+/************************************************************************/
+/*                          VSIFAcquireViewL()                          */
+/************************************************************************/
+
+/**
+ * \fn VSIVirtualHandle::AcquireView( vsi_l_offset nOffset, size_t nSize )
+ * \brief Return a read-only pointer to a range of the file content.
+ *
+ * This gives direct access to the bytes [nOffset, nOffset + nSize) of the
+ * file, without copying them, when the file system can provide it. This is
+ * currently implemented for regular files opened in read-only mode on
+ * 64-bit Unix systems (through a memory mapping of the file, unless the
+ * CPL_VSIL_MMAP_VIEW configuration option is set to NO) and for /vsimem/
+ * files opened in read-only mode.
+ *
+ * Callers must be prepared to get a null pointer, for example if the range
+ * extends beyond the end of the file, and fall back to Read() or PRead().
+ *
+ * The returned pointer must be released with ReleaseView() before the file
+ * handle is closed. The view is invalidated if the file is modified or
+ * truncated, including by another handle or process.
+ *
+ * @param nOffset offset of the start of the range.
+ * @param nSize size of the range in bytes.
+ *
+ * @return a pointer to the range content, or nullptr.
+ * @since GDAL 3.10
+ */
+
+/**
+ * \brief Return a read-only pointer to a range of the file content.
+ *
+ * This gives direct access to the bytes [nOffset, nOffset + nSize) of the
+ * file, without copying them, when the file system can provide it.
+ * See VSIVirtualHandle::AcquireView() for details.
+ *
+ * @param fp file handle opened with VSIFOpenL().
+ * @param nOffset offset of the start of the range.
+ * @param nSize size of the range in bytes.
+ *
+ * @return a pointer to the range content, to release with
+ *         VSIFReleaseViewL(), or nullptr.
+ * @since GDAL 3.10
+ */
+
+const void *VSIFAcquireViewL(VSILFILE *fp, vsi_l_offset nOffset, size_t nSize)
+{
+    return fp->AcquireView(nOffset, nSize);
+}
+
+/************************************************************************/
+/*                          VSIFReleaseViewL()                          */
+/************************************************************************/
+
+/**
+ * \fn VSIVirtualHandle::ReleaseView( const void* pView, size_t nSize )
+ * \brief Release a pointer returned by AcquireView().
+ *
+ * @param pView pointer returned by AcquireView(), or nullptr.
+ * @param nSize value of the nSize parameter passed to AcquireView().
+ * @since GDAL 3.10
+ */
+
+/**
+ * \brief Release a pointer returned by VSIFAcquireViewL().
+ *
+ * @param fp file handle opened with VSIFOpenL().
+ * @param pView pointer returned by VSIFAcquireViewL(), or nullptr.
+ * @param nSize value of the nSize parameter passed to VSIFAcquireViewL().
+ * @since GDAL 3.10
+ */
+
+void VSIFReleaseViewL(VSILFILE *fp, const void *pView, size_t nSize)
+{
+    fp->ReleaseView(pView, nSize);
+}
+
 /************************************************************************/
 /*                           VSIIngestFile()                            */
 /************************************************************************/
@@ -3472,8 +3717,11 @@ void VSICleanupFileManager()
         hVSIFileManagerMutex = nullptr;
     }
 
+    VSICachedFileDestroySharedCache();
+
 #ifdef HAVE_CURL
     VSICURLDestroyCacheFileProp();
+    VSICURLDestroyShareHandle();
 #endif
 }
 
@@ -3583,3 +3831,22 @@ size_t VSIVirtualHandle::PRead(CPL_UNUSED void *pBuffer,
 {
     return 0;
 }
+
+/************************************************************************/
+/*                            AcquireView()                             */
+/************************************************************************/
+
+const void *VSIVirtualHandle::AcquireView(CPL_UNUSED vsi_l_offset nOffset,
+                                          CPL_UNUSED size_t nSize)
+{
+    return nullptr;
+}
+
+/************************************************************************/
+/*                            ReleaseView()                             */
+/************************************************************************/
+
+void VSIVirtualHandle::ReleaseView(CPL_UNUSED const void *pView,
+                                   CPL_UNUSED size_t nSize)
+{
+}
@@ -946,6 +946,7 @@ char **VSIADLSFSHandler::GetFileMetadata(const char *pszFilename,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -1130,6 +1131,7 @@ bool VSIADLSFSHandler::SetFileMetadata(const char *pszFilename,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -1379,6 +1381,7 @@ int VSIADLSFSHandler::Rename(const char *oldpath, const char *newpath)
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -1529,6 +1532,7 @@ int VSIADLSFSHandler::MkdirInternal(const char *pszDirname, long nMode,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -1686,6 +1690,7 @@ int VSIADLSFSHandler::RmdirInternal(const char *pszDirname, bool bRecursive)
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -1847,6 +1852,7 @@ int VSIADLSFSHandler::CopyObject(const char *oldpath, const char *newpath,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -2001,6 +2007,7 @@ bool VSIADLSFSHandler::UploadFile(const std::string &osFilename, Event event,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
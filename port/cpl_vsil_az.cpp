@@ -904,6 +904,7 @@ char **VSIAzureFSHandler::GetFileMetadata(const char *pszFilename,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -1128,6 +1129,7 @@ bool VSIAzureFSHandler::SetFileMetadata(const char *pszFilename,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -1364,6 +1366,7 @@ bool VSIAzureWriteHandle::SendInternal(bool bInitOnly, bool bIsLastBlock)
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -1573,6 +1576,7 @@ int *VSIAzureFSHandler::UnlinkBatch(CSLConstList papszFiles)
                     CPLSleep(dfRetryDelay);
                     dfRetryDelay = dfNewRetryDelay;
                     nRetryCount++;
+                    NetworkStatisticsLogger::LogRetry();
                     bRetry = true;
                 }
                 else
@@ -1821,6 +1825,7 @@ int VSIAzureFSHandler::CreateContainer(const std::string &osDirname)
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -1991,6 +1996,7 @@ int VSIAzureFSHandler::DeleteContainer(const std::string &osDirname)
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -2167,6 +2173,7 @@ int VSIAzureFSHandler::CopyObject(const char *oldpath, const char *newpath,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -2292,6 +2299,7 @@ std::string VSIAzureFSHandler::PutBlock(
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -2395,6 +2403,7 @@ bool VSIAzureFSHandler::PutBlockList(
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -37,9 +37,13 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
 #include <utility>
 
 #include "cpl_conv.h"
@@ -51,6 +55,164 @@
 
 //! @cond Doxygen_Suppress
 
+typedef std::shared_ptr<const cpl::NonCopyableVector<GByte>>
+    VSICachedFileBlock;
+
+/************************************************************************/
+/* ==================================================================== */
+/*                       VSICachedFileSharedCache                       */
+/* ==================================================================== */
+/************************************************************************/
+
+// Process-wide cache of blocks, shared by all VSICachedFile instances
+// created with VSI_CACHE_SHARED=YES, and keyed by (file, block index).
+// It is split into shards, each one with its own lock and LRU list, so that
+// threads reading different blocks rarely contend.
+
+class VSICachedFileSharedCache
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSICachedFileSharedCache)
+
+    typedef std::pair<uint64_t, vsi_l_offset> BlockKey;
+    typedef lru11::Cache<
+        BlockKey, VSICachedFileBlock, lru11::NullLock,
+        std::map<BlockKey, std::list<lru11::KeyValuePair<
+                               BlockKey, VSICachedFileBlock>>::iterator>>
+        BlockLRU;
+
+    struct Shard
+    {
+        std::mutex oMutex{};
+        BlockLRU oLRU{0, 0};  // unbounded. Pruned by size in Put()
+        size_t nBytes = 0;
+    };
+
+    static constexpr int N_SHARDS = 16;
+    Shard m_aoShards[N_SHARDS];
+    const size_t m_nMaxBytesPerShard;
+
+    std::mutex m_oFileIdsMutex{};
+    std::map<std::string, uint64_t> m_oMapFileIds{};
+
+    Shard &GetShard(uint64_t nFileId, vsi_l_offset nBlock)
+    {
+        // Consecutive blocks of a file go to different shards
+        const uint64_t nHash =
+            (nFileId * 0x9E3779B97F4A7C15ULL) ^ static_cast<uint64_t>(nBlock);
+        return m_aoShards[nHash % N_SHARDS];
+    }
+
+  public:
+    explicit VSICachedFileSharedCache(size_t nMaxBytes)
+        : m_nMaxBytesPerShard(std::max<size_t>(1, nMaxBytes / N_SHARDS))
+    {
+    }
+
+    uint64_t GetFileId(const std::string &osKey);
+    VSICachedFileBlock Get(uint64_t nFileId, vsi_l_offset nBlock);
+    bool Contains(uint64_t nFileId, vsi_l_offset nBlock);
+    void Put(uint64_t nFileId, vsi_l_offset nBlock, VSICachedFileBlock oData);
+};
+
+/************************************************************************/
+/*                             GetFileId()                              */
+/************************************************************************/
+
+uint64_t VSICachedFileSharedCache::GetFileId(const std::string &osKey)
+{
+    std::lock_guard<std::mutex> oLock(m_oFileIdsMutex);
+    const auto oIter = m_oMapFileIds.find(osKey);
+    if (oIter != m_oMapFileIds.end())
+        return oIter->second;
+    const uint64_t nId = m_oMapFileIds.size() + 1;
+    m_oMapFileIds[osKey] = nId;
+    return nId;
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+VSICachedFileBlock VSICachedFileSharedCache::Get(uint64_t nFileId,
+                                                 vsi_l_offset nBlock)
+{
+    Shard &oShard = GetShard(nFileId, nBlock);
+    std::lock_guard<std::mutex> oLock(oShard.oMutex);
+    VSICachedFileBlock oData;
+    oShard.oLRU.tryGet(BlockKey(nFileId, nBlock), oData);
+    return oData;
+}
+
+/************************************************************************/
+/*                              Contains()                              */
+/************************************************************************/
+
+bool VSICachedFileSharedCache::Contains(uint64_t nFileId, vsi_l_offset nBlock)
+{
+    Shard &oShard = GetShard(nFileId, nBlock);
+    std::lock_guard<std::mutex> oLock(oShard.oMutex);
+    return oShard.oLRU.contains(BlockKey(nFileId, nBlock));
+}
+
+/************************************************************************/
+/*                                Put()                                 */
+/************************************************************************/
+
+void VSICachedFileSharedCache::Put(uint64_t nFileId, vsi_l_offset nBlock,
+                                   VSICachedFileBlock oData)
+{
+    Shard &oShard = GetShard(nFileId, nBlock);
+    const BlockKey oKey(nFileId, nBlock);
+    std::lock_guard<std::mutex> oLock(oShard.oMutex);
+    VSICachedFileBlock oExisting;
+    if (oShard.oLRU.tryGet(oKey, oExisting))
+        oShard.nBytes -= oExisting->size();
+    oShard.nBytes += oData->size();
+    oShard.oLRU.insert(oKey, std::move(oData));
+
+    while (oShard.nBytes > m_nMaxBytesPerShard && oShard.oLRU.size() > 1)
+    {
+        BlockKey oOldestKey;
+        VSICachedFileBlock oOldest;
+        oShard.oLRU.getOldestEntry(oOldestKey, oOldest);
+        oShard.nBytes -= oOldest->size();
+        oShard.oLRU.remove(oOldestKey);
+    }
+}
+
+static std::mutex goSharedCacheMutex;
+static std::shared_ptr<VSICachedFileSharedCache> gpoSharedCache;
+
+/************************************************************************/
+/*                           GetSharedCache()                           */
+/************************************************************************/
+
+static std::shared_ptr<VSICachedFileSharedCache> GetSharedCache()
+{
+    std::lock_guard<std::mutex> oLock(goSharedCacheMutex);
+    if (!gpoSharedCache)
+    {
+        const auto nMaxBytes = static_cast<size_t>(std::min(
+            static_cast<GUIntBig>(std::numeric_limits<size_t>::max() / 2),
+            CPLScanUIntBig(
+                CPLGetConfigOption("VSI_CACHE_SHARED_SIZE", "100000000"),
+                40)));
+        gpoSharedCache = std::make_shared<VSICachedFileSharedCache>(nMaxBytes);
+    }
+    return gpoSharedCache;
+}
+
+/************************************************************************/
+/*                  VSICachedFileDestroySharedCache()                   */
+/************************************************************************/
+
+void VSICachedFileDestroySharedCache()
+{
+    // Handles still opened keep a reference on it
+    std::lock_guard<std::mutex> oLock(goSharedCacheMutex);
+    gpoSharedCache.reset();
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                             VSICachedFile                            */
@@ -63,7 +225,7 @@ class VSICachedFile final : public VSIVirtualHandle
 
   public:
     VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
-                  size_t nCacheSize);
+                  size_t nCacheSize, const char *pszFilename);
 
     ~VSICachedFile() override
     {
@@ -79,11 +241,30 @@ class VSICachedFile final : public VSIVirtualHandle
     vsi_l_offset m_nFileSize = 0;
 
     size_t m_nChunkSize = 0;
-    lru11::Cache<vsi_l_offset, cpl::NonCopyableVector<GByte>>
+    lru11::Cache<vsi_l_offset, VSICachedFileBlock>
         m_oCache;  // can only been initialized in constructor
 
+    // Used instead of m_oCache when VSI_CACHE_SHARED=YES
+    std::shared_ptr<VSICachedFileSharedCache> m_poSharedCache{};
+    uint64_t m_nSharedCacheFileId = 0;
+
+    // Asynchronous loading of the blocks following a cache miss, done in a
+    // background thread with PRead(), when VSI_CACHE_PREFETCH_BLOCKS is set.
+    int m_nPrefetchBlocks = 0;
+    std::thread m_oPrefetchThread{};
+    std::atomic<bool> m_bPrefetchDone{true};
+    vsi_l_offset m_nPrefetchStartBlock = 0;
+    vsi_l_offset m_nPrefetchEndBlock = 0;  // exclusive
+
     bool m_bEOF = false;
 
+    VSICachedFileBlock GetBlock(vsi_l_offset nBlock);
+    bool HasBlock(vsi_l_offset nBlock);
+    void PutBlock(vsi_l_offset nBlock, cpl::NonCopyableVector<GByte> &&oData);
+    size_t ReadBase(void *pBuffer, size_t nSize, vsi_l_offset nOffset);
+    void StartPrefetch(vsi_l_offset nStartBlock);
+    void WaitForPrefetch();
+
     int Seek(vsi_l_offset nOffset, int nWhence) override;
     vsi_l_offset Tell() override;
     size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
@@ -117,6 +298,16 @@ class VSICachedFile final : public VSIVirtualHandle
     {
         return m_poBase->PRead(pBuffer, nSize, nOffset);
     }
+
+    const void *AcquireView(vsi_l_offset nOffset, size_t nSize) override
+    {
+        return m_poBase->AcquireView(nOffset, nSize);
+    }
+
+    void ReleaseView(const void *pView, size_t nSize) override
+    {
+        m_poBase->ReleaseView(pView, nSize);
+    }
 };
 
 /************************************************************************/
@@ -148,13 +339,38 @@ template <class T> inline T DIV_ROUND_UP(T a, T b)
 /************************************************************************/
 
 VSICachedFile::VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
-                             size_t nCacheSize)
+                             size_t nCacheSize, const char *pszFilename)
     : m_poBase(poBaseHandle),
       m_nChunkSize(nChunkSize ? nChunkSize : VSI_CACHED_DEFAULT_CHUNK_SIZE),
       m_oCache{DIV_ROUND_UP(GetCacheMax(nCacheSize), m_nChunkSize), 0}
 {
     m_poBase->Seek(0, SEEK_END);
     m_nFileSize = m_poBase->Tell();
+
+    if (pszFilename &&
+        CPLTestBool(CPLGetConfigOption("VSI_CACHE_SHARED", "NO")))
+    {
+        // The file size and modification time are part of the key, so that
+        // blocks of a file modified since they have been cached are not
+        // reused.
+        VSIStatBufL sStat;
+        if (VSIStatL(pszFilename, &sStat) != 0)
+            sStat.st_mtime = 0;
+        std::string osKey(pszFilename);
+        osKey += CPLSPrintf("|" CPL_FRMT_GUIB "|" CPL_FRMT_GIB "|%u",
+                            static_cast<GUIntBig>(m_nFileSize),
+                            static_cast<GIntBig>(sStat.st_mtime),
+                            static_cast<unsigned>(m_nChunkSize));
+        m_poSharedCache = GetSharedCache();
+        m_nSharedCacheFileId = m_poSharedCache->GetFileId(osKey);
+
+        if (m_poBase->HasPRead())
+        {
+            m_nPrefetchBlocks = std::clamp(
+                atoi(CPLGetConfigOption("VSI_CACHE_PREFETCH_BLOCKS", "0")), 0,
+                1024);
+        }
+    }
 }
 
 /************************************************************************/
@@ -164,7 +380,9 @@ VSICachedFile::VSICachedFile(VSIVirtualHandle *poBaseHandle, size_t nChunkSize,
 int VSICachedFile::Close()
 
 {
+    WaitForPrefetch();
     m_oCache.clear();
+    m_poSharedCache.reset();
     m_poBase.reset();
 
     return 0;
@@ -207,6 +425,151 @@ vsi_l_offset VSICachedFile::Tell()
     return m_nOffset;
 }
 
+/************************************************************************/
+/*                              GetBlock()                              */
+/************************************************************************/
+
+VSICachedFileBlock VSICachedFile::GetBlock(vsi_l_offset nBlock)
+{
+    if (m_poSharedCache)
+        return m_poSharedCache->Get(m_nSharedCacheFileId, nBlock);
+    VSICachedFileBlock oData;
+    m_oCache.tryGet(nBlock, oData);
+    return oData;
+}
+
+/************************************************************************/
+/*                              HasBlock()                              */
+/************************************************************************/
+
+bool VSICachedFile::HasBlock(vsi_l_offset nBlock)
+{
+    if (m_poSharedCache)
+        return m_poSharedCache->Contains(m_nSharedCacheFileId, nBlock);
+    return m_oCache.contains(nBlock);
+}
+
+/************************************************************************/
+/*                              PutBlock()                              */
+/************************************************************************/
+
+void VSICachedFile::PutBlock(vsi_l_offset nBlock,
+                             cpl::NonCopyableVector<GByte> &&oData)
+{
+    auto oBlock =
+        std::make_shared<const cpl::NonCopyableVector<GByte>>(std::move(oData));
+    if (m_poSharedCache)
+        m_poSharedCache->Put(m_nSharedCacheFileId, nBlock, std::move(oBlock));
+    else
+        m_oCache.insert(nBlock, std::move(oBlock));
+}
+
+/************************************************************************/
+/*                              ReadBase()                              */
+/************************************************************************/
+
+size_t VSICachedFile::ReadBase(void *pBuffer, size_t nSize,
+                               vsi_l_offset nOffset)
+{
+    // Only PRead() may be used while the prefetch thread is running
+    if (m_nPrefetchBlocks > 0)
+        return m_poBase->PRead(pBuffer, nSize, nOffset);
+    if (m_poBase->Seek(nOffset, SEEK_SET) != 0)
+        return 0;
+    return m_poBase->Read(pBuffer, 1, nSize);
+}
+
+/************************************************************************/
+/*                           StartPrefetch()                            */
+/************************************************************************/
+
+void VSICachedFile::StartPrefetch(vsi_l_offset nStartBlock)
+{
+    // Only one prefetch at a time
+    if (!m_bPrefetchDone)
+        return;
+    WaitForPrefetch();
+
+    vsi_l_offset nEndBlock =
+        std::min(nStartBlock + m_nPrefetchBlocks,
+                 DIV_ROUND_UP(m_nFileSize,
+                              static_cast<vsi_l_offset>(m_nChunkSize)));
+    while (nStartBlock < nEndBlock && HasBlock(nStartBlock))
+        ++nStartBlock;
+    while (nEndBlock > nStartBlock && HasBlock(nEndBlock - 1))
+        --nEndBlock;
+    if (nStartBlock == nEndBlock)
+        return;
+
+    m_nPrefetchStartBlock = nStartBlock;
+    m_nPrefetchEndBlock = nEndBlock;
+    m_bPrefetchDone = false;
+
+    const auto task = [this](CPLStringList aosTLConfigOptions)
+    {
+        CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+        {
+            // Errors will be reported by the synchronous read done by Read()
+            // if a block is missing from the cache.
+            CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+            const size_t nBlocks = static_cast<size_t>(m_nPrefetchEndBlock -
+                                                       m_nPrefetchStartBlock);
+            const vsi_l_offset nStartOffset =
+                m_nPrefetchStartBlock * m_nChunkSize;
+            cpl::NonCopyableVector<GByte> abyBuffer;
+            try
+            {
+                abyBuffer.resize(nBlocks * m_nChunkSize);
+            }
+            catch (const std::exception &)
+            {
+                abyBuffer.clear();
+            }
+            const size_t nRead =
+                abyBuffer.empty() ? 0
+                                  : m_poBase->PRead(abyBuffer.data(),
+                                                    abyBuffer.size(),
+                                                    nStartOffset);
+            for (size_t i = 0; i < nBlocks && i * m_nChunkSize < nRead; ++i)
+            {
+                const size_t nDataFilled =
+                    std::min(m_nChunkSize, nRead - i * m_nChunkSize);
+                // A partial block is only valid at end of file
+                if (nDataFilled < m_nChunkSize &&
+                    nStartOffset + nRead != m_nFileSize)
+                {
+                    break;
+                }
+                try
+                {
+                    cpl::NonCopyableVector<GByte> oData(nDataFilled);
+                    memcpy(oData.data(), abyBuffer.data() + i * m_nChunkSize,
+                           nDataFilled);
+                    PutBlock(m_nPrefetchStartBlock + i, std::move(oData));
+                }
+                catch (const std::exception &)
+                {
+                    break;
+                }
+            }
+        }
+        CPLSetThreadLocalConfigOptions(nullptr);
+        m_bPrefetchDone = true;
+    };
+    m_oPrefetchThread =
+        std::thread(task, CPLStringList(CPLGetThreadLocalConfigOptions()));
+}
+
+/************************************************************************/
+/*                          WaitForPrefetch()                           */
+/************************************************************************/
+
+void VSICachedFile::WaitForPrefetch()
+{
+    if (m_oPrefetchThread.joinable())
+        m_oPrefetchThread.join();
+}
+
 /************************************************************************/
 /*                             LoadBlocks()                             */
 /*                                                                      */
@@ -227,23 +590,17 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
     /* -------------------------------------------------------------------- */
     if (nBlockCount == 1)
     {
-        if (m_poBase->Seek(static_cast<vsi_l_offset>(nStartBlock) *
-                               m_nChunkSize,
-                           SEEK_SET) != 0)
-        {
-            return false;
-        }
-
         try
         {
             cpl::NonCopyableVector<GByte> oData(m_nChunkSize);
             const auto nDataRead =
-                m_poBase->Read(oData.data(), 1, m_nChunkSize);
+                ReadBase(oData.data(), m_nChunkSize,
+                         static_cast<vsi_l_offset>(nStartBlock) * m_nChunkSize);
             if (nDataRead == 0)
                 return false;
             oData.resize(nDataRead);
 
-            m_oCache.insert(nStartBlock, std::move(oData));
+            PutBlock(nStartBlock, std::move(oData));
         }
         catch (const std::exception &)
         {
@@ -271,10 +628,6 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
                           nBufferSize);
     }
 
-    if (m_poBase->Seek(static_cast<vsi_l_offset>(nStartBlock) * m_nChunkSize,
-                       SEEK_SET) != 0)
-        return false;
-
     /* -------------------------------------------------------------------- */
     /*      Do we need to allocate our own buffer?                          */
     /* -------------------------------------------------------------------- */
@@ -293,7 +646,8 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
     /* -------------------------------------------------------------------- */
 
     const size_t nDataRead =
-        m_poBase->Read(pabyWorkBuffer, 1, nBlockCount * m_nChunkSize);
+        ReadBase(pabyWorkBuffer, nBlockCount * m_nChunkSize,
+                 static_cast<vsi_l_offset>(nStartBlock) * m_nChunkSize);
 
     bool ret = true;
     if (nBlockCount * m_nChunkSize > nDataRead + m_nChunkSize - 1)
@@ -320,7 +674,7 @@ bool VSICachedFile::LoadBlocks(vsi_l_offset nStartBlock, size_t nBlockCount,
             memcpy(oData.data(), pabyWorkBuffer + i * m_nChunkSize,
                    nDataFilled);
 
-            m_oCache.insert(iBlock, std::move(oData));
+            PutBlock(iBlock, std::move(oData));
         }
         catch (const std::exception &)
         {
@@ -370,13 +724,23 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nSize, size_t nCount)
         nEndBlock = nLastBlock;
     }
 
+    bool bCacheMiss = false;
     for (vsi_l_offset iBlock = nStartBlock; iBlock <= nEndBlock; iBlock++)
     {
-        if (!m_oCache.contains(iBlock))
+        if (!HasBlock(iBlock))
         {
+            if (!m_bPrefetchDone && iBlock >= m_nPrefetchStartBlock &&
+                iBlock < m_nPrefetchEndBlock)
+            {
+                WaitForPrefetch();
+                if (HasBlock(iBlock))
+                    continue;
+            }
+
+            bCacheMiss = true;
             size_t nBlocksToLoad = 1;
             while (iBlock + nBlocksToLoad <= nEndBlock &&
-                   !m_oCache.contains(iBlock + nBlocksToLoad))
+                   !HasBlock(iBlock + nBlocksToLoad))
             {
                 nBlocksToLoad++;
             }
@@ -385,6 +749,8 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nSize, size_t nCount)
                 break;
         }
     }
+    if (bCacheMiss && m_nPrefetchBlocks > 0)
+        StartPrefetch(nEndBlock + 1);
 
     /* ==================================================================== */
     /*      Copy data into the target buffer to the extent possible.        */
@@ -394,14 +760,14 @@ size_t VSICachedFile::Read(void *pBuffer, size_t nSize, size_t nCount)
     while (nAmountCopied < nRequestedBytes)
     {
         const vsi_l_offset iBlock = (m_nOffset + nAmountCopied) / m_nChunkSize;
-        const cpl::NonCopyableVector<GByte> *poData = m_oCache.getPtr(iBlock);
+        VSICachedFileBlock poData = GetBlock(iBlock);
         if (poData == nullptr)
         {
             // We can reach that point when the amount to read exceeds
             // the cache size.
             LoadBlocks(iBlock, 1, static_cast<GByte *>(pBuffer) + nAmountCopied,
                        std::min(nRequestedBytes - nAmountCopied, m_nChunkSize));
-            poData = m_oCache.getPtr(iBlock);
+            poData = GetBlock(iBlock);
             if (poData == nullptr)
             {
                 break;
@@ -645,7 +1011,8 @@ VSIVirtualHandle *VSICachedFilesystemHandler::Open(const char *pszFilename,
                            papszOptions);
     if (!fp)
         return nullptr;
-    return VSICreateCachedFile(fp, nChunkSize, nCacheSize);
+    return VSICreateCachedFile(fp, nChunkSize, nCacheSize,
+                               osUnderlyingFilename.c_str());
 }
 
 /************************************************************************/
@@ -698,13 +1065,21 @@ char **VSICachedFilesystemHandler::ReadDirEx(const char *pszDirname,
  * @param nCacheSize total size of the cache for the file, in bytes.
  *                   If 0, defaults to the value of the VSI_CACHE_SIZE
  *                   configuration option, which defaults to 25 MB.
+ * @param pszFilename name of the file, or nullptr. When it is provided and
+ *                    the VSI_CACHE_SHARED configuration option is set to YES,
+ *                    the cache is a process-wide one shared by the handles
+ *                    opened on the same file, whose size is controlled by
+ *                    VSI_CACHE_SHARED_SIZE instead of nCacheSize.
+ *                    (added in GDAL 3.10)
  * @return a new handle
  */
 VSIVirtualHandle *VSICreateCachedFile(VSIVirtualHandle *poBaseHandle,
-                                      size_t nChunkSize, size_t nCacheSize)
+                                      size_t nChunkSize, size_t nCacheSize,
+                                      const char *pszFilename)
 
 {
-    return new VSICachedFile(poBaseHandle, nChunkSize, nCacheSize);
+    return new VSICachedFile(poBaseHandle, nChunkSize, nCacheSize,
+                             pszFilename);
 }
 
 /************************************************************************/
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -44,10 +45,18 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
+#include "cpl_trace.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_mem_cache.h"
+#include "cpl_sha256.h"
+
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
 
 #ifndef S_IRUSR
 #define S_IRUSR 00400
@@ -223,6 +232,9 @@ static int GetMaxRegions()
     return N_MAX_REGIONS_DO_NOT_USE_DIRECTLY;
 }
 
+// Maximum number of chunks downloaded at once by sequential reads
+constexpr int MAX_CHUNK_SIZE_INCREASE_FACTOR = 128;
+
 /************************************************************************/
 /*          VSICurlFindStringSensitiveExceptEscapeSequences()           */
 /************************************************************************/
@@ -482,6 +494,14 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
 
     m_bCached = poFSIn->AllowCachedDataFor(pszFilename);
     poFS->GetCachedFileProp(m_pszURL, oFileProp);
+
+    // Readahead relies on the region cache, and on byte range requests
+    if (m_bCached && STARTS_WITH(m_pszURL, "http"))
+    {
+        m_nReadAheadMaxDepth = std::max(
+            0, std::min(16, atoi(CPLGetConfigOption(
+                                "CPL_VSIL_CURL_READAHEAD_DEPTH", "0"))));
+    }
 }
 
 /************************************************************************/
@@ -495,6 +515,18 @@ VSICurlHandle::~VSICurlHandle()
         m_oThreadAdviseRead.join();
     }
 
+    JoinReadAheadWindows(/* bOnlyFinished = */ false);
+
+    if (!m_oMapUnreadBlocks.empty())
+    {
+        GIntBig nWastedBytes = 0;
+        for (const auto &kv : m_oMapUnreadBlocks)
+            nWastedBytes += kv.second;
+        NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+        NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+        NetworkStatisticsLogger::LogWastedBytes(nWastedBytes);
+    }
+
     if (!m_bCached)
     {
         poFS->InvalidateCachedData(m_pszURL);
@@ -834,6 +866,16 @@ static GIntBig VSICurlGetExpiresFromS3LikeSignedURL(const char *pszURL)
 
 void VSICURLMultiPerform(CURLM *hCurlMultiHandle, CURL *hEasyHandle)
 {
+    CPLTraceSpan oTraceSpan("http", "HTTP request");
+    if (oTraceSpan.IsEnabled() && hEasyHandle)
+    {
+        char *pszURL = nullptr;
+        if (curl_easy_getinfo(hEasyHandle, CURLINFO_EFFECTIVE_URL, &pszURL) ==
+                CURLE_OK &&
+            pszURL)
+            oTraceSpan.AddURLArg("url", pszURL);
+    }
+
     int repeats = 0;
 
     if (hEasyHandle)
@@ -871,7 +913,10 @@ void VSICURLMultiPerform(CURLM *hCurlMultiHandle, CURL *hEasyHandle)
     CPLHTTPRestoreSigPipeHandler(old_handler);
 
     if (hEasyHandle)
+    {
         curl_multi_remove_handle(hCurlMultiHandle, hEasyHandle);
+        cpl::NetworkStatisticsLogger::LogRequestTimings(hEasyHandle);
+    }
 }
 
 /************************************************************************/
@@ -1459,6 +1504,7 @@ retry:
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 CPLFree(sWriteFuncData.pBuffer);
                 CPLFree(sWriteFuncHeaderData.pBuffer);
                 curl_easy_cleanup(hCurlHandle);
@@ -1941,6 +1987,7 @@ retry:
         CPLFree(sWriteFuncHeaderData.pBuffer);
         curl_easy_cleanup(hCurlHandle);
         nRetryCount++;
+        NetworkStatisticsLogger::LogRetry();
         if (Authenticate(m_osFilename.c_str()))
             goto retry;
         return std::string();
@@ -1977,6 +2024,7 @@ retry:
             CPLSleep(dfRetryDelay);
             dfRetryDelay = dfNewRetryDelay;
             nRetryCount++;
+            NetworkStatisticsLogger::LogRetry();
             CPLFree(sWriteFuncData.pBuffer);
             CPLFree(sWriteFuncHeaderData.pBuffer);
             curl_easy_cleanup(hCurlHandle);
@@ -2216,9 +2264,19 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
              static_cast<int>(curOffset), static_cast<int>(nBufferRequestSize));
 #endif
 
+    // A backward seek or a forward jump beyond the readahead window
+    // means that the file is no longer read sequentially.
+    if (m_nReadAheadNextOffset != VSI_L_OFFSET_MAX &&
+        (curOffset < m_nReadAheadStartOffset ||
+         curOffset > m_nReadAheadNextOffset))
+    {
+        StopReadAhead();
+    }
+
     vsi_l_offset iterOffset = curOffset;
     const int knMAX_REGIONS = GetMaxRegions();
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    bool bSequentialDownload = false;
     while (nBufferRequestSize)
     {
         // Don't try to read after end of file.
@@ -2240,6 +2298,10 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
             poFS->GetRegion(m_pszURL, nOffsetToDownload);
+        if (psRegion == nullptr && WaitForReadAhead(nOffsetToDownload))
+        {
+            psRegion = poFS->GetRegion(m_pszURL, nOffsetToDownload);
+        }
         if (psRegion != nullptr)
         {
             osRegion = *psRegion;
@@ -2252,9 +2314,9 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
                 // heuristic that we will read the file sequentially, so
                 // we double the requested size to decrease the number of
                 // client/server roundtrips.
-                constexpr int MAX_CHUNK_SIZE_INCREASE_FACTOR = 128;
                 if (nBlocksToDownload < MAX_CHUNK_SIZE_INCREASE_FACTOR)
                     nBlocksToDownload *= 2;
+                bSequentialDownload = true;
             }
             else
             {
@@ -2302,7 +2364,31 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
                     bEOF = true;
                 return 0;
             }
+
+            if (NetworkStatisticsLogger::IsEnabled())
+            {
+                // Remember the downloaded blocks, to be able to report the
+                // ones that are never read.
+                poFS->GetCachedFileProp(m_pszURL, oFileProp);
+                for (int i = 0; i < nBlocksToDownload; i++)
+                {
+                    const vsi_l_offset nBlockOffset =
+                        nOffsetToDownload +
+                        static_cast<vsi_l_offset>(i) * knDOWNLOAD_CHUNK_SIZE;
+                    size_t nBlockSize = knDOWNLOAD_CHUNK_SIZE;
+                    if (oFileProp.bHasComputedFileSize)
+                    {
+                        if (nBlockOffset >= oFileProp.fileSize)
+                            break;
+                        nBlockSize = static_cast<size_t>(std::min(
+                            static_cast<vsi_l_offset>(nBlockSize),
+                            oFileProp.fileSize - nBlockOffset));
+                    }
+                    m_oMapUnreadBlocks[nBlockOffset] = nBlockSize;
+                }
+            }
         }
+        m_oMapUnreadBlocks.erase(nOffsetToDownload);
 
         const vsi_l_offset nRegionOffset = iterOffset - nOffsetToDownload;
         if (osRegion.size() < nRegionOffset)
@@ -2335,11 +2421,385 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
     if (ret != nMemb)
         bEOF = true;
 
+    const vsi_l_offset nReadStartOffset = curOffset;
     curOffset = iterOffset;
 
+    if (m_nReadAheadMaxDepth > 0)
+    {
+        UpdateReadAhead(bSequentialDownload);
+        if (m_nReadAheadNextOffset != VSI_L_OFFSET_MAX)
+            m_nReadAheadStartOffset = nReadStartOffset;
+    }
+
     return ret;
 }
 
+/************************************************************************/
+/*                          UpdateReadAhead()                           */
+/************************************************************************/
+
+/** Issue asynchronous downloads of the regions following the current
+ * position, once sequential reading has been detected, so that the transfer
+ * of the next regions overlaps with the consumption of the current one.
+ *
+ * The readahead depth, that is the number of windows ahead of the current
+ * position, starts at 1 and is increased by WaitForReadAhead() each time the
+ * reader catches up with a window still in download, up to
+ * CPL_VSIL_CURL_READAHEAD_DEPTH. The size of the windows grows in the same
+ * way as the size of the synchronous downloads of sequential reads.
+ *
+ * Each window is downloaded in its own thread by a new handle on the same
+ * file, so that the state of this handle is never accessed concurrently.
+ * Downloaded data is stored in the region cache of the file system, where
+ * Read() will find it.
+ */
+void VSICurlHandle::UpdateReadAhead(bool bSequentialDownload)
+{
+    JoinReadAheadWindows(/* bOnlyFinished = */ true);
+
+    if (m_nReadAheadNextOffset == VSI_L_OFFSET_MAX)
+    {
+        if (!bSequentialDownload || pfnReadCbk != nullptr || bInterrupted)
+            return;
+        m_nReadAheadDepth = 1;
+        m_nReadAheadBlocks = nBlocksToDownload;
+        m_nReadAheadNextOffset = lastDownloadedOffset;
+        CPLDebug(poFS->GetDebugKey(),
+                 "Starting readahead of %s at offset " CPL_FRMT_GUIB,
+                 m_pszURL, m_nReadAheadNextOffset);
+    }
+    else if (bSequentialDownload &&
+             lastDownloadedOffset > m_nReadAheadNextOffset)
+    {
+        // The reader went faster than the readahead
+        m_nReadAheadNextOffset = lastDownloadedOffset;
+    }
+
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    // All windows in flight must fit in the region cache, otherwise
+    // they would be evicted before being consumed.
+    const int nMaxBlocks = std::max(
+        1, std::min(MAX_CHUNK_SIZE_INCREASE_FACTOR,
+                    GetMaxRegions() / (2 * m_nReadAheadMaxDepth)));
+    m_nReadAheadBlocks = std::min(m_nReadAheadBlocks, nMaxBlocks);
+
+    while (static_cast<int>(m_apoReadAheadWindows.size()) <
+               2 * m_nReadAheadMaxDepth &&
+           m_nReadAheadNextOffset <
+               curOffset + static_cast<vsi_l_offset>(m_nReadAheadDepth) *
+                               m_nReadAheadBlocks * knDOWNLOAD_CHUNK_SIZE)
+    {
+        poFS->GetCachedFileProp(m_pszURL, oFileProp);
+        if (oFileProp.bHasComputedFileSize &&
+            m_nReadAheadNextOffset >= oFileProp.fileSize)
+        {
+            break;
+        }
+
+        std::unique_ptr<VSICurlHandle> poHandle(
+            poFS->CreateFileHandle(m_osFilename.c_str()));
+        if (!poHandle)
+        {
+            StopReadAhead();
+            return;
+        }
+
+        auto poWindow = std::make_unique<ReadAheadWindow>();
+        poWindow->nStartOffset = m_nReadAheadNextOffset;
+        poWindow->nEndOffset =
+            m_nReadAheadNextOffset +
+            static_cast<vsi_l_offset>(m_nReadAheadBlocks) *
+                knDOWNLOAD_CHUNK_SIZE;
+
+        const auto task = [](ReadAheadWindow *psWindow,
+                             std::unique_ptr<VSICurlHandle> poHandleIn,
+                             int nBlocks, CPLStringList aosTLConfigOptions)
+        {
+            CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+            {
+                NetworkStatisticsFileSystem oContextFS(
+                    poHandleIn->poFS->GetFSPrefix().c_str());
+                NetworkStatisticsFile oContextFile(
+                    poHandleIn->m_osFilename.c_str());
+                NetworkStatisticsAction oContextAction("ReadAhead");
+
+                // Errors will be reported by the synchronous download
+                // done by Read() if the region is missing from the cache.
+                CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+                poHandleIn->DownloadRegion(psWindow->nStartOffset, nBlocks);
+                poHandleIn.reset();
+            }
+            CPLSetThreadLocalConfigOptions(nullptr);
+
+            std::lock_guard<std::mutex> oLock(psWindow->oMutex);
+            psWindow->bDone = true;
+            psWindow->oCV.notify_all();
+        };
+        poWindow->oThread =
+            std::thread(task, poWindow.get(), std::move(poHandle),
+                        m_nReadAheadBlocks,
+                        CPLStringList(CPLGetThreadLocalConfigOptions()));
+
+        m_nReadAheadNextOffset = poWindow->nEndOffset;
+        m_apoReadAheadWindows.push_back(std::move(poWindow));
+
+        if (m_nReadAheadBlocks < nMaxBlocks)
+            m_nReadAheadBlocks = std::min(2 * m_nReadAheadBlocks, nMaxBlocks);
+    }
+}
+
+/************************************************************************/
+/*                         WaitForReadAhead()                           */
+/************************************************************************/
+
+/** Wait for the completion of the readahead window containing nOffset, if
+ * there is one.
+ *
+ * @return true if nOffset was in a readahead window, in which case the
+ * region cache should be queried again.
+ */
+bool VSICurlHandle::WaitForReadAhead(vsi_l_offset nOffset)
+{
+    for (auto &poWindow : m_apoReadAheadWindows)
+    {
+        if (nOffset >= poWindow->nStartOffset &&
+            nOffset < poWindow->nEndOffset)
+        {
+            std::unique_lock<std::mutex> oLock(poWindow->oMutex);
+            if (!poWindow->bDone &&
+                m_nReadAheadNextOffset != VSI_L_OFFSET_MAX &&
+                m_nReadAheadDepth < m_nReadAheadMaxDepth)
+            {
+                // The reader consumes data faster than it is downloaded:
+                // keep more requests in flight.
+                m_nReadAheadDepth++;
+                CPLDebug(poFS->GetDebugKey(),
+                         "Increasing readahead depth to %d", m_nReadAheadDepth);
+            }
+            // coverity[missing_lock:FALSE]
+            while (!poWindow->bDone)
+            {
+                poWindow->oCV.wait(oLock);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                           StopReadAhead()                            */
+/************************************************************************/
+
+void VSICurlHandle::StopReadAhead()
+{
+    if (m_nReadAheadNextOffset != VSI_L_OFFSET_MAX)
+    {
+        CPLDebug(poFS->GetDebugKey(), "Stopping readahead of %s", m_pszURL);
+        m_nReadAheadNextOffset = VSI_L_OFFSET_MAX;
+    }
+    // Windows in flight are not cancelled, but are left to complete and
+    // populate the region cache.
+}
+
+/************************************************************************/
+/*                        JoinReadAheadWindows()                        */
+/************************************************************************/
+
+/** Join the threads of the readahead windows.
+ *
+ * @param bOnlyFinished if true, only join the threads of completed windows
+ * that are no longer ahead of the current position of an active readahead.
+ */
+void VSICurlHandle::JoinReadAheadWindows(bool bOnlyFinished)
+{
+    for (auto oIter = m_apoReadAheadWindows.begin();
+         oIter != m_apoReadAheadWindows.end();)
+    {
+        auto &poWindow = *oIter;
+        if (bOnlyFinished)
+        {
+            bool bDone;
+            {
+                std::lock_guard<std::mutex> oLock(poWindow->oMutex);
+                bDone = poWindow->bDone;
+            }
+            if (!bDone || (m_nReadAheadNextOffset != VSI_L_OFFSET_MAX &&
+                           poWindow->nEndOffset > curOffset &&
+                           poWindow->nStartOffset < m_nReadAheadNextOffset))
+            {
+                ++oIter;
+                continue;
+            }
+        }
+        poWindow->oThread.join();
+        oIter = m_apoReadAheadWindows.erase(oIter);
+    }
+}
+
+/************************************************************************/
+/*                        VSICURLCoalesceRanges()                       */
+/************************************************************************/
+
+namespace
+{
+struct CoalescedRequest
+{
+    vsi_l_offset nStartOffset = 0;
+    vsi_l_offset nEndOffset = 0;  // exclusive
+    int iFirstRange = 0;
+    int iLastRange = 0;  // inclusive
+};
+}  // namespace
+
+/** Group ranges, taken in the order they are provided, into requests.
+ *
+ * A range is merged into the request of the previous ones if it does not
+ * start before it, if the gap between them is not larger than
+ * sPolicy.nMaxGap, and if the resulting request is not larger than
+ * sPolicy.nMaxRequestSize. Empty ranges do not generate any request.
+ */
+static std::vector<CoalescedRequest>
+VSICURLCoalesceRanges(int nRanges, const vsi_l_offset *panOffsets,
+                      const size_t *panSizes,
+                      const VSIMultiRangeCoalescingPolicy &sPolicy,
+                      bool bMergeRanges)
+{
+    std::vector<CoalescedRequest> aoRequests;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i] == 0)
+            continue;
+        const vsi_l_offset nEnd = panOffsets[i] + panSizes[i];
+        if (bMergeRanges && !aoRequests.empty())
+        {
+            auto &oLast = aoRequests.back();
+            const vsi_l_offset nNewEnd = std::max(oLast.nEndOffset, nEnd);
+            if (panOffsets[i] >= oLast.nStartOffset &&
+                panOffsets[i] <= oLast.nEndOffset + sPolicy.nMaxGap &&
+                (sPolicy.nMaxRequestSize == 0 ||
+                 nNewEnd - oLast.nStartOffset <= sPolicy.nMaxRequestSize))
+            {
+                oLast.nEndOffset = nNewEnd;
+                oLast.iLastRange = i;
+                continue;
+            }
+        }
+        CoalescedRequest oRequest;
+        oRequest.nStartOffset = panOffsets[i];
+        oRequest.nEndOffset = nEnd;
+        oRequest.iFirstRange = i;
+        oRequest.iLastRange = i;
+        aoRequests.push_back(oRequest);
+    }
+    return aoRequests;
+}
+
+/************************************************************************/
+/*                     VSICURLMultiPerformLimited()                     */
+/************************************************************************/
+
+/** Run the transfers of the easy handles, with at most nMaxParallel of them
+ * (0 meaning no limit) in progress at the same time.
+ *
+ * Handles are added to the multi handle, and left in it.
+ */
+static void VSICURLMultiPerformLimited(CURLM *hCurlMultiHandle,
+                                       const std::vector<CURL *> &aHandles,
+                                       int nMaxParallel)
+{
+    size_t nAdded = aHandles.size();
+    if (nMaxParallel > 0)
+        nAdded = std::min(nAdded, static_cast<size_t>(nMaxParallel));
+    for (size_t i = 0; i < nAdded; ++i)
+        curl_multi_add_handle(hCurlMultiHandle, aHandles[i]);
+
+    if (nAdded == aHandles.size())
+    {
+        VSICURLMultiPerform(hCurlMultiHandle);
+        return;
+    }
+
+    int repeats = 0;
+    void *old_handler = CPLHTTPIgnoreSigPipe();
+    while (true)
+    {
+        int still_running;
+        while (curl_multi_perform(hCurlMultiHandle, &still_running) ==
+               CURLM_CALL_MULTI_PERFORM)
+        {
+            // loop
+        }
+
+        // Start a new transfer each time one is completed
+        bool bAddedNew = false;
+        CURLMsg *msg;
+        do
+        {
+            int msgq = 0;
+            msg = curl_multi_info_read(hCurlMultiHandle, &msgq);
+            if (msg && msg->msg == CURLMSG_DONE && nAdded < aHandles.size())
+            {
+                curl_multi_add_handle(hCurlMultiHandle, aHandles[nAdded]);
+                ++nAdded;
+                bAddedNew = true;
+            }
+        } while (msg);
+
+        if (!still_running && !bAddedNew)
+        {
+            if (nAdded == aHandles.size())
+                break;
+            // Should not happen, but avoid waiting forever
+            curl_multi_add_handle(hCurlMultiHandle, aHandles[nAdded]);
+            ++nAdded;
+        }
+        else if (!bAddedNew)
+        {
+            CPLMultiPerformWait(hCurlMultiHandle, repeats);
+        }
+    }
+    CPLHTTPRestoreSigPipeHandler(old_handler);
+}
+
+/************************************************************************/
+/*                    VSICURLUpdateNetworkEstimates()                   */
+/************************************************************************/
+
+/** Feed the latency and throughput of a completed transfer to the estimates
+ * of the file system, used by GDAL_HTTP_MULTIRANGE_MAX_GAP=AUTO.
+ */
+static void VSICURLUpdateNetworkEstimates(VSICurlFilesystemHandlerBase *poFS,
+                                          CURL *hCurlHandle, size_t nSize)
+{
+#if LIBCURL_VERSION_NUM >= 0x073D00
+    curl_off_t nStartTransferTimeUS = 0;
+    curl_off_t nTotalTimeUS = 0;
+    if (curl_easy_getinfo(hCurlHandle, CURLINFO_STARTTRANSFER_TIME_T,
+                          &nStartTransferTimeUS) != CURLE_OK ||
+        curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME_T,
+                          &nTotalTimeUS) != CURLE_OK ||
+        nStartTransferTimeUS <= 0)
+    {
+        return;
+    }
+    // Too small transfers give meaningless throughput values
+    constexpr size_t MIN_SIZE_FOR_THROUGHPUT = 64 * 1024;
+    double dfThroughput = 0;
+    if (nSize >= MIN_SIZE_FOR_THROUGHPUT && nTotalTimeUS > nStartTransferTimeUS)
+    {
+        dfThroughput = static_cast<double>(nSize) * 1e6 /
+                       static_cast<double>(nTotalTimeUS - nStartTransferTimeUS);
+    }
+    poFS->UpdateNetworkEstimates(
+        static_cast<double>(nStartTransferTimeUS) / 1e6, dfThroughput);
+#else
+    CPL_IGNORE_RET_VAL(poFS);
+    CPL_IGNORE_RET_VAL(hCurlHandle);
+    CPL_IGNORE_RET_VAL(nSize);
+#endif
+}
+
 /************************************************************************/
 /*                           ReadMultiRange()                           */
 /************************************************************************/
@@ -2411,27 +2871,15 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
 
     std::vector<CurlErrBuffer> asCurlErrors(nRanges);
 
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    const auto sPolicy = poFS->GetMultiRangeCoalescingPolicy(m_pszURL);
+    const auto aoRequests = VSICURLCoalesceRanges(
+        nRanges, panOffsets, panSizes, sPolicy,
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE")));
 
-    for (int i = 0, iRequest = 0; i < nRanges;)
+    for (size_t iRequest = 0; iRequest < aoRequests.size(); ++iRequest)
     {
-        size_t nSize = 0;
-        int iNext = i;
-        // Identify consecutive ranges
-        while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
-               panOffsets[iNext] + panSizes[iNext] == panOffsets[iNext + 1])
-        {
-            nSize += panSizes[iNext];
-            iNext++;
-        }
-        nSize += panSizes[iNext];
-
-        if (nSize == 0)
-        {
-            i = iNext + 1;
-            continue;
-        }
+        const auto &oRequest = aoRequests[iRequest];
 
         CURL *hCurlHandle = curl_easy_init();
         aHandles.push_back(hCurlHandle);
@@ -2457,9 +2905,9 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
                                    VSICurlHandleWriteFunc);
         asWriteFuncHeaderData[iRequest].bIsHTTP = STARTS_WITH(m_pszURL, "http");
-        asWriteFuncHeaderData[iRequest].nStartOffset = panOffsets[i];
+        asWriteFuncHeaderData[iRequest].nStartOffset = oRequest.nStartOffset;
 
-        asWriteFuncHeaderData[iRequest].nEndOffset = panOffsets[i] + nSize - 1;
+        asWriteFuncHeaderData[iRequest].nEndOffset = oRequest.nEndOffset - 1;
 
         char rangeStr[512] = {};
         snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
@@ -2491,34 +2939,26 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         headers = VSICurlMergeHeaders(headers, GetCurlHeaders("GET", headers));
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
         aHeaders.push_back(headers);
-        curl_multi_add_handle(hMultiHandle, hCurlHandle);
-
-        i = iNext + 1;
-        iRequest++;
     }
 
     if (!aHandles.empty())
     {
-        VSICURLMultiPerform(hMultiHandle);
+        VSICURLMultiPerformLimited(hMultiHandle, aHandles,
+                                   sPolicy.nMaxParallelRequests);
     }
 
     int nRet = 0;
-    size_t iReq = 0;
-    int iRange = 0;
     size_t nTotalDownloaded = 0;
-    for (; iReq < aHandles.size(); iReq++, iRange++)
+    vsi_l_offset nTotalRequested = 0;
+    for (size_t iReq = 0; iReq < aHandles.size(); iReq++)
     {
-        while (iRange < nRanges && panSizes[iRange] == 0)
-        {
-            iRange++;
-        }
-        if (iRange == nRanges)
-            break;
+        const auto &oRequest = aoRequests[iReq];
+        nTotalRequested += oRequest.nEndOffset - oRequest.nStartOffset;
 
         long response_code = 0;
         curl_easy_getinfo(aHandles[iReq], CURLINFO_HTTP_CODE, &response_code);
 
-        if (ENABLE_DEBUG && asCurlErrors[iRange].szCurlErrBuf[0] != '\0')
+        if (ENABLE_DEBUG && asCurlErrors[iReq].szCurlErrBuf[0] != '\0')
         {
             char rangeStr[512] = {};
             snprintf(rangeStr, sizeof(rangeStr),
@@ -2526,7 +2966,7 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                      asWriteFuncHeaderData[iReq].nStartOffset,
                      asWriteFuncHeaderData[iReq].nEndOffset);
 
-            const char *pszErrorMsg = &asCurlErrors[iRange].szCurlErrBuf[0];
+            const char *pszErrorMsg = &asCurlErrors[iReq].szCurlErrBuf[0];
             CPLDebug(poFS->GetDebugKey(),
                      "ReadMultiRange(%s), %s: response_code=%d, msg=%s",
                      osURL.c_str(), rangeStr, static_cast<int>(response_code),
@@ -2551,40 +2991,25 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         }
         else if (nRet == 0)
         {
-            size_t nOffset = 0;
-            size_t nRemainingSize = asWriteFuncData[iReq].nSize;
-            nTotalDownloaded += nRemainingSize;
-            CPLAssert(iRange < nRanges);
-            while (true)
+            nTotalDownloaded += asWriteFuncData[iReq].nSize;
+            for (int iRange = oRequest.iFirstRange;
+                 iRange <= oRequest.iLastRange; ++iRange)
             {
-                if (nRemainingSize < panSizes[iRange])
-                {
-                    nRet = -1;
-                    break;
-                }
-
                 if (panSizes[iRange] > 0)
                 {
                     memcpy(ppData[iRange],
-                           asWriteFuncData[iReq].pBuffer + nOffset,
+                           asWriteFuncData[iReq].pBuffer +
+                               static_cast<size_t>(panOffsets[iRange] -
+                                                   oRequest.nStartOffset),
                            panSizes[iRange]);
                 }
-
-                if (bMergeConsecutiveRanges && iRange + 1 < nRanges &&
-                    panOffsets[iRange] + panSizes[iRange] ==
-                        panOffsets[iRange + 1])
-                {
-                    nOffset += panSizes[iRange];
-                    nRemainingSize -= panSizes[iRange];
-                    iRange++;
-                }
-                else
-                {
-                    break;
-                }
             }
+
+            VSICURLUpdateNetworkEstimates(poFS, aHandles[iReq],
+                                          asWriteFuncData[iReq].nSize);
         }
 
+        NetworkStatisticsLogger::LogRequestTimings(aHandles[iReq]);
         curl_multi_remove_handle(hMultiHandle, aHandles[iReq]);
         VSICURLResetHeaderAndWriterFunctions(aHandles[iReq]);
         curl_easy_cleanup(aHandles[iReq]);
@@ -2594,7 +3019,28 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         curl_slist_free_all(aHeaders[iReq]);
     }
 
+    vsi_l_offset nTotalUseful = 0;
+    for (int i = 0; i < nRanges; ++i)
+        nTotalUseful += panSizes[i];
+    if (ENABLE_DEBUG)
+    {
+        CPLDebug(poFS->GetDebugKey(),
+                 "ReadMultiRange(): %d ranges coalesced into %d requests "
+                 "(max gap = " CPL_FRMT_GUIB "): " CPL_FRMT_GUIB
+                 " bytes requested, " CPL_FRMT_GUIB " bytes for ranges",
+                 nRanges, static_cast<int>(aoRequests.size()),
+                 static_cast<GUIntBig>(sPolicy.nMaxGap),
+                 static_cast<GUIntBig>(nTotalRequested),
+                 static_cast<GUIntBig>(nTotalUseful));
+    }
+
     NetworkStatisticsLogger::LogGET(nTotalDownloaded);
+    // Bytes of the gaps between coalesced ranges
+    if (nRet == 0 && nTotalDownloaded > nTotalUseful)
+    {
+        NetworkStatisticsLogger::LogWastedBytes(
+            static_cast<GIntBig>(nTotalDownloaded - nTotalUseful));
+    }
 
     if (ENABLE_DEBUG)
         CPLDebug(poFS->GetDebugKey(), "Download completed");
@@ -3104,6 +3550,7 @@ size_t VSICurlHandle::PRead(void *pBuffer, size_t nSize,
     CURLM *hMultiHandle = poFS->GetCurlMultiHandleFor(osURL);
     curl_multi_add_handle(hMultiHandle, hCurlHandle);
     VSICURLMultiPerform(hMultiHandle);
+    NetworkStatisticsLogger::LogRequestTimings(hCurlHandle);
 
     {
         std::lock_guard<std::mutex> oLock(m_oMutex);
@@ -3209,51 +3656,34 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
         return;
     }
 
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    auto sPolicy = poFS->GetMultiRangeCoalescingPolicy(m_pszURL);
+    // Always merge ranges only separated by the COG ghost markers of tiles
+    constexpr size_t SIZE_COG_MARKERS = 2 * sizeof(uint32_t);
+    sPolicy.nMaxGap = std::max<vsi_l_offset>(sPolicy.nMaxGap, SIZE_COG_MARKERS);
+    const auto aoRequests = VSICURLCoalesceRanges(
+        nRanges, panOffsets, panSizes, sPolicy,
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE")));
 
     try
     {
-        m_aoAdviseReadRanges.resize(nRanges);
-        int iRequest = 0;
-        for (int i = 0; i < nRanges;)
-        {
-            int iNext = i;
-            // Identify consecutive ranges
-            constexpr size_t SIZE_COG_MARKERS = 2 * sizeof(uint32_t);
-            auto nEndOffset = panOffsets[iNext] + panSizes[iNext];
-            while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
-                   panOffsets[iNext + 1] > panOffsets[iNext] &&
-                   panOffsets[iNext] + panSizes[iNext] + SIZE_COG_MARKERS >=
-                       panOffsets[iNext + 1] &&
-                   panOffsets[iNext + 1] + panSizes[iNext + 1] > nEndOffset)
-            {
-                iNext++;
-                nEndOffset = panOffsets[iNext] + panSizes[iNext];
-            }
-            CPLAssert(panOffsets[i] <= nEndOffset);
+        m_aoAdviseReadRanges.resize(aoRequests.size());
+        for (size_t iRequest = 0; iRequest < aoRequests.size(); ++iRequest)
+        {
             const size_t nSize =
-                static_cast<size_t>(nEndOffset - panOffsets[i]);
-
-            if (nSize == 0)
-            {
-                i = iNext + 1;
-                continue;
-            }
+                static_cast<size_t>(aoRequests[iRequest].nEndOffset -
+                                    aoRequests[iRequest].nStartOffset);
 
             if (m_aoAdviseReadRanges[iRequest] == nullptr)
                 m_aoAdviseReadRanges[iRequest] =
                     std::make_unique<AdviseReadRange>();
             // coverity[missing_lock]
             m_aoAdviseReadRanges[iRequest]->bDone = false;
-            m_aoAdviseReadRanges[iRequest]->nStartOffset = panOffsets[i];
+            m_aoAdviseReadRanges[iRequest]->nStartOffset =
+                aoRequests[iRequest].nStartOffset;
             m_aoAdviseReadRanges[iRequest]->nSize = nSize;
             m_aoAdviseReadRanges[iRequest]->abyData.resize(nSize);
-
-            i = iNext + 1;
-            iRequest++;
         }
-        m_aoAdviseReadRanges.resize(iRequest);
     }
     catch (const std::exception &)
     {
@@ -3270,7 +3700,7 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
              static_cast<unsigned>(m_aoAdviseReadRanges.size()));
 #endif
 
-    const auto task = [this](const std::string &osURL)
+    const auto task = [this](const std::string &osURL, int nMaxParallel)
     {
         CURLM *hMultiHandle = curl_multi_init();
 
@@ -3377,8 +3807,13 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
             unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER,
                                        headers);
             aHeaders.push_back(headers);
-            curl_multi_add_handle(hMultiHandle, hCurlHandle);
+            if (nMaxParallel <= 0 || static_cast<int>(i) < nMaxParallel)
+                curl_multi_add_handle(hMultiHandle, hCurlHandle);
         }
+        size_t nAdded = nMaxParallel <= 0
+                            ? aHandles.size()
+                            : std::min(aHandles.size(),
+                                       static_cast<size_t>(nMaxParallel));
 
         size_t nTotalDownloaded = 0;
         const auto DealWithRequest =
@@ -3430,6 +3865,8 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                 m_aoAdviseReadRanges[iReq]->abyData.resize(nSize);
 
                 nTotalDownloaded += nSize;
+
+                VSICURLUpdateNetworkEstimates(poFS, hCurlHandle, nSize);
             }
 
             {
@@ -3451,11 +3888,12 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
             {
                 // loop
             }
-            if (!still_running)
+            if (!still_running && nAdded == aHandles.size())
             {
                 break;
             }
 
+            bool bAddedNew = false;
             CURLMsg *msg;
             do
             {
@@ -3464,10 +3902,26 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                 if (msg && (msg->msg == CURLMSG_DONE))
                 {
                     DealWithRequest(msg->easy_handle);
+                    // Start a new transfer each time one is completed
+                    if (nAdded < aHandles.size())
+                    {
+                        curl_multi_add_handle(hMultiHandle, aHandles[nAdded]);
+                        ++nAdded;
+                        bAddedNew = true;
+                    }
                 }
             } while (msg);
 
-            CPLMultiPerformWait(hMultiHandle, repeats);
+            if (!still_running && !bAddedNew)
+            {
+                // Should not happen, but avoid waiting forever
+                curl_multi_add_handle(hMultiHandle, aHandles[nAdded]);
+                ++nAdded;
+            }
+            else if (!bAddedNew)
+            {
+                CPLMultiPerformWait(hMultiHandle, repeats);
+            }
         }
         CPLHTTPRestoreSigPipeHandler(old_handler);
 
@@ -3478,6 +3932,7 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
             {
                 DealWithRequest(aHandles[i]);
             }
+            NetworkStatisticsLogger::LogRequestTimings(aHandles[i]);
             curl_multi_remove_handle(hMultiHandle, aHandles[i]);
             VSICURLResetHeaderAndWriterFunctions(aHandles[i]);
             curl_easy_cleanup(aHandles[i]);
@@ -3491,7 +3946,8 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
 
         VSICURLMultiCleanup(hMultiHandle);
     };
-    m_oThreadAdviseRead = std::thread(task, l_osURL);
+    m_oThreadAdviseRead =
+        std::thread(task, l_osURL, sPolicy.nMaxParallelRequests);
 }
 
 /************************************************************************/
@@ -3665,26 +4121,424 @@ CURLM *VSICurlFilesystemHandlerBase::GetCurlMultiHandleFor(
     if (conn.hCurlMultiHandle == nullptr)
     {
         conn.hCurlMultiHandle = curl_multi_init();
+#ifdef CURLPIPE_MULTIPLEX
+        // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
+        // used), so that all transfers of this thread, and not only the ones
+        // of ReadMultiRange() and AdviseRead(), can share a single
+        // connection to the server.
+        if (conn.hCurlMultiHandle &&
+            CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+        {
+            curl_multi_setopt(conn.hCurlMultiHandle, CURLMOPT_PIPELINING,
+                              CURLPIPE_MULTIPLEX);
+        }
+#endif
     }
     return conn.hCurlMultiHandle;
 }
 
 /************************************************************************/
-/*                          GetRegionCache()                            */
+/*                          VSICurlDiskCache                            */
 /************************************************************************/
 
-VSICurlFilesystemHandlerBase::RegionCacheType *
-VSICurlFilesystemHandlerBase::GetRegionCache()
+namespace
 {
-    // should be called under hMutex taken
-    if (m_poRegionCacheDoNotUseDirectly == nullptr)
-    {
-        m_poRegionCacheDoNotUseDirectly.reset(
-            new RegionCacheType(static_cast<size_t>(GetMaxRegions())));
-    }
+
+/** Optional persistent cache of downloaded regions, stored in a local
+ * directory, and used below the in-memory region cache.
+ *
+ * Entries are content-addressed by the SHA256 of the URL, the version of the
+ * remote file (ETag, or size and modification time), the chunk size and the
+ * offset of the region, so that entries of a modified remote file are never
+ * used. Each entry is written to a temporary file that is then renamed, so
+ * that several processes can safely share the same directory. The total size
+ * is bounded, by evicting the least recently used entries (using the
+ * modification time of the files, updated on each hit).
+ */
+class VSICurlDiskCache
+{
+    std::string m_osDir;
+    const GIntBig m_nMaxSize;
+    std::atomic<GIntBig> m_nBytesWrittenSinceLastTrim{0};
+    std::atomic<bool> m_bTrimInProgress{false};
+    bool m_bTrimDoneOnce = false;  // protected by m_oMutex
+    std::mutex m_oMutex{};
+
+    static constexpr const char MAGIC[] = "GDAL_VSICURL_DISK_CACHE_1";
+    static constexpr size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+
+    std::string GetFilename(const std::string &osKey) const;
+    void Trim();
+
+    CPL_DISALLOW_COPY_ASSIGN(VSICurlDiskCache)
+
+  public:
+    VSICurlDiskCache(const std::string &osDir, GIntBig nMaxSize)
+        : m_osDir(osDir), m_nMaxSize(nMaxSize)
+    {
+    }
+
+    const std::string &GetDirectory() const
+    {
+        return m_osDir;
+    }
+
+    GIntBig GetMaxSize() const
+    {
+        return m_nMaxSize;
+    }
+
+    static std::shared_ptr<VSICurlDiskCache> Get();
+
+    bool Read(const std::string &osKey, std::string &osData);
+    void Write(const std::string &osKey, const char *pData, size_t nSize);
+};
+
+
+/************************************************************************/
+/*                       VSICurlDiskCache::Get()                        */
+/************************************************************************/
+
+/** Return the disk cache instance, or nullptr if
+ * CPL_VSIL_CURL_DISK_CACHE_DIR is not set.
+ */
+std::shared_ptr<VSICurlDiskCache> VSICurlDiskCache::Get()
+{
+    static std::mutex oMutex;
+    static std::shared_ptr<VSICurlDiskCache> poCache;
+
+    const char *pszDir =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    if (pszDir == nullptr || pszDir[0] == 0)
+        return nullptr;
+
+    constexpr GIntBig DISK_CACHE_SIZE_DEFAULT =
+        static_cast<GIntBig>(1024) * 1024 * 1024;
+    GIntBig nMaxSize =
+        CPLAtoGIntBig(CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE",
+                                         CPLSPrintf(CPL_FRMT_GIB,
+                                                    DISK_CACHE_SIZE_DEFAULT)));
+    if (nMaxSize <= 0)
+        return nullptr;
+
+    std::lock_guard<std::mutex> oLock(oMutex);
+    if (!poCache || poCache->GetDirectory() != pszDir ||
+        poCache->GetMaxSize() != nMaxSize)
+    {
+        if (VSIMkdirRecursive(pszDir, 0755) != 0)
+        {
+            VSIStatBufL sStat;
+            if (VSIStatL(pszDir, &sStat) != 0 || !VSI_ISDIR(sStat.st_mode))
+            {
+                CPLError(CE_Warning, CPLE_FileIO,
+                         "Cannot create CPL_VSIL_CURL_DISK_CACHE_DIR=%s. "
+                         "Disk cache disabled",
+                         pszDir);
+                poCache.reset();
+                return nullptr;
+            }
+        }
+        poCache = std::make_shared<VSICurlDiskCache>(pszDir, nMaxSize);
+    }
+    return poCache;
+}
+
+/************************************************************************/
+/*                    VSICurlDiskCache::GetFilename()                   */
+/************************************************************************/
+
+std::string VSICurlDiskCache::GetFilename(const std::string &osKey) const
+{
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osHex(pszHex);
+    CPLFree(pszHex);
+    // Spread entries over 256 sub-directories
+    const std::string osSubDir(
+        CPLFormFilename(m_osDir.c_str(), osHex.substr(0, 2).c_str(), nullptr));
+    return CPLFormFilename(osSubDir.c_str(), osHex.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                       VSICurlDiskCache::Read()                       */
+/************************************************************************/
+
+bool VSICurlDiskCache::Read(const std::string &osKey, std::string &osData)
+{
+    const std::string osFilename = GetFilename(osKey);
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return false;
+
+    bool bOK = false;
+    VSIFSeekL(fp, 0, SEEK_END);
+    const vsi_l_offset nFileSize = VSIFTellL(fp);
+    VSIFSeekL(fp, 0, SEEK_SET);
+
+    // Header: magic, key size (4 bytes LSB), key, followed by the data.
+    const size_t nHeaderSize = MAGIC_SIZE + sizeof(uint32_t) + osKey.size();
+    if (nFileSize >= nHeaderSize &&
+        nFileSize - nHeaderSize <=
+            static_cast<vsi_l_offset>(VSICURLGetDownloadChunkSize()))
+    {
+        std::string osHeader;
+        osHeader.resize(nHeaderSize);
+        if (VSIFReadL(&osHeader[0], nHeaderSize, 1, fp) == 1 &&
+            memcmp(osHeader.data(), MAGIC, MAGIC_SIZE) == 0)
+        {
+            uint32_t nKeySize = 0;
+            memcpy(&nKeySize, osHeader.data() + MAGIC_SIZE, sizeof(nKeySize));
+            CPL_LSBPTR32(&nKeySize);
+            if (nKeySize == osKey.size() &&
+                memcmp(osHeader.data() + MAGIC_SIZE + sizeof(nKeySize),
+                       osKey.data(), osKey.size()) == 0)
+            {
+                const size_t nDataSize =
+                    static_cast<size_t>(nFileSize - nHeaderSize);
+                osData.resize(nDataSize);
+                bOK = nDataSize == 0 ||
+                      VSIFReadL(&osData[0], nDataSize, 1, fp) == 1;
+            }
+        }
+    }
+    VSIFCloseL(fp);
+
+    if (!bOK)
+    {
+        osData.clear();
+        return false;
+    }
+
+    // Update the modification time, used as the LRU criterion by Trim()
+    if (!STARTS_WITH(osFilename.c_str(), "/vsi"))
+    {
+#ifdef _WIN32
+        wchar_t *pwszFilename = CPLRecodeToWChar(osFilename.c_str(),
+                                                 CPL_ENC_UTF8, CPL_ENC_UCS2);
+        _wutime(pwszFilename, nullptr);
+        CPLFree(pwszFilename);
+#else
+        utime(osFilename.c_str(), nullptr);
+#endif
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                      VSICurlDiskCache::Write()                       */
+/************************************************************************/
+
+void VSICurlDiskCache::Write(const std::string &osKey, const char *pData,
+                             size_t nSize)
+{
+    const std::string osFilename = GetFilename(osKey);
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        return;
+
+    // Write to a file name unique to this process and thread, and rename it
+    // at the end, so that concurrent readers never see partial content.
+    static std::atomic<int> nCounter{0};
+    const std::string osTmpFilename(
+        osFilename + CPLSPrintf(".%d_%d.tmp", CPLGetCurrentProcessID(),
+                                ++nCounter));
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        VSIMkdir(CPLGetPath(osFilename.c_str()), 0755);
+        fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+        if (fp == nullptr)
+            return;
+    }
+
+    uint32_t nKeySize = static_cast<uint32_t>(osKey.size());
+    CPL_LSBPTR32(&nKeySize);
+    bool bOK = VSIFWriteL(MAGIC, MAGIC_SIZE, 1, fp) == 1 &&
+               VSIFWriteL(&nKeySize, sizeof(nKeySize), 1, fp) == 1 &&
+               VSIFWriteL(osKey.data(), osKey.size(), 1, fp) == 1 &&
+               (nSize == 0 || VSIFWriteL(pData, nSize, 1, fp) == 1);
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        // Can happen on Windows if another process has created the
+        // same entry in the meantime.
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    bool bNeedTrim;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        // Check the total size at the first write done by this process, and
+        // then each time 10% of the maximum size has been written by it.
+        m_nBytesWrittenSinceLastTrim += static_cast<GIntBig>(nSize);
+        bNeedTrim = !m_bTrimDoneOnce ||
+                    m_nBytesWrittenSinceLastTrim > m_nMaxSize / 10;
+        if (bNeedTrim)
+        {
+            m_bTrimDoneOnce = true;
+            m_nBytesWrittenSinceLastTrim = 0;
+        }
+    }
+    if (bNeedTrim && !m_bTrimInProgress.exchange(true))
+    {
+        Trim();
+        m_bTrimInProgress = false;
+    }
+}
+
+/************************************************************************/
+/*                       VSICurlDiskCache::Trim()                       */
+/************************************************************************/
+
+/** Remove the least recently used entries when the total size of the cache
+ * exceeds its maximum size, so that it goes back below 90% of it. Stale
+ * temporary files are also removed.
+ */
+void VSICurlDiskCache::Trim()
+{
+    struct Entry
+    {
+        std::string osFilename;
+        time_t nMTime;
+        GIntBig nSize;
+    };
+
+    std::vector<Entry> asEntries;
+    GIntBig nTotalSize = 0;
+    const time_t nNow = time(nullptr);
+    constexpr int STALE_TMP_FILE_DELAY_SEC = 3600;
+
+    const CPLStringList aosSubDirs(VSIReadDir(m_osDir.c_str()));
+    for (const char *pszSubDir : aosSubDirs)
+    {
+        if (strlen(pszSubDir) != 2)
+            continue;
+        const std::string osSubDir(
+            CPLFormFilename(m_osDir.c_str(), pszSubDir, nullptr));
+        const CPLStringList aosFiles(VSIReadDir(osSubDir.c_str()));
+        for (const char *pszFile : aosFiles)
+        {
+            if (pszFile[0] == '.')
+                continue;
+            std::string osFilename(
+                CPLFormFilename(osSubDir.c_str(), pszFile, nullptr));
+            VSIStatBufL sStat;
+            if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+                !VSI_ISREG(sStat.st_mode))
+            {
+                continue;
+            }
+            if (EQUAL(CPLGetExtension(pszFile), "tmp"))
+            {
+                if (nNow - sStat.st_mtime > STALE_TMP_FILE_DELAY_SEC)
+                    VSIUnlink(osFilename.c_str());
+                continue;
+            }
+            nTotalSize += static_cast<GIntBig>(sStat.st_size);
+            asEntries.push_back(Entry{std::move(osFilename), sStat.st_mtime,
+                                      static_cast<GIntBig>(sStat.st_size)});
+        }
+    }
+
+    if (nTotalSize <= m_nMaxSize)
+        return;
+
+    std::sort(asEntries.begin(), asEntries.end(),
+              [](const Entry &a, const Entry &b)
+              { return a.nMTime < b.nMTime; });
+    const GIntBig nTargetSize = m_nMaxSize / 10 * 9;
+    int nRemoved = 0;
+    for (const auto &sEntry : asEntries)
+    {
+        if (nTotalSize <= nTargetSize)
+            break;
+        // May fail if another process has removed it in the meantime
+        if (VSIUnlink(sEntry.osFilename.c_str()) == 0)
+            ++nRemoved;
+        nTotalSize -= sEntry.nSize;
+    }
+    CPLDebug("VSICURL", "Disk cache: %d entries evicted", nRemoved);
+}
+
+/************************************************************************/
+/*                          GetDiskCacheKey()                           */
+/************************************************************************/
+
+/** Return the key of a region in the disk cache, or an empty string if the
+ * version of the remote file is unknown (in which case the disk cache must
+ * not be used).
+ */
+static std::string GetDiskCacheKey(const char *pszURL,
+                                   vsi_l_offset nFileOffsetStart)
+{
+    FileProp oFileProp;
+    if (!VSICURLGetCachedFileProp(pszURL, oFileProp) ||
+        oFileProp.eExists != EXIST_YES)
+    {
+        return std::string();
+    }
+
+    std::string osVersion;
+    if (!oFileProp.ETag.empty())
+        osVersion = "etag=" + oFileProp.ETag;
+    else if (oFileProp.bHasComputedFileSize && oFileProp.mTime != 0)
+        osVersion = CPLSPrintf("size=" CPL_FRMT_GUIB ",mtime=" CPL_FRMT_GIB,
+                               static_cast<GUIntBig>(oFileProp.fileSize),
+                               static_cast<GIntBig>(oFileProp.mTime));
+    else
+        return std::string();
+
+    std::string osKey(pszURL);
+    osKey += '\n';
+    osKey += osVersion;
+    osKey += CPLSPrintf("\nchunk_size=%d\noffset=" CPL_FRMT_GUIB,
+                        VSICURLGetDownloadChunkSize(),
+                        static_cast<GUIntBig>(nFileOffsetStart));
+    return osKey;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                          GetRegionCache()                            */
+/************************************************************************/
+
+VSICurlFilesystemHandlerBase::RegionCacheType *
+VSICurlFilesystemHandlerBase::GetRegionCache()
+{
+    // should be called under hMutex taken
+    if (m_poRegionCacheDoNotUseDirectly == nullptr)
+    {
+        m_poRegionCacheDoNotUseDirectly.reset(
+            new RegionCacheType(static_cast<size_t>(GetMaxRegions())));
+    }
     return m_poRegionCacheDoNotUseDirectly.get();
 }
 
+/************************************************************************/
+/*                       VSICurlNewCachedRegion()                       */
+/************************************************************************/
+
+// Regions are accounted in the VSICURL_REGION_CACHE memory accounting
+// counter until they are evicted from the cache and no longer used.
+static std::shared_ptr<std::string> VSICurlNewCachedRegion(std::string &&osData)
+{
+    static CPLMemoryAccountingCounter *const hCounter =
+        CPLGetMemoryAccountingCounter("VSICURL_REGION_CACHE");
+    const GIntBig nSize = static_cast<GIntBig>(osData.size());
+    CPLMemoryAccountingAdd(hCounter, nSize);
+    return std::shared_ptr<std::string>(
+        new std::string(std::move(osData)),
+        [nSize](std::string *posData)
+        {
+            CPLMemoryAccountingAdd(hCounter, -nSize);
+            delete posData;
+        });
+}
+
 /************************************************************************/
 /*                          GetRegion()                                 */
 /************************************************************************/
@@ -3693,17 +4547,36 @@ std::shared_ptr<std::string>
 VSICurlFilesystemHandlerBase::GetRegion(const char *pszURL,
                                         vsi_l_offset nFileOffsetStart)
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     nFileOffsetStart =
         (nFileOffsetStart / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
 
-    std::shared_ptr<std::string> out;
-    if (GetRegionCache()->tryGet(
-            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
     {
-        return out;
+        CPLMutexHolder oHolder(&hMutex);
+
+        std::shared_ptr<std::string> out;
+        if (GetRegionCache()->tryGet(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out))
+        {
+            return out;
+        }
+    }
+
+    // Fallback to the persistent disk cache (outside of the mutex, as it
+    // involves I/O).
+    const auto poDiskCache = VSICurlDiskCache::Get();
+    if (poDiskCache)
+    {
+        const std::string osKey = GetDiskCacheKey(pszURL, nFileOffsetStart);
+        std::string osData;
+        if (!osKey.empty() && poDiskCache->Read(osKey, osData))
+        {
+            auto out = VSICurlNewCachedRegion(std::move(osData));
+            CPLMutexHolder oHolder(&hMutex);
+            GetRegionCache()->insert(
+                FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), out);
+            return out;
+        }
     }
 
     return nullptr;
@@ -3717,12 +4590,21 @@ void VSICurlFilesystemHandlerBase::AddRegion(const char *pszURL,
                                              vsi_l_offset nFileOffsetStart,
                                              size_t nSize, const char *pData)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    {
+        CPLMutexHolder oHolder(&hMutex);
+
+        auto value = VSICurlNewCachedRegion(std::string(pData, nSize));
+        GetRegionCache()->insert(
+            FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    }
 
-    std::shared_ptr<std::string> value(new std::string());
-    value->assign(pData, nSize);
-    GetRegionCache()->insert(
-        FilenameOffsetPair(std::string(pszURL), nFileOffsetStart), value);
+    const auto poDiskCache = VSICurlDiskCache::Get();
+    if (poDiskCache)
+    {
+        const std::string osKey = GetDiskCacheKey(pszURL, nFileOffsetStart);
+        if (!osKey.empty())
+            poDiskCache->Write(osKey, pData, nSize);
+    }
 }
 
 /************************************************************************/
@@ -3947,6 +4829,53 @@ VSICurlFilesystemHandlerBase::CreateFileHandle(const char *pszFilename)
     return new VSICurlHandle(this, pszFilename);
 }
 
+/************************************************************************/
+/*                    GetMultiRangeCoalescingPolicy()                   */
+/************************************************************************/
+
+VSIMultiRangeCoalescingPolicy
+VSICurlFilesystemHandlerBase::GetMultiRangeCoalescingPolicy(
+    const char * /* pszPath */)
+{
+    double dfLatency;
+    double dfThroughput;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexNetworkEstimates);
+        dfLatency = m_dfLatencyEstimate;
+        dfThroughput = m_dfThroughputEstimate;
+    }
+    return VSIMultiRangeCoalescingPolicy::FromConfigOptions(dfLatency,
+                                                            dfThroughput);
+}
+
+/************************************************************************/
+/*                       UpdateNetworkEstimates()                       */
+/************************************************************************/
+
+/** Update the running estimates of the latency (in seconds) and of the
+ * throughput (in bytes per second) with a new observation. A zero value means
+ * that the corresponding quantity has not been observed.
+ */
+void VSICurlFilesystemHandlerBase::UpdateNetworkEstimates(double dfLatency,
+                                                          double dfThroughput)
+{
+    // Exponential moving average, so that estimates follow changes of the
+    // network conditions.
+    const auto Update = [](double &dfEstimate, double dfNewValue)
+    {
+        constexpr double WEIGHT_NEW = 0.2;
+        if (dfNewValue > 0)
+        {
+            dfEstimate = dfEstimate > 0 ? (1 - WEIGHT_NEW) * dfEstimate +
+                                              WEIGHT_NEW * dfNewValue
+                                        : dfNewValue;
+        }
+    };
+    std::lock_guard<std::mutex> oLock(m_oMutexNetworkEstimates);
+    Update(m_dfLatencyEstimate, dfLatency);
+    Update(m_dfThroughputEstimate, dfThroughput);
+}
+
 /************************************************************************/
 /*                          GetActualURL()                              */
 /************************************************************************/
@@ -3987,6 +4916,14 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='GDAL_HTTP_MERGE_CONSECUTIVE_RANGES' type='boolean' "      \
     "description='Whether to merge consecutive ranges in multirange "          \
     "requests' default='YES'/>"                                                \
+    "  <Option name='GDAL_HTTP_MULTIRANGE_MAX_GAP' type='string' "             \
+    "description='Maximum gap in bytes, or AUTO, between two ranges of a "     \
+    "multirange request to merge them' default='0'/>"                          \
+    "  <Option name='GDAL_HTTP_MULTIRANGE_MAX_REQUEST_SIZE' type='integer' "   \
+    "description='Maximum size in bytes of a merged request' default='0'/>"    \
+    "  <Option name='GDAL_HTTP_MULTIRANGE_MAX_PARALLEL' type='integer' "       \
+    "description='Maximum number of parallel requests of a multirange "        \
+    "request' default='0'/>"                                                   \
     "  <Option name='CPL_VSIL_CURL_NON_CACHED' type='string' "                 \
     "description='Colon-separated list of filenames whose content"             \
     "must not be cached across open attempts'/>"                               \
@@ -4011,6 +4948,18 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='CPL_VSIL_CURL_CACHE_SIZE' type='integer' "                \
     "description='Size in bytes of the global /vsicurl/ cache' "               \
     "default='16384000'/>"                                                     \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_DIR' type='string' "            \
+    "description='Directory of a persistent cache of downloaded content, "     \
+    "that may be shared among processes'/>"                                    \
+    "  <Option name='CPL_VSIL_CURL_DISK_CACHE_SIZE' type='integer' "           \
+    "description='Maximum size in bytes of the persistent disk cache' "        \
+    "default='1073741824'/>"                                                   \
+    "  <Option name='CPL_VSIL_CURL_READAHEAD_DEPTH' type='integer' "           \
+    "description='Maximum number of asynchronous downloads ahead of the "      \
+    "current position in sequential reads' default='0'/>"                      \
+    "  <Option name='CPL_VSIL_CURL_SHARE_TLS_SESSIONS' type='boolean' "        \
+    "description='Whether to share the DNS cache and TLS sessions among "      \
+    "threads' default='YES'/>"                                                 \
     "  <Option name='CPL_VSIL_CURL_IGNORE_GLACIER_STORAGE' type='boolean' "    \
     "description='Whether to skip files with Glacier storage class in "        \
     "directory listing.' default='YES'/>"                                      \
@@ -4198,7 +5147,8 @@ VSIVirtualHandle *VSICurlFilesystemHandlerBase::Open(const char *pszFilename,
     }
 
     if (CPLTestBool(CPLGetConfigOption("VSI_CACHE", "FALSE")))
-        return VSICreateCachedFile(poHandle);
+        return VSICreateCachedFile(poHandle, VSI_CACHED_DEFAULT_CHUNK_SIZE, 0,
+                                   pszFilename);
     else
         return poHandle;
 }
@@ -5354,6 +6304,140 @@ char **VSICurlFilesystemHandlerBase::SiblingFiles(const char *pszFilename)
     return nullptr;
 }
 
+/************************************************************************/
+/*                       RunPrefetchTasks()                             */
+/************************************************************************/
+
+// Run pfnTask(i) for i in [0, nTasks[ from up to nThreads threads
+template <class T>
+static void RunPrefetchTasks(const std::string &osFSPrefix, size_t nTasks,
+                             int nThreads, const T &pfnTask)
+{
+    std::atomic<size_t> nNextTask{0};
+    const auto worker = [&osFSPrefix, &nNextTask, nTasks, &pfnTask](
+                            CPLStringList aosTLConfigOptions)
+    {
+        CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+        {
+            NetworkStatisticsFileSystem oContextFS(osFSPrefix.c_str());
+            NetworkStatisticsAction oContextAction("PrefetchMetadata");
+
+            // Errors will be reported when the files are actually accessed
+            CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+            while (true)
+            {
+                const size_t i = nNextTask++;
+                if (i >= nTasks)
+                    break;
+                pfnTask(i);
+            }
+        }
+        CPLSetThreadLocalConfigOptions(nullptr);
+    };
+
+    std::vector<std::thread> aoThreads;
+    const int nThreadsToStart =
+        static_cast<int>(std::min<size_t>(nTasks, std::max(1, nThreads)));
+    for (int i = 0; i < nThreadsToStart; ++i)
+    {
+        aoThreads.emplace_back(worker,
+                               CPLStringList(CPLGetThreadLocalConfigOptions()));
+    }
+    for (auto &oThread : aoThreads)
+        oThread.join();
+}
+
+/************************************************************************/
+/*                         PrefetchMetadata()                           */
+/************************************************************************/
+
+bool VSICurlFilesystemHandlerBase::PrefetchMetadata(CSLConstList papszFilenames,
+                                                    CSLConstList papszOptions)
+{
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS", "10");
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : std::clamp(atoi(pszNumThreads), 1, 256);
+    const CPLStringList aosSuffixes(CSLTokenizeString2(
+        CSLFetchNameValueDef(papszOptions, "EXTRA_SUFFIXES", ""), ",", 0));
+
+    // Directories that VSIFOpenL() would list, and files to probe
+    std::vector<std::string> aosDirs;
+    std::vector<std::pair<std::string, size_t>> aoFiles;  // (name, dir index)
+    for (const char *pszFilename : cpl::Iterate(papszFilenames))
+    {
+        if ((!STARTS_WITH_CI(pszFilename, GetFSPrefix().c_str()) &&
+             !STARTS_WITH_CI(pszFilename, "/vsicurl?")) ||
+            !IsAllowedFilename(pszFilename) || !AllowCachedDataFor(pszFilename))
+        {
+            continue;
+        }
+
+        bool bListDir = true;
+        bool bEmptyDir = false;
+        CPL_IGNORE_RET_VAL(VSICurlGetURLFromFilename(
+            pszFilename, nullptr, nullptr, nullptr, nullptr, &bListDir,
+            &bEmptyDir, nullptr, nullptr, nullptr));
+        const char *pszOptionVal = VSIGetPathSpecificOption(
+            pszFilename, "GDAL_DISABLE_READDIR_ON_OPEN", "NO");
+        const bool bSkipReadDir = !bListDir || bEmptyDir ||
+                                  EQUAL(pszOptionVal, "EMPTY_DIR") ||
+                                  CPLTestBool(pszOptionVal);
+
+        size_t iDir = std::numeric_limits<size_t>::max();
+        if (!bSkipReadDir)
+        {
+            const std::string osDir =
+                std::string(CPLGetDirname(pszFilename)) + '/';
+            const auto oIter = std::find(aosDirs.begin(), aosDirs.end(), osDir);
+            iDir = static_cast<size_t>(oIter - aosDirs.begin());
+            if (oIter == aosDirs.end())
+                aosDirs.push_back(osDir);
+        }
+        aoFiles.emplace_back(pszFilename, iDir);
+        for (const char *pszSuffix : aosSuffixes)
+            aoFiles.emplace_back(std::string(pszFilename) + pszSuffix, iDir);
+    }
+
+    // First list directories, which gives the properties of all the files
+    // they contain.
+    std::vector<char> abGotFileList(aosDirs.size(), false);
+    RunPrefetchTasks(GetFSPrefix(), aosDirs.size(), nThreads,
+                     [this, &aosDirs, &abGotFileList](size_t i)
+                     {
+                         bool bGotFileList = false;
+                         CSLDestroy(ReadDirInternal(aosDirs[i].c_str(), 0,
+                                                    &bGotFileList));
+                         abGotFileList[i] = bGotFileList;
+                     });
+
+    // Then issue HEAD requests on files whose properties are still unknown
+    // and that are not in a listed directory.
+    RunPrefetchTasks(
+        GetFSPrefix(), aoFiles.size(), nThreads,
+        [this, &aoFiles, &abGotFileList](size_t i)
+        {
+            const std::string &osFilename = aoFiles[i].first;
+            const size_t iDir = aoFiles[i].second;
+            if (iDir < abGotFileList.size() && abGotFileList[iDir])
+                return;
+            FileProp oFileProp;
+            if (GetCachedFileProp(GetURLFromFilename(osFilename).c_str(),
+                                  oFileProp) &&
+                oFileProp.eExists != EXIST_UNKNOWN)
+            {
+                return;
+            }
+            std::unique_ptr<VSICurlHandle> poHandle(
+                CreateFileHandle(osFilename.c_str()));
+            if (poHandle)
+                poHandle->Exists(false);
+        });
+
+    return true;
+}
+
 /************************************************************************/
 /*                          GetFileMetadata()                           */
 /************************************************************************/
@@ -5593,6 +6677,47 @@ long CurlRequestHelper::perform(CURL *hCurlHandle, struct curl_slist *headers,
 NetworkStatisticsLogger NetworkStatisticsLogger::gInstance{};
 int NetworkStatisticsLogger::gnEnabled = -1;  // unknown state
 
+const int NetworkStatisticsLogger::kanLatencyBucketUpperBoundsMS
+    [NetworkStatisticsLogger::LATENCY_BUCKET_COUNT - 1] = {
+        5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000};
+
+void NetworkStatisticsLogger::LatencyHistogram::Add(double dfMS)
+{
+    nCount++;
+    dfSumMS += dfMS;
+    dfMaxMS = std::max(dfMaxMS, dfMS);
+    int iBucket = 0;
+    while (iBucket < LATENCY_BUCKET_COUNT - 1 &&
+           dfMS >= kanLatencyBucketUpperBoundsMS[iBucket])
+    {
+        ++iBucket;
+    }
+    anBuckets[iBucket]++;
+}
+
+void NetworkStatisticsLogger::LatencyHistogram::AsJSON(
+    CPLJSONObject &oJSON) const
+{
+    oJSON.Add("count", nCount);
+    oJSON.Add("mean_ms", nCount ? dfSumMS / static_cast<double>(nCount) : 0.0);
+    oJSON.Add("max_ms", dfMaxMS);
+    CPLJSONObject oBuckets;
+    for (int i = 0; i < LATENCY_BUCKET_COUNT; ++i)
+    {
+        std::string osKey;
+        if (i < LATENCY_BUCKET_COUNT - 1)
+        {
+            osKey = CPLSPrintf("<%d", kanLatencyBucketUpperBoundsMS[i]);
+        }
+        else
+        {
+            osKey = CPLSPrintf(">=%d", kanLatencyBucketUpperBoundsMS[i - 1]);
+        }
+        oBuckets.Add(osKey, anBuckets[i]);
+    }
+    oJSON.Add("histogram_ms", oBuckets);
+}
+
 static void ShowNetworkStats()
 {
     printf("Network statistics:\n%s\n",  // ok
@@ -5770,6 +6895,70 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogRequestTimings(CURL *hCurlHandle)
+{
+    if (!IsEnabled())
+        return;
+
+    long response_code = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_RESPONSE_CODE, &response_code);
+    if (response_code == 0)
+    {
+        // No response received
+        return;
+    }
+#if LIBCURL_VERSION_NUM >= 0x073D00
+    curl_off_t nStartTransferTimeUS = 0;
+    curl_off_t nTotalTimeUS = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_STARTTRANSFER_TIME_T,
+                      &nStartTransferTimeUS);
+    curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME_T, &nTotalTimeUS);
+    const double dfTimeToFirstByteMS =
+        static_cast<double>(nStartTransferTimeUS) / 1e3;
+    const double dfTotalTimeMS = static_cast<double>(nTotalTimeUS) / 1e3;
+#else
+    double dfStartTransferTime = 0;
+    double dfTotalTime = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_STARTTRANSFER_TIME,
+                      &dfStartTransferTime);
+    curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME, &dfTotalTime);
+    const double dfTimeToFirstByteMS = dfStartTransferTime * 1e3;
+    const double dfTotalTimeMS = dfTotalTime * 1e3;
+#endif
+    const bool bThrottled = response_code == 429 || response_code == 503;
+
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->oTimeToFirstByte.Add(dfTimeToFirstByteMS);
+        counters->oTotalTime.Add(dfTotalTimeMS);
+        if (bThrottled)
+            counters->nThrottled++;
+    }
+}
+
+void NetworkStatisticsLogger::LogRetry()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nRetries++;
+    }
+}
+
+void NetworkStatisticsLogger::LogWastedBytes(GIntBig nWastedBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nWastedBytes += nWastedBytes;
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -5799,6 +6988,23 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    if (counters.oTimeToFirstByte.nCount)
+    {
+        CPLJSONObject oLatency;
+        CPLJSONObject oTimeToFirstByte;
+        counters.oTimeToFirstByte.AsJSON(oTimeToFirstByte);
+        oLatency.Add("time_to_first_byte", oTimeToFirstByte);
+        CPLJSONObject oTotalTime;
+        counters.oTotalTime.AsJSON(oTotalTime);
+        oLatency.Add("total", oTotalTime);
+        oJSON.Add("latency", oLatency);
+    }
+    if (counters.nRetries)
+        oJSON.Add("retries/count", counters.nRetries);
+    if (counters.nThrottled)
+        oJSON.Add("throttled/count", counters.nThrottled);
+    if (counters.nWastedBytes)
+        oJSON.Add("over_fetch/wasted_bytes", counters.nWastedBytes);
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
@@ -5983,6 +7189,90 @@ int VSICurlUninstallReadCbk(VSILFILE *fp)
     return reinterpret_cast<cpl::VSICurlHandle *>(fp)->UninstallReadCbk();
 }
 
+/************************************************************************/
+/*                        VSICURLGetShareHandle()                       */
+/************************************************************************/
+
+namespace
+{
+struct VSICURLShareHandle
+{
+    CURLSH *hShare = nullptr;
+    std::mutex aoMutexes[CURL_LOCK_DATA_LAST]{};
+
+    static void Lock(CURL *, curl_lock_data data, curl_lock_access,
+                     void *userptr)
+    {
+        static_cast<VSICURLShareHandle *>(userptr)->aoMutexes[data].lock();
+    }
+
+    static void Unlock(CURL *, curl_lock_data data, void *userptr)
+    {
+        static_cast<VSICURLShareHandle *>(userptr)->aoMutexes[data].unlock();
+    }
+};
+
+std::mutex goShareHandleMutex;
+VSICURLShareHandle *gpoShareHandle = nullptr;
+}  // namespace
+
+/** Return a process-wide curl share handle, that shares the DNS cache and
+ * the TLS sessions among all easy handles, whatever the thread and the multi
+ * handle they are used with.
+ *
+ * Connections themselves are kept in the per-thread multi handles, as libcurl
+ * does not support sharing its connection cache between concurrent threads,
+ * but new connections opened by a thread can resume a TLS session negotiated
+ * by another one, which saves a round trip and most of the cryptographic
+ * cost of the handshake.
+ */
+static CURLSH *VSICURLGetShareHandle()
+{
+    if (!CPLTestBool(
+            CPLGetConfigOption("CPL_VSIL_CURL_SHARE_TLS_SESSIONS", "YES")))
+        return nullptr;
+
+    std::lock_guard<std::mutex> oLock(goShareHandleMutex);
+    if (gpoShareHandle == nullptr)
+    {
+        gpoShareHandle = new VSICURLShareHandle();
+        gpoShareHandle->hShare = curl_share_init();
+        if (gpoShareHandle->hShare)
+        {
+            CURLSH *hShare = gpoShareHandle->hShare;
+            curl_share_setopt(hShare, CURLSHOPT_LOCKFUNC,
+                              VSICURLShareHandle::Lock);
+            curl_share_setopt(hShare, CURLSHOPT_UNLOCKFUNC,
+                              VSICURLShareHandle::Unlock);
+            curl_share_setopt(hShare, CURLSHOPT_USERDATA, gpoShareHandle);
+            curl_share_setopt(hShare, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            curl_share_setopt(hShare, CURLSHOPT_SHARE,
+                              CURL_LOCK_DATA_SSL_SESSION);
+        }
+    }
+    return gpoShareHandle->hShare;
+}
+
+/************************************************************************/
+/*                      VSICURLDestroyShareHandle()                     */
+/************************************************************************/
+
+void VSICURLDestroyShareHandle()
+{
+    std::lock_guard<std::mutex> oLock(goShareHandleMutex);
+    if (gpoShareHandle)
+    {
+        // Fails if easy handles still use it, in which case we leak it
+        // rather than crashing.
+        if (gpoShareHandle->hShare == nullptr ||
+            curl_share_cleanup(gpoShareHandle->hShare) == CURLSHE_OK)
+        {
+            delete gpoShareHandle;
+        }
+        gpoShareHandle = nullptr;
+    }
+}
+
 /************************************************************************/
 /*                       VSICurlSetOptions()                            */
 /************************************************************************/
@@ -5993,6 +7283,10 @@ struct curl_slist *VSICurlSetOptions(CURL *hCurlHandle, const char *pszURL,
     struct curl_slist *headers = static_cast<struct curl_slist *>(
         CPLHTTPSetOptions(hCurlHandle, pszURL, papszOptions));
 
+    CURLSH *hShare = VSICURLGetShareHandle();
+    if (hShare)
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_SHARE, hShare);
+
     long option = CURLFTPMETHOD_SINGLECWD;
     unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_FTP_FILEMETHOD, option);
 
@@ -6306,6 +7600,22 @@ void VSINetworkStatsReset(void)
 
  * </pre>
  *
+ * Starting with GDAL 3.10, each level of the report may also contain:
+ * <ul>
+ * <li>a "latency" object with "time_to_first_byte" and "total" members,
+ * giving the number of HTTP requests, the mean and maximum duration in
+ * milliseconds and an histogram of durations ("histogram_ms" object whose
+ * keys are the bucket bounds).</li>
+ * <li>"retries/count": the number of requests retried after a transient
+ * error.</li>
+ * <li>"throttled/count": the number of 429 Too Many Requests or 503 Service
+ * Unavailable responses.</li>
+ * <li>"over_fetch/wasted_bytes": the number of downloaded bytes never
+ * returned to the caller. That is the blocks of CPL_VSIL_CURL_CHUNK_SIZE bytes
+ * downloaded by Read() but not read before the file is closed, and the gaps
+ * between ranges coalesced by ReadMultiRange().</li>
+ * </ul>
+ *
  * @param papszOptions Unused.
  * @return a JSON serialized string to free with VSIFree(), or nullptr
  * @since GDAL 3.2.0
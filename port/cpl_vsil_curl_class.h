@@ -34,6 +34,7 @@
 #include "cpl_aws.h"
 #include "cpl_azure.h"
 #include "cpl_port.h"
+#include "cpl_error_internal.h"
 #include "cpl_json.h"
 #include "cpl_string.h"
 #include "cpl_vsil_curl_priv.h"
@@ -42,7 +43,9 @@
 #include "cpl_curl_priv.h"
 
 #include <algorithm>
+#include <array>
 #include <condition_variable>
+#include <deque>
 #include <set>
 #include <map>
 #include <memory>
@@ -158,6 +161,8 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
 {
     CPL_DISALLOW_COPY_ASSIGN(VSICurlFilesystemHandlerBase)
 
+    friend class VSICurlHandle;  // for CreateFileHandle() in readahead
+
     struct FilenameOffsetPair
     {
         std::string filename_;
@@ -225,6 +230,12 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     std::map<std::string, std::unique_ptr<RegionInDownload>>
         m_oMapRegionInDownload{};
 
+    // Latency (in seconds) and throughput (in bytes per second) of the
+    // requests of ReadMultiRange(), used by GetMultiRangeCoalescingPolicy()
+    std::mutex m_oMutexNetworkEstimates{};
+    double m_dfLatencyEstimate = 0;
+    double m_dfThroughputEstimate = 0;
+
   protected:
     CPLMutex *hMutex = nullptr;
 
@@ -267,12 +278,19 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     int Rmdir(const char *pszDirname) override;
     char **ReadDirEx(const char *pszDirname, int nMaxFiles) override;
     char **SiblingFiles(const char *pszFilename) override;
+    bool PrefetchMetadata(CSLConstList papszFilenames,
+                          CSLConstList papszOptions) override;
 
     int HasOptimizedReadMultiRange(const char * /* pszPath */) override
     {
         return true;
     }
 
+    VSIMultiRangeCoalescingPolicy
+    GetMultiRangeCoalescingPolicy(const char * /* pszPath */) override;
+
+    void UpdateNetworkEstimates(double dfLatency, double dfThroughput);
+
     const char *GetActualURL(const char *pszFilename) override;
 
     const char *GetOptions() override;
@@ -387,6 +405,10 @@ class VSICurlHandle : public VSIVirtualHandle
     vsi_l_offset lastDownloadedOffset = VSI_L_OFFSET_MAX;
     int nBlocksToDownload = 1;
 
+    // Blocks downloaded by Read() but not read yet, when network statistics
+    // are enabled. Used to report over-fetched bytes.
+    std::map<vsi_l_offset, size_t> m_oMapUnreadBlocks{};
+
     bool bStopOnInterruptUntilUninstall = false;
     bool bInterrupted = false;
     VSICurlReadCbkFunc pfnReadCbk = nullptr;
@@ -439,6 +461,29 @@ class VSICurlHandle : public VSIVirtualHandle
     std::vector<std::unique_ptr<AdviseReadRange>> m_aoAdviseReadRanges{};
     std::thread m_oThreadAdviseRead{};
 
+    // Used by the asynchronous readahead of sequential Read() calls
+    struct ReadAheadWindow
+    {
+        bool bDone = false;
+        std::mutex oMutex{};
+        std::condition_variable oCV{};
+        vsi_l_offset nStartOffset = 0;
+        vsi_l_offset nEndOffset = 0;
+        std::thread oThread{};
+    };
+
+    std::vector<std::unique_ptr<ReadAheadWindow>> m_apoReadAheadWindows{};
+    int m_nReadAheadMaxDepth = 0;
+    int m_nReadAheadDepth = 1;
+    int m_nReadAheadBlocks = 1;
+    vsi_l_offset m_nReadAheadStartOffset = 0;
+    vsi_l_offset m_nReadAheadNextOffset = VSI_L_OFFSET_MAX;
+
+    void UpdateReadAhead(bool bSequentialDownload);
+    bool WaitForReadAhead(vsi_l_offset nOffset);
+    void StopReadAhead();
+    void JoinReadAheadWindows(bool bOnlyDone);
+
   protected:
     virtual struct curl_slist *
     GetCurlHeaders(const std::string & /*osVerb*/,
@@ -588,6 +633,8 @@ class IVSIS3LikeFSHandler : public VSICurlFilesystemHandlerBaseWritable
 {
     CPL_DISALLOW_COPY_ASSIGN(IVSIS3LikeFSHandler)
 
+    friend class VSIS3WriteHandle;
+
     virtual int MkdirInternal(const char *pszDirname, long nMode,
                               bool bDoStatCheck);
 
@@ -752,7 +799,31 @@ class VSIS3WriteHandle final : public VSIVirtualHandle
     double m_dfRetryDelay = 0.0;
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
+    // Parts being uploaded by background threads, in part number order.
+    struct PendingPart
+    {
+        int nPartNumber = 0;
+        GByte *pabyBuffer = nullptr;
+        std::string osEtag{};
+        std::vector<CPLErrorHandlerAccumulatorStruct> aoErrors{};
+        std::thread oThread{};
+    };
+
+    int m_nMaxParallelParts = 1;
+    std::deque<std::unique_ptr<PendingPart>> m_apoPendingParts{};
+    std::vector<GByte *> m_apabyFreeBuffers{};
+
+    // When the first part is uploaded last, it is kept in memory, so that
+    // it can be read and modified until Close().
+    bool m_bWriteFirstPartLast = false;
+    GByte *m_pabyFirstPart = nullptr;
+    vsi_l_offset m_nFileSize = 0;
+
+    GByte *GetInMemoryRange(vsi_l_offset nOffset, size_t &nAvailable);
     bool UploadPart();
+    bool UploadPartAsync();
+    bool WaitForOldestPendingPart();
+    bool WaitForPendingParts();
     bool DoSinglePartPUT();
 
     static size_t ReadCallBackBufferChunked(char *buffer, size_t size,
@@ -779,6 +850,8 @@ class VSIS3WriteHandle final : public VSIVirtualHandle
     {
         return m_bUseChunked || m_pabyBuffer != nullptr;
     }
+
+    bool EnableWriteFirstPartLast();
 };
 
 /************************************************************************/
@@ -871,6 +944,24 @@ class NetworkStatisticsLogger
 
     std::mutex m_mutex{};
 
+    //! Number of buckets of LatencyHistogram
+    static constexpr int LATENCY_BUCKET_COUNT = 12;
+
+    //! Upper bounds (exclusive), in milliseconds, of the buckets of
+    //! LatencyHistogram, but the last one which has no upper bound.
+    static const int kanLatencyBucketUpperBoundsMS[LATENCY_BUCKET_COUNT - 1];
+
+    struct LatencyHistogram
+    {
+        GIntBig nCount = 0;
+        double dfSumMS = 0;
+        double dfMaxMS = 0;
+        std::array<GIntBig, LATENCY_BUCKET_COUNT> anBuckets{};
+
+        void Add(double dfMS);
+        void AsJSON(CPLJSONObject &oJSON) const;
+    };
+
     struct Counters
     {
         GIntBig nHEAD = 0;
@@ -882,6 +973,11 @@ class NetworkStatisticsLogger
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+        GIntBig nRetries = 0;
+        GIntBig nThrottled = 0;
+        GIntBig nWastedBytes = 0;
+        LatencyHistogram oTimeToFirstByte{};
+        LatencyHistogram oTotalTime{};
     };
 
     enum class ContextPathType
@@ -961,6 +1057,12 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogRequestTimings(CURL *hCurlHandle);
+
+    static void LogRetry();
+
+    static void LogWastedBytes(GIntBig nWastedBytes);
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
@@ -1026,6 +1128,9 @@ void VSICURLInvalidateCachedFileProp(const char *pszURL);
 void VSICURLInvalidateCachedFilePropPrefix(const char *pszURL);
 void VSICURLDestroyCacheFileProp();
 
+// Process-wide share handle for DNS cache and TLS sessions
+void VSICURLDestroyShareHandle();
+
 void VSICURLMultiCleanup(CURLM *hCurlMultiHandle);
 
 //! @endcond
@@ -1445,6 +1445,7 @@ retry:
             CPLSleep(dfRetryDelay);
             dfRetryDelay = dfNewRetryDelay;
             nRetryCount++;
+            NetworkStatisticsLogger::LogRetry();
             curOffset = curOffsetOri;
             goto retry;
         }
@@ -1614,7 +1615,8 @@ VSIVirtualHandle *VSICurlStreamingFSHandler::Open(const char *pszFilename,
     }
 
     if (CPLTestBool(CPLGetConfigOption("VSI_CACHE", "FALSE")))
-        return VSICreateCachedFile(poHandle);
+        return VSICreateCachedFile(poHandle, VSI_CACHED_DEFAULT_CHUNK_SIZE, 0,
+                                   pszFilename);
 
     return poHandle;
 }
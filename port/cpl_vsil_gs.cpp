@@ -387,6 +387,7 @@ char **VSIGSFSHandler::GetFileMetadata(const char *pszFilename,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -501,6 +502,7 @@ bool VSIGSFSHandler::SetFileMetadata(const char *pszFilename,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else
@@ -706,6 +708,7 @@ int *VSIGSFSHandler::UnlinkBatch(CSLConstList papszFiles)
                         CPLSleep(dfRetryDelay);
                         dfRetryDelay = dfNewRetryDelay;
                         nRetryCount++;
+                        NetworkStatisticsLogger::LogRetry();
                         bRetry = true;
                     }
                     else
@@ -1955,6 +1955,10 @@ class VSIGZipWriteHandleMT final : public VSIVirtualHandle
     int nSeqNumberExpected_ = 0;
     int nSeqNumberExpectedCRC_ = 0;
     size_t nChunkSize_ = 0;
+    // Number of independently compressed chunks processed by a single job.
+    // Small chunks (typically SOZip ones) are grouped to reduce the per-job
+    // overhead.
+    size_t nChunksPerJob_ = 1;
     bool bHasErrored_ = false;
 
     struct Job
@@ -1966,6 +1970,9 @@ class VSIGZipWriteHandleMT final : public VSIVirtualHandle
         bool bInCRCComputation_ = false;
 
         std::string sCompressedData_{};
+        // Offsets in sCompressedData_ of the start of the chunks after the
+        // first one.
+        std::vector<size_t> anChunkOffsets_{};
         uLong nCRC_ = 0;
     };
 
@@ -1978,6 +1985,7 @@ class VSIGZipWriteHandleMT final : public VSIVirtualHandle
 
     static void DeflateCompress(void *inData);
     static void CRCCompute(void *inData);
+    void AppendSOZIPIndexEntry(uint64_t nOffset);
     bool ProcessCompletedJobs();
     Job *GetJobObject();
 #ifdef DEBUG_VERBOSE
@@ -2029,6 +2037,8 @@ VSIGZipWriteHandleMT::VSIGZipWriteHandleMT(VSIVirtualHandle *poBaseHandle,
             std::max(static_cast<size_t>(4 * 1024),
                      std::min(static_cast<size_t>(UINT_MAX), nChunkSize_));
     }
+    constexpr size_t MIN_JOB_SIZE = 1024 * 1024;
+    nChunksPerJob_ = std::max<size_t>(1, MIN_JOB_SIZE / nChunkSize_);
 
     for (int i = 0; i < 1 + nThreads_; i++)
         aposBuffers_.emplace_back(new std::string());
@@ -2176,9 +2186,6 @@ void VSIGZipWriteHandleMT::DeflateCompress(void *inData)
     sStream.zfree = nullptr;
     sStream.opaque = nullptr;
 
-    sStream.avail_in = static_cast<uInt>(psJob->pBuffer_->size());
-    sStream.next_in = reinterpret_cast<Bytef *>(&(*psJob->pBuffer_)[0]);
-
     int ret = deflateInit2(
         &sStream, Z_DEFAULT_COMPRESSION, Z_DEFLATED,
         (psJob->pParent_->nDeflateType_ == CPL_DEFLATE_TYPE_ZLIB) ? MAX_WBITS
@@ -2188,49 +2195,70 @@ void VSIGZipWriteHandleMT::DeflateCompress(void *inData)
 
     size_t nRealSize = 0;
 
-    while (sStream.avail_in > 0)
+    const size_t nChunkSize = psJob->pParent_->nChunkSize_;
+    const size_t nBufferSize = psJob->pBuffer_->size();
+    const size_t nChunks =
+        std::max<size_t>(1, (nBufferSize + nChunkSize - 1) / nChunkSize);
+    psJob->anChunkOffsets_.clear();
+    for (size_t iChunk = 0; iChunk < nChunks; ++iChunk)
     {
+        if (iChunk > 0)
+            psJob->anChunkOffsets_.push_back(nRealSize);
+
+        const size_t nChunkStart = iChunk * nChunkSize;
+        sStream.avail_in = static_cast<uInt>(
+            std::min(nChunkSize, nBufferSize - nChunkStart));
+        sStream.next_in =
+            reinterpret_cast<Bytef *>(&(*psJob->pBuffer_)[0]) + nChunkStart;
+
+        while (sStream.avail_in > 0)
+        {
+            psJob->sCompressedData_.resize(nRealSize + Z_BUFSIZE);
+            sStream.avail_out = static_cast<uInt>(Z_BUFSIZE);
+            sStream.next_out =
+                reinterpret_cast<Bytef *>(&psJob->sCompressedData_[0]) +
+                nRealSize;
+
+            const int zlibRet = deflate(&sStream, Z_NO_FLUSH);
+            CPLAssertAlwaysEval(zlibRet == Z_OK);
+
+            nRealSize += static_cast<uInt>(Z_BUFSIZE) - sStream.avail_out;
+        }
+
         psJob->sCompressedData_.resize(nRealSize + Z_BUFSIZE);
         sStream.avail_out = static_cast<uInt>(Z_BUFSIZE);
         sStream.next_out =
             reinterpret_cast<Bytef *>(&psJob->sCompressedData_[0]) + nRealSize;
 
-        const int zlibRet = deflate(&sStream, Z_NO_FLUSH);
-        CPLAssertAlwaysEval(zlibRet == Z_OK);
-
-        nRealSize += static_cast<uInt>(Z_BUFSIZE) - sStream.avail_out;
-    }
-
-    psJob->sCompressedData_.resize(nRealSize + Z_BUFSIZE);
-    sStream.avail_out = static_cast<uInt>(Z_BUFSIZE);
-    sStream.next_out =
-        reinterpret_cast<Bytef *>(&psJob->sCompressedData_[0]) + nRealSize;
-
-    if (psJob->bFinish_)
-    {
-        const int zlibRet = deflate(&sStream, Z_FINISH);
-        CPLAssertAlwaysEval(zlibRet == Z_STREAM_END);
-    }
-    else
-    {
-        // Do a Z_SYNC_FLUSH and Z_FULL_FLUSH, so as to have two markers when
-        // independent as pigz 2.3.4 or later. The following 9 byte sequence
-        // will be found: 0x00 0x00 0xff 0xff 0x00 0x00 0x00 0xff 0xff
-        // Z_FULL_FLUSH only is sufficient, but it is not obvious if a
-        // 0x00 0x00 0xff 0xff marker in the codestream is just a SYNC_FLUSH (
-        // without dictionary reset) or a FULL_FLUSH (with dictionary reset)
+        if (psJob->bFinish_ && iChunk + 1 == nChunks)
         {
-            const int zlibRet = deflate(&sStream, Z_SYNC_FLUSH);
-            CPLAssertAlwaysEval(zlibRet == Z_OK);
+            const int zlibRet = deflate(&sStream, Z_FINISH);
+            CPLAssertAlwaysEval(zlibRet == Z_STREAM_END);
         }
-
+        else
         {
-            const int zlibRet = deflate(&sStream, Z_FULL_FLUSH);
-            CPLAssertAlwaysEval(zlibRet == Z_OK);
+            // Do a Z_SYNC_FLUSH and Z_FULL_FLUSH, so as to have two markers
+            // when independent as pigz 2.3.4 or later. The following 9 byte
+            // sequence will be found: 0x00 0x00 0xff 0xff 0x00 0x00 0x00 0xff
+            // 0xff. Z_FULL_FLUSH only is sufficient, but it is not obvious if
+            // a 0x00 0x00 0xff 0xff marker in the codestream is just a
+            // SYNC_FLUSH (without dictionary reset) or a FULL_FLUSH (with
+            // dictionary reset). The dictionary reset makes each chunk
+            // independently decodable, even when several chunks are
+            // compressed by the same job.
+            {
+                const int zlibRet = deflate(&sStream, Z_SYNC_FLUSH);
+                CPLAssertAlwaysEval(zlibRet == Z_OK);
+            }
+
+            {
+                const int zlibRet = deflate(&sStream, Z_FULL_FLUSH);
+                CPLAssertAlwaysEval(zlibRet == Z_OK);
+            }
         }
-    }
 
-    nRealSize += static_cast<uInt>(Z_BUFSIZE) - sStream.avail_out;
+        nRealSize += static_cast<uInt>(Z_BUFSIZE) - sStream.avail_out;
+    }
     psJob->sCompressedData_.resize(nRealSize);
 
     deflateEnd(&sStream);
@@ -2287,6 +2315,43 @@ void VSIGZipWriteHandleMT::DumpState()
 }
 #endif
 
+/************************************************************************/
+/*                        AppendSOZIPIndexEntry()                       */
+/************************************************************************/
+
+void VSIGZipWriteHandleMT::AppendSOZIPIndexEntry(uint64_t nOffset)
+{
+    if (!panSOZIPIndex_)
+        return;
+    if (nSOZIPIndexEltSize_ == 8)
+    {
+        CPL_LSBPTR64(&nOffset);
+        std::copy(reinterpret_cast<const uint8_t *>(&nOffset),
+                  reinterpret_cast<const uint8_t *>(&nOffset) + sizeof(nOffset),
+                  std::back_inserter(*panSOZIPIndex_));
+    }
+    else
+    {
+        if (nOffset > std::numeric_limits<uint32_t>::max())
+        {
+            // shouldn't happen normally...
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Too big offset for SOZIP_OFFSET_SIZE = 4");
+            panSOZIPIndex_->clear();
+            panSOZIPIndex_ = nullptr;
+        }
+        else
+        {
+            uint32_t nOffset32 = static_cast<uint32_t>(nOffset);
+            CPL_LSBPTR32(&nOffset32);
+            std::copy(reinterpret_cast<const uint8_t *>(&nOffset32),
+                      reinterpret_cast<const uint8_t *>(&nOffset32) +
+                          sizeof(nOffset32),
+                      std::back_inserter(*panSOZIPIndex_));
+        }
+    }
+}
+
 /************************************************************************/
 /*                         ProcessCompletedJobs()                       */
 /************************************************************************/
@@ -2336,40 +2401,14 @@ bool VSIGZipWriteHandleMT::ProcessCompletedJobs()
                 sMutex_.unlock();
 
                 const size_t nToWrite = psJob->sCompressedData_.size();
-                if (panSOZIPIndex_ && !bIsSeqNumberExpectedZero &&
-                    !psJob->pBuffer_->empty())
+                if (panSOZIPIndex_ && !psJob->pBuffer_->empty())
                 {
-                    uint64_t nOffset = poBaseHandle_->Tell() - nStartOffset_;
-                    if (nSOZIPIndexEltSize_ == 8)
-                    {
-                        CPL_LSBPTR64(&nOffset);
-                        std::copy(reinterpret_cast<const uint8_t *>(&nOffset),
-                                  reinterpret_cast<const uint8_t *>(&nOffset) +
-                                      sizeof(nOffset),
-                                  std::back_inserter(*panSOZIPIndex_));
-                    }
-                    else
-                    {
-                        if (nOffset > std::numeric_limits<uint32_t>::max())
-                        {
-                            // shouldn't happen normally...
-                            CPLError(
-                                CE_Failure, CPLE_AppDefined,
-                                "Too big offset for SOZIP_OFFSET_SIZE = 4");
-                            panSOZIPIndex_->clear();
-                            panSOZIPIndex_ = nullptr;
-                        }
-                        else
-                        {
-                            uint32_t nOffset32 = static_cast<uint32_t>(nOffset);
-                            CPL_LSBPTR32(&nOffset32);
-                            std::copy(
-                                reinterpret_cast<const uint8_t *>(&nOffset32),
-                                reinterpret_cast<const uint8_t *>(&nOffset32) +
-                                    sizeof(nOffset32),
-                                std::back_inserter(*panSOZIPIndex_));
-                        }
-                    }
+                    const uint64_t nOffset =
+                        poBaseHandle_->Tell() - nStartOffset_;
+                    if (!bIsSeqNumberExpectedZero)
+                        AppendSOZIPIndexEntry(nOffset);
+                    for (size_t nChunkOffset : psJob->anChunkOffsets_)
+                        AppendSOZIPIndexEntry(nOffset + nChunkOffset);
                 }
                 bool bError =
                     poBaseHandle_->Write(psJob->sCompressedData_.data(), 1,
@@ -2492,13 +2531,14 @@ size_t VSIGZipWriteHandleMT::Write(const void *const pBuffer,
             }
             pCurBuffer_->clear();
         }
+        const size_t nJobSize = nChunkSize_ * nChunksPerJob_;
         size_t nConsumed =
-            std::min(nBytesToWrite, nChunkSize_ - pCurBuffer_->size());
+            std::min(nBytesToWrite, nJobSize - pCurBuffer_->size());
         pCurBuffer_->append(pszBuffer, nConsumed);
         nCurOffset_ += nConsumed;
         pszBuffer += nConsumed;
         nBytesToWrite -= nConsumed;
-        if (pCurBuffer_->size() == nChunkSize_)
+        if (pCurBuffer_->size() == nJobSize)
         {
             if (poPool_ == nullptr)
             {
@@ -2826,72 +2866,878 @@ size_t VSIGZipWriteHandle::Write(const void *const pBuffer, size_t const nSize,
         const int zlibRet = deflate(&sStream, Z_NO_FLUSH);
         CPLAssertAlwaysEval(zlibRet == Z_OK);
 
-        const size_t nOutBytes =
-            static_cast<uInt>(Z_BUFSIZE) - sStream.avail_out;
+        const size_t nOutBytes =
+            static_cast<uInt>(Z_BUFSIZE) - sStream.avail_out;
+
+        if (nOutBytes > 0)
+        {
+            if (m_poBaseHandle->Write(pabyOutBuf, 1, nOutBytes) < nOutBytes)
+                return 0;
+        }
+
+        nNextByte += nNewBytesToWrite;
+        nCurOffset += nNewBytesToWrite;
+    }
+
+    return nMemb;
+}
+
+/************************************************************************/
+/*                               Flush()                                */
+/************************************************************************/
+
+int VSIGZipWriteHandle::Flush()
+
+{
+    // we *could* do something for this but for now we choose not to.
+
+    return 0;
+}
+
+/************************************************************************/
+/*                                Eof()                                 */
+/************************************************************************/
+
+int VSIGZipWriteHandle::Eof()
+
+{
+    return 1;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIGZipWriteHandle::Seek(vsi_l_offset nOffset, int nWhence)
+
+{
+    if (nOffset == 0 && (nWhence == SEEK_END || nWhence == SEEK_CUR))
+        return 0;
+    else if (nWhence == SEEK_SET && nOffset == nCurOffset)
+        return 0;
+    else
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Seeking on writable compressed data streams not supported.");
+
+        return -1;
+    }
+}
+
+/************************************************************************/
+/*                                Tell()                                */
+/************************************************************************/
+
+vsi_l_offset VSIGZipWriteHandle::Tell()
+
+{
+    return nCurOffset;
+}
+
+#ifdef HAVE_LIBDEFLATE
+
+/************************************************************************/
+/* ==================================================================== */
+/*                         VSIInflatedMemHandle                         */
+/* ==================================================================== */
+/************************************************************************/
+
+// Read-only handle on a deflate stream that has been decompressed at once
+// with libdeflate, which is much faster than zlib streaming inflation, and
+// gives cheap random and concurrent (PRead()) access.
+class VSIInflatedMemHandle final : public VSIVirtualHandle
+{
+    std::vector<GByte> m_abyData;
+    vsi_l_offset m_nCurOffset = 0;
+    bool m_bEOF = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIInflatedMemHandle)
+
+  public:
+    explicit VSIInflatedMemHandle(std::vector<GByte> &&abyData)
+        : m_abyData(std::move(abyData))
+    {
+    }
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+
+    vsi_l_offset Tell() override
+    {
+        return m_nCurOffset;
+    }
+
+    size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
+    size_t Write(const void *pBuffer, size_t nSize, size_t nMemb) override;
+
+    int Eof() override
+    {
+        return m_bEOF;
+    }
+
+    int Close() override
+    {
+        return 0;
+    }
+
+    bool HasPRead() const override
+    {
+        return true;
+    }
+
+    size_t PRead(void *pBuffer, size_t nSize,
+                 vsi_l_offset nOffset) const override;
+    const void *AcquireView(vsi_l_offset nOffset, size_t nSize) override;
+
+    void ReleaseView(const void *, size_t) override
+    {
+    }
+};
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIInflatedMemHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+        m_nCurOffset = nOffset;
+    else if (nWhence == SEEK_CUR)
+        m_nCurOffset += nOffset;
+    else
+        m_nCurOffset = m_abyData.size() + nOffset;
+    return 0;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIInflatedMemHandle::Read(void *pBuffer, size_t nSize, size_t nMemb)
+{
+    if (nSize == 0 || nMemb == 0)
+        return 0;
+    const size_t nRead = PRead(pBuffer, nSize * nMemb, m_nCurOffset);
+    m_nCurOffset += nRead;
+    if (nRead < nSize * nMemb)
+        m_bEOF = true;
+    return nRead / nSize;
+}
+
+/************************************************************************/
+/*                                PRead()                               */
+/************************************************************************/
+
+size_t VSIInflatedMemHandle::PRead(void *pBuffer, size_t nSize,
+                                   vsi_l_offset nOffset) const
+{
+    if (nOffset >= m_abyData.size())
+        return 0;
+    const size_t nToRead = static_cast<size_t>(
+        std::min<vsi_l_offset>(nSize, m_abyData.size() - nOffset));
+    memcpy(pBuffer, m_abyData.data() + static_cast<size_t>(nOffset), nToRead);
+    return nToRead;
+}
+
+/************************************************************************/
+/*                             AcquireView()                            */
+/************************************************************************/
+
+const void *VSIInflatedMemHandle::AcquireView(vsi_l_offset nOffset,
+                                              size_t nSize)
+{
+    if (nOffset > m_abyData.size() || nSize > m_abyData.size() - nOffset)
+        return nullptr;
+    return m_abyData.data() + static_cast<size_t>(nOffset);
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+size_t VSIInflatedMemHandle::Write(const void * /* pBuffer */,
+                                   size_t /* nSize */, size_t /* nMemb */)
+{
+    CPLError(CE_Failure, CPLE_NotSupported,
+             "VSIFWriteL is not supported on GZip streams");
+    return 0;
+}
+
+/************************************************************************/
+/*                    GetInflateInMemoryMaxSize()                       */
+/************************************************************************/
+
+// Maximum uncompressed size of a /vsigzip/ file or of a deflate-compressed
+// /vsizip/ member to be decompressed in a single pass with libdeflate.
+static size_t GetInflateInMemoryMaxSize()
+{
+    const char *pszMaxSize =
+        CPLGetConfigOption("CPL_VSIL_INFLATE_IN_MEMORY_MAX_SIZE", "10M");
+    GUIntBig nMaxSize = static_cast<GUIntBig>(
+        std::max<GIntBig>(0, CPLAtoGIntBig(pszMaxSize)));
+    if (strchr(pszMaxSize, 'K'))
+        nMaxSize *= 1024;
+    else if (strchr(pszMaxSize, 'M'))
+        nMaxSize *= 1024 * 1024;
+    else if (strchr(pszMaxSize, 'G'))
+        nMaxSize *= 1024 * 1024 * 1024;
+    return static_cast<size_t>(std::min<GUIntBig>(
+        nMaxSize, std::numeric_limits<size_t>::max() / 2));
+}
+
+/************************************************************************/
+/*                      VSIInflateGZipInMemory()                        */
+/************************************************************************/
+
+// Decompress a whole single-member gzip file, whose compressed and
+// uncompressed sizes are not greater than GetInflateInMemoryMaxSize().
+// Returns nullptr (without error) if that cannot be done, so that the
+// caller falls back to streaming decompression.
+static VSIVirtualHandle *VSIInflateGZipInMemory(VSIVirtualHandle *poBaseHandle)
+{
+    const size_t nMaxSize = GetInflateInMemoryMaxSize();
+    if (nMaxSize == 0 || poBaseHandle->Seek(0, SEEK_END) != 0)
+        return nullptr;
+    const vsi_l_offset nFileSize = poBaseHandle->Tell();
+    // 18 = size of minimum gzip header + trailer
+    if (nFileSize < 18 || nFileSize > nMaxSize)
+        return nullptr;
+
+    std::vector<GByte> abyCompressed;
+    try
+    {
+        abyCompressed.resize(static_cast<size_t>(nFileSize));
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+    if (poBaseHandle->Seek(0, SEEK_SET) != 0 ||
+        poBaseHandle->Read(abyCompressed.data(), 1, abyCompressed.size()) !=
+            abyCompressed.size())
+    {
+        return nullptr;
+    }
+
+    // ISIZE field of the trailer: uncompressed size modulo 2^32
+    const size_t nUncompressedSize =
+        static_cast<size_t>(abyCompressed[abyCompressed.size() - 4]) |
+        (static_cast<size_t>(abyCompressed[abyCompressed.size() - 3]) << 8) |
+        (static_cast<size_t>(abyCompressed[abyCompressed.size() - 2]) << 16) |
+        (static_cast<size_t>(abyCompressed[abyCompressed.size() - 1]) << 24);
+    if (nUncompressedSize > nMaxSize)
+        return nullptr;
+
+    std::vector<GByte> abyUncompressed;
+    try
+    {
+        // +1 to avoid a zero-sized buffer
+        abyUncompressed.resize(nUncompressedSize + 1);
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+
+    struct libdeflate_decompressor *dec = libdeflate_alloc_decompressor();
+    if (dec == nullptr)
+        return nullptr;
+    size_t nActualIn = 0;
+    size_t nActualOut = 0;
+    // libdeflate checks the CRC32 and ISIZE fields
+    const auto res = libdeflate_gzip_decompress_ex(
+        dec, abyCompressed.data(), abyCompressed.size(),
+        abyUncompressed.data(), abyUncompressed.size(), &nActualIn,
+        &nActualOut);
+    libdeflate_free_decompressor(dec);
+
+    // Multi-member files (nActualIn < file size) are left to VSIGZipHandle
+    if (res != LIBDEFLATE_SUCCESS || nActualIn != abyCompressed.size() ||
+        nActualOut != nUncompressedSize)
+    {
+        return nullptr;
+    }
+    abyUncompressed.resize(nActualOut);
+    return new VSIInflatedMemHandle(std::move(abyUncompressed));
+}
+
+/************************************************************************/
+/*                      VSIInflateDeflateInMemory()                     */
+/************************************************************************/
+
+// Same as VSIInflateGZipInMemory(), for a raw deflate stream of a /vsizip/
+// member.
+static VSIVirtualHandle *
+VSIInflateDeflateInMemory(VSIVirtualHandle *poBaseHandle,
+                          vsi_l_offset nStartOffset,
+                          vsi_l_offset nCompressedSize,
+                          vsi_l_offset nUncompressedSize, uLong nCRC)
+{
+    const size_t nMaxSize = GetInflateInMemoryMaxSize();
+    if (nCompressedSize > nMaxSize || nUncompressedSize > nMaxSize)
+        return nullptr;
+
+    std::vector<GByte> abyCompressed;
+    std::vector<GByte> abyUncompressed;
+    try
+    {
+        abyCompressed.resize(static_cast<size_t>(nCompressedSize));
+        // +1 to avoid a zero-sized buffer
+        abyUncompressed.resize(static_cast<size_t>(nUncompressedSize) + 1);
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+    if (poBaseHandle->Seek(nStartOffset, SEEK_SET) != 0 ||
+        poBaseHandle->Read(abyCompressed.data(), 1, abyCompressed.size()) !=
+            abyCompressed.size())
+    {
+        return nullptr;
+    }
+
+    struct libdeflate_decompressor *dec = libdeflate_alloc_decompressor();
+    if (dec == nullptr)
+        return nullptr;
+    size_t nActualOut = 0;
+    const auto res = libdeflate_deflate_decompress(
+        dec, abyCompressed.data(), abyCompressed.size(),
+        abyUncompressed.data(), abyUncompressed.size(), &nActualOut);
+    libdeflate_free_decompressor(dec);
+    if (res != LIBDEFLATE_SUCCESS || nActualOut != nUncompressedSize ||
+        libdeflate_crc32(0, abyUncompressed.data(), nActualOut) != nCRC)
+    {
+        return nullptr;
+    }
+    abyUncompressed.resize(nActualOut);
+    return new VSIInflatedMemHandle(std::move(abyUncompressed));
+}
+
+#endif  // HAVE_LIBDEFLATE
+
+/************************************************************************/
+/*                  VSIGetDecompressionThreadCount()                    */
+/************************************************************************/
+
+// Number of threads to use to decompress independent blocks, from the
+// GDAL_NUM_THREADS configuration option (defaults to 1)
+static int VSIGetDecompressionThreadCount()
+{
+    int nThreads = 1;
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", nullptr);
+    if (pszThreads)
+    {
+        if (EQUAL(pszThreads, "ALL_CPUS"))
+            nThreads = CPLGetNumCPUs();
+        else
+            nThreads = atoi(pszThreads);
+        nThreads = std::max(1, std::min(128, nThreads));
+    }
+    return nThreads;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                            VSIBGZFHandle                             */
+/* ==================================================================== */
+/************************************************************************/
+
+// Read-only handle on a BGZF file (blocked gzip, as produced by bgzip and
+// used by htslib), that is a concatenation of gzip members of at most 64 KB
+// of uncompressed data each, whose compressed size is recorded in a 'BC'
+// extra subfield. This allows to build an index of the blocks by only
+// parsing their headers, and thus random access and concurrent
+// decompression of consecutive blocks.
+class VSIBGZFHandle final : public VSIVirtualHandle
+{
+    struct BlockInfo
+    {
+        vsi_l_offset nCompressedOffset;
+        vsi_l_offset nUncompressedOffset;
+    };
+
+    struct DecodeJob
+    {
+        const GByte *pabyIn = nullptr;
+        size_t nInSize = 0;
+        GByte *pabyOut = nullptr;
+        size_t nOutSize = 0;
+        bool bOK = false;
+    };
+
+    // Size of the chunks of compressed data read when extending the index.
+    static constexpr size_t INDEX_CHUNK_SIZE = 1024 * 1024;
+    static constexpr int BGZF_MAX_BLOCK_SIZE = 65536;
+    static constexpr int GZIP_BASE_HEADER_SIZE = 12;
+    static constexpr int GZIP_TRAILER_SIZE = 8;
+
+    VSIVirtualHandleUniquePtr m_poBaseHandle;
+    const int m_nThreads;
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+
+    std::vector<BlockInfo> m_asBlocks{};
+    vsi_l_offset m_nIndexCompressedEnd = 0;
+    vsi_l_offset m_nIndexUncompressedEnd = 0;
+    bool m_bIndexComplete = false;
+
+    // Last chunk of compressed data read by ExtendIndex().
+    std::vector<GByte> m_abyChunk{};
+    vsi_l_offset m_nChunkOffset = 0;
+
+    std::vector<GByte> m_abyCompressed{};
+    std::vector<GByte> m_abyDecoded{};
+    vsi_l_offset m_nDecodedOffset = 0;
+
+    vsi_l_offset m_nCurPos = 0;
+    bool m_bEOF = false;
+    bool m_bError = false;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIBGZFHandle)
+
+    bool ExtendIndex();
+    bool DecodeBlocksAt(vsi_l_offset nOffset);
+    static void DecodeJobFunc(void *pData);
+
+  public:
+    VSIBGZFHandle(VSIVirtualHandleUniquePtr &&poBaseHandle, int nThreads)
+        : m_poBaseHandle(std::move(poBaseHandle)), m_nThreads(nThreads)
+    {
+    }
+
+    static bool IsBGZFHeader(const GByte *pabyHeader, size_t nSize);
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+
+    vsi_l_offset Tell() override
+    {
+        return m_nCurPos;
+    }
+
+    size_t Read(void *pBuffer, size_t nSize, size_t nCount) override;
+
+    size_t Write(const void *, size_t, size_t) override
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "VSIFWriteL is not supported on GZip streams");
+        return 0;
+    }
+
+    int Eof() override
+    {
+        return m_bEOF;
+    }
+
+    int Close() override
+    {
+        m_poBaseHandle.reset();
+        return 0;
+    }
+};
+
+/************************************************************************/
+/*                           IsBGZFHeader()                             */
+/************************************************************************/
+
+// Whether pabyHeader starts with a gzip member header with a 'BC' extra
+// subfield.
+bool VSIBGZFHandle::IsBGZFHeader(const GByte *pabyHeader, size_t nSize)
+{
+    if (nSize < GZIP_BASE_HEADER_SIZE || pabyHeader[0] != 0x1f ||
+        pabyHeader[1] != 0x8b || pabyHeader[2] != Z_DEFLATED ||
+        pabyHeader[3] != EXTRA_FIELD)
+    {
+        return false;
+    }
+    const size_t nXLen = pabyHeader[10] | (pabyHeader[11] << 8);
+    if (GZIP_BASE_HEADER_SIZE + nXLen > nSize)
+        return false;
+    const GByte *pabyExtra = pabyHeader + GZIP_BASE_HEADER_SIZE;
+    for (size_t i = 0; i + 4 <= nXLen;)
+    {
+        const size_t nSubLen = pabyExtra[i + 2] | (pabyExtra[i + 3] << 8);
+        if (pabyExtra[i] == 'B' && pabyExtra[i + 1] == 'C' && nSubLen == 2)
+            return i + 6 <= nXLen;
+        i += 4 + nSubLen;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                            ExtendIndex()                             */
+/************************************************************************/
+
+// Read the next chunk of compressed data after the last indexed block, and
+// add the blocks it fully contains to the index.
+bool VSIBGZFHandle::ExtendIndex()
+{
+    if (m_bIndexComplete)
+        return true;
+    if (m_bError)
+        return false;
+
+    m_abyChunk.resize(INDEX_CHUNK_SIZE);
+    m_nChunkOffset = m_nIndexCompressedEnd;
+    if (m_poBaseHandle->Seek(m_nChunkOffset, SEEK_SET) != 0)
+    {
+        m_bError = true;
+        return false;
+    }
+    const size_t nRead =
+        m_poBaseHandle->Read(m_abyChunk.data(), 1, m_abyChunk.size());
+    m_abyChunk.resize(nRead);
+
+    size_t nPos = 0;
+    while (nPos + GZIP_BASE_HEADER_SIZE <= nRead)
+    {
+        const GByte *pabyBlock = m_abyChunk.data() + nPos;
+        if (!IsBGZFHeader(pabyBlock, nRead - nPos))
+        {
+            if (nRead - nPos >= GZIP_BASE_HEADER_SIZE +
+                                    static_cast<size_t>(BGZF_MAX_BLOCK_SIZE))
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid BGZF block header at offset " CPL_FRMT_GUIB,
+                         static_cast<GUIntBig>(m_nChunkOffset + nPos));
+                m_bError = true;
+                return false;
+            }
+            // Probably header truncated by the end of the chunk.
+            break;
+        }
+        const size_t nXLen = pabyBlock[10] | (pabyBlock[11] << 8);
+        const GByte *pabyExtra = pabyBlock + GZIP_BASE_HEADER_SIZE;
+        size_t nBlockSize = 0;
+        for (size_t i = 0; i + 4 <= nXLen;)
+        {
+            const size_t nSubLen = pabyExtra[i + 2] | (pabyExtra[i + 3] << 8);
+            if (pabyExtra[i] == 'B' && pabyExtra[i + 1] == 'C' && nSubLen == 2)
+            {
+                nBlockSize =
+                    1 + static_cast<size_t>(pabyExtra[i + 4] |
+                                            (pabyExtra[i + 5] << 8));
+                break;
+            }
+            i += 4 + nSubLen;
+        }
+        if (nBlockSize < GZIP_BASE_HEADER_SIZE + nXLen + GZIP_TRAILER_SIZE)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid BGZF block size at offset " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(m_nChunkOffset + nPos));
+            m_bError = true;
+            return false;
+        }
+        if (nPos + nBlockSize > nRead)
+            break;
+
+        const GByte *pabyISize = pabyBlock + nBlockSize - 4;
+        const uint32_t nUncompressedSize =
+            pabyISize[0] | (pabyISize[1] << 8) | (pabyISize[2] << 16) |
+            (static_cast<uint32_t>(pabyISize[3]) << 24);
+        if (nUncompressedSize > static_cast<uint32_t>(BGZF_MAX_BLOCK_SIZE))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Invalid BGZF uncompressed block size at offset "
+                     CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(m_nChunkOffset + nPos));
+            m_bError = true;
+            return false;
+        }
+
+        m_asBlocks.push_back({m_nIndexCompressedEnd, m_nIndexUncompressedEnd});
+        m_nIndexCompressedEnd += nBlockSize;
+        m_nIndexUncompressedEnd += nUncompressedSize;
+        nPos += nBlockSize;
+    }
+
+    if (nRead < INDEX_CHUNK_SIZE)
+    {
+        if (nPos < nRead)
+        {
+            CPLDebug("GZIP",
+                     "Ignoring %u trailing bytes after last BGZF block",
+                     static_cast<unsigned>(nRead - nPos));
+        }
+        m_bIndexComplete = true;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           DecodeJobFunc()                            */
+/************************************************************************/
+
+void VSIBGZFHandle::DecodeJobFunc(void *pData)
+{
+    DecodeJob *psJob = static_cast<DecodeJob *>(pData);
+    const GByte *pabyIn = psJob->pabyIn;
+    const size_t nHeaderSize =
+        GZIP_BASE_HEADER_SIZE + (pabyIn[10] | (pabyIn[11] << 8));
+    const GByte *pabyTrailer = pabyIn + psJob->nInSize - GZIP_TRAILER_SIZE;
+    const uint32_t nExpectedCRC =
+        pabyTrailer[0] | (pabyTrailer[1] << 8) | (pabyTrailer[2] << 16) |
+        (static_cast<uint32_t>(pabyTrailer[3]) << 24);
+    const size_t nDeflateSize =
+        psJob->nInSize - nHeaderSize - GZIP_TRAILER_SIZE;
+
+#ifdef HAVE_LIBDEFLATE
+    auto dec = libdeflate_alloc_decompressor();
+    if (dec == nullptr)
+        return;
+    size_t nActualOut = 0;
+    const auto res = libdeflate_deflate_decompress(
+        dec, pabyIn + nHeaderSize, nDeflateSize, psJob->pabyOut,
+        psJob->nOutSize, &nActualOut);
+    libdeflate_free_decompressor(dec);
+    psJob->bOK = res == LIBDEFLATE_SUCCESS && nActualOut == psJob->nOutSize &&
+                 libdeflate_crc32(0, psJob->pabyOut, psJob->nOutSize) ==
+                     nExpectedCRC;
+#else
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return;
+    sStream.next_in = const_cast<Bytef *>(pabyIn + nHeaderSize);
+    sStream.avail_in = static_cast<uInt>(nDeflateSize);
+    // next_out must not be null, even for an empty block.
+    GByte abyDummy[1];
+    sStream.next_out = psJob->nOutSize ? psJob->pabyOut : abyDummy;
+    sStream.avail_out = static_cast<uInt>(psJob->nOutSize);
+    const bool bStreamEnd =
+        inflate(&sStream, Z_FINISH) == Z_STREAM_END && sStream.avail_out == 0;
+    inflateEnd(&sStream);
+    psJob->bOK =
+        bStreamEnd &&
+        crc32(0, psJob->pabyOut, static_cast<uInt>(psJob->nOutSize)) ==
+            nExpectedCRC;
+#endif
+}
+
+/************************************************************************/
+/*                          DecodeBlocksAt()                            */
+/************************************************************************/
+
+// Decompress the block containing uncompressed offset nOffset, and a few
+// following ones (concurrently when several threads are allowed) into
+// m_abyDecoded. Returns false on error or if nOffset is beyond end of file.
+bool VSIBGZFHandle::DecodeBlocksAt(vsi_l_offset nOffset)
+{
+    if (m_bError)
+        return false;
+
+    while (!m_bIndexComplete && nOffset >= m_nIndexUncompressedEnd)
+    {
+        if (!ExtendIndex())
+            return false;
+    }
+    if (nOffset >= m_nIndexUncompressedEnd)
+        return false;
+
+    const auto oIter = std::upper_bound(
+        m_asBlocks.begin(), m_asBlocks.end(), nOffset,
+        [](vsi_l_offset nVal, const BlockInfo &sBlock)
+        { return nVal < sBlock.nUncompressedOffset; });
+    CPLAssert(oIter != m_asBlocks.begin());
+    const size_t iFirstBlock =
+        static_cast<size_t>(std::distance(m_asBlocks.begin(), oIter)) - 1;
+
+    const size_t nMaxBlocks = 4 * static_cast<size_t>(m_nThreads);
+    while (!m_bIndexComplete && m_asBlocks.size() < iFirstBlock + nMaxBlocks)
+    {
+        if (!ExtendIndex())
+            return false;
+    }
+    const size_t iEndBlock =
+        std::min(m_asBlocks.size(), iFirstBlock + nMaxBlocks);
+
+    const auto GetCompressedOffset = [this](size_t iBlock)
+    {
+        return iBlock < m_asBlocks.size()
+                   ? m_asBlocks[iBlock].nCompressedOffset
+                   : m_nIndexCompressedEnd;
+    };
+    const auto GetUncompressedOffset = [this](size_t iBlock)
+    {
+        return iBlock < m_asBlocks.size()
+                   ? m_asBlocks[iBlock].nUncompressedOffset
+                   : m_nIndexUncompressedEnd;
+    };
 
-        if (nOutBytes > 0)
+    const vsi_l_offset nCompressedStart = GetCompressedOffset(iFirstBlock);
+    const vsi_l_offset nCompressedEnd = GetCompressedOffset(iEndBlock);
+    const GByte *pabyCompressed;
+    if (nCompressedStart >= m_nChunkOffset &&
+        nCompressedEnd <= m_nChunkOffset + m_abyChunk.size())
+    {
+        pabyCompressed =
+            m_abyChunk.data() +
+            static_cast<size_t>(nCompressedStart - m_nChunkOffset);
+    }
+    else
+    {
+        m_abyCompressed.resize(
+            static_cast<size_t>(nCompressedEnd - nCompressedStart));
+        if (m_poBaseHandle->Seek(nCompressedStart, SEEK_SET) != 0 ||
+            m_poBaseHandle->Read(m_abyCompressed.data(), 1,
+                                 m_abyCompressed.size()) !=
+                m_abyCompressed.size())
         {
-            if (m_poBaseHandle->Write(pabyOutBuf, 1, nOutBytes) < nOutBytes)
-                return 0;
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "Cannot read BGZF blocks at offset " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(nCompressedStart));
+            return false;
         }
-
-        nNextByte += nNewBytesToWrite;
-        nCurOffset += nNewBytesToWrite;
+        pabyCompressed = m_abyCompressed.data();
     }
 
-    return nMemb;
-}
-
-/************************************************************************/
-/*                               Flush()                                */
-/************************************************************************/
+    m_nDecodedOffset = GetUncompressedOffset(iFirstBlock);
+    m_abyDecoded.resize(static_cast<size_t>(GetUncompressedOffset(iEndBlock) -
+                                            m_nDecodedOffset));
 
-int VSIGZipWriteHandle::Flush()
+    std::vector<DecodeJob> asJobs(iEndBlock - iFirstBlock);
+    std::vector<void *> apJobs;
+    for (size_t i = 0; i < asJobs.size(); ++i)
+    {
+        const size_t iBlock = iFirstBlock + i;
+        asJobs[i].pabyIn = pabyCompressed + static_cast<size_t>(
+                                                GetCompressedOffset(iBlock) -
+                                                nCompressedStart);
+        asJobs[i].nInSize = static_cast<size_t>(
+            GetCompressedOffset(iBlock + 1) - GetCompressedOffset(iBlock));
+        asJobs[i].pabyOut = m_abyDecoded.data() +
+                            static_cast<size_t>(GetUncompressedOffset(iBlock) -
+                                                m_nDecodedOffset);
+        asJobs[i].nOutSize = static_cast<size_t>(
+            GetUncompressedOffset(iBlock + 1) - GetUncompressedOffset(iBlock));
+        apJobs.push_back(&asJobs[i]);
+    }
 
-{
-    // we *could* do something for this but for now we choose not to.
+    if (m_nThreads > 1 && asJobs.size() > 1 && !m_poPool)
+    {
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (poPool->Setup(m_nThreads, nullptr, nullptr, false))
+            m_poPool = std::move(poPool);
+    }
+    if (m_poPool && asJobs.size() > 1)
+    {
+        m_poPool->SubmitJobs(DecodeJobFunc, apJobs);
+        m_poPool->WaitCompletion();
+    }
+    else
+    {
+        for (void *pJob : apJobs)
+            DecodeJobFunc(pJob);
+    }
 
-    return 0;
+    for (size_t i = 0; i < asJobs.size(); ++i)
+    {
+        if (!asJobs[i].bOK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot decompress BGZF block at offset " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(
+                         GetCompressedOffset(iFirstBlock + i)));
+            m_abyDecoded.clear();
+            m_bError = true;
+            return false;
+        }
+    }
+    return true;
 }
 
 /************************************************************************/
-/*                                Eof()                                 */
+/*                                Seek()                                */
 /************************************************************************/
 
-int VSIGZipWriteHandle::Eof()
-
+int VSIBGZFHandle::Seek(vsi_l_offset nOffset, int nWhence)
 {
-    return 1;
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+    {
+        m_nCurPos = nOffset;
+    }
+    else if (nWhence == SEEK_CUR)
+    {
+        m_nCurPos += nOffset;
+    }
+    else
+    {
+        while (!m_bIndexComplete)
+        {
+            if (!ExtendIndex())
+                return -1;
+        }
+        m_nCurPos = m_nIndexUncompressedEnd + nOffset;
+    }
+    return 0;
 }
 
 /************************************************************************/
-/*                                Seek()                                */
+/*                                Read()                                */
 /************************************************************************/
 
-int VSIGZipWriteHandle::Seek(vsi_l_offset nOffset, int nWhence)
-
+size_t VSIBGZFHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
 {
-    if (nOffset == 0 && (nWhence == SEEK_END || nWhence == SEEK_CUR))
-        return 0;
-    else if (nWhence == SEEK_SET && nOffset == nCurOffset)
+    const size_t nToRead = nSize * nCount;
+    if (nToRead == 0)
         return 0;
-    else
-    {
-        CPLError(CE_Failure, CPLE_NotSupported,
-                 "Seeking on writable compressed data streams not supported.");
 
-        return -1;
+    GByte *pabyBuffer = static_cast<GByte *>(pBuffer);
+    size_t nTotalRead = 0;
+    while (nTotalRead < nToRead)
+    {
+        if (m_nCurPos >= m_nDecodedOffset &&
+            m_nCurPos < m_nDecodedOffset + m_abyDecoded.size())
+        {
+            const size_t nOffsetInDecoded =
+                static_cast<size_t>(m_nCurPos - m_nDecodedOffset);
+            const size_t nAvail =
+                std::min(m_abyDecoded.size() - nOffsetInDecoded,
+                         nToRead - nTotalRead);
+            memcpy(pabyBuffer + nTotalRead,
+                   m_abyDecoded.data() + nOffsetInDecoded, nAvail);
+            nTotalRead += nAvail;
+            m_nCurPos += nAvail;
+        }
+        else if (!DecodeBlocksAt(m_nCurPos))
+        {
+            if (!m_bError)
+                m_bEOF = true;
+            break;
+        }
     }
+    return nTotalRead / nSize;
 }
 
 /************************************************************************/
-/*                                Tell()                                */
+/*                        VSICreateBGZFHandle()                         */
 /************************************************************************/
 
-vsi_l_offset VSIGZipWriteHandle::Tell()
-
+// Returns a VSIBGZFHandle if poBaseHandle is a BGZF file, or nullptr
+// (without error) otherwise, leaving the base handle untouched.
+static VSIVirtualHandle *
+VSICreateBGZFHandle(VSIVirtualHandleUniquePtr &poBaseHandle)
 {
-    return nCurOffset;
+    if (!CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_USE_BGZF_INDEX", "YES")))
+        return nullptr;
+
+    // Size of a standard BGZF block header, with only the 'BC' subfield.
+    constexpr int BGZF_HEADER_SIZE = 18;
+    GByte abyHeader[BGZF_HEADER_SIZE];
+    if (poBaseHandle->Seek(0, SEEK_SET) != 0 ||
+        poBaseHandle->Read(abyHeader, 1, sizeof(abyHeader)) !=
+            sizeof(abyHeader) ||
+        !VSIBGZFHandle::IsBGZFHeader(abyHeader, sizeof(abyHeader)))
+    {
+        poBaseHandle->Seek(0, SEEK_SET);
+        return nullptr;
+    }
+
+    const int nThreads = VSIGetDecompressionThreadCount();
+    CPLDebug("GZIP", "BGZF file detected. Using %d thread(s) to decompress it",
+             nThreads);
+    // coverity[tainted_data]
+    return new VSIBGZFHandle(std::move(poBaseHandle), nThreads);
 }
 
 /************************************************************************/
@@ -3001,6 +3847,22 @@ VSIGZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     /*      Otherwise we are in the read access case.                       */
     /* -------------------------------------------------------------------- */
 
+    {
+        VSIVirtualHandleUniquePtr poVirtualHandle(
+            poFSHandler->Open(pszFilename + strlen("/vsigzip/"), "rb"));
+        if (poVirtualHandle)
+        {
+#ifdef HAVE_LIBDEFLATE
+            auto poMemHandle = VSIInflateGZipInMemory(poVirtualHandle.get());
+            if (poMemHandle)
+                return poMemHandle;
+#endif
+            auto poBGZFHandle = VSICreateBGZFHandle(poVirtualHandle);
+            if (poBGZFHandle)
+                return poBGZFHandle;
+        }
+    }
+
     VSIGZipHandle *poGZIPHandle = OpenGZipReadOnly(pszFilename, pszAccess);
     if (poGZIPHandle)
         // Wrap the VSIGZipHandle inside a buffered reader that will
@@ -3169,6 +4031,26 @@ int VSIGZipFilesystemHandler::Stat(const char *pszFilename,
             }
         }
 
+        // A BGZF file can be indexed cheaply from its block headers.
+        {
+            VSIFilesystemHandler *poFSHandler =
+                VSIFileManager::GetHandler(pszFilename + strlen("/vsigzip/"));
+            VSIVirtualHandleUniquePtr poBaseHandle(
+                poFSHandler->Open(pszFilename + strlen("/vsigzip/"), "rb"));
+            if (poBaseHandle)
+            {
+                VSIVirtualHandleUniquePtr poBGZFHandle(
+                    VSICreateBGZFHandle(poBaseHandle));
+                if (poBGZFHandle)
+                {
+                    if (poBGZFHandle->Seek(0, SEEK_END) != 0)
+                        return -1;
+                    pStatBuf->st_size = poBGZFHandle->Tell();
+                    return ret;
+                }
+            }
+        }
+
         // No, then seek at the end of the data (slow).
         VSIGZipHandle *poHandle =
             VSIGZipFilesystemHandler::OpenGZipReadOnly(pszFilename, "rb");
@@ -3667,6 +4549,16 @@ VSIZipFilesystemHandler::CreateReader(const char *pszZipFileName)
 
 class VSISOZipHandle final : public VSIVirtualHandle
 {
+    struct ChunkJob
+    {
+        GByte *pabyIn = nullptr;
+        size_t nInSize = 0;
+        GByte *pabyOut = nullptr;
+        size_t nOutSize = 0;
+        VSISOZipHandle *poHandle = nullptr;  // non null for shared decompressor
+        bool bOK = false;
+    };
+
     VSIVirtualHandle *poBaseHandle_;
     vsi_l_offset nPosCompressedStream_;
     uint64_t compressed_size_;
@@ -3683,9 +4575,38 @@ class VSISOZipHandle final : public VSIVirtualHandle
     z_stream sStream_{};
 #endif
 
+    const int nThreads_;
+    std::unique_ptr<CPLWorkerThreadPool> poPool_{};
+
+    // Chunks decompressed ahead of the reader on sequential reads, when
+    // several threads are allowed.
+    std::vector<GByte> abyReadAhead_{};
+    uint64_t nReadAheadFirstChunk_ = 0;
+    size_t nReadAheadChunkCount_ = 0;
+    size_t nReadAheadWindow_ = 0;
+    uint64_t nNextSequentialChunk_ = 0;
+
     VSISOZipHandle(const VSISOZipHandle &) = delete;
     VSISOZipHandle &operator=(const VSISOZipHandle &) = delete;
 
+    uint64_t GetChunkCount() const
+    {
+        return uncompressed_size_ == 0
+                   ? 0
+                   : 1 + (uncompressed_size_ - 1) / nChunkSize_;
+    }
+
+    size_t GetChunkUncompressedSize(uint64_t nChunkIdx) const
+    {
+        return static_cast<size_t>(
+            std::min<uint64_t>(nChunkSize_, uncompressed_size_ -
+                                                nChunkIdx * nChunkSize_));
+    }
+
+    bool DecodeChunks(const std::vector<uint64_t> &anChunks,
+                      const std::vector<GByte *> &apabyOut);
+    static void DecodeChunkJob(void *pData);
+
   public:
     VSISOZipHandle(VSIVirtualHandle *poVirtualHandle,
                    vsi_l_offset nPosCompressedStream, uint64_t compressed_size,
@@ -3702,6 +4623,10 @@ class VSISOZipHandle final : public VSIVirtualHandle
 
     virtual size_t Read(void *pBuffer, size_t nSize, size_t nCount) override;
 
+    virtual int ReadMultiRange(int nRanges, void **ppData,
+                               const vsi_l_offset *panOffsets,
+                               const size_t *panSizes) override;
+
     virtual size_t Write(const void *, size_t, size_t) override
     {
         return 0;
@@ -3733,7 +4658,8 @@ VSISOZipHandle::VSISOZipHandle(VSIVirtualHandle *poVirtualHandle,
     : poBaseHandle_(poVirtualHandle),
       nPosCompressedStream_(nPosCompressedStream),
       compressed_size_(compressed_size), uncompressed_size_(uncompressed_size),
-      indexPos_(indexPos), nToSkip_(nToSkip), nChunkSize_(nChunkSize)
+      indexPos_(indexPos), nToSkip_(nToSkip), nChunkSize_(nChunkSize),
+      nThreads_(VSIGetDecompressionThreadCount())
 {
 #ifdef HAVE_LIBDEFLATE
     pDecompressor_ = libdeflate_alloc_decompressor();
@@ -3791,6 +4717,215 @@ int VSISOZipHandle::Seek(vsi_l_offset nOffset, int nWhence)
     return 0;
 }
 
+/************************************************************************/
+/*                          DecodeChunkJob()                            */
+/************************************************************************/
+
+void VSISOZipHandle::DecodeChunkJob(void *pData)
+{
+    ChunkJob *psJob = static_cast<ChunkJob *>(pData);
+    const size_t nCompressedToRead = psJob->nInSize;
+    GByte *pabyCompressedData = psJob->pabyIn;
+    if (nCompressedToRead >= 5 &&
+        pabyCompressedData[nCompressedToRead - 5] == 0x00 &&
+        memcmp(&pabyCompressedData[nCompressedToRead - 4], "\x00\x00\xFF\xFF",
+               4) == 0)
+    {
+        // Tag this flush block as the last one.
+        pabyCompressedData[nCompressedToRead - 5] = 0x01;
+    }
+
+#ifdef HAVE_LIBDEFLATE
+    struct libdeflate_decompressor *pDecompressor =
+        psJob->poHandle ? psJob->poHandle->pDecompressor_
+                        : libdeflate_alloc_decompressor();
+    if (!pDecompressor)
+        return;
+    size_t nOut = 0;
+    psJob->bOK = libdeflate_deflate_decompress(
+                     pDecompressor, pabyCompressedData, nCompressedToRead,
+                     psJob->pabyOut, psJob->nOutSize,
+                     &nOut) == LIBDEFLATE_SUCCESS &&
+                 nOut == psJob->nOutSize;
+    if (!psJob->poHandle)
+        libdeflate_free_decompressor(pDecompressor);
+#else
+    z_stream sLocalStream;
+    z_stream *psStream;
+    if (psJob->poHandle)
+    {
+        psStream = &psJob->poHandle->sStream_;
+    }
+    else
+    {
+        memset(&sLocalStream, 0, sizeof(sLocalStream));
+        if (inflateInit2(&sLocalStream, -MAX_WBITS) != Z_OK)
+            return;
+        psStream = &sLocalStream;
+    }
+    psStream->avail_in = static_cast<uInt>(nCompressedToRead);
+    psStream->next_in = pabyCompressedData;
+    psStream->avail_out = static_cast<uInt>(psJob->nOutSize);
+    psStream->next_out = psJob->pabyOut;
+
+    const int err = inflate(psStream, Z_FINISH);
+    psJob->bOK =
+        (err == Z_OK || err == Z_STREAM_END) && psStream->avail_out == 0;
+    if (psStream->avail_in != 0)
+        CPLDebug("VSIZIP", "avail_in = %d", psStream->avail_in);
+    if (psJob->poHandle)
+        inflateReset(psStream);
+    else
+        inflateEnd(psStream);
+#endif
+}
+
+/************************************************************************/
+/*                           DecodeChunks()                             */
+/************************************************************************/
+
+// Decompress the chunks of (sorted and unique) indices anChunks into the
+// corresponding apabyOut[] buffers, whose size must be nChunkSize_ (or less
+// for the last chunk). Consecutive chunks are read from the base handle with
+// a single request, and decompressed concurrently when several threads are
+// allowed.
+bool VSISOZipHandle::DecodeChunks(const std::vector<uint64_t> &anChunks,
+                                  const std::vector<GByte *> &apabyOut)
+{
+    CPLAssert(anChunks.size() == apabyOut.size());
+    const uint64_t nChunkCount = GetChunkCount();
+
+    std::vector<std::vector<GByte>> aabyCompressed;
+    std::vector<ChunkJob> asJobs(anChunks.size());
+    for (size_t iFirst = 0; iFirst < anChunks.size();)
+    {
+        // Find the run of consecutive chunks starting at iFirst
+        size_t iLast = iFirst;
+        while (iLast + 1 < anChunks.size() &&
+               anChunks[iLast + 1] == anChunks[iLast] + 1)
+        {
+            ++iLast;
+        }
+        const uint64_t nFirstChunk = anChunks[iFirst];
+        const uint64_t nLastChunk = anChunks[iLast];
+        if (nLastChunk >= nChunkCount)
+            return false;
+
+        // Offsets in the compressed stream of chunks nFirstChunk to
+        // nLastChunk + 1. The index stores the offsets of chunks 1 to
+        // nChunkCount - 1.
+        std::vector<uint64_t> anOffsets;
+        anOffsets.reserve(static_cast<size_t>(nLastChunk - nFirstChunk + 2));
+        if (nFirstChunk == 0)
+            anOffsets.push_back(0);
+        const uint64_t nFirstIndexed = std::max<uint64_t>(1, nFirstChunk);
+        const uint64_t nLastIndexed =
+            std::min<uint64_t>(nChunkCount - 1, nLastChunk + 1);
+        if (nFirstIndexed <= nLastIndexed)
+        {
+            constexpr size_t nOffsetSize = 8;
+            const size_t nIndexed =
+                static_cast<size_t>(nLastIndexed - nFirstIndexed + 1);
+            const size_t nOldSize = anOffsets.size();
+            anOffsets.resize(nOldSize + nIndexed);
+            if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
+                                        (nFirstIndexed - 1) * nOffsetSize,
+                                    SEEK_SET) != 0 ||
+                poBaseHandle_->Read(&anOffsets[nOldSize], nOffsetSize,
+                                    nIndexed) != nIndexed)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot read nOffsetInCompressedStream");
+                return false;
+            }
+            for (size_t i = nOldSize; i < anOffsets.size(); ++i)
+            {
+                CPL_LSBPTR64(&anOffsets[i]);
+            }
+        }
+        if (nLastChunk + 1 == nChunkCount)
+            anOffsets.push_back(compressed_size_);
+
+        for (size_t i = 0; i + 1 < anOffsets.size(); ++i)
+        {
+            if (anOffsets[i + 1] <= anOffsets[i] ||
+                anOffsets[i + 1] - anOffsets[i] > 13 + 2 * nChunkSize_ ||
+                anOffsets[i + 1] > compressed_size_)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid values for nOffsetInCompressedStream "
+                         "(" CPL_FRMT_GUIB ") / "
+                         "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
+                         static_cast<GUIntBig>(anOffsets[i]),
+                         static_cast<GUIntBig>(anOffsets[i + 1]));
+                return false;
+            }
+        }
+
+        // Read the compressed data of the run at once
+        aabyCompressed.emplace_back();
+        auto &abyCompressed = aabyCompressed.back();
+        abyCompressed.resize(
+            static_cast<size_t>(anOffsets.back() - anOffsets.front()));
+        if (poBaseHandle_->Seek(nPosCompressedStream_ + anOffsets.front(),
+                                SEEK_SET) != 0 ||
+            poBaseHandle_->Read(abyCompressed.data(), abyCompressed.size(),
+                                1) != 1)
+        {
+            return false;
+        }
+
+        for (size_t i = iFirst; i <= iLast; ++i)
+        {
+            const size_t iInRun = i - iFirst;
+            asJobs[i].pabyIn =
+                abyCompressed.data() +
+                static_cast<size_t>(anOffsets[iInRun] - anOffsets.front());
+            asJobs[i].nInSize =
+                static_cast<size_t>(anOffsets[iInRun + 1] - anOffsets[iInRun]);
+            asJobs[i].pabyOut = apabyOut[i];
+            asJobs[i].nOutSize = GetChunkUncompressedSize(anChunks[i]);
+        }
+
+        iFirst = iLast + 1;
+    }
+
+    if (nThreads_ > 1 && asJobs.size() > 1 && !poPool_)
+    {
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (poPool->Setup(nThreads_, nullptr, nullptr, false))
+            poPool_ = std::move(poPool);
+    }
+    if (poPool_ && asJobs.size() > 1)
+    {
+        std::vector<void *> apJobs;
+        for (auto &sJob : asJobs)
+            apJobs.push_back(&sJob);
+        poPool_->SubmitJobs(DecodeChunkJob, apJobs);
+        poPool_->WaitCompletion();
+    }
+    else
+    {
+        for (auto &sJob : asJobs)
+        {
+            sJob.poHandle = this;
+            DecodeChunkJob(&sJob);
+        }
+    }
+
+    for (size_t i = 0; i < asJobs.size(); ++i)
+    {
+        if (!asJobs[i].bOK)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Decompression failed at pos " CPL_FRMT_GUIB,
+                     static_cast<GUIntBig>(anChunks[i] * nChunkSize_));
+            return false;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                              Read()                                  */
 /************************************************************************/
@@ -3827,152 +4962,144 @@ size_t VSISOZipHandle::Read(void *pBuffer, size_t nSize, size_t nCount)
         return 0;
     }
 
-    const auto ReadOffsetInCompressedStream =
-        [this](uint64_t nChunkIdx) -> uint64_t
+    GByte *pabyBuffer = static_cast<GByte *>(pBuffer);
+    const uint64_t nFirstChunk = nCurPos_ / nChunkSize_;
+    const size_t nChunks =
+        (nToRead + nChunkSize_ - 1) / nChunkSize_;
+
+    std::vector<uint64_t> anChunks;
+    std::vector<GByte *> apabyOut;
+    for (size_t i = 0; i < nChunks; ++i)
     {
-        if (nChunkIdx == 0)
-            return 0;
-        if (nChunkIdx == 1 + (uncompressed_size_ - 1) / nChunkSize_)
-            return compressed_size_;
-        constexpr size_t nOffsetSize = 8;
-        if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
-                                    (nChunkIdx - 1) * nOffsetSize,
-                                SEEK_SET) != 0)
-            return static_cast<uint64_t>(-1);
-
-        uint64_t nOffset;
-        if (poBaseHandle_->Read(&nOffset, sizeof(nOffset), 1) != 1)
-            return static_cast<uint64_t>(-1);
-        CPL_LSBPTR64(&nOffset);
-        return nOffset;
-    };
+        const uint64_t nChunk = nFirstChunk + i;
+        GByte *pabyOut = pabyBuffer + i * nChunkSize_;
+        if (nChunk >= nReadAheadFirstChunk_ &&
+            nChunk < nReadAheadFirstChunk_ + nReadAheadChunkCount_)
+        {
+            memcpy(pabyOut,
+                   abyReadAhead_.data() +
+                       static_cast<size_t>(nChunk - nReadAheadFirstChunk_) *
+                           nChunkSize_,
+                   GetChunkUncompressedSize(nChunk));
+        }
+        else
+        {
+            anChunks.push_back(nChunk);
+            apabyOut.push_back(pabyOut);
+        }
+    }
 
-    size_t nOffsetInOutputBuffer = 0;
-    while (true)
+    if (!anChunks.empty())
     {
-        uint64_t nOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(nCurPos_ / nChunkSize_);
-        if (nOffsetInCompressedStream == static_cast<uint64_t>(-1))
+        // On sequential reads, decompress a growing number of following
+        // chunks in the same batch, so that all threads are busy.
+        const uint64_t nChunkCount = GetChunkCount();
+        const uint64_t nEndChunk = nFirstChunk + nChunks;
+        size_t nReadAhead = 0;
+        if (nThreads_ > 1 && nFirstChunk == nNextSequentialChunk_ &&
+            nEndChunk < nChunkCount)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nOffsetInCompressedStream");
-            return 0;
+            nReadAheadWindow_ = nReadAheadWindow_ == 0
+                                    ? static_cast<size_t>(nThreads_)
+                                    : std::min(2 * nReadAheadWindow_,
+                                               4 * static_cast<size_t>(
+                                                       nThreads_));
+            nReadAhead = static_cast<size_t>(std::min<uint64_t>(
+                nReadAheadWindow_, nChunkCount - nEndChunk));
         }
-        uint64_t nNextOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(1 + nCurPos_ / nChunkSize_);
-        if (nNextOffsetInCompressedStream == static_cast<uint64_t>(-1))
+        else
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nNextOffsetInCompressedStream");
-            return 0;
+            nReadAheadWindow_ = 0;
         }
 
-        if (nNextOffsetInCompressedStream <= nOffsetInCompressedStream ||
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream >
-                13 + 2 * nChunkSize_ ||
-            nNextOffsetInCompressedStream > compressed_size_)
+        if (nReadAhead > 0)
         {
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Invalid values for nOffsetInCompressedStream (" CPL_FRMT_GUIB
-                ") / "
-                "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
-                static_cast<GUIntBig>(nOffsetInCompressedStream),
-                static_cast<GUIntBig>(nNextOffsetInCompressedStream));
-            return 0;
+            abyReadAhead_.resize(nReadAhead * nChunkSize_);
+            nReadAheadFirstChunk_ = nEndChunk;
+            for (size_t i = 0; i < nReadAhead; ++i)
+            {
+                anChunks.push_back(nEndChunk + i);
+                apabyOut.push_back(abyReadAhead_.data() + i * nChunkSize_);
+            }
         }
+        nReadAheadChunkCount_ = 0;
 
-        // CPLDebug("VSIZIP", "Seek to compressed data at offset "
-        // CPL_FRMT_GUIB, static_cast<GUIntBig>(nPosCompressedStream_ +
-        // nOffsetInCompressedStream));
-        if (poBaseHandle_->Seek(
-                nPosCompressedStream_ + nOffsetInCompressedStream, SEEK_SET) !=
-            0)
+        if (!DecodeChunks(anChunks, apabyOut))
             return 0;
+        nReadAheadChunkCount_ = nReadAhead;
+    }
 
-        const int nCompressedToRead = static_cast<int>(
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream);
-        // CPLDebug("VSIZIP", "nCompressedToRead = %d", nCompressedToRead);
-        std::vector<GByte> abyCompressedData(nCompressedToRead);
-        if (poBaseHandle_->Read(&abyCompressedData[0], nCompressedToRead, 1) !=
-            1)
-            return 0;
+    nCurPos_ += nToRead;
+    nNextSequentialChunk_ = nFirstChunk + nChunks;
+    return nCount;
+}
 
-        size_t nToReadThisIter =
-            std::min(nToRead, static_cast<size_t>(nChunkSize_));
+/************************************************************************/
+/*                          ReadMultiRange()                            */
+/************************************************************************/
 
-        if (nCompressedToRead >= 5 &&
-            abyCompressedData[nCompressedToRead - 5] == 0x00 &&
-            memcmp(&abyCompressedData[nCompressedToRead - 4],
-                   "\x00\x00\xFF\xFF", 4) == 0)
+int VSISOZipHandle::ReadMultiRange(int nRanges, void **ppData,
+                                   const vsi_l_offset *panOffsets,
+                                   const size_t *panSizes)
+{
+    // Collect the chunks intersecting the ranges, so as to decode them in
+    // a single batch.
+    std::vector<uint64_t> anChunks;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i] == 0)
+            continue;
+        if (panOffsets[i] + panSizes[i] > uncompressed_size_)
+            return -1;
+        for (uint64_t nChunk = panOffsets[i] / nChunkSize_;
+             nChunk <= (panOffsets[i] + panSizes[i] - 1) / nChunkSize_;
+             ++nChunk)
         {
-            // Tag this flush block as the last one.
-            abyCompressedData[nCompressedToRead - 5] = 0x01;
+            anChunks.push_back(nChunk);
         }
+    }
+    std::sort(anChunks.begin(), anChunks.end());
+    anChunks.erase(std::unique(anChunks.begin(), anChunks.end()),
+                   anChunks.end());
 
-#ifdef HAVE_LIBDEFLATE
-        size_t nOut = 0;
-        if (libdeflate_deflate_decompress(
-                pDecompressor_, &abyCompressedData[0], nCompressedToRead,
-                static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer,
-                nToReadThisIter, &nOut) != LIBDEFLATE_SUCCESS)
-        {
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "libdeflate_deflate_decompress() failed at pos " CPL_FRMT_GUIB,
-                static_cast<GUIntBig>(nCurPos_));
-            return 0;
-        }
-        if (nOut != nToReadThisIter)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                     " whereas %u where expected",
-                     static_cast<unsigned>(nOut),
-                     static_cast<GUIntBig>(nCurPos_),
-                     static_cast<unsigned>(nToReadThisIter));
-            return 0;
-        }
-#else
-        sStream_.avail_in = nCompressedToRead;
-        sStream_.next_in = &abyCompressedData[0];
-        sStream_.avail_out = static_cast<int>(nToReadThisIter);
-        sStream_.next_out =
-            static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer;
-
-        int err = inflate(&sStream_, Z_FINISH);
-        if ((err != Z_OK && err != Z_STREAM_END))
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "inflate() failed at pos " CPL_FRMT_GUIB,
-                     static_cast<GUIntBig>(nCurPos_));
-            inflateReset(&sStream_);
-            return 0;
-        }
-        if (sStream_.avail_in != 0)
-            CPLDebug("VSIZIP", "avail_in = %d", sStream_.avail_in);
-        if (sStream_.avail_out != 0)
+    std::vector<GByte> abyUncompressed;
+    std::vector<GByte *> apabyOut;
+    try
+    {
+        abyUncompressed.resize(anChunks.size() * nChunkSize_);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in VSISOZipHandle::ReadMultiRange()");
+        return -1;
+    }
+    for (size_t i = 0; i < anChunks.size(); ++i)
+        apabyOut.push_back(abyUncompressed.data() + i * nChunkSize_);
+    if (!DecodeChunks(anChunks, apabyOut))
+        return -1;
+
+    for (int i = 0; i < nRanges; ++i)
+    {
+        vsi_l_offset nOffset = panOffsets[i];
+        size_t nOffsetInData = 0;
+        while (nOffsetInData < panSizes[i])
         {
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                " whereas %u where expected",
-                static_cast<unsigned>(nToReadThisIter - sStream_.avail_out),
-                static_cast<GUIntBig>(nCurPos_),
-                static_cast<unsigned>(nToReadThisIter));
-            inflateReset(&sStream_);
-            return 0;
+            const uint64_t nChunk = nOffset / nChunkSize_;
+            const size_t iChunk = static_cast<size_t>(
+                std::lower_bound(anChunks.begin(), anChunks.end(), nChunk) -
+                anChunks.begin());
+            const size_t nOffsetInChunk =
+                static_cast<size_t>(nOffset - nChunk * nChunkSize_);
+            const size_t nToCopy = std::min(panSizes[i] - nOffsetInData,
+                                            nChunkSize_ - nOffsetInChunk);
+            memcpy(static_cast<GByte *>(ppData[i]) + nOffsetInData,
+                   apabyOut[iChunk] + nOffsetInChunk, nToCopy);
+            nOffsetInData += nToCopy;
+            nOffset += nToCopy;
         }
-        inflateReset(&sStream_);
-#endif
-        nOffsetInOutputBuffer += nToReadThisIter;
-        nCurPos_ += nToReadThisIter;
-        nToRead -= nToReadThisIter;
-        if (nToRead == 0)
-            break;
     }
-
-    return nCount;
+    return 0;
 }
 
 /************************************************************************/
@@ -4287,6 +5414,17 @@ VSIVirtualHandle *VSIZipFilesystemHandler::Open(const char *pszFilename,
             return VSICreateCachedFile(poSOZIPHandle, info.nSOZIPChunkSize, 0);
         }
 
+#ifdef HAVE_LIBDEFLATE
+        if (info.nCompressionMethod == 8)
+        {
+            auto poMemHandle = VSIInflateDeflateInMemory(
+                info.poVirtualHandle.get(), info.nStartDataStream,
+                info.nCompressedSize, info.nUncompressedSize, info.nCRC);
+            if (poMemHandle)
+                return poMemHandle;
+        }
+#endif
+
         VSIGZipHandle *poGZIPHandle = new VSIGZipHandle(
             info.poVirtualHandle.release(), nullptr, info.nStartDataStream,
             info.nCompressedSize, info.nUncompressedSize, info.nCRC,
@@ -774,6 +774,17 @@ VSIS3WriteHandle::VSIS3WriteHandle(IVSIS3LikeFSHandler *poFS,
                      "Cannot allocate working buffer for %s",
                      m_poFS->GetFSPrefix().c_str());
         }
+
+        // Number of parts that may be uploaded concurrently. Each of them
+        // holds its own buffer, so memory use is bounded by
+        // (N + 1) * chunk size.
+        if (poFS->SupportsParallelMultipartUpload())
+        {
+            m_nMaxParallelParts = std::max(
+                1, std::min(64, atoi(VSIGetPathSpecificOption(
+                                    pszFilename,
+                                    "CPL_VSIL_CURL_UPLOAD_NUM_THREADS", "1"))));
+        }
     }
 }
 
@@ -822,6 +833,9 @@ VSIS3WriteHandle::~VSIS3WriteHandle()
     VSIS3WriteHandle::Close();
     delete m_poS3HandleHelper;
     CPLFree(m_pabyBuffer);
+    CPLFree(m_pabyFirstPart);
+    for (GByte *pabyBuffer : m_apabyFreeBuffers)
+        CPLFree(pabyBuffer);
     if (m_hCurlMulti)
     {
         if (m_hCurl)
@@ -840,6 +854,27 @@ VSIS3WriteHandle::~VSIS3WriteHandle()
 
 int VSIS3WriteHandle::Seek(vsi_l_offset nOffset, int nWhence)
 {
+    if (m_bWriteFirstPartLast)
+    {
+        // Whether the target can actually be read or written is checked
+        // by Read() and Write()
+        const vsi_l_offset nNewOffset =
+            nWhence == SEEK_SET   ? nOffset
+            : nWhence == SEEK_CUR ? m_nCurOffset + nOffset
+                                  : m_nFileSize + nOffset;
+        if (nNewOffset > m_nFileSize)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Seek beyond end of file not supported on writable %s "
+                     "files",
+                     m_poFS->GetFSPrefix().c_str());
+            m_bError = true;
+            return -1;
+        }
+        m_nCurOffset = nNewOffset;
+        return 0;
+    }
+
     if (!((nWhence == SEEK_SET && nOffset == m_nCurOffset) ||
           (nWhence == SEEK_CUR && nOffset == 0) ||
           (nWhence == SEEK_END && nOffset == 0)))
@@ -866,9 +901,35 @@ vsi_l_offset VSIS3WriteHandle::Tell()
 /*                               Read()                                 */
 /************************************************************************/
 
-size_t VSIS3WriteHandle::Read(void * /* pBuffer */, size_t /* nSize */,
-                              size_t /* nMemb */)
+size_t VSIS3WriteHandle::Read(void *pBuffer, size_t nSize, size_t nMemb)
 {
+    if (m_bWriteFirstPartLast && nSize > 0)
+    {
+        GByte *pabyDstBuffer = static_cast<GByte *>(pBuffer);
+        size_t nBytesToRead = nSize * nMemb;
+        while (nBytesToRead > 0 && m_nCurOffset < m_nFileSize)
+        {
+            size_t nAvailable = 0;
+            const GByte *pabySrc = GetInMemoryRange(m_nCurOffset, nAvailable);
+            if (pabySrc == nullptr)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "Cannot read at offset " CPL_FRMT_GUIB
+                         " of %s: data has already been uploaded",
+                         static_cast<GUIntBig>(m_nCurOffset),
+                         m_osFilename.c_str());
+                m_bError = true;
+                break;
+            }
+            const size_t nToRead = std::min(nAvailable, nBytesToRead);
+            memcpy(pabyDstBuffer, pabySrc, nToRead);
+            pabyDstBuffer += nToRead;
+            nBytesToRead -= nToRead;
+            m_nCurOffset += nToRead;
+        }
+        return (nSize * nMemb - nBytesToRead) / nSize;
+    }
+
     CPLError(CE_Failure, CPLE_NotSupported,
              "Read not supported on writable %s files",
              m_poFS->GetFSPrefix().c_str());
@@ -935,6 +996,7 @@ std::string IVSIS3LikeFSHandler::InitiateMultipartUpload(
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -1001,6 +1063,9 @@ bool VSIS3WriteHandle::UploadPart()
             knMAX_PART_NUMBER, m_osFilename.c_str());
         return false;
     }
+    if (m_nMaxParallelParts > 1)
+        return UploadPartAsync();
+
     const std::string osEtag = m_poFS->UploadPart(
         m_osFilename, m_nPartNumber, m_osUploadID,
         static_cast<vsi_l_offset>(m_nBufferSize) * (m_nPartNumber - 1),
@@ -1014,6 +1079,116 @@ bool VSIS3WriteHandle::UploadPart()
     return !osEtag.empty();
 }
 
+/************************************************************************/
+/*                          UploadPartAsync()                           */
+/************************************************************************/
+
+// Hands the current buffer over to a background thread that uploads it,
+// and continues filling a new buffer. When m_nMaxParallelParts uploads are
+// already in flight, waits for the oldest one first.
+bool VSIS3WriteHandle::UploadPartAsync()
+{
+    if (static_cast<int>(m_apoPendingParts.size()) >= m_nMaxParallelParts &&
+        !WaitForOldestPendingPart())
+    {
+        return false;
+    }
+
+    GByte *pabyNextBuffer = nullptr;
+    if (!m_apabyFreeBuffers.empty())
+    {
+        pabyNextBuffer = m_apabyFreeBuffers.back();
+        m_apabyFreeBuffers.pop_back();
+    }
+    else
+    {
+        pabyNextBuffer = static_cast<GByte *>(VSIMalloc(m_nBufferSize));
+        if (pabyNextBuffer == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate working buffer for %s",
+                     m_poFS->GetFSPrefix().c_str());
+            return false;
+        }
+    }
+
+    // The handle helper is modified when issuing a request, so each
+    // concurrent upload needs its own one.
+    std::unique_ptr<IVSIS3LikeHandleHelper> poHandleHelper(
+        m_poFS->CreateHandleHelper(
+            m_osFilename.c_str() + m_poFS->GetFSPrefix().size(), false));
+    if (!poHandleHelper)
+    {
+        m_apabyFreeBuffers.push_back(pabyNextBuffer);
+        return false;
+    }
+
+    auto poPart = std::make_unique<PendingPart>();
+    poPart->nPartNumber = m_nPartNumber;
+    poPart->pabyBuffer = m_pabyBuffer;
+    const size_t nPartSize = static_cast<size_t>(m_nBufferOff);
+    m_pabyBuffer = pabyNextBuffer;
+    m_nBufferOff = 0;
+
+    const auto task =
+        [this](PendingPart *psPart,
+               std::unique_ptr<IVSIS3LikeHandleHelper> poHandleHelperIn,
+               size_t nSize, CPLStringList aosTLConfigOptions)
+    {
+        CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+        // Errors are re-emitted by the thread that waits for the part
+        CPLInstallErrorHandlerAccumulator(psPart->aoErrors);
+        psPart->osEtag = m_poFS->UploadPart(
+            m_osFilename, psPart->nPartNumber, m_osUploadID,
+            static_cast<vsi_l_offset>(m_nBufferSize) *
+                (psPart->nPartNumber - 1),
+            psPart->pabyBuffer, nSize, poHandleHelperIn.get(), m_nMaxRetry,
+            m_dfRetryDelay, nullptr);
+        CPLUninstallErrorHandlerAccumulator();
+        poHandleHelperIn.reset();
+        CPLSetThreadLocalConfigOptions(nullptr);
+    };
+    poPart->oThread =
+        std::thread(task, poPart.get(), std::move(poHandleHelper), nPartSize,
+                    CPLStringList(CPLGetThreadLocalConfigOptions()));
+    m_apoPendingParts.push_back(std::move(poPart));
+    return true;
+}
+
+/************************************************************************/
+/*                      WaitForOldestPendingPart()                      */
+/************************************************************************/
+
+bool VSIS3WriteHandle::WaitForOldestPendingPart()
+{
+    auto poPart = std::move(m_apoPendingParts.front());
+    m_apoPendingParts.pop_front();
+    poPart->oThread.join();
+    for (const auto &oError : poPart->aoErrors)
+        CPLError(oError.type, oError.no, "%s", oError.msg.c_str());
+    m_apabyFreeBuffers.push_back(poPart->pabyBuffer);
+    if (poPart->osEtag.empty())
+        return false;
+    // Parts are waited for in increasing part number order
+    m_aosEtags.push_back(std::move(poPart->osEtag));
+    return true;
+}
+
+/************************************************************************/
+/*                        WaitForPendingParts()                         */
+/************************************************************************/
+
+bool VSIS3WriteHandle::WaitForPendingParts()
+{
+    bool bRet = true;
+    while (!m_apoPendingParts.empty())
+    {
+        if (!WaitForOldestPendingPart())
+            bRet = false;
+    }
+    return bRet;
+}
+
 std::string IVSIS3LikeFSHandler::UploadPart(
     const std::string &osFilename, int nPartNumber,
     const std::string &osUploadID, vsi_l_offset /* nPosition */,
@@ -1032,6 +1207,22 @@ std::string IVSIS3LikeFSHandler::UploadPart(
     const CPLStringList aosHTTPOptions(
         CPLHTTPGetOptionsFromEnv(osFilename.c_str()));
 
+    // Optional end-to-end integrity check of the part by the server
+    std::string osContentMD5;
+    if (CPLTestBool(VSIGetPathSpecificOption(
+            osFilename.c_str(), "CPL_VSIL_CURL_UPLOAD_CONTENT_MD5", "NO")))
+    {
+        struct CPLMD5Context context;
+        CPLMD5Init(&context);
+        CPLMD5Update(&context, pabyBuffer, nBufferSize);
+        unsigned char hash[16];
+        CPLMD5Final(hash, &context);
+        char *pszBase64 = CPLBase64Encode(16, hash);
+        osContentMD5 = "Content-MD5: ";
+        osContentMD5 += pszBase64;
+        CPLFree(pszBase64);
+    }
+
     do
     {
         bRetry = false;
@@ -1054,6 +1245,8 @@ std::string IVSIS3LikeFSHandler::UploadPart(
         struct curl_slist *headers = static_cast<struct curl_slist *>(
             CPLHTTPSetOptions(hCurlHandle, poS3HandleHelper->GetURL().c_str(),
                               aosHTTPOptions));
+        if (!osContentMD5.empty())
+            headers = curl_slist_append(headers, osContentMD5.c_str());
         headers = VSICurlMergeHeaders(
             headers, poS3HandleHelper->GetCurlHeaders("PUT", headers,
                                                       pabyBuffer, nBufferSize));
@@ -1082,6 +1275,7 @@ std::string IVSIS3LikeFSHandler::UploadPart(
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -1281,6 +1475,7 @@ size_t VSIS3WriteHandle::WriteChunked(const void *pBuffer, size_t nSize,
                                 CPLSleep(dfRetryDelay);
                                 dfRetryDelay = dfNewRetryDelay;
                                 nRetryCount++;
+                                NetworkStatisticsLogger::LogRetry();
                                 bRetry = true;
                             }
                             else if (sWriteFuncData.pBuffer != nullptr &&
@@ -1352,6 +1547,7 @@ size_t VSIS3WriteHandle::WriteChunked(const void *pBuffer, size_t nSize,
                     CPLSleep(dfRetryDelay);
                     dfRetryDelay = dfNewRetryDelay;
                     nRetryCount++;
+                    NetworkStatisticsLogger::LogRetry();
                     bRetry = true;
                 }
                 else if (sWriteFuncData.pBuffer != nullptr &&
@@ -1442,6 +1638,31 @@ size_t VSIS3WriteHandle::Write(const void *pBuffer, size_t nSize, size_t nMemb)
     }
 
     const GByte *pabySrcBuffer = reinterpret_cast<const GByte *>(pBuffer);
+
+    // Rewriting of data that has not been uploaded yet
+    while (nBytesToWrite > 0 && m_nCurOffset < m_nFileSize)
+    {
+        size_t nAvailable = 0;
+        GByte *pabyDst = GetInMemoryRange(m_nCurOffset, nAvailable);
+        if (pabyDst == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Cannot write at offset " CPL_FRMT_GUIB
+                     " of %s: data has already been uploaded. You may "
+                     "need to increase the %s_CHUNK_SIZE configuration "
+                     "option",
+                     static_cast<GUIntBig>(m_nCurOffset), m_osFilename.c_str(),
+                     (std::string("VSI") + m_poFS->GetDebugKey()).c_str());
+            m_bError = true;
+            return 0;
+        }
+        const size_t nToWrite = std::min(nAvailable, nBytesToWrite);
+        memcpy(pabyDst, pabySrcBuffer, nToWrite);
+        pabySrcBuffer += nToWrite;
+        nBytesToWrite -= nToWrite;
+        m_nCurOffset += nToWrite;
+    }
+
     while (nBytesToWrite > 0)
     {
         const int nToWriteInBuffer = static_cast<int>(std::min(
@@ -1450,6 +1671,7 @@ size_t VSIS3WriteHandle::Write(const void *pBuffer, size_t nSize, size_t nMemb)
         pabySrcBuffer += nToWriteInBuffer;
         m_nBufferOff += nToWriteInBuffer;
         m_nCurOffset += nToWriteInBuffer;
+        m_nFileSize = m_nCurOffset;
         nBytesToWrite -= nToWriteInBuffer;
         if (m_nBufferOff == m_nBufferSize)
         {
@@ -1463,6 +1685,23 @@ size_t VSIS3WriteHandle::Write(const void *pBuffer, size_t nSize, size_t nMemb)
                     m_bError = true;
                     return 0;
                 }
+                if (m_bWriteFirstPartLast)
+                {
+                    m_pabyFirstPart = m_pabyBuffer;
+                    m_pabyBuffer =
+                        static_cast<GByte *>(VSIMalloc(m_nBufferSize));
+                    if (m_pabyBuffer == nullptr)
+                    {
+                        CPLError(CE_Failure, CPLE_OutOfMemory,
+                                 "Cannot allocate working buffer for %s",
+                                 m_poFS->GetFSPrefix().c_str());
+                        m_bError = true;
+                        return 0;
+                    }
+                    ++m_nPartNumber;
+                    m_nBufferOff = 0;
+                    continue;
+                }
             }
             if (!UploadPart())
             {
@@ -1475,6 +1714,47 @@ size_t VSIS3WriteHandle::Write(const void *pBuffer, size_t nSize, size_t nMemb)
     return nMemb;
 }
 
+/************************************************************************/
+/*                      EnableWriteFirstPartLast()                      */
+/************************************************************************/
+
+// In that mode, the first part of the multipart upload is kept in memory
+// and uploaded when closing the file. This enables the file to be modified
+// and read back within its first VSIxx_CHUNK_SIZE bytes (and in the part
+// being currently filled), which is enough for formats that patch a header
+// once the data has been written, as GeoTIFF does with its tile index.
+bool VSIS3WriteHandle::EnableWriteFirstPartLast()
+{
+    if (m_bUseChunked || m_nFileSize != 0)
+        return false;
+    m_bWriteFirstPartLast = true;
+    return true;
+}
+
+/************************************************************************/
+/*                          GetInMemoryRange()                          */
+/************************************************************************/
+
+// Returns the memory holding the byte at nOffset, if it has not been
+// uploaded yet, and the number of contiguous bytes available from there.
+GByte *VSIS3WriteHandle::GetInMemoryRange(vsi_l_offset nOffset,
+                                          size_t &nAvailable)
+{
+    if (m_pabyFirstPart && nOffset < static_cast<vsi_l_offset>(m_nBufferSize))
+    {
+        nAvailable = static_cast<size_t>(m_nBufferSize - nOffset);
+        return m_pabyFirstPart + static_cast<size_t>(nOffset);
+    }
+    const vsi_l_offset nBufferStart = m_nFileSize - m_nBufferOff;
+    if (nOffset >= nBufferStart && nOffset < m_nFileSize)
+    {
+        nAvailable = static_cast<size_t>(m_nFileSize - nOffset);
+        return m_pabyBuffer + static_cast<size_t>(nOffset - nBufferStart);
+    }
+    nAvailable = 0;
+    return nullptr;
+}
+
 /************************************************************************/
 /*                                Eof()                                 */
 /************************************************************************/
@@ -1563,6 +1843,7 @@ bool VSIS3WriteHandle::DoSinglePartPUT()
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -1702,6 +1983,7 @@ bool IVSIS3LikeFSHandler::CompleteMultipart(
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -1787,6 +2069,7 @@ bool IVSIS3LikeFSHandler::AbortMultipart(
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -1924,6 +2207,7 @@ bool IVSIS3LikeFSHandler::AbortPendingUploads(const char *pszFilename)
                     CPLSleep(dfRetryDelay);
                     dfRetryDelay = dfNewRetryDelay;
                     nRetryCount++;
+                    NetworkStatisticsLogger::LogRetry();
                     bRetry = true;
                 }
                 else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -2046,21 +2330,40 @@ int VSIS3WriteHandle::Close()
         {
             if (m_bError)
             {
+                WaitForPendingParts();
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
                                             m_poS3HandleHelper, m_nMaxRetry,
                                             m_dfRetryDelay))
                     nRet = -1;
             }
-            else if (m_nBufferOff > 0 && !UploadPart())
-                nRet = -1;
-            else if (m_poFS->CompleteMultipart(
-                         m_osFilename, m_osUploadID, m_aosEtags, m_nCurOffset,
-                         m_poS3HandleHelper, m_nMaxRetry, m_dfRetryDelay))
+            else
             {
-                InvalidateParentDirectory();
+                bool bOK = m_nBufferOff == 0 || UploadPart();
+                if (!WaitForPendingParts())
+                    bOK = false;
+                if (bOK && m_pabyFirstPart)
+                {
+                    const std::string osEtag = m_poFS->UploadPart(
+                        m_osFilename, 1, m_osUploadID, 0, m_pabyFirstPart,
+                        m_nBufferSize, m_poS3HandleHelper, m_nMaxRetry,
+                        m_dfRetryDelay, nullptr);
+                    if (osEtag.empty())
+                        bOK = false;
+                    else
+                        m_aosEtags.insert(m_aosEtags.begin(), osEtag);
+                }
+                if (!bOK)
+                    nRet = -1;
+                else if (m_poFS->CompleteMultipart(
+                             m_osFilename, m_osUploadID, m_aosEtags,
+                             m_nFileSize, m_poS3HandleHelper, m_nMaxRetry,
+                             m_dfRetryDelay))
+                {
+                    InvalidateParentDirectory();
+                }
+                else
+                    nRet = -1;
             }
-            else
-                nRet = -1;
         }
     }
     return nRet;
@@ -2100,6 +2403,21 @@ VSIVirtualHandle *VSICurlFilesystemHandlerBaseWritable::Open(
 
     if (strchr(pszAccess, '+'))
     {
+        if (!strchr(pszAccess, 'r') &&
+            CPLTestBool(VSIGetPathSpecificOption(
+                pszFilename, "CPL_VSIL_WRITE_FIRST_PART_LAST", "NO")))
+        {
+            auto poHandle = CreateWriteHandle(pszFilename, papszOptions);
+            if (!poHandle)
+                return nullptr;
+            auto poS3Handle = dynamic_cast<VSIS3WriteHandle *>(poHandle.get());
+            if (poS3Handle && poS3Handle->EnableWriteFirstPartLast())
+                return poHandle.release();
+            CPLDebug(GetDebugKey(),
+                     "CPL_VSIL_WRITE_FIRST_PART_LAST ignored for %s",
+                     pszFilename);
+        }
+
         if (!SupportsRandomWrite(pszFilename, true))
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -2536,6 +2854,7 @@ std::set<std::string> VSIS3FSHandler::DeleteObjects(const char *pszBucket,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -2667,6 +2986,7 @@ char **VSIS3FSHandler::GetFileMetadata(const char *pszFilename,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -2869,6 +3189,7 @@ bool VSIS3FSHandler::SetFileMetadata(const char *pszFilename,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -3377,6 +3698,7 @@ int IVSIS3LikeFSHandler::CopyObject(const char *oldpath, const char *newpath,
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -3486,6 +3808,7 @@ int IVSIS3LikeFSHandler::DeleteObject(const char *pszFilename)
                 CPLSleep(dfRetryDelay);
                 dfRetryDelay = dfNewRetryDelay;
                 nRetryCount++;
+                NetworkStatisticsLogger::LogRetry();
                 bRetry = true;
             }
             else if (requestHelper.sWriteFuncData.pBuffer != nullptr &&
@@ -646,6 +646,7 @@ char **VSISwiftFSHandler::GetFileList(const char *pszDirname, int nMaxFiles,
                     CPLSleep(dfRetryDelay);
                     dfRetryDelay = dfNewRetryDelay;
                     nRetryCount++;
+                    NetworkStatisticsLogger::LogRetry();
                     bRetry = true;
                     CPLFree(sWriteFuncData.pBuffer);
                     CPLFree(sWriteFuncHeaderData.pBuffer);
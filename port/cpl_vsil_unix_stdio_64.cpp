@@ -81,6 +81,18 @@
 #ifdef HAVE_PREAD_BSD
 #include <sys/uio.h>
 #endif
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+#ifdef ENABLE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if !defined(__NR_io_uring_setup) || !defined(__NR_io_uring_enter)
+#undef ENABLE_IO_URING
+#endif
+#endif
 
 #if defined(__MACH__) && defined(__APPLE__)
 #define HAS_CASE_INSENSITIVE_FILE_SYSTEM
@@ -89,8 +101,11 @@
 #include <limits.h>
 #endif
 
+#include <algorithm>
 #include <limits>
+#include <memory>
 #include <new>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -155,6 +170,274 @@ static_assert(sizeof(VSIStatBufL::st_size) == sizeof(vsi_l_offset),
               "add the -DBUILD_WITHOUT_64BIT_OFFSET define");
 #endif
 
+#ifdef ENABLE_IO_URING
+
+/************************************************************************/
+/* ==================================================================== */
+/*                             VSIIOURing                               */
+/* ==================================================================== */
+/************************************************************************/
+
+// Minimal io_uring submission/completion loop, issued through raw system
+// calls so that no dependency on liburing is needed. It is only used to
+// service ReadMultiRange() with a deep queue from a single thread.
+
+class VSIIOURing
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIIOURing)
+
+    int m_fd = -1;
+    unsigned m_nEntries = 0;
+
+    void *m_pSQRing = MAP_FAILED;
+    size_t m_nSQRingSize = 0;
+    void *m_pCQRing = MAP_FAILED;
+    size_t m_nCQRingSize = 0;
+    struct io_uring_sqe *m_pasSQEs = nullptr;
+    size_t m_nSQEsSize = 0;
+
+    unsigned *m_pnSQTail = nullptr;
+    unsigned m_nSQMask = 0;
+    unsigned *m_panSQArray = nullptr;
+    unsigned *m_pnCQHead = nullptr;
+    unsigned *m_pnCQTail = nullptr;
+    unsigned m_nCQMask = 0;
+    struct io_uring_cqe *m_pasCQEs = nullptr;
+
+    VSIIOURing() = default;
+
+    int Enter(unsigned nToSubmit, unsigned nMinComplete);
+
+  public:
+    ~VSIIOURing();
+
+    static std::unique_ptr<VSIIOURing> Create(unsigned nEntries);
+
+    bool ReadRanges(int fd, int nRanges, void **ppData,
+                    const vsi_l_offset *panOffsets, const size_t *panSizes);
+};
+
+/************************************************************************/
+/*                              Create()                                */
+/************************************************************************/
+
+std::unique_ptr<VSIIOURing> VSIIOURing::Create(unsigned nEntries)
+{
+    struct io_uring_params sParams;
+    memset(&sParams, 0, sizeof(sParams));
+    const int fd =
+        static_cast<int>(syscall(__NR_io_uring_setup, nEntries, &sParams));
+    if (fd < 0)
+    {
+        CPLDebug("VSI", "io_uring_setup() failed: %s", strerror(errno));
+        return nullptr;
+    }
+
+    auto poRing = std::unique_ptr<VSIIOURing>(new VSIIOURing());
+    poRing->m_fd = fd;
+    poRing->m_nEntries = sParams.sq_entries;
+
+    poRing->m_nSQRingSize =
+        sParams.sq_off.array + sParams.sq_entries * sizeof(unsigned);
+    poRing->m_nCQRingSize =
+        sParams.cq_off.cqes + sParams.cq_entries * sizeof(io_uring_cqe);
+    const bool bSingleMMap = (sParams.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (bSingleMMap)
+    {
+        poRing->m_nSQRingSize =
+            std::max(poRing->m_nSQRingSize, poRing->m_nCQRingSize);
+        poRing->m_nCQRingSize = 0;
+    }
+
+    poRing->m_pSQRing =
+        mmap(nullptr, poRing->m_nSQRingSize, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (poRing->m_pSQRing == MAP_FAILED)
+        return nullptr;
+    void *pCQRing = poRing->m_pSQRing;
+    if (!bSingleMMap)
+    {
+        poRing->m_pCQRing =
+            mmap(nullptr, poRing->m_nCQRingSize, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (poRing->m_pCQRing == MAP_FAILED)
+            return nullptr;
+        pCQRing = poRing->m_pCQRing;
+    }
+
+    poRing->m_nSQEsSize = sParams.sq_entries * sizeof(io_uring_sqe);
+    void *pSQEs = mmap(nullptr, poRing->m_nSQEsSize, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (pSQEs == MAP_FAILED)
+        return nullptr;
+    poRing->m_pasSQEs = static_cast<struct io_uring_sqe *>(pSQEs);
+
+    GByte *pabySQ = static_cast<GByte *>(poRing->m_pSQRing);
+    poRing->m_pnSQTail =
+        reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.tail);
+    poRing->m_nSQMask =
+        *reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.ring_mask);
+    poRing->m_panSQArray =
+        reinterpret_cast<unsigned *>(pabySQ + sParams.sq_off.array);
+
+    GByte *pabyCQ = static_cast<GByte *>(pCQRing);
+    poRing->m_pnCQHead =
+        reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.head);
+    poRing->m_pnCQTail =
+        reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.tail);
+    poRing->m_nCQMask =
+        *reinterpret_cast<unsigned *>(pabyCQ + sParams.cq_off.ring_mask);
+    poRing->m_pasCQEs =
+        reinterpret_cast<struct io_uring_cqe *>(pabyCQ + sParams.cq_off.cqes);
+
+    return poRing;
+}
+
+/************************************************************************/
+/*                            ~VSIIOURing()                             */
+/************************************************************************/
+
+VSIIOURing::~VSIIOURing()
+{
+    if (m_pasSQEs)
+        munmap(m_pasSQEs, m_nSQEsSize);
+    if (m_pCQRing != MAP_FAILED)
+        munmap(m_pCQRing, m_nCQRingSize);
+    if (m_pSQRing != MAP_FAILED)
+        munmap(m_pSQRing, m_nSQRingSize);
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+/************************************************************************/
+/*                               Enter()                                */
+/************************************************************************/
+
+int VSIIOURing::Enter(unsigned nToSubmit, unsigned nMinComplete)
+{
+    while (true)
+    {
+        const int nRet = static_cast<int>(
+            syscall(__NR_io_uring_enter, m_fd, nToSubmit, nMinComplete,
+                    nMinComplete ? IORING_ENTER_GETEVENTS : 0, nullptr, 0));
+        if (nRet >= 0 || errno != EINTR)
+            return nRet;
+    }
+}
+
+/************************************************************************/
+/*                             ReadRanges()                             */
+/************************************************************************/
+
+// Returns true if all ranges could be fully read. Ranges whose request
+// completed with an error or a short count are (re)read with pread(), so
+// that kernels lacking support for some operation still give correct
+// results.
+bool VSIIOURing::ReadRanges(int fd, int nRanges, void **ppData,
+                            const vsi_l_offset *panOffsets,
+                            const size_t *panSizes)
+{
+    std::vector<struct iovec> asIOVecs(nRanges);
+    bool bOK = true;
+    int iNext = 0;
+    unsigned nQueued = 0;
+    unsigned nInFlight = 0;
+
+    const auto CompleteWithPRead = [&](int iRange, size_t nAlreadyRead)
+    {
+        GByte *pabyData = static_cast<GByte *>(ppData[iRange]);
+        while (nAlreadyRead < panSizes[iRange])
+        {
+            const ssize_t nRead =
+                pread(fd, pabyData + nAlreadyRead,
+                      panSizes[iRange] - nAlreadyRead,
+                      static_cast<off_t>(panOffsets[iRange] + nAlreadyRead));
+            if (nRead < 0 && errno == EINTR)
+                continue;
+            if (nRead <= 0)
+                return false;
+            nAlreadyRead += static_cast<size_t>(nRead);
+        }
+        return true;
+    };
+
+    while (iNext < nRanges || nQueued > 0 || nInFlight > 0)
+    {
+        // Fill the submission queue up to the ring capacity, which
+        // guarantees that the completion queue cannot overflow.
+        while (iNext < nRanges && nQueued + nInFlight < m_nEntries)
+        {
+            if (panSizes[iNext] == 0)
+            {
+                ++iNext;
+                continue;
+            }
+            asIOVecs[iNext].iov_base = ppData[iNext];
+            asIOVecs[iNext].iov_len = panSizes[iNext];
+
+            const unsigned nTail = *m_pnSQTail;
+            const unsigned nIdx = nTail & m_nSQMask;
+            struct io_uring_sqe *psSQE = &m_pasSQEs[nIdx];
+            memset(psSQE, 0, sizeof(*psSQE));
+            psSQE->opcode = IORING_OP_READV;
+            psSQE->fd = fd;
+            psSQE->off = panOffsets[iNext];
+            psSQE->addr = reinterpret_cast<uintptr_t>(&asIOVecs[iNext]);
+            psSQE->len = 1;
+            psSQE->user_data = static_cast<uint64_t>(iNext);
+            m_panSQArray[nIdx] = nIdx;
+            __atomic_store_n(m_pnSQTail, nTail + 1, __ATOMIC_RELEASE);
+            ++nQueued;
+            ++iNext;
+        }
+
+        const int nSubmitted = Enter(nQueued, 1);
+        if (nSubmitted < 0)
+        {
+            CPLDebug("VSI", "io_uring_enter() failed: %s", strerror(errno));
+            if (nInFlight == 0)
+            {
+                // Nothing can still write to the buffers: withdraw the
+                // queued requests and finish synchronously.
+                *m_pnSQTail -= nQueued;
+                for (int i = iNext - static_cast<int>(nQueued); i < nRanges;
+                     ++i)
+                {
+                    if (!CompleteWithPRead(i, 0))
+                        bOK = false;
+                }
+                return bOK;
+            }
+        }
+        else
+        {
+            nQueued -= static_cast<unsigned>(nSubmitted);
+            nInFlight += static_cast<unsigned>(nSubmitted);
+        }
+
+        unsigned nHead = *m_pnCQHead;
+        const unsigned nCQTail = __atomic_load_n(m_pnCQTail, __ATOMIC_ACQUIRE);
+        while (nHead != nCQTail)
+        {
+            const struct io_uring_cqe *psCQE = &m_pasCQEs[nHead & m_nCQMask];
+            const int iRange = static_cast<int>(psCQE->user_data);
+            const int nRes = psCQE->res;
+            if (!CompleteWithPRead(iRange,
+                                   nRes > 0 ? static_cast<size_t>(nRes) : 0))
+            {
+                bOK = false;
+            }
+            ++nHead;
+            --nInFlight;
+        }
+        __atomic_store_n(m_pnCQHead, nHead, __ATOMIC_RELEASE);
+    }
+
+    return bOK;
+}
+
+#endif  // ENABLE_IO_URING
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
@@ -188,6 +471,7 @@ class VSIUnixStdioFilesystemHandler final : public VSIFilesystemHandler
     char **ReadDirEx(const char *pszDirname, int nMaxFiles) override;
     GIntBig GetDiskFreeSpace(const char *pszDirname) override;
     int SupportsSparseFiles(const char *pszPath) override;
+    int HasOptimizedReadMultiRange(const char *pszPath) override;
 
     bool IsLocal(const char *pszPath) override;
     bool SupportsSequentialWrite(const char *pszPath,
@@ -232,6 +516,18 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
 #ifdef VSI_COUNT_BYTES_READ
     vsi_l_offset nTotalBytesRead = 0;
     VSIUnixStdioFilesystemHandler *poFS = nullptr;
+#endif
+#ifdef HAVE_MMAP
+    // Read-only mapping of the whole file, backing AcquireView()
+    bool m_bCanMap = false;
+    GByte *m_pabyMapping = nullptr;
+    size_t m_nMappingSize = 0;
+    int m_nViewCount = 0;
+#endif
+#ifdef ENABLE_IO_URING
+    // Created on first use by ReadMultiRange() on read-only handles
+    bool m_bCanUseIOURing = false;
+    std::unique_ptr<VSIIOURing> m_poIOURing{};
 #endif
   public:
     VSIUnixStdioHandle(VSIUnixStdioFilesystemHandler *poFSIn, FILE *fpIn,
@@ -258,6 +554,17 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
 #endif
+#ifdef HAVE_MMAP
+    const void *AcquireView(vsi_l_offset nOffset, size_t nSize) override;
+    void ReleaseView(const void *pView, size_t nSize) override;
+#endif
+#ifdef ENABLE_IO_URING
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override;
+#endif
 };
 
 /************************************************************************/
@@ -277,6 +584,16 @@ VSIUnixStdioHandle::VSIUnixStdioHandle(
       poFS(poFSIn)
 #endif
 {
+#ifdef HAVE_MMAP
+    // Mapping whole files is only reasonable with a 64-bit address space
+    m_bCanMap = bReadOnly && sizeof(void *) == 8 &&
+                CPLTestBool(CPLGetConfigOption("CPL_VSIL_MMAP_VIEW", "YES"));
+#endif
+#ifdef ENABLE_IO_URING
+    m_bCanUseIOURing =
+        bReadOnly &&
+        CPLTestBool(CPLGetConfigOption("CPL_VSIL_USE_IO_URING", "NO"));
+#endif
 }
 
 /************************************************************************/
@@ -295,6 +612,20 @@ int VSIUnixStdioHandle::Close()
     poFS->AddToTotal(nTotalBytesRead);
 #endif
 
+#ifdef HAVE_MMAP
+    if (m_pabyMapping)
+    {
+        CPLAssert(m_nViewCount == 0);
+        munmap(m_pabyMapping, m_nMappingSize);
+        m_pabyMapping = nullptr;
+        m_nMappingSize = 0;
+    }
+#endif
+
+#ifdef ENABLE_IO_URING
+    m_poIOURing.reset();
+#endif
+
     int ret = fclose(fp);
     fp = nullptr;
     return ret;
@@ -665,6 +996,121 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
 }
 #endif
 
+#ifdef HAVE_MMAP
+
+/************************************************************************/
+/*                            AcquireView()                             */
+/************************************************************************/
+
+const void *VSIUnixStdioHandle::AcquireView(vsi_l_offset nOffset,
+                                            size_t nSize)
+{
+    if (!m_bCanMap || nOffset > std::numeric_limits<size_t>::max() - nSize)
+        return nullptr;
+
+    if (nOffset + nSize > m_nMappingSize)
+    {
+        // The file might have grown since it was mapped. The mapping
+        // cannot be replaced while views on it are still in use.
+        struct stat sStat;
+        if (m_nViewCount > 0 || fstat(fileno(fp), &sStat) != 0 ||
+            static_cast<vsi_l_offset>(sStat.st_size) < nOffset + nSize ||
+            static_cast<vsi_l_offset>(sStat.st_size) >
+                std::numeric_limits<size_t>::max())
+        {
+            return nullptr;
+        }
+
+        if (m_pabyMapping)
+            munmap(m_pabyMapping, m_nMappingSize);
+        m_nMappingSize = static_cast<size_t>(sStat.st_size);
+        void *pMapping =
+            mmap(nullptr, m_nMappingSize, PROT_READ, MAP_SHARED, fileno(fp), 0);
+        if (pMapping == MAP_FAILED)
+        {
+            CPLDebug("VSI", "mmap() failed: %s", strerror(errno));
+            m_pabyMapping = nullptr;
+            m_nMappingSize = 0;
+            m_bCanMap = false;
+            return nullptr;
+        }
+        m_pabyMapping = static_cast<GByte *>(pMapping);
+    }
+
+    ++m_nViewCount;
+    return m_pabyMapping + static_cast<size_t>(nOffset);
+}
+
+/************************************************************************/
+/*                            ReleaseView()                             */
+/************************************************************************/
+
+void VSIUnixStdioHandle::ReleaseView(const void *pView, size_t /* nSize */)
+{
+    if (pView)
+    {
+        CPLAssert(m_nViewCount > 0);
+        --m_nViewCount;
+    }
+}
+
+#endif  // HAVE_MMAP
+
+#ifdef ENABLE_IO_URING
+
+/************************************************************************/
+/*                          ReadMultiRange()                            */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    if (m_bCanUseIOURing && nRanges > 1)
+    {
+        if (!m_poIOURing)
+        {
+            constexpr unsigned QUEUE_DEPTH = 128;
+            m_poIOURing = VSIIOURing::Create(QUEUE_DEPTH);
+            if (!m_poIOURing)
+                m_bCanUseIOURing = false;
+        }
+        if (m_poIOURing)
+        {
+            // The file position is left unchanged, as in the default
+            // implementation, but pending buffered writes do not matter
+            // since the handle is read-only.
+            return m_poIOURing->ReadRanges(fileno(fp), nRanges, ppData,
+                                           panOffsets, panSizes)
+                       ? 0
+                       : -1;
+        }
+    }
+    return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                            panSizes);
+}
+
+/************************************************************************/
+/*                            AdviseRead()                              */
+/************************************************************************/
+
+void VSIUnixStdioHandle::AdviseRead(int nRanges,
+                                    const vsi_l_offset *panOffsets,
+                                    const size_t *panSizes)
+{
+    // Let the kernel start populating the page cache, so that the PRead()
+    // calls subsequently issued by worker threads hit memory.
+    if (!m_bCanUseIOURing)
+        return;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        posix_fadvise(fileno(fp), static_cast<off_t>(panOffsets[i]),
+                      static_cast<off_t>(panSizes[i]), POSIX_FADV_WILLNEED);
+    }
+}
+
+#endif  // ENABLE_IO_URING
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
@@ -735,7 +1181,8 @@ VSIUnixStdioFilesystemHandler::Open(const char *pszFilename,
     /* -------------------------------------------------------------------- */
     if (bReadOnly && CPLTestBool(CPLGetConfigOption("VSI_CACHE", "FALSE")))
     {
-        return VSICreateCachedFile(poHandle);
+        return VSICreateCachedFile(poHandle, VSI_CACHED_DEFAULT_CHUNK_SIZE, 0,
+                                   pszFilename);
     }
 
     return poHandle;
@@ -942,6 +1389,20 @@ int VSIUnixStdioFilesystemHandler::SupportsSparseFiles(const char *
 #endif
 }
 
+/************************************************************************/
+/*                     HasOptimizedReadMultiRange()                     */
+/************************************************************************/
+
+int VSIUnixStdioFilesystemHandler::HasOptimizedReadMultiRange(
+    const char * /* pszPath */)
+{
+#ifdef ENABLE_IO_URING
+    return CPLTestBool(CPLGetConfigOption("CPL_VSIL_USE_IO_URING", "NO"));
+#else
+    return FALSE;
+#endif
+}
+
 /************************************************************************/
 /*                          IsLocal()                                   */
 /************************************************************************/
@@ -1153,6 +1153,7 @@ retry:
             CPLSleep(dfRetryDelay);
             dfRetryDelay = dfNewRetryDelay;
             nRetryCount++;
+            NetworkStatisticsLogger::LogRetry();
             CPLFree(sWriteFuncData.pBuffer);
             curl_easy_cleanup(hCurlHandle);
             goto retry;
@@ -29,20 +29,146 @@
 #include "cpl_port.h"
 #include "cpl_worker_thread_pool.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdlib>
+#include <iterator>
 #include <memory>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_vsi.h"
 
-struct CPLWorkerThreadJob
+static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
+static thread_local CPLWorkerThread *threadLocalCurrentWorkerThread = nullptr;
+
+/************************************************************************/
+/*                           Thread budget                              */
+/************************************************************************/
+
+// Process-wide limit, set with GDAL_MAX_ACTIVE_THREADS, of the number of
+// worker threads, of all pools, that are running a job at the same time.
+// A worker thread must hold a token to run a job. It gives it back while it
+// is blocked in one of the wait methods of a pool or job queue, so that the
+// jobs it waits for can run.
+
+namespace
 {
-    CPLThreadFunc pfnFunc;
-    void *pData;
+struct CPLThreadBudget
+{
+    std::mutex m_mutex{};
+    std::condition_variable m_cv{};
+    // 0 = unlimited. Only modified under m_mutex, but atomic so that it can
+    // be checked without locking
+    std::atomic<int> m_nMaxActiveThreads{0};
+    int m_nActiveThreads = 0;
 };
+}  // namespace
 
-static thread_local CPLWorkerThreadPool *threadLocalCurrentThreadPool = nullptr;
+static CPLThreadBudget &GetThreadBudget()
+{
+    static CPLThreadBudget oBudget;
+    return oBudget;
+}
+
+// Whether the current thread holds a token, that is it is a worker thread
+// running a job.
+static thread_local bool threadLocalHasToken = false;
+
+static void CPLThreadBudgetUpdateMax()
+{
+    // Called for each submitted job
+    static thread_local CPLCachedConfigOption oMaxActiveThreads(
+        "GDAL_MAX_ACTIVE_THREADS", nullptr);
+    const char *pszMax = oMaxActiveThreads.Get();
+    int nMax = 0;
+    if (pszMax && EQUAL(pszMax, "ALL_CPUS"))
+        nMax = CPLGetNumCPUs();
+    else if (pszMax)
+        nMax = std::max(0, atoi(pszMax));
+
+    // Only lock when the value changes
+    auto &oBudget = GetThreadBudget();
+    if (nMax != oBudget.m_nMaxActiveThreads.load())
+    {
+        std::lock_guard<std::mutex> oGuard(oBudget.m_mutex);
+        oBudget.m_nMaxActiveThreads = nMax;
+        oBudget.m_cv.notify_all();
+    }
+}
+
+static bool CPLThreadBudgetHasFreeToken()
+{
+    auto &oBudget = GetThreadBudget();
+    std::lock_guard<std::mutex> oGuard(oBudget.m_mutex);
+    return oBudget.m_nMaxActiveThreads == 0 ||
+           oBudget.m_nActiveThreads < oBudget.m_nMaxActiveThreads;
+}
+
+// If bForce is false, wait until a token is available.
+static void CPLThreadBudgetAcquireToken(bool bForce)
+{
+    auto &oBudget = GetThreadBudget();
+    std::unique_lock<std::mutex> oGuard(oBudget.m_mutex);
+    while (!bForce && oBudget.m_nMaxActiveThreads > 0 &&
+           oBudget.m_nActiveThreads >= oBudget.m_nMaxActiveThreads)
+    {
+        oBudget.m_cv.wait(oGuard);
+    }
+    oBudget.m_nActiveThreads++;
+    threadLocalHasToken = true;
+}
+
+static bool CPLThreadBudgetTryAcquireToken()
+{
+    auto &oBudget = GetThreadBudget();
+    std::lock_guard<std::mutex> oGuard(oBudget.m_mutex);
+    if (oBudget.m_nMaxActiveThreads > 0 &&
+        oBudget.m_nActiveThreads >= oBudget.m_nMaxActiveThreads)
+    {
+        return false;
+    }
+    oBudget.m_nActiveThreads++;
+    threadLocalHasToken = true;
+    return true;
+}
+
+static void CPLThreadBudgetReleaseToken()
+{
+    auto &oBudget = GetThreadBudget();
+    std::lock_guard<std::mutex> oGuard(oBudget.m_mutex);
+    oBudget.m_nActiveThreads--;
+    threadLocalHasToken = false;
+    oBudget.m_cv.notify_one();
+}
+
+namespace
+{
+// Gives back the token of the current thread, if any, during its lifetime.
+// The token is taken back without waiting, as the thread was already
+// counted before blocking.
+struct CPLThreadBudgetTokenLender
+{
+    const bool m_bHadToken;
+
+    CPLThreadBudgetTokenLender() : m_bHadToken(threadLocalHasToken)
+    {
+        if (m_bHadToken)
+            CPLThreadBudgetReleaseToken();
+    }
+
+    ~CPLThreadBudgetTokenLender()
+    {
+        if (m_bHadToken)
+            CPLThreadBudgetAcquireToken(/* bForce = */ true);
+    }
+
+    CPLThreadBudgetTokenLender(const CPLThreadBudgetTokenLender &) = delete;
+    CPLThreadBudgetTokenLender &
+    operator=(const CPLThreadBudgetTokenLender &) = delete;
+};
+}  // namespace
 
 /************************************************************************/
 /*                         CPLWorkerThreadPool()                        */
@@ -96,21 +222,20 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     CPLWorkerThreadPool *poTP = psWT->poTP;
 
     threadLocalCurrentThreadPool = poTP;
+    threadLocalCurrentWorkerThread = psWT;
 
     if (psWT->pfnInitFunc)
         psWT->pfnInitFunc(psWT->pInitData);
 
-    while (true)
+    CPLWorkerThreadJob sJob;
+    while (poTP->GetNextJob(psWT, sJob))
     {
-        CPLWorkerThreadJob *psJob = poTP->GetNextJob(psWT);
-        if (psJob == nullptr)
-            break;
-
-        if (psJob->pfnFunc)
+        CPLThreadBudgetAcquireToken(/* bForce = */ false);
+        if (sJob.pfnFunc)
         {
-            psJob->pfnFunc(psJob->pData);
+            sJob.pfnFunc(sJob.pData);
         }
-        CPLFree(psJob);
+        CPLThreadBudgetReleaseToken();
 #if DEBUG_VERBOSE
         CPLDebug("JOB", "%p finished a job", psWT);
 #endif
@@ -118,128 +243,157 @@ void CPLWorkerThreadPool::WorkerThreadFunction(void *user_data)
     }
 }
 
+/************************************************************************/
+/*                            StartThread()                             */
+/************************************************************************/
+
+// Must be called with m_mutex held.
+bool CPLWorkerThreadPool::StartThread(CPLThreadFunc pfnInitFunc,
+                                      void *pInitData)
+{
+    std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
+    wt->pfnInitFunc = pfnInitFunc;
+    wt->pInitData = pInitData;
+    wt->poTP = this;
+    wt->bMarkedAsWaiting = false;
+    // The thread will look for a job as soon as it is started
+    wt->bWokenUp = true;
+    wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
+    if (wt->hThread == nullptr)
+        return false;
+    m_nWakingWorkerThreads++;
+    aWT.emplace_back(std::move(wt));
+    return true;
+}
+
+/************************************************************************/
+/*                     WakeUpWaitingWorkerThread()                      */
+/************************************************************************/
+
+// Must be called with oGuard locking m_mutex. oGuard is unlocked on return.
+void CPLWorkerThreadPool::WakeUpWaitingWorkerThread(
+    std::unique_lock<std::mutex> &oGuard)
+{
+    if (psWaitingWorkerThreadsList == nullptr)
+    {
+        oGuard.unlock();
+        return;
+    }
+
+    CPLWorkerThread *psWorkerThread =
+        static_cast<CPLWorkerThread *>(psWaitingWorkerThreadsList->pData);
+
+    CPLAssert(psWorkerThread->bMarkedAsWaiting);
+    psWorkerThread->bMarkedAsWaiting = false;
+    psWorkerThread->bWokenUp = true;
+    m_nWakingWorkerThreads++;
+
+    CPLList *psNext = psWaitingWorkerThreadsList->psNext;
+    CPLList *psToFree = psWaitingWorkerThreadsList;
+    psWaitingWorkerThreadsList = psNext;
+    nWaitingWorkerThreads--;
+
+    // CPLAssert(
+    //   CPLListCount(psWaitingWorkerThreadsList) == nWaitingWorkerThreads);
+
+#if DEBUG_VERBOSE
+    CPLDebug("JOB", "Waking up %p", psWorkerThread);
+#endif
+
+    {
+        std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
+        oGuard.unlock();
+        psWorkerThread->m_cv.notify_one();
+    }
+
+    CPLFree(psToFree);
+}
+
 /************************************************************************/
 /*                             SubmitJob()                              */
 /************************************************************************/
 
 /** Queue a new job.
+ *
+ * When called from a worker thread of this pool, the job is queued in the
+ * deque of that thread, from which idle threads steal it. If there is no idle
+ * thread, it is run synchronously.
  *
  * @param pfnFunc Function to run for the job.
  * @param pData User data to pass to the job function.
  * @return true in case of success.
  */
 bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
+{
+    return SubmitJob(pfnFunc, pData, nullptr);
+}
+
+bool CPLWorkerThreadPool::SubmitJob(CPLThreadFunc pfnFunc, void *pData,
+                                    CPLJobQueue *poQueue)
 {
     CPLAssert(m_nMaxThreads > 0);
 
-    bool bMustIncrementWaitingWorkerThreadsAfterSubmission = false;
+    CPLThreadBudgetUpdateMax();
+
+    // A job submitted from a worker thread, of this or another pool, while
+    // the thread budget is exhausted could never be started if the submitter
+    // waits for it, so run it synchronously.
+    if (threadLocalHasToken && !CPLThreadBudgetHasFreeToken())
+    {
+        pfnFunc(pData);
+        return true;
+    }
+
+    CPLWorkerThreadJob sJob;
+    sJob.pfnFunc = pfnFunc;
+    sJob.pData = pData;
+    sJob.poQueue = poQueue;
+
     if (threadLocalCurrentThreadPool == this)
     {
+        CPLWorkerThread *psWT = threadLocalCurrentWorkerThread;
+
         // If there are waiting threads or we have not started all allowed
         // threads, we can submit this job asynchronously
+        std::unique_lock<std::mutex> oGuard(m_mutex);
+        if (nWaitingWorkerThreads == 0 &&
+            (static_cast<int>(aWT.size()) >= m_nMaxThreads ||
+             !StartThread(nullptr, nullptr)))
         {
-            std::unique_lock<std::mutex> oGuard(m_mutex);
-            if (nWaitingWorkerThreads > 0 ||
-                static_cast<int>(aWT.size()) < m_nMaxThreads)
-            {
-                bMustIncrementWaitingWorkerThreadsAfterSubmission = true;
-                nWaitingWorkerThreads--;
-            }
-        }
-        if (!bMustIncrementWaitingWorkerThreadsAfterSubmission)
-        {
-            // otherwise there is a risk of deadlock, so execute synchronously.
+            oGuard.unlock();
+            // otherwise there is a risk of deadlock, so execute
+            // synchronously.
             pfnFunc(pData);
             return true;
         }
-    }
 
-    CPLWorkerThreadJob *psJob = static_cast<CPLWorkerThreadJob *>(
-        VSI_MALLOC_VERBOSE(sizeof(CPLWorkerThreadJob)));
-    if (psJob == nullptr)
-    {
-        if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
+        // The job is queued while m_mutex is held, so that a worker thread
+        // looking for a job under m_mutex sees it.
         {
-            std::unique_lock<std::mutex> oGuard(m_mutex);
-            nWaitingWorkerThreads++;
+            std::lock_guard<std::mutex> oGuardJobs(psWT->m_oJobsMutex);
+            psWT->m_aoJobs.push_back(sJob);
         }
-        return false;
-    }
-    psJob->pfnFunc = pfnFunc;
-    psJob->pData = pData;
+        nPendingJobs++;
+        m_nQueuedJobs++;
 
-    CPLList *psItem =
-        static_cast<CPLList *>(VSI_MALLOC_VERBOSE(sizeof(CPLList)));
-    if (psItem == nullptr)
-    {
-        VSIFree(psJob);
-        if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
-        {
-            std::unique_lock<std::mutex> oGuard(m_mutex);
-            nWaitingWorkerThreads++;
-        }
-        return false;
+        WakeUpWaitingWorkerThread(oGuard);
+        return true;
     }
-    psItem->pData = psJob;
 
     std::unique_lock<std::mutex> oGuard(m_mutex);
 
-    if (bMustIncrementWaitingWorkerThreadsAfterSubmission)
-        nWaitingWorkerThreads++;
-
     if (static_cast<int>(aWT.size()) < m_nMaxThreads)
     {
         // CPLDebug("CPL", "Starting new thread...");
-        std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-        wt->pfnInitFunc = nullptr;
-        wt->pInitData = nullptr;
-        wt->poTP = this;
-        wt->bMarkedAsWaiting = false;
-        wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-        if (wt->hThread == nullptr)
-        {
-            VSIFree(psJob);
-            VSIFree(psItem);
+        if (!StartThread(nullptr, nullptr))
             return false;
-        }
-        else
-        {
-            aWT.emplace_back(std::move(wt));
-        }
     }
 
-    psItem->psNext = psJobQueue;
-    psJobQueue = psItem;
+    m_aoJobs.push_back(sJob);
     nPendingJobs++;
+    m_nQueuedJobs++;
 
-    if (psWaitingWorkerThreadsList)
-    {
-        CPLWorkerThread *psWorkerThread =
-            static_cast<CPLWorkerThread *>(psWaitingWorkerThreadsList->pData);
-
-        CPLAssert(psWorkerThread->bMarkedAsWaiting);
-        psWorkerThread->bMarkedAsWaiting = false;
-
-        CPLList *psNext = psWaitingWorkerThreadsList->psNext;
-        CPLList *psToFree = psWaitingWorkerThreadsList;
-        psWaitingWorkerThreadsList = psNext;
-        nWaitingWorkerThreads--;
-
-        // CPLAssert(
-        //   CPLListCount(psWaitingWorkerThreadsList) == nWaitingWorkerThreads);
-
-#if DEBUG_VERBOSE
-        CPLDebug("JOB", "Waking up %p", psWorkerThread);
-#endif
-
-        {
-            std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
-            oGuard.unlock();
-            psWorkerThread->m_cv.notify_one();
-        }
-
-        CPLFree(psToFree);
-    }
+    WakeUpWaitingWorkerThread(oGuard);
 
     return true;
 }
@@ -259,7 +413,10 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
 {
     CPLAssert(m_nMaxThreads > 0);
 
-    if (threadLocalCurrentThreadPool == this)
+    CPLThreadBudgetUpdateMax();
+
+    if (threadLocalCurrentThreadPool == this ||
+        (threadLocalHasToken && !CPLThreadBudgetHasFreeToken()))
     {
         // If SubmitJob() is called from a worker thread of this queue,
         // then synchronously run the task to avoid deadlock.
@@ -272,106 +429,27 @@ bool CPLWorkerThreadPool::SubmitJobs(CPLThreadFunc pfnFunc,
 
     std::unique_lock<std::mutex> oGuard(m_mutex);
 
-    CPLList *psJobQueueInit = psJobQueue;
-    bool bRet = true;
-
     for (size_t i = 0; i < apData.size(); i++)
     {
         if (static_cast<int>(aWT.size()) < m_nMaxThreads)
         {
-            std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-            wt->pfnInitFunc = nullptr;
-            wt->pInitData = nullptr;
-            wt->poTP = this;
-            wt->bMarkedAsWaiting = false;
-            wt->hThread =
-                CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-            if (wt->hThread == nullptr)
-            {
-                if (aWT.empty())
-                    return false;
-            }
-            else
-            {
-                aWT.emplace_back(std::move(wt));
-            }
+            if (!StartThread(nullptr, nullptr) && aWT.empty())
+                return false;
         }
 
-        CPLWorkerThreadJob *psJob = static_cast<CPLWorkerThreadJob *>(
-            VSI_MALLOC_VERBOSE(sizeof(CPLWorkerThreadJob)));
-        if (psJob == nullptr)
-        {
-            bRet = false;
-            break;
-        }
-        psJob->pfnFunc = pfnFunc;
-        psJob->pData = apData[i];
-
-        CPLList *psItem =
-            static_cast<CPLList *>(VSI_MALLOC_VERBOSE(sizeof(CPLList)));
-        if (psItem == nullptr)
-        {
-            VSIFree(psJob);
-            bRet = false;
-            break;
-        }
-        psItem->pData = psJob;
-
-        psItem->psNext = psJobQueue;
-        psJobQueue = psItem;
+        CPLWorkerThreadJob sJob;
+        sJob.pfnFunc = pfnFunc;
+        sJob.pData = apData[i];
+        m_aoJobs.push_back(sJob);
         nPendingJobs++;
+        m_nQueuedJobs++;
     }
 
-    if (!bRet)
+    while (psWaitingWorkerThreadsList &&
+           m_nQueuedJobs > m_nWakingWorkerThreads)
     {
-        for (CPLList *psIter = psJobQueue; psIter != psJobQueueInit;)
-        {
-            CPLList *psNext = psIter->psNext;
-            VSIFree(psIter->pData);
-            VSIFree(psIter);
-            nPendingJobs--;
-            psIter = psNext;
-        }
-        return false;
-    }
-
-    for (size_t i = 0; i < apData.size(); i++)
-    {
-        if (psWaitingWorkerThreadsList && psJobQueue)
-        {
-            CPLWorkerThread *psWorkerThread;
-
-            psWorkerThread = static_cast<CPLWorkerThread *>(
-                psWaitingWorkerThreadsList->pData);
-
-            CPLAssert(psWorkerThread->bMarkedAsWaiting);
-            psWorkerThread->bMarkedAsWaiting = false;
-
-            CPLList *psNext = psWaitingWorkerThreadsList->psNext;
-            CPLList *psToFree = psWaitingWorkerThreadsList;
-            psWaitingWorkerThreadsList = psNext;
-            nWaitingWorkerThreads--;
-
-            // CPLAssert(
-            //    CPLListCount(psWaitingWorkerThreadsList) ==
-            //    nWaitingWorkerThreads);
-
-#if DEBUG_VERBOSE
-            CPLDebug("JOB", "Waking up %p", psWorkerThread);
-#endif
-            {
-                std::lock_guard<std::mutex> oGuardWT(psWorkerThread->m_mutex);
-                oGuard.unlock();
-                psWorkerThread->m_cv.notify_one();
-            }
-
-            CPLFree(psToFree);
-            oGuard.lock();
-        }
-        else
-        {
-            break;
-        }
+        WakeUpWaitingWorkerThread(oGuard);
+        oGuard.lock();
     }
 
     return true;
@@ -391,6 +469,7 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
 {
     if (nMaxRemainingJobs < 0)
         nMaxRemainingJobs = 0;
+    CPLThreadBudgetTokenLender oTokenLender;
     std::unique_lock<std::mutex> oGuard(m_mutex);
     while (nPendingJobs > nMaxRemainingJobs)
     {
@@ -406,6 +485,7 @@ void CPLWorkerThreadPool::WaitCompletion(int nMaxRemainingJobs)
  */
 void CPLWorkerThreadPool::WaitEvent()
 {
+    CPLThreadBudgetTokenLender oTokenLender;
     std::unique_lock<std::mutex> oGuard(m_mutex);
     while (true)
     {
@@ -467,19 +547,13 @@ bool CPLWorkerThreadPool::Setup(int nThreads, CPLThreadFunc pfnInitFunc,
     bool bRet = true;
     for (int i = static_cast<int>(aWT.size()); i < nThreads; i++)
     {
-        std::unique_ptr<CPLWorkerThread> wt(new CPLWorkerThread);
-        wt->pfnInitFunc = pfnInitFunc;
-        wt->pInitData = pasInitData ? pasInitData[i] : nullptr;
-        wt->poTP = this;
-        wt->bMarkedAsWaiting = false;
-        wt->hThread = CPLCreateJoinableThread(WorkerThreadFunction, wt.get());
-        if (wt->hThread == nullptr)
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        if (!StartThread(pfnInitFunc, pasInitData ? pasInitData[i] : nullptr))
         {
             nThreads = i;
             bRet = false;
             break;
         }
-        aWT.emplace_back(std::move(wt));
     }
 
     {
@@ -515,32 +589,94 @@ void CPLWorkerThreadPool::DeclareJobFinished()
     m_cv.notify_one();
 }
 
+/************************************************************************/
+/*                              TakeJob()                               */
+/************************************************************************/
+
+// Must be called with m_mutex held.
+// Takes the most recent job submitted from outside of the pool, or, failing
+// that, steals the oldest job of another worker thread than
+// psExcludedWorkerThread. If poQueue is not null, only jobs of that queue are
+// considered.
+bool CPLWorkerThreadPool::TakeJob(CPLWorkerThread *psExcludedWorkerThread,
+                                  CPLJobQueue *poQueue,
+                                  CPLWorkerThreadJob &sJob)
+{
+    for (auto iter = m_aoJobs.rbegin(); iter != m_aoJobs.rend(); ++iter)
+    {
+        if (poQueue == nullptr || iter->poQueue == poQueue)
+        {
+            sJob = *iter;
+            m_aoJobs.erase(std::next(iter).base());
+            m_nQueuedJobs--;
+            return true;
+        }
+    }
+
+    for (auto &wt : aWT)
+    {
+        if (wt.get() == psExcludedWorkerThread)
+            continue;
+        std::lock_guard<std::mutex> oGuard(wt->m_oJobsMutex);
+        auto &aoJobs = wt->m_aoJobs;
+        for (auto iter = aoJobs.begin(); iter != aoJobs.end(); ++iter)
+        {
+            if (poQueue == nullptr || iter->poQueue == poQueue)
+            {
+#if DEBUG_VERBOSE
+                CPLDebug("JOB", "Stealing a job from %p", wt.get());
+#endif
+                sJob = *iter;
+                aoJobs.erase(iter);
+                m_nQueuedJobs--;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 /************************************************************************/
 /*                             GetNextJob()                             */
 /************************************************************************/
 
-CPLWorkerThreadJob *
-CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
+bool CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread,
+                                     CPLWorkerThreadJob &sJob)
 {
     while (true)
     {
+        // Jobs submitted by this thread are run first, most recent first.
+        {
+            std::lock_guard<std::mutex> oGuard(psWorkerThread->m_oJobsMutex);
+            auto &aoJobs = psWorkerThread->m_aoJobs;
+            if (!aoJobs.empty())
+            {
+                sJob = aoJobs.back();
+                aoJobs.pop_back();
+                m_nQueuedJobs--;
+                return true;
+            }
+        }
+
         std::unique_lock<std::mutex> oGuard(m_mutex);
         if (eState == CPLWTS_STOP)
         {
-            return nullptr;
+            return false;
         }
-        CPLList *psTopJobIter = psJobQueue;
-        if (psTopJobIter)
-        {
-            psJobQueue = psTopJobIter->psNext;
 
+        const bool bGotJob = TakeJob(psWorkerThread, nullptr, sJob);
+        if (psWorkerThread->bWokenUp)
+        {
+            psWorkerThread->bWokenUp = false;
+            m_nWakingWorkerThreads--;
+        }
+        if (bGotJob)
+        {
 #if DEBUG_VERBOSE
             CPLDebug("JOB", "%p got a job", psWorkerThread);
 #endif
-            CPLWorkerThreadJob *psJob =
-                static_cast<CPLWorkerThreadJob *>(psTopJobIter->pData);
-            CPLFree(psTopJobIter);
-            return psJob;
+            return true;
         }
 
         if (!psWorkerThread->bMarkedAsWaiting)
@@ -555,7 +691,7 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
                 eState = CPLWTS_ERROR;
                 m_cv.notify_one();
 
-                return nullptr;
+                return false;
             }
 
             psItem->pData = psWorkerThread;
@@ -580,6 +716,66 @@ CPLWorkerThreadPool::GetNextJob(CPLWorkerThread *psWorkerThread)
     }
 }
 
+/************************************************************************/
+/*                           RunPendingJob()                            */
+/************************************************************************/
+
+// Runs in the calling thread a job of poQueue that has not been started yet.
+// Used by CPLJobQueue::RunPendingJobsAndWaitCompletion().
+// Returns 1 if a job has been run, 0 if there is no such job, and -1 if the
+// queued jobs are about to be picked up by worker threads that have just been
+// woken up.
+int CPLWorkerThreadPool::RunPendingJob(CPLJobQueue *poQueue)
+{
+    CPLWorkerThread *psWT = threadLocalCurrentThreadPool == this
+                                ? threadLocalCurrentWorkerThread
+                                : nullptr;
+    // A thread that is not a worker thread also needs a token to run a job
+    // on behalf of the pool.
+    if (!threadLocalHasToken)
+    {
+        if (!CPLThreadBudgetTryAcquireToken())
+            return 0;
+        const int nRet = RunPendingJob(poQueue);
+        CPLThreadBudgetReleaseToken();
+        return nRet;
+    }
+
+    CPLWorkerThreadJob sJob;
+    {
+        std::lock_guard<std::mutex> oGuard(m_mutex);
+        if (m_nQueuedJobs == 0)
+            return 0;
+        if (m_nQueuedJobs <= m_nWakingWorkerThreads)
+            return -1;
+
+        bool bGotJob = false;
+        if (psWT)
+        {
+            // Most recent job of this thread first
+            std::lock_guard<std::mutex> oGuardJobs(psWT->m_oJobsMutex);
+            auto &aoJobs = psWT->m_aoJobs;
+            for (auto iter = aoJobs.rbegin(); iter != aoJobs.rend(); ++iter)
+            {
+                if (iter->poQueue == poQueue)
+                {
+                    sJob = *iter;
+                    aoJobs.erase(std::next(iter).base());
+                    m_nQueuedJobs--;
+                    bGotJob = true;
+                    break;
+                }
+            }
+        }
+        if (!bGotJob && !TakeJob(psWT, poQueue, sJob))
+            return 0;
+    }
+
+    sJob.pfnFunc(sJob.pData);
+    DeclareJobFinished();
+    return 1;
+}
+
 /************************************************************************/
 /*                         CreateJobQueue()                             */
 /************************************************************************/
@@ -647,7 +843,8 @@ void CPLJobQueue::DeclareJobFinished()
 {
     std::lock_guard<std::mutex> oGuard(m_mutex);
     m_nPendingJobs--;
-    m_cv.notify_one();
+    // Several threads may be waiting in WaitCompletion()
+    m_cv.notify_all();
 }
 
 /************************************************************************/
@@ -670,7 +867,7 @@ bool CPLJobQueue::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
         std::lock_guard<std::mutex> oGuard(m_mutex);
         m_nPendingJobs++;
     }
-    bool bRet = m_poPool->SubmitJob(JobQueueFunction, poJob);
+    bool bRet = m_poPool->SubmitJob(JobQueueFunction, poJob, this);
     if (!bRet)
     {
         delete poJob;
@@ -690,6 +887,7 @@ bool CPLJobQueue::SubmitJob(CPLThreadFunc pfnFunc, void *pData)
  */
 void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
 {
+    CPLThreadBudgetTokenLender oTokenLender;
     std::unique_lock<std::mutex> oGuard(m_mutex);
     // coverity[missing_lock:FALSE]
     while (m_nPendingJobs > nMaxRemainingJobs)
@@ -697,3 +895,54 @@ void CPLJobQueue::WaitCompletion(int nMaxRemainingJobs)
         m_cv.wait(oGuard);
     }
 }
+
+/************************************************************************/
+/*                  RunPendingJobsAndWaitCompletion()                   */
+/************************************************************************/
+
+/** Wait for completion of part or whole jobs, running in the calling thread
+ * the jobs of this queue that have not been started yet.
+ *
+ * Contrary to WaitCompletion(), jobs may be run in the calling thread, so
+ * the caller must not hold locks or per-thread state that the jobs also use.
+ * This is useful for a job that submits sub-jobs and waits for them, as it
+ * makes progress on its own sub-jobs rather than blocking a pool thread.
+ *
+ * @param nMaxRemainingJobs Maximum number of pendings jobs that are allowed
+ *                          in the queue after this method has completed. Might
+ * be 0 to wait for all jobs.
+ * @since GDAL 3.10
+ */
+void CPLJobQueue::RunPendingJobsAndWaitCompletion(int nMaxRemainingJobs)
+{
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> oGuard(m_mutex);
+            // coverity[missing_lock:FALSE]
+            if (m_nPendingJobs <= nMaxRemainingJobs)
+                return;
+        }
+
+        const int nRet = m_poPool->RunPendingJob(this);
+        if (nRet <= 0)
+        {
+            CPLThreadBudgetTokenLender oTokenLender;
+            std::unique_lock<std::mutex> oGuard(m_mutex);
+            // coverity[missing_lock:FALSE]
+            if (m_nPendingJobs > nMaxRemainingJobs)
+            {
+                if (nRet == 0)
+                {
+                    m_cv.wait(oGuard);
+                }
+                else
+                {
+                    // Worker threads are being woken up for the queued jobs.
+                    // Check again shortly whether they have picked them.
+                    m_cv.wait_for(oGuard, std::chrono::milliseconds(1));
+                }
+            }
+        }
+    }
+}
@@ -33,7 +33,10 @@
 #include "cpl_multiproc.h"
 #include "cpl_list.h"
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -46,9 +49,16 @@
  */
 
 #ifndef DOXYGEN_SKIP
-struct CPLWorkerThreadJob;
+class CPLJobQueue;
 class CPLWorkerThreadPool;
 
+struct CPLWorkerThreadJob
+{
+    CPLThreadFunc pfnFunc = nullptr;
+    void *pData = nullptr;
+    CPLJobQueue *poQueue = nullptr;
+};
+
 struct CPLWorkerThread
 {
     CPL_DISALLOW_COPY_ASSIGN(CPLWorkerThread)
@@ -59,9 +69,15 @@ struct CPLWorkerThread
     CPLWorkerThreadPool *poTP = nullptr;
     CPLJoinableThread *hThread = nullptr;
     bool bMarkedAsWaiting = false;
+    bool bWokenUp = false;
 
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
+
+    // Jobs submitted from this thread. The owner pops from the back, other
+    // threads steal from the front.
+    std::mutex m_oJobsMutex{};
+    std::deque<CPLWorkerThreadJob> m_aoJobs{};
 };
 
 typedef enum
@@ -72,29 +88,41 @@ typedef enum
 } CPLWorkerThreadState;
 #endif  // ndef DOXYGEN_SKIP
 
-class CPLJobQueue;
-
 /** Pool of worker threads */
 class CPL_DLL CPLWorkerThreadPool
 {
     CPL_DISALLOW_COPY_ASSIGN(CPLWorkerThreadPool)
 
+    friend class CPLJobQueue;
+
     std::vector<std::unique_ptr<CPLWorkerThread>> aWT{};
     std::mutex m_mutex{};
     std::condition_variable m_cv{};
     volatile CPLWorkerThreadState eState = CPLWTS_OK;
-    CPLList *psJobQueue = nullptr;
+    // Jobs submitted from threads that are not worker threads of this pool
+    std::deque<CPLWorkerThreadJob> m_aoJobs{};
     int nPendingJobs = 0;
+    // Number of jobs in m_aoJobs and in the deques of the worker threads
+    std::atomic<int> m_nQueuedJobs{0};
 
     CPLList *psWaitingWorkerThreadsList = nullptr;
     int nWaitingWorkerThreads = 0;
+    // Number of worker threads that have been woken up or started, but have
+    // not yet looked for a job
+    int m_nWakingWorkerThreads = 0;
 
     int m_nMaxThreads = 0;
 
     static void WorkerThreadFunction(void *user_data);
 
     void DeclareJobFinished();
-    CPLWorkerThreadJob *GetNextJob(CPLWorkerThread *psWorkerThread);
+    bool GetNextJob(CPLWorkerThread *psWorkerThread, CPLWorkerThreadJob &sJob);
+    bool TakeJob(CPLWorkerThread *psExcludedWorkerThread, CPLJobQueue *poQueue,
+                 CPLWorkerThreadJob &sJob);
+    bool StartThread(CPLThreadFunc pfnInitFunc, void *pInitData);
+    void WakeUpWaitingWorkerThread(std::unique_lock<std::mutex> &oGuard);
+    bool SubmitJob(CPLThreadFunc pfnFunc, void *pData, CPLJobQueue *poQueue);
+    int RunPendingJob(CPLJobQueue *poQueue);
 
   public:
     CPLWorkerThreadPool();
@@ -147,6 +175,67 @@ class CPL_DLL CPLJobQueue
 
     bool SubmitJob(CPLThreadFunc pfnFunc, void *pData);
     void WaitCompletion(int nMaxRemainingJobs = 0);
+    void RunPendingJobsAndWaitCompletion(int nMaxRemainingJobs = 0);
 };
 
+/** Call pfnFunc(iJob, iStart, iEnd) on nJobs contiguous ranges
+ * [iStart, iEnd[ that partition [0, nCount[, in worker threads of
+ * poJobQueue, and wait for their completion.
+ *
+ * The number of jobs is capped to nCount, so that ranges are never empty,
+ * and iJob is in [0, nJobs[, which can be used to index per-job scratch
+ * buffers. If poJobQueue is null or if there is a single job,
+ * pfnFunc(0, 0, nCount) is called in the calling thread.
+ *
+ * @param poJobQueue Job queue, or nullptr.
+ * @param nJobs Maximum number of jobs.
+ * @param nCount Number of elements to process.
+ * @param pfnFunc Function, or lambda, called with (int iJob, T iStart, T iEnd).
+ * @since GDAL 3.10
+ */
+template <class T, class Func>
+void CPLJobQueueRunRanges(CPLJobQueue *poJobQueue, int nJobs, T nCount,
+                          const Func &pfnFunc)
+{
+    if (nCount < static_cast<T>(nJobs))
+        nJobs = static_cast<int>(nCount);
+    if (poJobQueue == nullptr || nJobs <= 1)
+    {
+        pfnFunc(0, static_cast<T>(0), nCount);
+        return;
+    }
+
+    struct Job
+    {
+        const Func *pfnFunc;
+        int iJob;
+        T iStart;
+        T iEnd;
+    };
+
+    std::vector<Job> asJobs(nJobs);
+    for (int iJob = 0; iJob < nJobs; ++iJob)
+    {
+        Job &sJob = asJobs[iJob];
+        sJob.pfnFunc = &pfnFunc;
+        sJob.iJob = iJob;
+        sJob.iStart = static_cast<T>(static_cast<uint64_t>(nCount) * iJob /
+                                     static_cast<uint64_t>(nJobs));
+        sJob.iEnd = static_cast<T>(static_cast<uint64_t>(nCount) * (iJob + 1) /
+                                   static_cast<uint64_t>(nJobs));
+        if (!poJobQueue->SubmitJob(
+                [](void *pData)
+                {
+                    const Job *psJob = static_cast<const Job *>(pData);
+                    (*psJob->pfnFunc)(psJob->iJob, psJob->iStart,
+                                      psJob->iEnd);
+                },
+                &sJob))
+        {
+            pfnFunc(iJob, sJob.iStart, sJob.iEnd);
+        }
+    }
+    poJobQueue->WaitCompletion();
+}
+
 #endif  // CPL_WORKER_THREAD_POOL_H_INCLUDED_
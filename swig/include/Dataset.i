@@ -833,6 +833,10 @@ CPLErr AdviseRead(  int xoff, int yoff, int xsize, int ysize,
     return GDALDatasetIsLayerPrivate(self, index);
   }
 
+  bool IsThreadSafe( int scopeFlags ) {
+    return GDALDatasetIsThreadSafe(self, scopeFlags, NULL);
+  }
+
 
 
 
@@ -839,6 +839,61 @@ public:
     }
     return CE_None;
   }
+
+%apply Pointer NONNULL {GDALExtendedDataTypeHS* buffer_datatype};
+%apply ( void **outPythonObject ) { (void **buf ) };
+%apply (int nList, GUIntBig* pList) {(int nIndices, GUIntBig *indices)};
+  CPLErr ReadPoints( int nIndices, GUIntBig* indices,
+                     GDALExtendedDataTypeHS* buffer_datatype,
+                     void **buf) {
+    *buf = NULL;
+
+    const int nExpectedDims = (int)GDALMDArrayGetDimensionCount(self);
+    if( nExpectedDims == 0 || (nIndices % nExpectedDims) != 0 )
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+            "Number of values in indices should be a multiple of the number of dimensions");
+        return CE_Failure;
+    }
+    if( GDALExtendedDataTypeGetClass(buffer_datatype) != GEDTC_NUMERIC )
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+            "Only numeric data types are supported");
+        return CE_Failure;
+    }
+    const size_t nPoints = (size_t)(nIndices / nExpectedDims);
+    const size_t buf_size = nPoints * GDALExtendedDataTypeGetSize(buffer_datatype);
+
+    SWIG_PYTHON_THREAD_BEGIN_BLOCK;
+    *buf = (void *)PyByteArray_FromStringAndSize( NULL, buf_size );
+    if (*buf == NULL)
+    {
+        *buf = Py_None;
+        if( !GetUseExceptions() )
+        {
+            PyErr_Clear();
+        }
+        SWIG_PYTHON_THREAD_END_BLOCK;
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Cannot allocate result buffer");
+        return CE_Failure;
+    }
+    char *data = PyByteArray_AsString( (PyObject *)*buf );
+    SWIG_PYTHON_THREAD_END_BLOCK;
+
+    CPLErr eErr = GDALMDArrayReadPoints( self, nPoints, indices,
+                                         buffer_datatype, data ) ? CE_None : CE_Failure;
+    if (eErr == CE_Failure)
+    {
+        SWIG_PYTHON_THREAD_BEGIN_BLOCK;
+        Py_DECREF((PyObject*)*buf);
+        SWIG_PYTHON_THREAD_END_BLOCK;
+        *buf = NULL;
+    }
+
+    return eErr;
+  }
+%clear (void **buf );
+%clear (int nIndices, GUIntBig *indices);
 #endif
 
 %newobject GetAttribute;
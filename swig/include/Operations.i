@@ -382,6 +382,31 @@ int  SieveFilter( GDALRasterBandShadow *srcBand,
 %}
 %clear GDALRasterBandShadow *srcBand, GDALRasterBandShadow *dstBand;
 
+/************************************************************************/
+/*                          ZonalStatistics()                           */
+/************************************************************************/
+
+%apply Pointer NONNULL {GDALRasterBandShadow *srcBand, OGRLayerShadow *outLayer};
+#ifndef SWIGJAVA
+%feature( "kwargs" ) ZonalStatistics;
+#endif
+%inline %{
+int  ZonalStatistics( GDALRasterBandShadow *srcBand,
+                      GDALRasterBandShadow *zoneBand,
+                      OGRLayerShadow *zoneLayer,
+                      OGRLayerShadow *outLayer,
+                      char **options = NULL,
+                      GDALProgressFunc callback=NULL,
+                      void* callback_data=NULL) {
+
+    CPLErrorReset();
+
+    return GDALZonalStatistics( srcBand, zoneBand, zoneLayer, outLayer,
+                                options, callback, callback_data );
+}
+%}
+%clear GDALRasterBandShadow *srcBand, OGRLayerShadow *outLayer;
+
 /************************************************************************/
 /*                        RegenerateOverviews()                         */
 /************************************************************************/
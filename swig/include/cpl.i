@@ -711,6 +711,17 @@ bool wrapper_VSISync(const char* pszSource,
 
 bool VSIAbortPendingUploads(const char *utf8_path );
 
+%rename (PrefetchMetadata) wrapper_VSIPrefetchMetadata;
+%apply (char **options) {char ** files};
+%feature( "kwargs" ) wrapper_VSIPrefetchMetadata;
+%inline {
+bool wrapper_VSIPrefetchMetadata(char** files, char** options = NULL)
+{
+    return VSIPrefetchMetadata(files, options) != FALSE;
+}
+}
+%clear (char **files);
+
 #endif
 
 %rename (CopyFile) wrapper_VSICopyFile;
@@ -690,6 +690,16 @@ void wrapper_GDALSetCacheMax(GIntBig nBytes)
 }
 }
 
+%rename (GetCacheStatistics) wrapper_GDALGetCacheStatistics;
+%apply (char **dictAndCSLDestroy) { char ** };
+%inline {
+char **wrapper_GDALGetCacheStatistics(GDALDatasetShadow* ds = NULL)
+{
+    return GDALGetCacheStatistics(ds);
+}
+}
+%clear char **;
+
 #else
 %inline {
 int wrapper_GDALGetCacheMax()
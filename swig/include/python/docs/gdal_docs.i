@@ -24,6 +24,26 @@ int
     maximum cache size in bytes
 ";
 
+// gdal.GetCacheStatistics
+%feature("docstring") wrapper_GDALGetCacheStatistics "
+
+Return statistics on the activity of the raster block cache.
+See :cpp:func:`GDALGetCacheStatistics`.
+
+Parameters
+----------
+ds : Dataset, optional
+    dataset for which to return statistics. If not specified, global
+    statistics are returned.
+
+Returns
+-------
+dict
+    dictionary with HITS, MISSES, EVICTIONS, DIRTY_BLOCKS_FLUSHED,
+    BYTES_WRITTEN_BACK, COMPRESSED_CACHE_HITS and (for global statistics)
+    LOCK_WAIT_TIME keys, with values as strings.
+";
+
 // gdal.GetCacheUsed
 %feature("docstring") wrapper_GDALGetCacheUsed "
 
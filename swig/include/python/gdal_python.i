@@ -1819,6 +1819,37 @@ def GetMDArrayNames(self, options = []) -> "list[str]":
         buffer_datatype = self.GetDataType()
       return _gdal.MDArray_Read(self, array_start_idx, count, array_step, buffer_stride, buffer_datatype)
 
+  def ReadPoints(self, indices, buffer_datatype = None):
+      """Read the values of the array at a list of points.
+
+      Parameters
+      ----------
+      indices: list
+          List of points, each one being a sequence of GetDimensionCount()
+          indices.
+      buffer_datatype: ExtendedDataType, optional
+          Data type of the returned values (must be numeric). Defaults to the
+          data type of the array.
+
+      Returns
+      -------
+      A bytearray with the values of the points.
+
+      Notes
+      -----
+      .. versionadded:: 3.10
+      """
+      flat_indices = []
+      for point in indices:
+          if len(point) != self.GetDimensionCount():
+              raise ValueError("Each point should have GetDimensionCount() indices")
+          flat_indices += point
+      if not buffer_datatype:
+        buffer_datatype = self.GetDataType()
+      if not flat_indices:
+          return bytearray()
+      return _gdal.MDArray_ReadPoints(self, flat_indices, buffer_datatype)
+
   def ReadAsArray(self,
                   array_start_idx = None,
                   count = None,
@@ -2179,6 +2210,7 @@ def GetName(self):
 def InfoOptions(options=None, format='text', deserialize=True,
          computeMinMax=False, reportHistograms=False, reportProj4=False,
          stats=False, approxStats=False, computeChecksum=False,
+         computeHash=False,
          showGCPs=True, showMetadata=True, showRAT=True, showColorTable=True,
          listMDD=False, showFileList=True, allMetadata=False,
          extraMDDomains=None, wktFormat=None):
@@ -2213,6 +2245,8 @@ def InfoOptions(options=None, format='text', deserialize=True,
             new_options += ['-approx_stats']
         if computeChecksum:
             new_options += ['-checksum']
+        if computeHash:
+            new_options += ['-hash']
         if not showGCPs:
             new_options += ['-nogcp']
         if not showMetadata:
@@ -3569,7 +3603,7 @@ def DEMProcessing(destName, srcDS, processing, **kwargs):
 def NearblackOptions(options=None, format=None,
          creationOptions=None, white = False, colors=None,
          maxNonBlack=None, nearDist=None, setAlpha = False, setMask = False,
-         alg=None,
+         alg=None, numThreads=None,
          callback=None, callback_data=None):
     """Create a NearblackOptions() object that can be passed to gdal.Nearblack()
 
@@ -3595,6 +3629,8 @@ def NearblackOptions(options=None, format=None,
         adds a mask band to the output file.
     alg:
         "twopasses" (default), or "floodfill"
+    numThreads:
+        number of threads, or "ALL_CPUS"
     callback:
         callback method
     callback_data:
@@ -3641,6 +3677,8 @@ def NearblackOptions(options=None, format=None,
             new_options += ['-setmask']
         if alg:
             new_options += ['-alg', alg]
+        if numThreads is not None:
+            new_options += ['-num_threads', str(numThreads)]
 
     if return_option_list:
         return new_options
@@ -3695,6 +3733,7 @@ def GridOptions(options=None, format=None,
               zfield=None,
               z_increase=None,
               z_multiply=None,
+              tiled=False,
               callback=None, callback_data=None):
     """ Create a GridOptions() object that can be passed to gdal.Grid()
 
@@ -3740,6 +3779,9 @@ def GridOptions(options=None, format=None,
         Multiplication ratio for Z field. This can be used for shift from e.g. foot to meters
         or from  elevation to deep. The result value will be
         (Z value + Z increase value) * Z multiply value. The default value is 1.
+    tiled:
+        whether to read the points of each output block with a spatial filter,
+        instead of loading all points in memory.
     callback:
         callback method
     callback_data:
@@ -3795,6 +3837,8 @@ def GridOptions(options=None, format=None,
             new_options += ['-z_multiply', str(z_multiply)]
         if spatFilter is not None:
             new_options += ['-spat', str(spatFilter[0]), str(spatFilter[1]), str(spatFilter[2]), str(spatFilter[3])]
+        if tiled:
+            new_options += ['-tiled']
 
     if return_option_list:
         return new_options
@@ -3840,7 +3884,7 @@ def RasterizeOptions(options=None, format=None,
          bands=None, inverse=False, allTouched=False,
          burnValues=None, attribute=None, useZ=False, layers=None,
          SQLStatement=None, SQLDialect=None, where=None, optim=None,
-         add=None,
+         add=None, coverage=False,
          callback=None, callback_data=None):
     """Create a RasterizeOptions() object that can be passed to gdal.Rasterize()
 
@@ -3907,6 +3951,9 @@ def RasterizeOptions(options=None, format=None,
         optimization mode ('RASTER', 'VECTOR')
     add:
         set to True to use additive mode instead of replace when burning values
+    coverage:
+        set to True to burn polygons weighted by the exact fraction of each pixel
+        they cover (GDAL >= 3.10)
     callback:
         callback method
     callback_data:
@@ -3969,6 +4016,8 @@ def RasterizeOptions(options=None, format=None,
             new_options += ['-i']
         if allTouched:
             new_options += ['-at']
+        if coverage:
+            new_options += ['-coverage']
         if burnValues is not None:
             if attribute is not None:
                 raise Exception('burnValues and attribute option are exclusive.')
@@ -4041,6 +4090,7 @@ def FootprintOptions(options=None,
                      combineBands=None,
                      srcNodata=None,
                      ovr=None,
+                     adaptive=None,
                      targetCoordinateSystem=None,
                      dstSRS=None,
                      splitPolys=None,
@@ -4071,6 +4121,8 @@ def FootprintOptions(options=None,
         source nodata value(s).
     ovr:
         overview index.
+    adaptive:
+        whether to vectorize an overview level first, and refine the footprint at full resolution only near its boundary.
     targetCoordinateSystem:
         "pixel" or "georef"
     dstSRS:
@@ -4131,6 +4183,8 @@ def FootprintOptions(options=None,
             new_options += ['-srcnodata', str(srcNodata)]
         if ovr is not None:
             new_options += ['-ovr', str(ovr)]
+        if adaptive:
+            new_options += ["-adaptive"]
         if splitPolys:
             new_options += ["-split_polys"]
         if convexHull:
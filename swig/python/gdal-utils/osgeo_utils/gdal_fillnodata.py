@@ -230,7 +230,7 @@ class GDALFillNoData(GDALScript):
             "-interp",
             "--interpolation",
             dest="interpolation",
-            choices=["inv_dist", "nearest"],
+            choices=["inv_dist", "nearest", "pull_push"],
             help="Interpolation method.",
         )
 